@@ -204,6 +204,50 @@ else()
 
 endif()
 
+find_library(
+  NVML_LIBRARY nvidia-ml
+  PATHS
+  ${CUDA_TOOLKIT_ROOT_DIR}
+  PATH_SUFFIXES
+  lib/x86_64-linux-gnu
+  lib/x64
+  lib64
+  lib
+  lib64/stubs
+  lib/stubs
+  NO_DEFAULT_PATH
+  # We aren't going to search any system paths. We want to find the library
+  # in the CUDA toolkit we're building against.
+  )
+
+if(NOT TARGET nvml AND NVML_LIBRARY)
+
+  message(STATUS "NVML: ${NVML_LIBRARY}")
+
+  if(WIN32)
+    add_library(nvml STATIC IMPORTED GLOBAL)
+  else()
+    add_library(nvml SHARED IMPORTED GLOBAL)
+  endif()
+
+  add_library(nvidia::nvml ALIAS nvml)
+
+  set_property(
+    TARGET nvml
+    PROPERTY IMPORTED_LOCATION
+    ${NVML_LIBRARY}
+    )
+
+elseif(TARGET nvml)
+
+  message(STATUS "NVML: Already Found")
+
+else()
+
+  message(STATUS "NVML: Not Found")
+
+endif()
+
 include_directories(SYSTEM ${CUDA_INCLUDE_DIRS})
 # Some platforms (e.g. Visual Studio) don't add the CUDA include directories to the system include
 # paths by default, so we add it explicitly here.
@@ -262,12 +306,20 @@ function(cutlass_unify_source_files TARGET_ARGS_VAR)
       string(SHA256 CUDA_FILE_BATCH_HASH "${CUDA_FILE_BATCH}")
       string(SUBSTRING ${CUDA_FILE_BATCH_HASH} 0 12 CUDA_FILE_BATCH_HASH)
       set(BATCH_FILE ${CMAKE_CURRENT_BINARY_DIR}/${NAME}.unity.${CUDA_FILE_BATCH_HASH}.cu)
-      message(STATUS "Generating ${BATCH_FILE}")
-      file(WRITE ${BATCH_FILE} "// Unity File - Auto Generated!\n")
+      set(BATCH_FILE_CONTENT "// Unity File - Auto Generated!\n")
       foreach(CUDA_FILE ${CUDA_FILE_BATCH})
         get_filename_component(CUDA_FILE_ABS_PATH ${CUDA_FILE} ABSOLUTE)
-        file(APPEND ${BATCH_FILE} "#include \"${CUDA_FILE_ABS_PATH}\"\n")
+        string(APPEND BATCH_FILE_CONTENT "#include \"${CUDA_FILE_ABS_PATH}\"\n")
       endforeach()
+      # Rewrite the file only if its content changed, to avoid recompiling it on every configure
+      set(BATCH_FILE_EXISTING_CONTENT)
+      if (EXISTS ${BATCH_FILE})
+        file(READ ${BATCH_FILE} BATCH_FILE_EXISTING_CONTENT)
+      endif()
+      if (NOT BATCH_FILE_CONTENT STREQUAL BATCH_FILE_EXISTING_CONTENT)
+        message(STATUS "Generating ${BATCH_FILE}")
+        file(WRITE ${BATCH_FILE} "${BATCH_FILE_CONTENT}")
+      endif()
       list(APPEND TARGET_SOURCE_ARGS ${BATCH_FILE})
       if (NUM_CUDA_FILE_ARGS LESS_EQUAL __BATCH_SIZE)
         break()
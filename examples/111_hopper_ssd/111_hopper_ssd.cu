@@ -51,13 +51,14 @@
 
 #if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
 
-#include "reference/reference_ssd_cumsum.hpp"
 #include "reference/reference_ssd.hpp"
 
 #include "cutlass/transform/device/transform_universal_adapter.hpp"
 
-#include "device/ssd.hpp"
-#include "kernel/sm90_ssd_kernel_builder.hpp"
+#include "cutlass/experimental/ssd/device/ssd.hpp"
+#include "cutlass/experimental/ssd/kernel/sm90_ssd_kernel_builder.hpp"
+#include "cutlass/experimental/ssd/kernel/ssd_cumsum_kernel.hpp"
+#include "cutlass/experimental/ssd/kernel/ssd_decode_kernel.hpp"
 
 using namespace cute;
 
@@ -89,6 +90,8 @@ struct Options {
   int iterations;
   bool verify;
   bool verbose;
+  bool varlen;
+  bool init_state;
 
   int warmups;
   bool measure;
@@ -118,6 +121,8 @@ struct Options {
     cmd.get_cmd_line_argument("H", H, defaults.H);
     verbose = cmd.check_cmd_line_flag("verbose");
     verify = !(cmd.check_cmd_line_flag("without_verify"));
+    varlen = cmd.check_cmd_line_flag("varlen");
+    init_state = cmd.check_cmd_line_flag("init_state");
 
     EH = E*H;
 
@@ -143,6 +148,8 @@ struct Options {
       << "  --B=<int>                   Batch\n"
       << "  --E=<int>                   Expanded factor\n"
       << "  --H=<int>                   Number of heads\n"
+      << "  --varlen                    Pack the sequences along the chunk mode and pass cu_seqlens\n"
+      << "  --init_state                Start the scan from a random initial state\n"
       << "\n";
 
     return out;
@@ -153,6 +160,11 @@ struct Options {
     return cute::make_tuple(G, B, EH, C, L, D, N);
   }
 
+  // Number of chunks along the chunk mode of the sequence tensors
+  int packed_chunks() const {
+    return varlen ? B * int(C) : int(C);
+  }
+
   // acceptable layout by cuDNN
   // x       [b, eh, d, c, l]
   // delta   [b, eh, c, l]
@@ -161,35 +173,41 @@ struct Options {
   // C       [b,  g, n, c, l]
   // y       [b, eh, d, c, l]
   // fstate  [b, eh, d, n]
+  //
+  // With --varlen the sequences are packed along the chunk mode instead, e.g. x [eh, d, (b, c), l],
+  // and the layouts below view the packed tensors with the batched coordinates.
 
   auto layoutX() const {
-    auto layout = make_layout(make_shape(L, C, D, EH, B));
-    return make_layout(reverse(layout.shape()), reverse(layout.stride()));
+    int c_total = packed_chunks();
+    return make_layout(
+      make_shape(B, EH, D, C, L),
+      make_stride(varlen ? int(C * L) : int(EH * D * C * L), int(D * c_total * L), int(c_total * L), L, _1{}));
   }
 
   auto layoutDelta() const {
-    auto layout = make_layout(make_shape(L, C, EH, B));
-    return make_layout(reverse(layout.shape()), reverse(layout.stride()));
+    int c_total = packed_chunks();
+    return make_layout(
+      make_shape(B, EH, C, L),
+      make_stride(varlen ? int(C * L) : int(EH * C * L), int(c_total * L), L, _1{}));
   }
 
   auto layoutDeltaA() const {
-    auto layout = make_layout(make_shape(L, C, EH, B));
-    return make_layout(reverse(layout.shape()), reverse(layout.stride()));
+    return layoutDelta();
   }
 
   auto layoutB() const {
-    auto layout = make_layout(make_shape(L, C, N, G, B));
-    return make_layout(reverse(layout.shape()), reverse(layout.stride()));
+    int c_total = packed_chunks();
+    return make_layout(
+      make_shape(B, G, N, C, L),
+      make_stride(varlen ? int(C * L) : int(G * N * C * L), int(N * c_total * L), int(c_total * L), L, _1{}));
   }
 
   auto layoutC() const {
-    auto layout = make_layout(make_shape(L, C, N, G, B));
-    return make_layout(reverse(layout.shape()), reverse(layout.stride()));
+    return layoutB();
   }
 
   auto layoutY() const {
-    auto layout = make_layout(make_shape(L, C, D, EH, B));
-    return make_layout(reverse(layout.shape()), reverse(layout.stride()));
+    return layoutX();
   }
 
   auto layoutF() const {
@@ -209,66 +227,50 @@ struct Options {
   }
 
   auto layoutZ() const {
-    auto layout = make_layout(make_shape(L, C, D, EH, B));
-    return make_layout(reverse(layout.shape()), reverse(layout.stride()));
+    return layoutX();
   }
 
   // transformed layout for kernel parameters
 
+  // Batch mode of the sequence tensors, folded into the chunk mode with --varlen
+  int batch_heads() const {
+    return varlen ? EH : EH * B;
+  }
+
+  int batch_groups() const {
+    return varlen ? G : G * B;
+  }
+
   auto layoutX_transformed() const {
-    auto layout = make_layout(make_shape(L,int32_t(C),D,EH*B));
+    int c_total = packed_chunks();
     return make_layout(
-      make_shape(D,L,int32_t(C),EH*B),
-      make_stride(
-        stride<2>(layout),
-        stride<0>(layout),
-        stride<1>(layout),
-        stride<3>(layout)
-      )
-    );
+      make_shape(D, L, c_total, batch_heads()),
+      make_stride(int(c_total * L), _1{}, L, int(D * c_total * L)));
   }
 
   auto layoutB_transformed() const {
-    auto layout = make_layout(make_shape(L,int32_t(C),N,G*B));
+    int c_total = packed_chunks();
     return make_layout(
-      make_shape(L,N,int32_t(C),G*B),
-      make_stride(
-        stride<0>(layout),
-        stride<2>(layout),
-        stride<1>(layout),
-        stride<3>(layout)
-      )
-    );
+      make_shape(L, N, c_total, batch_groups()),
+      make_stride(_1{}, int(c_total * L), L, int(N * c_total * L)));
   }
 
   auto layoutC_transformed() const {
-    auto layout = make_layout(make_shape(L,int32_t(C),N,G*B));
-    return make_layout(
-      make_shape(L,N,int32_t(C),G*B),
-      make_stride(
-        stride<0>(layout),
-        stride<2>(layout),
-        stride<1>(layout),
-        stride<3>(layout)
-      )
-    );
+    return layoutB_transformed();
   }
 
   auto layoutDelta_transformed() const {
-    return make_layout(make_shape(L,int32_t(C),EH*B));
+    int c_total = packed_chunks();
+    return make_layout(
+      make_shape(L, c_total, batch_heads()),
+      make_stride(_1{}, L, int(c_total * L)));
   }
 
   auto layoutY_transformed() const {
-    auto layout = make_layout(make_shape(L,int32_t(C),D,EH*B));
+    int c_total = packed_chunks();
     return make_layout(
-      make_shape(L,D,int32_t(C),EH*B), // (M,K,L,...)
-      make_stride(
-        stride<0>(layout),
-        stride<2>(layout),
-        stride<1>(layout),
-        stride<3>(layout)
-      )
-    );
+      make_shape(L, D, c_total, batch_heads()), // (M,K,L,...)
+      make_stride(_1{}, int(c_total * L), L, int(D * c_total * L)));
   }
 
   auto layoutF_transformed() const {
@@ -293,16 +295,7 @@ struct Options {
   }
 
   auto layoutZ_transformed() const {
-    auto layout = make_layout(make_shape(L,int32_t(C),D,EH*B));
-    return make_layout(
-      make_shape(L,D,int32_t(C),EH*B),
-      make_stride(
-        stride<0>(layout),
-        stride<2>(layout),
-        stride<1>(layout),
-        stride<3>(layout)
-      )
-    );
+    return layoutY_transformed();
   }
 
 };
@@ -363,6 +356,8 @@ struct TestBed {
   thrust::universal_vector<Element> tensor_F;
   thrust::universal_vector<Element> tensor_F_ref_0;
   thrust::universal_vector<Element> tensor_F_ref_1;
+  thrust::universal_vector<Element> tensor_S;
+  thrust::universal_vector<int> cu_seqlens;
 
   cutlass::Distribution::Kind init_X      = cutlass::Distribution::Uniform;
   cutlass::Distribution::Kind init_DeltaA = cutlass::Distribution::Gaussian;
@@ -379,6 +374,8 @@ struct TestBed {
     >::Kernel>;
   using CumsumKenrel = cutlass::ssd::kernel::CumsumKernel<Element, ElementDA, TileShape>;
   using CumsumOperation = cutlass::transform::device::TransformUniversalAdapter<CumsumKenrel>;
+  using DecodeKernel = cutlass::ssd::kernel::SsdDecodeKernel<Element, ElementDA, ElementAcc, Option::HAS_D, Option::HAS_Z>;
+  using DecodeOperation = cutlass::transform::device::TransformUniversalAdapter<DecodeKernel>;
 
   bool initialize(Options const& options, const cutlass::KernelHardwareInfo& hw_info, uint64_t seed = 2023) {
     auto [g, b, eh, c, l, d, n] = options.get_problem_shape();
@@ -405,6 +402,7 @@ struct TestBed {
     tensor_F      .resize(sizeof(Element) * size(options.layoutF()));
     tensor_F_ref_0.resize(sizeof(Element) * size(options.layoutF()));
     tensor_F_ref_1.resize(sizeof(Element) * size(options.layoutF()));
+    tensor_S      .resize(sizeof(Element) * size(options.layoutF()));
 
     tensor_DeltaA_cumsum.resize(sizeof(ElementDA) * size(options.layoutDeltaA()));
 
@@ -416,6 +414,13 @@ struct TestBed {
     initialize_values(tensor_C, init_C, seed + 7);
     initialize_values(tensor_D, init_C, seed + 9);
     initialize_values(tensor_Z, init_X, seed);
+    initialize_values(tensor_S, options.init_state ? init_X : cutlass::Distribution::AllZeros, seed + 11);
+
+    // Equal length sequences starting on chunk boundaries of the packed chunk mode
+    cu_seqlens.resize(b + 1);
+    for (int i = 0; i <= b; ++i) {
+      cu_seqlens[i] = i * c * l;
+    }
 
     cudaError_t result;
     result = cudaDeviceSynchronize();
@@ -425,8 +430,9 @@ struct TestBed {
     }
 
     // apply cumsum(device) before kernel launch
+    // The packed chunk mode of --varlen is scanned as a single batch
     typename CumsumOperation::Arguments arguments{
-      make_shape(int(b), int(eh), int(c), int(l)),
+      options.varlen ? make_shape(1, int(eh), options.packed_chunks(), int(l)) : make_shape(int(b), int(eh), int(c), int(l)),
       {
         tensor_DeltaA.data().get(),
         tensor_DeltaA_cumsum.data().get(),
@@ -541,7 +547,7 @@ struct TestBed {
 
     auto [g, b, eh, c, l, d, n] = options.get_problem_shape();
     typename SsdOperation::Arguments arguments{
-      make_shape(int(g), int(b), int(eh), int(c), int(l), int(d), int(n)),
+      make_shape(int(g), int(b), int(eh), options.packed_chunks(), int(l), int(d), int(n)),
       { 
         tensor_X.data().get(),
         tensor_DeltaA_cumsum.data().get(),
@@ -551,7 +557,9 @@ struct TestBed {
         options.layoutX_transformed(),
         options.layoutB_transformed(),
         options.layoutC_transformed(),
-        options.layoutDelta_transformed()
+        options.layoutDelta_transformed(),
+        options.init_state ? tensor_S.data().get() : nullptr,
+        options.layoutF_transformed()
       },
       { 
         tensor_Y.data().get(),
@@ -563,7 +571,8 @@ struct TestBed {
         options.layoutD_transformed(),
         options.layoutZ_transformed()
       },
-      hw_info
+      hw_info,
+      options.varlen ? cu_seqlens.data().get() : nullptr
     };
 
     SsdOperation op;
@@ -663,6 +672,7 @@ struct TestBed {
     auto mZ       = cute::make_tensor(tensor_Z.data().get(),       options.layoutZ());
     auto mDelta   = cute::make_tensor(tensor_Delta.data().get(),   options.layoutDelta());
     auto mDeltaA  = cute::make_tensor(tensor_DeltaA.data().get(),  options.layoutDeltaA());
+    auto mS       = cute::make_tensor(tensor_S.data().get(),       options.layoutF());
 
     // Reference Device kernel
     if (options.verify) {
@@ -676,6 +686,7 @@ struct TestBed {
         mC,
         mD,
         mZ,
+        mS,
         options
       );
     }
@@ -687,11 +698,112 @@ struct TestBed {
       passed &= compare_reference<5>(mY_ref_1, mY_res);
       printf("[TensorF]verifying...\n");
       passed &= compare_reference<4>(mF_ref_1, mF_res);
+      printf("[Decode]verifying...\n");
+      passed &= verify_decode(options, hw_info);
     }
 
     return passed;
   }
 
+  // Advances the final state of the scan by one token and checks it against a host reference
+  bool verify_decode(Options const& options, const cutlass::KernelHardwareInfo& hw_info, uint64_t seed = 2025) {
+    auto [g, b, eh, c, l, d, n] = options.get_problem_shape();
+
+    thrust::universal_vector<Element> tensor_X_dec(d * eh * b);
+    thrust::universal_vector<Element> tensor_Z_dec(d * eh * b);
+    thrust::universal_vector<Element> tensor_Y_dec(d * eh * b);
+    thrust::universal_vector<Element> tensor_Delta_dec(eh * b);
+    thrust::universal_vector<ElementDA> tensor_DeltaA_dec(eh * b);
+    thrust::universal_vector<Element> tensor_B_dec(n * g * b);
+    thrust::universal_vector<Element> tensor_C_dec(n * g * b);
+    thrust::universal_vector<Element> tensor_State(tensor_F);
+
+    initialize_values(tensor_X_dec, init_X, seed);
+    initialize_values(tensor_Z_dec, init_X, seed + 1);
+    initialize_values(tensor_Delta_dec, init_Delta, seed + 3, Element(0.05f));
+    initialize_values(tensor_DeltaA_dec, init_DeltaA, seed + 5, ElementDA(0.05f));
+    initialize_values(tensor_B_dec, init_B, seed + 7);
+    initialize_values(tensor_C_dec, init_C, seed + 9);
+    cudaDeviceSynchronize();
+
+    auto layout_D = options.layoutD();
+    typename DecodeOperation::Arguments arguments{
+      make_shape(int(g), int(b), int(eh), int(d), int(n)),
+      {
+        tensor_X_dec.data().get(),
+        tensor_DeltaA_dec.data().get(),
+        tensor_Delta_dec.data().get(),
+        tensor_B_dec.data().get(),
+        tensor_C_dec.data().get(),
+        tensor_D.data().get(),
+        tensor_Z_dec.data().get(),
+        tensor_Y_dec.data().get(),
+        tensor_State.data().get(),
+        make_layout(make_shape(int(d), int(eh * b)), make_stride(_1{}, int(d))),
+        make_layout(make_shape(int(n), int(g * b)), make_stride(_1{}, int(n))),
+        make_layout(make_shape(int(eh * b)), make_stride(1)),
+        make_layout(make_shape(int(d), int(eh)),
+                    make_stride(Option::D_HAS_HDIM ? int(stride<1>(layout_D)) : 0, int(stride<0>(layout_D)))),
+        make_layout(make_shape(int(d), int(n), int(eh * b)), make_stride(int(n), _1{}, int(d * n)))
+      },
+      hw_info
+    };
+
+    DecodeOperation op;
+    if (op.can_implement(arguments) != cutlass::Status::kSuccess ||
+        op.initialize(arguments) != cutlass::Status::kSuccess ||
+        op.run() != cutlass::Status::kSuccess) {
+      std::cerr << "Failed to launch the decode kernel. Last CUDA error is: "
+                << cudaGetErrorString(cudaGetLastError()) << std::endl;
+      return false;
+    }
+    cudaError_t result = cudaDeviceSynchronize();
+    if (result != cudaSuccess) {
+      std::cerr << "Error running the decode kernel. Last CUDA error is: "
+                << cudaGetErrorString(result) << std::endl;
+      return false;
+    }
+
+    auto mF = cute::make_tensor(tensor_F.data().get(), options.layoutF());
+    auto mD = cute::make_tensor(tensor_D.data().get(), layout_D);
+    int group_ratio = eh / g;
+    for (int bi = 0; bi < b; ++bi) {
+      for (int ehi = 0; ehi < eh; ++ehi) {
+        int blk = bi * eh + ehi;
+        int gi = ehi / group_ratio;
+        float delta = static_cast<float>(tensor_Delta_dec[blk]);
+        float decay = expf(static_cast<float>(tensor_DeltaA_dec[blk]));
+        for (int di = 0; di < d; ++di) {
+          float x = static_cast<float>(tensor_X_dec[blk * d + di]);
+          float y = 0.f;
+          for (int ni = 0; ni < n; ++ni) {
+            float s = decay * static_cast<float>(mF(bi,ehi,di,ni)) +
+                      delta * x * static_cast<float>(tensor_B_dec[(bi * g + gi) * n + ni]);
+            y += s * static_cast<float>(tensor_C_dec[(bi * g + gi) * n + ni]);
+            float act = static_cast<float>(tensor_State[blk * d * n + di * n + ni]);
+            if (std::abs(act - s) > 0.05f * std::max(1.f, std::abs(s))) {
+              printf("state [%d, %d, %d, %d] %f, %f\n", bi, ehi, di, ni, s, act);
+              return false;
+            }
+          }
+          if constexpr (Option::HAS_D) {
+            y += static_cast<float>(mD(ehi, Option::D_HAS_HDIM ? di : 0)) * x;
+          }
+          if constexpr (Option::HAS_Z) {
+            float z = static_cast<float>(tensor_Z_dec[blk * d + di]);
+            y = y * z / (1.f + expf(-z));
+          }
+          float act = static_cast<float>(tensor_Y_dec[blk * d + di]);
+          if (std::abs(act - y) > 0.05f * std::max(1.f, std::abs(y))) {
+            printf("y [%d, %d, %d] %f, %f\n", bi, ehi, di, y, act);
+            return false;
+          }
+        }
+      }
+    }
+    return true;
+  }
+
   template<
     int TensorDim,
     class Engine, class Layout
@@ -164,12 +164,13 @@ template<
   class TensorC,
   class TensorD,
   class TensorZ,
+  class TensorS,
   class Params
 >
 void ssd_reference_impl(
     TensorY mY, TensorF mF,
     TensorX mX, TensorDelta mDelta, TensorDeltaA mDeltaA,
-    TensorB mB, TensorC mC, TensorD mD, TensorZ mZ,
+    TensorB mB, TensorC mC, TensorD mD, TensorZ mZ, TensorS mS,
     Params params) {
 
   using namespace cute;
@@ -183,6 +184,7 @@ void ssd_reference_impl(
   // C       [b,  g, n, c, l]
   // y       [b, eh, d, c, l]
   // fstate  [b, eh, d, n]
+  // istate  [b, eh, d, n]
   // d       [   eh, d]
   auto [G, B, EH, C, L, D, N] = params.get_problem_shape();
   int group_ratio = EH / G;
@@ -198,6 +200,7 @@ void ssd_reference_impl(
       auto tC      = mC(b,g,_,_,_);
       auto tD      = mD(eh,_);
       auto tZ      = mZ(b,eh,_,_,_);
+      auto tS      = mS(b,eh,_,_);
       // IntraBMM1 BxC, LxLxN, NT
       // B: [n, c, l]
       // C: [n, c, l]
@@ -257,7 +260,7 @@ void ssd_reference_impl(
         for (int ni = 0; ni < N; ++ ni){
           for (int di = 0; di < D; ++di) {
             if (ci == 0) {
-              tInterBMM2_inp(ci, ni, di) = 0;
+              tInterBMM2_inp(ci, ni, di) = static_cast<float>(tS(di, ni));
             }
             else {
               tInterBMM2_inp(ci, ni, di) = tInterBMM1_out(ci - 1, ni, di) + expf(tLast(ci - 1)) * tInterBMM2_inp(ci - 1, ni, di);
@@ -328,14 +331,15 @@ template<
   class TensorC,
   class TensorD,
   class TensorZ,
+  class TensorS,
   class Params
 >
 void ssd_reference(
     TensorY mY, TensorF mF,
     TensorX mX, TensorDelta mDelta, TensorDeltaA mDeltaA,
-    TensorB mB, TensorC mC, TensorD mD, TensorZ mZ,
+    TensorB mB, TensorC mC, TensorD mD, TensorZ mZ, TensorS mS,
     Params params) {
-  ssd_reference_impl<HAS_D, D_HAS_HDIM, HAS_Z>(mY, mF, mX, mDelta, mDeltaA, mB, mC, mD, mZ, params);
+  ssd_reference_impl<HAS_D, D_HAS_HDIM, HAS_Z>(mY, mF, mX, mDelta, mDeltaA, mB, mC, mD, mZ, mS, params);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -42,10 +42,12 @@
 
 #include "cute/tensor.hpp"
 #include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder_gated.hpp"
 #include "cutlass/epilogue/fusion/operations.hpp"
 #include "cutlass/epilogue/thread/activation.h"
 #include "cutlass/gemm/dispatch_policy.hpp"
 #include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/gemm/collective/collective_builder_gated.hpp"
 #include "cutlass/gemm/device/gemm_universal_adapter.h"
 #include "cutlass/gemm/kernel/gemm_universal.hpp"
 #include "cutlass/gemm/kernel/tile_scheduler_params.h"
@@ -60,8 +62,6 @@
 #include "helper.h"
 #include "options.hpp"
 #include "utils.hpp"
-#include "gated_stride.hpp"
-#include "gated_builder.hpp"
 #include "activation_kernel.cuh"
 
 using namespace cute;
@@ -134,8 +134,8 @@ using KernelSchedule   = conditional_t<Pingpong, KernelSchedulePingpong, KernelS
 using EpilogueSchedule = conditional_t<Pingpong, cutlass::epilogue::TmaWarpSpecialized, cutlass::epilogue::TmaWarpSpecializedCooperative>;
 using TileShape        = conditional_t<Pingpong, Shape<_128,_128,TileShapeK>, Shape<_128,_256,TileShapeK>>;
 
-using CollectiveEpilogue = typename cutlass::epilogue::collective::Sm90CollectiveBuilderGated<
-  OperatorClass,
+using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilderGated<
+  cutlass::arch::Sm90, OperatorClass,
   TileShape, ClusterShape,
   EpiTileShape,
   ElementAccumulator, ElementCompute, ElementScalar,
@@ -147,8 +147,8 @@ using CollectiveEpilogue = typename cutlass::epilogue::collective::Sm90Collectiv
   Quantize
 >::CollectiveOp;
 
-using CollectiveMainloop = typename cutlass::gemm::collective::Sm90CollectiveBuilderGated<
-  OperatorClass,
+using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilderGated<
+  cutlass::arch::Sm90, OperatorClass,
   ElementA, LayoutA, AlignmentA,
   ElementB, LayoutB, AlignmentB,
   ElementAccumulator,
@@ -43,11 +43,13 @@
 
 #include "cutlass/cutlass.h"
 #include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder_gated.hpp"
 #include "cutlass/epilogue/fusion/operations.hpp"
 #include "cutlass/epilogue/thread/activation.h"
 #include "cutlass/gemm/dispatch_policy.hpp"
 #include "cutlass/gemm/group_array_problem_shape.hpp"
 #include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/gemm/collective/collective_builder_gated.hpp"
 #include "cutlass/gemm/kernel/gemm_universal.hpp"
 #include "cutlass/gemm/device/gemm_universal_adapter.h"
 
@@ -62,8 +64,6 @@
 #include "options.hpp"
 #include "utils.hpp"
 #include "tile_scheduler_group.hpp"
-#include "gated_stride.hpp"
-#include "gated_builder.hpp"
 #include "activation_kernel.cuh"
 
 using namespace cute;
@@ -151,8 +151,8 @@ using TileShape        = conditional_t<Pingpong, Shape<_128,_128,TileShapeK>, Sh
 
 // Gated GEMM setup
 
-using CollectiveEpilogue = typename cutlass::epilogue::collective::Sm90CollectiveBuilderGated<
-    OperatorClass,
+using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilderGated<
+    cutlass::arch::Sm90, OperatorClass,
     TileShape, ClusterShape,
     EpiTileShape,
     ElementAccumulator, ElementCompute, ElementScalar,
@@ -164,8 +164,8 @@ using CollectiveEpilogue = typename cutlass::epilogue::collective::Sm90Collectiv
     Quantize
   >::CollectiveOp;
 
-using CollectiveMainloop = typename cutlass::gemm::collective::Sm90CollectiveBuilderGated<
-    OperatorClass,
+using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilderGated<
+    cutlass::arch::Sm90, OperatorClass,
     ElementA, LayoutA *, AlignmentA,
     ElementB, LayoutB *, AlignmentB,
     ElementAccumulator,
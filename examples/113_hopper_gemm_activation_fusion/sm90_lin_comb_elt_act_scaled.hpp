@@ -41,7 +41,7 @@
 #include "cute/tensor.hpp"
 
 #include "cutlass/epilogue/fusion/sm90_callbacks_tma_warpspecialized.hpp"       // Sm90EVT
-#include "cutlass/epilogue/fusion/sm90_visitor_load_tma_warpspecialized.hpp"    // Sm90ScalarBroadcastPtrArray
+#include "cutlass/epilogue/fusion/sm90_visitor_load_tma_warpspecialized.hpp"    // Sm90ScalarBroadcastSelector
 #include "cutlass/epilogue/fusion/sm90_visitor_store_tma_warpspecialized.hpp"   // Sm90AuxArrayStore
 #include "cutlass/epilogue/fusion/sm90_visitor_compute_tma_warpspecialized.hpp" // Sm90Compute
 
@@ -49,15 +49,6 @@
 
 namespace cutlass::epilogue::fusion {
 
-template<
-  bool PtrArray,
-  class Element,
-  class Stride>
-using Sm90ScalarBroadcastSelector = cute::conditional_t<PtrArray,
-  Sm90ScalarBroadcastPtrArray<Element, Stride>,
-  Sm90ScalarBroadcast<Element, Stride>
->;
-
 // D = activation(alpha * acc + beta * C)
 template<
   bool DoScale,
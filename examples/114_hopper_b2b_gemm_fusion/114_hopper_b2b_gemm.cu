@@ -0,0 +1,503 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Hopper back-to-back GEMM fusion with an SMEM-resident intermediate
+
+    This example fuses two GEMMs of an MLP chain into a single warp-specialized kernel:
+
+      D0 = ReLU(alpha0 * A0 * B0)             (M x N0, never written to global memory)
+      D1 = alpha1 * D0 * B1 + beta1 * C1      (M x N1)
+
+    This is the CUTLASS 3.x counterpart of examples/13_two_tensor_op_fusion. Each CTA owns a BLK_M row
+    block of both GEMMs, so N0 and N1 must fit in the N extents of the CTA tiles (up to 256 each).
+
+    1. The first GEMM reuses the SM90 TMA + WGMMA SS mainloop from the collective builder.
+
+    2. Its accumulators are scaled, activated, converted to the A operand type of the second GEMM and
+    stored into a swizzled K-major shared memory layout that WGMMA reads directly as its A operand
+    (see collective/sm90_b2b_mma_intermediate_ss.hpp).
+
+    3. The producer warp group prefetches B1 through its own TMA pipeline while the first GEMM is running,
+    so the second GEMM starts as soon as the intermediate is in shared memory.
+
+    Examples:
+
+      $ ./examples/114_hopper_b2b_gemm_fusion/114_hopper_b2b_gemm --m=16384 --n0=128 --k0=512 --n1=128
+*/
+
+#include <iostream>
+
+#include "cutlass/cutlass.h"
+
+#include "cute/tensor.hpp"
+#include "cutlass/tensor_ref.h"
+#include "cutlass/epilogue/collective/default_epilogue.hpp"
+#include "cutlass/epilogue/thread/activation.h"
+#include "cutlass/epilogue/thread/linear_combination.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+#include "cutlass/util/reference/device/gemm.h"
+#include "cutlass/util/reference/device/tensor_compare.h"
+#include "cutlass/util/reference/device/tensor_fill.h"
+#include "cutlass/util/reference/device/tensor_relu.h"
+
+#include "helper.h"
+
+#include "collective/sm90_b2b_mma_intermediate_ss.hpp"
+#include "kernel/sm90_b2b_gemm_tma_warpspecialized.hpp"
+#include "device/b2b_gemm.hpp"
+
+using namespace cute;
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// B2B GEMM kernel configurations
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// A0 matrix configuration
+using         ElementA    = cutlass::half_t;                                // Element type for A0 matrix operand
+using         LayoutA     = cutlass::layout::RowMajor;                      // Layout type for A0 matrix operand
+constexpr int AlignmentA  = 128 / cutlass::sizeof_bits<ElementA>::value;    // Memory access granularity/alignment of A0 matrix in units of elements (up to 16 bytes)
+
+// B0 and B1 matrix configuration
+using         ElementB    = cutlass::half_t;                                // Element type for B0 and B1 matrix operands
+using         LayoutB     = cutlass::layout::ColumnMajor;                   // Layout type for B0 and B1 matrix operands
+constexpr int AlignmentB  = 128 / cutlass::sizeof_bits<ElementB>::value;    // Memory access granularity/alignment of B0 and B1 matrices in units of elements (up to 16 bytes)
+
+// Intermediate D0 configuration, the A operand of the second GEMM
+using         ElementIntermediate = cutlass::half_t;                        // Element type of the SMEM-resident intermediate
+using         LayoutIntermediate  = cutlass::layout::RowMajor;              // Layout of the intermediate for the reference GEMMs
+
+// C1/D1 matrix configuration
+using         ElementC    = cutlass::half_t;                                // Element type for C1 and D1 matrix operands
+using         LayoutC     = cutlass::layout::RowMajor;                      // Layout type for C1 and D1 matrix operands
+
+// Core kernel configurations
+using ElementAccumulator  = float;                                          // Element type for internal accumulation
+using ElementCompute      = float;                                          // Element type for epilogue computation
+using ArchTag             = cutlass::arch::Sm90;                            // Tag indicating the minimum SM that supports the intended feature
+using OperatorClass       = cutlass::arch::OpClassTensorOp;                 // Operator class tag
+using TileShape0          = Shape<_128,_128,_64>;                           // CTA tile of the first GEMM, tile N0 bounds the problem N0
+using TileShape1          = Shape<_128,_128,_64>;                           // CTA tile of the second GEMM, tile N1 bounds the problem N1
+using ClusterShape        = Shape<_1,_1,_1>;                                // The intermediate is CTA resident
+constexpr int Stages1     = 2;                                              // B1 pipeline stages
+
+using StrideA = cutlass::detail::TagToStrideA_t<LayoutA>;
+using StrideB = cutlass::detail::TagToStrideB_t<LayoutB>;
+using StrideC = cutlass::detail::TagToStrideC_t<LayoutC>;
+
+using CollectiveMainloop1 = cutlass::b2b::collective::Sm90B2bMmaIntermediateSs<
+    Stages1,
+    TileShape0, TileShape1,
+    ElementIntermediate,
+    ElementB, StrideB,
+    ElementAccumulator, ElementCompute,
+    cutlass::epilogue::thread::ReLu
+  >;
+
+using CollectiveEpilogue = cutlass::epilogue::collective::DefaultEpilogue<
+    ElementC, StrideC, StrideC,
+    cutlass::epilogue::thread::LinearCombination<ElementC, 1, ElementAccumulator, ElementCompute>,
+    cutlass::gemm::EpilogueDefault
+  >;
+
+using CollectiveMainloop0 = typename cutlass::gemm::collective::CollectiveBuilder<
+    ArchTag, OperatorClass,
+    ElementA, LayoutA, AlignmentA,
+    ElementB, LayoutB, AlignmentB,
+    ElementAccumulator,
+    TileShape0, ClusterShape,
+    cutlass::gemm::collective::StageCountAutoCarveout<
+      static_cast<int>(sizeof(typename CollectiveMainloop1::SharedStorage))>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative
+  >::CollectiveOp;
+
+using B2bGemmKernel = cutlass::b2b::kernel::Sm90B2bGemmTmaWarpSpecialized<
+    CollectiveMainloop0,
+    CollectiveMainloop1,
+    CollectiveEpilogue
+  >;
+
+using B2bGemm = cutlass::b2b::device::B2bGemm<B2bGemmKernel>;
+
+// Reference device GEMM implementations
+using DeviceGemmReference0 = cutlass::reference::device::Gemm<
+  ElementA, LayoutA,
+  ElementB, LayoutB,
+  ElementIntermediate, LayoutIntermediate,
+  ElementAccumulator, ElementAccumulator>;
+
+using DeviceGemmReference1 = cutlass::reference::device::Gemm<
+  ElementIntermediate, LayoutIntermediate,
+  ElementB, LayoutB,
+  ElementC, LayoutC,
+  ElementAccumulator, ElementAccumulator>;
+
+//
+// Data members
+//
+
+/// Initialization
+StrideA stride_A0;
+StrideB stride_B0;
+StrideB stride_B1;
+StrideC stride_C1;
+StrideC stride_D1;
+uint64_t seed;
+
+cutlass::DeviceAllocation<ElementA> block_A0;
+cutlass::DeviceAllocation<ElementB> block_B0;
+cutlass::DeviceAllocation<ElementB> block_B1;
+cutlass::DeviceAllocation<ElementC> block_C1;
+cutlass::DeviceAllocation<ElementC> block_D1;
+cutlass::DeviceAllocation<ElementIntermediate> block_ref_D0;
+cutlass::DeviceAllocation<ElementC> block_ref_D1;
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Testbed utility types
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Command line options parsing
+struct Options {
+
+  bool help;
+
+  float alpha0, alpha1, beta1;
+  int iterations;
+  int m, n0, k0, n1, l;
+
+  Options():
+    help(false),
+    m(16384), n0(128), k0(512), n1(128), l(1),
+    alpha0(1.f), alpha1(1.f), beta1(0.f),
+    iterations(1000)
+  { }
+
+  // Parses the command line
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    cmd.get_cmd_line_argument("m", m);
+    cmd.get_cmd_line_argument("n0", n0);
+    cmd.get_cmd_line_argument("k0", k0);
+    cmd.get_cmd_line_argument("n1", n1);
+    cmd.get_cmd_line_argument("l", l);
+    cmd.get_cmd_line_argument("alpha0", alpha0, 1.f);
+    cmd.get_cmd_line_argument("alpha1", alpha1, 1.f);
+    cmd.get_cmd_line_argument("beta1", beta1, 0.f);
+    cmd.get_cmd_line_argument("iterations", iterations);
+  }
+
+  /// Prints the usage statement.
+  std::ostream & print_usage(std::ostream &out) const {
+
+    out << "114_hopper_b2b_gemm\n\n"
+      << "  Hopper back-to-back FP16 GEMMs with the intermediate kept in shared memory:\n"
+      << "    D1 = alpha1 * ReLU(alpha0 * A0 * B0) * B1 + beta1 * C1\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement\n\n"
+      << "  --m=<int>                   Sets the M extent of both GEMMs\n"
+      << "  --n0=<int>                  Sets the N extent of the first GEMM (at most the CTA tile N0)\n"
+      << "  --k0=<int>                  Sets the K extent of the first GEMM\n"
+      << "  --n1=<int>                  Sets the N extent of the second GEMM (at most the CTA tile N1)\n"
+      << "  --l=<int>                   Sets the batch count\n"
+      << "  --alpha0=<f32>              Scalar applied to the first GEMM before the activation\n"
+      << "  --alpha1=<f32>              Epilogue scalar alpha of the second GEMM\n"
+      << "  --beta1=<f32>               Epilogue scalar beta of the second GEMM\n\n"
+      << "  --iterations=<int>          Number of profiling iterations to perform.\n\n";
+
+    out
+      << "\n\nExamples:\n\n"
+      << "$ " << "114_hopper_b2b_gemm" << " --m=16384 --n0=128 --k0=512 --n1=64 --beta1=0.5 \n\n";
+
+    return out;
+  }
+
+  /// Compute performance in GFLOP/s
+  double gflops(double runtime_s) const
+  {
+    // Two flops per multiply-add
+    uint64_t flop = uint64_t(2) * m * l * (uint64_t(n0) * k0 + uint64_t(n1) * n0);
+    double gflop = double(flop) / double(1.0e9);
+    return gflop / runtime_s;
+  }
+};
+
+/// Result structure
+struct Result
+{
+  double avg_runtime_ms;
+  double gflops;
+  cutlass::Status status;
+  cudaError_t error;
+  bool passed;
+
+  Result(
+    double avg_runtime_ms = 0,
+    double gflops = 0,
+    cutlass::Status status = cutlass::Status::kSuccess,
+    cudaError_t error = cudaSuccess)
+  :
+    avg_runtime_ms(avg_runtime_ms), gflops(gflops), status(status), error(error), passed(false)
+  {}
+
+};
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// B2B GEMM setup and evaluation
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Helper to initialize a block of device data with small integers so that results are exact
+template <class Element>
+bool initialize_block(
+  cutlass::DeviceAllocation<Element>& block,
+  uint64_t seed=2023) {
+
+  Element scope_max = Element(2);
+  Element scope_min = Element(-2);
+
+  cutlass::reference::device::BlockFillRandomUniform(
+    block.get(), block.size(), seed, scope_max, scope_min, 0);
+
+  return true;
+}
+
+/// Initialize operands to be used in the B2B GEMM and reference GEMMs
+void initialize(const Options &options) {
+
+  stride_A0 = cutlass::make_cute_packed_stride(StrideA{}, {options.m, options.k0, options.l});
+  stride_B0 = cutlass::make_cute_packed_stride(StrideB{}, {options.n0, options.k0, options.l});
+  stride_B1 = cutlass::make_cute_packed_stride(StrideB{}, {options.n1, options.n0, options.l});
+  stride_C1 = cutlass::make_cute_packed_stride(StrideC{}, {options.m, options.n1, options.l});
+  stride_D1 = cutlass::make_cute_packed_stride(StrideC{}, {options.m, options.n1, options.l});
+
+  block_A0.reset(size_t(options.m) * options.k0 * options.l);
+  block_B0.reset(size_t(options.k0) * options.n0 * options.l);
+  block_B1.reset(size_t(options.n0) * options.n1 * options.l);
+  block_C1.reset(size_t(options.m) * options.n1 * options.l);
+  block_D1.reset(size_t(options.m) * options.n1 * options.l);
+  block_ref_D0.reset(size_t(options.m) * options.n0 * options.l);
+  block_ref_D1.reset(size_t(options.m) * options.n1 * options.l);
+
+  initialize_block(block_A0, seed + 2023);
+  initialize_block(block_B0, seed + 2022);
+  initialize_block(block_B1, seed + 2021);
+  initialize_block(block_C1, seed + 2020);
+}
+
+/// Populates a B2bGemm::Arguments structure from the given commandline options
+typename B2bGemm::Arguments args_from_options(const Options &options)
+{
+  typename B2bGemm::Arguments arguments{
+    {options.m, options.n0, options.k0, options.n1, options.l},
+    {block_A0.get(), stride_A0, block_B0.get(), stride_B0},
+    {block_B1.get(), stride_B1, options.alpha0},
+    {{options.alpha1, options.beta1}, block_C1.get(), stride_C1, block_D1.get(), stride_D1}
+  };
+
+  return arguments;
+}
+
+bool verify(const Options &options) {
+  DeviceGemmReference0 gemm_reference0;
+  DeviceGemmReference1 gemm_reference1;
+
+  // The reference materializes the intermediate in global memory, one batch at a time
+  for (int batch = 0; batch < options.l; ++batch) {
+    size_t offset_A0 = size_t(batch) * options.m * options.k0;
+    size_t offset_B0 = size_t(batch) * options.k0 * options.n0;
+    size_t offset_B1 = size_t(batch) * options.n0 * options.n1;
+    size_t offset_D0 = size_t(batch) * options.m * options.n0;
+    size_t offset_C1 = size_t(batch) * options.m * options.n1;
+
+    cutlass::TensorRef ref_A0(block_A0.get() + offset_A0, LayoutA::packed({options.m, options.k0}));
+    cutlass::TensorRef ref_B0(block_B0.get() + offset_B0, LayoutB::packed({options.k0, options.n0}));
+    cutlass::TensorRef ref_D0(block_ref_D0.get() + offset_D0, LayoutIntermediate::packed({options.m, options.n0}));
+    cutlass::TensorRef ref_B1(block_B1.get() + offset_B1, LayoutB::packed({options.n0, options.n1}));
+    cutlass::TensorRef ref_C1(block_C1.get() + offset_C1, LayoutC::packed({options.m, options.n1}));
+    cutlass::TensorRef ref_D1(block_ref_D1.get() + offset_C1, LayoutC::packed({options.m, options.n1}));
+
+    gemm_reference0(
+      {options.m, options.n0, options.k0},
+      ElementAccumulator(options.alpha0),
+      ref_A0,
+      ref_B0,
+      ElementAccumulator(0),
+      ref_D0,
+      ref_D0);
+
+    cutlass::reference::device::TensorReLu(
+      cutlass::TensorView(ref_D0.data(), ref_D0.layout(), {options.m, options.n0}));
+
+    gemm_reference1(
+      {options.m, options.n1, options.n0},
+      ElementAccumulator(options.alpha1),
+      ref_D0,
+      ref_B1,
+      ElementAccumulator(options.beta1),
+      ref_C1,
+      ref_D1);
+  }
+
+  // Wait for kernel to finish
+  CUDA_CHECK(cudaDeviceSynchronize());
+
+  // Check if output from CUTLASS kernel and reference kernel are equal or not
+  bool passed = cutlass::reference::device::BlockCompareEqual(block_ref_D1.get(), block_D1.get(), block_D1.size());
+
+  return passed;
+}
+
+/// Execute a given example B2B GEMM computation
+template <typename B2bGemm>
+int run(Options &options)
+{
+  initialize(options);
+
+  // Instantiate CUTLASS kernel depending on templates
+  B2bGemm b2b_gemm;
+
+  // Create a structure of kernel arguments suitable for invoking an instance of B2bGemm
+  auto arguments = args_from_options(options);
+
+  // Using the arguments, query for extra workspace required for the computation
+  size_t workspace_size = B2bGemm::get_workspace_size(arguments);
+
+  // Allocate workspace memory
+  cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
+
+  // Check if the problem size is supported or not
+  CUTLASS_CHECK(b2b_gemm.can_implement(arguments));
+
+  // Initialize CUTLASS kernel with arguments and workspace pointer
+  CUTLASS_CHECK(b2b_gemm.initialize(arguments, workspace.get()));
+
+  // Correctness / Warmup iteration
+  CUTLASS_CHECK(b2b_gemm.run());
+
+  // Check if output from CUTLASS kernel and reference kernel are equal or not
+  Result result;
+  result.passed = verify(options);
+
+  std::cout << "  Disposition: " << (result.passed ? "Passed" : "Failed") << std::endl;
+
+  if (!result.passed) {
+    exit(-1);
+  }
+
+  // Run profiling loop
+  if (options.iterations > 0)
+  {
+    GpuTimer timer;
+    timer.start();
+    for (int iter = 0; iter < options.iterations; ++iter) {
+      CUTLASS_CHECK(b2b_gemm.run());
+    }
+    timer.stop();
+
+    // Compute average runtime and GFLOPs.
+    float elapsed_ms = timer.elapsed_millis();
+    result.avg_runtime_ms = double(elapsed_ms) / double(options.iterations);
+    result.gflops = options.gflops(result.avg_runtime_ms / 1000.0);
+
+    std::cout << "  Problem Size: " << options.m << 'x' << options.n0 << 'x' << options.k0
+              << " -> " << options.m << 'x' << options.n1 << 'x' << options.n0
+              << " (batch " << options.l << ")" << std::endl;
+    std::cout << "  Avg runtime: " << result.avg_runtime_ms << " ms" << std::endl;
+    std::cout << "  GFLOPS: " << result.gflops << std::endl;
+  }
+
+  return 0;
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const **args) {
+
+  // CUTLASS must be compiled with CUDA 12.0 Toolkit to run this example
+  // and must have compute capability at least 90.
+  if (__CUDACC_VER_MAJOR__ < 12) {
+    std::cerr << "This example requires CUDA 12 or newer.\n";
+    // Returning zero so this test passes on older Toolkits. Its actions are no-op.
+    return 0;
+  }
+
+  cudaDeviceProp props;
+  int current_device_id;
+  CUDA_CHECK(cudaGetDevice(&current_device_id));
+  CUDA_CHECK(cudaGetDeviceProperties(&props, current_device_id));
+  if (props.major != 9 || props.minor != 0) {
+    std::cerr
+      << "This example requires a GPU of NVIDIA's Hopper Architecture (compute capability 90).\n";
+    return 0;
+  }
+
+  //
+  // Parse options
+  //
+
+  Options options;
+
+  options.parse(argc, args);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  //
+  // Evaluate CUTLASS kernels
+  //
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+  run<B2bGemm>(options);
+#endif
+
+  return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
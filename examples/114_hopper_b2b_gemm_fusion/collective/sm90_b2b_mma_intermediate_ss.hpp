@@ -0,0 +1,411 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Second GEMM of a Hopper back-to-back GEMM whose A operand is the SMEM-resident intermediate.
+
+    The accumulators of the first GEMM are scaled, passed through an activation, converted to the
+    A operand type of the second GEMM and stored into a K-major swizzled SMEM layout that WGMMA
+    consumes directly. Only the B operand of the second GEMM is streamed through a TMA pipeline.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/arch/barrier.h"
+#include "cutlass/gemm/gemm.h"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/pipeline/pipeline.hpp"
+#include "cutlass/trace.h"
+
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+#include "cute/algorithm/gemm.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::b2b::collective {
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <
+  int Stages_,
+  class TileShape0_,                  // (BLK_M, BLK_N0, BLK_K0) of the first GEMM
+  class TileShape_,                   // (BLK_M, BLK_N1, BLK_K1) of the second GEMM
+  class ElementIntermediate_,         // A operand type of the second GEMM
+  class ElementB_,
+  class StrideB_,
+  class ElementAccumulator_,
+  class ElementCompute_,
+  template <class> class Activation_, // Applied to alpha0 * accumulators of the first GEMM
+  class AtomLayoutMNK_ = Layout<Shape<_2,_1,_1>>,
+  class ClusterShape_ = Shape<_1,_1,_1>
+>
+struct Sm90B2bMmaIntermediateSs {
+  //
+  // Type Aliases
+  //
+  using TileShape0 = TileShape0_;
+  using TileShape = TileShape_;
+  using ElementA = ElementIntermediate_;
+  using ElementB = ElementB_;
+  using StrideB = StrideB_;
+  using ElementAccumulator = ElementAccumulator_;
+  using ElementCompute = ElementCompute_;
+  using Activation = Activation_<ElementCompute>;
+  using AtomLayoutMNK = AtomLayoutMNK_;
+  using ClusterShape = ClusterShape_;
+  using ArchTag = arch::Sm90;
+
+  static_assert(size(ClusterShape{}) == 1, "The intermediate is CTA resident, clusters are not supported.");
+  static_assert(size<0>(TileShape0{}) == size<0>(TileShape{}), "Both GEMMs must share the CTA tile M.");
+  static_assert(size<1>(TileShape0{}) % size<2>(TileShape{}) == 0,
+    "Tile N of the first GEMM must be a multiple of tile K of the second GEMM.");
+
+  // Number of K tiles of the second GEMM covered by the intermediate
+  static constexpr int IntermediateKTiles = size<1>(TileShape0{}) / size<2>(TileShape{});
+
+  static constexpr GMMA::Major GmmaMajorB = cutlass::gemm::detail::is_k_major<StrideB>() ? GMMA::Major::K : GMMA::Major::MN;
+
+  using TiledMma = decltype(cute::make_tiled_mma(cute::GMMA::ss_op_selector<
+      ElementA, ElementB, ElementAccumulator, TileShape, GMMA::Major::K, GmmaMajorB>(), AtomLayoutMNK{}));
+
+  using GmemTiledCopyB = SM90_TMA_LOAD;
+
+  using SmemLayoutAtomA = decltype(cutlass::gemm::collective::detail::ss_smem_selector<
+      GMMA::Major::K, ElementA, decltype(cute::get<0>(TileShape{})), decltype(cute::get<2>(TileShape{}))>());
+  using SmemLayoutAtomB = decltype(cutlass::gemm::collective::detail::ss_smem_selector<
+      GmmaMajorB, ElementB, decltype(cute::get<1>(TileShape{})), decltype(cute::get<2>(TileShape{}))>());
+
+  // The intermediate is indexed by K tile of the second GEMM the same way a pipeline indexes stages
+  using SmemLayoutA = decltype(tile_to_shape(
+      SmemLayoutAtomA{},
+      make_shape(shape<0>(TileShape{}), shape<2>(TileShape{}), Int<IntermediateKTiles>{})));
+  using SmemLayoutB = decltype(tile_to_shape(
+      SmemLayoutAtomB{},
+      make_shape(shape<1>(TileShape{}), shape<2>(TileShape{}), Int<Stages_>{}),
+      cute::conditional_t< ::cutlass::gemm::detail::is_major<0,StrideB>(), Step<_2,_1,_3>, Step<_1,_2,_3>>{}));
+
+  using MainloopPipeline = cutlass::PipelineTmaAsync<Stages_>;
+  using PipelineState = cutlass::PipelineState<Stages_>;
+  using PipelineParams = typename MainloopPipeline::Params;
+
+  static_assert(Stages_ >= 2, "Specialization requires Stages set to value 2 or more.");
+  static_assert(cute::rank(StrideB{}) == 3, "StrideB must be rank-3: [N, K, L]. If batch mode is not needed, set L stride to Int<0>.");
+
+  struct SharedStorage
+  {
+    struct TensorStorage : cute::aligned_struct<128, _0> {
+      cute::array_aligned<typename TiledMma::ValTypeA, cute::cosize_v<SmemLayoutA>> smem_A;
+      cute::array_aligned<typename TiledMma::ValTypeB, cute::cosize_v<SmemLayoutB>> smem_B;
+    } tensors;
+
+    using PipelineStorage = typename MainloopPipeline::SharedStorage;
+    PipelineStorage pipeline;
+  };
+  using TensorStorage = typename SharedStorage::TensorStorage;
+  using PipelineStorage = typename SharedStorage::PipelineStorage;
+
+  // Host side kernel arguments
+  struct Arguments {
+    ElementB const* ptr_B;
+    StrideB dB;
+    ElementCompute alpha0 = ElementCompute(1);
+  };
+
+  // Device side kernel params
+  struct Params {
+    // Assumption: StrideB is congruent with Problem_NK
+    using TMA_B = decltype(make_tma_copy_B_sm90(
+        GmemTiledCopyB{},
+        make_tensor(static_cast<ElementB const*>(nullptr), repeat_like(StrideB{}, int32_t(0)), StrideB{}),
+        SmemLayoutB{}(_,_,cute::Int<0>{}),
+        TileShape{},
+        ClusterShape{}));
+    TMA_B tma_load_b;
+    ElementCompute alpha0;
+    uint32_t tma_transaction_bytes = TmaTransactionBytes;
+  };
+
+  static constexpr int K_PIPE_MAX = Stages_;
+  static constexpr int K_PIPE_MMAS = 1;
+  static constexpr uint32_t TmaTransactionBytes =
+        cutlass::bits_to_bytes(size<0>(SmemLayoutB{}) * size<1>(SmemLayoutB{}) * static_cast<uint32_t>(sizeof_bits<ElementB>::value));
+
+  //
+  // Methods
+  //
+
+  /// ProblemShape is the (M,N1,K1,L) shape of the second GEMM, with K1 equal to N0 of the first GEMM
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    (void) workspace;
+
+    auto [M,N,K,L] = problem_shape;
+    Tensor tensor_b = make_tensor(args.ptr_B, make_layout(make_shape(N,K,L), args.dB));
+
+    typename Params::TMA_B tma_load_b = make_tma_copy_B_sm90(
+        GmemTiledCopyB{},
+        tensor_b,
+        SmemLayoutB{}(_,_,cute::Int<0>{}),
+        TileShape{},
+        ClusterShape{});
+
+    return {
+      tma_load_b,
+      args.alpha0,
+      TmaTransactionBytes
+    };
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(
+      ProblemShape const& problem_shape,
+      [[maybe_unused]] Arguments const& args) {
+    constexpr int tma_alignment_bits = 128;
+    auto [M,N,K,L] = problem_shape;
+
+    bool implementable = true;
+    constexpr int min_tma_aligned_elements_B = tma_alignment_bits / cutlass::sizeof_bits<ElementB>::value;
+    implementable = implementable && cutlass::detail::check_alignment<min_tma_aligned_elements_B>(cute::make_shape(N,K,L), StrideB{});
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum alignment requirements for TMA.\n");
+      return implementable;
+    }
+
+    // The whole intermediate row block and output row block must be resident in one CTA
+    implementable = K <= size<1>(TileShape0{}) && N <= size<1>(TileShape{});
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: N0 and N1 must not exceed the N extents of the CTA tiles.\n");
+    }
+    return implementable;
+  }
+
+  /// Issue Tma Descriptor Prefetch -- ideally from a single thread for best performance
+  CUTLASS_DEVICE
+  static void prefetch_tma_descriptors(Params const& mainloop_params) {
+    cute::prefetch_tma_descriptor(mainloop_params.tma_load_b.get_tma_descriptor());
+  }
+
+  /// Returns the tma tensor B after a local tile so it has shape (BLK_N,BLK_K,n,k,l)
+  template <class ProblemShape_MNKL>
+  CUTLASS_DEVICE auto
+  load_init(ProblemShape_MNKL const& problem_shape_MNKL, Params const& mainloop_params) const {
+    using X = Underscore;
+    auto [M,N,K,L] = problem_shape_MNKL;
+
+    Tensor mB_nkl = mainloop_params.tma_load_b.get_tma_tensor(make_shape(N,K,L));                            // (n,k,l)
+    Tensor gB_nkl = local_tile(mB_nkl, TileShape{}, make_coord(_,_,_), Step< X,_1,_1>{});        // (BLK_N,BLK_K,n,k,l)
+    return gB_nkl;
+  }
+
+  /// Producer Perspective: streams all IntermediateKTiles tiles of B for the CTA
+  template <class TensorB, class BlockCoord>
+  CUTLASS_DEVICE void
+  load(
+      Params const& mainloop_params,
+      MainloopPipeline pipeline,
+      PipelineState smem_pipe_write,
+      TensorB const& gB_nkl,
+      BlockCoord const& blk_coord,
+      TensorStorage& shared_tensors) {
+    int lane_predicate = cute::elect_one_sync();
+
+    if (lane_predicate) {
+      Tensor sB = make_tensor(make_smem_ptr(shared_tensors.smem_B.data()), SmemLayoutB{});        // (BLK_N,BLK_K,PIPE)
+
+      auto [m_coord, n_coord, k_coord, l_coord] = blk_coord;
+      Tensor gB = gB_nkl(_,_,n_coord,_,l_coord);                                                     // (BLK_N,BLK_K,k)
+
+      auto block_tma_b = mainloop_params.tma_load_b.get_slice(0);
+      Tensor tBgB = block_tma_b.partition_S(gB);                                                 // (TMA,TMA_N,TMA_K,k)
+      Tensor tBsB = block_tma_b.partition_D(sB);                                              // (TMA,TMA_N,TMA_K,PIPE)
+
+      CUTLASS_PRAGMA_NO_UNROLL
+      for (int k_tile = 0; k_tile < IntermediateKTiles; ++k_tile) {
+        // LOCK smem_pipe_write for _writing_
+        pipeline.producer_acquire(smem_pipe_write);
+
+        using BarrierType = typename MainloopPipeline::ProducerBarrierType;
+        BarrierType* tma_barrier = pipeline.producer_get_barrier(smem_pipe_write);
+
+        int write_stage = smem_pipe_write.index();
+        copy(mainloop_params.tma_load_b.with(*tma_barrier), tBgB(_,_,_,k_tile), tBsB(_,_,_,write_stage));
+
+        // Advance smem_pipe_write
+        ++smem_pipe_write;
+      }
+    }
+  }
+
+  /// Perform a Producer Epilogue to prevent early exit of blocks while TMA loads are in flight
+  CUTLASS_DEVICE void
+  load_tail(MainloopPipeline pipeline, PipelineState smem_pipe_write) {
+    int lane_predicate = cute::elect_one_sync();
+
+    if (lane_predicate) {
+      pipeline.producer_tail(smem_pipe_write);
+    }
+  }
+
+  /// Converts the accumulators of the first GEMM into the A operand of the second GEMM.
+  /// All NumMmaThreads consumer threads must call this; on return the intermediate is visible to WGMMA.
+  template <class FrgTensorC, class TiledMma0>
+  CUTLASS_DEVICE void
+  store_intermediate(
+      FrgTensorC const& accum0,
+      TiledMma0 tiled_mma0,
+      int thread_idx,
+      TensorStorage& shared_tensors,
+      Params const& mainloop_params) {
+    static_assert(is_rmem<FrgTensorC>::value, "C tensor must be rmem resident.");
+    constexpr int NumMmaThreads = size(TiledMma{});
+    static_assert(size(TiledMma0{}) == NumMmaThreads, "Both GEMMs must be computed by the same threads.");
+
+    Tensor sA = make_tensor(make_smem_ptr(shared_tensors.smem_A.data()), SmemLayoutA{});          // (BLK_M,BLK_K,KT)
+    // View the intermediate as the (BLK_M,BLK_N0) output tile of the first GEMM
+    Tensor sA_mn = make_tensor(sA.data(), composition(sA.layout(),
+        make_layout(make_shape(shape<0>(TileShape{}), make_shape(shape<2>(TileShape{}), Int<IntermediateKTiles>{})))));
+
+    auto thr_mma0 = tiled_mma0.get_thread_slice(thread_idx);
+    Tensor tCsA = thr_mma0.partition_C(sA_mn);                                                 // (MMA,MMA_M,MMA_N)
+    CUTE_STATIC_ASSERT_V(size(tCsA) == size(accum0));
+
+    Activation activation;
+    NumericConverter<ElementCompute, ElementAccumulator> accumulator_converter;
+    NumericConverter<typename TiledMma::ValTypeA, ElementCompute> intermediate_converter;
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(accum0); ++i) {
+      ElementCompute value = mainloop_params.alpha0 * accumulator_converter(accum0(i));
+      tCsA(i) = intermediate_converter(activation(value));
+    }
+
+    // Make the generic proxy writes visible to the async proxy before any warp group issues WGMMA
+    cutlass::arch::fence_view_async_shared();
+    cutlass::arch::NamedBarrier::sync(NumMmaThreads, static_cast<uint32_t>(cutlass::arch::ReservedNamedBarriers::FirstUserBarrier));
+  }
+
+  /// Perform a collective-scoped matrix multiply-accumulate
+  /// Consumer Perspective
+  template <class FrgTensorC>
+  CUTLASS_DEVICE void
+  mma(MainloopPipeline pipeline,
+      PipelineState smem_pipe_read,
+      FrgTensorC& accum,
+      int thread_idx,
+      TensorStorage& shared_tensors) {
+    static_assert(is_rmem<FrgTensorC>::value, "C tensor must be rmem resident.");
+
+    Tensor sA = make_tensor(make_smem_ptr(shared_tensors.smem_A.data()), SmemLayoutA{});          // (BLK_M,BLK_K,KT)
+    Tensor sB = make_tensor(make_smem_ptr(shared_tensors.smem_B.data()), SmemLayoutB{});          // (BLK_N,BLK_K,PIPE)
+
+    constexpr int MmaWarpGroups = size(TiledMma{}) / NumThreadsPerWarpGroup;
+    Layout warp_group_thread_layout = make_layout(Int<MmaWarpGroups>{},
+                                                  Int<NumThreadsPerWarpGroup>{});
+
+    int warp_group_idx = __shfl_sync(0xFFFFFFFF, thread_idx / NumThreadsPerWarpGroup, 0);
+
+    TiledMma tiled_mma;
+    auto thread_mma = tiled_mma.get_slice(warp_group_thread_layout(warp_group_idx));
+
+    Tensor tCsA = thread_mma.partition_A(sA);                                                   // (MMA,MMA_M,MMA_K,KT)
+    Tensor tCsB = thread_mma.partition_B(sB);                                                 // (MMA,MMA_N,MMA_K,PIPE)
+
+    // Allocate "fragments/descriptors"
+    Tensor tCrA = thread_mma.make_fragment_A(tCsA);                                             // (MMA,MMA_M,MMA_K,KT)
+    Tensor tCrB = thread_mma.make_fragment_B(tCsB);                                           // (MMA,MMA_N,MMA_K,PIPE)
+
+    CUTE_STATIC_ASSERT_V(size<1>(tCsA) == size<1>(accum));                                                         // M
+    CUTE_STATIC_ASSERT_V(size<1>(tCsB) == size<2>(accum));                                                         // N
+    CUTE_STATIC_ASSERT_V(size<2>(tCsA) == size<2>(tCsB));                                                          // K
+
+    static_assert((0 <= K_PIPE_MMAS) && (K_PIPE_MMAS <  K_PIPE_MAX),
+        "ERROR : Incorrect number of MMAs in flight");
+
+    // We release buffers to producer warps(dma load) with some mmas in flight
+    PipelineState smem_pipe_release = smem_pipe_read;
+
+    tiled_mma.accumulate_ = GMMA::ScaleOut::Zero;
+    warpgroup_fence_operand(accum);
+
+    CUTLASS_PRAGMA_NO_UNROLL
+    for (int k_tile = 0; k_tile < IntermediateKTiles; ++k_tile) {
+      // WAIT on smem_pipe_read until its data are available (phase bit flips from rdPhaseBit value)
+      auto barrier_token = pipeline.consumer_try_wait(smem_pipe_read);
+      pipeline.consumer_wait(smem_pipe_read, barrier_token);
+
+      int read_stage = smem_pipe_read.index();
+      warpgroup_fence_operand(accum);
+      warpgroup_arrive();
+      // Unroll the K mode manually to set scale D to 1
+      CUTLASS_PRAGMA_UNROLL
+      for (int k_block = 0; k_block < size<2>(tCrA); ++k_block) {
+        // (V,M,K) x (V,N,K) => (V,M,N)
+        cute::gemm(tiled_mma, tCrA(_,_,k_block,k_tile), tCrB(_,_,k_block,read_stage), accum);
+        tiled_mma.accumulate_ = GMMA::ScaleOut::One;
+      }
+      warpgroup_commit_batch();
+
+      /// Wait on the GMMA barrier for K_PIPE_MMAS (or fewer) outstanding to ensure smem_pipe_write is consumed
+      warpgroup_wait<K_PIPE_MMAS>();
+      warpgroup_fence_operand(accum);
+
+      // UNLOCK smem_pipe_release once the GMMAs reading it have retired
+      if (k_tile >= K_PIPE_MMAS) {
+        pipeline.consumer_release(smem_pipe_release);
+        ++smem_pipe_release;
+      }
+
+      ++smem_pipe_read;
+    }
+
+    // Wait on all GMMAs to complete and release the remaining buffers
+    warpgroup_wait<0>();
+    warpgroup_fence_operand(accum);
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int count = 0; count < cute::min(K_PIPE_MMAS, IntermediateKTiles); ++count) {
+      pipeline.consumer_release(smem_pipe_release);                 // UNLOCK smem_pipe_release, done _computing_ on it
+      ++smem_pipe_release;
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::b2b::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
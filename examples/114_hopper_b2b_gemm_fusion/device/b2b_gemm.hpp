@@ -1,5 +1,5 @@
 /***************************************************************************************************
- * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * Copyright (c) 2023 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: BSD-3-Clause
  *
  * Redistribution and use in source and binary forms, with or without
@@ -28,6 +28,10 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *
  **************************************************************************************************/
+/*!
+  \file
+  \brief Device layer for the Hopper back-to-back GEMM kernel.
+*/
 
 #pragma once
 
@@ -42,14 +46,14 @@
 
 ////////////////////////////////////////////////////////////////////////////////
 
-namespace cutlass::ssd::device {
+namespace cutlass::b2b::device {
 
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////// CUTLASS 3.x API /////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 
 template <class Kernel_>
-class SSD {
+class B2bGemm {
 public:
   using Kernel = Kernel_;
 
@@ -105,7 +109,7 @@ public:
 
   /// Computes the maximum number of active blocks per multiprocessor
   static int maximum_active_blocks(int /* smem_capacity */ = -1) {
-    CUTLASS_TRACE_HOST("Universal::maximum_active_blocks()");
+    CUTLASS_TRACE_HOST("B2bGemm::maximum_active_blocks()");
     int max_active_blocks = -1;
     int smem_size = Kernel::SharedStorageSize;
 
@@ -148,7 +152,7 @@ public:
   /// Initializes GEMM state from arguments.
   Status
   initialize(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr) {
-    CUTLASS_TRACE_HOST("Universal::initialize() - workspace "
+    CUTLASS_TRACE_HOST("B2bGemm::initialize() - workspace "
       << workspace << ", stream: " << (stream ? "non-null" : "null"));
 
     // Initialize the workspace
@@ -164,7 +168,6 @@ public:
 
     // account for dynamic smem capacity if needed
     int smem_size = Kernel::SharedStorageSize;
-    printf("[Usage] smem : %d\n", smem_size);
     if (smem_size >= (48 << 10)) {
       CUTLASS_TRACE_HOST("  Setting smem size to " << smem_size);
       cudaError_t result = cudaFuncSetAttribute(
@@ -186,7 +189,7 @@ public:
   /// Update API is preserved in 3.0, but does not guarantee a lightweight update of params.
   Status
   update(Arguments const& args, void* workspace = nullptr) {
-    CUTLASS_TRACE_HOST("Universal()::update() - workspace: " << workspace);
+    CUTLASS_TRACE_HOST("B2bGemm::update() - workspace: " << workspace);
 
     size_t workspace_bytes = get_workspace_size(args);
     if (workspace_bytes > 0 && nullptr == workspace) {
@@ -200,8 +203,8 @@ public:
   /// Primary run() entry point API that is static allowing users to create and manage their own params.
   /// Supplied params struct must be construct by calling Kernel::to_underling_arguments()
   static Status
-  run(Params& params, cudaStream_t stream = nullptr) {
-    CUTLASS_TRACE_HOST("Universal::run()");
+  run(Params& params, cudaStream_t stream = nullptr, bool launch_with_pdl = false) {
+    CUTLASS_TRACE_HOST("B2bGemm::run()");
     dim3 const block = Kernel::get_block_shape();
     dim3 const grid = get_grid_shape(params);
 
@@ -216,7 +219,8 @@ public:
                    cute::size<2>(typename Kernel::ClusterShape{}));
       void const* kernel = (void const*) device_kernel<Kernel>;
       void* kernel_params[] = {&params};
-      launch_result = ClusterLauncher::launch(grid, cluster, block, smem_size, stream, kernel, kernel_params);
+      launch_result = ClusterLauncher::launch(
+        grid, cluster, block, smem_size, stream, kernel, kernel_params, launch_with_pdl);
     }
     else {
       launch_result = Status::kSuccess;
@@ -239,35 +243,35 @@ public:
 
   /// Launches the kernel after first constructing Params internal state from supplied arguments.
   Status
-  run(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr) {
+  run(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr, bool launch_with_pdl = false) {
     Status status = initialize(args, workspace, stream);
     if (Status::kSuccess == status) {
-      status = run(params_, stream);
+      status = run(params_, stream, launch_with_pdl);
     }
     return status;
   }
 
   /// Launches the kernel after first constructing Params internal state from supplied arguments.
   Status
-  operator()(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr) {
-    return run(args, workspace, stream);
+  operator()(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr, bool launch_with_pdl = false) {
+    return run(args, workspace, stream, launch_with_pdl);
   }
 
   /// Overload that allows a user to re-launch the same kernel without updating internal params struct.
   Status
-  run(cudaStream_t stream = nullptr) {
-    return run(params_, stream);
+  run(cudaStream_t stream = nullptr, bool launch_with_pdl = false) {
+    return run(params_, stream, launch_with_pdl);
   }
 
   /// Overload that allows a user to re-launch the same kernel without updating internal params struct.
   Status
-  operator()(cudaStream_t stream = nullptr) {
-    return run(params_, stream);
+  operator()(cudaStream_t stream = nullptr, bool launch_with_pdl = false) {
+    return run(params_, stream, launch_with_pdl);
   }
 };
 
 ////////////////////////////////////////////////////////////////////////////////
 
-} // namespace cutlass::device
+} // namespace cutlass::b2b::device
 
 ////////////////////////////////////////////////////////////////////////////////
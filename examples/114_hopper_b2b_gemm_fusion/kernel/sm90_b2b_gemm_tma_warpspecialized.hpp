@@ -0,0 +1,432 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Warp-specialized Hopper kernel computing two back-to-back GEMMs in one CTA.
+
+    D1 = epilogue(Activation(alpha0 * A0 * B0) * B1, C1)
+
+    One producer warp group streams A0/B0 and then B1 through TMA. Two consumer warp groups compute
+    the first GEMM, store its converted accumulators to SMEM, compute the second GEMM directly from
+    SMEM and run the epilogue. Each CTA owns a BLK_M row block of both GEMMs.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/arch/reg_reconfig.h"
+#include "cutlass/arch/mma_sm90.h"
+#include "cutlass/arch/grid_dependency_control.h"
+#include "cutlass/gemm/gemm.h"
+#include "cutlass/pipeline/pipeline.hpp"
+#include "cutlass/trace.h"
+
+#include "cute/tensor.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::b2b::kernel {
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// (M, N0, K0, N1, L): the first GEMM is (M,N0,K0,L) and the second GEMM is (M,N1,N0,L)
+using B2bProblemShape = cute::tuple<int, int, int, int, int>;
+
+template <
+  class CollectiveMainloop0_,
+  class CollectiveMainloop1_,
+  class CollectiveEpilogue_
+>
+class Sm90B2bGemmTmaWarpSpecialized {
+public:
+  //
+  // Type Aliases
+  //
+  using ProblemShape = B2bProblemShape;
+
+  // First GEMM mainloop derived types
+  using CollectiveMainloop0 = CollectiveMainloop0_;
+  using TileShape0 = typename CollectiveMainloop0::TileShape;
+  using TiledMma0 = typename CollectiveMainloop0::TiledMma;
+  using ArchTag = typename CollectiveMainloop0::ArchTag;
+  using ClusterShape = typename CollectiveMainloop0::DispatchPolicy::ClusterShape;
+  using Mainloop0Arguments = typename CollectiveMainloop0::Arguments;
+  using Mainloop0Params = typename CollectiveMainloop0::Params;
+  static_assert(ArchTag::kMinComputeCapability >= 90);
+  static_assert(size(ClusterShape{}) == 1, "B2B GEMM kernel does not support clusters.");
+
+  // Second GEMM mainloop derived types
+  using CollectiveMainloop1 = CollectiveMainloop1_;
+  using TileShape = typename CollectiveMainloop1::TileShape;
+  using TiledMma = typename CollectiveMainloop1::TiledMma;
+  using Mainloop1Arguments = typename CollectiveMainloop1::Arguments;
+  using Mainloop1Params = typename CollectiveMainloop1::Params;
+  static_assert(cute::is_same_v<TileShape0, typename CollectiveMainloop1::TileShape0>,
+    "The second GEMM collective must be configured with the tile shape of the first GEMM.");
+
+  // Epilogue derived types
+  using CollectiveEpilogue = CollectiveEpilogue_;
+  using ElementC = typename CollectiveEpilogue::ElementC;
+  using StrideC  = typename CollectiveEpilogue::StrideC;
+  using ElementD = typename CollectiveEpilogue::ElementD;
+  using StrideD  = typename CollectiveEpilogue::StrideD;
+  using EpilogueArguments = typename CollectiveEpilogue::Arguments;
+  using EpilogueParams = typename CollectiveEpilogue::Params;
+
+  // Kernel level shared memory storage
+  struct SharedStorage {
+    struct TensorStorage : cute::aligned_struct<128, _1> {
+      using Mainloop0TensorStorage = typename CollectiveMainloop0::TensorStorage;
+      using Mainloop1TensorStorage = typename CollectiveMainloop1::TensorStorage;
+      using EpilogueTensorStorage = typename CollectiveEpilogue::TensorStorage;
+
+      // B1 is prefetched while the first GEMM runs, so both mainloops are live at once
+      Mainloop0TensorStorage mainloop0;
+      Mainloop1TensorStorage mainloop1;
+      EpilogueTensorStorage epilogue;
+    } tensors;
+
+    struct PipelineStorage : cute::aligned_struct<16, _1> {
+      using Mainloop0PipelineStorage = typename CollectiveMainloop0::PipelineStorage;
+      using Mainloop1PipelineStorage = typename CollectiveMainloop1::PipelineStorage;
+
+      alignas(16) Mainloop0PipelineStorage mainloop0;
+      alignas(16) Mainloop1PipelineStorage mainloop1;
+    } pipelines;
+  };
+
+  static constexpr int SharedStorageSize = sizeof(SharedStorage);
+
+  static constexpr uint32_t NumLoadWarpGroups = 1;
+  static constexpr uint32_t NumMmaThreads = size(TiledMma0{});
+  static constexpr uint32_t NumMmaWarpGroups = NumMmaThreads / NumThreadsPerWarpGroup;
+  static constexpr uint32_t MaxThreadsPerBlock = NumMmaThreads + (NumLoadWarpGroups * NumThreadsPerWarpGroup);
+  static constexpr uint32_t MinBlocksPerMultiprocessor = 1;
+  static_assert(NumMmaThreads == 256, "B2B GEMM kernel must have TiledMMA operating using 256 threads.");
+  static_assert(size(TiledMma{}) == NumMmaThreads, "Both GEMMs must be computed by the same warp groups.");
+
+  /// Register requirement for Load and Math WGs
+  static constexpr uint32_t LoadRegisterRequirement = 40;
+  static constexpr uint32_t MmaRegisterRequirement = 232;
+
+  // Device side arguments
+  struct Arguments {
+    ProblemShape problem_shape{};
+    Mainloop0Arguments mainloop0{};
+    Mainloop1Arguments mainloop1{};
+    EpilogueArguments epilogue{};
+    KernelHardwareInfo hw_info{};
+  };
+
+  // Kernel entry point API
+  struct Params {
+    ProblemShape problem_shape{};
+    Mainloop0Params mainloop0{};
+    Mainloop1Params mainloop1{};
+    EpilogueParams epilogue{};
+  };
+
+  //
+  // Methods
+  //
+
+  static auto
+  get_problem_shape0(ProblemShape const& problem_shape) {
+    auto [M, N0, K0, N1, L] = problem_shape;
+    return make_shape(M, N0, K0, L);
+  }
+
+  static auto
+  get_problem_shape1(ProblemShape const& problem_shape) {
+    auto [M, N0, K0, N1, L] = problem_shape;
+    return make_shape(M, N1, N0, L);
+  }
+
+  static Params
+  to_underlying_arguments(Arguments const& args, void* workspace) {
+    (void) workspace;
+    auto problem_shape0 = get_problem_shape0(args.problem_shape);
+    auto problem_shape1 = get_problem_shape1(args.problem_shape);
+
+    return {
+      args.problem_shape,
+      CollectiveMainloop0::to_underlying_arguments(problem_shape0, args.mainloop0, workspace),
+      CollectiveMainloop1::to_underlying_arguments(problem_shape1, args.mainloop1, workspace),
+      CollectiveEpilogue::to_underlying_arguments(problem_shape1, args.epilogue, workspace)
+    };
+  }
+
+  static bool
+  can_implement(Arguments const& args) {
+    auto problem_shape0 = get_problem_shape0(args.problem_shape);
+    auto problem_shape1 = get_problem_shape1(args.problem_shape);
+
+    bool implementable = true;
+    implementable &= CollectiveMainloop0::can_implement(problem_shape0, args.mainloop0);
+    implementable &= CollectiveMainloop1::can_implement(problem_shape1, args.mainloop1);
+    implementable &= CollectiveEpilogue::can_implement(problem_shape1, args.epilogue);
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Arguments or Problem Shape don't meet the requirements.\n");
+    }
+    return implementable;
+  }
+
+  static size_t
+  get_workspace_size(Arguments const& args) {
+    return 0;
+  }
+
+  static cutlass::Status
+  initialize_workspace(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  // One CTA per BLK_M row block and batch
+  static dim3
+  get_grid_shape(Params const& params) {
+    auto [M, N0, K0, N1, L] = params.problem_shape;
+    return dim3(uint32_t(ceil_div(M, size<0>(TileShape0{}))), 1, uint32_t(L));
+  }
+
+  static dim3
+  get_block_shape() {
+    return dim3(MaxThreadsPerBlock, 1, 1);
+  }
+
+  CUTLASS_DEVICE
+  void
+  operator()(Params const& params, char* smem_buf) {
+    using namespace cute;
+    using X = Underscore;
+
+// Any Tensor Op MMA Atom in the WGMMA ISA is arch conditional to sm90a.
+#if ! defined(__CUDA_ARCH_FEAT_SM90_ALL)
+    CUTE_INVALID_CONTROL_PATH("ERROR : Arch conditional MMA instruction used without targeting sm90a compute capability. Aborting.\n");
+#else
+
+    enum class WarpGroupRole {
+      Producer = 0,
+      Consumer0 = 1,
+      Consumer1 = 2
+    };
+    enum class ProducerWarpRole {
+      Mainloop = 0,
+      Warp1 = 1,
+      Warp2 = 2,
+      Warp3 = 3
+    };
+
+    // Kernel level shared memory storage
+    SharedStorage& shared_storage = *reinterpret_cast<SharedStorage*>(smem_buf);
+
+    int thread_idx = int(threadIdx.x);
+    int warp_idx = canonical_warp_idx_sync();
+    int warp_idx_in_warp_group = warp_idx % NumWarpsPerWarpGroup;
+    int warp_group_thread_idx = thread_idx % NumThreadsPerWarpGroup;
+    int mma_thread_idx = thread_idx % NumMmaThreads;
+    auto warp_group_role = WarpGroupRole(canonical_warp_group_idx());
+    auto producer_warp_role = ProducerWarpRole(warp_idx_in_warp_group);
+    int lane_predicate = cute::elect_one_sync();
+
+    // Issue Tma Descriptor Prefetch from a single thread
+    if ((warp_idx == 0) && lane_predicate) {
+      CollectiveMainloop0::prefetch_tma_descriptors(params.mainloop0);
+      CollectiveMainloop1::prefetch_tma_descriptors(params.mainloop1);
+    }
+
+    // First GEMM load pipeline
+    using Mainloop0Pipeline = typename CollectiveMainloop0::MainloopPipeline;
+    typename Mainloop0Pipeline::Params mainloop0_pipeline_params;
+    if (warp_group_role == WarpGroupRole::Producer && producer_warp_role == ProducerWarpRole::Mainloop) {
+      mainloop0_pipeline_params.role = Mainloop0Pipeline::ThreadCategory::Producer;
+    }
+    if (warp_group_role == WarpGroupRole::Consumer0 || warp_group_role == WarpGroupRole::Consumer1) {
+      mainloop0_pipeline_params.role = Mainloop0Pipeline::ThreadCategory::Consumer;
+    }
+    mainloop0_pipeline_params.is_leader = warp_group_thread_idx == 0;
+    mainloop0_pipeline_params.num_consumers = NumMmaThreads;
+    mainloop0_pipeline_params.transaction_bytes = params.mainloop0.tma_transaction_bytes;
+    Mainloop0Pipeline mainloop0_pipeline(shared_storage.pipelines.mainloop0, mainloop0_pipeline_params, ClusterShape{});
+
+    // Second GEMM load pipeline, carrying B1 only
+    using Mainloop1Pipeline = typename CollectiveMainloop1::MainloopPipeline;
+    typename Mainloop1Pipeline::Params mainloop1_pipeline_params;
+    if (warp_group_role == WarpGroupRole::Producer && producer_warp_role == ProducerWarpRole::Mainloop) {
+      mainloop1_pipeline_params.role = Mainloop1Pipeline::ThreadCategory::Producer;
+    }
+    if (warp_group_role == WarpGroupRole::Consumer0 || warp_group_role == WarpGroupRole::Consumer1) {
+      mainloop1_pipeline_params.role = Mainloop1Pipeline::ThreadCategory::Consumer;
+    }
+    mainloop1_pipeline_params.is_leader = warp_group_thread_idx == 0;
+    mainloop1_pipeline_params.num_consumers = NumMmaThreads;
+    mainloop1_pipeline_params.transaction_bytes = params.mainloop1.tma_transaction_bytes;
+    Mainloop1Pipeline mainloop1_pipeline(shared_storage.pipelines.mainloop1, mainloop1_pipeline_params, ClusterShape{});
+
+    // For the DMA Load (producer) we start with an opposite phase
+    // i.e., we skip all waits since we know that the buffer is indeed empty
+    auto mainloop0_pipe_producer_state = cutlass::make_producer_start_state<Mainloop0Pipeline>();
+    auto mainloop1_pipe_producer_state = cutlass::make_producer_start_state<Mainloop1Pipeline>();
+    typename CollectiveMainloop0::PipelineState mainloop0_pipe_consumer_state;
+    typename CollectiveMainloop1::PipelineState mainloop1_pipe_consumer_state;
+
+    // We need this to guarantee that the Pipeline init is visible to all producers and consumers
+    __syncthreads();
+
+    auto problem_shape0 = get_problem_shape0(params.problem_shape);
+    auto problem_shape1 = get_problem_shape1(params.problem_shape);
+
+    CollectiveMainloop0 collective_mainloop0;
+    CollectiveMainloop1 collective_mainloop1;
+
+    // Prepare and partition the input tensors
+    auto load_inputs0 = collective_mainloop0.load_init(problem_shape0, params.mainloop0);
+    Tensor gA0_mkl = get<0>(load_inputs0);
+    Tensor gB1_nkl = collective_mainloop1.load_init(problem_shape1, params.mainloop1);
+
+    // Both GEMMs cover the whole N extent, so the CTA only walks M and L
+    auto m_coord = idx2crd(int(blockIdx.x), shape<2>(gA0_mkl));
+    auto l_coord = idx2crd(int(blockIdx.z), shape<4>(gA0_mkl));
+    auto blk_coord = make_coord(m_coord, _0{}, _, l_coord);
+
+    int k_tile_count0 = size<3>(gA0_mkl);
+
+    if (warp_group_role == WarpGroupRole::Producer) {
+      cutlass::arch::warpgroup_reg_dealloc<LoadRegisterRequirement>();
+
+      if (producer_warp_role == ProducerWarpRole::Mainloop) {
+        // Ensure that the prefetched kernel does not touch
+        // unflushed global memory prior to this instruction
+        cutlass::arch::wait_on_dependent_grids();
+
+        auto k_tile_iter = cute::make_coord_iterator(shape<3>(gA0_mkl));
+        collective_mainloop0.load(
+          params.mainloop0,
+          mainloop0_pipeline,
+          mainloop0_pipe_producer_state,
+          load_inputs0,
+          blk_coord,
+          k_tile_iter, k_tile_count0,
+          thread_idx,
+          0 /* block_rank_in_cluster */,
+          shared_storage.tensors.mainloop0
+        );
+        mainloop0_pipe_producer_state.advance(k_tile_count0);
+
+        // B1 does not depend on the first GEMM, so it is prefetched behind A0 and B0
+        collective_mainloop1.load(
+          params.mainloop1,
+          mainloop1_pipeline,
+          mainloop1_pipe_producer_state,
+          gB1_nkl,
+          blk_coord,
+          shared_storage.tensors.mainloop1
+        );
+        mainloop1_pipe_producer_state.advance(CollectiveMainloop1::IntermediateKTiles);
+
+        // Make sure all loads have landed before the producer exits
+        collective_mainloop0.load_tail(mainloop0_pipeline, mainloop0_pipe_producer_state);
+        collective_mainloop1.load_tail(mainloop1_pipeline, mainloop1_pipe_producer_state);
+      }
+    }
+    else if (warp_group_role == WarpGroupRole::Consumer0 || warp_group_role == WarpGroupRole::Consumer1) {
+      cutlass::arch::warpgroup_reg_alloc<MmaRegisterRequirement>();
+
+      // First GEMM
+      TiledMma0 tiled_mma0;
+      auto accumulators0 = partition_fragment_C(tiled_mma0, take<0,2>(TileShape0{}));          // (MMA,MMA_M,MMA_N)
+      collective_mainloop0.mma(
+        mainloop0_pipeline,
+        mainloop0_pipe_consumer_state,
+        accumulators0,
+        k_tile_count0,
+        mma_thread_idx,
+        shared_storage.tensors.mainloop0,
+        params.mainloop0
+      );
+      collective_mainloop0.mma_tail(
+        mainloop0_pipeline,
+        mainloop0_pipe_consumer_state,
+        k_tile_count0
+      );
+
+      // The intermediate never leaves the CTA: convert it into the A operand of the second GEMM
+      collective_mainloop1.store_intermediate(
+        accumulators0,
+        tiled_mma0,
+        mma_thread_idx,
+        shared_storage.tensors.mainloop1,
+        params.mainloop1
+      );
+
+      // Second GEMM
+      TiledMma tiled_mma;
+      auto accumulators = partition_fragment_C(tiled_mma, take<0,2>(TileShape{}));             // (MMA,MMA_M,MMA_N)
+      collective_mainloop1.mma(
+        mainloop1_pipeline,
+        mainloop1_pipe_consumer_state,
+        accumulators,
+        mma_thread_idx,
+        shared_storage.tensors.mainloop1
+      );
+
+      // Hint on an early release of global memory resources.
+      // The timing of calling this function only influences performance,
+      // not functional correctness.
+      cutlass::arch::launch_dependent_grids();
+
+      // Epilogue and write to gD
+      CollectiveEpilogue collective_epilogue(params.epilogue, shared_storage.tensors.epilogue);
+      auto problem_shape_MNKL = problem_shape1;
+      auto residue_mnk = make_tuple(0, 0, 0);
+      collective_epilogue(
+        problem_shape_MNKL,
+        TileShape{},
+        blk_coord,
+        accumulators,
+        tiled_mma,
+        residue_mnk,
+        mma_thread_idx,
+        reinterpret_cast<char*>(&shared_storage.tensors.epilogue)
+      );
+    }
+#endif
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::b2b::kernel
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
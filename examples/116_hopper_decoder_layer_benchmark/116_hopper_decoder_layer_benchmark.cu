@@ -0,0 +1,747 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief  Hopper transformer decoder layer benchmark
+
+    The other examples time one kernel in isolation. This example assembles a full pre-norm
+    decoder layer from CUTLASS kernels and times it at the layer level, so that a kernel change
+    can be judged by its effect on the step time:
+
+      x_norm = rmsnorm(x)
+      qkv    = x_norm @ W_qkv                           (SM90 GEMM)
+      attn   = attention(q, k, v)                       (88_hopper_fmha, reading q/k/v in place)
+      h      = attn @ W_o + x                           (SM90 GEMM, residual add in the epilogue)
+      h_norm = rmsnorm(h)
+      gate   = SiLU(h_norm @ W_gate)                    (SM90 GEMM, LinCombEltAct<SiLu>)
+      up     = (h_norm @ W_up) * gate                   (SM90 GEMM, EVT multiplying by C)
+      y      = up @ W_down + h                          (SM90 GEMM, residual add in the epilogue)
+
+    Two phases are modeled:
+      prefill: batch x seq tokens with causal self-attention. The GEMMs use 128x256 cooperative
+               tiles on 2x1 clusters.
+      decode:  one token per sequence attending to a KV cache of seq tokens. The GEMMs use
+               128x64 cooperative tiles with the stream-K scheduler, since the few token rows
+               would otherwise leave most SMs idle.
+
+    Every kernel is launched with programmatic dependent launch (PDL) when --pdl is set, and the
+    layer is also captured into a CUDA graph and replayed. The example reports the time of each
+    op, the end-to-end time with eager launches and with graph replay, and the model FLOP
+    utilization (MFU) relative to --peak-tflops.
+
+    The numbers are performance only. The kernels are verified by their own examples and unit
+    tests, so no reference is computed here.
+
+    Assumptions:
+      1. Multi-head attention with a head dimension of 128 (hidden / heads == 128).
+      2. FP16 weights and activations, FP32 accumulation.
+
+    Example usage:
+      $ ./examples/116_hopper_decoder_layer_benchmark/116_hopper_decoder_layer_benchmark \
+            --mode=prefill --batch=2 --seq=4096
+      $ ./examples/116_hopper_decoder_layer_benchmark/116_hopper_decoder_layer_benchmark \
+            --mode=decode --batch=64 --seq=2048
+*/
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_types.h"
+
+#include "cute/tensor.hpp"
+#include "cutlass/tensor_ref.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler.hpp"
+#include "cutlass/epilogue/dispatch_policy.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/thread/activation.h"
+
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/device_rmsnorm.h"
+#include "cutlass/util/packed_stride.hpp"
+#include "cutlass/util/reference/device/tensor_fill.h"
+
+#include "collective/fmha_fusion.hpp"
+#include "device/device_universal.hpp"
+#include "kernel/fmha_kernel_builder.hpp"
+
+#include "helper.h"
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Testbed utility types
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Command line options parsing
+struct Options {
+
+  bool help = false;
+
+  std::string mode = "prefill";
+  int batch = 2;
+  int seq = 4096;                  // Prefill sequence length, or KV cache length in decode
+  int hidden = 4096;
+  int heads = 32;
+  int ffn = 14336;
+  bool pdl = true;
+  bool graph = true;
+  int warmup = 10;
+  int iterations = 50;
+  double peak_tflops = 989.0;      // Dense FP16 tensor core peak of H100 SXM
+
+  // Parses the command line
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    cmd.get_cmd_line_argument("mode", mode);
+    cmd.get_cmd_line_argument("batch", batch);
+    cmd.get_cmd_line_argument("seq", seq);
+    cmd.get_cmd_line_argument("hidden", hidden);
+    cmd.get_cmd_line_argument("heads", heads);
+    cmd.get_cmd_line_argument("ffn", ffn);
+    cmd.get_cmd_line_argument("pdl", pdl, true);
+    cmd.get_cmd_line_argument("graph", graph, true);
+    cmd.get_cmd_line_argument("warmup", warmup);
+    cmd.get_cmd_line_argument("iterations", iterations);
+    cmd.get_cmd_line_argument("peak-tflops", peak_tflops);
+  }
+
+  /// Prints the usage statement.
+  std::ostream & print_usage(std::ostream &out) const {
+
+    out << "116_hopper_decoder_layer_benchmark\n\n"
+      << "  Times a transformer decoder layer assembled from CUTLASS kernels.\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement\n\n"
+      << "  --mode=<prefill|decode>     Phase to model\n"
+      << "  --batch=<int>               Number of sequences\n"
+      << "  --seq=<int>                 Prefill sequence length, or KV cache length in decode\n"
+      << "  --hidden=<int>              Model dimension\n"
+      << "  --heads=<int>               Attention heads, hidden / heads must be 128\n"
+      << "  --ffn=<int>                 Intermediate dimension of the gated MLP\n"
+      << "  --pdl=<bool>                Launch with programmatic dependent launch\n"
+      << "  --graph=<bool>              Also time the layer captured into a CUDA graph\n"
+      << "  --warmup=<int>              Number of warmup iterations\n"
+      << "  --iterations=<int>          Number of profiling iterations to perform\n"
+      << "  --peak-tflops=<float>       Tensor core peak the MFU is relative to\n\n";
+
+    out
+      << "\n\nExamples:\n\n"
+      << "$ " << "116_hopper_decoder_layer_benchmark" << " --mode=prefill --batch=2 --seq=4096\n"
+      << "$ " << "116_hopper_decoder_layer_benchmark" << " --mode=decode --batch=64 --seq=2048\n\n";
+
+    return out;
+  }
+
+  bool decode() const {
+    return mode == "decode";
+  }
+
+  int head_dim() const {
+    return hidden / heads;
+  }
+
+  /// Rows of the GEMMs
+  int tokens() const {
+    return decode() ? batch : batch * seq;
+  }
+
+  /// Query length of the attention
+  int seq_q() const {
+    return decode() ? 1 : seq;
+  }
+
+  bool valid(std::ostream &out) const {
+    if (mode != "prefill" && mode != "decode") {
+      out << "--mode must be prefill or decode.\n";
+      return false;
+    }
+    if (heads <= 0 || hidden % heads != 0 || head_dim() != 128) {
+      out << "hidden / heads must be 128.\n";
+      return false;
+    }
+    if (ffn % 8 != 0 || batch <= 0 || seq <= 0) {
+      out << "ffn must be a multiple of 8, and batch and seq positive.\n";
+      return false;
+    }
+    return true;
+  }
+};
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Kernel configurations
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+using Element             = cutlass::half_t;                                // Weights and activations
+using ElementAccumulator  = float;                                          // Element type for internal accumulation
+using ElementCompute      = float;                                          // Element type for epilogue computation
+constexpr int Alignment   = 128 / cutlass::sizeof_bits<Element>::value;     // Memory access granularity/alignment in units of elements
+
+using LayoutA             = cutlass::layout::RowMajor;                      // Activations, tokens x features
+using LayoutB             = cutlass::layout::ColumnMajor;                   // Weights, out_features x in_features
+using LayoutD             = cutlass::layout::RowMajor;
+
+using ArchTag             = cutlass::arch::Sm90;
+using OperatorClass       = cutlass::arch::OpClassTensorOp;
+
+// Epilogue fusions of the layer
+using LinCombFusion       = cutlass::epilogue::fusion::LinearCombination<Element, ElementCompute, Element>;
+using SiLuFusion          = cutlass::epilogue::fusion::LinCombEltAct<
+                              cutlass::epilogue::thread::SiLu, Element, ElementCompute, Element>;
+// D = acc * C, multiplying the up projection by SiLU(gate) loaded as the source operand
+using GatedFusion         = cutlass::epilogue::fusion::Sm90EVT<
+                              cutlass::epilogue::fusion::Sm90Compute<
+                                cutlass::multiplies, Element, ElementCompute, cutlass::FloatRoundStyle::round_to_nearest>,
+                              cutlass::epilogue::fusion::Sm90AccFetch,
+                              cutlass::epilogue::fusion::Sm90SrcFetch<Element>>;
+
+/// GEMM tile configuration of one phase
+template <class TileShape_, class ClusterShape_, class KernelSchedule_, class TileScheduler_>
+struct GemmConfig {
+  using TileShape = TileShape_;
+  using ClusterShape = ClusterShape_;
+  using KernelSchedule = KernelSchedule_;
+  using EpilogueSchedule = cutlass::epilogue::TmaWarpSpecializedCooperative;
+  using TileScheduler = TileScheduler_;
+};
+
+// Large tiles on clusters for the thousands of prefill rows
+using PrefillGemmConfig = GemmConfig<
+  Shape<_128,_256,_64>, Shape<_2,_1,_1>,
+  cutlass::gemm::KernelTmaWarpSpecializedCooperative, cutlass::gemm::PersistentScheduler>;
+
+// Narrow tiles split along K for the few decode rows
+using DecodeGemmConfig = GemmConfig<
+  Shape<_128,_64,_128>, Shape<_1,_1,_1>,
+  cutlass::gemm::KernelTmaWarpSpecializedCooperative, cutlass::gemm::StreamKScheduler>;
+
+template <class Config, class FusionOperation>
+struct DecoderGemm {
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      ArchTag, OperatorClass,
+      typename Config::TileShape, typename Config::ClusterShape,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      ElementAccumulator, ElementCompute,
+      Element, LayoutD, Alignment,
+      Element, LayoutD, Alignment,
+      typename Config::EpilogueSchedule,
+      FusionOperation
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      ArchTag, OperatorClass,
+      Element, LayoutA, Alignment,
+      Element, LayoutB, Alignment,
+      ElementAccumulator,
+      typename Config::TileShape, typename Config::ClusterShape,
+      cutlass::gemm::collective::StageCountAutoCarveout<
+        static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))
+      >,
+      typename Config::KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue,
+      typename Config::TileScheduler
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/// Attention of one phase, reading q, k and v with arbitrary (seq, batch, head) strides
+template <class Fusion>
+struct DecoderAttention {
+
+  using TileShape = Shape<_128,_128,_128>;
+  using ProblemShape = cute::tuple<int, int, int, int, int>;                  // B H Q K D
+  using StrideQ = cute::tuple<int, _1, cute::tuple<int, int>>;                // Q D (B H)
+  using StrideK = cute::tuple<int, _1, cute::tuple<int, int>>;                // K D (B H)
+  using StrideV = cute::tuple<int, _1, cute::tuple<int, int>>;                // K D (B H)
+  using StrideO = cute::tuple<int, _1, cute::tuple<int, int>>;                // Q D (B H)
+  using StrideLSE = cute::tuple<_1, cute::tuple<int, int>>;                   // Q (B H)
+
+  using Operation = cutlass::device::Universal<
+    typename cutlass::fmha::kernel::FmhaBuilder<
+      Element, ElementAccumulator, ElementAccumulator,
+      TileShape, StrideQ, StrideK, StrideV,
+      Fusion, cutlass::gemm::KernelTmaWarpSpecializedCooperative
+    >::Kernel>;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Decoder layer
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Owns the weights, activations and initialized kernels of one layer
+template <class Config, class AttentionFusion>
+struct DecoderLayer {
+
+  using LinCombGemm = typename DecoderGemm<Config, LinCombFusion>::Gemm;
+  using SiLuGemm = typename DecoderGemm<Config, SiLuFusion>::Gemm;
+  using GatedGemm = typename DecoderGemm<Config, GatedFusion>::Gemm;
+  using Attention = DecoderAttention<AttentionFusion>;
+
+  enum Op {
+    kNormAttn, kQkvProj, kAttention, kOutProj, kNormMlp, kGateProj, kUpProj, kDownProj, kOpCount
+  };
+
+  static char const *name(int op) {
+    static char const *names[kOpCount] = {
+      "rmsnorm (attention)",
+      "qkv_proj",
+      "attention",
+      "o_proj + residual",
+      "rmsnorm (mlp)",
+      "gate_proj + SiLU",
+      "up_proj * gate",
+      "down_proj + residual"
+    };
+    return names[op];
+  }
+
+  Options options;
+  cutlass::KernelHardwareInfo hw_info;
+
+  // Weights, stored out_features x in_features
+  cutlass::DeviceAllocation<Element> w_qkv, w_o, w_gate, w_up, w_down;
+  cutlass::DeviceAllocation<Element> gamma_attn, gamma_mlp;
+
+  // Activations
+  cutlass::DeviceAllocation<Element> x, x_norm, qkv, attn, h, h_norm, gate, up, y;
+  cutlass::DeviceAllocation<ElementAccumulator> lse;
+
+  // KV cache of the decode phase, batch x seq x heads x head_dim
+  cutlass::DeviceAllocation<Element> k_cache, v_cache;
+
+  LinCombGemm qkv_proj, out_proj, down_proj;
+  SiLuGemm gate_proj;
+  GatedGemm up_proj;
+  typename Attention::Operation attention;
+
+  std::vector<cutlass::device_memory::allocation<uint8_t>> workspaces;
+
+  DecoderLayer(Options const &options_, cutlass::KernelHardwareInfo const &hw_info_):
+    options(options_), hw_info(hw_info_) { }
+
+  /// Allocates and fills the tensors and initializes every kernel
+  void initialize() {
+    int T = options.tokens();
+    int E = options.hidden;
+    int F = options.ffn;
+
+    auto fill = [](cutlass::DeviceAllocation<Element> &block, size_t count, uint64_t seed, float scale) {
+      block.reset(count);
+      cutlass::reference::device::BlockFillRandomUniform(
+        block.get(), count, seed, scale, -scale);
+    };
+
+    uint64_t seed = 2026;
+    fill(w_qkv, size_t(3) * E * E, seed++, 0.02f);
+    fill(w_o, size_t(E) * E, seed++, 0.02f);
+    fill(w_gate, size_t(F) * E, seed++, 0.02f);
+    fill(w_up, size_t(F) * E, seed++, 0.02f);
+    fill(w_down, size_t(E) * F, seed++, 0.02f);
+    fill(gamma_attn, E, seed++, 1.0f);
+    fill(gamma_mlp, E, seed++, 1.0f);
+    fill(x, size_t(T) * E, seed++, 1.0f);
+
+    x_norm.reset(size_t(T) * E);
+    qkv.reset(size_t(T) * 3 * E);
+    attn.reset(size_t(T) * E);
+    h.reset(size_t(T) * E);
+    h_norm.reset(size_t(T) * E);
+    gate.reset(size_t(T) * F);
+    up.reset(size_t(T) * F);
+    y.reset(size_t(T) * E);
+    lse.reset(size_t(options.batch) * options.heads * options.seq_q());
+
+    if (options.decode()) {
+      fill(k_cache, size_t(options.batch) * options.seq * E, seed++, 1.0f);
+      fill(v_cache, size_t(options.batch) * options.seq * E, seed++, 1.0f);
+    }
+
+    initialize_gemm(qkv_proj, T, 3 * E, E, x_norm.get(), w_qkv.get(), qkv.get(), qkv.get(), 0.f);
+    initialize_gemm(out_proj, T, E, E, attn.get(), w_o.get(), x.get(), h.get(), 1.f);
+    initialize_gemm(gate_proj, T, F, E, h_norm.get(), w_gate.get(), gate.get(), gate.get(), 0.f);
+    initialize_gemm(up_proj, T, F, E, h_norm.get(), w_up.get(), gate.get(), up.get(), 0.f);
+    initialize_gemm(down_proj, T, E, F, up.get(), w_down.get(), h.get(), y.get(), 1.f);
+    initialize_attention();
+
+    CUDA_CHECK(cudaDeviceSynchronize());
+  }
+
+  /// D = epilogue(A @ B^T, C) with A of T x K and B of N x K, both K-major
+  template <class Gemm>
+  void initialize_gemm(
+      Gemm &gemm, int M, int N, int K,
+      Element const *ptr_A, Element const *ptr_B, Element const *ptr_C, Element *ptr_D, float beta) {
+
+    using StrideA = typename Gemm::GemmKernel::StrideA;
+    using StrideB = typename Gemm::GemmKernel::StrideB;
+    using StrideC = typename Gemm::GemmKernel::StrideC;
+    using StrideD = typename Gemm::GemmKernel::StrideD;
+
+    typename Gemm::Arguments arguments{
+      cutlass::gemm::GemmUniversalMode::kGemm,
+      {M, N, K, 1},
+      {ptr_A, cutlass::make_cute_packed_stride(StrideA{}, {M, K, 1}),
+       ptr_B, cutlass::make_cute_packed_stride(StrideB{}, {N, K, 1})},
+      {{}, ptr_C, cutlass::make_cute_packed_stride(StrideC{}, {M, N, 1}),
+       ptr_D, cutlass::make_cute_packed_stride(StrideD{}, {M, N, 1})},
+      hw_info
+    };
+
+    if constexpr (not cute::is_same_v<Gemm, GatedGemm>) {
+      arguments.epilogue.thread.alpha = 1.f;
+      arguments.epilogue.thread.beta = beta;
+    }
+
+    workspaces.emplace_back(Gemm::get_workspace_size(arguments));
+    CUTLASS_CHECK(gemm.can_implement(arguments));
+    CUTLASS_CHECK(gemm.initialize(arguments, workspaces.back().get()));
+  }
+
+  /// Reads q, k and v straight out of the fused projection (prefill) or the KV cache (decode)
+  void initialize_attention() {
+    int B = options.batch;
+    int H = options.heads;
+    int D = options.head_dim();
+    int E = options.hidden;
+    int Q = options.seq_q();
+    int K = options.seq;
+
+    typename Attention::ProblemShape problem_size{B, H, Q, K, D};
+
+    // Token t of sequence b is row b * Q + t of qkv, holding q, k and v of every head
+    auto stride_Q = make_stride(3 * E, _1{}, make_stride(Q * 3 * E, D));
+    auto stride_O = make_stride(E, _1{}, make_stride(Q * E, D));
+    auto stride_LSE = make_stride(_1{}, make_stride(H * Q, Q));
+
+    Element const *ptr_K = qkv.get() + E;
+    Element const *ptr_V = qkv.get() + 2 * E;
+    auto stride_KV = stride_Q;
+    if (options.decode()) {
+      ptr_K = k_cache.get();
+      ptr_V = v_cache.get();
+      stride_KV = make_stride(E, _1{}, make_stride(K * E, D));
+    }
+
+    typename Attention::Operation::Arguments arguments{
+      problem_size,
+      { qkv.get(), stride_Q,
+        ptr_K, stride_KV,
+        ptr_V, stride_KV },
+      { attn.get(), stride_O,
+        lse.get(), stride_LSE },
+      hw_info
+    };
+
+    workspaces.emplace_back(Attention::Operation::get_workspace_size(arguments));
+    CUTLASS_CHECK(attention.can_implement(arguments));
+    CUTLASS_CHECK(attention.initialize(arguments, workspaces.back().get()));
+  }
+
+  /// Launches one op of the layer
+  void run(int op, cudaStream_t stream, bool launch_with_pdl) {
+    int T = options.tokens();
+    int E = options.hidden;
+    cutlass::MatrixCoord extent{T, E};
+    cutlass::layout::RowMajor layout(E);
+
+    switch (op) {
+    case kNormAttn:
+      // The util RMSNorm kernel does not wait on its predecessor, so it is never launched with PDL
+      cutlass::rmsnorm(extent, {x_norm.get(), layout}, {x.get(), layout}, {gamma_attn.get(), layout}, stream);
+      break;
+    case kQkvProj:
+      CUTLASS_CHECK(qkv_proj.run(stream, nullptr, launch_with_pdl));
+      break;
+    case kAttention:
+      CUTLASS_CHECK(attention.run(stream, launch_with_pdl));
+      break;
+    case kOutProj:
+      CUTLASS_CHECK(out_proj.run(stream, nullptr, launch_with_pdl));
+      break;
+    case kNormMlp:
+      cutlass::rmsnorm(extent, {h_norm.get(), layout}, {h.get(), layout}, {gamma_mlp.get(), layout}, stream);
+      break;
+    case kGateProj:
+      CUTLASS_CHECK(gate_proj.run(stream, nullptr, launch_with_pdl));
+      break;
+    case kUpProj:
+      CUTLASS_CHECK(up_proj.run(stream, nullptr, launch_with_pdl));
+      break;
+    case kDownProj:
+      CUTLASS_CHECK(down_proj.run(stream, nullptr, launch_with_pdl));
+      break;
+    default:
+      break;
+    }
+  }
+
+  /// Launches the whole layer
+  void run(cudaStream_t stream, bool launch_with_pdl) {
+    for (int op = 0; op < kOpCount; ++op) {
+      run(op, stream, launch_with_pdl);
+    }
+  }
+
+  /// Tensor core FLOPs of one op, zero for memory-bound ops
+  double flops(int op) const {
+    double T = options.tokens();
+    double E = options.hidden;
+    double F = options.ffn;
+    double B = options.batch;
+    double H = options.heads;
+    double D = options.head_dim();
+    double S = options.seq;
+
+    switch (op) {
+    case kQkvProj:   return 2 * T * 3 * E * E;
+    case kOutProj:   return 2 * T * E * E;
+    case kGateProj:  return 2 * T * F * E;
+    case kUpProj:    return 2 * T * F * E;
+    case kDownProj:  return 2 * T * E * F;
+    case kAttention:
+      // Two GEMMs of 2 * Q * K * D per head, causal prefill skips half of them
+      return options.decode() ? 4 * B * H * S * D : 2 * B * H * S * S * D;
+    default:
+      return 0;
+    }
+  }
+
+  double flops() const {
+    double total = 0;
+    for (int op = 0; op < kOpCount; ++op) {
+      total += flops(op);
+    }
+    return total;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Benchmark
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+void print_row(std::string const &name, double runtime_us, double share, double flops, Options const &options) {
+  double tflops = flops / (runtime_us * 1.0e6);
+  std::cout << "  " << std::left << std::setw(24) << name << std::right
+            << std::fixed << std::setprecision(1)
+            << std::setw(12) << runtime_us
+            << std::setw(9) << share * 100.0 << "%";
+  if (flops > 0) {
+    std::cout << std::setw(12) << tflops
+              << std::setw(9) << 100.0 * tflops / options.peak_tflops << "%";
+  }
+  std::cout << std::endl;
+}
+
+template <class Layer>
+void run(Options const &options, cutlass::KernelHardwareInfo const &hw_info) {
+
+  Layer layer(options, hw_info);
+  layer.initialize();
+
+  cudaStream_t stream;
+  CUDA_CHECK(cudaStreamCreate(&stream));
+
+  std::cout << "  Mode: " << options.mode << ", batch " << options.batch << ", "
+            << (options.decode() ? "KV cache " : "sequence ") << options.seq << ", hidden " << options.hidden
+            << ", heads " << options.heads << ", ffn " << options.ffn
+            << ", tokens " << options.tokens() << "\n\n";
+
+  //
+  // Per-op times, with events between the ops and no PDL overlap
+  //
+
+  std::vector<cudaEvent_t> events(Layer::kOpCount + 1);
+  for (auto &event : events) {
+    CUDA_CHECK(cudaEventCreate(&event));
+  }
+  std::vector<double> op_us(Layer::kOpCount, 0);
+
+  for (int iter = 0; iter < options.warmup; ++iter) {
+    layer.run(stream, false);
+  }
+  for (int iter = 0; iter < options.iterations; ++iter) {
+    for (int op = 0; op < Layer::kOpCount; ++op) {
+      CUDA_CHECK(cudaEventRecord(events[op], stream));
+      layer.run(op, stream, false);
+    }
+    CUDA_CHECK(cudaEventRecord(events[Layer::kOpCount], stream));
+    CUDA_CHECK(cudaEventSynchronize(events[Layer::kOpCount]));
+
+    for (int op = 0; op < Layer::kOpCount; ++op) {
+      float elapsed_ms = 0;
+      CUDA_CHECK(cudaEventElapsedTime(&elapsed_ms, events[op], events[op + 1]));
+      op_us[op] += 1000.0 * elapsed_ms / options.iterations;
+    }
+  }
+
+  for (auto &event : events) {
+    CUDA_CHECK(cudaEventDestroy(event));
+  }
+
+  double sum_us = 0;
+  for (double us : op_us) {
+    sum_us += us;
+  }
+
+  std::cout << "  " << std::left << std::setw(24) << "op" << std::right
+            << std::setw(12) << "time (us)" << std::setw(10) << "share"
+            << std::setw(12) << "TFLOP/s" << std::setw(10) << "MFU" << "\n";
+  for (int op = 0; op < Layer::kOpCount; ++op) {
+    print_row(Layer::name(op), op_us[op], op_us[op] / sum_us, layer.flops(op), options);
+  }
+  print_row("sum of ops", sum_us, 1.0, layer.flops(), options);
+  std::cout << "\n";
+
+  //
+  // End-to-end times
+  //
+
+  GpuTimer timer;
+  auto time_layer = [&](auto &&launch) {
+    for (int iter = 0; iter < options.warmup; ++iter) {
+      launch();
+    }
+    timer.start(stream);
+    for (int iter = 0; iter < options.iterations; ++iter) {
+      launch();
+    }
+    timer.stop();
+    return 1000.0 * timer.elapsed_millis() / options.iterations;
+  };
+
+  double eager_us = time_layer([&]() { layer.run(stream, options.pdl); });
+  print_row(options.pdl ? "layer, eager + PDL" : "layer, eager", eager_us, eager_us / sum_us, layer.flops(), options);
+
+  if (options.graph) {
+    cudaGraph_t graph;
+    cudaGraphExec_t graph_exec;
+    CUDA_CHECK(cudaStreamBeginCapture(stream, cudaStreamCaptureModeGlobal));
+    layer.run(stream, options.pdl);
+    CUDA_CHECK(cudaStreamEndCapture(stream, &graph));
+    CUDA_CHECK(cudaGraphInstantiate(&graph_exec, graph, 0));
+
+    double graph_us = time_layer([&]() { CUDA_CHECK(cudaGraphLaunch(graph_exec, stream)); });
+    print_row(options.pdl ? "layer, graph + PDL" : "layer, graph", graph_us, graph_us / sum_us, layer.flops(), options);
+
+    CUDA_CHECK(cudaGraphExecDestroy(graph_exec));
+    CUDA_CHECK(cudaGraphDestroy(graph));
+  }
+
+  std::cout << "\n  Share of the layer rows is relative to the sum of the ops; MFU is relative to "
+            << options.peak_tflops << " TFLOP/s." << std::endl;
+
+  CUDA_CHECK(cudaStreamDestroy(stream));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const **args) {
+
+  // CUTLASS must be compiled with CUDA 12.0 Toolkit to run this example
+  // and must have compute capability at least 90.
+  if (__CUDACC_VER_MAJOR__ < 12) {
+    std::cerr << "This example requires CUDA 12 or newer.\n";
+    // Returning zero so this test passes on older Toolkits. Its actions are no-op.
+    return 0;
+  }
+
+  cudaDeviceProp props;
+  int current_device_id;
+  CUDA_CHECK(cudaGetDevice(&current_device_id));
+  CUDA_CHECK(cudaGetDeviceProperties(&props, current_device_id));
+  if (props.major != 9 || props.minor != 0) {
+    std::cerr
+      << "This example requires a GPU of NVIDIA's Hopper Architecture (compute capability 90).\n";
+    return 0;
+  }
+
+  //
+  // Parse options
+  //
+
+  Options options;
+
+  options.parse(argc, args);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  if (!options.valid(std::cerr)) {
+    return -1;
+  }
+
+  //
+  // Evaluate the layer
+  //
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = current_device_id;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  if (options.decode()) {
+    run<DecoderLayer<DecodeGemmConfig, cutlass::fmha::collective::ResidualFusion>>(options, hw_info);
+  }
+  else {
+    run<DecoderLayer<PrefillGemmConfig, cutlass::fmha::collective::CausalFusion>>(options, hw_info);
+  }
+#endif
+
+  return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
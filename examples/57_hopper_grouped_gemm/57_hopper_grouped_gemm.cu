@@ -210,6 +210,8 @@ std::vector<ElementAccumulator> beta_host;
 
 // Device-side allocations
 cutlass::DeviceAllocation<typename ProblemShape::UnderlyingProblemShape> problem_sizes;
+// Device-side group count, as it would be produced by e.g. an MoE router kernel
+cutlass::DeviceAllocation<int32_t> group_count;
 
 cutlass::DeviceAllocation<typename Gemm::ElementA> block_A;
 cutlass::DeviceAllocation<typename Gemm::ElementB> block_B;
@@ -478,6 +480,9 @@ void initialize(const Options &options) {
   problem_sizes.reset(options.groups);
   problem_sizes.copy_from_host(options.problem_sizes_host.data());
 
+  group_count.reset(1);
+  group_count.copy_from_host(&options.groups);
+
   //
   // Assign pointers
   //
@@ -601,9 +606,12 @@ typename GemmT::Arguments args_from_options(const Options &options, bool host_pr
     };
   }
   else {
+    // Problem shapes and the group count are only read on the device, so they could be written
+    // by a preceding kernel on the same stream without synchronizing. options.groups acts as an
+    // upper bound on the group count for host-side sizing.
     arguments = typename GemmT::Arguments {
       cutlass::gemm::GemmUniversalMode::kGrouped,
-      {options.groups, problem_sizes.get(), nullptr},
+      {options.groups, problem_sizes.get(), nullptr, group_count.get()},
       {ptr_A.get(), stride_A.get(), ptr_B.get(), stride_B.get()},
       {fusion_args, ptr_C.get(), stride_C.get(), ptr_D.get(), stride_D.get()},
       kernel_hw_info
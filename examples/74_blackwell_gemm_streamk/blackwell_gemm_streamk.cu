@@ -43,7 +43,7 @@
       * StreamK: parallelizes work according to the stream-K load balancing method described in https://arxiv.org/abs/2301.03598
       * Heuristic: applies an internal heuristic in attempt to choose the most performant among the three preceding decomposition modes
 
-    Additionally, the Stream-K scheduler supports two different means of performing reductions for
+    Additionally, the Stream-K scheduler supports three different means of performing reductions for
     decomposition modes that require reduction (SplitK, StreamK, and Heuristic):
       * Deterministic: Participating CTAs perform reduction in a turnstile fashion in order of the K mode
                        covered by each CTA. This requires a lock to be held exclusively by the CTA that is
@@ -55,6 +55,10 @@
                           be performed). Due to the nondeterminsitic ordering of accumulation, deterministic numeric
                           behavior cannot be guaranteed with this mode (e.g., floating-point rounding error will depend
                           on the order of accumulation)
+      * DeterministicTree: Participating CTAs write their partial values to their own portion of the workspace without
+                           waiting on one another, and the CTA computing the final split adds them pairwise in order of
+                           the K mode covered by each CTA. Numeric behavior is deterministic, while only the final CTA
+                           waits, at the cost of a workspace partial per participating CTA.
 
     This example allows one to try out different decomposition modes, reduction modes, and (when using Split-K) splitting factors.
     Here are a few examples of usage:
@@ -69,6 +73,9 @@
 
       # Stream-K mode with nondeterministic reduction
       ./74_blackwell_gemm_streamk" --m=256 --n=256 --k=16384 --decomposition=StreamK --reduction=Nondeterministic
+
+      # Stream-K mode with deterministic tree reduction
+      ./74_blackwell_gemm_streamk" --m=256 --n=256 --k=16384 --decomposition=StreamK --reduction=DeterministicTree
 */
 
 
@@ -231,8 +238,9 @@ struct Options {
   };
 
   std::unordered_map<ReductionMode, std::vector<std::string>> red_mappings = {
-    {ReductionMode::Deterministic,    {"Deterministic", "deterministic", "d", "D", ""}},
-    {ReductionMode::Nondeterministic, {"Nondeterministic", "nondeterministic", "n", "N"}}
+    {ReductionMode::Deterministic,     {"Deterministic", "deterministic", "d", "D", ""}},
+    {ReductionMode::Nondeterministic,  {"Nondeterministic", "nondeterministic", "n", "N"}},
+    {ReductionMode::DeterministicTree, {"DeterministicTree", "deterministictree", "t", "T"}}
   };
 
   Options():
@@ -281,7 +289,7 @@ struct Options {
     cmd.get_cmd_line_argument("reduction", red_mode);
     found = parse_from_options_map(red_mode, red_mappings, reduction_mode);
     if (!found) {
-      std::cout << "--reduction must be one of Deterministic and Nondeterministic" << std::endl;
+      std::cout << "--reduction must be one of Deterministic, Nondeterministic, and DeterministicTree" << std::endl;
       help = true;
       return;
     }
@@ -302,7 +310,7 @@ struct Options {
       << "  --cluster_m=<str>           Sets the M extent of the cluster shape\n"
       << "  --cluster_n=<str>           Sets the N extent of the cluster shape\n"
       << "  --decomposition=<str>       Mode in which the stream-K kernel should decompose the problem. Options: Heuristic (default), SplitK, StreamK, DataParallel\n"
-      << "  --reduction=<str>           Mode in which the stream-K kernel's reduction should be performed. Options: Deterministic (default), Nondeterministic\n"
+      << "  --reduction=<str>           Mode in which the stream-K kernel's reduction should be performed. Options: Deterministic (default), Nondeterministic, DeterministicTree\n"
       << "  --iterations=<int>          Number of profiling iterations to perform.\n\n";
 
     out
@@ -55,6 +55,13 @@
     (max_seqlen, cumulative_seqlen_ptr) in the problem shape for
     seqlen Q and KV.
 
+    Head Dimensions
+    ---------------
+
+    The head dim mode of the problem shape is either D, or (D_VO, D_QK - D_VO) when V and O
+    are narrower than Q and K, e.g. d_qk = 192 and d_v = 128 as in DeepSeek-style attention,
+    so V does not have to be padded to the QK^T head dim.
+
     Support
     ---------
 
@@ -67,7 +74,9 @@
             --b=2048 --h=2048 --d=2048 --q=2048 --k=2048
 */
 
+#include <algorithm>
 #include <iostream>
+#include <numeric>
 #include <random>
 #include <regex>
 
@@ -86,6 +95,7 @@
 #include "collective/fmha_fusion.hpp"
 #include "collective/sm100_fmha_fwd_mainloop_tma_warpspecialized.hpp"
 #include "collective/sm100_fmha_fwd_epilogue_tma_warpspecialized.hpp"
+#include "kernel/fmha_kernel_lse_merge.hpp"
 #include "kernel/fmha_options.hpp"
 #include "kernel/fmha_tile_scheduler.hpp"
 #include "kernel/sm100_fmha_fwd_kernel_tma_warpspecialized.hpp"
@@ -119,6 +129,7 @@ struct Options {
   std::vector<int> varlen_q;
   std::vector<int> varlen_k;
   int d = 128;
+  int d_vo = 128;
   int warmup_iterations = 1;
   int iterations = 3;
   int tensor_ring_buffers = 1;
@@ -128,8 +139,20 @@ struct Options {
   bool causal = false;
   bool causal_q_begin = true;
   bool residual = false;
+  bool sliding_window = false;
+  int window_size = 256;
+  bool block_sparse = false;
+  int doc_size = 1024;
+  int page = 0; // page size of a paged K/V, contiguous K/V if zero
   bool varlen = false;
   bool persistent = false;
+  bool rope = false;
+  bool rope_table = false;
+  float softcap = 0.0f;
+  bool alibi = false;
+  float dropout = 0.0f;
+  uint64_t dropout_seed = 0;
+  std::string lse_merge; // merges two kv shards through the epilogue or the merge kernel, off if empty
   int sm_count = 0;
   std::string kernel_filter;
 
@@ -178,6 +201,7 @@ struct Options {
     }
 
     cmd.get_cmd_line_argument("d", d, defaults.d);
+    cmd.get_cmd_line_argument("d_vo", d_vo, d);
     cmd.get_cmd_line_argument("h", h, -1);
     if (h == -1) h = 2048 / d;
 
@@ -288,6 +312,61 @@ struct Options {
       residual = true;
       causal = false;
     }
+    else if (mask == "sliding-window") {
+      residual = causal = false;
+      sliding_window = true;
+      causal_q_begin = causal_type != "qend";
+    }
+    else if (mask == "block-sparse") {
+      residual = causal = false;
+      block_sparse = true;
+      if (varlen) {
+        std::cout << "Error: --mask=block-sparse does not support --varlen\n";
+        std::exit(-1);
+      }
+    }
+    cmd.get_cmd_line_argument("window-size", window_size, defaults.window_size);
+    cmd.get_cmd_line_argument("doc-size", doc_size, defaults.doc_size);
+    if (doc_size <= 0) {
+      std::cout << "Error: --doc-size must be positive\n";
+      std::exit(-1);
+    }
+    cmd.get_cmd_line_argument("page", page, defaults.page);
+    if (page < 0 || (page > 0 && varlen)) {
+      std::cout << "Error: --page must be positive and does not support --varlen\n";
+      std::exit(-1);
+    }
+    rope_table = cmd.check_cmd_line_flag("rope-table");
+    rope = rope_table || cmd.check_cmd_line_flag("rope");
+    if (rope && varlen) {
+      std::cout << "Error: --rope does not support --varlen\n";
+      std::exit(-1);
+    }
+    cmd.get_cmd_line_argument("softcap", softcap, defaults.softcap);
+    alibi = cmd.check_cmd_line_flag("alibi");
+    if ((softcap > 0 || alibi) && (sliding_window || block_sparse)) {
+      std::cout << "Error: --softcap and --alibi are not instantiated with --mask=" << mask << "\n";
+      std::exit(-1);
+    }
+    cmd.get_cmd_line_argument("dropout", dropout, defaults.dropout);
+    cmd.get_cmd_line_argument("dropout-seed", dropout_seed, defaults.dropout_seed);
+    if (dropout < 0 || dropout >= 1) {
+      std::cout << "Error: --dropout must be in [0, 1)\n";
+      std::exit(-1);
+    }
+    if (dropout > 0 && (softcap > 0 || alibi || sliding_window || block_sparse)) {
+      std::cout << "Error: --dropout is not instantiated with score modifications or --mask=" << mask << "\n";
+      std::exit(-1);
+    }
+    cmd.get_cmd_line_argument<std::string>("lse-merge", lse_merge, "");
+    if (lse_merge != "" && lse_merge != "epilogue" && lse_merge != "kernel") {
+      std::cout << "Error: --lse-merge must be epilogue or kernel\n";
+      std::exit(-1);
+    }
+    if (lse_merge != "" && (causal || sliding_window || block_sparse || varlen || page > 0 || rope || alibi || dropout > 0)) {
+      std::cout << "Error: --lse-merge needs a position independent problem, use --mask=no or --mask=residual\n";
+      std::exit(-1);
+    }
     cmd.get_cmd_line_argument("sm-count", sm_count, defaults.sm_count);
     get_init_style_argument(cmd, "init-style", init_style_q, defaults.init_style_q);
     get_init_style_argument(cmd, "init-style", init_style_k, defaults.init_style_q);
@@ -315,14 +394,30 @@ struct Options {
       << "  --varlen-q=<int>:<int...>   Sets the variable Q extent per batch (colon separated)\n"
       << "  --varlen-k=<int>:<int...>   Sets the variable K extent per batch (colon separated)\n"
       << "  --d=<int>                   Sets the D extent\n"
+      << "  --d_vo=<int>                Sets the D_VO extent, defaults to D\n"
       << "  --tensor_ring_buffers=<int> Sets the number of tensor ring buffers\n"
       << "  --warmup_iterations=<int>   Sets the warmup iterations\n"
       << "  --iterations=<int>          Benchmarking iterations\n"
       << "  --verify                    Verify results\n"
       << "  --verbose                   Print smem and execution time per kernel\n"
-      << "  --mask=<no|residual|causal> Enables masking\n"
-      << "  --causal-type=<qbegin|qend> Causal mask type\n"
+      << "  --mask=<no|residual|causal|sliding-window|block-sparse>\n"
+      << "                              Enables masking\n"
+      << "  --causal-type=<qbegin|qend> Causal and sliding window mask type\n"
+      << "  --window-size=<int>         Sets the left window size of the sliding window mask\n"
+      << "  --doc-size=<int>            Sets the length of the documents packed into each\n"
+      << "                              sequence for the block-sparse mask\n"
+      << "  --page=<int>                Reads K and V through a page table with pages of the\n"
+      << "                              given size (a multiple of the K/V tile), in random order\n"
       << "  --persistent                Enables persistent scheduler\n"
+      << "  --rope                      Applies rotary position embedding to Q and K in the kernel\n"
+      << "  --rope-table                Same as --rope, with precomputed cos/sin tables\n"
+      << "  --softcap=<float>           Soft-caps the logits to (-softcap, softcap) with tanh\n"
+      << "  --alibi                     Adds the ALiBi bias with the standard per-head slopes\n"
+      << "  --dropout=<float>           Drops out P with the given probability in the kernel\n"
+      << "  --dropout-seed=<int>        Sets the seed of the dropout random number generator\n"
+      << "  --lse-merge=<epilogue|kernel>\n"
+      << "                              Verifies two halves of K/V merged through their LSE, by the\n"
+      << "                              accumulating epilogue or by the LSE merge kernel\n"
       << "  --varlen                    Enables variable sequence length\n"
       << "                              B*Q and B*K become the total sequence length\n"
       << "                              and are split B-ways, alternatingly +10% and -10%\n"
@@ -419,9 +514,13 @@ struct FwdRunner {
   using ElementAccumulatorPV = float;
   using ElementOut = cutlass::half_t;
 
+  // the head dim is (D_VO, D_QK - D_VO) if the tile splits it, see head_dim_qk
+  static constexpr bool kIsSplitHeadDim = rank_v<decltype(get<2>(TileShape{}))> == 2;
+  using HeadDimType = std::conditional_t<kIsSplitHeadDim, cute::tuple<int, int>, int>;
+
   // Q K D ((H_R, H_K) B)
-  using ProblemShapeRegular = cute::tuple<int, int, int, cute::tuple<cute::tuple<int, int>, int>>;
-  using ProblemShapeVarlen = cute::tuple<VariableLength, VariableLength, int, cute::tuple<cute::tuple<int, int>, int>>;
+  using ProblemShapeRegular = cute::tuple<int, int, HeadDimType, cute::tuple<cute::tuple<int, int>, int>>;
+  using ProblemShapeVarlen = cute::tuple<VariableLength, VariableLength, HeadDimType, cute::tuple<cute::tuple<int, int>, int>>;
   using ProblemShapeType = std::conditional_t<kIsVarlen, ProblemShapeVarlen, ProblemShapeRegular>;
   
   using StrideQ = cute::tuple<int, _1, cute::tuple<cute::tuple<int, int>, int>>;  // Q D ((H_R, H_K), B)
@@ -430,14 +529,28 @@ struct FwdRunner {
   using StrideO = StrideQ;
   using StrideLSE = cute::tuple<_1, cute::tuple<cute::tuple<int, int>, int>>;     // Q ((H_R, H_K), B)
 
+  // runtime state of the mask
+  ActiveMask mask;
+  DeviceAllocation<int> block_sparse_row_offsets;
+  DeviceAllocation<int> block_sparse_col_indices;
+  double block_sparse_attended = 0;
+  DeviceAllocation<float> block_alibi_slopes;
+
   static constexpr bool kIsPersistent = find_option_t<Tag::kIsPersistent, true_type, KernelOptions...>::value;
-  using TileScheduler = std::conditional_t<kIsPersistent, cutlass::fmha::kernel::PersistentTileScheduler, cutlass::fmha::kernel::IndividualTileScheduler>;
+  using IsRope = find_option_t<Tag::kIsRope, false_type, KernelOptions...>;
+  static constexpr bool kIsRope = IsRope::value;
+  static constexpr double kRopeTheta = 10000.0;
+  // persistent varlen kernels only visit the tiles inside each sequence
+  using PersistentTileScheduler = std::conditional_t<kIsVarlen,
+      cutlass::fmha::kernel::VariableLengthPersistentTileScheduler,
+      cutlass::fmha::kernel::PersistentTileScheduler>;
+  using TileScheduler = std::conditional_t<kIsPersistent, PersistentTileScheduler, cutlass::fmha::kernel::IndividualTileScheduler>;
 
   using Mainloop = 
     cutlass::fmha::collective::Sm100FmhaFwdMainloopTmaWarpspecialized<
       Element, ElementAccumulatorQK, ElementAccumulatorPV,
       TileShape, StrideQ, StrideK, StrideV,
-      ActiveMask
+      ActiveMask, Shape<_2, _1, _1>, cute::false_type, IsRope
     >;
   using Operation = cutlass::fmha::device::FMHA<
     cutlass::fmha::kernel::Sm100FmhaFwdKernelTmaWarpspecialized<
@@ -473,6 +586,9 @@ struct FwdRunner {
     DeviceAllocation<ElementAccumulatorPV> block_ref_LSE;
     DeviceAllocation<int> device_cumulative_seqlen_q;
     DeviceAllocation<int> device_cumulative_seqlen_kv;
+    // K and V copied to the pages of the page table for --page
+    DeviceAllocation<Element> block_paged_K;
+    DeviceAllocation<Element> block_paged_V;
 
     DeviceBuffer() = default;
     DeviceBuffer(const DeviceBuffer&) = delete;
@@ -482,33 +598,64 @@ struct FwdRunner {
       return block_Q.get_storage_size() + block_K.get_storage_size() + block_V.get_storage_size()
           + block_O.get_storage_size() + block_LSE.get_storage_size() + block_ref_O.get_storage_size()
           + block_ref_LSE.get_storage_size() + device_cumulative_seqlen_q.get_storage_size()
-          + device_cumulative_seqlen_kv.get_storage_size();
+          + device_cumulative_seqlen_kv.get_storage_size() + block_paged_K.get_storage_size()
+          + block_paged_V.get_storage_size();
     }
   };
 
   std::vector<std::unique_ptr<DeviceBuffer>> buffers;
 
+  // [position, D/2] angles of the rotary position embedding for --rope-table
+  DeviceAllocation<float> block_rope_cos;
+  DeviceAllocation<float> block_rope_sin;
+
   std::vector<int> cumulative_seqlen_q;
   std::vector<int> cumulative_seqlen_kv;
 
+  // [pages per batch, B] page table for --page, the pages of all batches in random order
+  int page_size = 0;
+  int pages_per_batch = 0;
+  std::vector<int> page_table;
+  DeviceAllocation<int> block_page_table;
+
   //
   // Methods
   //
+
+  /// Copies the [seqlen, row_size] rows of each batch of a contiguous K or V to the pages of the page table
+  void copy_to_pages(DeviceAllocation<Element>& block_paged, DeviceAllocation<Element> const& block, int seqlen, int row_size) {
+    std::vector<Element> contiguous(block.size());
+    block.copy_to_host(contiguous.data(), contiguous.size());
+    std::vector<Element> paged(block_paged.size(), Element(0));
+    int batches = static_cast<int>(page_table.size()) / pages_per_batch;
+    for (int b = 0; b < batches; b++) {
+      for (int row = 0; row < seqlen; row++) {
+        size_t page = page_table[b * pages_per_batch + row / page_size];
+        std::copy_n(contiguous.begin() + (static_cast<size_t>(b) * seqlen + row) * row_size, row_size,
+                    paged.begin() + (page * page_size + row % page_size) * row_size);
+      }
+    }
+    block_paged.copy_from_host(paged.data(), paged.size());
+  }
+
   bool verify(const ProblemShapeType& problem_shape, DeviceBuffer& buffer) {
+    int D_QK = head_dim_qk(problem_shape);
+    int D_VO = head_dim_vo(problem_shape);
+
     Tensor mQ = make_tensor(make_gmem_ptr(buffer.block_Q.get()),
-      select<0,2,3>(problem_shape),
+      replace<1>(select<0,2,3>(problem_shape), D_QK),
       stride_Q);
 
     Tensor mK = make_tensor(make_gmem_ptr(buffer.block_K.get()),
-      select<1,2,3>(problem_shape),
+      replace<1>(select<1,2,3>(problem_shape), D_QK),
       stride_K);
 
     Tensor mV = make_tensor(make_gmem_ptr(buffer.block_V.get()),
-      select<1,2,3>(problem_shape),
+      replace<1>(select<1,2,3>(problem_shape), D_VO),
       stride_V);
 
     Tensor mO = make_tensor(make_gmem_ptr(buffer.block_ref_O.get()),
-      select<0,2,3>(problem_shape),
+      replace<1>(select<0,2,3>(problem_shape), D_VO),
       stride_O);
 
     Tensor mLSE = make_tensor(make_gmem_ptr(buffer.block_ref_LSE.get()),
@@ -517,9 +664,22 @@ struct FwdRunner {
     
     auto [Q, K, D, HB] = problem_shape;
 
-    auto problem_shape_ref = cute::make_tuple(Q, K, D, D, HB);
-
-    fmha_reference(problem_shape_ref, mQ, mK, mV, mO, mLSE, ActiveMask{});
+    // a split head dim takes the MLA path of the reference
+    auto problem_shape_ref = cute::make_tuple(Q, K, D, D_VO, HB);
+
+    if constexpr (kIsRope) {
+      // the reference attends to rotated copies of Q and K
+      DeviceAllocation<Element> block_rope_Q(buffer.block_Q.size());
+      DeviceAllocation<Element> block_rope_K(buffer.block_K.size());
+      Tensor mRopeQ = make_tensor(make_gmem_ptr(block_rope_Q.get()), mQ.layout());
+      Tensor mRopeK = make_tensor(make_gmem_ptr(block_rope_K.get()), mK.layout());
+      fmha_rope_reference(mQ, mRopeQ, kRopeTheta);
+      fmha_rope_reference(mK, mRopeK, kRopeTheta);
+      fmha_reference(problem_shape_ref, mRopeQ, mRopeK, mV, mO, mLSE, mask);
+    }
+    else {
+      fmha_reference(problem_shape_ref, mQ, mK, mV, mO, mLSE, mask);
+    }
 
     cudaError_t result = cudaDeviceSynchronize();
     if (result != cudaSuccess) {
@@ -625,7 +785,14 @@ struct FwdRunner {
   ProblemShapeType initialize(const Options& options) {
     int h_r = options.h / options.h_k;
     assert(options.h % options.h_k == 0);
-    auto problem_shape_in = cute::make_tuple(options.q, options.k, options.d, cute::make_tuple(cute::make_tuple(h_r, options.h_k), options.b));
+    HeadDimType head_dim;
+    if constexpr (kIsSplitHeadDim) {
+      head_dim = cute::make_tuple(options.d_vo, options.d - options.d_vo);
+    }
+    else {
+      head_dim = options.d;
+    }
+    auto problem_shape_in = cute::make_tuple(options.q, options.k, head_dim, cute::make_tuple(cute::make_tuple(h_r, options.h_k), options.b));
     
     ProblemShapeType problem_shape;
     decltype(problem_shape_in) problem_size;
@@ -640,24 +807,34 @@ struct FwdRunner {
       problem_shape = problem_shape_in;
     }
 
-    get<2>(problem_size) = cutlass::round_up(get<2>(problem_size), 8);  // alignment
-
-    auto shape_QO = select<0,2,3>(problem_size);
-    auto shape_KV = select<1,2,3>(problem_size);
-    auto shape_LSE = select<0,3>(problem_size);
+    // alignment
+    if constexpr (kIsSplitHeadDim) {
+      get<2,0>(problem_size) = cutlass::round_up(get<2,0>(problem_size), 8);
+      get<2,1>(problem_size) = cutlass::round_up(get<2,1>(problem_size), 8);
+    }
+    else {
+      get<2>(problem_size) = cutlass::round_up(get<2>(problem_size), 8);
+    }
 
     int SQ = size<0>(problem_size);
     int SK = size<1>(problem_size);
-    int D = size<2>(problem_size);
+    int D = head_dim_qk(problem_size);
+    int D_VO = head_dim_vo(problem_size);
     int H  = size<3,0>(problem_size);
     int H_K = size<3,0,1>(problem_size);
     int H_Q = size<3,0,0>(problem_size);
     int B = size<3,1>(problem_size);
 
+    auto shape_Q = make_shape(SQ, D, get<3>(problem_size));
+    auto shape_K = make_shape(SK, D, get<3>(problem_size));
+    auto shape_V = make_shape(SK, D_VO, get<3>(problem_size));
+    auto shape_O = make_shape(SQ, D_VO, get<3>(problem_size));
+    auto shape_LSE = select<0,3>(problem_size);
+
     stride_Q = make_stride(H*D , _1{}, make_stride(make_stride(D, H_Q*D), H*D*SQ));
-    stride_O = stride_Q;
+    stride_O = make_stride(H*D_VO , _1{}, make_stride(make_stride(D_VO, H_Q*D_VO), H*D_VO*SQ));
     stride_K = make_stride(H_K*D , _1{}, make_stride(make_stride(_0{}, D), H_K*D*SK));
-    stride_V = stride_K;
+    stride_V = make_stride(H_K*D_VO , _1{}, make_stride(make_stride(_0{}, D_VO), H_K*D_VO*SK));
     stride_LSE = make_stride(_1{}, make_stride(make_stride(SQ, SQ*H_Q), SQ*H));
 
     if (kIsVarlen) {
@@ -669,12 +846,12 @@ struct FwdRunner {
     }
 
     auto buffer_init_fn = [&](auto& buffer) {
-      buffer.block_Q.reset(size(shape_QO));
-      buffer.block_K.reset(size(shape_KV));
-      buffer.block_V.reset(size(shape_KV));
-      buffer.block_O.reset(size(shape_QO), kIsVarlen ? D*SQ*H : 0);
+      buffer.block_Q.reset(size(shape_Q));
+      buffer.block_K.reset(size(shape_K));
+      buffer.block_V.reset(size(shape_V));
+      buffer.block_O.reset(size(shape_O), kIsVarlen ? D_VO*SQ*H : 0);
       buffer.block_LSE.reset(size(shape_LSE));
-      buffer.block_ref_O.reset(size(shape_QO), kIsVarlen ? D*SQ*H : 0);
+      buffer.block_ref_O.reset(size(shape_O), kIsVarlen ? D_VO*SQ*H : 0);
       buffer.block_ref_LSE.reset(size(shape_LSE));
 
       initialize_block(buffer.block_Q, seed + 2023, options.init_style_q);
@@ -693,13 +870,34 @@ struct FwdRunner {
       }   
     };
 
+    if (options.page > 0) {
+      page_size = options.page;
+      pages_per_batch = ceil_div(SK, page_size);
+      page_table.resize(B * pages_per_batch);
+      std::iota(page_table.begin(), page_table.end(), 0);
+      std::shuffle(page_table.begin(), page_table.end(), std::mt19937(0x202410151200ull));
+      block_page_table.reset(page_table.size());
+      block_page_table.copy_from_host(page_table.data(), page_table.size());
+    }
+
+    auto buffer_page_fn = [&](auto& buffer) {
+      if (page_size > 0) {
+        buffer.block_paged_K.reset(page_table.size() * page_size * H_K * D);
+        buffer.block_paged_V.reset(page_table.size() * page_size * H_K * D_VO);
+        copy_to_pages(buffer.block_paged_K, buffer.block_K, SK, H_K * D);
+        copy_to_pages(buffer.block_paged_V, buffer.block_V, SK, H_K * D_VO);
+      }
+    };
+
     buffers.push_back(std::make_unique<DeviceBuffer>());
     buffer_init_fn(*buffers.back());
+    buffer_page_fn(*buffers.back());
 
     int tensor_ring_buffers = options.tensor_ring_buffers;
     for (int i = 1; i < tensor_ring_buffers; i++) {
       buffers.push_back(std::make_unique<DeviceBuffer>());
       buffer_init_fn(*buffers.back());
+      buffer_page_fn(*buffers.back());
     }
 
     if constexpr (kIsVarlen) {
@@ -707,9 +905,101 @@ struct FwdRunner {
       get<1>(problem_shape).cumulative_length = buffers[0]->device_cumulative_seqlen_kv.get();
     }
 
+    if (kIsRope && options.rope_table) {
+      int half_d = D / 2;
+      int positions = std::max(SQ, SK);
+      std::vector<float> rope_cos(positions * half_d);
+      std::vector<float> rope_sin(positions * half_d);
+      for (int pos = 0; pos < positions; pos++) {
+        for (int i = 0; i < half_d; i++) {
+          double angle = pos * std::pow(kRopeTheta, -2.0 * i / D);
+          rope_cos[pos * half_d + i] = static_cast<float>(std::cos(angle));
+          rope_sin[pos * half_d + i] = static_cast<float>(std::sin(angle));
+        }
+      }
+      block_rope_cos.reset(rope_cos.size());
+      block_rope_cos.copy_from_host(rope_cos.data(), rope_cos.size());
+      block_rope_sin.reset(rope_sin.size());
+      block_rope_sin.copy_from_host(rope_sin.data(), rope_sin.size());
+    }
+
+    if constexpr (is_sliding_window_mask_v<ActiveMask>) {
+      mask.window_size_left = options.window_size;
+      mask.window_size_right = 0;
+    }
+
+    if constexpr (is_block_sparse_mask_v<ActiveMask>) {
+      // documents of --doc-size tokens are packed into each sequence, and every
+      // query tile visits the kv tiles of the documents its rows belong to
+      int tile_q = get<0>(TileShape{});
+      int tile_kv = get<1>(TileShape{});
+      std::vector<int> row_offsets = {0};
+      std::vector<int> col_indices;
+      block_sparse_attended = 0;
+      for (int row_begin = 0; row_begin < SQ; row_begin += tile_q) {
+        int row_end = std::min(row_begin + tile_q, SQ);
+        int col_begin = std::min(row_begin / options.doc_size * options.doc_size, (SK - 1) / tile_kv * tile_kv);
+        int col_end = std::max(std::min(SK, ceil_div(row_end, options.doc_size) * options.doc_size), col_begin + 1);
+        for (int tile = col_begin / tile_kv; tile < ceil_div(col_end, tile_kv); tile++) {
+          col_indices.push_back(tile);
+          block_sparse_attended += 1.0 * (row_end - row_begin) * (std::min(SK, (tile + 1) * tile_kv) - tile * tile_kv);
+        }
+        row_offsets.push_back(static_cast<int>(col_indices.size()));
+      }
+      block_sparse_row_offsets.reset(row_offsets.size());
+      block_sparse_row_offsets.copy_from_host(row_offsets.data(), row_offsets.size());
+      block_sparse_col_indices.reset(col_indices.size());
+      block_sparse_col_indices.copy_from_host(col_indices.data(), col_indices.size());
+      mask.ptr_row_offsets = block_sparse_row_offsets.get();
+      mask.ptr_col_indices = block_sparse_col_indices.get();
+      mask.block_q = tile_q;
+      mask.block_kv = tile_kv;
+    }
+
+    if constexpr (is_softcap_fusion_v<ActiveMask>) {
+      mask.softcap = options.softcap;
+    }
+
+    if constexpr (is_alibi_fusion_v<ActiveMask>) {
+      // the slopes of the ALiBi paper, a geometric sequence starting at 2^(-8/H)
+      std::vector<float> slopes(options.h);
+      for (int h = 0; h < options.h; h++) {
+        slopes[h] = static_cast<float>(std::exp2(-8.0 * (h + 1) / options.h));
+      }
+      block_alibi_slopes.reset(slopes.size());
+      block_alibi_slopes.copy_from_host(slopes.data(), slopes.size());
+      mask.ptr_slopes = block_alibi_slopes.get();
+    }
+
+    if constexpr (is_dropout_fusion_v<ActiveMask>) {
+      mask.p_dropout = options.dropout;
+      mask.seed = options.dropout_seed;
+    }
+
     return problem_shape;
   }
 
+  // number of (q, k) pairs that are attended to, per batch and head
+  double get_attended(int seqlen_q, int seqlen_kv) {
+    if constexpr (is_sliding_window_mask_v<ActiveMask>) {
+      int offset_q = ActiveMask::IsQBegin ? 0 : seqlen_kv - seqlen_q;
+      double result = 0;
+      for (int i = 0; i < seqlen_q; i++) {
+        int row = i + offset_q;
+        int col_begin = mask.window_size_left < 0 ? 0 : std::max(0, row - mask.window_size_left);
+        int col_end = std::min(seqlen_kv, row + mask.window_size_right + 1);
+        result += std::max(0, col_end - col_begin);
+      }
+      return result;
+    }
+    else if constexpr (is_block_sparse_mask_v<ActiveMask>) {
+      return block_sparse_attended;
+    }
+    else {
+      return 1.0 * seqlen_q * seqlen_kv;
+    }
+  }
+
   auto get_arguments(const ProblemShapeType& problem_shape, const cutlass::KernelHardwareInfo& hw_info, int buffer_index) {
     auto problem_shape_ = problem_shape;
     if constexpr (kIsVarlen) {
@@ -725,9 +1015,93 @@ struct FwdRunner {
         buffers[buffer_index]->block_LSE.get(), stride_LSE },
       hw_info
     };
+    arguments.mainloop.mask = mask;
+    if (page_size > 0) {
+      // the batch mode of paged K and V steps over pages
+      auto stride_paged_K = stride_K;
+      auto stride_paged_V = stride_V;
+      get<2,1>(stride_paged_K) = page_size * get<0>(stride_K);
+      get<2,1>(stride_paged_V) = page_size * get<0>(stride_V);
+      arguments.mainloop.load.ptr_K = buffers[buffer_index]->block_paged_K.get();
+      arguments.mainloop.load.dK = stride_paged_K;
+      arguments.mainloop.load.ptr_V = buffers[buffer_index]->block_paged_V.get();
+      arguments.mainloop.load.dV = stride_paged_V;
+      arguments.mainloop.load.ptr_page_table = block_page_table.get();
+      arguments.mainloop.load.stride_page_table = make_stride(_1{}, pages_per_batch);
+      arguments.mainloop.load.page_count = static_cast<int>(page_table.size());
+      arguments.mainloop.load.page_size = page_size;
+    }
+    if constexpr (kIsRope) {
+      arguments.mainloop.load.ptr_rope_cos = block_rope_cos.get();
+      arguments.mainloop.load.ptr_rope_sin = block_rope_sin.get();
+      arguments.mainloop.load.rope_stride = head_dim_qk(problem_shape) / 2;
+      arguments.mainloop.load.rope_theta = static_cast<float>(kRopeTheta);
+    }
     return arguments;
   }
 
+  /// Recomputes the result of buffer 0 for --lse-merge from two shards of K/V, the way ring or context
+  /// parallel attention does. The second shard is merged into the first through the accumulating epilogue,
+  /// or computed separately and merged by FmhaKernelLseMerge.
+  bool run_kv_shards(const Options& options, const ProblemShapeType& problem_shape, const cutlass::KernelHardwareInfo& hw_info) {
+    if constexpr (kIsVarlen) {
+      return false;
+    }
+    else {
+      using OperationLseMerge = cutlass::fmha::device::FMHA<
+        cutlass::fmha::kernel::FmhaKernelLseMerge<ProblemShapeType, ElementOut, ElementAccumulatorPV>>;
+
+      DeviceBuffer& buffer = *buffers[0];
+      DeviceAllocation<ElementOut> block_O_partial;
+      DeviceAllocation<ElementAccumulatorPV> block_LSE_partial;
+      bool merge_kernel = options.lse_merge == "kernel";
+
+      int split = size<1>(problem_shape) / 2;
+      for (int shard = 0; shard < 2; shard++) {
+        auto problem_shape_shard = problem_shape;
+        get<1>(problem_shape_shard) = shard == 0 ? split : size<1>(problem_shape) - split;
+        auto arguments = get_arguments(problem_shape_shard, hw_info, 0);
+        arguments.mainloop.load.ptr_K += shard * split * get<0>(stride_K);
+        arguments.mainloop.load.ptr_V += shard * split * get<0>(stride_V);
+        if (shard == 1 && merge_kernel) {
+          block_O_partial.reset(buffer.block_O.size());
+          block_LSE_partial.reset(buffer.block_LSE.size());
+          arguments.epilogue.ptr_O = block_O_partial.get();
+          arguments.epilogue.ptr_LSE = block_LSE_partial.get();
+        }
+        else if (shard == 1) {
+          arguments.epilogue.accumulate = true;
+        }
+
+        Operation op;
+        DeviceAllocation<uint8_t> workspace(Operation::get_workspace_size(arguments));
+        if (op.can_implement(arguments) != cutlass::Status::kSuccess ||
+            op.run(arguments, workspace.get()) != cutlass::Status::kSuccess) {
+          std::cerr << "Failed to run the kernel on kv shard " << shard << std::endl;
+          return false;
+        }
+      }
+
+      if (merge_kernel) {
+        typename OperationLseMerge::Arguments arguments{
+          problem_shape,
+          buffer.block_O.get(), stride_O,
+          buffer.block_LSE.get(), stride_LSE,
+          block_O_partial.get(), stride_O,
+          block_LSE_partial.get(), stride_LSE
+        };
+        OperationLseMerge op;
+        if (op.can_implement(arguments) != cutlass::Status::kSuccess ||
+            op.run(arguments) != cutlass::Status::kSuccess) {
+          std::cerr << "Failed to run the LSE merge kernel" << std::endl;
+          return false;
+        }
+      }
+
+      return cudaDeviceSynchronize() == cudaSuccess;
+    }
+  }
+
   ExampleResult run(const Options& options, const cutlass::KernelHardwareInfo& hw_info) {
 
     ProblemShapeType problem_shape = initialize(options);
@@ -855,19 +1229,17 @@ struct FwdRunner {
     if (kIsVarlen) {
       flops = 0.0;
       for (int i = 0; i < size<3,1>(problem_shape); i++) {
-        flops += (cumulative_seqlen_q[i+1] - cumulative_seqlen_q[i])
-               * 1.0
-               * (cumulative_seqlen_kv[i+1] - cumulative_seqlen_kv[i]);
+        flops += get_attended(
+            cumulative_seqlen_q[i+1] - cumulative_seqlen_q[i],
+            cumulative_seqlen_kv[i+1] - cumulative_seqlen_kv[i]);
       }
     }
     else {
-      flops = 1.0;
-      flops *= static_cast<double>(size<0>(problem_shape));
-      flops *= static_cast<double>(size<1>(problem_shape));
+      flops = get_attended(size<0>(problem_shape), size<1>(problem_shape));
       flops *= static_cast<double>(size<3,1>(problem_shape));
     }
-    flops *= 4.0 * (std::is_same_v<ActiveMask, CausalMask<true>> || std::is_same_v<ActiveMask, CausalMask<false>> ? 0.5 : 1.0);
-    flops *= static_cast<double>(size<2>(problem_shape));
+    flops *= 2.0 * (std::is_base_of_v<CausalMask<true>, ActiveMask> || std::is_base_of_v<CausalMask<false>, ActiveMask> ? 0.5 : 1.0);
+    flops *= static_cast<double>(head_dim_qk(problem_shape) + head_dim_vo(problem_shape));
     flops *= static_cast<double>(size<3,0>(problem_shape));
     double tflops_s = flops * 1e-12 /*tera*/ / (runtime_ms * 1e-3 /*ms*/);
     example_result.tflops_tc_s = tflops_s;
@@ -883,6 +1255,10 @@ struct FwdRunner {
     // Verify that the result is correct
     bool passed = true;
     if (options.verify) {
+      if (! options.lse_merge.empty() && ! run_kv_shards(options, problem_shape, hw_info)) {
+        std::cerr << "Error running the kernel on the kv shards" << std::endl;
+        return example_result;
+      }
       passed = verify(problem_shape, *buffers[0]);
       if (passed) example_result.verified = true;
     }
@@ -935,6 +1311,11 @@ void run_fwd_128(Mask fusion, Options const & options, cutlass::KernelHardwareIn
       auto result = runner.run(options, hw_info);
       print_result(name, result, options.verbose);
     }
+    else if (options.rope) {
+      FwdRunner<false, decltype(shape), void, Mask, decltype(kernel_options)..., Option<Tag::kIsRope, true_type>> runner;
+      auto result = runner.run(options, hw_info);
+      print_result(name, result, options.verbose);
+    }
     else 
     {
       FwdRunner<false, decltype(shape), void, Mask, decltype(kernel_options)...> runner;
@@ -957,6 +1338,54 @@ void run_fwd_128(Mask fusion, Options const & options, cutlass::KernelHardwareIn
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+template<class Mask>
+void run_fwd_192_128(Mask fusion, Options const & options, cutlass::KernelHardwareInfo const& hw_info) {
+  auto run = [&](auto shape, const char* name, auto... kernel_options) {
+    if ((! options.kernel_filter.empty()) && (! std::regex_search(name, std::basic_regex(options.kernel_filter)))) {
+        return;
+    }
+    if (options.varlen) {
+      FwdRunner<true, decltype(shape), void, Mask, decltype(kernel_options)...> runner;
+      auto result = runner.run(options, hw_info);
+      print_result(name, result, options.verbose);
+    }
+    else if (options.rope) {
+      FwdRunner<false, decltype(shape), void, Mask, decltype(kernel_options)..., Option<Tag::kIsRope, true_type>> runner;
+      auto result = runner.run(options, hw_info);
+      print_result(name, result, options.verbose);
+    }
+    else
+    {
+      FwdRunner<false, decltype(shape), void, Mask, decltype(kernel_options)...> runner;
+      auto result = runner.run(options, hw_info);
+      print_result(name, result, options.verbose);
+    }
+  };
+
+  // D_QK = 192 and D_VO = 128
+  using HeadDim = Shape<_128, _64>;
+
+#ifdef FP8
+  if (options.persistent) {
+    // Persistent Tile Scheduler
+    run(Shape<_256, _128, HeadDim>{}, "tma ws 256x128 acc fp32 persistent", Option<Tag::kIsPersistent, true_type>{});
+  }
+  else
+#else
+  if (options.persistent) {
+    // the persistent kernel keeps the epilogue smem next to the 192 wide Q and K tiles, which does not fit
+    std::cout << "No persistent kernel instantiated for d=" << options.d << " d_vo=" << options.d_vo << std::endl;
+  }
+  else
+#endif
+  {
+    // Individual Tile Scheduler
+    run(Shape<_256, _128, HeadDim>{}, "tma ws 256x128 acc fp32 individual", Option<Tag::kIsPersistent, false_type>{});
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
 template<class Mask>
 void run_fwd_64(Mask fusion, Options const & options, cutlass::KernelHardwareInfo const& hw_info) {
   auto run = [&](auto shape, const char* name, auto... kernel_options) {
@@ -968,6 +1397,11 @@ void run_fwd_64(Mask fusion, Options const & options, cutlass::KernelHardwareInf
       auto result = runner.run(options, hw_info);
       print_result(name, result, options.verbose);
     }
+    else if (options.rope) {
+      FwdRunner<false, decltype(shape), void, Mask, decltype(kernel_options)..., Option<Tag::kIsRope, true_type>> runner;
+      auto result = runner.run(options, hw_info);
+      print_result(name, result, options.verbose);
+    }
     else 
     {
       FwdRunner<false, decltype(shape), void, Mask, decltype(kernel_options)...> runner;
@@ -999,6 +1433,10 @@ void run_fwd_32(Mask fusion, Options const & options, cutlass::KernelHardwareInf
       auto result = runner.run(options, hw_info);
       print_result(name, result, options.verbose);
     }
+    else if (options.rope) {
+      // rope pairs the two halves of the mma k blocks, of which there is only one for fp8
+      std::cout << "No rope kernel instantiated for d=" << options.d << std::endl;
+    }
     else {
       FwdRunner<false, decltype(shape), void, Mask, decltype(kernel_options)...> runner;
       auto result = runner.run(options, hw_info);
@@ -1085,8 +1523,12 @@ int main_single(int argc, char const **args) {
     hw_info.sm_count = options.sm_count;
   }
 
-  std::cout << "###### B " << options.b << " H " << options.h << " H_K " << options.h_k << " Q " << options.q << " K " << options.k << " D " << options.d << " ";
-  std::cout << "Forward" << " " << (options.causal ? "Causal" : (options.residual ? "Residual" : "None")) << " ";
+  std::cout << "###### B " << options.b << " H " << options.h << " H_K " << options.h_k << " Q " << options.q << " K " << options.k << " D " << options.d << " D_VO " << options.d_vo << " ";
+  std::cout << "Forward" << " " << (options.causal ? "Causal" : options.sliding_window ? "SlidingWindow" :
+      options.block_sparse ? "BlockSparse" : (options.residual ? "Residual" : "None")) << " ";
+  if (options.softcap > 0) std::cout << "Softcap " << options.softcap << " ";
+  if (options.alibi) std::cout << "ALiBi ";
+  if (options.dropout > 0) std::cout << "Dropout " << options.dropout << " ";
   std::cout << "#SM " << hw_info.sm_count << std::endl;
 
   auto with_mask = [&](auto fn) {
@@ -1097,6 +1539,16 @@ int main_single(int argc, char const **args) {
         fn(CausalMask<false>{});
       }
     }
+    else if (options.sliding_window) {
+      if(options.causal_q_begin) {
+        fn(SlidingWindowMask{});
+      } else {
+        fn(SlidingWindowMask<false>{});
+      }
+    }
+    else if (options.block_sparse) {
+      fn(BlockSparseMask{});
+    }
     else if (options.residual) {
       fn(ResidualMask{});
     }
@@ -1105,8 +1557,43 @@ int main_single(int argc, char const **args) {
     }
   };
 
-  with_mask([&](auto fusion) {
-    if (options.d <= 32) {
+  // score modifications are layered on top of the mask, with ALiBi aligned like the mask
+  auto with_score_mod = [&](auto fn) {
+    with_mask([&](auto mask) {
+      using Mask = decltype(mask);
+      constexpr bool kIsQBegin = ! std::is_same_v<Mask, CausalMask<false>>;
+      if constexpr (is_sliding_window_mask_v<Mask> || is_block_sparse_mask_v<Mask>) {
+        // not instantiated to limit the number of kernels, rejected by the options
+        fn(mask);
+      }
+      else if (options.softcap > 0 && options.alibi) {
+        fn(SoftcapFusion<AlibiFusion<Mask, kIsQBegin>>{});
+      }
+      else if (options.softcap > 0) {
+        fn(SoftcapFusion<Mask>{});
+      }
+      else if (options.alibi) {
+        fn(AlibiFusion<Mask, kIsQBegin>{});
+      }
+      else if (options.dropout > 0) {
+        fn(DropoutFusion<Mask>{});
+      }
+      else {
+        fn(mask);
+      }
+    });
+  };
+
+  with_score_mod([&](auto fusion) {
+    if (options.d_vo != options.d) {
+      if (options.d == 192 && options.d_vo == 128) {
+        run_fwd_192_128(fusion, options, hw_info);
+      }
+      else {
+        std::cout << "No kernel instantiated for d=" << options.d << " d_vo=" << options.d_vo << std::endl;
+      }
+    }
+    else if (options.d <= 32) {
       run_fwd_32(fusion, options, hw_info);
     }
     else if (options.d <= 64) {
@@ -125,6 +125,11 @@ struct Options {
   bool causal = false;
   bool residual = false;
   bool varlen = false;
+  bool fuse_sum_odo = false;
+  float softcap = 0.0f;
+  bool alibi = false;
+  float dropout = 0.0f;
+  uint64_t dropout_seed = 0;
   int sm_count = 0;
 
   std::string kernel_filter;
@@ -277,6 +282,19 @@ struct Options {
     }
 
     skip_reference = cmd.check_cmd_line_flag("skip-reference");
+    fuse_sum_odo = cmd.check_cmd_line_flag("fuse-sum-odo");
+    cmd.get_cmd_line_argument("softcap", softcap, defaults.softcap);
+    alibi = cmd.check_cmd_line_flag("alibi");
+    cmd.get_cmd_line_argument("dropout", dropout, defaults.dropout);
+    cmd.get_cmd_line_argument("dropout-seed", dropout_seed, defaults.dropout_seed);
+    if (dropout < 0 || dropout >= 1) {
+      std::cout << "Error: --dropout must be in [0, 1)\n";
+      std::exit(-1);
+    }
+    if (dropout > 0 && (softcap > 0 || alibi)) {
+      std::cout << "Error: --dropout is not instantiated with score modifications\n";
+      std::exit(-1);
+    }
     cmd.get_cmd_line_argument("sm-count", sm_count, defaults.sm_count);
 
     get_init_style_argument(cmd, "init-style", init_style_q, defaults.init_style_q);
@@ -317,6 +335,12 @@ struct Options {
       << "                              and are split B-ways, alternatingly +10% and -10%\n"
       << "                              with the last batch sized to make it fit\n"
       << "                              implies at least residual masking for correctness\n"
+      << "  --fuse-sum-odo              Computes sum(O * dO) inside the backward kernel (non-MLA only)\n"
+      << "  --softcap=<float>           Soft-caps the logits to (-softcap, softcap) with tanh (non-MLA only)\n"
+      << "  --alibi                     Adds the ALiBi bias with the standard per-head slopes (non-MLA only)\n"
+      << "  --dropout=<float>           Drops out P with the given probability, regenerating\n"
+      << "                              the forward mask in the kernel (non-MLA only)\n"
+      << "  --dropout-seed=<int>        Sets the seed of the dropout random number generator\n"
       << "  --sm-count                  Sets SM count rather than querying it\n"
       << "  --kernel-filter=<filter>    Sets regexp to match kernel against\n"
       << "\n";
@@ -464,6 +488,9 @@ struct BwdRunner {
   DeviceAllocation<Element> block_ref_dK;
   DeviceAllocation<Element> block_ref_dV;
 
+  DeviceAllocation<float> block_alibi_slopes;
+  ActiveMask mask;
+
   //
   // Methods
   //
@@ -481,7 +508,7 @@ struct BwdRunner {
     Tensor mDV = make_tensor(make_gmem_ptr(block_ref_dV.get()), make_shape(K, D_VO, HB), stride_dV);
     Tensor mDO = make_tensor(make_gmem_ptr(block_dO.get()), make_shape(Q, D_VO, HB), stride_dO);
 
-    fmha_bwd_reference(problem_shape, mQ, mK, mV, mO, mLSE, mDO, mDQ, mDK, mDV, ActiveMask{});
+    fmha_bwd_reference(problem_shape, mQ, mK, mV, mO, mLSE, mDO, mDQ, mDK, mDV, mask);
 
     cudaError_t result = cudaDeviceSynchronize();
     if (result != cudaSuccess) {
@@ -651,6 +678,26 @@ struct BwdRunner {
     initialize_block(block_ref_dK, seed + 2034);
     initialize_block(block_ref_dV, seed + 2035);
 
+    if constexpr (is_softcap_fusion_v<ActiveMask>) {
+      mask.softcap = options.softcap;
+    }
+
+    if constexpr (is_alibi_fusion_v<ActiveMask>) {
+      // the slopes of the ALiBi paper, a geometric sequence starting at 2^(-8/H)
+      std::vector<float> slopes(options.h);
+      for (int h = 0; h < options.h; h++) {
+        slopes[h] = static_cast<float>(std::exp2(-8.0 * (h + 1) / options.h));
+      }
+      block_alibi_slopes.reset(slopes.size());
+      block_alibi_slopes.copy_from_host(slopes.data(), slopes.size());
+      mask.ptr_slopes = block_alibi_slopes.get();
+    }
+
+    if constexpr (is_dropout_fusion_v<ActiveMask>) {
+      mask.p_dropout = options.dropout;
+      mask.seed = options.dropout_seed;
+    }
+
     Tensor mQ = make_tensor(make_gmem_ptr(block_Q.get()),
       select<0,2,4>(problem_shape),
       stride_Q);
@@ -672,7 +719,7 @@ struct BwdRunner {
       stride_LSE);
 
     if (not options.skip_reference) {
-      fmha_reference(problem_shape, mQ, mK, mV, mO, mLSE, ActiveMask{});
+      fmha_reference(problem_shape, mQ, mK, mV, mO, mLSE, mask);
     }
 
     return problem_shape;
@@ -701,6 +748,10 @@ struct BwdRunner {
       softmax_scale,
       hw_info
     };
+    if constexpr (! kIsMla) {
+      arguments.fuse_sum_OdO = options.fuse_sum_odo;
+      arguments.mask = mask;
+    }
 
     Operation op;
 
@@ -798,7 +849,7 @@ struct BwdRunner {
 
     runtime_ms /= static_cast<float>(options.iterations);
 
-    double flops = 2.0 * (std::is_same_v<ActiveMask, CausalForBackwardMask<false>> || std::is_same_v<ActiveMask, CausalForBackwardMask<true>> ? 0.5 : 1.0);
+    double flops = 2.0 * (std::is_base_of_v<CausalForBackwardMask<false>, ActiveMask> || std::is_base_of_v<CausalForBackwardMask<true>, ActiveMask> ? 0.5 : 1.0);
     flops *= static_cast<double>(get<0>(problem_shape));
     flops *= static_cast<double>(get<1>(problem_shape));
     flops *= (3 * static_cast<double>(get<2>(problem_shape)) + 2 * static_cast<double>(get<3>(problem_shape)));
@@ -908,6 +959,20 @@ void run_bwd_128(Mask fusion, Options const & options, cutlass::KernelHardwareIn
   run(Shape<_128, _128, HeadDim, HeadDim>{}, KernelCoop{}, "tma");
 }
 
+template<class Mask>
+void run_bwd_128_64(Mask fusion, Options const & options, cutlass::KernelHardwareInfo const& hw_info) {
+  auto run = [&](auto shape, auto kernel, const char* name, auto... kernel_options) {
+    dispatch_bool(options.varlen, [&](auto is_varlen) {
+      BwdRunner<decltype(is_varlen)::value, false, decltype(shape), decltype(kernel), Mask, decltype(kernel_options)...> runner;
+      auto result = runner.run(options, hw_info);
+      print_result(name, result, options.verbose);
+    });
+  };
+
+  // the narrower V/O head dim shrinks the dP and dV mmas and the dV accumulator
+  run(Shape<_128, _128, _128, _64>{}, KernelCoop{}, "tma");
+}
+
 template<class Mask>
 void run_bwd_mla_192(Mask fusion, Options const & options, cutlass::KernelHardwareInfo const& hw_info) {
   auto run = [&](auto shape, auto kernel, const char* name, auto... kernel_options) {
@@ -920,7 +985,12 @@ void run_bwd_mla_192(Mask fusion, Options const & options, cutlass::KernelHardwa
 
   using HeadDim = _192;
 
-  run(Shape<_64, _128, HeadDim, _128>{}, KernelCoop{}, "tma");
+  if constexpr (has_score_mod_v<Mask> || has_dropout_v<Mask>) {
+    std::cout << "Score modifications and dropout are not supported by the MLA backward kernel" << std::endl;
+  }
+  else {
+    run(Shape<_64, _128, HeadDim, _128>{}, KernelCoop{}, "tma");
+  }
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -991,6 +1061,9 @@ int main_single(int argc, char const **args) {
 
   std::cout << "###### B " << options.b << " H " << options.h << " H_K " << options.h_k << " Q " << options.q << " K " << options.k << " D " << options.d << " D_VO " << options.d_vo << " ";
   std::cout << "Backward" << " " << (options.causal ? "Causal" : "Full") << " ";
+  if (options.softcap > 0) std::cout << "Softcap " << options.softcap << " ";
+  if (options.alibi) std::cout << "ALiBi ";
+  if (options.dropout > 0) std::cout << "Dropout " << options.dropout << " ";
   std::cout << "#SM " << hw_info.sm_count << std::endl;
 
   auto with_causal = [&](auto fn) {
@@ -1005,18 +1078,43 @@ int main_single(int argc, char const **args) {
     }
   };
 
-  with_causal([&](auto fusion) {
+  // score modifications are layered on top of the mask
+  auto with_score_mod = [&](auto fn) {
+    with_causal([&](auto mask) {
+      using Mask = decltype(mask);
+      if (options.softcap > 0 && options.alibi) {
+        fn(SoftcapFusion<AlibiFusion<Mask>>{});
+      }
+      else if (options.softcap > 0) {
+        fn(SoftcapFusion<Mask>{});
+      }
+      else if (options.alibi) {
+        fn(AlibiFusion<Mask>{});
+      }
+      else if (options.dropout > 0) {
+        fn(DropoutFusion<Mask>{});
+      }
+      else {
+        fn(mask);
+      }
+    });
+  };
+
+  with_score_mod([&](auto fusion) {
     if (options.d <= 64 && options.d_vo == options.d) {
       run_bwd_64(fusion, options, hw_info);
     }
     else if (options.d <= 128 && options.d_vo == options.d) {
       run_bwd_128(fusion, options, hw_info);
     }
+    else if (options.d <= 128 && options.d_vo <= 64) {
+      run_bwd_128_64(fusion, options, hw_info);
+    }
     else if (options.d == 192 && options.d_vo == 128) {
       run_bwd_mla_192(fusion, options, hw_info);
     }
     else {
-      std::cout << "No kernel instantiated for d=" << options.d << std::endl;
+      std::cout << "No kernel instantiated for d=" << options.d << " d_vo=" << options.d_vo << std::endl;
     }
   });
 #endif
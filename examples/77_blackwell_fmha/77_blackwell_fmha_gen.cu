@@ -50,7 +50,9 @@
 #define DSHOW(x) print(#x ": "); print(x); print("\n");
 #define DSHOWT(x) print(#x ": "); print_tensor(x); print("\n");
 
+#include <algorithm>
 #include <iostream>
+#include <numeric>
 #include <random>
 #include <regex>
 
@@ -65,7 +67,7 @@
 #include "reference/fmha_fwd_gen_reference.hpp"
 #include "reference/reference_abs_error.hpp"
 
-#include "device/fmha.hpp"
+#include "device/sm100_fmha_gen.hpp"
 #include "collective/fmha_fusion.hpp"
 #include "collective/sm100_fmha_gen_mainloop_warpspecialized.hpp"
 #include "collective/sm100_fmha_gen_epilogue_warpspecialized.hpp"
@@ -101,6 +103,9 @@ struct Options {
   bool remap = false;
   bool varlen = false;
   bool cache_only = false;
+  int split_kv = -1; // number of splits along the kv sequence, chosen from the SM count if negative
+  int page = 0; // page size of a paged kv cache, contiguous cache if zero
+  bool kv_scales = false; // per kv head dequantization factors of the cache
 
   int sm_count = 0;
 
@@ -175,6 +180,16 @@ struct Options {
     varlen = cmd.check_cmd_line_flag("varlen");
     remap = cmd.check_cmd_line_flag("remap");
     cache_only = cmd.check_cmd_line_flag("cache-only");
+    cmd.get_cmd_line_argument("split_kv", split_kv, defaults.split_kv);
+    if (split_kv == 0) {
+      split_kv = 1;
+    }
+    kv_scales = cmd.check_cmd_line_flag("kv-scales");
+    cmd.get_cmd_line_argument("page", page, defaults.page);
+    if (page < 0 || (page & (page - 1)) != 0) {
+      std::cout << "Error: --page must be a power of two\n";
+      std::exit(-1);
+    }
     cmd.get_cmd_line_argument("sm-count", sm_count, defaults.sm_count);
 
     get_init_style_argument(cmd, "init-style", init_style_q, defaults.init_style_q);
@@ -212,6 +227,10 @@ struct Options {
       << "  --remap                     Enables batch index remapping\n"
       << "  --cache-only                Only use data from KV cache, no reading or inserting new entry\n"
       << "  --varlen                    Varies sequence length between cache entries\n"
+      << "  --split_kv=<int>            Split KV factor, picked from the SM count if not given\n"
+      << "  --kv-scales                 Dequantizes K and V with random per kv head factors\n"
+      << "  --page=<int>                Pages the KV cache with pages of the given size (power of two),\n"
+      << "                              handed out in random order\n"
       << "  --sm-count                  Sets SM count rather than querying it\n"
       << "  --clear-cache               Clears the cache before benchmarking runs\n"
       << " --kernel-filter=<filter>     Sets regexp to match kernel against\n"
@@ -355,7 +374,7 @@ struct ExampleRunner {
       >
     >;
   
-  using Operation = cutlass::fmha::device::FMHA<Kernel>;
+  using Operation = cutlass::fmha::device::FMHAGen<Kernel>;
 
   StrideQ stride_q;
   StrideNewK stride_new_k;
@@ -380,10 +399,63 @@ struct ExampleRunner {
   DeviceAllocation<Element> block_ref_cache_v;
   DeviceAllocation<ElementOut> block_ref_o;
 
+  // per kv head dequantization factors for --kv-scales
+  DeviceAllocation<float> block_scale_k;
+  DeviceAllocation<float> block_scale_v;
+
+  // [pages per batch, B] page table for --page, the pages of all batches in random order
+  int page_size = 0;
+  int pages_per_batch = 0;
+  std::vector<int> page_table;
+  DeviceAllocation<int> block_page_table;
+  DeviceAllocation<Element> block_paged_cache_k;
+  DeviceAllocation<Element> block_paged_cache_v;
+  StrideCacheK stride_paged_cache_k;
+  StrideCacheV stride_paged_cache_v;
+
   ClearCache clear_cache;
 
+  /// Copies the [seqlen, row_size] rows of each batch of a contiguous cache to the pages of the page table, or back
+  void copy_pages(DeviceAllocation<Element>& block_paged, DeviceAllocation<Element>& block, int seqlen, int row_size, bool to_pages) {
+    std::vector<Element> contiguous(block.size());
+    std::vector<Element> paged(block_paged.size(), Element(0));
+    if (to_pages) {
+      block.copy_to_host(contiguous.data(), contiguous.size());
+    }
+    else {
+      block_paged.copy_to_host(paged.data(), paged.size());
+    }
+    int batches = static_cast<int>(page_table.size()) / pages_per_batch;
+    for (int b = 0; b < batches; b++) {
+      for (int row = 0; row < seqlen; row++) {
+        size_t page = page_table[b * pages_per_batch + row / page_size];
+        auto it_contiguous = contiguous.begin() + (static_cast<size_t>(b) * seqlen + row) * row_size;
+        auto it_paged = paged.begin() + (page * page_size + row % page_size) * row_size;
+        if (to_pages) {
+          std::copy_n(it_contiguous, row_size, it_paged);
+        }
+        else {
+          std::copy_n(it_paged, row_size, it_contiguous);
+        }
+      }
+    }
+    if (to_pages) {
+      block_paged.copy_from_host(paged.data(), paged.size());
+    }
+    else {
+      block.copy_from_host(contiguous.data(), contiguous.size());
+    }
+  }
+
   bool verify(const ProblemShape& problem_shape) {
 
+    if (page_size > 0) {
+      // the kernel appended the new entries to the pages, gather them to compare against the reference
+      int row_size = size<2>(problem_shape) * size<3,0,1>(problem_shape);
+      copy_pages(block_paged_cache_k, block_cache_k, size<1>(problem_shape), row_size, false);
+      copy_pages(block_paged_cache_v, block_cache_v, size<1>(problem_shape), row_size, false);
+    }
+
     Tensor mQ = make_tensor(make_gmem_ptr(block_q.get()), select<0,2,3>(problem_shape), stride_q);
     Tensor mNewK = make_tensor(make_gmem_ptr(block_new_k.get()), select<0,2,3>(problem_shape), stride_new_k);
     Tensor mNewV = make_tensor(make_gmem_ptr(block_new_v.get()), select<0,2,3>(problem_shape), stride_new_v);
@@ -393,7 +465,8 @@ struct ExampleRunner {
 
     fmha_fwd_gen_reference<ElementAcc>(
         problem_shape, block_seqlen_kv.get(), block_cache_batch_idx.get(),
-        mQ, mNewK, mNewV, mCacheK, mCacheV, mO);
+        mQ, mNewK, mNewV, mCacheK, mCacheV, mO,
+        block_scale_k.get(), block_scale_v.get());
     cudaError_t result = cudaDeviceSynchronize();
     if (result != cudaSuccess) {
       std::cerr << "Reference kernel failed. Last CUDA error: "
@@ -511,6 +584,42 @@ struct ExampleRunner {
       block_cache_batch_idx.copy_from_host(cache_batch_idx.data(), cache_batch_idx.size());
     }
 
+    if (options.kv_scales) {
+      std::mt19937 rng(0x202410151300ull);
+      std::uniform_real_distribution<float> dist(0.5f, 1.5f);
+      std::vector<float> scale_k(options.h_k), scale_v(options.h_k);
+      for (int i = 0; i < options.h_k; i++) {
+        scale_k[i] = dist(rng);
+        scale_v[i] = dist(rng);
+      }
+      block_scale_k.reset(scale_k.size());
+      block_scale_k.copy_from_host(scale_k.data(), scale_k.size());
+      block_scale_v.reset(scale_v.size());
+      block_scale_v.copy_from_host(scale_v.data(), scale_v.size());
+    }
+
+    if (options.page > 0) {
+      page_size = options.page;
+      pages_per_batch = ceil_div(get<1>(result), page_size);
+      page_table.resize(options.b * pages_per_batch);
+      std::iota(page_table.begin(), page_table.end(), 0);
+      std::shuffle(page_table.begin(), page_table.end(), std::mt19937(0x202410151200ull));
+      block_page_table.reset(page_table.size());
+      block_page_table.copy_from_host(page_table.data(), page_table.size());
+
+      // the batch mode of the paged cache steps over pages
+      stride_paged_cache_k = stride_cache_k;
+      stride_paged_cache_v = stride_cache_v;
+      get<2,1>(stride_paged_cache_k) = page_size * get<0>(stride_cache_k);
+      get<2,1>(stride_paged_cache_v) = page_size * get<0>(stride_cache_v);
+
+      int row_size = options.d * size<3,0,1>(result);
+      block_paged_cache_k.reset(page_table.size() * page_size * row_size);
+      block_paged_cache_v.reset(page_table.size() * page_size * row_size);
+      copy_pages(block_paged_cache_k, block_cache_k, get<1>(result), row_size, true);
+      copy_pages(block_paged_cache_v, block_cache_v, get<1>(result), row_size, true);
+    }
+
     return result;
   }
 
@@ -529,6 +638,25 @@ struct ExampleRunner {
       hw_info
     };
 
+    if (page_size > 0) {
+      arguments.ptr_cache_k = block_paged_cache_k.get();
+      arguments.dCacheK = stride_paged_cache_k;
+      arguments.ptr_cache_v = block_paged_cache_v.get();
+      arguments.dCacheV = stride_paged_cache_v;
+      arguments.ptr_page_table = block_page_table.get();
+      arguments.stride_page_table = make_stride(_1{}, pages_per_batch);
+      arguments.page_count = static_cast<int>(page_table.size());
+      arguments.page_size = page_size;
+    }
+
+    arguments.ptr_scale_k = block_scale_k.get();
+    arguments.ptr_scale_v = block_scale_v.get();
+
+    arguments.split_kv = options.split_kv;
+    if (arguments.split_kv < 0) {
+      Operation::set_split_kv(arguments);
+    }
+
     Operation op;
 
     ExampleResult example_result;
@@ -85,6 +85,7 @@ struct Options {
   bool verify = false;
   bool verbose = false;
   bool is_fused_reduction = false;
+  bool kv_scales = false;
 
   int sm_count = 0;
 
@@ -158,6 +159,7 @@ struct Options {
       split_kv = max_split_kv;
     }
     is_fused_reduction = cmd.check_cmd_line_flag("fuse_reduction");
+    kv_scales = cmd.check_cmd_line_flag("kv-scales");
     if (split_kv == 1) {
       is_fused_reduction = false;
     }
@@ -190,6 +192,7 @@ struct Options {
       << "  --split_kv=<int>            Split KV factor\n"
       << "  --fused_reduction           Fuse the reduction operation\n"
       << "  --var_split_kv              Use varying split KV factor\n"
+      << "  --kv-scales                 Dequantizes the latent cache with random per batch factors\n"
       << "  --verify                    Verify results\n"
       << "  --verbose                   Print smem and execution time per kernel\n"
       << " --sm-count                   Sets SM count rather than querying it\n"
@@ -345,6 +348,7 @@ struct Runner {
   DeviceAllocation<ElementAcc> block_LSE;
   DeviceAllocation<ElementOut> block_ref_O;
   DeviceAllocation<ElementAcc> block_ref_LSE;
+  DeviceAllocation<ElementAcc> block_scale_kv;
    
   ElementAcc scale;
 
@@ -390,7 +394,7 @@ struct Runner {
     Tensor mSeq = make_tensor(make_gmem_ptr(static_cast<int*>(block_seq.get())), make_shape(B));
     Tensor mPT = make_tensor(make_gmem_ptr(static_cast<int*>(block_PT.get())), make_shape(ceil_div(K, page_size), B), stride_PT);
 
-    fmha_mla_reference(problem_shape, mSeq, mPT, mQ_latent, mQ_rope, mC_latent, mK_rope, mO, mLSE, scale);
+    fmha_mla_reference(problem_shape, mSeq, mPT, mQ_latent, mQ_rope, mC_latent, mK_rope, mO, mLSE, scale, block_scale_kv.get());
 
     cudaError_t result = cudaDeviceSynchronize();
     if (result != cudaSuccess) {
@@ -502,6 +506,17 @@ struct Runner {
     initialize_block(block_Q, seed + 2023, options.init_style_q);
     initialize_block(block_C, seed + 2022, options.init_style_c);
 
+    if (options.kv_scales) {
+      std::mt19937 rng(0x202410151300ull);
+      std::uniform_real_distribution<ElementAcc> dist(0.5f, 1.5f);
+      std::vector<ElementAcc> host_scale_kv(B);
+      for (auto& s : host_scale_kv) {
+        s = dist(rng);
+      }
+      block_scale_kv.reset(host_scale_kv.size());
+      block_scale_kv.copy_from_host(host_scale_kv.data(), host_scale_kv.size());
+    }
+
     return problem_shape;
   }
 
@@ -531,6 +546,7 @@ struct Runner {
       options.is_var_split_kv ? block_split_kv.get() : nullptr,
       options.is_fused_reduction
     };
+    arguments.mainloop.ptr_scale_kv = block_scale_kv.get();
     if (options.split_kv < 0 && !options.is_var_split_kv) {
       Operation::set_split_kv(arguments);
     }
@@ -63,6 +63,28 @@ CUTE_DEVICE constexpr auto unstageSmemLayout(Layout const& layout, Stages stages
     return composition(layout, prepend<decltype(rank(layout))::value>(make_layout(stages), _));
 }
 
+// the head dim mode of a problem or tile shape is either D, shared by QK^T and PV,
+// or (D_VO, D_QK - D_VO) as for MLA, where the second part only enters QK^T
+template<class Shape>
+CUTE_HOST_DEVICE constexpr auto head_dim_qk(Shape const& shape) {
+  if constexpr (rank_v<decltype(get<2>(Shape{}))> == 2) {
+    return get<2,0>(shape) + get<2,1>(shape);
+  }
+  else {
+    return get<2>(shape);
+  }
+}
+
+template<class Shape>
+CUTE_HOST_DEVICE constexpr auto head_dim_vo(Shape const& shape) {
+  if constexpr (rank_v<decltype(get<2>(Shape{}))> == 2) {
+    return get<2,0>(shape);
+  }
+  else {
+    return get<2>(shape);
+  }
+}
+
 template<class T>
 CUTE_DEVICE T warp_uniform(T a) {
   return __shfl_sync(0xffffffff, a, 0);
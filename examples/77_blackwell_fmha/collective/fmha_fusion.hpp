@@ -32,6 +32,8 @@
 
 
 #include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/philox.h"
 #include "cute/tensor.hpp"
 
 namespace cutlass::fmha::collective {
@@ -69,6 +71,29 @@ struct NoMask {
     return get_trip_count(blk_coord, tile_shape, problem_size);
   }
 
+  // masked iterations that come before the unmasked ones, e.g. the left edge of a sliding window
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_leading_masked_trip_count(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) {
+
+    return 0;
+  }
+
+  // index of the kv tile visited in the given iteration, which allows masks to skip tiles
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_kv_tile_index(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size,
+      int iteration) {
+
+    return iteration;
+  }
+
   template<class AccQK, class IndexQK, class ProblemSize>
   CUTLASS_DEVICE
   void apply_mask(
@@ -313,6 +338,466 @@ struct CausalForBackwardMask : CausalMask<kIsQBegin>, ResidualMaskForBackward {
 
 };
 
+// Sliding window attention, where query i attends to keys j with
+//   i - window_size_left <= j <= i + window_size_right
+// A negative window size leaves that side unbounded, i.e. {-1, 0} is causal.
+// Only the kv tiles that intersect the window are visited, so the work per
+// query tile scales with the window size rather than the sequence length.
+// Like for the causal mask, Q can be aligned with the beginning or the end of K.
+template<bool kIsQBegin = true>
+struct SlidingWindowMask : NoMask {
+
+  using Base = NoMask;
+
+  static constexpr bool IsQBegin = kIsQBegin;
+
+  int window_size_left = -1;
+  int window_size_right = 0;
+
+  template<class ProblemSize>
+  CUTLASS_DEVICE
+  int get_offset_q(ProblemSize const& problem_size) {
+    if constexpr (IsQBegin) {
+      return 0;
+    }
+    else {
+      return get<1>(problem_size) - get<0>(problem_size);
+    }
+  }
+
+  // first and one-past-last row of the tile in the coordinates of K
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  cute::tuple<int, int> get_row_range(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) {
+
+    int offset_q = get_offset_q(problem_size);
+    int row_begin = get<0>(blk_coord) * get<0>(tile_shape);
+    int row_end = std::min(row_begin + int(get<0>(tile_shape)), int(get<0>(problem_size)));
+    return cute::make_tuple(row_begin + offset_q, row_end + offset_q);
+  }
+
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  cute::tuple<int, int> get_kv_tile_range(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) {
+
+    auto [row_begin, row_end] = get_row_range(blk_coord, tile_shape, problem_size);
+    int col_begin = window_size_left < 0 ? 0 : std::max(0, row_begin - window_size_left);
+    int col_end = window_size_right < 0 ? int(get<1>(problem_size)) :
+        std::min(int(get<1>(problem_size)), row_end + window_size_right);
+    int tile_end = ceil_div(col_end, get<1>(tile_shape));
+    // keep at least one (fully masked) tile, like the causal mask does for rows past K
+    int tile_begin = std::max(0, std::min(col_begin / int(get<1>(tile_shape)), tile_end - 1));
+    return cute::make_tuple(tile_begin, tile_end);
+  }
+
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_trip_count(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) {
+
+    auto [tile_begin, tile_end] = get_kv_tile_range(blk_coord, tile_shape, problem_size);
+    return std::max(tile_end - tile_begin, 1);
+  }
+
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_leading_masked_trip_count(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) {
+
+    if (window_size_left < 0) {
+      return 0;
+    }
+    auto [row_begin, row_end] = get_row_range(blk_coord, tile_shape, problem_size);
+    auto [tile_begin, tile_end] = get_kv_tile_range(blk_coord, tile_shape, problem_size);
+    // a tile is unmasked on the left if its first column is visible from the last row
+    int tile_unmasked_begin = ceil_div(std::max(0, row_end - 1 - window_size_left), int(get<1>(tile_shape)));
+    int trip_count = get_trip_count(blk_coord, tile_shape, problem_size);
+    return std::min(std::max(tile_unmasked_begin - tile_begin, 0), trip_count);
+  }
+
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_masked_trip_count(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) {
+
+    auto [row_begin, row_end] = get_row_range(blk_coord, tile_shape, problem_size);
+    auto [tile_begin, tile_end] = get_kv_tile_range(blk_coord, tile_shape, problem_size);
+    // a tile is unmasked on the right if its last column is visible from the first row
+    int col_unmasked_end = window_size_right < 0 ? int(get<1>(problem_size)) :
+        std::min(int(get<1>(problem_size)), row_begin + window_size_right + 1);
+    int tile_unmasked_end = col_unmasked_end / int(get<1>(tile_shape));
+    int leading = get_leading_masked_trip_count(blk_coord, tile_shape, problem_size);
+    int trip_count = get_trip_count(blk_coord, tile_shape, problem_size);
+    return std::min(std::max(tile_begin + trip_count - std::max(tile_unmasked_end, tile_begin + leading), 0), trip_count - leading);
+  }
+
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_unmasked_trip_count(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) {
+
+    return get_trip_count(blk_coord, tile_shape, problem_size)
+        - get_leading_masked_trip_count(blk_coord, tile_shape, problem_size)
+        - get_masked_trip_count(blk_coord, tile_shape, problem_size);
+  }
+
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_kv_tile_index(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size,
+      int iteration) {
+
+    return get<0>(get_kv_tile_range(blk_coord, tile_shape, problem_size)) + iteration;
+  }
+
+  template<class AccQK, class IndexQK, class ProblemSize>
+  CUTLASS_DEVICE
+  void apply_mask(
+      AccQK& acc_qk,
+      IndexQK const& index_qk,
+      ProblemSize const& problem_size) {
+
+    int offset_q = get_offset_q(problem_size);
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(acc_qk); i++) {
+      auto pos = index_qk(i);
+      int row = get<0>(pos) + offset_q;
+      int col = get<1>(pos);
+      bool masked = col >= get<1>(problem_size);
+      masked |= window_size_left >= 0 && col < row - window_size_left;
+      masked |= window_size_right >= 0 && col > row + window_size_right;
+      if (masked) {
+        acc_qk(i) = -INFINITY;
+      }
+    }
+  }
+};
+
+// Block-sparse attention, e.g. for document masking of packed sequences.
+// The layout is shared by all heads and batches and given in CSR form over
+// blocks of block_q x block_kv elements, which must match the kernel tile:
+// query tile i visits the kv tiles
+//   ptr_col_indices[ptr_row_offsets[i]], ..., ptr_col_indices[ptr_row_offsets[i+1] - 1]
+// which must be sorted in ascending order, and every row needs at least one
+// kv tile. All kv tiles that are not listed are skipped entirely, and visited
+// tiles are only masked against the end of the sequence.
+struct BlockSparseMask : NoMask {
+
+  using Base = NoMask;
+
+  int const* ptr_row_offsets = nullptr;
+  int const* ptr_col_indices = nullptr;
+  int block_q = 0;
+  int block_kv = 0;
+
+  // number of listed kv tiles of the row that start before end
+  CUTLASS_DEVICE
+  int get_row_count(int row, int end) {
+    int offset = ptr_row_offsets[row];
+    int count = ptr_row_offsets[row + 1] - offset;
+    // binary search, rows are sorted
+    int lo = 0;
+    while (lo < count) {
+      int mid = (lo + count) / 2;
+      if (ptr_col_indices[offset + mid] < end) {
+        lo = mid + 1;
+      }
+      else {
+        count = mid;
+      }
+    }
+    return lo;
+  }
+
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_trip_count(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) {
+
+    // tiles past the end of a shorter (variable length) sequence are dropped
+    return get_row_count(get<0>(blk_coord), ceil_div(get<1>(problem_size), get<1>(tile_shape)));
+  }
+
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_masked_trip_count(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) {
+
+    if (get<1>(problem_size) % get<1>(tile_shape) == 0) {
+      return 0;
+    }
+    int trip_count = get_trip_count(blk_coord, tile_shape, problem_size);
+    if (trip_count == 0) {
+      return 0;
+    }
+    int last = get_kv_tile_index(blk_coord, tile_shape, problem_size, trip_count - 1);
+    return last == get<1>(problem_size) / get<1>(tile_shape) ? 1 : 0;
+  }
+
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_unmasked_trip_count(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) {
+
+    return get_trip_count(blk_coord, tile_shape, problem_size) - get_masked_trip_count(blk_coord, tile_shape, problem_size);
+  }
+
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_kv_tile_index(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size,
+      int iteration) {
+
+    return ptr_col_indices[ptr_row_offsets[get<0>(blk_coord)] + iteration];
+  }
+
+  template<class AccQK, class IndexQK, class ProblemSize>
+  CUTLASS_DEVICE
+  void apply_mask(
+      AccQK& acc_qk,
+      IndexQK const& index_qk,
+      ProblemSize const& problem_size) {
+
+    // the kernel only calls this for listed tiles, the block lookup is
+    // needed for elementwise users such as the reference implementation
+    int cached_row = -1;
+    int cached_col = -1;
+    bool cached_is_listed = false;
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(acc_qk); i++) {
+      auto pos = index_qk(i);
+      if (get<1>(pos) >= get<1>(problem_size)) {
+        acc_qk(i) = -INFINITY;
+        continue;
+      }
+      int row = get<0>(pos) / block_q;
+      int col = get<1>(pos) / block_kv;
+      if (row != cached_row || col != cached_col) {
+        int count = get_row_count(row, col + 1);
+        cached_is_listed = count > 0 && ptr_col_indices[ptr_row_offsets[row] + count - 1] == col;
+        cached_row = row;
+        cached_col = col;
+      }
+      if (! cached_is_listed) {
+        acc_qk(i) = -INFINITY;
+      }
+    }
+  }
+};
+
+// Score modifications are applied to every tile of S before the mask, and are
+// layered on top of a mask, e.g. SoftcapFusion<AlibiFusion<CausalMask<>>>.
+// They work on the unscaled S = Q K^T, so that the kernels can keep folding the
+// softmax scale into the exponent: for the logits x = scale_softmax * S they
+// compute S' = g(scale_softmax * S) / scale_softmax. The backward pass recomputes
+// S' and multiplies dS' by dS'/dS, as returned by score_mod_grad(S').
+template<class T, class = void> struct has_score_mod_impl : std::false_type {};
+template<class T> struct has_score_mod_impl<T, std::void_t<decltype(T::HasScoreMod)>> : std::bool_constant<T::HasScoreMod> {};
+template<class T> constexpr bool has_score_mod_v = has_score_mod_impl<remove_cvref_t<T>>::value;
+
+// Gemma-style logit soft-capping, x -> softcap * tanh(x / softcap)
+template<class Base>
+struct SoftcapFusion : Base {
+
+  static constexpr bool HasScoreMod = true;
+
+  float softcap = 0.0f;
+
+  template<class AccQK, class IndexQK, class ProblemSize>
+  CUTLASS_DEVICE
+  void apply_score_mod(
+      AccQK& acc_qk,
+      IndexQK const& index_qk,
+      ProblemSize const& problem_size,
+      int head, float scale_softmax) {
+
+    if constexpr (has_score_mod_v<Base>) {
+      Base::apply_score_mod(acc_qk, index_qk, problem_size, head, scale_softmax);
+    }
+    float scale_in = scale_softmax / softcap;
+    float scale_out = softcap / scale_softmax;
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(acc_qk); i++) {
+      acc_qk(i) = scale_out * cutlass::fast_tanh(scale_in * acc_qk(i));
+    }
+  }
+
+  // the derivative of the cap is 1 - tanh^2, where tanh = S' * scale_softmax / softcap
+  CUTLASS_DEVICE
+  float score_mod_grad(float acc_qk, float scale_softmax) {
+    float t = acc_qk * (scale_softmax / softcap);
+    return 1.0f - t * t;
+  }
+};
+
+// ALiBi, x -> x - slope[head] * |j - i|, with one slope per query head given
+// in ptr_slopes. Like for the causal mask, Q can be aligned with the beginning
+// or the end of K. The bias is linear, so it must be the innermost score
+// modification for the backward pass to see the final S'.
+template<class Base, bool kIsQBegin = true>
+struct AlibiFusion : Base {
+
+  static_assert(! has_score_mod_v<Base>, "Compose score modifications as SoftcapFusion<AlibiFusion<Mask>>");
+
+  static constexpr bool HasScoreMod = true;
+
+  float const* ptr_slopes = nullptr;
+
+  template<class AccQK, class IndexQK, class ProblemSize>
+  CUTLASS_DEVICE
+  void apply_score_mod(
+      AccQK& acc_qk,
+      IndexQK const& index_qk,
+      ProblemSize const& problem_size,
+      int head, float scale_softmax) {
+
+    int offset_q = 0;
+    if constexpr (! kIsQBegin) {
+      offset_q = get<1>(problem_size) - get<0>(problem_size);
+    }
+    float slope = ptr_slopes[head] / scale_softmax;
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(acc_qk); i++) {
+      auto pos = index_qk(i);
+      int distance = ::abs(int(get<1>(pos)) - int(get<0>(pos)) - offset_q);
+      acc_qk(i) -= slope * distance;
+    }
+  }
+
+  CUTLASS_DEVICE
+  float score_mod_grad(float acc_qk, float scale_softmax) {
+    return 1.0f;
+  }
+};
+
+// Attention dropout on P, applied to the operand of the PV MMA. The keep decision of
+// element (row, col) is drawn from a counter-based Philox4x32-10 with the counter
+// (col / 4, row, head, batch) and the 64b seed as key, so the backward pass regenerates
+// the same mask from the coordinates alone and no mask tensor is stored. Kept elements
+// are rescaled by 1 / (1 - p_dropout); the forward kernel folds this into the output scale.
+template<class T, class = void> struct has_dropout_impl : std::false_type {};
+template<class T> struct has_dropout_impl<T, std::void_t<decltype(T::HasDropout)>> : std::bool_constant<T::HasDropout> {};
+template<class T> constexpr bool has_dropout_v = has_dropout_impl<remove_cvref_t<T>>::value;
+
+template<class Base>
+struct DropoutFusion : Base {
+
+  static constexpr bool HasDropout = true;
+
+  float p_dropout = 0.0f;
+  uint64_t seed = 0;
+
+  CUTLASS_HOST_DEVICE
+  float rp_dropout() const {
+    return 1.0f / (1.0f - p_dropout);
+  }
+
+  // elements whose random word is below the threshold are dropped
+  CUTLASS_HOST_DEVICE
+  uint32_t dropout_threshold() const {
+    // 4294967040 is the largest float below 2^32
+    return static_cast<uint32_t>(fminf(p_dropout * 4294967296.0f, 4294967040.0f));
+  }
+
+  // random words of the four columns [col & ~3, (col & ~3) + 4) of a row
+  CUTLASS_HOST_DEVICE
+  Philox4x32_10::result_type dropout_words(int row, int col, int batch, int head) const {
+    Philox4x32_10::Counter counter;
+    counter[0] = static_cast<uint32_t>(col) >> 2;
+    counter[1] = static_cast<uint32_t>(row);
+    counter[2] = static_cast<uint32_t>(head);
+    counter[3] = static_cast<uint32_t>(batch);
+    Philox4x32_10::Key key;
+    key[0] = static_cast<uint32_t>(seed);
+    key[1] = static_cast<uint32_t>(seed >> 32);
+    return Philox4x32_10::generate(counter, key);
+  }
+
+  CUTLASS_HOST_DEVICE
+  bool is_kept(int row, int col, int batch, int head) const {
+    return dropout_words(row, col, batch, head)[col & 3] >= dropout_threshold();
+  }
+
+  // One keep bit per element i of index_qk(i) -> (row, col). Each block of four
+  // columns of a row is drawn once when consecutive elements share it.
+  template<int Count, class IndexQK>
+  CUTLASS_DEVICE
+  Array<uint32_t, (Count + 31) / 32> dropout_keep_bits(IndexQK const& index_qk, int batch, int head) const {
+    Array<uint32_t, (Count + 31) / 32> bits;
+    bits.clear();
+    uint32_t threshold = dropout_threshold();
+    Philox4x32_10::result_type words;
+    int cached_row = -1;
+    int cached_block = -1;
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < Count; i++) {
+      auto pos = index_qk(i);
+      int row = int(get<0>(pos));
+      int col = int(get<1>(pos));
+      if (row != cached_row || (col >> 2) != cached_block) {
+        words = dropout_words(row, col, batch, head);
+        cached_row = row;
+        cached_block = col >> 2;
+      }
+      bits[i / 32] |= uint32_t(words[col & 3] >= threshold) << (i % 32);
+    }
+    return bits;
+  }
+
+  // zeroes the dropped elements of acc and multiplies the kept ones by scale
+  template<class Acc, class IndexQK>
+  CUTLASS_DEVICE
+  void apply_dropout(Acc& acc, IndexQK const& index_qk, int batch, int head, float scale) const {
+    constexpr int Count = decltype(size(acc))::value;
+    auto bits = dropout_keep_bits<Count>(index_qk, batch, head);
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < Count; i++) {
+      acc(i) = ((bits[i / 32] >> (i % 32)) & 1) ? acc(i) * scale : 0.0f;
+    }
+  }
+};
+
+template<class T, class = void> struct is_softcap_fusion_impl : std::false_type {};
+template<class T> struct is_softcap_fusion_impl<T, std::void_t<decltype(std::declval<T&>().softcap)>> : std::true_type {};
+template<class T> constexpr bool is_softcap_fusion_v = is_softcap_fusion_impl<remove_cvref_t<T>>::value;
+
+template<class T, class = void> struct is_alibi_fusion_impl : std::false_type {};
+template<class T> struct is_alibi_fusion_impl<T, std::void_t<decltype(std::declval<T&>().ptr_slopes)>> : std::true_type {};
+template<class T> constexpr bool is_alibi_fusion_v = is_alibi_fusion_impl<remove_cvref_t<T>>::value;
+
+template<class T, class = void> struct is_dropout_fusion_impl : std::false_type {};
+template<class T> struct is_dropout_fusion_impl<T, std::void_t<decltype(std::declval<T&>().p_dropout)>> : std::true_type {};
+template<class T> constexpr bool is_dropout_fusion_v = is_dropout_fusion_impl<remove_cvref_t<T>>::value;
+
+template<class T> constexpr bool is_sliding_window_mask_v =
+    std::is_base_of_v<SlidingWindowMask<true>, remove_cvref_t<T>> || std::is_base_of_v<SlidingWindowMask<false>, remove_cvref_t<T>>;
+
+template<class T> constexpr bool is_block_sparse_mask_v = std::is_base_of_v<BlockSparseMask, remove_cvref_t<T>>;
+
 struct VariableLength {
   int max_length;
   int* cumulative_length = nullptr;
@@ -74,6 +74,10 @@ struct Sm100FmhaFwdEpilogueTmaWarpspecialized {
 
     ElementAcc* ptr_LSE;
     StrideLSE dLSE;
+
+    // merge the result into the (O, LSE) already in memory instead of overwriting it,
+    // e.g. to combine the partial attention over the KV shards of context parallelism
+    bool accumulate = false;
   };
 
   using TMA_O = decltype(make_tma_copy(
@@ -88,8 +92,17 @@ struct Sm100FmhaFwdEpilogueTmaWarpspecialized {
 
     ElementAcc* ptr_LSE;
     StrideLSE dLSE;
+
+    Element* ptr_O;
+    StrideO dO;
+    bool accumulate;
   };
 
+  static bool can_implement(Arguments const& args) {
+    // the running LSE is needed to merge with the accumulated O
+    return ! args.accumulate || args.ptr_LSE != nullptr;
+  }
+
   // FMHA and MLA have different input ProblemShapes; 
   // get problem_shape_O according to the input ProblemShape.
   template<class ProblemShape>
@@ -135,7 +148,10 @@ struct Sm100FmhaFwdEpilogueTmaWarpspecialized {
     return {
       tma_store_o,
       args.ptr_LSE,
-      args.dLSE
+      args.dLSE,
+      args.ptr_O,
+      args.dO,
+      args.accumulate
     };
   }
 
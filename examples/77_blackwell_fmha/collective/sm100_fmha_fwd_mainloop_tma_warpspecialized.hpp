@@ -60,7 +60,9 @@ template<
   // (1, 2, 1) means they sit side by side (best for small Q / large K)
   class ThreadShape = Shape<_2, _1, _1>,
   // Since shared memory is sufficient for FMHA, there is no need to reuse shared memory.
-  class OrderLoadEpilogue = cute::false_type
+  class OrderLoadEpilogue = cute::false_type,
+  // applies rotary position embedding to Q and K in smem, see Sm100FmhaLoadTmaWarpspecialized
+  class IsRope_ = cute::false_type
 >
 struct Sm100FmhaFwdMainloopTmaWarpspecialized {
 
@@ -73,8 +75,13 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
   using StrideV = StrideV_;
   using Mask = Mask_;
 
+  // the head dim mode of the tile is either D or (D_VO, D_QK - D_VO), see head_dim_qk
+  static constexpr int HeadDimQK = head_dim_qk(TileShape{});
+  static constexpr int HeadDimVO = head_dim_vo(TileShape{});
+
   static constexpr int StageCountQ = 2;
-  static constexpr int StageCountKV = sizeof(Element_) == 1 ? 4 : 3;
+  // a wider QK^T head dim grows the Q and K tiles, so one K/V stage less keeps them in smem
+  static constexpr int StageCountKV = sizeof(Element_) == 1 ? 4 : (HeadDimQK > 128 ? 2 : 3);
 
   using StagesQ = cutlass::gemm::collective::StageCount<StageCountQ>;
   using StagesKV = cutlass::gemm::collective::StageCount<StageCountKV>;
@@ -83,9 +90,11 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
 
   static const int Alignment = 128 / sizeof_bits_v<Element>;
 
-  using TileShapeQK = decltype(shape_div(TileShape{}, ThreadShape{}));
+  using TileShapeQK = decltype(shape_div(replace<2>(TileShape{}, Int<HeadDimQK>{}), ThreadShape{}));
+
+  using TileShapePV = decltype(select<0,2,1>(shape_div(replace<2>(TileShape{}, Int<HeadDimVO>{}), ThreadShape{})));
 
-  using TileShapePV = decltype(select<0,2,1>(TileShapeQK{}));
+  static_assert(HeadDimVO <= 128, "O has to fit into its tmem allocation");
 
   using CollectiveMmaQK = typename cutlass::gemm::collective::CollectiveBuilder<
       cutlass::arch::Sm100, cutlass::arch::OpClassTensorOp,
@@ -110,7 +119,7 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
 
   // Reuse shared memory for V and O.
   static constexpr bool IsOrderLoadEpilogue = std::is_same_v<OrderLoadEpilogue, cute::true_type>;
-  struct TensorStorage {
+  struct TensorStorageQKV {
     cute::array_aligned<Element, cute::cosize_v<SmemLayoutQ>> smem_q;
     union {
       cute::array_aligned<Element, cute::cosize_v<SmemLayoutK>> smem_k;
@@ -118,6 +127,16 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
     };
   };
 
+  static constexpr bool IsRope = std::is_same_v<IsRope_, cute::true_type>;
+  // from tma to the load warp, protects q/k in smem until they are rotated
+  // placed behind the tiles, so that they do not alias the epilogue storage
+  struct TensorStorageQKVRope : TensorStorageQKV {
+    alignas(16) uint64_t rope_barrier_q;
+    uint64_t rope_barrier_k;
+  };
+
+  using TensorStorage = std::conditional_t<IsRope, TensorStorageQKVRope, TensorStorageQKV>;
+
   enum class TmemAllocation : uint32_t {
     kSizeS = 128,
     kSizeO = 128,
@@ -175,13 +194,15 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
   static const int TransactionBytesLoadK = cutlass::bits_to_bytes(cosize(take<0,3>(SmemLayoutK{})) * cute::sizeof_bits_v<Element>);
   static const int TransactionBytesLoadV = cutlass::bits_to_bytes(cosize(take<0,3>(SmemLayoutV{})) * cute::sizeof_bits_v<Element>);
 
-  static_assert(TransactionBytesLoadK == TransactionBytesLoadV, "K and V smem layouts must be of equal size");
+  // K and V share a pipeline, its stages expect the smaller of the two tiles and the load of the
+  // larger one expects the difference on top, see Sm100FmhaLoadTmaWarpspecialized
+  static const int TransactionBytesLoadKV = cute::min(TransactionBytesLoadK, TransactionBytesLoadV);
 
   using Load = Sm100FmhaLoadTmaWarpspecialized<
     Element, StrideQ, StrideK, StrideV,
     CollectiveMmaQK, CollectiveMmaPV,
     SmemLayoutQ, SmemLayoutK, SmemLayoutV,
-    TensorStorage, PipelineQ, PipelineKV, Mask, TileShape
+    TensorStorage, PipelineQ, PipelineKV, Mask, TileShape, IsRope
   >;
 
   struct Arguments {
@@ -197,6 +218,9 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
 
     // scaling factor to quantize O
     float inv_scale_o = 1.0f;
+
+    // runtime state of the mask, e.g. the window size of a sliding window mask
+    Mask mask = {};
   };
 
   struct Params {
@@ -206,11 +230,33 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
     float scale_softmax_log2;
 
     float scale_output;
+
+    Mask mask;
   };
 
   template<class ProblemShape>
   static bool can_implement(ProblemShape const& problem_shape, Arguments const& args) {
-    return true;
+    if constexpr (is_block_sparse_mask_v<Mask>) {
+      if (args.mask.ptr_row_offsets == nullptr || args.mask.ptr_col_indices == nullptr) {
+        std::cerr << __FILE__ << "(" << __LINE__ << "): block sparse layout missing\n";
+        return false;
+      }
+      if (args.mask.block_q != get<0>(TileShape{}) || args.mask.block_kv != get<1>(TileShape{})) {
+        std::cerr << __FILE__ << "(" << __LINE__ << "): block sparse block size does not match tile\n";
+        return false;
+      }
+    }
+    return Load::can_implement(problem_shape, args.load);
+  }
+
+  // the kept elements of P are rescaled together with O
+  static float output_scale_dropout(Mask const& mask) {
+    if constexpr (has_dropout_v<Mask>) {
+      return mask.rp_dropout();
+    }
+    else {
+      return 1.0f;
+    }
   }
 
   template<class ProblemShape>
@@ -221,7 +267,7 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
 
     float scale_softmax = args.scale_softmax;
     if (scale_softmax == 0.0f) {
-      scale_softmax = 1.0f / (float) std::sqrt(get<2>(problem_shape));
+      scale_softmax = 1.0f / (float) std::sqrt(head_dim_qk(problem_shape));
     }
     float log2_e = static_cast<float>(std::log2(std::exp(1.0)));
 
@@ -229,7 +275,8 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
         Load::to_underlying_arguments(problem_shape, args.load, workspace),
         args.scale_q * args.scale_k * scale_softmax,
         args.scale_q * args.scale_k * log2_e * scale_softmax,
-        args.scale_v * args.inv_scale_o
+        args.scale_v * args.inv_scale_o * output_scale_dropout(args.mask),
+        args.mask
     };
   }
 
@@ -248,7 +295,7 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
       PipelineKV& pipeline_kv, typename PipelineKV::PipelineState& pipeline_kv_producer_state) {
 
     Load load;
-    load.load(blk_coord, problem_shape, params.load, params_problem_shape,
+    load.load(blk_coord, problem_shape, params.load, params.mask, params_problem_shape,
         storage,
         pipeline_q, pipeline_q_producer_state,
         pipeline_kv, pipeline_kv_producer_state);
@@ -269,7 +316,8 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
     auto pipeline_q_release_state = pipeline_q_consumer_state;
     auto pipeline_kv_release_state = pipeline_kv_consumer_state;
 
-    int mask_tile_count = Mask{}.get_trip_count(blk_coord, TileShape{}, problem_shape);
+    Mask mask = params.mask;
+    int mask_tile_count = mask.get_trip_count(blk_coord, TileShape{}, problem_shape);
 
     typename CollectiveMmaQK::TiledMma mma_qk;
     ThrMMA thr_mma_qk = mma_qk.get_slice(0);
@@ -572,14 +620,24 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
     Tensor tTMEM_LOADrS = make_tensor<ElementQK>(shape(tTMEM_LOADcS));
     copy(tiled_tmem_load, tTMEM_LOADtS, tTMEM_LOADrS);
 
+    // score modifications apply to every tile, and before the mask so masked elements stay at -inf
+    if constexpr (has_score_mod_v<Mask>) {
+      Mask mask = params.mask;
+      mask.apply_score_mod(tTMEM_LOADrS, tTMEM_LOADcS, problem_shape, int(get<2,0>(blk_coord)), params.scale_softmax);
+    }
+
     if constexpr (need_apply_mask) {
-      Mask{}.apply_mask(tTMEM_LOADrS, tTMEM_LOADcS, problem_shape);
+      Mask mask = params.mask;
+      mask.apply_mask(tTMEM_LOADrS, tTMEM_LOADcS, problem_shape);
     }
 
     ElementQK old_row_max = row_max;
     #if defined CUTE_ARCH_TCGEN05_TMEM_STAT_ENABLED
       auto pos = tTMEM_LOADcS(0);
-      if (!need_apply_mask || (need_apply_mask && (get<0>(pos) >= get<1>(pos) + 12) && (get<1>(pos) < get<1>(problem_shape)))) {
+      // the hardware max is only valid if the mask cannot hide anything to the left of the diagonal,
+      // and it is taken over the unmodified S
+      constexpr bool kMaskHasLeftEdge = is_sliding_window_mask_v<Mask>;
+      if (!has_score_mod_v<Mask> && (!need_apply_mask || (need_apply_mask && !kMaskHasLeftEdge && (get<0>(pos) >= get<1>(pos) + 12) && (get<1>(pos) < get<1>(problem_shape))))) {
         float curr_max = tiled_tmem_load.get_max();
         row_max = ::fmax(row_max, curr_max);
       }
@@ -631,6 +689,14 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
 
     const int kReleasePipeCount = 10;  // must be multiple of 2
 
+    // dropout only applies to the P fed to the PV MMA, the row sum stays that of the full softmax
+    constexpr int kDropoutBitCount = has_dropout_v<Mask> ? int(size(tTMEM_LOADrS)) : 1;
+    Array<uint32_t, (kDropoutBitCount + 31) / 32> keep_bits;
+    if constexpr (has_dropout_v<Mask>) {
+      keep_bits = params.mask.template dropout_keep_bits<kDropoutBitCount>(
+          tTMEM_LOADcS, int(get<2,1>(blk_coord)), int(get<2,0>(blk_coord)));
+    }
+
     order_s.wait();
 
     CUTLASS_PRAGMA_UNROLL
@@ -651,6 +717,11 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
       CUTLASS_PRAGMA_UNROLL
       for (int j = 0; j < kConversionsPerStep; j++) {
         in_conv[j] = tTMEM_LOADrS(i + j);
+        if constexpr (has_dropout_v<Mask>) {
+          if (((keep_bits[(i + j) / 32] >> ((i + j) % 32)) & 1) == 0) {
+            in_conv[j] = 0;
+          }
+        }
       }
       tTMEM_STORErS_x4_e[i / kConversionsPerStep] = convert(in_conv);
 
@@ -732,7 +803,10 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
       PipelineC& pipeline_c, typename PipelineC::PipelineState& pipeline_c_producer_state,
       OrderBarrierSoftmax& order_s) {
 
-    int mask_tile_count = Mask{}.get_unmasked_trip_count(blk_coord, TileShape{}, problem_shape);
+    Mask mask = params.mask;
+    int leading_mask_tile_count = mask.get_leading_masked_trip_count(blk_coord, TileShape{}, problem_shape);
+    int unmasked_tile_count = mask.get_unmasked_trip_count(blk_coord, TileShape{}, problem_shape);
+    int masked_tile_count = mask.get_masked_trip_count(blk_coord, TileShape{}, problem_shape);
 
     ElementQK row_max = -INFINITY;
     ElementQK row_sum = 0;
@@ -742,39 +816,64 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
         get<0>(blk_coord) * get<0>(TileShape{}) + (stage % get<0>(ThreadShape{})) * get<0>(TileShapeQK{}),
         0 + (stage % get<1>(ThreadShape{})) * get<1>(TileShapeQK{})
     );
-    Tensor cS = domain_offset(logical_offset, cS_base);
+    Tensor cS_tile = domain_offset(logical_offset, cS_base);
+
+    // the mask may skip kv tiles, so look up the position of each iteration
+    int iteration = 0;
+    auto get_cS = [&]() {
+      int k_index = mask.get_kv_tile_index(blk_coord, TileShape{}, problem_shape, iteration);
+      return domain_offset(make_coord(_0{}, k_index * get<1>(TileShape{})), cS_tile);
+    };
 
     pipeline_c.producer_acquire(pipeline_c_producer_state);
 
+    // Leading masked iterations
+    int mask_tile_count = leading_mask_tile_count;
+
+    CUTLASS_PRAGMA_NO_UNROLL
+    for (; mask_tile_count > 0; mask_tile_count -= 1) {
+      softmax_step<true /* need_apply_mask */>(
+          row_max, row_sum, stage,
+          (mask_tile_count == 1) && (unmasked_tile_count == 0) && (masked_tile_count == 0),
+          blk_coord, get_cS(), params, problem_shape,
+          pipeline_s, pipeline_s_consumer_state,
+          pipeline_c, pipeline_c_producer_state,
+          order_s
+      );
+
+      iteration += 1;
+    }
+
+    mask_tile_count = unmasked_tile_count;
+
     CUTLASS_PRAGMA_NO_UNROLL
     for (; mask_tile_count > 0; mask_tile_count -= 1) {
       softmax_step<false /* need_apply_mask */>(
           row_max, row_sum, stage,
-          (mask_tile_count == 1) &&
-              (Mask{}.get_masked_trip_count(blk_coord, TileShape{}, problem_shape) == 0),
-          blk_coord, cS, params, problem_shape,
+          (mask_tile_count == 1) && (masked_tile_count == 0),
+          blk_coord, get_cS(), params, problem_shape,
           pipeline_s, pipeline_s_consumer_state,
           pipeline_c, pipeline_c_producer_state,
           order_s
       );
 
-      cS.data() = cS.data() + E<1>{} * get<1>(ThreadShape{}) * get<1>(TileShapeQK{});
+      iteration += 1;
     }
 
     // Masked iterations
-    mask_tile_count = Mask{}.get_masked_trip_count(blk_coord, TileShape{}, problem_shape);
+    mask_tile_count = masked_tile_count;
 
     CUTLASS_PRAGMA_NO_UNROLL
     for (; mask_tile_count > 0; mask_tile_count -= 1) {
       softmax_step<true /* need_apply_mask */>(
           row_max, row_sum, stage, mask_tile_count == 1,
-          blk_coord, cS, params, problem_shape,
+          blk_coord, get_cS(), params, problem_shape,
           pipeline_s, pipeline_s_consumer_state,
           pipeline_c, pipeline_c_producer_state,
           order_s
       );
 
-      cS.data() = cS.data() + E<1>{} * get<1>(ThreadShape{}) * get<1>(TileShapeQK{});
+      iteration += 1;
     }
 
     pipeline_c.producer_commit(pipeline_c_producer_state);
@@ -786,12 +885,30 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
     ++pipeline_s_consumer_state;
   }
 
-  template<class Stage, class TensorO>
+  // Merges the log-sum-exp of a row of this tile with the one of the accumulated (O, LSE),
+  // returns the weights of the tile and of the accumulated O in the merged O.
+  CUTLASS_DEVICE static float2
+  merge_lse(float& lse, float lse_acc) {
+    float lse_max = fmaxf(lse, lse_acc);
+    if (lse_max == -INFINITY) {
+      return make_float2(0.0f, 0.0f);
+    }
+    float weight = cutlass::fast_exp(lse - lse_max);
+    float weight_acc = cutlass::fast_exp(lse_acc - lse_max);
+    float sum = weight + weight_acc;
+    lse = lse_max + cutlass::fast_log(sum);
+    return make_float2(weight / sum, weight_acc / sum);
+  }
+
+  // gO_acc is the row of the accumulated O held by this thread, added with scale_acc if non-zero
+  template<class Stage, class TensorO, class TensorOAcc>
   CUTLASS_DEVICE auto
   correction_epilogue(
       float scale,
       Stage stage,
-      TensorO const& sO_01) {
+      TensorO const& sO_01,
+      float scale_acc,
+      TensorOAcc const& gO_acc) {
 
     using ElementOut = typename TensorO::value_type;
 
@@ -836,7 +953,7 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
     // loop:
     //   TMEM_LOAD, FMUL2 scale, TMEM_STORE
     CUTLASS_PRAGMA_UNROLL
-    for (int i = 0; i < get<2>(TileShape{}) / kCorrectionTileSize; i++) {
+    for (int i = 0; i < HeadDimVO / kCorrectionTileSize; i++) {
       Tensor tTMEM_LOADtO_i = tTMEM_LOADtO(_, _0{}, _0{}, i);
       Tensor tTMEM_LOADsO_i = tTMEM_LOADsO(_, _0{}, _0{}, i);
 
@@ -855,6 +972,14 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
       }
 #endif
 
+      if (scale_acc != 0.0f) {
+        Tensor tTMcO_i = tTMEM_LOADcO(_, _0{}, _0{}, i);
+        CUTLASS_PRAGMA_UNROLL
+        for (int j = 0; j < size(tTMrO); j++) {
+          tTMrO(j) += scale_acc * static_cast<ElementPV>(gO_acc(get<1>(tTMcO_i(j))));
+        }
+      }
+
       constexpr int N = 4 / sizeof(ElementOut);
       NumericArrayConverter<ElementOut, ElementPV, N> convert;
 
@@ -877,6 +1002,40 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
     cutlass::arch::fence_view_async_shared();
   }
 
+  // Final rescale of the O of one stage into the epilogue smem and store of its LSE.
+  // When accumulating, the row is merged with the (O, LSE) in memory on the way.
+  template<
+    class Stage, class TensorRS, class BlkCoord, class ProblemShape,
+    class TensorO, class TensorLSE, class TensorOAcc, class CollectiveEpilogue
+  >
+  CUTLASS_DEVICE auto
+  correction_final(
+      Stage stage, TensorRS const& tTMEM_LOADVrS,
+      int row_idx, int row_offset,
+      BlkCoord const& blk_coord,
+      Params const& params, ProblemShape const& problem_shape,
+      TensorO const& sO, TensorLSE& gLSE, TensorOAcc const& mO,
+      CollectiveEpilogue& epilogue) {
+
+    bool is_row_valid = row_idx < get<0>(problem_shape);
+    float scale = params.scale_output / tTMEM_LOADVrS(kIdxFinalRowSum);
+    float scale_acc = 0.0f;
+    ElementPV lse = cutlass::fast_log(tTMEM_LOADVrS(kIdxFinalRowSum)) + params.scale_softmax * tTMEM_LOADVrS(kIdxFinalRowMax);
+
+    if (epilogue.params.accumulate && is_row_valid) {
+      float2 weights = merge_lse(lse, gLSE(row_idx + row_offset, get<2>(blk_coord)));
+      // a fully masked row has a zero row sum, do not let it turn the merged O into NaN
+      scale = weights.x == 0.0f ? 0.0f : scale * weights.x;
+      scale_acc = weights.y;
+    }
+
+    correction_epilogue(scale, stage, sO, scale_acc, mO(row_idx + row_offset, _, get<2>(blk_coord)));
+
+    if (epilogue.params.ptr_LSE != nullptr && is_row_valid) {
+      gLSE(row_idx + row_offset, get<2>(blk_coord)) = lse;
+    }
+  }
+
   CUTLASS_DEVICE auto
   correction_rescale(
       float scale,
@@ -937,7 +1096,7 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
     //   TMEM_LOAD, FMUL2 scale, TMEM_STORE
     copy_in(0);
 
-    int count = get<2>(TileShape{}) / kCorrectionTileSize;
+    int count = HeadDimVO / kCorrectionTileSize;
 
     CUTLASS_PRAGMA_UNROLL
     for (int i = 0; i < count; i++) {
@@ -978,7 +1137,8 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
       PipelineE& pipeline_epi, typename PipelineE::PipelineState& pipeline_epi_producer_state,
       CollectiveEpilogue& epilogue) {
 
-    int mask_tile_count = Mask{}.get_trip_count(blk_coord, TileShape{}, problem_shape);
+    Mask mask = params.mask;
+    int mask_tile_count = mask.get_trip_count(blk_coord, TileShape{}, problem_shape);
 
     int thread_idx = threadIdx.x % (4 * cutlass::NumThreadsPerWarp);
 
@@ -1092,24 +1252,18 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
     //    store to smem
     Tensor sO = make_tensor(make_smem_ptr(shared_storage_epi.smem_o.data()), typename TensorStorageEpi::SmemLayoutO{});
     Tensor gLSE = make_tensor(make_gmem_ptr(epilogue.params.ptr_LSE), select<0,3>(problem_shape), epilogue.params.dLSE);
+    Tensor mO = make_tensor(make_gmem_ptr(epilogue.params.ptr_O), epilogue.get_problem_shape_O(problem_shape), epilogue.params.dO);
 
-    correction_epilogue(params.scale_output / tTMEM_LOADVrS(kIdxFinalRowSum), _0{}, sO);
-
-    if (epilogue.params.ptr_LSE != nullptr) {
-      int row_idx = get<0>(tTMEM_LOADVcS(_0{})) + get<0>(TileShape{}) * get<0>(blk_coord);
-
-      int row_offset = 0;
-      if constexpr (is_variable_length_v<tuple_element_t<0, ParamsProblemShape>>) {
+    int row_offset = 0;
+    if constexpr (is_variable_length_v<tuple_element_t<0, ParamsProblemShape>>) {
+      if (epilogue.params.ptr_LSE != nullptr) {
         row_offset = get<0>(params_problem_shape).cumulative_length[get<2,1>(blk_coord)];
       }
-
-      ElementPV lse = cutlass::fast_log(tTMEM_LOADVrS(kIdxFinalRowSum)) + params.scale_softmax * tTMEM_LOADVrS(kIdxFinalRowMax);
-
-      if (row_idx < get<0>(problem_shape)) {
-        gLSE(row_idx + row_offset, get<2>(blk_coord)) = lse;
-      }
     }
 
+    correction_final(_0{}, tTMEM_LOADVrS, get<0>(tTMEM_LOADVcS(_0{})) + get<0>(TileShape{}) * get<0>(blk_coord),
+        row_offset, blk_coord, params, problem_shape, sO, gLSE, mO, epilogue);
+
     cutlass::arch::fence_view_async_tmem_load();
 
     pipeline_o.consumer_release(pipeline_o_consumer_state);
@@ -1129,22 +1283,8 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
     pipeline_o.consumer_wait(pipeline_o_consumer_state);
     pipeline_epi.producer_acquire(pipeline_epi_producer_state);
 
-    correction_epilogue(params.scale_output / tTMEM_LOADVrS(kIdxFinalRowSum), _1{}, sO);
-
-    if (epilogue.params.ptr_LSE != nullptr) {
-      int row_idx = get<0>(tTMEM_LOADVcS(_0{})) + get<0>(TileShape{}) * get<0>(blk_coord) + get<0>(TileShapeQK{});
-
-      ElementPV lse = cutlass::fast_log(tTMEM_LOADVrS(kIdxFinalRowSum)) + params.scale_softmax * tTMEM_LOADVrS(kIdxFinalRowMax);
-
-      int row_offset = 0;
-      if constexpr (is_variable_length_v<tuple_element_t<0, ParamsProblemShape>>) {
-        row_offset = get<0>(params_problem_shape).cumulative_length[get<2,1>(blk_coord)];
-      }
-
-      if (row_idx < get<0>(problem_shape)) {
-        gLSE(row_idx + row_offset, get<2>(blk_coord)) = lse;
-      }
-    }
+    correction_final(_1{}, tTMEM_LOADVrS, get<0>(tTMEM_LOADVcS(_0{})) + get<0>(TileShape{}) * get<0>(blk_coord) + get<0>(TileShapeQK{}),
+        row_offset, blk_coord, params, problem_shape, sO, gLSE, mO, epilogue);
 
     cutlass::arch::fence_view_async_tmem_load();
 
@@ -1196,7 +1336,26 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
     copy(tiled_copy, tOrO, tOgO(_,_,_,_0{}));
 #endif
 
-    if (epilogue.params.ptr_LSE != nullptr) {
+    // nothing to merge into the accumulated (O, LSE), store its O back unchanged
+    Tensor mO = make_tensor(make_gmem_ptr(epilogue.params.ptr_O), epilogue.get_problem_shape_O(problem_shape), epilogue.params.dO);
+    auto copy_accumulated = [&](auto stage, int row_idx) {
+      if (! epilogue.params.accumulate || row_idx >= get<0>(problem_shape)) {
+        return;
+      }
+      int row_offset = 0;
+      if constexpr (is_variable_length_v<tuple_element_t<0, ParamsProblemShape>>) {
+        row_offset = get<0>(params_problem_shape).cumulative_length[get<2,1>(blk_coord)];
+      }
+      CUTLASS_PRAGMA_NO_UNROLL
+      for (int i = 0; i < HeadDimVO; i++) {
+        sO(thread_idx, i, stage) = mO(row_idx + row_offset, i, get<2>(blk_coord));
+      }
+    };
+
+    copy_accumulated(_0{}, thread_idx + get<0>(TileShape{}) * get<0>(blk_coord));
+    cutlass::arch::fence_view_async_shared();
+
+    if (epilogue.params.ptr_LSE != nullptr && ! epilogue.params.accumulate) {
       int row_idx = thread_idx + get<0>(TileShape{}) * get<0>(blk_coord);
 
       int row_offset = 0;
@@ -1213,10 +1372,11 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
     ++pipeline_epi_producer_state;
 
     copy(tiled_copy, tOrO, tOgO(_,_,_,_1{}));
+    copy_accumulated(_1{}, thread_idx + get<0>(TileShape{}) * get<0>(blk_coord) + get<0>(TileShapeQK{}));
     cutlass::arch::fence_view_async_shared();
     pipeline_epi.producer_acquire(pipeline_epi_producer_state);
 
-    if (epilogue.params.ptr_LSE != nullptr) {
+    if (epilogue.params.ptr_LSE != nullptr && ! epilogue.params.accumulate) {
       int row_idx = thread_idx + get<0>(TileShape{}) * get<0>(blk_coord) + get<0>(TileShapeQK{});
 
       int row_offset = 0;
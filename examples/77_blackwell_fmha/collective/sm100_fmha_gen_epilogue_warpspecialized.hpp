@@ -37,7 +37,8 @@ namespace cutlass::fmha::collective {
 
 template<
     class Element_,
-    class StrideO_
+    class StrideO_,
+    class ElementAcc_ = float
 >
 struct Sm100FmhaGenEpilogueWarpspecialized {
     
@@ -46,8 +47,12 @@ struct Sm100FmhaGenEpilogueWarpspecialized {
   using SmemLayoutO = Layout<Shape<_1, _1, _1>>;
   using SmemLayoutO_ = SmemLayoutO;
   using Element = Element_;
+  using ElementAcc = ElementAcc_;
   using StrideOOrig = StrideO_;
   using StrideO = decltype(replace<0>(StrideOOrig{}, 0));
+  // partial results of split-kv, O is (QG, D, (H, B), split), LSE is (QG, (H, B), split)
+  using StrideOAcc = decltype(append<4>(StrideO{}, int{}));
+  using StrideLSEAcc = decltype(make_stride(_1{}, get<2>(StrideO{}), int{}));
   
   struct TensorStorage {
 
@@ -59,6 +64,12 @@ struct Sm100FmhaGenEpilogueWarpspecialized {
   struct Arguments {
     Element* ptr_o;
     StrideO dO;
+
+    // only used if the kv sequence is split
+    ElementAcc* ptr_o_acc = nullptr;
+    StrideOAcc dOAcc = {};
+    ElementAcc* ptr_lse_acc = nullptr;
+    StrideLSEAcc dLSEAcc = {};
   };
 
   using Params = Arguments;
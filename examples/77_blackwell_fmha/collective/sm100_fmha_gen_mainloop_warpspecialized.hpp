@@ -199,8 +199,16 @@ struct Sm100FmhaGenMainloopWarpspecialized {
     float scale_k = 1.0f;
     float scale_v = 1.0f;
 
+    // optional per kv head dequantization factors for a quantized (e.g. FP8) kv cache,
+    // applied on top of scale_k / scale_v, indexed by kv head
+    float const* ptr_scale_k = nullptr;
+    float const* ptr_scale_v = nullptr;
+
     // scaling factor to quantize O
     float inv_scale_o = 1.0f;
+
+    // number of partitions along the kv sequence, see get_split_tile_range
+    int split_kv = 1;
   };
 
   struct Params {
@@ -210,6 +218,11 @@ struct Sm100FmhaGenMainloopWarpspecialized {
     float scale_softmax_log2;
 
     float scale_output;
+
+    float const* ptr_scale_k;
+    float const* ptr_scale_v;
+
+    int split_kv;
   };
 
   template<class ProblemShape>
@@ -233,10 +246,49 @@ struct Sm100FmhaGenMainloopWarpspecialized {
         Load::to_underlying_arguments(problem_shape, args.load, workspace),
         args.scale_q * args.scale_k * scale_softmax,
         args.scale_q * args.scale_k * log2_e * scale_softmax,
-        args.scale_v * args.inv_scale_o
+        args.scale_v * args.inv_scale_o,
+        args.ptr_scale_k,
+        args.ptr_scale_v,
+        args.split_kv
     };
   }
 
+  // softmax (log2 domain) and output scales of the kv head get<2,0>(blk_coord),
+  // the per-head kv dequantization factors are folded in so the inner loops stay unchanged
+  template<class BlkCoord>
+  CUTLASS_DEVICE
+  static auto get_head_scales(Params const& params, BlkCoord const& blk_coord) {
+    float scale_softmax_log2 = params.scale_softmax_log2;
+    float scale_output = params.scale_output;
+    if (params.ptr_scale_k != nullptr) {
+      scale_softmax_log2 *= params.ptr_scale_k[get<2,0>(blk_coord)];
+    }
+    if (params.ptr_scale_v != nullptr) {
+      scale_output *= params.ptr_scale_v[get<2,0>(blk_coord)];
+    }
+    return cute::make_tuple(scale_softmax_log2, scale_output);
+  }
+
+  // kv tiles [k_index, k_index + k_tile_count) processed by the split get<3>(blk_coord)
+  // the last split also owns the residual tile, earlier splits are never masked
+  template<class BlkCoord, class ProblemShape>
+  CUTLASS_HOST_DEVICE
+  static auto get_split_tile_range(BlkCoord const& blk_coord, ProblemShape const& problem_shape, int split_kv) {
+    int k_tile_total = ceil_div(get<1>(problem_shape), get<1>(TileShape{}));
+    int k_tile_per_cta = ceil_div(k_tile_total, split_kv);
+    int k_index = get<3>(blk_coord) * k_tile_per_cta;
+    int k_tile_count = max(0, min(k_tile_total, k_index + k_tile_per_cta) - k_index);
+    return cute::make_tuple(k_index, k_tile_count, k_index + k_tile_count == k_tile_total);
+  }
+
+  // number of splits that received at least one kv tile
+  template<class ProblemShape>
+  CUTLASS_HOST_DEVICE
+  static int get_split_count(ProblemShape const& problem_shape, int split_kv) {
+    int k_tile_total = ceil_div(get<1>(problem_shape), get<1>(TileShape{}));
+    return ceil_div(k_tile_total, ceil_div(k_tile_total, split_kv));
+  }
+
   CUTLASS_DEVICE
   static void prefetch_tma_descriptors(Params const& params) {
     Load::prefetch_tma_descriptors(params.load);
@@ -251,11 +303,14 @@ struct Sm100FmhaGenMainloopWarpspecialized {
       PipelineQ& pipeline_q, typename PipelineQ::PipelineState& pipeline_q_producer_state,
       PipelineKV& pipeline_kv, typename PipelineKV::PipelineState& pipeline_kv_producer_state) {
 
+    auto [k_index, k_tile_count, is_last_split] = get_split_tile_range(blk_coord, problem_shape, params.split_kv);
+
     Load load;
     load.load(blk_coord, problem_shape, params.load, params_problem_shape,
         storage,
         pipeline_q, pipeline_q_producer_state,
-        pipeline_kv, pipeline_kv_producer_state);
+        pipeline_kv, pipeline_kv_producer_state,
+        k_index, k_tile_count);
   }
 
   template<class BlkCoord, class ProblemShape>
@@ -273,7 +328,7 @@ struct Sm100FmhaGenMainloopWarpspecialized {
     auto pipeline_q_release_state = pipeline_q_consumer_state;
     auto pipeline_kv_release_state = pipeline_kv_consumer_state;
 
-    int mask_tile_count = Mask{}.get_trip_count(blk_coord, TileShape{}, problem_shape);
+    int mask_tile_count = get<1>(get_split_tile_range(blk_coord, problem_shape, params.split_kv));
 
     typename CollectiveMmaQK::TiledMma mma_qk;
     ThrMMA thr_mma_qk = mma_qk.get_slice(0);
@@ -521,6 +576,7 @@ struct Sm100FmhaGenMainloopWarpspecialized {
       Stage stage, bool final_call,
       BlkCoord const& blk_coord, CoordTensor const& cS,
       Params const& params, ProblemShape const& problem_shape,
+      float scale_softmax_log2,
       PipelineS& pipeline_s, typename PipelineS::PipelineState& pipeline_s_consumer_state,
       PipelineC& pipeline_c, typename PipelineC::PipelineState& pipeline_c_producer_state,
       OrderBarrierSoftmax& order_s) {
@@ -619,7 +675,7 @@ struct Sm100FmhaGenMainloopWarpspecialized {
 
     // notify correction wg that they are ready (might need addtl ordering between S0 and S1 WG's)
 
-    ElementQK scale = params.scale_softmax_log2;
+    ElementQK scale = scale_softmax_log2;
     ElementQK row_max_scale = row_max_safe * scale;
 
     float2 scale_fp32x2 = make_float2(scale, scale);
@@ -736,7 +792,11 @@ struct Sm100FmhaGenMainloopWarpspecialized {
       PipelineC& pipeline_c, typename PipelineC::PipelineState& pipeline_c_producer_state,
       OrderBarrierSoftmax& order_s) {
 
-    int mask_tile_count = Mask{}.get_unmasked_trip_count(blk_coord, TileShape{}, problem_shape);
+    auto [k_index, k_tile_count, is_last_split] = get_split_tile_range(blk_coord, problem_shape, params.split_kv);
+    int masked_tile_count = is_last_split ? Mask{}.get_masked_trip_count(blk_coord, TileShape{}, problem_shape) : 0;
+    int mask_tile_count = k_tile_count - masked_tile_count;
+
+    float scale_softmax_log2 = get<0>(get_head_scales(params, blk_coord));
 
     ElementQK row_max = -INFINITY;
     ElementQK row_sum = 0;
@@ -744,7 +804,7 @@ struct Sm100FmhaGenMainloopWarpspecialized {
     Tensor cS_base = make_identity_tensor(select<0,1>(TileShapeQK{}));
     auto logical_offset = make_coord(
         get<0>(blk_coord) * get<0>(TileShape{}) + (stage % get<0>(ThreadShape{})) * get<0>(TileShapeQK{}),
-        0 + (stage % get<1>(ThreadShape{})) * get<1>(TileShapeQK{})
+        k_index * get<1>(TileShape{}) + (stage % get<1>(ThreadShape{})) * get<1>(TileShapeQK{})
     );
     Tensor cS = domain_offset(logical_offset, cS_base);
 
@@ -754,9 +814,8 @@ struct Sm100FmhaGenMainloopWarpspecialized {
     for (; mask_tile_count > 0; mask_tile_count -= 1) {
       softmax_step<false /* need_apply_mask */>(
           row_max, row_sum, stage,
-          (mask_tile_count == 1) &&
-              (Mask{}.get_masked_trip_count(blk_coord, TileShape{}, problem_shape) == 0),
-          blk_coord, cS, params, problem_shape,
+          (mask_tile_count == 1) && (masked_tile_count == 0),
+          blk_coord, cS, params, problem_shape, scale_softmax_log2,
           pipeline_s, pipeline_s_consumer_state,
           pipeline_c, pipeline_c_producer_state,
           order_s
@@ -766,13 +825,13 @@ struct Sm100FmhaGenMainloopWarpspecialized {
     }
 
     // Masked iterations
-    mask_tile_count = Mask{}.get_masked_trip_count(blk_coord, TileShape{}, problem_shape);
+    mask_tile_count = masked_tile_count;
 
     CUTLASS_PRAGMA_NO_UNROLL
     for (; mask_tile_count > 0; mask_tile_count -= 1) {
       softmax_step<true /* need_apply_mask */>(
           row_max, row_sum, stage, mask_tile_count == 1,
-          blk_coord, cS, params, problem_shape,
+          blk_coord, cS, params, problem_shape, scale_softmax_log2,
           pipeline_s, pipeline_s_consumer_state,
           pipeline_c, pipeline_c_producer_state,
           order_s
@@ -790,12 +849,12 @@ struct Sm100FmhaGenMainloopWarpspecialized {
     ++pipeline_s_consumer_state;
   }
 
-  template<class Vector, class GTensor, class CTensor, class Shape, class Epilogue>
+  template<class Vector, class GTensor, class CTensor, class Shape, class Epilogue, class LSETensor = std::nullptr_t>
   CUTLASS_DEVICE auto
   correction_epilogue(
       float scale_softmax_log2, float scale_out, Vector const& v0, Vector const& v1,
       GTensor& gO, CTensor const& cO, Shape const& g_shape,
-      Epilogue const& epilogue) {
+      Epilogue const& epilogue, LSETensor gLSE = nullptr) {
 
     using ElementOut = typename GTensor::value_type;
 
@@ -806,7 +865,8 @@ struct Sm100FmhaGenMainloopWarpspecialized {
     // good values would be either 32 or 64
     const int kCorrectionTileSize = 32 / sizeof(ElementOut);
 
-    using TMEM_LOAD = std::conditional_t<kCorrectionTileSize == 32, SM100_TMEM_LOAD_32dp32b32x, SM100_TMEM_LOAD_32dp32b16x>;  // 4x32 threads with 64 cols of 32b elem
+    using TMEM_LOAD = std::conditional_t<kCorrectionTileSize == 32, SM100_TMEM_LOAD_32dp32b32x,
+                      std::conditional_t<kCorrectionTileSize == 16, SM100_TMEM_LOAD_32dp32b16x, SM100_TMEM_LOAD_32dp32b8x>>;  // 4x32 threads with 64 cols of 32b elem
 
     typename CollectiveMmaPV::TiledMma mma;
     Tensor tOtO = partition_fragment_C(mma, select<0,1>(TileShapePV{}));
@@ -837,6 +897,13 @@ struct Sm100FmhaGenMainloopWarpspecialized {
     float scale0 = scale_out * adj0 / row_sum;
     float scale1 = scale_out * adj1 / row_sum;
 
+    if constexpr (! is_same_v<LSETensor, std::nullptr_t>) {
+      // base-2 log-sum-exp of the scaled scores, used to combine the splits
+      if (get<0>(tTMEM_LOADcO(_0{})) < get<0>(g_shape)) {
+        gLSE(get<0>(tTMEM_LOADcO(_0{}))) = ::log2f(row_sum) + scale_softmax_log2 * row_max;
+      }
+    }
+
     float2 scale0_f32x2 = make_float2(scale0, scale0);
     float2 scale1_f32x2 = make_float2(scale1, scale1);
 
@@ -988,7 +1055,8 @@ struct Sm100FmhaGenMainloopWarpspecialized {
       PipelineE& pipeline_epi, typename PipelineE::PipelineState& pipeline_epi_producer_state,
       Epilogue const& epilogue) {
 
-    int mask_tile_count = Mask{}.get_trip_count(blk_coord, TileShape{}, problem_shape);
+    int mask_tile_count = get<1>(get_split_tile_range(blk_coord, problem_shape, params.split_kv));
+    auto [scale_softmax_log2, scale_output] = get_head_scales(params, blk_coord);
 
     int thread_idx = threadIdx.x % (4 * cutlass::NumThreadsPerWarp);
 
@@ -1034,7 +1102,7 @@ struct Sm100FmhaGenMainloopWarpspecialized {
       copy(tiled_tmem_loadv, tTMEM_LOADVtS0, tTMEM_LOADVrS);
 
       // e^(scale * (old_max - new_max)
-      float scale = (tTMEM_LOADVrS(kIdxOldRowMax) == tTMEM_LOADVrS(kIdxNewRowMax)) ? 1.0f : ::exp2f(params.scale_softmax_log2 * (tTMEM_LOADVrS(kIdxOldRowMax) - tTMEM_LOADVrS(kIdxNewRowMax)));
+      float scale = (tTMEM_LOADVrS(kIdxOldRowMax) == tTMEM_LOADVrS(kIdxNewRowMax)) ? 1.0f : ::exp2f(scale_softmax_log2 * (tTMEM_LOADVrS(kIdxOldRowMax) - tTMEM_LOADVrS(kIdxNewRowMax)));
 
       pipeline_o.consumer_wait(pipeline_o_consumer_state);
 
@@ -1055,7 +1123,7 @@ struct Sm100FmhaGenMainloopWarpspecialized {
 
       copy(tiled_tmem_loadv, tTMEM_LOADVtS1, tTMEM_LOADVrS);
 
-      scale = (tTMEM_LOADVrS(kIdxOldRowMax) == tTMEM_LOADVrS(kIdxNewRowMax)) ? 1.0f : ::exp2f(params.scale_softmax_log2 * (tTMEM_LOADVrS(kIdxOldRowMax) - tTMEM_LOADVrS(kIdxNewRowMax)));
+      scale = (tTMEM_LOADVrS(kIdxOldRowMax) == tTMEM_LOADVrS(kIdxNewRowMax)) ? 1.0f : ::exp2f(scale_softmax_log2 * (tTMEM_LOADVrS(kIdxOldRowMax) - tTMEM_LOADVrS(kIdxNewRowMax)));
 
       pipeline_o.consumer_wait(pipeline_o_consumer_state);
 
@@ -1115,10 +1183,23 @@ struct Sm100FmhaGenMainloopWarpspecialized {
 
     Tensor cO = make_identity_tensor(select<0,1>(TileShapePV{}));
     auto g_shape = select<0,2>(problem_shape);
-    auto mO = make_tensor(make_gmem_ptr(epilogue.params.ptr_o), append<3>(select<0,1>(TileShapePV{}), get<3>(problem_shape)), epilogue.params.dO);
-    auto gO = mO(_, _, get<2>(blk_coord));
+    if (get_split_count(problem_shape, params.split_kv) > 1) {
+      // partial O in full precision, combined with the other splits by the reduction kernel
+      auto mO = make_tensor(make_gmem_ptr(epilogue.params.ptr_o_acc),
+          append<4>(append<3>(select<0,1>(TileShapePV{}), get<3>(problem_shape)), params.split_kv), epilogue.params.dOAcc);
+      auto gO = mO(_, _, get<2>(blk_coord), get<3>(blk_coord));
+      auto mLSE = make_tensor(make_gmem_ptr(epilogue.params.ptr_lse_acc),
+          make_shape(get<0>(TileShapePV{}), get<3>(problem_shape), params.split_kv), epilogue.params.dLSEAcc);
+      auto gLSE = mLSE(_, get<2>(blk_coord), get<3>(blk_coord));
+
+      correction_epilogue(scale_softmax_log2, scale_output, tTMEM_LOADVrS0, tTMEM_LOADVrS1, gO, cO, g_shape, epilogue, gLSE);
+    }
+    else {
+      auto mO = make_tensor(make_gmem_ptr(epilogue.params.ptr_o), append<3>(select<0,1>(TileShapePV{}), get<3>(problem_shape)), epilogue.params.dO);
+      auto gO = mO(_, _, get<2>(blk_coord));
 
-    correction_epilogue(params.scale_softmax_log2, params.scale_output, tTMEM_LOADVrS0, tTMEM_LOADVrS1, gO, cO, g_shape, epilogue);
+      correction_epilogue(scale_softmax_log2, scale_output, tTMEM_LOADVrS0, tTMEM_LOADVrS1, gO, cO, g_shape, epilogue);
+    }
 
     cutlass::arch::fence_view_async_tmem_load();
 
@@ -38,6 +38,7 @@
 
 #include "collective/fmha_common.hpp"
 #include "collective/fmha_fusion.hpp"
+#include "common/pow_2.hpp"
 
 namespace cutlass::fmha::collective {
 
@@ -82,6 +83,14 @@ struct Sm100FmhaLoadCpAsyncWarpspecialized {
     StrideCacheK dCacheK;
     Element* ptr_cache_v;
     StrideCacheV dCacheV;
+
+    // for paged attention, we interpret what was previously [batch, seqlen]
+    // of the cache as [page_count, page_size], and index according to page_table
+    const int* ptr_page_table = nullptr;
+    // page table is [pages per batch, batch]
+    Stride<_1, int> stride_page_table = {};
+    int page_count = 0;
+    int page_size = 0;  // powers of two
   };
 
   using Params = Arguments;
@@ -142,10 +151,13 @@ struct Sm100FmhaLoadCpAsyncWarpspecialized {
       Params const& params, ParamsProblemShape const& params_problem_shape,
       TensorStorage& storage,
       PipelineQ& pipeline_q, typename PipelineQ::PipelineState& pipeline_q_producer_state,
-      PipelineKV& pipeline_kv, typename PipelineKV::PipelineState& pipeline_kv_producer_state) {
+      PipelineKV& pipeline_kv, typename PipelineKV::PipelineState& pipeline_kv_producer_state,
+      int k_index, int k_tile_count) {
 
-    int mask_tile_count = Mask{}.get_trip_count(blk_coord, TileShape{}, problem_shape);
-    mask_tile_count *= 2;
+    // only the kv tiles [k_index, k_index + k_tile_count) are loaded
+    bool is_last_split = k_index + k_tile_count == ceil_div(get<1>(problem_shape), get<1>(TileShape{}));
+    int mask_tile_count = k_tile_count * 2;
+    k_index *= 2;
 
     int warp_idx = (threadIdx.x / 32) % 2;
     int thread_idx = warp_idx * 32 + (threadIdx.x % 32);
@@ -273,10 +285,23 @@ struct Sm100FmhaLoadCpAsyncWarpspecialized {
     Tensor gNewK = mNewK(_, _, get<2>(blk_coord));
     Tensor gNewV = mNewV(_, _, get<2>(blk_coord));
 
+    // rows of the paged cache are gathered per vector through the page table
+    bool is_paged = params.ptr_page_table != nullptr;
+    auto page_size = Pow2{is_paged ? params.page_size : 1};
+    auto mPT_l = make_tensor(make_gmem_ptr(params.ptr_page_table),
+                             make_shape(params.page_count, get<3,1>(problem_shape)),
+                             params.stride_page_table);
+    auto mPT = mPT_l(_, get<2,1>(blk_coord_cache));
+    auto paged_shape = make_shape(params.page_size, get<2>(problem_shape), make_shape(get<3,0>(problem_shape), params.page_count));
+    Tensor mPagedK = make_tensor(make_gmem_ptr(params.ptr_cache_k), paged_shape, params.dCacheK);
+    Tensor mPagedV = make_tensor(make_gmem_ptr(params.ptr_cache_v), select<1,0,2>(paged_shape), select<1,0,2>(params.dCacheV));
+    Tensor gPagedK = mPagedK(_, _, make_coord(get<2,0>(blk_coord_cache), _));
+    Tensor gPagedV = mPagedV(_, _, make_coord(get<2,0>(blk_coord_cache), _));
+
     auto load_k = [&](int k_index, auto& state) {
       pipeline_kv.producer_acquire(state);
 
-      if (k_index < full_tiles_cache) {
+      if (k_index < full_tiles_cache && ! is_paged) {
         copy(tiled_copy_k, tKgK(_, _, _, _, k_index), tKsK(_, _, _, _, state.index()));
         pipeline_kv.producer_commit(state, cutlass::arch::cpasync_barrier_arrive);
       } else {
@@ -293,6 +318,10 @@ struct Sm100FmhaLoadCpAsyncWarpspecialized {
           Vec* dst_ptr = &dst(i);
           const Vec* src_ptr = &src(i);
           bool guard = elem_less(cc, limitK);
+          if (is_paged && guard) {
+            int row = get<0>(cc);
+            src_ptr = reinterpret_cast<const Vec*>(&gPagedK(row % page_size, get<1>(cc), mPT(row / page_size)));
+          }
           if (get<0>(cc) == seqlen_cache_kv && has_new) {
             src_ptr = &src2(_0{}, get<1>(cc) / vlen);
             guard = true;
@@ -309,7 +338,7 @@ struct Sm100FmhaLoadCpAsyncWarpspecialized {
     auto load_v = [&](int v_index, auto& state) {
       pipeline_kv.producer_acquire(state);
 
-      if (v_index < full_tiles_cache) {
+      if (v_index < full_tiles_cache && ! is_paged) {
         copy(tiled_copy_v, tVgV(_, _, _, _, v_index), tVsV(_, _, _, _, state.index()));
         pipeline_kv.producer_commit(state, cutlass::arch::cpasync_barrier_arrive);
       } else {
@@ -327,6 +356,10 @@ struct Sm100FmhaLoadCpAsyncWarpspecialized {
           Vec* dst_ptr = &dst(i);
           const Vec* src_ptr = &src(i);
           bool guard = elem_less(cc, limitV);
+          if (is_paged && guard) {
+            int row = get<1>(cc);
+            src_ptr = reinterpret_cast<const Vec*>(&gPagedV(get<0>(cc), row % page_size, mPT(row / page_size)));
+          }
           if (get<1>(cc) == seqlen_cache_kv && has_new) {
             src_ptr = &src2(_0{}, get<0>(cc) / vlen);
             guard = true;
@@ -341,8 +374,7 @@ struct Sm100FmhaLoadCpAsyncWarpspecialized {
     };
 
     // K1
-    int k_index = 0;
-    int v_index = 0;
+    int v_index = k_index;
 
     load_k(k_index, pipeline_kv_producer_state);
 
@@ -371,7 +403,19 @@ struct Sm100FmhaLoadCpAsyncWarpspecialized {
     ++pipeline_kv_producer_state;
     v_index += 1;
   
-    if (has_new) {
+    // the new token is appended by the split that holds the last tile
+    if (! is_last_split) {
+      return;
+    }
+
+    if (has_new && is_paged) {
+      int page = mPT(seqlen_cache_kv / page_size);
+      for (int i = thread_idx; i < get<2>(TileShape{}); i += 64) {
+        gPagedK(seqlen_cache_kv % page_size, i, page) = gNewK(0, i);
+        gPagedV(i, seqlen_cache_kv % page_size, page) = gNewV(0, i);
+      }
+    }
+    else if (has_new) {
       for (int i = thread_idx; i < get<2>(TileShape{}); i += 64) {
         gK(seqlen_cache_kv, i, 0) = gNewK(0, i);
         gV(i, seqlen_cache_kv, 0) = gNewV(0, i);
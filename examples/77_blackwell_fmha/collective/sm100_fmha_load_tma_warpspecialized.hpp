@@ -57,13 +57,20 @@ template<
   class PipelineQ,
   class PipelineKV,
   class Mask,
-  class TileShape
+  class TileShape,
+  bool kIsRope = false
 >
 struct Sm100FmhaLoadTmaWarpspecialized {
 
   using TileShapeQK = typename CollectiveMmaQK::TileShape;
   using TileShapePV = typename CollectiveMmaPV::TileShape;
 
+  static const int TransactionBytesLoadQ = cutlass::bits_to_bytes(cosize(take<0,3>(SmemLayoutQ{})) * cute::sizeof_bits_v<Element>);
+  static const int TransactionBytesLoadK = cutlass::bits_to_bytes(cosize(take<0,3>(SmemLayoutK{})) * cute::sizeof_bits_v<Element>);
+  static const int TransactionBytesLoadV = cutlass::bits_to_bytes(cosize(take<0,3>(SmemLayoutV{})) * cute::sizeof_bits_v<Element>);
+  // the kv pipeline expects the smaller tile, the larger one adds the difference when it is loaded
+  static const int TransactionBytesLoadKV = cute::min(TransactionBytesLoadK, TransactionBytesLoadV);
+
   struct Arguments {
     const Element* ptr_Q;
     StrideQ dQ;
@@ -71,6 +78,23 @@ struct Sm100FmhaLoadTmaWarpspecialized {
     StrideK dK;
     const Element* ptr_V;
     StrideV dV;
+
+    // for paged attention, we interpret what was previously [batch, seqlen]
+    // of K and V as [page_count, page_size], and index according to page_table
+    const int* ptr_page_table = nullptr;
+    // page table is [pages per batch, batch]
+    Stride<_1, int> stride_page_table = {};
+    int page_count = 0;
+    int page_size = 0;  // multiple of the K/V tile
+
+    // for rotary position embedding (kIsRope), the pairs (d, d + D/2) of Q and K are rotated
+    // by the angle of their position in the sequence before the QK^T mma
+    // the tables are [position, D/2] and optional, without them the angle of the pair d is
+    // computed on the fly as position * rope_theta^(-2d/D)
+    const float* ptr_rope_cos = nullptr;
+    const float* ptr_rope_sin = nullptr;
+    int rope_stride = 0;  // between positions in the tables
+    float rope_theta = 10000.0f;
   };
 
   using TMA_Q = typename CollectiveMmaQK::Params::TMA_A;
@@ -81,8 +105,39 @@ struct Sm100FmhaLoadTmaWarpspecialized {
     TMA_Q tma_load_q;
     TMA_K tma_load_k;
     TMA_V tma_load_v;
+
+    const int* ptr_page_table = nullptr;
+    Stride<_1, int> stride_page_table = {};
+    int page_count = 0;
+    int page_size = 0;
+
+    const float* ptr_rope_cos = nullptr;
+    const float* ptr_rope_sin = nullptr;
+    int rope_stride = 0;
+    float rope_log2_freq = 0.0f;  // log2 of the frequency of pair d is d * rope_log2_freq
   };
 
+  template<class ProblemShape>
+  static bool can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    if (args.ptr_page_table != nullptr) {
+      if (args.page_size <= 0 || args.page_size % get<1>(TileShapeQK{}) != 0) {
+        std::cerr << __FILE__ << "(" << __LINE__ << "): tma page size off\n";
+        return false;
+      }
+    }
+    if constexpr (kIsRope) {
+      if ((args.ptr_rope_cos == nullptr) != (args.ptr_rope_sin == nullptr)) {
+        std::cerr << __FILE__ << "(" << __LINE__ << "): rope needs both cos and sin tables\n";
+        return false;
+      }
+      if (args.ptr_rope_cos == nullptr && args.rope_theta <= 0.0f) {
+        std::cerr << __FILE__ << "(" << __LINE__ << "): rope theta off\n";
+        return false;
+      }
+    }
+    return true;
+  }
+
   template<class ProblemShape>
   static Params to_underlying_arguments(
       ProblemShape const& problem_shape,
@@ -105,11 +160,11 @@ struct Sm100FmhaLoadTmaWarpspecialized {
       if (cumulative_length_q != nullptr && cumulative_length_k != nullptr ) {
           get<0>(problem_shape_qk) = get<0>(problem_shape).total_length;
           get<1>(problem_shape_qk) = get<1>(problem_shape).total_length;
-          get<2>(problem_shape_qk) = get<2>(problem_shape);
+          get<2>(problem_shape_qk) = head_dim_qk(problem_shape);
           get<3>(problem_shape_qk) = get<3>(problem_shape);
       }
     } else {
-      problem_shape_qk = problem_shape;
+      problem_shape_qk = replace<2>(problem_shape, head_dim_qk(problem_shape));
     }
 
     auto params_qk = CollectiveMmaQK::to_underlying_arguments(
@@ -119,7 +174,19 @@ struct Sm100FmhaLoadTmaWarpspecialized {
             ptr_K, dK,
         }, /*workspace=*/ nullptr);
 
-    auto problem_shape_pv = select<0,2,1,3>(problem_shape_qk);
+    // for paged attention, K and V are [page_size, D, (H, page_count)] and the batch stride is the page stride
+    if (args.ptr_page_table != nullptr) {
+      get<1>(problem_shape_qk) = args.page_size;
+      get<3,1>(problem_shape_qk) = args.page_count;
+      params_qk.tma_load_b = CollectiveMmaQK::to_underlying_arguments(
+          problem_shape_qk,
+          typename CollectiveMmaQK::Arguments {
+              ptr_Q, dQ,  // never used, dummy
+              ptr_K, dK,
+          }, /*workspace=*/ nullptr).tma_load_b;
+    }
+
+    auto problem_shape_pv = select<0,2,1,3>(replace<2>(problem_shape_qk, head_dim_vo(problem_shape)));
     auto params_pv = CollectiveMmaPV::to_underlying_arguments(
         problem_shape_pv,
         typename CollectiveMmaPV::Arguments {
@@ -127,10 +194,23 @@ struct Sm100FmhaLoadTmaWarpspecialized {
             ptr_V, select<1,0,2>(dV),
         }, /*workspace=*/ nullptr);
 
+    float rope_log2_freq = 0.0f;
+    if constexpr (kIsRope) {
+      rope_log2_freq = -2.0f * std::log2(args.rope_theta) / head_dim_qk(problem_shape);
+    }
+
     return Params{
         params_qk.tma_load_a,
         params_qk.tma_load_b,
-        params_pv.tma_load_b
+        params_pv.tma_load_b,
+        args.ptr_page_table,
+        args.stride_page_table,
+        args.page_count,
+        args.page_size,
+        args.ptr_rope_cos,
+        args.ptr_rope_sin,
+        args.rope_stride,
+        rope_log2_freq
     };
   }
 
@@ -142,11 +222,56 @@ struct Sm100FmhaLoadTmaWarpspecialized {
     cute::prefetch_tma_descriptor(params.tma_load_v.get_tma_descriptor());
   }
 
+  // rotates the pairs (d, d + D/2) of the rows of a Q or K tile in smem
+  // sX is the mma partition (MMA, MMA_MN, MMA_K) of the tile and cX holds its coordinates,
+  // pairs are MMA_K/2 apart since each mma k block covers the same number of columns
+  template<class SmemTensor, class CoordTensor>
+  CUTLASS_DEVICE void
+  apply_rope(
+      SmemTensor&& sX, CoordTensor const& cX,
+      int pos_0, int pos_end, Params const& params) {
+
+    auto sX_k = group_modes<0,2>(sX);
+    auto cX_k = group_modes<0,2>(cX);
+    constexpr int kElements = decltype(size<0>(sX_k))::value;
+    constexpr int kBlocksK = decltype(size<1>(sX_k))::value;
+    static_assert(kBlocksK % 2 == 0, "rope needs an even number of mma k blocks");
+    constexpr int kHalf = kBlocksK / 2;
+
+    int lane_idx = threadIdx.x % NumThreadsPerWarp;
+    CUTLASS_PRAGMA_NO_UNROLL
+    for (int i = lane_idx; i < kElements * kHalf; i += NumThreadsPerWarp) {
+      int idx = i % kElements;
+      int k = i / kElements;
+      auto coord = cX_k(idx, k);
+      int pos = pos_0 + get<0>(coord);
+      // rows past the end of the sequence are zero filled by tma
+      if (pos >= pos_end) continue;
+      int d = get<1>(coord);
+
+      float cos_x, sin_x;
+      if (params.ptr_rope_cos != nullptr) {
+        cos_x = params.ptr_rope_cos[pos * params.rope_stride + d];
+        sin_x = params.ptr_rope_sin[pos * params.rope_stride + d];
+      }
+      else {
+        // reduce to one turn first, the fast math sincos is only accurate near zero
+        float turns = pos * exp2f(d * params.rope_log2_freq) * (0.5f / float(M_PI));
+        sincospif(2.0f * (turns - rintf(turns)), &sin_x, &cos_x);
+      }
+
+      float x0 = static_cast<float>(sX_k(idx, k));
+      float x1 = static_cast<float>(sX_k(idx, k + kHalf));
+      sX_k(idx, k) = static_cast<Element>(x0 * cos_x - x1 * sin_x);
+      sX_k(idx, k + kHalf) = static_cast<Element>(x1 * cos_x + x0 * sin_x);
+    }
+  }
+
   template<class BlkCoord, class ProblemShape, class ParamsProblemShape>
   CUTLASS_DEVICE void
   load(
       BlkCoord const& blk_coord_in, ProblemShape const& problem_shape,
-      Params const& params, ParamsProblemShape const& params_problem_shape,
+      Params const& params, Mask mask, ParamsProblemShape const& params_problem_shape,
       TensorStorage& storage,
       PipelineQ& pipeline_q, typename PipelineQ::PipelineState& pipeline_q_producer_state,
       PipelineKV& pipeline_kv, typename PipelineKV::PipelineState& pipeline_kv_producer_state) {
@@ -154,7 +279,10 @@ struct Sm100FmhaLoadTmaWarpspecialized {
     BlkCoord blk_coord_q = blk_coord_in;
     BlkCoord blk_coord_kv = blk_coord_in;
 
-    int mask_tile_count = Mask{}.get_trip_count(blk_coord_in, TileShape{}, problem_shape);
+    int mask_tile_count = mask.get_trip_count(blk_coord_in, TileShape{}, problem_shape);
+
+    // Q and K are tiled along the QK^T head dim, V along the PV one
+    auto problem_shape_qk = replace<2>(problem_shape, head_dim_qk(problem_shape));
 
     using X = Underscore;
 
@@ -167,7 +295,7 @@ struct Sm100FmhaLoadTmaWarpspecialized {
     // compute gQ, sQ
     // we load 2*get<0>(blk_coord), and 2*get<0>(blk_coord) + 1
     ThrMMA mma_qk = typename CollectiveMmaQK::TiledMma{}.get_slice(0);
-    Tensor mQ_qdl_p = params.tma_load_q.get_tma_tensor(select<0,2,3>(problem_shape));
+    Tensor mQ_qdl_p = params.tma_load_q.get_tma_tensor(select<0,2,3>(problem_shape_qk));
 
     int q_offs_0 = 0;
 
@@ -191,13 +319,20 @@ struct Sm100FmhaLoadTmaWarpspecialized {
     Tensor tQgQ = tQgQ_qdl(_, _, _0{}, get<2>(blk_coord_q));
 
     // compute gK, sK
-    Tensor mK_kdl_p = params.tma_load_k.get_tma_tensor(select<1,2,3>(problem_shape));
+    bool is_paged = params.ptr_page_table != nullptr;
+    auto problem_shape_kdl = select<1,2,3>(problem_shape_qk);
+    if (is_paged) {
+      get<0>(problem_shape_kdl) = params.page_size;
+      get<2,1>(problem_shape_kdl) = params.page_count;
+    }
+    Tensor mK_kdl_p = params.tma_load_k.get_tma_tensor(problem_shape_kdl);
 
     int kv_offs_0 = 0;
 
     if constexpr (is_variable_length_v<tuple_element_t<1, ParamsProblemShape>>) {
       auto cumulative_length = get<1>(params_problem_shape).cumulative_length;
-      if (cumulative_length != nullptr) {
+      // paged K and V are indexed through the page table of the batch instead
+      if (cumulative_length != nullptr && ! is_paged) {
         kv_offs_0 = cumulative_length[get<2,1>(blk_coord_kv)];
         get<2,1>(blk_coord_kv) = 0;
       }
@@ -216,7 +351,7 @@ struct Sm100FmhaLoadTmaWarpspecialized {
 
     // compute gV, sV
     ThrMMA mma_pv = typename CollectiveMmaPV::TiledMma{}.get_slice(0);
-    Tensor mV_dkl_p = params.tma_load_v.get_tma_tensor(select<2,1,3>(problem_shape));
+    Tensor mV_dkl_p = params.tma_load_v.get_tma_tensor(select<1,0,2>(replace<1>(problem_shape_kdl, head_dim_vo(problem_shape))));
 
     Tensor mV_dkl = domain_offset(make_coord(_0{}, kv_offs_0, make_coord(_0{}, _0{})), mV_dkl_p);
 
@@ -229,6 +364,33 @@ struct Sm100FmhaLoadTmaWarpspecialized {
     );
     auto tVgV = tVgV_dkl(_, _0{}, _, get<2>(blk_coord_kv));
 
+    // for paged attention, each K/V tile is a slice of the page that holds it
+    auto mPT_l = make_tensor(make_gmem_ptr(params.ptr_page_table),
+                             make_shape(params.page_count, get<3,1>(problem_shape)),
+                             params.stride_page_table);
+    auto mPT = mPT_l(_, get<2,1>(blk_coord_kv));
+    int tiles_per_page = is_paged ? params.page_size / get<1>(TileShapeQK{}) : 1;
+
+    auto copy_k = [&](auto const& tma_load, int k_index, int stage) {
+      if (is_paged) {
+        auto kv_coord = make_coord(get<2,0>(blk_coord_kv), mPT(k_index / tiles_per_page));
+        copy(tma_load, tKgK_kdl(_, k_index % tiles_per_page, _0{}, kv_coord), tKsK(_, stage));
+      }
+      else {
+        copy(tma_load, tKgK(_, k_index), tKsK(_, stage));
+      }
+    };
+
+    auto copy_v = [&](auto const& tma_load, int v_index, int stage) {
+      if (is_paged) {
+        auto kv_coord = make_coord(get<2,0>(blk_coord_kv), mPT(v_index / tiles_per_page));
+        copy(tma_load, tVgV_dkl(_, _0{}, v_index % tiles_per_page, kv_coord), tVsV(_, stage));
+      }
+      else {
+        copy(tma_load, tVgV(_, v_index), tVsV(_, stage));
+      }
+    };
+
     // blk_coord in decomposed in terms of TileShape, not TileShapeQK
     // As such, it needs to be transformed as
     // (a,b,c): a -> 2*a (Q0) 2*a+1 (Q1)
@@ -236,62 +398,156 @@ struct Sm100FmhaLoadTmaWarpspecialized {
 
     uint32_t lane_predicate = cute::elect_one_sync();
 
+    // with rope, tma signals the rope barriers instead of the pipelines, and once the tile is
+    // rotated in smem the load warp signals the mma warp itself through the full barrier
+    // the rotation of a tile is deferred until the next tile is issued to keep one load in flight,
+    // at most one q and one k tile wait for their rotation, so a single barrier each suffices
+    using ClusterBarrier = cutlass::arch::ClusterBarrier;
+    using ClusterTransactionBarrier = cutlass::arch::ClusterTransactionBarrier;
+
+    if constexpr (kIsRope) {
+      // the rope barriers are private to this warp, so they are set up before its first tile
+      if (pipeline_q_producer_state.count() == 0) {
+        if (lane_predicate) {
+          ClusterTransactionBarrier::init(&storage.rope_barrier_q, 1);
+          ClusterTransactionBarrier::init(&storage.rope_barrier_k, 1);
+        }
+        cutlass::arch::fence_barrier_init();
+        __syncwarp();
+      }
+    }
+
+    auto cQ = make_identity_tensor(select<0,2>(TileShapeQK{}));
+    auto tScQ = mma_qk.partition_A(cQ);
+    auto cK = make_identity_tensor(select<1,2>(TileShapeQK{}));
+    auto tScK = mma_qk.partition_B(cK);
+
+    auto load_q = [&](int q_index, auto state) {
+      if constexpr (kIsRope) {
+        // the arrival on the full barrier has to wait for the rotation
+        while (pipeline_q.producer_try_acquire(state) != BarrierStatus::WaitDone) {}
+        if (lane_predicate) {
+          auto tma_barrier = &storage.rope_barrier_q;
+          ClusterTransactionBarrier::arrive_and_expect_tx(tma_barrier, TransactionBytesLoadQ);
+          copy(params.tma_load_q.with(*tma_barrier, 0), tQgQ(_, q_index), tQsQ(_, state.index()));
+        }
+      }
+      else {
+        pipeline_q.producer_acquire(state);
+        if (lane_predicate) {
+          auto tma_barrier = pipeline_q.producer_get_barrier(state);
+          copy(params.tma_load_q.with(*tma_barrier, 0), tQgQ(_, q_index), tQsQ(_, state.index()));
+        }
+      }
+    };
+
+    auto load_k = [&](int k_index, auto state) {
+      if constexpr (kIsRope) {
+        while (pipeline_kv.producer_try_acquire(state) != BarrierStatus::WaitDone) {}
+        if (lane_predicate) {
+          auto tma_barrier = &storage.rope_barrier_k;
+          ClusterTransactionBarrier::arrive_and_expect_tx(tma_barrier, TransactionBytesLoadK);
+          copy_k(params.tma_load_k.with(*tma_barrier, 0), k_index, state.index());
+        }
+      }
+      else {
+        pipeline_kv.producer_acquire(state);
+        if constexpr (TransactionBytesLoadK != TransactionBytesLoadKV) {
+          pipeline_kv.producer_expect_transaction(state, TransactionBytesLoadK - TransactionBytesLoadKV);
+        }
+        if (lane_predicate) {
+          auto tma_barrier = pipeline_kv.producer_get_barrier(state);
+          copy_k(params.tma_load_k.with(*tma_barrier, 0), k_index, state.index());
+        }
+      }
+    };
+
+    auto load_v = [&](int v_index, auto state) {
+      pipeline_kv.producer_acquire(state);
+      if constexpr (TransactionBytesLoadV != TransactionBytesLoadKV) {
+        pipeline_kv.producer_expect_transaction(state, TransactionBytesLoadV - TransactionBytesLoadKV);
+      }
+      if (lane_predicate) {
+        auto tma_barrier = pipeline_kv.producer_get_barrier(state);
+        copy_v(params.tma_load_v.with(*tma_barrier, 0), v_index, state.index());
+      }
+    };
+
+    auto rope_q = [&](int q_index, auto state) {
+      if constexpr (kIsRope) {
+        // every q load goes through the rope barrier
+        ClusterTransactionBarrier::wait(&storage.rope_barrier_q, state.count() % 2);
+        apply_rope(sQ(_, _, _, state.index()), tScQ,
+            q_index * get<0>(TileShapeQK{}), get<0>(problem_shape), params);
+        // the rotated tile is read by the tensor cores
+        cutlass::arch::fence_view_async_shared();
+        __syncwarp();
+        if (lane_predicate) {
+          ClusterBarrier::arrive(pipeline_q.producer_get_barrier(state));
+        }
+      }
+    };
+
+    auto rope_k = [&](int k_index, auto state) {
+      if constexpr (kIsRope) {
+        // k and v loads alternate, so every other kv load goes through the rope barrier
+        ClusterTransactionBarrier::wait(&storage.rope_barrier_k, (state.count() / 2) % 2);
+        apply_rope(sK(_, _, _, state.index()), tScK,
+            k_index * get<1>(TileShapeQK{}), get<1>(problem_shape), params);
+        cutlass::arch::fence_view_async_shared();
+        __syncwarp();
+        if (lane_predicate) {
+          ClusterBarrier::arrive(pipeline_kv.producer_get_barrier(state));
+        }
+      }
+    };
+
     // Q1
     int q0_index = 2 * get<0>(blk_coord_q);
     int q1_index = 2 * get<0>(blk_coord_q) + 1;
-    pipeline_q.producer_acquire(pipeline_q_producer_state);
-    if (lane_predicate) {
-      auto tma_barrier = pipeline_q.producer_get_barrier(pipeline_q_producer_state);
-      copy(params.tma_load_q.with(*tma_barrier, 0), tQgQ(_, q0_index), tQsQ(_, pipeline_q_producer_state.index()));
-    }
+    auto q0_state = pipeline_q_producer_state;
+    load_q(q0_index, q0_state);
     ++pipeline_q_producer_state;
 
     // K1
-    int k_index = 0;
-    pipeline_kv.producer_acquire(pipeline_kv_producer_state);
-    if (lane_predicate) {
-      auto tma_barrier = pipeline_kv.producer_get_barrier(pipeline_kv_producer_state);
-      copy(params.tma_load_k.with(*tma_barrier, 0), tKgK(_, k_index), tKsK(_, pipeline_kv_producer_state.index()));
-    }
+    // the mask may skip kv tiles, so the tile of each iteration is looked up
+    int k_iteration = 0;
+    int k_index = mask.get_kv_tile_index(blk_coord_in, TileShape{}, problem_shape, k_iteration);
+    auto k_state = pipeline_kv_producer_state;
+    load_k(k_index, k_state);
     ++pipeline_kv_producer_state;
 
+    rope_q(q0_index, q0_state);
+
     // Q2
-    pipeline_q.producer_acquire(pipeline_q_producer_state);
-    if (lane_predicate) {
-      auto tma_barrier = pipeline_q.producer_get_barrier(pipeline_q_producer_state);
-      copy(params.tma_load_q.with(*tma_barrier, 0), tQgQ(_, q1_index), tQsQ(_, pipeline_q_producer_state.index()));
-    }
+    auto q1_state = pipeline_q_producer_state;
+    load_q(q1_index, q1_state);
     ++pipeline_q_producer_state;
 
+    rope_k(k_index, k_state);
+
     // V1
-    pipeline_kv.producer_acquire(pipeline_kv_producer_state);
-    if (lane_predicate) {
-      auto tma_barrier = pipeline_kv.producer_get_barrier(pipeline_kv_producer_state);
-      copy(params.tma_load_v.with(*tma_barrier, 0), tVgV(_, k_index), tVsV(_, pipeline_kv_producer_state.index()));
-    }
+    load_v(k_index, pipeline_kv_producer_state);
     ++pipeline_kv_producer_state;
-    k_index += 1;
+
+    rope_q(q1_index, q1_state);
 
     // loop:
     mask_tile_count -= 1;
     for (; mask_tile_count > 0; mask_tile_count -= 1) {
+      k_iteration += 1;
+      k_index = mask.get_kv_tile_index(blk_coord_in, TileShape{}, problem_shape, k_iteration);
 
       // Ki
-      pipeline_kv.producer_acquire(pipeline_kv_producer_state);
-      if (lane_predicate) {
-        auto tma_barrier = pipeline_kv.producer_get_barrier(pipeline_kv_producer_state);
-        copy(params.tma_load_k.with(*tma_barrier, 0), tKgK(_, k_index), tKsK(_, pipeline_kv_producer_state.index()));
-      }
+      k_state = pipeline_kv_producer_state;
+      load_k(k_index, k_state);
       ++pipeline_kv_producer_state;
 
       // Vi
-      pipeline_kv.producer_acquire(pipeline_kv_producer_state);
-      if (lane_predicate) {
-        auto tma_barrier = pipeline_kv.producer_get_barrier(pipeline_kv_producer_state);
-        copy(params.tma_load_v.with(*tma_barrier, 0), tVgV(_, k_index), tVsV(_, pipeline_kv_producer_state.index()));
-      }
+      load_v(k_index, pipeline_kv_producer_state);
       ++pipeline_kv_producer_state;
-      k_index += 1;
+
+      rope_k(k_index, k_state);
     }
   }
 };
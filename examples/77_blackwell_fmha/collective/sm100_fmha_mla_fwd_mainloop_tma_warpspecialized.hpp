@@ -194,6 +194,8 @@ struct Sm100MlaFwdMainloopTmaWarpspecialized {
   static constexpr int TransactionBytesLoadQ = cutlass::bits_to_bytes(cosize(take<0,3>(SmemLayoutQ{})) * cute::sizeof_bits_v<Element>);
   static constexpr int TransactionBytesLoadK = cutlass::bits_to_bytes(cosize(take<0,3>(SmemLayoutK{})) * cute::sizeof_bits_v<Element>);
   static constexpr int TransactionBytesLoadV = cutlass::bits_to_bytes(cosize(take<0,3>(SmemLayoutV{})) * cute::sizeof_bits_v<Element>);
+  // the load acquires V stages with their own byte count
+  static constexpr int TransactionBytesLoadKV = TransactionBytesLoadK;
 
   using Load = Sm100MlaFwdLoadTmaWarpspecialized<
     Element, StrideQ, StrideK, StrideV,
@@ -123,6 +123,20 @@ public:
     ElementAccumulator softmax_scale;
 
     cutlass::KernelHardwareInfo hw_info;
+
+    // computes sum_OdO inside the backward kernel rather than in a separate pass over O and dO
+    bool fuse_sum_OdO = false;
+
+    // dequantization scales of FP8 inputs, and the scale dS is multiplied by before it is quantized
+    ElementAccumulator scale_q = 1.0f;
+    ElementAccumulator scale_k = 1.0f;
+    ElementAccumulator scale_v = 1.0f;
+    ElementAccumulator scale_o = 1.0f;
+    ElementAccumulator scale_do = 1.0f;
+    ElementAccumulator scale_ds = 1.0f;
+
+    // runtime state of the mask and the score modifications, e.g. the softcap
+    Mask mask = {};
   };
 
   using OperationSumOdO = cutlass::fmha::device::FMHA<
@@ -132,9 +146,17 @@ public:
     cutlass::fmha::kernel::FmhaKernelBwdConvert<ProblemShape, Element, ElementAccumulator>
   >;
 
+  // causal tiles differ in length, so they are scheduled persistently and longest first
+  static constexpr bool kIsCausal =
+      std::is_base_of_v<cutlass::fmha::collective::CausalMask<true>, Mask> ||
+      std::is_base_of_v<cutlass::fmha::collective::CausalMask<false>, Mask>;
+  using TileSchedulerNormal = std::conditional_t<kIsCausal,
+      cutlass::fmha::kernel::CausalPersistentBwdTileScheduler,
+      cutlass::fmha::kernel::IndividualBwdTileScheduler>;
+
   using OperationNormal= cutlass::fmha::device::FMHA<
       cutlass::fmha::kernel::Sm100FmhaBwdKernelTmaWarpSpecialized<
-          ProblemShape, Element, ElementAccumulator, TileShape, Mask
+          ProblemShape, Element, ElementAccumulator, TileShape, Mask, TileSchedulerNormal
       >
   >;
 
@@ -155,6 +177,7 @@ public:
     OperationConvert op_convert;
     ElementAccumulator* dQ_acc;
     size_t dQ_acc_size;
+    bool fuse_sum_OdO;
   };
 
 private:
@@ -180,7 +203,7 @@ private:
       sum_odo, stride_sum_OdO,
       args.ptr_LSE, args.stride_LSE,
       scaled_lse, stride_scaled_lse,
-      -1.0f, -log2_e
+      -args.scale_o * args.scale_do * args.scale_ds, -log2_e
     };
   }
 
@@ -200,7 +223,7 @@ private:
       args.ptr_dQ, args.stride_dQ,
       nullptr, args.stride_dK,
       nullptr, args.stride_dV,
-      args.softmax_scale
+      args.softmax_scale * args.scale_k / args.scale_ds
     };
   }
 
@@ -210,7 +233,7 @@ private:
       ElementAccumulator* scaled_lse = nullptr, cute::tuple<cute::_1, cute::tuple<cute::tuple<int, int>, int>> const& stride_scaled_lse = {},
       ElementAccumulator* dQ_acc = nullptr, cute::tuple<int, cute::_1, cute::tuple<cute::tuple<int, int>, int>> const& stride_dQ = {}) {
 
-    return typename Operation::Arguments{
+    typename Operation::Arguments arguments{
       to_bwd_shape(args.problem_shape),
       { args.ptr_Q,  to_bwd_stride(args.stride_Q),
         args.ptr_K,  to_bwd_stride(args.stride_K),
@@ -224,6 +247,29 @@ private:
         args.ptr_dV, to_bwd_stride(args.stride_dV) },
       args.hw_info
     };
+
+    if constexpr (! IsMla) {
+      if (args.fuse_sum_OdO) {
+        // the kernel reads O and the unscaled LSE directly
+        arguments.mainloop.ptr_o = args.ptr_O;
+        arguments.mainloop.stride_o = args.stride_O;
+        arguments.mainloop.ptr_lse = args.ptr_LSE;
+        arguments.mainloop.stride_lse = args.stride_LSE;
+      }
+      arguments.mainloop.scale_q = args.scale_q;
+      arguments.mainloop.scale_k = args.scale_k;
+      arguments.mainloop.scale_v = args.scale_v;
+      arguments.mainloop.scale_o = args.scale_o;
+      arguments.mainloop.scale_do = args.scale_do;
+      arguments.mainloop.scale_ds = args.scale_ds;
+      arguments.mainloop.mask = args.mask;
+    }
+    else {
+      static_assert(! cutlass::fmha::collective::has_score_mod_v<Mask>, "Score modifications are not supported for MLA");
+      static_assert(! cutlass::fmha::collective::has_dropout_v<Mask>, "Dropout is not supported for MLA");
+    }
+
+    return arguments;
   }
 
 public:
@@ -233,9 +279,20 @@ public:
   can_implement(Arguments const& args) {
     Status status = Status::kSuccess;
 
-    status = OperationSumOdO::can_implement(to_sum_OdO_arguments(args));
-    if (status != Status::kSuccess) {
-      return status;
+    if constexpr (IsMla) {
+      bool is_scaled = args.scale_q != 1.0f || args.scale_k != 1.0f || args.scale_v != 1.0f ||
+                       args.scale_o != 1.0f || args.scale_do != 1.0f || args.scale_ds != 1.0f;
+      if (args.fuse_sum_OdO || is_scaled) {
+        CUTLASS_TRACE_HOST("  CAN IMPLEMENT: fused sum_OdO and FP8 scales are not supported by the MLA kernel.");
+        return Status::kErrorNotSupported;
+      }
+    }
+
+    if (! args.fuse_sum_OdO) {
+      status = OperationSumOdO::can_implement(to_sum_OdO_arguments(args));
+      if (status != Status::kSuccess) {
+        return status;
+      }
     }
 
     status = OperationConvert::can_implement(to_convert_arguments(args));
@@ -259,10 +316,12 @@ public:
     D = cutlass::round_up(D, 8);  // Alignment
     int Q = cutlass::round_up(static_cast<int>(Q_), 8);  // Alignment
     size_t workspace_bytes = 0;
-    // OdO vector
-    workspace_bytes += B*H*Q * sizeof(ElementAccumulator);
-    // scaled LSE vector
-    workspace_bytes += B*H*Q * sizeof(ElementAccumulator);
+    if (! args.fuse_sum_OdO) {
+      // OdO vector
+      workspace_bytes += B*H*Q * sizeof(ElementAccumulator);
+      // scaled LSE vector
+      workspace_bytes += B*H*Q * sizeof(ElementAccumulator);
+    }
     // FP32 versions of outputs that are churned (start off with Q only)
     workspace_bytes += B*H*Q*D * sizeof(ElementAccumulator);
     return workspace_bytes;
@@ -283,9 +342,12 @@ public:
     ElementAccumulator* dQ_acc = reinterpret_cast<ElementAccumulator*>(workspace_dQ);
     params_.dQ_acc = dQ_acc;
     params_.dQ_acc_size = B*H*Q*D * sizeof(ElementAccumulator);
+    params_.fuse_sum_OdO = args.fuse_sum_OdO;
     auto args_sum_OdO = to_sum_OdO_arguments(args, sum_OdO, scaled_lse);
     auto args_convert = to_convert_arguments(args, dQ_acc);
-    params_.op_sum_OdO.initialize(args_sum_OdO, nullptr, stream);
+    if (! args.fuse_sum_OdO) {
+      params_.op_sum_OdO.initialize(args_sum_OdO, nullptr, stream);
+    }
     params_.op_convert.initialize(args_convert, nullptr, stream);
     auto args_bwd = to_bwd_arguments(
         args, sum_OdO, args_sum_OdO.stride_sum_OdO,
@@ -308,10 +370,14 @@ public:
     D = cutlass::round_up(D, 8);  // Alignment
     int Q = cutlass::round_up(static_cast<int>(Q_), 8);  // Alignment
     char* workspace_chr = reinterpret_cast<char*>(workspace);
-    ElementAccumulator* sum_OdO = reinterpret_cast<ElementAccumulator*>(workspace_chr);
-    workspace_chr += B*H*Q * sizeof(ElementAccumulator);
-    ElementAccumulator* scaled_lse = reinterpret_cast<ElementAccumulator*>(workspace_chr);
-    workspace_chr += B*H*Q * sizeof(ElementAccumulator);
+    ElementAccumulator* sum_OdO = nullptr;
+    ElementAccumulator* scaled_lse = nullptr;
+    if (! args.fuse_sum_OdO) {
+      sum_OdO = reinterpret_cast<ElementAccumulator*>(workspace_chr);
+      workspace_chr += B*H*Q * sizeof(ElementAccumulator);
+      scaled_lse = reinterpret_cast<ElementAccumulator*>(workspace_chr);
+      workspace_chr += B*H*Q * sizeof(ElementAccumulator);
+    }
     ElementAccumulator* dQ_acc = reinterpret_cast<ElementAccumulator*>(workspace_chr);
     return initialize_split(args, dQ_acc, sum_OdO, scaled_lse, stream);
   }
@@ -323,9 +389,11 @@ public:
     CUTLASS_TRACE_HOST("FmhaDeviceBwd::run()");
 
     Status result = Status::kSuccess;
-    result = params.op_sum_OdO.run(stream);
-    if (result != Status::kSuccess) {
-      return result;
+    if (! params.fuse_sum_OdO) {
+      result = params.op_sum_OdO.run(stream);
+      if (result != Status::kSuccess) {
+        return result;
+      }
     }
 
     auto cuda_result = cudaMemsetAsync(params.dQ_acc, 0, params.dQ_acc_size, stream);
@@ -194,4 +194,85 @@ struct CausalPersistentTileScheduler {
 };
 ////////////////////////////////////////////////////////////////////////////////
 
+// Backward pass over (KV tile, KV head, batch). Under a causal mask a KV tile sees
+// fewer Q tiles the further it is along the sequence, so the persistent CTAs take
+// the tiles longest processing time first: KV tile outermost in ascending order,
+// then batch, then head. The short tiles are left to fill the last wave.
+// Launch order: H B K
+struct CausalPersistentBwdTileScheduler {
+
+  struct Params {
+    int num_blocks;
+    FastDivmod divmod_h;
+    FastDivmod divmod_b;
+
+    KernelHardwareInfo hw_info;
+  };
+
+  int block_idx = 0;
+  Params params;
+
+  CUTLASS_DEVICE
+  CausalPersistentBwdTileScheduler(Params const& params) : block_idx(blockIdx.x), params(params) {}
+
+  template<class ProblemShape, class TileShape>
+  static Params to_underlying_arguments(
+      ProblemShape const& problem_shape, KernelHardwareInfo hw_info,
+      TileShape const& tile_shape) {
+    using namespace cute;
+    // Get SM count if needed, otherwise use user supplied SM count
+    int sm_count = hw_info.sm_count;
+    if (sm_count <= 0) {
+      CUTLASS_TRACE_HOST("  WARNING: Arguments do not include a valid SM count.\n"
+          "  For optimal performance, populate the arguments KernelHardwareInfo struct with the SM count.");
+      sm_count = KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+    }
+
+    CUTLASS_TRACE_HOST("to_underlying_arguments(): Setting persistent grid SM count to " << sm_count);
+    hw_info.sm_count = sm_count;
+
+    auto [Q, K, D, D_VO, HB] = problem_shape;
+    auto [H, B] = HB;
+    auto [H_R, H_K] = H;
+    int num_k_blocks = ceil_div(int(K), size<1>(tile_shape));
+    int num_blocks = num_k_blocks * H_K * B;
+
+    return Params {
+      num_blocks,
+      { H_K }, { B },
+      hw_info
+    };
+  }
+
+  static dim3 get_grid_shape(Params const& params) {
+    dim3 grid(std::min(params.num_blocks, params.hw_info.sm_count), 1, 1);
+    return grid;
+  }
+
+  CUTLASS_DEVICE
+  bool is_valid() {
+    return block_idx < params.num_blocks;
+  }
+
+  // (KV tile, KV head, batch)
+  CUTLASS_DEVICE
+  auto get_block_coord() {
+    using namespace cute;
+    int block_decode = block_idx;
+    int k_block, bidb, bidh;
+    params.divmod_h(block_decode, bidh, block_decode);
+    params.divmod_b(block_decode, bidb, block_decode);
+    k_block = block_decode;
+    return make_coord(k_block, bidh, bidb);
+  }
+
+  CUTLASS_DEVICE
+  CausalPersistentBwdTileScheduler& operator++() {
+    block_idx += gridDim.x;
+    return *this;
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
 }  // namespace cutlass::fmha::kernel
@@ -0,0 +1,198 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cute/layout.hpp"
+
+namespace cutlass::fmha::kernel {
+
+using namespace cute;
+
+// Merges a partial attention result (O_p, LSE_p), e.g. the one of a KV shard in ring or
+// context parallel attention, in place into the accumulated (O, LSE):
+//   LSE' = log(exp(LSE) + exp(LSE_p))
+//   O'   = exp(LSE - LSE') * O + exp(LSE_p - LSE') * O_p
+// ProblemShape is the one of the forward kernel, Q K D ((H_R, H_K), B).
+template<class ProblemShape, class Element, class ElementAcc>
+struct FmhaKernelLseMerge {
+
+  using StrideO = cute::tuple<int, cute::_1, cute::tuple<cute::tuple<int, int>, int>>;
+  using StrideLSE = cute::tuple<cute::_1, cute::tuple<cute::tuple<int, int>, int>>;
+
+  struct Arguments {
+    ProblemShape problem_shape;
+
+    // accumulated result, updated in place
+    Element* ptr_O;
+    StrideO stride_O;
+    ElementAcc* ptr_LSE;
+    StrideLSE stride_LSE;
+
+    // partial result merged into it
+    const Element* ptr_O_partial;
+    StrideO stride_O_partial;
+    const ElementAcc* ptr_LSE_partial;
+    StrideLSE stride_LSE_partial;
+  };
+
+  using Params = Arguments;
+
+  using ClusterShape = Shape<_1, _1, _1>;
+  static constexpr int SharedStorageSize = 0;
+
+  static const int MinBlocksPerMultiprocessor = 1;
+  static const int MaxThreadsPerBlock = 128;
+  using ArchTag = cutlass::arch::Sm100;
+
+  static size_t get_workspace_size(Arguments const& args) { return 0; }
+  static cutlass::Status initialize_workspace(Arguments const&, void*, cudaStream_t) {
+    return cutlass::Status::kSuccess;
+  }
+
+  static const int kBlockQ = 16;
+
+  static const int kNumThreadsD = 8;
+  static const int kNumThreadsQ = MaxThreadsPerBlock / kNumThreadsD;
+  static const int kElementsPerLoad = 2;
+
+  // MLA carries (D_latent, D_rope) in mode 2, O has the latent head dim
+  CUTLASS_HOST_DEVICE
+  static int head_dim_vo(ProblemShape const& problem_shape) {
+    if constexpr (rank_v<decltype(get<2>(problem_shape))> == 2) {
+      return get<2,0>(problem_shape);
+    }
+    else {
+      return get<2>(problem_shape);
+    }
+  }
+
+  static bool can_implement(Arguments const& args) {
+    return head_dim_vo(args.problem_shape) % kElementsPerLoad == 0;
+  }
+
+  static dim3 get_grid_shape(Params const& params) {
+    dim3 grid(ceil_div(size<0>(params.problem_shape), kBlockQ), size<3,0>(params.problem_shape), size<3,1>(params.problem_shape));
+    return grid;
+  }
+
+  static dim3 get_block_shape() {
+    dim3 block(kNumThreadsD, kNumThreadsQ, 1);
+    return block;
+  }
+
+  static Params to_underlying_arguments(Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  CUTLASS_DEVICE void operator()(const Params &params, char* smem) {
+    int idx_h_r = blockIdx.y % size<3,0,0>(params.problem_shape);
+    int idx_h_k = blockIdx.y / size<3,0,0>(params.problem_shape);
+
+    auto offset_h = [&](auto const& stride) {
+      return idx_h_r * get<0,0>(stride) + idx_h_k * get<0,1>(stride) + blockIdx.z * get<1>(stride);
+    };
+
+    auto ptr_O_bh = params.ptr_O + offset_h(get<2>(params.stride_O));
+    auto ptr_LSE_bh = params.ptr_LSE + offset_h(get<1>(params.stride_LSE));
+    auto ptr_O_partial_bh = params.ptr_O_partial + offset_h(get<2>(params.stride_O_partial));
+    auto ptr_LSE_partial_bh = params.ptr_LSE_partial + offset_h(get<1>(params.stride_LSE_partial));
+
+    auto problem_q = get<0>(params.problem_shape);
+    int seqlen_q = problem_q;
+    if constexpr (is_variable_length_v<decltype(problem_q)>) {
+      int offset = problem_q.cumulative_length[blockIdx.z];
+      ptr_O_bh += offset * get<0>(params.stride_O);
+      ptr_LSE_bh += offset * get<0>(params.stride_LSE);
+      ptr_O_partial_bh += offset * get<0>(params.stride_O_partial);
+      ptr_LSE_partial_bh += offset * get<0>(params.stride_LSE_partial);
+      seqlen_q = problem_q.cumulative_length[blockIdx.z + 1] - offset;
+    }
+
+    int head_dim = head_dim_vo(params.problem_shape);
+
+    // the threads of a row are in the same warp, and share whether the row is valid
+    int lane_idx = (threadIdx.y * kNumThreadsD + threadIdx.x) % NumThreadsPerWarp;
+    uint32_t row_mask = ((1u << kNumThreadsD) - 1) << (lane_idx / kNumThreadsD * kNumThreadsD);
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int idx_q_t = threadIdx.y; idx_q_t < kBlockQ; idx_q_t += kNumThreadsQ) {
+      int idx_q = idx_q_t + kBlockQ * blockIdx.x;
+      if (idx_q >= seqlen_q) continue;
+      auto ptr_O_bhq = ptr_O_bh + idx_q * get<0>(params.stride_O);
+      auto ptr_LSE_bhq = ptr_LSE_bh + idx_q * get<0>(params.stride_LSE);
+      auto ptr_O_partial_bhq = ptr_O_partial_bh + idx_q * get<0>(params.stride_O_partial);
+      auto ptr_LSE_partial_bhq = ptr_LSE_partial_bh + idx_q * get<0>(params.stride_LSE_partial);
+
+      ElementAcc lse = *ptr_LSE_bhq;
+      ElementAcc lse_partial = *ptr_LSE_partial_bhq;
+      ElementAcc lse_max = cutlass::fast_max(lse, lse_partial);
+
+      // both empty, e.g. fully masked rows, the merge is empty as well
+      ElementAcc scale = 0;
+      ElementAcc scale_partial = 0;
+      if (lse_max != -INFINITY) {
+        ElementAcc weight = ::expf(lse - lse_max);
+        ElementAcc weight_partial = ::expf(lse_partial - lse_max);
+        ElementAcc sum = weight + weight_partial;
+        lse = lse_max + ::logf(sum);
+        scale = weight / sum;
+        scale_partial = weight_partial / sum;
+      }
+
+      // every thread of the row has read the old LSE before it is overwritten
+      __syncwarp(row_mask);
+
+      for (int idx_d = threadIdx.x * kElementsPerLoad; idx_d < head_dim; idx_d += kElementsPerLoad * kNumThreadsD) {
+        Element value_O[kElementsPerLoad];
+        Element value_O_partial[kElementsPerLoad];
+
+        using Vec = uint_bit_t<sizeof_bits_v<Element> * kElementsPerLoad>;
+        *reinterpret_cast<Vec*>(value_O) = *reinterpret_cast<const Vec*>(&ptr_O_bhq[idx_d]);
+        *reinterpret_cast<Vec*>(value_O_partial) = *reinterpret_cast<const Vec*>(&ptr_O_partial_bhq[idx_d]);
+
+        for (int v = 0; v < kElementsPerLoad; v++) {
+          value_O[v] = static_cast<Element>(scale * static_cast<ElementAcc>(value_O[v]) + scale_partial * static_cast<ElementAcc>(value_O_partial[v]));
+        }
+
+        *reinterpret_cast<Vec*>(&ptr_O_bhq[idx_d]) = *reinterpret_cast<const Vec*>(value_O);
+      }
+
+      if (threadIdx.x == 0) {
+        *ptr_LSE_bhq = lse;
+      }
+    }
+  }
+};
+
+}  // namespace cutlass::fmha::kernel
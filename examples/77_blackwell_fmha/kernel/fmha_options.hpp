@@ -73,7 +73,9 @@ enum class Tag {
   kBlocksPerSM,
   kClusterM,
 
-  kAccQK
+  kAccQK,
+
+  kIsRope
 };
 
 template<auto kTag, class Value>
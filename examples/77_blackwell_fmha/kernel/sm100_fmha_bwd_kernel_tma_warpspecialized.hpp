@@ -42,6 +42,8 @@
 #include "cutlass/gemm/collective/collective_builder.hpp"
 
 #include "collective/fmha_common.hpp"
+#include "kernel/fmha_tile_scheduler.hpp"
+#include "kernel/fmha_causal_tile_scheduler.hpp"
 
 #include <cmath>
 
@@ -56,7 +58,8 @@ template<
     class Element,
     class ElementAcc,
     class TileShape,
-    class Mask
+    class Mask,
+    class TileScheduler = IndividualBwdTileScheduler
 >
 struct Sm100FmhaBwdKernelTmaWarpSpecialized {
 
@@ -65,7 +68,8 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
   using TileShapeK = decltype(get<1>(TileShape{}));
   static_assert(std::is_same_v<TileShapeK, _128>, "tile shape K must be 128");
   using TileShapeDQK = decltype(get<2>(TileShape{}));
-  using TileShapeDVO = decltype(get<2>(TileShape{}));
+  // the tile is (Q, K, D_QK, D_VO), or (Q, K, D) if both head dims agree
+  using TileShapeDVO = decltype(get<rank_v<TileShape> - 1>(TileShape{}));
 
   using TmemAllocator = cute::TMEM::Allocator1Sm;
   struct TmemAllocation {
@@ -84,12 +88,14 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
   );
 
   enum class WarpRole {
-    Empty = 0x0, Load = 0x1, Mma = 0x2, Compute = 0x3, Reduce = 0x4
+    Empty = 0x0, Load = 0x1, Mma = 0x2, Compute = 0x3, Reduce = 0x4, SumOdO = 0x5
   };
 
-  static constexpr unsigned long long kWarpAssignment = 0x12'3333'3333'4444ull;
+  // the SumOdO warps are only active when sum_OdO is computed in-kernel (see MainloopArguments::ptr_o)
+  static constexpr unsigned long long kWarpAssignment = 0x5512'3333'3333'4444ull;
   static constexpr int kNumComputeWarps = 8;
   static constexpr int kNumReduceWarps = 4;
+  static constexpr int kNumSumOdOWarps = 2;
   CUTLASS_DEVICE WarpRole warp_idx_to_role(int warp_idx) {
     return static_cast<WarpRole>((kWarpAssignment >> (4 * warp_idx)) & 0xF);
   }
@@ -103,6 +109,7 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
     static constexpr int kMma = kWarpgroup2;
     static constexpr int kEmpty = kWarpgroup2;
     static constexpr int kLoad = kWarpgroup2;
+    static constexpr int kSumOdO = kWarpgroup2;
 
     static_assert(kWarpgroup0 + 2 * kWarpgroup1 + kWarpgroup2 <= 512);
   };
@@ -303,6 +310,24 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
     TensorStride stride_dq_acc;
 
     ElementAcc softmax_scale = 1.0f / sqrtf(TileShapeDQK{});
+
+    // if set, the SumOdO warps compute sum_OdO from O and dO and scale the raw LSE in ptr_lse,
+    // instead of reading both from the output of FmhaKernelBwdSumOdO
+    const Element* ptr_o = nullptr;
+    TensorStride stride_o = {};
+
+    // dequantization scales of the (FP8) inputs, and the scale dS is multiplied by before
+    // it is quantized to Element; a precomputed ptr_sum_odo must already carry
+    // -scale_o * scale_do * scale_ds, and dQ_acc is returned without scale_k / scale_ds
+    ElementAcc scale_q = 1.0f;
+    ElementAcc scale_k = 1.0f;
+    ElementAcc scale_v = 1.0f;
+    ElementAcc scale_o = 1.0f;
+    ElementAcc scale_do = 1.0f;
+    ElementAcc scale_ds = 1.0f;
+
+    // runtime state of the mask and the score modifications, e.g. the softcap
+    Mask mask = {};
   };
 
   using TMA_K = typename CollectiveMmaKQ::Params::TMA_A;
@@ -343,6 +368,7 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
     MainloopParams mainloop_params;
     EpilogueArguments epilogue;
     KernelHardwareInfo hw_info;
+    typename TileScheduler::Params tile_scheduler;
   };
 
 
@@ -408,7 +434,8 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
         tma_red_dq
       },
       args.epilogue,
-      args.hw_info
+      args.hw_info,
+      TileScheduler::to_underlying_arguments(args.problem_shape, args.hw_info, TileShape{})
     };
   }
 
@@ -503,6 +530,12 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
 
     auto [blk_coord_q, blk_coord_k, blk_coord_d, blk_coord_dv, blk_coord_batch] = blk_coord;
 
+    // K is read by the mma of the previous tile until it releases its last Q stage,
+    // so with a persistent scheduler both Q stages must drain before K is reloaded
+    auto pipeline_load_mma_q_last_state = pipeline_load_mma_q_producer_state;
+    ++pipeline_load_mma_q_last_state;
+    while (pipeline_load_mma_q.producer_try_acquire(pipeline_load_mma_q_last_state) != BarrierStatus::WaitDone) { }
+
     pipeline_load_mma_q.producer_acquire(pipeline_load_mma_q_producer_state);
     auto tma_barrier = pipeline_load_mma_q.producer_get_barrier(pipeline_load_mma_q_producer_state);
 
@@ -528,26 +561,33 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
 
     ++pipeline_load_mma_q_producer_state;
 
-    pipeline_load_compute_lse.producer_acquire(pipeline_load_compute_lse_producer_state);
+    // LSE and sum_OdO are produced by the SumOdO warps instead
+    bool is_sum_odo_fused = mainloop_args.ptr_o != nullptr;
 
     // load LSE
     // 32 threads loading 128 values of 32b each
     // so 4*32b=128b
 
     int thread_idx = threadIdx.x % NumThreadsPerWarp;
-    int smem_idx = TileShapeQ{} * pipeline_load_compute_lse_producer_state.index() + thread_idx * 4;
-    int gmem_idx = TileShapeQ{} * iter_index + thread_idx * 4;
+    int smem_idx = 0;
+    int gmem_idx = 0;
     auto mLSE = make_tensor(mainloop_args.ptr_lse, make_shape(Q, HB), mainloop_args.stride_lse);
-    for (int i = 0; i < 4; i++) {
-      cutlass::arch::cp_async_zfill<4>(
-          shared_tensors.smem_lse.begin() + smem_idx + i,
-          &mLSE(gmem_idx + i, blk_coord_batch),
-          gmem_idx + i < Q
-      );
-    }
+    if (! is_sum_odo_fused) {
+      pipeline_load_compute_lse.producer_acquire(pipeline_load_compute_lse_producer_state);
+
+      smem_idx = TileShapeQ{} * pipeline_load_compute_lse_producer_state.index() + thread_idx * 4;
+      gmem_idx = TileShapeQ{} * iter_index + thread_idx * 4;
+      for (int i = 0; i < 4; i++) {
+        cutlass::arch::cp_async_zfill<4>(
+            shared_tensors.smem_lse.begin() + smem_idx + i,
+            &mLSE(gmem_idx + i, blk_coord_batch),
+            gmem_idx + i < Q
+        );
+      }
 
-    pipeline_load_compute_lse.producer_commit(pipeline_load_compute_lse_producer_state, cutlass::arch::cpasync_barrier_arrive);
-    ++pipeline_load_compute_lse_producer_state;
+      pipeline_load_compute_lse.producer_commit(pipeline_load_compute_lse_producer_state, cutlass::arch::cpasync_barrier_arrive);
+      ++pipeline_load_compute_lse_producer_state;
+    }
 
 
     pipeline_load_mma_do.producer_acquire(pipeline_load_mma_do_producer_state);
@@ -575,22 +615,24 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
 
     ++pipeline_load_mma_do_producer_state;
 
-    pipeline_load_compute_sum_odo.producer_acquire(pipeline_load_compute_sum_odo_producer_state);
-
     // load sum_OdO
-    smem_idx = TileShapeQ{} * pipeline_load_compute_sum_odo_producer_state.index() + thread_idx * 4;
-    gmem_idx = TileShapeQ{} * iter_index + thread_idx * 4;
     auto mSumOdO = make_tensor(mainloop_args.ptr_sum_odo, make_shape(Q, HB), mainloop_args.stride_sum_odo);
-    for (int i = 0; i < 4; i++) {
-      cutlass::arch::cp_async_zfill<4>(
-          shared_tensors.smem_sum_odo.begin() + smem_idx + i,
-          &mSumOdO(gmem_idx + i, blk_coord_batch),
-          gmem_idx + i < Q
-      );
-    }
+    if (! is_sum_odo_fused) {
+      pipeline_load_compute_sum_odo.producer_acquire(pipeline_load_compute_sum_odo_producer_state);
 
-    pipeline_load_compute_sum_odo.producer_commit(pipeline_load_compute_sum_odo_producer_state, cutlass::arch::cpasync_barrier_arrive);
-    ++pipeline_load_compute_sum_odo_producer_state;
+      smem_idx = TileShapeQ{} * pipeline_load_compute_sum_odo_producer_state.index() + thread_idx * 4;
+      gmem_idx = TileShapeQ{} * iter_index + thread_idx * 4;
+      for (int i = 0; i < 4; i++) {
+        cutlass::arch::cp_async_zfill<4>(
+            shared_tensors.smem_sum_odo.begin() + smem_idx + i,
+            &mSumOdO(gmem_idx + i, blk_coord_batch),
+            gmem_idx + i < Q
+        );
+      }
+
+      pipeline_load_compute_sum_odo.producer_commit(pipeline_load_compute_sum_odo_producer_state, cutlass::arch::cpasync_barrier_arrive);
+      ++pipeline_load_compute_sum_odo_producer_state;
+    }
 
     iter_count -= 1;
     iter_index += 1;
@@ -615,21 +657,23 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
 
       ++pipeline_load_mma_q_producer_state;
 
-      pipeline_load_compute_lse.producer_acquire(pipeline_load_compute_lse_producer_state);
-
       // load LSE
-      smem_idx = TileShapeQ{} * pipeline_load_compute_lse_producer_state.index() + thread_idx * 4;
-      gmem_idx = TileShapeQ{} * iter_index + thread_idx * 4;
-      for (int i = 0; i < 4; i++) {
-        cutlass::arch::cp_async_zfill<4>(
-            shared_tensors.smem_lse.begin() + smem_idx + i,
-            &mLSE(gmem_idx + i, blk_coord_batch),
-            gmem_idx + i < Q
-        );
-      }
+      if (! is_sum_odo_fused) {
+        pipeline_load_compute_lse.producer_acquire(pipeline_load_compute_lse_producer_state);
+
+        smem_idx = TileShapeQ{} * pipeline_load_compute_lse_producer_state.index() + thread_idx * 4;
+        gmem_idx = TileShapeQ{} * iter_index + thread_idx * 4;
+        for (int i = 0; i < 4; i++) {
+          cutlass::arch::cp_async_zfill<4>(
+              shared_tensors.smem_lse.begin() + smem_idx + i,
+              &mLSE(gmem_idx + i, blk_coord_batch),
+              gmem_idx + i < Q
+          );
+        }
 
-      pipeline_load_compute_lse.producer_commit(pipeline_load_compute_lse_producer_state, cutlass::arch::cpasync_barrier_arrive);
-      ++pipeline_load_compute_lse_producer_state;
+        pipeline_load_compute_lse.producer_commit(pipeline_load_compute_lse_producer_state, cutlass::arch::cpasync_barrier_arrive);
+        ++pipeline_load_compute_lse_producer_state;
+      }
 
       pipeline_load_mma_do.producer_acquire(pipeline_load_mma_do_producer_state);
       tma_barrier = pipeline_load_mma_do.producer_get_barrier(pipeline_load_mma_do_producer_state);
@@ -645,20 +689,122 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
 
       ++pipeline_load_mma_do_producer_state;
 
+      // load sum_OdO
+      if (! is_sum_odo_fused) {
+        pipeline_load_compute_sum_odo.producer_acquire(pipeline_load_compute_sum_odo_producer_state);
+
+        smem_idx = TileShapeQ{} * pipeline_load_compute_sum_odo_producer_state.index() + thread_idx * 4;
+        gmem_idx = TileShapeQ{} * iter_index + thread_idx * 4;
+        for (int i = 0; i < 4; i++) {
+          cutlass::arch::cp_async_zfill<4>(
+              shared_tensors.smem_sum_odo.begin() + smem_idx + i,
+              &mSumOdO(gmem_idx + i, blk_coord_batch),
+              gmem_idx + i < Q
+          );
+        }
+
+        pipeline_load_compute_sum_odo.producer_commit(pipeline_load_compute_sum_odo_producer_state, cutlass::arch::cpasync_barrier_arrive);
+        ++pipeline_load_compute_sum_odo_producer_state;
+      }
+
+      iter_count -= 1;
+      iter_index += 1;
+    }
+  }
+
+
+  template<class BlkCoord, class BlkOffset, class ProblemShape_>
+  CUTLASS_DEVICE void sum_odo(
+      BlkCoord const& blk_coord,
+      BlkOffset const& blk_offset,
+      ProblemShape_ const& problem_shape,
+      int iter_start,
+      int iter_end,
+      int iter_count,
+      MainloopArguments const& mainloop_args,
+      TensorStorage& shared_tensors,
+      PipelineLoadComputeLSE& pipeline_load_compute_lse,
+      typename PipelineLoadComputeLSE::PipelineState& pipeline_load_compute_lse_producer_state,
+      PipelineLoadComputeSumOdO& pipeline_load_compute_sum_odo,
+      typename PipelineLoadComputeSumOdO::PipelineState& pipeline_load_compute_sum_odo_producer_state) {
+
+    auto [Q, K, D, D_VO, HB] = problem_shape;
+    int iter_index = iter_start;
+
+    auto [blk_coord_q, blk_coord_k, blk_coord_d, blk_coord_dv, blk_coord_batch] = blk_coord;
+
+    auto mO_in = make_tensor(make_gmem_ptr(mainloop_args.ptr_o), make_shape(Q, D_VO, HB), mainloop_args.stride_o);
+    auto mDO_in = make_tensor(make_gmem_ptr(mainloop_args.ptr_do), make_shape(Q, D_VO, HB), mainloop_args.stride_do);
+    auto mLSE_in = make_tensor(make_gmem_ptr(mainloop_args.ptr_lse), make_shape(Q, HB), mainloop_args.stride_lse);
+
+    auto mO = domain_offset(select<0,3,4>(blk_offset), mO_in);
+    auto mDO = domain_offset(select<0,3,4>(blk_offset), mDO_in);
+    auto mLSE = domain_offset(select<0,4>(blk_offset), mLSE_in);
+
+    // every row of O and dO is read by kThreadsPerRow threads in 128b vectors
+    constexpr int kNumThreads = kNumSumOdOWarps * NumThreadsPerWarp;
+    constexpr int kThreadsPerRow = 8;
+    constexpr int kRowsPerStep = kNumThreads / kThreadsPerRow;
+
+    int thread_idx = threadIdx.x % kNumThreads;
+    int row_idx = thread_idx / kThreadsPerRow;
+    int col_idx = (thread_idx % kThreadsPerRow) * Alignment;
+
+    using Fragment = cutlass::AlignedArray<Element, Alignment>;
+    cutlass::NumericArrayConverter<ElementAcc, Element, Alignment> convert;
+
+    // matches the negation and scaling done by FmhaKernelBwdSumOdO
+    ElementAcc log2_e = static_cast<ElementAcc>(M_LOG2E);
+    ElementAcc sum_odo_scale = -mainloop_args.scale_o * mainloop_args.scale_do * mainloop_args.scale_ds;
+
+    CUTLASS_PRAGMA_NO_UNROLL
+    while (iter_count > 0) {
+      if (iter_index == iter_end) {
+        iter_index = iter_start;
+        get<0,0>(blk_coord_batch) += 1;
+      }
+
+      // LSE is needed first, for P
+      pipeline_load_compute_lse.producer_acquire(pipeline_load_compute_lse_producer_state);
+
+      int smem_idx = TileShapeQ{} * pipeline_load_compute_lse_producer_state.index();
+      for (int i = thread_idx; i < TileShapeQ{}; i += kNumThreads) {
+        int idx_q = TileShapeQ{} * iter_index + i;
+        shared_tensors.smem_lse[smem_idx + i] = idx_q < Q ? -log2_e * mLSE(idx_q, blk_coord_batch) : ElementAcc(0);
+      }
+
+      pipeline_load_compute_lse.producer_commit(pipeline_load_compute_lse_producer_state);
+      ++pipeline_load_compute_lse_producer_state;
+
+      // compute sum_OdO
       pipeline_load_compute_sum_odo.producer_acquire(pipeline_load_compute_sum_odo_producer_state);
 
-      // load sum_OdO
-      smem_idx = TileShapeQ{} * pipeline_load_compute_sum_odo_producer_state.index() + thread_idx * 4;
-      gmem_idx = TileShapeQ{} * iter_index + thread_idx * 4;
-      for (int i = 0; i < 4; i++) {
-        cutlass::arch::cp_async_zfill<4>(
-            shared_tensors.smem_sum_odo.begin() + smem_idx + i,
-            &mSumOdO(gmem_idx + i, blk_coord_batch),
-            gmem_idx + i < Q
-        );
+      smem_idx = TileShapeQ{} * pipeline_load_compute_sum_odo_producer_state.index();
+      for (int i = row_idx; i < TileShapeQ{}; i += kRowsPerStep) {
+        int idx_q = TileShapeQ{} * iter_index + i;
+        ElementAcc acc = 0;
+        if (idx_q < Q) {
+          for (int idx_d = col_idx; idx_d < D_VO; idx_d += kThreadsPerRow * Alignment) {
+            auto frag_o = convert(*reinterpret_cast<Fragment const*>(&mO(idx_q, idx_d, blk_coord_batch)));
+            auto frag_do = convert(*reinterpret_cast<Fragment const*>(&mDO(idx_q, idx_d, blk_coord_batch)));
+            CUTLASS_PRAGMA_UNROLL
+            for (int v = 0; v < Alignment; v++) {
+              acc += frag_o[v] * frag_do[v];
+            }
+          }
+        }
+
+        CUTLASS_PRAGMA_UNROLL
+        for (int j = 1; j < kThreadsPerRow; j *= 2) {
+          acc += __shfl_xor_sync((uint32_t)-1, acc, j, kThreadsPerRow);
+        }
+
+        if (thread_idx % kThreadsPerRow == 0) {
+          shared_tensors.smem_sum_odo[smem_idx + i] = sum_odo_scale * acc;
+        }
       }
 
-      pipeline_load_compute_sum_odo.producer_commit(pipeline_load_compute_sum_odo_producer_state, cutlass::arch::cpasync_barrier_arrive);
+      pipeline_load_compute_sum_odo.producer_commit(pipeline_load_compute_sum_odo_producer_state);
       ++pipeline_load_compute_sum_odo_producer_state;
 
       iter_count -= 1;
@@ -749,6 +895,13 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
 
     auto pipeline_load_mma_q_release_state = pipeline_load_mma_q_consumer_state;
 
+    // dK and dV of the previous tile must have been read out of tmem before they are
+    // overwritten, which matters once a persistent scheduler runs several tiles per CTA
+    auto pipeline_mma_compute_dk_state = pipeline_mma_compute_dkdv_producer_state;
+    ++pipeline_mma_compute_dk_state;
+    pipeline_mma_compute_dkdv.producer_acquire(pipeline_mma_compute_dkdv_producer_state);
+    pipeline_mma_compute_dkdv.producer_acquire(pipeline_mma_compute_dk_state);
+
     pipeline_load_mma_q.consumer_wait(pipeline_load_mma_q_consumer_state);
     pipeline_mma_compute_s.producer_acquire(pipeline_mma_compute_s_producer_state);
 
@@ -1073,7 +1226,7 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
     Tensor tTR_rDK = make_tensor<ElementAcc>(shape(tTR_cDK));
     Tensor tTR_tDK = split_wg(thread_t2r_dk.partition_S(tDKtDK));
 
-    auto tDVtDV = partition_fragment_C(TiledMmaDSQ{}, select<0,1>(TileShapeDSQ{}))(make_coord(_,_),_0{},_0{});
+    auto tDVtDV = partition_fragment_C(TiledMmaPDO{}, select<0,1>(TileShapePDO{}))(make_coord(_,_),_0{},_0{});
     tDVtDV.data() = TmemAllocation::kDV;
 
     auto mDV_in = make_tensor(make_gmem_ptr(epilogue_args.ptr_dv), make_shape(K, TileShapeDVO{}, HB), epilogue_args.stride_dv);
@@ -1099,6 +1252,11 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
     // load tDVtDV
     cute::copy(tiled_t2r_dv, tTR_tDV, tTR_rDV);
 
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(tTR_rDV); i++) {
+      tTR_rDV(i) = mainloop_args.scale_do * tTR_rDV(i);
+    }
+
     // store tDVgDV
     store(tTR_gDV, tTR_rDV, tTR_cDV, select<1,3>(problem_shape));
 
@@ -1111,9 +1269,11 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
     // load tDKtDK
     cute::copy(tiled_t2r_dk, tTR_tDK, tTR_rDK);
 
+    ElementAcc scale_dk = mainloop_args.softmax_scale * mainloop_args.scale_q / mainloop_args.scale_ds;
+
     CUTLASS_PRAGMA_UNROLL
     for (int i = 0; i < size(tTR_rDK); i++) {
-      tTR_rDK(i) = mainloop_args.softmax_scale * tTR_rDK(i);
+      tTR_rDK(i) = scale_dk * tTR_rDK(i);
     }
 
     // store tDKgDK
@@ -1241,6 +1401,15 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
 
     bool is_residual_k = get<1>(blk_coord) * TileShapeK{} + TileShapeK{} > get<1>(problem_shape);
 
+    Mask mask = mainloop_args.mask;
+    // the query heads sharing this kv head are visited in turn, each from iter_start to iter_end
+    int head_r = 0;
+    ElementAcc scale_qk = mainloop_args.softmax_scale * mainloop_args.scale_q * mainloop_args.scale_k;
+    // S' after the score modifications, as needed for their gradient
+    Tensor tTR_rST_mod = make_tensor<ElementAcc>(shape(tTR_cST));
+    // P with the dropout mask regenerated and the kept elements rescaled, the operand of dV = P^T dO
+    Tensor tTR_rPD = make_tensor<ElementAcc>(shape(tTR_cST));
+
     CUTLASS_PRAGMA_NO_UNROLL
     while (iter_count > 0) {
       // wait for S and P
@@ -1280,17 +1449,26 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
         // compute P = softmax(S, LSE)
         cute::copy(tiled_t2r, tTR_tST, tTR_rST);
 
+        auto index_qk = [&](int i) {
+          auto c_transpose = tTR_cST(i);
+          return make_coord(get<1>(c_transpose) + iter_index * TileShapeQ{}, get<0>(c_transpose) + get<1>(blk_coord) * TileShapeK{});
+        };
+
+        int head = head_r + get<4,0,0>(problem_shape) * get<4,0,1>(blk_coord);
+
+        if constexpr (cutlass::fmha::collective::has_score_mod_v<Mask>) {
+          mask.apply_score_mod(tTR_rST, index_qk, problem_shape, head, scale_qk);
+          copy(tTR_rST, tTR_rST_mod);
+        }
+
         if constexpr (decltype(is_masked_tile)::value) {
-          Mask{}.apply_mask(tTR_rST, [&](int i) {
-            auto c_transpose = tTR_cST(i);
-            return make_coord(get<1>(c_transpose) + iter_index * TileShapeQ{}, get<0>(c_transpose) + get<1>(blk_coord) * TileShapeK{});
-          }, problem_shape);
+          mask.apply_mask(tTR_rST, index_qk, problem_shape);
         }
 
         ElementAcc log2_e = static_cast<ElementAcc>(M_LOG2E);
         float2 softmax_scale_log2_e;
-        softmax_scale_log2_e.x = mainloop_args.softmax_scale * log2_e;
-        softmax_scale_log2_e.y = mainloop_args.softmax_scale * log2_e;
+        softmax_scale_log2_e.x = mainloop_args.softmax_scale * mainloop_args.scale_q * mainloop_args.scale_k * log2_e;
+        softmax_scale_log2_e.y = softmax_scale_log2_e.x;
 
         CUTLASS_PRAGMA_UNROLL
         for (int i = 0; i < size(tTR_rST); i += 2) {
@@ -1306,7 +1484,12 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
           tTR_rST(i+1) = ::exp2f(out.y);
         }
 
-        auto tRT_rST = quantize(tTR_rST);
+        if constexpr (cutlass::fmha::collective::has_dropout_v<Mask>) {
+          copy(tTR_rST, tTR_rPD);
+          mask.apply_dropout(tTR_rPD, index_qk, int(get<4,1>(blk_coord)), head, mask.rp_dropout());
+        }
+
+        auto tRT_rST = quantize(cute::conditional_return<cutlass::fmha::collective::has_dropout_v<Mask>>(tTR_rPD, tTR_rST));
         auto tRT_rST_reshaped = make_tensor(tRT_rST.data(), shape(tRT_cST));
 
         cutlass::arch::fence_view_async_tmem_load();
@@ -1342,6 +1525,11 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
       // compute dS = dsoftmax(P, dP, sum_OdO)
       cute::copy(tiled_t2r, tTR_tDPT, tTR_rDPT);
 
+      // sum_OdO already carries scale_ds, so this yields dS * scale_ds
+      float2 dp_scale;
+      dp_scale.x = mainloop_args.scale_v * mainloop_args.scale_do * mainloop_args.scale_ds;
+      dp_scale.y = dp_scale.x;
+
       CUTLASS_PRAGMA_UNROLL
       for (int i = 0; i < size(tTR_rDPT); i += 2) {
         float2 st;
@@ -1353,11 +1541,29 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
         float2 odo;
         odo.x = sSumOdO(get<1>(tTR_cDPT(i)), pipeline_load_compute_sum_odo_consumer_state.index());
         odo.y = sSumOdO(get<1>(tTR_cDPT(i+1)), pipeline_load_compute_sum_odo_consumer_state.index());
-        float2 dif;
-        // sum odo is negated during preprocess
-        cute::add(dif, dpt, odo);
         float2 out;
-        cute::mul(out, dif, st);
+        if constexpr (cutlass::fmha::collective::has_dropout_v<Mask>) {
+          // dS = P (Z dP / (1 - p) - sum_OdO) = dP P_dropped - sum_OdO P, as sum_OdO is taken over the dropped O
+          float2 pd;
+          pd.x = tTR_rPD(i);
+          pd.y = tTR_rPD(i+1);
+          float2 dpt_scaled;
+          cute::mul(dpt_scaled, dp_scale, dpt);
+          float2 odo_st;
+          // sum odo is negated during preprocess
+          cute::mul(odo_st, odo, st);
+          cute::fma(out, dpt_scaled, pd, odo_st);
+        }
+        else {
+          float2 dif;
+          // sum odo is negated during preprocess
+          cute::fma(dif, dp_scale, dpt, odo);
+          cute::mul(out, dif, st);
+        }
+        if constexpr (cutlass::fmha::collective::has_score_mod_v<Mask>) {
+          out.x *= mask.score_mod_grad(tTR_rST_mod(i), scale_qk);
+          out.y *= mask.score_mod_grad(tTR_rST_mod(i+1), scale_qk);
+        }
         tTR_rDPT(i) = out.x;
         tTR_rDPT(i+1) = out.y;
       }
@@ -1395,6 +1601,7 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
       iter_index += 1;
       if (iter_index == iter_end) {
         iter_index = iter_start;
+        head_r += 1;
       }
     }
 
@@ -1554,14 +1761,19 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
     PipelineLoadMmaDO pipeline_load_mma_do(shared_storage.pipelines.load_mma_do, pipeline_load_mma_do_params,
       ClusterShape{}, /*barrier init*/ cute::true_type{}, /*mask calc*/cute::false_type{});
 
+    // with sum_OdO fused, the SumOdO warps also produce the LSE
+    bool is_sum_odo_fused = params.mainloop.ptr_o != nullptr;
+    WarpRole role_sum_odo_producer = is_sum_odo_fused ? WarpRole::SumOdO : WarpRole::Load;
+    int sum_odo_producer_arv_count = (is_sum_odo_fused ? kNumSumOdOWarps : 1) * NumThreadsPerWarp;
+
     typename PipelineLoadComputeLSE::Params pipeline_load_compute_lse_params;
-    if (role == WarpRole::Load) {
+    if (role == role_sum_odo_producer) {
       pipeline_load_compute_lse_params.role = PipelineLoadComputeLSE::ThreadCategory::Producer;
     }
     if (role == WarpRole::Compute) {
       pipeline_load_compute_lse_params.role = PipelineLoadComputeLSE::ThreadCategory::Consumer;
     }
-    pipeline_load_compute_lse_params.producer_arv_count = NumThreadsPerWarp;
+    pipeline_load_compute_lse_params.producer_arv_count = sum_odo_producer_arv_count;
     pipeline_load_compute_lse_params.consumer_arv_count = kNumComputeWarps * NumThreadsPerWarp;
     pipeline_load_compute_lse_params.initializing_warp = initializing_warp++;
     PipelineLoadComputeLSE pipeline_load_compute_lse(
@@ -1570,13 +1782,13 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
       /*barrier init*/ cute::true_type{});
 
     typename PipelineLoadComputeSumOdO::Params pipeline_load_compute_sum_odo_params;
-    if (role == WarpRole::Load) {
+    if (role == role_sum_odo_producer) {
       pipeline_load_compute_sum_odo_params.role = PipelineLoadComputeSumOdO::ThreadCategory::Producer;
     }
     if (role == WarpRole::Compute) {
       pipeline_load_compute_sum_odo_params.role = PipelineLoadComputeSumOdO::ThreadCategory::Consumer;
     }
-    pipeline_load_compute_sum_odo_params.producer_arv_count = NumThreadsPerWarp;
+    pipeline_load_compute_sum_odo_params.producer_arv_count = sum_odo_producer_arv_count;
     pipeline_load_compute_sum_odo_params.consumer_arv_count = kNumComputeWarps * NumThreadsPerWarp;
     pipeline_load_compute_sum_odo_params.initializing_warp = initializing_warp++;
     PipelineLoadComputeSumOdO pipeline_load_compute_sum_odo(
@@ -1709,102 +1921,164 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
 
     pipeline_init_wait(size(ClusterShape{}));
 
-    auto blk_coord = make_coord(_0{}, blockIdx.x, _0{}, _0{}, make_coord(make_coord(0, blockIdx.y), blockIdx.z));
-    auto [problem_shape, blk_offset] = apply_variable_length_offset(
-        params.problem_shape,
-        blk_coord
-    );
-    int iter_end = ceil_div(get<0>(problem_shape), TileShapeQ{});
-    int iter_start = 0;
-    if constexpr (std::is_base_of_v<cutlass::fmha::collective::CausalMask<true>, Mask>) {
-      iter_start = (get<1>(blk_coord) * TileShapeK{}) / TileShapeQ{};
-    } else if constexpr (std::is_base_of_v<cutlass::fmha::collective::CausalMask<false>, Mask>) {
-      int offset = get<1>(problem_shape) - get<0>(problem_shape);
-      iter_start = max(0, (int(get<1>(blk_coord) * TileShapeK{}) - offset) / (int)TileShapeQ{});
-    }
-    if (get<1>(blk_coord) * TileShapeK{} >= get<1>(problem_shape)) {
-      return;
-    }
-    int iter_count = (iter_end - iter_start) * get<4,0,0>(problem_shape);
-
-    if (iter_count <= 0) {
-      epilogue_clear(
-          blk_coord,
-          blk_offset,
-          problem_shape,
-          params.mainloop,
-          params.epilogue
-      );
-      return;
-    }
-
     if (role == WarpRole::Load) {
       warpgroup_reg_set<RegisterAllocation::kLoad>();
-
-      load(
-          blk_coord,
-          blk_offset,
-          problem_shape,
-          iter_start,
-          iter_end,
-          iter_count,
-          params.mainloop,
-          params.mainloop_params,
-          shared_storage.tensors,
-          pipeline_load_mma_q, pipeline_load_mma_q_producer_state,
-          pipeline_load_mma_do, pipeline_load_mma_do_producer_state,
-          pipeline_load_compute_lse, pipeline_load_compute_lse_producer_state,
-          pipeline_load_compute_sum_odo, pipeline_load_compute_sum_odo_producer_state
-      );
-
     }
     else if (role == WarpRole::Mma) {
       warpgroup_reg_set<RegisterAllocation::kMma>();
-
-      tmem_allocator.allocate(TmemAllocator::Sm100TmemCapacityColumns, &shared_storage.tmem_base_ptr);
-      __syncwarp();
-
-      mma(
-          blk_coord,
-          problem_shape,
-          iter_start,
-          iter_end,
-          iter_count,
-          params.mainloop,
-          shared_storage.tensors,
-          pipeline_load_mma_q, pipeline_load_mma_q_consumer_state,
-          pipeline_load_mma_do, pipeline_load_mma_do_consumer_state,
-          pipeline_mma_compute_s, pipeline_mma_compute_s_producer_state,
-          pipeline_mma_compute_dp, pipeline_mma_compute_dp_producer_state,
-          pipeline_mma_reduce_dq, pipeline_mma_reduce_dq_producer_state,
-          pipeline_compute_mma_p, pipeline_compute_mma_p_consumer_state,
-          pipeline_compute_mma_ds, pipeline_compute_mma_ds_consumer_state,
-          pipeline_mma_compute_dkdv, pipeline_mma_compute_dkdv_producer_state
-      );
-
     }
     else if (role == WarpRole::Compute) {
       warpgroup_reg_set<RegisterAllocation::kCompute>();
+    }
+    else if (role == WarpRole::Reduce) {
+      warpgroup_reg_set<RegisterAllocation::kReduce>();
+    }
+    else if (role == WarpRole::SumOdO) {
+      warpgroup_reg_set<RegisterAllocation::kSumOdO>();
+    }
+    else {
+      warpgroup_reg_set<RegisterAllocation::kEmpty>();
+    }
+
+    // tmem is allocated for the first tile with any work, every role sees the same tiles
+    bool is_tmem_allocated = false;
 
-      compute(
-          blk_coord,
-          blk_offset,
-          problem_shape,
-          iter_start,
-          iter_end,
-          iter_count,
-          params.mainloop,
-          params.epilogue,
-          shared_storage.tensors,
-          pipeline_load_compute_lse, pipeline_load_compute_lse_consumer_state,
-          pipeline_load_compute_sum_odo, pipeline_load_compute_sum_odo_consumer_state,
-          pipeline_mma_compute_s, pipeline_mma_compute_s_consumer_state,
-          pipeline_mma_compute_dp, pipeline_mma_compute_dp_consumer_state,
-          pipeline_compute_mma_p, pipeline_compute_mma_p_producer_state,
-          pipeline_compute_mma_ds, pipeline_compute_mma_ds_producer_state,
-          pipeline_mma_compute_dkdv, pipeline_mma_compute_dkdv_consumer_state
+    TileScheduler tile_scheduler{params.tile_scheduler};
+
+    CUTLASS_PRAGMA_NO_UNROLL
+    for (; tile_scheduler.is_valid(); ++tile_scheduler) {
+      auto [blk_k, blk_h_k, blk_b] = tile_scheduler.get_block_coord();
+      auto blk_coord = make_coord(_0{}, blk_k, _0{}, _0{}, make_coord(make_coord(0, blk_h_k), blk_b));
+      auto [problem_shape, blk_offset] = apply_variable_length_offset(
+          params.problem_shape,
+          blk_coord
       );
+      int iter_end = ceil_div(get<0>(problem_shape), TileShapeQ{});
+      int iter_start = 0;
+      if constexpr (std::is_base_of_v<cutlass::fmha::collective::CausalMask<true>, Mask>) {
+        iter_start = (get<1>(blk_coord) * TileShapeK{}) / TileShapeQ{};
+      } else if constexpr (std::is_base_of_v<cutlass::fmha::collective::CausalMask<false>, Mask>) {
+        int offset = get<1>(problem_shape) - get<0>(problem_shape);
+        iter_start = max(0, (int(get<1>(blk_coord) * TileShapeK{}) - offset) / (int)TileShapeQ{});
+      }
+      if (get<1>(blk_coord) * TileShapeK{} >= get<1>(problem_shape)) {
+        continue;
+      }
+      int iter_count = (iter_end - iter_start) * get<4,0,0>(problem_shape);
+
+      if (iter_count <= 0) {
+        epilogue_clear(
+            blk_coord,
+            blk_offset,
+            problem_shape,
+            params.mainloop,
+            params.epilogue
+        );
+        continue;
+      }
+
+      if (role == WarpRole::Load) {
+        load(
+            blk_coord,
+            blk_offset,
+            problem_shape,
+            iter_start,
+            iter_end,
+            iter_count,
+            params.mainloop,
+            params.mainloop_params,
+            shared_storage.tensors,
+            pipeline_load_mma_q, pipeline_load_mma_q_producer_state,
+            pipeline_load_mma_do, pipeline_load_mma_do_producer_state,
+            pipeline_load_compute_lse, pipeline_load_compute_lse_producer_state,
+            pipeline_load_compute_sum_odo, pipeline_load_compute_sum_odo_producer_state
+        );
+
+      }
+      else if (role == WarpRole::Mma) {
+        if (! is_tmem_allocated) {
+          tmem_allocator.allocate(TmemAllocator::Sm100TmemCapacityColumns, &shared_storage.tmem_base_ptr);
+          __syncwarp();
+        }
+
+        mma(
+            blk_coord,
+            problem_shape,
+            iter_start,
+            iter_end,
+            iter_count,
+            params.mainloop,
+            shared_storage.tensors,
+            pipeline_load_mma_q, pipeline_load_mma_q_consumer_state,
+            pipeline_load_mma_do, pipeline_load_mma_do_consumer_state,
+            pipeline_mma_compute_s, pipeline_mma_compute_s_producer_state,
+            pipeline_mma_compute_dp, pipeline_mma_compute_dp_producer_state,
+            pipeline_mma_reduce_dq, pipeline_mma_reduce_dq_producer_state,
+            pipeline_compute_mma_p, pipeline_compute_mma_p_consumer_state,
+            pipeline_compute_mma_ds, pipeline_compute_mma_ds_consumer_state,
+            pipeline_mma_compute_dkdv, pipeline_mma_compute_dkdv_producer_state
+        );
+
+      }
+      else if (role == WarpRole::Compute) {
+        compute(
+            blk_coord,
+            blk_offset,
+            problem_shape,
+            iter_start,
+            iter_end,
+            iter_count,
+            params.mainloop,
+            params.epilogue,
+            shared_storage.tensors,
+            pipeline_load_compute_lse, pipeline_load_compute_lse_consumer_state,
+            pipeline_load_compute_sum_odo, pipeline_load_compute_sum_odo_consumer_state,
+            pipeline_mma_compute_s, pipeline_mma_compute_s_consumer_state,
+            pipeline_mma_compute_dp, pipeline_mma_compute_dp_consumer_state,
+            pipeline_compute_mma_p, pipeline_compute_mma_p_producer_state,
+            pipeline_compute_mma_ds, pipeline_compute_mma_ds_producer_state,
+            pipeline_mma_compute_dkdv, pipeline_mma_compute_dkdv_consumer_state
+        );
+
+      }
+      else if (role == WarpRole::Reduce) {
+        reduce(
+            blk_coord,
+            problem_shape,
+            iter_start,
+            iter_end,
+            iter_count,
+            params.mainloop,
+            params.mainloop_params,
+            shared_storage.tensors,
+            pipeline_mma_reduce_dq, pipeline_mma_reduce_dq_consumer_state,
+            pipeline_reduce_tma_store, pipeline_reduce_tma_store_producer_state
+        );
+      }
+      else if (role == WarpRole::SumOdO && is_sum_odo_fused) {
+        sum_odo(
+            blk_coord,
+            blk_offset,
+            problem_shape,
+            iter_start,
+            iter_end,
+            iter_count,
+            params.mainloop,
+            shared_storage.tensors,
+            pipeline_load_compute_lse, pipeline_load_compute_lse_producer_state,
+            pipeline_load_compute_sum_odo, pipeline_load_compute_sum_odo_producer_state
+        );
+      }
+      else {
+
+        /* no-op */
+
+      }
+
+      is_tmem_allocated = true;
+    }
 
+    if (role == WarpRole::Compute && is_tmem_allocated) {
       cutlass::arch::NamedBarrier(
           kNumComputeWarps * NumThreadsPerWarp,
           cutlass::arch::ReservedNamedBarriers::EpilogueBarrier
@@ -1814,32 +2088,10 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
         uint32_t free_stage_ptr = shared_storage.tmem_base_ptr;
         tmem_allocator.free(free_stage_ptr, TmemAllocator::Sm100TmemCapacityColumns);
       }
-
     }
     else if (role == WarpRole::Reduce) {
-      warpgroup_reg_set<RegisterAllocation::kReduce>();
-
-      reduce(
-          blk_coord,
-          problem_shape,
-          iter_start,
-          iter_end,
-          iter_count,
-          params.mainloop,
-          params.mainloop_params,
-          shared_storage.tensors,
-          pipeline_mma_reduce_dq, pipeline_mma_reduce_dq_consumer_state,
-          pipeline_reduce_tma_store, pipeline_reduce_tma_store_producer_state
-      );
-
       pipeline_reduce_tma_store.producer_tail(pipeline_reduce_tma_store_producer_state);
     }
-    else {
-      warpgroup_reg_set<RegisterAllocation::kEmpty>();
-
-      /* no-op */
-
-    }
 #endif
   }
 
@@ -1849,11 +2101,7 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
   }
 
   static dim3 get_grid_shape(Params const& params) {
-    auto [Q, K, D, D_VO, HB] = params.problem_shape;
-    auto [H, B] = HB;
-    auto [H_R, H_K] = H;
-    dim3 grid(ceil_div(K, TileShapeK{}), H_K, B);
-    return grid;
+    return TileScheduler::get_grid_shape(params.tile_scheduler);
   }
 };
 
@@ -33,6 +33,7 @@
 #include "cutlass/cutlass.h"
 #include "cute/layout.hpp"
 #include "cutlass/arch/arch.h"
+#include "cutlass/arch/grid_dependency_control.h"
 #include "cutlass/kernel_hardware_info.h"
 #include "cutlass/pipeline/pipeline.hpp"
 #include "cute/arch/tmem_allocator_sm100.hpp"
@@ -175,7 +176,8 @@ struct Sm100FmhaFwdKernelTmaWarpspecialized {
       typename CollectiveEpilogue::TensorStorage epilogue;
     };
 
-    static constexpr bool IsPersistent = std::is_same_v<TileScheduler, PersistentTileScheduler> || std::is_same_v<TileScheduler, CausalPersistentTileScheduler>;
+    static constexpr bool IsPersistent = std::is_same_v<TileScheduler, PersistentTileScheduler> || std::is_same_v<TileScheduler, CausalPersistentTileScheduler> ||
+                                        std::is_same_v<TileScheduler, VariableLengthPersistentTileScheduler>;
     using MainloopEpilogueStorage = std::conditional_t<IsPersistent, 
                                                        std::conditional_t<IsMla, 
                                                                           std::conditional_t<CollectiveMainloop::IsOrderLoadEpilogue, UnionType, StructType>,
@@ -225,7 +227,14 @@ struct Sm100FmhaFwdKernelTmaWarpspecialized {
   }
 
   static bool can_implement(Arguments const& args) {
-    return CollectiveMainloop::can_implement(args.problem_shape, args.mainloop);
+    if constexpr (IsMla) {
+      // the MLA correction does not merge with an accumulated (O, LSE)
+      if (args.epilogue.accumulate) {
+        return false;
+      }
+    }
+    return CollectiveMainloop::can_implement(args.problem_shape, args.mainloop)
+        && CollectiveEpilogue::can_implement(args.epilogue);
   }
 
   static dim3 get_grid_shape(Params const& params) {
@@ -304,7 +313,7 @@ struct Sm100FmhaFwdKernelTmaWarpspecialized {
       pipeline_load_kv_params.role = CollectiveMainloop::PipelineKV::ThreadCategory::Consumer;
     }
     pipeline_load_kv_params.is_leader = lane_predicate && (role == WarpRole::Load);
-    pipeline_load_kv_params.transaction_bytes = CollectiveMainloop::TransactionBytesLoadK;
+    pipeline_load_kv_params.transaction_bytes = CollectiveMainloop::TransactionBytesLoadKV;
     typename CollectiveMainloop::PipelineKV pipeline_load_kv(
       shared_storage.pipelines.load_kv,
       pipeline_load_kv_params,
@@ -469,6 +478,10 @@ struct Sm100FmhaFwdKernelTmaWarpspecialized {
     else if (role == WarpRole::Correction) {
       cutlass::arch::warpgroup_reg_dealloc<NumRegsCorrection>();
 
+      // Ensure that the prefetched kernel does not touch
+      // unflushed global memory prior to this instruction
+      cutlass::arch::wait_on_dependent_grids();
+
       bool has_valid = false;
 
       CUTLASS_PRAGMA_NO_UNROLL
@@ -558,10 +571,19 @@ struct Sm100FmhaFwdKernelTmaWarpspecialized {
         );
 
       }
+
+      // Hint on an early release of global memory resources.
+      // The timing of calling this function only influences performance,
+      // not functional correctness.
+      cutlass::arch::launch_dependent_grids();
     }
     else if (role == WarpRole::Load) {
       warpgroup_reg_set<NumRegsOther>();
 
+      // Ensure that the prefetched kernel does not touch
+      // unflushed global memory prior to this instruction
+      cutlass::arch::wait_on_dependent_grids();
+
       if constexpr (IsMla && CollectiveMainloop::IsOrderLoadEpilogue) {
         cutlass::arch::NamedBarrier::arrive((NumWarpsLoad + NumWarpsEpilogue) * NumThreadsPerWarp, 
                                       cutlass::arch::ReservedNamedBarriers::EpilogueBarrier);
@@ -595,6 +617,10 @@ struct Sm100FmhaFwdKernelTmaWarpspecialized {
     else if (role == WarpRole::Epilogue) {
       warpgroup_reg_set<NumRegsOther>();
 
+      // Ensure that the prefetched kernel does not touch
+      // unflushed global memory prior to this instruction
+      cutlass::arch::wait_on_dependent_grids();
+
       bool has_valid = false;
 
       CUTLASS_PRAGMA_NO_UNROLL
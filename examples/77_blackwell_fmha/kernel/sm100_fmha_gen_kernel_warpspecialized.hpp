@@ -29,9 +29,12 @@
  *
  **************************************************************************************************/
 
+#pragma once
+
 #include "cutlass/cutlass.h"
 #include "cute/layout.hpp"
 #include "cutlass/arch/arch.h"
+#include "cutlass/fast_math.h"
 #include "cutlass/kernel_hardware_info.h"
 #include "cutlass/pipeline/pipeline.hpp"
 #include "cute/arch/tmem_allocator_sm100.hpp"
@@ -39,6 +42,7 @@
 #include "kernel/fmha_options.hpp"
 #include "kernel/fmha_tile_scheduler.hpp"
 #include "collective/fmha_fusion.hpp"
+#include "collective/fmha_common.hpp"
 
 namespace cutlass::fmha::kernel {
 
@@ -146,6 +150,9 @@ struct Sm100FmhaGenKernelWarpspecialized {
   using Element = typename CollectiveMainloop::Element;
   using ElementAcc = typename CollectiveMainloop::ElementAcc;
   using ElementOut = typename CollectiveMainloop::ElementOut;
+  using ElementOAcc = typename CollectiveEpilogue::ElementAcc;
+  using StrideOAcc = typename CollectiveEpilogue::StrideOAcc;
+  using StrideLSEAcc = typename CollectiveEpilogue::StrideLSEAcc;
 
   struct Arguments {
     // _1, max_seqlen_k, head_dim, ((h_g, h_kv), b)
@@ -170,6 +177,23 @@ struct Sm100FmhaGenKernelWarpspecialized {
     cutlass::KernelHardwareInfo hw_info;
 
     ElementAcc scale_softmax = 0.0f;
+
+    // optional per kv head dequantization factors of an FP8 kv cache
+    const float* ptr_scale_k = nullptr;
+    const float* ptr_scale_v = nullptr;
+
+    // for paged attention, the caches are [page_size x D x (H x page_count)]
+    // and the pages of each batch are listed in the page table
+    const int* ptr_page_table = nullptr;
+    // page table is [pages per batch, batch]
+    Stride<_1, int> stride_page_table = {};
+    int page_count = 0;
+    int page_size = 0;  // powers of two
+
+    // number of partitions along the kv sequence (flash decoding)
+    // with more than one split, the partial results are kept in the workspace
+    // and have to be combined by Sm100FmhaGenReductionKernel
+    int split_kv = 1;
   };
 
   struct Params {
@@ -178,18 +202,38 @@ struct Sm100FmhaGenKernelWarpspecialized {
     typename CollectiveMainloop::Params mainloop;
     typename CollectiveEpilogue::Params epilogue;
     typename TileScheduler::Params tile_scheduler;
+    // the tile scheduler enumerates (batch, split) as batch coordinate
+    FastDivmod divmod_batch;
   };
 
   static const int MinBlocksPerMultiprocessor = 1;
   static const int MaxThreadsPerBlock = NumWarps * cutlass::NumThreadsPerWarp;
   using ArchTag = cutlass::arch::Sm100;
 
-  static size_t get_workspace_size(Arguments const& args) { return 0; }
+  static size_t get_workspace_size(Arguments const& args) {
+    if (args.split_kv <= 1) {
+      return 0;
+    }
+    // partial O and LSE for every split
+    size_t num_rows = static_cast<size_t>(size<3>(args.problem_shape)) * args.split_kv;
+    return (sizeof(ElementOAcc) * get<2>(args.problem_shape) + sizeof(ElementOAcc)) * num_rows;
+  }
+
   static cutlass::Status initialize_workspace(Arguments const&, void*, cudaStream_t) {
     return cutlass::Status::kSuccess;
   }
 
   static bool can_implement(Arguments const& args) {
+    if (args.split_kv <= 0) {
+      std::cerr << __FILE__ << "(" << __LINE__ << "): split-kv off\n";
+      return false;
+    }
+    if (args.ptr_page_table != nullptr) {
+      if (args.page_size <= 0 || (args.page_size & (args.page_size - 1)) != 0) {
+        std::cerr << __FILE__ << "(" << __LINE__ << "): cpasync page size pow2\n";
+        return false;
+      }
+    }
     return true;
   }
 
@@ -220,23 +264,64 @@ struct Sm100FmhaGenKernelWarpspecialized {
         args.ptr_new_v, args.dNewV,
         args.ptr_cache_k, args.dCacheK,
         args.ptr_cache_v, args.dCacheV,
+        args.ptr_page_table, args.stride_page_table,
+        args.page_count, args.page_size
       },
       args.scale_softmax
     };
+    mainloop_args.ptr_scale_k = args.ptr_scale_k;
+    mainloop_args.ptr_scale_v = args.ptr_scale_v;
+    mainloop_args.split_kv = args.split_kv;
 
     typename CollectiveEpilogue::Arguments epilogue_args {
       args.ptr_o, dO,
     };
 
+    if (args.split_kv > 1) {
+      // workspace holds the partial O as (QG, D, (H, B), split) followed by the LSE as (QG, (H, B), split)
+      int D = get<2>(problem_shape);
+      int QG = get<0>(problem_shape);
+      int H = size<3,0>(problem_shape);
+      int B = size<3,1>(problem_shape);
+      epilogue_args.ptr_o_acc = reinterpret_cast<ElementOAcc*>(workspace);
+      epilogue_args.ptr_lse_acc = epilogue_args.ptr_o_acc + static_cast<size_t>(D) * QG * H * B * args.split_kv;
+      get<0>(epilogue_args.dOAcc) = D;
+      get<2,0,0>(epilogue_args.dOAcc) = D * QG;
+      get<2,0,1>(epilogue_args.dOAcc) = D * QG;
+      get<2,1>(epilogue_args.dOAcc) = D * QG * H;
+      get<3>(epilogue_args.dOAcc) = D * QG * H * B;
+      get<1,0,0>(epilogue_args.dLSEAcc) = QG;
+      get<1,0,1>(epilogue_args.dLSEAcc) = QG;
+      get<1,1>(epilogue_args.dLSEAcc) = QG * H;
+      get<2>(epilogue_args.dLSEAcc) = QG * H * B;
+    }
+
+    auto problem_shape_scheduler = problem_shape;
+    get<3,1>(problem_shape_scheduler) *= args.split_kv;
+
     return Params{
         problem_shape,
         args.seqlen_kv,
         CollectiveMainloop::to_underlying_arguments(problem_shape, mainloop_args, workspace),
         CollectiveEpilogue::to_underlying_arguments(problem_shape, epilogue_args, workspace),
-        TileScheduler::to_underlying_arguments(problem_shape, args.hw_info, ClusterShape{}, TileShape{})
+        TileScheduler::to_underlying_arguments(problem_shape_scheduler, args.hw_info, ClusterShape{}, TileShape{}),
+        FastDivmod(size<3,1>(problem_shape))
     };
   }
 
+  CUTLASS_DEVICE auto get_block_coord(const Params &params, TileScheduler& tile_scheduler) {
+    auto blk_coord = tile_scheduler.get_block_coord();
+    int split_idx, batch_idx;
+    params.divmod_batch(split_idx, batch_idx, get<2,1>(blk_coord));
+    // (Q, K, (H, B), split)
+    return append<4>(replace<2>(blk_coord, make_coord(get<2,0>(blk_coord), batch_idx)), split_idx);
+  }
+
+  template<class BlkCoord>
+  CUTLASS_DEVICE bool is_empty_split(const Params &params, ProblemShape const& problem_shape, BlkCoord const& blk_coord) {
+    return get<1>(CollectiveMainloop::get_split_tile_range(blk_coord, problem_shape, params.mainloop.split_kv)) == 0;
+  }
+
   CUTLASS_DEVICE auto apply_batch(const Params &params, ProblemShape const& problem_shape, int batch_idx) {
     ProblemShape result = problem_shape;
     get<1>(result) = params.seqlen_kv[batch_idx];
@@ -423,7 +508,7 @@ struct Sm100FmhaGenKernelWarpspecialized {
 
       CUTLASS_PRAGMA_NO_UNROLL
       for (; tile_scheduler.is_valid(); ++tile_scheduler) {
-        auto blk_coord = tile_scheduler.get_block_coord();
+        auto blk_coord = get_block_coord(params, tile_scheduler);
 
         auto logical_problem_shape = apply_batch(params,
             params.problem_shape, get<2,1>(blk_coord));
@@ -432,6 +517,10 @@ struct Sm100FmhaGenKernelWarpspecialized {
           continue;
         }
 
+        if (is_empty_split(params, logical_problem_shape, blk_coord)) {
+          continue;
+        }
+
         bool is_softmax_0 = role == WarpRole::Softmax0;
 
         mainloop.softmax(
@@ -451,7 +540,7 @@ struct Sm100FmhaGenKernelWarpspecialized {
 
       CUTLASS_PRAGMA_NO_UNROLL
       for (; tile_scheduler.is_valid(); ++tile_scheduler) {
-        auto blk_coord = tile_scheduler.get_block_coord();
+        auto blk_coord = get_block_coord(params, tile_scheduler);
 
         auto logical_problem_shape = apply_batch(params,
             params.problem_shape, get<2,1>(blk_coord));
@@ -460,6 +549,10 @@ struct Sm100FmhaGenKernelWarpspecialized {
           continue;
         }
 
+        if (is_empty_split(params, logical_problem_shape, blk_coord)) {
+          continue;
+        }
+
         mainloop.correction(
           blk_coord,
           params.mainloop, logical_problem_shape,
@@ -490,7 +583,7 @@ struct Sm100FmhaGenKernelWarpspecialized {
 
       CUTLASS_PRAGMA_NO_UNROLL
       for (; tile_scheduler.is_valid(); ++tile_scheduler) {
-        auto blk_coord = tile_scheduler.get_block_coord();
+        auto blk_coord = get_block_coord(params, tile_scheduler);
 
         auto logical_problem_shape = apply_batch(params,
             params.problem_shape, get<2,1>(blk_coord));
@@ -499,6 +592,10 @@ struct Sm100FmhaGenKernelWarpspecialized {
           continue;
         }
 
+        if (is_empty_split(params, logical_problem_shape, blk_coord)) {
+          continue;
+        }
+
 
         mainloop.mma(
           blk_coord,
@@ -519,7 +616,7 @@ struct Sm100FmhaGenKernelWarpspecialized {
 
       CUTLASS_PRAGMA_NO_UNROLL
       for (; tile_scheduler.is_valid(); ++tile_scheduler) {
-        auto blk_coord = tile_scheduler.get_block_coord();
+        auto blk_coord = get_block_coord(params, tile_scheduler);
 
         auto logical_problem_shape = apply_batch(params,
             params.problem_shape, get<2,1>(blk_coord));
@@ -528,6 +625,10 @@ struct Sm100FmhaGenKernelWarpspecialized {
           continue;
         }
 
+        if (is_empty_split(params, logical_problem_shape, blk_coord)) {
+          continue;
+        }
+
         mainloop.load(
           blk_coord, logical_problem_shape,
           params.mainloop, params.problem_shape,
@@ -543,7 +644,7 @@ struct Sm100FmhaGenKernelWarpspecialized {
 
       CUTLASS_PRAGMA_NO_UNROLL
       for (; tile_scheduler.is_valid(); ++tile_scheduler) {
-        auto blk_coord = tile_scheduler.get_block_coord();
+        auto blk_coord = get_block_coord(params, tile_scheduler);
 
         auto logical_problem_shape = apply_batch(params,
             params.problem_shape, get<2,1>(blk_coord));
@@ -552,6 +653,10 @@ struct Sm100FmhaGenKernelWarpspecialized {
           continue;
         }
 
+        if (is_empty_split(params, logical_problem_shape, blk_coord)) {
+          continue;
+        }
+
         epilogue.store(
           blk_coord, logical_problem_shape,
           params.epilogue, params.problem_shape,
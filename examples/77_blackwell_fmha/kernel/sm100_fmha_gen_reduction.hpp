@@ -0,0 +1,198 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/arch/arch.h"
+#include "cute/tensor.hpp"
+
+namespace cutlass::fmha::kernel {
+
+using namespace cute;
+
+// Combines the split-kv partial results of Sm100FmhaGenKernelWarpspecialized.
+// Every split holds a normalized O and the base-2 log-sum-exp of its scores,
+// one CTA merges all splits of one query head.
+template<
+    class ElementOut,
+    class ElementAcc,
+    class ProblemShape,
+    class StrideO,
+    class StrideOAcc,
+    class StrideLSEAcc,
+    int kMaxSplits_
+>
+struct Sm100FmhaGenReductionKernel {
+
+  static const int SharedStorageSize = 0;
+  static const int MaxThreadsPerBlock = 128;
+  static const int MinBlocksPerMultiprocessor = 1;
+  static const int kMaxSplits = kMaxSplits_;
+
+  using ArchTag = cutlass::arch::Sm100;
+
+  struct Arguments {
+    // QG, max_seqlen_k, head_dim, ((1, h_kv), b), as used by the gen kernel
+    ProblemShape problem_shape;
+    const int* seqlen_kv = nullptr;
+    // the new token extends each sequence by one
+    bool has_new = false;
+
+    ElementAcc* ptr_o_acc = nullptr;
+    StrideOAcc dOAcc;
+    ElementAcc* ptr_lse_acc = nullptr;
+    StrideLSEAcc dLSEAcc;
+    ElementOut* ptr_o = nullptr;
+    StrideO dO;
+
+    int split_kv = 1;
+    int tile_shape_kv = 128;
+  };
+  using Params = Arguments;
+
+  static Params to_underlying_arguments(Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  static size_t get_workspace_size(Arguments const& /*args*/) {
+    return 0;
+  }
+
+  static Status initialize_workspace(
+      Arguments const& /*args*/, void* /*ws*/, cudaStream_t /*stream*/) {
+    return Status::kSuccess;
+  }
+
+  static dim3 get_grid_shape(Params const& params) {
+    return dim3(get<0>(params.problem_shape), size<3,0>(params.problem_shape), size<3,1>(params.problem_shape));
+  }
+
+  static dim3 get_block_shape() {
+    return dim3(MaxThreadsPerBlock, 1, 1);
+  }
+
+  static bool can_implement(Arguments const& args) {
+    if (args.split_kv <= 0) return false;
+    if (args.split_kv > kMaxSplits) return false;
+    return true;
+  }
+
+  CUTLASS_DEVICE void operator() (Params const& params, char* smem_raw) {
+    if (params.split_kv <= 1) return;
+
+    auto head_coord = make_coord(static_cast<int>(blockIdx.y), static_cast<int>(blockIdx.z));
+
+    int seqlen_kv = get<1>(params.problem_shape);
+    if (params.seqlen_kv != nullptr) {
+      seqlen_kv = params.seqlen_kv[blockIdx.z] + (params.has_new ? 1 : 0);
+    }
+    // same partitioning as the gen kernel, splits without tiles are never written
+    int k_tile_total = ceil_div(seqlen_kv, params.tile_shape_kv);
+    int local_split_kv = ceil_div(k_tile_total, ceil_div(k_tile_total, params.split_kv));
+
+    // with a single split the gen kernel already wrote O
+    if (local_split_kv <= 1) return;
+
+    __shared__ ElementAcc sLseScale[kMaxSplits];
+
+    Tensor mLSEacc = make_tensor(make_gmem_ptr(params.ptr_lse_acc),
+        make_shape(get<0>(params.problem_shape), get<3>(params.problem_shape), params.split_kv), params.dLSEAcc);
+    Tensor gLSEacc = mLSEacc(blockIdx.x, head_coord, _);
+
+    int warp_idx = cutlass::canonical_warp_idx_sync();
+    if (warp_idx == 0) {
+      constexpr int kNLsePerThread = cute::ceil_div(kMaxSplits, 32);
+
+      ElementAcc local_lse[kNLsePerThread];
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kNLsePerThread; ++i) {
+        const int split = i * 32 + threadIdx.x;
+        local_lse[i] = split < local_split_kv ? gLSEacc(split) : -std::numeric_limits<ElementAcc>::infinity();
+      }
+
+      ElementAcc lse_max = -std::numeric_limits<ElementAcc>::infinity();
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kNLsePerThread; ++i) {
+        lse_max = fmax(local_lse[i], lse_max);
+      }
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int offset = 16; offset >= 1; offset /= 2) {
+        lse_max = fmax(__shfl_xor_sync(0xffffffff, lse_max, offset), lse_max);
+      }
+
+      lse_max = __shfl_sync(0xffffffff, lse_max, 0);
+
+      ElementAcc sum_lse = 0;
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kNLsePerThread; ++i) {
+        sum_lse = sum_lse + exp2f(local_lse[i] - lse_max);
+      }
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int offset = 16; offset >= 1; offset /= 2) {
+        sum_lse = sum_lse + __shfl_xor_sync(0xffffffff, sum_lse, offset);
+      }
+
+      sum_lse = __shfl_sync(0xffffffff, sum_lse, 0);
+
+      ElementAcc global_lse = (sum_lse == 0.f || sum_lse != sum_lse) ? std::numeric_limits<ElementAcc>::infinity() : log2f(sum_lse) + lse_max;
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kNLsePerThread; ++i) {
+        const int split = i * 32 + threadIdx.x;
+        if (split < local_split_kv) {
+          sLseScale[split] = exp2f(local_lse[i] - global_lse);
+        }
+      }
+    }
+    __syncthreads();
+
+    Tensor mOacc = make_tensor(make_gmem_ptr(params.ptr_o_acc),
+        append<4>(select<0,2,3>(params.problem_shape), params.split_kv), params.dOAcc);
+    Tensor gOacc = mOacc(blockIdx.x, _, head_coord, _);
+    Tensor mO = make_tensor(make_gmem_ptr(params.ptr_o), select<0,2,3>(params.problem_shape), params.dO);
+    Tensor gO = mO(blockIdx.x, _, head_coord);
+
+    for (int i = threadIdx.x; i < size(gO); i += MaxThreadsPerBlock) {
+      ElementAcc local_val = 0;
+      for (int split = 0; split < local_split_kv; ++split) {
+        local_val += sLseScale[split] * gOacc(i, split);
+      }
+      gO(i) = static_cast<ElementOut>(local_val);
+    }
+  }
+};
+
+}  // namespace cutlass::fmha::kernel
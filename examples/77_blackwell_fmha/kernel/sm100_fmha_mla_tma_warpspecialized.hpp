@@ -269,6 +269,10 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
     Stride<_1, int> stride_page_table = {};
     int page_count = 0;
     int page_size = TileShapeS{};  // powers of two if kIsCpAsync, otherwise TileShapeS
+
+    // optional per batch dequantization factor of a quantized (e.g. FP8) kv cache
+    // it covers c_latent and k_rope alike, as both feed the same S accumulator
+    ElementAcc const* ptr_scale_kv = nullptr;
   };
   
   struct EpilogueArguments {
@@ -1862,7 +1866,7 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
 
       copy(tiled_t2r, tTR_tAcc, tTR_rAcc);
 
-      cutlass::epilogue::thread::LinearCombination<ElementOutAcc, 1, ElementAcc, ElementAcc, cutlass::epilogue::thread::ScaleType::OnlyAlphaScaling> epilogue_op({epilogue_args.output_scale / row_sum});
+      cutlass::epilogue::thread::LinearCombination<ElementOutAcc, 1, ElementAcc, ElementAcc, cutlass::epilogue::thread::ScaleType::OnlyAlphaScaling> epilogue_op({epilogue_args.output_scale * kv_scale(mainloop_args, cta_coord) / row_sum});
       CUTLASS_PRAGMA_UNROLL
       for (int i = 0; i < size(tTR_rAcc); i++) {
         tTR_rO_frag(i) = epilogue_op(tTR_rAcc(i));
@@ -1905,7 +1909,7 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
 
       copy(tiled_t2r, tTR_tAcc, tTR_rAcc);
 
-      cutlass::epilogue::thread::LinearCombination<ElementOut, 1, ElementAcc, ElementAcc, cutlass::epilogue::thread::ScaleType::OnlyAlphaScaling> epilogue_op({epilogue_args.output_scale / row_sum});
+      cutlass::epilogue::thread::LinearCombination<ElementOut, 1, ElementAcc, ElementAcc, cutlass::epilogue::thread::ScaleType::OnlyAlphaScaling> epilogue_op({epilogue_args.output_scale * kv_scale(mainloop_args, cta_coord) / row_sum});
       CUTLASS_PRAGMA_UNROLL
       for (int i = 0; i < size(tTR_rAcc); i++) {
         tTR_rO_frag(i) = epilogue_op(tTR_rAcc(i));
@@ -2025,7 +2029,7 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
     CUTE_STATIC_ASSERT_V(shape<2>(tOtO) == _1{});
 
     using EpilogueLinearCombination = cutlass::epilogue::thread::LinearCombination<ElementOut, 1, ElementAcc, ElementAcc, cutlass::epilogue::thread::ScaleType::OnlyAlphaScaling>;
-    EpilogueLinearCombination epilogue_op({epilogue_args.output_scale / row_sum * lse_scale});
+    EpilogueLinearCombination epilogue_op({epilogue_args.output_scale * kv_scale(mainloop_args, blk_coord) / row_sum * lse_scale});
 
     CUTLASS_PRAGMA_UNROLL
     for(int k = 0; k < IterationsPV_N; ++k) {
@@ -2073,11 +2077,17 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
     }
   }
 
+  // dequantization factor of the kv cache for the batch get<2>(blk_coord), 1 if not quantized
+  template<class BlkCoord>
+  CUTLASS_DEVICE static ElementAcc kv_scale(MainloopArguments const& mainloop_args, BlkCoord const& blk_coord) {
+    return mainloop_args.ptr_scale_kv == nullptr ? ElementAcc(1) : mainloop_args.ptr_scale_kv[get<2>(blk_coord)];
+  }
+
   template<class CtaCoord>
   CUTLASS_DEVICE void compute(
       CtaCoord const& cta_coord,
       ProblemShape const& problem_shape,
-      MainloopArguments const& mainloop_args,
+      MainloopArguments const& mainloop_params,
       EpilogueParams const& epilogue_args,
       TensorStorage& shared_tensors,
       PipelineS& pipeline_mma_s,
@@ -2107,6 +2117,11 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
     }
     int k_index_final = k_tile_total - 1;
 
+    // the kv dequantization factor multiplies S, so it folds into the softmax scale (and the lse);
+    // the output side is applied with output_scale in the epilogues
+    MainloopArguments mainloop_args = mainloop_params;
+    mainloop_args.softmax_scale *= kv_scale(mainloop_params, cta_coord);
+
     ElementAcc row_max = -std::numeric_limits<ElementAcc>::infinity();
     ElementAcc row_sum = 0;
     ElementAcc correction_factor = 1;
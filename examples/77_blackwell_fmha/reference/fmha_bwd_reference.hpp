@@ -96,10 +96,22 @@ void __global__ fmha_bwd_reference_dQ_kernel(
         auto id = make_identity_tensor(make_shape(1, 1));
         auto frag = make_tensor<ElementAcc>(Shape<_1, _1>{});
         frag(0) = acc_qk;
-        fusion.apply_mask(frag, make_tensor(id.data() + make_arithmetic_tuple(idx_Q, idx_K), id.layout()), problem_shape);
+        auto index_qk = make_tensor(id.data() + make_arithmetic_tuple(idx_Q, idx_K), id.layout());
+        ElementAcc score_mod_grad = 1;
+        if constexpr (has_score_mod_v<Fusion>) {
+          fusion.apply_score_mod(frag, index_qk, problem_shape, idx_L % int(size<4,0>(problem_shape_in)), softmax_scale);
+          score_mod_grad = fusion.score_mod_grad(frag(0), softmax_scale);
+        }
+        fusion.apply_mask(frag, index_qk, problem_shape);
         acc_qk = frag(0);
+        // dP only flows through the kept elements of P
+        ElementAcc dropout_scale = 1;
+        if constexpr (has_dropout_v<Fusion>) {
+          int num_heads = size<4,0>(problem_shape_in);
+          dropout_scale = fusion.is_kept(idx_Q, idx_K, idx_L / num_heads, idx_L % num_heads) ? fusion.rp_dropout() : 0;
+        }
 
-        mS[idx_K] = static_cast<Element>(expf(softmax_scale * acc_qk - mLSE(idx_Q, idx_L)) * softmax_scale * (acc_dov - acc_doo));
+        mS[idx_K] = static_cast<Element>(expf(softmax_scale * acc_qk - mLSE(idx_Q, idx_L)) * softmax_scale * (acc_dov * dropout_scale - acc_doo) * score_mod_grad);
       }  // for idx_K
 
       __syncthreads();
@@ -188,10 +200,20 @@ void __global__ fmha_bwd_reference_dK_kernel(
           auto id = make_identity_tensor(make_shape(1, 1));
           auto frag = make_tensor<ElementAcc>(Shape<_1, _1>{});
           frag(0) = acc_qk;
-          fusion.apply_mask(frag, make_tensor(id.data() + make_arithmetic_tuple(idx_Q, idx_K), id.layout()), problem_shape);
+          auto index_qk = make_tensor(id.data() + make_arithmetic_tuple(idx_Q, idx_K), id.layout());
+          ElementAcc score_mod_grad = 1;
+          if constexpr (has_score_mod_v<Fusion>) {
+            fusion.apply_score_mod(frag, index_qk, problem_shape, idx_H_R + H_R * idx_H_K, softmax_scale);
+            score_mod_grad = fusion.score_mod_grad(frag(0), softmax_scale);
+          }
+          fusion.apply_mask(frag, index_qk, problem_shape);
           acc_qk = frag(0);
+          ElementAcc dropout_scale = 1;
+          if constexpr (has_dropout_v<Fusion>) {
+            dropout_scale = fusion.is_kept(idx_Q, idx_K, idx_B, idx_H_R + H_R * idx_H_K) ? fusion.rp_dropout() : 0;
+          }
 
-          mS[idx_Q] = static_cast<Element>(expf(softmax_scale * acc_qk - mLSE(idx_Q, coord_HB)) * softmax_scale * (acc_dov - acc_doo));
+          mS[idx_Q] = static_cast<Element>(expf(softmax_scale * acc_qk - mLSE(idx_Q, coord_HB)) * softmax_scale * (acc_dov * dropout_scale - acc_doo) * score_mod_grad);
         }  // for idx_Q
 
         __syncthreads();
@@ -279,10 +301,18 @@ void __global__ fmha_bwd_reference_dV_kernel(
           auto id = make_identity_tensor(make_shape(1, 1));
           auto frag = make_tensor<ElementAcc>(Shape<_1, _1>{});
           frag(0) = acc_qk;
-          fusion.apply_mask(frag, make_tensor(id.data() + make_arithmetic_tuple(idx_Q, idx_K), id.layout()), problem_shape);
+          auto index_qk = make_tensor(id.data() + make_arithmetic_tuple(idx_Q, idx_K), id.layout());
+          if constexpr (has_score_mod_v<Fusion>) {
+            fusion.apply_score_mod(frag, index_qk, problem_shape, idx_H_R + H_R * idx_H_K, softmax_scale);
+          }
+          fusion.apply_mask(frag, index_qk, problem_shape);
           acc_qk = frag(0);
+          ElementAcc dropout_scale = 1;
+          if constexpr (has_dropout_v<Fusion>) {
+            dropout_scale = fusion.is_kept(idx_Q, idx_K, idx_B, idx_H_R + H_R * idx_H_K) ? fusion.rp_dropout() : 0;
+          }
 
-          mS[idx_Q] = static_cast<Element>(expf(softmax_scale * acc_qk - mLSE(idx_Q, coord_HB)));
+          mS[idx_Q] = static_cast<Element>(expf(softmax_scale * acc_qk - mLSE(idx_Q, coord_HB)) * dropout_scale);
         }  // for idx_Q
 
         __syncthreads();
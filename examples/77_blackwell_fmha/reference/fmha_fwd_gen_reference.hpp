@@ -49,7 +49,8 @@ void __global__ fmha_fwd_gen_reference_kernel(
     ProblemShape problem_shape,
     const int* seqlen_kv, const int* cache_batch_idx, 
     TensorQ mQ, TensorNewK mNewK, TensorNewV mNewV,
-    TensorCacheK mCacheK, TensorCacheV mCacheV, TensorO mO) {
+    TensorCacheK mCacheK, TensorCacheV mCacheV, TensorO mO,
+    const float* scale_k, const float* scale_v) {
 
   using namespace cute;
   extern __shared__ char mS_mem[];
@@ -78,6 +79,8 @@ void __global__ fmha_fwd_gen_reference_kernel(
       int idx_h = idx_h_qo + size<3,0,0>(problem_shape) * idx_h_kv;
       for (int idx_b = blockIdx.z; idx_b < size<3,1>(problem_shape); idx_b += gridDim.z) {
         int idx_b_kv = cache_batch_idx != nullptr ? cache_batch_idx[idx_b] : idx_b;
+        ElementAcc head_scale_k = scale_k != nullptr ? scale_k[idx_h_kv] : 1.0f;
+        ElementAcc head_scale_v = scale_v != nullptr ? scale_v[idx_h_kv] : 1.0f;
         const int kDim = 128;
         ElementAcc reg_o[kDim] = {0};
         ElementAcc row_max = -INFINITY;
@@ -89,6 +92,7 @@ void __global__ fmha_fwd_gen_reference_kernel(
             ElementAcc eK = tK(idx_d);
             reg_s += eQ * eK;
           }
+          reg_s *= head_scale_k;
 
           ElementAcc old_row_max = row_max;
           row_max = std::max(row_max, reg_s);
@@ -143,7 +147,7 @@ void __global__ fmha_fwd_gen_reference_kernel(
         __syncthreads();
 
         for (int idx_d = 0; idx_d < kDim; idx_d++) {
-          reg_o[idx_d] /= row_sum;
+          reg_o[idx_d] *= head_scale_v / row_sum;
           atomicAdd(&mS[idx_d], reg_o[idx_d]);
         }
 
@@ -170,7 +174,8 @@ void fmha_fwd_gen_reference(
     ProblemShape problem_shape,
     const int* seqlen_kv, const int* cache_batch_idx, 
     TensorQ mQ, TensorNewK mNewK, TensorNewV mNewV,
-    TensorCacheK mCacheK, TensorCacheV mCacheV, TensorO mO) {
+    TensorCacheK mCacheK, TensorCacheV mCacheV, TensorO mO,
+    const float* scale_k = nullptr, const float* scale_v = nullptr) {
 
   using namespace cute;
 
@@ -180,6 +185,6 @@ void fmha_fwd_gen_reference(
   assert(get<2>(problem_shape) == 128);
   fmha_fwd_gen_reference_kernel<ElementAcc><<<grid, block, shared_mem>>>(
       problem_shape, seqlen_kv, cache_batch_idx,
-      mQ, mNewK, mNewV, mCacheK, mCacheV, mO
+      mQ, mNewK, mNewV, mCacheK, mCacheV, mO, scale_k, scale_v
   );
 }
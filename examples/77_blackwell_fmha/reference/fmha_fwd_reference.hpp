@@ -80,7 +80,7 @@ void __global__ fmha_reference_kernel(
       int head_qk = 0;
       int head_v = 0;
       if constexpr (rank_v<decltype(get<2>(problem_shape))> == 2) {
-        // MLA case: head_qk 192, head_v = 128
+        // MLA or split head dim: (head_v, head_qk - head_v), e.g. head_qk 192, head_v = 128
         head_qk = size<2, 0>(problem_shape) + size<2, 1>(problem_shape);
         head_v = size<2, 0>(problem_shape);
       } else {
@@ -101,7 +101,7 @@ void __global__ fmha_reference_kernel(
       }
 
       if (get<1>(problem_shape) == 0) {
-        for (int idx_D = threadIdx.x; idx_D < head_qk; idx_D += blockDim.x) {
+        for (int idx_D = threadIdx.x; idx_D < head_v; idx_D += blockDim.x) {
           mO(idx_Q + offset_Q, idx_D, idx_L) = Element(0);
         }
 
@@ -120,7 +120,11 @@ void __global__ fmha_reference_kernel(
         }
         auto frag = make_tensor<ElementAccumulator>(Shape<_1, _1>{});
         frag(0) = acc;
-        mask.apply_mask(frag, make_tensor(id.data() + make_arithmetic_tuple(idx_Q, idx_K), id.layout()), problem_shape);
+        auto index_qk = make_tensor(id.data() + make_arithmetic_tuple(idx_Q, idx_K), id.layout());
+        if constexpr (has_score_mod_v<Mask>) {
+          mask.apply_score_mod(frag, index_qk, problem_shape, idx_L % int(size<4,0>(problem_shape_in)), softmax_scale);
+        }
+        mask.apply_mask(frag, index_qk, problem_shape);
         mS[idx_K] = frag(0);
       }
 
@@ -147,6 +151,18 @@ void __global__ fmha_reference_kernel(
 
       ElementAccumulator scale = 1.0f / sum;
 
+      if constexpr (has_dropout_v<Mask>) {
+        int num_heads = size<4,0>(problem_shape_in);
+        __syncthreads();
+        for (int idx_K = threadIdx.x; idx_K < size<1>(problem_shape); idx_K += blockDim.x) {
+          if (! mask.is_kept(idx_Q, idx_K, idx_L / num_heads, idx_L % num_heads)) {
+            mS[idx_K] = 0;
+          }
+        }
+        __syncthreads();
+        scale *= mask.rp_dropout();
+      }
+
 
       for (int idx_D = threadIdx.x; idx_D < head_v; idx_D += blockDim.x) {
         ElementAccumulator acc = 0;
@@ -206,3 +222,40 @@ void fmha_reference(
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class TensorX, class TensorY>
+void __global__ fmha_rope_reference_kernel(TensorX mX, TensorY mY, double rope_theta) {
+
+  using namespace cute;
+
+  using Element = typename TensorY::value_type;
+
+  int half_d = size<1>(mX) / 2;
+
+  for (int idx_L = blockIdx.y; idx_L < size<2>(mX); idx_L += gridDim.y) {
+    for (int idx_S = blockIdx.x; idx_S < size<0>(mX); idx_S += gridDim.x) {
+      for (int idx_D = threadIdx.x; idx_D < half_d; idx_D += blockDim.x) {
+        double angle = idx_S * pow(rope_theta, -2.0 * idx_D / size<1>(mX));
+        double x0 = mX(idx_S, idx_D, idx_L);
+        double x1 = mX(idx_S, idx_D + half_d, idx_L);
+        mY(idx_S, idx_D, idx_L) = static_cast<Element>(x0 * cos(angle) - x1 * sin(angle));
+        mY(idx_S, idx_D + half_d, idx_L) = static_cast<Element>(x1 * cos(angle) + x0 * sin(angle));
+      }
+    }
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// rotates the pairs (d, d + D/2) of the rows of mX (S, D, L) by the angle of the row index
+template<class TensorX, class TensorY>
+void fmha_rope_reference(TensorX mX, TensorY mY, double rope_theta) {
+
+  using namespace cute;
+
+  dim3 grid(size<0>(mX), size<2>(mX), 1);
+  dim3 block(128);
+  fmha_rope_reference_kernel<<<grid, block>>>(mX, mY, rope_theta);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -52,7 +52,7 @@ void __global__ fmha_mla_reference_kernel(
     TensorQL mQL, TensorQR mQR,
     TensorCL mCL, TensorKR mKR,
     TensorO mO, TensorLSE mLSE,
-    Scale softmax_scale) {
+    Scale softmax_scale, float const* scale_kv) {
 
   using namespace cute;
 
@@ -69,6 +69,7 @@ void __global__ fmha_mla_reference_kernel(
     if (mSeq.data() != nullptr) {
       K = mSeq(idx_B);
     }
+    ElementAcc kv_scale = scale_kv != nullptr ? scale_kv[idx_B] : 1.0f;
 
     for (int idx_H = blockIdx.x; idx_H < H; idx_H += gridDim.x) {
 
@@ -98,7 +99,7 @@ void __global__ fmha_mla_reference_kernel(
           ElementAcc eK = mKR(page_idx_K, idx_D, page_idx_B);
           acc += eQ * eK;
         }
-        mS[idx_K] = acc;
+        mS[idx_K] = acc * kv_scale;
       }
 
       __syncthreads();
@@ -122,7 +123,7 @@ void __global__ fmha_mla_reference_kernel(
         sum += mS[idx_K];
       }
 
-      ElementAcc o_scale = 1.0f / sum;
+      ElementAcc o_scale = kv_scale / sum;
 
       for (int idx_D = threadIdx.x; idx_D < D_latent; idx_D += blockDim.x) {
         ElementAcc acc = 0;
@@ -168,7 +169,7 @@ void fmha_mla_reference(
     TensorQL mQL, TensorQR mQR,
     TensorCL mCL, TensorKR mKR,
     TensorO mO, TensorLSE mLSE,
-    Scale scale) {
+    Scale scale, float const* scale_kv = nullptr) {
 
   using namespace cute;
 
@@ -192,7 +193,7 @@ void fmha_mla_reference(
     }    
   }
   fmha_mla_reference_kernel<<<grid, block, shared_mem>>>(
-      problem_shape, mSeq, mPT, mQL, mQR, mCL, mKR, mO, mLSE, scale);
+      problem_shape, mSeq, mPT, mQL, mQR, mCL, mKR, mO, mLSE, scale, scale_kv);
   cudaDeviceSynchronize();
   result = cudaGetLastError();
   if (cudaSuccess != result) {
@@ -86,6 +86,11 @@ struct DeviceAllocation {
     auto ret = cudaMemcpy(ptr_, ptr, sz * sizeof(T), cudaMemcpyDefault);
     assert(ret == cudaSuccess);
   }
+
+  void copy_to_host(T* ptr, size_t sz) const {
+    auto ret = cudaMemcpy(ptr, ptr_, sz * sizeof(T), cudaMemcpyDefault);
+    assert(ret == cudaSuccess);
+  }
 };
 
 template<typename Element>
@@ -116,6 +116,7 @@
 #include "cutlass/experimental/distributed/device/dist_gemm_universal_wrapper.hpp"
 #include "cutlass/experimental/distributed/kernel/dist_gemm_kernel_wrapper.hpp"
 #include "cutlass/experimental/distributed/schedules/dist_gemm_1d_schedules.hpp"
+#include "cutlass/experimental/distributed/schedules/dist_gemm_2d_schedules.hpp"
 
 #include "helper.h"
 
@@ -145,8 +146,13 @@ static constexpr int TP_ = TP{};
 // * GEMM + Reduce Scatter:
 //   * ReduceScatter1D_TilingA_RotatingC
 //   * ReduceScatter1D_TilingB_RotatingC
+//
+// * All Gather + GEMM + Reduce Scatter on a 2-D mesh (TPAllGather x TPReduceScatter == TP):
+//   * AllGatherReduceScatter2D_TilingCD_RotatingAC<TPAllGather, TPReduceScatter>
+//     (i.e. AllGatherReduceScatter2D_TilingCD_RotatingAC<_2, _4> for TP = 8)
 
 using DistSchedule = cutlass::distributed::schedules::AllGather1D_TilingCD_RotatingA<TP>;
+static_assert(typename DistSchedule::TP{} == TP_, "Distributed GEMM schedule must span TP devices.");
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 /// GEMM kernel configurations
@@ -222,6 +228,9 @@ using DistGemmKernel = cutlass::distributed::kernel::DistributedGemmKernelWrappe
   GemmKernel,
   DistSchedule
 >;
+// Reduce Scatter schedules can optionally exchange partial results in a narrower type with
+// per-block scales, i.e. DistributedGemmUniversalAdapter<DistGemmKernel, cutlass::float_e4m3_t>,
+// which only pays off when ElementD is wider than the compressed type.
 using DistGemm = cutlass::distributed::device::DistributedGemmUniversalAdapter<DistGemmKernel>;
 
 using StrideA = typename Gemm::GemmKernel::StrideA;
@@ -271,6 +280,7 @@ struct Options {
   int warmup_iterations = 10;
   int m = 16384, n = 106496, k = 16384, l = 1;
   float eps = 0.f;
+  int copy_sms = 0;
 
   // Parses the command line
   void parse(int argc, char const **args) {
@@ -290,6 +300,7 @@ struct Options {
     cmd.get_cmd_line_argument("iterations", iterations);
     cmd.get_cmd_line_argument("warmup-iterations", warmup_iterations);
     cmd.get_cmd_line_argument("eps", eps);
+    cmd.get_cmd_line_argument("copy-sms", copy_sms);
   }
 
   /// Prints the usage statement.
@@ -309,7 +320,9 @@ struct Options {
       << "  --iterations=<int>          Number of profiling iterations to perform (default: 100)\n"
       << "  --warmup-iterations=<int>   Number of warmup iterations prior to profiling (default: 10)\n"
       << "  --eps=<f32>                 Threshold for error compared to reference " 
-      << "GEMM (default: 0.0)\n\n";
+      << "GEMM (default: 0.0)\n"
+      << "  --copy-sms=<int>            Number of SMs copying rotating operands instead of copy engines "
+      << "(default: 0)\n\n";
 
     out
       << "\n\nExamples:\n\n"
@@ -657,7 +670,7 @@ int run(Options &options) {
     arguments_[device_idx] = dist_gemm_args_from_options(options, device_idx, stream_arr[device_idx]);
 
     // Using the arguments, query for extra workspace required for matrix multiplication computation
-    size_t workspace_size = DistGemm::get_workspace_size(arguments_, device_idx);
+    size_t workspace_size = DistGemm::get_workspace_size(arguments_, device_idx, options.copy_sms);
     size_t exclusive_workspace_size = DistGemm::get_exclusive_workspace_size();
 
     workspace_arr[device_idx] = cutlass::device_memory::allocation<uint8_t>(workspace_size);
@@ -692,7 +705,8 @@ int run(Options &options) {
           exclusive_workspace_ptr_arr,
           device_idx,
           stream_arr[device_idx],
-          launch_with_pdl
+          launch_with_pdl,
+          options.copy_sms
           ));
 
     cudaDeviceSynchronize();
@@ -70,6 +70,7 @@
 */
 
 #include <iostream>
+#include <random>
 
 #include "cute/tensor.hpp"
 
@@ -112,13 +113,23 @@ struct Options {
   bool causal;
   bool residual;
   bool bwd;
+  bool descale;
+  bool varlen;
+  float softcap;
+  bool alibi;
+  float dropout;
+  uint64_t dropout_seed;
+  int gqa;
 
   Options():
     help(false),
     error(false),
     b(16), h(16), q(1024), k(1024), d(128),
     iterations(3), verify(false),
-    causal(false), residual(false), bwd(false), verbose(false)
+    causal(false), residual(false), bwd(false), verbose(false),
+    descale(false), varlen(false),
+    softcap(0.0f), alibi(false),
+    dropout(0.0f), dropout_seed(0), gqa(1)
   { }
 
   // Parses the command line
@@ -165,6 +176,33 @@ struct Options {
     }
 
     bwd = cmd.check_cmd_line_flag("bwd");
+    descale = cmd.check_cmd_line_flag("descale");
+    varlen = cmd.check_cmd_line_flag("varlen");
+    if (varlen && bwd) {
+      std::cout << "Error: --bwd does not support --varlen\n";
+      std::exit(-1);
+    }
+    cmd.get_cmd_line_argument("softcap", softcap, defaults.softcap);
+    alibi = cmd.check_cmd_line_flag("alibi");
+    cmd.get_cmd_line_argument("dropout", dropout, defaults.dropout);
+    cmd.get_cmd_line_argument("dropout-seed", dropout_seed, defaults.dropout_seed);
+    if (dropout < 0 || dropout >= 1) {
+      std::cout << "Error: --dropout must be in [0, 1)\n";
+      std::exit(-1);
+    }
+    if (dropout > 0 && (softcap > 0 || alibi)) {
+      std::cout << "Error: --dropout is not instantiated with score modifications\n";
+      std::exit(-1);
+    }
+    cmd.get_cmd_line_argument("gqa", gqa, defaults.gqa);
+    if (gqa < 1 || h % gqa != 0) {
+      std::cout << "Error: --gqa must divide --h\n";
+      std::exit(-1);
+    }
+    if (gqa > 1 && (bwd || varlen || descale || softcap > 0 || alibi || dropout > 0)) {
+      std::cout << "Error: --gqa is only instantiated for the forward pass with uniform lengths, no descale and no score modifications\n";
+      std::exit(-1);
+    }
   }
 
   /// Prints the usage statement.
@@ -185,6 +223,18 @@ struct Options {
       << "  --verbose                   Print smem and execution time per kernel\n"
       << "  --mask=<no|residual|causal> Enables masking\n"
       << "  --bwd                       Runs the backwards pass\n"
+      << "  --descale                   Applies per-head Q and per-block K/V descale factors\n"
+      << "                              (warp-specialized forward kernels only)\n"
+      << "  --varlen                    Samples a sequence length per batch around --q and --k\n"
+      << "                              and packs the batches (warp-specialized forward kernels only)\n"
+      << "  --softcap=<float>           Soft-caps the logits to (-softcap, softcap) with tanh\n"
+      << "  --alibi                     Adds the ALiBi bias with the standard per-head slopes\n"
+      << "                              (warp-specialized kernels only)\n"
+      << "  --dropout=<float>           Drops out P with the given probability, regenerating\n"
+      << "                              the mask in the backward pass (warp-specialized kernels only)\n"
+      << "  --dropout-seed=<int>        Sets the seed of the dropout random number generator\n"
+      << "  --gqa=<int>                 Q heads per KV head, packed into the rows of one head\n"
+      << "                              so they share the K/V tiles (warp-specialized forward kernels only)\n"
       << "\n";
 
     return out;
@@ -212,6 +262,32 @@ bool initialize_block(
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Sets the runtime state of the score modifications and dropout
+template<class Fusion>
+void initialize_score_mod(Fusion& fusion, cutlass::DeviceAllocation<float>& block_alibi_slopes, Options const& options) {
+  if constexpr (is_softcap_fusion_v<Fusion>) {
+    fusion.softcap = options.softcap;
+  }
+
+  if constexpr (is_alibi_fusion_v<Fusion>) {
+    // the slopes of the ALiBi paper, a geometric sequence starting at 2^(-8/H)
+    std::vector<float> slopes(options.h);
+    for (int h = 0; h < options.h; h++) {
+      slopes[h] = static_cast<float>(std::exp2(-8.0 * (h + 1) / options.h));
+    }
+    block_alibi_slopes.reset(slopes.size());
+    block_alibi_slopes.copy_from_host(slopes.data());
+    fusion.ptr_slopes = block_alibi_slopes.get();
+  }
+
+  if constexpr (is_dropout_fusion_v<Fusion>) {
+    fusion.p_dropout = options.dropout;
+    fusion.seed = options.dropout_seed;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
 struct ExampleResult {
   bool passed = false;
   bool verified = false;
@@ -244,8 +320,12 @@ struct FwdRunner {
 
   using ElementAccumulatorPV = float;
 
+  static constexpr bool kIsVarlen = find_option_t<Tag::kIsVariableLength, false_type, KernelOptions...>::value;
+
   // B H Q K D
-  using ProblemShapeType = cute::tuple<int, int, int, int, int>;
+  using ProblemShapeType = std::conditional_t<kIsVarlen,
+    cute::tuple<int, int, VariableLength, VariableLength, int>,
+    cute::tuple<int, int, int, int, int>>;
 
   
   using StrideQ = cute::tuple<int, _1, cute::tuple<int, int>>;  // Q D (B H)
@@ -263,10 +343,33 @@ struct FwdRunner {
       ActiveFusion, DispatchPolicy, KernelOptions...
     >::Kernel>;
 
+  static constexpr bool kSupportsDescale = ! std::is_same_v<DispatchPolicy, cutlass::gemm::KernelTma>;
+  // the Q heads of a KV head are packed into the rows of a single head
+  static constexpr bool kIsGqaPacked = has_runtime_mask_v<ActiveFusion>;
+  // K/V descale granularity of the warp-specialized mainloop
+  static constexpr int kDescaleBlockKV = get<1>(TileShape{});
+
   //
   // Data members
   //
 
+  bool descale = false;
+  int descale_blocks_K = 0;
+  cutlass::DeviceAllocation<float> block_descale_Q;
+  cutlass::DeviceAllocation<float> block_descale_K;
+  cutlass::DeviceAllocation<float> block_descale_V;
+
+  std::vector<int> cumulative_seqlen_q;
+  std::vector<int> cumulative_seqlen_kv;
+  cutlass::DeviceAllocation<int> device_cumulative_seqlen_q;
+  cutlass::DeviceAllocation<int> device_cumulative_seqlen_kv;
+
+  ActiveFusion fusion;
+  cutlass::DeviceAllocation<float> block_alibi_slopes;
+
+  // Q heads per KV head, K and V have H / heads_per_kv_head heads
+  int heads_per_kv_head = 1;
+
   /// Initialization
   StrideQ stride_Q;
   StrideK stride_K;
@@ -287,29 +390,65 @@ struct FwdRunner {
   // Methods
   //
   bool verify(const ProblemShapeType& problem_size) {
-    auto [B, H, Q, K, D] = problem_size;
-
-    Tensor mQ = make_tensor(make_gmem_ptr(block_Q.get()),
-      make_shape(Q, D, make_shape(B, H)),
-      stride_Q);
-
-    Tensor mK = make_tensor(make_gmem_ptr(block_K.get()),
-      make_shape(K, D, make_shape(B, H)),
-      stride_K);
-
-    Tensor mV = make_tensor(make_gmem_ptr(block_V.get()),
-      make_shape(K, D, make_shape(B, H)),
-      stride_V);
-
-    Tensor mO = make_tensor(make_gmem_ptr(block_ref_O.get()),
-      make_shape(Q, D, make_shape(B, H)),
-      stride_O);
+    int B = get<0>(problem_size);
+    int H = get<1>(problem_size);
+    int D = get<4>(problem_size);
+
+    // Runs the reference on num_batches batches starting at the given sequence offsets
+    auto run_reference = [&](int batch, int num_batches, int Q, int K, int offset_q, int offset_kv) {
+      auto problem = make_tuple(num_batches, H, Q, K, D);
+
+      Tensor mQ = make_tensor(make_gmem_ptr(block_Q.get() + offset_q * get<0>(stride_Q)),
+        make_shape(Q, D, make_shape(num_batches, H)),
+        stride_Q);
+
+      // Q head h reads KV head h / heads_per_kv_head
+      auto shape_KV = make_shape(K, D, make_shape(num_batches, make_shape(heads_per_kv_head, H / heads_per_kv_head)));
+      auto gqa_stride = [](auto const& stride) {
+        return make_stride(get<0>(stride), get<1>(stride), make_stride(get<2,0>(stride), make_stride(_0{}, get<2,1>(stride))));
+      };
+
+      Tensor mK = make_tensor(make_gmem_ptr(block_K.get() + offset_kv * get<0>(stride_K)), shape_KV, gqa_stride(stride_K));
+
+      Tensor mV = make_tensor(make_gmem_ptr(block_V.get() + offset_kv * get<0>(stride_V)), shape_KV, gqa_stride(stride_V));
+
+      Tensor mO = make_tensor(make_gmem_ptr(block_ref_O.get() + offset_q * get<0>(stride_O)),
+        make_shape(Q, D, make_shape(num_batches, H)),
+        stride_O);
+
+      Tensor mLSE = make_tensor(make_gmem_ptr(block_ref_LSE.get() + offset_q),
+        make_shape(Q, make_shape(num_batches, H)),
+        stride_LSE);
+
+      if (descale) {
+        // Expand the descale factors to one per row: (Seq, (B, H))
+        Tensor mDescaleQ = make_tensor(make_gmem_ptr(block_descale_Q.get() + batch * H),
+          make_shape(Q, make_shape(num_batches, H)),
+          make_stride(_0{}, make_stride(H, 1)));
+        auto layout_descale_KV = make_layout(
+          make_shape(make_shape(Int<kDescaleBlockKV>{}, descale_blocks_K), make_shape(num_batches, H)),
+          make_stride(make_stride(_0{}, 1), make_stride(H * descale_blocks_K, descale_blocks_K)));
+        Tensor mDescaleK = make_tensor(make_gmem_ptr(block_descale_K.get() + batch * H * descale_blocks_K), layout_descale_KV);
+        Tensor mDescaleV = make_tensor(make_gmem_ptr(block_descale_V.get() + batch * H * descale_blocks_K), layout_descale_KV);
+
+        fmha_reference(problem, mQ, mK, mV, mO, mLSE, fusion, mDescaleQ, mDescaleK, mDescaleV);
+      }
+      else {
+        fmha_reference(problem, mQ, mK, mV, mO, mLSE, fusion);
+      }
+    };
 
-    Tensor mLSE = make_tensor(make_gmem_ptr(block_ref_LSE.get()),
-      make_shape(Q, make_shape(B, H)),
-      stride_LSE);
+    if constexpr (kIsVarlen) {
+      for (int b = 0; b < B; b++) {
+        int offset_q = cumulative_seqlen_q[b];
+        int offset_kv = cumulative_seqlen_kv[b];
+        run_reference(b, 1, cumulative_seqlen_q[b + 1] - offset_q, cumulative_seqlen_kv[b + 1] - offset_kv, offset_q, offset_kv);
+      }
+    }
+    else {
+      run_reference(0, B, get<2>(problem_size), get<3>(problem_size), 0, 0);
+    }
 
-    fmha_reference(problem_size, mQ, mK, mV, mO, mLSE, ActiveFusion{});
     cudaError_t result = cudaDeviceSynchronize();
     if (result != cudaSuccess) {
       std::cerr << "Reference kernel failed. Last CUDA error: "
@@ -355,14 +494,76 @@ struct FwdRunner {
     stride = make_stride(_1{}, Q, make_stride(H*Q*D, Q*D));
   }
 
+  /// Samples a sequence length per batch and returns the packed problem shape
+  ProblemShapeType initialize_varlen(const Options& options) {
+    // generate Q and KV as --b times
+    //    gaussian (--q, --q / 2) and (--k, --k / 2) sampled positive
+    //    track cumulative
+    std::mt19937 rng(0x202305151552ull);
+    std::normal_distribution<double> dist_q(options.q, options.q / 2);
+    std::normal_distribution<double> dist_kv(options.k, options.k / 2);
+
+    auto generate_positive_int = [](auto& dist, auto& gen) {
+      int result = 0;
+      do {
+        result = static_cast<int>(dist(gen));
+      } while (result <= 0);
+      return result;
+    };
+
+    cumulative_seqlen_q = {0};
+    cumulative_seqlen_kv = {0};
+
+    int max_seqlen_q = 0;
+    int max_seqlen_kv = 0;
+
+    for (int i = 0; i < options.b; i++) {
+      int seqlen_q = generate_positive_int(dist_q, rng);
+      int seqlen_kv = generate_positive_int(dist_kv, rng);
+
+      max_seqlen_q = std::max(max_seqlen_q, seqlen_q);
+      max_seqlen_kv = std::max(max_seqlen_kv, seqlen_kv);
+
+      cumulative_seqlen_q.push_back(cumulative_seqlen_q.back() + seqlen_q);
+      cumulative_seqlen_kv.push_back(cumulative_seqlen_kv.back() + seqlen_kv);
+    }
+
+    int total_seqlen_q = cumulative_seqlen_q.back();
+    // The FP8 V is column-major, so its D stride (the total KV length) must stay 16B aligned
+    int total_seqlen_kv = cutlass::round_up(cumulative_seqlen_kv.back(), 16);
+
+    device_cumulative_seqlen_q.reset(cumulative_seqlen_q.size());
+    device_cumulative_seqlen_q.copy_from_host(cumulative_seqlen_q.data());
+    device_cumulative_seqlen_kv.reset(cumulative_seqlen_kv.size());
+    device_cumulative_seqlen_kv.copy_from_host(cumulative_seqlen_kv.data());
+
+    return ProblemShapeType{options.b, options.h,
+      VariableLength{max_seqlen_q, device_cumulative_seqlen_q.get(), total_seqlen_q},
+      VariableLength{max_seqlen_kv, device_cumulative_seqlen_kv.get(), total_seqlen_kv},
+      options.d};
+  }
+
   /// Initialize operands to be used in the GEMM and reference GEMM
   void initialize(const ProblemShapeType& problem_size) {
-    auto [B, H, Q, K, D] = problem_size;
-    D = cutlass::round_up(D, 8); // Alignment
+    int B = get<0>(problem_size);
+    int H = get<1>(problem_size);
+    int Q = get<2>(problem_size);
+    int K = get<3>(problem_size);
+    int D = cutlass::round_up(get<4>(problem_size), 8); // Alignment
+
+    // Variable-length batches are packed back to back into a single batch
+    int B_packed = B;
+    int Q_packed = Q;
+    int K_packed = K;
+    if constexpr (kIsVarlen) {
+      B_packed = 1;
+      Q_packed = get<2>(problem_size).total_length;
+      K_packed = get<3>(problem_size).total_length;
+    }
 
-    auto shape_QO = cute::make_shape(B, H, Q, D);
-    auto shape_KV = cute::make_shape(B, H, K, D);
-    auto shape_LSE = cute::make_shape(B, H, Q);
+    auto shape_QO = cute::make_shape(B_packed, H, Q_packed, D);
+    auto shape_KV = cute::make_shape(B_packed, H / heads_per_kv_head, K_packed, D);
+    auto shape_LSE = cute::make_shape(B_packed, H, Q_packed);
 
     initialize_stride(shape_QO, stride_Q);
     initialize_stride(shape_KV, stride_K);
@@ -370,6 +571,14 @@ struct FwdRunner {
     initialize_stride(shape_QO, stride_O);
     initialize_stride(shape_LSE, stride_LSE);
 
+    if constexpr (kIsVarlen) {
+      get<2,0>(stride_Q) = 0;
+      get<2,0>(stride_K) = 0;
+      get<2,0>(stride_V) = 0;
+      get<2,0>(stride_O) = 0;
+      get<1,0>(stride_LSE) = 0;
+    }
+
     block_Q.reset(size(shape_QO));
     block_K.reset(size(shape_KV));
     block_V.reset(size(shape_KV));
@@ -381,23 +590,79 @@ struct FwdRunner {
     initialize_block(block_Q, seed + 2023, false);
     initialize_block(block_K, seed + 2022, false);
     initialize_block(block_V, seed + 2021, false);
+
+    if (descale) {
+      // Powers of two no larger than one keep the reference exact and the outputs in range
+      descale_blocks_K = cutlass::ceil_div(K, kDescaleBlockKV);
+      auto fill_descale = [](cutlass::DeviceAllocation<float>& block, int count, int seed) {
+        std::vector<float> host(count);
+        for (int i = 0; i < count; i++) {
+          host[i] = ((i * 7 + seed) % 3 == 0) ? 0.5f : 1.0f;
+        }
+        block.reset(count);
+        block.copy_from_host(host.data());
+      };
+      fill_descale(block_descale_Q, B * H, 0);
+      fill_descale(block_descale_K, B * H * descale_blocks_K, 1);
+      fill_descale(block_descale_V, B * H * descale_blocks_K, 2);
+    }
   }
 
   ExampleResult run(const Options& options, const cutlass::KernelHardwareInfo& hw_info) {
-    ProblemShapeType problem_size = ProblemShapeType{options.b, options.h, options.q, options.k, options.d};
+    ProblemShapeType problem_size;
+    if constexpr (kIsVarlen) {
+      problem_size = initialize_varlen(options);
+    }
+    else {
+      problem_size = ProblemShapeType{options.b, options.h, options.q, options.k, options.d};
+    }
 
+    descale = options.descale && kSupportsDescale;
+    heads_per_kv_head = options.gqa;
+    initialize_score_mod(fusion, block_alibi_slopes, options);
     initialize(problem_size);
 
+    // With packed GQA the kernel sees one head of heads_per_kv_head * Q rows per KV head,
+    // with head-major Q, O and LSE that is just a larger head stride
+    auto problem_size_kernel = problem_size;
+    auto stride_Q_kernel = stride_Q;
+    auto stride_O_kernel = stride_O;
+    auto stride_LSE_kernel = stride_LSE;
+    if constexpr (kIsGqaPacked) {
+      fusion.seqlen_q = get<2>(problem_size);
+      get<1>(problem_size_kernel) = get<1>(problem_size) / heads_per_kv_head;
+      get<2>(problem_size_kernel) = get<2>(problem_size) * heads_per_kv_head;
+      get<2,1>(stride_Q_kernel) *= heads_per_kv_head;
+      get<2,1>(stride_O_kernel) *= heads_per_kv_head;
+      get<1,1>(stride_LSE_kernel) *= heads_per_kv_head;
+    }
+
     typename Operation::Arguments arguments{
-      problem_size,
-      { block_Q.get(), stride_Q,
+      problem_size_kernel,
+      { block_Q.get(), stride_Q_kernel,
         block_K.get(), stride_K,
         block_V.get(), stride_V },
-      { block_O.get(), stride_O,
-      block_LSE.get(), stride_LSE },
+      { block_O.get(), stride_O_kernel,
+      block_LSE.get(), stride_LSE_kernel },
       hw_info
     };
 
+    if constexpr (kSupportsDescale) {
+      if (descale) {
+        int H = get<1>(problem_size);
+        arguments.mainloop.ptr_descale_Q = block_descale_Q.get();
+        arguments.mainloop.dDescaleQ = make_stride(0, make_stride(H, 1));
+        arguments.mainloop.ptr_descale_K = block_descale_K.get();
+        arguments.mainloop.dDescaleK = make_stride(1, make_stride(H * descale_blocks_K, descale_blocks_K));
+        arguments.mainloop.ptr_descale_V = block_descale_V.get();
+        arguments.mainloop.dDescaleV = make_stride(1, make_stride(H * descale_blocks_K, descale_blocks_K));
+      }
+    }
+
+    if constexpr (has_score_mod_v<ActiveFusion> || has_dropout_v<ActiveFusion> || kIsGqaPacked) {
+      arguments.mainloop.fusion = fusion;
+    }
+
     Operation op;
 
     ExampleResult example_result;
@@ -494,11 +759,21 @@ struct FwdRunner {
 
     runtime_ms /= static_cast<float>(options.iterations);
 
-    double flops = 4.0 * (std::is_same_v<ActiveFusion, CausalFusion> ? 0.5 : 1.0);
-    flops *= static_cast<double>(get<0>(problem_size));
+    double flops = 4.0 * (std::is_base_of_v<CausalFusion, ActiveFusion> ? 0.5 : 1.0);
+    if constexpr (kIsVarlen) {
+      double attended = 0;
+      for (int b = 0; b < get<0>(problem_size); b++) {
+        attended += 1.0 * (cumulative_seqlen_q[b + 1] - cumulative_seqlen_q[b]) *
+                          (cumulative_seqlen_kv[b + 1] - cumulative_seqlen_kv[b]);
+      }
+      flops *= attended;
+    }
+    else {
+      flops *= static_cast<double>(get<0>(problem_size));
+      flops *= static_cast<double>(get<2>(problem_size));
+      flops *= static_cast<double>(get<3>(problem_size));
+    }
     flops *= static_cast<double>(get<1>(problem_size));
-    flops *= static_cast<double>(get<2>(problem_size));
-    flops *= static_cast<double>(get<3>(problem_size));
     flops *= static_cast<double>(get<4>(problem_size));
     double tflops_s = flops * 1e-12 /*tera*/ / (runtime_ms * 1e-3 /*ms*/);
     example_result.tflops_s = tflops_s;
@@ -594,6 +869,9 @@ struct BwdRunner {
   cutlass::DeviceAllocation<Element> block_ref_dK;
   cutlass::DeviceAllocation<Element> block_ref_dV;
 
+  ActiveFusion fusion;
+  cutlass::DeviceAllocation<float> block_alibi_slopes;
+
   //
   // Methods
   //
@@ -637,7 +915,7 @@ struct BwdRunner {
       make_stride(get<2>(stride_dO), get<3>(stride_dO), make_stride(get<0>(stride_dO), get<1>(stride_dO))));
 
 
-    fmha_bwd_reference(problem_size, mQ, mK, mV, mO, mLSE, mDO, mDQ, mDK, mDV, ActiveFusion{});
+    fmha_bwd_reference(problem_size, mQ, mK, mV, mO, mLSE, mDO, mDQ, mDK, mDV, fusion);
     cudaError_t result = cudaDeviceSynchronize();
     if (result != cudaSuccess) {
       std::cerr << "Reference kernel failed. Last CUDA error: "
@@ -732,12 +1010,13 @@ struct BwdRunner {
       make_shape(Q, make_shape(B, H)),
       make_stride(get<2>(stride_LSE), make_stride(get<0>(stride_LSE), get<1>(stride_LSE))));
 
-    fmha_reference(problem_size, mQ, mK, mV, mO, mLSE, ActiveFusion{});
+    fmha_reference(problem_size, mQ, mK, mV, mO, mLSE, fusion);
   }
 
   ExampleResult run(const Options& options, const cutlass::KernelHardwareInfo& hw_info) {
     ProblemShapeType problem_size = ProblemShapeType{options.b, options.h, options.q, options.k, options.d};
 
+    initialize_score_mod(fusion, block_alibi_slopes, options);
     initialize(problem_size);
 
     typename Operation::Arguments arguments{
@@ -751,7 +1030,8 @@ struct BwdRunner {
       block_dQ.get(), stride_dQ,
       block_dK.get(), stride_dK,
       block_dV.get(), stride_dV,
-      hw_info
+      hw_info,
+      fusion
     };
 
     Operation op;
@@ -854,7 +1134,7 @@ struct BwdRunner {
 
     runtime_ms /= static_cast<float>(options.iterations);
 
-    double flops = 10.0 * (std::is_same_v<ActiveFusion, CausalFusion> ? 0.5 : 1.0);
+    double flops = 10.0 * (std::is_base_of_v<CausalFusion, ActiveFusion> ? 0.5 : 1.0);
     flops *= static_cast<double>(get<0>(problem_size));
     flops *= static_cast<double>(get<1>(problem_size));
     flops *= static_cast<double>(get<2>(problem_size));
@@ -914,12 +1194,33 @@ using KernelPingpong = cutlass::gemm::KernelTmaWarpSpecializedPingpong;
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+template<class TileShape, class DispatchPolicy, class Fusion, class... KernelOptions>
+void run_fwd(const char* name, Options const & options, cutlass::KernelHardwareInfo const& hw_info) {
+  if constexpr ((has_score_mod_v<Fusion> || has_dropout_v<Fusion> || has_runtime_mask_v<Fusion>) && std::is_same_v<DispatchPolicy, KernelTma>) {
+    // Score modifications, dropout and packed GQA are only applied by the warp-specialized mainloop
+    return;
+  }
+  else if (options.varlen) {
+    // Variable sequence lengths need the persistent warp-specialized kernels
+    if constexpr (! std::is_same_v<DispatchPolicy, KernelTma> && ! has_runtime_mask_v<Fusion>) {
+      FwdRunner<TileShape, DispatchPolicy, Fusion, KernelOptions..., Option<Tag::kIsVariableLength, true_type>> runner;
+      auto result = runner.run(options, hw_info);
+      print_result(name, result, options.verbose);
+    }
+  }
+  else {
+    FwdRunner<TileShape, DispatchPolicy, Fusion, KernelOptions...> runner;
+    auto result = runner.run(options, hw_info);
+    print_result(name, result, options.verbose);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
 template<class Fusion>
 void run_fwd_32(Fusion fusion, Options const & options, cutlass::KernelHardwareInfo const& hw_info) {
   auto run = [&](auto shape, auto kernel, const char* name, auto... kernel_options) {
-    FwdRunner<decltype(shape), decltype(kernel), Fusion, decltype(kernel_options)...> runner;
-    auto result = runner.run(options, hw_info);
-    print_result(name, result, options.verbose);
+    run_fwd<decltype(shape), decltype(kernel), Fusion, decltype(kernel_options)...>(name, options, hw_info);
   };
 
   using HeadDim = _32;
@@ -933,9 +1234,7 @@ void run_fwd_32(Fusion fusion, Options const & options, cutlass::KernelHardwareI
 template<class Fusion>
 void run_fwd_64(Fusion fusion, Options const & options, cutlass::KernelHardwareInfo const& hw_info) {
   auto run = [&](auto shape, auto kernel, const char* name, auto... kernel_options) {
-    FwdRunner<decltype(shape), decltype(kernel), Fusion, decltype(kernel_options)...> runner;
-    auto result = runner.run(options, hw_info);
-    print_result(name, result, options.verbose);
+    run_fwd<decltype(shape), decltype(kernel), Fusion, decltype(kernel_options)...>(name, options, hw_info);
   };
 
   using HeadDim = _64;
@@ -950,9 +1249,7 @@ void run_fwd_64(Fusion fusion, Options const & options, cutlass::KernelHardwareI
 template<class Fusion>
 void run_fwd_128(Fusion fusion, Options const & options, cutlass::KernelHardwareInfo const& hw_info) {
   auto run = [&](auto shape, auto kernel, const char* name, auto... kernel_options) {
-    FwdRunner<decltype(shape), decltype(kernel), Fusion, decltype(kernel_options)...> runner;
-    auto result = runner.run(options, hw_info);
-    print_result(name, result, options.verbose);
+    run_fwd<decltype(shape), decltype(kernel), Fusion, decltype(kernel_options)...>(name, options, hw_info);
   };
 
   using HeadDim = _128;
@@ -970,9 +1267,7 @@ void run_fwd_128(Fusion fusion, Options const & options, cutlass::KernelHardware
 template<class Fusion>
 void run_fwd_256(Fusion fusion, Options const & options, cutlass::KernelHardwareInfo const& hw_info) {
   auto run = [&](auto shape, auto kernel, const char* name, auto... kernel_options) {
-    FwdRunner<decltype(shape), decltype(kernel), Fusion, decltype(kernel_options)...> runner;
-    auto result = runner.run(options, hw_info);
-    print_result(name, result, options.verbose);
+    run_fwd<decltype(shape), decltype(kernel), Fusion, decltype(kernel_options)...>(name, options, hw_info);
   };
 
   using HeadDim = _256;
@@ -1098,6 +1393,10 @@ int main_single(int argc, char const **args) {
 
   std::cout << "###### B " << options.b << " H " << options.h << " Q " << options.q << " K " << options.k << " D " << options.d << " ";
   std::cout << (options.bwd ? "Backward" : "Forward") << " " << (options.causal ? "Causal" : "Full") << " ";
+  if (options.softcap > 0) std::cout << "Softcap " << options.softcap << " ";
+  if (options.alibi) std::cout << "ALiBi ";
+  if (options.dropout > 0) std::cout << "Dropout " << options.dropout << " ";
+  if (options.gqa > 1) std::cout << "GQA " << options.gqa << " ";
   std::cout << "#SM " << hw_info.sm_count << std::endl;
 
   auto with_fusion = [&](auto fn) {
@@ -1110,8 +1409,36 @@ int main_single(int argc, char const **args) {
     }
   };
 
-  with_fusion([&](auto fusion) {
-    if (options.bwd) {
+  // score modifications are layered on top of the mask
+  auto with_score_mod = [&](auto fn) {
+    with_fusion([&](auto mask) {
+      using Mask = decltype(mask);
+      if (options.gqa > 1) {
+        fn(GqaPackedFusion<Mask>{});
+      } else if (options.softcap > 0 && options.alibi) {
+        fn(SoftcapFusion<AlibiFusion<Mask>>{});
+      } else if (options.softcap > 0) {
+        fn(SoftcapFusion<Mask>{});
+      } else if (options.alibi) {
+        fn(AlibiFusion<Mask>{});
+      } else if (options.dropout > 0) {
+        fn(DropoutFusion<Mask>{});
+      } else {
+        fn(mask);
+      }
+    });
+  };
+
+  with_score_mod([&](auto fusion) {
+    if constexpr (has_runtime_mask_v<decltype(fusion)>) {
+      // packed GQA is forward only
+      if (options.d <= 128) {
+        run_fwd_128(fusion, options, hw_info);
+      }
+      else {
+        std::cout << "No packed GQA kernel instantiated for d=" << options.d << std::endl;
+      }
+    } else if (options.bwd) {
 #ifndef FP8
       if (options.d <= 32) {
         run_bwd_32(fusion, options, hw_info);
@@ -55,6 +55,7 @@ struct FmhaBwdMainloopTmaWarpSpecialized {
   using TileShape = TileShape_;
 
   static constexpr bool kIsPersistent = false;
+  static constexpr bool kIsVariableLength = false;
 
   static const int NumLoadWarpGroups = 1;
   static constexpr int NumMmaWarpGroups = 2;
@@ -224,6 +225,9 @@ struct FmhaBwdMainloopTmaWarpSpecialized {
 
     ElementAccumulator* ptr_dQ;
     cute::tuple<int, int, int, _1> dDQ;
+
+    // runtime state of the fusion, e.g. the softcap
+    Fusion fusion = {};
   };
 
   using TMA_Q = typename CollectiveMmaNM::Params::TMA_B;
@@ -297,6 +301,8 @@ struct FmhaBwdMainloopTmaWarpSpecialized {
 
     float scale_softmax;
     float scale_softmax_log2;
+
+    Fusion fusion;
   };
 
   static_assert(size(TiledMmaNM{}) == size(TiledMmaND{}));
@@ -345,7 +351,8 @@ struct FmhaBwdMainloopTmaWarpSpecialized {
         tma_load_lse, tma_load_odo,
         tma_red_dq,
         1.0f / (float) std::sqrt(get<4>(problem_size)),
-        (float) (std::log2(std::exp(1.0)) / std::sqrt(get<4>(problem_size)))
+        (float) (std::log2(std::exp(1.0)) / std::sqrt(get<4>(problem_size))),
+        args.fusion
     };
   }
 
@@ -726,12 +733,27 @@ struct FmhaBwdMainloopTmaWarpSpecialized {
 
       math_wg_order_barrier.wait();
       // Compute S -> P
+      // the gradient of the score modifications is taken before masking, where S' is finite
+      auto acc_S_grad = make_fragment_like<ElementAccumulator>(acc_S);
+      if constexpr (has_score_mod_v<Fusion>) {
+        params.fusion.apply_score_mod(acc_S, tScS, problem_size, get<2,1>(blk_coord), params.scale_softmax);
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(acc_S); i++) {
+          acc_S_grad(i) = params.fusion.score_mod_grad(acc_S(i), params.scale_softmax);
+        }
+      }
       Fusion{}.before_softmax(acc_S, tScS, problem_size);
       auto acc_P = make_fragment_like<ElementAccumulator>(acc_S);
       CUTLASS_PRAGMA_UNROLL
       for (int i = 0; i < size(acc_P); i++) {
         acc_P(i) = ::exp2f(params.scale_softmax_log2 * acc_S(i) - reg_LSE(i));
       }
+      // dV takes P with the forward dropout mask regenerated, and dP only flows through its kept elements
+      auto acc_PD = make_fragment_like<ElementAccumulator>(acc_S);
+      if constexpr (has_dropout_v<Fusion>) {
+        copy(acc_P, acc_PD);
+        params.fusion.apply_dropout(acc_PD, tScS, get<2,0>(blk_coord), get<2,1>(blk_coord), params.fusion.rp_dropout());
+      }
       math_wg_order_barrier.arrive();
 
       if constexpr (decltype(get<0>(TileShape{}) == _128{})::value) {
@@ -748,11 +770,20 @@ struct FmhaBwdMainloopTmaWarpSpecialized {
       CUTLASS_PRAGMA_UNROLL
       for (int i = 0; i < size(acc_DS); i++) {
         // We could move the scale out and into the respective epilogues (or a final scaling step)
-        acc_DS(i) = acc_P(i) * params.scale_softmax * (acc_DP(i) - reg_ODO(i));
+        if constexpr (has_dropout_v<Fusion>) {
+          // sum(O dO) is taken over the dropped O, so dS = P (Z dP / (1 - p) - sum(O dO))
+          acc_DS(i) = params.scale_softmax * (acc_PD(i) * acc_DP(i) - acc_P(i) * reg_ODO(i));
+        }
+        else if constexpr (has_score_mod_v<Fusion>) {
+          acc_DS(i) = acc_P(i) * params.scale_softmax * (acc_DP(i) - reg_ODO(i)) * acc_S_grad(i);
+        }
+        else {
+          acc_DS(i) = acc_P(i) * params.scale_softmax * (acc_DP(i) - reg_ODO(i));
+        }
       }
 
       // GEMM PdO -> dV
-      auto op_P = make_acc_into_op<Element>(acc_P, typename TiledMmaND::LayoutA_TV{});
+      auto op_P = make_acc_into_op<Element>(conditional_return<has_dropout_v<Fusion>>(acc_PD, acc_P), typename TiledMmaND::LayoutA_TV{});
       warpgroup_fence_operand(acc_DV);
       warpgroup_fence_operand(op_P);
       warpgroup_arrive();
@@ -62,23 +62,27 @@ struct CollectiveLoadTma {
   CollectiveLoadTma(Params const& params, Pipeline& pipeline, SharedStorage& storage)
     : params(params), pipeline(pipeline), storage(storage) {}
 
+  // seq_offset is the first row of the sequence in a packed batch
   template<class ProblemSize, class TileShape, class BlockCoord>
   CUTLASS_DEVICE auto init_g(ProblemSize const& problem_size, TileShape const& tile_shape,
-      BlockCoord const& blk_coord, int loop_count
+      BlockCoord const& blk_coord, int loop_count, int seq_offset = 0
   ) {
     using X = Underscore;
     if constexpr (kKind == LoadKind::kK) {
-      Tensor mK_full = params.get_tma_tensor(make_shape(get<3>(problem_size), get<4>(problem_size), select<0,1>(problem_size)));
+      Tensor mK_full = domain_offset(make_coord(seq_offset, _0{}, make_coord(_0{}, _0{})),
+          params.get_tma_tensor(make_shape(get<3>(problem_size), get<4>(problem_size), select<0,1>(problem_size))));
       Tensor gK_full = local_tile(mK_full, tile_shape, make_coord(_, _, _), Step<X, _1, _1>{});
       Tensor gK = gK_full(_, _, _, _0{}, get<2>(blk_coord));
       return gK;
     } else if constexpr (kKind == LoadKind::kQ) {
-      Tensor mQ_full = params.get_tma_tensor(make_shape(get<2>(problem_size), get<4>(problem_size), select<0,1>(problem_size)));
+      Tensor mQ_full = domain_offset(make_coord(seq_offset, _0{}, make_coord(_0{}, _0{})),
+          params.get_tma_tensor(make_shape(get<2>(problem_size), get<4>(problem_size), select<0,1>(problem_size))));
       Tensor gQ_full = local_tile(mQ_full, tile_shape, make_coord(_, _, _), Step<_1, X, _1>{});
       Tensor gQ = gQ_full(_, _, _, _0{}, get<2>(blk_coord));
       return make_tensor(gQ.data() + loop_count * get<0>(blk_coord) * stride<2>(gQ), gQ.layout());
     } else if constexpr (kKind == LoadKind::kV) {
-      Tensor mV_full = params.get_tma_tensor(make_shape(get<4>(problem_size), get<3>(problem_size), select<0,1>(problem_size)));
+      Tensor mV_full = domain_offset(make_coord(_0{}, seq_offset, make_coord(_0{}, _0{})),
+          params.get_tma_tensor(make_shape(get<4>(problem_size), get<3>(problem_size), select<0,1>(problem_size))));
       Tensor gV_full = local_tile(mV_full, tile_shape, make_coord(_, _, _), Step<X, _1, _1>{});
       Tensor gV = gV_full(_, _, _0{}, _, get<2>(blk_coord));
       return gV;
@@ -103,9 +107,9 @@ struct CollectiveLoadTma {
   template<class ClusterRank, class ProblemSize, class TileShape, class BlockCoord>
   CUTLASS_DEVICE auto init_state(ClusterRank const& block_rank_in_cluster,
       ProblemSize const& problem_size, TileShape const& tile_shape,
-      BlockCoord const& block_coord, int loop_count
+      BlockCoord const& block_coord, int loop_count, int seq_offset = 0
   ) {
-    Tensor g = init_g(problem_size, tile_shape, block_coord, loop_count);
+    Tensor g = init_g(problem_size, tile_shape, block_coord, loop_count, seq_offset);
     Tensor s = make_tensor(make_smem_ptr(storage.data()), SmemLayout{});
   
     auto block_tma = params.get_slice(block_rank_in_cluster);
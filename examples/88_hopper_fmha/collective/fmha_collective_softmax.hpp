@@ -35,6 +35,7 @@
 #include "cute/tensor.hpp"
 
 #include "../collective/fmha_common.hpp"
+#include "../collective/fmha_fusion.hpp"
 
 namespace cutlass::fmha::collective {
 
@@ -85,9 +86,36 @@ struct CollectiveSoftmax {
     return f;
   }
 
+  // Masks with runtime state come with the params, the others are default constructed
+  CUTLASS_DEVICE Fusion mask_fusion() const {
+    if constexpr (has_runtime_mask_v<Fusion>) {
+      return params.fusion;
+    }
+    else {
+      return Fusion{};
+    }
+  }
+
+  // Score modifications apply to every tile, including the ones that skip the mask
+  template<class AccQK, class CountQK, class ProblemShape>
+  CUTLASS_DEVICE void apply_score_mod(AccQK& acc_qk, CountQK const& count_qk, ProblemShape const& problem_shape) {
+    if constexpr (has_score_mod_v<Fusion>) {
+      params.fusion.apply_score_mod(acc_qk, count_qk, problem_shape, params.head, params.scale_softmax);
+    }
+  }
+
+  // Dropout applies to P once the row sums are taken, the kept elements are rescaled in tail()
+  template<class AccQK, class CountQK>
+  CUTLASS_DEVICE void apply_dropout(AccQK& acc_qk, CountQK const& count_qk) {
+    if constexpr (has_dropout_v<Fusion>) {
+      params.fusion.apply_dropout(acc_qk, count_qk, params.batch, params.head, 1.0f);
+    }
+  }
+
   template<class AccQK, class TiledMmaQK, class CountQK, class State, class ProblemShape>
   CUTLASS_DEVICE auto step(AccQK& acc_qk, TiledMmaQK const& tiled_mma_qk, CountQK const& count_qk, State& state, ProblemShape const& problem_shape) {
-    Fusion{}.before_softmax(acc_qk, count_qk, problem_shape);
+    apply_score_mod(acc_qk, count_qk, problem_shape);
+    mask_fusion().before_softmax(acc_qk, count_qk, problem_shape);
     Tensor acc_qk_mn = make_tensor(acc_qk.data(), layout_acc_mn(tiled_mma_qk, acc_qk.layout()));
     auto reduction_target_qk = reduction_target_n(tiled_mma_qk);
     constexpr int red_rank = decltype(rank(reduction_target_qk))::value;
@@ -132,13 +160,15 @@ struct CollectiveSoftmax {
     for (int i = 0; i < size<0>(acc_qk_mn); i++) {
       a_sum(i) = SumType{reduce(acc_qk_mn(i, _), cute::plus{})};
     }
+    apply_dropout(acc_qk, count_qk);
   }
 
   template<bool kUseFusion=true, class AccQK, class TiledMmaQK, class CountQK, class State, class AccPV, class TiledMmaPV, class ProblemShape>
   CUTLASS_DEVICE auto step_interleave_begin(AccQK& acc_qk, TiledMmaQK const& tiled_mma_qk, CountQK const& count_qk, State& state, AccPV& acc_pv, TiledMmaPV const& tiled_mma_pv, ProblemShape const& problem_shape) {
 
+    apply_score_mod(acc_qk, count_qk, problem_shape);
     if constexpr (kUseFusion) {
-      Fusion{}.before_softmax(acc_qk, count_qk, problem_shape);
+      mask_fusion().before_softmax(acc_qk, count_qk, problem_shape);
     }
 
     Tensor acc_qk_mn = make_tensor(acc_qk.data(), layout_acc_mn(tiled_mma_qk, acc_qk.layout()));
@@ -208,8 +238,9 @@ struct CollectiveSoftmax {
   template<bool kUseFusion=true, class AccQK, class TiledMmaQK, class CountQK, class State, class AccPV, class TiledMmaPV, class ProblemShape>
   CUTLASS_DEVICE auto step(AccQK& acc_qk, TiledMmaQK const& tiled_mma_qk, CountQK const& count_qk, State& state, AccPV& acc_pv, TiledMmaPV const& tiled_mma_pv, ProblemShape const& problem_shape) {
 
+    apply_score_mod(acc_qk, count_qk, problem_shape);
     if constexpr (kUseFusion) {
-      Fusion{}.before_softmax(acc_qk, count_qk, problem_shape);
+      mask_fusion().before_softmax(acc_qk, count_qk, problem_shape);
     }
 
     Tensor acc_qk_mn = make_tensor(acc_qk.data(), layout_acc_mn(tiled_mma_qk, acc_qk.layout()));
@@ -261,6 +292,7 @@ struct CollectiveSoftmax {
       }
       a_sum(i) += SumType{reduce(acc_qk_mn(i, _), cute::plus{})};
     }
+    apply_dropout(acc_qk, count_qk);
   }
 
 
@@ -67,6 +67,10 @@ struct FmhaMainloopTma {
   using Stages = cutlass::gemm::collective::StageCount<StageCount>;
   using ClusterShape = Shape<kClusterM, _1, _1>;
 
+  static_assert(! has_score_mod_v<Fusion>, "Score modifications need the warp-specialized mainloop");
+  static_assert(! has_dropout_v<Fusion>, "Dropout needs the warp-specialized mainloop");
+  static_assert(! has_runtime_mask_v<Fusion>, "Packed GQA needs the warp-specialized mainloop");
+
   // 16B alignment lets us use TMA
   static constexpr int Alignment = 16 / sizeof(Element);
 
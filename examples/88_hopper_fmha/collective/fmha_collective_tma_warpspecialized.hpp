@@ -33,10 +33,12 @@
 
 #include "cutlass/cutlass.h"
 #include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/gemm/collective/fp8_accumulation.hpp"
 
 #include "../collective/fmha_common.hpp"
 #include "../collective/fmha_collective_load.hpp"
 #include "../collective/fmha_collective_softmax.hpp"
+#include "../collective/fmha_fusion.hpp"
 #include "../kernel/fmha_options.hpp"
 
 namespace cutlass::fmha::collective {
@@ -51,7 +53,7 @@ template<
   class ElementAccumulatorPV_,
   class TileShape_, // SeqQ, SeqKV, Head
   class LayoutQ_, class LayoutK_, class LayoutV_,  // SeqX, Head, (Batches)
-  class Fusion,
+  class Fusion_,
   class... Options
 >
 struct FmhaMainloopTmaWarpSpecialized {
@@ -66,7 +68,12 @@ struct FmhaMainloopTmaWarpSpecialized {
   using LayoutV = LayoutV_;
 
   // Options
-  static constexpr bool kIsPersistent = find_option_t<Tag::kIsPersistent, false_type, Options...>::value;
+  static constexpr bool kIsVariableLength = find_option_t<Tag::kIsVariableLength, false_type, Options...>::value;
+  // the variable length scheduler is persistent
+  static constexpr bool kIsPersistent = find_option_t<Tag::kIsPersistent, cute::bool_constant<kIsVariableLength>, Options...>::value;
+
+  using Fusion = std::conditional_t<kIsVariableLength, VariableLengthFusion<Fusion_>, Fusion_>;
+  static_assert(! (kIsVariableLength && has_runtime_mask_v<Fusion_>), "Packed GQA needs uniform sequence lengths");
   static constexpr bool kIsMainloopLocked = find_option_t<Tag::kIsMainloopLocked, false_type, Options...>::value;
 
   static constexpr int NumLoadWarpGroups = 1;
@@ -74,6 +81,11 @@ struct FmhaMainloopTmaWarpSpecialized {
   static constexpr int StageCount = find_option_t<Tag::kStagesKV, Int<5>, Options...>::value;
   static constexpr int StageCountQ = find_option_t<Tag::kStagesQ, Int<NumMmaWarpGroups>, Options...>::value;
 
+  // FP8 accumulates P*V of one kv tile into a temporary accumulator and promotes it
+  // into the main accumulator (scaled by the V descale) after every tile
+  static constexpr bool kIsFp8 = sizeof_bits_v<Element> == 8;
+  static constexpr bool kPromotePV = find_option_t<Tag::kPromotePV, cute::bool_constant<kIsFp8>, Options...>::value;
+
   static const int kOuterLoads = 1;
   using StagesQ = cutlass::gemm::collective::StageCount<StageCountQ>;
   using Stages = cutlass::gemm::collective::StageCount<StageCount>;
@@ -91,6 +103,10 @@ struct FmhaMainloopTmaWarpSpecialized {
 
   using TileShapePV = decltype(select<0,2,1>(TileShapeQK{}));
 
+  // Granularity of the descale factors along the sequence dimensions
+  static constexpr int kDescaleBlockQ = get<0>(TileShapeQK{});
+  static constexpr int kDescaleBlockKV = get<1>(TileShapeQK{});
+
   using CollectiveMmaQK = typename cutlass::gemm::collective::CollectiveBuilder<
       cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
       Element, LayoutQ, Alignment,
@@ -136,6 +152,9 @@ struct FmhaMainloopTmaWarpSpecialized {
     };
   };
 
+  // Block, (Batches)
+  using StrideDescale = cute::Stride<int, cute::Stride<int, int>>;
+
   struct Arguments {
     const Element* ptr_Q;
     LayoutQ dQ;
@@ -143,6 +162,18 @@ struct FmhaMainloopTmaWarpSpecialized {
     LayoutK dK;
     const Element* ptr_V;
     LayoutV dV;
+
+    // Optional dequantization factors for blocks of kDescaleBlockQ rows of Q and
+    // kDescaleBlockKV rows of K and V. A block stride of zero gives one factor per head.
+    const float* ptr_descale_Q = nullptr;
+    StrideDescale dDescaleQ = {};
+    const float* ptr_descale_K = nullptr;
+    StrideDescale dDescaleK = {};
+    const float* ptr_descale_V = nullptr;
+    StrideDescale dDescaleV = {};
+
+    // runtime state of the fusion, e.g. the softcap
+    Fusion_ fusion = {};
   };
 
   using TMA_Q = typename CollectiveMmaQK::Params::TMA_A;
@@ -157,6 +188,31 @@ struct FmhaMainloopTmaWarpSpecialized {
     float scale_softmax;
     float scale_softmax_log2;
     float rp_dropout;
+
+    const float* ptr_descale_Q;
+    StrideDescale dDescaleQ;
+    const float* ptr_descale_K;
+    StrideDescale dDescaleK;
+    const float* ptr_descale_V;
+    StrideDescale dDescaleV;
+
+    // packed batches only, the row offsets of the sequences in Q and K/V
+    int* cumulative_length_q;
+    int* cumulative_length_k;
+
+    Fusion fusion;
+  };
+
+  // The subset of Params used by the softmax, with the per-head descales folded in
+  struct SoftmaxParams {
+    float scale_softmax;
+    float scale_softmax_log2;
+    float rp_dropout;
+
+    // for the score modifications and dropout
+    Fusion fusion;
+    int head;
+    int batch;
   };
 
   using LoadQ = cutlass::fmha::collective::CollectiveLoadTma<
@@ -187,15 +243,53 @@ struct FmhaMainloopTmaWarpSpecialized {
 
   template<class ProblemShape>
   static bool can_implement(ProblemShape const& problem_size, Arguments const& args) {
+    if constexpr (kIsVariableLength) {
+      if (get<2>(problem_size).cumulative_length == nullptr || get<3>(problem_size).cumulative_length == nullptr) {
+        return false;
+      }
+    }
+    if constexpr (has_runtime_mask_v<Fusion_>) {
+      // the packed rows are whole heads
+      if (args.fusion.seqlen_q <= 0 || get<2>(problem_size) % args.fusion.seqlen_q != 0) {
+        return false;
+      }
+    }
     return true
       && (get<4>(problem_size) <= get<2>(TileShape{}))
       && ((get<4>(problem_size) % Alignment) == 0)
       && ((get<2>(problem_size) % Alignment) == 0)
+      // without promotion V can only be descaled once per head in the epilogue
+      && (kPromotePV || args.ptr_descale_V == nullptr || get<0>(args.dDescaleV) == 0)
     ;
   }
 
+  // masks with runtime state, e.g. the packed GQA rows, need the fusion of the params
+  CUTLASS_DEVICE static Fusion
+  get_fusion(Params const& params) {
+    return params.fusion;
+  }
+
+  // the kept elements of P are rescaled together with the final normalization
+  static float rp_dropout(Fusion const& fusion) {
+    if constexpr (has_dropout_v<Fusion>) {
+      return fusion.rp_dropout();
+    }
+    else {
+      return 1.0f;
+    }
+  }
+
   template<class ProblemShape>
-  static Params to_underlying_arguments(ProblemShape const& problem_size, Arguments const& args, void* workspace) {
+  static Params to_underlying_arguments(ProblemShape const& problem_size_in, Arguments const& args, void* workspace) {
+
+    // packed batches are described by the total lengths, the sequences are offset into them per tile
+    auto problem_size = cutlass::fmha::collective::apply_total_length(problem_size_in);
+    int* cumulative_length_q = nullptr;
+    int* cumulative_length_k = nullptr;
+    if constexpr (kIsVariableLength) {
+      cumulative_length_q = get<2>(problem_size_in).cumulative_length;
+      cumulative_length_k = get<3>(problem_size_in).cumulative_length;
+    }
 
     auto problem_shape_qk = make_shape(get<2>(problem_size), get<3>(problem_size), get<4>(problem_size), make_shape(get<0>(problem_size), get<1>(problem_size)));
     auto params_qk = CollectiveMmaQK::to_underlying_arguments(problem_shape_qk,
@@ -217,10 +311,51 @@ struct FmhaMainloopTmaWarpSpecialized {
         params_pv.tma_load_b,
         1.0f / (float) std::sqrt(get<4>(problem_size)),
         (float) (std::log2(std::exp(1.0)) / std::sqrt(get<4>(problem_size))),
-        1.0f
+        rp_dropout(args.fusion),
+        args.ptr_descale_Q, args.dDescaleQ,
+        args.ptr_descale_K, args.dDescaleK,
+        args.ptr_descale_V, args.dDescaleV,
+        cumulative_length_q, cumulative_length_k,
+        Fusion{args.fusion}
     };
   }
 
+  // Returns the row offsets of the sequence in Q and K/V, and a block coord with the batch mode
+  // cleared, as the packed tensors only have a single batch
+  template<class BlkCoord>
+  CUTLASS_DEVICE static auto
+  apply_sequence_offset(Params const& params, BlkCoord const& blk_coord) {
+    BlkCoord blk_coord_seq = blk_coord;
+    int offset_q = 0;
+    int offset_k = 0;
+    if constexpr (kIsVariableLength) {
+      offset_q = params.cumulative_length_q[get<2,0>(blk_coord)];
+      offset_k = params.cumulative_length_k[get<2,0>(blk_coord)];
+      get<2,0>(blk_coord_seq) = 0;
+    }
+    return make_tuple(blk_coord_seq, offset_q, offset_k);
+  }
+
+  template<class BlkCoord>
+  CUTLASS_DEVICE static float
+  get_descale(const float* ptr_descale, StrideDescale const& dDescale, int block, BlkCoord const& blk_coord) {
+    if (ptr_descale == nullptr) {
+      return 1.0f;
+    }
+    return ptr_descale[block * get<0>(dDescale)
+        + get<2,0>(blk_coord) * get<1,0>(dDescale)
+        + get<2,1>(blk_coord) * get<1,1>(dDescale)];
+  }
+
+  template<class AccQK>
+  CUTLASS_DEVICE static void
+  apply_descale(AccQK& acc_qk, float descale) {
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(acc_qk); i++) {
+      acc_qk(i) = static_cast<typename AccQK::value_type>(static_cast<float>(acc_qk(i)) * descale);
+    }
+  }
+
   CUTLASS_DEVICE
   static void prefetch_tma_descriptors(Params const& params) {
     cute::prefetch_tma_descriptor(params.tma_load_q.get_tma_descriptor());
@@ -238,7 +373,7 @@ struct FmhaMainloopTmaWarpSpecialized {
       SharedStorage& storage,
       LoadWarpBarrier& load_warp_barrier, bool do_barrier)
   {
-    int fusion_tile_count = Fusion{}.get_trip_count(blk_coord, TileShape{}, problem_size);
+    int fusion_tile_count = get_fusion(params).get_trip_count(blk_coord, TileShape{}, problem_size);
 
     int lane_predicate = cute::elect_one_sync();
 
@@ -259,14 +394,16 @@ struct FmhaMainloopTmaWarpSpecialized {
     auto k_tile_iter = cute::make_coord_iterator(fusion_tile_count);
     int k_tile_count = 2 * fusion_tile_count;
     
+    auto [blk_coord_seq, offset_q, offset_k] = apply_sequence_offset(params, blk_coord);
+
     LoadQ load_q{params.tma_load_q, pipeline_q, storage.smem_q};
-    auto load_state_q = load_q.init_state(_0{}, problem_size, TileShapeQK{}, blk_coord, NumMmaWarpGroups);
+    auto load_state_q = load_q.init_state(_0{}, problem_size, TileShapeQK{}, blk_coord_seq, NumMmaWarpGroups, offset_q);
 
     LoadK load_k{params.tma_load_k, pipeline, storage.smem_k};
-    auto load_state_k = load_k.init_state(block_rank_in_cluster, problem_size, TileShapeQK{}, blk_coord, fusion_tile_count);
+    auto load_state_k = load_k.init_state(block_rank_in_cluster, problem_size, TileShapeQK{}, blk_coord_seq, fusion_tile_count, offset_k);
 
     LoadV load_v{params.tma_load_v, pipeline, storage.smem_v};
-    auto load_state_v = load_v.init_state(block_rank_in_cluster, problem_size, TileShapePV{}, blk_coord, fusion_tile_count);
+    auto load_state_v = load_v.init_state(block_rank_in_cluster, problem_size, TileShapePV{}, blk_coord_seq, fusion_tile_count, offset_k);
 
     if constexpr (kLoadQ) {
       load_q.step(q_tile_iter, load_state_q, smem_pipe_write_q, lane_predicate, q_tile_count);
@@ -311,8 +448,10 @@ struct FmhaMainloopTmaWarpSpecialized {
   {
     int lane_predicate = cute::elect_one_sync();
 
+    auto [blk_coord_seq, offset_q, offset_k] = apply_sequence_offset(params, blk_coord);
+
     LoadQ load_q{params.tma_load_q, pipeline_q, storage.smem_q};
-    auto load_state_q = load_q.init_state(_0{}, problem_size, TileShapeQK{}, blk_coord, NumMmaWarpGroups);
+    auto load_state_q = load_q.init_state(_0{}, problem_size, TileShapeQK{}, blk_coord_seq, NumMmaWarpGroups, offset_q);
 
     auto q_tile_iter = cute::make_coord_iterator(Int<NumMmaWarpGroups>{});
 
@@ -374,7 +513,7 @@ struct FmhaMainloopTmaWarpSpecialized {
     Tensor tOsV = thr_mma_pv.partition_B(sV);                                   // (MMA,MMA_N,MMA_K,PIPE)
     Tensor tOrV = thr_mma_pv.make_fragment_B(tOsV);                            // (MMA,MMA_M,MMA_N,PIPE)
 
-    int k_tile_count = Fusion{}.get_unmasked_trip_count(blk_coord, TileShape{}, problem_size);
+    int k_tile_count = get_fusion(params).get_unmasked_trip_count(blk_coord, TileShape{}, problem_size);
 
     pipeline_q.consumer_wait(smem_pipe_read_q);
 
@@ -386,8 +525,35 @@ struct FmhaMainloopTmaWarpSpecialized {
 
     // Allocate PV acc
     Tensor acc_pv = partition_fragment_C(tiled_mma_pv, take<0, 2>(TileShapePV{}));
+    Tensor acc_pv_tmp = partition_fragment_C(tiled_mma_pv, take<0, 2>(TileShapePV{}));
+    cutlass::gemm::collective::GmmaFP8Accumulation accumulation(acc_pv_tmp, /*promotion interval=*/ 1, /*mma count per tile=*/ 1);
+    auto& acc_pv_mma = kPromotePV ? accumulation() : acc_pv;
+
+    // Per-head descales are folded into the softmax scales, per-block ones are applied per tile
+    int kv_tile = 0;
+    bool is_descale_k_per_block = params.ptr_descale_K != nullptr && get<0>(params.dDescaleK) != 0;
+    bool is_descale_v_per_block = params.ptr_descale_V != nullptr && get<0>(params.dDescaleV) != 0;
+    float descale_qk = get_descale(params.ptr_descale_Q, params.dDescaleQ, m_block, blk_coord);
+    if (! is_descale_k_per_block) {
+      descale_qk *= get_descale(params.ptr_descale_K, params.dDescaleK, 0, blk_coord);
+    }
+    float descale_v = get_descale(params.ptr_descale_V, params.dDescaleV, 0, blk_coord);
+
+    SoftmaxParams softmax_params{
+      params.scale_softmax * descale_qk,
+      params.scale_softmax_log2 * descale_qk,
+      params.rp_dropout * (is_descale_v_per_block ? 1.0f : descale_v),
+      params.fusion,
+      int(get<2,1>(blk_coord)),
+      int(get<2,0>(blk_coord))
+    };
+    if constexpr (kPromotePV) {
+      // promoted tiles are scaled during promotion
+      softmax_params.rp_dropout = params.rp_dropout;
+      clear(acc_pv);
+    }
 
-    cutlass::fmha::collective::CollectiveSoftmax<ElementAccumulatorQK, Fusion, decltype(params)> softmax{params};
+    cutlass::fmha::collective::CollectiveSoftmax<ElementAccumulatorQK, Fusion, SoftmaxParams> softmax{softmax_params};
     auto softmax_state = softmax.init(acc_pv, tiled_mma_pv);
 
     if (true)
@@ -408,11 +574,13 @@ struct FmhaMainloopTmaWarpSpecialized {
         math_wg_order_barrier.arrive();
 
         ++smem_pipe_read;
+        float descale_k = is_descale_k_per_block ? get_descale(params.ptr_descale_K, params.dDescaleK, kv_tile, blk_coord) : 1.0f;
   
         // Wait for the pipeline MMAs to drain
         warpgroup_wait<0>();
         warpgroup_fence_operand(acc_qk);
 
+        if (is_descale_k_per_block) apply_descale(acc_qk, descale_k);
         softmax.step(acc_qk, tiled_mma_qk, tPcP, softmax_state, problem_size);
   
         Tensor acc_qk_fixed = make_acc_into_op<Element>(acc_qk, typename TiledMmaPV::LayoutA_TV{});
@@ -420,19 +588,21 @@ struct FmhaMainloopTmaWarpSpecialized {
         pipeline.consumer_wait(smem_pipe_read);
 
         // MMA PV
-        warpgroup_fence_operand(acc_pv);
+        warpgroup_fence_operand(acc_pv_mma);
         warpgroup_fence_operand(acc_qk_fixed);
         warpgroup_arrive();
   
-        gemm_zero_acc(tiled_mma_pv, acc_qk_fixed, tOrV(_,_,_,smem_pipe_read.index()), acc_pv);
+        gemm_zero_acc(tiled_mma_pv, acc_qk_fixed, tOrV(_,_,_,smem_pipe_read.index()), acc_pv_mma);
         warpgroup_commit_batch();
 
         pipeline.consumer_release(smem_pipe_release);
         ++smem_pipe_release;
+        if (is_descale_v_per_block) descale_v = get_descale(params.ptr_descale_V, params.dDescaleV, kv_tile, blk_coord);
 
         // Advance consumer pipeline
         ++smem_pipe_read;
         tPcP.data() = tPcP.data() + E<1>{} * get<1>(TileShapeQK{});
+        ++kv_tile;
     }
   
     CUTLASS_PRAGMA_NO_UNROLL
@@ -454,12 +624,17 @@ struct FmhaMainloopTmaWarpSpecialized {
 
         ++smem_pipe_read;
         auto tok = pipeline.consumer_try_wait(smem_pipe_read);
+        float descale_k = is_descale_k_per_block ? get_descale(params.ptr_descale_K, params.dDescaleK, kv_tile, blk_coord) : 1.0f;
   
         // Wait for the pipeline MMAs to drain
         warpgroup_wait<0>();
         warpgroup_fence_operand(acc_qk);
-        warpgroup_fence_operand(acc_pv);
+        warpgroup_fence_operand(acc_pv_mma);
+
+        // Promote the previous tile before the softmax rescales the accumulator
+        if constexpr (kPromotePV) accumulation.scale_if_needed(acc_pv, descale_v);
 
+        if (is_descale_k_per_block) apply_descale(acc_qk, descale_k);
         if constexpr (kIsMainloopLocked) math_wg_order_barrier.wait();
         softmax.template step<false>(acc_qk, tiled_mma_qk, tPcP, softmax_state, acc_pv, tiled_mma_pv, problem_size);
         if constexpr (kIsMainloopLocked) math_wg_order_barrier.arrive();
@@ -469,11 +644,16 @@ struct FmhaMainloopTmaWarpSpecialized {
         pipeline.consumer_wait(smem_pipe_read, tok);
 
         // MMA PV
-        warpgroup_fence_operand(acc_pv);
+        warpgroup_fence_operand(acc_pv_mma);
         warpgroup_fence_operand(acc_qk_fixed);
         warpgroup_arrive();
   
-        cute::gemm(tiled_mma_pv, acc_qk_fixed, tOrV(_,_,_,smem_pipe_read.index()), acc_pv);
+        if constexpr (kPromotePV) {
+          gemm_zero_acc(tiled_mma_pv, acc_qk_fixed, tOrV(_,_,_,smem_pipe_read.index()), acc_pv_mma);
+        }
+        else {
+          cute::gemm(tiled_mma_pv, acc_qk_fixed, tOrV(_,_,_,smem_pipe_read.index()), acc_pv_mma);
+        }
         warpgroup_commit_batch();
 
         pipeline.consumer_release(smem_pipe_release);
@@ -481,12 +661,14 @@ struct FmhaMainloopTmaWarpSpecialized {
   
         pipeline.consumer_release(smem_pipe_release);
         ++smem_pipe_release;
+        if (is_descale_v_per_block) descale_v = get_descale(params.ptr_descale_V, params.dDescaleV, kv_tile, blk_coord);
 
         ++smem_pipe_read;
         tPcP.data() = tPcP.data() + E<1>{} * get<1>(TileShapeQK{});
+        ++kv_tile;
     }
 
-    k_tile_count += Fusion{}.get_masked_trip_count(blk_coord, TileShape{}, problem_size);
+    k_tile_count += get_fusion(params).get_masked_trip_count(blk_coord, TileShape{}, problem_size);
 
     CUTLASS_PRAGMA_NO_UNROLL
     while (k_tile_count > 0)
@@ -507,15 +689,20 @@ struct FmhaMainloopTmaWarpSpecialized {
 
         ++smem_pipe_read;
         auto tok = pipeline.consumer_try_wait(smem_pipe_read);
+        float descale_k = is_descale_k_per_block ? get_descale(params.ptr_descale_K, params.dDescaleK, kv_tile, blk_coord) : 1.0f;
   
         // Wait for the pipeline MMAs to drain
         warpgroup_wait<0>();
         warpgroup_fence_operand(acc_qk);
-        warpgroup_fence_operand(acc_pv);
+        warpgroup_fence_operand(acc_pv_mma);
+
+        // Promote the previous tile before the softmax rescales the accumulator
+        if constexpr (kPromotePV) accumulation.scale_if_needed(acc_pv, descale_v);
 
         //if constexpr (kIsPersistent)
         //  if (k_tile_count == 0) pipeline_q.consumer_release(smem_pipe_release_q);
 
+        if (is_descale_k_per_block) apply_descale(acc_qk, descale_k);
         if constexpr (kIsMainloopLocked) math_wg_order_barrier.wait();
         softmax.step(acc_qk, tiled_mma_qk, tPcP, softmax_state, acc_pv, tiled_mma_pv, problem_size);
         if constexpr (kIsMainloopLocked) math_wg_order_barrier.arrive();
@@ -525,11 +712,16 @@ struct FmhaMainloopTmaWarpSpecialized {
         pipeline.consumer_wait(smem_pipe_read, tok);
 
         // MMA PV
-        warpgroup_fence_operand(acc_pv);
+        warpgroup_fence_operand(acc_pv_mma);
         warpgroup_fence_operand(acc_qk_fixed);
         warpgroup_arrive();
   
-        cute::gemm(tiled_mma_pv, acc_qk_fixed, tOrV(_,_,_,smem_pipe_read.index()), acc_pv);
+        if constexpr (kPromotePV) {
+          gemm_zero_acc(tiled_mma_pv, acc_qk_fixed, tOrV(_,_,_,smem_pipe_read.index()), acc_pv_mma);
+        }
+        else {
+          cute::gemm(tiled_mma_pv, acc_qk_fixed, tOrV(_,_,_,smem_pipe_read.index()), acc_pv_mma);
+        }
         warpgroup_commit_batch();
 
         pipeline.consumer_release(smem_pipe_release);
@@ -537,16 +729,19 @@ struct FmhaMainloopTmaWarpSpecialized {
   
         pipeline.consumer_release(smem_pipe_release);
         ++smem_pipe_release;
+        if (is_descale_v_per_block) descale_v = get_descale(params.ptr_descale_V, params.dDescaleV, kv_tile, blk_coord);
 
         ++smem_pipe_read;
         tPcP.data() = tPcP.data() + E<1>{} * get<1>(TileShapeQK{});
+        ++kv_tile;
     }
 
     if (kIsPersistent) pipeline_q.consumer_release(smem_pipe_release_q);
 
     // Wait for the pipeline MMAs to drain
     warpgroup_wait<0>();
-    warpgroup_fence_operand(acc_pv);
+    warpgroup_fence_operand(acc_pv_mma);
+    if constexpr (kPromotePV) accumulation.scale_if_needed(acc_pv, descale_v);
 
     if (kIsPersistent) pipeline.consumer_release(smem_pipe_release);
     ++smem_pipe_release;
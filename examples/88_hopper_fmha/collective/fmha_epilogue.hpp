@@ -37,6 +37,7 @@
 #include "cutlass/epilogue/thread/linear_combination.h"
 
 #include "../collective/fmha_common.hpp"
+#include "../collective/fmha_fusion.hpp"
 
 namespace cutlass::fmha::collective {
 
@@ -69,6 +70,11 @@ struct FmhaFwdEpilogue {
     cute::tuple<cute::_1, cute::tuple<int, int>> dLSE;
   
     typename CollectiveEpilogueTMA::Params epilogue_TMA;
+
+    // packed batches only, O is then stored without TMA
+    int* cumulative_length_q;
+    Element* ptr_O;
+    cute::tuple<int, cute::_1, cute::tuple<int, int>> dO;
   };
 
   using TensorStorage = typename CollectiveEpilogueTMA::TensorStorage;
@@ -77,13 +83,20 @@ struct FmhaFwdEpilogue {
   static constexpr int TmaTransactionBytes = CollectiveEpilogueTMA::TmaTransactionBytes;
 
   template<class ProblemShape>
-  static Params to_underlying_arguments(ProblemShape const& problem_size, Arguments const& args, void* workspace = nullptr) {
+  static Params to_underlying_arguments(ProblemShape const& problem_size_in, Arguments const& args, void* workspace = nullptr) {
+    auto problem_size = cutlass::fmha::collective::apply_total_length(problem_size_in);
+    int* cumulative_length_q = nullptr;
+    if constexpr (is_variable_length_v<tuple_element_t<2, ProblemShape>>) {
+      cumulative_length_q = get<2>(problem_size_in).cumulative_length;
+    }
+
     auto problem_size_o = make_shape(get<2>(problem_size), get<4>(problem_size), 1,
               make_shape(get<0>(problem_size), get<1>(problem_size)));
     typename CollectiveEpilogueTMA::Arguments args_tma{{}, args.ptr_O, args.dO, args.ptr_O, args.dO};
     return Params{
       args.ptr_LSE, args.dLSE,
-      CollectiveEpilogueTMA::to_underlying_arguments(problem_size_o, args_tma, workspace)
+      CollectiveEpilogueTMA::to_underlying_arguments(problem_size_o, args_tma, workspace),
+      cumulative_length_q, args.ptr_O, args.dO
     };
   }
 
@@ -105,8 +118,13 @@ struct FmhaFwdEpilogue {
     int seqlen_q = get<2>(problem_size);
     int num_batch = get<0>(problem_size);
     int num_heads = get<1>(problem_size);
+    // rows of the sequence within a packed batch
+    int offset_q = 0;
+    if (params.cumulative_length_q != nullptr) {
+      offset_q = params.cumulative_length_q[get<2,0>(blk_coord)];
+    }
     // Epilogue for lse
-    Tensor mLSE = make_tensor(make_gmem_ptr(params.ptr_LSE),
+    Tensor mLSE = make_tensor(make_gmem_ptr(params.ptr_LSE + offset_q),
         make_shape(seqlen_q, get<1>(tile_shape), make_shape(num_batch, num_heads)),
         make_stride(_1{}, _0{}, get<1>(params.dLSE)));
     Tensor gLSE_full = local_tile(mLSE, tile_shape, make_coord(_, _, _), Step<_1, _1, X>{});
@@ -124,6 +142,24 @@ struct FmhaFwdEpilogue {
         }
       }
     }
+
+    if (params.cumulative_length_q != nullptr) {
+      // A sequence ends at an arbitrary row of the packed O, where a TMA store would
+      // overwrite the start of the next one, so O is stored with predication instead
+      Tensor mO = make_tensor(make_gmem_ptr(params.ptr_O + offset_q * get<0>(params.dO)),
+          make_shape(seqlen_q, get<4>(problem_size), make_shape(num_batch, num_heads)),
+          params.dO);
+      Tensor gO_full = local_tile(mO, tile_shape, make_coord(_, _, _), Step<_1, _1, X>{});
+      Tensor gO = gO_full(_, _, get<0>(blk_coord), get<1>(blk_coord), get<2>(blk_coord));
+      Tensor tOgO = thr_mma.partition_C(gO);
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size(tOgO); i++) {
+        if (get<0>(tOcO(i)) + get<0>(blk_coord) * get<0>(tile_shape) < seqlen_q && get<1>(tOcO(i)) < get<4>(problem_size)) {
+          tOgO(i) = static_cast<Element>(acc(i));
+        }
+      }
+      return;
+    }
     auto problem_size_o = make_shape(get<2>(problem_size), get<4>(problem_size), _,
               make_shape(get<0>(problem_size), get<1>(problem_size)));
 
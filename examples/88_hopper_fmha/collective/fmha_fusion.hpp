@@ -32,6 +32,8 @@
 #pragma once
 
 #include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/philox.h"
 #include "cute/tensor.hpp"
 
 namespace cutlass::fmha::collective {
@@ -191,8 +193,228 @@ struct CausalFusion : DefaultFusion {
 
 };
 
+// Variable sequence lengths leave a ragged last tile in every sequence, and the
+// rows past its end belong to the next sequence, so they are always masked out.
 template<class Base>
-struct FusionBwdAdapter {
+struct VariableLengthFusion : Base {
+
+  template<class AccQK, class IndexQK, class ProblemSize>
+  CUTLASS_DEVICE
+  void before_softmax(
+    AccQK& acc_qk,
+    IndexQK const& index_qk,
+    ProblemSize const& problem_size
+  ) {
+    Base{}.before_softmax(acc_qk, index_qk, problem_size);
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(acc_qk); i++) {
+      auto pos = index_qk(i);
+      if (get<1>(pos) >= get<3>(problem_size)) {
+        acc_qk(i) = -INFINITY;
+      }
+    }
+  }
+};
+
+// Score modifications are applied to every tile of S before the mask, and are
+// layered on top of a mask fusion, e.g. SoftcapFusion<AlibiFusion<CausalFusion>>.
+// Unlike the masks they carry runtime state, so the kernels take the fusion object
+// as an argument. They work on the unscaled S = Q K^T, so that the softmax scale
+// stays folded into the exponent: for the logits x = scale_softmax * S they compute
+// S' = g(scale_softmax * S) / scale_softmax. The backward pass recomputes S' and
+// multiplies dS' by dS'/dS, as returned by score_mod_grad(S').
+template<class T, class = void> struct has_score_mod_impl : std::false_type {};
+template<class T> struct has_score_mod_impl<T, std::void_t<decltype(T::HasScoreMod)>> : std::bool_constant<T::HasScoreMod> {};
+template<class T> constexpr bool has_score_mod_v = has_score_mod_impl<remove_cvref_t<T>>::value;
+
+// Masks with runtime state, taken from the params of the mainloop instead of being default constructed
+template<class T, class = void> struct has_runtime_mask_impl : std::false_type {};
+template<class T> struct has_runtime_mask_impl<T, std::void_t<decltype(T::HasRuntimeMask)>> : std::bool_constant<T::HasRuntimeMask> {};
+template<class T> constexpr bool has_runtime_mask_v = has_runtime_mask_impl<remove_cvref_t<T>>::value;
+
+// Gemma-style logit soft-capping, x -> softcap * tanh(x / softcap)
+template<class Base>
+struct SoftcapFusion : Base {
+
+  static constexpr bool HasScoreMod = true;
+
+  float softcap = 0.0f;
+
+  template<class AccQK, class IndexQK, class ProblemSize>
+  CUTLASS_DEVICE
+  void apply_score_mod(
+    AccQK& acc_qk,
+    IndexQK const& index_qk,
+    ProblemSize const& problem_size,
+    int head, float scale_softmax
+  ) {
+    if constexpr (has_score_mod_v<Base>) {
+      Base::apply_score_mod(acc_qk, index_qk, problem_size, head, scale_softmax);
+    }
+    using ElementAcc = typename AccQK::value_type;
+    float scale_in = scale_softmax / softcap;
+    float scale_out = softcap / scale_softmax;
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(acc_qk); i++) {
+      acc_qk(i) = static_cast<ElementAcc>(scale_out * cutlass::fast_tanh(scale_in * static_cast<float>(acc_qk(i))));
+    }
+  }
+
+  // the derivative of the cap is 1 - tanh^2, where tanh = S' * scale_softmax / softcap
+  CUTLASS_DEVICE
+  float score_mod_grad(float acc_qk, float scale_softmax) {
+    float t = acc_qk * (scale_softmax / softcap);
+    return 1.0f - t * t;
+  }
+};
+
+// ALiBi, x -> x - slope[head] * |k - q|, with one slope per head given in
+// ptr_slopes. As for causal masking, Q is aligned with the beginning of K unless
+// kIsQBegin is false. The bias is linear, so it must be the innermost score
+// modification for the backward pass to see the final S'.
+template<class Base, bool kIsQBegin = true>
+struct AlibiFusion : Base {
+
+  static_assert(! has_score_mod_v<Base>, "Compose score modifications as SoftcapFusion<AlibiFusion<Fusion>>");
+  static_assert(! has_runtime_mask_v<Base>, "ALiBi needs the unpacked rows and heads");
+
+  static constexpr bool HasScoreMod = true;
+
+  float const* ptr_slopes = nullptr;
+
+  template<class AccQK, class IndexQK, class ProblemSize>
+  CUTLASS_DEVICE
+  void apply_score_mod(
+    AccQK& acc_qk,
+    IndexQK const& index_qk,
+    ProblemSize const& problem_size,
+    int head, float scale_softmax
+  ) {
+    int offset_q = 0;
+    if constexpr (! kIsQBegin) {
+      offset_q = int(get<3>(problem_size)) - int(get<2>(problem_size));
+    }
+    using ElementAcc = typename AccQK::value_type;
+    float slope = ptr_slopes[head] / scale_softmax;
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(acc_qk); i++) {
+      auto pos = index_qk(i);
+      int distance = ::abs(int(get<1>(pos)) - int(get<0>(pos)) - offset_q);
+      acc_qk(i) = static_cast<ElementAcc>(static_cast<float>(acc_qk(i)) - slope * distance);
+    }
+  }
+
+  CUTLASS_DEVICE
+  float score_mod_grad(float acc_qk, float scale_softmax) {
+    return 1.0f;
+  }
+};
+
+// Attention dropout on P, applied to the A operand of the PV GEMM after the row sums
+// are taken. The keep decision of element (q, k) is drawn from a counter-based
+// Philox4x32-10 with the counter (k / 4, q, head, batch) and the 64b seed as key, so
+// the backward pass regenerates the same mask and no mask tensor is stored. Kept
+// elements are rescaled by rp_dropout() = 1 / (1 - p_dropout), which the forward
+// pass folds into the final normalization.
+template<class T, class = void> struct has_dropout_impl : std::false_type {};
+template<class T> struct has_dropout_impl<T, std::void_t<decltype(T::HasDropout)>> : std::bool_constant<T::HasDropout> {};
+template<class T> constexpr bool has_dropout_v = has_dropout_impl<remove_cvref_t<T>>::value;
+
+template<class Base>
+struct DropoutFusion : Base {
+
+  static_assert(! has_runtime_mask_v<Base>, "Dropout needs the unpacked rows and heads");
+
+  static constexpr bool HasDropout = true;
+
+  float p_dropout = 0.0f;
+  uint64_t seed = 0;
+
+  CUTLASS_HOST_DEVICE
+  float rp_dropout() const {
+    return 1.0f / (1.0f - p_dropout);
+  }
+
+  // elements whose random word is below the threshold are dropped
+  CUTLASS_HOST_DEVICE
+  uint32_t dropout_threshold() const {
+    // 4294967040 is the largest float below 2^32
+    return static_cast<uint32_t>(fminf(p_dropout * 4294967296.0f, 4294967040.0f));
+  }
+
+  // random words of the four columns [k & ~3, (k & ~3) + 4) of row q
+  CUTLASS_HOST_DEVICE
+  Philox4x32_10::result_type dropout_words(int q, int k, int batch, int head) const {
+    Philox4x32_10::Counter counter;
+    counter[0] = static_cast<uint32_t>(k) >> 2;
+    counter[1] = static_cast<uint32_t>(q);
+    counter[2] = static_cast<uint32_t>(head);
+    counter[3] = static_cast<uint32_t>(batch);
+    Philox4x32_10::Key key;
+    key[0] = static_cast<uint32_t>(seed);
+    key[1] = static_cast<uint32_t>(seed >> 32);
+    return Philox4x32_10::generate(counter, key);
+  }
+
+  CUTLASS_HOST_DEVICE
+  bool is_kept(int q, int k, int batch, int head) const {
+    return dropout_words(q, k, batch, head)[k & 3] >= dropout_threshold();
+  }
+
+  // Zeroes the dropped elements of acc and multiplies the kept ones by scale. Each
+  // block of four columns is drawn once for consecutive elements sharing it.
+  template<class Acc, class IndexQK>
+  CUTLASS_DEVICE
+  void apply_dropout(Acc& acc, IndexQK const& index_qk, int batch, int head, float scale) const {
+    using ElementAcc = typename Acc::value_type;
+    uint32_t threshold = dropout_threshold();
+    Philox4x32_10::result_type words;
+    int cached_q = -1;
+    int cached_block = -1;
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(acc); i++) {
+      auto pos = index_qk(i);
+      int q = int(get<0>(pos));
+      int k = int(get<1>(pos));
+      if (q != cached_q || (k >> 2) != cached_block) {
+        words = dropout_words(q, k, batch, head);
+        cached_q = q;
+        cached_block = k >> 2;
+      }
+      acc(i) = words[k & 3] >= threshold ? static_cast<ElementAcc>(static_cast<float>(acc(i)) * scale) : ElementAcc(0);
+    }
+  }
+};
+
+// GQA packing: the Q heads sharing a KV head are stacked along the sequence, so the kernel
+// runs one head per KV head with q_heads_per_kv_head * seqlen_q rows of Q, O and the LSE, and
+// each K/V tile a CTA loads serves all heads of the group. With head-major Q and O the rows
+// of a group are already adjacent, e.g. Q (B, H, Q, D) is viewed as (B, H_K, G * Q, D). The
+// mask is applied to the row within the head; seqlen_q must be set at runtime.
+template<class Base>
+struct GqaPackedFusion : Base {
+
+  static_assert(! has_score_mod_v<Base> && ! has_dropout_v<Base>, "Layer score modifications on top of GqaPackedFusion");
+
+  static constexpr bool HasRuntimeMask = true;
+
+  int seqlen_q = 0;
+
+  // rows within the head covered by the tile, all of them if the tile spans two heads
+  template<class BlkCoord, class TileShape>
+  CUTLASS_DEVICE
+  cute::tuple<int, int> get_head_rows(BlkCoord const& blk_coord, TileShape const& tile_shape) const {
+    int row_first = get<0>(blk_coord) * get<0>(tile_shape);
+    int row_last = row_first + get<0>(tile_shape) - 1;
+    if (row_first / seqlen_q != row_last / seqlen_q) {
+      return {0, seqlen_q - 1};
+    }
+    return {row_first % seqlen_q, row_last % seqlen_q};
+  }
+
+  // Only the causal mask depends on the rows, the others keep the trip counts of Base
+  static constexpr bool kIsCausal = std::is_base_of_v<CausalFusion, Base>;
+
   template<class BlkCoord, class TileShape, class ProblemSize>
   CUTLASS_DEVICE
   int get_trip_count(
@@ -200,9 +422,60 @@ struct FusionBwdAdapter {
     TileShape const& tile_shape,
     ProblemSize const& problem_size
   ) {
-    return Base{}.get_trip_count(select<1,0,2>(blk_coord), select<1,0,2>(tile_shape), select<0,1,3,2,4>(problem_size));
+    if constexpr (kIsCausal) {
+      auto [row_first, row_last] = get_head_rows(blk_coord, tile_shape);
+      int max_blocks_k = ceil_div(get<3>(problem_size), get<1>(tile_shape));
+      return std::min(max_blocks_k, ceil_div(row_last + 1, get<1>(tile_shape)));
+    }
+    else {
+      return Base::get_trip_count(blk_coord, tile_shape, problem_size);
+    }
+  }
+
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_masked_trip_count(
+    BlkCoord const& blk_coord,
+    TileShape const& tile_shape,
+    ProblemSize const& problem_size
+  ) {
+    if constexpr (kIsCausal) {
+      return get_trip_count(blk_coord, tile_shape, problem_size) - get_unmasked_trip_count(blk_coord, tile_shape, problem_size);
+    }
+    else {
+      return Base::get_masked_trip_count(blk_coord, tile_shape, problem_size);
+    }
   }
 
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_unmasked_trip_count(
+    BlkCoord const& blk_coord,
+    TileShape const& tile_shape,
+    ProblemSize const& problem_size
+  ) {
+    if constexpr (kIsCausal) {
+      // the kv tiles left of the diagonal of the first row
+      auto [row_first, row_last] = get_head_rows(blk_coord, tile_shape);
+      return std::min(get_trip_count(blk_coord, tile_shape, problem_size), (row_first + 1) / get<1>(tile_shape));
+    }
+    else {
+      return Base::get_unmasked_trip_count(blk_coord, tile_shape, problem_size);
+    }
+  }
+
+  template<class IndexQK>
+  struct HeadIndex {
+    IndexQK const& index_qk;
+    int seqlen_q;
+
+    CUTLASS_DEVICE
+    auto operator()(int i) const {
+      auto pos = index_qk(i);
+      return make_coord(int(get<0>(pos)) % seqlen_q, get<1>(pos));
+    }
+  };
+
   template<class AccQK, class IndexQK, class ProblemSize>
   CUTLASS_DEVICE
   void before_softmax(
@@ -210,21 +483,70 @@ struct FusionBwdAdapter {
     IndexQK const& index_qk,
     ProblemSize const& problem_size
   ) {
-    auto index_base = index_qk(_0{});
-    auto index_shape = shape(index_qk);
-    auto index_stride = transform_leaf(stride(index_qk), [](auto elem) {
-      if constexpr (is_scaled_basis<decltype(elem)>::value) {
-        if constexpr(decltype(elem.mode() == _0{})::value) {
-          return ScaledBasis<decltype(elem.value()), 1>(elem.value());
-        } else {
-          return ScaledBasis<decltype(elem.value()), 0>(elem.value());
-        }
+    if constexpr (kIsCausal) {
+      Base::before_softmax(acc_qk, HeadIndex<IndexQK>{index_qk, seqlen_q}, replace<2>(problem_size, seqlen_q));
+    }
+    else {
+      Base::before_softmax(acc_qk, index_qk, problem_size);
+    }
+  }
+};
+
+template<class T, class = void> struct is_softcap_fusion_impl : std::false_type {};
+template<class T> struct is_softcap_fusion_impl<T, std::void_t<decltype(std::declval<T&>().softcap)>> : std::true_type {};
+template<class T> constexpr bool is_softcap_fusion_v = is_softcap_fusion_impl<remove_cvref_t<T>>::value;
+
+template<class T, class = void> struct is_alibi_fusion_impl : std::false_type {};
+template<class T> struct is_alibi_fusion_impl<T, std::void_t<decltype(std::declval<T&>().ptr_slopes)>> : std::true_type {};
+template<class T> constexpr bool is_alibi_fusion_v = is_alibi_fusion_impl<remove_cvref_t<T>>::value;
+
+template<class T, class = void> struct is_dropout_fusion_impl : std::false_type {};
+template<class T> struct is_dropout_fusion_impl<T, std::void_t<decltype(std::declval<T&>().p_dropout)>> : std::true_type {};
+template<class T> constexpr bool is_dropout_fusion_v = is_dropout_fusion_impl<remove_cvref_t<T>>::value;
+
+// The backward pass iterates over Q for a tile of K, so its index tensors hold (k, q)
+// coordinates. Returns an index tensor with the forward (q, k) coordinates instead.
+template<class IndexQK>
+CUTLASS_DEVICE
+auto transpose_index_bwd(IndexQK const& index_qk) {
+  auto index_base = index_qk(_0{});
+  auto index_shape = shape(index_qk);
+  auto index_stride = transform_leaf(stride(index_qk), [](auto elem) {
+    if constexpr (is_scaled_basis<decltype(elem)>::value) {
+      if constexpr(decltype(elem.mode() == _0{})::value) {
+        return ScaledBasis<decltype(elem.value()), 1>(elem.value());
       } else {
-        return elem;
+        return ScaledBasis<decltype(elem.value()), 0>(elem.value());
       }
-    });
-    auto index_qk_bwd = make_tensor(make_inttuple_iter(select<1,0>(index_base)), make_layout(index_shape, index_stride));
-    Base{}.before_softmax(acc_qk, index_qk_bwd, problem_size);
+    } else {
+      return elem;
+    }
+  });
+  return make_tensor(make_inttuple_iter(select<1,0>(index_base)), make_layout(index_shape, index_stride));
+}
+
+template<class Base>
+struct FusionBwdAdapter {
+  static_assert(! has_runtime_mask_v<Base>, "The backward pass does not support packed GQA");
+
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_trip_count(
+    BlkCoord const& blk_coord,
+    TileShape const& tile_shape,
+    ProblemSize const& problem_size
+  ) {
+    return Base{}.get_trip_count(select<1,0,2>(blk_coord), select<1,0,2>(tile_shape), select<0,1,3,2,4>(problem_size));
+  }
+
+  template<class AccQK, class IndexQK, class ProblemSize>
+  CUTLASS_DEVICE
+  void before_softmax(
+    AccQK& acc_qk,
+    IndexQK const& index_qk,
+    ProblemSize const& problem_size
+  ) {
+    Base{}.before_softmax(acc_qk, transpose_index_bwd(index_qk), problem_size);
   }
 
   template<class BlkCoord, class TileShape, class ProblemSize>
@@ -280,4 +602,132 @@ struct FusionBwdAdapter<CausalFusion> {
   }
 };
 
+// Score modifications keep the adapter of the mask fusion underneath them, and
+// hold the fusion to apply the modifications with the forward coordinates
+template<class ScoreModFusion, class MaskFusion>
+struct ScoreModFusionBwdAdapter : FusionBwdAdapter<MaskFusion> {
+
+  static constexpr bool HasScoreMod = true;
+
+  ScoreModFusion fusion = {};
+
+  template<class AccQK, class IndexQK, class ProblemSize>
+  CUTLASS_DEVICE
+  void apply_score_mod(
+    AccQK& acc_qk,
+    IndexQK const& index_qk,
+    ProblemSize const& problem_size,
+    int head, float scale_softmax
+  ) {
+    fusion.apply_score_mod(acc_qk, transpose_index_bwd(index_qk), problem_size, head, scale_softmax);
+  }
+
+  CUTLASS_DEVICE
+  float score_mod_grad(float acc_qk, float scale_softmax) {
+    return fusion.score_mod_grad(acc_qk, scale_softmax);
+  }
+};
+
+template<class Base>
+struct FusionBwdAdapter<SoftcapFusion<Base>> : ScoreModFusionBwdAdapter<SoftcapFusion<Base>, Base> {};
+
+template<class Base, bool kIsQBegin>
+struct FusionBwdAdapter<AlibiFusion<Base, kIsQBegin>> : ScoreModFusionBwdAdapter<AlibiFusion<Base, kIsQBegin>, Base> {};
+
+template<class Base, bool kIsQBegin>
+struct FusionBwdAdapter<SoftcapFusion<AlibiFusion<Base, kIsQBegin>>>
+    : ScoreModFusionBwdAdapter<SoftcapFusion<AlibiFusion<Base, kIsQBegin>>, Base> {};
+
+// Dropout keeps the adapter of the mask fusion underneath it, and regenerates the
+// mask with the forward coordinates
+template<class Base>
+struct FusionBwdAdapter<DropoutFusion<Base>> : FusionBwdAdapter<Base> {
+
+  static_assert(! has_score_mod_v<Base>, "Dropout is not supported together with score modifications");
+
+  static constexpr bool HasDropout = true;
+
+  DropoutFusion<Base> fusion = {};
+
+  CUTLASS_HOST_DEVICE
+  float rp_dropout() const {
+    return fusion.rp_dropout();
+  }
+
+  template<class Acc, class IndexQK>
+  CUTLASS_DEVICE
+  void apply_dropout(Acc& acc, IndexQK const& index_qk, int batch, int head, float scale) const {
+    fusion.apply_dropout(acc, transpose_index_bwd(index_qk), batch, head, scale);
+  }
+};
+
+template<class Fusion>
+CUTE_HOST_DEVICE
+FusionBwdAdapter<Fusion> make_fusion_bwd_adapter(Fusion const& fusion) {
+  FusionBwdAdapter<Fusion> adapter{};
+  if constexpr (has_score_mod_v<Fusion> || has_dropout_v<Fusion>) {
+    adapter.fusion = fusion;
+  }
+  return adapter;
+}
+
+// For a packed batch, Q and K of the problem size are VariableLength: sequence b
+// spans rows [cumulative_length[b], cumulative_length[b+1]) of a tensor with
+// total_length rows, and max_length is used wherever a uniform length is needed.
+struct VariableLength {
+  int max_length;
+  int* cumulative_length = nullptr;
+  int total_length = -1;
+
+  CUTE_HOST_DEVICE operator int() const {
+    return max_length;
+  }
+};
+
+template<class T> struct is_variable_length_impl : std::false_type {};
+template<> struct is_variable_length_impl<VariableLength> : std::true_type {};
+template<class T> constexpr bool is_variable_length_v = is_variable_length_impl<remove_cvref_t<T>>::value;
+
+// Replaces the VariableLength modes by the lengths of sequence idx
+template<class Shape, class Idx>
+CUTE_HOST_DEVICE
+constexpr auto
+apply_variable_length(Shape const& shape, Idx const& idx) {
+  return transform_leaf(shape, [&](auto const& s) {
+    if constexpr (is_variable_length_v<decltype(s)>) {
+      return s.cumulative_length[idx+1] - s.cumulative_length[idx];
+    }
+    else {
+      return s;
+    }
+  });
+}
+
+// Replaces the VariableLength modes by the total lengths, as needed to describe the packed tensors
+template<class Shape>
+CUTE_HOST_DEVICE
+constexpr auto
+apply_total_length(Shape const& shape) {
+  return transform_leaf(shape, [&](auto const& s) {
+    if constexpr (is_variable_length_v<decltype(s)>) {
+      return s.total_length;
+    }
+    else {
+      return s;
+    }
+  });
+}
+
 }  // namespace cutlass::fmha::collective
+
+namespace cute {
+
+template<>
+struct is_integral<cutlass::fmha::collective::VariableLength> : true_type {};
+
+CUTE_HOST_DEVICE
+void print(cutlass::fmha::collective::VariableLength a) {
+  printf("Varlen<%d, %p>", a.max_length, a.cumulative_length);
+}
+
+}
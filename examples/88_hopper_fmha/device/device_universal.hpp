@@ -204,7 +204,7 @@ public:
   /// Primary run() entry point API that is static allowing users to create and manage their own params.
   /// Supplied params struct must be construct by calling Kernel::to_underling_arguments()
   static Status
-  run(Params& params, cudaStream_t stream = nullptr) {
+  run(Params& params, cudaStream_t stream = nullptr, bool launch_with_pdl = false) {
     CUTLASS_TRACE_HOST("Universal::run()");
     dim3 const block = Kernel::get_block_shape();
     dim3 const grid = get_grid_shape(params);
@@ -220,7 +220,8 @@ public:
                    cute::size<2>(typename Kernel::ClusterShape{}));
       void const* kernel = (void const*) device_kernel<Kernel>;
       void* kernel_params[] = {&params};
-      launch_result = ClusterLauncher::launch(grid, cluster, block, smem_size, stream, kernel, kernel_params);
+      launch_result = ClusterLauncher::launch(
+        grid, cluster, block, smem_size, stream, kernel, kernel_params, launch_with_pdl);
     }
     else {
       launch_result = Status::kSuccess;
@@ -244,30 +245,30 @@ public:
 
   /// Launches the kernel after first constructing Params internal state from supplied arguments.
   Status
-  run(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr) {
+  run(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr, bool launch_with_pdl = false) {
     Status status = initialize(args, workspace, stream);
     if (Status::kSuccess == status) {
-      status = run(params_, stream);
+      status = run(params_, stream, launch_with_pdl);
     }
     return status;
   }
 
   /// Launches the kernel after first constructing Params internal state from supplied arguments.
   Status
-  operator()(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr) {
-    return run(args, workspace, stream);
+  operator()(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr, bool launch_with_pdl = false) {
+    return run(args, workspace, stream, launch_with_pdl);
   }
 
   /// Overload that allows a user to re-launch the same kernel without updating internal params struct.
   Status
-  run(cudaStream_t stream = nullptr) {
-    return run(params_, stream);
+  run(cudaStream_t stream = nullptr, bool launch_with_pdl = false) {
+    return run(params_, stream, launch_with_pdl);
   }
 
   /// Overload that allows a user to re-launch the same kernel without updating internal params struct.
   Status
-  operator()(cudaStream_t stream = nullptr) {
-    return run(params_, stream);
+  operator()(cudaStream_t stream = nullptr, bool launch_with_pdl = false) {
+    return run(params_, stream, launch_with_pdl);
   }
 };
 
@@ -86,6 +86,9 @@ public:
     cute::tuple<int, int, int, cute::_1> stride_dV;
 
     cutlass::KernelHardwareInfo hw_info;
+
+    // runtime state of the fusion, e.g. the softcap
+    Fusion fusion = {};
   };
 
   using OperationSumOdO = cutlass::device::Universal<cutlass::fmha::kernel::FmhaKernelBwdSumOdO<Element, ElementAccumulator>>;
@@ -156,7 +159,8 @@ private:
         args.ptr_dO, args.stride_dO,
         args.ptr_LSE, args.stride_LSE,
         sum_OdO, stride_sum_OdO,
-        dQ_acc, stride_dQ },
+        dQ_acc, stride_dQ,
+        cutlass::fmha::collective::make_fusion_bwd_adapter(args.fusion) },
       { args.ptr_dK, args.stride_dK,
         args.ptr_dV, args.stride_dV },
       args.hw_info
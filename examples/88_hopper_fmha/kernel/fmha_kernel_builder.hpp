@@ -74,6 +74,9 @@ struct FmhaBuilder<
   Options...
 > {
 
+  static_assert(! find_option_t<Tag::kIsVariableLength, false_type, Options...>::value,
+      "Variable sequence lengths require a warp-specialized kernel");
+
   using CollectiveMainloop = cutlass::fmha::collective::FmhaMainloopTma<Element, ElementAccumulator, TileShape, Fusion, Options...>;
 
   using CollectiveEpilogue = cutlass::fmha::collective::FmhaFwdEpilogue<
@@ -114,8 +117,12 @@ struct FmhaBuilder<
   using CollectiveEpilogue = cutlass::fmha::collective::FmhaFwdEpilogue<
       Element, ElementAccumulatorPV, typename CollectiveMainloop::TileShapePV>;
 
-  static constexpr bool kIsPersistent = find_option_t<Tag::kIsPersistent, false_type, Options...>::value;
-  using TileScheduler = std::conditional_t<kIsPersistent, cutlass::fmha::kernel::PersistentTileScheduler, cutlass::fmha::kernel::IndividualTileScheduler>;
+  static constexpr bool kIsPersistent = CollectiveMainloop::kIsPersistent;
+  static constexpr bool kIsVariableLength = CollectiveMainloop::kIsVariableLength;
+  static_assert(kIsPersistent || ! kIsVariableLength, "Variable sequence lengths require a persistent kernel");
+  using TileScheduler = std::conditional_t<kIsVariableLength,
+      cutlass::fmha::kernel::VariableLengthPersistentTileScheduler,
+      std::conditional_t<kIsPersistent, cutlass::fmha::kernel::PersistentTileScheduler, cutlass::fmha::kernel::IndividualTileScheduler>>;
 
   using Kernel = cutlass::fmha::kernel::FmhaKernelTmaWarpSpecialized<CollectiveMainloop, CollectiveEpilogue, TileScheduler, Options...>;
 };
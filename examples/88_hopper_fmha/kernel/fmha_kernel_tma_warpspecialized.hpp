@@ -35,7 +35,9 @@
 #include "cutlass/arch/reg_reconfig.h"
 #include "cutlass/pipeline/pipeline.hpp"
 #include "cutlass/arch/arch.h"
+#include "cutlass/arch/grid_dependency_control.h"
 
+#include "../collective/fmha_fusion.hpp"
 #include "../kernel/fmha_options.hpp"
 
 namespace cutlass::fmha::kernel {
@@ -101,7 +103,10 @@ struct FmhaKernelTmaWarpSpecialized {
 
   static constexpr int SharedStorageSize = sizeof(SharedStorage);
 
-  using ProblemShape = cute::tuple<int, int, int, int, int>;
+  // B H Q K D, with Q and K given per sequence through cumulative lengths for packed batches
+  using ProblemShape = std::conditional_t<CollectiveMainloop::kIsVariableLength,
+      cute::tuple<int, int, cutlass::fmha::collective::VariableLength, cutlass::fmha::collective::VariableLength, int>,
+      cute::tuple<int, int, int, int, int>>;
 
   struct Arguments {
     ProblemShape problem_size;
@@ -150,6 +155,18 @@ struct FmhaKernelTmaWarpSpecialized {
     return block;
   }
 
+  // The problem size of the sequence the block belongs to
+  template<class BlkCoord>
+  CUTLASS_DEVICE static auto
+  apply_batch(Params const& params, BlkCoord const& blk_coord) {
+    if constexpr (CollectiveMainloop::kIsVariableLength) {
+      return cutlass::fmha::collective::apply_variable_length(params.problem_size, get<2,0>(blk_coord));
+    }
+    else {
+      return params.problem_size;
+    }
+  }
+
   static Params to_underlying_arguments(Arguments const& args, void* workspace) {
     return Params{
         args.problem_size,
@@ -289,6 +306,10 @@ struct FmhaKernelTmaWarpSpecialized {
 
     CollectiveMainloop collective_mainloop;
 
+    // Ensure that the prefetched kernel does not touch
+    // unflushed global memory prior to this instruction
+    cutlass::arch::wait_on_dependent_grids();
+
     if (warp_group_role == WarpGroupRole::Producer) {
       cutlass::arch::warpgroup_reg_dealloc<LoadRegisterRequirement>();
       if (producer_warp_role == ProducerWarpRole::LoadKV) {
@@ -297,9 +318,10 @@ struct FmhaKernelTmaWarpSpecialized {
         CUTLASS_PRAGMA_NO_UNROLL
         for (; tile_scheduler.is_valid(); ++tile_scheduler) {
           auto blk_coord = tile_scheduler.get_block_coord();
+          auto problem_size = apply_batch(params, blk_coord);
           collective_mainloop.template load_kv_maybe_q<!kLoadsQSeparately>(
             block_rank_in_cluster,
-            blk_coord, params.mainloop, params.problem_size,
+            blk_coord, params.mainloop, problem_size,
             pipeline_inner, smem_pipe_write_inner,
             pipeline_outer, smem_pipe_write_outer,
             storage.tensors.mainloop,
@@ -314,8 +336,9 @@ struct FmhaKernelTmaWarpSpecialized {
         CUTLASS_PRAGMA_NO_UNROLL
         for (; tile_scheduler.is_valid(); ++tile_scheduler) {
           auto blk_coord = tile_scheduler.get_block_coord();
+          auto problem_size = apply_batch(params, blk_coord);
           collective_mainloop.load_maybe_q(
-            blk_coord, params.mainloop, params.problem_size,
+            blk_coord, params.mainloop, problem_size,
             pipeline_outer, smem_pipe_write_outer,
             storage.tensors.mainloop,
             storage.load_warp_barrier, do_barrier
@@ -325,8 +348,9 @@ struct FmhaKernelTmaWarpSpecialized {
       } else if (producer_warp_role == ProducerWarpRole::Reducer) {
         for (; tile_scheduler.is_valid(); ++tile_scheduler) {
           auto blk_coord = tile_scheduler.get_block_coord();
+          auto problem_size = apply_batch(params, blk_coord);
           collective_mainloop.reduce(
-            blk_coord, params.mainloop, params.problem_size,
+            blk_coord, params.mainloop, problem_size,
             pipeline_reducer, smem_pipe_read_reducer,
             storage.tensors.mainloop
           );
@@ -344,6 +368,7 @@ struct FmhaKernelTmaWarpSpecialized {
       for (; tile_scheduler.is_valid(); ++tile_scheduler) {
         auto blk_coord = tile_scheduler.get_block_coord();
         auto wg_coord = blk_coord;
+        auto problem_size = apply_batch(params, blk_coord);
 
         constexpr int kOuterLoads = CollectiveMainloop::kOuterLoads;
 
@@ -377,7 +402,7 @@ struct FmhaKernelTmaWarpSpecialized {
 
         auto result = collective_mainloop.compute(
           blk_coord, wg_coord,
-          params.mainloop, params.problem_size,
+          params.mainloop, problem_size,
           pipeline_inner, smem_pipe_read_inner,
           pipeline_outer, smem_pipe_read_outer,
           pipeline_reducer, smem_pipe_write_reducer,
@@ -409,11 +434,16 @@ struct FmhaKernelTmaWarpSpecialized {
         CollectiveEpilogue epilogue;
         epilogue(typename CollectiveMainloop::TileShapePV{}, wg_coord,
           result, typename CollectiveMainloop::TiledMmaPV{},
-          params.problem_size, params.epilogue,
+          problem_size, params.epilogue,
           epi_load_pipeline, storage.tensors.epilogue[consumer_warp_group_idx]);
 
         if constexpr (kIsEpilogueLocked) ; math_wg_order_barrier.arrive();
       }
+
+      // Hint on an early release of global memory resources.
+      // The timing of calling this function only influences performance,
+      // not functional correctness.
+      cutlass::arch::launch_dependent_grids();
     }
 #endif
   }
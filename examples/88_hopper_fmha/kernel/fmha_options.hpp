@@ -71,7 +71,10 @@ enum class Tag {
   kBlocksPerSM,
   kClusterM,
 
-  kAccQK
+  kAccQK,
+  kPromotePV,
+
+  kIsVariableLength
 };
 
 template<auto kTag, class Value>
@@ -158,6 +158,114 @@ struct PersistentTileScheduler {
 
 ////////////////////////////////////////////////////////////////////////////////
 
+// Persistent scheduler for packed batches of variable length. Only the m blocks
+// that lie within each sequence are enumerated, batch by batch with the heads of
+// a batch adjacent, so no CTA is spent on the padding up to the max length.
+struct VariableLengthPersistentTileScheduler {
+
+  struct Params {
+    int num_blocks;  // upper bound, the exact count depends on the device-side lengths
+    int num_batches;
+    int num_heads;
+    int block_m;
+    int cluster_m;
+    int* cumulative_length;
+
+    KernelHardwareInfo hw_info;
+  };
+
+  int block_idx = 0;
+  int batch_idx = 0;
+  int batch_block_begin = 0;
+  int batch_m_blocks = 0;
+  Params params;
+
+  CUTLASS_DEVICE
+  VariableLengthPersistentTileScheduler(Params const& params) : block_idx(blockIdx.x), params(params) {
+    batch_m_blocks = get_m_blocks(0);
+    advance();
+  }
+
+  template<class ProblemSize, class ClusterShape, class TileShape>
+  static Params to_underlying_arguments(
+      ProblemSize const& problem_size, KernelHardwareInfo hw_info,
+      ClusterShape const& cluster_shape, TileShape const& tile_shape)
+  {
+    using namespace cute;
+    int sm_count = hw_info.sm_count;
+    if (sm_count <= 0) {
+      CUTLASS_TRACE_HOST("  WARNING: Arguments do not include a valid SM count.\n"
+          "  For optimal performance, populate the arguments KernelHardwareInfo struct with the SM count.");
+      sm_count = KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+    }
+
+    CUTLASS_TRACE_HOST("to_underlying_arguments(): Setting persistent grid SM count to " << sm_count);
+    hw_info.sm_count = sm_count;
+
+    int num_batches = get<0>(problem_size);
+    int num_heads = get<1>(problem_size);
+    int block_m = size<0>(tile_shape);
+    int cluster_m = size<0>(cluster_shape);
+
+    // every sequence wastes at most one partial block and the cluster padding
+    int max_m_blocks = ceil_div(get<2>(problem_size).total_length, block_m) + num_batches * cluster_m;
+    int num_blocks = max_m_blocks * num_heads;
+
+    return Params {
+      num_blocks, num_batches, num_heads, block_m, cluster_m,
+      get<2>(problem_size).cumulative_length,
+      hw_info
+    };
+  }
+
+  static dim3 get_grid_shape(Params const& params) {
+    dim3 grid(std::min(params.num_blocks, params.hw_info.sm_count), 1, 1);
+    return grid;
+  }
+
+  CUTLASS_DEVICE
+  int get_m_blocks(int batch) {
+    if (batch >= params.num_batches) {
+      return 0;
+    }
+    int length = params.cumulative_length[batch + 1] - params.cumulative_length[batch];
+    return cutlass::round_up(cutlass::ceil_div(length, params.block_m), params.cluster_m);
+  }
+
+  // moves to the batch that contains block_idx
+  CUTLASS_DEVICE
+  void advance() {
+    while (batch_idx < params.num_batches && block_idx >= batch_block_begin + batch_m_blocks * params.num_heads) {
+      batch_block_begin += batch_m_blocks * params.num_heads;
+      batch_idx += 1;
+      batch_m_blocks = get_m_blocks(batch_idx);
+    }
+  }
+
+  CUTLASS_DEVICE
+  bool is_valid() {
+    return batch_idx < params.num_batches;
+  }
+
+  CUTLASS_DEVICE
+  auto get_block_coord() {
+    using namespace cute;
+    int block_in_batch = block_idx - batch_block_begin;
+    int bidh = block_in_batch / batch_m_blocks;
+    int m_block = block_in_batch - bidh * batch_m_blocks;
+    return make_coord(m_block, _0{}, make_coord(batch_idx, bidh));
+  }
+
+  CUTLASS_DEVICE
+  VariableLengthPersistentTileScheduler& operator++() {
+    block_idx += gridDim.x;
+    advance();
+    return *this;
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
 template<typename Base>
 struct TileSchedulerBwdAdapter {
 
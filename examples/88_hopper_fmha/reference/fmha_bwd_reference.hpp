@@ -34,6 +34,8 @@
 
 #include "cute/tensor.hpp"
 
+#include "../collective/fmha_fusion.hpp"
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 template<
@@ -76,10 +78,22 @@ void __global__ fmha_bwd_reference_dQ_kernel(
         auto id = make_identity_tensor(make_shape(1, 1));
         auto frag = make_tensor<ElementAccumulator>(Shape<_1, _1>{});
         frag(0) = acc_qk;
-        fusion.before_softmax(frag, make_tensor(id.data() + make_arithmetic_tuple(idx_Q, idx_K), id.layout()), problem_shape);
+        auto index_qk = make_tensor(id.data() + make_arithmetic_tuple(idx_Q, idx_K), id.layout());
+        ElementAccumulator score_mod_grad = 1;
+        if constexpr (cutlass::fmha::collective::has_score_mod_v<Fusion>) {
+          fusion.apply_score_mod(frag, index_qk, problem_shape, idx_L / int(size<2,0>(mO)), float(softmax_scale));
+          score_mod_grad = fusion.score_mod_grad(frag(0), float(softmax_scale));
+        }
+        fusion.before_softmax(frag, index_qk, problem_shape);
         acc_qk = frag(0);
 
-        mS[idx_K] = static_cast<Element>(exp(softmax_scale * acc_qk - mLSE(idx_Q, idx_L)) * softmax_scale * (acc_dov - acc_doo));
+        // dP only flows through the kept elements of P
+        ElementAccumulator dropout_scale = 1;
+        if constexpr (cutlass::fmha::collective::has_dropout_v<Fusion>) {
+          int num_batches = size<2,0>(mO);
+          dropout_scale = fusion.is_kept(idx_Q, idx_K, idx_L % num_batches, idx_L / num_batches) ? fusion.rp_dropout() : 0;
+        }
+        mS[idx_K] = static_cast<Element>(exp(softmax_scale * acc_qk - mLSE(idx_Q, idx_L)) * softmax_scale * (acc_dov * dropout_scale - acc_doo) * score_mod_grad);
       }
 
       __syncthreads();
@@ -137,10 +151,22 @@ void __global__ fmha_bwd_reference_dK_kernel(
         auto id = make_identity_tensor(make_shape(1, 1));
         auto frag = make_tensor<ElementAccumulator>(Shape<_1, _1>{});
         frag(0) = acc_qk;
-        fusion.before_softmax(frag, make_tensor(id.data() + make_arithmetic_tuple(idx_Q, idx_K), id.layout()), problem_shape);
+        auto index_qk = make_tensor(id.data() + make_arithmetic_tuple(idx_Q, idx_K), id.layout());
+        ElementAccumulator score_mod_grad = 1;
+        if constexpr (cutlass::fmha::collective::has_score_mod_v<Fusion>) {
+          fusion.apply_score_mod(frag, index_qk, problem_shape, idx_L / int(size<2,0>(mO)), float(softmax_scale));
+          score_mod_grad = fusion.score_mod_grad(frag(0), float(softmax_scale));
+        }
+        fusion.before_softmax(frag, index_qk, problem_shape);
         acc_qk = frag(0);
 
-        mS[idx_Q] = static_cast<Element>(exp(softmax_scale * acc_qk - mLSE(idx_Q, idx_L)) * softmax_scale * (acc_dov - acc_doo));
+        // dP only flows through the kept elements of P
+        ElementAccumulator dropout_scale = 1;
+        if constexpr (cutlass::fmha::collective::has_dropout_v<Fusion>) {
+          int num_batches = size<2,0>(mO);
+          dropout_scale = fusion.is_kept(idx_Q, idx_K, idx_L % num_batches, idx_L / num_batches) ? fusion.rp_dropout() : 0;
+        }
+        mS[idx_Q] = static_cast<Element>(exp(softmax_scale * acc_qk - mLSE(idx_Q, idx_L)) * softmax_scale * (acc_dov * dropout_scale - acc_doo) * score_mod_grad);
       }
 
       __syncthreads();
@@ -194,10 +220,19 @@ void __global__ fmha_bwd_reference_dV_kernel(
         auto id = make_identity_tensor(make_shape(1, 1));
         auto frag = make_tensor<ElementAccumulator>(Shape<_1, _1>{});
         frag(0) = acc_qk;
-        fusion.before_softmax(frag, make_tensor(id.data() + make_arithmetic_tuple(idx_Q, idx_K), id.layout()), problem_shape);
+        auto index_qk = make_tensor(id.data() + make_arithmetic_tuple(idx_Q, idx_K), id.layout());
+        if constexpr (cutlass::fmha::collective::has_score_mod_v<Fusion>) {
+          fusion.apply_score_mod(frag, index_qk, problem_shape, idx_L / int(size<2,0>(mO)), float(softmax_scale));
+        }
+        fusion.before_softmax(frag, index_qk, problem_shape);
         acc_qk = frag(0);
 
-        mS[idx_Q] = static_cast<Element>(exp(softmax_scale * acc_qk - mLSE(idx_Q, idx_L)));
+        ElementAccumulator dropout_scale = 1;
+        if constexpr (cutlass::fmha::collective::has_dropout_v<Fusion>) {
+          int num_batches = size<2,0>(mO);
+          dropout_scale = fusion.is_kept(idx_Q, idx_K, idx_L % num_batches, idx_L / num_batches) ? fusion.rp_dropout() : 0;
+        }
+        mS[idx_Q] = static_cast<Element>(exp(softmax_scale * acc_qk - mLSE(idx_Q, idx_L)) * dropout_scale);
       }
 
       __syncthreads();
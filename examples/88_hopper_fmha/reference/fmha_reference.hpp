@@ -32,6 +32,15 @@
 
 #include "cute/tensor.hpp"
 
+#include "../collective/fmha_fusion.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Descale factors are callables of (seq index, batch index), e.g. tensors of shape (Seq, (B, H))
+struct FmhaReferenceNoDescale {
+  CUTE_HOST_DEVICE float operator()(int, int) const { return 1.0f; }
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 template<
@@ -41,13 +50,17 @@ template<
   class TensorV,
   class TensorO,
   class TensorLSE,
-  class Fusion
+  class Fusion,
+  class DescaleQ,
+  class DescaleK,
+  class DescaleV
 >
 void __global__ fmha_reference_kernel(
     ProblemShape problem_shape,
     TensorQ mQ, TensorK mK, TensorV mV,
     TensorO mO, TensorLSE mLSE,
-    Fusion fusion
+    Fusion fusion,
+    DescaleQ descale_Q, DescaleK descale_K, DescaleV descale_V
 ) {
   using namespace cute;
 
@@ -67,9 +80,14 @@ void __global__ fmha_reference_kernel(
         for (int idx_D = 0; idx_D < size<1>(mK); idx_D++) {
           acc += mQ(idx_Q, idx_D, idx_L) * mK(idx_K, idx_D, idx_L);
         }
+        acc *= descale_Q(idx_Q, idx_L) * descale_K(idx_K, idx_L);
         auto frag = make_tensor<ElementAccumulator>(Shape<_1, _1>{});
         frag(0) = acc;
-        fusion.before_softmax(frag, make_tensor(id.data() + make_arithmetic_tuple(idx_Q, idx_K), id.layout()), problem_shape);
+        auto index_qk = make_tensor(id.data() + make_arithmetic_tuple(idx_Q, idx_K), id.layout());
+        if constexpr (cutlass::fmha::collective::has_score_mod_v<Fusion>) {
+          fusion.apply_score_mod(frag, index_qk, problem_shape, idx_L / int(size<2,0>(mO)), softmax_scale);
+        }
+        fusion.before_softmax(frag, index_qk, problem_shape);
         mS[idx_K] = static_cast<Element>(frag(0) * softmax_scale);
       }
 
@@ -96,10 +114,22 @@ void __global__ fmha_reference_kernel(
 
       Element scale = static_cast<Element>(1.0 / sum);
 
+      if constexpr (cutlass::fmha::collective::has_dropout_v<Fusion>) {
+        int num_batches = size<2,0>(mO);
+        __syncthreads();
+        for (int idx_K = threadIdx.x; idx_K < size<0>(mK); idx_K += blockDim.x) {
+          if (! fusion.is_kept(idx_Q, idx_K, idx_L % num_batches, idx_L / num_batches)) {
+            mS[idx_K] = static_cast<Element>(0);
+          }
+        }
+        __syncthreads();
+        scale = static_cast<Element>(fusion.rp_dropout() / sum);
+      }
+
       for (int idx_D = threadIdx.x; idx_D < size<1>(mO); idx_D += blockDim.x) {
         ElementAccumulator acc = 0;
         for (int idx_K = 0; idx_K < size<0>(mK); idx_K++) {
-          acc += mS[idx_K] * mV(idx_K, idx_D, idx_L) * scale;
+          acc += mS[idx_K] * mV(idx_K, idx_D, idx_L) * descale_V(idx_K, idx_L) * scale;
         }
         mO(idx_Q, idx_D, idx_L) = static_cast<Element>(acc);
       }
@@ -121,13 +151,17 @@ template<
   class TensorV,
   class TensorO,
   class TensorLSE,
-  class Fusion
+  class Fusion,
+  class DescaleQ = FmhaReferenceNoDescale,
+  class DescaleK = FmhaReferenceNoDescale,
+  class DescaleV = FmhaReferenceNoDescale
 >
 void fmha_reference(
     ProblemShape problem_shape,
     TensorQ mQ, TensorK mK, TensorV mV,
     TensorO mO, TensorLSE mLSE,
-    Fusion fusion
+    Fusion fusion,
+    DescaleQ descale_Q = {}, DescaleK descale_K = {}, DescaleV descale_V = {}
 ) {
   using namespace cute;
 
@@ -138,7 +172,7 @@ void fmha_reference(
   if (shared_mem >= (48 << 10)) {
     CUTLASS_TRACE_HOST("  Setting smem size to " << shared_mem);
     auto result = cudaFuncSetAttribute(
-        fmha_reference_kernel<ProblemShape, TensorQ, TensorK, TensorV, TensorO, TensorLSE, Fusion>,
+        fmha_reference_kernel<ProblemShape, TensorQ, TensorK, TensorV, TensorO, TensorLSE, Fusion, DescaleQ, DescaleK, DescaleV>,
         cudaFuncAttributeMaxDynamicSharedMemorySize,
         shared_mem);
     if (cudaSuccess != result) {
@@ -150,7 +184,7 @@ void fmha_reference(
     }
   }
 
-  fmha_reference_kernel<<<grid, block, shared_mem>>>(problem_shape, mQ, mK, mV, mO, mLSE, fusion);
+  fmha_reference_kernel<<<grid, block, shared_mem>>>(problem_shape, mQ, mK, mV, mO, mLSE, fusion, descale_Q, descale_K, descale_V);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -45,9 +45,15 @@
       and KV(_,0,_,_,_) = K, KV(_,1,_,_,_) = V.
     page_table shape (kvL/Page_Size, BS), entry [p, bs] = physical page id of batch bs's per-batch page p.
 
+  --qL N --causal 1 runs multi token decode (e.g. speculative decoding verification):
+    the qL q tokens are the last qL positions of each sequence and attend causally among themselves.
+    Up to MTP_CTA_qL q tokens are packed together with the q heads of a kv head into one cta tile,
+    so they share a single read of the kv cache.
+
   Example usage:
     $ ./examples/93_blackwell_low_latency_gqa --kvL 8192 --kvH 8 --qH 64 --BS 1
     $ ./examples/93_blackwell_low_latency_gqa --kvL 8192 --kvH 8 --qH 64 --BS 1 --mode 1
+    $ ./examples/93_blackwell_low_latency_gqa --kvL 8192 --kvH 8 --qH 64 --BS 1 --qL 2 --causal 1
 */
 
 // Standard library includes
@@ -106,7 +112,8 @@ reference_gqa(
   int* seq_lens,
   TensorSinks const& tensor_Sinks,
   float softmax_scale,
-  int sliding_window_size) {
+  int sliding_window_size,
+  bool causal) {
 
   using TypeQKV = typename TensorQ::element_type;
   using TypeO = typename TensorO::element_type;
@@ -160,8 +167,17 @@ reference_gqa(
   for (int _BS = 0; _BS < BS; ++_BS) {
     int seq_len = seq_lens[_BS];
     int NumKVBlocks = cutlass::ceil_div(seq_len, CTA_kvL);
-    int kvL_start = (sliding_window_size == 0) ? 0 : std::max(0, seq_len - sliding_window_size);
+    // with causal masking, q token _qL sits at position seq_len - qL + _qL, so the first q token's window starts qL - 1 positions earlier
+    int causal_offset = causal ? qL - 1 : 0;
+    int kvL_start = (sliding_window_size == 0) ? 0 : std::max(0, seq_len - sliding_window_size - causal_offset);
     int kvBlock_start = kvL_start / CTA_kvL;
+    auto is_masked = [&](int _kvL, int _qL) {
+      if (!causal) {
+        return _kvL < kvL_start;
+      }
+      int dist = seq_len - qL + _qL - _kvL;
+      return (dist < 0) || ((sliding_window_size > 0) && (dist >= sliding_window_size));
+    };
 
     // bmm1 s = q * k * softmax_scale_log2
     for (int _kvH = 0; _kvH < kvH; ++_kvH) {
@@ -176,7 +192,7 @@ reference_gqa(
               for (int _dH = 0; _dH < dH; ++_dH) {
                 acc += tensor_K(_kvL, _dH, _kvH, _BS) * tensor_Q(make_coord(_qHLocal, _qL), _dH, _kvH, _BS);
               }
-              tensor_Acc1(_kvL, make_coord(_qHLocal, _qL), _kvH, _BS) =  (_kvL < kvL_start) ? -INFINITY : (acc * softmax_scale_log2);
+              tensor_Acc1(_kvL, make_coord(_qHLocal, _qL), _kvH, _BS) =  is_masked(_kvL, _qL) ? -INFINITY : (acc * softmax_scale_log2);
             }
           }
         }
@@ -209,8 +225,11 @@ reference_gqa(
             int start = _kvBlock * CTA_kvL;
             int end = std::min(start + CTA_kvL, seq_len);
             assert(start < end);
+            // a fully masked block (causal) has fmax = -inf, offset by 0 so that p = 0 instead of nan
+            TypeAcc fmax = tensor_Fmax(_kvBlock, make_coord(_qHLocal, _qL), _kvH, _BS);
+            TypeAcc fmax_safe = (fmax == -INFINITY) ? TypeAcc(0.f) : fmax;
             for (int _kvL = start; _kvL < end; ++_kvL) {
-              tensor_P(_kvL, make_coord(_qHLocal, _qL), _kvH, _BS) = std::exp2f(tensor_Acc1(_kvL, make_coord(_qHLocal, _qL), _kvH, _BS) - tensor_Fmax(_kvBlock, make_coord(_qHLocal, _qL), _kvH, _BS));
+              tensor_P(_kvL, make_coord(_qHLocal, _qL), _kvH, _BS) = std::exp2f(tensor_Acc1(_kvL, make_coord(_qHLocal, _qL), _kvH, _BS) - fmax_safe);
             }
           }
         }
@@ -495,6 +514,9 @@ public:
   using TypeAcc = float;
   static constexpr int CTA_qHLocal = 8;
   static constexpr int CTA_qL = 1;
+  // number of q tokens packed into a cta tile when qL > 1, the n dimension of bmm1/bmm2 is CTA_qHLocal * CTA_qL
+  // each epilog thread holds a full row of S (and its fmax/alpha/fsum) in registers, so it is bounded by the 128 register budget
+  static constexpr int MTP_CTA_qL = 2;
   static constexpr int CTA_kvL = 128;
   static constexpr int CTA_dH = 64;
   // Page_Size only used by gqa_paged (mode 1). Page_Size must divide CTA_kvL; CTA_kvL/Page_Size = pages per CTA tile.
@@ -515,6 +537,7 @@ private:
   float softmax_scale_;
   ProblemStride stride_;
   int sliding_window_size_;
+  bool causal_;
   int mode_; // 0: gqa, 1: gqa_paged
 
   // Host vectors
@@ -600,8 +623,8 @@ private:
   }
 
 public:
-  GQATester(int kvH, int qH, int qL, int kvL, int dH, int BS, float softmax_scale, int sliding_window_size, int mode = 0) :
-  kvH_(kvH), qHLocal_(qH / kvH), qL_(qL), kvL_(kvL), dH_(dH), BS_(BS), softmax_scale_(softmax_scale), sliding_window_size_(sliding_window_size), mode_(mode) {
+  GQATester(int kvH, int qH, int qL, int kvL, int dH, int BS, float softmax_scale, int sliding_window_size, bool causal = false, int mode = 0) :
+  kvH_(kvH), qHLocal_(qH / kvH), qL_(qL), kvL_(kvL), dH_(dH), BS_(BS), softmax_scale_(softmax_scale), sliding_window_size_(sliding_window_size), causal_(causal), mode_(mode) {
     assert(sliding_window_size_ >= 0);
     // Allocate host memory
     host_Q_.resize(kvH_ * qHLocal_ * qL_ * dH_ * BS_);
@@ -626,7 +649,8 @@ public:
     initialize_tensor(host_tensor_V);
     for (int i = 0; i < BS_; ++i) {
       if (VarSeqLens) {
-        host_seq_lens_[i] = rand() % kvL_ + 1;
+        // with causal masking the q tokens are part of the sequence
+        host_seq_lens_[i] = rand() % (kvL_ - qL_ + 1) + qL_;
       } 
       else { // all the batch have the same seq len
         host_seq_lens_[i] = kvL_;
@@ -676,10 +700,20 @@ public:
   }
 
     void run_kernel(bool pdl, int pdl_count = -1, cudaStream_t stream = 0) {
+      if (qL_ > 1) {
+        run_kernel<MTP_CTA_qL>(pdl, pdl_count, stream);
+      }
+      else {
+        run_kernel<CTA_qL>(pdl, pdl_count, stream);
+      }
+    }
+
+    template <int CTA_qL_>
+    void run_kernel(bool pdl, int pdl_count, cudaStream_t stream) {
       if (mode_ == 0) {
         TGV::gqa::gqa_host<
           TypeQKV, TypeO, TypeAcc,
-          CTA_qHLocal, CTA_qL, CTA_kvL, CTA_dH,
+          CTA_qHLocal, CTA_qL_, CTA_kvL, CTA_dH,
           BMM1_DMA_Stage, BMM2_DMA_Stage,
           MaxSplits,
           NumReductionCTA>(
@@ -693,12 +727,13 @@ public:
           stride_.stride_O_kvH, stride_.stride_O_qHLocal, stride_.stride_O_qL, stride_.stride_O_dH, stride_.stride_O_BS,
           softmax_scale_,
           sliding_window_size_,
+          causal_,
           pdl, pdl_count, stream);
       }
       else {
         TGV::gqa_paged::gqa_paged_host<
           TypeQKV, TypeO, TypeAcc,
-          CTA_qHLocal, CTA_qL, CTA_kvL, CTA_dH,
+          CTA_qHLocal, CTA_qL_, CTA_kvL, CTA_dH,
           Page_Size,
           BMM1_DMA_Stage, BMM2_DMA_Stage,
           Page_Idx_Stage, Num_Page_Idx_Per_Stage,
@@ -717,6 +752,7 @@ public:
           stride_.stride_PT_p, stride_.stride_PT_BS,
           softmax_scale_,
           sliding_window_size_,
+          causal_,
           pdl, pdl_count, stream);
       }
     }
@@ -750,7 +786,7 @@ public:
 
       // Execute reference GQA kernel
       reference_gqa<TypeAcc, CTA_kvL, NoSink>(
-        host_tensor_K, host_tensor_Q, host_tensor_V, host_reference_tensor_O, host_seq_lens_.data(), host_tensor_sinks, softmax_scale_, sliding_window_size_);
+        host_tensor_K, host_tensor_Q, host_tensor_V, host_reference_tensor_O, host_seq_lens_.data(), host_tensor_sinks, softmax_scale_, sliding_window_size_, causal_);
 
       // Compare results using torch.allclose semantics
       // For bfloat16, use more relaxed tolerances due to reduced precision
@@ -767,9 +803,9 @@ public:
 
 };
 
-void benchmark_gqa(int kvH, int qH, int qL, int kvL, int dH, int BS, float softmax_scale, int sliding_window_size, int mode, bool pdl, int pdl_count, int num_testers = 4, int bench_iters = 100) {
+void benchmark_gqa(int kvH, int qH, int qL, int kvL, int dH, int BS, float softmax_scale, int sliding_window_size, bool causal, int mode, bool pdl, int pdl_count, int num_testers = 4, int bench_iters = 100) {
   std::cout << "=== GQA Benchmark ===" << std::endl;
-  std::cout << "Problem size: kvH=" << kvH << ", qH=" << qH << ", qL=" << qL << ", kvL=" << kvL << ", dH=" << dH << ", BS=" << BS << ", sliding_window_size=" << sliding_window_size << std::endl;
+  std::cout << "Problem size: kvH=" << kvH << ", qH=" << qH << ", qL=" << qL << ", kvL=" << kvL << ", dH=" << dH << ", BS=" << BS << ", sliding_window_size=" << sliding_window_size << ", causal=" << causal << std::endl;
   std::cout << "Mode: " << mode << " (" << (mode == 0 ? "gqa" : "gqa_paged") << ")" << std::endl;
   std::cout << "Number of testers (L2 thrashing): " << num_testers << std::endl;
   std::cout << "Benchmark iterations: " << bench_iters << std::endl;
@@ -777,7 +813,7 @@ void benchmark_gqa(int kvH, int qH, int qL, int kvL, int dH, int BS, float softm
   // Create multiple tester instances to thrash L2 cache
   std::vector<std::unique_ptr<GQATester>> testers;
   for (int i = 0; i < num_testers; ++i) {
-    testers.push_back(std::make_unique<GQATester>(kvH, qH, qL, kvL, dH, BS, softmax_scale, sliding_window_size, mode));
+    testers.push_back(std::make_unique<GQATester>(kvH, qH, qL, kvL, dH, BS, softmax_scale, sliding_window_size, causal, mode));
   }
   std::cout << "Created " << num_testers << " GQATester instances" << std::endl;
 
@@ -869,6 +905,7 @@ int main(int argc, char* argv[]) {
   int BS = 1;      // batch size
   float softmax_scale = 1.0f / (float)sqrt(dH);
   int sliding_window_size = 0; // when sliding_window_size = 0, it's disabled
+  bool causal = false; // causal masking among the qL q tokens, for multi token decode
   bool pdl = false;
   // don't support it yet
   int pdl_count = -1;
@@ -885,6 +922,7 @@ int main(int argc, char* argv[]) {
     {"BS",          required_argument, 0, 0},
     {"sliding_window_size", required_argument, 0, 0},
     {"mode",        required_argument, 0, 0},
+    {"causal",      required_argument, 0, 0},
     {0, 0, 0, 0} // denote end of array
     };
 
@@ -905,16 +943,18 @@ int main(int argc, char* argv[]) {
         else if (option_index == 4) BS = atoi(optarg);
         else if (option_index == 5) sliding_window_size = atoi(optarg);
         else if (option_index == 6) mode = atoi(optarg);
+        else if (option_index == 7) causal = atoi(optarg) != 0;
         break;
       default: assert(false);
     }
   }
 
-  GQATester tester(kvH, qH, qL, kvL, dH, BS, softmax_scale, sliding_window_size, mode);
+  GQATester tester(kvH, qH, qL, kvL, dH, BS, softmax_scale, sliding_window_size, causal, mode);
   bool success = tester.verify();
   std::cout << "Correctness test"
             << " mode=" << mode
+            << " causal=" << causal
             << " " << (success ? "PASSED" : "FAILED") << std::endl;
 
-  benchmark_gqa(kvH, qH, qL, kvL, dH, BS, softmax_scale, sliding_window_size, mode, pdl, pdl_count, 100, 1000);
+  benchmark_gqa(kvH, qH, qL, kvL, dH, BS, softmax_scale, sliding_window_size, causal, mode, pdl, pdl_count, 100, 1000);
 }
@@ -910,6 +910,7 @@ EPILOG_warp(
   TiledBMM2 tiled_bmm2,
   float softmax_scale_log2,
   int sliding_window_size,
+  bool causal,
   cutlass::arch::NamedBarrier& epilog_barrier,
   int NumSplits,
   int tid,      // tid local to epilog warp
@@ -986,6 +987,10 @@ EPILOG_warp(
                           make_coord(_, work_tile_info.dH_idx, work_tile_info.kvH_idx, work_tile_info.BS_idx));  // (CTA_kvL, CTA_dH, Num_CTA_kvL) -> (kvL, dH, kvH, BS)
   Tensor cur_kvL = cK(tid, 0, _); // (Num_CTA_kvL) -> (kvL, dH, kvH, BS)
 
+  // column coordinate of each element of tDrS, the q token index is used for causal masking among the q tokens
+  Tensor cS = make_identity_tensor(shape(sS(_,_,0)));        // (CTA_kvL, (CTA_qHLocal, CTA_qL)) -> (CTA_kvL, (CTA_qHLocal, CTA_qL))
+  Tensor tDcS = thr_t2r_copy_bmm1.partition_D(cta_bmm1.partition_C(cS)); // (CpyD, NumCpy_M, NumCpy_N), same partitioning as tDrS
+
   // BMM2 tcgen05.ld
   // now we get the per thread slice of the Acc2 for tcgen05.ld src and dst
   constexpr int acc2_col_bits = size<1>(gO) * sizeof_bits_v<TypeAcc>;
@@ -1303,8 +1308,15 @@ EPILOG_warp(
     // it is flipped to 1 when the BMM2 warp is done, and now we can start the epilog
     int bmm2_epilog_full_barrier_phase_bit = 0;
 
+    // with causal masking (multi token decode, e.g. speculative decoding), the qL q tokens are the last qL positions of the sequence
+    // and q token q_idx only attends to kv positions [0, seq_len - qL + q_idx], the earlier q tokens also reach qL - 1 positions further back into a sliding window
+    int qL = size<1,1>(mO);
+    int causal_offset = causal ? qL - 1 : 0;
+    // distance between the position of the first q token of this cta (q_idx = qL_idx * CTA_qL) and kv position 0
+    int causal_q_pos = seq_len - qL + work_tile_info.qL_idx * CTA_qL;
+
     // If sliding window feature is enabled, we need to adjust the seq_len_start.
-    int seq_len_start = (sliding_window_size == 0) ? 0 : cute::max(0, seq_len - sliding_window_size);
+    int seq_len_start = (sliding_window_size == 0) ? 0 : cute::max(0, seq_len - sliding_window_size - causal_offset);
 
     // loop over each kv tile
     for (int kv_tile = 0; kv_tile < NumKVTiles; kv_tile++) {
@@ -1337,6 +1349,16 @@ EPILOG_warp(
       if (!row_valid) {
         fill(tDrS, -cutlass::platform::numeric_limits<TypeAcc>::infinity());
       }
+      else if (causal) {
+        // per q token mask, the q token index within the cta is static after unrolling so this is a compare and select per element
+        CUTE_UNROLL
+        for (int i = 0; i < tDrS.size(); i++) {
+          int dist = causal_q_pos + get<1,1>(tDcS(i)) - kv_seq_len; // distance from the q token to this kv position
+          if ((dist < 0) || ((sliding_window_size > 0) && (dist >= sliding_window_size))) {
+            tDrS[i] = -cutlass::platform::numeric_limits<TypeAcc>::infinity();
+          }
+        }
+      }
       // scale it by softmax_scale_log2, s = s * softmax_scale_log2 = s * softmax_scale * log2(e)
       // here we leverage the fact that expf(s) = exp2f(s * log2(e)), and doing the exp2f path generates less instructions than expf (and presumably slightly less accurate)
       // so we fuse the log2(e) with the softmax scale, hence all later expf (e.g. alpha/beta) should be replaced by exp2f
@@ -1361,16 +1383,24 @@ EPILOG_warp(
         tDrFmax[i] = reduce_op<ReduceOp::Max>(tDrFmax(i), m_ij(i));
       }
 
+      // with causal masking a q token can have all kv positions of this cta masked so far, i.e. m_i = -inf
+      // offset by 0 instead, so that alpha and p become exp2f(-inf) = 0 rather than exp2f(-inf - (-inf)) = nan
+      Tensor m_i_safe = make_tensor<TypeAcc>(shape(tDrFmax));
+      CUTE_UNROLL
+      for (int i = 0; i < tDrFmax.size(); i++) {
+        m_i_safe[i] = (tDrFmax[i] == -cutlass::platform::numeric_limits<TypeAcc>::infinity()) ? TypeAcc(0) : tDrFmax[i];
+      }
+
       // alpha = exp2f(m_i_old - m_i)
       CUTE_UNROLL
       for (int i = 0; i < tDrFmax.size(); i++) {
-        rAlpha[i] = exp2f(m_i_old[i] - tDrFmax[i]);
+        rAlpha[i] = exp2f(m_i_old[i] - m_i_safe[i]);
       }
 
       // p = exp2f(s - m_i)
       CUTE_UNROLL
       for (int i = 0; i < tDrS.size(); i++) {
-        tDrS[i] = exp2f(tDrS[i] - tDrFmax[i]);
+        tDrS[i] = exp2f(tDrS[i] - m_i_safe[i]);
       }
 
       // l_i = alpha * l_i + p
@@ -1688,6 +1718,7 @@ gqa_device(
   TiledBMM2 tiled_bmm2,
   float softmax_scale_log2,
   int sliding_window_size,
+  bool causal,
   int pdl_count
 ) {
   //if (threadIdx.x == 0) {
@@ -1800,10 +1831,13 @@ gqa_device(
   //   - Skip offset aligned to tiles: floor(70 / 16) * 16 = 64
   //   - Workload range: [64, 100), length = 36
   //   - Tiles to process: ceil(36 / 16) = 3 tiles
+  //
+  // With causal masking the window of the first q token starts qL - 1 positions earlier.
   int workload_seq_len = seq_len;
   int seq_len_skip_offset = 0;  // Number of sequence positions to skip (tile-aligned)
-  if (sliding_window_size > 0 && sliding_window_size < seq_len) {
-    int unaligned_skip = seq_len - sliding_window_size;
+  int window_size = sliding_window_size + (causal ? size<1,1>(mO) - 1 : 0);
+  if (sliding_window_size > 0 && window_size < seq_len) {
+    int unaligned_skip = seq_len - window_size;
     seq_len_skip_offset = (unaligned_skip / CTA_kvL) * CTA_kvL;  // Align to tile boundary
     workload_seq_len = seq_len - seq_len_skip_offset;
   }
@@ -1839,7 +1873,7 @@ gqa_device(
     // epilog tid is from 128 to 255, need to offset by -128 when getting the per thread slice
     int tid = threadIdx.x - 128;
     // warp_idx - 4 because epilog warp group starts from warp 4
-    EPILOG_warp<SharedStorage, WorkTileInfo, decltype(mK), decltype(mO), decltype(mSink), TiledBMM1, TiledBMM2, CTA_qHLocal, CTA_qL, CTA_kvL, CTA_dH, NumReductionCTA, NoSink>(shared_storage, work_tile_info, mK, mO, mSink, seq_len, tiled_bmm1, tiled_bmm2, softmax_scale_log2, sliding_window_size, epilog_barrier, NumSplits, tid, warp_idx - 4, rank);
+    EPILOG_warp<SharedStorage, WorkTileInfo, decltype(mK), decltype(mO), decltype(mSink), TiledBMM1, TiledBMM2, CTA_qHLocal, CTA_qL, CTA_kvL, CTA_dH, NumReductionCTA, NoSink>(shared_storage, work_tile_info, mK, mO, mSink, seq_len, tiled_bmm1, tiled_bmm2, softmax_scale_log2, sliding_window_size, causal, epilog_barrier, NumSplits, tid, warp_idx - 4, rank);
   }
 
   __syncthreads();
@@ -1852,6 +1886,8 @@ gqa_device(
 // kvL is max_seq_len, seq_lens[BS] is the actual seq len for each batch
 // sinks has shape (qHLocal * kvH), i.e. one sink per q head, when device_ptr_sinks is nullptr, it's disabled
 // sliding_window_size is the size of the sliding window, when it's 0, it's disabled
+// causal enables causal masking among the qL q tokens (multi token decode), which are the last qL positions of each sequence
+// packing CTA_qL > 1 q tokens into the n dimension of bmm1/bmm2 lets them share one read of the kv cache
 template<
   class TypeQKV, class TypeO, class TypeAcc,
   int CTA_qHLocal, int CTA_qL, int CTA_kvL, int CTA_dH,
@@ -1871,6 +1907,7 @@ void gqa_host(
   int stride_O_kvH, int stride_O_qHLocal, int stride_O_qL, int stride_O_dH, int stride_O_BS,
   float softmax_scale,
   int sliding_window_size,
+  bool causal,
   bool pdl, int pdl_count = -1,
   cudaStream_t stream = 0
 ) {
@@ -2110,7 +2147,7 @@ void gqa_host(
                                 mSeqLens,
                                 tma_atom_K, tma_atom_Q, tma_atom_V,
                                 tiled_bmm1, tiled_bmm2,
-                                softmax_scale * Log2_E, sliding_window_size, pdl_count));
+                                softmax_scale * Log2_E, sliding_window_size, causal, pdl_count));
   }
   else {
     auto *kernel_instance =
@@ -2130,7 +2167,7 @@ void gqa_host(
                                 mSeqLens,
                                 tma_atom_K, tma_atom_Q, tma_atom_V,
                                 tiled_bmm1, tiled_bmm2,
-                                softmax_scale * Log2_E, sliding_window_size, pdl_count));
+                                softmax_scale * Log2_E, sliding_window_size, causal, pdl_count));
   }
 }
 
@@ -429,6 +429,7 @@ gqa_paged_device(
   TiledBMM2 tiled_bmm2,
   float softmax_scale_log2,
   int sliding_window_size,
+  bool causal,
   int pdl_count
 ) {
   // Allocate SMEM
@@ -508,10 +509,12 @@ gqa_paged_device(
   // Sliding window optimization: when enabled, we only process tokens in range
   // [seq_len - sliding_window_size, seq_len). To simplify tile distribution,
   // we align the skip boundary to CTA_kvL tiles.
+  // With causal masking the window of the first q token starts qL - 1 positions earlier.
   int workload_seq_len = seq_len;
   int seq_len_skip_offset = 0;
-  if (sliding_window_size > 0 && sliding_window_size < seq_len) {
-    int unaligned_skip = seq_len - sliding_window_size;
+  int window_size = sliding_window_size + (causal ? size<1,1>(mO) - 1 : 0);
+  if (sliding_window_size > 0 && window_size < seq_len) {
+    int unaligned_skip = seq_len - window_size;
     seq_len_skip_offset = (unaligned_skip / CTA_kvL) * CTA_kvL;
     workload_seq_len = seq_len - seq_len_skip_offset;
   }
@@ -557,7 +560,7 @@ gqa_paged_device(
     int kvL = static_cast<int>(shape<0>(mPageTable)) * Page_Size;
     auto mK_coord = make_identity_tensor(make_shape(kvL, dH, kvH, BS));
     // warp_idx - 4 because epilog warp group starts from warp 4
-    gqa::EPILOG_warp<SharedStorage, WorkTileInfo, decltype(mK_coord), decltype(mO), decltype(mSink), TiledBMM1, TiledBMM2, CTA_qHLocal, CTA_qL, CTA_kvL, CTA_dH, NumReductionCTA, NoSink>(shared_storage, work_tile_info, mK_coord, mO, mSink, seq_len, tiled_bmm1, tiled_bmm2, softmax_scale_log2, sliding_window_size, epilog_barrier, NumSplits, tid, warp_idx - 4, rank);
+    gqa::EPILOG_warp<SharedStorage, WorkTileInfo, decltype(mK_coord), decltype(mO), decltype(mSink), TiledBMM1, TiledBMM2, CTA_qHLocal, CTA_qL, CTA_kvL, CTA_dH, NumReductionCTA, NoSink>(shared_storage, work_tile_info, mK_coord, mO, mSink, seq_len, tiled_bmm1, tiled_bmm2, softmax_scale_log2, sliding_window_size, causal, epilog_barrier, NumSplits, tid, warp_idx - 4, rank);
   }
 
   __syncthreads();
@@ -570,6 +573,7 @@ gqa_paged_device(
 // seq_lens has shape (BS); kvL is max_seq_len, seq_lens[bs] is the actual seq len for batch bs
 // page_table has shape (kvL/Page_Size, BS)
 // sliding_window_size is the size of the sliding window, when it's 0, it's disabled
+// causal enables causal masking among the qL q tokens (multi token decode), which are the last qL positions of each sequence
 template<
   class TypeQKV, class TypeO, class TypeAcc,
   int CTA_qHLocal, int CTA_qL, int CTA_kvL, int CTA_dH,
@@ -591,6 +595,7 @@ void gqa_paged_host(
   int stride_PT_p, int stride_PT_BS,
   float softmax_scale,
   int sliding_window_size,
+  bool causal,
   bool pdl, int pdl_count = -1,
   cudaStream_t stream = 0
 ) {
@@ -836,7 +841,7 @@ void gqa_paged_host(
                                 mSeqLens, mPageTable,
                                 tma_atom_K, tma_atom_Q, tma_atom_V,
                                 tiled_bmm1, tiled_bmm2,
-                                softmax_scale * Log2_E, sliding_window_size, pdl_count));
+                                softmax_scale * Log2_E, sliding_window_size, causal, pdl_count));
   }
   else {
     auto *kernel_instance =
@@ -859,7 +864,7 @@ void gqa_paged_host(
                                 mSeqLens, mPageTable,
                                 tma_atom_K, tma_atom_Q, tma_atom_V,
                                 tiled_bmm1, tiled_bmm2,
-                                softmax_scale * Log2_E, sliding_window_size, pdl_count));
+                                softmax_scale * Log2_E, sliding_window_size, causal, pdl_count));
   }
 }
 
@@ -103,8 +103,61 @@ heuristic_permutation(Tensor<AEngine, ALayout> const& a,
   }
 }
 
+namespace detail {
+
+// The widest vector, in bits, that cooperative_copy can use for the permuted (V,rest) tensors:
+// a common vector of both tensors that keeps every vector of either tensor aligned, at most MaxVecBits
+template <uint32_t MaxVecBits,
+          class SrcEngine, class SrcLayout,
+          class DstEngine, class DstLayout>
+CUTE_HOST_DEVICE constexpr
+auto
+cooperative_copy_vec_bits(Tensor<SrcEngine, SrcLayout> const& src_a,
+                          Tensor<DstEngine, DstLayout> const& dst_a)
+{
+  constexpr int elem_bits   = sizeof_bits_v<typename SrcEngine::value_type>;
+  constexpr int common_bits = elem_bits * decltype(max_common_vector(src_a, dst_a))::value;
+  constexpr int align_src   = elem_bits * decltype(max_alignment(src_a.layout()))::value;
+  constexpr int align_dst   = elem_bits * decltype(max_alignment(dst_a.layout()))::value;
+  constexpr int vec_bits    = cute::gcd(cute::gcd(common_bits, int(MaxVecBits)), cute::gcd(align_src, align_dst));
+  return Int<cute::max(elem_bits, vec_bits)>{};
+}
+
+// Instantiated with CUTE_COOPERATIVE_COPY_REQUIRE_MAX_VECTORIZATION defined. A failure names the
+// vector width cooperative_copy chose for the tensors as VecBits.
+template <int VecBits, int MaxVecBits>
+struct cooperative_copy_require_max_vectorization {
+  static_assert(VecBits == MaxVecBits,
+                "cooperative_copy: the src and dst layouts only admit VecBits-wide vectors, below MaxVecBits.");
+  static constexpr bool value = true;
+};
+
+} // end namespace detail
+
+// cooperative_copy_vector_bits<MaxVecBits>(src, dst)
+// The vector width, in bits, with which cooperative_copy<NumThreads, MaxVecBits> copies src to dst,
+// e.g. static_assert(decltype(cooperative_copy_vector_bits<128>(src, dst))::value == 128);
+//
+template <uint32_t MaxVecBits,
+          class SrcEngine, class SrcLayout,
+          class DstEngine, class DstLayout>
+CUTE_HOST_DEVICE constexpr
+auto
+cooperative_copy_vector_bits(Tensor<SrcEngine, SrcLayout> const& src,
+                             Tensor<DstEngine, DstLayout> const& dst)
+{
+  auto common_layout = heuristic_permutation(src, dst);
+  return detail::cooperative_copy_vec_bits<MaxVecBits>(coalesce(logical_divide(src, common_layout), Shape<_1,_1>{}),
+                                                       coalesce(logical_divide(dst, common_layout), Shape<_1,_1>{}));
+}
+
 // cooperative_copy<NumThreads, MaxVecBits>(thr_idx, src, dst)
 // Use NumThreads to copy Tensor src to Tensor dst with element-wise vectorization up to MaxVecBits.
+// The widest vector the layouts of src and dst admit is always used, leaving threads idle if there
+// are fewer vectors than threads. If the vectors cannot be evenly partitioned across the threads,
+// the residue vectors are copied first by the leading threads.
+// Define CUTE_COOPERATIVE_COPY_REQUIRE_MAX_VECTORIZATION to make a width below MaxVecBits a
+// compile-time error, or query it with cooperative_copy_vector_bits.
 // @pre 0 <= @a tid < NumThreads
 // @pre Tensors @a src and @a dst are aligned up to MaxVecBits.
 //      That is, pointers and dynamic strides are assumed to be aligned up to MaxVecBits.
@@ -162,22 +215,32 @@ cooperative_copy(uint32_t                     const& tid,
   Tensor dst_a = coalesce(logical_divide(dst, common_layout), Shape<_1,_1>{});
 
   //
-  // Determine vectorization of elems and thrs based on src/dst size and number of threads
-  // NOTE: This heuristic promotes parallelization over vectorization
+  // Determine vectorization of elems based on the layouts of src/dst, then the number of threads
+  // NOTE: This heuristic promotes vectorization over parallelization
   //
 
   // The number of elements and number of bits
   constexpr int  elem_bits = sizeof_bits_v<typename SrcEngine::value_type>;
   constexpr int total_elem = size(SrcLayout{});
 
-  // The number of elements that can be vectorized in values
-  constexpr int common_elem = decltype(max_common_vector(src_a, dst_a))::value;
+  // The widest vector both tensors admit
+  constexpr int vec_bits   = decltype(detail::cooperative_copy_vec_bits<MaxVecBits>(src_a, dst_a))::value;
+  constexpr int vec_elem   = vec_bits / elem_bits;
+  constexpr int total_vec  = total_elem / vec_elem;
+
+  static_assert(vec_bits % elem_bits == 0, "Expected divisibility");
+  static_assert(total_elem % vec_elem == 0, "Expected divisibility");
+
+#if defined(CUTE_COOPERATIVE_COPY_REQUIRE_MAX_VECTORIZATION)
+  static_assert(detail::cooperative_copy_require_max_vectorization<vec_bits, int(MaxVecBits)>::value);
+#endif
 
 #if 0
       if (thread0()) {
         print("   "); print("common_layout: "); print(common_layout); print("\n");
         print("   "); print("src_a: "); print(src_a); print("\n");
         print("   "); print("dst_a: "); print(dst_a); print("\n");
+        print("   "); print("vec_bits: "); print(vec_bits); print("\n");
       }
 #ifdef __CUDA_ARCH__
       __syncthreads();
@@ -185,25 +248,18 @@ cooperative_copy(uint32_t                     const& tid,
 #endif
 
   //
-  if constexpr (total_elem % NumThreads != 0) {
-    // Not attempting to find a partitioning pattern, fallback to dynamically indexed slowpath
-
-    if constexpr (common_elem > 1 && MaxVecBits > elem_bits) {
-      // If the vectorization is non-trivial and divides the maximum vectorizations, then vectorize
-      constexpr auto max_align_src = elem_bits * decltype(max_alignment(src_a.layout()))::value;
-      constexpr auto max_align_dst = elem_bits * decltype(max_alignment(dst_a.layout()))::value;
-      constexpr auto vec_bits = gcd(max_align_src, max_align_dst, MaxVecBits);
-      using VecType = uint_bit_t<vec_bits>;
+  if constexpr (total_vec % NumThreads != 0 && total_vec > NumThreads) {
+    // The vectors cannot be partitioned evenly: copy the residue, then whole rounds over all threads
 
-      static_assert(vec_bits % elem_bits == 0, "Expected divisibility");
-      static_assert((vec_bits >= 8), "No support for subbyte copying");
+    if constexpr (vec_bits >= 8) {
+      using VecType = uint_bit_t<vec_bits>;
 
       Tensor src_v = recast<VecType const>(src_a);
       Tensor dst_v = recast<VecType      >(dst_a);
 
 #if 0
       if (thread0()) {
-        print("   "); print("cooperative_copy -- naive\n");
+        print("   "); print("cooperative_copy -- residue\n");
         print("   "); print("src_v: "); print(src_v); print("\n");
         print("   "); print("dst_v: "); print(dst_v); print("\n");
       }
@@ -212,31 +268,36 @@ cooperative_copy(uint32_t                     const& tid,
 #endif
 #endif
 
-      naive_cooperative_copy<NumThreads>(tid, src_v, dst_v);
+      // One vector of each tensor, keeping the memory space of its engine for the copy policy
+      auto copy_vec = [&](uint32_t i) {
+        Tensor src_i = make_tensor(src_v.data() + src_v.layout()(i), Layout<_1>{});
+        Tensor dst_i = make_tensor(dst_v.data() + dst_v.layout()(i), Layout<_1>{});
+        copy(cpy, src_i, dst_i);
+      };
+
+      constexpr uint32_t R = total_vec % NumThreads;
+      if (tid < R) {                                                          // Residue in-bounds
+        copy_vec(tid);
+      }
+      CUTE_UNROLL
+      for (uint32_t i = R; i < uint32_t(total_vec); i += NumThreads) {       // All in-bounds
+        copy_vec(tid + i);
+      }
     } else {
+      // Subbyte elements without vectorization, fallback to dynamically indexed slowpath
       naive_cooperative_copy<NumThreads>(tid, src_a, dst_a);
     }
   } else {
-    // If the tensors can be equally partitioned by the threads,
-    // compute vectorization widths in elements and threads.
-
-    // If there are too many threads to allow a full vectorized copy, trunc the vectorization
-    constexpr int total_bits = total_elem * elem_bits;
-    constexpr int max_bits_per_thr = total_bits / NumThreads;
-    // At least elem_bits, at most common_bits
-    constexpr int common_bits = common_elem * elem_bits;
-    constexpr int vec_bits = cute::max(elem_bits, cute::gcd(common_bits, int(MaxVecBits), max_bits_per_thr));
+    // The vectors can be equally partitioned by the threads, possibly leaving threads idle
 
-    // Should account for vec_bits < 8 and/or vec_elem <= 1
+    // Should account for vec_bits < 8
     // And also account for subbyte types, which could cause race conditions
     // Want to ENFORCE sufficient vectorization in those cases
-    static_assert(vec_bits % elem_bits == 0, "Expected divisibility");
     static_assert(vec_bits >= 8, "No support for subbyte copying");
 
     using VecType = uint_bit_t<vec_bits>;
-    constexpr int vec_elem = vec_bits / elem_bits;
 
-    constexpr int vec_thrs = cute::min(int(NumThreads), total_elem / vec_elem);
+    constexpr int vec_thrs = cute::min(int(NumThreads), total_vec);
 
     //
     // Determine the partitioning patterns for the vec_elems and vec_thrs
@@ -287,6 +348,64 @@ cooperative_copy(uint32_t                     const& tid,
 }
 
 
+#if defined(CUTE_COPY_ATOM_TMA_SM90_ENABLED)
+// cooperative_copy<NumThreads, MaxVecBits>(thr_idx, src, dst, Copy_Traits<SM90_BULK_COPY_AUTO>{}.with(mbar))
+// Use NumThreads to copy Tensor src to Tensor dst with cp.async.bulk, without a TMA descriptor.
+// The tensors are split into their largest common contiguous chunks, each copied by a single
+// bulk copy, and the chunks are distributed across the threads. MaxVecBits is not used.
+// @pre 0 <= @a tid < NumThreads
+// @pre The chunks are multiples of 16B and aligned to 16B in both tensors.
+// @pre For gmem -> smem, the memory barrier expects the transaction bytes of all of @a dst.
+//      For smem -> gmem, the issuing threads commit and wait on their bulk async-groups.
+//
+template <uint32_t NumThreads, uint32_t MaxVecBits,
+          class SrcEngine, class SrcLayout,
+          class DstEngine, class DstLayout,
+          class... CT_Args>
+CUTE_HOST_DEVICE
+void
+cooperative_copy(uint32_t                                     const& tid,
+                 Tensor<SrcEngine, SrcLayout>                 const& src,
+                 Tensor<DstEngine, DstLayout>                      & dst,
+                 Copy_Traits<SM90_BULK_COPY_AUTO, CT_Args...> const& atom)
+{
+  CUTE_STATIC_ASSERT_V(is_static<decltype(shape(src))>{} && is_static<decltype(shape(dst))>{});
+  CUTE_STATIC_ASSERT_V(size(src) == size(dst));
+  // Precondition on tid in DEBUG
+  assert(tid < NumThreads);
+
+  // The common contiguous chunk of both tensors
+  // (V, Rest)
+  auto tiler = max_common_layout(src, dst);
+  Tensor src_v = logical_divide(src, tiler);
+  Tensor dst_v = logical_divide(dst, tiler);
+
+  constexpr int num_chunks = decltype(size<1>(src_v))::value;
+
+  CUTE_UNROLL
+  for (int i = int(tid); i < num_chunks; i += int(NumThreads)) {
+    Tensor dst_i = dst_v(_,i);
+    copy(atom, src_v(_,i), dst_i);
+  }
+}
+
+template <uint32_t NumThreads, uint32_t MaxVecBits,
+          class SrcEngine, class SrcLayout,
+          class DstEngine, class DstLayout,
+          class... CT_Args, class... CA_Args>
+CUTE_HOST_DEVICE
+void
+cooperative_copy(uint32_t                                                            const& tid,
+                 Tensor<SrcEngine, SrcLayout>                                        const& src,
+                 Tensor<DstEngine, DstLayout>                                             & dst,
+                 Copy_Atom<Copy_Traits<SM90_BULK_COPY_AUTO, CT_Args...>, CA_Args...> const& atom)
+{
+  return cooperative_copy<NumThreads, MaxVecBits>(tid, src, dst,
+                                                  static_cast<Copy_Traits<SM90_BULK_COPY_AUTO, CT_Args...> const&>(atom));
+}
+#endif // #if defined(CUTE_COPY_ATOM_TMA_SM90_ENABLED)
+
+
 // Default max-vectorization size to value_type size
 template <uint32_t NumThreads,
           class SrcEngine, class SrcLayout,
@@ -37,6 +37,10 @@
 #include <cute/algorithm/functional.hpp>
 #include <cute/algorithm/fill.hpp>
 
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ >= 800
+  #define CUTE_ARCH_REDUX_SYNC_ENABLED 1
+#endif
+
 namespace cute
 {
 
@@ -104,4 +108,240 @@ logical_reduce(Tensor<SrcEngine, SrcLayout> const& src,
   batch_reduce(src_tensor, dst, op);
 }
 
+//
+// Warp-level segmented reduction
+//
+//   A segment is the set of SegmentSize lanes { base + k * LaneStride : k in [0,SegmentSize) } that
+//   differ from each other only in the lane-index bits covered by (SegmentSize-1) * LaneStride.
+//   For example, SegmentSize = 8 and LaneStride = 4 reduces across the lanes that hold the same row
+//   of an SM80 16x8 MMA accumulator, and SegmentSize = 32 reduces across the whole warp.
+//   Every lane of the segment receives the reduced value (all-reduce).
+//
+//   32-bit integer plus, min, max, and bitwise reductions use redux.sync when available (SM80+),
+//   everything else uses a shuffle-xor butterfly of log2(SegmentSize) steps.
+//
+
+namespace detail {
+
+// Lanes that belong to the same segment as @a lane
+template <int SegmentSize, int LaneStride>
+CUTE_HOST_DEVICE constexpr
+uint32_t
+warp_segment_mask(int lane)
+{
+  static_assert(has_single_bit(SegmentSize) && has_single_bit(LaneStride), "Segment size and lane stride must be powers of two.");
+  static_assert(SegmentSize * LaneStride <= 32, "Segment must fit within a warp.");
+
+  uint32_t base = uint32_t(lane) & ~uint32_t((SegmentSize - 1) * LaneStride);
+  uint32_t mask = 0;
+  for (int k = 0; k < SegmentSize; ++k) {
+    mask |= uint32_t(1) << (base + k * LaneStride);
+  }
+  return mask;
+}
+
+// Whether redux.sync implements @a BinaryOp on @a T
+template <class T, class BinaryOp>
+inline constexpr bool is_redux_sync_op_v = is_std_integral<T>::value && sizeof(T) == 4 &&
+                                            is_any_of_v<BinaryOp, plus, min_fn, max_fn, bit_and, bit_or, bit_xor>;
+
+template <class BinaryOp, class T>
+CUTE_DEVICE
+T
+redux_sync(uint32_t mask, T value)
+{
+#if defined(CUTE_ARCH_REDUX_SYNC_ENABLED)
+  static_assert(is_redux_sync_op_v<T,BinaryOp>, "Unsupported redux.sync operation.");
+  uint32_t v = reinterpret_cast<uint32_t const&>(value);
+  uint32_t r;
+  if constexpr (is_same_v<BinaryOp, plus>) {
+    asm volatile("redux.sync.add.u32 %0, %1, %2;\n" : "=r"(r) : "r"(v), "r"(mask));
+  } else
+  if constexpr (is_same_v<BinaryOp, min_fn> && is_signed_v<T>) {
+    asm volatile("redux.sync.min.s32 %0, %1, %2;\n" : "=r"(r) : "r"(v), "r"(mask));
+  } else
+  if constexpr (is_same_v<BinaryOp, min_fn>) {
+    asm volatile("redux.sync.min.u32 %0, %1, %2;\n" : "=r"(r) : "r"(v), "r"(mask));
+  } else
+  if constexpr (is_same_v<BinaryOp, max_fn> && is_signed_v<T>) {
+    asm volatile("redux.sync.max.s32 %0, %1, %2;\n" : "=r"(r) : "r"(v), "r"(mask));
+  } else
+  if constexpr (is_same_v<BinaryOp, max_fn>) {
+    asm volatile("redux.sync.max.u32 %0, %1, %2;\n" : "=r"(r) : "r"(v), "r"(mask));
+  } else
+  if constexpr (is_same_v<BinaryOp, bit_and>) {
+    asm volatile("redux.sync.and.b32 %0, %1, %2;\n" : "=r"(r) : "r"(v), "r"(mask));
+  } else
+  if constexpr (is_same_v<BinaryOp, bit_or>) {
+    asm volatile("redux.sync.or.b32 %0, %1, %2;\n" : "=r"(r) : "r"(v), "r"(mask));
+  } else {
+    asm volatile("redux.sync.xor.b32 %0, %1, %2;\n" : "=r"(r) : "r"(v), "r"(mask));
+  }
+  return reinterpret_cast<T const&>(r);
+#else
+  CUTE_INVALID_CONTROL_PATH("Trying to use redux.sync without CUTE_ARCH_REDUX_SYNC_ENABLED.");
+  return value;
+#endif
+}
+
+// Exchange @a value of any trivially copyable type with lane (laneid ^ @a lane_mask), 32 bits at a time
+template <class T>
+CUTE_DEVICE
+T
+shfl_xor_sync(uint32_t mask, T const& value, int lane_mask)
+{
+  static_assert(is_trivially_copyable<T>::value, "Shuffled values must be trivially copyable.");
+  constexpr int NumWords = (sizeof(T) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+  uint32_t words[NumWords] = {};
+  memcpy(words, &value, sizeof(T));
+  CUTE_UNROLL
+  for (int i = 0; i < NumWords; ++i) {
+    words[i] = __shfl_xor_sync(mask, words[i], lane_mask);
+  }
+  T result;
+  memcpy(&result, words, sizeof(T));
+  return result;
+}
+
+CUTE_DEVICE
+uint32_t
+lane_id()
+{
+#if defined(__CUDA_ARCH__)
+  uint32_t lane;
+  asm volatile("mov.u32 %0, %%laneid;\n" : "=r"(lane));
+  return lane;
+#else
+  return 0;
+#endif
+}
+
+} // end namespace detail
+
+// Reduce @a value across the lanes of its warp segment and return the result in every lane of the segment.
+// @pre All 32 lanes of the warp call this together with the same SegmentSize and LaneStride.
+template <int SegmentSize = 32, int LaneStride = 1, class T, class BinaryOp = cute::plus>
+CUTE_DEVICE
+T
+warp_reduce(T value, BinaryOp op = {})
+{
+  static_assert(has_single_bit(SegmentSize) && has_single_bit(LaneStride), "Segment size and lane stride must be powers of two.");
+  static_assert(SegmentSize * LaneStride <= 32, "Segment must fit within a warp.");
+
+  if constexpr (SegmentSize == 1) {
+    return value;
+  } else {
+#if defined(CUTE_ARCH_REDUX_SYNC_ENABLED)
+    if constexpr (detail::is_redux_sync_op_v<T,BinaryOp>) {
+      return detail::redux_sync<BinaryOp>(detail::warp_segment_mask<SegmentSize,LaneStride>(detail::lane_id()), value);
+    }
+#endif
+    CUTE_UNROLL
+    for (int offset = (SegmentSize / 2) * LaneStride; offset >= LaneStride; offset /= 2) {
+      value = op(value, detail::shfl_xor_sync(0xffffffff, value, offset));
+    }
+    return value;
+  }
+
+  CUTE_GCC_UNREACHABLE;
+}
+
+// Reduce every element of the register fragment @a frg across the lanes of its warp segment, in place.
+// After the call, each lane of a segment holds the same reduced fragment.
+// @pre All 32 lanes of the warp call this together, with fragments of the same static size.
+template <int SegmentSize = 32, int LaneStride = 1,
+          class Engine, class Layout,
+          class BinaryOp = cute::plus>
+CUTE_DEVICE
+void
+warp_reduce(Tensor<Engine,Layout>& frg, BinaryOp op = {})
+{
+  CUTE_UNROLL
+  for (int i = 0; i < size(frg); ++i) {
+    frg(i) = warp_reduce<SegmentSize,LaneStride>(frg(i), op);
+  }
+}
+
+template <int SegmentSize = 32, int LaneStride = 1,
+          class Engine, class Layout,
+          class BinaryOp = cute::plus>
+CUTE_DEVICE
+void
+warp_reduce(Tensor<Engine,Layout>&& frg, BinaryOp op = {})
+{
+  warp_reduce<SegmentSize,LaneStride>(frg, op);
+}
+
+// Reduce every element of the register fragment @a frg across a warpgroup segment, in place.
+//   The segment is the warp segment (SegmentSize, LaneStride) of each lane, extended across the four warps
+//   of the warpgroup: lanes that hold the same position within their warp segments combine their fragments.
+//   Partial results are exchanged through @a smem, which needs room for
+//   size(frg) * (32 / SegmentSize) * 4 elements, and named barrier @a barrier_id synchronizes the warpgroup.
+// @pre All 128 threads of the warpgroup call this together; @a thread_idx is the index within the warpgroup.
+// @pre No thread of the warpgroup is still reading @a smem from a previous use.
+// @post @a smem may be reused once the warpgroup has synchronized again.
+template <int SegmentSize = 32, int LaneStride = 1,
+          class Engine, class Layout,
+          class SmemEngine, class SmemLayout,
+          class BinaryOp = cute::plus>
+CUTE_DEVICE
+void
+warpgroup_reduce(Tensor<Engine,Layout>&             frg,
+                 Tensor<SmemEngine,SmemLayout> const& smem,
+                 int                                thread_idx,
+                 uint32_t                           barrier_id,
+                 BinaryOp                           op = {})
+{
+  constexpr int NumWarps    = 4;
+  constexpr int NumSegments = 32 / SegmentSize;
+  assert(size(smem) >= size(frg) * NumSegments * NumWarps);
+
+  warp_reduce<SegmentSize,LaneStride>(frg, op);
+
+  // Segment index within the warp, and whether this lane is the first lane of its segment
+  int lane    = thread_idx % 32;
+  int warp    = (thread_idx / 32) % NumWarps;
+  int seg_idx = (lane % LaneStride) + (lane / (SegmentSize * LaneStride)) * LaneStride;
+  bool leader = ((lane / LaneStride) % SegmentSize) == 0;
+
+  // (frg, segment, warp)
+  Tensor partials = make_tensor(smem.data(), make_layout(make_shape(size(frg), Int<NumSegments>{}, Int<NumWarps>{})));
+  if (leader) {
+    CUTE_UNROLL
+    for (int i = 0; i < size(frg); ++i) {
+      partials(i, seg_idx, warp) = frg(i);
+    }
+  }
+
+#if defined(__CUDA_ARCH__)
+  asm volatile("bar.sync %0, %1;\n" : : "r"(barrier_id), "n"(NumWarps * 32));
+#endif
+
+  CUTE_UNROLL
+  for (int i = 0; i < size(frg); ++i) {
+    auto result = partials(i, seg_idx, 0);
+    CUTE_UNROLL
+    for (int w = 1; w < NumWarps; ++w) {
+      result = op(result, partials(i, seg_idx, w));
+    }
+    frg(i) = result;
+  }
+}
+
+template <int SegmentSize = 32, int LaneStride = 1,
+          class Engine, class Layout,
+          class SmemEngine, class SmemLayout,
+          class BinaryOp = cute::plus>
+CUTE_DEVICE
+void
+warpgroup_reduce(Tensor<Engine,Layout>&&            frg,
+                 Tensor<SmemEngine,SmemLayout> const& smem,
+                 int                                thread_idx,
+                 uint32_t                           barrier_id,
+                 BinaryOp                           op = {})
+{
+  warpgroup_reduce<SegmentSize,LaneStride>(frg, smem, thread_idx, barrier_id, op);
+}
+
 } // end namespace cute
@@ -1259,6 +1259,23 @@ tma_store_wait() {
 }
 
 
+// Wait until at most Count committed TMA_STOREs are pending and the writes of all prior commits are
+// complete, i.e. visible in global memory rather than only read out of shared memory
+template <int Count>
+CUTE_HOST_DEVICE static void
+tma_store_wait_writes() {
+#if defined(CUTE_ARCH_TMA_SM90_ENABLED)
+    asm volatile(
+      "cp.async.bulk.wait_group %0;"
+      :
+      : "n"(Count)
+      : "memory");
+    cutlass::arch::synclog_emit_tma_store_wait(__LINE__, Count);
+#else
+    CUTE_INVALID_CONTROL_PATH("Trying to use tma without CUTE_ARCH_TMA_SM90_ENABLED.");
+#endif
+}
+
 // Wait until all TMA descriptor previously issued are safe to be modified after tma_desc_commit_group()
 CUTE_HOST_DEVICE static void
 tma_desc_wait_group() {
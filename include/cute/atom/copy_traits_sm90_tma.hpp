@@ -35,6 +35,7 @@
 #endif
 
 #include <cute/atom/copy_traits_sm90_tma_swizzle.hpp>
+#include <cute/atom/copy_traits_sm90_tma_cache.hpp>
 #include <cute/atom/copy_traits.hpp>
 #include <cute/atom/copy_atom.hpp>
 
@@ -1044,46 +1045,68 @@ make_tma_copy_desc(Tensor<GEngine,GLayout> const& gtensor,         // The origin
     TMA::SmemSwizzleBits swizzle_bits = get_tma_swizzle_bits(swizzle);
     TMA::SmemSwizzleBase swizzle_base = get_tma_swizzle_base(swizzle);
     CUtensorMapSwizzle smem_swizzle = TMA::to_CUtensorMapSwizzle(swizzle_bits, swizzle_base);
-    CUresult result = CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuTensorMapEncodeTiled)(
-        &tma_desc,
-        tma_format,
-        tma_dim,
-        gmem_address,
-        gmem_prob_shape.data(),
-        gmem_prob_stride.data() + 1,  // gmem_prob_stride[0] implicitly 1
-        smem_box_shape.data(),
-        smem_box_stride.data(),
-        tma_interleave,
-        smem_swizzle,
-        tma_l2Promotion,
-        tma_oobFill);
-   
-    int driver_version = 0;
-    cudaError_t driver_version_err = cudaDriverGetVersion(&driver_version);
-    assert(driver_version_err == cudaSuccess);
-    if (driver_version <= 13010) {      
-      if (cute::bits_to_bytes(
-            cute::cosize(gtensor.layout()) *
-            cute::sizeof_bits<typename GEngine::value_type>::value) < 131072) {
-        reinterpret_cast<uint64_t*>(&tma_desc)[1] &= ~(1llu << 21);
+
+    // Descriptors of tensors under 128KiB may be patched after encoding
+    bool is_small_tensor = cute::bits_to_bytes(
+                             cute::cosize(gtensor.layout()) *
+                             cute::sizeof_bits<typename GEngine::value_type>::value) < 131072;
+
+    bool is_cached = false;
+  #if defined(CUTE_ENABLE_TMA_DESCRIPTOR_CACHE)
+    TMA::DescriptorCacheKey cache_key = TMA::make_descriptor_cache_key(
+        tma_format, tma_dim, gmem_address,
+        gmem_prob_shape.data(), gmem_prob_stride.data() + 1,
+        smem_box_shape.data(), smem_box_stride.data(),
+        tma_interleave, smem_swizzle, tma_l2Promotion, tma_oobFill,
+        uint64_t(is_small_tensor));
+    is_cached = TMA::DescriptorCache::get().find(cache_key, tma_desc);
+  #endif
+
+    if (not is_cached) {
+      CUresult result = CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuTensorMapEncodeTiled)(
+          &tma_desc,
+          tma_format,
+          tma_dim,
+          gmem_address,
+          gmem_prob_shape.data(),
+          gmem_prob_stride.data() + 1,  // gmem_prob_stride[0] implicitly 1
+          smem_box_shape.data(),
+          smem_box_stride.data(),
+          tma_interleave,
+          smem_swizzle,
+          tma_l2Promotion,
+          tma_oobFill);
+
+      int driver_version = 0;
+      cudaError_t driver_version_err = cudaDriverGetVersion(&driver_version);
+      assert(driver_version_err == cudaSuccess);
+      if (driver_version <= 13010) {      
+        if (is_small_tensor) {
+          reinterpret_cast<uint64_t*>(&tma_desc)[1] &= ~(1llu << 21);
+        }
       }
-    }
 
-    if (result != CUDA_SUCCESS) {
-      std::cerr << "TMA Desc Addr:   " << &tma_desc
-                << "\nformat         " << tma_format
-                << "\ndim            " << tma_dim
-                << "\ngmem_address   " << gmem_address
-                << "\nglobalDim      " << gmem_prob_shape
-                << "\nglobalStrides  " << gmem_prob_stride
-                << "\nboxDim         " << smem_box_shape
-                << "\nelementStrides " << smem_box_stride
-                << "\ninterleave     " << tma_interleave
-                << "\nswizzle        " << smem_swizzle
-                << "\nl2Promotion    " << tma_l2Promotion
-                << "\noobFill        " << tma_oobFill << std::endl;
-      std::cerr << "Error: Failed to initialize the TMA descriptor " << result << std::endl;
-      assert(false);
+      if (result != CUDA_SUCCESS) {
+        std::cerr << "TMA Desc Addr:   " << &tma_desc
+                  << "\nformat         " << tma_format
+                  << "\ndim            " << tma_dim
+                  << "\ngmem_address   " << gmem_address
+                  << "\nglobalDim      " << gmem_prob_shape
+                  << "\nglobalStrides  " << gmem_prob_stride
+                  << "\nboxDim         " << smem_box_shape
+                  << "\nelementStrides " << smem_box_stride
+                  << "\ninterleave     " << tma_interleave
+                  << "\nswizzle        " << smem_swizzle
+                  << "\nl2Promotion    " << tma_l2Promotion
+                  << "\noobFill        " << tma_oobFill << std::endl;
+        std::cerr << "Error: Failed to initialize the TMA descriptor " << result << std::endl;
+        assert(false);
+      }
+  #if defined(CUTE_ENABLE_TMA_DESCRIPTOR_CACHE)
+      else {
+        TMA::DescriptorCache::get().insert(cache_key, tma_desc);
+      }
+  #endif
     }
 
   #endif // (__CUDACC_VER_MAJOR__ >= 12) && !defined(__CUDACC_RTC__)
@@ -0,0 +1,202 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/// @file copy_traits_sm90_tma_cache.hpp
+/// @brief Host-side cache of encoded TMA descriptors
+///
+/// Define CUTE_ENABLE_TMA_DESCRIPTOR_CACHE to have make_tma_copy and all collectives built on it
+/// reuse previously encoded descriptors instead of calling cuTensorMapEncodeTiled again. An encoded
+/// descriptor depends only on its encoding parameters, so a cached entry never becomes stale, even
+/// if its global memory is freed and later reused.
+
+#if !defined(__CUDACC_RTC__)
+#include <cuda.h>
+#endif
+
+#include <cute/config.hpp>
+#include <cute/arch/copy_sm90_desc.hpp>  // cute::TmaDescriptor
+
+#if (__CUDACC_VER_MAJOR__ >= 12) && !defined(__CUDACC_RTC__)
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#endif
+
+namespace cute::TMA {
+
+#if (__CUDACC_VER_MAJOR__ >= 12) && !defined(__CUDACC_RTC__)
+
+/// All arguments of cuTensorMapEncodeTiled, plus any state used to patch the encoded descriptor
+struct DescriptorCacheKey {
+  std::array<uint64_t, 27> words{};
+
+  bool operator==(DescriptorCacheKey const& other) const { return words == other.words; }
+};
+
+struct DescriptorCacheKeyHash {
+  size_t operator()(DescriptorCacheKey const& key) const {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (uint64_t word : key.words) {
+      hash = (hash ^ word) * 0x100000001b3ull;
+    }
+    return size_t(hash);
+  }
+};
+
+inline
+DescriptorCacheKey
+make_descriptor_cache_key(CUtensorMapDataType     format,
+                          uint32_t                rank,
+                          void const*             gmem_address,
+                          uint64_t const*         gmem_shape,     // [5]
+                          uint64_t const*         gmem_stride,    // [4], in bytes, skipping the implicit unit stride
+                          uint32_t const*         box_shape,      // [5]
+                          uint32_t const*         box_stride,     // [5]
+                          CUtensorMapInterleave   interleave,
+                          CUtensorMapSwizzle      swizzle,
+                          CUtensorMapL2promotion  l2_promotion,
+                          CUtensorMapFloatOOBfill oob_fill,
+                          uint64_t                extra)          // patch state of the encoded descriptor
+{
+  DescriptorCacheKey key;
+  int w = 0;
+  key.words[w++] = uint64_t(format);
+  key.words[w++] = uint64_t(rank);
+  key.words[w++] = reinterpret_cast<uint64_t>(gmem_address);
+  for (int i = 0; i < 5; ++i) { key.words[w++] = gmem_shape[i];  }
+  for (int i = 0; i < 4; ++i) { key.words[w++] = gmem_stride[i]; }
+  for (int i = 0; i < 5; ++i) { key.words[w++] = box_shape[i];   }
+  for (int i = 0; i < 5; ++i) { key.words[w++] = box_stride[i];  }
+  key.words[w++] = uint64_t(interleave);
+  key.words[w++] = uint64_t(swizzle);
+  key.words[w++] = uint64_t(l2_promotion);
+  key.words[w++] = uint64_t(oob_fill);
+  key.words[w++] = extra;
+  assert(w == int(key.words.size()));
+  return key;
+}
+
+/// Thread-safe, process-wide map from encoding parameters to encoded TMA descriptors.
+/// Once the cache holds `capacity()` descriptors it is cleared before the next insertion.
+class DescriptorCache {
+public:
+
+  /// Returns the process-wide cache
+  static DescriptorCache& get() {
+    static DescriptorCache cache;
+    return cache;
+  }
+
+  /// Copies the cached descriptor for `key` to `desc`. Returns false if there is none.
+  bool find(DescriptorCacheKey const& key, TmaDescriptor& desc) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!enabled_) {
+      return false;
+    }
+    auto it = map_.find(key);
+    if (it == map_.end()) {
+      ++misses_;
+      return false;
+    }
+    ++hits_;
+    std::memcpy(&desc, &it->second, sizeof(TmaDescriptor));
+    return true;
+  }
+
+  void insert(DescriptorCacheKey const& key, TmaDescriptor const& desc) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!enabled_) {
+      return;
+    }
+    if (map_.size() >= capacity_) {
+      map_.clear();
+    }
+    map_[key] = desc;
+  }
+
+  /// Enables or disables lookups and insertions. The cache is enabled by default.
+  void set_enabled(bool enabled) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    enabled_ = enabled;
+  }
+
+  void set_capacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    capacity_ = capacity;
+    if (map_.size() > capacity_) {
+      map_.clear();
+    }
+  }
+
+  /// Drops all descriptors and resets the statistics
+  void clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.clear();
+    hits_ = 0;
+    misses_ = 0;
+  }
+
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.size();
+  }
+
+  size_t capacity() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return capacity_;
+  }
+
+  uint64_t hits() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return hits_;
+  }
+
+  uint64_t misses() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return misses_;
+  }
+
+private:
+  mutable std::mutex mutex_;
+  std::unordered_map<DescriptorCacheKey, TmaDescriptor, DescriptorCacheKeyHash> map_;
+  size_t capacity_ = 4096;
+  uint64_t hits_ = 0;
+  uint64_t misses_ = 0;
+  bool enabled_ = true;
+};
+
+#endif // (__CUDACC_VER_MAJOR__ >= 12) && !defined(__CUDACC_RTC__)
+
+} // end namespace cute::TMA
@@ -1017,6 +1017,43 @@ group(Layout<Shape,Stride> const& layout)
                      group<B,E>(layout.stride()));
 }
 
+//
+// Static layout algebra
+//   When every argument is static, the result of a layout algebra operation is a function of
+//   the argument types alone. Deduce it once per argument types in an unevaluated context and
+//   return a value-initialized instance instead: the deep chain of fold/transform helpers is
+//   then only type-checked and never odr-used, so it is never code-generated on either the
+//   host or the device side. Results that are not static fall back to the regular evaluation.
+//
+
+namespace detail {
+
+template <class Fn, class... Args>
+struct static_layout_algebra {
+  using type = decltype(declval<Fn const&>()(declval<Args const&>()...));
+};
+
+template <class Fn, class... Args>
+CUTE_HOST_DEVICE constexpr
+auto
+memoized_layout_algebra(Fn const& fn, Args const&... args)
+{
+  if constexpr ((is_static<Args>::value && ...)) {
+    using Result = typename static_layout_algebra<Fn,Args...>::type;
+    if constexpr (is_static<Result>::value) {
+      return Result{};
+    } else {
+      return fn(args...);
+    }
+  } else {
+    return fn(args...);
+  }
+
+  CUTE_GCC_UNREACHABLE;
+}
+
+} // end namespace detail
+
 //
 // Composition of two layouts: lhs o rhs
 // @post compatible(rhs, result)
@@ -1136,8 +1173,10 @@ auto
 composition(Layout<LShape,LStride> const& lhs,
             Layout<RShape,RStride> const& rhs)
 {
-  auto flat_lhs = detail::coalesce_x(lhs, coprofile(rhs));
-  return detail::composition_impl(flat_lhs.shape(), flat_lhs.stride(), rhs.shape(), rhs.stride());
+  return detail::memoized_layout_algebra([](auto const& a, auto const& b) {
+    auto flat_lhs = detail::coalesce_x(a, coprofile(b));
+    return detail::composition_impl(flat_lhs.shape(), flat_lhs.stride(), b.shape(), b.stride());
+  }, lhs, rhs);
 }
 
 template <class LShape, class LStride, class Tiler>
@@ -1153,8 +1192,10 @@ composition(Layout<LShape,LStride> const& lhs,
   } else if constexpr (is_underscore<Tiler>::value) {
     return lhs;
   } else if constexpr (is_integral<Tiler>::value) {
-    auto flat_lhs = detail::coalesce_x(lhs);
-    return detail::composition_impl(flat_lhs.shape(), flat_lhs.stride(), rhs, Int<1>{});
+    return detail::memoized_layout_algebra([](auto const& a, auto const& b) {
+      auto flat_lhs = detail::coalesce_x(a);
+      return detail::composition_impl(flat_lhs.shape(), flat_lhs.stride(), b, Int<1>{});
+    }, lhs, rhs);
   }
 
   CUTE_GCC_UNREACHABLE;
@@ -1233,8 +1274,10 @@ CUTE_HOST_DEVICE constexpr
 auto
 complement(Layout<Shape,Stride> const& layout, CoTarget const& cotarget)
 {
-  auto filter_layout = filter(layout);
-  return detail::complement(filter_layout.shape(), filter_layout.stride(), shape(cotarget));
+  return detail::memoized_layout_algebra([](auto const& l, auto const& t) {
+    auto filter_layout = filter(l);
+    return detail::complement(filter_layout.shape(), filter_layout.stride(), shape(t));
+  }, layout, cotarget);
 }
 
 template <class Shape, class Stride>
@@ -1242,8 +1285,10 @@ CUTE_HOST_DEVICE constexpr
 auto
 complement(Layout<Shape,Stride> const& layout)
 {
-  auto filter_layout = filter(layout);
-  return detail::complement(filter_layout.shape(), filter_layout.stride(), cosize(filter_layout));
+  return detail::memoized_layout_algebra([](auto const& l) {
+    auto filter_layout = filter(l);
+    return detail::complement(filter_layout.shape(), filter_layout.stride(), cosize(filter_layout));
+  }, layout);
 }
 
 //
@@ -1259,10 +1304,12 @@ complement(Layout<Shape,Stride> const& layout)
 //    composition(@a layout, @a result) is identical to make_layout(shape(result))
 //
 
+namespace detail {
+
 template <class Shape, class Stride>
 CUTE_HOST_DEVICE constexpr
 auto
-right_inverse(Layout<Shape,Stride> const& layout)
+right_inverse_impl(Layout<Shape,Stride> const& layout)
 {
   // Flatten and filter shape-1
   auto clayout = coalesce(layout);
@@ -1302,6 +1349,16 @@ right_inverse(Layout<Shape,Stride> const& layout)
   return coalesce(make_layout(result_shape, result_stride));
 }
 
+} // end namespace detail
+
+template <class Shape, class Stride>
+CUTE_HOST_DEVICE constexpr
+auto
+right_inverse(Layout<Shape,Stride> const& layout)
+{
+  return detail::memoized_layout_algebra([](auto const& l) { return detail::right_inverse_impl(l); }, layout);
+}
+
 CUTE_HOST_DEVICE constexpr
 auto
 right_inverse(Underscore const& _)
@@ -1318,10 +1375,12 @@ right_inverse(Underscore const& _)
 //    composition(@layout, composition(@a result, @a layout)) is identical to @a layout
 //
 
+namespace detail {
+
 template <class Shape, class Stride>
 CUTE_HOST_DEVICE constexpr
 auto
-left_inverse(Layout<Shape,Stride> const& layout)
+left_inverse_impl(Layout<Shape,Stride> const& layout)
 {
   // Flatten and filter shape-1
   auto clayout = coalesce(layout);
@@ -1360,6 +1419,16 @@ left_inverse(Layout<Shape,Stride> const& layout)
                               result_stride));
 }
 
+} // end namespace detail
+
+template <class Shape, class Stride>
+CUTE_HOST_DEVICE constexpr
+auto
+left_inverse(Layout<Shape,Stride> const& layout)
+{
+  return detail::memoized_layout_algebra([](auto const& l) { return detail::left_inverse_impl(l); }, layout);
+}
+
 CUTE_HOST_DEVICE constexpr
 auto
 left_inverse(Underscore const& _)
@@ -1559,7 +1628,9 @@ auto
 logical_divide(Layout<LShape,LStride> const& layout,
                Layout<TShape,TStride> const& tiler)
 {
-  return composition(layout, make_layout(tiler, complement(tiler, shape(coalesce(layout)))));
+  return detail::memoized_layout_algebra([](auto const& l, auto const& t) {
+    return composition(l, make_layout(t, complement(t, shape(coalesce(l)))));
+  }, layout, tiler);
 }
 
 template <class LShape, class LStride, class Tiler>
@@ -331,13 +331,15 @@ auto
 composition(Layout<ShapeA,StrideA> const& a,
             Swizzle<B,M,S>         const& b)
 {
-  // Get the Z bits and the Y bits
-  auto active_Y = a(typename Swizzle<B,M,S>::yyy_msk{});
-  auto active_Z = a(typename Swizzle<B,M,S>::zzz_msk{});
+  return detail::memoized_layout_algebra([](auto const& l) {
+    // Get the Z bits and the Y bits
+    auto active_Y = l(typename Swizzle<B,M,S>::yyy_msk{});
+    auto active_Z = l(typename Swizzle<B,M,S>::zzz_msk{});
 
-  // Works in simple cases... but could be greatly generalized
+    // Works in simple cases... but could be greatly generalized
 
-  return composition(make_swizzle<active_Y,active_Z>(), a);
+    return composition(make_swizzle<active_Y,active_Z>(), l);
+  }, a);
 }
 
 //
@@ -350,11 +352,13 @@ CUTE_HOST_DEVICE constexpr
 auto
 right_inverse(ComposedLayout<Swizzle<B,M,S>,Offset,Layout> const& layout)
 {
-  if constexpr (is_constant<0, Offset>::value) {
-    return composition(right_inverse(layout.layout_b()), layout.layout_a());
-  } else {
-    return composition(right_inverse(layout.layout_b()), right_inverse(layout.offset()), right_inverse(layout.layout_a()));
-  }
+  return detail::memoized_layout_algebra([](auto const& l) {
+    if constexpr (is_constant<0, Offset>::value) {
+      return composition(right_inverse(l.layout_b()), l.layout_a());
+    } else {
+      return composition(right_inverse(l.layout_b()), right_inverse(l.offset()), right_inverse(l.layout_a()));
+    }
+  }, layout);
 }
 
 // Specialization to attempt to pass-through the Swizzle back to the left -- Needed?
@@ -363,11 +367,13 @@ CUTE_HOST_DEVICE constexpr
 auto
 left_inverse(ComposedLayout<Swizzle<B,M,S>,Offset,Layout> const& layout)
 {
-  if constexpr (is_constant<0, Offset>::value) {
-    return composition(left_inverse(layout.layout_b()), layout.layout_a());
-  } else {
-    return composition(left_inverse(layout.layout_b()), left_inverse(layout.offset()), left_inverse(layout.layout_a()));
-  }
+  return detail::memoized_layout_algebra([](auto const& l) {
+    if constexpr (is_constant<0, Offset>::value) {
+      return composition(left_inverse(l.layout_b()), l.layout_a());
+    } else {
+      return composition(left_inverse(l.layout_b()), left_inverse(l.offset()), left_inverse(l.layout_a()));
+    }
+  }, layout);
 }
 
 template <int B, int M, int S>
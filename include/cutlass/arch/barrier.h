@@ -739,6 +739,22 @@ void fence_view_async_shared() {
 #endif
 }
 
+// Issue a global memory fence for async operations, ordering TMA accesses of global memory
+// with the generic accesses of the executing thread
+CUTLASS_DEVICE
+void fence_view_async_global() {
+#if CUDA_BARRIER_ENABLED
+    asm volatile (
+        "{\n\t"
+        "fence.proxy.async.global; \n"
+        "}"
+        ::
+        : "memory");
+#else
+    CUTLASS_NOT_IMPLEMENTED();
+#endif
+}
+
 CUTLASS_DEVICE
 void fence_view_shared() {
 #if CUDA_BARRIER_ENABLED
@@ -72,12 +72,46 @@ struct NamedBarrierSync {
   }
 };
 
+//
+// Policies for polling a flag in global memory
+//
+
+/// Polls back to back
+struct SpinWait {
+  CUTLASS_DEVICE
+  void backoff() {}
+};
+
+/// Sleeps between polls, doubling the sleep from MinNs up to MaxNs nanoseconds. This keeps the
+/// waiting warps from saturating L2 and SM issue slots with acquire loads while peers are still
+/// writing the data guarded by the flag.
+template <
+  uint32_t MinNs = 32,
+  uint32_t MaxNs = 512
+>
+struct BackoffWait {
+  static_assert(0 < MinNs && MinNs <= MaxNs, "Backoff range must be non-empty.");
+
+  uint32_t sleep_ns = MinNs;
+
+  CUTLASS_DEVICE
+  void backoff() {
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 700)
+    __nanosleep(sleep_ns);
+    sleep_ns = sleep_ns < MaxNs / 2 ? sleep_ns * 2 : MaxNs;
+#endif
+  }
+};
+
 } // namepspace detail
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// Group or CTA-wide semaphore for inter-CTA synchronization.
-template <class Sync>
+template <
+  class Sync,
+  class Wait = detail::SpinWait
+>
 struct GenericBarrier {
 
 public:
@@ -141,8 +175,11 @@ public:
     if (thread_idx == 0)
     {
         // Spin-loop
+        Wait wait;
         #pragma unroll 1
-        while(ld_acquire(flag_ptr) < count) {}
+        while(ld_acquire(flag_ptr) < count) {
+          wait.backoff();
+        }
     }
 
     Sync::sync();
@@ -157,13 +194,18 @@ public:
     if (thread_idx == 0)
     {
         // Spin-loop
+        Wait wait;
         #pragma unroll 1
-        while(ld_acquire(flag_ptr) != val) {}
+        while(ld_acquire(flag_ptr) != val) {
+          wait.backoff();
+        }
     }
     Sync::sync();
   }
 
-  /// Uses thread[0] to wait for the specified count of signals on the given flag counter
+  /// Uses thread[0] to wait for the specified count of signals on the given flag counter, and
+  /// resets the flag to INIT once they have arrived, so that the flag can be reused by a subsequent
+  /// launch without clearing it again.
   CUTLASS_DEVICE
   static void wait_eq_reset(void *lock_ptr, int thread_idx, int flag_idx, T val = 1) {
     T *flag_ptr = reinterpret_cast<T*>(lock_ptr) + flag_idx;
@@ -171,8 +213,18 @@ public:
     if (thread_idx == 0)
     {
         // Spin-loop
+        Wait wait;
         #pragma unroll 1
-        while(atomicCAS(flag_ptr, val, 0) != val) {}
+        while(atomicCAS(flag_ptr, val, 0) != val) {
+          wait.backoff();
+        }
+
+        // The CAS is relaxed. Order it before the reads of the data released by the peers.
+#if (__CUDA_ARCH__ >= 700)
+        asm volatile ("fence.acq_rel.gpu;\n");
+#else
+        __threadfence();
+#endif // (__CUDA_ARCH__ >= 700)
     }
 
     Sync::sync();
@@ -220,11 +272,13 @@ using Barrier = GenericBarrier<detail::SyncthreadsSync>;
  * @param ThreadCount_ Number of threads that will wait on a NamedBarrier with a given ID
  * @param Offset Value added to the ID passed in by the user to determine the NamedBarrier ID to call into
  * @param MaxNumNamedBarriers The maximum number of unique barrier IDs that will be requested on this type
+ * @param Wait Policy for polling the flags (e.g., detail::SpinWait, detail::BackoffWait)
 **/
 template <
   uint32_t ThreadCount_,
   uint32_t Offset = 0,
-  uint32_t MaxNumNamedBarriers = 16
+  uint32_t MaxNumNamedBarriers = 16,
+  class Wait = cutlass::detail::SpinWait
 >
 struct NamedBarrierManager {
 
@@ -235,7 +289,7 @@ struct NamedBarrierManager {
   static constexpr uint32_t ThreadCount = ThreadCount_;
 
   template <uint32_t BarrierId>
-  using BarrierSync = cutlass::GenericBarrier<cutlass::detail::NamedBarrierSync<ThreadCount, BarrierId>>;
+  using BarrierSync = cutlass::GenericBarrier<cutlass::detail::NamedBarrierSync<ThreadCount, BarrierId>, Wait>;
 
   // Underlying type used by all barriers for synchronization. Does not depend on
   // template parameter BarrierId, so passing in 0 suffices.
@@ -324,17 +378,19 @@ private:
  *  via an API that mirrors that of NamedBarrierManager
  *
  * @param Synchronizer Synchronization helper exposing a `sync()` method to perform synchronization
+ * @param Wait Policy for polling the flags (e.g., detail::SpinWait, detail::BackoffWait)
 **/
 template <
   class Synchronizer,
-  uint32_t ThreadCount_
+  uint32_t ThreadCount_,
+  class Wait = cutlass::detail::SpinWait
 >
 struct SyncManager {
 
   // Number of threads participating in the barrier
   static constexpr uint32_t ThreadCount = ThreadCount_;
 
-  using BarrierSync = cutlass::GenericBarrier<Synchronizer>;
+  using BarrierSync = cutlass::GenericBarrier<Synchronizer, Wait>;
 
   // Underlying type used by all barriers for synchronization.
   using T = typename BarrierSync::T;
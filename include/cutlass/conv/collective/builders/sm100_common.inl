@@ -96,6 +96,8 @@ sm100_cluster_shape_to_im2col_tma_atom_A(ClusterShapeMNK cluster_shape_mnk, Atom
   }
 }
 
+// For fprop, B is the filter, which is identical for every output pixel tile of a cluster column.
+// Clusters wider than the MMA atom along M therefore multicast it rather than reloading it per CTA.
 template <class ClusterShapeMNK, class AtomThrId>
 constexpr auto
 sm100_cluster_shape_to_im2col_tma_atom_B(ClusterShapeMNK cluster_shape_mnk, AtomThrId atom_thr_id) {
@@ -59,5 +59,6 @@ struct CollectiveConv {
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "sm90_implicit_gemm_gmma_ss_warpspecialized.hpp"
+#include "sm90_implicit_gemm_gmma_ss_warpspecialized_upsample.hpp"
 #include "sm100_implicit_gemm_umma_warpspecialized.hpp" 
 /////////////////////////////////////////////////////////////////////////////////////////////////
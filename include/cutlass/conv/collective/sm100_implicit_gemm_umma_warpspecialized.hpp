@@ -354,6 +354,10 @@ public:
     TMA_A tma_load_a_fallback;
     TMA_B tma_load_b_fallback;
     dim3 cluster_shape_fallback;
+    // Grouped fprop: number of N tiles per group and input channels per group.
+    // A group's N tiles read the activation channels [g * group_channels, (g + 1) * group_channels).
+    int32_t group_tiles_n = 1;
+    int32_t group_channels = 0;
   };
 
   //
@@ -417,12 +421,23 @@ public:
     static_assert(size(typename decltype(tma_load_a)::ThrID{}) == size(AtomThrShapeMNK{}));
     static_assert(size(typename decltype(tma_load_b)::ThrID{}) == size(AtomThrShapeMNK{}));
 
+    int32_t group_tiles_n = 1;
+    int32_t group_channels = 0;
+    if constexpr (ConvOp == conv::Operator::kFprop) {
+      if (problem_shape.groups > 1) {
+        group_tiles_n = problem_shape.shape_B[0] / problem_shape.groups / size<1>(TileShape{});
+        group_channels = problem_shape.shape_B[NumTensorDimensions-1];
+      }
+    }
+
     return {
       tma_load_a,
       tma_load_b,
       tma_load_a_fallback,
       tma_load_b_fallback,
-      hw_info.cluster_shape_fallback
+      hw_info.cluster_shape_fallback,
+      group_tiles_n,
+      group_channels
     };
   }
 
@@ -584,9 +599,9 @@ public:
       }
     }
 
-    // When groups > 1, it should be a Grouped Conv.
+    // When groups > 1, it should be a Grouped Wgrad or a Grouped Fprop.
     if (problem_shape.groups > 1) {
-      implementable &= TileShapeMNKLRank > 3;
+      implementable &= TileShapeMNKLRank > 3 || ConvOp == conv::Operator::kFprop;
 
       if (!implementable) {
         CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Only Grouped Conv can support groups > 1.\n");
@@ -594,6 +609,40 @@ public:
       }
     }
 
+    // Grouped Fprop channel check. Multicast within the cluster is checked by the kernel.
+    if constexpr (ConvOp == conv::Operator::kFprop) {
+      if (problem_shape.groups > 1) {
+        // shape_A: [N,D,H,W,C], shape_B: [K,T,R,S,C/groups]
+        int input_C = problem_shape.shape_A[NumTensorDimensions-1];
+        int output_K = problem_shape.shape_B[0];
+        int group_C = problem_shape.shape_B[NumTensorDimensions-1];
+
+        implementable &= input_C == group_C * problem_shape.groups;
+        implementable &= output_K % problem_shape.groups == 0;
+
+        if (!implementable) {
+          CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Grouped Fprop's input C, filter C, filter K and groups do not match.\n");
+          return false;
+        }
+
+        if (group_C == 1) {
+          CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Depthwise Fprop is not supported by TMA im2col kernels, use the SM80 DirectConvolution kernels instead.\n");
+          return false;
+        }
+
+        constexpr int Tile_N = size<1>(TileShape{});
+        constexpr int Tile_K = size<2>(TileShape{});
+
+        implementable &= group_C % Tile_K == 0;
+        implementable &= (output_K / problem_shape.groups) % Tile_N == 0;
+
+        if (!implementable) {
+          CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Grouped Fprop requires C/groups divisible by Tile_K and K/groups divisible by Tile_N.\n");
+          return false;
+        }
+      }
+    }
+
     // Only support Grouped Wgrad currently.
     if constexpr (TileShapeMNKLRank > 3) {
       implementable &= ConvOp == conv::Operator::kWgrad;
@@ -702,7 +751,20 @@ public:
           mcast_mask_a, mcast_mask_b] = load_inputs;
 
     // slice out the work coord from partitioned tensors
-    Tensor tAgA = tAgA_mk(_, get<0>(cta_coord_mnkl) / size(typename TiledMma::AtomThrID{}), _);
+    // Grouped fprop: move the A window onto the channels of this tile's group
+    Tensor tAgA = [&]() {
+      if constexpr (ConvOp == conv::Operator::kFprop) {
+        Tensor tAgA_k = tAgA_mk(_, get<0>(cta_coord_mnkl) / size(typename TiledMma::AtomThrID{}), _);
+        int32_t group_idx = static_cast<int32_t>(get<1>(cta_coord_mnkl)) / params.group_tiles_n;
+        auto coord = *tAgA_k.data();                                                          // (c,whd,n,srt)
+        auto group_coord = make_arithmetic_tuple(get<0>(coord) + group_idx * params.group_channels,
+                                                 get<1>(coord), get<2>(coord), get<3>(coord));
+        return make_tensor(ArithmeticTupleIterator(group_coord), tAgA_k.layout());
+      }
+      else {
+        return tAgA_mk(_, get<0>(cta_coord_mnkl) / size(typename TiledMma::AtomThrID{}), _);
+      }
+    }();
     auto tensor_b_coord = get<1>(cta_coord_mnkl);
     if constexpr (is_grouped_wgrad) {
       // in grouped wgrad, tensor A = NZPQK, tensor B = NDHWC, tensor C = KTRSc, where C = G*c, c = channel_per_group = 8,16,32.
@@ -778,9 +840,22 @@ public:
 
     // Represent the full tensors -- get these from TMA
     auto K_A = conditional_return<is_strided_dgrad>(get<0>(K), K);
-    Tensor mA_mk = observed_tma_load_a_->get_tma_tensor(make_shape(M, K_A));
+    Tensor mA_mk_full = observed_tma_load_a_->get_tma_tensor(make_shape(M, K_A));
     Tensor mB_nk = observed_tma_load_b_->get_tma_tensor(make_shape(N, K));
 
+    // The im2col tensor spans all channels of the activation. Restrict its K domain to the filter's
+    // (c,s,r,t), which only differs for grouped fprop; load() offsets the channel per group.
+    auto mA_mk = [&]() {
+      if constexpr (ConvOp == conv::Operator::kFprop) {
+        auto layout_mk = mA_mk_full.layout();
+        return make_tensor(mA_mk_full.data(),
+          composition(layout_mk.layout_a(), layout_mk.offset(), make_identity_layout(make_shape(M, K_A))));
+      }
+      else {
+        return mA_mk_full;
+      }
+    }();
+
     // Tile the tensors and defer the slice
     Tensor gA_mk = local_tile(mA_mk, TileShape{}, make_coord(_,_,_), Step<_1, X,_1>{});         // (BLK_M, BLK_K, m, k)
     Tensor gB_nk = local_tile(mB_nk, TileShape{}, make_coord(_,_,_), Step< X,_1,_1>{});         // (BLK_N, BLK_K, n, k)
@@ -31,6 +31,7 @@
 #pragma once
 
 #include "cutlass/cutlass.h"
+#include "cutlass/functional.h"
 
 #include "cute/arch/cluster_sm90.hpp"
 #include "cute/arch/copy_sm90.hpp"
@@ -156,6 +157,7 @@ struct CollectiveConv<
 
   static constexpr int K_PIPE_MAX = DispatchPolicy::Stages;
   static constexpr int K_PIPE_MMAS = DispatchPolicy::PipelineAsyncMmaStages;
+  static constexpr int NumProducerThreadEvents = 1;
   static constexpr uint32_t TmaTransactionBytes =
       (size<0>(SmemLayoutA{}) * size<1>(SmemLayoutA{}) * static_cast<uint32_t>(sizeof(InternalElementA)))+
       (size<0>(SmemLayoutB{}) * size<1>(SmemLayoutB{}) * static_cast<uint32_t>(sizeof(InternalElementB)));
@@ -164,6 +166,9 @@ struct CollectiveConv<
   struct Arguments {
     ElementA const* ptr_A{nullptr};
     ElementB const* ptr_B{nullptr};
+    // Wgrad only: if set, the bias gradient (the sum of dy over N,Z,P,Q) is accumulated into this
+    // K-vector in the same pass. It must be zeroed by the user, since partial sums are added atomically.
+    ElementAccumulator* ptr_dbias{nullptr};
   };
 
 private:
@@ -294,6 +299,13 @@ public:
     TMA_A tma_load_a;
     TMA_B tma_load_b;
     uint32_t tma_transaction_bytes = TmaTransactionBytes;
+    // Grouped fprop: number of N tiles per group and input channels per group.
+    // A group's N tiles read the activation channels [g * group_channels, (g + 1) * group_channels).
+    int32_t group_tiles_n = 1;
+    int32_t group_channels = 0;
+    // Wgrad bias gradient and its extent (output channels K)
+    ElementAccumulator* ptr_dbias = nullptr;
+    int32_t dbias_extent = 0;
   };
 
   //
@@ -325,10 +337,30 @@ public:
     auto tma_load_a = get_tma_load_a_instance(tensor_a, problem_shape);
     auto tma_load_b = get_tma_load_b_instance(tensor_b, problem_shape);
 
+    int32_t group_tiles_n = 1;
+    int32_t group_channels = 0;
+    if constexpr (ConvOp == conv::Operator::kFprop) {
+      if (problem_shape.groups > 1) {
+        group_tiles_n = problem_shape.shape_B[0] / problem_shape.groups / size<1>(TileShape{});
+        group_channels = problem_shape.shape_B[NumTensorDimensions-1];
+      }
+    }
+
+    ElementAccumulator* ptr_dbias = nullptr;
+    int32_t dbias_extent = 0;
+    if constexpr (ConvOp == conv::Operator::kWgrad) {
+      ptr_dbias = args.ptr_dbias;
+      dbias_extent = problem_shape.shape_C[0];
+    }
+
     return {
       tma_load_a,
       tma_load_b,
-      TmaTransactionBytes
+      TmaTransactionBytes,
+      group_tiles_n,
+      group_channels,
+      ptr_dbias,
+      dbias_extent
     };
   }
 
@@ -404,6 +436,11 @@ public:
       }
     }
 
+    if (ConvOp != conv::Operator::kWgrad && args.ptr_dbias != nullptr) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: The bias gradient reduction is only supported by wgrad kernels.\n");
+      return false;
+    }
+
     // Wgrad kernels don't support non-packed output strides, non-packed tensor A stride (linearized)
     if constexpr (ConvOp == conv::Operator::kWgrad) {
 #if defined(CUTLASS_DEBUG_TRACE_LEVEL) && (CUTLASS_DEBUG_TRACE_LEVEL > 1)
@@ -476,9 +513,51 @@ public:
       return false;
     }
 
+    // Strided dgrad is decomposed into unit-stride stride phases by ConvUniversalAdapter
+    if constexpr (ConvOp == conv::Operator::kDgrad) {
+      for (auto stride : problem_shape.traversal_stride) {
+        implementable &= stride == 1;
+      }
+      if (!implementable) {
+        CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Dgrad kernels only support unit traversal strides.\n");
+        return false;
+      }
+    }
+
     if (problem_shape.groups > 1) {
-      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: This kernel does not support conv groups > 1.\n");
-      return false;
+      if constexpr (ConvOp != conv::Operator::kFprop) {
+        CUTLASS_TRACE_HOST("  CAN IMPLEMENT: This kernel only supports conv groups > 1 for Fprop.\n");
+        return false;
+      }
+      else {
+        // shape_A: [N,D,H,W,C], shape_B: [K,T,R,S,C/groups]
+        int input_C = problem_shape.shape_A[NumTensorDimensions-1];
+        int output_K = problem_shape.shape_B[0];
+        int group_C = problem_shape.shape_B[NumTensorDimensions-1];
+        implementable &= input_C == group_C * problem_shape.groups;
+        implementable &= output_K % problem_shape.groups == 0;
+        if (!implementable) {
+          CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Grouped Fprop's input C, filter C, filter K and groups do not match.\n");
+          return false;
+        }
+
+        if (group_C == 1) {
+          CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Depthwise Fprop is not supported by TMA im2col kernels, use the SM80 DirectConvolution kernels instead.\n");
+          return false;
+        }
+
+        // Each K tile must not cross a group's channels, and every CTA sharing a multicast
+        // A tile within the cluster must belong to the same group.
+        constexpr int Tile_N = size<1>(TileShape{});
+        constexpr int Tile_K = size<2>(TileShape{});
+        constexpr int Cluster_N = size<1>(ClusterShape{});
+        implementable &= group_C % Tile_K == 0;
+        implementable &= (output_K / problem_shape.groups) % (Tile_N * Cluster_N) == 0;
+        if (!implementable) {
+          CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Grouped Fprop requires C/groups divisible by Tile_K and K/groups divisible by Tile_N * Cluster_N.\n");
+          return false;
+        }
+      }
     }
 
     if constexpr (is_im2col_A || is_im2col_B) {
@@ -527,9 +606,22 @@ public:
 
     // TMA requires special handling of strides to deal with coord codomain mapping
     // Represent the full tensors -- get these from TMA
-    Tensor mA_mk = mainloop_params.tma_load_a.get_tma_tensor(make_shape(M,K));                            // (m,k)
+    Tensor mA_mk_full = mainloop_params.tma_load_a.get_tma_tensor(make_shape(M,K));                       // (m,k)
     Tensor mB_nk = mainloop_params.tma_load_b.get_tma_tensor(make_shape(N,K));                            // (n,k)
 
+    // The im2col tensor spans all channels of the activation. Restrict its K domain to the filter's
+    // (c,s,r,t), which only differs for grouped fprop; load() offsets the channel per group.
+    auto mA_mk = [&]() {
+      if constexpr (ConvOp == conv::Operator::kFprop) {
+        auto layout_mk = mA_mk_full.layout();
+        return make_tensor(mA_mk_full.data(),
+          composition(layout_mk.layout_a(), layout_mk.offset(), make_identity_layout(make_shape(M,K))));
+      }
+      else {
+        return mA_mk_full;
+      }
+    }();
+
     // Make tiled views, defer the slice
     Tensor gA_mk = local_tile(mA_mk, TileShape{}, make_coord(_,_,_), Step<_1, X,_1>{});        // (BLK_M,BLK_K,m,k)
     Tensor gB_nk = local_tile(mB_nk, TileShape{}, make_coord(_,_,_), Step< X,_1,_1>{});        // (BLK_N,BLK_K,n,k)
@@ -574,7 +666,20 @@ public:
       // Partition the inputs based on the current block coordinates.
       auto [m_coord, n_coord, k_coord, l_coord] = blk_coord;
 
-      Tensor gA = gA_mk(_,_,m_coord,_);                                                     // (BLK_M,BLK_K,k)
+      // Grouped fprop: move the A window onto the channels of this tile's group
+      Tensor gA = [&]() {
+        if constexpr (ConvOp == conv::Operator::kFprop) {
+          Tensor gA_k = gA_mk(_,_,m_coord,_);
+          int32_t group_idx = static_cast<int32_t>(n_coord) / mainloop_params.group_tiles_n;
+          auto coord = *gA_k.data();                                                        // (c,whd,n,srt)
+          auto group_coord = make_arithmetic_tuple(get<0>(coord) + group_idx * mainloop_params.group_channels,
+                                                   get<1>(coord), get<2>(coord), get<3>(coord));
+          return make_tensor(ArithmeticTupleIterator(group_coord), gA_k.layout());
+        }
+        else {
+          return gA_mk(_,_,m_coord,_);
+        }
+      }();                                                                                  // (BLK_M,BLK_K,k)
       Tensor gB = gB_nk(_,_,n_coord,_);                                                     // (BLK_N,BLK_K,k)
 
       // Applies the mapping from block_tma_a
@@ -649,7 +754,7 @@ public:
 
   /// Perform a collective-scoped matrix multiply-accumulate
   /// Consumer Perspective
-  template <class FrgTensorC>
+  template <class FrgTensorC, class BlockCoord>
   CUTLASS_DEVICE void
   mma(MainloopPipeline pipeline,
       PipelineState smem_pipe_consumer_state,
@@ -657,12 +762,38 @@ public:
       int k_tile_count,
       int thread_idx,
       TensorStorage& shared_tensors,
-      Params const& mainloop_params) {
+      Params const& mainloop_params,
+      BlockCoord const& blk_coord) {
     static_assert(is_rmem<FrgTensorC>::value, "C tensor must be rmem resident.");
 
     Tensor sA = make_tensor(make_smem_ptr(shared_tensors.smem_A.data()), SmemLayoutA{});          // (BLK_M,BLK_K,PIPE)
     Tensor sB = make_tensor(make_smem_ptr(shared_tensors.smem_B.data()), SmemLayoutB{});          // (BLK_N,BLK_K,PIPE)
 
+    //
+    // Wgrad bias gradient: the tiles of the first N tile sum their dy (A) tiles over GEMM-K while they
+    // are resident in smem. Threads own rows (output channels) and stride over the k of each tile.
+    //
+    constexpr int DbiasRows = cute::min(int(size(TiledMma{})), int(size<0>(TileShape{})));
+    constexpr int DbiasThreadsPerRow = int(size(TiledMma{})) / DbiasRows;
+    constexpr int DbiasRowsPerThread = int(size<0>(TileShape{})) / DbiasRows;
+    bool reduce_dbias = false;
+    if constexpr (ConvOp == conv::Operator::kWgrad) {
+      reduce_dbias = mainloop_params.ptr_dbias != nullptr && cute::sum(get<1>(blk_coord)) == 0;
+    }
+    Array<ElementAccumulator, DbiasRowsPerThread> dbias_partial;
+    dbias_partial.fill(ElementAccumulator(0));
+
+    auto reduce_dbias_stage = [&](int read_stage) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < DbiasRowsPerThread; ++i) {
+        int m = thread_idx % DbiasRows + i * DbiasRows;
+        CUTLASS_PRAGMA_UNROLL
+        for (int k = thread_idx / DbiasRows; k < size<1>(sA); k += DbiasThreadsPerRow) {
+          dbias_partial[i] += static_cast<ElementAccumulator>(sA(m,k,read_stage));
+        }
+      }
+    };
+
     //
     // Define C accumulators and A/B partitioning
     //
@@ -716,6 +847,10 @@ public:
 
       warpgroup_commit_batch();
 
+      if (reduce_dbias) {
+        reduce_dbias_stage(read_stage);
+      }
+
       ++smem_pipe_consumer_state;
     }
 
@@ -744,6 +879,10 @@ public:
       }
       warpgroup_commit_batch();
 
+      if (reduce_dbias) {
+        reduce_dbias_stage(read_stage);
+      }
+
       /// Wait on the GMMA barrier for K_PIPE_MMAS (or fewer) outstanding to ensure smem_pipe_producer_state is consumed
       warpgroup_wait<K_PIPE_MMAS>();
       warpgroup_fence_operand(accum);
@@ -757,6 +896,20 @@ public:
     }
 
     warpgroup_fence_operand(accum);
+
+    // Split-K and stream-K units of a tile each add the sums of their own k range
+    if constexpr (ConvOp == conv::Operator::kWgrad) {
+      if (reduce_dbias) {
+        atomic_add<ElementAccumulator> reduce_output{};
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < DbiasRowsPerThread; ++i) {
+          int m = int(get<0>(blk_coord)) * int(size<0>(TileShape{})) + thread_idx % DbiasRows + i * DbiasRows;
+          if (m < mainloop_params.dbias_extent) {
+            reduce_output(mainloop_params.ptr_dbias + m, dbias_partial[i]);
+          }
+        }
+      }
+    }
   }
 
   /// Perform a Consumer Epilogue to release all buffers
@@ -0,0 +1,671 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/arch/barrier.h"
+#include "cutlass/arch/memory_sm80.h"
+
+#include "cute/arch/cluster_sm90.hpp"
+#include "cute/arch/copy_sm90.hpp"
+#include "cute/atom/mma_atom.hpp"
+#include "cute/algorithm/functional.hpp"
+#include "cute/algorithm/gemm.hpp"
+
+#include "cutlass/conv/detail.hpp"
+#include "cutlass/conv/convolution.h"
+#include "cutlass/conv/dispatch_policy.hpp"
+#include "cutlass/pipeline/pipeline.hpp"
+#include "cutlass/util/packed_stride.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::conv::collective {
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 2D fprop over a 2x upsampled activation. The problem shape describes the convolution of the
+// upsampled [N,2H,2W,C] tensor, while ptr_A points to the packed [N,H,W,C] input. The upsampled
+// tensor is never materialized: the MainloopAux producer warp synthesizes each (BLK_M,BLK_K)
+// im2col tile from the input, with cp.async for nearest and with register interpolation for
+// bilinear, and the Mainloop producer warp loads the filter tiles with TMA into the same stage.
+template <
+  int Stages,
+  UpsampleMode Upsample,
+  class ClusterShape,
+  int PipelineAsyncMmaStages,
+  class TileShape_,
+  class ElementA_,
+  class ElementB_,
+  class TiledMma_,
+  class TileTraitsA_,
+  class TileTraitsB_>
+struct CollectiveConv<
+    MainloopSm90CpAsyncUpsampleGmmaWarpSpecializedImplicitGemm<
+        Stages, Upsample, ClusterShape, PipelineAsyncMmaStages>,
+    TileShape_,
+    ElementA_,
+    ElementB_,
+    TiledMma_,
+    TileTraitsA_,
+    TileTraitsB_>
+{
+  //
+  // Type Aliases
+  //
+  using DispatchPolicy = MainloopSm90CpAsyncUpsampleGmmaWarpSpecializedImplicitGemm<
+      Stages, Upsample, ClusterShape, PipelineAsyncMmaStages>;
+  using TileShape = TileShape_;
+  using ElementA = ElementA_;
+  using ElementB = ElementB_;
+  using TiledMma = TiledMma_;
+  using ElementAccumulator = typename TiledMma::ValTypeC;
+  using GmemTiledCopyA = typename TileTraitsA_::GmemTiledCopy;
+  using GmemTiledCopyB = typename TileTraitsB_::GmemTiledCopy;
+  using SmemLayoutA = typename TileTraitsA_::SmemLayout;
+  using SmemLayoutB = typename TileTraitsB_::SmemLayout;
+  using ArchTag = typename DispatchPolicy::ArchTag;
+  static constexpr conv::Operator ConvOp = DispatchPolicy::ConvOp;
+  static constexpr int NumSpatialDimensions = DispatchPolicy::NumSpatialDimensions;
+  static constexpr int NumTensorDimensions = NumSpatialDimensions + 2;
+  using StrideA = decltype(detail::sm90_dispatch_policy_to_stride_A<DispatchPolicy>());
+  using StrideB = decltype(detail::sm90_dispatch_policy_to_stride_B<DispatchPolicy>());
+
+  using MainloopPipeline = cutlass::PipelineTmaAsync<DispatchPolicy::Stages>;
+
+  using PipelineParams = typename MainloopPipeline::Params;
+  using PipelineState  = typename cutlass::PipelineState<DispatchPolicy::Stages>;
+
+  using ProblemShape = ConvProblemShape<ConvOp, NumSpatialDimensions>;
+
+  static_assert(rank(SmemLayoutA{}) == 3, "SmemLayout must be rank 3 (M/N, K, PIPE)");
+  static_assert((size<0>(TileShape{}) == size<0>(SmemLayoutA{})), "SmemLayout must be compatible with the tile shape.");
+  static_assert((size<2>(TileShape{}) == size<1>(SmemLayoutA{})), "SmemLayout must be compatible with the tile shape.");
+
+  static_assert(rank(SmemLayoutB{}) == 3, "SmemLayout must be rank 3 (M/N, K, PIPE)");
+  static_assert((size<1>(TileShape{}) == size<0>(SmemLayoutB{})), "SmemLayout must be compatible with the tile shape.");
+  static_assert((size<2>(TileShape{}) == size<1>(SmemLayoutB{})), "SmemLayout must be compatible with the tile shape.");
+
+  static_assert(DispatchPolicy::Stages >= 2, "Specialization requires Stages set to value 1 or more.");
+  static_assert(cute::is_base_of<cute::GMMA::DescriptorIterator, typename TiledMma::FrgTypeA>::value &&
+                cute::is_base_of<cute::GMMA::DescriptorIterator, typename TiledMma::FrgTypeB>::value,
+                "MMA atom must source both A and B operand from smem_desc for this mainloop.");
+  static_assert(cute::is_same_v<GmemTiledCopyB, SM90_TMA_LOAD>,
+      "GmemTiledCopyB - the filter is loaded with a non-multicast TMA.");
+
+  // TMA converts f32 input to tf32 when copying from GMEM to SMEM
+  // For all other types, cast to size equivalent uint type to avoid any rounding by TMA.
+  static constexpr bool ConvertF32toTF32B = cute::is_same_v<float, ElementB>;
+  using InternalElementB = cute::conditional_t<ConvertF32toTF32B, tfloat32_t, uint_bit_t<sizeof_bits_v<ElementB>>>;
+  using SmemElementA = typename TiledMma::ValTypeA;
+
+  // The activation tile is moved in 16B chunks of channels. A warp covers RowsPerPass rows of
+  // the tile per pass, with consecutive lanes reading consecutive chunks of a pixel.
+  static constexpr int NumAuxThreads = NumThreadsPerWarp;
+  static constexpr int ElementsPerChunk = 128 / sizeof_bits_v<ElementA>;
+  static constexpr int ChunksPerRow = size<2>(TileShape{}) / ElementsPerChunk;
+  static constexpr int RowsPerPass = NumAuxThreads / ChunksPerRow;
+  static constexpr int PassesPerTile = size<0>(TileShape{}) / RowsPerPass;
+  static_assert(sizeof_bits_v<ElementA> == sizeof_bits_v<SmemElementA>, "The activation is stored to smem without a conversion.");
+  static_assert(size<2>(TileShape{}) % ElementsPerChunk == 0 && NumAuxThreads % ChunksPerRow == 0,
+      "BLK_K must span a whole number of 16B chunks dividing a warp.");
+  static_assert(size<0>(TileShape{}) % RowsPerPass == 0, "BLK_M must be a multiple of the rows per pass.");
+
+  // The full barrier of a stage expects the TMA leader and every thread of the MainloopAux warp
+  static constexpr int NumProducerThreadEvents = 1 + NumAuxThreads;
+
+  struct SharedStorage
+  {
+    struct TensorStorage : cute::aligned_struct<128, _0> {
+      cute::array_aligned<typename TiledMma::ValTypeA, cute::cosize_v<SmemLayoutA>> smem_A;
+      cute::array_aligned<typename TiledMma::ValTypeB, cute::cosize_v<SmemLayoutB>> smem_B;
+    } tensors;
+
+    using PipelineStorage = typename MainloopPipeline::SharedStorage;
+    PipelineStorage pipeline;
+  };
+  using TensorStorage = typename SharedStorage::TensorStorage;
+  using PipelineStorage = typename SharedStorage::PipelineStorage;
+
+  static constexpr int K_PIPE_MAX = DispatchPolicy::Stages;
+  static constexpr int K_PIPE_MMAS = DispatchPolicy::PipelineAsyncMmaStages;
+  // Only the filter is loaded with TMA
+  static constexpr uint32_t TmaTransactionBytes =
+      (size<0>(SmemLayoutB{}) * size<1>(SmemLayoutB{}) * static_cast<uint32_t>(sizeof(InternalElementB)));
+
+  // Host side kernel arguments
+  struct Arguments {
+    ElementA const* ptr_A{nullptr};           // packed [N,H,W,C] input, upsampled to shape_A
+    ElementB const* ptr_B{nullptr};
+  };
+
+private:
+  template <class TensorB>
+  static constexpr auto
+  get_tma_load_b_instance(TensorB const& tensor_b) {
+    return make_tma_copy(
+        GmemTiledCopyB{},
+        tensor_b,
+        SmemLayoutB{}(_,_,_0{}),
+        make_shape(shape<1>(TileShape{}), shape<2>(TileShape{})),
+        size<0>(ClusterShape{}));
+  }
+
+  // Bilinear taps of upsampled coordinate x along an input extent, with half-pixel centers:
+  // x maps to x / 2 - 0.25, clamped to [0, extent - 1]
+  CUTLASS_DEVICE static void
+  bilinear_taps(int x, int extent, int& i0, int& i1, float& w1) {
+    int i = x >> 1;
+    if (x & 1) {
+      i0 = i;
+      i1 = cute::min(i + 1, extent - 1);
+      w1 = 0.25f;
+    }
+    else {
+      i0 = cute::max(i - 1, 0);
+      i1 = i;
+      w1 = 0.75f;
+    }
+  }
+
+public:
+
+  // The GEMM-M mode is linearized over (q,p,n), as for the im2col kernels
+  static constexpr auto
+  get_problem_shape_MNKL(ProblemShape const& problem_shape) {
+    return cutlass::conv::detail::get_linearized_problem_shape_MNKL(problem_shape);
+  }
+
+  // Device side kernel params
+  struct Params {
+    using TMA_B = decltype(get_tma_load_b_instance(
+        make_tensor(
+            make_gmem_ptr(static_cast<InternalElementB const*>(nullptr)),
+            make_layout(repeat_like(StrideB{}, int32_t(0)), StrideB{}))));
+
+    // Members
+    TMA_B tma_load_b;
+    uint32_t tma_transaction_bytes = TmaTransactionBytes;
+    ElementA const* ptr_A = nullptr;
+    int32_t gemm_m = 0;
+    FastDivmod divmod_q{};                  // output width Q
+    FastDivmod divmod_p{};                  // output height P
+    int32_t upsampled_h = 0;                // 2H
+    int32_t upsampled_w = 0;                // 2W
+    int32_t channels = 0;                   // C, the input stride along w
+    int64_t stride_h = 0;                   // input strides of the [N,H,W,C] tensor
+    int64_t stride_n = 0;
+    int32_t pad_h = 0;
+    int32_t pad_w = 0;
+    int32_t traversal_stride_h = 1;
+    int32_t traversal_stride_w = 1;
+    int32_t dilation_h = 1;
+    int32_t dilation_w = 1;
+  };
+
+  //
+  // Methods
+  //
+
+  // Lowers the host side user facing arguments to the kernel facing lauch params
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    (void) workspace;
+
+    auto shape_B_orig = problem_shape.get_shape_B();
+    auto dB = make_cute_packed_stride(StrideB{}, problem_shape.stride_B, ConvOp);
+    auto ptr_B = reinterpret_cast<InternalElementB const*>(args.ptr_B);
+    Tensor tensor_b = make_tensor(make_gmem_ptr(ptr_B), make_layout(shape_B_orig, dB));
+
+    // shape_A: [N,2H,2W,C], shape_C: [N,P,Q,K]
+    int32_t upsampled_h = problem_shape.shape_A[1];
+    int32_t upsampled_w = problem_shape.shape_A[2];
+    int32_t channels = problem_shape.shape_A[3];
+    int64_t stride_h = int64_t(upsampled_w / 2) * channels;
+    int64_t stride_n = int64_t(upsampled_h / 2) * stride_h;
+
+    return {
+      get_tma_load_b_instance(tensor_b),
+      TmaTransactionBytes,
+      args.ptr_A,
+      static_cast<int32_t>(cute::product(get<0>(get_problem_shape_MNKL(problem_shape)))),
+      FastDivmod(problem_shape.shape_C[2]),
+      FastDivmod(problem_shape.shape_C[1]),
+      upsampled_h,
+      upsampled_w,
+      channels,
+      stride_h,
+      stride_n,
+      problem_shape.lower_padding[0],
+      problem_shape.lower_padding[1],
+      problem_shape.traversal_stride[0],
+      problem_shape.traversal_stride[1],
+      problem_shape.dilation[0],
+      problem_shape.dilation[1]
+    };
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(
+      ProblemShape const& problem_shape,
+      Arguments const& args) {
+    bool implementable = true;
+    // channel mode is major, and the input is read as packed [N,H,W,C]
+    implementable &= problem_shape.stride_A[NumTensorDimensions-1] == 1;
+    implementable &= problem_shape.stride_B[NumTensorDimensions-1] == 1;
+
+    constexpr int tma_alignment_bits = 128;
+    auto shape_B_orig = problem_shape.get_shape_B();
+    constexpr int min_tma_aligned_elements_B = tma_alignment_bits / cutlass::sizeof_bits<ElementB>::value;
+    implementable = implementable && cutlass::detail::check_alignment<min_tma_aligned_elements_B>(shape_B_orig, StrideB{});
+    implementable &= reinterpret_cast<uintptr_t>(args.ptr_A) % 16 == 0;
+
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum alignment requirements.\n");
+      return false;
+    }
+
+    // Each k tile holds BLK_K channels of a single filter tap
+    implementable &= problem_shape.shape_A[NumTensorDimensions-1] % size<2>(TileShape{}) == 0;
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Upsample fprop requires C divisible by Tile_K.\n");
+      return false;
+    }
+
+    implementable &= problem_shape.shape_A[1] % 2 == 0 && problem_shape.shape_A[2] % 2 == 0;
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Upsample fprop requires the activation extents H and W to be 2x upsampled (even).\n");
+      return false;
+    }
+
+    implementable &= problem_shape.groups == 1;
+    implementable &= problem_shape.mode == cutlass::conv::Mode::kCrossCorrelation;
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Upsample fprop only supports cross correlation without groups.\n");
+      return false;
+    }
+
+    auto [M, N, K, L] = cutlass::conv::detail::get_transformed_problem_shape_MNKL(problem_shape);
+    auto to_64b = [](auto S) { return transform_leaf(S, [](auto s) { return static_cast<int64_t>(s); }); };
+    implementable &= cute::product(to_64b(M)) <= cutlass::platform::numeric_limits<int32_t>::max();
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: the extents exceed the maximum number.\n");
+      return false;
+    }
+
+    return true;
+  }
+
+  /// Issue Tma Descriptor Prefetch -- ideally from a single thread for best performance
+  CUTLASS_DEVICE
+  static void prefetch_tma_descriptors(Params const& mainloop_params) {
+    cute::prefetch_tma_descriptor(mainloop_params.tma_load_b.get_tma_descriptor());
+  }
+
+  /// Set up the data needed by this collective for load and mma.
+  /// gA_mk - a coordinate tensor (m,(c,s,r)) of the upsampled im2col matrix, shape (BLK_M,BLK_K,m,k)
+  /// gB_nk - The tma tensor, B after a local tile so it has shape  (BLK_N,BLK_K,n,k)
+  template <class ProblemShapeMNKL>
+  CUTLASS_DEVICE auto
+  load_init(ProblemShapeMNKL const& problem_shape_MNKL, Params const& mainloop_params) {
+    using X = Underscore;
+    auto [M, N, K, L] = problem_shape_MNKL;
+
+    Tensor cA_mk = make_identity_tensor(make_shape(M,K));                                    // (m,k)
+    Tensor mB_nk = mainloop_params.tma_load_b.get_tma_tensor(make_shape(N,K));                // (n,k)
+
+    Tensor gA_mk = local_tile(cA_mk, TileShape{}, make_coord(_,_,_), Step<_1, X,_1>{});        // (BLK_M,BLK_K,m,k)
+    Tensor gB_nk = local_tile(mB_nk, TileShape{}, make_coord(_,_,_), Step< X,_1,_1>{});        // (BLK_N,BLK_K,n,k)
+
+    return cute::make_tuple(gA_mk, gB_nk);
+  }
+
+  /// Perform a collective-scoped matrix multiply-accumulate
+  /// Producer Perspective, loads the filter tiles
+  template <
+    class TensorA, class TensorB,
+    class KTileIterator, class BlockCoord
+  >
+  CUTLASS_DEVICE void
+  load(
+      Params const& mainloop_params,
+      MainloopPipeline pipeline,
+      PipelineState smem_pipe_producer_state,
+      cute::tuple<TensorA, TensorB> const& load_inputs,
+      BlockCoord const& blk_coord,
+      KTileIterator k_tile_iter, int k_tile_count,
+      int thread_idx,
+      uint32_t block_rank_in_cluster,
+      TensorStorage& shared_tensors) {
+
+    int lane_predicate = cute::elect_one_sync();
+    if (lane_predicate) {
+      Tensor sB = make_tensor(make_smem_ptr(shared_tensors.smem_B.data()), SmemLayoutB{});        // (BLK_N,BLK_K,PIPE)
+
+      auto block_tma_b = mainloop_params.tma_load_b.get_slice(0);
+      auto [m_coord, n_coord, k_coord, l_coord] = blk_coord;
+      Tensor gB = get<1>(load_inputs)(_,_,n_coord,_);                                       // (BLK_N,BLK_K,k)
+
+      Tensor tBgB = block_tma_b.partition_S(gB);                                                 // (TMA,TMA_N,TMA_K,k)
+      Tensor tBsB = block_tma_b.partition_D(sB);                                              // (TMA,TMA_N,TMA_K,PIPE)
+
+      // Mainloop
+      CUTLASS_PRAGMA_NO_UNROLL
+      for ( ; k_tile_count > 0; --k_tile_count) {
+        // LOCK smem_pipe_producer_state for _writing_
+        pipeline.producer_acquire(smem_pipe_producer_state);
+
+        using BarrierType = typename MainloopPipeline::ProducerBarrierType;
+        BarrierType* tma_barrier = pipeline.producer_get_barrier(smem_pipe_producer_state);
+
+        int write_stage = smem_pipe_producer_state.index();
+        copy(mainloop_params.tma_load_b.with(*tma_barrier), tBgB(_,_,_,*k_tile_iter), tBsB(_,_,_,write_stage));
+        ++k_tile_iter;
+
+        // Advance smem_pipe_producer_state
+        ++smem_pipe_producer_state;
+      }
+    }
+  }
+
+  /// Producer Perspective, synthesizes the upsampled activation tiles. Called by all threads of
+  /// the MainloopAux warp, which arrive on the stage's full barrier once their chunks have landed.
+  template <
+    class TensorA, class TensorB,
+    class KTileIterator, class BlockCoord
+  >
+  CUTLASS_DEVICE void
+  load_auxiliary(
+      Params const& mainloop_params,
+      MainloopPipeline pipeline,
+      PipelineState smem_pipe_producer_state,
+      cute::tuple<TensorA, TensorB> const& load_inputs,
+      BlockCoord const& blk_coord,
+      KTileIterator k_tile_iter, int k_tile_count,
+      int thread_idx,
+      uint32_t block_rank_in_cluster,
+      TensorStorage& shared_tensors) {
+    using VectorA = cutlass::AlignedArray<ElementA, ElementsPerChunk>;
+    using SmemVectorA = cutlass::AlignedArray<SmemElementA, ElementsPerChunk>;
+
+    Tensor sA = make_tensor(make_smem_ptr(shared_tensors.smem_A.data()), SmemLayoutA{});        // (BLK_M,BLK_K,PIPE)
+
+    auto [m_coord, n_coord, k_coord, l_coord] = blk_coord;
+    Tensor cA = get<0>(load_inputs)(_,_,m_coord,_);                                         // (BLK_M,BLK_K,k)
+
+    int row_in_pass = thread_idx / ChunksPerRow;
+    int chunk_channel = (thread_idx % ChunksPerRow) * ElementsPerChunk;
+    int input_h = mainloop_params.upsampled_h / 2;
+    int input_w = mainloop_params.upsampled_w / 2;
+
+    // Mainloop
+    CUTLASS_PRAGMA_NO_UNROLL
+    for ( ; k_tile_count > 0; --k_tile_count) {
+      // LOCK smem_pipe_producer_state for _writing_
+      pipeline.producer_acquire(smem_pipe_producer_state);
+
+      // The k tile covers channels [c, c + BLK_K) of filter tap (s,r)
+      auto tile_origin = cA(0,0,*k_tile_iter);                                                // (m,(c,s,r))
+      int m_start = get<0>(tile_origin);
+      int c = get<0>(get<1>(tile_origin)) + chunk_channel;
+      int s = get<1>(get<1>(tile_origin));
+      int r = get<2>(get<1>(tile_origin));
+      int write_stage = smem_pipe_producer_state.index();
+
+      CUTLASS_PRAGMA_NO_UNROLL
+      for (int pass = 0; pass < PassesPerTile; ++pass) {
+        int row = pass * RowsPerPass + row_in_pass;
+        int m = m_start + row;
+        int np, q, n, p;
+        mainloop_params.divmod_q(np, q, m);
+        mainloop_params.divmod_p(n, p, np);
+        int h = p * mainloop_params.traversal_stride_h - mainloop_params.pad_h + r * mainloop_params.dilation_h;
+        int w = q * mainloop_params.traversal_stride_w - mainloop_params.pad_w + s * mainloop_params.dilation_w;
+        bool valid = m < mainloop_params.gemm_m &&
+                     h >= 0 && h < mainloop_params.upsampled_h &&
+                     w >= 0 && w < mainloop_params.upsampled_w;
+
+        ElementA const* ptr_image = mainloop_params.ptr_A + n * mainloop_params.stride_n + c;
+        SmemElementA* smem_ptr = &sA(row, chunk_channel, write_stage);
+
+        if constexpr (Upsample == UpsampleMode::kNearest) {
+          ElementA const* ptr_src = valid ?
+              ptr_image + (h >> 1) * mainloop_params.stride_h + (w >> 1) * mainloop_params.channels :
+              mainloop_params.ptr_A;
+          cutlass::arch::cp_async_zfill<sizeof(VectorA), cutlass::arch::CacheOperation::Global>(smem_ptr, ptr_src, valid);
+        }
+        else {
+          SmemVectorA result;
+          result.clear();
+          if (valid) {
+            int h0, h1, w0, w1;
+            float wh, ww;
+            bilinear_taps(h, input_h, h0, h1, wh);
+            bilinear_taps(w, input_w, w0, w1, ww);
+
+            auto load_tap = [&](int hi, int wi) {
+              return *reinterpret_cast<VectorA const*>(
+                  ptr_image + hi * mainloop_params.stride_h + wi * mainloop_params.channels);
+            };
+            NumericArrayConverter<float, ElementA, ElementsPerChunk> to_float;
+            Array<float, ElementsPerChunk> x00 = to_float(load_tap(h0, w0));
+            Array<float, ElementsPerChunk> x01 = to_float(load_tap(h0, w1));
+            Array<float, ElementsPerChunk> x10 = to_float(load_tap(h1, w0));
+            Array<float, ElementsPerChunk> x11 = to_float(load_tap(h1, w1));
+
+            Array<float, ElementsPerChunk> blended;
+            CUTLASS_PRAGMA_UNROLL
+            for (int i = 0; i < ElementsPerChunk; ++i) {
+              float top    = x00[i] + ww * (x01[i] - x00[i]);
+              float bottom = x10[i] + ww * (x11[i] - x10[i]);
+              blended[i] = top + wh * (bottom - top);
+            }
+            NumericArrayConverter<SmemElementA, float, ElementsPerChunk> to_smem;
+            result = to_smem(blended);
+          }
+          *reinterpret_cast<SmemVectorA*>(smem_ptr) = result;
+        }
+      }
+
+      if constexpr (Upsample == UpsampleMode::kNearest) {
+        pipeline.producer_commit(smem_pipe_producer_state, cutlass::arch::cpasync_barrier_arrive_noinc);
+      }
+      else {
+        // Make the generic proxy stores visible to GMMA before releasing the stage
+        cutlass::arch::fence_view_async_shared();
+        pipeline.producer_commit(smem_pipe_producer_state, [](uint64_t const* barrier) {
+          cutlass::arch::ClusterBarrier::arrive(barrier);
+        });
+      }
+
+      ++k_tile_iter;
+      ++smem_pipe_producer_state;
+    }
+  }
+
+  /// Perform a Producer Epilogue to prevent early exit of blocks in a Cluster
+  CUTLASS_DEVICE void
+  load_tail(MainloopPipeline pipeline, PipelineState smem_pipe_producer_state) {
+    int lane_predicate = cute::elect_one_sync();
+
+    // Issue the epilogue waits
+    if (lane_predicate) {
+      /* This helps avoid early exit of blocks in Cluster
+       * Waits for all stages to either be released (all
+       * Consumer UNLOCKs), or if the stage was never used
+       * then would just be acquired since the phase was
+       * still inverted from make_producer_start_state
+       */
+      pipeline.producer_tail(smem_pipe_producer_state);
+    }
+  }
+
+  /// Perform a collective-scoped matrix multiply-accumulate
+  /// Consumer Perspective
+  template <class FrgTensorC, class BlockCoord>
+  CUTLASS_DEVICE void
+  mma(MainloopPipeline pipeline,
+      PipelineState smem_pipe_consumer_state,
+      FrgTensorC& accum,
+      int k_tile_count,
+      int thread_idx,
+      TensorStorage& shared_tensors,
+      Params const& mainloop_params,
+      BlockCoord const& blk_coord) {
+    static_assert(is_rmem<FrgTensorC>::value, "C tensor must be rmem resident.");
+
+    Tensor sA = make_tensor(make_smem_ptr(shared_tensors.smem_A.data()), SmemLayoutA{});          // (BLK_M,BLK_K,PIPE)
+    Tensor sB = make_tensor(make_smem_ptr(shared_tensors.smem_B.data()), SmemLayoutB{});          // (BLK_N,BLK_K,PIPE)
+
+    //
+    // Define C accumulators and A/B partitioning
+    //
+
+    TiledMma tiled_mma;
+    auto thread_mma = tiled_mma.get_thread_slice(thread_idx);
+
+    Tensor tCsA = thread_mma.partition_A(sA);                                                 // (MMA,MMA_M,MMA_K,PIPE)
+    Tensor tCsB = thread_mma.partition_B(sB);                                                 // (MMA,MMA_N,MMA_K,PIPE)
+
+    // Allocate "fragments/descriptors"
+    Tensor tCrA = thread_mma.make_fragment_A(tCsA);                                           // (MMA,MMA_M,MMA_K,PIPE)
+    Tensor tCrB = thread_mma.make_fragment_B(tCsB);                                           // (MMA,MMA_N,MMA_K,PIPE)
+
+    CUTE_STATIC_ASSERT_V(size<1>(tCsA) == size<1>(accum));                                                         // M
+    CUTE_STATIC_ASSERT_V(size<1>(tCsB) == size<2>(accum));                                                         // N
+    CUTE_STATIC_ASSERT_V(size<2>(tCsA) == size<2>(tCsB));                                                          // K
+    CUTE_STATIC_ASSERT_V(size<3>(tCsA) == size<3>(tCsB));                                                       // PIPE
+    CUTE_STATIC_ASSERT_V(Int<DispatchPolicy::Stages>{} == size<2>(sA));                                         // PIPE
+    CUTE_STATIC_ASSERT_V(Int<DispatchPolicy::Stages>{} == size<2>(sB));                                         // PIPE
+
+    //
+    // PIPELINED MAIN LOOP
+    //
+    static_assert((0 <= K_PIPE_MMAS) && (K_PIPE_MMAS <  K_PIPE_MAX),
+        "ERROR : Incorrect number of MMAs in flight");
+
+    // We release buffers to producer warps(dma load) with some mmas in flight
+    PipelineState smem_pipe_release = smem_pipe_consumer_state;
+
+    // Prologue GMMAs
+    int prologue_mma_count = min(K_PIPE_MMAS, k_tile_count);
+
+    tiled_mma.accumulate_ = GMMA::ScaleOut::Zero;
+
+    warpgroup_fence_operand(accum);
+    CUTLASS_PRAGMA_UNROLL
+    for (int k_tile_prologue = prologue_mma_count; k_tile_prologue > 0; --k_tile_prologue) {
+      // WAIT on smem_pipe_consumer_state until its data are available (phase bit flips from rdPhaseBit value)
+      pipeline.consumer_wait(smem_pipe_consumer_state);
+
+      int read_stage = smem_pipe_consumer_state.index();
+      warpgroup_arrive();
+      // Unroll the K mode manually to set scale D to 1
+      CUTLASS_PRAGMA_UNROLL
+      for (int k_block = 0; k_block < size<2>(tCrA); ++k_block) {
+        // (V,M,K) x (V,N,K) => (V,M,N)
+        cute::gemm(tiled_mma, tCrA(_,_,k_block,read_stage), tCrB(_,_,k_block,read_stage), accum);
+        tiled_mma.accumulate_ = GMMA::ScaleOut::One;
+      }
+
+      warpgroup_commit_batch();
+
+      ++smem_pipe_consumer_state;
+    }
+
+    warpgroup_fence_operand(accum);
+    // Mainloop GMMAs
+    k_tile_count -= prologue_mma_count;
+
+    CUTLASS_PRAGMA_NO_UNROLL
+    for ( ; k_tile_count > 0; --k_tile_count) {
+      // WAIT on smem_pipe_consumer_state until its data are available (phase bit flips from rdPhaseBit value)
+      pipeline.consumer_wait(smem_pipe_consumer_state);
+
+      //
+      // Compute on k_tile
+      //
+
+      int read_stage = smem_pipe_consumer_state.index();
+      warpgroup_fence_operand(accum);
+      warpgroup_arrive();
+      // Unroll the K mode manually to set scale D to 1
+      CUTLASS_PRAGMA_UNROLL
+      for (int k_block = 0; k_block < size<2>(tCrA); ++k_block) {
+        // (V,M) x (V,N) => (V,M,N)
+        cute::gemm(tiled_mma, tCrA(_,_,k_block,read_stage), tCrB(_,_,k_block,read_stage), accum);
+        tiled_mma.accumulate_ = GMMA::ScaleOut::One;
+      }
+      warpgroup_commit_batch();
+
+      /// Wait on the GMMA barrier for K_PIPE_MMAS (or fewer) outstanding to ensure smem_pipe_producer_state is consumed
+      warpgroup_wait<K_PIPE_MMAS>();
+      warpgroup_fence_operand(accum);
+
+      // UNLOCK smem_pipe_release, done _computing_ on it
+      pipeline.consumer_release(smem_pipe_release);
+
+      // Advance smem_pipe_consumer_state and smem_pipe_release
+      ++smem_pipe_consumer_state;
+      ++smem_pipe_release;
+    }
+
+    warpgroup_fence_operand(accum);
+  }
+
+  /// Perform a Consumer Epilogue to release all buffers
+  CUTLASS_DEVICE void
+  mma_tail(MainloopPipeline pipeline, PipelineState smem_pipe_release, int k_tile_count) {
+    // Prologue GMMAs
+    int prologue_mma_count = min(K_PIPE_MMAS, k_tile_count);
+    k_tile_count -= prologue_mma_count;
+
+    smem_pipe_release.advance(k_tile_count);
+
+    // Wait on all GMMAs to complete
+    warpgroup_wait<0>();
+
+    for (int count = 0; count < prologue_mma_count; ++count) {
+      pipeline.consumer_release(smem_pipe_release);                 // UNLOCK smem_pipe_release, done _computing_ on it
+      ++smem_pipe_release;
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::conv::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
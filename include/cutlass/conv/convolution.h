@@ -104,7 +104,8 @@ enum class IteratorAlgorithm {
   kOptimized,     ///< optimized for R <= 32, S <= 32 and unity-stride dgrad
   kFixedChannels, ///< Analytic algorithm optimized for fixed channel count (C == AccessSize)
   kFewChannels,   ///< Analytic algorithm optimized for few channels (C divisible by AccessSize)
-  kFixedStrideDilation ///< Optimized for fixed stride and dilation
+  kFixedStrideDilation, ///< Optimized for fixed stride and dilation
+  kWinograd       ///< Winograd minimal filtering for unit-stride 3x3 fprop
 };
 
 /// Distinguishes among partial specializations that accelerate certain problems where convolution
@@ -130,6 +131,12 @@ enum class GroupMode {
   kDepthwise      ///< One CTA calculates cta_n groups (problem_size.C == problem_size.K == problem_size.groups)
 };
 
+/// Identifies the 2x upsampling applied to the activation by fused upsample fprop kernels
+enum class UpsampleMode {
+  kNearest,       ///< x'[h,w] = x[h/2,w/2]
+  kBilinear       ///< half-pixel centers with edge clamping (align_corners = false)
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// Shape of a tensor
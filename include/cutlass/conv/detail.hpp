@@ -31,6 +31,7 @@
  **************************************************************************************************/
 #pragma once
 
+#include "cutlass/fast_math.h"
 #include "cutlass/conv/convnd_problem_shape.hpp"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -132,6 +133,108 @@ get_linearized_problem_shape_MNKL(ConvProblemShape<ConvOp, SpatialDim> const& pr
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Strided dgrad phase decomposition, the 3.x counterpart of 2.x's
+// implicit_gemm_convolution_strided_dgrad.h.
+//
+// Stride phase (a_d, a_h, a_w) owns the dx pixels w = a_w + V * w' along each spatial mode. The only
+// filter taps landing on them are s = s0 + tap_step * s', where s0 * dilation = a_w + pad_w (mod V),
+// and they read dy at q = w' + pad' - s' * dilation'. Each phase is therefore a unit-stride dgrad
+// over strided views of the filter and of dx, and no MMA work is spent on zero-inserted dy pixels.
+template <int SpatialDim>
+struct StridedDgradPhase {
+  using ProblemShape = ConvProblemShape<conv::Operator::kDgrad, SpatialDim>;
+
+  ProblemShape problem_shape{};             // unit-stride sub-problem of this phase
+  cute::array<int, SpatialDim> dx_start{};  // first dx coordinate of this phase, [d,h,w]
+  int64_t filter_offset = 0;                // element offset of the first filter tap of this phase
+  bool has_output = true;                   // false if the phase owns no dx pixel
+  bool has_taps = true;                     // false if no filter tap lands on the phase, see below
+};
+
+// Number of stride phases of a dgrad problem, V * U * O
+template <int SpatialDim>
+int
+get_strided_dgrad_phase_count(ConvProblemShape<conv::Operator::kDgrad, SpatialDim> const& problem_shape) {
+  int phase_count = 1;
+  for (int i = 0; i < SpatialDim; ++i) {
+    phase_count *= problem_shape.traversal_stride[i];
+  }
+  return phase_count;
+}
+
+// Returns the unit-stride sub-problem of stride phase `phase_idx`, phases being enumerated with the
+// innermost spatial mode fastest. The sub-problem keeps the dy tensor and the filter/dx base addresses
+// of the original problem: the caller offsets the filter by `filter_offset` and dx by `dx_start`.
+// Phases without filter taps still own dx pixels that the epilogue has to write. For those the
+// sub-problem is a 1x1 dgrad whose filter must be a zero-filled, packed [K,1,..,1,C] tensor.
+template <int SpatialDim>
+StridedDgradPhase<SpatialDim>
+get_strided_dgrad_phase(ConvProblemShape<conv::Operator::kDgrad, SpatialDim> const& problem_shape, int phase_idx) {
+  constexpr int RankT = SpatialDim + 2;
+
+  StridedDgradPhase<SpatialDim> phase;
+  auto& sub_problem = phase.problem_shape;
+  sub_problem = problem_shape;
+
+  for (int i = SpatialDim - 1; i >= 0; --i) {
+    int const stride = problem_shape.traversal_stride[i];
+    int const dilation = problem_shape.dilation[i];
+    int const filter_extent = problem_shape.shape_B[i+1];
+    int const dx_extent = problem_shape.shape_C[i+1];
+    int const dx_start = phase_idx % stride;
+    phase_idx /= stride;
+
+    // First tap s0 with s0 * dilation = dx_start + pad (mod stride). The taps of a phase repeat every
+    // tap_step taps, and none land on it if no such s0 exists or it lies outside of the filter.
+    int const residue = (dx_start + problem_shape.lower_padding[i]) % stride;
+    int const tap_step = stride / cutlass::gcd(stride, dilation);
+    int s0 = 0;
+    while (s0 < tap_step && (s0 * dilation) % stride != residue) {
+      ++s0;
+    }
+    int const taps = (s0 < tap_step && s0 < filter_extent) ? cutlass::ceil_div(filter_extent - s0, tap_step) : 0;
+    int const dx_sub_extent = dx_extent > dx_start ? cutlass::ceil_div(dx_extent - dx_start, stride) : 0;
+
+    phase.dx_start[i] = dx_start;
+    phase.has_output &= dx_sub_extent > 0;
+    phase.has_taps &= taps > 0;
+    phase.filter_offset += int64_t(s0) * problem_shape.stride_B[i+1];
+
+    sub_problem.shape_B[i+1] = taps;
+    sub_problem.stride_B[i+1] = problem_shape.stride_B[i+1] * tap_step;
+    sub_problem.shape_C[i+1] = dx_sub_extent;
+    sub_problem.stride_C[i+1] = problem_shape.stride_C[i+1] * stride;
+    sub_problem.traversal_stride[i] = 1;
+    sub_problem.dilation[i] = dilation / (stride / tap_step);
+    // Exact division: dx_start + pad - s0 * dilation is a multiple of the stride by choice of s0
+    sub_problem.lower_padding[i] = (dx_start + problem_shape.lower_padding[i] - s0 * dilation) / stride;
+  }
+
+  if (not phase.has_taps) {
+    phase.filter_offset = 0;
+    int const channels = problem_shape.shape_B[RankT-1];
+    sub_problem.stride_B[0] = channels;
+    sub_problem.stride_B[RankT-1] = 1;
+    for (int i = 0; i < SpatialDim; ++i) {
+      sub_problem.shape_B[i+1] = 1;
+      sub_problem.stride_B[i+1] = channels;
+      sub_problem.dilation[i] = 1;
+      sub_problem.lower_padding[i] = 0;
+    }
+  }
+
+  // The dgrad mainloop only consumes the lower padding, keep the upper padding consistent with it
+  for (int i = 0; i < SpatialDim; ++i) {
+    int const upper_padding = sub_problem.shape_A[i+1] - sub_problem.shape_C[i+1] - sub_problem.lower_padding[i] +
+                              (sub_problem.shape_B[i+1] - 1) * sub_problem.dilation[i];
+    sub_problem.upper_padding[i] = upper_padding > 0 ? upper_padding : 0;
+  }
+
+  return phase;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 } // namespace cutlass::conv::detail
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
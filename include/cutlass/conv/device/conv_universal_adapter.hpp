@@ -37,12 +37,17 @@
 #include "cutlass/trace.h"
 #include "cutlass/cluster_launch.hpp"
 #include "cutlass/device_kernel.h"
+#include "cutlass/kernel_launch.h"
+#include "cutlass/workspace.h"
 
+#include "cutlass/conv/detail.hpp"
 #include "cutlass/conv/kernel/conv_universal.hpp"
 #include "cutlass/gemm/gemm.h"
 #include "cutlass/detail/layout.hpp"
 #include "cutlass/cuda_host_adapter.hpp"
 
+#include <vector>
+
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace cutlass::conv::device {
@@ -78,6 +83,12 @@ public:
   static constexpr conv::Operator kConvolutionalOperator = DispatchPolicy::ConvOp;
   static constexpr int NumSpatialDimensions = CollectiveMainloop::NumSpatialDimensions;
 
+  // Dgrad kernels loading dy through TMA im2col only implement unit traversal strides. Strided dgrad
+  // is lowered into one unit-stride launch per stride phase (see detail::get_strided_dgrad_phase()),
+  // so that no MMA work is spent on the zeros of a zero-inserted dy.
+  static constexpr bool kDecomposeStridedDgrad =
+      kConvolutionalOperator == conv::Operator::kDgrad && CollectiveMainloop::is_im2col_A;
+
   // If our TiledMMA's instruction thread layout size is larger than 1, we know its a tensorop!
   using OperatorClass = cute::conditional_t<
       (cute::size(typename ConvKernel::TiledMma::AtomThrID{}) > 1),
@@ -142,6 +153,169 @@ private:
   /// Kernel API parameters object
   Params params_;
 
+  /// Kernel API parameters of the stride phases of a strided dgrad problem, launched in order
+  std::vector<Params> dgrad_phase_params_;
+
+  /// Returns true if the problem is a dgrad with a non-unit traversal stride
+  static bool
+  is_strided_dgrad(Arguments const& args) {
+    if constexpr (kDecomposeStridedDgrad) {
+      for (int stride : args.problem_shape.traversal_stride) {
+        if (stride != 1) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  /// Size of the zero-filled [K,1,..,1,C] filter read by the stride phases that no filter tap lands on
+  static size_t
+  get_dgrad_zero_filter_size(Arguments const& args) {
+    if constexpr (kDecomposeStridedDgrad) {
+      auto const& problem_shape = args.problem_shape;
+      int const phase_count = detail::get_strided_dgrad_phase_count(problem_shape);
+      for (int phase_idx = 0; phase_idx < phase_count; ++phase_idx) {
+        auto phase = detail::get_strided_dgrad_phase(problem_shape, phase_idx);
+        if (phase.has_output && not phase.has_taps) {
+          size_t filter_bytes = size_t(problem_shape.shape_B[0]) * size_t(problem_shape.shape_B[NumSpatialDimensions+1]) *
+                                cutlass::sizeof_bits<ElementB>::value / 8;
+          return (filter_bytes + MinWorkspaceAlignment - 1) / MinWorkspaceAlignment * MinWorkspaceAlignment;
+        }
+      }
+    }
+    return 0;
+  }
+
+  /// Checks that the kernel implements the unit-stride sub-problem of every stride phase
+  static Status
+  can_implement_dgrad_phases(Arguments const& args) {
+    if constexpr (kDecomposeStridedDgrad) {
+      int const phase_count = detail::get_strided_dgrad_phase_count(args.problem_shape);
+      for (int phase_idx = 0; phase_idx < phase_count; ++phase_idx) {
+        auto phase = detail::get_strided_dgrad_phase(args.problem_shape, phase_idx);
+        if (phase.has_output && not ConvKernel::can_implement(get_dgrad_phase_arguments(args, phase, nullptr))) {
+          CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Stride phase " << phase_idx << " of the strided dgrad is not supported.\n");
+          return Status::kInvalid;
+        }
+      }
+      return Status::kSuccess;
+    }
+    else {
+      return Status::kErrorNotSupported;
+    }
+  }
+
+  /// Workspace of a strided dgrad: the zero filter followed by the kernel workspace of each stride phase
+  static size_t
+  get_dgrad_phases_workspace_size(Arguments const& args) {
+    size_t workspace_bytes = get_dgrad_zero_filter_size(args);
+    if constexpr (kDecomposeStridedDgrad) {
+      int const phase_count = detail::get_strided_dgrad_phase_count(args.problem_shape);
+      for (int phase_idx = 0; phase_idx < phase_count; ++phase_idx) {
+        auto phase = detail::get_strided_dgrad_phase(args.problem_shape, phase_idx);
+        if (phase.has_output) {
+          workspace_bytes += ConvKernel::get_workspace_size(get_dgrad_phase_arguments(args, phase, nullptr));
+        }
+      }
+    }
+    return workspace_bytes;
+  }
+
+  /// Lowers the arguments of a strided dgrad to the unit-stride arguments of one of its stride phases.
+  /// Fusion operands of the epilogue are not rebased: only the C and D views are strided per phase.
+  template <class Phase>
+  static Arguments
+  get_dgrad_phase_arguments(Arguments const& args, Phase const& phase, void const* zero_filter) {
+    Arguments phase_args = args;
+    phase_args.problem_shape = phase.problem_shape;
+    phase_args.mainloop.ptr_B = phase.has_taps ? args.mainloop.ptr_B + phase.filter_offset
+                                               : reinterpret_cast<decltype(args.mainloop.ptr_B)>(zero_filter);
+
+    // dC/dD are ((w,h,d,n),c,l) strides while the phase coordinates are [d,h,w]
+    int64_t offset_C = 0;
+    int64_t offset_D = 0;
+    cute::for_each(cute::make_seq<NumSpatialDimensions>{}, [&](auto i) {
+      int const mode = NumSpatialDimensions - 1 - int(i);
+      int const stride = args.problem_shape.traversal_stride[mode];
+      offset_C += int64_t(phase.dx_start[mode]) * cute::get<0,i>(args.epilogue.dC);
+      offset_D += int64_t(phase.dx_start[mode]) * cute::get<0,i>(args.epilogue.dD);
+      cute::get<0,i>(phase_args.epilogue.dC) = cute::get<0,i>(args.epilogue.dC) * stride;
+      cute::get<0,i>(phase_args.epilogue.dD) = cute::get<0,i>(args.epilogue.dD) * stride;
+    });
+    if constexpr (not cute::is_void_v<cute::remove_pointer_t<decltype(args.epilogue.ptr_C)>>) {
+      if (args.epilogue.ptr_C != nullptr) {
+        phase_args.epilogue.ptr_C = args.epilogue.ptr_C + offset_C;
+      }
+    }
+    phase_args.epilogue.ptr_D = args.epilogue.ptr_D + offset_D;
+    return phase_args;
+  }
+
+  /// Lowers every stride phase that owns dx pixels to its own kernel params. The workspace holds the
+  /// zero-filled filter of the phases without filter taps, followed by the kernel workspace of each phase.
+  Status
+  initialize_dgrad_phases(
+    Arguments const& args,
+    void* workspace,
+    cudaStream_t stream,
+    CudaHostAdapter *cuda_adapter,
+    bool initialize_workspace) {
+
+    if constexpr (kDecomposeStridedDgrad) {
+      dgrad_phase_params_.clear();
+      uint8_t* workspace_ptr = reinterpret_cast<uint8_t*>(workspace);
+      size_t workspace_offset = get_dgrad_zero_filter_size(args);
+      if (initialize_workspace) {
+        Status status = zero_workspace(workspace, workspace_offset, stream, cuda_adapter);
+        if (status != Status::kSuccess) {
+          return status;
+        }
+      }
+
+      int const phase_count = detail::get_strided_dgrad_phase_count(args.problem_shape);
+      for (int phase_idx = 0; phase_idx < phase_count; ++phase_idx) {
+        auto phase = detail::get_strided_dgrad_phase(args.problem_shape, phase_idx);
+        if (not phase.has_output) {
+          continue;
+        }
+        Arguments phase_args = get_dgrad_phase_arguments(args, phase, workspace);
+        void* phase_workspace = workspace_ptr ? workspace_ptr + workspace_offset : nullptr;
+        if (initialize_workspace) {
+          Status status = ConvKernel::initialize_workspace(phase_args, phase_workspace, stream, cuda_adapter);
+          if (status != Status::kSuccess) {
+            return status;
+          }
+        }
+        dgrad_phase_params_.push_back(ConvKernel::to_underlying_arguments(phase_args, phase_workspace));
+        workspace_offset += ConvKernel::get_workspace_size(phase_args);
+      }
+      return Status::kSuccess;
+    }
+    else {
+      return Status::kErrorNotSupported;
+    }
+  }
+
+  /// Launches the internal params struct, or the params of each stride phase in order
+  Status
+  launch(
+    cudaStream_t stream,
+    CudaHostAdapter *cuda_adapter = nullptr,
+    int32_t kernel_index = 0,
+    bool launch_with_pdl = false) {
+    if (dgrad_phase_params_.empty()) {
+      return run(params_, stream, cuda_adapter, kernel_index, launch_with_pdl);
+    }
+    for (Params& phase_params : dgrad_phase_params_) {
+      Status status = run(phase_params, stream, cuda_adapter, kernel_index, launch_with_pdl);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+    return Status::kSuccess;
+  }
+
 public:
 
   /// Access the Params structure
@@ -152,6 +326,10 @@ public:
   /// Determines whether the conv can execute the given problem.
   static Status
   can_implement(Arguments const& args) {
+    if (is_strided_dgrad(args)) {
+      return can_implement_dgrad_phases(args);
+    }
+
     if (ConvKernel::can_implement(args)) {
       return Status::kSuccess;
     }
@@ -166,6 +344,11 @@ public:
     size_t workspace_bytes = 0;
     CUTLASS_TRACE_HOST("  workspace_bytes: " << workspace_bytes);
 
+    if (is_strided_dgrad(args)) {
+      workspace_bytes += get_dgrad_phases_workspace_size(args);
+      return workspace_bytes;
+    }
+
     workspace_bytes += ConvKernel::get_workspace_size(args);
     return workspace_bytes;
   }
@@ -236,14 +419,24 @@ public:
     CUTLASS_TRACE_HOST("ConvUniversal::initialize() - workspace "
       << workspace << ", stream: " << (stream ? "non-null" : "null"));
 
-    // Initialize the workspace
-    Status status = ConvKernel::initialize_workspace(args, workspace, stream, cuda_adapter);
-    if (status != Status::kSuccess) {
-      return status;
+    if (is_strided_dgrad(args)) {
+      // Initialize the workspace and the Params structure of each stride phase
+      Status status = initialize_dgrad_phases(args, workspace, stream, cuda_adapter, true);
+      if (status != Status::kSuccess) {
+        return status;
+      }
     }
+    else {
+      // Initialize the workspace
+      Status status = ConvKernel::initialize_workspace(args, workspace, stream, cuda_adapter);
+      if (status != Status::kSuccess) {
+        return status;
+      }
 
-    // Initialize the Params structure
-    params_ = ConvKernel::to_underlying_arguments(args, workspace);
+      // Initialize the Params structure
+      params_ = ConvKernel::to_underlying_arguments(args, workspace);
+      dgrad_phase_params_.clear();
+    }
 
     // Don't set the function attributes - require the CudaHostAdapter to set it.
     if constexpr (kEnableCudaHostAdapter) {
@@ -279,14 +472,23 @@ public:
       return Status::kErrorWorkspaceNull;
     }
 
+    if (is_strided_dgrad(args)) {
+      return initialize_dgrad_phases(args, workspace, nullptr, nullptr, false);
+    }
+
     params_ = ConvKernel::to_underlying_arguments(args, workspace);
+    dgrad_phase_params_.clear();
     return Status::kSuccess;
   }
 
   /// Primary run() entry point API that is static allowing users to create and manage their own params.
   /// Supplied params struct must be construct by calling ConvKernel::to_underling_arguments()
   static Status
-  run(Params& params, cudaStream_t stream = nullptr, CudaHostAdapter *cuda_adapter = nullptr, int32_t kernel_index = 0) {
+  run(Params& params,
+      cudaStream_t stream = nullptr,
+      CudaHostAdapter *cuda_adapter = nullptr,
+      int32_t kernel_index = 0,
+      bool launch_with_pdl = false) {
     CUTLASS_TRACE_HOST("ConvUniversal::run()");
     dim3 const block = ConvKernel::get_block_shape();
     dim3 const grid = get_grid_shape(params);
@@ -320,6 +522,11 @@ public:
         //
         CUTLASS_ASSERT(cuda_adapter);
         if (cuda_adapter) {
+          if (launch_with_pdl) {
+            CUTLASS_TRACE_HOST(
+              "ConvUniversal::run() does not support launching with PDL and a custom cuda adapter.");
+            return Status::kErrorInternal;
+          }
 
           launch_result = cuda_adapter->launch(grid,
                                                cluster, 
@@ -341,12 +548,12 @@ public:
                         || ConvKernel::ArchTag::kMinComputeCapability == 100 
                      ) {
           if constexpr (is_static_1x1x1) {
-            device_kernel<ConvKernel><<<grid, block, smem_size, stream>>>(params);
-            launch_result = Status::kSuccess;
+            launch_result = cutlass::kernel_launch<ConvKernel>(
+              grid, block, smem_size, stream, params, launch_with_pdl);
           }
           else {
             launch_result = ClusterLauncher::launch(
-                grid, cluster, block, smem_size, stream, kernel, kernel_params);
+                grid, cluster, block, smem_size, stream, kernel, kernel_params, launch_with_pdl);
           }
         }
         else {
@@ -361,7 +568,8 @@ public:
               smem_size,
               stream,
               kernel,
-              kernel_params);
+              kernel_params,
+              launch_with_pdl);
           }
         }
       }
@@ -385,7 +593,8 @@ public:
       }
       else {
         CUTLASS_ASSERT(cuda_adapter == nullptr);
-        device_kernel<ConvKernel><<<grid, block, smem_size, stream>>>(params);
+        launch_result = cutlass::kernel_launch<ConvKernel>(
+          grid, block, smem_size, stream, params, launch_with_pdl);
       }
     }
 
@@ -410,11 +619,12 @@ public:
     void* workspace = nullptr,
     cudaStream_t stream = nullptr,
     CudaHostAdapter *cuda_adapter = nullptr,
-    int32_t kernel_index = 0
+    int32_t kernel_index = 0,
+    bool launch_with_pdl = false
   ) {
     Status status = initialize(args, workspace, stream, cuda_adapter);
     if (Status::kSuccess == status) {
-      status = run(params_, stream, cuda_adapter, kernel_index);
+      status = launch(stream, cuda_adapter, kernel_index, launch_with_pdl);
     }
     return status;
   }
@@ -432,13 +642,13 @@ public:
   /// Overload that allows a user to re-launch the same kernel without updating internal params struct.
   Status
   run(cudaStream_t stream = nullptr) {
-    return run(params_, stream);
+    return launch(stream);
   }
 
   /// Overload that allows a user to re-launch the same kernel without updating internal params struct.
   Status
   operator()(cudaStream_t stream = nullptr) {
-    return run(params_, stream);
+    return launch(stream);
   }
 };
 
@@ -0,0 +1,271 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Template for device-level Winograd F(m x m, 3 x 3) fprop
+*/
+
+#pragma once
+
+#include <limits>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/device_kernel.h"
+#include "cutlass/conv/convolution.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace conv {
+namespace device {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename WinogradKernel_>
+class WinogradConvolution {
+public:
+
+  using UnderlyingKernel = WinogradKernel_;
+
+  using ElementA = typename UnderlyingKernel::ElementA;
+  using LayoutA = typename UnderlyingKernel::LayoutA;
+  using ElementB = typename UnderlyingKernel::ElementB;
+  using LayoutB = typename UnderlyingKernel::LayoutB;
+  using ElementC = typename UnderlyingKernel::ElementC;
+  using LayoutC = typename UnderlyingKernel::LayoutC;
+  using ElementAccumulator = typename UnderlyingKernel::ElementAccumulator;
+  using ElementCompute = typename UnderlyingKernel::ElementCompute;
+  using OperatorClass = typename UnderlyingKernel::OperatorClass;
+  using ArchTag = typename UnderlyingKernel::ArchTag;
+  using ThreadblockShape = typename UnderlyingKernel::ThreadblockShape;
+  using WarpShape = typename UnderlyingKernel::WarpShape;
+  using InstructionShape = typename UnderlyingKernel::InstructionShape;
+  using EpilogueOutputOp = typename UnderlyingKernel::EpilogueOutputOp;
+  static int const kStages = UnderlyingKernel::kStages;
+  static int const kConvDim = UnderlyingKernel::kConvDim;
+  using ArchMmaOperator = typename UnderlyingKernel::ArchMmaOperator;
+  using MathOperator = typename UnderlyingKernel::MathOperator;
+
+  static cutlass::conv::Operator const kConvolutionalOperator = UnderlyingKernel::kConvolutionalOperator;
+  static cutlass::conv::IteratorAlgorithm const kIteratorAlgorithm = UnderlyingKernel::kIteratorAlgorithm;
+  static cutlass::conv::StrideSupport const kStrideSupport = UnderlyingKernel::kStrideSupport;
+  static cutlass::conv::GroupMode const kGroupMode = UnderlyingKernel::kGroupMode;
+
+  static int const kOutputTile = UnderlyingKernel::kOutputTile;
+
+  static int const kWarpCount = UnderlyingKernel::WarpCount::kCount;
+
+  /// Argument structure
+  using Arguments = typename UnderlyingKernel::Arguments;
+
+  using FilterTransformKernel = typename UnderlyingKernel::FilterTransform;
+
+private:
+
+  /// Kernel parameters object
+  typename UnderlyingKernel::Params params_;
+
+public:
+
+  /// Constructs Winograd convolution
+  WinogradConvolution() { }
+
+  /// Determines whether the Winograd convolution can execute the given problem.
+  static Status can_implement(Arguments const &args) {
+
+    auto const &problem_size = args.problem_size;
+
+    // Winograd F(m x m, 3 x 3) only implements unit-stride, non-dilated, non-grouped 3x3 filters
+    if (problem_size.R != UnderlyingKernel::kFilterSize || problem_size.S != UnderlyingKernel::kFilterSize) {
+      return Status::kErrorInvalidProblem;
+    }
+
+    if (problem_size.stride_h != 1 || problem_size.stride_w != 1 ||
+        problem_size.dilation_h != 1 || problem_size.dilation_w != 1) {
+      return Status::kErrorInvalidProblem;
+    }
+
+    if (problem_size.groups != 1) {
+      return Status::kErrorInvalidProblem;
+    }
+
+    // Input channels are reduced within a threadblock
+    if (problem_size.split_k_slices != 1 || args.split_k_mode != SplitKMode::kSerial) {
+      return Status::kErrorNotSupported;
+    }
+
+    if (problem_size.P != problem_size.H + 2 * problem_size.pad_h - problem_size.R + 1 ||
+        problem_size.Q != problem_size.W + 2 * problem_size.pad_w - problem_size.S + 1) {
+      return Status::kErrorInvalidProblem;
+    }
+
+    if (problem_size.C % UnderlyingKernel::kAccessSize) {
+      return Status::kErrorMisalignedOperand;
+    }
+
+    // Check that tensor sizes don't exceed maximum supported size
+    if (problem_size.activation_size() * sizeof(ElementA) >= (1ull << 31) ||
+        problem_size.filter_size() * sizeof(ElementB) >= (1ull << 31) ||
+        problem_size.output_size() * sizeof(ElementC) >= (1ull << 31)) {
+      return Status::kErrorInvalidProblem;
+    }
+
+    // Determine grid shape
+    typename UnderlyingKernel::Params params(args);
+    dim3 grid = UnderlyingKernel::get_grid_shape(params);
+
+    if (!(grid.y <= std::numeric_limits<uint16_t>::max() &&
+          grid.z <= std::numeric_limits<uint16_t>::max())) {
+
+      return Status::kErrorInvalidProblem;
+    }
+
+    return Status::kSuccess;
+  }
+
+  /// Gets the workspace size: the filter transformed into the Winograd domain
+  static size_t get_workspace_size(Arguments const &args) {
+    return UnderlyingKernel::get_workspace_size(args.problem_size);
+  }
+
+  /// Initializes Winograd convolution state from arguments.
+  Status initialize(
+    Arguments const &args,
+    void *workspace = nullptr,
+    cudaStream_t stream = nullptr) {
+
+    if (!workspace) {
+      return Status::kErrorWorkspaceNull;
+    }
+
+    // initialize the params structure from the arguments
+    params_ = typename UnderlyingKernel::Params(
+      args,
+      static_cast<ElementB *>(workspace)
+    );
+
+    int smem_size = int(sizeof(typename UnderlyingKernel::SharedStorage));
+
+    if (smem_size >= (48 << 10)) {
+      cudaError_t result = cudaFuncSetAttribute(cutlass::Kernel<UnderlyingKernel>,
+                                    cudaFuncAttributeMaxDynamicSharedMemorySize,
+                                    smem_size);
+
+      if (result != cudaSuccess) {
+        return Status::kErrorInternal;
+      }
+    }
+
+    return Status::kSuccess;
+  }
+
+  /// Initializes Winograd convolution state from arguments.
+  Status update(Arguments const &args, void *workspace = nullptr) {
+
+    if (!workspace) {
+      return Status::kErrorWorkspaceNull;
+    }
+
+    // update the params structure from the arguments
+    params_.ptr_A = args.ref_A.data();
+    params_.ptr_B = args.ref_B.data();
+    params_.ptr_C = args.ref_C.data();
+    params_.ptr_D = args.ref_D.data();
+    params_.output_op = args.output_op;
+    params_.ptr_U = static_cast<ElementB *>(workspace);
+
+    return Status::kSuccess;
+  }
+
+  /// Runs the kernel using initialized state.
+  Status run(cudaStream_t stream = nullptr) {
+
+    // Launch filter transform kernel
+    {
+      dim3 grid = UnderlyingKernel::get_filter_transform_grid_shape(params_);
+      dim3 block(FilterTransformKernel::kThreadCount, 1, 1);
+
+      cutlass::arch::synclog_setup();
+      cutlass::Kernel<FilterTransformKernel><<<grid, block, 0, stream>>>(
+        UnderlyingKernel::get_filter_transform_params(params_));
+
+      cudaError_t result = cudaGetLastError();
+      if (result != cudaSuccess) {
+        CUTLASS_TRACE_HOST("  Filter transform kernel launch failed. Reason: " << result);
+        return Status::kErrorInternal;
+      }
+    }
+
+    // Launch main kernel
+    dim3 grid = UnderlyingKernel::get_grid_shape(params_);
+    dim3 block(UnderlyingKernel::kThreadCount, 1, 1);
+
+    int smem_size = int(sizeof(typename UnderlyingKernel::SharedStorage));
+
+    cutlass::arch::synclog_setup();
+    cutlass::Kernel<UnderlyingKernel><<<grid, block, smem_size, stream>>>(params_);
+
+    cudaError_t result = cudaGetLastError();
+    if (result != cudaSuccess) {
+      CUTLASS_TRACE_HOST("  Kernel launch failed. Reason: " << result);
+      return Status::kErrorInternal;
+    }
+
+    return Status::kSuccess;
+  }
+
+  /// Runs the kernel using initialized state.
+  Status operator()(cudaStream_t stream = nullptr) {
+    return run(stream);
+  }
+
+  /// Runs the kernel using initialized state.
+  Status operator()(
+    Arguments const &args,
+    void *workspace = nullptr,
+    cudaStream_t stream = nullptr) {
+
+    Status status = initialize(args, workspace, stream);
+
+    if (status == Status::kSuccess) {
+      status = run(stream);
+    }
+
+    return status;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -51,7 +51,7 @@ namespace cutlass::conv {
 // Policies for categorical dispatch of mainloop against kernel grid schedules
 //
 struct KernelImplicitTmaWarpSpecializedSm90 : cutlass::gemm::KernelTmaWarpSpecialized { };
-struct KernelImplicitTmaWarpSpecializedSm90Cooperative { };
+struct KernelImplicitTmaWarpSpecializedSm90Cooperative : cutlass::gemm::KernelTmaWarpSpecializedCooperative { };
 struct KernelImplicitTmaWarpSpecializedSm90Pingpong { };
 
 //
@@ -78,9 +78,39 @@ struct MainloopSm90TmaGmmaWarpSpecializedImplicitGemm {
   using Schedule = KernelSchedule;
 
   static_assert(NumSpatialDimensions >= 1);
-  static_assert(! (cute::is_same_v<KernelSchedule,KernelImplicitTmaWarpSpecializedSm90Cooperative> ||
-                   cute::is_same_v<KernelSchedule,KernelImplicitTmaWarpSpecializedSm90Pingpong>),
-    "Persistent schedules not support for conv yet.");
+  static_assert(! cute::is_same_v<KernelSchedule,KernelImplicitTmaWarpSpecializedSm90Pingpong>,
+    "Pingpong schedule not supported for conv yet.");
+};
+
+// Fprop kernel schedule reading a 2x upsampled activation synthesized from the low resolution input.
+// The activation tile is gathered by the auxiliary producer warp of the cooperative kernel.
+template <UpsampleMode Mode_>
+struct KernelImplicitUpsample2xSm90Cooperative : KernelImplicitTmaWarpSpecializedSm90Cooperative {
+  static constexpr UpsampleMode Mode = Mode_;
+};
+using KernelImplicitUpsampleNearest2xSm90Cooperative = KernelImplicitUpsample2xSm90Cooperative<UpsampleMode::kNearest>;
+using KernelImplicitUpsampleBilinear2xSm90Cooperative = KernelImplicitUpsample2xSm90Cooperative<UpsampleMode::kBilinear>;
+
+// n-buffer in smem, 2D fprop whose activation is a 2x upsampled view of the input. The activation
+// tiles are gathered with cp.async (nearest) or interpolated in registers (bilinear) by one producer
+// warp while the filter tiles are loaded with TMA, both arriving on the same stage barrier.
+template<
+  int Stages_,
+  UpsampleMode Mode_,
+  class ClusterShape_ = cute::Shape<cute::C<1>,cute::C<1>,cute::C<1>>,
+  int PipelineAsyncMmaStages_ = 1
+>
+struct MainloopSm90CpAsyncUpsampleGmmaWarpSpecializedImplicitGemm {
+  static constexpr int Stages = Stages_;
+  static constexpr int NumSpatialDimensions = 2;
+  static constexpr Operator ConvOp = Operator::kFprop;
+  static constexpr UpsampleMode Upsample = Mode_;
+  static constexpr int PipelineAsyncMmaStages = PipelineAsyncMmaStages_;
+  using ClusterShape = ClusterShape_;
+  using ArchTag = arch::Sm90;
+  using Schedule = KernelImplicitUpsample2xSm90Cooperative<Mode_>;
+
+  static_assert(cute::size(ClusterShape{}) == 1, "The upsampled activation is not multicast, use a 1x1x1 cluster.");
 };
 
 
@@ -135,3 +165,25 @@ struct MainloopSm100TmaUmmaWarpSpecializedImplicitGemm {
 } // namespace cutlass::conv 
 
 //////////////////////////////////////////////////////////////////////////////
+
+// The upsampled activation is loaded by the MainloopAux producer warp
+namespace cutlass::gemm::kernel::detail {
+
+template<
+  int Stages,
+  conv::UpsampleMode Mode,
+  class ClusterShape,
+  int PipelineAsyncMmaStages
+>
+struct HasAuxiliaryLoad<
+  conv::MainloopSm90CpAsyncUpsampleGmmaWarpSpecializedImplicitGemm<
+    Stages,
+    Mode,
+    ClusterShape,
+    PipelineAsyncMmaStages
+  >
+> : cute::true_type{};
+
+} // namespace cutlass::gemm::kernel::detail
+
+//////////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,8 @@
 
 #include "cutlass/conv/convnd_problem_shape.hpp"
 #include "cutlass/detail/dependent_false.hpp"
+#include "cutlass/gemm/gemm.h"
+#include "cutlass/kernel_hardware_info.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -57,6 +59,39 @@ class ConvUniversal {
 
 ////////////////////////////////////////////////////////////////////////////////
 
+namespace detail {
+
+template <class ConvKernel, class = void>
+struct HasGemmModeArgument : cute::false_type { };
+
+template <class ConvKernel>
+struct HasGemmModeArgument<ConvKernel, cute::void_t<decltype(std::declval<typename ConvKernel::Arguments&>().mode)>>
+    : cute::true_type { };
+
+} // namespace detail
+
+/*
+ * Builds the arguments of a CONV kernel. Persistent SM90 kernels are GEMM kernels, whose aggregate
+ * arguments lead with the GEMM mode, which is always kGemm for convolutions.
+**/
+template <class ConvKernel>
+typename ConvKernel::Arguments
+make_conv_arguments(
+    typename ConvKernel::ProblemShape const& problem_shape,
+    typename ConvKernel::MainloopArguments const& mainloop,
+    typename ConvKernel::EpilogueArguments const& epilogue,
+    KernelHardwareInfo const& hw_info = {},
+    typename ConvKernel::TileScheduler::Arguments const& scheduler = {}) {
+  if constexpr (detail::HasGemmModeArgument<ConvKernel>::value) {
+    return {cutlass::gemm::GemmUniversalMode::kGemm, problem_shape, mainloop, epilogue, hw_info, scheduler};
+  }
+  else {
+    return {problem_shape, mainloop, epilogue, hw_info, scheduler};
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 } // namespace cutlass::conv::kernel
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -302,6 +302,20 @@ public:
       }
     }
 
+    // Grouped fprop multicasts A along cluster N, so all CTAs of a cluster row must share a group
+    if constexpr (CollectiveMainloop::DispatchPolicy::ConvOp == conv::Operator::kFprop) {
+      if (args.problem_shape.groups > 1) {
+        int group_K = args.problem_shape.shape_B[0] / args.problem_shape.groups;
+        implementable &= group_K % (size<1>(TileShape{}) * size<1>(cluster_shape)) == 0;
+        implementable &= group_K % (size<1>(TileShape{}) * size<1>(cluster_shape_fallback)) == 0;
+
+        if (!implementable) {
+          CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Grouped Fprop requires K/groups divisible by Tile_N * Cluster_N.\n");
+          return false;
+        }
+      }
+    }
+
     return implementable;
   }
 
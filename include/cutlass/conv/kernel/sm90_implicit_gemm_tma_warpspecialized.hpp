@@ -70,6 +70,28 @@ class ConvUniversal<
   TileScheduler_
 >
 {};
+
+// Persistent cooperative kernel, supports the stream-K and split-K tile schedulers. Mostly useful for
+// wgrad, whose GEMM-K spans all output pixels (N,Z,P,Q) of the activation.
+template <
+  class ProblemShape_,
+  class CollectiveMainloop_,
+  class CollectiveEpilogue_,
+  class TileScheduler_
+>
+class ConvUniversal<
+  ProblemShape_,
+  CollectiveMainloop_,
+  CollectiveEpilogue_,
+  TileScheduler_,
+  cute::enable_if_t<cute::is_base_of_v<KernelImplicitTmaWarpSpecializedSm90Cooperative, typename CollectiveMainloop_::DispatchPolicy::Schedule>>
+> : public cutlass::gemm::kernel::GemmUniversal<
+  ProblemShape_,
+  CollectiveMainloop_,
+  CollectiveEpilogue_,
+  TileScheduler_
+>
+{};
 ///////////////////////////////////////////////////////////////////////////////
 
 } // namespace cutlass::conv::kernel
@@ -0,0 +1,686 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Template for a Winograd F(m x m, 3 x 3) fprop kernel using Tensor Core MMAs.
+
+    A unit-stride 3x3 fprop is decomposed into output tiles of m x m pixels. In the Winograd domain
+    the convolution of every output tile becomes alpha^2 = (m + 2)^2 independent GEMMs
+
+      M[xi](tile, k) = sum_c V[xi](tile, c) * U[xi](c, k)
+
+    where V = B^T d B is the transformed input tile and U = G g G^T the transformed filter.
+
+    WinogradFilterTransform computes U once per run into the workspace. WinogradConvolution then
+    computes a ThreadblockShape::kM (output tiles) x ThreadblockShape::kN (output channels) block of
+    all alpha^2 GEMMs per threadblock. Each iteration over ThreadblockShape::kK input channels
+    transforms the input tiles into shared memory while the matching U slice streams in with
+    cp.async, then issues the MMAs of all alpha^2 GEMMs. Every thread holds the accumulators of the
+    same (tile, k) coordinates for all alpha^2 GEMMs, so the output transform Y = A^T M A and the
+    linear combination epilogue run in registers without another pass through shared memory.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+
+#include "cutlass/aligned_buffer.h"
+#include "cutlass/array.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/tensor_ref.h"
+#include "cutlass/layout/matrix.h"
+#include "cutlass/layout/tensor.h"
+#include "cutlass/arch/memory_sm80.h"
+#include "cutlass/arch/mma.h"
+#include "cutlass/gemm/gemm.h"
+#include "cutlass/conv/convolution.h"
+#include "cutlass/conv/conv2d_problem_size.h"
+#include "cutlass/conv/thread/winograd_transform.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace conv {
+namespace kernel {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Transforms a KRSC 3x3 filter into the Winograd domain. The transformed filter is stored as
+/// U[xi][k][c] with k and c zero-padded to multiples of the threadblock tile of the fprop kernel.
+template <
+  typename ElementB_,                             ///! Element type of the filter
+  typename LayoutB_,                              ///! Layout of the filter (KRSC)
+  int OutputTile                                  ///! m of F(m x m, 3 x 3)
+>
+struct WinogradFilterTransform {
+
+  using ElementB = ElementB_;
+  using LayoutB = LayoutB_;
+  using Transform = thread::WinogradTransform<OutputTile>;
+
+  static int const kFilterSize = Transform::kFilterSize;
+  static int const kTileElements = Transform::kTileElements;
+  static int const kThreadCount = 128;
+
+  struct Params {
+    ElementB const *ptr_B;
+    LayoutB layout_B;
+    ElementB *ptr_U;
+    int K;
+    int C;
+    int padded_K;
+    int padded_C;
+    Mode mode;
+  };
+
+  struct SharedStorage { };
+
+  /// Transforms the filter of one (k, c) pair per thread
+  CUTLASS_DEVICE
+  void operator()(Params const &params, SharedStorage &shared_storage) {
+
+    int64_t idx = int64_t(blockIdx.x) * kThreadCount + threadIdx.x;
+    int64_t plane_size = int64_t(params.padded_K) * params.padded_C;
+    if (idx >= plane_size) {
+      return;
+    }
+
+    int k = int(idx / params.padded_C);
+    int c = int(idx % params.padded_C);
+
+    float g[kFilterSize * kFilterSize];
+    CUTLASS_PRAGMA_UNROLL
+    for (int rs = 0; rs < kFilterSize * kFilterSize; ++rs) {
+      g[rs] = 0.f;
+    }
+
+    if (k < params.K && c < params.C) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int r = 0; r < kFilterSize; ++r) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int s = 0; s < kFilterSize; ++s) {
+          // Convolution (as opposed to cross-correlation) rotates the filter by 180 degrees
+          int filter_r = (params.mode == Mode::kConvolution) ? kFilterSize - 1 - r : r;
+          int filter_s = (params.mode == Mode::kConvolution) ? kFilterSize - 1 - s : s;
+          g[r * kFilterSize + s] = float(params.ptr_B[params.layout_B(typename LayoutB::TensorCoord(k, filter_r, filter_s, c))]);
+        }
+      }
+    }
+
+    float u[kTileElements];
+    Transform::filter(g, u);
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int xi = 0; xi < kTileElements; ++xi) {
+      params.ptr_U[xi * plane_size + idx] = ElementB(u[xi]);
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <
+  typename ElementA_,                             ///! Element type of the activation tensor
+  typename ElementB_,                             ///! Element type of the filter tensor
+  typename ElementAccumulator_,                   ///! Element type of the accumulators
+  typename EpilogueOutputOp_,                     ///! Epilogue output operator
+  typename ArchTag_,                              ///! Architecture tag
+  typename ThreadblockShape_,                     ///! (output tiles, output channels, input channels) per threadblock
+  typename WarpShape_,                            ///! (output tiles, output channels, input channels) per warp
+  typename InstructionShape_,                     ///! Tensor Core instruction shape
+  int OutputTile,                                 ///! m of F(m x m, 3 x 3)
+  int AccessSize,                                 ///! Input channels per activation access
+  typename MathOperator_ = arch::OpMultiplyAdd    ///! Math operator of the Tensor Core instruction
+>
+struct WinogradConvolution {
+
+  using EpilogueOutputOp = EpilogueOutputOp_;
+  static Operator const kConvolutionalOperator = Operator::kFprop;
+
+  using ElementA = ElementA_;
+  using LayoutA = layout::TensorNHWC;
+  using ElementB = ElementB_;
+  using LayoutB = layout::TensorNHWC;
+  using ElementC = typename EpilogueOutputOp::ElementOutput;
+  using LayoutC = layout::TensorNHWC;
+
+  using ElementAccumulator = ElementAccumulator_;
+  using ElementCompute = typename EpilogueOutputOp::ElementCompute;
+
+  using MathOperator = MathOperator_;
+  using OperatorClass = arch::OpClassTensorOp;
+  using ArchTag = ArchTag_;
+
+  using ThreadblockShape = ThreadblockShape_;
+  using WarpShape = WarpShape_;
+  using InstructionShape = InstructionShape_;
+
+  using ArchMmaOperator = arch::Mma<
+    InstructionShape, 32,
+    ElementA, layout::RowMajor,
+    ElementB, layout::ColumnMajor,
+    ElementAccumulator, layout::RowMajor,
+    MathOperator>;
+
+  static int const kStages = 1;
+  static int const kConvDim = 2;
+  static IteratorAlgorithm const kIteratorAlgorithm = IteratorAlgorithm::kWinograd;
+  static StrideSupport const kStrideSupport = StrideSupport::kUnity;
+  static GroupMode const kGroupMode = GroupMode::kNone;
+
+  /// Output C is NHWC: fprop selects the stride of the N*P*Q rows
+  static int const kTensorCStrideIdx = 0;
+
+  using Transform = thread::WinogradTransform<OutputTile>;
+  using FilterTransform = WinogradFilterTransform<ElementB, LayoutB, OutputTile>;
+
+  static int const kOutputTile = Transform::kOutputTile;
+  static int const kFilterSize = Transform::kFilterSize;
+  static int const kTileSize = Transform::kTileSize;
+  static int const kTileElements = Transform::kTileElements;
+
+  /// Warp count (concept: GemmShape)
+  using WarpCount = gemm::GemmShape<
+    ThreadblockShape::kM / WarpShape::kM,
+    ThreadblockShape::kN / WarpShape::kN,
+    1>;
+  static int const kThreadCount = 32 * WarpCount::kCount;
+
+  static_assert(ThreadblockShape::kK == WarpShape::kK,
+    "The input channels of a threadblock tile are not split across warps.");
+  static_assert(!(ThreadblockShape::kM % WarpShape::kM) && !(ThreadblockShape::kN % WarpShape::kN),
+    "Warp shape must divide the threadblock shape.");
+  static_assert(InstructionShape::kM == 16 && InstructionShape::kN == 8 && InstructionShape::kK == 16 &&
+                sizeof_bits<ElementA>::value == 16 && sizeof_bits<ElementB>::value == 16,
+    "Winograd fprop requires the 16x8x16 Tensor Core instruction on 16-bit operands.");
+  static_assert(!(WarpShape::kM % InstructionShape::kM) && !(WarpShape::kN % InstructionShape::kN) &&
+                !(WarpShape::kK % InstructionShape::kK),
+    "Instruction shape must divide the warp shape.");
+  static_assert(EpilogueOutputOp::kCount == 1,
+    "Winograd fprop applies the epilogue to one output element at a time.");
+
+  static int const kMmaIterationsM = WarpShape::kM / InstructionShape::kM;
+  static int const kMmaIterationsN = WarpShape::kN / InstructionShape::kN;
+  static int const kMmaIterationsK = ThreadblockShape::kK / InstructionShape::kK;
+
+  /// Shared memory rows are padded by 16B so that MMA operand loads are free of bank conflicts
+  static int const kSmemStride = ThreadblockShape::kK + 128 / sizeof_bits<ElementA>::value;
+
+  /// Activation accesses: every thread transforms AccessSize channels of one output tile
+  static int const kAccessSize = AccessSize;
+  using AccessTypeA = AlignedArray<ElementA, kAccessSize>;
+  static_assert(!(ThreadblockShape::kK % kAccessSize), "Access size must divide the channel tile.");
+  static int const kAccessesPerTile = ThreadblockShape::kK / kAccessSize;
+  static int const kInputIterations =
+    (ThreadblockShape::kM * kAccessesPerTile + kThreadCount - 1) / kThreadCount;
+
+  /// Transformed filter accesses: 16B cp.async from the padded workspace
+  static int const kFilterAccessSize = 128 / sizeof_bits<ElementB>::value;
+  static int const kFilterAccessesPerRow = ThreadblockShape::kK / kFilterAccessSize;
+  static int const kFilterAccesses = kTileElements * ThreadblockShape::kN * kFilterAccessesPerRow;
+  static int const kFilterIterations = (kFilterAccesses + kThreadCount - 1) / kThreadCount;
+
+  using TensorRefA = TensorRef<ElementA const, LayoutA>;
+  using TensorRefB = TensorRef<ElementB const, LayoutB>;
+  using TensorRefC = TensorRef<ElementC, LayoutC>;
+
+  using ConvProblemSize = Conv2dProblemSize;
+
+  /// Argument structure
+  struct Arguments {
+
+    //
+    // Data members
+    //
+
+    ConvProblemSize problem_size;
+    TensorRefA ref_A;
+    TensorRefB ref_B;
+    TensorRefC ref_C;
+    TensorRefC ref_D;
+    typename EpilogueOutputOp::Params output_op;
+    SplitKMode split_k_mode;
+
+    //
+    // Methods
+    //
+
+    /// Default ctor
+    CUTLASS_HOST_DEVICE
+    Arguments() { }
+
+    CUTLASS_HOST_DEVICE
+    Arguments(
+      ConvProblemSize const & problem_size
+    ):
+      problem_size(problem_size) { }
+
+    CUTLASS_HOST_DEVICE
+    Arguments(
+      ConvProblemSize const & problem_size,
+      TensorRefA const & ref_A,
+      TensorRefB const & ref_B,
+      TensorRefC const & ref_C,
+      TensorRefC const & ref_D,
+      typename EpilogueOutputOp::Params const & output_op,
+      SplitKMode const & split_k_mode = SplitKMode::kSerial
+    ):
+      problem_size(problem_size),
+      ref_A(ref_A),
+      ref_B(ref_B),
+      ref_C(ref_C),
+      ref_D(ref_D),
+      output_op(output_op),
+      split_k_mode(split_k_mode)
+    {
+
+    }
+
+  };
+
+  /// Parameters structure
+  struct Params {
+    ConvProblemSize problem_size;
+    int tile_count;
+    FastDivmod tiles_per_image_divmod;
+    FastDivmod tiles_w_divmod;
+    int padded_K;
+    int padded_C;
+    int channel_iterations;
+    ElementA const *ptr_A;
+    LayoutA layout_A;
+    ElementB const *ptr_B;
+    LayoutB layout_B;
+    ElementB *ptr_U;
+    ElementC *ptr_C;
+    LayoutC layout_C;
+    ElementC *ptr_D;
+    LayoutC layout_D;
+    typename EpilogueOutputOp::Params output_op;
+
+    //
+    // Methods
+    //
+
+    CUTLASS_HOST_DEVICE
+    Params(): tile_count(0), padded_K(0), padded_C(0), channel_iterations(0) { }
+
+    CUTLASS_HOST_DEVICE
+    Params(
+      Arguments const &args,
+      ElementB *workspace = nullptr
+    ):
+      problem_size(args.problem_size),
+      padded_K(get_padded_K(args.problem_size)),
+      padded_C(get_padded_C(args.problem_size)),
+      ptr_A(args.ref_A.data()),
+      layout_A(args.ref_A.layout()),
+      ptr_B(args.ref_B.data()),
+      layout_B(args.ref_B.layout()),
+      ptr_U(workspace),
+      ptr_C(args.ref_C.data()),
+      layout_C(args.ref_C.layout()),
+      ptr_D(args.ref_D.data()),
+      layout_D(args.ref_D.layout()),
+      output_op(args.output_op)
+    {
+      int tiles_h = (args.problem_size.P + kOutputTile - 1) / kOutputTile;
+      int tiles_w = (args.problem_size.Q + kOutputTile - 1) / kOutputTile;
+      tile_count = args.problem_size.N * tiles_h * tiles_w;
+      tiles_per_image_divmod = FastDivmod(tiles_h * tiles_w);
+      tiles_w_divmod = FastDivmod(tiles_w);
+      channel_iterations = padded_C / ThreadblockShape::kK;
+    }
+  };
+
+  /// Shared memory storage structure
+  struct SharedStorage {
+    AlignedBuffer<ElementA, kTileElements * ThreadblockShape::kM * kSmemStride> operand_V;
+    AlignedBuffer<ElementB, kTileElements * ThreadblockShape::kN * kSmemStride> operand_U;
+  };
+
+  //
+  // Host-side helpers
+  //
+
+  /// Output channels of the transformed filter, padded to the threadblock tile
+  CUTLASS_HOST_DEVICE
+  static int get_padded_K(ConvProblemSize const &problem_size) {
+    return (problem_size.K + ThreadblockShape::kN - 1) / ThreadblockShape::kN * ThreadblockShape::kN;
+  }
+
+  /// Input channels of the transformed filter, padded to the threadblock tile
+  CUTLASS_HOST_DEVICE
+  static int get_padded_C(ConvProblemSize const &problem_size) {
+    return (problem_size.C + ThreadblockShape::kK - 1) / ThreadblockShape::kK * ThreadblockShape::kK;
+  }
+
+  /// Bytes of the transformed filter
+  static size_t get_workspace_size(ConvProblemSize const &problem_size) {
+    return size_t(kTileElements) * size_t(get_padded_K(problem_size)) * size_t(get_padded_C(problem_size)) *
+           sizeof_bits<ElementB>::value / 8;
+  }
+
+  /// Output tiles along grid.x and output channel tiles along grid.y
+  static dim3 get_grid_shape(Params const &params) {
+    return dim3(
+      (params.tile_count + ThreadblockShape::kM - 1) / ThreadblockShape::kM,
+      params.padded_K / ThreadblockShape::kN,
+      1);
+  }
+
+  /// Parameters of the filter transform that fills the workspace consumed by this kernel
+  static typename FilterTransform::Params get_filter_transform_params(Params const &params) {
+    return typename FilterTransform::Params{
+      params.ptr_B,
+      params.layout_B,
+      params.ptr_U,
+      params.problem_size.K,
+      params.problem_size.C,
+      params.padded_K,
+      params.padded_C,
+      params.problem_size.mode
+    };
+  }
+
+  static dim3 get_filter_transform_grid_shape(Params const &params) {
+    int64_t plane_size = int64_t(params.padded_K) * params.padded_C;
+    return dim3(int((plane_size + FilterTransform::kThreadCount - 1) / FilterTransform::kThreadCount), 1, 1);
+  }
+
+  //
+  // Methods
+  //
+
+  CUTLASS_HOST_DEVICE
+  WinogradConvolution() { }
+
+  /// Executes one Winograd fprop
+  CUTLASS_DEVICE
+  void operator()(Params const &params, SharedStorage &shared_storage) {
+
+    int thread_idx = threadIdx.x;
+    int warp_idx = canonical_warp_idx_sync();
+    int lane_idx = threadIdx.x % 32;
+
+    int tile_offset = int(blockIdx.x) * ThreadblockShape::kM;
+    int k_offset = int(blockIdx.y) * ThreadblockShape::kN;
+
+    int warp_m = warp_idx % WarpCount::kM;
+    int warp_n = warp_idx / WarpCount::kM;
+
+    ElementA *smem_V = shared_storage.operand_V.data();
+    ElementB *smem_U = shared_storage.operand_U.data();
+
+    //
+    // Origins of the input tiles transformed by this thread
+    //
+
+    int input_n[kInputIterations];
+    int input_h[kInputIterations];
+    int input_w[kInputIterations];
+    bool input_valid[kInputIterations];
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int it = 0; it < kInputIterations; ++it) {
+      int access_idx = thread_idx + it * kThreadCount;
+      int tile = tile_offset + access_idx / kAccessesPerTile;
+      input_valid[it] = access_idx < ThreadblockShape::kM * kAccessesPerTile && tile < params.tile_count;
+
+      int residual, th, tw;
+      params.tiles_per_image_divmod(input_n[it], residual, tile);
+      params.tiles_w_divmod(th, tw, residual);
+      input_h[it] = th * kOutputTile - params.problem_size.pad_h;
+      input_w[it] = tw * kOutputTile - params.problem_size.pad_w;
+    }
+
+    //
+    // Mainloop
+    //
+
+    using FragmentA = typename ArchMmaOperator::FragmentA;
+    using FragmentB = typename ArchMmaOperator::FragmentB;
+    using FragmentC = typename ArchMmaOperator::FragmentC;
+
+    FragmentC accum[kTileElements][kMmaIterationsM][kMmaIterationsN];
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int xi = 0; xi < kTileElements; ++xi) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int mma_m = 0; mma_m < kMmaIterationsM; ++mma_m) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int mma_n = 0; mma_n < kMmaIterationsN; ++mma_n) {
+          accum[xi][mma_m][mma_n].clear();
+        }
+      }
+    }
+
+    ArchMmaOperator mma;
+
+    for (int channel_iter = 0; channel_iter < params.channel_iterations; ++channel_iter) {
+
+      int c_offset = channel_iter * ThreadblockShape::kK;
+
+      // Stream the transformed filter of this channel tile into shared memory
+      CUTLASS_PRAGMA_UNROLL
+      for (int it = 0; it < kFilterIterations; ++it) {
+        int access_idx = thread_idx + it * kThreadCount;
+        if (access_idx < kFilterAccesses) {
+          int xi = access_idx / (ThreadblockShape::kN * kFilterAccessesPerRow);
+          int residual = access_idx % (ThreadblockShape::kN * kFilterAccessesPerRow);
+          int row = residual / kFilterAccessesPerRow;
+          int column = (residual % kFilterAccessesPerRow) * kFilterAccessSize;
+
+          ElementB const *gmem_ptr = params.ptr_U +
+            (int64_t(xi) * params.padded_K + k_offset + row) * params.padded_C + c_offset + column;
+          ElementB *smem_ptr = smem_U + (xi * ThreadblockShape::kN + row) * kSmemStride + column;
+
+          arch::cp_async<16, arch::CacheOperation::Global>(smem_ptr, gmem_ptr);
+        }
+      }
+      arch::cp_async_fence();
+
+      // Load and transform the input tiles of this channel tile into shared memory
+      CUTLASS_PRAGMA_UNROLL
+      for (int it = 0; it < kInputIterations; ++it) {
+        int access_idx = thread_idx + it * kThreadCount;
+        if (access_idx < ThreadblockShape::kM * kAccessesPerTile) {
+          int tile = access_idx / kAccessesPerTile;
+          int column = (access_idx % kAccessesPerTile) * kAccessSize;
+          int c = c_offset + column;
+
+          AccessTypeA patch[kTileElements];
+
+          CUTLASS_PRAGMA_UNROLL
+          for (int i = 0; i < kTileSize; ++i) {
+            CUTLASS_PRAGMA_UNROLL
+            for (int j = 0; j < kTileSize; ++j) {
+              int h = input_h[it] + i;
+              int w = input_w[it] + j;
+              bool guard = input_valid[it] && c < params.problem_size.C &&
+                           h >= 0 && h < params.problem_size.H && w >= 0 && w < params.problem_size.W;
+              if (guard) {
+                patch[i * kTileSize + j] = *reinterpret_cast<AccessTypeA const *>(
+                  params.ptr_A + params.layout_A(typename LayoutA::TensorCoord(input_n[it], h, w, c)));
+              }
+              else {
+                patch[i * kTileSize + j].clear();
+              }
+            }
+          }
+
+          CUTLASS_PRAGMA_UNROLL
+          for (int v = 0; v < kAccessSize; ++v) {
+            float d[kTileElements];
+            float transformed[kTileElements];
+            CUTLASS_PRAGMA_UNROLL
+            for (int xi = 0; xi < kTileElements; ++xi) {
+              d[xi] = float(patch[xi][v]);
+            }
+            Transform::input(d, transformed);
+            CUTLASS_PRAGMA_UNROLL
+            for (int xi = 0; xi < kTileElements; ++xi) {
+              patch[xi][v] = ElementA(transformed[xi]);
+            }
+          }
+
+          CUTLASS_PRAGMA_UNROLL
+          for (int xi = 0; xi < kTileElements; ++xi) {
+            *reinterpret_cast<AccessTypeA *>(smem_V + (xi * ThreadblockShape::kM + tile) * kSmemStride + column) =
+              patch[xi];
+          }
+        }
+      }
+
+      arch::cp_async_wait<0>();
+      __syncthreads();
+
+      // MMAs of all transformed positions
+      int lane_row = lane_idx / 4;
+      int lane_column = (lane_idx % 4) * 2;
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int xi = 0; xi < kTileElements; ++xi) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int mma_k = 0; mma_k < kMmaIterationsK; ++mma_k) {
+
+          FragmentA frag_A[kMmaIterationsM];
+          FragmentB frag_B[kMmaIterationsN];
+
+          int column = mma_k * InstructionShape::kK + lane_column;
+
+          CUTLASS_PRAGMA_UNROLL
+          for (int mma_m = 0; mma_m < kMmaIterationsM; ++mma_m) {
+            int row = warp_m * WarpShape::kM + mma_m * InstructionShape::kM + lane_row;
+            ElementA const *ptr = smem_V + (xi * ThreadblockShape::kM + row) * kSmemStride + column;
+            uint32_t *frag = reinterpret_cast<uint32_t *>(&frag_A[mma_m]);
+            frag[0] = *reinterpret_cast<uint32_t const *>(ptr);
+            frag[1] = *reinterpret_cast<uint32_t const *>(ptr + 8 * kSmemStride);
+            frag[2] = *reinterpret_cast<uint32_t const *>(ptr + 8);
+            frag[3] = *reinterpret_cast<uint32_t const *>(ptr + 8 * kSmemStride + 8);
+          }
+
+          CUTLASS_PRAGMA_UNROLL
+          for (int mma_n = 0; mma_n < kMmaIterationsN; ++mma_n) {
+            int row = warp_n * WarpShape::kN + mma_n * InstructionShape::kN + lane_row;
+            ElementB const *ptr = smem_U + (xi * ThreadblockShape::kN + row) * kSmemStride + column;
+            uint32_t *frag = reinterpret_cast<uint32_t *>(&frag_B[mma_n]);
+            frag[0] = *reinterpret_cast<uint32_t const *>(ptr);
+            frag[1] = *reinterpret_cast<uint32_t const *>(ptr + 8);
+          }
+
+          CUTLASS_PRAGMA_UNROLL
+          for (int mma_m = 0; mma_m < kMmaIterationsM; ++mma_m) {
+            CUTLASS_PRAGMA_UNROLL
+            for (int mma_n = 0; mma_n < kMmaIterationsN; ++mma_n) {
+              mma(accum[xi][mma_m][mma_n], frag_A[mma_m], frag_B[mma_n], accum[xi][mma_m][mma_n]);
+            }
+          }
+        }
+      }
+
+      __syncthreads();
+    }
+
+    //
+    // Output transform and epilogue
+    //
+
+    EpilogueOutputOp output_op(params.output_op);
+    bool source_needed = output_op.is_source_needed();
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int mma_m = 0; mma_m < kMmaIterationsM; ++mma_m) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int mma_n = 0; mma_n < kMmaIterationsN; ++mma_n) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int idx = 0; idx < FragmentC::kElements; ++idx) {
+
+          // The 16x8 accumulator tile of each thread holds (row, column) and (row + 8, column) pairs
+          int tile = tile_offset + warp_m * WarpShape::kM + mma_m * InstructionShape::kM +
+                     lane_idx / 4 + (idx / 2) * 8;
+          int k = k_offset + warp_n * WarpShape::kN + mma_n * InstructionShape::kN +
+                  (lane_idx % 4) * 2 + (idx % 2);
+
+          if (tile >= params.tile_count || k >= params.problem_size.K) {
+            continue;
+          }
+
+          int n, residual, th, tw;
+          params.tiles_per_image_divmod(n, residual, tile);
+          params.tiles_w_divmod(th, tw, residual);
+
+          float m[kTileElements];
+          float y[kOutputTile * kOutputTile];
+          CUTLASS_PRAGMA_UNROLL
+          for (int xi = 0; xi < kTileElements; ++xi) {
+            m[xi] = float(accum[xi][mma_m][mma_n][idx]);
+          }
+          Transform::output(m, y);
+
+          CUTLASS_PRAGMA_UNROLL
+          for (int i = 0; i < kOutputTile; ++i) {
+            CUTLASS_PRAGMA_UNROLL
+            for (int j = 0; j < kOutputTile; ++j) {
+              int p = th * kOutputTile + i;
+              int q = tw * kOutputTile + j;
+              if (p < params.problem_size.P && q < params.problem_size.Q) {
+                typename LayoutC::TensorCoord coord(n, p, q, k);
+
+                typename EpilogueOutputOp::FragmentAccumulator frag_accum;
+                frag_accum[0] = ElementAccumulator(y[i * kOutputTile + j]);
+
+                typename EpilogueOutputOp::FragmentOutput frag_output;
+                if (source_needed) {
+                  typename EpilogueOutputOp::FragmentSource frag_source;
+                  frag_source[0] = params.ptr_C[params.layout_C(coord)];
+                  frag_output = output_op(frag_accum, frag_source);
+                }
+                else {
+                  frag_output = output_op(frag_accum);
+                }
+                params.ptr_D[params.layout_D(coord)] = frag_output[0];
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace kernel
+} // namespace conv
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,219 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Winograd minimal filtering transforms F(m x m, 3 x 3) used by the Winograd fprop kernels.
+
+    The transforms follow Lavin and Gray, "Fast Algorithms for Convolutional Neural Networks". With
+    alpha = m + 2, a unit-stride 3x3 cross-correlation of an alpha x alpha input tile d with the
+    filter g computes an m x m output tile
+
+      Y = A^T [ (G g G^T) .* (B^T d B) ] A
+
+    Each 2-D transform is applied as the 1-D transform of the columns followed by the 1-D transform
+    of the rows, with the matrices expanded into adds so that no constant tables reach device code.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace conv {
+namespace thread {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// 1-D Winograd transforms of F(OutputTile, 3)
+template <int OutputTile>
+struct WinogradTransform1d;
+
+/// F(2, 3)
+template <>
+struct WinogradTransform1d<2> {
+
+  static int const kOutputTile = 2;
+  static int const kFilterSize = 3;
+  static int const kTileSize = kOutputTile + kFilterSize - 1;
+
+  /// t = B^T d
+  template <typename T>
+  CUTLASS_HOST_DEVICE
+  static void input(T const *d, int d_stride, T *t, int t_stride) {
+    T d0 = d[0], d1 = d[d_stride], d2 = d[2 * d_stride], d3 = d[3 * d_stride];
+    t[0]            = d0 - d2;
+    t[t_stride]     = d1 + d2;
+    t[2 * t_stride] = d2 - d1;
+    t[3 * t_stride] = d1 - d3;
+  }
+
+  /// u = G g
+  template <typename T>
+  CUTLASS_HOST_DEVICE
+  static void filter(T const *g, int g_stride, T *u, int u_stride) {
+    T g0 = g[0], g1 = g[g_stride], g2 = g[2 * g_stride];
+    T half = T(0.5f);
+    u[0]            = g0;
+    u[u_stride]     = half * (g0 + g1 + g2);
+    u[2 * u_stride] = half * (g0 - g1 + g2);
+    u[3 * u_stride] = g2;
+  }
+
+  /// y = A^T m
+  template <typename T>
+  CUTLASS_HOST_DEVICE
+  static void output(T const *m, int m_stride, T *y, int y_stride) {
+    T m0 = m[0], m1 = m[m_stride], m2 = m[2 * m_stride], m3 = m[3 * m_stride];
+    y[0]        = m0 + m1 + m2;
+    y[y_stride] = m1 - m2 - m3;
+  }
+};
+
+/// F(4, 3)
+template <>
+struct WinogradTransform1d<4> {
+
+  static int const kOutputTile = 4;
+  static int const kFilterSize = 3;
+  static int const kTileSize = kOutputTile + kFilterSize - 1;
+
+  /// t = B^T d
+  template <typename T>
+  CUTLASS_HOST_DEVICE
+  static void input(T const *d, int d_stride, T *t, int t_stride) {
+    T d0 = d[0], d1 = d[d_stride], d2 = d[2 * d_stride];
+    T d3 = d[3 * d_stride], d4 = d[4 * d_stride], d5 = d[5 * d_stride];
+    T four = T(4), five = T(5), two = T(2);
+    t[0]            = four * d0 - five * d2 + d4;
+    t[t_stride]     = d3 + d4 - four * (d1 + d2);
+    t[2 * t_stride] = d4 - d3 + four * (d1 - d2);
+    t[3 * t_stride] = d4 - d2 + two * (d3 - d1);
+    t[4 * t_stride] = d4 - d2 + two * (d1 - d3);
+    t[5 * t_stride] = four * d1 - five * d3 + d5;
+  }
+
+  /// u = G g
+  template <typename T>
+  CUTLASS_HOST_DEVICE
+  static void filter(T const *g, int g_stride, T *u, int u_stride) {
+    T g0 = g[0], g1 = g[g_stride], g2 = g[2 * g_stride];
+    u[0]            = g0 * T(1.0f / 4.0f);
+    u[u_stride]     = (g0 + g1 + g2) * T(-1.0f / 6.0f);
+    u[2 * u_stride] = (g0 - g1 + g2) * T(-1.0f / 6.0f);
+    u[3 * u_stride] = g0 * T(1.0f / 24.0f) + g1 * T(1.0f / 12.0f) + g2 * T(1.0f / 6.0f);
+    u[4 * u_stride] = g0 * T(1.0f / 24.0f) - g1 * T(1.0f / 12.0f) + g2 * T(1.0f / 6.0f);
+    u[5 * u_stride] = g2;
+  }
+
+  /// y = A^T m
+  template <typename T>
+  CUTLASS_HOST_DEVICE
+  static void output(T const *m, int m_stride, T *y, int y_stride) {
+    T m0 = m[0], m1 = m[m_stride], m2 = m[2 * m_stride];
+    T m3 = m[3 * m_stride], m4 = m[4 * m_stride], m5 = m[5 * m_stride];
+    T sum12 = m1 + m2, diff12 = m1 - m2;
+    T sum34 = m3 + m4, diff34 = m3 - m4;
+    y[0]            = m0 + sum12 + sum34;
+    y[y_stride]     = diff12 + T(2) * diff34;
+    y[2 * y_stride] = sum12 + T(4) * sum34;
+    y[3 * y_stride] = diff12 + T(8) * diff34 + m5;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// 2-D Winograd transforms of F(OutputTile x OutputTile, 3 x 3) on row-major tiles
+template <int OutputTile>
+struct WinogradTransform {
+
+  using Transform1d = WinogradTransform1d<OutputTile>;
+
+  static int const kOutputTile = Transform1d::kOutputTile;
+  static int const kFilterSize = Transform1d::kFilterSize;
+  static int const kTileSize = Transform1d::kTileSize;
+
+  /// Number of elements of a transformed tile, i.e. the number of independent GEMMs
+  static int const kTileElements = kTileSize * kTileSize;
+
+  /// V = B^T d B, with d and V being kTileSize x kTileSize
+  template <typename T>
+  CUTLASS_HOST_DEVICE
+  static void input(T const (&d)[kTileElements], T (&v)[kTileElements]) {
+    T t[kTileElements];
+    CUTLASS_PRAGMA_UNROLL
+    for (int col = 0; col < kTileSize; ++col) {
+      Transform1d::input(d + col, kTileSize, t + col, kTileSize);
+    }
+    CUTLASS_PRAGMA_UNROLL
+    for (int row = 0; row < kTileSize; ++row) {
+      Transform1d::input(t + row * kTileSize, 1, v + row * kTileSize, 1);
+    }
+  }
+
+  /// U = G g G^T, with g being kFilterSize x kFilterSize and U being kTileSize x kTileSize
+  template <typename T>
+  CUTLASS_HOST_DEVICE
+  static void filter(T const (&g)[kFilterSize * kFilterSize], T (&u)[kTileElements]) {
+    T t[kTileSize * kFilterSize];
+    CUTLASS_PRAGMA_UNROLL
+    for (int col = 0; col < kFilterSize; ++col) {
+      Transform1d::filter(g + col, kFilterSize, t + col, kFilterSize);
+    }
+    CUTLASS_PRAGMA_UNROLL
+    for (int row = 0; row < kTileSize; ++row) {
+      Transform1d::filter(t + row * kFilterSize, 1, u + row * kTileSize, 1);
+    }
+  }
+
+  /// Y = A^T M A, with M being kTileSize x kTileSize and Y being kOutputTile x kOutputTile
+  template <typename T>
+  CUTLASS_HOST_DEVICE
+  static void output(T const (&m)[kTileElements], T (&y)[kOutputTile * kOutputTile]) {
+    T t[kOutputTile * kTileSize];
+    CUTLASS_PRAGMA_UNROLL
+    for (int col = 0; col < kTileSize; ++col) {
+      Transform1d::output(m + col, kTileSize, t + col, kTileSize);
+    }
+    CUTLASS_PRAGMA_UNROLL
+    for (int row = 0; row < kOutputTile; ++row) {
+      Transform1d::output(t + row * kTileSize, 1, y + row * kOutputTile, 1);
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace thread
+} // namespace conv
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
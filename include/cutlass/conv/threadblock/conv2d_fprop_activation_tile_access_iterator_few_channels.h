@@ -33,6 +33,8 @@
     matrix from memory.
 
     This iterator assumes TensorNHWC or TensorNCxHWx<Interleave> layout of tensors in Global Memory.
+    Fprop activations may also be read directly from a TensorNCHW tensor, in which case each access
+    covers a single channel and channels beyond C are zero-filled by the predicates.
 
     The iterator is specialized for each of the three convolution operators: forward propagation (Fprop),
     backward data gradient (Dgrad), and backward weight gradient (Wgrad).
@@ -106,6 +108,9 @@ public:
   static_assert(!(ThreadMap::kElementsPerAccess % AccessType::kElements),
     "Vectors implied by the thread map must be divisible by the access type.");
 
+  static_assert(!platform::is_same<Layout, layout::TensorNCHW>::value || AccessType::kElements == 1,
+    "NCHW activations are not contiguous along C and require single-element accesses.");
+
   //
   // Simplifying assertions
   //
@@ -279,7 +284,7 @@ public:
       coord.n() * params_.stride_n +
       coord.h() * params_.stride_h +
       coord.w() * params_.stride_w +
-      coord.c();
+      coord.c() * params_.stride_c;
 
     AccessType const *ptr = reinterpret_cast<AccessType const *>(pointer_ + offset * sizeof_bits<Element>::value / 8);
 
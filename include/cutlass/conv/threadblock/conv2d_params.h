@@ -89,6 +89,8 @@ struct Conv2dFewChannelsParams {
 
   using Layout = Layout_;
 
+  /// Channels are contiguous in memory
+  static int32_t const stride_c = 1;
 
   int32_t stride_w;
   int32_t stride_h;
@@ -123,6 +125,49 @@ struct Conv2dFewChannelsParams {
   }
 };
 
+/// Params structure used by the few channels activation iterator to read NCHW tensors directly.
+/// Channels are strided by H * W, so every access covers a single element.
+template <>
+struct Conv2dFewChannelsParams<layout::TensorNCHW> {
+
+  using Layout = layout::TensorNCHW;
+
+  /// Pixels along W are contiguous in memory
+  static int32_t const stride_w = 1;
+
+  int32_t stride_h;
+  int32_t stride_c;
+  int32_t stride_n;
+
+  FastDivmod divmod_P;
+  FastDivmod divmod_Q;
+  FastDivmod divmod_S;
+  FastDivmod divmod_C;
+
+  //
+  // Methods
+  //
+
+  CUTLASS_HOST_DEVICE
+  Conv2dFewChannelsParams() { }
+
+  CUTLASS_HOST_DEVICE
+  Conv2dFewChannelsParams(
+    Conv2dProblemSize const &problem_size,
+    Layout const &layout
+  ):
+    stride_h(int32_t(layout.stride()[0])),
+    stride_c(int32_t(layout.stride()[1])),
+    stride_n(int32_t(layout.stride()[2])),
+    divmod_P(problem_size.P),
+    divmod_Q(problem_size.Q),
+    divmod_S(problem_size.S),
+    divmod_C(problem_size.C)
+  {
+
+  }
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// Parameters structure used for Conv2dDgradOutputGradientTileAccessIteratorAnalyticParams
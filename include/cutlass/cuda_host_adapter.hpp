@@ -153,6 +153,15 @@ CUTLASS_CUDA_DRIVER_WRAPPER_DECL(cuTensorMapEncodeTiled, 12000);
 CUTLASS_CUDA_DRIVER_WRAPPER_DECL(cuTensorMapEncodeIm2col, 12000);
 #endif
 
+// Green contexts and their SM resources were introduced in CUDA 12.4
+#if (__CUDACC_VER_MAJOR__ > 12) || ((__CUDACC_VER_MAJOR__ == 12) && (__CUDACC_VER_MINOR__ >= 4))
+#define CUDA_HOST_ADAPTER_GREEN_CONTEXT_ENABLED
+CUTLASS_CUDA_DRIVER_WRAPPER_DECL(cuCtxGetCurrent, 4000);
+CUTLASS_CUDA_DRIVER_WRAPPER_DECL(cuCtxGetDevResource, 12040);
+CUTLASS_CUDA_DRIVER_WRAPPER_DECL(cuGreenCtxGetDevResource, 12040);
+CUTLASS_CUDA_DRIVER_WRAPPER_DECL(cuStreamGetGreenCtx, 12040);
+#endif
+
 #undef CUTLASS_CUDA_DRIVER_STRINGIFY
 
 #define CUTLASS_CUDA_DRIVER_WRAPPER_CALL(func) cutlass::call_##func
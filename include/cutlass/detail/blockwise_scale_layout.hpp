@@ -40,6 +40,7 @@
 #include "cutlass/layout/matrix.h"
 
 #include "cute/int_tuple.hpp"
+#include "cute/tensor.hpp"
 #include "cute/atom/mma_traits_sm100.hpp"
 #include "cute/arch/mma_sm90.hpp"
 
@@ -178,6 +179,68 @@ struct Sm1xxBlockwiseScaleConfig {
     return make_layout(append(shape(nk_layout), L), append(stride(nk_layout), size(filter_zeros(nk_layout))));
   }
 
+  // The following function fills layout_SFA for scale factors stored at the run-time granularity
+  // sf_vec_shape = (sfm, sfn, sfk), each a multiple of the compile-time SFVecSize of its mode.
+  // The extents and strides describe the coarser tensor; mainloops supporting run-time granularity
+  // take sf_vec_shape alongside the layout and still resolve scales at SFVecSize.
+  template <class ProblemShape, class SFVecShape>
+  CUTE_HOST_DEVICE
+  static constexpr auto
+  tile_atom_to_shape_SFA(ProblemShape problem_shape, SFVecShape sf_vec_shape) {
+    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+
+    auto strides = [&]() CUTLASS_LAMBDA_FUNC_INLINE {
+      auto [M, N, K, L] = problem_shape_MNKL;
+      auto [sfm, sfn, sfk] = sf_vec_shape;
+      if constexpr (majorSFA == UMMA::Major::MN) {
+        return make_stride(make_stride(_0{}, _1{}), make_stride(_0{}, cute::ceil_div(M, sfm)));
+      }
+      else {
+        return make_stride(make_stride(_0{}, cute::ceil_div(K, sfk)), make_stride(_0{}, _1{}));
+      }
+    }();
+
+    auto [M, N, K, L] = problem_shape_MNKL;
+    auto [sfm, sfn, sfk] = sf_vec_shape;
+    auto mk_layout = make_layout(
+      make_shape(make_shape(Int<SFVecSizeM>{}, cute::ceil_div(M, sfm)),
+                 make_shape(Int<SFVecSizeK>{}, cute::ceil_div(K, sfk))),
+      strides
+    );
+
+    return make_layout(append(shape(mk_layout), L), append(stride(mk_layout), size(filter_zeros(mk_layout))));
+  }
+
+  // The following function fills layout_SFB for scale factors stored at the run-time granularity
+  // sf_vec_shape = (sfm, sfn, sfk), see tile_atom_to_shape_SFA.
+  template <class ProblemShape, class SFVecShape>
+  CUTE_HOST_DEVICE
+  static constexpr auto
+  tile_atom_to_shape_SFB(ProblemShape problem_shape, SFVecShape sf_vec_shape) {
+    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+
+    auto strides = [&]() CUTLASS_LAMBDA_FUNC_INLINE {
+      auto [M, N, K, L] = problem_shape_MNKL;
+      auto [sfm, sfn, sfk] = sf_vec_shape;
+      if constexpr (majorSFB == UMMA::Major::MN) {
+        return make_stride(make_stride(_0{}, _1{}), make_stride(_0{}, cute::ceil_div(N, sfn)));
+      }
+      else {
+        return make_stride(make_stride(_0{}, cute::ceil_div(K, sfk)), make_stride(_0{}, _1{}));
+      }
+    }();
+
+    auto [M, N, K, L] = problem_shape_MNKL;
+    auto [sfm, sfn, sfk] = sf_vec_shape;
+    auto nk_layout = make_layout(
+      make_shape(make_shape(Int<SFVecSizeN>{}, cute::ceil_div(N, sfn)),
+                 make_shape(Int<SFVecSizeK>{}, cute::ceil_div(K, sfk))),
+      strides
+    );
+
+    return make_layout(append(shape(nk_layout), L), append(stride(nk_layout), size(filter_zeros(nk_layout))));
+  }
+
 };
 
 template<UMMA::Major majorSFA = UMMA::Major::MN, UMMA::Major majorSFB = UMMA::Major::MN>
@@ -300,6 +363,68 @@ constexpr auto sm120_trivial_blockwise_scale_config(MmaTileShape_MNK) {
   return Sm120BlockwiseScaleConfig<size<0>(MmaTileShape_MNK{}), size<1>(MmaTileShape_MNK{}), size<2>(MmaTileShape_MNK{})>{};
 }
 
+// Resolves the run-time scale granularity (sfm, sfn, sfk) passed to a blockwise scaling mainloop
+// whose scales are resolved at (SFVecSizeM, SFVecSizeN, SFVecSizeK): zeros select the compile-time
+// granularity of their mode.
+template<int SFVecSizeM, int SFVecSizeN, int SFVecSizeK, class SFVecShape>
+CUTE_HOST_DEVICE constexpr
+Shape<int32_t, int32_t, int32_t>
+resolve_blockwise_scale_granularity(SFVecShape sf_vec_shape) {
+  auto [sfm, sfn, sfk] = sf_vec_shape;
+  return make_shape(sfm > 0 ? int32_t(sfm) : SFVecSizeM,
+                    sfn > 0 ? int32_t(sfn) : SFVecSizeN,
+                    sfk > 0 ? int32_t(sfk) : SFVecSizeK);
+}
+
+// Whether a mainloop resolving scales at (SFVecSizeM, SFVecSizeN, SFVecSizeK) can serve scale factors
+// of the resolved run-time granularity sf_vec_shape: every mode must be a multiple of the compile-time one.
+template<int SFVecSizeM, int SFVecSizeN, int SFVecSizeK, class SFVecShape>
+CUTE_HOST_DEVICE constexpr
+bool
+is_blockwise_scale_granularity_supported(SFVecShape sf_vec_shape) {
+  auto [sfm, sfn, sfk] = sf_vec_shape;
+  return sfm % SFVecSizeM == 0 && sfn % SFVecSizeN == 0 && sfk % SFVecSizeK == 0;
+}
+
+// Copies one pipeline stage of scale factors stored at a run-time granularity (sf_mn, sf_k) into the
+// smem tile sSF of shape ((SFVecSizeMN,ScalesMN),(SFVecSizeK,ScalesK)). Entry (i,j) of the tile scales
+// the block at (mn_offset + i * SFVecSizeMN, k_offset + j * SFVecSizeK) and is copied from the scale
+// factor of layout_SF covering that block. Entries beyond the extents of layout_SF are left untouched.
+template<class CopyAtom, class ElementSF, class LayoutSF, class SmemTensorSF>
+CUTE_DEVICE
+void
+copy_blockwise_scales(
+    CopyAtom const& copy_atom,
+    ElementSF const* ptr_SF, LayoutSF const& layout_SF,
+    int sf_mn, int sf_k,
+    int mn_offset, int k_offset, int l_coord,
+    SmemTensorSF&& sSF,
+    int thread_idx, int num_threads) {
+  using SmemLayoutSF = typename remove_cvref_t<SmemTensorSF>::layout_type;
+  constexpr int SFVecSizeMN = size<0,0>(SmemLayoutSF{});
+  constexpr int SFVecSizeK = size<1,0>(SmemLayoutSF{});
+  constexpr int ScalesMN = size<0,1>(SmemLayoutSF{});
+  constexpr int ScalesK = size<1,1>(SmemLayoutSF{});
+
+  CUTLASS_PRAGMA_UNROLL
+  for (int j = 0; j < ScalesK; ++j) {
+    int k_sf = (k_offset + j * SFVecSizeK) / sf_k;
+    CUTLASS_PRAGMA_NO_UNROLL
+    for (int i = thread_idx; i < ScalesMN; i += num_threads) {
+      int mn_sf = (mn_offset + i * SFVecSizeMN) / sf_mn;
+      if (mn_sf < size<0,1>(layout_SF) && k_sf < size<1,1>(layout_SF)) {
+        Tensor gSF_ij = make_tensor(
+            make_gmem_ptr(ptr_SF + layout_SF(make_coord(make_coord(_0{}, mn_sf), make_coord(_0{}, k_sf), l_coord))),
+            Layout<_1>{});
+        Tensor sSF_ij = make_tensor(
+            sSF.data() + sSF.layout()(make_coord(make_coord(_0{}, i), make_coord(_0{}, j))),
+            Layout<_1>{});
+        copy(copy_atom, gSF_ij, sSF_ij);
+      }
+    }
+  }
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 } // namespace cutlass::detail
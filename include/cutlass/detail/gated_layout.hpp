@@ -0,0 +1,95 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Shapes and strides of gated (GLU) GEMMs, which compute the gate and up projections in one mainloop.
+
+    The sm90 gated kernels interleave the gate and up operands along M in groups of 8 rows, so that
+    every thread of a WGMMA accumulator holds matching gate and up values. This is expressed as an
+    (8,2,M/16) mode-0 in the problem shape, tile shape and strides of the gated operands.
+*/
+
+#pragma once
+
+#include "cute/layout.hpp"
+#include "cute/algorithm/tuple_algorithms.hpp"
+#include "cutlass/detail/layout.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+
+// Factors an (8,2) sub-mode out of mode ModeIndex of the input shape
+template <int ModeIndex, class InputShape>
+CUTLASS_HOST_DEVICE
+auto
+sm90_make_gated_shape(InputShape const& shape) {
+  using namespace cute;
+  using Tiler = Shape<_8,_2>;
+  return replace<ModeIndex>(shape, append(Tiler{}, shape_div(get<ModeIndex>(shape), Tiler{})));
+}
+
+// Factors an (8) sub-mode out of mode ModeIndex of the output shape
+template <int ModeIndex, class InputShape>
+CUTLASS_HOST_DEVICE
+auto
+sm90_make_gated_output_shape(InputShape const& shape) {
+  using namespace cute;
+  using Tiler = Shape<_8>;
+  return replace<ModeIndex>(shape, append(Tiler{}, shape_div(get<ModeIndex>(shape), Tiler{})));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// Stride of a gated operand, with an (8,2,M/16) mode ModeIndex
+template <int ModeIndex, class InputStride>
+using GatedStride = cute::conditional_t<
+  cutlass::detail::is_major<ModeIndex, InputStride>(),
+  decltype(cute::replace<ModeIndex>(InputStride{}, cute::Stride<cute::_1,int64_t,cute::_8>{})),
+  decltype(cute::replace<ModeIndex>(InputStride{}, cute::Stride< int64_t,int64_t, int64_t>{}))
+>;
+
+// Stride of a gated output, with an (8,M/16) mode ModeIndex
+template <int ModeIndex, class InputStride>
+using GatedOutputStride = cute::conditional_t<
+  cutlass::detail::is_major<ModeIndex, InputStride>(),
+  decltype(cute::replace<ModeIndex>(InputStride{}, cute::Stride<cute::_1,cute::_8>{})),
+  decltype(cute::replace<ModeIndex>(InputStride{}, cute::Stride< int64_t, int64_t>{}))
+>;
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,170 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Vectorized host-side bulk conversion between float and 16b / 8b floating-point types.
+
+    These routines convert contiguous arrays on the host. They are used by the host paths of
+    NumericArrayConverter and by the host reference TensorCopy. Every routine produces the same
+    bits as the corresponding scalar conversion in half.h, bfloat16.h and float8.h.
+*/
+
+#pragma once
+
+#if !defined(__CUDACC_RTC__)
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "cutlass/numeric_types.h"
+
+#ifndef CUTLASS_ENABLE_NEON
+#define CUTLASS_ENABLE_NEON 0
+#endif
+
+// NEON half-precision conversions are only targeted on AArch64 hosts.
+#if !defined(__CUDA_ARCH__) && CUTLASS_ENABLE_NEON && defined(__aarch64__)
+#include <arm_neon.h>
+#define CUTLASS_HOST_NEON_FP16_ENABLED 1
+#endif
+
+namespace cutlass {
+namespace detail {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// float => half_t, round to nearest even
+inline void host_convert_float_to_half_rn(half_t *dst, float const *src, size_t count) {
+  size_t i = 0;
+
+#if !defined(__CUDA_ARCH__) && CUTLASS_ENABLE_F16C
+  if (CpuId::instance().is_f16c_supported()) {
+    for (; i + 8 <= count; i += 8) {
+      __m256 v = _mm256_loadu_ps(src + i);
+      __m128i h = _mm256_cvtps_ph(v, F16C_ROUND_NEAREST);
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), h);
+    }
+  }
+#elif defined(CUTLASS_HOST_NEON_FP16_ENABLED)
+  for (; i + 4 <= count; i += 4) {
+    float16x4_t h = vcvt_f16_f32(vld1q_f32(src + i));
+    vst1_u16(reinterpret_cast<uint16_t *>(dst + i), vreinterpret_u16_f16(h));
+  }
+#endif
+
+  for (; i < count; ++i) {
+    dst[i] = half_t::convert(src[i]);
+  }
+}
+
+/// half_t => float
+inline void host_convert_half_to_float(float *dst, half_t const *src, size_t count) {
+  size_t i = 0;
+
+#if !defined(__CUDA_ARCH__) && CUTLASS_ENABLE_F16C
+  if (CpuId::instance().is_f16c_supported()) {
+    for (; i + 8 <= count; i += 8) {
+      __m128i h = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i));
+      _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+    }
+  }
+#elif defined(CUTLASS_HOST_NEON_FP16_ENABLED)
+  for (; i + 4 <= count; i += 4) {
+    float16x4_t h = vreinterpret_f16_u16(vld1_u16(reinterpret_cast<uint16_t const *>(src + i)));
+    vst1q_f32(dst + i, vcvt_f32_f16(h));
+  }
+#endif
+
+  for (; i < count; ++i) {
+    dst[i] = half_t::convert(src[i]);
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// float => bfloat16_t, round to nearest even.
+///
+/// Written as branch-free integer arithmetic so the loop auto-vectorizes on every host ISA. The
+/// AVX-512 BF16 instructions are deliberately not used since they flush denormals, which would
+/// diverge from bfloat16_t(float).
+inline void host_convert_float_to_bfloat16_rn(bfloat16_t *dst, float const *src, size_t count) {
+  uint32_t const *src_bits = reinterpret_cast<uint32_t const *>(src);
+  uint16_t *dst_bits = reinterpret_cast<uint16_t *>(dst);
+
+  for (size_t i = 0; i < count; ++i) {
+    uint32_t bits = src_bits[i];
+    bool is_inf_or_nan = (bits & 0x7f800000u) == 0x7f800000u;
+    bool is_nan = is_inf_or_nan && (bits & 0x007fffffu);
+    uint32_t rounded = bits + 0x7fffu + ((bits >> 16) & 1u);
+    uint32_t result = is_nan ? 0x7fffffffu : (is_inf_or_nan ? bits : rounded);
+    dst_bits[i] = uint16_t(result >> 16);
+  }
+}
+
+/// bfloat16_t => float
+inline void host_convert_bfloat16_to_float(float *dst, bfloat16_t const *src, size_t count) {
+  uint16_t const *src_bits = reinterpret_cast<uint16_t const *>(src);
+  uint32_t *dst_bits = reinterpret_cast<uint32_t *>(dst);
+
+  for (size_t i = 0; i < count; ++i) {
+    dst_bits[i] = uint32_t(src_bits[i]) << 16;
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// 8b floating-point => float through a 256-entry table built from the scalar conversion
+template <typename Float8>
+inline void host_convert_float8_to_float(float *dst, Float8 const *src, size_t count) {
+  static_assert(sizeof(Float8) == 1, "Expected an 8b floating-point type.");
+
+  struct Table {
+    float values[256];
+    Table() {
+      for (int i = 0; i < 256; ++i) {
+        values[i] = float(Float8::bitcast(uint8_t(i)));
+      }
+    }
+  };
+  static Table const table;
+
+  uint8_t const *src_bits = reinterpret_cast<uint8_t const *>(src);
+  for (size_t i = 0; i < count; ++i) {
+    dst[i] = table.values[src_bits[i]];
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace detail
+} // namespace cutlass
+
+#endif // !defined(__CUDACC_RTC__)
@@ -129,6 +129,56 @@ struct Sm100MixedInputBlockwiseScaleConfig {
 
 };
 
+// Scale layout for group-wise quantized weights whose group size along K is only known at runtime
+// (e.g. AWQ / GPTQ checkpoints). The MN granularity stays static. The mainloop requires the runtime
+// group size to be a multiple of the CTA tile K (or to equal K) and reloads one scale/zero column
+// per group.
+template<int SFVecSizeMN = 1, UMMA::Major majorSFA = UMMA::Major::MN>
+struct Sm100MixedInputRuntimeGroupScaleConfig {
+
+  using ShapeScale = Shape<Shape<Int<SFVecSizeMN>, int32_t>, Shape<int32_t, int32_t>, int32_t>;
+
+  using StrideScale = conditional_t<majorSFA == UMMA::Major::MN, 
+      Stride<Stride<_0,_1>,Stride<_0,int32_t>, int32_t>, 
+      Stride<Stride<_0,int32_t>,Stride<_0,_1>, int32_t>>;
+
+  using LayoutScale = Layout<ShapeScale, StrideScale>;
+
+  CUTE_HOST_DEVICE
+  static constexpr auto
+  deduce_layout_scale() {
+    return LayoutScale{};
+  }
+
+  // The following function is provided for user fill dynamic problem size and group size to the layout_S.
+  template <class ScaledInputDim>
+  CUTE_HOST_DEVICE
+  static constexpr auto 
+  tile_atom_to_shape_scale(ScaledInputDim scale_input_dims, int32_t group_size) {
+    const auto scale_input_dims_MNKL = append<3>(scale_input_dims, 1);
+
+    auto strides = [&]() CUTLASS_LAMBDA_FUNC_INLINE {
+      auto [MN, K, L] = scale_input_dims_MNKL;
+      if constexpr (majorSFA == UMMA::Major::MN) {
+        return make_stride(make_stride(_0{}, _1{}), make_stride(_0{}, int32_t(cute::ceil_div(MN, SFVecSizeMN))));
+      }
+      else {
+        return make_stride(make_stride(_0{}, int32_t(cute::ceil_div(K, group_size))), make_stride(_0{}, _1{}));
+      }
+    }();
+
+    auto [MN, K, L] = scale_input_dims_MNKL;
+    auto mk_layout = make_layout(
+      make_shape(make_shape(Int<SFVecSizeMN>{}, int32_t(cute::ceil_div(MN, SFVecSizeMN))),
+                 make_shape(group_size, int32_t(cute::ceil_div(K, group_size)))),
+      strides
+    );
+
+    return make_layout(append(shape(mk_layout), int32_t(L)), append(stride(mk_layout), int32_t(size(filter_zeros(mk_layout)))));
+  }
+
+};
+
 template<UMMA::Major majorScale = UMMA::Major::MN>
 struct RuntimeMixedInputBlockwiseScaleConfig {
 
@@ -51,6 +51,36 @@ static constexpr auto find_tmem_tensor_col_offset(TmemTensor tensor) {
   return cosize(recast<uint32_t>(tensor).layout()) & TmemColMask;
 }
 
+// Number of TMEM columns to allocate for tensors packed back to back from the allocation base:
+// their total column extent rounded up to a power of two of at least one 32-column slice.
+template <class... TmemTensors>
+CUTE_HOST_DEVICE
+static constexpr uint32_t tmem_allocation_columns(TmemTensors... tensors) {
+  uint32_t columns = (0u + ... + static_cast<uint32_t>(find_tmem_tensor_col_offset(tensors)));
+  uint32_t allocation = 32;
+  while (allocation < columns) {
+    allocation *= 2;
+  }
+  return allocation;
+}
+
+// TMEM columns a kernel allocates for its collective mainloop. Collectives that pack their TMEM tensors
+// from the allocation base expose the extent through tmem_allocation_columns<EpilogueTile, IsOverlappingAccum>(),
+// which lets a kernel hold only part of TMEM and a dependent grid allocate beside it on the same SM.
+// Other collectives conservatively hold the full capacity.
+template <class CollectiveMainloop, class EpilogueTile, bool IsOverlappingAccum, class = void>
+struct Sm100TmemAllocationColumns {
+  static constexpr uint32_t value = 512;
+};
+
+template <class CollectiveMainloop, class EpilogueTile, bool IsOverlappingAccum>
+struct Sm100TmemAllocationColumns<CollectiveMainloop, EpilogueTile, IsOverlappingAccum,
+    cute::void_t<decltype(CollectiveMainloop::template tmem_allocation_columns<EpilogueTile, IsOverlappingAccum>())>> {
+  static constexpr uint32_t value = CollectiveMainloop::template tmem_allocation_columns<EpilogueTile, IsOverlappingAccum>();
+  static_assert(value >= 32 && value <= 512 && (value & (value - 1)) == 0,
+    "TMEM allocations must be a power of two between 32 and 512 columns.");
+};
+
 template <int AccumulatorPipelineStageCount, bool IsOverlappingAccum,
           class TiledMma, class AccumulatorShape,
           class EpilogueTile>
@@ -859,7 +859,7 @@ struct CallbacksBuilder<
 > {
   using GmemStrideTypeAux = gemm::TagToStrideC_t<typename FusionOp::GmemLayoutTagAux>;
   using SmemLayoutAtomAux = decltype(detail::sm100_get_epilogue_smem_swizzle_layout_atom<
-    GmemStrideTypeAux, typename FusionOp::ElementAux, EpilogueTile_MN>());
+    GmemStrideTypeAux, typename FusionOp::ElementAux, fusion::get_aux_epilogue_tile_t<FusionOp, EpilogueTile_MN>>());
   using CopyOpR2S = decltype(detail::sm100_get_smem_store_op<
     GmemStrideTypeAux, typename FusionOp::ElementAux, ElementAccumulator, AccLoadOp>());
   using CopyOpS2R = decltype(detail::sm100_get_smem_load_op<
@@ -898,7 +898,7 @@ struct CallbacksBuilder<
 > {
   using GmemStrideTypeAux = gemm::TagToStrideC_t<typename FusionOp::GmemLayoutTagAux>;
   using SmemLayoutAtomAux = decltype(detail::sm100_get_epilogue_smem_swizzle_layout_atom<
-    GmemStrideTypeAux, typename FusionOp::ElementAux, EpilogueTile_MN>());
+    GmemStrideTypeAux, typename FusionOp::ElementAux, fusion::get_aux_epilogue_tile_t<FusionOp, EpilogueTile_MN>>());
   using CopyOpR2S = decltype(detail::sm100_get_smem_store_op<
     GmemStrideTypeAux, typename FusionOp::ElementAux, ElementAccumulator, AccLoadOp>());
   using CopyOpS2R = decltype(detail::sm100_get_smem_load_op<
@@ -1042,7 +1042,10 @@ sm100_dense_compute_tile_shape_or_override() {
     constexpr int N_min_D = (detail::is_m_major<GmemStrideTypeD>()) ? 8 * WarpN
                               : (sizeof_bits_v<ElementD> == 6) ? 128 * WarpN // TMA store only supports SW128B for FP6 data type
                                                               : 128 / sizeof_bits_v<ElementD> * WarpN;
-    constexpr int N_tmp = cute::min(CtaN, cute::max(N_perf, N_min_C, N_min_D));
+    // Permuted (multimodal N) outputs widen the tile to keep TMA box rows contiguous per tmem warp
+    constexpr int N_min_permute = detail::multimodal_epi_tile_n_min<
+      cute::remove_cvref_t<decltype(get<1>(CtaTileShape_MNK{}))>, ElementD>() * WarpN;
+    constexpr int N_tmp = cute::min(CtaN, cute::max(N_perf, N_min_C, N_min_D, N_min_permute));
     constexpr int N = CtaN % N_tmp == 0 ? N_tmp : CtaN;
     static_assert(CtaN >= N_min_C && CtaN >= N_min_D, "CTA tile too small");
 
@@ -1307,7 +1310,12 @@ private:
 
   static constexpr auto
   gmem_store_op() {
-    if constexpr (detail::is_im2col_mode<GmemLayoutTagD>) {
+    if constexpr (detail::is_tma_reduce_add_v<Schedule>) {
+      static_assert(detail::is_tma_reduce_add_element_v<ElementD> && not detail::is_im2col_mode<GmemLayoutTagD>,
+                    "TMA reduce-add store of D requires a float, half_t or bfloat16_t non-im2col D");
+      return SM90_TMA_REDUCE_ADD{};
+    }
+    else if constexpr (detail::is_im2col_mode<GmemLayoutTagD>) {
       return SM90_TMA_STORE_IM2COL{};
     }
     else {
@@ -1488,8 +1496,9 @@ private:
                                     is_same_v<BlockwiseNoSmemWarpSpecialized2Sm, EpilogueScheduleType> ||
                                     is_same_v<PtrArrayBlockwiseNoSmemWarpSpecialized1Sm, EpilogueScheduleType> ||
                                     is_same_v<PtrArrayBlockwiseNoSmemWarpSpecialized2Sm, EpilogueScheduleType>;
+  static constexpr bool IsOzakiF64Schedule = is_same_v<OzakiF64NoSmemWarpSpecialized1Sm, EpilogueScheduleType>;
   // Transform kernels - when dispatching to sm100 nosmem epilogue, go through the default path without EVT support.
-  static constexpr bool IsTransformSchedule = IsInterleavedComplex || IsFastF32Schedule || IsBlockwiseSchedule;
+  static constexpr bool IsTransformSchedule = IsInterleavedComplex || IsFastF32Schedule || IsBlockwiseSchedule || IsOzakiF64Schedule;
   static_assert(Is1SmMma ^ Is2SmMma, "unsupported schedule");
   static_assert(not (Is2SmMma && size<0>(ClusterShape_MNK{}) % 2 == 1), "schedule + cluster mismatch");
 
@@ -114,14 +114,18 @@ constexpr auto
 sm90_compute_tile_shape_or_override() {
   if constexpr (cute::is_same_v<EpilogueTileType, EpilogueTileAuto>) {
     auto epi_tile = [&] () {
+      // Permuted (multimodal N) outputs widen the tile to keep TMA box rows contiguous
+      constexpr int N_min = detail::multimodal_epi_tile_n_min<
+        cute::remove_cvref_t<decltype(get<1>(TileShape_MNK{}))>, ElementD>();
       if constexpr (detail::sm90_is_cooperative_v<Schedule>) {
 
+        constexpr int N_perf = cute::max(32, N_min);
         auto tile_m = cute::min(_128{}, size<0>(TileShape_MNK{}));
-        auto tile_n = cute::gcd(cute::min(_32{}, size<1>(TileShape_MNK{})), size<1>(TileShape_MNK{}));
+        auto tile_n = cute::gcd(cute::min(Int<N_perf>{}, size<1>(TileShape_MNK{})), size<1>(TileShape_MNK{}));
         return make_shape(tile_m, tile_n);
       }
       else if constexpr (detail::sm90_is_warp_specialized_v<Schedule>) {
-        constexpr int N_perf = (sizeof_bits_v<ElementD> == 8) && (size<1>(TileShape_MNK{}) % 64 == 0) ? 64 : 32;
+        constexpr int N_perf = cute::max((sizeof_bits_v<ElementD> == 8) && (size<1>(TileShape_MNK{}) % 64 == 0) ? 64 : 32, N_min);
         auto tile_m = cute::min(_64{}, size<0>(TileShape_MNK{}));
         auto tile_n = cute::gcd(cute::min(Int<N_perf>{}, size<1>(TileShape_MNK{})), size<1>(TileShape_MNK{}));
         return make_shape(tile_m, tile_n);
@@ -290,7 +294,8 @@ template <
   class GmemLayoutTagD,
   int AlignmentD,
   class FusionOpOrCallbacks,
-  class DispatchPolicy
+  class DispatchPolicy,
+  bool ReduceAddD = false
 >
 struct Sm90TmaBuilderImpl {
   // C/D should meet TMA alignment requirement if not void
@@ -310,9 +315,15 @@ struct Sm90TmaBuilderImpl {
   using UnderlyingGmemStrideTypeC = cute::remove_pointer_t<GmemStrideTypeC>;
   using UnderlyingGmemStrideTypeD = cute::remove_pointer_t<GmemStrideTypeD>;
 
-  using CopyOpS2G = cute::conditional_t<detail::is_im2col_mode<GmemLayoutTagD>,
-      SM90_TMA_STORE_IM2COL,
-      SM90_TMA_STORE
+  static_assert(not ReduceAddD || (detail::is_tma_reduce_add_element_v<ElementD> && not detail::is_im2col_mode<GmemLayoutTagD>),
+                "TMA reduce-add store of D requires a float, half_t or bfloat16_t non-im2col D\n");
+
+  using CopyOpS2G = cute::conditional_t<ReduceAddD,
+      SM90_TMA_REDUCE_ADD,
+      cute::conditional_t<detail::is_im2col_mode<GmemLayoutTagD>,
+        SM90_TMA_STORE_IM2COL,
+        SM90_TMA_STORE
+      >
     >;
   using CopyOpG2S = cute::conditional_t<detail::is_im2col_mode<GmemLayoutTagC>,
       SM90_TMA_LOAD_IM2COL,
@@ -366,6 +377,120 @@ struct Sm90TmaBuilderImpl {
     >;
 };
 
+// aux fusion callbacks builder for sm90 direct store epilogue
+template <
+  class FusionOp,
+  class TileShape_MNK,
+  class EpilogueTile_MN,
+  class AccLoadOp,
+  class ElementAccumulator
+>
+struct CallbacksBuilder<
+  Sm90NoSmemWarpSpecialized,
+  FusionOp,
+  TileShape_MNK,
+  EpilogueTile_MN,
+  ElementAccumulator,
+  AccLoadOp,
+  cute::enable_if_t<(FusionOp::IsAuxOutSupported ^ FusionOp::IsAuxInSupported)> // only one aux tensor
+> {
+  using Callbacks = fusion::FusionCallbacks<
+    Sm90NoSmemWarpSpecialized, FusionOp, TileShape_MNK, EpilogueTile_MN,
+    Layout<_1,_0>, DefaultCopy // aux tensor doesn't use tma
+  >;
+};
+
+// True for the linear combination handled by the legacy DefaultEpilogue no-smem builder
+template <class FusionOp, class ElementD, class ElementCompute, class ElementC>
+struct sm90_is_nosmem_linear_combination : cute::false_type {};
+
+template <class ElementD, class ElementCompute, class ElementC, FloatRoundStyle RoundStyle>
+struct sm90_is_nosmem_linear_combination<
+    fusion::LinearCombination<ElementD,ElementCompute,ElementC,ElementCompute,RoundStyle>,
+    ElementD, ElementCompute, ElementC> : cute::true_type {};
+
+// The direct store epilogue vectorizes D along N, where each thread's gmma accumulators hold adjacent columns.
+// Pick it over the scalar DefaultEpilogue when D is N-major and aligned to at least 32b stores.
+template <class ElementC, class GmemLayoutTagC, int AlignmentC, class ElementD, class GmemLayoutTagD, int AlignmentD>
+constexpr bool
+sm90_is_nosmem_store_vectorizable() {
+  if constexpr (is_im2col_mode<GmemLayoutTagC> || is_im2col_mode<GmemLayoutTagD>) {
+    return false;
+  }
+  else if constexpr (not cute::is_void_v<ElementC> && AlignmentC * cute::sizeof_bits_v<ElementC> < 32) {
+    return false;
+  }
+  else {
+    return cutlass::detail::is_major<1>(cutlass::detail::TagToStrideC_t<GmemLayoutTagD>{})
+        && AlignmentD * cute::sizeof_bits_v<ElementD> >= 32;
+  }
+}
+
+// Helper for building direct store (no-smem) collective epilogues with EVT support.
+// Without smem staging the whole CTA tile is processed as one epilogue subtile.
+template <
+  class TileShape_MNK,
+  class EpilogueTileType,
+  class ElementAccumulator,
+  class ElementC_,
+  class GmemLayoutTagC_,
+  int AlignmentC,
+  class ElementD,
+  class GmemLayoutTagD,
+  int AlignmentD,
+  class FusionOpOrCallbacks
+>
+struct Sm90NoSmemBuilderImpl {
+  // Passing void C disables source load
+  using ElementC = cute::conditional_t<cute::is_void_v<ElementC_>,
+      ElementD, ElementC_>; // prevents cute breakages
+  using GmemLayoutTagC = cute::conditional_t<cute::is_void_v<ElementC_>,
+      GmemLayoutTagD, GmemLayoutTagC_>;
+
+  using GmemStrideTypeC = cutlass::detail::TagToStrideC_t<GmemLayoutTagC>;
+  using GmemStrideTypeD = cutlass::detail::TagToStrideC_t<GmemLayoutTagD>;
+
+  static_assert(cute::is_same_v<EpilogueTileType, EpilogueTileAuto> ||
+                cute::is_same_v<EpilogueTileType, decltype(take<0,2>(TileShape_MNK{}))>,
+                "The direct store epilogue only supports the CTA tile as epilogue tile.");
+  using EpilogueTile_MN = decltype(take<0,2>(TileShape_MNK{}));
+
+  // Smallest tiled copy the accumulators are retiled with, matching the tma epilogue's partitioning
+  using CopyAtomC = cute::conditional_t<
+    size<1>(EpilogueTile_MN{}) % 16 == 0,
+    Copy_Atom<SM90_U32x4_STSM_N, cutlass::half_t>,
+    cute::conditional_t<
+      size<1>(EpilogueTile_MN{}) % 8 == 0,
+      Copy_Atom<SM90_U32x2_STSM_N, cutlass::half_t>,
+      void
+    >
+  >;
+  static_assert(!cute::is_same_v<CopyAtomC, void>, "CopyAtomC can't be void, CTA_N must be a multiple of 8");
+
+  using FusionCallbacks =
+    typename CallbacksBuilder<
+      Sm90NoSmemWarpSpecialized,
+      FusionOpOrCallbacks,
+      TileShape_MNK,
+      EpilogueTile_MN,
+      ElementAccumulator
+    >::Callbacks;
+
+  using CollectiveOp = cutlass::epilogue::collective::detail::Sm90TmaWarpSpecializedAdapter<
+    cutlass::epilogue::collective::CollectiveEpilogue<
+      Sm90NoSmemWarpSpecialized,
+      EpilogueTile_MN,
+      ElementC_, // Need to pass void through to expose via GemmUniversal
+      GmemStrideTypeC,
+      ElementD,
+      GmemStrideTypeD,
+      FusionCallbacks,
+      CopyAtomC,
+      Int<AlignmentC>,
+      Int<AlignmentD>
+    >>;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 // Descriptor classes for defining EVT nodes
 // Some of the epilogue visitor nodes require non-intuitive template arguments
@@ -516,6 +641,55 @@ struct CollectiveBuilder<
     >;
 };
 
+// No-smem builder with EVT support
+template <
+  class OpClass,
+  class TileShape_MNK,
+  class ClusterShape_MNK,
+  class EpilogueTileType,
+  class ElementAccumulator,
+  class ElementCompute,
+  class ElementC,
+  class GmemLayoutTagC,
+  int AlignmentC,
+  class ElementD,
+  class GmemLayoutTagD,
+  int AlignmentD,
+  class FusionOperation
+>
+struct CollectiveBuilder<
+    arch::Sm90,
+    OpClass,
+    TileShape_MNK,
+    ClusterShape_MNK,
+    EpilogueTileType,
+    ElementAccumulator,
+    ElementCompute,
+    ElementC,
+    GmemLayoutTagC,
+    AlignmentC,
+    ElementD,
+    GmemLayoutTagD,
+    AlignmentD,
+    NoSmemWarpSpecialized,
+    FusionOperation,
+    cute::enable_if_t<not detail::sm90_is_nosmem_linear_combination<
+                        FusionOperation, ElementD, ElementCompute, ElementC>::value>> {
+  using CollectiveOp =
+    typename detail::Sm90NoSmemBuilderImpl<
+      TileShape_MNK,
+      EpilogueTileType,
+      ElementAccumulator,
+      ElementC,
+      GmemLayoutTagC,
+      AlignmentC,
+      ElementD,
+      GmemLayoutTagD,
+      AlignmentD,
+      FusionOperation
+    >::CollectiveOp;
+};
+
 // Tma warp-specialized builder
 template <
   class OpClass,
@@ -551,6 +725,8 @@ struct CollectiveBuilder<
     FusionOperation,
     cute::enable_if_t<cute::is_same_v<Schedule, TmaWarpSpecialized> ||
                       cute::is_same_v<Schedule, TmaWarpSpecializedCooperative> ||
+                      cute::is_same_v<Schedule, TmaWarpSpecializedReduceAdd> ||
+                      cute::is_same_v<Schedule, TmaWarpSpecializedCooperativeReduceAdd> ||
                       detail::sm90_is_ptr_array_tma_v<Schedule>>> {
 private:
   using ElementD = cute::conditional_t<cute::is_void_v<ElementD_>,
@@ -574,7 +750,8 @@ public:
       GmemLayoutTagD,
       AlignmentD,
       FusionOperation,
-      DispatchPolicy
+      DispatchPolicy,
+      detail::is_tma_reduce_add_v<Schedule>
     >::CollectiveOp;
 };
 
@@ -612,12 +789,30 @@ struct CollectiveBuilder<
     FusionOperation,
     void> {
 private:
-  static_assert(cute::is_same_v<FusionOperation, fusion::LinearCombination<ElementD,ElementCompute,ElementC,ElementCompute>>,
-                "Auto schedule doesn't support fusion. Use one of the TmaWarpSpecialized schedules instead.");
-
   // Pick No-Smem epilogue as the Auto Epilogue Schedule (Auto schedules do not guarantee best performance) 
   // since TMA epilogues are not compatible with non-TMA non-WS mainloops
   using EpilogueSchedule = NoSmemWarpSpecialized;
+
+  // Fusions always take the direct store EVT epilogue. Linear combinations take it when its stores
+  // vectorize, and otherwise keep the scalar DefaultEpilogue.
+  static constexpr bool UseDirectStoreEpilogue =
+    not detail::sm90_is_nosmem_linear_combination<FusionOperation, ElementD, ElementCompute, ElementC>::value ||
+    (cute::is_same_v<OpClass, arch::OpClassTensorOp> &&
+     cute::is_same_v<EpilogueTileType, EpilogueTileAuto> &&
+     size<1>(TileShape_MNK{}) % 8 == 0 &&
+     detail::sm90_is_nosmem_store_vectorizable<ElementC, GmemLayoutTagC, AlignmentC, ElementD, GmemLayoutTagD, AlignmentD>());
+  using _DirectStoreBuilder = detail::Sm90NoSmemBuilderImpl<
+    TileShape_MNK,
+    EpilogueTileType,
+    ElementAccumulator,
+    ElementC,
+    GmemLayoutTagC,
+    AlignmentC,
+    ElementD,
+    GmemLayoutTagD,
+    AlignmentD,
+    FusionOperation
+  >;
   using _CollectiveBuilder = CollectiveBuilder<
     arch::Sm90,
     OpClass,
@@ -637,7 +832,8 @@ private:
   >;
 
 public:
-  using CollectiveOp = typename _CollectiveBuilder::CollectiveOp;
+  using CollectiveOp = typename cute::conditional_t<UseDirectStoreEpilogue,
+    _DirectStoreBuilder, _CollectiveBuilder>::CollectiveOp;
 };
 
 // DEPRECATED Tma warp-specialized builder for elementwise fusion
@@ -28,75 +28,54 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *
  **************************************************************************************************/
-#pragma once
+/*! \file
+    \brief Epilogue builder for gated (GLU) GEMMs, which store x0 * act(x1) at half the size of the accumulator.
 
-// This is a temp fix for circular include issue in CuTe
-#include "cute/atom/copy_atom.hpp"
+    The output is written through an aux store (D is void) since its shape differs from the accumulator,
+    see cutlass/epilogue/fusion/sm90_visitor_gated_act.hpp.
+*/
+#pragma once
 
-#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/detail/gated_layout.hpp"
+#include "cutlass/detail/dependent_false.hpp"
 #include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/fusion/operations.hpp"
 
-#include "gated_stride.hpp"
-#include "sm90_visitor_gated_act.hpp"
-
-namespace cutlass::detail {
+/////////////////////////////////////////////////////////////////////////////////////////////////
 
-template <int ModeIndex, class InputStride>
-using GatedStride = cute::conditional_t<
-  cutlass::detail::is_major<ModeIndex, InputStride>(),
-  decltype(replace<ModeIndex>(InputStride{}, cute::Stride<cute::_1,int64_t,cute::_8>{})),
-  decltype(replace<ModeIndex>(InputStride{}, cute::Stride< int64_t,int64_t, int64_t>{}))
->;
-
-template <int ModeIndex, class InputStride>
-using GatedOutputStride = cute::conditional_t<
-  cutlass::detail::is_major<ModeIndex, InputStride>(),
-  decltype(replace<ModeIndex>(InputStride{}, cute::Stride<cute::_1,cute::_8>{})),
-  decltype(replace<ModeIndex>(InputStride{}, cute::Stride< int64_t, int64_t>{}))
->;
-
-}
+namespace cutlass::epilogue::collective {
 
-namespace cutlass::gemm::collective {
+/////////////////////////////////////////////////////////////////////////////////////////////////
 
 template <
+  class ArchTag,
   class OpClass,
-  class ElementA,
-  class GmemLayoutA,
-  int AlignmentA,
-  class ElementB,
-  class GmemLayoutB,
-  int AlignmentB,
-  class ElementAccumulator,
-  class TileShape_MNK_,
+  class TileShape_MNK,
   class ClusterShape_MNK,
-  class StageCountType,
-  class KernelScheduleType
+  class EpilogueTileType,
+  class ElementAccumulator,
+  class ElementCompute,
+  class ElementScalar,
+  class ElementIntermediate,
+  class ElementC,
+  class GmemLayoutTagC,
+  int AlignmentC,
+  class ElementD,
+  class GmemLayoutTagD,
+  int AlignmentD,
+  class EpilogueSchedule,
+  template <class> class ActivationFn,
+  bool Quantize,
+  class Enable = void
 >
-struct Sm90CollectiveBuilderGated {
-
-  using TileShape_MNK = decltype(cutlass::sm90_make_gated_shape<0>(TileShape_MNK_{}));
-
-  using InternalStrideA = cute::remove_pointer_t<cutlass::gemm::TagToStrideA_t<GmemLayoutA>>;
-  using GatedInternalStrideA = cutlass::detail::GatedStride<0, InternalStrideA>;
-  using StrideA = cute::conditional_t<platform::is_pointer<GmemLayoutA>::value, GatedInternalStrideA *, GatedInternalStrideA>;
-
-  using StrideB = cutlass::gemm::TagToStrideB_t<GmemLayoutB>;
-  
-  using CollectiveOp = typename CollectiveBuilder<
-    arch::Sm90, OpClass,
-    ElementA, StrideA, AlignmentA,
-    ElementB, StrideB, AlignmentB,
-    ElementAccumulator,
-    TileShape_MNK, ClusterShape_MNK,
-    StageCountType, KernelScheduleType
-  >::CollectiveOp;
+struct CollectiveBuilderGated {
+  static_assert(cutlass::detail::dependent_false<ArchTag>,
+      "Could not build a gated collective epilogue for given parameters.");
 };
 
-} // namespace cutlass::gemm::collective
-
-namespace cutlass::epilogue::collective {
+/////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Gate and up alternate along M in groups of 8 rows, the input tile has an (8,2,M/16) mode-0
 template <
   class OpClass,
   class TileShape_MNK,
@@ -116,7 +95,26 @@ template <
   template <class> class ActivationFn,
   bool Quantize
 >
-struct Sm90CollectiveBuilderGated {
+struct CollectiveBuilderGated<
+    arch::Sm90,
+    OpClass,
+    TileShape_MNK,
+    ClusterShape_MNK,
+    EpilogueTileType,
+    ElementAccumulator,
+    ElementCompute,
+    ElementScalar,
+    ElementIntermediate,
+    ElementC,
+    GmemLayoutTagC,
+    AlignmentC,
+    ElementD,
+    GmemLayoutTagD,
+    AlignmentD,
+    EpilogueSchedule,
+    ActivationFn,
+    Quantize
+> {
 
   static constexpr bool IsPtrArray = platform::is_pointer<GmemLayoutTagD>::value;
 
@@ -170,4 +168,83 @@ struct Sm90CollectiveBuilderGated {
   >::CollectiveOp;
 };
 
-} // namespace cutlass::epilogue::collective 
+// Gate and up alternate along N in adjacent columns, the input tile is (M,2N) and the output (M,N).
+// The TMEM load layouts hold whole rows per thread, so no special tile shape or strides are needed.
+template <
+  class OpClass,
+  class TileShape_MNK,
+  class ClusterShape_MNK,
+  class EpilogueTileType,
+  class ElementAccumulator,
+  class ElementCompute,
+  class ElementScalar,
+  class ElementIntermediate,
+  class ElementC,
+  class GmemLayoutTagC,
+  int AlignmentC,
+  class ElementD,
+  class GmemLayoutTagD,
+  int AlignmentD,
+  class EpilogueSchedule,
+  template <class> class ActivationFn,
+  bool Quantize
+>
+struct CollectiveBuilderGated<
+    arch::Sm100,
+    OpClass,
+    TileShape_MNK,
+    ClusterShape_MNK,
+    EpilogueTileType,
+    ElementAccumulator,
+    ElementCompute,
+    ElementScalar,
+    ElementIntermediate,
+    ElementC,
+    GmemLayoutTagC,
+    AlignmentC,
+    ElementD,
+    GmemLayoutTagD,
+    AlignmentD,
+    EpilogueSchedule,
+    ActivationFn,
+    Quantize
+> {
+
+  using FusionOp = cutlass::epilogue::fusion::LinCombGatedActFunc<
+    Quantize,                                   // Quantize
+    ActivationFn,                               // ActivationFn
+    GmemLayoutTagD,                             // GmemLayoutTagOutput
+    ElementD,                                   // ElementOutput
+    ElementCompute,                             // ElementCompute
+    ElementC,                                   // ElementSource
+    ElementScalar,                              // ElementScalar
+    ElementIntermediate,                        // ElementIntermediate
+    AlignmentD,                                 // Alignment
+    FloatRoundStyle::round_to_nearest,          // RoundStyle
+    1                                           // ModeIndex
+  >;
+
+  using CollectiveOp = typename CollectiveBuilder<
+    arch::Sm100,
+    OpClass,
+    TileShape_MNK,
+    ClusterShape_MNK,
+    EpilogueTileType,
+    ElementAccumulator,
+    ElementCompute,
+    ElementC,
+    GmemLayoutTagC,
+    AlignmentC,
+    void, // output through AuxStore
+    GmemLayoutTagD,
+    AlignmentD,
+    EpilogueSchedule,
+    FusionOp
+  >::CollectiveOp;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -160,6 +160,36 @@ static constexpr bool sm90_is_warp_specialized_v =
   (!sm90_is_ptr_array_tma_cooperative_v<EpilogueSchedule> && sm90_is_ptr_array_tma_v<EpilogueSchedule>) ||
   cute::is_base_of_v<cutlass::epilogue::TmaWarpSpecialized, EpilogueSchedule>;
 
+template <class EpilogueSchedule>
+static constexpr bool is_tma_reduce_add_v =
+  cute::is_base_of_v<cutlass::epilogue::TmaWarpSpecializedReduceAdd, EpilogueSchedule> ||
+  cute::is_base_of_v<cutlass::epilogue::TmaWarpSpecializedCooperativeReduceAdd, EpilogueSchedule> ||
+  cute::is_base_of_v<cutlass::epilogue::TmaWarpSpecialized1SmReduceAdd, EpilogueSchedule> ||
+  cute::is_base_of_v<cutlass::epilogue::TmaWarpSpecialized2SmReduceAdd, EpilogueSchedule>;
+
+// Element types supported by the add reduction of cp.reduce.async.bulk.tensor used to store D
+template <class Element>
+static constexpr bool is_tma_reduce_add_element_v =
+  cute::is_same_v<Element, float> ||
+  cute::is_same_v<Element, cutlass::half_t> ||
+  cute::is_same_v<Element, cutlass::bfloat16_t>;
+
+// Smallest auto epilogue tile N for an explicit multimodal CTA tiler in N, e.g. the (head_dim,heads)
+// tiler of a permuted output. Each TMA box row then spans the full contiguous innermost sub-mode,
+// up to 128B of ElementD, instead of a fraction of it. Flat and implicit multimodal tilers return 0.
+template <class CtaTileShapeN, class ElementD>
+constexpr int
+multimodal_epi_tile_n_min() {
+  if constexpr (cute::is_tuple<CtaTileShapeN>::value && cute::tuple_size_v<CtaTileShapeN> > 1) {
+    constexpr int InnerN = cute::size<0>(CtaTileShapeN{});
+    constexpr int MaxN = 1024 / cute::sizeof_bits_v<ElementD>;
+    return InnerN < MaxN ? InnerN : MaxN;
+  }
+  else {
+    return 0;
+  }
+}
+
 template <class GmemLayoutTag>
 static constexpr bool is_im2col_mode =
   cute::is_same_v<GmemLayoutTag, cutlass::layout::TensorNWC> ||
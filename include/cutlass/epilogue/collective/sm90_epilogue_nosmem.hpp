@@ -0,0 +1,409 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Register-direct sm90 epilogue supporting EVT, no smem staging of the output tile.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/arch/barrier.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/epilogue/dispatch_policy.hpp"
+#include "cutlass/epilogue/collective/detail.hpp"
+#include "cutlass/epilogue/fusion/callbacks.hpp"
+#include "cutlass/epilogue/fusion/sm90_callbacks_tma_warpspecialized.hpp"
+#include "cutlass/detail/layout.hpp"
+#include "cutlass/detail/helper_macros.hpp"
+#include "cutlass/trace.h"
+
+#include "cute/tensor.hpp"
+#include "cutlass/cuda_host_adapter.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace epilogue {
+namespace collective {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Direct store sm90 epilogue supporting EVT
+// The accumulators are visited in registers with the same thread-value partitioning the TMA epilogue
+// uses to stage the output tile, and written to gmem with predicated stores vectorized up to the
+// contiguity of that partitioning and the gmem alignment. Without smem staging the whole CTA tile
+// is a single epilogue subtile. Wrap with detail::Sm90TmaWarpSpecializedAdapter for the
+// warp-specialized kernels.
+template <
+  class EpilogueTile_, // (EPI_TILE_M,EPI_TILE_N), must equal (CTA_M,CTA_N)
+  class ElementC_,
+  class StrideC_,
+  class ElementD_,
+  class StrideD_,
+  class FusionCallbacks_,
+  class CopyAtomC_,
+  class AlignmentC_,
+  class AlignmentD_
+>
+class CollectiveEpilogue<
+    Sm90NoSmemWarpSpecialized,
+    EpilogueTile_,
+    ElementC_,
+    StrideC_,
+    ElementD_,
+    StrideD_,
+    FusionCallbacks_,
+    CopyAtomC_,
+    AlignmentC_,
+    AlignmentD_
+> {
+public:
+  //
+  // Type Aliases
+  //
+  using DispatchPolicy = Sm90NoSmemWarpSpecialized;
+  using EpilogueTile = EpilogueTile_;
+  using ElementC = ElementC_;
+  using ElementD = ElementD_;
+  using GmemElementC = cute::conditional_t<cute::is_void_v<ElementC>,ElementD,ElementC>; // prevents void ref breakages
+  using StrideC = StrideC_;
+  using StrideD = StrideD_;
+  using FusionCallbacks = FusionCallbacks_;
+  using CopyAtomC = CopyAtomC_;
+  using ThreadEpilogueOp = typename epilogue::fusion::FusionCallbacksTraits<FusionCallbacks>::Operation;
+
+  using GmemTiledCopyC = void;
+  using GmemTiledCopyD = void;
+
+  static_assert(not cute::is_void_v<ElementD>, "Direct store epilogue requires a D output.");
+  static_assert(cute::rank(EpilogueTile{}) == 2, "EpilogueTile must be rank-2: (EPI_TILE_M,EPI_TILE_N)");
+  static_assert(cute::rank(StrideC{}) == 3, "StrideC must be rank-3: [M, N, L]");
+  static_assert(cute::rank(StrideD{}) == 3, "StrideD must be rank-3: [M, N, L]");
+
+private:
+  constexpr static bool is_source_supported = not cute::is_void_v<ElementC>;
+  constexpr static bool IsReductionBufferNeeded = ThreadEpilogueOp::IsDePerRowBiasSupported
+                                               || is_same_v<ThreadEpilogueOp, epilogue::fusion::FusionOperation>; // alloc reduction buffer for custom EVTs
+  constexpr static size_t ImplicitSharedStorageSize = IsReductionBufferNeeded ? size(EpilogueTile{}) : 0;
+
+public:
+  constexpr static int AlignmentC = AlignmentC_{};
+  constexpr static int AlignmentD = AlignmentD_{};
+
+  struct SharedStorage {
+    using FusionStorage = typename FusionCallbacks::SharedStorage;
+    FusionStorage thread;
+    array_aligned<uint8_t, ImplicitSharedStorageSize> buffer;
+  };
+
+  // Host side epilogue arguments
+  struct Arguments {
+    typename FusionCallbacks::Arguments thread{};
+    ElementC const* ptr_C = nullptr;
+    StrideC dC = {};
+    ElementD* ptr_D = nullptr;
+    StrideD dD = {};
+  };
+
+  // Device side epilogue params
+  struct Params {
+    typename FusionCallbacks::Params thread{};
+    ElementC const* ptr_C = nullptr;
+    StrideC dC = {};
+    ElementD* ptr_D = nullptr;
+    StrideD dD = {};
+  };
+
+  //
+  // Constructor and Data Members
+  //
+  // The fusion callbacks are constructed in operator() since the non warp-specialized kernels
+  // only hand the epilogue its smem once the mainloop is done with it
+  CUTLASS_HOST_DEVICE
+  CollectiveEpilogue(Params const& params_)
+  : params(params_) { }
+
+protected:
+  Params const& params;
+
+public:
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(
+      [[maybe_unused]] ProblemShape const& problem_shape,
+      Arguments const& args,
+      [[maybe_unused]] void* workspace) {
+    return {
+      FusionCallbacks::to_underlying_arguments(problem_shape, args.thread, workspace),
+      args.ptr_C,
+      args.dC,
+      args.ptr_D,
+      args.dD
+    };
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return FusionCallbacks::get_workspace_size(problem_shape, args.thread);
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+      CudaHostAdapter* cuda_adapter = nullptr) {
+    return FusionCallbacks::initialize_workspace(problem_shape, args.thread, workspace, stream, cuda_adapter);
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(
+      ProblemShape const& problem_shape,
+      [[maybe_unused]] Arguments const& args) {
+    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    auto [M,N,K,L] = problem_shape_MNKL;
+    auto shape = cute::make_shape(M,N,L);
+
+    // Vectorized stores assume every vector of the output tile is aligned in gmem
+    bool implementable = cutlass::detail::check_alignment<AlignmentD>(shape, StrideD{});
+    if constexpr (is_source_supported) {
+      implementable = implementable && cutlass::detail::check_alignment<AlignmentC>(shape, StrideC{});
+    }
+
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum alignment requirements for vectorized stores.\n");
+    }
+
+    bool fusion_implementable = FusionCallbacks::can_implement(problem_shape, args.thread);
+    if (!fusion_implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum requirements for FusionCallbacks.\n");
+    }
+
+    bool beta_implementable = true;
+    if constexpr (not is_source_supported) {
+      if constexpr (detail::has_beta<Arguments>::value) {
+        beta_implementable = args.thread.beta == 0.0;
+      }
+      if constexpr (detail::has_beta_ptr<Arguments>::value) {
+        beta_implementable = beta_implementable && args.thread.beta_ptr == nullptr;
+      }
+    }
+
+    if (!beta_implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Beta/beta pointer was set, but epilogue is sourceless (void-C).\n");
+    }
+
+    return implementable && fusion_implementable && beta_implementable;
+  }
+
+  template<
+    class ProblemShapeMNKL,
+    class BlockShapeMNK,
+    class BlockCoordMNKL,
+    class FrgEngine, class FrgLayout,
+    class TiledMma,
+    class ResidueMNK
+  >
+  CUTLASS_DEVICE void
+  operator()(
+      ProblemShapeMNKL problem_shape_mnkl,
+      BlockShapeMNK blk_shape_MNK,
+      BlockCoordMNKL blk_coord_mnkl,
+      cute::Tensor<FrgEngine, FrgLayout> const& accumulators,
+      TiledMma tiled_mma,
+      [[maybe_unused]] ResidueMNK,
+      int thread_idx,
+      char* smem_buf) {
+    using namespace cute;
+    using ElementAccumulator = typename FrgEngine::value_type;
+    using ElementCompute_ = typename epilogue::fusion::FusionCallbacksTraits<FusionCallbacks>::ElementCompute;
+    using ElementCompute = cute::conditional_t<cute::is_void_v<ElementCompute_>,ElementAccumulator,ElementCompute_>;
+
+    static_assert(is_rmem<FrgEngine>::value, "Accumulator must be RF resident.");
+    static_assert(rank(FrgLayout{}) == 3, "Accumulator must be MMA-partitioned: (MMA,MMA_M,MMA_N)");
+    static_assert(rank(ProblemShapeMNKL{}) == 4, "ProblemShapeMNKL must be rank 4");
+    static_assert(is_static<BlockShapeMNK>::value, "ThreadBlock tile shape must be static");
+    static_assert(rank(BlockShapeMNK{}) == 3, "BlockShapeMNK must be rank 3");
+    static_assert(rank(BlockCoordMNKL{}) == 4, "BlockCoordMNKL must be rank 4");
+    static_assert(size<0>(EpilogueTile{}) == size<0>(BlockShapeMNK{}) &&
+                  size<1>(EpilogueTile{}) == size<1>(BlockShapeMNK{}), "EpilogueTile must be the CTA tile");
+
+    constexpr int ThreadCount = size(TiledMma{});
+
+    auto [M, N, K, L] = problem_shape_mnkl;
+    auto [m_coord, n_coord, k_coord, l_coord] = blk_coord_mnkl;
+
+    SharedStorage& shared_storage = *reinterpret_cast<SharedStorage*>(smem_buf);
+    FusionCallbacks fusion_callbacks(params.thread, shared_storage.thread);
+
+    // (t)hread-partition for (r)egister to (g)mem copy (tRG_), this is the partitioning the tma epilogue
+    // stores registers to smem with, so the fusion callbacks see the layouts they do in the tma epilogue
+    TiledCopy tiled_copy_C_atom = make_tiled_copy_C_atom(CopyAtomC{}, tiled_mma);
+    TiledCopy tiled_r2g = make_tiled_copy_S(Copy_Atom<AutoVectorizingCopyWithAssumedAlignment<128>,ElementD>{}, tiled_copy_C_atom);
+    ThrCopy thread_r2g = tiled_r2g.get_slice(thread_idx);
+    Tensor tRG_rAcc = thread_r2g.retile_S(accumulators);                                   // ((R2G,R2G_V),MMA_M,MMA_N)
+
+    constexpr bool RefSrc = true; // Register tensors reference tiled copy src layout
+    Tensor mC = make_tensor(make_gmem_ptr<GmemElementC>(params.ptr_C), make_shape(M,N,L), params.dC);    //   (M,N,L)
+    Tensor mD = make_tensor(make_gmem_ptr<ElementD>(params.ptr_D), make_shape(M,N,L), params.dD);        //   (M,N,L)
+    Tensor tRG_gC = cutlass::epilogue::fusion::sm90_partition_for_epilogue<RefSrc>(
+                      mC, blk_shape_MNK, blk_coord_mnkl, EpilogueTile{}, tiled_r2g, thread_idx);  // (R2G,R2G_M,R2G_N,EPI_M,EPI_N)
+    Tensor tRG_gD = cutlass::epilogue::fusion::sm90_partition_for_epilogue<RefSrc>(
+                      mD, blk_shape_MNK, blk_coord_mnkl, EpilogueTile{}, tiled_r2g, thread_idx);  // (R2G,R2G_M,R2G_N,EPI_M,EPI_N)
+
+    // Allocate C and D registers
+    Tensor tRG_rC = make_tensor<GmemElementC>(take<0,3>(shape(tRG_gC)));                                // (R2G,R2G_M,R2G_N)
+    Tensor tRG_rD = make_tensor<ElementD>(take<0,3>(shape(tRG_gD)));                                    // (R2G,R2G_M,R2G_N)
+    CUTE_STATIC_ASSERT_V(size(tRG_rAcc) == size(tRG_rD), "Accumulators must cover the CTA tile");
+
+    // One fragment per MMA tile
+    constexpr int FragmentSize = decltype(size<0>(tRG_rAcc))::value;
+    Tensor tRG_rAcc_frg = recast<Array<ElementAccumulator, FragmentSize>>(tRG_rAcc);
+    Tensor tRG_rD_frg   = recast<Array<ElementD          , FragmentSize>>(tRG_rD);
+    constexpr int MmaM = size<1>(tRG_rAcc_frg);
+    constexpr int MmaN = size<2>(tRG_rAcc_frg);
+
+    // OOB predication for tile quantization "residue"
+    // Absolute coordinate tensors (dynamic)
+    Tensor mD_crd = make_identity_tensor(make_shape(M,N));                                                     // (M,N)
+    Tensor cD_mn = local_tile(mD_crd, take<0,2>(blk_shape_MNK), make_coord(m_coord, n_coord));         // (CTA_M,CTA_N)
+    Tensor tRG_cD_mn = thread_r2g.partition_S(flat_divide(cD_mn, EpilogueTile{}));  // (R2G,R2G_M,R2G_N,EPI_M,EPI_N)
+    // Relative coordinate tensors (static)
+    Tensor cD = make_coord_tensor(cD_mn.layout());                                                     // (CTA_M,CTA_N)
+    Tensor tRG_cD = make_coord_tensor(tRG_cD_mn.layout());                          // (R2G,R2G_M,R2G_N,EPI_M,EPI_N)
+    // Subtract the global "bottom right" corner from the local "top left" corner to get the max relative coordinate
+    auto residue_cD = make_coord(M,N) - cD_mn(_0{});                                                           // (m,n)
+    auto residue_tRG_cD = make_coord(M,N) - tRG_cD_mn(_0{});                                                   // (m,n)
+
+    Tensor tRG_pCD = cute::lazy::transform(tRG_cD_mn(_,_,_,_0{},_0{}),
+      [&] (auto const& c) CUTLASS_LAMBDA_FUNC_INLINE { return elem_less(c, make_coord(M,N)); });
+
+    // Vector width is bounded by the contiguity the register partitioning shares with gmem, by the
+    // alignment, and by the widest (128b) global access
+    constexpr auto mclD = decltype(max_common_layout(tRG_gD(_,_,_,_0{},_0{}), tRG_rD)){};
+    constexpr int VD = cute::min(cute::min(AlignmentD, int(size(mclD))), cute::max(1, 128 / int(sizeof_bits_v<ElementD>)));
+    constexpr auto mclC = decltype(max_common_layout(tRG_gC(_,_,_,_0{},_0{}), tRG_rC)){};
+    constexpr int VC = cute::min(cute::min(AlignmentC, int(size(mclC))), cute::max(1, 128 / int(sizeof_bits_v<GmemElementC>)));
+
+    auto cst_args = cutlass::epilogue::fusion::detail::ConsumerStoreArgs(
+                      problem_shape_mnkl,
+                      blk_shape_MNK,
+                      blk_coord_mnkl,
+                      tiled_mma,
+                      EpilogueTile{},
+                      tiled_r2g,
+                      cD,
+                      residue_cD,
+                      tRG_cD,
+                      residue_tRG_cD,
+                      tRG_rC,
+                      thread_idx
+                    );
+    auto cst_callbacks = fusion_callbacks.template get_consumer_store_callbacks<RefSrc>(cst_args);
+    bool is_C_load_needed = is_source_supported && fusion_callbacks.is_C_load_needed();
+
+    using FragmentVisit = decltype(cst_callbacks.visit(tRG_rAcc_frg(0), 0, 0, 0));
+    constexpr bool IsDirectR2G = cute::is_same_v<FragmentVisit, Array<ElementD, FragmentSize>>;
+    using RegisterElementD = cute::conditional_t<!IsDirectR2G, ElementCompute, ElementD>;
+    Tensor tRG_rCompute = make_tensor<RegisterElementD>(tRG_rD.layout());                          // (R2G,R2G_M,R2G_N)
+    Tensor tRG_rCompute_frg = recast<Array<RegisterElementD, FragmentSize>>(tRG_rCompute);
+
+    auto synchronize = [] () CUTLASS_LAMBDA_FUNC_INLINE { cutlass::arch::NamedBarrier::sync(ThreadCount, cutlass::arch::ReservedNamedBarriers::EpilogueBarrier); };
+
+    //
+    // BEGIN EPILOGUE
+    //
+
+    // Ensure no thread is still reading smem that the reduction buffer aliases
+    if constexpr (IsReductionBufferNeeded) {
+      synchronize();
+    }
+
+    // Pre-loop fusion callback entry point
+    cst_callbacks.begin();
+    if (cst_callbacks.begin_sync_needed()) {
+      synchronize();
+    }
+
+    cst_callbacks.begin_loop(0, 0);
+
+    if constexpr (is_source_supported) {
+      if (is_C_load_needed) {
+        using CVecType = uint_bit_t<VC * sizeof_bits_v<ElementC>>;
+        Tensor tRG_gC_vec = recast<CVecType>(coalesce(tRG_gC(_,_,_,_0{},_0{})));
+        Tensor tRG_rC_vec = recast<CVecType>(coalesce(tRG_rC));
+        Tensor tRG_pC_vec = tensor<1>(zipped_divide(coalesce(tRG_pCD), mclC.compose(Int<VC>{})));
+        copy_if(tRG_pC_vec, tRG_gC_vec, tRG_rC_vec);
+      }
+    }
+
+    // Vectorized fragment loop with visitor callback entry point
+    CUTLASS_PRAGMA_UNROLL
+    for (int mma_n = 0; mma_n < MmaN; ++mma_n) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int mma_m = 0; mma_m < MmaM; ++mma_m) {
+        int epi_v = mma_n * MmaM + mma_m;
+        tRG_rCompute_frg(epi_v) = cst_callbacks.visit(tRG_rAcc_frg(_0{},mma_m,mma_n), epi_v, 0, 0);
+      }
+    }
+
+    // Smem reduction callback entry point using the implicit reduction buffer for workspace
+    Tensor reduction_buffer = make_tensor(
+      make_smem_ptr(shared_storage.buffer.data()), make_layout(Shape<Int<ImplicitSharedStorageSize>>{}));
+    cst_callbacks.reduce(reduction_buffer, synchronize, 0, 0, true, tRG_rCompute_frg);
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(tRG_rD_frg); ++i) {
+      tRG_rD_frg(i) = cutlass::NumericArrayConverter<ElementD, RegisterElementD, FragmentSize>{}(tRG_rCompute_frg(i));
+    }
+
+    cst_callbacks.end_loop(0, 0);
+
+    // Copy tile from register to gmem
+    using DVecType = uint_bit_t<VD * sizeof_bits_v<ElementD>>;
+    Tensor tRG_gD_vec = recast<DVecType>(coalesce(tRG_gD(_,_,_,_0{},_0{})));
+    Tensor tRG_rD_vec = recast<DVecType>(coalesce(tRG_rD));
+    Tensor tRG_pD_vec = tensor<1>(zipped_divide(coalesce(tRG_pCD), mclD.compose(Int<VD>{})));
+    copy_if(tRG_pD_vec, tRG_rD_vec, tRG_gD_vec);
+
+    // Post-loop fusion callback entry point
+    cst_callbacks.end();
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace collective
+} // namespace epilogue
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
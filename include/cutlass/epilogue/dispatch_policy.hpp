@@ -58,6 +58,10 @@ struct TmaWarpSpecializedCooperative {};
 struct PtrArrayTmaWarpSpecialized { static constexpr int NumEpilogueWarpGroups = 1; };
 struct PtrArrayTmaWarpSpecializedPingpong { static constexpr int NumEpilogueWarpGroups = 2; };
 struct PtrArrayTmaWarpSpecializedCooperative { static constexpr int NumEpilogueWarpGroups = 2; };
+// D is stored with a TMA reduce-add (cp.reduce.async.bulk.tensor) into its existing contents,
+// e.g. D += alpha * A @ B for gradient accumulation without reading C
+struct TmaWarpSpecializedReduceAdd : TmaWarpSpecialized {};
+struct TmaWarpSpecializedCooperativeReduceAdd : TmaWarpSpecializedCooperative {};
 // Blackwell direct store schedules
 struct NoSmemWarpSpecialized1Sm {};
 struct NoSmemWarpSpecialized2Sm {};
@@ -65,6 +69,7 @@ struct FastF32NoSmemWarpSpecialized1Sm : NoSmemWarpSpecialized1Sm {};
 struct FastF32NoSmemWarpSpecialized2Sm : NoSmemWarpSpecialized2Sm {};
 struct BlockwiseNoSmemWarpSpecialized1Sm : NoSmemWarpSpecialized1Sm {};
 struct BlockwiseNoSmemWarpSpecialized2Sm : NoSmemWarpSpecialized2Sm {};
+struct OzakiF64NoSmemWarpSpecialized1Sm : NoSmemWarpSpecialized1Sm {};
 struct PtrArrayNoSmemWarpSpecialized1Sm : NoSmemWarpSpecialized1Sm {};
 struct PtrArrayNoSmemWarpSpecialized2Sm : NoSmemWarpSpecialized2Sm {};
 struct PtrArrayFastF32NoSmemWarpSpecialized1Sm : PtrArrayNoSmemWarpSpecialized1Sm {};
@@ -78,6 +83,8 @@ struct TmaWarpSpecialized1Sm {};
 struct TmaWarpSpecialized2Sm {};
 struct PtrArrayTmaWarpSpecialized1Sm : TmaWarpSpecialized1Sm {};
 struct PtrArrayTmaWarpSpecialized2Sm : TmaWarpSpecialized2Sm {};
+struct TmaWarpSpecialized1SmReduceAdd : TmaWarpSpecialized1Sm {};
+struct TmaWarpSpecialized2SmReduceAdd : TmaWarpSpecialized2Sm {};
 
 struct PlanarComplexTmaWarpSpecialized1Sm : TmaWarpSpecialized1Sm {};
 struct PlanarComplexTmaWarpSpecialized2Sm : TmaWarpSpecialized2Sm {};
@@ -203,6 +210,14 @@ struct Sm90PtrArrayTmaWarpSpecialized {
   constexpr static int NumEpilogueWarpGroups = NumEpilogueWarpGroups_;
 };
 
+// Register-direct epilogue supporting EVT, accumulators are visited in registers and
+// written to gmem with vectorized predicated stores without staging through smem
+struct Sm90NoSmemWarpSpecialized {
+  constexpr static int StagesC = 1;
+  constexpr static int StagesD = 1;
+  constexpr static int FragmentSize = 1;
+};
+
 // DEPRECATED policies, will be removed in next release
 template<
   int StagesC_,
@@ -31,6 +31,7 @@
 
 #pragma once
 
+#include <cutlass/blas3_types.h>
 #include <cutlass/numeric_conversion.h>
 #include <cutlass/layout/matrix.h>
 #include <cute/numeric/numeric_types.hpp>
@@ -54,6 +55,7 @@ struct FusionOperation {
   using ElementOutput = void;
   using ElementCompute = void;
   FloatRoundStyle RoundStyle = FloatRoundStyle::round_indeterminate;
+  static constexpr bool IsStochasticRoundSupported = false; // Output is rounded stochastically
 
   using ElementSource = void;
   static constexpr bool IsSourceSupported = false;
@@ -70,6 +72,7 @@ struct FusionOperation {
   static constexpr bool IsPerRowBiasSupported = false;
   static constexpr bool IsPerColBiasSupported = false;
   static constexpr bool IsDePerRowBiasSupported = false;
+  static constexpr bool IsDePerColBiasSupported = false;
 
   using ActivationFn = void;
   static constexpr bool IsEltActSupported = false;
@@ -119,6 +122,19 @@ struct LinearCombination
   static constexpr bool IsSourceSupported = true;
 };
 
+// D = alpha * acc + beta * C, stochastically rounded to ElementOutput
+template<
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombStochasticRound
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  static constexpr bool IsStochasticRoundSupported = true;
+};
+
 // D = activation(alpha * acc + beta * C)
 template<
   template <class> class ActivationFn_,
@@ -147,6 +163,221 @@ struct LinCombTopKSoftmaxCol
     : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
 };
 
+// D = softmax(top_k(alpha * acc + beta * C)), e.g. the routing weights of a mixture-of-experts router with N experts
+// topk_indices(m, k) = column of the k-th largest element of row m
+// expert_counts(n) += number of rows whose top-k contains column n (atomic, must be zeroed by the user)
+template<
+  int TopK,
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombTopKSoftmaxColRouter
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementIndex = int32_t;
+};
+
+// Z = alpha * acc + beta * C
+// row_max(m, n_blk) = max(Z(m, n_blk * EPI_N : (n_blk + 1) * EPI_N))
+// D = exp(Z - row_max), row_sum(m, n_blk) = sum(D(m, n_blk * EPI_N : (n_blk + 1) * EPI_N))
+// softmax(Z) = D * exp(row_max - max(row_max, axis=1)) / sum(row_sum * exp(row_max - max(row_max, axis=1)), axis=1),
+// applied in place by reduction::device::SoftmaxPartialFinalize, or in the epilogue if N <= EPI_N
+template<
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementPartial_ = float,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombSoftmaxPartialCol
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementPartial = ElementPartial_;
+};
+
+// Z = alpha * acc + beta * C
+// scale(m, n_blk) = max(abs(Z(m, n_blk * EPI_N : (n_blk + 1) * EPI_N))) / max(ElementOutput)
+// D = Z / scale
+// row_amax = max(abs(Z), axis=1) (optional)
+template<
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementScaleFactor_ = ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombPerRowQuantAmax
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementScaleFactor = ElementScaleFactor_;
+  using ElementAmax = ElementCompute_;
+  static constexpr bool IsAbsMaxSupported = true;
+};
+
+// D = alpha * acc + beta * C on and below (FillMode::kLower) or above (FillMode::kUpper) the diagonal
+// D = C elsewhere, so that an in-place update (D == C) leaves the other triangle unchanged
+// C is read even if beta is zero
+template<
+  FillMode FillMode_,
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombTriangular
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  static constexpr FillMode kFillMode = FillMode_;
+};
+
+// D_blocks = alpha * acc + beta * C on the non-zero blocks of a BSR output mask, as for sampled dense-dense
+// matrix products (SDDMM). Blocks have the CTA tile shape and are written in BSR order. D is typically void.
+template<
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombBlockSparse
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementAux = ElementOutput_;
+};
+
+// D = alpha * acc + beta * C
+// D_compressed, E = compress(prune(D)), the structured sparse A operand of a consuming GEMM
+// with sparse configuration SparseConfig, pruned by magnitude along N
+template<
+  class SparseConfig_,
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombSparseCompress
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using SparseConfig = SparseConfig_;
+};
+
+// Z = alpha * acc + beta * C, where C is typically the residual
+// D = Z
+// row_sum_sq = sum(Z * Z, axis=1)
+// row_sum = sum(Z, axis=1) (optional, LayerNorm only)
+template<
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombRowNormStatistics
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementStatistic = ElementCompute_;
+};
+
+// D = alpha * acc + beta * C
+// col_sum = sum(Z, axis=0)
+// col_sum_sq = sum(Z * Z, axis=0)
+// where Z = alpha * acc + beta * C before the conversion to ElementOutput. For conv fprop/dgrad the columns
+// are the output channels, which gives the BatchNorm statistics of the conv output: mean = col_sum / (N*Z*P*Q)
+// and var = col_sum_sq / (N*Z*P*Q) - mean * mean
+template<
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementStatistic_ = float,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombBatchNormStatistics
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementStatistic = ElementStatistic_;
+};
+
+// Applies the RMSNorm/LayerNorm of A described by the row statistics of LinCombRowNormStatistics, so that
+// D = alpha * (norm(A) @ B) + bias + beta * C without materializing norm(A):
+// mean = row_sum / norm_extent (0 for RMSNorm)
+// rstd = rsqrt(row_sum_sq / norm_extent - mean * mean + epsilon)
+// D = alpha * rstd * (acc - mean * col_weight_sum) + bias + beta * C
+// where the norm weight gamma is folded into B along K, col_weight_sum = sum(B, axis=0) (LayerNorm only)
+// and bias = shift @ B for the LayerNorm shift
+template<
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementBias_ = ElementOutput_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  int AlignmentBias_ = 128 / cute::sizeof_bits_v<ElementBias_>,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct RowNormLinCombPerColBias
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementBias = ElementBias_;
+  using ElementStatistic = ElementCompute_;
+  static constexpr int AlignmentBias = AlignmentBias_;
+};
+
+// Z = alpha * acc + beta * C, e.g. the logits of the LM-head GEMM of a language model
+// D = Z, typically with ElementD = void so that the logits are not written
+// lse = log(sum(exp(Z), axis=1))
+// loss = lse - Z(m, target(m)), 0 where target(m) == ignore_index
+template<
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementStatistic_ = float,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombCrossEntropy
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementStatistic = ElementStatistic_;
+  using ElementTarget = int32_t;
+};
+
+// Z = alpha * acc + beta * C, the logits recomputed from the operands of LinCombCrossEntropy
+// D = dloss * (exp(Z - lse) - onehot(target)), 0 in rows where target(m) == ignore_index
+// where lse is written by LinCombCrossEntropy and dloss is a per-row vector or a scalar
+template<
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombCrossEntropyGrad
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementTarget = int32_t;
+};
+
+// Z = alpha * acc + beta * C
+// D = scale * Z0 * activation(Z1), written through the aux tensor at half the size of Z, where
+//   ModeIndex = 0: Z0 and Z1 alternate along M in groups of 8 rows, Z has an (8,2,M/16) mode-0
+//   ModeIndex = 1: Z0 and Z1 alternate along N in adjacent columns, D has N/2 columns
+template<
+  bool Quantize, // whether to quantize output with a per-tensor scale factor
+  template <class> class ActivationFn,
+  class GmemLayoutTagOutput,
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  class ElementIntermediate_ = ElementOutput_,
+  int Alignment = 128 / cute::sizeof_bits_v<ElementOutput_>,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest,
+  int ModeIndex = 0
+>
+struct LinCombGatedActFunc
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementAux = ElementOutput_;
+  using GmemLayoutTagAux = GmemLayoutTagOutput;
+  static constexpr int AlignmentAux = Alignment;
+  static constexpr bool IsAuxOutSupported = true;
+};
+
 
 // D = alpha * acc + beta * C + per-row bias
 template<
@@ -336,6 +567,46 @@ struct PerColResAddPerColBiasEltAct
   static constexpr bool IsResidualSupported = true;
 };
 
+// Z = per-col alpha * acc + per-col beta * C + per-column bias
+// amax_d = max(abs(elements in activation(Z)))
+// D = scale_d * activation(Z)
+// Covers quantized inference blocks (e.g. folded batchnorm + residual + relu to fp8/int8 output)
+template<
+  template <class> class ActivationFn_,
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementAmax_ = ElementCompute_,
+  class ElementBias_ = ElementOutput_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_, // per-col alpha/beta
+  int AlignmentBias_ = 128 / cute::sizeof_bits_v<ElementBias_>,
+  int AlignmentScalar_ = 128 / cute::sizeof_bits_v<ElementScalar_>,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct PerColLinCombPerColBiasEltActAmaxQuant
+    : PerColLinCombPerColBiasEltAct<ActivationFn_, ElementOutput_, ElementCompute_,
+        ElementBias_, ElementSource_, ElementScalar_, AlignmentBias_, AlignmentScalar_, RoundStyle_> {
+  using ElementAmax = ElementAmax_;
+  static constexpr bool IsAbsMaxSupported = true;
+};
+
+// D = alpha * per-row scale * per-col scale * acc + beta * C
+// Dequantizes integer GEMMs with per-token (row) and per-channel (column) scales, e.g. SmoothQuant
+template<
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementScale_ = ElementCompute_, // per-row and per-col scales
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  int AlignmentScale_ = 128 / cute::sizeof_bits_v<ElementScale_>,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombPerRowScalePerColScale
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementScale = ElementScale_;
+  static constexpr int AlignmentScale = AlignmentScale_;
+};
+
 // Z = scale_a * scale_b * alpha * acc + beta * scale_c * C + per-row bias
 // if D is fp8 
 //   D = scale_d * activation(Z)
@@ -452,6 +723,39 @@ struct ScaledLinCombPerColBiasEltActAmaxAux
   static constexpr bool IsAuxOutSupported = true;
 };
 
+// Z = scale_a * scale_b * alpha * acc + scale_c * beta * C
+// if D is fp8
+//   amax_d = max(abs(elements in activation(Z)))
+//   D = scale_d * activation(Z)
+// else
+//   D = activation(Z)
+// D is stored in its own layout and again in GmemLayoutTagTransposed (typically the opposite major) from the
+// same converted values, e.g. to produce both the forward operand and the K-major wgrad operand of fp8 training
+template<
+  class GmemLayoutTagTransposed_,
+  template <class> class ActivationFn_,
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementAmax_ = ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  int AlignmentTransposed_ = 128 / cute::sizeof_bits_v<ElementOutput_>,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct ScaledLinCombEltActAmaxDualLayout
+    : LinCombEltAct<ActivationFn_, ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  static constexpr bool IsScaleFactorSupported = true;
+
+  using ElementAmax = ElementAmax_;
+  static constexpr bool IsAbsMaxSupported = true;
+
+  // The second copy of D is an aux output of the same element type
+  using ElementAux = ElementOutput_;
+  using GmemLayoutTagAux = GmemLayoutTagTransposed_;
+  static constexpr int AlignmentAux = AlignmentTransposed_;
+  static constexpr bool IsAuxOutSupported = true;
+};
+
 // Z = Aux
 // dY = alpha * acc + beta * C
 // D = d_activation(dY, Z)
@@ -502,6 +806,31 @@ struct LinCombDeEltActDePerRowBias
   static constexpr bool IsDePerRowBiasSupported = true;
 };
 
+// Z = Aux
+// dY = alpha * acc + beta * C
+// D = d_activation(dY, Z)
+// dBias = sum of rows of D
+template<
+  class GmemLayoutTagAux_,
+  template <class> class ActivationFn_,
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementAux_ = ElementOutput_,
+  class ElementBias_ = ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  int AlignmentAux_ = 128 / cute::sizeof_bits_v<ElementAux_>,
+  int AlignmentBias_ = 128 / cute::sizeof_bits_v<ElementBias_>,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombDeEltActDePerColBias
+    : LinCombDeEltAct<GmemLayoutTagAux_, ActivationFn_, ElementOutput_, ElementCompute_,
+        ElementAux_, ElementSource_, ElementScalar_, AlignmentAux_, RoundStyle_> {
+  using ElementBias = ElementBias_;
+  static constexpr int AlignmentBias = AlignmentBias_;
+  static constexpr bool IsDePerColBiasSupported = true;
+};
+
 template<
   int SFVecSize_,
   class ElementOutput_,
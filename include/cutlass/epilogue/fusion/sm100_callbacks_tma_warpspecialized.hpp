@@ -160,10 +160,11 @@ template<
   class ElementBlockScaleFactor, 
   class ElementSource = ElementOutput,
   class ElementScalar = ElementCompute,
-  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest,
+  class BlockScaledOutputConfig = cutlass::detail::Sm1xxBlockScaledOutputConfig<SFVecsize>
 >
 using Sm100LinearCombRowBlockScaleFactor =
-  Sm90EVT<Sm100BlockScaleFactorRowStore<SFVecsize, EpilogueTile, ElementOutput, ElementCompute, ElementBlockScaleFactor, RoundStyle>, // gen scalefactor
+  Sm90EVT<Sm100BlockScaleFactorRowStore<SFVecsize, EpilogueTile, ElementOutput, ElementCompute, ElementBlockScaleFactor, RoundStyle, BlockScaledOutputConfig>, // gen scalefactor
     Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // beta * C + (alpha * acc)
   >;
 
@@ -1280,6 +1281,166 @@ struct FusionCallbacks<
 };
 
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// D = softmax(top_k(alpha * acc + beta * C))
+//   The sm100 epilogue keeps visited results in the output type, so the sm90 tree is rooted
+//   with a conversion and the top-k node applies softmax to the converted results.
+template<
+  class TopKSoftmaxTree,
+  class ElementOutput,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm100TopKSoftmaxColOutput =
+  Sm90EVT<Sm90Compute<cutlass::epilogue::thread::Identity, ElementOutput, ElementCompute, RoundStyle>, // Identity for final conversion
+    TopKSoftmaxTree
+  >;
+
+template <
+  int TopK,
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm100TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombTopKSoftmaxCol<TopK, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm100TopKSoftmaxColOutput<
+      Sm90LinCombTopKSoftmaxCol<TopK, FragmentSize, CtaTileShapeMNK, EpilogueTile, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementSource, ElementScalar, RoundStyle>,
+      ElementOutput, ElementCompute, RoundStyle> {
+
+  using Impl = Sm100TopKSoftmaxColOutput<
+      Sm90LinCombTopKSoftmaxCol<TopK, FragmentSize, CtaTileShapeMNK, EpilogueTile, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementSource, ElementScalar, RoundStyle>,
+      ElementOutput, ElementCompute, RoundStyle>;
+  using Operation = fusion::LinCombTopKSoftmaxCol<TopK, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+
+  using Sm90Arguments = typename FusionCallbacks<
+      epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+      Operation, CtaTileShapeMNK, EpilogueTile>::Arguments;
+
+  struct Arguments : Sm90Arguments {
+    operator typename Impl::Arguments() const {
+      return
+        {
+          static_cast<Sm90Arguments const&>(*this), // top_k_softmax(beta * C + (alpha * acc))
+          {} // unary args: identity
+        };
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+template <
+  int TopK,
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm100TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombTopKSoftmaxColRouter<TopK, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm100TopKSoftmaxColOutput<
+      Sm90LinCombTopKSoftmaxColRouter<TopK, FragmentSize, CtaTileShapeMNK, EpilogueTile, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementSource, ElementScalar, RoundStyle>,
+      ElementOutput, ElementCompute, RoundStyle> {
+
+  using Impl = Sm100TopKSoftmaxColOutput<
+      Sm90LinCombTopKSoftmaxColRouter<TopK, FragmentSize, CtaTileShapeMNK, EpilogueTile, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementSource, ElementScalar, RoundStyle>,
+      ElementOutput, ElementCompute, RoundStyle>;
+  using Operation = fusion::LinCombTopKSoftmaxColRouter<TopK, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+
+  using Sm90Arguments = typename FusionCallbacks<
+      epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+      Operation, CtaTileShapeMNK, EpilogueTile>::Arguments;
+
+  struct Arguments : Sm90Arguments {
+    operator typename Impl::Arguments() const {
+      return
+        {
+          static_cast<Sm90Arguments const&>(*this), // top_k_softmax(beta * C + (alpha * acc))
+          {} // unary args: identity
+        };
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+
+// D = exp(alpha * acc + beta * C - row_max), with the per-row max and sum of exponentials of each epilogue tile
+//   As for top-K + softmax, the sm90 tree is rooted with a conversion and the partial softmax
+//   node exponentiates the converted results.
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementPartial,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm100TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombSoftmaxPartialCol<ElementOutput, ElementCompute, ElementPartial, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90EVT<Sm90Compute<cutlass::epilogue::thread::Identity, ElementOutput, ElementCompute, RoundStyle>,
+      Sm90LinCombSoftmaxPartialCol<FragmentSize, CtaTileShapeMNK, EpilogueTile, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementPartial, ElementSource, ElementScalar, RoundStyle>> {
+
+  using Impl = Sm90EVT<Sm90Compute<cutlass::epilogue::thread::Identity, ElementOutput, ElementCompute, RoundStyle>,
+      Sm90LinCombSoftmaxPartialCol<FragmentSize, CtaTileShapeMNK, EpilogueTile, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementPartial, ElementSource, ElementScalar, RoundStyle>>;
+  using Operation = fusion::LinCombSoftmaxPartialCol<ElementOutput, ElementCompute, ElementPartial, ElementSource, ElementScalar, RoundStyle>;
+
+  using Sm90Arguments = typename FusionCallbacks<
+      epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+      Operation, CtaTileShapeMNK, EpilogueTile>::Arguments;
+
+  struct Arguments : Sm90Arguments {
+    operator typename Impl::Arguments() const {
+      return
+        {
+          static_cast<Sm90Arguments const&>(*this), // partial_softmax(beta * C + (alpha * acc))
+          {} // unary args: identity
+        };
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+
 // --------------------------------------------------------------------
 //  Sm100PtrArrayNoSmemWarpSpecialized  (direct-store, grouped GEMM)
 // --------------------------------------------------------------------
@@ -39,6 +39,7 @@
 
 #include "cutlass/cutlass.h"
 #include "cutlass/detail/sm100_blockscaled_layout.hpp" 
+#include "cutlass/detail/sm103_blockscaled_layout.hpp"
 #include "cute/tensor.hpp"
 #include "cutlass/epilogue/fusion/sm90_visitor_tma_warpspecialized.hpp"
 #include "cutlass/detail/helper_macros.hpp"
@@ -105,7 +106,9 @@ template <
   class ElementOutput,
   class ElementCompute,
   class ElementBlockScaleFactor,
-  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest,
+  // Layout of the stored scale factors. Sm103BlockScaledOutputConfig writes them for an SM103 block scaled GEMM.
+  class BlockScaledOutputConfig = cutlass::detail::Sm1xxBlockScaledOutputConfig<SFVecSize>
 >
 struct Sm100BlockScaleFactorRowStore {
   static_assert(size<1>(EpilogueTile{}) % SFVecSize == 0, "EpilogueTileN should be divisible by SFVecSize");
@@ -284,7 +287,7 @@ struct Sm100BlockScaleFactorRowStore {
 
     auto [M, N, K, L] = args.problem_shape_mnkl;
     auto [tile_coord_m, tile_coord_n, tile_coord_k, tile_coord_l] = args.tile_coord_mnkl;
-    using Sm1xxBlockScaledOutputConfig= cutlass::detail::Sm1xxBlockScaledOutputConfig<SFVecSize>;
+    static_assert(BlockScaledOutputConfig::SFVecSize == SFVecSize, "Mismatched scale factor vector size.");
     UnderlyingElementBlockScaleFactor* ptr_scale_factor = nullptr;
     // If Ptr-Array/Grouped GEMM with BlockScaleFactor per batch/group
     if constexpr (!cute::is_same_v<UnderlyingElementBlockScaleFactor, ElementBlockScaleFactor>) {
@@ -296,7 +299,7 @@ struct Sm100BlockScaleFactorRowStore {
     }
 
     auto epi_tile_mn = shape<1>(zipped_divide(make_layout(take<0,2>(args.tile_shape_mnk)), args.epi_tile));
-    Tensor mSFD = make_tensor(make_gmem_ptr(ptr_scale_factor), Sm1xxBlockScaledOutputConfig::tile_atom_to_shape_SFD(args.problem_shape_mnkl));
+    Tensor mSFD = make_tensor(make_gmem_ptr(ptr_scale_factor), BlockScaledOutputConfig::tile_atom_to_shape_SFD(args.problem_shape_mnkl));
     static_assert(size<1>(EpilogueTile{}) && ((size<1>(EpilogueTile{}) & (size<1>(EpilogueTile{}) - 1)) == 0), "Epilogue Tile N should be pow of 2");
     Tensor gSFD = local_tile(mSFD, args.epi_tile, make_coord(_,_,tile_coord_l));                   // (EPI_M,EPI_N, #EPI_Ms, #EPI_Ns)
     Tensor tCgSFD = sm90_partition_for_epilogue<ReferenceSrc>(                                     // (CPY,CPY_M,CPY_N,EPI_M,EPI_N,#EPI_Ms, #EPI_Ns)
@@ -47,6 +47,13 @@
 #include "cutlass/epilogue/fusion/sm90_visitor_compute_tma_warpspecialized.hpp"
 
 #include "cutlass/epilogue/fusion/sm90_visitor_topk_softmax.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_amax_quantize.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_softmax_partial.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_sparse_compress.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_block_sparse_store.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_gated_act.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_triangular.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_cross_entropy.hpp"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -57,6 +64,35 @@ namespace cutlass::epilogue::fusion {
 template <class NodeOp, class... ChildOps>
 using Sm90EVT = Sm90TreeVisitor<NodeOp, ChildOps...>;
 
+// Sm90 direct store callbacks alias to sm90 tma callbacks with 0 stages
+// Additional copy atom args will be ignored in the 0-stage specializations of aux load/store nodes
+template <
+  class Operation,
+  class CtaTile_MNK,
+  class EpilogueTile_MN,
+  class... Args
+>
+struct FusionCallbacks<
+    epilogue::Sm90NoSmemWarpSpecialized,
+    Operation,
+    CtaTile_MNK,
+    EpilogueTile_MN,
+    Args...
+> : FusionCallbacks<
+      epilogue::Sm90TmaWarpSpecialized<0, 0, 0, false, false>,
+      Operation,
+      CtaTile_MNK,
+      EpilogueTile_MN,
+      Args...
+    > {
+  using FusionCallbacks<
+      epilogue::Sm90TmaWarpSpecialized<0, 0, 0, false, false>,
+      Operation,
+      CtaTile_MNK,
+      EpilogueTile_MN,
+      Args...>::FusionCallbacks;
+};
+
 // D = alpha * acc
 template <
   int StagesC,
@@ -245,6 +281,82 @@ struct FusionCallbacks<
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+// D = stochastic_round(alpha * acc + beta * C)
+template<
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombStochasticRound =
+  Sm90EVT<Sm90StochasticRound<ElementOutput, ElementCompute, RoundStyle>, // stochastic_round(Z)
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // Z = beta * C + (alpha * acc)
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombStochasticRound<ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombStochasticRound<typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombStochasticRound<typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombStochasticRound<ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    using StrideBeta  = Stride<_0,_0,int64_t>;
+    StrideAlpha dAlpha = {_0{}, _0{}, 0};
+    StrideBeta  dBeta  = {_0{}, _0{}, 0};
+
+    // Philox seed of the stochastic rounding, seed_ptr takes precedence if non-null
+    uint64_t seed = 0;
+    uint64_t const* seed_ptr = nullptr;
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op : stochastic_round(beta * C + (alpha * acc))
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}, {dBeta}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}, {dAlpha}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          {seed, seed_ptr} // unary args : stochastic_round
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 // D = alpha * acc + beta * C, where beta and alpha can be vectors for each batch
 template<
   class ElementOutput,
@@ -1470,6 +1582,120 @@ struct FusionCallbacks<
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+// D = alpha * per-row scale * per-col scale * acc + beta * C
+template<
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementScale = ElementCompute,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  int AlignmentScale = 128 / sizeof_bits_v<ElementScale>,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombPerRowScalePerColScale =
+  Sm90EVT<Sm90Compute<homogeneous_multiply_add, ElementOutput, ElementCompute, RoundStyle>, // beta * C + (alpha * row_scale * col_scale * acc)
+    Sm90ScalarBroadcast<ElementScalar, Stride<_0,_0,int64_t>>, // beta
+    Sm90SrcFetch<ElementSource>, // C
+    Sm90EVT<Sm90Compute<multiplies, ElementCompute, ElementCompute, RoundStyle>, // alpha * row_scale * col_scale * acc
+      Sm90ScalarBroadcast<ElementScalar, Stride<_0,_0,int64_t>>, // alpha
+      Sm90EVT<Sm90Compute<multiplies, ElementCompute, ElementCompute, RoundStyle>, // row_scale * col_scale * acc
+        Sm90ColBroadcast<0, CtaTileShapeMNK, ElementScale, ElementCompute, Stride<_1,_0,int64_t>, AlignmentScale>, // row_scale
+        Sm90EVT<Sm90Compute<multiplies, ElementCompute, ElementCompute, RoundStyle>, // col_scale * acc
+          Sm90RowBroadcast<0, CtaTileShapeMNK, ElementScale, ElementCompute, Stride<_0,_1,int64_t>, AlignmentScale>, // col_scale
+          Sm90AccFetch // acc
+        >
+      >
+    >
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementScale,
+  class ElementSource,
+  class ElementScalar,
+  int AlignmentScale,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombPerRowScalePerColScale<
+      ElementOutput, ElementCompute, ElementScale, ElementSource, ElementScalar, AlignmentScale, RoundStyle
+    >,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombPerRowScalePerColScale<
+      CtaTileShapeMNK, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute,
+      ElementScale, ElementSource, ElementScalar, AlignmentScale, RoundStyle
+    > {
+
+  using Impl =
+    Sm90LinCombPerRowScalePerColScale<
+      CtaTileShapeMNK, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute,
+      ElementScale, ElementSource, ElementScalar, AlignmentScale, RoundStyle
+    >;
+  using Operation =
+    fusion::LinCombPerRowScalePerColScale<
+      ElementOutput, ElementCompute, ElementScale, ElementSource, ElementScalar, AlignmentScale, RoundStyle
+    >;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    using StrideBeta  = Stride<_0,_0,int64_t>;
+    StrideAlpha dAlpha = {_0{}, _0{}, 0};
+    StrideBeta  dBeta  = {_0{}, _0{}, 0};
+
+    // A null scale pointer is treated as a vector of ones
+    using StrideRowScale = Stride<_1,_0,int64_t>;
+    ElementScale const* row_scale_ptr = nullptr;
+    StrideRowScale dRowScale = {};
+
+    using StrideColScale = Stride<_0,_1,int64_t>;
+    ElementScale const* col_scale_ptr = nullptr;
+    StrideColScale dColScale = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // ternary op : beta * C + (alpha * row_scale * col_scale * acc)
+          {{beta}, {beta_ptr}, {dBeta}}, // leaf args : beta
+          {},                   // leaf args : C
+          {                     // binary op : alpha * row_scale * col_scale * acc
+            {{alpha}, {alpha_ptr}, {dAlpha}}, // leaf args : alpha
+            {                       // binary op : row_scale * col_scale * acc
+              {row_scale_ptr, ElementScale(1), dRowScale}, // leaf args : row_scale
+              {                                            // binary op : col_scale * acc
+                {col_scale_ptr, ElementScale(1), dColScale}, // leaf args : col_scale
+                {},                                          // leaf args : acc
+                {}                  // binary args : multiplies
+              },                    // end binary op
+              {}                    // binary args : multiplies
+            },                      // end binary op
+            {}                      // binary args : multiplies
+          },                        // end binary op
+          {} // ternary args : multiply_add
+        };   // end ternary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace detail {
 
 template <typename T>
@@ -1488,6 +1714,130 @@ using amax = cutlass::maximum_absolute_value_reduction<T, true>; // propogate na
 
 }; // end namespace detail
 
+// Z = per-col alpha * acc + per-col beta * C + per-column bias
+// amax_d = max(abs(elements in activation(Z)))
+// D = scale_d * activation(Z)
+template<
+  int StagesC,
+  class CtaTileShapeMNK,
+  class EpilogueTile,
+  template <class> class ActivationFn,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementAmax = ElementCompute,
+  class ElementBias = ElementOutput,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  int AlignmentBias = 128 / sizeof_bits_v<ElementBias>,
+  int AlignmentScalar = 128 / sizeof_bits_v<ElementScalar>,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90PerColLinCombPerColBiasEltActAmaxQuant =
+  Sm90EVT<Sm90Compute<cutlass::multiplies, ElementOutput, ElementCompute, RoundStyle>, // activation(Z) * scale_d
+    Sm90EVT<Sm90ScalarReduction<detail::amax, atomic_maximum, ElementAmax, ElementCompute, RoundStyle>, // amax_d
+      Sm90EVT<Sm90Compute<ActivationFn, ElementCompute, ElementCompute, RoundStyle>, // activation(Z)
+        Sm90PerColLinCombPerColBias<StagesC, CtaTileShapeMNK, EpilogueTile, ElementCompute, ElementCompute,
+                                    ElementBias, ElementSource, ElementScalar, AlignmentBias, AlignmentScalar, RoundStyle> // Z
+      >
+    >,
+    Sm90ScalarBroadcast<ElementScalar> // scale_d
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  template <class> class ActivationFn,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementAmax,
+  class ElementBias,
+  class ElementSource,
+  class ElementScalar,
+  int AlignmentBias,
+  int AlignmentScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::PerColLinCombPerColBiasEltActAmaxQuant<
+      ActivationFn, ElementOutput, ElementCompute, ElementAmax, ElementBias, ElementSource, ElementScalar, AlignmentBias, AlignmentScalar, RoundStyle
+    >,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90PerColLinCombPerColBiasEltActAmaxQuant<
+      StagesC, CtaTileShapeMNK, EpilogueTile, ActivationFn, ElementOutput, ElementCompute, ElementAmax, ElementBias, ElementSource, ElementScalar, AlignmentBias, AlignmentScalar, RoundStyle
+    > {
+
+  using Impl =
+    Sm90PerColLinCombPerColBiasEltActAmaxQuant<
+      StagesC, CtaTileShapeMNK, EpilogueTile, ActivationFn, ElementOutput, ElementCompute, ElementAmax, ElementBias, ElementSource, ElementScalar, AlignmentBias, AlignmentScalar, RoundStyle
+    >;
+  using Operation =
+    fusion::PerColLinCombPerColBiasEltActAmaxQuant<
+      ActivationFn, ElementOutput, ElementCompute, ElementAmax, ElementBias, ElementSource, ElementScalar, AlignmentBias, AlignmentScalar, RoundStyle
+    >;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    ElementScalar scale_d = ElementScalar(1);
+    ElementScalar const* scale_d_ptr = nullptr;
+
+    using StrideAlpha = Stride<_0,bool,int64_t>;
+    using StrideBeta  = Stride<_0,bool,int64_t>;
+    StrideAlpha dAlpha = {_0{}, bool(1), 0};
+    StrideBeta  dBeta  = {_0{}, bool(1), 0};
+
+    using StrideBias = Stride<_0,_1,int64_t>;
+    ElementBias const* bias_ptr = nullptr;
+    StrideBias dBias = {};
+
+    using ActivationArguments = typename Sm90Compute<ActivationFn, ElementOutput, ElementCompute, RoundStyle>::Arguments;
+    ActivationArguments activation = ActivationArguments();
+
+    // amax_d is skipped if null
+    ElementAmax* amax_D_ptr = nullptr;
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // binary op : activation(beta * C + (alpha * acc + bias)) * scale_d
+          {    // unary op : amax_d = max(abs(activation(beta * C + (alpha * acc + bias))))
+            {    // unary op : activation(beta * C + (alpha * acc + bias))
+              {    // ternary op : beta * C + (alpha * acc + bias)
+                {beta_ptr, beta, dBeta}, // leaf args : beta
+                {},                      // leaf args : C
+                {                        // ternary op : alpha * acc + bias
+                  {alpha_ptr, alpha, dAlpha},        // leaf args : alpha
+                  {},                                // leaf args : acc
+                  {bias_ptr, ElementBias(0), dBias}, // leaf args : bias
+                  {}                     // ternary args : multiply_add
+                },                       // end ternary op
+                {} // ternary args : multiply_add
+              },   // end ternary op
+              activation // unary args : activation
+            },   // end unary op
+            {amax_D_ptr} // unary args : amax_d
+          },   // end unary op
+          {{scale_d}, {scale_d_ptr}}, // leaf args : scale_d
+          {} // binary args : multiplies
+        };   // end binary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 // D = scale_a * scale_b * alpha * acc + scale_c * beta * C + per-row bias
 template<
   class CtaTileShapeMNK,
@@ -2424,32 +2774,201 @@ struct FusionCallbacks<
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Z = scale_a * scale_b * alpha * acc + scale_c * beta * C
+// if D is fp8
+//   amax_d = max(abs(elements in activation(Z)))
+//   D = scale_d * activation(Z)
+// else
+//   D = activation(Z)
+// D is also stored through the aux TMA store in the layout of StrideTransposed. The aux node receives the
+// values already converted to ElementOutput, so both copies share amax_d, scale_d and rounding bit for bit.
 template<
   class CtaTileShapeMNK,
   class EpilogueTile,
-  int Stages,
-  class StrideAux,
+  int StagesD,
+  class StrideTransposed,
   class SmemLayoutAtom,
-  class CopyOpS2R,
+  class CopyOpR2S,
   template <class> class ActivationFn,
   class ElementOutput,
   class ElementCompute,
-  class ElementAux = ElementOutput,
+  class ElementAmax = ElementCompute,
   class ElementSource = ElementOutput,
   class ElementScalar = ElementCompute,
-  int AlignmentAux = 128 / sizeof_bits_v<ElementAux>,
+  int AlignmentTransposed = 128 / sizeof_bits_v<ElementOutput>,
   FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
 >
-using Sm90LinCombDeEltAct =
-  Sm90EVT<Sm90Compute<ActivationFn, ElementOutput, ElementCompute, RoundStyle>, // activation(beta * C + (alpha * acc), aux)
-    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle>, // beta * C + (alpha * acc)
-    Sm90AuxLoad<Stages, EpilogueTile, ElementAux, StrideAux, SmemLayoutAtom, CopyOpS2R, AlignmentAux> // aux
-  >;
-
-template <
-  int StagesC,
-  int StagesD,
-  int FragmentSize,
+using Sm90ScaledLinCombEltActAmaxDualLayout =
+  Sm90EVT<Sm90AuxStore<StagesD, EpilogueTile, ElementOutput, RoundStyle, StrideTransposed, SmemLayoutAtom, CopyOpR2S, AlignmentTransposed>, // store(D) in the second layout
+    Sm90EVT<Sm90Compute<detail::ScaleOutOp<ElementOutput>::template Op, ElementOutput, ElementCompute, RoundStyle>, // activation(Z) * scale_d
+      Sm90EVT<Sm90ScalarReduction<detail::amax, atomic_maximum, ElementAmax, ElementCompute, RoundStyle>, // amax_d
+        Sm90EVT<Sm90Compute<ActivationFn, ElementCompute, ElementCompute, RoundStyle>, // activation(Z)
+          Sm90EVT<Sm90Compute<homogeneous_multiply_add, ElementCompute, ElementCompute, RoundStyle>, // beta * C + (alpha * acc)
+            Sm90ScalarBroadcast<ElementScalar, Stride<_0,_0,int64_t>, 2>, // scale_c * beta
+            Sm90SrcFetch<ElementSource>, // C
+            Sm90EVT<Sm90Compute<multiplies, ElementCompute, ElementCompute, RoundStyle>, // alpha * acc
+              Sm90ScalarBroadcast<ElementScalar, Stride<_0,_0,int64_t>, 3>, // scale_a * scale_b * alpha
+              Sm90AccFetch // acc
+            >
+          >
+        >
+      >,
+      Sm90ScalarBroadcast<ElementScalar> // scale_d
+    >
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class GmemLayoutTagTransposed,
+  template <class> class ActivationFn,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementAmax,
+  class ElementSource,
+  class ElementScalar,
+  int AlignmentTransposed,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile,
+  class SmemLayoutAtom,
+  class CopyOpR2S
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::ScaledLinCombEltActAmaxDualLayout<
+      GmemLayoutTagTransposed, ActivationFn, ElementOutput, ElementCompute,
+      ElementAmax, ElementSource, ElementScalar, AlignmentTransposed, RoundStyle
+    >,
+    CtaTileShapeMNK,
+    EpilogueTile,
+    SmemLayoutAtom,
+    CopyOpR2S
+> : Sm90ScaledLinCombEltActAmaxDualLayout<
+      CtaTileShapeMNK, EpilogueTile, StagesD, cutlass::gemm::TagToStrideC_t<GmemLayoutTagTransposed>,
+      SmemLayoutAtom, CopyOpR2S, ActivationFn,
+      ElementOutput, ElementCompute, ElementAmax, ElementSource, ElementScalar, AlignmentTransposed, RoundStyle
+    > {
+
+  using Impl =
+    Sm90ScaledLinCombEltActAmaxDualLayout<
+      CtaTileShapeMNK, EpilogueTile, StagesD, cutlass::gemm::TagToStrideC_t<GmemLayoutTagTransposed>,
+      SmemLayoutAtom, CopyOpR2S, ActivationFn,
+      ElementOutput, ElementCompute, ElementAmax, ElementSource, ElementScalar, AlignmentTransposed, RoundStyle
+    >;
+  using Operation =
+    fusion::ScaledLinCombEltActAmaxDualLayout<
+      GmemLayoutTagTransposed, ActivationFn, ElementOutput, ElementCompute,
+      ElementAmax, ElementSource, ElementScalar, AlignmentTransposed, RoundStyle
+    >;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    ElementScalar scale_a = ElementScalar(1);
+    ElementScalar scale_b = ElementScalar(1);
+    ElementScalar scale_c = ElementScalar(1);
+    ElementScalar scale_d = ElementScalar(1);
+    ElementScalar const* scale_a_ptr = nullptr;
+    ElementScalar const* scale_b_ptr = nullptr;
+    ElementScalar const* scale_c_ptr = nullptr;
+    ElementScalar const* scale_d_ptr = nullptr;
+
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    using StrideBeta  = Stride<_0,_0,int64_t>;
+    StrideAlpha dAlpha = {_0{}, _0{}, 0};
+    StrideBeta  dBeta  = {_0{}, _0{}, 0};
+
+    using ActivationArguments = typename Sm90Compute<ActivationFn, ElementOutput, ElementCompute, RoundStyle>::Arguments;
+    ActivationArguments activation = ActivationArguments();
+
+    ElementAmax* amax_D_ptr = nullptr;
+
+    // Second copy of D, e.g. column-major for a row-major D
+    using StrideTransposed = cutlass::gemm::TagToStrideC_t<GmemLayoutTagTransposed>;
+    ElementOutput* transposed_ptr = nullptr;
+    StrideTransposed dTransposed = {};
+
+    operator typename Impl::Arguments() const {
+      // Only compute amax_d if D is fp8
+      ElementAmax* amax_D_ptr_ = nullptr;
+      if constexpr (detail::is_fp8_v<ElementOutput>) {
+        amax_D_ptr_ = amax_D_ptr;
+      }
+
+      return
+        {    // unary op : store(D) in the second layout
+          {    // binary op : activation(Z) * scale_d or activation(Z)
+            {    // unary op : reduce(activation(Z))
+              {    // unary op : activation(Z)
+                {    // ternary op : (scale_c * beta) * C + (scale_a * scale_b * alpha) * acc
+                  {{beta, scale_c},
+                   {beta_ptr, scale_c_ptr},
+                   {dBeta, {_0{}, _0{}, 0}}
+                   },  // leaf args : (scale_c * beta)
+                  {},  // leaf args : C
+                  {    // binary op : (scale_a * scale_b * alpha) * acc
+                    {{alpha, scale_a, scale_b},
+                     {alpha_ptr, scale_a_ptr, scale_b_ptr},
+                     {dAlpha, {_0{}, _0{}, 0}, {_0{}, _0{}, 0}}
+                     },  // leaf args : (scale_a * scale_b * alpha)
+                    {},  // leaf args : acc
+                    {}   // binary args : multiplies
+                  },   // end binary op
+                  {} // ternary args : multiply_add
+                },   // end ternary op
+                activation // unary args : activation
+              },   // end unary op
+              {amax_D_ptr_} // unary args : reduce
+            },   // end unary op
+            {{scale_d},
+             {scale_d_ptr}
+             },  // leaf args : scale_d
+            {} // binary args : multiplies or first
+          },   // end binary op
+          {transposed_ptr, dTransposed} // unary args : store
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<
+  class CtaTileShapeMNK,
+  class EpilogueTile,
+  int Stages,
+  class StrideAux,
+  class SmemLayoutAtom,
+  class CopyOpS2R,
+  template <class> class ActivationFn,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementAux = ElementOutput,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  int AlignmentAux = 128 / sizeof_bits_v<ElementAux>,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombDeEltAct =
+  Sm90EVT<Sm90Compute<ActivationFn, ElementOutput, ElementCompute, RoundStyle>, // activation(beta * C + (alpha * acc), aux)
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle>, // beta * C + (alpha * acc)
+    Sm90AuxLoad<Stages, EpilogueTile, ElementAux, StrideAux, SmemLayoutAtom, CopyOpS2R, AlignmentAux> // aux
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
   bool ReuseSmemC,
   bool DelayTmaStore,
   class GmemLayoutTagAux,
@@ -2663,47 +3182,80 @@ struct FusionCallbacks<
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
-// D = softmax(top_k(alpha * acc + beta * C))
 template<
-  int TopK,
-  int FragmentSize,
   class CtaTileShapeMNK,
   class EpilogueTile,
+  int Stages,
+  class StrideAux,
+  class SmemLayoutAtom,
+  class CopyOpS2R,
+  template <class> class ActivationFn,
   class ElementOutput,
   class ElementCompute,
+  class ElementAux = ElementOutput,
+  class ElementBias = ElementOutput,
   class ElementSource = ElementOutput,
   class ElementScalar = ElementCompute,
+  int AlignmentAux = 128 / sizeof_bits_v<ElementAux>,
+  int AlignmentBias = 128 / sizeof_bits_v<ElementBias>,
   FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
 >
-using Sm90LinCombTopKSoftmaxCol =
-  Sm90EVT<Sm90TopKSoftmaxColReduction<TopK, FragmentSize, CtaTileShapeMNK, EpilogueTile, ElementOutput, ElementCompute, RoundStyle>, // softmax(top_k(beta * C + (alpha * acc)))
-    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // beta * C + (alpha * acc)
+using Sm90LinCombDeEltActDePerColBias =
+  Sm90EVT<Sm90Compute<cutlass::epilogue::thread::Identity, ElementOutput, ElementCompute, RoundStyle>, // Identity for final conversion
+    Sm90EVT<Sm90RowReduction<plus, plus, plus, 0, CtaTileShapeMNK,
+                             ElementBias, ElementCompute, RoundStyle, Stride<_0,_1,int64_t>, AlignmentBias>,
+      Sm90LinCombDeEltAct<CtaTileShapeMNK, EpilogueTile, Stages, StrideAux, SmemLayoutAtom, CopyOpS2R, ActivationFn,
+                          ElementCompute, ElementCompute, ElementAux, ElementSource, ElementScalar, AlignmentAux, RoundStyle>
+    >
   >;
 
 template <
-  int TopK,
   int StagesC,
   int StagesD,
   int FragmentSize,
   bool ReuseSmemC,
   bool DelayTmaStore,
+  class GmemLayoutTagAux,
+  template <class> class ActivationFn,
   class ElementOutput,
   class ElementCompute,
+  class ElementAux,
+  class ElementBias,
   class ElementSource,
   class ElementScalar,
+  int AlignmentAux,
+  int AlignmentBias,
   FloatRoundStyle RoundStyle,
   class CtaTileShapeMNK,
-  class EpilogueTile
+  class EpilogueTile,
+  class SmemLayoutAtom,
+  class CopyOpS2R
 >
 struct FusionCallbacks<
     epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
-    fusion::LinCombTopKSoftmaxCol<TopK, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>,
+    fusion::LinCombDeEltActDePerColBias<
+      GmemLayoutTagAux, ActivationFn, ElementOutput, ElementCompute,
+      ElementAux, ElementBias, ElementSource, ElementScalar, AlignmentAux, AlignmentBias, RoundStyle
+    >,
     CtaTileShapeMNK,
-    EpilogueTile
-> : Sm90LinCombTopKSoftmaxCol<TopK, FragmentSize, CtaTileShapeMNK, EpilogueTile, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle> {
+    EpilogueTile,
+    SmemLayoutAtom,
+    CopyOpS2R
+> : Sm90LinCombDeEltActDePerColBias<
+      CtaTileShapeMNK, EpilogueTile, StagesC, cutlass::gemm::TagToStrideC_t<GmemLayoutTagAux>, SmemLayoutAtom, CopyOpS2R, ActivationFn,
+      ElementOutput, ElementCompute, ElementAux, ElementBias, ElementSource, ElementScalar, AlignmentAux, AlignmentBias, RoundStyle
+    > {
 
-  using Impl = Sm90LinCombTopKSoftmaxCol<TopK, FragmentSize, CtaTileShapeMNK, EpilogueTile, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
-  using Operation = fusion::LinCombTopKSoftmaxCol<TopK, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+  using Impl =
+    Sm90LinCombDeEltActDePerColBias<
+      CtaTileShapeMNK, EpilogueTile, StagesC, cutlass::gemm::TagToStrideC_t<GmemLayoutTagAux>, SmemLayoutAtom, CopyOpS2R, ActivationFn,
+      ElementOutput, ElementCompute, ElementAux, ElementBias, ElementSource, ElementScalar, AlignmentAux, AlignmentBias, RoundStyle
+    >;
+  using Operation =
+    fusion::LinCombDeEltActDePerColBias<
+      GmemLayoutTagAux, ActivationFn, ElementOutput, ElementCompute,
+      ElementAux, ElementBias, ElementSource, ElementScalar, AlignmentAux, AlignmentBias, RoundStyle
+    >;
 
   struct Arguments {
     ElementScalar alpha = ElementScalar(1);
@@ -2711,21 +3263,44 @@ struct FusionCallbacks<
     ElementScalar const* alpha_ptr = nullptr;
     ElementScalar const* beta_ptr = nullptr;
 
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    using StrideBeta  = Stride<_0,_0,int64_t>;
+    StrideAlpha dAlpha = {_0{}, _0{}, 0};
+    StrideBeta  dBeta  = {_0{}, _0{}, 0};
+
+    using ActivationArguments = typename Sm90Compute<ActivationFn, ElementOutput, ElementCompute, RoundStyle>::Arguments;
+    ActivationArguments activation = ActivationArguments();
+
+    using StrideAux = cutlass::gemm::TagToStrideC_t<GmemLayoutTagAux>;
+    ElementAux const* aux_ptr = nullptr;
+    StrideAux dAux = {};
+
+    using StrideBias = Stride<_0,_1,int64_t>;
+    ElementBias* dbias_ptr = nullptr;
+    StrideBias dDbias = {};
+
     operator typename Impl::Arguments() const {
       return
-        {    // unary op: activation(beta * C + (alpha * acc))
-          {    // ternary op : beta * C + (alpha * acc)
-            {{beta}, {beta_ptr}}, // leaf args : beta
-            {},                   // leaf args : C
-            {                     // binary op : alpha * acc
-              {{alpha}, {alpha_ptr}}, // leaf args : alpha
-              {},                     // leaf args : acc
-              {}                  // binary args : multiplies
-            },                    // end binary op
-            {} // ternary args : multiply_add
-          },   // end ternary op
-          {} // unary args: activation
-        };   // end unary op
+      {   // unary op : identity/convert
+        {    // unary op : reduce(activation(beta * C + (alpha * acc), aux))
+          {    // binary op : activation(beta * C + (alpha * acc), aux)
+            {                  // ternary op : beta * C + (alpha * acc)
+              {{beta}, {beta_ptr}, {dBeta}}, // leaf args : beta
+              {},                   // leaf args : C
+              {                     // binary op : alpha * acc
+                {{alpha}, {alpha_ptr}, {dAlpha}}, // leaf args : alpha
+                {},                     // leaf args : acc
+                {}                  // binary args : multiplies
+              },                    // end binary op
+              {}               // ternary args : multiply_add
+            },                 // end ternary op
+            {aux_ptr, ElementAux(0), dAux}, // leaf args : aux
+            activation // binary args : activation
+          },   // end binary op
+          {dbias_ptr, ElementCompute(0), dDbias} // unary args : reduce
+        },   // end unary op
+        {} // unary args : identity/convert
+      };   // end unary op
     }
   };
 
@@ -2735,26 +3310,25 @@ struct FusionCallbacks<
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
-// Grouped Wgrad Conv
+// D = softmax(top_k(alpha * acc + beta * C))
 template<
-  class GroupsPerTile,
+  int TopK,
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class EpilogueTile,
   class ElementOutput,
   class ElementCompute,
   class ElementSource = ElementOutput,
   class ElementScalar = ElementCompute,
   FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
 >
-using Sm90LinearCombinationGroupedWgrad =
-  Sm90EVT<Sm90Compute<homogeneous_multiply_add, ElementOutput, ElementCompute, RoundStyle>, // beta * C + (alpha * acc)
-    Sm90ScalarBroadcast<ElementScalar, Stride<_0,_0,int64_t>>, // beta
-    Sm90SrcFetch<ElementSource>, // C
-    Sm90EVT<Sm90Compute<multiplies, ElementCompute, ElementCompute, RoundStyle>, // alpha * acc
-      Sm90ScalarBroadcast<ElementScalar, Stride<_0,_0,int64_t>>, // alpha
-      Sm90AccFetchGroupedWgrad<GroupsPerTile> // acc
-    >
+using Sm90LinCombTopKSoftmaxCol =
+  Sm90EVT<Sm90TopKSoftmaxColReduction<TopK, FragmentSize, CtaTileShapeMNK, EpilogueTile, ElementOutput, ElementCompute, RoundStyle>, // softmax(top_k(beta * C + (alpha * acc)))
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // beta * C + (alpha * acc)
   >;
 
 template <
+  int TopK,
   int StagesC,
   int StagesD,
   int FragmentSize,
@@ -2766,41 +3340,1181 @@ template <
   class ElementScalar,
   FloatRoundStyle RoundStyle,
   class CtaTileShapeMNK,
-  class EpilogueTile,
-  class GroupsPerTile
+  class EpilogueTile
 >
 struct FusionCallbacks<
     epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
-    fusion::LinearCombinationGroupedWgrad<GroupsPerTile, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>,
+    fusion::LinCombTopKSoftmaxCol<TopK, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>,
     CtaTileShapeMNK,
     EpilogueTile
-> : Sm90LinearCombinationGroupedWgrad<GroupsPerTile, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementSource, ElementScalar, RoundStyle> {
+> : Sm90LinCombTopKSoftmaxCol<TopK, FragmentSize, CtaTileShapeMNK, EpilogueTile, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle> {
 
-  using Impl = Sm90LinearCombinationGroupedWgrad<GroupsPerTile, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
-  using Operation = fusion::LinearCombinationGroupedWgrad<GroupsPerTile, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+  using Impl = Sm90LinCombTopKSoftmaxCol<TopK, FragmentSize, CtaTileShapeMNK, EpilogueTile, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombTopKSoftmaxCol<TopK, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
 
   struct Arguments {
     ElementScalar alpha = ElementScalar(1);
     ElementScalar beta = ElementScalar(0);
-    //ElementScalar groups = ElementScalar(1);
     ElementScalar const* alpha_ptr = nullptr;
     ElementScalar const* beta_ptr = nullptr;
 
-    using StrideAlpha = Stride<_0,_0,int64_t>;
-    using StrideBeta  = Stride<_0,_0,int64_t>;
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op: activation(beta * C + (alpha * acc))
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          {} // unary args: activation
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// D = softmax(top_k(alpha * acc + beta * C)), topk_indices = top_k indices, expert_counts += histogram(topk_indices)
+template<
+  int TopK,
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class EpilogueTile,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombTopKSoftmaxColRouter =
+  Sm90EVT<Sm90TopKSoftmaxColReduction<TopK, FragmentSize, CtaTileShapeMNK, EpilogueTile, ElementOutput, ElementCompute, RoundStyle,
+                                      128 / sizeof_bits_v<ElementOutput>, true /* UseButterflyReduce */, true /* EmitIndices */>, // softmax(top_k(beta * C + (alpha * acc)))
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // beta * C + (alpha * acc)
+  >;
+
+template <
+  int TopK,
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombTopKSoftmaxColRouter<TopK, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombTopKSoftmaxColRouter<TopK, FragmentSize, CtaTileShapeMNK, EpilogueTile, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombTopKSoftmaxColRouter<TopK, FragmentSize, CtaTileShapeMNK, EpilogueTile, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombTopKSoftmaxColRouter<TopK, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    int32_t* topk_indices_ptr = nullptr;  // (M,TopK,L) packed row-major, may be null
+    int32_t* expert_counts_ptr = nullptr; // (N,L) packed, must be zeroed by the user, may be null
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op: top_k_softmax(beta * C + (alpha * acc))
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          {topk_indices_ptr, expert_counts_ptr} // unary args: top_k_softmax
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// D = exp(alpha * acc + beta * C - row_max), with the per-row max and sum of exponentials of each epilogue tile
+template<
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class EpilogueTile,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementPartial = float,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombSoftmaxPartialCol =
+  Sm90EVT<Sm90SoftmaxPartialColReduction<FragmentSize, CtaTileShapeMNK, EpilogueTile, ElementCompute, ElementPartial,
+            Stride<_1, int64_t, int64_t>, RoundStyle>, // exp(beta * C + (alpha * acc) - row_max)
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // beta * C + (alpha * acc)
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementPartial,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombSoftmaxPartialCol<ElementOutput, ElementCompute, ElementPartial, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombSoftmaxPartialCol<FragmentSize, CtaTileShapeMNK, EpilogueTile, ElementOutput, ElementCompute, ElementPartial, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombSoftmaxPartialCol<FragmentSize, CtaTileShapeMNK, EpilogueTile, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementPartial, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombSoftmaxPartialCol<ElementOutput, ElementCompute, ElementPartial, ElementSource, ElementScalar, RoundStyle>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    using StridePartial = Stride<_1, int64_t, int64_t>;
+    ElementPartial* row_max_ptr = nullptr; // (M,ceil_div(N,EPI_N),L), optional if N <= EPI_N
+    ElementPartial* row_sum_ptr = nullptr; // (M,ceil_div(N,EPI_N),L), optional if N <= EPI_N
+    StridePartial dPartial = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op: partial_softmax(beta * C + (alpha * acc))
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          {row_max_ptr, row_sum_ptr, dPartial} // unary args: partial_softmax
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// D = (alpha * acc + beta * C) / scale, with per-row scale factors for each epilogue tile and optional per-row amax
+template<
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class EpilogueTile,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementScaleFactor,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombPerRowQuantAmax =
+  Sm90EVT<Sm90AmaxQuantizeColReduction<FragmentSize, CtaTileShapeMNK, EpilogueTile, ElementOutput, ElementCompute, ElementScaleFactor,
+            Stride<_1, int64_t, int64_t>, Stride<_1, _0, int64_t>, RoundStyle>, // quantize(beta * C + (alpha * acc))
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // beta * C + (alpha * acc)
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementScaleFactor,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombPerRowQuantAmax<ElementOutput, ElementCompute, ElementScaleFactor, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombPerRowQuantAmax<FragmentSize, CtaTileShapeMNK, EpilogueTile, ElementOutput, ElementCompute, ElementScaleFactor, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombPerRowQuantAmax<FragmentSize, CtaTileShapeMNK, EpilogueTile, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementScaleFactor, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombPerRowQuantAmax<ElementOutput, ElementCompute, ElementScaleFactor, ElementSource, ElementScalar, RoundStyle>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    using StrideScaleFactor = Stride<_1, int64_t, int64_t>;
+    ElementScaleFactor* scale_factor_ptr = nullptr; // (M,ceil_div(N,EPI_N),L)
+    StrideScaleFactor dScaleFactor = {};
+
+    using StrideAmax = Stride<_1, _0, int64_t>;
+    ElementCompute* amax_row_ptr = nullptr;         // (M,L), optional
+    StrideAmax dAmaxRow = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op: quantize(beta * C + (alpha * acc))
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          {scale_factor_ptr, dScaleFactor, amax_row_ptr, dAmaxRow} // unary args: quantize
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// D = alpha * acc + beta * C, with a structured sparse compressed copy of D for a consuming sparse GEMM
+template<
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class EpilogueTile,
+  class SparseConfig,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombSparseCompress =
+  Sm90EVT<Sm90SparseCompressStore<FragmentSize, CtaTileShapeMNK, EpilogueTile, SparseConfig, ElementOutput, ElementCompute, RoundStyle>, // compress(beta * C + (alpha * acc))
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // beta * C + (alpha * acc)
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class SparseConfig,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombSparseCompress<SparseConfig, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombSparseCompress<FragmentSize, CtaTileShapeMNK, EpilogueTile, SparseConfig, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombSparseCompress<FragmentSize, CtaTileShapeMNK, EpilogueTile, SparseConfig, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombSparseCompress<SparseConfig, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    void* compressed_ptr = nullptr; // SparseConfig::fill_layoutA of (M,N,L)
+    void* metadata_ptr = nullptr;   // SparseConfig::fill_layoutE of (M,N,L)
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op: compress(beta * C + (alpha * acc))
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          {compressed_ptr, metadata_ptr} // unary args: compress
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// D_blocks = alpha * acc + beta * C on the non-zero blocks of a BSR output mask
+template<
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombBlockSparse =
+  Sm90EVT<Sm90BlockSparseStore<CtaTileShapeMNK, ElementOutput, ElementCompute, RoundStyle>, // store_blocks(beta * C + (alpha * acc))
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // beta * C + (alpha * acc)
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombBlockSparse<ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombBlockSparse<CtaTileShapeMNK, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombBlockSparse<CtaTileShapeMNK, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombBlockSparse<ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    ElementOutput* blocks_ptr = nullptr;             // (BLK_M,BLK_N) row-major blocks in BSR order
+    int32_t const* block_row_offsets = nullptr;      // BSR row offsets of the mask
+    int32_t const* block_col_indices = nullptr;      // BSR block column indices of the mask
+    int32_t num_blocks = 0;
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op: store_blocks(beta * C + (alpha * acc))
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          {blocks_ptr, block_row_offsets, block_col_indices, num_blocks} // unary args: store_blocks
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// D = alpha * acc + beta * C inside the triangle selected by FillMode, D = C outside of it
+template<
+  FillMode FillMode_,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombTriangular =
+  Sm90EVT<Sm90TriangularSelect<FillMode_, ElementOutput, ElementCompute, RoundStyle>, // select(beta * C + (alpha * acc), C)
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle>, // beta * C + (alpha * acc)
+    Sm90SrcFetch<ElementSource> // C
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  FillMode FillMode_,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombTriangular<FillMode_, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombTriangular<FillMode_, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementSource, ElementScalar, RoundStyle> {
+
+  static_assert(not cute::is_void_v<ElementSource>,
+    "Triangular linear combination requires the source C, which provides the elements outside of the triangle.");
+
+  using Impl = Sm90LinCombTriangular<FillMode_, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombTriangular<FillMode_, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // binary op : select(beta * C + (alpha * acc), C)
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          {},  // leaf args : C
+          {}   // binary args : select
+        };   // end binary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Gated activation (GLU), see Sm90GatedActivation
+template<
+  bool PtrArray,
+  bool Quantize,
+  template <class> class ActivationFn,
+  int Stages,
+  int NumEpilogueWarpGroups,
+  class EpilogueTile,
+  class StrideMNL,
+  class SmemLayoutAtom,
+  class CopyOpR2S,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  class ElementIntermediate = ElementOutput,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest,
+  int ModeIndex = 0
+>
+using Sm90LinCombGatedActFunc =
+  Sm90EVT<Sm90GatedActivation<PtrArray, Quantize, ActivationFn, Stages, NumEpilogueWarpGroups, EpilogueTile, StrideMNL,
+                              SmemLayoutAtom, CopyOpR2S, ElementOutput, ElementCompute, ElementScalar, RoundStyle, ModeIndex>,  // store(x(0) * f(x(1) * scale))
+          // This is same as Sm90LinearCombinationPtrArray except it performs a roundrip cast to ElementIntermediate 
+          // after accumulator scaling but before adding source (bias), which emulates precision of unfused path
+          Sm90EVT<Sm90Compute<homogeneous_multiply_add, ElementCompute, ElementCompute, RoundStyle>, // beta * C + (alpha * acc)
+                  Sm90ScalarBroadcastSelector<PtrArray, ElementScalar, Stride<_0,_0,int64_t>>, // beta
+                  Sm90SrcFetch<ElementSource>, // C
+                  Sm90EVT<Sm90Compute<multiplies, ElementIntermediate, ElementCompute, RoundStyle>, // alpha * acc
+                          Sm90ScalarBroadcastSelector<PtrArray, ElementScalar, Stride<_0,_0,int64_t>>, // alpha
+                          Sm90AccFetch // acc
+                  >
+          >
+  >;
+
+template <
+  // DispatchPolicy args
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  // Fusion op args
+  // Gated act + quantization args
+  bool Quantize,
+  template <class> class ActivationFn,
+  // Store args
+  class GmemLayoutTagOutput,
+  // Element types
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource,
+  class ElementScalar,
+  class ElementIntermediate,
+  int Alignment,
+  FloatRoundStyle RoundStyle,
+  int ModeIndex,
+  // Tile shape args
+  class CtaTileShapeMNK,
+  class EpilogueTile,
+  // Aux store args
+  class SmemLayoutAtom,
+  class CopyOpR2S
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombGatedActFunc<Quantize, ActivationFn, GmemLayoutTagOutput, ElementOutput, ElementCompute, ElementSource, ElementScalar, ElementIntermediate, Alignment, RoundStyle, ModeIndex>,
+    CtaTileShapeMNK,
+    EpilogueTile,
+    SmemLayoutAtom,
+    CopyOpR2S
+> : Sm90LinCombGatedActFunc<false, Quantize, ActivationFn, StagesD, 2, EpilogueTile, cutlass::gemm::TagToStrideC_t<GmemLayoutTagOutput>,
+                            SmemLayoutAtom, CopyOpR2S, ElementOutput, ElementCompute, ElementSource, ElementScalar, ElementIntermediate, RoundStyle, ModeIndex> {
+
+  using Impl = Sm90LinCombGatedActFunc<false, Quantize, ActivationFn, StagesD, 2, EpilogueTile, cutlass::gemm::TagToStrideC_t<GmemLayoutTagOutput>,
+                                       SmemLayoutAtom, CopyOpR2S, ElementOutput, ElementCompute, ElementSource, ElementScalar, ElementIntermediate, RoundStyle, ModeIndex>;
+  using Operation = fusion::LinCombGatedActFunc<Quantize, ActivationFn, GmemLayoutTagOutput, ElementOutput, ElementCompute,
+                                                ElementSource, ElementScalar, ElementIntermediate, Alignment, RoundStyle, ModeIndex>;
+
+  struct Arguments {
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    ElementScalar               alpha = ElementScalar(1);
+    ElementScalar const*        alpha_ptr{};
+    StrideAlpha                 dAlpha{};
+
+    using StrideBeta = Stride<_0,_0,int64_t>;
+    ElementScalar               beta = ElementScalar(0);
+    ElementScalar const*        beta_ptr{};
+    StrideBeta                  dBeta{};
+
+    using StrideScale = Stride<_0,_0,int64_t>;
+    ElementScalar               scale = ElementScalar(1);
+    ElementScalar const*        scale_ptr{};
+    StrideScale                 dScale{};
+
+    using StrideOutput = cutlass::gemm::TagToStrideC_t<GmemLayoutTagOutput>;
+    ElementOutput* ptr_D{};
+    StrideOutput dD{};
+
+    int sm_count{};
+
+    operator typename Impl::Arguments() const {
+
+      using StoreArgs = decltype(typename Impl::Arguments{}.op_1.op_1);
+
+      StoreArgs store_args = [&]{
+        if constexpr (Quantize) {
+          return StoreArgs
+          {                                                        // custom node : conversion + store 
+            {                                                        // binary op : conversion + scale
+              {{scale}, {scale_ptr}, {dScale}},                        // leaf args : scalar broadcast (scale)
+              {},                                                      // leaf args : acc fetch (input)
+              {}                                                       // binary args : multiplies
+            },
+            {ptr_D, dD},                                             // unary op : aux store
+          };
+        }
+        else {
+          return StoreArgs
+          {                                                        // unary op : aux store
+            {},                                                      // leaf args : acc fetch (input)
+            {ptr_D, dD}                                              // unary args : aux store
+          };
+        }
+      }();
+
+      return
+        {                                                          // unary op: store(scale(gated_act(beta * C + (alpha * acc))))
+          {                                                          // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}, {dBeta}},                             // leaf args : beta
+            {},                                                        // leaf args : C
+            {                                                          // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}, {dAlpha}},                          // leaf args : alpha
+              {},                                                        // leaf args : acc
+              {}                                                         // binary args : multiplies
+            },
+            {}                                                         // ternary args : multiply_add
+          },
+          {                                                        // custom node : gated_act+scale+store custom node
+            {                                                        // unary op : act_func(input)
+              {},                                                      // leaf args : input
+              {}                                                       // unary args : act_func
+            },
+            store_args
+          }
+        };
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+template <
+  // DispatchPolicy args
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  int NumEpilogueWarpGroups,
+  // Fusion op args
+  // Gated act + quantization args
+  bool Quantize,
+  template <class> class ActivationFn,
+  // Store args
+  class GmemLayoutTagOutput,
+  // Element types
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource,
+  class ElementScalar,
+  class ElementIntermediate,
+  int Alignment,
+  FloatRoundStyle RoundStyle,
+  int ModeIndex,
+  // Tile shape args
+  class CtaTileShapeMNK,
+  class EpilogueTile,
+  // Aux store args
+  class SmemLayoutAtom,
+  class CopyOpR2S
+>
+struct FusionCallbacks<
+    epilogue::Sm90PtrArrayTmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore, NumEpilogueWarpGroups>,
+    fusion::LinCombGatedActFunc<Quantize, ActivationFn, GmemLayoutTagOutput, ElementOutput, ElementCompute, ElementSource, ElementScalar, ElementIntermediate, Alignment, RoundStyle, ModeIndex>,
+    CtaTileShapeMNK,
+    EpilogueTile,
+    SmemLayoutAtom,
+    CopyOpR2S
+> : Sm90LinCombGatedActFunc<true, Quantize, ActivationFn, StagesD, NumEpilogueWarpGroups, EpilogueTile, cutlass::gemm::TagToStrideC_t<GmemLayoutTagOutput>,
+                            SmemLayoutAtom, CopyOpR2S, ElementOutput, ElementCompute, ElementSource, ElementScalar, ElementIntermediate, RoundStyle, ModeIndex> {
+
+  using Impl = Sm90LinCombGatedActFunc<true, Quantize, ActivationFn, StagesD, NumEpilogueWarpGroups, EpilogueTile, cutlass::gemm::TagToStrideC_t<GmemLayoutTagOutput>,
+                                       SmemLayoutAtom, CopyOpR2S, ElementOutput, ElementCompute, ElementSource, ElementScalar, ElementIntermediate, RoundStyle, ModeIndex>;
+  using Operation = fusion::LinCombGatedActFunc<Quantize, ActivationFn, GmemLayoutTagOutput, ElementOutput, ElementCompute,
+                                                ElementSource, ElementScalar, ElementIntermediate, Alignment, RoundStyle, ModeIndex>;
+
+  struct Arguments {
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    ElementScalar               alpha = ElementScalar(1);
+    ElementScalar const*        alpha_ptr{};
+    ElementScalar const* const* alpha_ptr_array{};
+    StrideAlpha                 dAlpha{};
+
+    using StrideBeta = Stride<_0,_0,int64_t>;
+    ElementScalar               beta = ElementScalar(0);
+    ElementScalar const*        beta_ptr{};
+    ElementScalar const* const* beta_ptr_array{};
+    StrideBeta                  dBeta{};
+
+    using StrideScale = Stride<_0,_0,int64_t>;
+    ElementScalar               scale = ElementScalar(1);
+    ElementScalar const*        scale_ptr{};
+    ElementScalar const* const* scale_ptr_array{};
+    StrideScale                 dScale{};
+
+    using StrideOutput = cutlass::gemm::TagToStrideC_t<GmemLayoutTagOutput>;
+    ElementOutput** ptr_D{};
+    StrideOutput dD{};
+
+    int sm_count{};
+
+    operator typename Impl::Arguments() const {
+
+      using StoreArgs = decltype(typename Impl::Arguments{}.op_1.op_1);
+
+      StoreArgs store_args = [&]{
+        if constexpr (Quantize) {
+          return StoreArgs
+          {                                                        // custom node : conversion + store 
+            {                                                        // binary op : conversion + scale
+              {{scale}, {scale_ptr}, {scale_ptr_array}, {dScale}},     // leaf args : scalar broadcast (scale)
+              {},                                                      // leaf args : acc fetch (input)
+              {}                                                       // binary args : multiplies
+            },
+            {ptr_D, dD, sm_count},                                   // unary op : aux store
+          };
+        }
+        else {
+          return StoreArgs
+          {                                                        // unary op : aux store
+            {},                                                      // leaf args : acc fetch (input)
+            {ptr_D, dD, sm_count}                                    // unary args : aux store
+          };
+        }
+      }();
+
+      return
+        {                                                          // unary op: store(scale(gated_act(beta * C + (alpha * acc))))
+          {                                                          // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}, {beta_ptr_array}, {dBeta}},           // leaf args : beta
+            {},                                                        // leaf args : C
+            {                                                          // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}, {alpha_ptr_array}, {dAlpha}},       // leaf args : alpha
+              {},                                                        // leaf args : acc
+              {}                                                         // binary args : multiplies
+            },
+            {}                                                         // ternary args : multiply_add
+          },
+          {                                                        // custom node : gated_act+scale+store custom node
+            {                                                        // unary op : act_func(input)
+              {},                                                      // leaf args : input
+              {}                                                       // unary args : act_func
+            },
+            store_args
+          }
+        };
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Grouped Wgrad Conv
+template<
+  class GroupsPerTile,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinearCombinationGroupedWgrad =
+  Sm90EVT<Sm90Compute<homogeneous_multiply_add, ElementOutput, ElementCompute, RoundStyle>, // beta * C + (alpha * acc)
+    Sm90ScalarBroadcast<ElementScalar, Stride<_0,_0,int64_t>>, // beta
+    Sm90SrcFetch<ElementSource>, // C
+    Sm90EVT<Sm90Compute<multiplies, ElementCompute, ElementCompute, RoundStyle>, // alpha * acc
+      Sm90ScalarBroadcast<ElementScalar, Stride<_0,_0,int64_t>>, // alpha
+      Sm90AccFetchGroupedWgrad<GroupsPerTile> // acc
+    >
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile,
+  class GroupsPerTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinearCombinationGroupedWgrad<GroupsPerTile, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinearCombinationGroupedWgrad<GroupsPerTile, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinearCombinationGroupedWgrad<GroupsPerTile, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinearCombinationGroupedWgrad<GroupsPerTile, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    //ElementScalar groups = ElementScalar(1);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    using StrideBeta  = Stride<_0,_0,int64_t>;
+    StrideAlpha dAlpha = {_0{}, _0{}, 0};
+    StrideBeta  dBeta  = {_0{}, _0{}, 0};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // ternary op : beta * C + (alpha * acc)
+          {{beta}, {beta_ptr}, {dBeta}}, // leaf args : beta
+          {},                   // leaf args : C
+          {                     // binary op : alpha * acc
+            {{alpha}, {alpha_ptr}, {dAlpha}}, // leaf args : alpha
+            {},                     // leaf args : acc
+            {}                  // binary args : multiplies
+          },                    // end binary op
+          {} // ternary args : multiply_add
+        };   // end ternary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// D = alpha * acc + beta * C, with per-row sum and sum of squares of D reduced across all CTAs of a row
+template<
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombRowNormStatistics =
+  Sm90EVT<Sm90Compute<cutlass::epilogue::thread::Identity, ElementOutput, ElementCompute, RoundStyle>, // Identity for final conversion
+    Sm90EVT<Sm90ColReduction<plus, plus, plus, 0, CtaTileShapeMNK,
+                             ElementCompute, ElementCompute, RoundStyle, Stride<_1,_0,int64_t>>, // row_sum
+      Sm90EVT<Sm90ColReduction<square_and_plus, plus, plus, 0, CtaTileShapeMNK,
+                               ElementCompute, ElementCompute, RoundStyle, Stride<_1,_0,int64_t>>, // row_sum_sq
+        Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // beta * C + (alpha * acc)
+      >
+    >
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombRowNormStatistics<ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombRowNormStatistics<CtaTileShapeMNK, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombRowNormStatistics<CtaTileShapeMNK, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombRowNormStatistics<ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    using StrideBeta  = Stride<_0,_0,int64_t>;
+    StrideAlpha dAlpha = {_0{}, _0{}, 0};
+    StrideBeta  dBeta  = {_0{}, _0{}, 0};
+
+    using StrideStatistic = Stride<_1,_0,int64_t>;
+    ElementCompute* row_sum_sq_ptr = nullptr; // (M,L)
+    ElementCompute* row_sum_ptr = nullptr;    // (M,L), optional
+    StrideStatistic dStatistic = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op : identity/convert
+          {    // unary op : reduce(beta * C + (alpha * acc))
+            {    // unary op : reduce_sq(beta * C + (alpha * acc))
+              {    // ternary op : beta * C + (alpha * acc)
+                {{beta}, {beta_ptr}, {dBeta}}, // leaf args : beta
+                {},                   // leaf args : C
+                {                     // binary op : alpha * acc
+                  {{alpha}, {alpha_ptr}, {dAlpha}}, // leaf args : alpha
+                  {},                     // leaf args : acc
+                  {}                  // binary args : multiplies
+                },                    // end binary op
+                {} // ternary args : multiply_add
+              },   // end ternary op
+              {row_sum_sq_ptr, ElementCompute(0), dStatistic} // unary args : reduce_sq
+            },   // end unary op
+            {row_sum_ptr, ElementCompute(0), dStatistic} // unary args : reduce
+          },   // end unary op
+          {} // unary args : identity/convert
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// D = alpha * acc + beta * C, with per-column sum and sum of squares of D reduced in ElementStatistic across all CTAs of a column
+template<
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementStatistic = float,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombBatchNormStatistics =
+  Sm90EVT<Sm90Compute<cutlass::epilogue::thread::Identity, ElementOutput, ElementCompute, RoundStyle>, // Identity for final conversion
+    Sm90EVT<Sm90RowReduction<plus, plus, plus, 0, CtaTileShapeMNK,
+                             ElementStatistic, ElementStatistic, RoundStyle, Stride<_0,_1,int64_t>>, // col_sum
+      Sm90EVT<Sm90RowReduction<square_and_plus, plus, plus, 0, CtaTileShapeMNK,
+                               ElementStatistic, ElementStatistic, RoundStyle, Stride<_0,_1,int64_t>>, // col_sum_sq
+        Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // beta * C + (alpha * acc)
+      >
+    >
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementStatistic,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombBatchNormStatistics<ElementOutput, ElementCompute, ElementStatistic, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombBatchNormStatistics<CtaTileShapeMNK, ElementOutput, ElementCompute, ElementStatistic, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombBatchNormStatistics<CtaTileShapeMNK, ElementOutput, ElementCompute, ElementStatistic, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombBatchNormStatistics<ElementOutput, ElementCompute, ElementStatistic, ElementSource, ElementScalar, RoundStyle>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    using StrideBeta  = Stride<_0,_0,int64_t>;
     StrideAlpha dAlpha = {_0{}, _0{}, 0};
     StrideBeta  dBeta  = {_0{}, _0{}, 0};
 
+    using StrideStatistic = Stride<_0,_1,int64_t>;
+    ElementStatistic* col_sum_ptr = nullptr;    // (N,L)
+    ElementStatistic* col_sum_sq_ptr = nullptr; // (N,L)
+    StrideStatistic dStatistic = {};
+
     operator typename Impl::Arguments() const {
       return
-        {    // ternary op : beta * C + (alpha * acc)
+        {    // unary op : identity/convert
+          {    // unary op : reduce(beta * C + (alpha * acc))
+            {    // unary op : reduce_sq(beta * C + (alpha * acc))
+              {    // ternary op : beta * C + (alpha * acc)
+                {{beta}, {beta_ptr}, {dBeta}}, // leaf args : beta
+                {},                   // leaf args : C
+                {                     // binary op : alpha * acc
+                  {{alpha}, {alpha_ptr}, {dAlpha}}, // leaf args : alpha
+                  {},                     // leaf args : acc
+                  {}                  // binary args : multiplies
+                },                    // end binary op
+                {} // ternary args : multiply_add
+              },   // end ternary op
+              {col_sum_sq_ptr, ElementStatistic(0), dStatistic} // unary args : reduce_sq
+            },   // end unary op
+            {col_sum_ptr, ElementStatistic(0), dStatistic} // unary args : reduce
+          },   // end unary op
+          {} // unary args : identity/convert
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// rstd * (acc - mean * col_weight_sum), with mean and rstd derived from the row sum and sum of squares
+template <class T>
+struct RowNormalize {
+  struct Arguments {
+    T inv_norm_extent = T(1);
+    T epsilon = T(0);
+  };
+
+  CUTLASS_HOST_DEVICE
+  T operator()(T const& acc, T const& row_sum, T const& row_sum_sq, T const& col_weight_sum, Arguments const& args) const {
+    maximum<T> max_op;
+    inverse_square_root<T> rsqrt_op;
+
+    T mean = row_sum * args.inv_norm_extent;
+    // Clamp the variance, E[x^2] - E[x]^2 can round below zero
+    T var = max_op(row_sum_sq * args.inv_norm_extent - mean * mean, T(0));
+    return rsqrt_op(var + args.epsilon) * (acc - mean * col_weight_sum);
+  }
+};
+
+template <class T, int N>
+struct RowNormalize<Array<T, N>> {
+  using Arguments = typename RowNormalize<T>::Arguments;
+
+  CUTLASS_HOST_DEVICE
+  Array<T, N> operator()(Array<T, N> const& acc, Array<T, N> const& row_sum, Array<T, N> const& row_sum_sq,
+                         Array<T, N> const& col_weight_sum, Arguments const& args) const {
+    RowNormalize<T> op;
+    Array<T, N> result;
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < N; ++i) {
+      result[i] = op(acc[i], row_sum[i], row_sum_sq[i], col_weight_sum[i], args);
+    }
+    return result;
+  }
+};
+
+} // namespace detail
+
+// D = alpha * norm(A) @ B + bias + beta * C, consuming the row statistics of Sm90LinCombRowNormStatistics
+template<
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementBias = ElementOutput,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  int AlignmentBias = 128 / sizeof_bits_v<ElementBias>,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90RowNormLinCombPerColBias =
+  Sm90EVT<Sm90Compute<homogeneous_multiply_add, ElementOutput, ElementCompute, RoundStyle>, // beta * C + (alpha * norm + bias)
+    Sm90ScalarBroadcast<ElementScalar, Stride<_0,_0,int64_t>>, // beta
+    Sm90SrcFetch<ElementSource>, // C
+    Sm90EVT<Sm90Compute<homogeneous_multiply_add, ElementCompute, ElementCompute, RoundStyle>, // alpha * norm + bias
+      Sm90ScalarBroadcast<ElementScalar, Stride<_0,_0,int64_t>>, // alpha
+      Sm90EVT<Sm90Compute<detail::RowNormalize, ElementCompute, ElementCompute, RoundStyle>, // norm = rstd * (acc - mean * col_weight_sum)
+        Sm90AccFetch, // acc
+        Sm90ColBroadcast<0, CtaTileShapeMNK, ElementCompute, ElementCompute, Stride<_1,_0,int64_t>>, // row_sum
+        Sm90ColBroadcast<0, CtaTileShapeMNK, ElementCompute, ElementCompute, Stride<_1,_0,int64_t>>, // row_sum_sq
+        Sm90RowBroadcast<0, CtaTileShapeMNK, ElementCompute, ElementCompute, Stride<_0,_1,int64_t>> // col_weight_sum
+      >,
+      Sm90RowBroadcast<0, CtaTileShapeMNK, ElementBias, ElementCompute, Stride<_0,_1,int64_t>, AlignmentBias> // bias
+    >
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementBias,
+  class ElementSource,
+  class ElementScalar,
+  int AlignmentBias,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::RowNormLinCombPerColBias<ElementOutput, ElementCompute, ElementBias, ElementSource, ElementScalar, AlignmentBias, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90RowNormLinCombPerColBias<
+      CtaTileShapeMNK, ElementOutput, ElementCompute, ElementBias, ElementSource, ElementScalar, AlignmentBias, RoundStyle> {
+  using Impl = Sm90RowNormLinCombPerColBias<
+    CtaTileShapeMNK, ElementOutput, ElementCompute, ElementBias, ElementSource, ElementScalar, AlignmentBias, RoundStyle>;
+  using Operation = fusion::RowNormLinCombPerColBias<
+    ElementOutput, ElementCompute, ElementBias, ElementSource, ElementScalar, AlignmentBias, RoundStyle>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    using StrideBeta  = Stride<_0,_0,int64_t>;
+    StrideAlpha dAlpha = {_0{}, _0{}, 0};
+    StrideBeta  dBeta  = {_0{}, _0{}, 0};
+
+    // Number of normalized elements per row, i.e. the K extent of this GEMM
+    int norm_extent = 1;
+    ElementCompute epsilon = ElementCompute(0);
+
+    using StrideStatistic = Stride<_1,_0,int64_t>;
+    ElementCompute const* row_sum_sq_ptr = nullptr; // (M,L)
+    ElementCompute const* row_sum_ptr = nullptr;    // (M,L), optional
+    StrideStatistic dStatistic = {};
+
+    using StrideColWeightSum = Stride<_0,_1,int64_t>;
+    ElementCompute const* col_weight_sum_ptr = nullptr; // (N,L), optional
+    StrideColWeightSum dColWeightSum = {};
+
+    using StrideBias = Stride<_0,_1,int64_t>;
+    ElementBias const* bias_ptr = nullptr;
+    StrideBias dBias = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {     // ternary op : beta * C + (alpha * norm + bias)
           {{beta}, {beta_ptr}, {dBeta}}, // leaf args : beta
           {},                   // leaf args : C
-          {                     // binary op : alpha * acc
+          {                     // ternary op : alpha * norm + bias
             {{alpha}, {alpha_ptr}, {dAlpha}}, // leaf args : alpha
-            {},                     // leaf args : acc
-            {}                  // binary args : multiplies
-          },                    // end binary op
+            {                     // quaternary op : norm
+              {},                     // leaf args : acc
+              {row_sum_ptr, ElementCompute(0), dStatistic},    // leaf args : row_sum
+              {row_sum_sq_ptr, ElementCompute(0), dStatistic}, // leaf args : row_sum_sq
+              {col_weight_sum_ptr, ElementCompute(0), dColWeightSum}, // leaf args : col_weight_sum
+              {ElementCompute(1) / ElementCompute(norm_extent), epsilon} // quaternary args : normalize
+            },                    // end quaternary op
+            {bias_ptr, ElementBias(0), dBias}, // leaf args : bias
+            {}                  // ternary args : multiply_add
+          },                    // end ternary op
           {} // ternary args : multiply_add
         };   // end ternary op
     }
@@ -2812,6 +4526,176 @@ struct FusionCallbacks<
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+// D = alpha * acc + beta * C, with the per-row logsumexp and cross-entropy loss of D reduced across all CTAs of a row
+template<
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementStatistic = float,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombCrossEntropy =
+  Sm90EVT<Sm90Compute<cutlass::epilogue::thread::Identity, ElementOutput, ElementCompute, RoundStyle>, // Identity for final conversion
+    Sm90EVT<Sm90CrossEntropyColReduction<CtaTileShapeMNK, ElementStatistic, ElementCompute, int32_t,
+                                         Stride<_1,_0,int64_t>, RoundStyle>, // lse, loss
+      Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // beta * C + (alpha * acc)
+    >
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementStatistic,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombCrossEntropy<ElementOutput, ElementCompute, ElementStatistic, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombCrossEntropy<CtaTileShapeMNK, ElementOutput, ElementCompute, ElementStatistic, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombCrossEntropy<CtaTileShapeMNK, ElementOutput, ElementCompute, ElementStatistic, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombCrossEntropy<ElementOutput, ElementCompute, ElementStatistic, ElementSource, ElementScalar, RoundStyle>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    using StrideBeta  = Stride<_0,_0,int64_t>;
+    StrideAlpha dAlpha = {_0{}, _0{}, 0};
+    StrideBeta  dBeta  = {_0{}, _0{}, 0};
+
+    using StrideStatistic = Stride<_1,_0,int64_t>;
+    int32_t const* target_ptr = nullptr;  // (M,L)
+    ElementStatistic* loss_ptr = nullptr; // (M,L), optional
+    ElementStatistic* lse_ptr = nullptr;  // (M,L), optional
+    int32_t ignore_index = -100;
+    StrideStatistic dStatistic = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op : identity/convert
+          {    // unary op : cross_entropy(beta * C + (alpha * acc))
+            {    // ternary op : beta * C + (alpha * acc)
+              {{beta}, {beta_ptr}, {dBeta}}, // leaf args : beta
+              {},                   // leaf args : C
+              {                     // binary op : alpha * acc
+                {{alpha}, {alpha_ptr}, {dAlpha}}, // leaf args : alpha
+                {},                     // leaf args : acc
+                {}                  // binary args : multiplies
+              },                    // end binary op
+              {} // ternary args : multiply_add
+            },   // end ternary op
+            {target_ptr, loss_ptr, lse_ptr, ignore_index, dStatistic} // unary args : cross_entropy
+          },   // end unary op
+          {} // unary args : identity/convert
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// D = dloss * (softmax(alpha * acc + beta * C) - onehot(target)), the gradient of the loss of Sm90LinCombCrossEntropy
+template<
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombCrossEntropyGrad =
+  Sm90EVT<Sm90CrossEntropyGrad<CtaTileShapeMNK, ElementOutput, ElementCompute, int32_t,
+                               Stride<_1,_0,int64_t>, RoundStyle>, // dloss * (exp(Z - lse) - onehot(target))
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // Z = beta * C + (alpha * acc)
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombCrossEntropyGrad<ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombCrossEntropyGrad<CtaTileShapeMNK, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombCrossEntropyGrad<CtaTileShapeMNK, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombCrossEntropyGrad<ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    using StrideBeta  = Stride<_0,_0,int64_t>;
+    StrideAlpha dAlpha = {_0{}, _0{}, 0};
+    StrideBeta  dBeta  = {_0{}, _0{}, 0};
+
+    using StrideStatistic = Stride<_1,_0,int64_t>;
+    int32_t const* target_ptr = nullptr;       // (M,L)
+    ElementCompute const* lse_ptr = nullptr;   // (M,L)
+    ElementCompute const* dloss_ptr = nullptr; // (M,L), optional, dloss is used if null
+    ElementCompute dloss = ElementCompute(1);
+    int32_t ignore_index = -100;
+    StrideStatistic dStatistic = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op : cross_entropy_grad(beta * C + (alpha * acc))
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}, {dBeta}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}, {dAlpha}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          {target_ptr, lse_ptr, dloss_ptr, dloss, ignore_index, dStatistic} // unary args : cross_entropy_grad
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace detail {
 template <class FusionOpOrCallbacks, class = cute::void_t<>>
 struct get_element_aux {
@@ -2835,11 +4719,31 @@ struct get_element_aux<FusionCallbacks<Ts...>, cute::void_t<typename FusionCallb
  public:
   using type = typename get_element_aux<Operation>::type;
 };
+// Tile of the aux tensor written per epilogue subtile, which differs from the epilogue tile for ops
+// that write the aux output at a reduced size
+template <class FusionOp, class EpilogueTile>
+struct get_aux_epilogue_tile {
+  using type = EpilogueTile;
+};
+
+template <
+  bool Quantize, template <class> class ActivationFn, class GmemLayoutTagOutput, class ElementOutput, class ElementCompute,
+  class ElementSource, class ElementScalar, class ElementIntermediate, int Alignment, FloatRoundStyle RoundStyle, class EpilogueTile
+>
+struct get_aux_epilogue_tile<
+    LinCombGatedActFunc<Quantize, ActivationFn, GmemLayoutTagOutput, ElementOutput, ElementCompute,
+                        ElementSource, ElementScalar, ElementIntermediate, Alignment, RoundStyle, 1>,
+    EpilogueTile> {
+  using type = decltype(cute::replace<1>(EpilogueTile{}, gated_halve_n(cute::get<1>(EpilogueTile{}))));
+};
 } // namespace cutlass:epilogue::fusion::detail
 
 template <class Callbacks>
 using get_element_aux_t = typename detail::get_element_aux<Callbacks>::type;
 
+template <class FusionOp, class EpilogueTile>
+using get_aux_epilogue_tile_t = typename detail::get_aux_epilogue_tile<FusionOp, EpilogueTile>::type;
+
 } // namespace cutlass::epilogue::fusion
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,336 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+  \brief Visitor tree per-row amax + quantization fusion operation for sm90 TMA warp-specialized epilogue
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/workspace.h"
+#include "cutlass/functional.h"
+#include "cutlass/numeric_types.h"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::fusion {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Per-row amax + quantization reduction across columns
+// Computes the absolute maximum of each row of the epilogue tile, derives a scale factor
+// from it, and rescales the visited results so that they span the range of ElementOutput:
+//
+//   amax(m, n_blk)  = max(abs(Z(m, n))) over the EPI_N columns of block n_blk
+//   scale(m, n_blk) = amax(m, n_blk) / max(ElementOutput)
+//   D(m, n)         = Z(m, n) / scale(m, n_blk)
+//
+// so that Z ~= D * scale. Optionally, the amax over the full N extent of each row is
+// accumulated with atomics into a (M,L) vector, which can be used to requantize to a single
+// per-row scale factor in a later pass.
+//
+//   Assumptions:
+//     1. There is a single warp across N in the epilogue tile, so that rows can be reduced
+//        with warp shuffles.
+//     2. The visited results are in ElementCompute when the node is reduced, so that they
+//        can be rescaled before conversion to ElementOutput.
+//
+template <
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class EpilogueTile,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementScale,
+  class StrideScaleMNL = Stride<_1, int64_t, int64_t>,
+  class StrideAmaxMNL = Stride<_1, _0, int64_t>,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+struct Sm90AmaxQuantizeColReduction {
+private:
+  static_assert(is_same_v<ElementCompute, float>, "Fused amax + quantization reduction requires FP32 compute.");
+  static_assert(take<0,2>(StrideAmaxMNL{}) == Stride<_1,_0>{}, "Row amax must be a contiguous (M,L) vector.");
+
+  static constexpr int EpiN = size<1>(EpilogueTile{});
+  static_assert(size<1>(CtaTileShapeMNK{}) % EpiN == 0, "EPI_N must divide CTA_N");
+
+public:
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementScale* ptr_scale = nullptr;        // (M,ceil_div(N,EPI_N),L) scale factors
+    StrideScaleMNL dScale = {};
+    ElementCompute* ptr_row_amax = nullptr;   // optional (M,L) amax over the full N extent
+    StrideAmaxMNL dRowAmax = {};
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    // The scale factors are computed per epilogue tile rather than across the full row,
+    // because a cross CTA reduction is not possible without a guarantee that all CTAs run
+    // concurrently, and only the current epilogue tile can be re-visited once reduced.
+    return args.ptr_scale != nullptr;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    if (args.ptr_row_amax != nullptr) {
+      auto problem_shape_mnkl = append<4>(problem_shape, 1);
+      auto [M, N, K, L] = problem_shape_mnkl;
+      Layout mAmax_layout = make_layout(make_shape(size<>(M),size<>(N),size<>(L)), args.dRowAmax);
+      return fill_workspace(args.ptr_row_amax, ElementCompute(0), cosize(mAmax_layout), stream, cuda_adapter);
+    }
+    return Status::kSuccess;
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90AmaxQuantizeColReduction() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90AmaxQuantizeColReduction(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<class ArgsTuple>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(ArgsTuple&& args_tuple, Params const& params)
+      : args_tuple(cute::forward<ArgsTuple>(args_tuple)),
+        params(params) {}
+
+    ArgsTuple args_tuple;
+    Params const& params;
+
+    template <typename ElementAccumulator, typename ElementInput>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+
+      auto& [tCrAmax, gScale, gAmax, tCcCol, tCcCta, cCol,
+              lane_layout_MN, residue_cCol, residue_tCcCol] = args_tuple;
+      Tensor tCcCol_mn = tCcCol(_,_,_,epi_m,epi_n);
+
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+      maximum_absolute_value_reduction<ElementCompute, /*PropagateNaN=*/true> amax_op{};
+
+      Array frg_I = convert_input(frg_input);
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        auto thread_crd = tCcCol_mn(epi_v * FragmentSize + i);
+        if (elem_less(thread_crd, residue_tCcCol)) {
+          ElementCompute& tCrAmax_vmn = tCrAmax(epi_v * FragmentSize + i);
+          tCrAmax_vmn = amax_op(tCrAmax_vmn, frg_I[i]);
+        }
+      }
+
+      return frg_input;
+    }
+
+    template <class STensor, class SyncFn, class VTensor>
+    CUTLASS_DEVICE void
+    reduce(STensor&& smem_buffer, SyncFn const& sync_fn, int epi_m, int epi_n, bool is_last_iteration, VTensor visit_results) {
+      static_assert(is_same_v<typename remove_cvref_t<VTensor>::value_type, Array<ElementCompute, FragmentSize>>,
+        "Fused amax + quantization requires the visited results in ElementCompute, before conversion to ElementOutput.");
+
+      auto& [tCrAmax, gScale, gAmax, tCcCol, tCcCta, cCol,
+              lane_layout_MN, residue_cCol, residue_tCcCol] = args_tuple;
+
+      // fully OOB CTA in partially OOB cluster
+      if (not elem_less(cCol(_0{},_0{}), residue_cCol)) {
+        return;
+      }
+      Tensor tCcCol_mn = tCcCol(_,_,_,epi_m,epi_n);
+      Tensor tCcCta_mn = tCcCta(_,_,_,epi_m,epi_n);
+
+      // `tCrAmax` has 0-strides along modes that correspond to N, so we butterfly-reduce its
+      // co-domain through a filtered view, after which every lane holds the amax of its rows.
+      auto tCrAmax_f = filter(tCrAmax);
+      maximum<ElementCompute, /*PropagateNaN=*/true> max_op{};
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int j = 1; j < size<1>(lane_layout_MN); j *= 2) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(tCrAmax_f); ++i) {
+          tCrAmax_f(i) = max_op(tCrAmax_f(i), __shfl_xor_sync(0xFFFFFFFF, tCrAmax_f(i), lane_layout_MN(_0{},j)));
+        }
+      }
+
+      ElementCompute const max_output = ElementCompute(cutlass::platform::numeric_limits<ElementOutput>::max());
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int epi_v = 0; epi_v < size(visit_results); ++epi_v) {
+        auto& visit_frag = visit_results(epi_v);
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < FragmentSize; ++i) {
+          ElementCompute amax = tCrAmax(epi_v * FragmentSize + i);
+          // All-zero (or fully OOB) rows keep a unit scale so they dequantize back to zero
+          ElementCompute inv_scale = amax > ElementCompute(0) ? max_output / amax : ElementCompute(1);
+          visit_frag[i] *= inv_scale;
+
+          // Exactly one thread owns the first column of each row of the epilogue tile,
+          // that thread writes the scale factor and contributes to the row amax.
+          auto thread_crd = tCcCol_mn(epi_v * FragmentSize + i);
+          auto [m, n] = tCcCta_mn(epi_v * FragmentSize + i);
+          if (n % EpiN == 0 && elem_less(thread_crd, residue_tCcCol)) {
+            gScale(m, n / EpiN) = ElementScale(amax > ElementCompute(0) ? amax / max_output : ElementCompute(1));
+            if (params.ptr_row_amax != nullptr) {
+              atomic_maximum<ElementCompute>{}(&gAmax(m, n), amax);
+            }
+          }
+        }
+      }
+    }
+
+    CUTLASS_DEVICE void
+    end_loop(int epi_m, int epi_n) {
+      auto& [tCrAmax, gScale, gAmax, tCcCol, tCcCta, cCol,
+              lane_layout_MN, residue_cCol, residue_tCcCol] = args_tuple;
+
+      // Reset the row amax for the next epilogue tile
+      fill(tCrAmax, ElementCompute(0));
+    }
+
+    CUTLASS_DEVICE void
+    end() { }
+
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    Layout ref_layout_MN = [&] () {
+      auto mn_shape = shape(typename decltype(args.tiled_copy)::Tiler_MN{});
+      if constexpr (ReferenceSrc) { return right_inverse(args.tiled_copy.get_layoutS_TV()).with_shape(mn_shape); }
+      else                        { return right_inverse(args.tiled_copy.get_layoutD_TV()).with_shape(mn_shape); }
+    }();                                                                                         // tile_mn -> tv_idx
+
+    // Get the MN layout of lanes to determine shuffle reduction iterations
+    using _W = Int<decltype(args.tiled_copy)::TiledNumThr::value / NumThreadsPerWarp>;
+    Layout tv2lane = Layout<Shape<Int<NumThreadsPerWarp>,_W,_1>,Stride<_1,_0,_0>>{};            //   tv_idx -> lane_idx
+    Layout ref2lane = composition(tv2lane, ref_layout_MN);                                      //  tile_mn -> lane_idx
+    Layout lane_layout_MN = make_layout(filter(get<0>(ref2lane)), filter(get<1>(ref2lane)));    //  lane_mn -> lane_idx
+
+    // Get the MN layout of warps
+    Layout tv2warp = Layout<Shape<Int<NumThreadsPerWarp>,_W,_1>,Stride<_0,_1,_0>>{};            //   tv_idx -> warp_idx
+    Layout ref2warp = composition(tv2warp, ref_layout_MN);                                      //  tile_mn -> warp_idx
+    Layout warp_layout_MN = make_layout(filter(get<0>(ref2warp)), filter(get<1>(ref2warp)));    //  warp_mn -> warp_idx
+
+    // Make sure there's only one warp across N so we can use warp shuffle intrinsics for reduction.
+    static_assert(decltype(size<1>(warp_layout_MN))::value <= 1);
+
+    // Reduction layout, with column broadcast so that fragment indices of the same row map
+    // to the same element (see Sm90TopKSoftmaxColReduction)
+    auto [M, N, K] = args.tile_shape_mnk;
+    auto thr_mma = args.tiled_mma.get_thread_slice(args.thread_idx);
+    auto gColReduce = make_tensor<ElementCompute>(
+        make_layout(make_shape(M, N), make_stride(_1{}, 0_c)));                                                // (M,N)
+    auto tCrColReduce = make_tensor_like<ElementCompute>(                                       // (FrgV, MMA_M, MMA_N)
+        thr_mma.partition_C(gColReduce).layout());
+
+    ThrCopy thread_r2s = args.tiled_copy.get_slice(args.thread_idx);
+    Tensor tRS_rAmax = thread_r2s.retile_S(tCrColReduce);                                  // ((R2S,R2S_V),MMA_M,MMA_N)
+    auto tCrAmax_layout = take<0, 3>(tRS_rAmax.layout()).compose(args.tCrC.layout()); // (R2S,R2S_V) o (R2S,R2S_M,R2S_N)
+
+    Tensor tCrAmax = make_tensor<ElementCompute>(tCrAmax_layout);                                  // (R2S,R2S_M,R2S_N)
+    fill(tCrAmax, ElementCompute(0));
+
+    // Scale factors and row amax of this CTA tile, indexed by CTA-relative coordinates
+    auto [M_, N_, K_, L_] = args.problem_shape_mnkl;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+    Tensor mScale = make_tensor(make_gmem_ptr(params.ptr_scale),
+                      make_layout(make_shape(M_, ceil_div(N_, Int<EpiN>{}), L_), params.dScale));      // (M,N/EPI_N,L)
+    Tensor gScale = local_tile(mScale(_,_,l), make_shape(M, N / Int<EpiN>{}), make_coord(m, n)); // (CTA_M,CTA_N/EPI_N)
+    Tensor mAmax = make_tensor(make_gmem_ptr(params.ptr_row_amax),
+                     make_layout(make_shape(M_, N_, L_), params.dRowAmax));                                  // (M,N,L)
+    Tensor gAmax = local_tile(mAmax(_,_,l), make_shape(M, N), make_coord(m, n));                 // (CTA_M,CTA_N)
+
+    // tCcD is relative to the first coordinate of each thread, the CTA tiles above are indexed by
+    // coordinates relative to the CTA instead
+    Tensor cCta = flat_divide(make_identity_tensor(make_shape(M, N)), args.epi_tile);          // (EPI_M,EPI_N,...)
+    Tensor tCcCta = [&] () {
+      if constexpr (ReferenceSrc) { return thread_r2s.partition_S(cCta); }
+      else                        { return thread_r2s.partition_D(cCta); }
+    }();                                                                                   // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+
+    auto args_tuple = make_tuple(
+        cute::move(tCrAmax), gScale, gAmax, args.tCcD, tCcCta, args.cD,
+        lane_layout_MN, args.residue_cD, args.residue_tCcD);
+    return ConsumerStoreCallbacks<decltype(args_tuple)>(std::move(args_tuple), params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,210 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+  \brief Visitor tree store operation that writes the non-zero blocks of a block-sparse output for sm90 TMA warp-specialized epilogue
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_sddmm.hpp"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::fusion {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Block-sparse store
+// Writes the visited results of each CTA tile into the values of a BSR output whose blocks have the
+// CTA tile shape (BLK_M, BLK_N): non-zero block b of batch l is a row-major (BLK_M, BLK_N) block at
+// ptr_blocks + (l * num_blocks + b) * BLK_M * BLK_N. The block row offsets and column indices are those
+// of PersistentTileSchedulerSm90Sddmm, which visits only the non-zero blocks; tiles of zero blocks
+// visited by other schedulers are dropped.
+//
+//   Assumptions:
+//     1. Block columns are sorted within each block row, the block of a tile is found by bisection.
+//     2. Elements of a block outside of the (M,N) problem are not written.
+//
+template <
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+struct Sm90BlockSparseStore {
+  static constexpr int BlkM = size<0>(CtaTileShapeMNK{});
+  static constexpr int BlkN = size<1>(CtaTileShapeMNK{});
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementOutput* ptr_blocks = nullptr;             // values of the non-zero blocks, in BSR order
+    int32_t const* block_row_offsets = nullptr;      // ceil_div(M, BLK_M) + 1 BSR row offsets
+    int32_t const* block_col_indices = nullptr;      // block column (N tile) index of each non-zero block
+    int32_t num_blocks = 0;                          // number of non-zero blocks per batch
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    bool implementable = args.num_blocks == 0 ||
+      (args.ptr_blocks != nullptr && args.block_row_offsets != nullptr && args.block_col_indices != nullptr);
+    if (not implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Block-sparse store requires the output blocks and the BSR metadata of the mask.\n");
+    }
+    return implementable;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return cutlass::Status::kSuccess;
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90BlockSparseStore() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90BlockSparseStore(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<class ArgsTuple>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(ArgsTuple&& args_tuple)
+      : args_tuple(cute::forward<ArgsTuple>(args_tuple)) {}
+
+    ArgsTuple args_tuple;
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+
+      auto& [ptr_block, tCcD, tCcCta, residue_tCcD] = args_tuple;
+      if (ptr_block == nullptr) {
+        return frg_input;
+      }
+
+      Tensor tCcD_mn = tCcD(_,_,_,epi_m,epi_n);
+      Tensor tCcCta_mn = tCcCta(_,_,_,epi_m,epi_n);
+
+      using ConvertInput = NumericArrayConverter<ElementOutput, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+
+      Array frg_output = convert_input(frg_input);
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        if (elem_less(tCcD_mn(epi_v * FragmentSize + i), residue_tCcD)) {
+          auto [m, n] = tCcCta_mn(epi_v * FragmentSize + i);
+          ptr_block[m * BlkN + n] = frg_output[i];
+        }
+      }
+
+      return frg_input;
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+
+    using Scheduler = cutlass::gemm::kernel::detail::PersistentTileSchedulerSm90Sddmm;
+    ElementOutput* ptr_block = nullptr;
+    if (params.num_blocks > 0) {
+      int32_t block = Scheduler::find_block(params.block_row_offsets, params.block_col_indices, int32_t(m), int32_t(n));
+      if (block >= 0) {
+        ptr_block = params.ptr_blocks + (int64_t(l) * params.num_blocks + block) * (BlkM * BlkN);
+      }
+    }
+
+    // tCcD is relative to the first coordinate of each thread, blocks are indexed relative to the CTA
+    ThrCopy thread_r2s = args.tiled_copy.get_slice(args.thread_idx);
+    Tensor cCta = flat_divide(make_identity_tensor(make_shape(Int<BlkM>{}, Int<BlkN>{})), args.epi_tile);
+    Tensor tCcCta = [&] () {
+      if constexpr (ReferenceSrc) { return thread_r2s.partition_S(cCta); }
+      else                        { return thread_r2s.partition_D(cCta); }
+    }();                                                                                   // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+
+    auto args_tuple = make_tuple(ptr_block, args.tCcD, tCcCta, args.residue_tCcD);
+    return ConsumerStoreCallbacks<decltype(args_tuple)>(std::move(args_tuple));
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -38,6 +38,7 @@
 #include "cutlass/cutlass.h"
 #include "cutlass/array.h"
 #include "cutlass/numeric_conversion.h"
+#include "cutlass/philox.h"
 #include "cutlass/epilogue/thread/activation.h"
 #include "cutlass/detail/helper_macros.hpp"
 
@@ -215,6 +216,129 @@ public:
 
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Stochastic Rounding Output Conversion
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Converts the output of its child to ElementOutput with stochastic rounding, e.g.
+//   Sm90EVT<Sm90StochasticRound<cutlass::float_e4m3_t>, Sm90LinearCombination<float, float, ...>>
+// Each thread draws its random bits from a Philox4x32-10 stream keyed by the seed, with a counter made
+// from (call index, thread index | batch index << 12, tile m coordinate, tile n coordinate), so results
+// are reproducible for a given seed and kernel configuration.
+template<
+  class ElementOutput,
+  class ElementCompute = float,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest  // rounding of the input to ElementCompute
+>
+struct Sm90StochasticRound {
+
+  static_assert(is_same_v<ElementCompute, float>, "Stochastic rounding converts from float.");
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    uint64_t seed = 0;
+    uint64_t const* seed_ptr = nullptr;    // device pointer, takes precedence over seed if non-null
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const&, Arguments const& args, void*) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return true;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const&, Arguments const&) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return cutlass::Status::kSuccess;
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90StochasticRound() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90StochasticRound(Params const& params, SharedStorage const& shared_storage)
+      : params_ptr(&params) { }
+
+  Params const* params_ptr = nullptr;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(Philox4x32_10 rng)
+      : rng(rng) { }
+
+    Philox4x32_10 rng;
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE Array<ElementOutput, FragmentSize>
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      using ConvertOutput = NumericArrayConverterStochasticRound<ElementOutput, ElementCompute, FragmentSize>;
+      ConvertInput convert_input{};
+      ConvertOutput convert_output{};
+
+      typename ConvertOutput::random_type random_bits;
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; i += 4) {
+        auto words = rng();
+        CUTLASS_PRAGMA_UNROLL
+        for (int j = 0; j < 4 && i + j < FragmentSize; ++j) {
+          random_bits[i + j] = words[j];
+        }
+      }
+
+      return convert_output(convert_input(frg_input), random_bits);
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+    uint64_t seed = params_ptr->seed_ptr != nullptr ? *params_ptr->seed_ptr : params_ptr->seed;
+    Philox4x32_10 rng(seed, 0, uint32_t(args.thread_idx) | (uint32_t(l) << 12), uint32_t(m), uint32_t(n));
+    return ConsumerStoreCallbacks(rng);
+  }
+
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 //
 // Performance Optimized Specializations
@@ -0,0 +1,697 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+  \brief Visitor tree cross-entropy loss fusion operations for sm90 TMA warp-specialized epilogue
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/workspace.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/platform/platform.h"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::fusion {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// Merges the partial logsumexp state (other_max, other_sum) into (max, sum), where
+// sum = sum(exp(x - max)) over the elements seen so far
+template <class ElementCompute>
+CUTLASS_DEVICE void
+merge_online_softmax(ElementCompute& max, ElementCompute& sum, ElementCompute other_max, ElementCompute other_sum) {
+  maximum<ElementCompute, /*PropagateNaN=*/true> max_op{};
+  ElementCompute new_max = max_op(max, other_max);
+  sum = sum * fast_exp(max - new_max) + other_sum * fast_exp(other_max - new_max);
+  max = new_max;
+}
+
+// Running max of a row before any element is seen. This is the lowest finite value rather
+// than -inf so that merging two empty states does not compute exp(-inf - -inf)
+template <class ElementCompute>
+CUTLASS_HOST_DEVICE constexpr ElementCompute
+online_softmax_identity() {
+  return -cutlass::platform::numeric_limits<ElementCompute>::max();
+}
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Per-row cross-entropy loss reduction across columns, e.g. for the LM-head GEMM of a language
+// model with M tokens and a vocabulary of N, without writing the (M,N) logits Z:
+//
+//   lse(m)  = log(sum(exp(Z(m, n)), axis=1))
+//   loss(m) = lse(m) - Z(m, target(m)), or 0 if target(m) == ignore_index
+//
+// Each CTA keeps an online max and sum of exponentials of its rows, along with the logit of the
+// target column if it falls in the CTA tile. The partial states are written to a gmem workspace
+// and the last CTA of each row of tiles merges them, as in the final reduction of Sm90ColReduction.
+//
+//   Assumptions:
+//     1. Targets are in [0,N) or equal to ignore_index.
+//     2. There is a single warp across N in the epilogue tile, so that rows can be reduced
+//        with warp shuffles.
+//     3. The tile counters are zeroed by initialize_workspace, which must be called before
+//        every launch.
+//
+template <
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementTarget = int32_t,
+  class StrideMNL = Stride<_1,_0,int64_t>,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+struct Sm90CrossEntropyColReduction {
+private:
+  static_assert(is_same_v<ElementCompute, float>, "Fused cross-entropy reduction requires FP32 compute.");
+  static_assert(is_static_v<decltype(take<0,2>(StrideMNL{}))>); // batch stride can be dynamic or static
+  static_assert(take<0,2>(StrideMNL{}) == Stride<_1,_0>{}, "Per-row outputs must be contiguous (M,L) vectors.");
+
+  // Running max, sum of exponentials and target logit of each row
+  static constexpr int NumPartials = 3;
+
+  template <class ProblemShape>
+  static size_t
+  get_reduction_buffer_size(ProblemShape const& problem_shape) {
+    auto problem_shape_mnkl = append<4>(problem_shape, 1);
+    auto [M, N, K, L] = problem_shape_mnkl;
+    auto [tile_M, tile_N, tile_K] = CtaTileShapeMNK{};
+    return product(ceil_div(make_shape(M,N,L), make_shape(tile_M, tile_N))) * tile_M;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_tile_counters_offset(ProblemShape const& problem_shape) {
+    size_t offset = NumPartials * get_reduction_buffer_size(problem_shape) * sizeof(ElementCompute);
+    return round_nearest(offset, MinWorkspaceAlignment);
+  }
+
+public:
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementTarget const* ptr_target = nullptr;  // (M,L) target column of each row
+    ElementOutput* ptr_loss = nullptr;          // (M,L), optional
+    ElementOutput* ptr_lse = nullptr;           // (M,L), optional
+    ElementTarget ignore_index = ElementTarget(-100);
+    StrideMNL dRow = {};
+  };
+
+  struct Params {
+    ElementTarget const* ptr_target = nullptr;
+    ElementOutput* ptr_loss = nullptr;
+    ElementOutput* ptr_lse = nullptr;
+    ElementTarget ignore_index = ElementTarget(-100);
+    StrideMNL dRow = {};
+    ElementCompute* reduction_buffer = nullptr;
+    int* tile_counters = nullptr;
+  };
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    size_t tile_counters_offset = get_tile_counters_offset(problem_shape);
+    return {
+      args.ptr_target,
+      args.ptr_loss,
+      args.ptr_lse,
+      args.ignore_index,
+      args.dRow,
+      reinterpret_cast<ElementCompute*>(workspace),
+      reinterpret_cast<int*>(reinterpret_cast<uint8_t*>(workspace) + tile_counters_offset)
+    };
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return args.ptr_target != nullptr;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    auto problem_shape_mnkl = append<4>(problem_shape, 1);
+    auto [M, N, K, L] = problem_shape_mnkl;
+    auto [tile_M, tile_N, tile_K] = CtaTileShapeMNK{};
+
+    // Reduction buffers, followed by a tile counter for each row of CTA tiles of each batch
+    size_t workspace_size = get_tile_counters_offset(problem_shape);
+    workspace_size += cute::ceil_div(M, tile_M) * L * sizeof(int);
+    return workspace_size;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    auto problem_shape_mnkl = append<4>(problem_shape, 1);
+    auto [M, N, K, L] = problem_shape_mnkl;
+    auto [tile_M, tile_N, tile_K] = CtaTileShapeMNK{};
+
+    int* tile_counters = reinterpret_cast<int*>(reinterpret_cast<uint8_t*>(workspace) + get_tile_counters_offset(problem_shape));
+    size_t tile_counters_size = cute::ceil_div(M, tile_M) * L * sizeof(int);
+    return zero_workspace(tile_counters, tile_counters_size, stream, cuda_adapter);
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90CrossEntropyColReduction() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90CrossEntropyColReduction(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<class ArgsTuple>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(ArgsTuple&& args_tuple, Params const& params)
+      : args_tuple(cute::forward<ArgsTuple>(args_tuple)),
+        params(params) {}
+
+    ArgsTuple args_tuple;
+    Params const& params;
+    bool do_final_reduction = false;
+
+    CUTLASS_DEVICE void
+    begin() {
+      auto& [ref_src, tCrMax, tCrSum, tCrLogit, tCrTarget, tCgTarget, tCcCol, tCcCta, cCol,
+              gTarget_l, gLoss_l, gLse_l, gBufMax_nl, gBufSum_nl, gBufLogit_nl,
+              lane_layout_MN, lane_mn, tile_counter_idx, tile_coord_mnkl,
+              residue_cCol, residue_tCcCol, epi_tile, tiled_copy, thread_idx] = args_tuple;
+
+      // Rows outside of the problem never match a column
+      fill(tCrTarget, params.ignore_index);
+
+      // Filter so we don't issue redundant copies over stride-0 modes
+      Tensor tCgTarget_flt = filter_zeros(tCgTarget);
+      Tensor tCrTarget_flt = filter_zeros(tCrTarget);
+      Tensor tCcTarget_flt = filter_zeros(tCcCol, tCgTarget.stride());
+      Tensor tCpTarget_flt = cute::lazy::transform(tCcTarget_flt, [&](auto const& c){ return elem_less(c, residue_tCcCol); });
+      copy_if(tCpTarget_flt, tCgTarget_flt, tCrTarget_flt);
+    }
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+
+      auto& [ref_src, tCrMax, tCrSum, tCrLogit, tCrTarget, tCgTarget, tCcCol, tCcCta, cCol,
+              gTarget_l, gLoss_l, gLse_l, gBufMax_nl, gBufSum_nl, gBufLogit_nl,
+              lane_layout_MN, lane_mn, tile_counter_idx, tile_coord_mnkl,
+              residue_cCol, residue_tCcCol, epi_tile, tiled_copy, thread_idx] = args_tuple;
+      Tensor tCrMax_mn = tCrMax(_,_,_,epi_m,epi_n);
+      Tensor tCrSum_mn = tCrSum(_,_,_,epi_m,epi_n);
+      Tensor tCrLogit_mn = tCrLogit(_,_,_,epi_m,epi_n);
+      Tensor tCrTarget_mn = tCrTarget(_,_,_,epi_m,epi_n);
+      Tensor tCcCol_mn = tCcCol(_,_,_,epi_m,epi_n);
+      Tensor tCcCta_mn = tCcCta(_,_,_,epi_m,epi_n);
+
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+
+      int col_offset = get<1>(tile_coord_mnkl) * size<1>(CtaTileShapeMNK{});
+
+      Array frg_I = convert_input(frg_input);
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        int idx = epi_v * FragmentSize + i;
+        if (elem_less(tCcCol_mn(idx), residue_tCcCol)) {
+          ElementCompute x = frg_I[i];
+          ElementCompute& row_max = tCrMax_mn(idx);
+          ElementCompute& row_sum = tCrSum_mn(idx);
+          // Rescale the running sum only when the max changes, so that each element costs one exp
+          if (x > row_max) {
+            row_sum = row_sum * fast_exp(row_max - x) + ElementCompute(1);
+            row_max = x;
+          }
+          else {
+            row_sum += fast_exp(x - row_max);
+          }
+          if (col_offset + get<1>(tCcCta_mn(idx)) == int(tCrTarget_mn(idx))) {
+            tCrLogit_mn(idx) = x;
+          }
+        }
+      }
+
+      return frg_input;
+    }
+
+    template <class STensor, class SyncFn, class VTensor>
+    CUTLASS_DEVICE void
+    reduce(STensor&& smem_buffer, SyncFn const& sync_fn, int epi_m, int epi_n, bool is_last_iteration, VTensor visit_results) {
+      if (not is_last_iteration) {
+        return;
+      }
+
+      auto& [ref_src, tCrMax, tCrSum, tCrLogit, tCrTarget, tCgTarget, tCcCol, tCcCta, cCol,
+              gTarget_l, gLoss_l, gLse_l, gBufMax_nl, gBufSum_nl, gBufLogit_nl,
+              lane_layout_MN, lane_mn, tile_counter_idx, tile_coord_mnkl,
+              residue_cCol, residue_tCcCol, epi_tile, tiled_copy, thread_idx] = args_tuple;
+      auto [m, n, k, l] = tile_coord_mnkl;
+      constexpr bool ReferenceSrc = decltype(ref_src)::value;
+
+      // fully OOB CTA in partially OOB cluster
+      if (not elem_less(cCol(_0{},_0{}), residue_cCol)) {
+        return;
+      }
+
+      //
+      // 1. Warp shuffle reduction
+      //
+      // The register tensors have 0-strides along modes that correspond to N, so we reduce
+      // their co-domain through filtered views. Only one lane holds the target logit of a row,
+      // the others hold 0.
+      Tensor tCrMax_f = filter(tCrMax);
+      Tensor tCrSum_f = filter(tCrSum);
+      Tensor tCrLogit_f = filter(tCrLogit);
+      CUTLASS_PRAGMA_UNROLL
+      for (int reduction_cols = size<1>(lane_layout_MN) / 2; reduction_cols > 0; reduction_cols /= 2) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(tCrMax_f); ++i) {
+          int src_lane = lane_layout_MN(_0{},reduction_cols);
+          ElementCompute other_max = __shfl_down_sync(0xFFFFFFFF, tCrMax_f(i), src_lane);
+          ElementCompute other_sum = __shfl_down_sync(0xFFFFFFFF, tCrSum_f(i), src_lane);
+          ElementCompute other_logit = __shfl_down_sync(0xFFFFFFFF, tCrLogit_f(i), src_lane);
+          detail::merge_online_softmax(tCrMax_f(i), tCrSum_f(i), other_max, other_sum);
+          tCrLogit_f(i) += other_logit;
+        }
+      }
+      bool is_reduced_lane = get<1>(lane_mn) == 0;
+
+      //
+      // 2. One warp in N, dump warp reduction to gmem workspace
+      //
+      using ElementGmem = ElementCompute volatile;
+      Tensor tCgBufMax = sm90_partition_for_epilogue<ReferenceSrc>(gBufMax_nl(_,_,n,l), epi_tile, tiled_copy, thread_idx);
+      Tensor tCgBufSum = sm90_partition_for_epilogue<ReferenceSrc>(gBufSum_nl(_,_,n,l), epi_tile, tiled_copy, thread_idx);
+      Tensor tCgBufLogit = sm90_partition_for_epilogue<ReferenceSrc>(gBufLogit_nl(_,_,n,l), epi_tile, tiled_copy, thread_idx);
+      if (is_reduced_lane) {
+        copy_aligned(tCrMax, recast<ElementGmem>(tCgBufMax));
+        copy_aligned(tCrSum, recast<ElementGmem>(tCgBufSum));
+        copy_aligned(tCrLogit, recast<ElementGmem>(tCgBufLogit));
+      }
+      sync_fn();
+
+      //
+      // 3. Increment atomic counters to signal final gmem reduction
+      //
+      // Ensure gmem writes are visible to other threads before incrementing counter
+      __threadfence();
+      sync_fn();
+      // Collective thread 0 increments atomic tile counter and copies value to smem
+      int* prev_tile_count = reinterpret_cast<int*>(raw_pointer_cast(smem_buffer.data()));
+      if (thread_idx == 0) {
+        *prev_tile_count = atomicAdd(&params.tile_counters[tile_counter_idx], 1);
+      }
+      sync_fn();
+      // Broadcast tile count to other threads in CTA and determine final reduction status
+      do_final_reduction = *prev_tile_count == size<2>(gBufMax_nl) - 1;
+      sync_fn();
+    }
+
+    CUTLASS_DEVICE void
+    end() {
+      //
+      // 4. Do final gmem reduction if necessary
+      //
+      if (not do_final_reduction) {
+        return;
+      }
+
+      auto& [ref_src, tCrMax, tCrSum, tCrLogit, tCrTarget, tCgTarget, tCcCol, tCcCta, cCol,
+              gTarget_l, gLoss_l, gLse_l, gBufMax_nl, gBufSum_nl, gBufLogit_nl,
+              lane_layout_MN, lane_mn, tile_counter_idx, tile_coord_mnkl,
+              residue_cCol, residue_tCcCol, epi_tile, tiled_copy, thread_idx] = args_tuple;
+      auto [m, n, k, l] = tile_coord_mnkl;
+
+      using ConvertOutput = NumericConverter<ElementOutput, ElementCompute, RoundStyle>;
+      ConvertOutput convert_output{};
+
+      CUTLASS_PRAGMA_NO_UNROLL
+      for (int row = thread_idx; row < size<0>(gBufMax_nl); row += size(tiled_copy)) {
+        if (not elem_less(cCol(row,_0{}), residue_cCol)) {
+          continue;
+        }
+
+        ElementCompute row_max = gBufMax_nl(row,_0{},_0{},l);
+        ElementCompute row_sum = gBufSum_nl(row,_0{},_0{},l);
+        ElementCompute row_logit = gBufLogit_nl(row,_0{},_0{},l);
+        CUTLASS_PRAGMA_NO_UNROLL
+        for (int n_ = 1; n_ < size<2>(gBufMax_nl); ++n_) {
+          detail::merge_online_softmax(row_max, row_sum, gBufMax_nl(row,_0{},n_,l), gBufSum_nl(row,_0{},n_,l));
+          row_logit += gBufLogit_nl(row,_0{},n_,l);
+        }
+
+        ElementCompute lse = row_max + fast_log(row_sum);
+        ElementTarget target = gTarget_l(row,_0{},l);
+        ElementCompute loss = target != params.ignore_index ? lse - row_logit : ElementCompute(0);
+
+        if (params.ptr_loss != nullptr) {
+          gLoss_l(row,_0{},l) = convert_output(loss);
+        }
+        if (params.ptr_lse != nullptr) {
+          gLse_l(row,_0{},l) = convert_output(lse);
+        }
+      }
+    }
+
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    Layout ref_layout_MN = [&] () {
+      auto mn_shape = shape(typename decltype(args.tiled_copy)::Tiler_MN{});
+      if constexpr (ReferenceSrc) { return right_inverse(args.tiled_copy.get_layoutS_TV()).with_shape(mn_shape); }
+      else                        { return right_inverse(args.tiled_copy.get_layoutD_TV()).with_shape(mn_shape); }
+    }();                                                                                         // tile_mn -> tv_idx
+
+    // Get the MN layout + coord of lanes to determine shuffle reduction iterations
+    using _W = Int<decltype(args.tiled_copy)::TiledNumThr::value / NumThreadsPerWarp>;
+    Layout tv2lane = Layout<Shape<Int<NumThreadsPerWarp>,_W,_1>,Stride<_1,_0,_0>>{};            //   tv_idx -> lane_idx
+    Layout ref2lane = composition(tv2lane, ref_layout_MN);                                      //  tile_mn -> lane_idx
+    Layout lane_layout_MN = make_layout(filter(get<0>(ref2lane)), filter(get<1>(ref2lane)));    //  lane_mn -> lane_idx
+    Layout inv_lane_layout_MN = right_inverse(lane_layout_MN);                                  // lane_idx -> lane_mn
+    int lane_idx = canonical_lane_idx();
+    auto lane_mn = idx2crd(inv_lane_layout_MN(lane_idx), shape(lane_layout_MN));
+
+    // Get the MN layout of warps
+    Layout tv2warp = Layout<Shape<Int<NumThreadsPerWarp>,_W,_1>,Stride<_0,_1,_0>>{};            //   tv_idx -> warp_idx
+    Layout ref2warp = composition(tv2warp, ref_layout_MN);                                      //  tile_mn -> warp_idx
+    Layout warp_layout_MN = make_layout(filter(get<0>(ref2warp)), filter(get<1>(ref2warp)));    //  warp_mn -> warp_idx
+
+    // Make sure there's only one warp across N so we can use warp shuffle intrinsics for reduction.
+    static_assert(decltype(size<1>(warp_layout_MN))::value <= 1,
+      "Fused cross-entropy reduction requires a single warp across N in the epilogue tile.");
+
+    // Partition per-row gmem and register tensors
+    auto [tile_M, tile_N, tile_K] = args.tile_shape_mnk;
+    auto [M, N, K, L] = args.problem_shape_mnkl;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+
+    Tensor mTarget = make_tensor(make_gmem_ptr(params.ptr_target), make_shape(M,N,L), params.dRow);  // (M,N,L)
+    Tensor mLoss = make_tensor(make_gmem_ptr(params.ptr_loss), make_shape(M,N,L), params.dRow);      // (M,N,L)
+    Tensor mLse = make_tensor(make_gmem_ptr(params.ptr_lse), make_shape(M,N,L), params.dRow);        // (M,N,L)
+    Tensor gTarget_l = local_tile(mTarget, take<0,2>(args.tile_shape_mnk), make_coord(m,n,_));      // (CTA_M,CTA_N,L)
+    Tensor gLoss_l = local_tile(mLoss, take<0,2>(args.tile_shape_mnk), make_coord(m,n,_));          // (CTA_M,CTA_N,L)
+    Tensor gLse_l = local_tile(mLse, take<0,2>(args.tile_shape_mnk), make_coord(m,n,_));            // (CTA_M,CTA_N,L)
+    Tensor tCgTarget = sm90_partition_for_epilogue<ReferenceSrc>(                      // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+                         gTarget_l(_,_,l), args.epi_tile, args.tiled_copy, args.thread_idx);
+    Tensor tCrTarget = make_tensor_like<ElementTarget>(tCgTarget);                     // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    Tensor tCrMax = make_tensor_like<ElementCompute>(tCgTarget);                       // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    Tensor tCrSum = make_tensor_like<ElementCompute>(tCgTarget);                       // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    Tensor tCrLogit = make_tensor_like<ElementCompute>(tCgTarget);                     // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    fill(tCrMax, detail::online_softmax_identity<ElementCompute>());
+    fill(tCrSum, ElementCompute(0));
+    fill(tCrLogit, ElementCompute(0));
+
+    // tCcD is relative to the first coordinate of each thread, the target column is compared
+    // against coordinates relative to the CTA instead
+    Tensor cCta = flat_divide(make_identity_tensor(make_shape(tile_M, tile_N)), args.epi_tile); // (EPI_M,EPI_N,...)
+    ThrCopy thread_r2s = args.tiled_copy.get_slice(args.thread_idx);
+    Tensor tCcCta = [&] () {
+      if constexpr (ReferenceSrc) { return thread_r2s.partition_S(cCta); }
+      else                        { return thread_r2s.partition_D(cCta); }
+    }();                                                                               // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+
+    // Partition gmem reduction buffer tensors, one for each of the partial states
+    Layout gBuf_layout = make_layout(take<0,2>(args.tile_shape_mnk), make_stride(_1{}, _0{}));
+    Layout mBuf_layout = blocked_product(gBuf_layout, make_layout(ceil_div(make_shape(M,N,L), shape(gBuf_layout))));
+    ElementCompute* ptr_buf_max = params.reduction_buffer;
+    ElementCompute* ptr_buf_sum = ptr_buf_max + size(mBuf_layout);
+    ElementCompute* ptr_buf_logit = ptr_buf_sum + size(mBuf_layout);
+    Tensor gBufMax_nl = local_tile(make_tensor(make_gmem_ptr(ptr_buf_max), mBuf_layout),
+                          take<0,2>(args.tile_shape_mnk), make_coord(m,_,_));         // (CTA_M,CTA_N,REST_N,L)
+    Tensor gBufSum_nl = local_tile(make_tensor(make_gmem_ptr(ptr_buf_sum), mBuf_layout),
+                          take<0,2>(args.tile_shape_mnk), make_coord(m,_,_));         // (CTA_M,CTA_N,REST_N,L)
+    Tensor gBufLogit_nl = local_tile(make_tensor(make_gmem_ptr(ptr_buf_logit), mBuf_layout),
+                            take<0,2>(args.tile_shape_mnk), make_coord(m,_,_));       // (CTA_M,CTA_N,REST_N,L)
+
+    // One tile counter per row of CTA tiles of each batch
+    int tile_counter_idx = int(l) * int(ceil_div(M, tile_M)) + int(m);
+
+    auto args_tuple = make_tuple(
+        bool_constant<ReferenceSrc>{}, cute::move(tCrMax), cute::move(tCrSum), cute::move(tCrLogit),
+        cute::move(tCrTarget), tCgTarget, args.tCcD, tCcCta, args.cD,
+        gTarget_l, gLoss_l, gLse_l, gBufMax_nl, gBufSum_nl, gBufLogit_nl,
+        lane_layout_MN, lane_mn, tile_counter_idx, args.tile_coord_mnkl,
+        args.residue_cD, args.residue_tCcD, args.epi_tile, args.tiled_copy, args.thread_idx);
+    return ConsumerStoreCallbacks<decltype(args_tuple)>(std::move(args_tuple), params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Gradient of the cross-entropy loss of Sm90CrossEntropyColReduction with respect to the logits Z,
+// recomputed from the same GEMM operands so that the logits are never materialized:
+//
+//   dZ(m, n) = dloss(m) * (exp(Z(m, n) - lse(m)) - (n == target(m))), or 0 if target(m) == ignore_index
+//
+// where lse is the per-row logsumexp written by the forward pass, and dloss is either a per-row
+// vector or a scalar, e.g. 1 / num_valid_rows for a mean reduction of the loss.
+//
+template <
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementTarget = int32_t,
+  class StrideMNL = Stride<_1,_0,int64_t>,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+struct Sm90CrossEntropyGrad {
+private:
+  static_assert(is_same_v<ElementCompute, float>, "Fused cross-entropy gradient requires FP32 compute.");
+  static_assert(is_static_v<decltype(take<0,2>(StrideMNL{}))>); // batch stride can be dynamic or static
+  static_assert(take<0,2>(StrideMNL{}) == Stride<_1,_0>{}, "Per-row inputs must be contiguous (M,L) vectors.");
+
+public:
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementTarget const* ptr_target = nullptr;   // (M,L) target column of each row
+    ElementCompute const* ptr_lse = nullptr;     // (M,L) logsumexp of each row
+    ElementCompute const* ptr_dloss = nullptr;   // (M,L), optional, dloss is used if null
+    ElementCompute dloss = ElementCompute(1);
+    ElementTarget ignore_index = ElementTarget(-100);
+    StrideMNL dRow = {};
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return args.ptr_target != nullptr && args.ptr_lse != nullptr;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90CrossEntropyGrad() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90CrossEntropyGrad(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<class ArgsTuple>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(ArgsTuple&& args_tuple, Params const& params)
+      : args_tuple(cute::forward<ArgsTuple>(args_tuple)),
+        params(params) {}
+
+    ArgsTuple args_tuple;
+    Params const& params;
+
+    CUTLASS_DEVICE void
+    begin() {
+      auto& [tCrTarget, tCrLse, tCrDloss, tCgTarget, tCgLse, tCgDloss, tCcCol, tCcCta,
+              col_offset, residue_tCcCol] = args_tuple;
+
+      fill(tCrTarget, params.ignore_index);
+      fill(tCrLse, ElementCompute(0));
+      fill(tCrDloss, params.dloss);
+
+      // Filter so we don't issue redundant copies over stride-0 modes
+      // (only works if 0-strides are in same location, which is by construction)
+      Tensor tCcRow_flt = filter_zeros(tCcCol, tCgTarget.stride());
+      Tensor tCpRow_flt = cute::lazy::transform(tCcRow_flt, [&](auto const& c){ return elem_less(c, residue_tCcCol); });
+      copy_if(tCpRow_flt, filter_zeros(tCgTarget), filter_zeros(tCrTarget));
+      copy_if(tCpRow_flt, filter_zeros(tCgLse), filter_zeros(tCrLse));
+      if (params.ptr_dloss != nullptr) {
+        copy_if(tCpRow_flt, filter_zeros(tCgDloss), filter_zeros(tCrDloss));
+      }
+    }
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE Array<ElementOutput, FragmentSize>
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+
+      auto& [tCrTarget, tCrLse, tCrDloss, tCgTarget, tCgLse, tCgDloss, tCcCol, tCcCta,
+              col_offset, residue_tCcCol] = args_tuple;
+      Tensor tCrTarget_mn = tCrTarget(_,_,_,epi_m,epi_n);
+      Tensor tCrLse_mn = tCrLse(_,_,_,epi_m,epi_n);
+      Tensor tCrDloss_mn = tCrDloss(_,_,_,epi_m,epi_n);
+      Tensor tCcCta_mn = tCcCta(_,_,_,epi_m,epi_n);
+
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      using ConvertOutput = NumericArrayConverter<ElementOutput, ElementCompute, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+      ConvertOutput convert_output{};
+
+      Array frg_I = convert_input(frg_input);
+      Array<ElementCompute, FragmentSize> frg_grad;
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        int idx = epi_v * FragmentSize + i;
+        ElementTarget target = tCrTarget_mn(idx);
+        ElementCompute prob = fast_exp(frg_I[i] - tCrLse_mn(idx));
+        ElementCompute is_target = col_offset + get<1>(tCcCta_mn(idx)) == int(target) ? ElementCompute(1) : ElementCompute(0);
+        frg_grad[i] = target == params.ignore_index ? ElementCompute(0) : (prob - is_target) * tCrDloss_mn(idx);
+      }
+
+      return convert_output(frg_grad);
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    auto [tile_M, tile_N, tile_K] = args.tile_shape_mnk;
+    auto [M, N, K, L] = args.problem_shape_mnkl;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+
+    Tensor mTarget = make_tensor(make_gmem_ptr(params.ptr_target), make_shape(M,N,L), params.dRow); // (M,N,L)
+    Tensor mLse = make_tensor(make_gmem_ptr(params.ptr_lse), make_shape(M,N,L), params.dRow);       // (M,N,L)
+    Tensor mDloss = make_tensor(make_gmem_ptr(params.ptr_dloss), make_shape(M,N,L), params.dRow);   // (M,N,L)
+    Tensor tCgTarget = sm90_partition_for_epilogue<ReferenceSrc>(                      // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+                         mTarget, args.tile_shape_mnk, args.tile_coord_mnkl, args.epi_tile, args.tiled_copy, args.thread_idx);
+    Tensor tCgLse = sm90_partition_for_epilogue<ReferenceSrc>(                         // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+                      mLse, args.tile_shape_mnk, args.tile_coord_mnkl, args.epi_tile, args.tiled_copy, args.thread_idx);
+    Tensor tCgDloss = sm90_partition_for_epilogue<ReferenceSrc>(                       // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+                        mDloss, args.tile_shape_mnk, args.tile_coord_mnkl, args.epi_tile, args.tiled_copy, args.thread_idx);
+    Tensor tCrTarget = make_tensor_like<ElementTarget>(tCgTarget);                     // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    Tensor tCrLse = make_tensor_like<ElementCompute>(tCgLse);                          // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    Tensor tCrDloss = make_tensor_like<ElementCompute>(tCgDloss);                      // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+
+    // tCcD is relative to the first coordinate of each thread, the target column is compared
+    // against coordinates relative to the CTA instead
+    Tensor cCta = flat_divide(make_identity_tensor(make_shape(tile_M, tile_N)), args.epi_tile); // (EPI_M,EPI_N,...)
+    ThrCopy thread_r2s = args.tiled_copy.get_slice(args.thread_idx);
+    Tensor tCcCta = [&] () {
+      if constexpr (ReferenceSrc) { return thread_r2s.partition_S(cCta); }
+      else                        { return thread_r2s.partition_D(cCta); }
+    }();                                                                               // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    int col_offset = int(n) * int(tile_N);
+
+    auto args_tuple = make_tuple(
+        cute::move(tCrTarget), cute::move(tCrLse), cute::move(tCrDloss), tCgTarget, tCgLse, tCgDloss,
+        args.tCcD, tCcCta, col_offset, args.residue_tCcD);
+    return ConsumerStoreCallbacks<decltype(args_tuple)>(std::move(args_tuple), params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,465 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+  \brief Visitor tree node for gated activation functions (GLU, e.g. SwiGLU or GeGLU)
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/workspace.h"
+
+#include "cute/tensor.hpp"
+
+#include "cutlass/epilogue/fusion/sm90_visitor_tma_warpspecialized.hpp"          // Sm90TreeVisitor
+#include "cutlass/epilogue/fusion/sm90_visitor_load_tma_warpspecialized.hpp"     // Sm90ScalarBroadcastSelector
+#include "cutlass/epilogue/fusion/sm90_visitor_store_tma_warpspecialized.hpp"    // Sm90Aux(Array)Store
+#include "cutlass/epilogue/fusion/sm90_visitor_compute_tma_warpspecialized.hpp"  // Sm90Compute
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::fusion {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// Halves an N extent, or an N tiler with a unit-stride leading mode such as the SM100 epilogue tile
+// (N/WarpN,WarpN):(1,CtaN/WarpN), by dropping every other column
+template <class ExtentOrTiler>
+CUTLASS_HOST_DEVICE
+constexpr auto
+gated_halve_n(ExtentOrTiler const& n) {
+  using namespace cute;
+  if constexpr (is_layout<ExtentOrTiler>::value) {
+    auto layout = coalesce(n);
+    static_assert(remove_cvref_t<decltype(front(flatten(stride(layout))))>::value == 1,
+      "Gated N tiler must have a unit-stride leading mode");
+    auto shape_out = [&] () {
+      if constexpr (is_tuple<decltype(shape(layout))>::value) {
+        return replace<0>(shape(layout), get<0>(shape(layout)) / _2{});
+      }
+      else {
+        return shape(layout) / _2{};
+      }
+    }();
+    auto stride_out = transform_leaf(stride(layout), [] (auto d) { return ceil_div(d, _2{}); });
+    return make_layout(shape_out, stride_out);
+  }
+  else {
+    return n / _2{};
+  }
+}
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Gated activation: store(x0 * f(x1)), where x0 and x1 are the two halves of the input tile
+// along mode ModeIndex. The output is written at half the size of the input through an aux store,
+// which requires every thread to hold matching x0 and x1 values:
+//
+//   ModeIndex = 0: x0 and x1 alternate along M in groups of 8 rows, as in the WGMMA accumulator
+//                  layout. The input has an (8,2,M/16) mode-0, the output an (8,M/16) mode-0.
+//   ModeIndex = 1: x0 and x1 alternate along N in adjacent columns, as in the 32dp32b and 16dp256b
+//                  TMEM load layouts. The output has N/2 columns.
+template<
+  bool PtrArray,
+  bool Quantize,
+  template <class> class ActivationFn,
+  int Stages,
+  int NumEpilogueWarpGroups,
+  class EpilogueTile,
+  class StrideMNL,
+  class SmemLayoutAtom,
+  class CopyOpR2S,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest,
+  int ModeIndex = 0>
+struct Sm90GatedActivation
+{
+  static_assert(ModeIndex == 0 || ModeIndex == 1, "Gated activation only supports gating along M or N");
+
+  // Transparently handle PtrArray/GroupGemm case by using a dummy shape on host
+  template<class ProblemShape>
+  CUTLASS_HOST_DEVICE
+  static constexpr auto
+  get_problem_shape(ProblemShape const& problem_shape) {
+    if constexpr (PtrArray) {
+      return typename ProblemShape::UnderlyingProblemShape{};
+    }
+    else {
+      return problem_shape;
+    }
+  }
+
+  // Convert input problem shape [(M,2),N,K,L] to output problem shape [M,N,K,L],
+  // or [M,N,K,L] to [M,N/2,K,L] when gating along N
+  template<class Shape>
+  CUTLASS_HOST_DEVICE
+  static constexpr auto
+  to_output_shape(Shape const& shape) {
+    using namespace cute;
+    if constexpr (ModeIndex == 0) {
+      static_assert(CUTE_STATIC_V(rank<0>(shape)) == 3, "Input shape/coord must have a rank-3 M-mode");
+      auto M = remove<1>(get<0>(shape));
+      return replace<0>(shape, M);
+    }
+    else {
+      return replace<1>(shape, detail::gated_halve_n(get<1>(shape)));
+    }
+  }
+
+  // Tile coordinates are unchanged when gating along N, only the tile size is halved
+  template<class Coord>
+  CUTLASS_HOST_DEVICE
+  static constexpr auto
+  to_output_coord(Coord const& coord) {
+    if constexpr (ModeIndex == 0) {
+      return to_output_shape(coord);
+    }
+    else {
+      return coord;
+    }
+  }
+
+  using EpilogueTileOut = decltype(to_output_shape(EpilogueTile{}));
+
+  // Define sub-EVTs below that will be invoked manually
+  // Cannot compose them using normal EVT structure due to gated activation logic:
+  // 1. Compute EVT (activation) is only visited on "bottom" half of the values
+  // 2. Store EVT is visited after multiplying gating and activation values, 
+  //    which needs access to the whole epilogue tile, i.e. in reduce()
+
+  using ComputeOp = Sm90Compute<ActivationFn, ElementCompute, ElementCompute, RoundStyle>;
+  using ComputeEVT = Sm90TreeVisitor<ComputeOp, Sm90AccFetch>; // leaf input slot
+
+  using StoreOp = cute::conditional_t<PtrArray,
+    Sm90AuxArrayStore<Stages, NumEpilogueWarpGroups, EpilogueTileOut, ElementOutput, RoundStyle, StrideMNL, SmemLayoutAtom, CopyOpR2S>,
+    Sm90AuxStore<Stages, EpilogueTileOut, ElementOutput, RoundStyle, StrideMNL, SmemLayoutAtom, CopyOpR2S>
+  >;
+  using ScaleOp = Sm90TreeVisitor<Sm90Compute<multiplies, ElementCompute, ElementCompute, RoundStyle>,  // scale op
+                          Sm90ScalarBroadcastSelector<PtrArray, ElementScalar, Stride<_0,_0,int64_t>>, // scale factor broadcast
+                          Sm90AccFetch>;                                                               // leaf input slot
+  using StoreEVT = Sm90TreeVisitor<StoreOp, cute::conditional_t<Quantize, ScaleOp, Sm90AccFetch>>;
+
+  // Delegate most operations to generic Sm90Visitor even though we don't inherit from it
+  using Impl = Sm90TreeVisitor<StoreEVT, ComputeEVT>;
+
+  using SharedStorage = typename Impl::SharedStorage;
+  using Arguments = typename Impl::Arguments;
+  using Params = typename Impl::Params;
+  template <bool IsLoad>
+  using TensorMaps = typename Impl::template TensorMaps<IsLoad>;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return Impl::to_underlying_arguments(to_output_shape(get_problem_shape(problem_shape)), args, workspace);
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    if constexpr (ModeIndex == 1) {
+      // Gate and up columns must come in pairs
+      if (get<1>(problem_shape) % 2 != 0) {
+        return false;
+      }
+    }
+    // unlike other host APIs, can_implement gets passed underlying problem shape for Grouped Gemm cases
+    return Impl::can_implement(to_output_shape(problem_shape), args);
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return Impl::get_workspace_size(to_output_shape(get_problem_shape(problem_shape)), args);
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return Impl::initialize_workspace(to_output_shape(get_problem_shape(problem_shape)), args, workspace, stream);
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90GatedActivation() : impl() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90GatedActivation(Params const& params, SharedStorage const& shared_storage)
+    : impl(params, shared_storage) { }
+
+  Impl impl;
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return impl.is_producer_load_needed();
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return impl.is_C_load_needed();
+  }
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return impl.get_producer_load_callbacks(args);
+  }
+
+  template <
+    class CallbacksImpl,
+    class CrdTensor
+  >
+  struct ConsumerStoreCallbacks : CallbacksImpl {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(
+        CallbacksImpl impl,
+        CrdTensor tRS_cD)
+    : CallbacksImpl(impl), 
+      tRS_cD(tRS_cD) {}
+
+    using CallbacksImpl::callbacks_tuple;
+    CrdTensor tRS_cD;
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      using namespace cute;
+
+      static_assert(FragmentSize % 4 == 0, "Fragment size is too small");
+      using FrgOutput = Array<ElementInput, FragmentSize / 2>;
+
+      // This splitting relies on details of the accumulator register layout, see get_consumer_store_callbacks
+      auto [input_val, input_act] = [&] () {
+        if constexpr (ModeIndex == 0) {
+          // WGMMA: rows r and r+8 alternate every 2 values
+          Tensor input = flat_divide(make_tensor(frg_input.data(), Int<FragmentSize>{}), Layout<Shape<_2,_2>>{});
+          Tensor val = make_tensor_like(input(_,0,_));
+          Tensor act = make_tensor_like(input(_,1,_));
+          copy(input(_,0,_), val);
+          copy(input(_,1,_), act);
+          return cute::make_tuple(val, act);
+        }
+        else {
+          // Columns 2n and 2n+1 alternate every value
+          Tensor input = make_tensor(frg_input.data(), Layout<Shape<_2,Int<FragmentSize/2>>>{});
+          Tensor val = make_tensor_like(input(0,_));
+          Tensor act = make_tensor_like(input(1,_));
+          copy(input(0,_), val);
+          copy(input(1,_), act);
+          return cute::make_tuple(val, act);
+        }
+      }();
+
+      FrgOutput const& frg_input_val = recast<FrgOutput>(input_val)(0);
+      FrgOutput const& frg_input_act = recast<FrgOutput>(input_act)(0);
+
+      // store(gemm0 * act(gemm1))
+      FrgOutput frg_output_act = get<0>(callbacks_tuple).visit(frg_input_act, epi_v, epi_m, epi_n);
+      FrgOutput frg_output = frg_input_val * frg_output_act;
+      get<1>(callbacks_tuple).visit(frg_output, epi_v, epi_m, epi_n);
+
+      if constexpr (ModeIndex == 0) {
+        return frg_input;
+      }
+      else {
+        // The sm100 collective stores the visited fragment in the output type, it is discarded as D is void
+        return NumericArrayConverter<ElementOutput, ElementInput, FragmentSize, RoundStyle>{}(frg_input);
+      }
+    }
+  };
+
+  // Whether values 2v and 2v+1 of every thread hold columns 2n and 2n+1 of the same row
+  template <class LayoutTV, class TilerM, class TilerN>
+  CUTLASS_HOST_DEVICE
+  static constexpr bool
+  is_column_paired() {
+    using namespace cute;
+    // By-mode coalesced layouts are functionally equivalent and cheaper to evaluate
+    constexpr auto layout_tv = coalesce(LayoutTV{}, Step<_1,_1>{});
+    constexpr auto tiler_m = coalesce(TilerM{});
+    constexpr auto tiler_n = coalesce(TilerN{});
+    constexpr int NumThreads = size<0>(layout_tv);
+    constexpr int NumValues = size<1>(layout_tv);
+    constexpr int TilerSizeM = size(tiler_m);
+    if constexpr (NumValues % 2 != 0) {
+      return false;
+    }
+    else {
+      for (int t = 0; t < NumThreads; ++t) {
+        for (int v = 0; v < NumValues; v += 2) {
+          int idx0 = layout_tv(t, v);
+          int idx1 = layout_tv(t, v + 1);
+          int m0 = tiler_m(idx0 % TilerSizeM), n0 = tiler_n(idx0 / TilerSizeM);
+          int m1 = tiler_m(idx1 % TilerSizeM), n1 = tiler_n(idx1 / TilerSizeM);
+          if (m0 != m1 || n0 % 2 != 0 || n1 != n0 + 1) {
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+  }
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+
+    using namespace cute;
+
+    // Transform TV layout of the tiled copy by removing every other group of 8 rows,
+    // or every other column when gating along N.
+    // Note: assumes by-mode tilers that are bijective here - not necessarily the case in general!
+
+    // The TV layout of a TMEM load is in TMEM address units, so gating along N uses its register view instead
+    auto tiled_copy_in = [&] () {
+      if constexpr (ModeIndex == 0) {
+        return args.tiled_copy;
+      }
+      else if constexpr (ReferenceSrc) {
+        return make_tiled_copy_S(Copy_Atom<DefaultCopy,ElementCompute>{}, args.tiled_copy);
+      }
+      else {
+        return make_tiled_copy_D(Copy_Atom<DefaultCopy,ElementCompute>{}, args.tiled_copy);
+      }
+    }();
+
+    auto tiler_mn = typename decltype(tiled_copy_in)::Tiler_MN{};
+    auto layout_tv = typename decltype(tiled_copy_in)::TiledLayout_TV{};
+    auto [tiler_m, tiler_n] = tiler_mn;
+    int constexpr TileM = CUTE_STATIC_V(size(tiler_m));
+    int constexpr TileN = CUTE_STATIC_V(size(tiler_n));
+
+    auto [row_selector, col_selector, tiler_mn_out] = [&] () {
+      if constexpr (ModeIndex == 0) {
+        auto row_selector = Layout<Shape<_8,Int<TileM/16>>, Stride<_1,_16>>{}; // select every other group of 8 rows
+        auto col_selector = Layout<Int<TileN>>{};                              // select all columns
+        auto tiler_mn_out = make_tile(
+          right_inverse(make_layout_like(composition(right_inverse(tiler_m), row_selector))),
+          tiler_n
+        );
+        return cute::make_tuple(row_selector, col_selector, tiler_mn_out);
+      }
+      else {
+        static_assert(is_column_paired<decltype(layout_tv), decltype(tiler_m), decltype(tiler_n)>(),
+          "Gating along N requires every thread to hold adjacent column pairs of the accumulator.");
+        auto row_selector = Layout<Int<TileM>>{};                              // select all rows
+        auto col_selector = Layout<Int<TileN/2>, _2>{};                        // select every other column
+        auto tiler_mn_out = make_tile(
+          tiler_m,
+          right_inverse(make_layout_like(composition(right_inverse(tiler_n), col_selector)))
+        );
+        return cute::make_tuple(row_selector, col_selector, tiler_mn_out);
+      }
+    }();
+
+    auto layout_tv_out =
+      right_inverse(                                                         // t,v/2 -> copy m/2,n
+        composition(                                                         // copy m/2,n -> t,v/2
+          make_layout_like(                                                  // real m/2,n -> t,v/2
+            composition(                                                     // real m/2,n -> t,v/2
+              composition(                                                   // real m,n -> t,v
+                right_inverse(layout_tv).with_shape(shape(tiler_mn)),        // copy m,n -> t,v
+                make_tile(right_inverse(tiler_m), right_inverse(tiler_n))    // real m,n -> copy m,n
+              ),
+              make_tile(row_selector, col_selector)                          // real m,n -> real m/2,n
+            )
+          ),
+          tiler_mn_out
+        )
+      ).with_shape(make_shape(size<0>(layout_tv), size<1>(layout_tv)/_2{})); // t,v/2 -> copy m/2,n
+
+    auto tiled_copy = TiledCopy<Copy_Atom<DefaultCopy,ElementCompute>, decltype(layout_tv_out), decltype(tiler_mn_out)>{};
+    
+    auto args_impl = ConsumerStoreArgs{
+      to_output_shape(args.problem_shape_mnkl),
+      to_output_shape(args.tile_shape_mnk),
+      to_output_coord(args.tile_coord_mnkl),
+      args.tiled_mma,
+      EpilogueTileOut{},
+      tiled_copy,
+      args.cD,
+      args.residue_cD,
+      args.tCcD,
+      args.residue_tCcD,
+      args.tCrC,
+      args.thread_idx
+    };
+
+    auto cst_impl = impl.template get_consumer_store_callbacks<ReferenceSrc>(args_impl);
+
+    return ConsumerStoreCallbacks<decltype(cst_impl), decltype(args.tCcD)>(
+      cst_impl, 
+      args.tCcD);
+  }
+
+  template <bool IsLoad, class CallbacksImpl>
+  struct TensorMapCallbacks : CallbacksImpl {
+
+    CUTLASS_DEVICE
+    TensorMapCallbacks(CallbacksImpl&& impl) : CallbacksImpl(cute::move(impl)) {}
+    
+    template <class ProblemShape_MNKL>
+    CUTLASS_DEVICE
+    void
+    perform_update(
+        TensorMaps<IsLoad> tensormaps,
+        ProblemShape_MNKL problem_shape_mnkl,
+        int32_t next_batch,
+        int32_t warp_group_idx)
+    {
+      CallbacksImpl::perform_update(tensormaps, to_output_shape(problem_shape_mnkl), next_batch, warp_group_idx);
+    }
+  };
+
+  template <bool IsLoad>
+  CUTLASS_DEVICE constexpr auto
+  get_tensormap_callbacks() {
+    auto tmap_callbacks = impl.template get_tensormap_callbacks<IsLoad>();
+    return TensorMapCallbacks<IsLoad,decltype(tmap_callbacks)>(cute::move(tmap_callbacks));
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
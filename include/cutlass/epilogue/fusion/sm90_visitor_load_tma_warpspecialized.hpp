@@ -1337,6 +1337,15 @@ private:
   }
 };
 
+// Selects the ptr-array scalar broadcast for grouped/ptr-array kernels
+template<
+  bool PtrArray,
+  class Element,
+  class Stride>
+using Sm90ScalarBroadcastSelector = cute::conditional_t<PtrArray,
+  Sm90ScalarBroadcastPtrArray<Element, Stride>,
+  Sm90ScalarBroadcast<Element, Stride>
+>;
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
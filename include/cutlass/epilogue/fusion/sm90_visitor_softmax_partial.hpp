@@ -0,0 +1,369 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+  \brief Visitor tree partial row softmax fusion operation for sm90 TMA warp-specialized epilogue
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/functional.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/platform/platform.h"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::fusion {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Partial row softmax across columns
+// Exponentiates each row of the epilogue tile relative to its own maximum and emits the
+// per-row statistics of each block of EPI_N columns:
+//
+//   max(m, n_blk) = max(Z(m, n)) over the EPI_N columns of block n_blk
+//   sum(m, n_blk) = sum(exp(Z(m, n) - max(m, n_blk))) over the same columns
+//   D(m, n)       = exp(Z(m, n) - max(m, n_blk))
+//
+// so that softmax(Z)(m, n) = D(m, n) * exp(max(m, n_blk) - max(m)) / sum(m), with
+//
+//   max(m) = max(max(m, :))
+//   sum(m) = sum(sum(m, :) * exp(max(m, :) - max(m)))
+//
+// which is applied in place by reduction::kernel::SoftmaxPartialFinalize after the GEMM.
+// If a row fits in a single epilogue tile (N <= EPI_N), D is normalized here and no
+// finalization is needed.
+//
+//   Assumptions:
+//     1. There is a single warp across N in the epilogue tile, so that rows can be reduced
+//        with warp shuffles.
+//     2. Visited results may already be converted to the output type (e.g. by the sm100
+//        epilogue), in which case they are exponentiated after rounding.
+//
+template <
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class EpilogueTile,
+  class ElementCompute,
+  class ElementPartial = float,
+  class StridePartialMNL = Stride<_1, int64_t, int64_t>,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+struct Sm90SoftmaxPartialColReduction {
+private:
+  static_assert(is_same_v<ElementCompute, float>, "Fused partial softmax requires FP32 compute.");
+
+  static constexpr int EpiN = size<1>(EpilogueTile{});
+  static_assert(size<1>(CtaTileShapeMNK{}) % EpiN == 0, "EPI_N must divide CTA_N");
+
+public:
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementPartial* ptr_max = nullptr;        // (M,ceil_div(N,EPI_N),L) row max of each block of columns
+    ElementPartial* ptr_sum = nullptr;        // (M,ceil_div(N,EPI_N),L) row sum of exponentials of each block
+    StridePartialMNL dPartial = {};
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    // The partial statistics are only optional if rows are normalized in the epilogue
+    auto problem_shape_mnkl = append<4>(problem_shape, 1);
+    auto [M, N, K, L] = problem_shape_mnkl;
+    return (args.ptr_max != nullptr && args.ptr_sum != nullptr) || int(N) <= EpiN;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90SoftmaxPartialColReduction() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90SoftmaxPartialColReduction(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<class ArgsTuple>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(ArgsTuple&& args_tuple, Params const& params)
+      : args_tuple(cute::forward<ArgsTuple>(args_tuple)),
+        params(params) {}
+
+    ArgsTuple args_tuple;
+    Params const& params;
+
+    template <typename ElementAccumulator, typename ElementInput>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+
+      auto& [tCrMax, tCrSum, gMax, gSum, tCcCol, tCcCta, cCol,
+              lane_layout_MN, residue_cCol, residue_tCcCol, is_single_block] = args_tuple;
+      Tensor tCcCol_mn = tCcCol(_,_,_,epi_m,epi_n);
+
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+      maximum<ElementCompute, /*PropagateNaN=*/true> max_op{};
+
+      Array frg_I = convert_input(frg_input);
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        if (elem_less(tCcCol_mn(epi_v * FragmentSize + i), residue_tCcCol)) {
+          ElementCompute& tCrMax_vmn = tCrMax(epi_v * FragmentSize + i);
+          tCrMax_vmn = max_op(tCrMax_vmn, frg_I[i]);
+        }
+      }
+
+      return frg_input;
+    }
+
+    template <class STensor, class SyncFn, class VTensor>
+    CUTLASS_DEVICE void
+    reduce(STensor&& smem_buffer, SyncFn const& sync_fn, int epi_m, int epi_n, bool is_last_iteration, VTensor visit_results) {
+
+      auto& [tCrMax, tCrSum, gMax, gSum, tCcCol, tCcCta, cCol,
+              lane_layout_MN, residue_cCol, residue_tCcCol, is_single_block] = args_tuple;
+
+      // fully OOB CTA in partially OOB cluster
+      if (not elem_less(cCol(_0{},_0{}), residue_cCol)) {
+        return;
+      }
+      Tensor tCcCol_mn = tCcCol(_,_,_,epi_m,epi_n);
+      Tensor tCcCta_mn = tCcCta(_,_,_,epi_m,epi_n);
+
+      // `tCrMax` and `tCrSum` have 0-strides along modes that correspond to N, so we butterfly-reduce
+      // their co-domain through filtered views, after which every lane holds the result of its rows.
+      auto tCrMax_f = filter(tCrMax);
+      auto tCrSum_f = filter(tCrSum);
+      maximum<ElementCompute, /*PropagateNaN=*/true> max_op{};
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int j = 1; j < size<1>(lane_layout_MN); j *= 2) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(tCrMax_f); ++i) {
+          tCrMax_f(i) = max_op(tCrMax_f(i), __shfl_xor_sync(0xFFFFFFFF, tCrMax_f(i), lane_layout_MN(_0{},j)));
+        }
+      }
+
+      using ElementVisit = typename cute::remove_cvref_t<decltype(visit_results(0))>::Element;
+      using ConvertVisit = NumericConverter<ElementCompute, ElementVisit, RoundStyle>;
+      using ConvertResult = NumericConverter<ElementVisit, ElementCompute, RoundStyle>;
+      ConvertVisit convert_visit{};
+      ConvertResult convert_result{};
+
+      // Exponentiate relative to the row max of the epilogue tile and accumulate the row sums
+      CUTLASS_PRAGMA_UNROLL
+      for (int epi_v = 0; epi_v < size(visit_results); ++epi_v) {
+        auto& visit_frag = visit_results(epi_v);
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < FragmentSize; ++i) {
+          int idx = epi_v * FragmentSize + i;
+          if (elem_less(tCcCol_mn(idx), residue_tCcCol)) {
+            ElementCompute exp_value = fast_exp(convert_visit(visit_frag[i]) - tCrMax(idx));
+            visit_frag[i] = convert_result(exp_value);
+            tCrSum(idx) += exp_value;
+          }
+          else {
+            visit_frag[i] = convert_result(ElementCompute(0));
+          }
+        }
+      }
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int j = 1; j < size<1>(lane_layout_MN); j *= 2) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(tCrSum_f); ++i) {
+          tCrSum_f(i) += __shfl_xor_sync(0xFFFFFFFF, tCrSum_f(i), lane_layout_MN(_0{},j));
+        }
+      }
+
+      // Rows which fit in a single epilogue tile are complete, so normalize them in place
+      if (is_single_block) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int epi_v = 0; epi_v < size(visit_results); ++epi_v) {
+          auto& visit_frag = visit_results(epi_v);
+          CUTLASS_PRAGMA_UNROLL
+          for (int i = 0; i < FragmentSize; ++i) {
+            ElementCompute sum = tCrSum(epi_v * FragmentSize + i);
+            ElementCompute inv_sum = sum > ElementCompute(0) ? ElementCompute(1) / sum : ElementCompute(0);
+            visit_frag[i] = convert_result(convert_visit(visit_frag[i]) * inv_sum);
+          }
+        }
+      }
+
+      // Exactly one thread owns the first column of each row of the epilogue tile,
+      // that thread writes the statistics of the row
+      if (params.ptr_max != nullptr && params.ptr_sum != nullptr) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int idx = 0; idx < size(tCrMax); ++idx) {
+          auto [m, n] = tCcCta_mn(idx);
+          if (n % EpiN == 0 && elem_less(tCcCol_mn(idx), residue_tCcCol)) {
+            gMax(m, n / EpiN) = ElementPartial(tCrMax(idx));
+            gSum(m, n / EpiN) = ElementPartial(tCrSum(idx));
+          }
+        }
+      }
+    }
+
+    CUTLASS_DEVICE void
+    end_loop(int epi_m, int epi_n) {
+      auto& [tCrMax, tCrSum, gMax, gSum, tCcCol, tCcCta, cCol,
+              lane_layout_MN, residue_cCol, residue_tCcCol, is_single_block] = args_tuple;
+
+      // Reset the row statistics for the next epilogue tile
+      fill(tCrMax, -cutlass::platform::numeric_limits<ElementCompute>::infinity());
+      fill(tCrSum, ElementCompute(0));
+    }
+
+    CUTLASS_DEVICE void
+    end() { }
+
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    Layout ref_layout_MN = [&] () {
+      auto mn_shape = shape(typename decltype(args.tiled_copy)::Tiler_MN{});
+      if constexpr (ReferenceSrc) { return right_inverse(args.tiled_copy.get_layoutS_TV()).with_shape(mn_shape); }
+      else                        { return right_inverse(args.tiled_copy.get_layoutD_TV()).with_shape(mn_shape); }
+    }();                                                                                         // tile_mn -> tv_idx
+
+    // Get the MN layout of lanes to determine shuffle reduction iterations
+    using _W = Int<decltype(args.tiled_copy)::TiledNumThr::value / NumThreadsPerWarp>;
+    Layout tv2lane = Layout<Shape<Int<NumThreadsPerWarp>,_W,_1>,Stride<_1,_0,_0>>{};            //   tv_idx -> lane_idx
+    Layout ref2lane = composition(tv2lane, ref_layout_MN);                                      //  tile_mn -> lane_idx
+    Layout lane_layout_MN = make_layout(filter(get<0>(ref2lane)), filter(get<1>(ref2lane)));    //  lane_mn -> lane_idx
+
+    // Get the MN layout of warps
+    Layout tv2warp = Layout<Shape<Int<NumThreadsPerWarp>,_W,_1>,Stride<_0,_1,_0>>{};            //   tv_idx -> warp_idx
+    Layout ref2warp = composition(tv2warp, ref_layout_MN);                                      //  tile_mn -> warp_idx
+    Layout warp_layout_MN = make_layout(filter(get<0>(ref2warp)), filter(get<1>(ref2warp)));    //  warp_mn -> warp_idx
+
+    // Make sure there's only one warp across N so we can use warp shuffle intrinsics for reduction.
+    static_assert(decltype(size<1>(warp_layout_MN))::value <= 1);
+
+    // Reduction layout, with column broadcast so that fragment indices of the same row map
+    // to the same element (see Sm90AmaxQuantizeColReduction)
+    auto [M, N, K] = args.tile_shape_mnk;
+    auto thr_mma = args.tiled_mma.get_thread_slice(args.thread_idx);
+    auto gColReduce = make_tensor<ElementCompute>(
+        make_layout(make_shape(M, N), make_stride(_1{}, 0_c)));                                                // (M,N)
+    auto tCrColReduce = make_tensor_like<ElementCompute>(                                       // (FrgV, MMA_M, MMA_N)
+        thr_mma.partition_C(gColReduce).layout());
+
+    ThrCopy thread_r2s = args.tiled_copy.get_slice(args.thread_idx);
+    Tensor tRS_rReduce = thread_r2s.retile_S(tCrColReduce);                                // ((R2S,R2S_V),MMA_M,MMA_N)
+    auto tCrReduce_layout = take<0, 3>(tRS_rReduce.layout()).compose(args.tCrC.layout()); // (R2S,R2S_V) o (R2S,R2S_M,R2S_N)
+
+    Tensor tCrMax = make_tensor<ElementCompute>(tCrReduce_layout);                                 // (R2S,R2S_M,R2S_N)
+    Tensor tCrSum = make_tensor<ElementCompute>(tCrReduce_layout);                                 // (R2S,R2S_M,R2S_N)
+    fill(tCrMax, -cutlass::platform::numeric_limits<ElementCompute>::infinity());
+    fill(tCrSum, ElementCompute(0));
+
+    // Row statistics of this CTA tile, indexed by CTA-relative coordinates
+    auto [M_, N_, K_, L_] = args.problem_shape_mnkl;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+    Tensor mMax = make_tensor(make_gmem_ptr(params.ptr_max),
+                    make_layout(make_shape(M_, ceil_div(N_, Int<EpiN>{}), L_), params.dPartial));      // (M,N/EPI_N,L)
+    Tensor mSum = make_tensor(make_gmem_ptr(params.ptr_sum),
+                    make_layout(make_shape(M_, ceil_div(N_, Int<EpiN>{}), L_), params.dPartial));      // (M,N/EPI_N,L)
+    Tensor gMax = local_tile(mMax(_,_,l), make_shape(M, N / Int<EpiN>{}), make_coord(m, n));   // (CTA_M,CTA_N/EPI_N)
+    Tensor gSum = local_tile(mSum(_,_,l), make_shape(M, N / Int<EpiN>{}), make_coord(m, n));   // (CTA_M,CTA_N/EPI_N)
+
+    // tCcD is relative to the first coordinate of each thread, the CTA tiles above are indexed by
+    // coordinates relative to the CTA instead
+    Tensor cCta = flat_divide(make_identity_tensor(make_shape(M, N)), args.epi_tile);          // (EPI_M,EPI_N,...)
+    Tensor tCcCta = [&] () {
+      if constexpr (ReferenceSrc) { return thread_r2s.partition_S(cCta); }
+      else                        { return thread_r2s.partition_D(cCta); }
+    }();                                                                                   // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+
+    bool is_single_block = int(N_) <= EpiN;
+
+    auto args_tuple = make_tuple(
+        cute::move(tCrMax), cute::move(tCrSum), gMax, gSum, args.tCcD, tCcCta, args.cD,
+        lane_layout_MN, args.residue_cD, args.residue_tCcD, is_single_block);
+    return ConsumerStoreCallbacks<decltype(args_tuple)>(std::move(args_tuple), params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,308 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+  \brief Visitor tree store operation that writes structured sparse compressed output for sm90 TMA warp-specialized epilogue
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/numeric_conversion.h"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::fusion {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Structured sparse compressed store
+// Prunes the visited results to the structured sparsity of SparseConfig (2:4, or 1:2 for tf32) by
+// keeping the largest magnitudes of each chunk of consecutive columns, and writes the compacted
+// values and metadata in the layouts of the A operand of a sparse GEMM described by SparseConfig.
+// The (M,N) output of this GEMM becomes the (M,K) sparse operand of the consuming GEMM, so that it
+// does not need a separate compressor pass. Ties are broken towards the lower column, the same as
+// the magnitude pruning of the structured sparse compressor.
+//
+//   Assumptions:
+//     1. N is a multiple of the metadata and compressed tensor K alignments, so that the consumer
+//        never reads padding along K. Padding rows along M are not written.
+//     2. The node is visited once per element, results are staged through shared memory so that
+//        every chunk can be compressed by a single thread regardless of the register partitioning.
+//
+template <
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class EpilogueTile,
+  class SparseConfig,
+  class ElementOutput,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+struct Sm90SparseCompressStore {
+private:
+  using ElementAMmaRaw = typename SparseConfig::ElementAMmaRaw;
+  using ElementEMma = typename SparseConfig::ElementEMma;
+  using ElementEMmaRaw = typename SparseConfig::ElementEMmaRaw;
+  using ElementASparsity = typename SparseConfig::ElementASparsity;
+  using ElementOutputCompressed = cute::sparse_elem<ElementASparsity{}, ElementOutput>;
+
+  static constexpr int LogicalElemsPerChunk = typename SparseConfig::LogicalElemsAPerChunk{};
+  static constexpr int PhysicalElemsPerChunk = typename SparseConfig::PhysicalElemsAPerChunk{};
+  static constexpr int MetadataBitsPerChunk = typename SparseConfig::ElementEBitsPerChunk{};
+  // Columns covered by one metadata element
+  static constexpr int ElemsPerMetadata = typename SparseConfig::ElementEMmaSparsity{};
+  static constexpr int ChunksPerMetadata = ElemsPerMetadata / LogicalElemsPerChunk;
+
+  static constexpr int EpiM = size<0>(EpilogueTile{});
+  static constexpr int EpiN = size<1>(EpilogueTile{});
+
+  static_assert(sizeof_bits_v<ElementOutput> == sizeof_bits_v<ElementAMmaRaw>,
+    "ElementOutput must match the width of the sparse operand elements.");
+  static_assert(sizeof_bits_v<ElementEMmaRaw> == 8 && ChunksPerMetadata * MetadataBitsPerChunk == 8,
+    "Sparse compressed store expects one metadata byte per two chunks.");
+  static_assert(EpiN % ElemsPerMetadata == 0, "EPI_N must be a multiple of the columns covered by one metadata byte.");
+
+public:
+  struct SharedStorage {
+    array_aligned<ElementOutput, EpiM * EpiN> smem_tile;
+  };
+
+  struct Arguments {
+    void* ptr_compressed = nullptr;   // compressed values, SparseConfig::fill_layoutA of the (M,N) output
+    void* ptr_metadata = nullptr;     // metadata, SparseConfig::fill_layoutE of the (M,N) output
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    auto problem_shape_mnkl = append<4>(problem_shape, 1);
+    auto [M, N, K, L] = problem_shape_mnkl;
+
+    bool implementable = args.ptr_compressed != nullptr && args.ptr_metadata != nullptr;
+    implementable &= N % int(typename SparseConfig::TensorEAlignmentK{}) == 0;
+    implementable &= N % int(typename SparseConfig::TensorAAlignmentK{}) == 0;
+    if (not implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Sparse compressed store requires output pointers and N aligned to the consumer's K alignment.\n");
+    }
+    return implementable;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return cutlass::Status::kSuccess;
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90SparseCompressStore() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90SparseCompressStore(Params const& params, SharedStorage const& shared_storage)
+      : params(params),
+        smem_tile(const_cast<ElementOutput*>(shared_storage.smem_tile.data())) { }
+
+  Params params;
+  ElementOutput* smem_tile = nullptr;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<class ArgsTuple>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(ArgsTuple&& args_tuple)
+      : args_tuple(cute::forward<ArgsTuple>(args_tuple)) {}
+
+    ArgsTuple args_tuple;
+
+    template <typename ElementAccumulator, typename ElementInput>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+
+      auto& [sTile, gCompressed, gMetadata, tCcD, tCcCta, residue_cD, residue_tCcD,
+              cta_m, cta_n, thread_idx, num_threads] = args_tuple;
+      Tensor tCcD_mn = tCcD(_,_,_,epi_m,epi_n);
+      Tensor tCcCta_mn = tCcCta(_,_,_,epi_m,epi_n);
+
+      using ConvertInput = NumericArrayConverter<ElementOutput, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+
+      Array frg_output = convert_input(frg_input);
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        if (elem_less(tCcD_mn(epi_v * FragmentSize + i), residue_tCcD)) {
+          auto [m, n] = tCcCta_mn(epi_v * FragmentSize + i);
+          sTile(m - epi_m * EpiM, n - epi_n * EpiN) = frg_output[i];
+        }
+      }
+
+      return frg_input;
+    }
+
+    template <class STensor, class SyncFn, class VTensor>
+    CUTLASS_DEVICE void
+    reduce(STensor&& smem_buffer, SyncFn const& sync_fn, int epi_m, int epi_n, bool is_last_iteration, VTensor visit_results) {
+      auto& [sTile, gCompressed, gMetadata, tCcD, tCcCta, residue_cD, residue_tCcD,
+              cta_m, cta_n, thread_idx, num_threads] = args_tuple;
+
+      // Wait for the subtile to be staged by all threads
+      sync_fn();
+
+      // Each thread compresses the chunks covered by one metadata byte at a time, consecutive
+      // threads take consecutive bytes along N so that the compressed values are written contiguously
+      constexpr int BytesPerRow = EpiN / ElemsPerMetadata;
+      for (int idx = thread_idx; idx < EpiM * BytesPerRow; idx += num_threads) {
+        int row = idx / BytesPerRow;
+        int col = (idx % BytesPerRow) * ElemsPerMetadata;
+        int m = epi_m * EpiM + row;
+        int n = epi_n * EpiN + col;
+        if (not elem_less(make_coord(m, n), residue_cD)) {
+          continue;
+        }
+
+        ElementEMmaRaw metadata = 0;
+        CUTLASS_PRAGMA_UNROLL
+        for (int chunk = 0; chunk < ChunksPerMetadata; ++chunk) {
+          float magnitude[LogicalElemsPerChunk];
+          CUTLASS_PRAGMA_UNROLL
+          for (int i = 0; i < LogicalElemsPerChunk; ++i) {
+            float value = NumericConverter<float, ElementOutput>{}(sTile(row, col + chunk * LogicalElemsPerChunk + i));
+            magnitude[i] = value < 0.f ? -value : value;
+          }
+
+          int phy = 0;
+          uint32_t chunk_metadata = 0;
+          CUTLASS_PRAGMA_UNROLL
+          for (int i = 0; i < LogicalElemsPerChunk; ++i) {
+            int rank = 0;
+            CUTLASS_PRAGMA_UNROLL
+            for (int j = 0; j < LogicalElemsPerChunk; ++j) {
+              rank += (magnitude[j] > magnitude[i]) || (magnitude[j] == magnitude[i] && j < i);
+            }
+            if (rank < PhysicalElemsPerChunk) {
+              int k_phy = (cta_n + n) / ElementASparsity{} + chunk * PhysicalElemsPerChunk + phy;
+              gCompressed(cta_m + m, k_phy) = sTile(row, col + chunk * LogicalElemsPerChunk + i);
+              if constexpr (LogicalElemsPerChunk == 2) {
+                // 1:2 sparsity is expressed as a 2:4 pair of 32b halves
+                chunk_metadata |= (i == 0 ? 0b0100u : 0b1110u) << (4 * phy);
+              }
+              else {
+                chunk_metadata |= uint32_t(i) << (2 * phy);
+              }
+              ++phy;
+            }
+          }
+          metadata |= ElementEMmaRaw(chunk_metadata << (chunk * MetadataBitsPerChunk));
+        }
+        gMetadata(cta_m + m, (cta_n + n) / ElemsPerMetadata) = metadata;
+      }
+
+      // The subtile is restaged by the next iteration
+      sync_fn();
+    }
+
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    auto [M, N, K, L] = args.problem_shape_mnkl;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+    auto [CtaM, CtaN, CtaK] = args.tile_shape_mnk;
+
+    // Output of this GEMM is the (M,K) operand of the consuming sparse GEMM
+    auto consumer_problem_shape = make_tuple(M, 1, N, L);
+    Tensor mCompressed_sparse = make_tensor(make_gmem_ptr(cute::recast_ptr<ElementOutputCompressed>(params.ptr_compressed)),
+                                  SparseConfig::fill_layoutA(consumer_problem_shape));
+    Tensor mCompressed = cute::recast<ElementOutput>(mCompressed_sparse);          // (M_AlignedAC,K_AlignedAC/2,L)
+    Tensor mMetadata_sparse = make_tensor(make_gmem_ptr(cute::recast_ptr<ElementEMma>(params.ptr_metadata)),
+                                SparseConfig::fill_layoutE(consumer_problem_shape));
+    Tensor mMetadata = cute::recast<ElementEMmaRaw>(mMetadata_sparse);              // (M_AlignedE,K_AlignedE/8,L)
+
+    Tensor sTile = make_tensor(make_smem_ptr(smem_tile), make_layout(make_shape(Int<EpiM>{}, Int<EpiN>{}), LayoutRight{}));
+
+    // tCcD is relative to the first coordinate of each thread, smem is indexed relative to the CTA
+    ThrCopy thread_r2s = args.tiled_copy.get_slice(args.thread_idx);
+    Tensor cCta = flat_divide(make_identity_tensor(make_shape(CtaM, CtaN)), args.epi_tile);
+    Tensor tCcCta = [&] () {
+      if constexpr (ReferenceSrc) { return thread_r2s.partition_S(cCta); }
+      else                        { return thread_r2s.partition_D(cCta); }
+    }();                                                                                   // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+
+    auto args_tuple = make_tuple(
+        sTile, mCompressed(_,_,l), mMetadata(_,_,l), args.tCcD, tCcCta, args.residue_cD, args.residue_tCcD,
+        int(m * CtaM), int(n * CtaN), args.thread_idx, int(size(args.tiled_mma)));
+    return ConsumerStoreCallbacks<decltype(args_tuple)>(std::move(args_tuple));
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -37,6 +37,7 @@
 
 #include "cutlass/cutlass.h"
 #include "cutlass/workspace.h"
+#include "cutlass/fast_math.h"
 
 #include "cute/tensor.hpp"
 #include "sm90_visitor_tma_warpspecialized.hpp"
@@ -65,11 +66,16 @@ template <
   class SmemLayoutAtom,
   class CopyOpR2S,
   int Alignment = 128 / sizeof_bits_v<Element>,
-  bool EnableNullptr = true // Noop on nullptr params
+  bool EnableNullptr = true, // Noop on nullptr params
+  class CopyOpS2G = SM90_TMA_STORE // SM90_TMA_REDUCE_ADD accumulates into the existing aux tensor
 >
 struct Sm90AuxStore {
   using ElementAux = Element;
   static_assert(Alignment * sizeof_bits_v<Element> % 128 == 0, "sub-16B alignment not supported yet");
+  static_assert(cute::is_same_v<CopyOpS2G, SM90_TMA_STORE> ||
+                (cute::is_same_v<CopyOpS2G, SM90_TMA_REDUCE_ADD> &&
+                 epilogue::collective::detail::is_tma_reduce_add_element_v<Element>),
+                "Unsupported aux store op");
 
   constexpr static bool is_m_major = epilogue::collective::detail::is_m_major<StrideMNL>();
   // Find the max contiguous layout usable by TMA (if EpilogueTile is a non-compact tiler)
@@ -112,7 +118,7 @@ struct Sm90AuxStore {
   template <bool Hierarchical, class /* dummy to delay */ = void>
   struct TmaAuxTypeHelper {
     using type = decltype(make_tma_copy(
-        SM90_TMA_STORE{},
+        CopyOpS2G{},
         make_tensor(static_cast<Element*>(nullptr), repeat_like(StrideMNL{}, int32_t(0)), StrideMNL{}),
         SmemLayoutTma{},
         EpilogueTile{},
@@ -121,7 +127,7 @@ struct Sm90AuxStore {
   template <class Dummy>
   struct TmaAuxTypeHelper<false, Dummy> {
     using type = decltype(make_tma_copy(
-        SM90_TMA_STORE{},
+        CopyOpS2G{},
         make_tensor(static_cast<Element*>(nullptr), repeat_like(StrideMNL{}, int32_t(0)), StrideMNL{}),
         SmemLayoutTma{}));
   };
@@ -148,9 +154,9 @@ struct Sm90AuxStore {
     if (not is_nullptr) {
       Tensor tensor_aux = make_tensor(args.ptr_aux, make_layout(make_shape(M,N,L), args.dAux));
       if constexpr (IsHierarchicalStride) {
-        tma_store_aux = make_tma_copy(SM90_TMA_STORE{}, tensor_aux, SmemLayoutTma{}, EpilogueTile{}, Shape<_1,_1,_1>{});
+        tma_store_aux = make_tma_copy(CopyOpS2G{}, tensor_aux, SmemLayoutTma{}, EpilogueTile{}, Shape<_1,_1,_1>{});
       } else {
-        tma_store_aux = make_tma_copy(SM90_TMA_STORE{}, tensor_aux, SmemLayoutTma{});
+        tma_store_aux = make_tma_copy(CopyOpS2G{}, tensor_aux, SmemLayoutTma{});
       }
     }
 
@@ -237,44 +243,1481 @@ struct Sm90AuxStore {
     CUTLASS_DEVICE auto
     visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
           Array<ElementInput, FragmentSize> const& frg_input) {
-      using ConvertInput = NumericArrayConverter<Element, ElementInput, FragmentSize, RoundStyle>;
+      using ConvertInput = NumericArrayConverter<Element, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+
+      Tensor tC_rAux_frg = recast<Array<Element, FragmentSize>>(coalesce(tC_rAux));                          // (EPI_V)
+      tC_rAux_frg(epi_v) = convert_input(frg_input);
+
+      return frg_input;
+    }
+
+    CUTLASS_DEVICE void
+    postreduce(int epi_m, int epi_n, int store_iteration, bool issue_smem_store) {
+      if constexpr (EnableNullptr) {
+        if (params_ptr->is_nullptr) {
+          return;
+        }
+      }
+
+      using RLayoutR2S = decltype(cute::layout(TiledR2S{}.get_slice(0).retile_S(RTensor{})));
+      Tensor tRS_rAux = make_tensor(tC_rAux.data(), RLayoutR2S{});                                 // (R2S,R2S_M,R2S_N)
+
+      if (issue_smem_store) {
+        int store_pipe_index = store_iteration % Stages;
+        copy(tiled_r2s, tRS_rAux, tRS_sAux(_,_,_,store_pipe_index));
+      }
+    }
+
+    CUTLASS_DEVICE void
+    tma_store(int epi_m, int epi_n, int store_iteration, bool issue_tma_store) {
+      if constexpr (EnableNullptr) {
+        if (params_ptr->is_nullptr) {
+          return;
+        }
+      }
+
+      if (issue_tma_store) {
+        // Issue the TMA store
+        int store_pipe_index = store_iteration % Stages;
+        copy(params_ptr->tma_store_aux, bSG_sAux(_,_,_,store_pipe_index), bSG_gAux(_,_,_,epi_m,epi_n));
+      }
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+
+    auto [M, N, K, L] = args.problem_shape_mnkl;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+    Tensor mAux = params_ptr->tma_store_aux.get_tma_tensor(make_shape(M,N,L));                               // (M,N,L)
+    Tensor gAux = local_tile(mAux, take<0,2>(args.tile_shape_mnk), make_coord(m,n,l));                 // (CTA_M,CTA_N)
+
+    Tensor tC_gAux = sm90_partition_for_epilogue<ReferenceSrc>(                        // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+                      gAux, args.epi_tile, args.tiled_copy, args.thread_idx);
+    Tensor tC_rAux = make_tensor<Element>(take<0,3>(shape(tC_gAux)));                  // (CPY,CPY_M,CPY_N)
+
+    Tensor sAux_epi = cute::as_position_independent_swizzle_tensor(
+                        make_tensor(make_smem_ptr(smem_aux), SmemLayout{}));     // (EPI_TILE_M,EPI_TILE_N,PIPE)
+    Tensor gAux_epi = flat_divide(gAux, args.epi_tile);                          // (EPI_TILE_M,EPI_TILE_N,EPI_M,EPI_N)
+
+    auto tiled_r2s = conditional_return<ReferenceSrc>(
+      make_tiled_copy_S(Copy_Atom<CopyOpR2S,Element>{}, args.tiled_copy),
+      make_tiled_copy_D(Copy_Atom<CopyOpR2S,Element>{}, args.tiled_copy)
+    );
+    auto tRS_sAux = tiled_r2s.get_slice(args.thread_idx).partition_D(sAux_epi);               // (R2S,R2S_M,R2S_N,PIPE)
+
+    ThrCopy thrblk_s2g = params_ptr->tma_store_aux.get_slice(_0{});
+    Tensor bSG_sAux = thrblk_s2g.partition_S(sAux_epi);                                // (TMA,TMA_M,TMA_N,PIPE)
+    Tensor bSG_gAux = thrblk_s2g.partition_D(gAux_epi);                                // (TMA,TMA_M,TMA_N,EPI_M,EPI_N)
+
+    return ConsumerStoreCallbacks<decltype(tC_rAux), decltype(tiled_r2s), decltype(tRS_sAux), decltype(bSG_sAux), decltype(bSG_gAux)>(
+            cute::move(tC_rAux),
+            tiled_r2s,
+            cute::move(tRS_sAux),
+            cute::move(bSG_sAux),
+            cute::move(bSG_gAux),
+            params_ptr);
+  }
+};
+
+template <
+  class Element,
+  class EpilogueTile,   // Unused
+  FloatRoundStyle RoundStyle,
+  class LayoutOrStrideMNL,
+  class SmemLayoutAtom, // Unused
+  class CopyOpR2S,      // Unused
+  int Alignment,
+  bool EnableNullptr,
+  class CopyOpS2G       // Unused
+>
+struct Sm90AuxStore<
+  0, EpilogueTile, Element, RoundStyle, LayoutOrStrideMNL,
+  SmemLayoutAtom, CopyOpR2S, Alignment, EnableNullptr, CopyOpS2G
+> {
+  using ElementAux = Element;
+  using StrideMNL = cutlass::gemm::TagToStrideC_t<LayoutOrStrideMNL>;
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    Element* ptr_aux = nullptr;
+    StrideMNL dAux = {};
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return true;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return cutlass::Status::kSuccess;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90AuxStore() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90AuxStore(Params const& params, SharedStorage const& shared_storage)
+    : params_ptr(&params) { }
+
+  Params const* params_ptr;
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<
+    class GTensorR2G,
+    class RTensor,
+    class CTensorR2G,
+    class ProblemShapeMNL
+  >
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(
+        GTensorR2G&& tC_gAux,
+        RTensor&& tC_rAux,
+        CTensorR2G&& tC_cAux,
+        ProblemShapeMNL problem_shape_mnl,
+        Params const* params_ptr)
+      : tC_gAux(cute::forward<GTensorR2G>(tC_gAux)),
+        tC_rAux(cute::forward<RTensor>(tC_rAux)),
+        tC_cAux(cute::forward<CTensorR2G>(tC_cAux)),
+        problem_shape_mnl(problem_shape_mnl),
+        params_ptr(params_ptr) {}
+
+    GTensorR2G tC_gAux;
+    RTensor tC_rAux;
+    CTensorR2G tC_cAux;
+    ProblemShapeMNL problem_shape_mnl;
+    Params const* params_ptr;
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      using ConvertInput = NumericArrayConverter<Element, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+
+      Tensor tC_rAux_frg = recast<Array<Element, FragmentSize>>(coalesce(tC_rAux));
+      tC_rAux_frg(epi_v) = convert_input(frg_input);
+
+      return frg_input;
+    }
+
+    CUTLASS_DEVICE void
+    end_loop(int epi_m, int epi_n) {
+      if constexpr (EnableNullptr) {
+        if (params_ptr->ptr_aux == nullptr) {
+          return;
+        }
+      }
+
+      constexpr auto MCL = decltype(max_common_layout(tC_gAux(_,_,_,_0{},_0{}), tC_rAux)){};
+      constexpr int V = cute::min(Alignment, size(MCL));
+
+      Tensor tC_gAux_vec = recast<Array<Element, V>>(coalesce(tC_gAux(_,_,_,epi_m,epi_n)));
+      Tensor tC_rAux_vec = recast<Array<Element, V>>(coalesce(tC_rAux));
+
+      Tensor tC_cAux_vec = tensor<1>(zipped_divide(coalesce(tC_cAux(_,_,_,epi_m,epi_n)), MCL.compose(Int<V>{})));
+      Tensor tC_pAux_vec = cute::lazy::transform(tC_cAux_vec, [&](auto const& c){ return elem_less(c, problem_shape_mnl); });
+
+      copy_if(tC_pAux_vec, tC_rAux_vec, tC_gAux_vec);
+    }
+  };
+
+  template <
+    bool ReferenceSrc,
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+
+    auto [M, N, K, L] = args.problem_shape_mnkl;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+
+    auto problem_shape_mnl = make_shape(M,N,L);
+
+    // Gmem Tensor
+    Tensor mAux = make_tensor(
+      make_gmem_ptr(params_ptr->ptr_aux), make_shape(M,N,L), params_ptr->dAux
+    );
+    Tensor tC_gAux = sm90_partition_for_epilogue<ReferenceSrc>(
+                      mAux, args.tile_shape_mnk, args.tile_coord_mnkl, args.epi_tile, args.tiled_copy, args.thread_idx);
+
+    // Register Tensor
+    Tensor tC_rAux = make_tensor<Element>(take<0,3>(shape(tC_gAux)));
+
+    // Predication support
+    Tensor coordAux = make_identity_tensor(shape(mAux));
+    Tensor tC_cAux = sm90_partition_for_epilogue<ReferenceSrc>(
+                      coordAux, args.tile_shape_mnk, args.tile_coord_mnkl, args.epi_tile, args.tiled_copy, args.thread_idx);
+
+    return ConsumerStoreCallbacks<decltype(tC_gAux), decltype(tC_rAux), decltype(tC_cAux), decltype(problem_shape_mnl)>(
+      cute::move(tC_gAux),
+      cute::move(tC_rAux),
+      cute::move(tC_cAux),
+      problem_shape_mnl,
+      params_ptr
+    );
+
+  }
+
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// How Sm90AuxPeerStore writes output tiles into memory shared with other GPUs (ranks)
+enum class PeerStoreOp {
+  MulticastStore,  // multimem.st: the tile is stored into every rank's buffer (all gather)
+  MulticastReduce, // multimem.red.add: the tile is added into every rank's buffer (all reduce)
+  PeerReduce       // red.add: the tile is added into a single, possibly peer, buffer (reduce)
+};
+
+// Stores output tiles directly into multicast (NVLS) or peer memory from registers, fusing the
+// collective into the epilogue, and signals completion of each tile.
+//
+// ptr_aux is a multicast address for MulticastStore/MulticastReduce, and a (peer) address
+// accessible with direct peer access for PeerReduce. Reductions accumulate into the current
+// contents of the destination buffers, which must be initialized (i.e. zeroed) by the user.
+//
+// If ptr_tile_flags is not null, it points to a (ceil_div(M, CTA_M), ceil_div(N, CTA_N), L)
+// compact m-major tensor of flags, which is a multicast address for the Multicast ops, and each
+// rank increments a tile's flag by one once its stores for that tile are visible to all ranks.
+// A tile is therefore complete once its flag reaches the number of contributing ranks. Flags are
+// never reset, so consumers may keep counting across launches.
+template <
+  class Element,
+  FloatRoundStyle RoundStyle,
+  class StrideMNL,
+  int Alignment = 128 / sizeof_bits_v<Element>,
+  PeerStoreOp Op = PeerStoreOp::MulticastReduce,
+  bool EnableNullptr = true // Noop on nullptr params
+>
+struct Sm90AuxPeerStore {
+  static_assert(cute::is_same_v<Element, float> || cute::is_same_v<Element, cutlass::half_t> ||
+                cute::is_same_v<Element, cutlass::bfloat16_t>,
+      "Peer stores only support F32, F16 and BF16 outputs.");
+  static_assert(Alignment * sizeof_bits_v<Element> % 32 == 0, "sub-4B alignment not supported");
+
+  using ElementAux = Element;
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    Element* ptr_aux = nullptr;
+    StrideMNL dAux = {};
+    uint32_t* ptr_tile_flags = nullptr;
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return true;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return cutlass::Status::kSuccess;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90AuxPeerStore() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90AuxPeerStore(Params const& params, SharedStorage const& shared_storage)
+    : params_ptr(&params) { }
+
+  Params const* params_ptr;
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  // System scope 4B and 16B stores/reductions
+  CUTLASS_DEVICE static void
+  peer_store(void* gmem_ptr, uint32_t const (&data)[1]) {
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 900)
+    if constexpr (Op == PeerStoreOp::MulticastStore) {
+      asm volatile("multimem.st.relaxed.sys.global.b32 [%0], %1;" :: "l"(gmem_ptr), "r"(data[0]) : "memory");
+    }
+    else if constexpr (Op == PeerStoreOp::MulticastReduce) {
+      if constexpr (cute::is_same_v<Element, float>) {
+        asm volatile("multimem.red.relaxed.sys.global.add.f32 [%0], %1;" :: "l"(gmem_ptr), "r"(data[0]) : "memory");
+      }
+      else if constexpr (cute::is_same_v<Element, cutlass::half_t>) {
+        asm volatile("multimem.red.relaxed.sys.global.add.f16x2 [%0], %1;" :: "l"(gmem_ptr), "r"(data[0]) : "memory");
+      }
+      else {
+        asm volatile("multimem.red.relaxed.sys.global.add.bf16x2 [%0], %1;" :: "l"(gmem_ptr), "r"(data[0]) : "memory");
+      }
+    }
+    else {
+      if constexpr (cute::is_same_v<Element, float>) {
+        asm volatile("red.relaxed.sys.global.add.f32 [%0], %1;" :: "l"(gmem_ptr), "r"(data[0]) : "memory");
+      }
+      else if constexpr (cute::is_same_v<Element, cutlass::half_t>) {
+        asm volatile("red.relaxed.sys.global.add.noftz.f16x2 [%0], %1;" :: "l"(gmem_ptr), "r"(data[0]) : "memory");
+      }
+      else {
+        asm volatile("red.relaxed.sys.global.add.noftz.bf16x2 [%0], %1;" :: "l"(gmem_ptr), "r"(data[0]) : "memory");
+      }
+    }
+#else
+    CUTE_INVALID_CONTROL_PATH("Peer stores require SM90 or later.");
+#endif
+  }
+
+  CUTLASS_DEVICE static void
+  peer_store(void* gmem_ptr, uint32_t const (&data)[4]) {
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 900)
+    if constexpr (Op == PeerStoreOp::MulticastStore) {
+      asm volatile("multimem.st.relaxed.sys.global.v4.f32 [%0], {%1, %2, %3, %4};"
+          :: "l"(gmem_ptr), "r"(data[0]), "r"(data[1]), "r"(data[2]), "r"(data[3]) : "memory");
+    }
+    else if constexpr (Op == PeerStoreOp::MulticastReduce) {
+      if constexpr (cute::is_same_v<Element, float>) {
+        asm volatile("multimem.red.relaxed.sys.global.add.v4.f32 [%0], {%1, %2, %3, %4};"
+            :: "l"(gmem_ptr), "r"(data[0]), "r"(data[1]), "r"(data[2]), "r"(data[3]) : "memory");
+      }
+      else if constexpr (cute::is_same_v<Element, cutlass::half_t>) {
+        asm volatile("multimem.red.relaxed.sys.global.add.v4.f16x2 [%0], {%1, %2, %3, %4};"
+            :: "l"(gmem_ptr), "r"(data[0]), "r"(data[1]), "r"(data[2]), "r"(data[3]) : "memory");
+      }
+      else {
+        asm volatile("multimem.red.relaxed.sys.global.add.v4.bf16x2 [%0], {%1, %2, %3, %4};"
+            :: "l"(gmem_ptr), "r"(data[0]), "r"(data[1]), "r"(data[2]), "r"(data[3]) : "memory");
+      }
+    }
+    else {
+      if constexpr (cute::is_same_v<Element, float>) {
+        asm volatile("red.relaxed.sys.global.add.v4.f32 [%0], {%1, %2, %3, %4};"
+            :: "l"(gmem_ptr), "r"(data[0]), "r"(data[1]), "r"(data[2]), "r"(data[3]) : "memory");
+      }
+      else if constexpr (cute::is_same_v<Element, cutlass::half_t>) {
+        asm volatile("red.relaxed.sys.global.add.noftz.v4.f16x2 [%0], {%1, %2, %3, %4};"
+            :: "l"(gmem_ptr), "r"(data[0]), "r"(data[1]), "r"(data[2]), "r"(data[3]) : "memory");
+      }
+      else {
+        asm volatile("red.relaxed.sys.global.add.noftz.v4.bf16x2 [%0], {%1, %2, %3, %4};"
+            :: "l"(gmem_ptr), "r"(data[0]), "r"(data[1]), "r"(data[2]), "r"(data[3]) : "memory");
+      }
+    }
+#else
+    CUTE_INVALID_CONTROL_PATH("Peer stores require SM90 or later.");
+#endif
+  }
+
+  CUTLASS_DEVICE static void
+  signal_tile(uint32_t* flag_ptr) {
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 900)
+    if constexpr (Op == PeerStoreOp::PeerReduce) {
+      asm volatile("red.release.sys.global.add.u32 [%0], %1;" :: "l"(flag_ptr), "r"(1) : "memory");
+    }
+    else {
+      asm volatile("multimem.red.release.sys.global.add.u32 [%0], %1;" :: "l"(flag_ptr), "r"(1) : "memory");
+    }
+#else
+    CUTE_INVALID_CONTROL_PATH("Peer stores require SM90 or later.");
+#endif
+  }
+
+  template<
+    class GTensorR2G,
+    class RTensor,
+    class CTensorR2G,
+    class ProblemShapeMNL
+  >
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(
+        GTensorR2G&& tC_gAux,
+        RTensor&& tC_rAux,
+        CTensorR2G&& tC_cAux,
+        ProblemShapeMNL problem_shape_mnl,
+        uint32_t* tile_flag_ptr,
+        int thread_idx,
+        Params const* params_ptr)
+      : tC_gAux(cute::forward<GTensorR2G>(tC_gAux)),
+        tC_rAux(cute::forward<RTensor>(tC_rAux)),
+        tC_cAux(cute::forward<CTensorR2G>(tC_cAux)),
+        problem_shape_mnl(problem_shape_mnl),
+        tile_flag_ptr(tile_flag_ptr),
+        thread_idx(thread_idx),
+        params_ptr(params_ptr) {}
+
+    GTensorR2G tC_gAux;                                                                // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    RTensor tC_rAux;                                                                   // (CPY,CPY_M,CPY_N)
+    CTensorR2G tC_cAux;                                                                // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    ProblemShapeMNL problem_shape_mnl;
+    uint32_t* tile_flag_ptr;
+    int thread_idx;
+    Params const* params_ptr;
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      using ConvertInput = NumericArrayConverter<Element, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+
+      Tensor tC_rAux_frg = recast<Array<Element, FragmentSize>>(coalesce(tC_rAux));
+      tC_rAux_frg(epi_v) = convert_input(frg_input);
+
+      return frg_input;
+    }
+
+    template <class STensor, class SyncFn, class VTensor>
+    CUTLASS_DEVICE void
+    reduce(STensor&& reduction_buffer, SyncFn const& sync_fn, int epi_m, int epi_n, bool is_last_iteration, VTensor visit_results) {
+      bool is_ptr_aux_valid = not EnableNullptr || params_ptr->ptr_aux != nullptr;
+
+      if (is_ptr_aux_valid) {
+        constexpr auto MCL = decltype(max_common_layout(tC_gAux(_,_,_,_0{},_0{}), tC_rAux)){};
+        constexpr int V = cute::min(Alignment, size(MCL));
+        constexpr int VectorBits = V * sizeof_bits_v<Element>;
+        static_assert(VectorBits % 32 == 0, "Output tile partitioning must allow at least 4B stores.");
+        constexpr int StoreWords = VectorBits % 128 == 0 ? 4 : 1;
+        constexpr int NumStores = VectorBits / (32 * StoreWords);
+
+        Tensor tC_gAux_vec = recast<Array<Element, V>>(coalesce(tC_gAux(_,_,_,epi_m,epi_n)));
+        Tensor tC_rAux_vec = recast<Array<Element, V>>(coalesce(tC_rAux));
+
+        Tensor tC_cAux_vec = tensor<1>(zipped_divide(coalesce(tC_cAux(_,_,_,epi_m,epi_n)), MCL.compose(Int<V>{})));
+
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(tC_rAux_vec); ++i) {
+          if (elem_less(tC_cAux_vec(i), problem_shape_mnl)) {
+            uint8_t* gmem_ptr = reinterpret_cast<uint8_t*>(raw_pointer_cast(&tC_gAux_vec(i)));
+            uint32_t const* rmem_ptr = reinterpret_cast<uint32_t const*>(&tC_rAux_vec(i));
+
+            CUTLASS_PRAGMA_UNROLL
+            for (int j = 0; j < NumStores; ++j) {
+              uint32_t data[StoreWords];
+              CUTLASS_PRAGMA_UNROLL
+              for (int w = 0; w < StoreWords; ++w) {
+                data[w] = rmem_ptr[j * StoreWords + w];
+              }
+              peer_store(gmem_ptr + j * StoreWords * sizeof(uint32_t), data);
+            }
+          }
+        }
+      }
+
+      // Signal the tile once all epilogue threads' stores are visible to all ranks
+      if (is_last_iteration && tile_flag_ptr != nullptr) {
+        __threadfence_system();
+        sync_fn();
+        if (thread_idx == 0) {
+          signal_tile(tile_flag_ptr);
+        }
+      }
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+
+    auto [M, N, K, L] = args.problem_shape_mnkl;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+    auto [tile_M, tile_N, tile_K] = args.tile_shape_mnk;
+
+    auto problem_shape_mnl = make_shape(M,N,L);
+
+    // Gmem Tensor
+    Tensor mAux = make_tensor(
+      make_gmem_ptr(params_ptr->ptr_aux), make_shape(M,N,L), params_ptr->dAux
+    );
+    Tensor tC_gAux = sm90_partition_for_epilogue<ReferenceSrc>(
+                      mAux, args.tile_shape_mnk, args.tile_coord_mnkl, args.epi_tile, args.tiled_copy, args.thread_idx);
+
+    // Register Tensor
+    Tensor tC_rAux = make_tensor<Element>(take<0,3>(shape(tC_gAux)));
+
+    // Predication support
+    Tensor coordAux = make_identity_tensor(shape(mAux));
+    Tensor tC_cAux = sm90_partition_for_epilogue<ReferenceSrc>(
+                      coordAux, args.tile_shape_mnk, args.tile_coord_mnkl, args.epi_tile, args.tiled_copy, args.thread_idx);
+
+    // Flag of the current tile
+    uint32_t* tile_flag_ptr = nullptr;
+    if (params_ptr->ptr_tile_flags != nullptr) {
+      int tiles_m = ceil_div(int(M), int(tile_M));
+      int tiles_n = ceil_div(int(N), int(tile_N));
+      tile_flag_ptr = params_ptr->ptr_tile_flags + (int(m) + int(n) * tiles_m + int(l) * tiles_m * tiles_n);
+    }
+
+    return ConsumerStoreCallbacks<decltype(tC_gAux), decltype(tC_rAux), decltype(tC_cAux), decltype(problem_shape_mnl)>(
+      cute::move(tC_gAux),
+      cute::move(tC_rAux),
+      cute::move(tC_cAux),
+      problem_shape_mnl,
+      tile_flag_ptr,
+      args.thread_idx,
+      params_ptr
+    );
+  }
+
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Scatters output rows into a destination tensor from registers, e.g. to fuse the token
+// un-permutation (combine) of a mixture-of-experts layer into the epilogue of the second expert GEMM.
+//
+// Row m of batch l is written to row ptr_row_index[m + l * dRow] of ptr_aux, whose strides dAux are
+// those of a (num_dst_rows, N, L) n-major tensor. Rows with a negative index (e.g. dropped tokens) are
+// skipped. If ptr_row_weight is not null, each row is first scaled by ptr_row_weight[m + l * dRow]
+// (e.g. the gating weight of the token for the expert).
+//
+// If ElementIndex_ is a pointer type (grouped GEMMs), ptr_row_index and ptr_row_weight are arrays of
+// per-group pointers indexed by the group, and all groups scatter into the same destination tensor.
+//
+// If GmemReduceFn is atomic (e.g. atomic_add), rows are accumulated into the current contents of the
+// destination, which must be initialized (i.e. zeroed) by the user. This combines the top-k > 1 expert
+// outputs of a token. Otherwise rows are stored, and the destination rows of all output rows must be unique.
+template <
+  class Element,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle,
+  class StrideMNL,
+  class ElementIndex_ = int32_t,
+  class ElementWeight = ElementCompute,
+  template <class> class GmemReduceFn = cutlass::first,
+  int Alignment = 128 / sizeof_bits_v<Element>,
+  bool EnableNullptr = true // Noop on nullptr params
+>
+struct Sm90AuxScatterStore {
+  // Get base element index type.
+  using ElementIndex = cute::remove_pointer_t<ElementIndex_>;
+  // Check if the index and weight vectors are arrays of pointers.
+  static constexpr bool IsArrayOfPointers = is_same_v<ElementIndex*, ElementIndex_>;
+  using PtrIndexType = cute::conditional_t<IsArrayOfPointers, ElementIndex const* const*, ElementIndex const*>;
+  using PtrWeightType = cute::conditional_t<IsArrayOfPointers, ElementWeight const* const*, ElementWeight const*>;
+
+  static constexpr bool IsAtomic = is_atomic<GmemReduceFn<Element>>::value;
+  // 16b reductions are issued as packed f16x2/bf16x2 reductions
+  static constexpr bool IsPackedReduce = IsAtomic && cute::is_same_v<GmemReduceFn<Element>, atomic_add<Element>> &&
+                                         (cute::is_same_v<Element, cutlass::half_t> || cute::is_same_v<Element, cutlass::bfloat16_t>);
+
+  static_assert(cute::is_integral<ElementIndex>::value, "Row indices must be integers.");
+  static_assert(cute::is_same_v<remove_cvref_t<decltype(get<1>(StrideMNL{}))>, _1>, "Scatter destination must be n-major.");
+
+  using ElementAux = Element;
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    Element* ptr_aux = nullptr;
+    StrideMNL dAux = {};
+    PtrIndexType ptr_row_index = nullptr;
+    PtrWeightType ptr_row_weight = nullptr; // optional
+    int64_t dRow = 0;                       // batch stride of the index and weight vectors, unused for arrays of pointers
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    if (args.ptr_aux != nullptr && args.ptr_row_index == nullptr) {
+      CUTLASS_TRACE_HOST("  can_implement: row indices must be provided for the scatter destination.\n");
+      return false;
+    }
+    if (int64_t(get<0>(args.dAux)) % Alignment != 0) {
+      CUTLASS_TRACE_HOST("  can_implement: scatter destination rows do not satisfy the alignment requirement.\n");
+      return false;
+    }
+    return true;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return cutlass::Status::kSuccess;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90AuxScatterStore() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90AuxScatterStore(Params const& params, SharedStorage const& shared_storage)
+    : params_ptr(&params) { }
+
+  Params const* params_ptr;
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  // GPU scope packed 16b reduction
+  CUTLASS_DEVICE static void
+  packed_reduce(void* gmem_ptr, uint32_t data) {
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 900)
+    if constexpr (cute::is_same_v<Element, cutlass::half_t>) {
+      asm volatile("red.relaxed.gpu.global.add.noftz.f16x2 [%0], %1;" :: "l"(gmem_ptr), "r"(data) : "memory");
+    }
+    else {
+      asm volatile("red.relaxed.gpu.global.add.noftz.bf16x2 [%0], %1;" :: "l"(gmem_ptr), "r"(data) : "memory");
+    }
+#else
+    CUTE_INVALID_CONTROL_PATH("Packed scatter reductions require SM90 or later.");
+#endif
+  }
+
+  template<
+    class GTensorR2G,
+    class RTensor,
+    class CTensorR2G,
+    class ProblemShapeMN
+  >
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(
+        GTensorR2G&& tC_gAux,
+        RTensor&& tC_rAux,
+        CTensorR2G&& tC_cAux,
+        ProblemShapeMN problem_shape_mn,
+        Element* ptr_aux_l,
+        ElementIndex const* ptr_row_index_l,
+        ElementWeight const* ptr_row_weight_l,
+        Params const* params_ptr)
+      : tC_gAux(cute::forward<GTensorR2G>(tC_gAux)),
+        tC_rAux(cute::forward<RTensor>(tC_rAux)),
+        tC_cAux(cute::forward<CTensorR2G>(tC_cAux)),
+        problem_shape_mn(problem_shape_mn),
+        ptr_aux_l(ptr_aux_l),
+        ptr_row_index_l(ptr_row_index_l),
+        ptr_row_weight_l(ptr_row_weight_l),
+        params_ptr(params_ptr) {}
+
+    GTensorR2G tC_gAux;                                                                // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    RTensor tC_rAux;                                                                   // (CPY,CPY_M,CPY_N)
+    CTensorR2G tC_cAux;                                                                // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    ProblemShapeMN problem_shape_mn;
+    Element* ptr_aux_l;
+    ElementIndex const* ptr_row_index_l;
+    ElementWeight const* ptr_row_weight_l;
+    Params const* params_ptr;
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+
+      Tensor tC_rAux_frg = recast<Array<ElementCompute, FragmentSize>>(coalesce(tC_rAux));
+      tC_rAux_frg(epi_v) = convert_input(frg_input);
+
+      return frg_input;
+    }
+
+    template <class STensor, class SyncFn, class VTensor>
+    CUTLASS_DEVICE void
+    reduce(STensor&& reduction_buffer, SyncFn const& sync_fn, int epi_m, int epi_n, bool is_last_iteration, VTensor visit_results) {
+      if (EnableNullptr && ptr_aux_l == nullptr) {
+        return;
+      }
+
+      // Vectors are contiguous in n, so each vector lies within a single row
+      constexpr auto MCL = decltype(max_common_layout(tC_gAux(_,_,_,_0{},_0{}).layout(), tC_rAux.layout())){};
+      constexpr int V = cute::min(Alignment, size(MCL));
+      static_assert(not IsPackedReduce || V % 2 == 0, "Packed 16b reductions require even vectors.");
+      using VecType = uint_bit_t<V * sizeof_bits_v<Element>>;
+      using ConvertOutput = NumericArrayConverter<Element, ElementCompute, V, RoundStyle>;
+      ConvertOutput convert_output{};
+
+      Tensor tC_rAux_vec = recast<Array<ElementCompute, V>>(coalesce(tC_rAux));
+      Tensor tC_cAux_vec = tensor<1>(zipped_divide(coalesce(tC_cAux(_,_,_,epi_m,epi_n)), MCL.compose(Int<V>{})));
+
+      int64_t stride_M = int64_t(get<0>(params_ptr->dAux));
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size(tC_rAux_vec); ++i) {
+        int m = get<0>(tC_cAux_vec(i));
+        int n = get<1>(tC_cAux_vec(i));
+        if (elem_less(make_coord(m, n), problem_shape_mn)) {
+          int64_t dst_row = static_cast<int64_t>(ptr_row_index_l[m]);
+          if (dst_row < 0) {
+            continue;
+          }
+
+          Array<ElementCompute, V> frg_compute = tC_rAux_vec(i);
+          if (ptr_row_weight_l != nullptr) {
+            multiplies<Array<ElementCompute, V>> mul{};
+            frg_compute = mul(frg_compute, static_cast<ElementCompute>(ptr_row_weight_l[m]));
+          }
+          Array<Element, V> frg_output = convert_output(frg_compute);
+
+          Element* gmem_ptr = ptr_aux_l + (dst_row * stride_M + int64_t(n));
+          if constexpr (IsPackedReduce) {
+            uint32_t const* rmem_ptr = reinterpret_cast<uint32_t const*>(&frg_output);
+            CUTLASS_PRAGMA_UNROLL
+            for (int j = 0; j < V / 2; ++j) {
+              packed_reduce(gmem_ptr + 2 * j, rmem_ptr[j]);
+            }
+          }
+          else if constexpr (IsAtomic) {
+            GmemReduceFn<Element> reduce_output{};
+            CUTLASS_PRAGMA_UNROLL
+            for (int j = 0; j < V; ++j) {
+              reduce_output(gmem_ptr + j, frg_output[j]);
+            }
+          }
+          else {
+            *reinterpret_cast<VecType*>(gmem_ptr) = reinterpret_cast<VecType const&>(frg_output);
+          }
+        }
+      }
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+
+    auto [M, N, K, L] = args.problem_shape_mnkl;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+
+    auto problem_shape_mn = make_shape(M,N);
+
+    // Gmem Tensor, only used to determine the vectorization of the scattered rows
+    Tensor mAux = make_tensor(
+      make_gmem_ptr(params_ptr->ptr_aux), make_shape(M,N,L), params_ptr->dAux
+    );
+    Tensor tC_gAux = sm90_partition_for_epilogue<ReferenceSrc>(
+                      mAux, args.tile_shape_mnk, args.tile_coord_mnkl, args.epi_tile, args.tiled_copy, args.thread_idx);
+
+    // Register Tensor
+    Tensor tC_rAux = make_tensor<ElementCompute>(take<0,3>(shape(tC_gAux)));
+
+    // Predication support
+    Tensor coordAux = make_identity_tensor(shape(mAux));
+    Tensor tC_cAux = sm90_partition_for_epilogue<ReferenceSrc>(
+                      coordAux, args.tile_shape_mnk, args.tile_coord_mnkl, args.epi_tile, args.tiled_copy, args.thread_idx);
+
+    // Destination, indices and weights of the current batch (group)
+    Element* ptr_aux_l = params_ptr->ptr_aux;
+    ElementIndex const* ptr_row_index_l = nullptr;
+    ElementWeight const* ptr_row_weight_l = nullptr;
+    if (not (EnableNullptr && params_ptr->ptr_aux == nullptr)) {
+      if constexpr (IsArrayOfPointers) {
+        ptr_row_index_l = params_ptr->ptr_row_index[l];
+        if (params_ptr->ptr_row_weight != nullptr) {
+          ptr_row_weight_l = params_ptr->ptr_row_weight[l];
+        }
+      }
+      else {
+        ptr_aux_l += int64_t(l) * int64_t(get<2>(params_ptr->dAux));
+        ptr_row_index_l = params_ptr->ptr_row_index + int64_t(l) * params_ptr->dRow;
+        if (params_ptr->ptr_row_weight != nullptr) {
+          ptr_row_weight_l = params_ptr->ptr_row_weight + int64_t(l) * params_ptr->dRow;
+        }
+      }
+    }
+
+    return ConsumerStoreCallbacks<decltype(tC_gAux), decltype(tC_rAux), decltype(tC_cAux), decltype(problem_shape_mn)>(
+      cute::move(tC_gAux),
+      cute::move(tC_rAux),
+      cute::move(tC_cAux),
+      problem_shape_mn,
+      ptr_aux_l,
+      ptr_row_index_l,
+      ptr_row_weight_l,
+      params_ptr
+    );
+  }
+
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Splits the output of a fused QKV projection into Q, K and V and writes K and V into a paged
+// KV cache from registers, e.g. to fuse the rotary embedding, KV cache quantization and cache write
+// that follow the QKV GEMM of an attention layer into its epilogue.
+//
+// The N dimension holds num_q_heads heads of Q followed by num_kv_heads heads each of K and V, all
+// head_dim wide. Row m of batch l is token t = m + l * M.
+//  - Q head h of token t is written to ptr_q + t * q_stride_token + h * q_stride_head, so that Q can be
+//    laid out token-major or head-major as the attention kernel expects.
+//  - K and V head h of token t are written to slot s = ptr_slot_mapping[t] of the paged caches, at
+//    ptr_k_cache / ptr_v_cache + (s / block_size) * cache_stride_block + (s % block_size) * cache_stride_slot
+//    + h * cache_stride_head. Tokens with a negative slot (e.g. padding) are not cached.
+// The head dimension is contiguous in all destinations.
+//
+// If ptr_q_scale, ptr_k_scale or ptr_v_scale is not null, the corresponding values are divided by the
+// scale they point to before they are converted, e.g. to quantize an FP8 KV cache with per-tensor scales.
+//
+// If rotary_dim is not zero, the rotary embedding is applied to the leading rotary_dim dimensions of
+// each Q and K head, rotating the interleaved pairs (2i, 2i+1) by the angle of the token position
+// ptr_positions[t]. ptr_cos_sin points to a (max_position, rotary_dim) row-major table whose rows hold the
+// rotary_dim / 2 cosines followed by the rotary_dim / 2 sines. Models using the rotate-half (NeoX) pairing
+// (i, i + rotary_dim / 2) can use this node by permuting the rows of the Q and K projection weights into
+// interleaved order, which leaves the attention scores unchanged.
+//
+// Combine with a void ElementD to skip the store of the unsplit output.
+template <
+  class ElementQ,
+  class ElementCache,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest,
+  int Alignment = 128 / sizeof_bits_v<ElementQ>,
+  bool EnableNullptr = true // Noop on nullptr params
+>
+struct Sm90QkvCacheStore {
+  using ElementAux = ElementQ;
+
+  static_assert(Alignment % 2 == 0, "Rotary embedding pairs must lie within a vector.");
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    int num_q_heads = 0;
+    int num_kv_heads = 0;
+    int head_dim = 0;
+
+    ElementQ* ptr_q = nullptr;
+    int64_t q_stride_token = 0;
+    int64_t q_stride_head = 0;
+
+    ElementCache* ptr_k_cache = nullptr;
+    ElementCache* ptr_v_cache = nullptr;
+    int block_size = 0;                                 // tokens per page of the caches
+    int64_t cache_stride_block = 0;
+    int64_t cache_stride_slot = 0;
+    int64_t cache_stride_head = 0;
+    int64_t const* ptr_slot_mapping = nullptr;          // (tokens) cache slot of each token, negative to skip
+
+    ElementCompute const* ptr_q_scale = nullptr;        // optional
+    ElementCompute const* ptr_k_scale = nullptr;        // optional
+    ElementCompute const* ptr_v_scale = nullptr;        // optional
+
+    int rotary_dim = 0;                                 // 0 disables the rotary embedding
+    int32_t const* ptr_positions = nullptr;             // (tokens) position of each token
+    ElementCompute const* ptr_cos_sin = nullptr;        // (max_position, rotary_dim) cosines then sines
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    if (EnableNullptr && args.ptr_q == nullptr && args.ptr_k_cache == nullptr && args.ptr_v_cache == nullptr) {
+      return true;
+    }
+    auto problem_shape_mnkl = append<4>(problem_shape, 1);
+    int N = int(get<1>(problem_shape_mnkl));
+    if (args.head_dim <= 0 || args.head_dim % Alignment != 0 ||
+        N != (args.num_q_heads + 2 * args.num_kv_heads) * args.head_dim) {
+      CUTLASS_TRACE_HOST("  can_implement: N must hold the Q, K and V heads, each a multiple of the alignment wide.\n");
+      return false;
+    }
+    if (args.q_stride_token % Alignment != 0 || args.q_stride_head % Alignment != 0 ||
+        args.cache_stride_block % Alignment != 0 || args.cache_stride_slot % Alignment != 0 ||
+        args.cache_stride_head % Alignment != 0) {
+      CUTLASS_TRACE_HOST("  can_implement: Q and KV cache strides do not satisfy the alignment requirement.\n");
+      return false;
+    }
+    if ((args.ptr_k_cache != nullptr || args.ptr_v_cache != nullptr) &&
+        (args.ptr_slot_mapping == nullptr || args.block_size <= 0)) {
+      CUTLASS_TRACE_HOST("  can_implement: the slot mapping and block size must be provided for the KV cache.\n");
+      return false;
+    }
+    if (args.rotary_dim != 0 &&
+        (args.rotary_dim < 0 || args.rotary_dim % 2 != 0 || args.rotary_dim > args.head_dim ||
+         args.ptr_positions == nullptr || args.ptr_cos_sin == nullptr)) {
+      CUTLASS_TRACE_HOST("  can_implement: invalid rotary embedding arguments.\n");
+      return false;
+    }
+    return true;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return cutlass::Status::kSuccess;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90QkvCacheStore() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90QkvCacheStore(Params const& params, SharedStorage const& shared_storage)
+    : params_ptr(&params) { }
+
+  Params const* params_ptr;
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<
+    class GTensorR2G,
+    class RTensor,
+    class CTensorR2G,
+    class ProblemShapeMN
+  >
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(
+        GTensorR2G&& tC_gQkv,
+        RTensor&& tC_rQkv,
+        CTensorR2G&& tC_cQkv,
+        ProblemShapeMN problem_shape_mn,
+        int64_t token_offset,
+        ElementCompute q_scale_inv,
+        ElementCompute k_scale_inv,
+        ElementCompute v_scale_inv,
+        Params const* params_ptr)
+      : tC_gQkv(cute::forward<GTensorR2G>(tC_gQkv)),
+        tC_rQkv(cute::forward<RTensor>(tC_rQkv)),
+        tC_cQkv(cute::forward<CTensorR2G>(tC_cQkv)),
+        problem_shape_mn(problem_shape_mn),
+        token_offset(token_offset),
+        q_scale_inv(q_scale_inv),
+        k_scale_inv(k_scale_inv),
+        v_scale_inv(v_scale_inv),
+        params_ptr(params_ptr) {}
+
+    GTensorR2G tC_gQkv;                                                                // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    RTensor tC_rQkv;                                                                   // (CPY,CPY_M,CPY_N)
+    CTensorR2G tC_cQkv;                                                                // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    ProblemShapeMN problem_shape_mn;
+    int64_t token_offset;
+    ElementCompute q_scale_inv;
+    ElementCompute k_scale_inv;
+    ElementCompute v_scale_inv;
+    Params const* params_ptr;
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+
+      Tensor tC_rQkv_frg = recast<Array<ElementCompute, FragmentSize>>(coalesce(tC_rQkv));
+      tC_rQkv_frg(epi_v) = convert_input(frg_input);
+
+      return frg_input;
+    }
+
+    // Writes one vector of a Q, K or V head
+    template <class ElementDst, int V>
+    CUTLASS_DEVICE static void
+    store_vector(ElementDst* gmem_ptr, Array<ElementCompute, V> const& frg_compute, ElementCompute scale_inv) {
+      using VecType = uint_bit_t<V * sizeof_bits_v<ElementDst>>;
+      using ConvertOutput = NumericArrayConverter<ElementDst, ElementCompute, V, RoundStyle>;
+      ConvertOutput convert_output{};
+      multiplies<Array<ElementCompute, V>> mul{};
+
+      Array<ElementDst, V> frg_output = convert_output(mul(frg_compute, scale_inv));
+      *reinterpret_cast<VecType*>(gmem_ptr) = reinterpret_cast<VecType const&>(frg_output);
+    }
+
+    template <class STensor, class SyncFn, class VTensor>
+    CUTLASS_DEVICE void
+    reduce(STensor&& reduction_buffer, SyncFn const& sync_fn, int epi_m, int epi_n, bool is_last_iteration, VTensor visit_results) {
+      Params const& params = *params_ptr;
+      if (EnableNullptr && params.ptr_q == nullptr && params.ptr_k_cache == nullptr && params.ptr_v_cache == nullptr) {
+        return;
+      }
+
+      // Vectors are contiguous in n and aligned, so each vector lies within a single head
+      constexpr auto MCL = decltype(max_common_layout(tC_gQkv(_,_,_,_0{},_0{}).layout(), tC_rQkv.layout())){};
+      constexpr int V = cute::min(Alignment, size(MCL));
+      static_assert(V % 2 == 0, "Rotary embedding pairs must lie within a vector.");
+
+      Tensor tC_rQkv_vec = recast<Array<ElementCompute, V>>(coalesce(tC_rQkv));
+      Tensor tC_cQkv_vec = tensor<1>(zipped_divide(coalesce(tC_cQkv(_,_,_,epi_m,epi_n)), MCL.compose(Int<V>{})));
+
+      int q_dim = params.num_q_heads * params.head_dim;
+      int kv_dim = params.num_kv_heads * params.head_dim;
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size(tC_rQkv_vec); ++i) {
+        int m = get<0>(tC_cQkv_vec(i));
+        int n = get<1>(tC_cQkv_vec(i));
+        if (not elem_less(make_coord(m, n), problem_shape_mn)) {
+          continue;
+        }
+
+        int64_t token = token_offset + m;
+        bool is_q = n < q_dim;
+        bool is_k = not is_q && n < q_dim + kv_dim;
+        int n_head = is_q ? n : (is_k ? n - q_dim : n - q_dim - kv_dim);
+        int head = n_head / params.head_dim;
+        int dim = n_head % params.head_dim;
+
+        int64_t slot = -1;
+        if (not is_q) {
+          if ((is_k ? params.ptr_k_cache : params.ptr_v_cache) == nullptr) {
+            continue;
+          }
+          slot = params.ptr_slot_mapping[token];
+          if (slot < 0) {
+            continue;
+          }
+        }
+        else if (params.ptr_q == nullptr) {
+          continue;
+        }
+
+        Array<ElementCompute, V> frg_compute = tC_rQkv_vec(i);
+
+        // Rotate the interleaved pairs of Q and K
+        if (params.rotary_dim != 0 && (is_q || is_k) && dim < params.rotary_dim) {
+          ElementCompute const* cos_sin = params.ptr_cos_sin + int64_t(params.ptr_positions[token]) * params.rotary_dim;
+          int half_rotary_dim = params.rotary_dim / 2;
+          CUTLASS_PRAGMA_UNROLL
+          for (int j = 0; j < V; j += 2) {
+            int pair = (dim + j) / 2;
+            if (pair < half_rotary_dim) {
+              ElementCompute cos_theta = cos_sin[pair];
+              ElementCompute sin_theta = cos_sin[half_rotary_dim + pair];
+              ElementCompute x0 = frg_compute[j];
+              ElementCompute x1 = frg_compute[j + 1];
+              frg_compute[j]     = x0 * cos_theta - x1 * sin_theta;
+              frg_compute[j + 1] = x1 * cos_theta + x0 * sin_theta;
+            }
+          }
+        }
+
+        if (is_q) {
+          ElementQ* gmem_ptr = params.ptr_q + (token * params.q_stride_token + int64_t(head) * params.q_stride_head + dim);
+          store_vector(gmem_ptr, frg_compute, q_scale_inv);
+        }
+        else {
+          int64_t block = slot / params.block_size;
+          int64_t block_offset = slot % params.block_size;
+          int64_t offset = block * params.cache_stride_block + block_offset * params.cache_stride_slot +
+                           int64_t(head) * params.cache_stride_head + dim;
+          if (is_k) {
+            store_vector(params.ptr_k_cache + offset, frg_compute, k_scale_inv);
+          }
+          else {
+            store_vector(params.ptr_v_cache + offset, frg_compute, v_scale_inv);
+          }
+        }
+      }
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+
+    auto [M, N, K, L] = args.problem_shape_mnkl;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+
+    auto problem_shape_mn = make_shape(M,N);
+
+    // Gmem Tensor of the unsplit n-major output, only used to determine the vectorization of the stores
+    Tensor mQkv = make_tensor(
+      make_gmem_ptr(params_ptr->ptr_q), make_shape(M,N,L), make_stride(int64_t(N), _1{}, int64_t(M) * int64_t(N))
+    );
+    Tensor tC_gQkv = sm90_partition_for_epilogue<ReferenceSrc>(
+                      mQkv, args.tile_shape_mnk, args.tile_coord_mnkl, args.epi_tile, args.tiled_copy, args.thread_idx);
+
+    // Register Tensor
+    Tensor tC_rQkv = make_tensor<ElementCompute>(take<0,3>(shape(tC_gQkv)));
+
+    // Predication support
+    Tensor coordQkv = make_identity_tensor(shape(mQkv));
+    Tensor tC_cQkv = sm90_partition_for_epilogue<ReferenceSrc>(
+                      coordQkv, args.tile_shape_mnk, args.tile_coord_mnkl, args.epi_tile, args.tiled_copy, args.thread_idx);
+
+    // Reciprocals of the quantization scales
+    ElementCompute q_scale_inv = ElementCompute(1);
+    ElementCompute k_scale_inv = ElementCompute(1);
+    ElementCompute v_scale_inv = ElementCompute(1);
+    if (params_ptr->ptr_q_scale != nullptr) {
+      q_scale_inv = ElementCompute(1) / *params_ptr->ptr_q_scale;
+    }
+    if (params_ptr->ptr_k_scale != nullptr) {
+      k_scale_inv = ElementCompute(1) / *params_ptr->ptr_k_scale;
+    }
+    if (params_ptr->ptr_v_scale != nullptr) {
+      v_scale_inv = ElementCompute(1) / *params_ptr->ptr_v_scale;
+    }
+
+    return ConsumerStoreCallbacks<decltype(tC_gQkv), decltype(tC_rQkv), decltype(tC_cQkv), decltype(problem_shape_mn)>(
+      cute::move(tC_gQkv),
+      cute::move(tC_rQkv),
+      cute::move(tC_cQkv),
+      problem_shape_mn,
+      int64_t(l) * int64_t(M),
+      q_scale_inv,
+      k_scale_inv,
+      v_scale_inv,
+      params_ptr
+    );
+  }
+
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Pools the output activations of an implicit GEMM conv fprop into a smaller tensor from registers,
+// e.g. to fuse the max or average pooling layer that follows a convolution into its epilogue.
+//
+// Row m of the linearized fprop problem is the output pixel (q, p, z, n) with q fastest, as in
+// cutlass::conv::detail::get_linearized_problem_shape_MNKL. Each pixel is reduced into every
+// (window_p, window_q) window of stride (stride_p, stride_q) that contains it, so overlapping windows
+// (e.g. 3x3 windows of stride 2) are supported. A window extent of 0 pools the whole spatial extent
+// (global pooling), a stride of 0 defaults to the window extent, and windows that do not fit entirely
+// within the output are dropped. The pooled tensor is packed n-major with extents
+// (pooled_q, pooled_p, Z, N, K) in the same order as the rows.
+//
+// Since pixels of a window may belong to different output tiles, the pooled tensor is reduced into with
+// global atomics and must be initialized by the user: to -inf for max pooling and to zero for average
+// pooling. Average pooling scales each pixel by the reciprocal of the window area before the reduction.
+// Combine with a void ElementD to skip the store of the full resolution output.
+enum class ConvPoolMode {
+  kMax,
+  kAverage
+};
+
+template <
+  ConvPoolMode PoolMode,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest,
+  bool EnableNullptr = true // Noop on nullptr params
+>
+struct Sm90ConvPoolStore {
+  // Atomic max is only available for 32b floats
+  using ElementPool = float;
+  using ReduceFn = cute::conditional_t<PoolMode == ConvPoolMode::kMax, atomic_maximum<ElementPool>, atomic_add<ElementPool>>;
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementPool* ptr_pool = nullptr;
+    int extent_q = 1;                       // output width Q
+    int extent_p = 1;                       // output height P
+    int extent_z = 1;                       // output depth Z
+    int window_q = 2;                       // 0 pools the whole width
+    int window_p = 2;                       // 0 pools the whole height
+    int stride_q = 0;                       // 0 defaults to window_q
+    int stride_p = 0;                       // 0 defaults to window_p
+  };
+
+  struct Params {
+    ElementPool* ptr_pool = nullptr;
+    FastDivmod divmod_q{};
+    FastDivmod divmod_p{};
+    int window_q = 1;
+    int window_p = 1;
+    int stride_q = 1;
+    int stride_p = 1;
+    int pooled_q = 1;
+    int pooled_p = 1;
+    ElementPool scale = ElementPool(1);
+  };
+
+  CUTLASS_HOST_DEVICE static int
+  resolve_window(int window, int extent) {
+    return window == 0 ? extent : window;
+  }
+
+  CUTLASS_HOST_DEVICE static int
+  resolve_stride(int stride, int window) {
+    return stride == 0 ? window : stride;
+  }
+
+  template <class ProblemShape>
+  static Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    int window_q = resolve_window(args.window_q, args.extent_q);
+    int window_p = resolve_window(args.window_p, args.extent_p);
+    int stride_q = resolve_stride(args.stride_q, window_q);
+    int stride_p = resolve_stride(args.stride_p, window_p);
+
+    Params params;
+    params.ptr_pool = args.ptr_pool;
+    params.divmod_q = FastDivmod(args.extent_q);
+    params.divmod_p = FastDivmod(args.extent_p);
+    params.window_q = window_q;
+    params.window_p = window_p;
+    params.stride_q = stride_q;
+    params.stride_p = stride_p;
+    params.pooled_q = (args.extent_q - window_q) / stride_q + 1;
+    params.pooled_p = (args.extent_p - window_p) / stride_p + 1;
+    if constexpr (PoolMode == ConvPoolMode::kAverage) {
+      params.scale = ElementPool(1) / ElementPool(window_q * window_p);
+    }
+    return params;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    if (args.extent_q <= 0 || args.extent_p <= 0 || args.extent_z <= 0) {
+      CUTLASS_TRACE_HOST("  can_implement: pooling requires positive output extents.\n");
+      return false;
+    }
+    int window_q = resolve_window(args.window_q, args.extent_q);
+    int window_p = resolve_window(args.window_p, args.extent_p);
+    if (window_q < 0 || window_p < 0 || window_q > args.extent_q || window_p > args.extent_p) {
+      CUTLASS_TRACE_HOST("  can_implement: pooling windows must fit within the output.\n");
+      return false;
+    }
+    if (args.stride_q < 0 || args.stride_p < 0) {
+      CUTLASS_TRACE_HOST("  can_implement: pooling strides must not be negative.\n");
+      return false;
+    }
+    auto problem_shape_mnkl = append<4>(problem_shape, 1);
+    if (int64_t(get<0>(problem_shape_mnkl)) % (int64_t(args.extent_q) * args.extent_p * args.extent_z) != 0) {
+      CUTLASS_TRACE_HOST("  can_implement: GEMM-M is not a multiple of the output pixels per image.\n");
+      return false;
+    }
+    return true;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return cutlass::Status::kSuccess;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90ConvPoolStore() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90ConvPoolStore(Params const& params, SharedStorage const& shared_storage)
+    : params_ptr(&params) { }
+
+  Params const* params_ptr;
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<
+    class RTensor,
+    class CTensorR2G,
+    class ProblemShapeMN
+  >
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(
+        RTensor&& tC_rPool,
+        CTensorR2G&& tC_cPool,
+        ProblemShapeMN problem_shape_mn,
+        Params const* params_ptr)
+      : tC_rPool(cute::forward<RTensor>(tC_rPool)),
+        tC_cPool(cute::forward<CTensorR2G>(tC_cPool)),
+        problem_shape_mn(problem_shape_mn),
+        params_ptr(params_ptr) {}
+
+    RTensor tC_rPool;                                                                  // (CPY,CPY_M,CPY_N)
+    CTensorR2G tC_cPool;                                                               // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    ProblemShapeMN problem_shape_mn;
+    Params const* params_ptr;
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
       ConvertInput convert_input{};
 
-      Tensor tC_rAux_frg = recast<Array<Element, FragmentSize>>(coalesce(tC_rAux));                          // (EPI_V)
-      tC_rAux_frg(epi_v) = convert_input(frg_input);
+      Tensor tC_rPool_frg = recast<Array<ElementCompute, FragmentSize>>(coalesce(tC_rPool));
+      tC_rPool_frg(epi_v) = convert_input(frg_input);
 
       return frg_input;
     }
 
+    template <class STensor, class SyncFn, class VTensor>
     CUTLASS_DEVICE void
-    postreduce(int epi_m, int epi_n, int store_iteration, bool issue_smem_store) {
-      if constexpr (EnableNullptr) {
-        if (params_ptr->is_nullptr) {
-          return;
-        }
+    reduce(STensor&& reduction_buffer, SyncFn const& sync_fn, int epi_m, int epi_n, bool is_last_iteration, VTensor visit_results) {
+      if (EnableNullptr && params_ptr->ptr_pool == nullptr) {
+        return;
       }
 
-      using RLayoutR2S = decltype(cute::layout(TiledR2S{}.get_slice(0).retile_S(RTensor{})));
-      Tensor tRS_rAux = make_tensor(tC_rAux.data(), RLayoutR2S{});                                 // (R2S,R2S_M,R2S_N)
+      Params const& params = *params_ptr;
+      int N = get<1>(problem_shape_mn);
+      int64_t pooled_stride_z = int64_t(params.pooled_q) * params.pooled_p;
+      ReduceFn reduce_output{};
+      NumericConverter<ElementPool, ElementCompute, RoundStyle> convert_output{};
 
-      if (issue_smem_store) {
-        int store_pipe_index = store_iteration % Stages;
-        copy(tiled_r2s, tRS_rAux, tRS_sAux(_,_,_,store_pipe_index));
-      }
-    }
+      Tensor tC_rPool_flt = coalesce(tC_rPool);
+      Tensor tC_cPool_flt = coalesce(tC_cPool(_,_,_,epi_m,epi_n));
 
-    CUTLASS_DEVICE void
-    tma_store(int epi_m, int epi_n, int store_iteration, bool issue_tma_store) {
-      if constexpr (EnableNullptr) {
-        if (params_ptr->is_nullptr) {
-          return;
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size(tC_rPool_flt); ++i) {
+        int m = get<0>(tC_cPool_flt(i));
+        int n = get<1>(tC_cPool_flt(i));
+        if (not elem_less(make_coord(m, n), problem_shape_mn)) {
+          continue;
         }
-      }
 
-      if (issue_tma_store) {
-        // Issue the TMA store
-        int store_pipe_index = store_iteration % Stages;
-        copy(params_ptr->tma_store_aux, bSG_sAux(_,_,_,store_pipe_index), bSG_gAux(_,_,_,epi_m,epi_n));
+        // Decompose the output pixel, the image index is folded into z
+        int q, p, z, residual;
+        params.divmod_q(residual, q, m);
+        params.divmod_p(z, p, residual);
+
+        ElementPool value = convert_output(tC_rPool_flt(i));
+        if constexpr (PoolMode == ConvPoolMode::kAverage) {
+          value *= params.scale;
+        }
+
+        // Range of the pooled windows containing (p, q), usually a single one
+        int pp_end = cute::min(p / params.stride_p + 1, params.pooled_p);
+        int pq_end = cute::min(q / params.stride_q + 1, params.pooled_q);
+        int pp_begin = cute::max(p - params.window_p + params.stride_p, 0) / params.stride_p;
+        int pq_begin = cute::max(q - params.window_q + params.stride_q, 0) / params.stride_q;
+
+        for (int pp = pp_begin; pp < pp_end; ++pp) {
+          for (int pq = pq_begin; pq < pq_end; ++pq) {
+            int64_t pooled_row = int64_t(z) * pooled_stride_z + int64_t(pp) * params.pooled_q + pq;
+            reduce_output(params.ptr_pool + (pooled_row * N + n), value);
+          }
+        }
       }
     }
   };
@@ -287,73 +1730,83 @@ struct Sm90AuxStore {
   get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
 
     auto [M, N, K, L] = args.problem_shape_mnkl;
-    auto [m, n, k, l] = args.tile_coord_mnkl;
-    Tensor mAux = params_ptr->tma_store_aux.get_tma_tensor(make_shape(M,N,L));                               // (M,N,L)
-    Tensor gAux = local_tile(mAux, take<0,2>(args.tile_shape_mnk), make_coord(m,n,l));                 // (CTA_M,CTA_N)
 
-    Tensor tC_gAux = sm90_partition_for_epilogue<ReferenceSrc>(                        // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
-                      gAux, args.epi_tile, args.tiled_copy, args.thread_idx);
-    Tensor tC_rAux = make_tensor<Element>(take<0,3>(shape(tC_gAux)));                  // (CPY,CPY_M,CPY_N)
-
-    Tensor sAux_epi = cute::as_position_independent_swizzle_tensor(
-                        make_tensor(make_smem_ptr(smem_aux), SmemLayout{}));     // (EPI_TILE_M,EPI_TILE_N,PIPE)
-    Tensor gAux_epi = flat_divide(gAux, args.epi_tile);                          // (EPI_TILE_M,EPI_TILE_N,EPI_M,EPI_N)
+    auto problem_shape_mn = make_shape(M,N);
 
-    auto tiled_r2s = conditional_return<ReferenceSrc>(
-      make_tiled_copy_S(Copy_Atom<CopyOpR2S,Element>{}, args.tiled_copy),
-      make_tiled_copy_D(Copy_Atom<CopyOpR2S,Element>{}, args.tiled_copy)
-    );
-    auto tRS_sAux = tiled_r2s.get_slice(args.thread_idx).partition_D(sAux_epi);               // (R2S,R2S_M,R2S_N,PIPE)
+    // Predication support, the coordinates also locate the output pixel of each element
+    Tensor coordPool = make_identity_tensor(make_shape(M,N,L));
+    Tensor tC_cPool = sm90_partition_for_epilogue<ReferenceSrc>(
+                      coordPool, args.tile_shape_mnk, args.tile_coord_mnkl, args.epi_tile, args.tiled_copy, args.thread_idx);
 
-    ThrCopy thrblk_s2g = params_ptr->tma_store_aux.get_slice(_0{});
-    Tensor bSG_sAux = thrblk_s2g.partition_S(sAux_epi);                                // (TMA,TMA_M,TMA_N,PIPE)
-    Tensor bSG_gAux = thrblk_s2g.partition_D(gAux_epi);                                // (TMA,TMA_M,TMA_N,EPI_M,EPI_N)
+    // Register Tensor
+    Tensor tC_rPool = make_tensor<ElementCompute>(take<0,3>(shape(tC_cPool)));
 
-    return ConsumerStoreCallbacks<decltype(tC_rAux), decltype(tiled_r2s), decltype(tRS_sAux), decltype(bSG_sAux), decltype(bSG_gAux)>(
-            cute::move(tC_rAux),
-            tiled_r2s,
-            cute::move(tRS_sAux),
-            cute::move(bSG_sAux),
-            cute::move(bSG_gAux),
-            params_ptr);
+    return ConsumerStoreCallbacks<decltype(tC_rPool), decltype(tC_cPool), decltype(problem_shape_mn)>(
+      cute::move(tC_rPool),
+      cute::move(tC_cPool),
+      problem_shape_mn,
+      params_ptr
+    );
   }
+
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Sums the output columns of each segment into a pooled tensor from registers, e.g. to fuse the
+// pooling of an embedding bag into the epilogue of a GEMM whose N rows were gathered from the
+// embedding table (see the gathered B mode of the SM100 mixed TMA/cp.async mainloop).
+//
+// Column n of batch l is added to column ptr_segment_index[n + l * N] of the (M, num_segments, L)
+// m-major pooled tensor, whose segment and batch strides are ld_pool and batch_stride_pool. Columns
+// with a negative index are skipped. If ptr_segment_weight is not null, column n is first scaled by
+// ptr_segment_weight[n + l * N] (per-sample weights, or the reciprocal bag size for mean pooling).
+//
+// Since the columns of a segment may belong to different output tiles, the pooled tensor is reduced
+// into with global atomics and must be zeroed by the user. Combine with a void ElementD to skip the
+// store of the unpooled output.
 template <
-  class Element,
-  class EpilogueTile,   // Unused
-  FloatRoundStyle RoundStyle,
-  class LayoutOrStrideMNL,
-  class SmemLayoutAtom, // Unused
-  class CopyOpR2S,      // Unused
-  int Alignment,
-  bool EnableNullptr
+  class ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest,
+  bool EnableNullptr = true // Noop on nullptr params
 >
-struct Sm90AuxStore<
-  0, EpilogueTile, Element, RoundStyle, LayoutOrStrideMNL,
-  SmemLayoutAtom, CopyOpR2S, Alignment, EnableNullptr
-> {
-  using ElementAux = Element;
-  using StrideMNL = cutlass::gemm::TagToStrideC_t<LayoutOrStrideMNL>;
+struct Sm90SegmentSumStore {
+  using ElementPool = float;
+  using ReduceFn = atomic_add<ElementPool>;
 
   struct SharedStorage { };
 
   struct Arguments {
-    Element* ptr_aux = nullptr;
-    StrideMNL dAux = {};
+    ElementPool* ptr_pool = nullptr;
+    int32_t const* ptr_segment_index = nullptr;        // segment of each column
+    ElementPool const* ptr_segment_weight = nullptr;   // optional weight of each column
+    int64_t ld_pool = 0;                               // 0 defaults to M
+    int64_t batch_stride_pool = 0;
   };
 
   using Params = Arguments;
 
   template <class ProblemShape>
-  static constexpr Params
+  static Params
   to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
-    return args;
+    Params params = args;
+    if (params.ld_pool == 0) {
+      params.ld_pool = int64_t(get<0>(append<4>(problem_shape, 1)));
+    }
+    return params;
   }
 
   template <class ProblemShape>
   static bool
   can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    if (args.ptr_pool != nullptr && args.ptr_segment_index == nullptr) {
+      CUTLASS_TRACE_HOST("  can_implement: segment indices must be provided for the pooled tensor.\n");
+      return false;
+    }
+    if (args.ld_pool != 0 && args.ld_pool < int64_t(get<0>(append<4>(problem_shape, 1)))) {
+      CUTLASS_TRACE_HOST("  can_implement: pooled segments must not overlap.\n");
+      return false;
+    }
     return true;
   }
 
@@ -371,10 +1824,10 @@ struct Sm90AuxStore<
   }
 
   CUTLASS_HOST_DEVICE
-  Sm90AuxStore() { }
+  Sm90SegmentSumStore() { }
 
   CUTLASS_HOST_DEVICE
-  Sm90AuxStore(Params const& params, SharedStorage const& shared_storage)
+  Sm90SegmentSumStore(Params const& params, SharedStorage const& shared_storage)
     : params_ptr(&params) { }
 
   Params const* params_ptr;
@@ -396,67 +1849,84 @@ struct Sm90AuxStore<
   }
 
   template<
-    class GTensorR2G,
     class RTensor,
     class CTensorR2G,
-    class ProblemShapeMNL
+    class ProblemShapeMN
   >
   struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
     CUTLASS_DEVICE
     ConsumerStoreCallbacks(
-        GTensorR2G&& tC_gAux,
-        RTensor&& tC_rAux,
-        CTensorR2G&& tC_cAux,
-        ProblemShapeMNL problem_shape_mnl,
+        RTensor&& tC_rPool,
+        CTensorR2G&& tC_cPool,
+        ProblemShapeMN problem_shape_mn,
+        int l_coord,
         Params const* params_ptr)
-      : tC_gAux(cute::forward<GTensorR2G>(tC_gAux)),
-        tC_rAux(cute::forward<RTensor>(tC_rAux)),
-        tC_cAux(cute::forward<CTensorR2G>(tC_cAux)),
-        problem_shape_mnl(problem_shape_mnl),
+      : tC_rPool(cute::forward<RTensor>(tC_rPool)),
+        tC_cPool(cute::forward<CTensorR2G>(tC_cPool)),
+        problem_shape_mn(problem_shape_mn),
+        l_coord(l_coord),
         params_ptr(params_ptr) {}
 
-    GTensorR2G tC_gAux;
-    RTensor tC_rAux;
-    CTensorR2G tC_cAux;
-    ProblemShapeMNL problem_shape_mnl;
+    RTensor tC_rPool;                                                                  // (CPY,CPY_M,CPY_N)
+    CTensorR2G tC_cPool;                                                               // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    ProblemShapeMN problem_shape_mn;
+    int l_coord;
     Params const* params_ptr;
 
     template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
     CUTLASS_DEVICE auto
     visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
           Array<ElementInput, FragmentSize> const& frg_input) {
-      using ConvertInput = NumericArrayConverter<Element, ElementInput, FragmentSize, RoundStyle>;
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
       ConvertInput convert_input{};
 
-      Tensor tC_rAux_frg = recast<Array<Element, FragmentSize>>(coalesce(tC_rAux));
-      tC_rAux_frg(epi_v) = convert_input(frg_input);
+      Tensor tC_rPool_frg = recast<Array<ElementCompute, FragmentSize>>(coalesce(tC_rPool));
+      tC_rPool_frg(epi_v) = convert_input(frg_input);
 
       return frg_input;
     }
 
+    template <class STensor, class SyncFn, class VTensor>
     CUTLASS_DEVICE void
-    end_loop(int epi_m, int epi_n) {
-      if constexpr (EnableNullptr) {
-        if (params_ptr->ptr_aux == nullptr) {
-          return;
-        }
+    reduce(STensor&& reduction_buffer, SyncFn const& sync_fn, int epi_m, int epi_n, bool is_last_iteration, VTensor visit_results) {
+      if (EnableNullptr && params_ptr->ptr_pool == nullptr) {
+        return;
       }
 
-      constexpr auto MCL = decltype(max_common_layout(tC_gAux(_,_,_,_0{},_0{}), tC_rAux)){};
-      constexpr int V = cute::min(Alignment, size(MCL));
+      Params const& params = *params_ptr;
+      int N = get<1>(problem_shape_mn);
+      int64_t column_offset_l = int64_t(l_coord) * N;
+      ElementPool* ptr_pool_l = params.ptr_pool + int64_t(l_coord) * params.batch_stride_pool;
+      ReduceFn reduce_output{};
+      NumericConverter<ElementPool, ElementCompute, RoundStyle> convert_output{};
 
-      Tensor tC_gAux_vec = recast<Array<Element, V>>(coalesce(tC_gAux(_,_,_,epi_m,epi_n)));
-      Tensor tC_rAux_vec = recast<Array<Element, V>>(coalesce(tC_rAux));
+      Tensor tC_rPool_flt = coalesce(tC_rPool);
+      Tensor tC_cPool_flt = coalesce(tC_cPool(_,_,_,epi_m,epi_n));
 
-      Tensor tC_cAux_vec = tensor<1>(zipped_divide(coalesce(tC_cAux(_,_,_,epi_m,epi_n)), MCL.compose(Int<V>{})));
-      Tensor tC_pAux_vec = cute::lazy::transform(tC_cAux_vec, [&](auto const& c){ return elem_less(c, problem_shape_mnl); });
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size(tC_rPool_flt); ++i) {
+        int m = get<0>(tC_cPool_flt(i));
+        int n = get<1>(tC_cPool_flt(i));
+        if (not elem_less(make_coord(m, n), problem_shape_mn)) {
+          continue;
+        }
 
-      copy_if(tC_pAux_vec, tC_rAux_vec, tC_gAux_vec);
+        int32_t segment = params.ptr_segment_index[column_offset_l + n];
+        if (segment < 0) {
+          continue;
+        }
+
+        ElementPool value = convert_output(tC_rPool_flt(i));
+        if (params.ptr_segment_weight != nullptr) {
+          value *= params.ptr_segment_weight[column_offset_l + n];
+        }
+        reduce_output(ptr_pool_l + (int64_t(segment) * params.ld_pool + m), value);
+      }
     }
   };
 
   template <
-    bool ReferenceSrc,
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
     class... Args
   >
   CUTLASS_DEVICE auto
@@ -465,35 +1935,29 @@ struct Sm90AuxStore<
     auto [M, N, K, L] = args.problem_shape_mnkl;
     auto [m, n, k, l] = args.tile_coord_mnkl;
 
-    auto problem_shape_mnl = make_shape(M,N,L);
+    auto problem_shape_mn = make_shape(M,N);
 
-    // Gmem Tensor
-    Tensor mAux = make_tensor(
-      make_gmem_ptr(params_ptr->ptr_aux), make_shape(M,N,L), params_ptr->dAux
-    );
-    Tensor tC_gAux = sm90_partition_for_epilogue<ReferenceSrc>(
-                      mAux, args.tile_shape_mnk, args.tile_coord_mnkl, args.epi_tile, args.tiled_copy, args.thread_idx);
+    // Predication support, the coordinates also locate the column of each element
+    Tensor coordPool = make_identity_tensor(make_shape(M,N,L));
+    Tensor tC_cPool = sm90_partition_for_epilogue<ReferenceSrc>(
+                      coordPool, args.tile_shape_mnk, args.tile_coord_mnkl, args.epi_tile, args.tiled_copy, args.thread_idx);
 
     // Register Tensor
-    Tensor tC_rAux = make_tensor<Element>(take<0,3>(shape(tC_gAux)));
+    Tensor tC_rPool = make_tensor<ElementCompute>(take<0,3>(shape(tC_cPool)));
 
-    // Predication support
-    Tensor coordAux = make_identity_tensor(shape(mAux));
-    Tensor tC_cAux = sm90_partition_for_epilogue<ReferenceSrc>(
-                      coordAux, args.tile_shape_mnk, args.tile_coord_mnkl, args.epi_tile, args.tiled_copy, args.thread_idx);
-
-    return ConsumerStoreCallbacks<decltype(tC_gAux), decltype(tC_rAux), decltype(tC_cAux), decltype(problem_shape_mnl)>(
-      cute::move(tC_gAux),
-      cute::move(tC_rAux),
-      cute::move(tC_cAux),
-      problem_shape_mnl,
+    return ConsumerStoreCallbacks<decltype(tC_rPool), decltype(tC_cPool), decltype(problem_shape_mn)>(
+      cute::move(tC_rPool),
+      cute::move(tC_cPool),
+      problem_shape_mn,
+      int(l),
       params_ptr
     );
-
   }
 
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 template <
   int Stages,
   int NumEpilogueWarpGroups,
@@ -881,6 +2345,10 @@ struct Sm90AuxArrayStore {
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 // Scalar reduction
+//
+// If GmemReduceFn is not atomic, the reduction is deterministic: each CTA reduces its tile in a fixed
+// shuffle + smem order and writes the partial to a workspace buffer, and the last CTA to arrive reduces
+// the partials of all tiles in tile order, so the result is independent of CTA scheduling.
 template <
   template <class> class RegReduceFn,
   template <class> class GmemReduceFn,
@@ -888,14 +2356,15 @@ template <
   class ElementCompute,
   FloatRoundStyle RoundStyle,
   class StrideMNL = Stride<_0,_0,_0>,
-  bool EnableNullptr = true // Noop on nullptr params
+  bool EnableNullptr = true, // Noop on nullptr params
+  class CtaTileShapeMNK = void // Required by the non-atomic reduction, which keeps one partial per CTA tile
 >
 struct Sm90ScalarReduction {
 private:
   static_assert(is_static_v<decltype(take<0,2>(StrideMNL{}))>); // batch stride can be dynamic or static
   static_assert(take<0,2>(StrideMNL{}) == Stride<_0,_0>{});
   static constexpr bool IsAtomic = is_atomic<GmemReduceFn<ElementCompute>>::value;
-  static_assert(IsAtomic, "non-atomic scalar reduction not supported yet");
+  static_assert(IsAtomic || not cute::is_void_v<CtaTileShapeMNK>, "non-atomic scalar reduction requires the CTA tile shape");
 
 public:
   struct SharedStorage { };
@@ -906,12 +2375,43 @@ public:
     StrideMNL dScalar = {};
   };
 
-  using Params = Arguments;
+  struct Params {
+    ElementOutput* ptr_scalar = nullptr;
+    ElementCompute reduction_identity = ElementCompute(0);
+    StrideMNL dScalar = {};
+    ElementCompute* reduction_buffer = nullptr; // (ceil_M,ceil_N,L) m-major tile partials
+    int* tile_counters = nullptr;               // (L) arrived tile counts
+  };
+
+private:
+  template <class ProblemShape>
+  static size_t
+  get_tile_counters_offset(ProblemShape const& problem_shape) {
+    auto problem_shape_mnkl = append<4>(problem_shape, 1);
+    auto [M, N, K, L] = problem_shape_mnkl;
+    auto [tile_M, tile_N, tile_K] = CtaTileShapeMNK{};
+    size_t tile_counters_offset = product(ceil_div(make_shape(size<>(M), size<>(N), L), make_shape(tile_M, tile_N))) * sizeof(ElementCompute);
+    return round_nearest(tile_counters_offset, MinWorkspaceAlignment);
+  }
 
+public:
   template <class ProblemShape>
   static constexpr Params
   to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
-    return args;
+    ElementCompute* reduction_buffer = nullptr;
+    int* tile_counters = nullptr;
+    if constexpr (not IsAtomic) {
+      reduction_buffer = reinterpret_cast<ElementCompute*>(workspace);
+      tile_counters = reinterpret_cast<int*>(reinterpret_cast<uint8_t*>(workspace) + get_tile_counters_offset(problem_shape));
+    }
+
+    return {
+      args.ptr_scalar,
+      args.reduction_identity,
+      args.dScalar,
+      reduction_buffer,
+      tile_counters
+    };
   }
 
   template <class ProblemShape>
@@ -923,25 +2423,38 @@ public:
   template <class ProblemShape>
   static size_t
   get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
-    return 0;
+    if constexpr (IsAtomic) {
+      return 0;
+    }
+    else {
+      auto problem_shape_mnkl = append<4>(problem_shape, 1);
+      auto [M, N, K, L] = problem_shape_mnkl;
+      // Size of reduction buffer, aligned, incremented by size of tile counters
+      return get_tile_counters_offset(problem_shape) + size<>(L) * sizeof(int);
+    }
   }
 
   template <class ProblemShape>
   static cutlass::Status
   initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
     CudaHostAdapter* cuda_adapter = nullptr) {
-  #if !defined(CUTLASS_SKIP_REDUCTION_INIT)
     if constexpr (IsAtomic) {
+    #if !defined(CUTLASS_SKIP_REDUCTION_INIT)
       auto problem_shape_mnkl = append<4>(problem_shape, 1);
       auto [M, N, K, L] = problem_shape_mnkl;
       Layout mScalar_layout = make_layout(make_shape(M,N,L), args.dScalar);
       if (args.ptr_scalar != nullptr) {
         return fill_workspace(args.ptr_scalar, ElementOutput(args.reduction_identity), cosize(mScalar_layout), stream, cuda_adapter);
       }
+    #endif
+      return cutlass::Status::kSuccess;
+    }
+    else {
+      auto problem_shape_mnkl = append<4>(problem_shape, 1);
+      auto [M, N, K, L] = problem_shape_mnkl;
+      int* tile_counters = reinterpret_cast<int*>(reinterpret_cast<uint8_t*>(workspace) + get_tile_counters_offset(problem_shape));
+      return zero_workspace(tile_counters, size<>(L) * sizeof(int), stream, cuda_adapter);
     }
-  #endif
-
-    return cutlass::Status::kSuccess;
   }
 
   CUTLASS_DEVICE bool
@@ -969,25 +2482,44 @@ public:
     return EmptyProducerLoadCallbacks{};
   }
 
-  template<class CTensor, class ThrResidue>
+  template<class CTensor, class ThrResidue, int NumThreads>
   struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
     CUTLASS_DEVICE
     ConsumerStoreCallbacks(
         int l_coord,
         CTensor tCcScalar,
         ThrResidue residue_tCcScalar,
-        Params const& params)
+        Params const& params,
+        bool is_tile_in_bounds,
+        int partial_idx,
+        int first_partial,
+        int partial_count,
+        int counter_idx,
+        int thread_idx,
+        Int<NumThreads>)
       : scalar(params.reduction_identity),
         l_coord(l_coord),
         tCcScalar(tCcScalar),
         residue_tCcScalar(residue_tCcScalar),
-        params(params) {}
+        params(params),
+        is_tile_in_bounds(is_tile_in_bounds),
+        partial_idx(partial_idx),
+        first_partial(first_partial),
+        partial_count(partial_count),
+        counter_idx(counter_idx),
+        thread_idx(thread_idx) {}
 
     ElementCompute scalar;
     int l_coord;
     CTensor tCcScalar;                                                                 // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
     ThrResidue residue_tCcScalar;
     Params params;
+    bool is_tile_in_bounds;
+    int partial_idx;
+    int first_partial;                                                                 // First partial of this scalar
+    int partial_count;                                                                 // Number of partials of this scalar
+    int counter_idx;
+    int thread_idx;
 
     template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
     CUTLASS_DEVICE auto
@@ -1017,22 +2549,115 @@ public:
       return frg_input;
     }
 
+    // Reduces a value across the collective threads in a fixed order, the result is returned to thread 0
+    template <class STensor, class SyncFn>
+    CUTLASS_DEVICE ElementCompute
+    reduce_threads(ElementCompute value, STensor& smem_buffer, SyncFn const& sync_fn) {
+      constexpr int NumWarps = NumThreads / NumThreadsPerWarp;
+      static_assert(NumWarps * sizeof(ElementCompute) <=
+                    decltype(cosize(smem_buffer.layout()))::value * sizeof(typename remove_cvref_t<STensor>::value_type),
+                    "smem reduction buffer not large enough, use a larger epilogue tile");
+      GmemReduceFn<ElementCompute> reduce_partial{};
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int offset = NumThreadsPerWarp / 2; offset > 0; offset /= 2) {
+        value = reduce_partial(value, __shfl_xor_sync(0xFFFFFFFF, value, offset));
+      }
+
+      ElementCompute* sBuf = reinterpret_cast<ElementCompute*>(raw_pointer_cast(smem_buffer.data()));
+      sync_fn();
+      if (thread_idx % NumThreadsPerWarp == 0) {
+        sBuf[thread_idx / NumThreadsPerWarp] = value;
+      }
+      sync_fn();
+      if (thread_idx == 0) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int w = 1; w < NumWarps; ++w) {
+          value = reduce_partial(value, sBuf[w]);
+        }
+      }
+      sync_fn();
+      return value;
+    }
+
+    template <class STensor, class SyncFn, class VTensor>
     CUTLASS_DEVICE void
-    end() {
-      if constexpr (EnableNullptr) {
-        if (params.ptr_scalar == nullptr) {
+    reduce(STensor&& smem_buffer, SyncFn const& sync_fn, int epi_m, int epi_n, bool is_last_iteration, VTensor visit_results) {
+      if constexpr (not IsAtomic) {
+        if (not is_last_iteration) {
           return;
         }
+        if constexpr (EnableNullptr) {
+          if (params.ptr_scalar == nullptr) {
+            return;
+          }
+        }
+        // fully OOB CTA in partially OOB cluster
+        if (not is_tile_in_bounds) {
+          return;
+        }
+
+        //
+        // 1. Reduce the tile and write its partial to the gmem workspace
+        //
+        ElementCompute tile_scalar = reduce_threads(scalar, smem_buffer, sync_fn);
+        if (thread_idx == 0) {
+          params.reduction_buffer[partial_idx] = tile_scalar;
+        }
+
+        //
+        // 2. Increment the tile counter to signal the final gmem reduction
+        //
+        // Ensure gmem writes are visible to other threads before incrementing counter
+        __threadfence();
+        sync_fn();
+        int* prev_tile_count = reinterpret_cast<int*>(raw_pointer_cast(smem_buffer.data()));
+        if (thread_idx == 0) {
+          *prev_tile_count = atomicAdd(&params.tile_counters[counter_idx], 1);
+        }
+        sync_fn();
+        bool do_final_reduction = *prev_tile_count == partial_count - 1;
+        sync_fn();
+
+        //
+        // 3. The last CTA reduces the partials of all tiles in tile order
+        //
+        if (do_final_reduction) {
+          __threadfence();
+          GmemReduceFn<ElementCompute> reduce_partial{};
+          ElementCompute volatile* gBuf = params.reduction_buffer + first_partial;
+          ElementCompute value = params.reduction_identity;
+          for (int i = thread_idx; i < partial_count; i += NumThreads) {
+            value = reduce_partial(value, ElementCompute(gBuf[i]));
+          }
+          value = reduce_threads(value, smem_buffer, sync_fn);
+
+          if (thread_idx == 0) {
+            NumericConverter<ElementOutput, ElementCompute, RoundStyle> convert_output{};
+            params.ptr_scalar[l_coord * get<2>(params.dScalar)] = convert_output(value);
+          }
+        }
       }
+    }
+
+    CUTLASS_DEVICE void
+    end() {
+      if constexpr (IsAtomic) {
+        if constexpr (EnableNullptr) {
+          if (params.ptr_scalar == nullptr) {
+            return;
+          }
+        }
 
-      using ConvertI = NumericConverter<ElementOutput, ElementCompute, RoundStyle>;
-      using ReduceInput = GmemReduceFn<ElementOutput>;
+        using ConvertI = NumericConverter<ElementOutput, ElementCompute, RoundStyle>;
+        using ReduceInput = GmemReduceFn<ElementOutput>;
 
-      ConvertI convert_I{};
-      ReduceInput reduce_input{};
+        ConvertI convert_I{};
+        ReduceInput reduce_input{};
 
-      ElementOutput* ptr_scalar = params.ptr_scalar + l_coord * get<2>(params.dScalar);
-      reduce_input(ptr_scalar, convert_I(scalar));
+        ElementOutput* ptr_scalar = params.ptr_scalar + l_coord * get<2>(params.dScalar);
+        reduce_input(ptr_scalar, convert_I(scalar));
+      }
     }
 
   };
@@ -1043,8 +2668,31 @@ public:
   >
   CUTLASS_DEVICE auto
   get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
-    return ConsumerStoreCallbacks<decltype(args.tCcD), decltype(args.residue_tCcD)>(
-      get<3>(args.tile_coord_mnkl), args.tCcD, args.residue_tCcD, params);
+    auto [M, N, K, L] = args.problem_shape_mnkl;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+    bool is_tile_in_bounds = elem_less(args.cD(_0{},_0{}), args.residue_cD);
+
+    // m-major (ceil_M,ceil_N,L) partials, a scalar reduced over batches owns all of them
+    int partial_idx = 0, first_partial = 0, partial_count = 0, counter_idx = 0;
+    if constexpr (not IsAtomic) {
+      auto [tile_M, tile_N, tile_K] = CtaTileShapeMNK{};
+      int tiles_m = ceil_div(size<>(M), size<>(tile_M));
+      int tiles_n = ceil_div(size<>(N), size<>(tile_N));
+      partial_idx = (int(l) * tiles_n + int(n)) * tiles_m + int(m);
+      if (get<2>(params.dScalar) == 0) {
+        partial_count = tiles_m * tiles_n * size<>(L);
+      }
+      else {
+        first_partial = int(l) * tiles_m * tiles_n;
+        partial_count = tiles_m * tiles_n;
+        counter_idx = int(l);
+      }
+    }
+
+    constexpr int NumThreads = decltype(args.tiled_copy)::TiledNumThr::value;
+    return ConsumerStoreCallbacks<decltype(args.tCcD), decltype(args.residue_tCcD), NumThreads>(
+      get<3>(args.tile_coord_mnkl), args.tCcD, args.residue_tCcD, params,
+      is_tile_in_bounds, partial_idx, first_partial, partial_count, counter_idx, args.thread_idx, Int<NumThreads>{});
   }
 
 };
@@ -55,7 +55,22 @@ namespace cutlass::epilogue::fusion {
 //     1. CTA_N >= N (single tile across N, the mode which is reduced)
 //     2. EPI_N >= N (single epilogue tile across N, because we can reduce and revisit one
 //        epilogue tile at a time.)
-//     3. Top-K value is either 2 or 4.
+//     3. Top-K value is 1, 2, 4 or 8.
+//
+// The Top-K is selected cooperatively by the lanes of a warp: each thread keeps a sorted list of
+// the largest values it has visited in a row, and the per-thread lists are merged with warp
+// shuffles. This bounds register use by TopK rather than N, so rows as wide as the epilogue tile
+// (e.g. the 64-256 experts of a mixture-of-experts router) can be reduced.
+//
+// With EmitIndices, the node additionally writes the column indices of the Top-K of each row
+// (e.g. the experts selected by each token) in descending order to a packed (M,TopK,L) int32_t
+// tensor, and atomically counts how many rows selected each column into a packed (N,L) int32_t
+// histogram, which must be zeroed by the user. These are the inputs needed to build the problem
+// shapes of a grouped GEMM over the selected experts on device.
+//
+// To track indices at no cost to the reduction, the index of each element is packed into the
+// low ceil(log2(CTA_N)) mantissa bits of its value. Ties are therefore broken deterministically,
+// and the softmax is computed on values with a relative error of at most 2^(ceil(log2(CTA_N)) - 23).
 //
 
 namespace detail {
@@ -330,15 +345,46 @@ template <
   class ElementCompute,
   FloatRoundStyle RoundStyle,
   int Alignment = 128 / sizeof_bits_v<ElementOutput>,
-  bool UseButterflyReduce = true
+  bool UseButterflyReduce = true,
+  bool EmitIndices = false
 >
 struct Sm90TopKSoftmaxColReduction {
 private:
   static_assert(is_same_v<ElementCompute, float>, "Fused Top-K + Softmax reduction requires FP32 accumulation.");
-  static_assert(TopK == 2 || TopK == 4,
-  "Fused Top-K + Softmax reduction only allows K=2 and K=4, because those cases have been performance-optimized. Other values of K can be enabled by removing this assertion, but they may come with serious performance implications."
+  static_assert(TopK == 1 || TopK == 2 || TopK == 4 || TopK == 8,
+  "Fused Top-K + Softmax reduction only allows K=1, 2, 4 and 8. K=2 and K=4 have been performance-optimized, other values of K use a generic merge which may come with serious performance implications."
   );
   static_assert(Alignment * sizeof_bits_v<ElementOutput> % 128 == 0, "sub-16B alignment not supported yet");
+  // Indices of the reduced Top-K are only held by all lanes after a butterfly reduction
+  static_assert(not EmitIndices || UseButterflyReduce, "Top-K index outputs require the butterfly reduction.");
+
+  // Number of low mantissa bits holding the column index when indices are tracked
+  static constexpr int IndexBits = EmitIndices ? log_2(static_cast<uint32_t>(2 * size<1>(CtaTileShapeMNK{}) - 1)) : 0;
+  static constexpr uint32_t IndexMask = (1u << IndexBits) - 1;
+  static_assert(IndexBits <= 12, "Top-K index tracking supports up to 4096 columns.");
+
+  // Replace the low mantissa bits of a value with its column index, such that lower indices
+  // compare greater among values equal up to the index bits. This perturbs the value by less
+  // than 2^IndexBits ULPs, which bounds the error of the router outputs computed from it.
+  CUTLASS_DEVICE
+  static ElementCompute
+  pack_index(ElementCompute value, int n) {
+    // Infinities would turn into NaNs, and negative zero would order below positive zero
+    ElementCompute const max_value = cutlass::platform::numeric_limits<ElementCompute>::max();
+    value = value == ElementCompute(0) ? ElementCompute(0) : fminf(fmaxf(value, -max_value), max_value);
+    uint32_t bits = __float_as_uint(value) & ~IndexMask;
+    // Negative values decrease as their bits increase, so their index is stored as is
+    uint32_t key = (bits & 0x80000000u) ? static_cast<uint32_t>(n) : IndexMask - static_cast<uint32_t>(n);
+    return __uint_as_float(bits | key);
+  }
+
+  CUTLASS_DEVICE
+  static int
+  unpack_index(ElementCompute key) {
+    uint32_t bits = __float_as_uint(key);
+    uint32_t index = bits & IndexMask;
+    return static_cast<int>((bits & 0x80000000u) ? index : IndexMask - index);
+  }
 
   // Reduction tensors
   //   We have two tensors for this EVT node: a reduction tensor and a tensor holding
@@ -462,17 +508,24 @@ private:
     }
   };
 
+  struct EmptyArguments { };
+
+  struct IndexArguments {
+    int32_t* ptr_topk_indices = nullptr;  // (M,TopK,L) packed row-major, may be null
+    int32_t* ptr_expert_counts = nullptr; // (N,L) packed, atomically incremented, may be null
+  };
+
 public:
   struct SharedStorage { };
 
-  struct Arguments { };
+  using Arguments = cute::conditional_t<EmitIndices, IndexArguments, EmptyArguments>;
 
-  struct Params { };
+  using Params = Arguments;
 
   template <class ProblemShape>
   static constexpr Params
   to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
-    return {};
+    return args;
   }
 
   template <class ProblemShape>
@@ -543,7 +596,8 @@ public:
 
       auto& [tCrTopK, tCrSoftmax, tCcCol, cCol,
               lane_layout_MN, lane_mn,
-              residue_cCol, residue_tCcCol] = args_tuple;
+              residue_cCol, residue_tCcCol,
+              thread_origin, ptr_indices, ptr_counts] = args_tuple;
       Tensor tCcCol_mn = tCcCol(_,_,_,epi_m,epi_n);
 
       using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
@@ -555,7 +609,12 @@ public:
         auto thread_crd = tCcCol_mn(epi_v * FragmentSize + i);
         if (elem_less(thread_crd, residue_tCcCol)) {
           TopKResult& tCrCol_vmn = tCrTopK(epi_v * FragmentSize + i);
-          detail::add_element_to_desc_sorted_array(tCrCol_vmn.top_k_, frg_I[i]);
+          if constexpr (EmitIndices) {
+            detail::add_element_to_desc_sorted_array(tCrCol_vmn.top_k_, pack_index(frg_I[i], get<1>(thread_origin) + get<1>(thread_crd)));
+          }
+          else {
+            detail::add_element_to_desc_sorted_array(tCrCol_vmn.top_k_, frg_I[i]);
+          }
         }
       }
 
@@ -568,7 +627,8 @@ public:
 
       auto& [tCrTopK, tCrSoftmax, tCcCol, cCol,
               lane_layout_MN, lane_mn,
-              residue_cCol, residue_tCcCol] = args_tuple;
+              residue_cCol, residue_tCcCol,
+              thread_origin, ptr_indices, ptr_counts] = args_tuple;
 
       // fully OOB CTA in partially OOB cluster
       if (not elem_less(cCol(_0{},_0{}), residue_cCol)) {
@@ -648,19 +708,67 @@ public:
         }
       }
 
+      //
+      // 3. Write out the Top-K indices and per-column counts of each row
+      //
+      if constexpr (EmitIndices) {
+        // The (unique) thread holding the first column of a row writes out its results
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(tCcCol_mn); ++i) {
+          auto thread_crd = tCcCol_mn(i);
+          if (get<1>(thread_origin) + get<1>(thread_crd) == 0 && elem_less(thread_crd, residue_tCcCol)) {
+            auto const& top_k = tCrTopK(i).top_k_;
+            CUTLASS_PRAGMA_UNROLL
+            for (int k = 0; k < TopK; ++k) {
+              int n = unpack_index(top_k[k]);
+              if (ptr_indices != nullptr) {
+                ptr_indices[int64_t(get<0>(thread_origin) + get<0>(thread_crd)) * TopK + k] = n;
+              }
+              if (ptr_counts != nullptr) {
+                atomicAdd(ptr_counts + n, 1);
+              }
+            }
+          }
+        }
+      }
+
       //
       // 4. Re-visit and apply top-K and softmax
       //
+      //   Visited results may have already been converted to the output type (e.g. by the sm100
+      //   epilogue), in which case they are compared against the similarly rounded minimum of
+      //   the top-K, since rounding preserves ordering.
+      using ElementVisit = typename cute::remove_cvref_t<decltype(visit_results(0))>::Element;
+      using ConvertVisit = NumericConverter<ElementCompute, ElementVisit, RoundStyle>;
+      using ConvertResult = NumericConverter<ElementVisit, ElementCompute, RoundStyle>;
+      ConvertVisit convert_visit{};
+      ConvertResult convert_result{};
+
       CUTLASS_PRAGMA_UNROLL
       for (int epi_v = 0; epi_v < size(visit_results); ++epi_v) {
         auto& visit_frag = visit_results(epi_v);
         CUTLASS_PRAGMA_UNROLL
         for (int i = 0; i < FragmentSize; ++i) {
-          visit_frag[i] = detail::masked_softmax(
-            visit_frag[i],
-            tCrSoftmax(epi_v * FragmentSize + i).min_,
-            tCrSoftmax(epi_v * FragmentSize + i).logsumexp_
-          );
+          ReductionResult const& result = tCrSoftmax(epi_v * FragmentSize + i);
+          if constexpr (EmitIndices) {
+            // Select the softmax of the packed top-K value whose index matches this column
+            auto const& top_k = tCrTopK(epi_v * FragmentSize + i).top_k_;
+            int n = get<1>(thread_origin) + get<1>(tCcCol_mn(epi_v * FragmentSize + i));
+            ElementCompute value = ElementCompute(0);
+            CUTLASS_PRAGMA_UNROLL
+            for (int k = 0; k < TopK; ++k) {
+              value = unpack_index(top_k[k]) == n ? fast_exp(top_k[k] - result.logsumexp_) : value;
+            }
+            visit_frag[i] = convert_result(value);
+          }
+          else if constexpr (is_same_v<ElementVisit, ElementCompute>) {
+            visit_frag[i] = detail::masked_softmax(visit_frag[i], result.min_, result.logsumexp_);
+          }
+          else {
+            ElementCompute minimum = convert_visit(convert_result(result.min_));
+            visit_frag[i] = convert_result(
+              detail::masked_softmax(convert_visit(visit_frag[i]), minimum, result.logsumexp_));
+          }
         }
       }
 
@@ -670,7 +778,8 @@ public:
     end_loop(int epi_m, int epi_n) {
       auto& [tCrTopK, tCrSoftmax, tCcCol, cCol,
               lane_layout_MN, lane_mn,
-              residue_cCol, residue_tCcCol] = args_tuple;
+              residue_cCol, residue_tCcCol,
+              thread_origin, ptr_indices, ptr_counts] = args_tuple;
 
       // Reset reduced top-K values for next tile
       // This must be done because we only assume a single epilogue tile across N,
@@ -748,10 +857,29 @@ public:
     Tensor tCrSoftmax = make_tensor<ReductionResult>(tCrSoftmax_layout);                           // (R2S,R2S_M,R2S_N)
     fill(tCrTopK, TopKResult());
 
+    // Top-K index and count outputs of this batch, and the global (m,n) coordinate of the
+    // thread's first element, since thread coordinate tensors are relative to it
+    int32_t* ptr_indices = nullptr;
+    int32_t* ptr_counts = nullptr;
+    auto thread_origin = make_coord(0, 0);
+    if constexpr (EmitIndices) {
+      auto [problem_m, problem_n, problem_k, problem_l] = args.problem_shape_mnkl;
+      int l_coord = get<3>(args.tile_coord_mnkl);
+      thread_origin = make_coord(int(problem_m) - int(get<0>(args.residue_tCcD)),
+                                 int(problem_n) - int(get<1>(args.residue_tCcD)));
+      if (params.ptr_topk_indices != nullptr) {
+        ptr_indices = params.ptr_topk_indices + int64_t(l_coord) * problem_m * TopK;
+      }
+      if (params.ptr_expert_counts != nullptr) {
+        ptr_counts = params.ptr_expert_counts + int64_t(l_coord) * problem_n;
+      }
+    }
+
     auto args_tuple = make_tuple(
         cute::move(tCrTopK), cute::move(tCrSoftmax), args.tCcD, args.cD,
         lane_layout_MN, lane_mn,
-        args.residue_cD, args.residue_tCcD);
+        args.residue_cD, args.residue_tCcD,
+        thread_origin, ptr_indices, ptr_counts);
     return ConsumerStoreCallbacks<decltype(args_tuple)>(std::move(args_tuple), params);
   }
 };
@@ -0,0 +1,140 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+
+/*! \file
+  \brief Visitor tree triangular masking operation for the sm90 TMA warp-specialized epilogue
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/blas3_types.h"
+#include "cutlass/numeric_conversion.h"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::fusion {
+
+// Selects per element between two inputs by the position of the element relative to the diagonal
+// of the output:
+//
+//   Z(m, n) = X(m, n) if m >= n (FillMode::kLower) or m <= n (FillMode::kUpper)
+//   Z(m, n) = Y(m, n) otherwise
+//
+// Only CTA tiles crossing the diagonal compare coordinates, X is forwarded as is elsewhere.
+template<
+  FillMode FillMode_,
+  class ElementOutput,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+struct Sm90TriangularSelect : Sm90VisitorImpl<> {
+
+  static_assert(FillMode_ == FillMode::kLower || FillMode_ == FillMode::kUpper,
+    "Triangular select requires FillMode::kLower or FillMode::kUpper.");
+
+  using Sm90VisitorImpl<>::Sm90VisitorImpl;
+
+  template <class CtaCoordTensor>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(CtaCoordTensor&& tCcCta, int diagonal_offset, bool is_masked)
+      : tCcCta(cute::forward<CtaCoordTensor>(tCcCta)),
+        diagonal_offset(diagonal_offset),
+        is_masked(is_masked) {}
+
+    CtaCoordTensor tCcCta;                                                      // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    int diagonal_offset; // Column minus row index of the first element of the CTA tile
+    bool is_masked;
+
+    template <typename ElementAccumulator, typename ElementInput, typename ElementSource, int FragmentSize>
+    CUTLASS_DEVICE Array<ElementOutput, FragmentSize>
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input, Array<ElementSource, FragmentSize> const& frg_source) {
+
+      NumericArrayConverter<ElementOutput, ElementInput, FragmentSize, RoundStyle> convert_input{};
+      Array<ElementOutput, FragmentSize> frg_output = convert_input(frg_input);
+
+      if (is_masked) {
+        NumericArrayConverter<ElementOutput, ElementSource, FragmentSize, RoundStyle> convert_source{};
+        Array<ElementOutput, FragmentSize> frg_C = convert_source(frg_source);
+
+        Tensor tCcCta_mn = tCcCta(_,_,_,epi_m,epi_n);
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < FragmentSize; ++i) {
+          auto [m, n] = tCcCta_mn(epi_v * FragmentSize + i);
+          bool is_inside = FillMode_ == FillMode::kLower ? (int(m) - int(n) >= diagonal_offset)
+                                                         : (int(m) - int(n) <= diagonal_offset);
+          if (not is_inside) {
+            frg_output[i] = frg_C[i];
+          }
+        }
+      }
+
+      return frg_output;
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    auto [M, N, K] = args.tile_shape_mnk;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+
+    // Coordinates relative to the CTA tile
+    ThrCopy thread_r2s = args.tiled_copy.get_slice(args.thread_idx);
+    Tensor cCta = flat_divide(make_identity_tensor(make_shape(M, N)), args.epi_tile);           // (EPI_M,EPI_N,...)
+    Tensor tCcCta = [&] () {
+      if constexpr (ReferenceSrc) { return thread_r2s.partition_S(cCta); }
+      else                        { return thread_r2s.partition_D(cCta); }
+    }();                                                                       // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+
+    // Element (i, j) of the tile lies on the diagonal of the output if i - j == diagonal_offset
+    int diagonal_offset = int(n) * int(N) - int(m) * int(M);
+    bool is_masked = FillMode_ == FillMode::kLower ? (diagonal_offset > 1 - int(N))
+                                                   : (diagonal_offset < int(M) - 1);
+
+    return ConsumerStoreCallbacks<decltype(tCcCta)>(cute::move(tCcCta), diagonal_offset, is_masked);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
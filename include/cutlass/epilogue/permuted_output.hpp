@@ -0,0 +1,137 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Hierarchical problem shapes and D strides of GEMMs whose output is stored permuted.
+
+  A projection X[B*S,K] * W[G*H*Dh,K]^T normally produces the row-major [B,S,G,H,Dh] activation,
+  which attention then reshapes to [G,B,H,S,Dh]. Splitting M into (S,B) and N into (Dh,H,G) lets
+  the TMA epilogue store D directly in head-major order: every sub-mode of D gets its own stride,
+  the CTA tile N mode is split into (Dh, heads per tile), and the epilogue builders size the TMA
+  box to the contiguous head dimension so the stores stay coalesced.
+*/
+
+#pragma once
+
+#include "cute/layout.hpp"
+#include "cutlass/cutlass.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Problem shape, strides and CTA tile of a projection GEMM storing D as G head-major
+/// tensors [B,H,S,HeadDim], e.g. the fused QKV projection of an attention layer with Groups = 3.
+///
+/// The problem shape is ((S,B), (HeadDim,H,G), K, 1). A is the row-major activation [B*S,K] and
+/// B the K-major weight [G*H*HeadDim,K], both addressed through the same hierarchical modes.
+/// C, when present, is read with the permuted layout of D.
+template <
+  int HeadDim,
+  int Groups = 1
+>
+struct HeadMajorOutput {
+  static_assert(HeadDim > 0 && Groups > 0, "HeadDim and Groups must be positive.");
+
+  using ShapeM = cute::Shape<int, int>;                                       // (S,B)
+  using ShapeN = cute::Shape<cute::Int<HeadDim>, int, cute::Int<Groups>>;     // (HeadDim,H,G)
+  using ProblemShape = cute::Shape<ShapeM, ShapeN, int, int>;
+
+  using StrideA = cute::Stride<cute::Stride<int64_t, int64_t>, cute::_1, int64_t>;
+  using StrideB = cute::Stride<cute::Stride<int64_t, int64_t, int64_t>, cute::_1, int64_t>;
+  using StrideD = cute::Stride<cute::Stride<int64_t, int64_t>, cute::Stride<cute::_1, int64_t, int64_t>, int64_t>;
+  using StrideC = StrideD;
+
+  /// CTA tile of TileM rows of S by TileN columns of (HeadDim, heads per tile).
+  /// Tiles narrower than a head stay within the head dimension.
+  template <int TileM, int TileN, int TileK>
+  using TileShape = cute::Shape<
+    cute::Shape<cute::Int<TileM>>,
+    cute::conditional_t<(TileN <= HeadDim),
+      cute::Shape<cute::Int<TileN>>,
+      cute::Shape<cute::Int<HeadDim>, cute::Int<TileN / HeadDim>>>,
+    cute::Int<TileK>>;
+
+  int batch{1};
+  int seq_len{1};
+  int heads{1};
+
+  /// Problem shape of a projection with reduction extent k
+  ProblemShape problem_shape(int k) const {
+    return ProblemShape{ShapeM{seq_len, batch}, ShapeN{cute::Int<HeadDim>{}, heads, cute::Int<Groups>{}}, k, 1};
+  }
+
+  /// Row-major activations [B*S,K]
+  StrideA stride_A(int k) const {
+    int64_t ld = k;
+    return StrideA{{ld, ld * seq_len}, {}, ld * seq_len * batch};
+  }
+
+  /// K-major weights [G*H*HeadDim,K]
+  StrideB stride_B(int k) const {
+    int64_t ld = k;
+    return StrideB{{ld, ld * HeadDim, ld * HeadDim * heads}, {}, ld * HeadDim * heads * Groups};
+  }
+
+  /// Head-major output [G,B,H,S,HeadDim]
+  StrideD stride_D() const {
+    int64_t head_stride = int64_t(seq_len) * HeadDim;
+    int64_t group_stride = head_stride * heads * batch;
+    return StrideD{{int64_t(HeadDim), head_stride * heads}, {{}, head_stride, group_stride}, group_stride * Groups};
+  }
+
+  StrideC stride_C() const {
+    return stride_D();
+  }
+
+  /// Whether CTA tiles of TileM x TileN stay within one (sequence, batch) and whole heads.
+  /// Tiles must not straddle the sub-modes of M and N, so S must be a multiple of TileM and
+  /// the tile must cover a divisor of the head dimension or a whole number of heads.
+  template <int TileM, int TileN>
+  bool can_implement() const {
+    if (batch <= 0 || seq_len <= 0 || heads <= 0 || seq_len % TileM != 0) {
+      return false;
+    }
+    if constexpr (TileN <= HeadDim) {
+      return HeadDim % TileN == 0;
+    }
+    else {
+      return TileN % HeadDim == 0 && heads % (TileN / HeadDim) == 0;
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
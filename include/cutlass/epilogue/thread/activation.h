@@ -774,6 +774,38 @@ struct dGELU<Array<T, N> > {
   }
 };
 
+/// Computes backwards pass for SiLU operator assuming d_t is the layer gradient and
+/// z is the pre-activation saved by the forward pass.
+template <typename T>
+struct dSiLU {
+  static const bool kIsHeavy = true;
+
+  CUTLASS_HOST_DEVICE
+  T operator()(T const &d_t, T const &z) const {
+    Sigmoid<T> sigmoid;
+    T sig = sigmoid(z);
+    return d_t * sig * (T(1) + z * (T(1) - sig));
+  }
+};
+
+template <typename T, int N>
+struct dSiLU<Array<T, N> > {
+  static const bool kIsHeavy = true;
+
+  CUTLASS_HOST_DEVICE
+  Array<T, N> operator()(Array<T, N> const &d_t, Array<T, N> const &z) const {
+    Array<T, N> y;
+    dSiLU<T> silu_op;
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < N; ++i) {
+      y[i] = silu_op(d_t[i], z[i]);
+    }
+
+    return y;
+  }
+};
+
 template <typename T>
 struct dReLU {
   CUTLASS_HOST_DEVICE
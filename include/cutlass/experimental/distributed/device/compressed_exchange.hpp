@@ -0,0 +1,108 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Device layer interface for Distributed GEMM compressed partial result exchange.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/experimental/distributed/kernel/compressed_exchange.hpp"
+
+namespace cutlass::distributed::device {
+
+namespace detail {
+
+// Number of CTAs for quantizing/dequantizing num_elements; launches at most 8 CTAs per SM, which
+// then (grid-)stride over the remaining blocks.
+template <int NumThreads, int BlockSize>
+int get_compression_grid_size(size_t num_elements, int sm_count) {
+  size_t num_warps = ceil_div(num_elements, static_cast<size_t>(BlockSize));
+  size_t num_ctas = ceil_div(num_warps, static_cast<size_t>(NumThreads / NumThreadsPerWarp));
+  return static_cast<int>(cutlass::platform::max(
+        static_cast<size_t>(1), cutlass::platform::min(num_ctas, static_cast<size_t>(sm_count) * 8)));
+}
+
+} // namespace detail
+
+template <int BlockSize, typename ElementCompressed, typename ElementPartial>
+cudaError_t launch_quantize_partial(
+    ElementPartial const* partial_ptr,
+    ElementCompressed* compressed_ptr,
+    float* scale_ptr,
+    size_t num_elements,
+    int sm_count,
+    cudaStream_t stream) {
+
+  static constexpr int NumThreads = 256;
+  int num_ctas = detail::get_compression_grid_size<NumThreads, BlockSize>(num_elements, sm_count);
+
+  cutlass::distributed::kernel::quantize_partial_kernel<NumThreads, BlockSize, ElementCompressed, ElementPartial>
+    <<<num_ctas, NumThreads, 0, stream>>>(
+      partial_ptr,
+      compressed_ptr,
+      scale_ptr,
+      num_elements);
+
+  return cudaGetLastError();
+}
+
+template <int BlockSize, typename Transport, typename ElementCompressed, typename ElementPartial, typename FlagType>
+cudaError_t launch_exchange_compressed_partial(
+    ElementCompressed const* remote_compressed_ptr,
+    float const* remote_scale_ptr,
+    ElementPartial* partial_ptr,
+    size_t num_elements,
+    FlagType* self_flag_ptr,
+    FlagType* peer_flag_ptr,
+    int flag_peer_idx,
+    int sm_count,
+    cudaStream_t stream) {
+
+  static constexpr int NumThreads = 256;
+  int num_ctas = detail::get_compression_grid_size<NumThreads, BlockSize>(num_elements, sm_count);
+
+  cutlass::distributed::kernel::exchange_compressed_partial_kernel<
+    NumThreads, BlockSize, Transport, ElementCompressed, ElementPartial, FlagType>
+    <<<num_ctas, NumThreads, 0, stream>>>(
+      remote_compressed_ptr,
+      remote_scale_ptr,
+      partial_ptr,
+      num_elements,
+      self_flag_ptr,
+      peer_flag_ptr,
+      flag_peer_idx);
+
+  return cudaGetLastError();
+}
+
+} // namespace cutlass::distributed::device
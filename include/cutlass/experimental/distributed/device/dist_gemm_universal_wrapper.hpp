@@ -33,6 +33,19 @@
 
   Sets up local GEMM stages, the cuda graph, manages buffer and barrier spaces,
   and maps arguments to per-stage arguments.
+
+  Rotating operands are copied with copy engines (cudaMemcpyAsync) by default. Alternatively,
+  a number of SMs can be set aside for an SM-driven copy kernel (`copy_sm_count` in
+  `get_workspace_size` and `initialize`), in which case the local GEMMs run on the remaining SMs.
+  This requires persistent GEMM kernels (which respect `hw_info.sm_count`), so that the copy
+  kernel is never starved by GEMM CTAs waiting on its arrival flags, and a transport with direct
+  peer access.
+
+  Reduce Scatter schedules can optionally exchange partial results in a narrower type
+  (`ElementCompressed_`, i.e. FP8 or BF16). Each stage's partial is then quantized in blocks of
+  `CompressionBlockSize` elements with per-block FP32 scales, pulled by the peer and dequantized
+  into its local buffer, and the next stage's epilogue accumulates into it in FP32
+  (see kernel/compressed_exchange.hpp).
 */
 
 #pragma once
@@ -43,13 +56,15 @@
 #include "cutlass/gemm/device/gemm_universal_adapter.h"
 
 #include "cutlass/experimental/distributed/device/full_barrier.hpp"
+#include "cutlass/experimental/distributed/device/sm_copy.hpp"
+#include "cutlass/experimental/distributed/device/compressed_exchange.hpp"
 #include "cutlass/experimental/distributed/device/detail.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace cutlass::distributed::device {
 
-template <class GemmKernel_>
+template <class GemmKernel_, class ElementCompressed_ = void>
 class DistributedGemmUniversalAdapter {
 public:
   using DeviceGemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel_>;
@@ -110,12 +125,23 @@ public:
 
   // Distributed GEMM types and defs
   using DistSchedule = typename GemmKernel::DistSchedule;
+  using Transport = typename GemmKernel::Transport;
   static constexpr bool HasMemcpy = DistSchedule::HasMemcpy;
   using TP = typename DistSchedule::TP;
   static constexpr int TP_ = TP{};
   using ElementFlag = typename GemmKernel::ElementFlag;
   using ElementBarrier = uint32_t;
 
+  // Compressed partial results (Reduce Scatter schedules only)
+  using ElementCompressed = ElementCompressed_;
+  static constexpr bool CompressedReduceScatter = not cute::is_void_v<ElementCompressed>;
+  static constexpr int CompressionBlockSize = 128;
+
+  static_assert(not CompressedReduceScatter || (DistSchedule::RemoteC && not HasMemcpy),
+      "Compressed partial results are only supported by Reduce Scatter schedules.");
+  static_assert(not CompressedReduceScatter || Transport::SupportsDirectPeerAccess,
+      "Compressed partial results require a transport with direct peer access.");
+
   using BufferHelper = detail::DistGemmBufferHelper<
     DistSchedule,
     ElementA,
@@ -145,9 +171,25 @@ public:
     void * memcpy_source_ptr_array[TP_];
     void const * memcpy_remote_ptr_array[TP_];
     size_t memcpy_bytes[TP_];
+    int memcpy_peer_idx[TP_];
 
     cutlass::Array<ElementBarrier*, TP_> device_barrier_ptrs;
 
+    // SM-driven copies (0: copy engines)
+    int copy_sm_count = 0;
+    ElementBarrier* copy_counter_ptr = nullptr;
+
+    // Compressed partial results: the previous stage's partial, its compressed copy and scales,
+    // the peer's compressed partial and scales, and the local buffer it's dequantized into.
+    ElementD const* partial_ptr_array[TP_];
+    ElementCompressed* compressed_ptr_array[TP_];
+    float* scale_ptr_array[TP_];
+    ElementCompressed const* remote_compressed_ptr_array[TP_];
+    float const* remote_scale_ptr_array[TP_];
+    ElementC* reduced_ptr_array[TP_];
+    size_t compressed_elements = 0;
+    int compression_sm_count = 0;
+
     bool is_initialized = false;
   };
 
@@ -191,12 +233,53 @@ public:
   get_buffer_space_size(Arguments const& args) {
     size_t buffer_bytes = 0;
 
-    buffer_bytes = BufferHelper::get_buffer_size(args.problem_shape);
-    buffer_bytes = round_nearest(buffer_bytes, MinWorkspaceAlignment);
+    buffer_bytes = get_compressed_buffer_offset(args);
+    buffer_bytes += get_compressed_buffer_size(args);
 
     return buffer_bytes;
   }
 
+  // Compressed buffers follow operand buffers:
+  //   |  data iter 1  |  scales iter 1  | ... |  data iter TP - 1  |  scales iter TP - 1  |
+  static size_t
+  get_compressed_buffer_offset(Arguments const& args) {
+    return round_nearest(BufferHelper::get_buffer_size(args.problem_shape), MinWorkspaceAlignment);
+  }
+
+  static size_t
+  get_compressed_elements(Arguments const& args) {
+    return size(DistSchedule::get_local_d_shape(args.problem_shape));
+  }
+
+  static size_t
+  get_compressed_slot_size(Arguments const& args) {
+    if constexpr (CompressedReduceScatter) {
+      size_t num_elements = get_compressed_elements(args);
+      return round_nearest(num_elements * sizeof(ElementCompressed), MinWorkspaceAlignment) +
+        round_nearest(ceil_div(num_elements, size_t(CompressionBlockSize)) * sizeof(float), MinWorkspaceAlignment);
+    } else {
+      return 0;
+    }
+  }
+
+  static size_t
+  get_compressed_buffer_size(Arguments const& args) {
+    return get_compressed_slot_size(args) * BufferHelper::NumBuffersD;
+  }
+
+  // Compressed partial result of a stage/iteration < TP - 1
+  static auto
+  get_compressed_ptrs_for_iter(Arguments const* args_array, void** buffer_space, int device_idx, int iteration) {
+    auto const& args = args_array[device_idx];
+    uint8_t* slot_ptr = reinterpret_cast<uint8_t*>(buffer_space[device_idx]) +
+      get_compressed_buffer_offset(args) + get_compressed_slot_size(args) * iteration;
+
+    auto data_bytes = round_nearest(get_compressed_elements(args) * sizeof(ElementCompressed), MinWorkspaceAlignment);
+    return cute::make_tuple(
+        reinterpret_cast<ElementCompressed*>(slot_ptr),
+        reinterpret_cast<float*>(slot_ptr + data_bytes));
+  }
+
   static auto
   get_tensor_A_for_iter(Arguments const* args_array, void** buffer_space, int device_idx, int iteration) {
     auto args = args_array[device_idx];
@@ -223,6 +306,32 @@ public:
     return DistSchedule::get_tensor_B(tensor_B, tensor_buffer, device_idx, iteration);
   }
 
+  static auto
+  get_rotating_tensor_A_for_iter(Arguments const* args_array, void** buffer_space, int device_idx, int iteration) {
+    auto args = args_array[device_idx];
+    auto tensor_A = make_tensor(args.mainloop.ptr_A, make_layout(
+          DistSchedule::get_local_a_shape(args.problem_shape),
+          args.mainloop.dA));
+
+    uint8_t* tensor_buffer = reinterpret_cast<uint8_t*>(buffer_space[device_idx]) +
+      BufferHelper::get_buffer_offset_A(args.problem_shape);
+
+    return DistSchedule::get_rotating_tensor_A(tensor_A, tensor_buffer, device_idx, iteration);
+  }
+
+  static auto
+  get_rotating_tensor_B_for_iter(Arguments const* args_array, void** buffer_space, int device_idx, int iteration) {
+    auto args = args_array[device_idx];
+    auto tensor_B = make_tensor(args.mainloop.ptr_B, make_layout(
+          DistSchedule::get_local_b_shape(args.problem_shape),
+          args.mainloop.dB));
+
+    uint8_t* tensor_buffer = reinterpret_cast<uint8_t*>(buffer_space[device_idx]) +
+      BufferHelper::get_buffer_offset_B(args.problem_shape);
+
+    return DistSchedule::get_rotating_tensor_B(tensor_B, tensor_buffer, device_idx, iteration);
+  }
+
   static auto
   get_tensor_C_for_iter(Arguments const* args_array, void** buffer_space, int device_idx, int iteration) {
     auto args = args_array[device_idx];
@@ -230,8 +339,10 @@ public:
           DistSchedule::get_local_c_shape(args.problem_shape),
           args.epilogue.dC));
 
-    auto peer_idx_iter = DistSchedule::get_remote_peer_id(device_idx, iteration);
-    void* buffer_ptr = DistSchedule::RemoteC ? buffer_space[peer_idx_iter] : buffer_space[device_idx];
+    // Compressed partials are dequantized into the local buffer instead of accessed remotely
+    auto peer_idx_iter = DistSchedule::get_remote_c_peer_id(device_idx, iteration);
+    void* buffer_ptr = (DistSchedule::RemoteC && not CompressedReduceScatter) ?
+      buffer_space[peer_idx_iter] : buffer_space[device_idx];
 
     uint8_t* tensor_buffer = reinterpret_cast<uint8_t*>(buffer_ptr) +
       BufferHelper::get_buffer_offset_C(args.problem_shape);
@@ -253,8 +364,22 @@ public:
     return DistSchedule::get_tensor_D(tensor_D, tensor_buffer, device_idx, iteration);
   }
 
+  /// Number of SMs left for local GEMMs when copy_sm_count SMs drive the memcpies.
+  static int
+  get_gemm_sm_count(Arguments const& args, int copy_sm_count) {
+    int sm_count = args.hw_info.sm_count;
+    if (sm_count <= 0) {
+      sm_count = KernelHardwareInfo::query_device_multiprocessor_count(args.hw_info.device_id);
+    }
+    if constexpr (HasMemcpy) {
+      sm_count -= copy_sm_count;
+    }
+    return sm_count;
+  }
+
   static
-  auto make_dummy_base_args(Arguments const* args, int device_idx, int iteration, void ** buffer_space) {
+  auto make_dummy_base_args(Arguments const* args, int device_idx, int iteration, void ** buffer_space,
+      int copy_sm_count = 0) {
 
     // Set up GEMM arguments for the current stage/iteration
     auto tensor_a_iter = get_tensor_A_for_iter(args, buffer_space, device_idx, iteration);
@@ -279,19 +404,18 @@ public:
     };
 
     if constexpr (DistSchedule::RemoteC) {
-      if (iteration > 0) {
-        base_args.epilogue.thread.beta = 1.0;
-      }
-      else if (iteration == 0){
-        base_args.epilogue.thread.beta = 0.0;
-      }
+      base_args.epilogue.thread.beta = DistSchedule::has_remote_c(iteration) ? 1.0 : 0.0;
+    }
+
+    if (HasMemcpy && copy_sm_count > 0) {
+      base_args.hw_info.sm_count = get_gemm_sm_count(base_args, copy_sm_count);
     }
 
     return base_args;
   }
 
   static size_t
-  get_workspace_size(Arguments const* args, int device_idx) {
+  get_workspace_size(Arguments const* args, int device_idx, int copy_sm_count = 0) {
     size_t workspace_bytes = 0;
 
     workspace_bytes = get_buffer_space_size(args[device_idx]);
@@ -301,7 +425,7 @@ public:
     for (int iteration = 0; iteration < TP_; ++iteration) {
       // Workspace sizes can vary if arguments change, therefore we must
       // construct args for each iteration exactly as it will be run.
-      auto args_base = make_dummy_base_args(args, device_idx, iteration, dummy_buffer_space);
+      auto args_base = make_dummy_base_args(args, device_idx, iteration, dummy_buffer_space, copy_sm_count);
 
       // NOTE: assumes underlying kernels align up to alignment requirements on their own,
       // and that the alignment requirements of the individual kernels match.
@@ -329,9 +453,22 @@ public:
         (sizeof(ElementFlag) * iteration));
   }
 
+  static size_t
+  get_copy_counter_bytes() {
+    return round_nearest(sizeof(ElementBarrier) * TP_, 32);
+  }
+
+  static void *
+  exclusive_workspace_ptr_to_copy_counter_ptr(void * exclusive_workspace_ptr) {
+    return static_cast<void*>(
+        static_cast<uint8_t*>(exclusive_workspace_ptr) +
+        get_barrier_bytes() +
+        get_flag_bytes());
+  }
+
   static size_t
   get_exclusive_workspace_size() {
-    return get_barrier_bytes() + get_flag_bytes();
+    return get_barrier_bytes() + get_flag_bytes() + get_copy_counter_bytes();
   }
 
   /// Initializes GEMM state from arguments.
@@ -342,11 +479,26 @@ public:
     void** exclusive_workspace_ptrs,
     int device_idx,
     cudaStream_t stream = nullptr,
-    bool launch_with_pdl = false) {
+    bool launch_with_pdl = false,
+    int copy_sm_count = 0) {
 
     CUTLASS_TRACE_HOST("DistributedGemm::initialize() - stream: " << (stream ? "non-null" : "null"));
 
+    if (HasMemcpy && copy_sm_count > 0) {
+      if (not Transport::SupportsDirectPeerAccess) {
+        CUTLASS_TRACE_HOST("  SM-driven copies require a transport with direct peer access.");
+        return Status::kInvalid;
+      }
+      if (get_gemm_sm_count(args[device_idx], copy_sm_count) <= 0) {
+        CUTLASS_TRACE_HOST("  copy_sm_count (" << copy_sm_count << ") leaves no SMs for local GEMMs.");
+        return Status::kInvalid;
+      }
+    }
+
     state_.device_idx = device_idx;
+    state_.copy_sm_count = HasMemcpy ? copy_sm_count : 0;
+    state_.copy_counter_ptr = reinterpret_cast<ElementBarrier*>(
+        exclusive_workspace_ptr_to_copy_counter_ptr(exclusive_workspace_ptrs[device_idx]));
 
     for (int device = 0; device < TP_; ++device) {
       state_.device_barrier_ptrs[device] = reinterpret_cast<ElementBarrier*>(exclusive_workspace_ptrs[device]);
@@ -388,16 +540,15 @@ public:
       };
 
       if constexpr (DistSchedule::RemoteC) {
-        if (iteration > 0) {
-          base_args.epilogue.thread.beta = 1.0;
-        }
-        else if (iteration == 0){
-          base_args.epilogue.thread.beta = 0.0;
-        }
+        base_args.epilogue.thread.beta = DistSchedule::has_remote_c(iteration) ? 1.0 : 0.0;
+      }
+
+      if (state_.copy_sm_count > 0) {
+        base_args.hw_info.sm_count = get_gemm_sm_count(base_args, state_.copy_sm_count);
       }
 
       auto [left_peer_idx, right_peer_idx] = DistSchedule::get_peers_for_device(device_idx);
-      auto flag_peer_idx = DistSchedule::KernelWritesArrivalFlag ? right_peer_idx : device_idx;
+      auto flag_peer_idx = DistSchedule::kernel_writes_arrival_flag(iteration) ? right_peer_idx : device_idx;
 
       void * self_flag_ptr = exclusive_workspace_ptr_to_flag_ptr(exclusive_workspace_ptrs[device_idx], iteration);
       void * peer_flag_ptr = exclusive_workspace_ptr_to_flag_ptr(exclusive_workspace_ptrs[flag_peer_idx], iteration);
@@ -406,7 +557,8 @@ public:
         device_idx,
         iteration,
         self_flag_ptr,
-        peer_flag_ptr
+        peer_flag_ptr,
+        flag_peer_idx
       };
       PackedArguments args_iter = {base_args, distributed_args};
 
@@ -419,8 +571,31 @@ public:
       // Initialize the Params structure
       state_.params_array[iteration] = GemmKernel::to_underlying_arguments(args_iter, workspace_iter);
 
+      // Set up compressed partial result ptrs; the previous stage's partial is compressed, and the
+      // peer's compressed partial is dequantized into the same (local) buffer.
+      if constexpr (CompressedReduceScatter) {
+        if (DistSchedule::has_remote_c(iteration)) {
+          auto peer_idx_iter = DistSchedule::get_remote_c_peer_id(device_idx, iteration);
+          auto tensor_partial = get_tensor_D_for_iter(args, buffer_space, device_idx, iteration - 1);
+          auto [compressed_ptr, scale_ptr] = get_compressed_ptrs_for_iter(args, buffer_space, device_idx, iteration - 1);
+          auto [remote_compressed_ptr, remote_scale_ptr] = get_compressed_ptrs_for_iter(args, buffer_space, peer_idx_iter, iteration - 1);
+
+          assert(cute::cosize(tensor_partial.layout()) == get_compressed_elements(args[device_idx]));
+
+          state_.partial_ptr_array[iteration] = reinterpret_cast<ElementD const*>(tensor_partial.data());
+          state_.compressed_ptr_array[iteration] = compressed_ptr;
+          state_.scale_ptr_array[iteration] = scale_ptr;
+          state_.remote_compressed_ptr_array[iteration] = remote_compressed_ptr;
+          state_.remote_scale_ptr_array[iteration] = remote_scale_ptr;
+          state_.reduced_ptr_array[iteration] = reinterpret_cast<ElementC*>(tensor_c_iter.data());
+        }
+        state_.compressed_elements = get_compressed_elements(args[device_idx]);
+        state_.compression_sm_count = get_gemm_sm_count(args[device_idx], 0);
+      }
+
       // Set up peer buffer ptrs
-      if (iteration > 0 && HasMemcpy) {
+      state_.memcpy_bytes[iteration] = 0;
+      if (DistSchedule::has_memcpy(iteration)) {
         auto peer_idx_iter = DistSchedule::get_remote_peer_id(device_idx, iteration);
 
         void * local_ptr_itr = nullptr;
@@ -432,20 +607,22 @@ public:
               DistSchedule::MemcpyA || DistSchedule::MemcpyB),
             "Expected to either memcpy A or B when scheduler requires memcpy.");
         if constexpr (DistSchedule::MemcpyA) {
-          local_size = cute::cosize(tensor_a_iter.layout()) * sizeof(ElementA);
-          local_ptr_itr = reinterpret_cast<void*>(tensor_a_iter.data());
+          auto local_tensor_iter = get_rotating_tensor_A_for_iter(args, buffer_space, device_idx, iteration);
+          local_size = cute::cosize(local_tensor_iter.layout()) * sizeof(ElementA);
+          local_ptr_itr = reinterpret_cast<void*>(local_tensor_iter.data());
 
           // Copy peer's slice in the first iteration (direct access memcpy instead of logical ring)
-          auto remote_tensor_iter = get_tensor_A_for_iter(args, buffer_space, peer_idx_iter, 0);
+          auto remote_tensor_iter = get_rotating_tensor_A_for_iter(args, buffer_space, peer_idx_iter, 0);
           remote_ptr_itr = reinterpret_cast<void const*>(remote_tensor_iter.data());
           remote_size = cute::cosize(remote_tensor_iter.layout()) * sizeof(ElementA);
         }
         else if constexpr (DistSchedule::MemcpyB) {
-          local_size = cute::cosize(tensor_b_iter.layout()) * sizeof(ElementB);
-          local_ptr_itr = reinterpret_cast<void*>(tensor_b_iter.data());
+          auto local_tensor_iter = get_rotating_tensor_B_for_iter(args, buffer_space, device_idx, iteration);
+          local_size = cute::cosize(local_tensor_iter.layout()) * sizeof(ElementB);
+          local_ptr_itr = reinterpret_cast<void*>(local_tensor_iter.data());
 
           // Copy peer's slice in the first iteration (direct access memcpy instead of logical ring)
-          auto remote_tensor_iter = get_tensor_B_for_iter(args, buffer_space, peer_idx_iter, 0);
+          auto remote_tensor_iter = get_rotating_tensor_B_for_iter(args, buffer_space, peer_idx_iter, 0);
           remote_ptr_itr = reinterpret_cast<void const*>(remote_tensor_iter.data());
           remote_size = cute::cosize(remote_tensor_iter.layout()) * sizeof(ElementB);
         }
@@ -455,6 +632,7 @@ public:
         state_.memcpy_source_ptr_array[iteration] = local_ptr_itr;
         state_.memcpy_remote_ptr_array[iteration] = remote_ptr_itr;
         state_.memcpy_bytes[iteration] = local_size;
+        state_.memcpy_peer_idx[iteration] = peer_idx_iter;
       }
     }
 
@@ -532,7 +710,7 @@ public:
       self_flag_ptrs[iteration] = state_.params_array[iteration].distributed.self_flag_ptr_;
     }
 
-    launch_full_barrier<TP_, ElementBarrier, TP_, ElementFlag>(
+    launch_full_barrier<TP_, ElementBarrier, TP_, ElementFlag, Transport>(
         state_.device_barrier_ptrs, self_flag_ptrs, state_.device_idx, stream, launch_with_pdl);
 
     status = detail::check_cuda_status(cudaStreamEndCapture(stream, &state_.graph));
@@ -572,20 +750,53 @@ public:
         return status;
       }
 
+      if (state_.copy_sm_count > 0) {
+        // SM-driven copies: a single kernel on copy_sm_count CTAs copies all stages in order, and
+        // raises each stage's arrival flag once all CTAs are done with it.
+        cutlass::Array<void*, TP_> dst_ptrs;
+        cutlass::Array<void const*, TP_> src_ptrs;
+        cutlass::Array<size_t, TP_> bytes;
+        cutlass::Array<ElementFlag*, TP_> flag_ptrs;
+        for (int iteration = 0; iteration < TP_; ++iteration) {
+          dst_ptrs[iteration] = state_.memcpy_source_ptr_array[iteration];
+          src_ptrs[iteration] = state_.memcpy_remote_ptr_array[iteration];
+          bytes[iteration] = DistSchedule::has_memcpy(iteration) ? state_.memcpy_bytes[iteration] : 0;
+          flag_ptrs[iteration] = state_.params_array[iteration].distributed.peer_flag_ptr_;
+        }
+
+        status = detail::check_cuda_status(launch_sm_copy<TP_>(
+              dst_ptrs,
+              src_ptrs,
+              bytes,
+              flag_ptrs,
+              state_.copy_counter_ptr,
+              state_.copy_sm_count,
+              stream));
+
+        if (status != Status::kSuccess) {
+          return status;
+        }
+      }
+
       // No copies for first iter; we assume the data is already there.
-      for (int iteration = 1; iteration < TP_; ++iteration) {
+      for (int iteration = 1; iteration < TP_ && state_.copy_sm_count == 0; ++iteration) {
+        if (not DistSchedule::has_memcpy(iteration)) {
+          continue;
+        }
 
-        status = detail::check_cuda_status(cudaMemcpyAsync(
+        status = detail::check_cuda_status(Transport::get_async(
               state_.memcpy_source_ptr_array[iteration],
               state_.memcpy_remote_ptr_array[iteration],
               state_.memcpy_bytes[iteration],
-              cudaMemcpyDeviceToDevice, stream));
+              state_.memcpy_peer_idx[iteration],
+              stream));
 
         if (status != Status::kSuccess) {
           return status;
         }
 
-        // Set flag to non zero
+        // Set flag to non zero. The flag is local for schedules with memcpies, and get_async
+        // completes before subsequent work in the stream.
         status = detail::check_cuda_status(cudaMemsetAsync(
               reinterpret_cast<void *>(state_.params_array[iteration].distributed.peer_flag_ptr_),
               0b11111111,
@@ -621,6 +832,40 @@ public:
     }
 
     for (int iteration = 0; iteration < TP_; ++iteration) {
+      // Compress the previous stage's partial, and exchange it with peers before the epilogue
+      // accumulates into it. Arrivals are signaled by the exchange kernel instead of the GEMM
+      // (the GEMM's signal is a no-op, since the flag is already set).
+      if constexpr (CompressedReduceScatter) {
+        if (DistSchedule::has_remote_c(iteration)) {
+          status = detail::check_cuda_status(launch_quantize_partial<CompressionBlockSize>(
+                state_.partial_ptr_array[iteration],
+                state_.compressed_ptr_array[iteration],
+                state_.scale_ptr_array[iteration],
+                state_.compressed_elements,
+                state_.compression_sm_count,
+                stream));
+
+          if (status != Status::kSuccess) {
+            return status;
+          }
+
+          status = detail::check_cuda_status(launch_exchange_compressed_partial<CompressionBlockSize, Transport>(
+                state_.remote_compressed_ptr_array[iteration],
+                state_.remote_scale_ptr_array[iteration],
+                state_.reduced_ptr_array[iteration],
+                state_.compressed_elements,
+                state_.params_array[iteration].distributed.self_flag_ptr_,
+                state_.params_array[iteration].distributed.peer_flag_ptr_,
+                state_.params_array[iteration].distributed.flag_peer_idx,
+                state_.compression_sm_count,
+                stream));
+
+          if (status != Status::kSuccess) {
+            return status;
+          }
+        }
+      }
+
       status = DeviceGemm::run(
             state_.params_array[iteration],
             stream,
@@ -0,0 +1,121 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Device layer interface for expert-parallel mixture of experts token dispatch and combine.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/experimental/distributed/kernel/ep_dispatch_combine.hpp"
+
+namespace cutlass::distributed::device {
+
+// Launches the dispatch on num_ctas CTAs, which should be the SMs left free by the grouped GEMM it
+// overlaps with. max_arrival_tiles and arrival_tile_m must match the arguments of the
+// ExpertArrivalGroupScheduler on every device.
+template <typename Element>
+cudaError_t launch_ep_dispatch(
+    Element const* tokens_ptr,
+    int64_t ld_tokens,
+    int hidden,
+    cutlass::distributed::kernel::ExpertRouting const& routing,
+    Element* const* peer_expert_ptrs,
+    int64_t ld_expert,
+    int32_t* const* peer_counter_ptrs,
+    int max_arrival_tiles,
+    int arrival_tile_m,
+    int num_ctas,
+    cudaStream_t stream) {
+
+  static constexpr int NumThreads = 256;
+
+  if (routing.num_local_experts <= 0 || arrival_tile_m <= 0 || num_ctas <= 0) {
+    return cudaErrorInvalidValue;
+  }
+
+  cutlass::distributed::kernel::ep_dispatch_kernel<NumThreads, Element>
+    <<<num_ctas, NumThreads, 0, stream>>>(
+      tokens_ptr,
+      ld_tokens,
+      hidden,
+      routing,
+      peer_expert_ptrs,
+      ld_expert,
+      peer_counter_ptrs,
+      max_arrival_tiles,
+      arrival_tile_m);
+
+  return cudaGetLastError();
+}
+
+// Launches the combine with one warp per token, and at most 8 CTAs per SM which then (grid-)stride
+// over the remaining tokens.
+template <typename ElementExpert, typename ElementOutput>
+cudaError_t launch_ep_combine(
+    ElementExpert const* const* peer_expert_ptrs,
+    int64_t ld_expert,
+    int hidden,
+    cutlass::distributed::kernel::ExpertRouting const& routing,
+    ElementOutput* output_ptr,
+    int64_t ld_output,
+    int sm_count,
+    cudaStream_t stream) {
+
+  static constexpr int NumThreads = 256;
+  static constexpr int ElementsPerAccess = 128 / cutlass::sizeof_bits<ElementExpert>::value;
+  static constexpr int OutputAlignment = ElementsPerAccess * cutlass::sizeof_bits<ElementOutput>::value / 8;
+
+  if (routing.num_local_experts <= 0 ||
+      hidden % ElementsPerAccess != 0 || ld_expert % ElementsPerAccess != 0 || ld_output % ElementsPerAccess != 0 ||
+      reinterpret_cast<uintptr_t>(output_ptr) % OutputAlignment != 0) {
+    return cudaErrorInvalidValue;
+  }
+  if (routing.num_tokens == 0) {
+    return cudaSuccess;
+  }
+
+  int num_ctas = cutlass::platform::min(ceil_div(routing.num_tokens, NumThreads / NumThreadsPerWarp), sm_count * 8);
+
+  cutlass::distributed::kernel::ep_combine_kernel<NumThreads, ElementExpert, ElementOutput>
+    <<<num_ctas, NumThreads, 0, stream>>>(
+      peer_expert_ptrs,
+      ld_expert,
+      hidden,
+      routing,
+      output_ptr,
+      ld_output);
+
+  return cudaGetLastError();
+}
+
+} // namespace cutlass::distributed::device
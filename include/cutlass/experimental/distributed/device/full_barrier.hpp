@@ -39,7 +39,8 @@
 
 namespace cutlass::distributed::device {
 
-template <int NP, typename IntType, int Iterations, typename FlagType>
+template <int NP, typename IntType, int Iterations, typename FlagType,
+          typename Transport = transports::PeerAccessTransport>
 void launch_full_barrier(
     cutlass::Array<IntType*, NP> device_arrival_ptrs,
     cutlass::Array<FlagType*, Iterations> iteration_flag_ptrs,
@@ -63,7 +64,7 @@ void launch_full_barrier(
 
   cudaLaunchKernelEx(
       &launch_config,
-      cutlass::distributed::kernel::full_barrier_kernel<NP, IntType, Iterations, FlagType>,
+      cutlass::distributed::kernel::full_barrier_kernel<NP, IntType, Iterations, FlagType, Transport>,
       device_arrival_ptrs,
       iteration_flag_ptrs,
       device_idx);
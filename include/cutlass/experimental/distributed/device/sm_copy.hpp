@@ -0,0 +1,65 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Device layer interface for Distributed GEMM SM-driven copy kernel.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/experimental/distributed/kernel/sm_copy.hpp"
+
+namespace cutlass::distributed::device {
+
+template <int Iterations, typename FlagType, typename CounterType>
+cudaError_t launch_sm_copy(
+    cutlass::Array<void*, Iterations> dst_ptrs,
+    cutlass::Array<void const*, Iterations> src_ptrs,
+    cutlass::Array<size_t, Iterations> bytes,
+    cutlass::Array<FlagType*, Iterations> iteration_flag_ptrs,
+    CounterType* counter_ptr,
+    int num_ctas,
+    cudaStream_t stream) {
+
+  static constexpr int NumThreads = 256;
+
+  cutlass::distributed::kernel::sm_copy_kernel<NumThreads, Iterations, FlagType, CounterType>
+    <<<num_ctas, NumThreads, 0, stream>>>(
+      dst_ptrs,
+      src_ptrs,
+      bytes,
+      iteration_flag_ptrs,
+      counter_ptr);
+
+  return cudaGetLastError();
+}
+
+} // namespace cutlass::distributed::device
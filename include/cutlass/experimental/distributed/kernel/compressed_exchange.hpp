@@ -0,0 +1,163 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Distributed GEMM compressed partial result exchange kernels.
+
+    Reduce Scatter schedules can optionally exchange partial results in a narrower type.
+    Partials are quantized in blocks of BlockSize contiguous elements, each with its own FP32
+    scale (block amax / max finite value of the compressed type), and each warp handles one block
+    at a time. The receiving device pulls the compressed partial and its scales from its peer and
+    dequantizes it into a local buffer, which the next stage's epilogue then accumulates into in
+    FP32.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/fast_math.h"
+
+#include "cutlass/experimental/distributed/kernel/detail.hpp"
+
+namespace cutlass::distributed::kernel {
+
+template <int NumThreads, int BlockSize, typename ElementCompressed, typename ElementPartial>
+__global__ void quantize_partial_kernel(
+    ElementPartial const* partial_ptr,
+    ElementCompressed* compressed_ptr,
+    float* scale_ptr,
+    size_t num_elements) {
+
+  static_assert(NumThreads % NumThreadsPerWarp == 0 && BlockSize % NumThreadsPerWarp == 0,
+      "Expected whole warps and block sizes that are multiples of the warp size.");
+  static constexpr int NumWarps = NumThreads / NumThreadsPerWarp;
+  static constexpr int ElementsPerThread = BlockSize / NumThreadsPerWarp;
+
+  NumericConverter<ElementCompressed, float> convert;
+  float const max_compressed = static_cast<float>(platform::numeric_limits<ElementCompressed>::max());
+
+  int lane_idx = threadIdx.x % NumThreadsPerWarp;
+  size_t num_blocks = ceil_div(num_elements, static_cast<size_t>(BlockSize));
+
+  for (size_t block_idx = static_cast<size_t>(blockIdx.x) * NumWarps + threadIdx.x / NumThreadsPerWarp;
+       block_idx < num_blocks;
+       block_idx += static_cast<size_t>(gridDim.x) * NumWarps) {
+
+    float values[ElementsPerThread];
+    float amax = 0.f;
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < ElementsPerThread; ++i) {
+      size_t idx = block_idx * BlockSize + i * NumThreadsPerWarp + lane_idx;
+      values[i] = idx < num_elements ? static_cast<float>(partial_ptr[idx]) : 0.f;
+      amax = fmaxf(amax, fabsf(values[i]));
+    }
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int mask = NumThreadsPerWarp / 2; mask > 0; mask /= 2) {
+      amax = fmaxf(amax, __shfl_xor_sync(0xffffffff, amax, mask));
+    }
+
+    float scale = amax > 0.f ? amax / max_compressed : 1.f;
+    float scale_inv = 1.f / scale;
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < ElementsPerThread; ++i) {
+      size_t idx = block_idx * BlockSize + i * NumThreadsPerWarp + lane_idx;
+      if (idx < num_elements) {
+        compressed_ptr[idx] = convert(values[i] * scale_inv);
+      }
+    }
+
+    if (lane_idx == 0) {
+      scale_ptr[block_idx] = scale;
+    }
+  }
+}
+
+// Signals the flag peer that this device's compressed partial (written by the previous kernel in
+// the stream) is ready, then waits on the peer's and dequantizes it into a local buffer.
+template <
+  int NumThreads,
+  int BlockSize,
+  typename Transport,
+  typename ElementCompressed,
+  typename ElementPartial,
+  typename FlagType>
+__global__ void exchange_compressed_partial_kernel(
+    ElementCompressed const* remote_compressed_ptr,
+    float const* remote_scale_ptr,
+    ElementPartial* partial_ptr,
+    size_t num_elements,
+    FlagType* self_flag_ptr,
+    FlagType* peer_flag_ptr,
+    int flag_peer_idx) {
+
+  static constexpr int NumWarps = NumThreads / NumThreadsPerWarp;
+  static constexpr int ElementsPerThread = BlockSize / NumThreadsPerWarp;
+
+  if (blockIdx.x == 0 && threadIdx.x == 0) {
+    Transport::signal(peer_flag_ptr, static_cast<FlagType>(1), flag_peer_idx);
+  }
+
+  if (threadIdx.x == 0) {
+    FlagType arrived = 0;
+    detail::ld_without_cache(arrived, self_flag_ptr);
+    while (arrived == 0) {
+      detail::ld_without_cache(arrived, self_flag_ptr);
+      __nanosleep(40);
+    }
+  }
+  __syncthreads();
+
+  NumericConverter<ElementPartial, float> convert;
+
+  int lane_idx = threadIdx.x % NumThreadsPerWarp;
+  size_t num_blocks = ceil_div(num_elements, static_cast<size_t>(BlockSize));
+
+  for (size_t block_idx = static_cast<size_t>(blockIdx.x) * NumWarps + threadIdx.x / NumThreadsPerWarp;
+       block_idx < num_blocks;
+       block_idx += static_cast<size_t>(gridDim.x) * NumWarps) {
+
+    float scale = remote_scale_ptr[block_idx];
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < ElementsPerThread; ++i) {
+      size_t idx = block_idx * BlockSize + i * NumThreadsPerWarp + lane_idx;
+      if (idx < num_elements) {
+        partial_ptr[idx] = convert(static_cast<float>(remote_compressed_ptr[idx]) * scale);
+      }
+    }
+  }
+}
+
+} // namespace cutlass::distributed::kernel
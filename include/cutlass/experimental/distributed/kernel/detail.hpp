@@ -65,6 +65,15 @@ void ld_without_cache(uint32_t& val, void const * ptr) {
       : "l"(ptr));
 }
 
+// Adds to a counter that another device polls, releasing the prior writes of the calling thread,
+// and those ordered before it by a barrier, to the other device (fence.acq_rel + relaxed modifier at
+// system scope, as GenericBarrier does at GPU scope).
+CUTLASS_DEVICE
+void red_release_sys(int32_t* ptr, int32_t val) {
+  asm volatile ("fence.acq_rel.sys;\n" ::: "memory");
+  asm volatile ("red.relaxed.sys.global.add.s32 [%0], %1;\n" : : "l"(ptr), "r"(val) : "memory");
+}
+
 } // namespace cutlass::distributed::kernel::detail
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -42,6 +42,7 @@
 #include "cutlass/gemm/gemm.h"
 
 #include "cutlass/experimental/distributed/kernel/detail.hpp"
+#include "cutlass/experimental/distributed/transports/dist_gemm_transports.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -61,23 +62,38 @@ struct SupportsDistributedGemm: cutlass::gemm::detail::IsCutlass3GemmKernel<Gemm
   Depending on the underlying distribution policy/schedule, it prepends the underlying local GEMM
   kernel with a few additional instructions that gate the execution of the GEMM on buffers being
   ready for stages/iterations > 0.
+
+  The transport (see transports/dist_gemm_transports.hpp) determines how rotating operands are
+  copied and how arrivals are signaled between devices; the schedule's iteration mappings are
+  independent of it.
 */
 
-template <class GemmKernel_, class DistSchedule_, class Enable = void>
+template <
+  class GemmKernel_,
+  class DistSchedule_,
+  class Transport_ = transports::PeerAccessTransport,
+  class Enable = void>
 struct DistributedGemmKernelWrapper;
 
-template <class GemmKernel_, class DistSchedule_>
+template <class GemmKernel_, class DistSchedule_, class Transport_>
 struct DistributedGemmKernelWrapper<
   GemmKernel_,
   DistSchedule_,
+  Transport_,
   cute::enable_if_t<detail::SupportsDistributedGemm<GemmKernel_>::value>
   >: GemmKernel_
 {
   using DistSchedule = DistSchedule_;
   using TP = typename DistSchedule::TP;
+  using Transport = Transport_;
 
   static constexpr bool KernelWritesArrivalFlag = DistSchedule::KernelWritesArrivalFlag;
 
+  static_assert(Transport::SupportsDirectPeerAccess || (
+        DistSchedule::HasMemcpy && not DistSchedule::RemoteC && not KernelWritesArrivalFlag),
+      "Selected transport does not support direct peer access; only schedules that memcpy "
+      "their rotating operand are supported.");
+
   using BaseKernel = GemmKernel_;
   using BaseArguments = typename BaseKernel::Arguments;
   using BaseParams = typename BaseKernel::Params;
@@ -94,6 +110,9 @@ struct DistributedGemmKernelWrapper<
 
     void* self_flag_ptr{nullptr};
     void* peer_flag_ptr{nullptr};
+
+    // Device owning peer_flag_ptr
+    int flag_peer_idx = 0;
   };
 
   struct PackedArguments {
@@ -107,6 +126,8 @@ struct DistributedGemmKernelWrapper<
 
     ElementFlag* self_flag_ptr_{nullptr};
     ElementFlag* peer_flag_ptr_{nullptr};
+
+    int flag_peer_idx = 0;
   };
 
   // Kernel entry point API
@@ -129,7 +150,8 @@ struct DistributedGemmKernelWrapper<
         args.distributed.device_idx,
         args.distributed.iteration,
         reinterpret_cast<ElementFlag*>(args.distributed.self_flag_ptr),
-        reinterpret_cast<ElementFlag*>(args.distributed.peer_flag_ptr)
+        reinterpret_cast<ElementFlag*>(args.distributed.peer_flag_ptr),
+        args.distributed.flag_peer_idx
     };
 
     return {kernel_params, dist_params};
@@ -199,8 +221,11 @@ struct DistributedGemmKernelWrapper<
     if constexpr (KernelWritesArrivalFlag) {
       if (blockIdx.x == 0 && blockIdx.y == 0 && blockIdx.z == 0 &&
           threadIdx.x == 0 && threadIdx.y == 0 && threadIdx.z == 0 &&
-          params.distributed.iteration > 0) {
-        *reinterpret_cast<ElementFlag*>(params.distributed.peer_flag_ptr_) = 1;
+          DistSchedule::kernel_writes_arrival_flag(params.distributed.iteration)) {
+        Transport::signal(
+            params.distributed.peer_flag_ptr_,
+            static_cast<ElementFlag>(1),
+            params.distributed.flag_peer_idx);
       }
     }
   }
@@ -0,0 +1,205 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Expert-parallel mixture of experts token dispatch and combine kernels.
+
+    NOTE: This API is __experimental__ and will change heavily over time.
+
+    With expert parallelism, each device owns num_local_experts experts, and expert e lives on
+    device e / num_local_experts. A forward pass of an expert-parallel MoE layer then runs, on every
+    device of the NVLink domain:
+
+      1. a count exchange (not part of CUTLASS), which yields the number of rows each expert receives
+         from every device, and therefore the row expert_row[entry] of the owning device's expert input
+         buffer that each routed token lands in, and the device-side problem shapes of the expert GEMMs;
+      2. ep_dispatch_kernel, which pushes the rows of this device's tokens directly into the expert
+         input buffers of their owners, and counts the rows it delivers per arrival_tile_m rows of
+         each expert in the owner's arrival counters;
+      3. the grouped GEMM of the local experts (one group per expert), with the
+         ExpertArrivalGroupScheduler, which starts the tiles of an expert as soon as the rows of A they
+         read have arrived, overlapping 2 with 3;
+      4. a barrier across devices (e.g. launch_full_barrier) once the expert GEMMs are complete;
+      5. ep_combine_kernel, which pulls the expert outputs of this device's tokens back from their
+         owners and reduces them with the routing weights.
+
+    The dispatch must run alongside the grouped GEMM, on SMs the GEMM leaves free, and the arrival
+    counters must be zeroed on every device before any device starts its dispatch.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/functional.h"
+
+#include "cutlass/experimental/distributed/kernel/detail.hpp"
+
+namespace cutlass::distributed::kernel {
+
+// Top-k routing of this device's tokens. Entries are token-major: entry t * top_k + k sends token t
+// to global expert expert_idx[entry] (negative if the token is dropped), into row expert_row[entry]
+// of the expert's input buffer on the owning device, and weighs the expert's output by weight[entry].
+struct ExpertRouting {
+  int32_t const* expert_idx = nullptr;
+  int32_t const* expert_row = nullptr;
+  float const* weight = nullptr;
+  int num_tokens = 0;
+  int top_k = 0;
+  int num_local_experts = 0;
+};
+
+namespace detail {
+
+// Copies a row of bytes with the lanes of a warp, in 16B vectors where the row allows it
+CUTLASS_DEVICE
+void copy_row_warp(uint8_t* dst, uint8_t const* src, size_t bytes, int lane_idx) {
+  size_t num_vectors = 0;
+  if ((reinterpret_cast<uintptr_t>(dst) | reinterpret_cast<uintptr_t>(src)) % sizeof(uint4) == 0) {
+    num_vectors = bytes / sizeof(uint4);
+    for (size_t i = lane_idx; i < num_vectors; i += NumThreadsPerWarp) {
+      reinterpret_cast<uint4*>(dst)[i] = reinterpret_cast<uint4 const*>(src)[i];
+    }
+  }
+  for (size_t i = num_vectors * sizeof(uint4) + lane_idx; i < bytes; i += NumThreadsPerWarp) {
+    dst[i] = src[i];
+  }
+}
+
+} // namespace detail
+
+// Pushes every routed token row into the input buffer of its expert on the owning device, one warp
+// per routing entry. peer_expert_ptrs[device * num_local_experts + local_expert] is the input buffer of
+// the expert with row stride ld_expert, and peer_counter_ptrs[device] the (num_local_experts,
+// max_arrival_tiles) arrival counters of the device, both mapped into this device's address space.
+template <int NumThreads, typename Element>
+__global__ void ep_dispatch_kernel(
+    Element const* tokens_ptr,
+    int64_t ld_tokens,
+    int hidden,
+    ExpertRouting routing,
+    Element* const* peer_expert_ptrs,
+    int64_t ld_expert,
+    int32_t* const* peer_counter_ptrs,
+    int max_arrival_tiles,
+    int arrival_tile_m) {
+
+  static_assert(NumThreads % NumThreadsPerWarp == 0, "Expected whole warps.");
+  static constexpr int NumWarps = NumThreads / NumThreadsPerWarp;
+
+  int lane_idx = threadIdx.x % NumThreadsPerWarp;
+  size_t row_bytes = static_cast<size_t>(hidden) * sizeof_bits<Element>::value / 8;
+  size_t num_entries = static_cast<size_t>(routing.num_tokens) * routing.top_k;
+
+  for (size_t entry = static_cast<size_t>(blockIdx.x) * NumWarps + threadIdx.x / NumThreadsPerWarp;
+       entry < num_entries;
+       entry += static_cast<size_t>(gridDim.x) * NumWarps) {
+
+    int32_t expert = routing.expert_idx[entry];
+    if (expert < 0) {
+      continue;
+    }
+    int32_t peer_idx = expert / routing.num_local_experts;
+    int32_t local_expert = expert % routing.num_local_experts;
+    int32_t row = routing.expert_row[entry];
+    int64_t token = static_cast<int64_t>(entry / routing.top_k);
+
+    Element const* src = tokens_ptr + token * ld_tokens;
+    Element* dst = peer_expert_ptrs[peer_idx * routing.num_local_experts + local_expert] + row * ld_expert;
+    detail::copy_row_warp(reinterpret_cast<uint8_t*>(dst), reinterpret_cast<uint8_t const*>(src), row_bytes, lane_idx);
+
+    // All lanes' stores of the row are ordered before the arrival
+    __syncwarp();
+    if (lane_idx == 0) {
+      int32_t* counter_ptr = peer_counter_ptrs[peer_idx] + local_expert * max_arrival_tiles + row / arrival_tile_m;
+      detail::red_release_sys(counter_ptr, 1);
+    }
+  }
+}
+
+// Pulls the expert outputs of this device's tokens back from the devices owning the experts and
+// writes their weighted sum, one warp per token. peer_expert_ptrs[device * num_local_experts +
+// local_expert] is the output buffer of the expert with row stride ld_expert, mapped into this
+// device's address space. Rows are accessed in vectors of 16B of ElementExpert, so hidden and the
+// strides must be multiples of the vector, and the buffers aligned to it.
+template <int NumThreads, typename ElementExpert, typename ElementOutput>
+__global__ void ep_combine_kernel(
+    ElementExpert const* const* peer_expert_ptrs,
+    int64_t ld_expert,
+    int hidden,
+    ExpertRouting routing,
+    ElementOutput* output_ptr,
+    int64_t ld_output) {
+
+  static_assert(NumThreads % NumThreadsPerWarp == 0, "Expected whole warps.");
+  static constexpr int NumWarps = NumThreads / NumThreadsPerWarp;
+  static constexpr int ElementsPerAccess = 128 / sizeof_bits<ElementExpert>::value;
+
+  using ExpertVector = AlignedArray<ElementExpert, ElementsPerAccess>;
+  using OutputVector = AlignedArray<ElementOutput, ElementsPerAccess>;
+  using Accumulator = Array<float, ElementsPerAccess>;
+
+  NumericArrayConverter<float, ElementExpert, ElementsPerAccess> convert_expert;
+  NumericArrayConverter<ElementOutput, float, ElementsPerAccess> convert_output;
+  multiply_add<Accumulator> mad;
+
+  int lane_idx = threadIdx.x % NumThreadsPerWarp;
+
+  for (int64_t token = static_cast<int64_t>(blockIdx.x) * NumWarps + threadIdx.x / NumThreadsPerWarp;
+       token < routing.num_tokens;
+       token += static_cast<int64_t>(gridDim.x) * NumWarps) {
+
+    for (int col = lane_idx * ElementsPerAccess; col < hidden; col += NumThreadsPerWarp * ElementsPerAccess) {
+      Accumulator accum;
+      accum.clear();
+
+      for (int k = 0; k < routing.top_k; ++k) {
+        int64_t entry = token * routing.top_k + k;
+        int32_t expert = routing.expert_idx[entry];
+        if (expert < 0) {
+          continue;
+        }
+        int32_t peer_idx = expert / routing.num_local_experts;
+        int32_t local_expert = expert % routing.num_local_experts;
+        int64_t row = routing.expert_row[entry];
+
+        ElementExpert const* src = peer_expert_ptrs[peer_idx * routing.num_local_experts + local_expert] + row * ld_expert + col;
+        ExpertVector values = *reinterpret_cast<ExpertVector const*>(src);
+        accum = mad(convert_expert(values), routing.weight[entry], accum);
+      }
+
+      *reinterpret_cast<OutputVector*>(output_ptr + token * ld_output + col) = convert_output(accum);
+    }
+  }
+}
+
+} // namespace cutlass::distributed::kernel
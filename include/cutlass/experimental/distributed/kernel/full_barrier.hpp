@@ -41,10 +41,12 @@
 #include "cutlass/arch/grid_dependency_control.h"
 
 #include "cutlass/experimental/distributed/kernel/detail.hpp"
+#include "cutlass/experimental/distributed/transports/dist_gemm_transports.hpp"
 
 namespace cutlass::distributed::kernel {
 
-template <int NP, typename IntType, int Iterations, typename FlagType>
+template <int NP, typename IntType, int Iterations, typename FlagType,
+          typename Transport = transports::PeerAccessTransport>
 __global__ void full_barrier_kernel(
     cutlass::Array<IntType*, NP> device_arrival_ptrs,
     cutlass::Array<FlagType*, Iterations> iteration_flag_ptrs,
@@ -64,7 +66,7 @@ __global__ void full_barrier_kernel(
   CUTLASS_PRAGMA_UNROLL
   for (IntType d = 0; d < NP; ++d) {
     if (d != device_idx) {
-      atomicAdd(device_arrival_ptrs[d], val);
+      Transport::atomic_add(device_arrival_ptrs[d], val, static_cast<int>(d));
     }
   }
 
@@ -0,0 +1,92 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Distributed GEMM SM-driven copy kernel.
+
+    Copies peer slices of the rotating operand into local buffers for every stage/iteration with
+    a fixed number of CTAs, instead of copy engines. Each iteration is split into 16B chunks
+    striped across all CTAs; CTAs count their completion per iteration, and the last one to finish
+    sets the iteration's arrival flag (and resets the counter for the next run).
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+
+namespace cutlass::distributed::kernel {
+
+template <int NumThreads, int Iterations, typename FlagType, typename CounterType>
+__global__ void sm_copy_kernel(
+    cutlass::Array<void*, Iterations> dst_ptrs,
+    cutlass::Array<void const*, Iterations> src_ptrs,
+    cutlass::Array<size_t, Iterations> bytes,
+    cutlass::Array<FlagType*, Iterations> iteration_flag_ptrs,
+    CounterType* counter_ptr) {
+
+  size_t thread_idx = static_cast<size_t>(blockIdx.x) * NumThreads + threadIdx.x;
+  size_t num_threads = static_cast<size_t>(gridDim.x) * NumThreads;
+
+  // No copies for first iter; we assume the data is already there.
+  for (int iteration = 1; iteration < Iterations; ++iteration) {
+    if (bytes[iteration] == 0) {
+      continue;
+    }
+
+    uint8_t* dst = reinterpret_cast<uint8_t*>(dst_ptrs[iteration]);
+    uint8_t const* src = reinterpret_cast<uint8_t const*>(src_ptrs[iteration]);
+
+    size_t num_vectors = 0;
+    if ((reinterpret_cast<uintptr_t>(dst) | reinterpret_cast<uintptr_t>(src)) % sizeof(uint4) == 0) {
+      num_vectors = bytes[iteration] / sizeof(uint4);
+      for (size_t i = thread_idx; i < num_vectors; i += num_threads) {
+        reinterpret_cast<uint4*>(dst)[i] = reinterpret_cast<uint4 const*>(src)[i];
+      }
+    }
+    for (size_t i = num_vectors * sizeof(uint4) + thread_idx; i < bytes[iteration]; i += num_threads) {
+      dst[i] = src[i];
+    }
+
+    __syncthreads();
+
+    if (threadIdx.x == 0) {
+      // Make this CTA's stores visible before arriving
+      __threadfence();
+      CounterType arrived = atomicAdd(counter_ptr + iteration, static_cast<CounterType>(1));
+      if (arrived == static_cast<CounterType>(gridDim.x - 1)) {
+        __threadfence();
+        counter_ptr[iteration] = static_cast<CounterType>(0);
+        *reinterpret_cast<FlagType volatile*>(iteration_flag_ptrs[iteration]) = static_cast<FlagType>(1);
+      }
+    }
+  }
+}
+
+} // namespace cutlass::distributed::kernel
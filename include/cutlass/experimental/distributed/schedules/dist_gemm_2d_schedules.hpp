@@ -0,0 +1,457 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*!
+  \file 2-D Distributed GEMM Schedules
+
+  NOTE: This API is __experimental__ and will change heavily over time.
+  Please proceed with caution when modifying these schedules or defining new ones.
+
+  2-D schedules arrange the TP devices in a (TPAllGather x TPReduceScatter) mesh, and communicate
+  along each mesh axis separately:
+    device_idx = r + TPAllGather * s,  r in [0, TPAllGather), s in [0, TPReduceScatter)
+
+  Iterations are split the same way, with the reduce scatter axis being the fastest changing:
+    iteration = j + TPReduceScatter * i,  i in [0, TPAllGather), j in [0, TPReduceScatter)
+
+  Device/iteration mappings are still defined with rank-2 CuTe layouts, but each mapping is a
+  function of the coordinate and iteration along a single mesh axis, and is taken modulo the size
+  of that axis instead of TP:
+    crd = (Mapping(crd_axis + Offset, iter_axis) + AxisSize) % AxisSize
+
+  All schedules expose the same static interface as BaseSchedule, so they can be used with
+  DistributedGemmKernelWrapper and DistributedGemmUniversalAdapter directly.
+*/
+
+#pragma once
+
+#include "cute/layout.hpp"
+#include "cute/tensor.hpp"
+#include "cutlass/cutlass.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::distributed::schedules {
+
+// AllGather + GEMM + ReduceScatter
+// Each device owns an [M / TPAllGather, K / TPReduceScatter] slice of A and an
+// [N / TPAllGather, K / TPReduceScatter] slice of B: K is sharded along the reduce scatter axis,
+// and M (for A) and N (for B) along the all gather axis.
+//
+// Devices along the all gather axis (same s) rotate their slices of A, so that every device
+// eventually multiplies A[:, K_s] with its own slice of B. This produces a partial C[:, N_r], which
+// is reduced across devices along the reduce scatter axis (same r) by reading the left peer's D
+// directly in the epilogue, exactly like ReduceScatter1D_TilingA_RotatingC.
+//
+// Iteration (i, j) computes a GEMM of shape [M / TP, N / TPAllGather, K / TPReduceScatter]:
+//  * A: tile t of the A slice copied from all gather peer g, where
+//      g = (r + i) % TPAllGather                  (TPAllGather, TPAllGather) : (1, 1)
+//      t = (s - 1 - j) % TPReduceScatter           (TPReduceScatter, TPReduceScatter) : (1, -1), offset -1
+//  * C: tile g of the reduce scatter peer's D from iteration (i, j - 1), where the peer is
+//      (r, (s - 1) % TPReduceScatter)              (TPReduceScatter, TPReduceScatter) : (1, 0), offset -1
+//    No source in iterations with j = 0.
+//  * D: tile g of a local buffer, and of the local D in the last iteration of each reduction
+//    (j = TPReduceScatter - 1), where t = s.
+//
+// Below is an illustration of the iterations (i, j) producing the final output tiles owned by
+// device (r, s) = (0, 1) in the 2x2 case: tile t = 1 of every M block, in N block 0.
+//
+//                        Tensor D
+//
+//                  N block 0    N block 1
+//                |-----------|-----------|
+//   g = 0, t = 0 |           |           |
+//                |___________|___________|
+//   g = 0, t = 1 |  (0, 1)   |           |
+//                |___________|___________|
+//   g = 1, t = 0 |           |           |
+//                |___________|___________|
+//   g = 1, t = 1 |  (1, 1)   |           |
+//                |___________|___________|
+//
+//                                     M x N
+//
+// Compared to 1-D schedules over TP = TPAllGather * TPReduceScatter devices, each device
+// receives (TPAllGather - 1) / TP of A instead of (TP - 1) / TP of A (all gather), and sends
+// (TPReduceScatter - 1) / TPReduceScatter of an [M, N / TPAllGather] partial output instead of
+// (TP - 1) / TP of an [M, N] partial output (reduce scatter).
+//
+// Requirements: M % TP == 0, N % TPAllGather == 0, K % TPReduceScatter == 0, and beta == 0 (the
+// epilogue source is a peer's partial result.)
+//
+template <class TPAllGather_, class TPReduceScatter_>
+struct AllGatherReduceScatter2D_TilingCD_RotatingAC {
+
+  using TPAllGather = TPAllGather_;
+  using TPReduceScatter = TPReduceScatter_;
+  using TP = decltype(TPAllGather{} * TPReduceScatter{});
+
+  static_assert(
+      cute::is_static<TPAllGather>::value && cute::is_integral<TPAllGather>::value &&
+      cute::is_static<TPReduceScatter>::value && cute::is_integral<TPReduceScatter>::value,
+      "Only integers allowed for mesh axes at this time.");
+  static_assert(TPAllGather{} > 1 && TPReduceScatter{} > 1,
+      "Both mesh axes must be larger than 1; use a 1-D schedule instead.");
+
+  // All gather axis mappings: (r, i)
+  using PeerDeviceMapping = cute::Layout<cute::Shape<TPAllGather, TPAllGather>, cute::Stride<_1, _1>>;            // = r + i
+  using IterationMappingMBlock = cute::Layout<cute::Shape<TPAllGather, TPAllGather>, cute::Stride<_1, _1>>;       // = r + i
+
+  // Reduce scatter axis mappings: (s, j)
+  using ReduceScatterPeerMapping = cute::Layout<cute::Shape<TPReduceScatter, TPReduceScatter>, cute::Stride<_1, _0>>;  // = s + ProcessorOffset
+  using IterationMappingM = cute::Layout<cute::Shape<TPReduceScatter, TPReduceScatter>, cute::Stride<_1, _m1>>;       // = s + ProcessorOffset - j
+  using IterationMappingN = cute::Layout<cute::Shape<TPReduceScatter, TPReduceScatter>, cute::Stride<_0, _0>>;        // (N is not tiled across iterations) = 0
+  using IterationMappingK = cute::Layout<cute::Shape<TPReduceScatter, TPReduceScatter>, cute::Stride<_0, _0>>;        // (K is not tiled across iterations) = 0
+
+  using ProcessorOffset = _m1;
+
+  static constexpr bool KernelWritesArrivalFlag = true;
+  static constexpr bool MemcpyA = true;
+  static constexpr bool MemcpyB = false;
+  static constexpr bool HasMemcpy = MemcpyA || MemcpyB;
+
+  // A: one buffer per all gather step; D: one buffer per reduction step, each holding a tile for
+  // every all gather step.
+  static constexpr int NumBuffersA = TPAllGather{} - 1;
+  static constexpr int NumBuffersB = 0;
+  static constexpr int NumBuffersC = 0;
+  static constexpr int NumBuffersD = TPReduceScatter{} - 1;
+
+  static constexpr bool BufferedOutput = true;
+  static constexpr bool RemoteC = true;
+  static constexpr bool RemoteD = false;
+
+  // Mesh coordinates
+  CUTLASS_HOST_DEVICE
+  static int
+  get_all_gather_crd(int device_idx) {
+    return device_idx % TPAllGather{};
+  }
+
+  CUTLASS_HOST_DEVICE
+  static int
+  get_reduce_scatter_crd(int device_idx) {
+    return device_idx / TPAllGather{};
+  }
+
+  CUTLASS_HOST_DEVICE
+  static int
+  get_all_gather_iter(int iteration) {
+    return iteration / TPReduceScatter{};
+  }
+
+  CUTLASS_HOST_DEVICE
+  static int
+  get_reduce_scatter_iter(int iteration) {
+    return iteration % TPReduceScatter{};
+  }
+
+  CUTLASS_HOST_DEVICE
+  static int
+  get_device_idx(int all_gather_crd, int reduce_scatter_crd) {
+    return all_gather_crd + TPAllGather{} * reduce_scatter_crd;
+  }
+
+  // Host-side API: can_implement based on the GLOBAL problem shape
+  template <typename ProblemShape>
+  static bool
+  can_implement_global(ProblemShape const& global_problem_shape) {
+    auto [M, N, K, L] = append<4>(global_problem_shape, 1);
+
+    return M % TP{} == 0 && N % TPAllGather{} == 0 && K % TPReduceScatter{} == 0;
+  }
+
+  template <typename ProblemShape>
+  CUTLASS_HOST_DEVICE
+  static auto
+  get_local_gemm_shape(ProblemShape const& global_problem_shape) {
+    auto problem_shape_MNKL = append<4>(global_problem_shape, 1);
+
+    return shape_div(problem_shape_MNKL, cute::Shape<TP, TPAllGather, TPReduceScatter, _1>{});
+  }
+
+  // Host-side API: determine peers along the reduce scatter axis, which receive arrival flags
+  static auto
+  get_peers_for_device(int device_idx) {
+    auto r = get_all_gather_crd(device_idx);
+    auto s = get_reduce_scatter_crd(device_idx);
+    auto left_peer_id = get_device_idx(r, s > 0 ? s - 1 : TPReduceScatter{} - 1);
+    auto right_peer_id = get_device_idx(r, s < TPReduceScatter{} - 1 ? s + 1 : 0);
+
+    return cute::make_tuple(left_peer_id, right_peer_id);
+  }
+
+  // Determines the all gather peer A is copied from given device index and iteration
+  static int
+  get_remote_peer_id(int device_idx, int iteration) {
+    auto mapping = PeerDeviceMapping{};
+    auto r = get_all_gather_crd(device_idx);
+    auto i = get_all_gather_iter(iteration);
+    auto peer_r = (mapping(r, i) + TPAllGather{}) % TPAllGather{};
+    return get_device_idx(peer_r, get_reduce_scatter_crd(device_idx));
+  }
+
+  // Determines the reduce scatter peer whose D is the epilogue source given device index and
+  // iteration
+  static int
+  get_remote_c_peer_id(int device_idx, int iteration) {
+    auto mapping = ReduceScatterPeerMapping{};
+    auto s = get_reduce_scatter_crd(device_idx);
+    auto j = get_reduce_scatter_iter(iteration);
+    auto peer_s = (mapping(s + ProcessorOffset{}, j) + TPReduceScatter{}) % TPReduceScatter{};
+    return get_device_idx(get_all_gather_crd(device_idx), peer_s);
+  }
+
+  // Per-iteration communication: A is copied at the start of every all gather step, and the rest
+  // of the iterations reduce into the left peer's partial result.
+  static bool
+  has_memcpy(int iteration) {
+    return get_all_gather_iter(iteration) > 0 && get_reduce_scatter_iter(iteration) == 0;
+  }
+
+  CUTLASS_HOST_DEVICE
+  static bool
+  kernel_writes_arrival_flag(int iteration) {
+    return get_reduce_scatter_iter(iteration) > 0;
+  }
+
+  static bool
+  has_remote_c(int iteration) {
+    return get_reduce_scatter_iter(iteration) > 0;
+  }
+
+  // M block (all gather peer) and M tile within the block accessed in an iteration
+  CUTLASS_HOST_DEVICE
+  static int
+  get_device_tile_block_m(int device_idx, int iteration) {
+    auto mapping = IterationMappingMBlock{};
+    auto r = get_all_gather_crd(device_idx);
+    auto i = get_all_gather_iter(iteration);
+    return (mapping(r, i) + TPAllGather{}) % TPAllGather{};
+  }
+
+  // Tile coordinates within the rotating A ([M / TP, K / TPReduceScatter] tiles), and within C/D
+  // ([M / TP, N / TPAllGather] tiles)
+  CUTLASS_HOST_DEVICE
+  static auto
+  get_device_tile_idx_a(int device_idx, int iteration) {
+    auto mapping_m = IterationMappingM{};
+    auto mapping_k = IterationMappingK{};
+    auto s = get_reduce_scatter_crd(device_idx);
+    auto j = get_reduce_scatter_iter(iteration);
+    auto crd_m = (mapping_m(s + ProcessorOffset{}, j) + TPReduceScatter{} * 2) % TPReduceScatter{};
+    auto crd_k = (mapping_k(s + ProcessorOffset{}, j) + TPReduceScatter{}) % TPReduceScatter{};
+    return make_coord(crd_m, crd_k, 0);
+  }
+
+  CUTLASS_HOST_DEVICE
+  static auto
+  get_device_tile_idx_c(int device_idx, int iteration) {
+    auto mapping_n = IterationMappingN{};
+    auto s = get_reduce_scatter_crd(device_idx);
+    auto j = get_reduce_scatter_iter(iteration);
+    auto crd_m = get_device_tile_block_m(device_idx, iteration);
+    auto crd_n = (mapping_n(s + ProcessorOffset{}, j) + TPReduceScatter{}) % TPReduceScatter{};
+    return make_coord(crd_m, crd_n, 0);
+  }
+
+  // Device Partitioners
+  template <typename Tensor>
+  static auto
+  get_rotating_tensor_A(Tensor original_tensor, void * tensor_buffer_ptr, int device_idx, int iteration) {
+    static_assert(rank(original_tensor) == 3);
+
+    using Element = typename Tensor::value_type;
+    // Recreate tensor without constness. This is to ensure return types match.
+    Element* ptr = const_cast<Element*>(original_tensor.data());
+    auto shape = original_tensor.shape();
+    auto layout = original_tensor.layout();
+
+    auto i = get_all_gather_iter(iteration);
+    if (i == 0) {
+      return make_tensor(ptr, layout);
+    }
+    Element* ptr_buffer = reinterpret_cast<Element*>(tensor_buffer_ptr);
+    ptr_buffer += size(shape) * (i - 1);
+
+    return make_tensor(ptr_buffer, layout);
+  }
+
+  template <typename Tensor>
+  static auto
+  get_tensor_A(Tensor original_tensor, void * tensor_buffer_ptr, int device_idx, int iteration) {
+    auto tensor = get_rotating_tensor_A(original_tensor, tensor_buffer_ptr, device_idx, iteration);
+    auto tiler = shape_div(tensor.shape(), cute::Shape<TPReduceScatter, _1, _1>{});
+    auto idx = get_device_tile_idx_a(device_idx, iteration);
+    return inner_partition(tensor, tiler, idx);
+  }
+
+  template <typename Tensor>
+  static auto
+  get_tensor_B(Tensor original_tensor, void * tensor_buffer_ptr, int device_idx, int iteration) {
+    static_assert(rank(original_tensor) == 3);
+
+    using Element = typename Tensor::value_type;
+    // Recreate tensor without constness. This is to ensure return types match.
+    Element * ptr = const_cast<Element *>(original_tensor.data());
+    return make_tensor(ptr, original_tensor.layout());
+  }
+
+  // C is read from the reduce scatter peer's D buffers (tensor_buffer_ptr is the peer's buffer),
+  // which hold a tile for every all gather step. Peers along the reduce scatter axis share the
+  // same all gather coordinate, and therefore access the same tile.
+  template <typename Tensor>
+  static auto
+  get_tensor_C(Tensor original_tensor, void * tensor_buffer_ptr, int device_idx, int iteration) {
+    static_assert(rank(original_tensor) == 3);
+
+    using Element = typename Tensor::value_type;
+    // Recreate tensor without constness. This is to ensure return types match.
+    Element * ptr = const_cast<Element *>(original_tensor.data());
+    auto shape = original_tensor.shape();
+    auto layout = original_tensor.layout();
+
+    auto j = get_reduce_scatter_iter(iteration);
+    if (j > 0) {
+      ptr = reinterpret_cast<Element *>(tensor_buffer_ptr) + size(shape) * (j - 1);
+    }
+
+    auto tensor = make_tensor(ptr, layout);
+    auto tiler = shape_div(shape, cute::Shape<TPAllGather, _1, _1>{});
+    auto idx = get_device_tile_idx_c(device_idx, iteration);
+    return inner_partition(tensor, tiler, idx);
+  }
+
+  template <typename Tensor>
+  static auto
+  get_tensor_D(Tensor original_tensor, void * tensor_buffer_ptr, int device_idx, int iteration) {
+    static_assert(rank(original_tensor) == 3);
+
+    using Element = typename Tensor::value_type;
+    // Recreate tensor without constness. This is to ensure return types match.
+    Element * ptr = const_cast<Element *>(original_tensor.data());
+    auto shape = original_tensor.shape();
+    auto layout = original_tensor.layout();
+
+    // last iteration of every reduction is the local tensor, the rest are buffers
+    auto j = get_reduce_scatter_iter(iteration);
+    if (j < TPReduceScatter{} - 1) {
+      ptr = reinterpret_cast<Element *>(tensor_buffer_ptr) + size(shape) * j;
+    }
+
+    auto tensor = make_tensor(ptr, layout);
+    auto tiler = shape_div(shape, cute::Shape<TPAllGather, _1, _1>{});
+    auto idx = get_device_tile_idx_c(device_idx, iteration);
+    return inner_partition(tensor, tiler, idx);
+  }
+
+  template <typename ProblemShape>
+  CUTLASS_HOST_DEVICE
+  static auto
+  get_local_a_shape(ProblemShape problem_shape) {
+    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    return shape_div(
+        select<0,2,3>(problem_shape_MNKL),
+        cute::Shape<TPAllGather, TPReduceScatter, _1>{});
+  }
+
+  template <typename ProblemShape>
+  CUTLASS_HOST_DEVICE
+  static auto
+  get_local_b_shape(ProblemShape problem_shape) {
+    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    return shape_div(
+        select<1,2,3>(problem_shape_MNKL),
+        cute::Shape<TPAllGather, TPReduceScatter, _1>{});
+  }
+
+  template <typename ProblemShape>
+  CUTLASS_HOST_DEVICE
+  static auto
+  get_local_c_shape(ProblemShape problem_shape) {
+    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    return shape_div(
+        select<0,1,3>(problem_shape_MNKL),
+        cute::Shape<TPReduceScatter, TPAllGather, _1>{});
+  }
+
+  template <typename ProblemShape>
+  CUTLASS_HOST_DEVICE
+  static auto
+  get_local_d_shape(ProblemShape problem_shape) {
+    return get_local_c_shape(problem_shape);
+  }
+
+  // Host-side APIs: get_device_slice_{A,B,C,D}
+  // Slice off a view of the GLOBAL tensor that corresponds to the shard that 
+  // is going to be owned by a specific device.
+  template <typename Tensor>
+  static auto
+  get_device_slice_A(Tensor tensor, int device_idx) {
+    auto tiler = shape_div(tensor.shape(), cute::Shape<TPAllGather, TPReduceScatter, _1>{});
+    auto idx = make_coord(get_all_gather_crd(device_idx), get_reduce_scatter_crd(device_idx), 0);
+    return inner_partition(tensor, tiler, idx);
+  }
+
+  template <typename Tensor>
+  static auto
+  get_device_slice_B(Tensor tensor, int device_idx) {
+    auto tiler = shape_div(tensor.shape(), cute::Shape<TPAllGather, TPReduceScatter, _1>{});
+    auto idx = make_coord(get_all_gather_crd(device_idx), get_reduce_scatter_crd(device_idx), 0);
+    return inner_partition(tensor, tiler, idx);
+  }
+
+  // Devices own tile t = s of every M block, which is not contiguous in M:
+  // the M mode of the slice is (M / TP, TPAllGather) : (1, M / TPAllGather).
+  template <typename Tensor>
+  static auto
+  get_device_slice_C(Tensor tensor, int device_idx) {
+    auto [M, N, L] = tensor.shape();
+    auto tiler = make_tile(
+        make_layout(make_shape(M / TP{}, TPReduceScatter{}, TPAllGather{})),
+        make_layout(make_shape(N / TPAllGather{}, TPAllGather{})),
+        make_layout(L));
+    auto tiled_tensor = tensor.compose(tiler);
+    return tiled_tensor(
+        make_coord(_, get_reduce_scatter_crd(device_idx), _),
+        make_coord(_, get_all_gather_crd(device_idx)),
+        _);
+  }
+
+  template <typename Tensor>
+  static auto
+  get_device_slice_D(Tensor tensor, int device_idx) {
+    return get_device_slice_C(tensor, device_idx);
+  }
+};
+
+} // namespace cutlass::distributed::schedules
+
+///////////////////////////////////////////////////////////////////////////////
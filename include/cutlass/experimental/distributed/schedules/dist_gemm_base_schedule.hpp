@@ -183,6 +183,35 @@ struct BaseSchedule {
     return peer_idx;
   }
 
+  // Determines the peer whose D buffer is the epilogue source (remote C) given device index
+  // and iteration
+  static int
+  get_remote_c_peer_id(int device_idx, int iteration) {
+    return get_remote_peer_id(device_idx, iteration);
+  }
+
+  // Per-iteration communication:
+  //  * has_memcpy: a peer's slice is memcpied into a local buffer before the iteration starts,
+  //  * kernel_writes_arrival_flag: the iteration's kernel signals its flag peer that the previous
+  //    iteration's output is ready,
+  //  * has_remote_c: the epilogue reduces into a peer's partial result (beta = 1).
+  // Iteration 0 never communicates.
+  static bool
+  has_memcpy(int iteration) {
+    return HasMemcpy && iteration > 0;
+  }
+
+  CUTLASS_HOST_DEVICE
+  static bool
+  kernel_writes_arrival_flag(int iteration) {
+    return KernelWritesArrivalFlag && iteration > 0;
+  }
+
+  static bool
+  has_remote_c(int iteration) {
+    return RemoteC && iteration > 0;
+  }
+
   // Construct tilers and index mappers for sharding across processors
   template <typename Tensor>
   CUTLASS_HOST_DEVICE
@@ -425,6 +454,23 @@ struct BaseSchedule {
     }
   }
 
+  // Rotating operands: the entire (untiled) buffered operand read in an iteration; the local
+  // tensor in iteration 0, and the buffer its memcpy writes to in the rest.
+  // Memcpies copy the peer's iteration 0 rotating operand into the iteration's rotating operand.
+  template <typename Tensor>
+  static auto
+  get_rotating_tensor_A(Tensor original_tensor, void * tensor_buffer_ptr, int device_idx, int iteration) {
+    static_assert(NumBuffersA > 0, "Tensor A is not buffered.");
+    return get_tensor_A(original_tensor, tensor_buffer_ptr, device_idx, iteration);
+  }
+
+  template <typename Tensor>
+  static auto
+  get_rotating_tensor_B(Tensor original_tensor, void * tensor_buffer_ptr, int device_idx, int iteration) {
+    static_assert(NumBuffersB > 0, "Tensor B is not buffered.");
+    return get_tensor_B(original_tensor, tensor_buffer_ptr, device_idx, iteration);
+  }
+
   template <typename ProblemShape>
   CUTLASS_HOST_DEVICE
   static auto
@@ -0,0 +1,134 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*!
+  \file Distributed GEMM Transports
+
+  NOTE: This API is __experimental__ and will change heavily over time.
+
+  A transport describes how a Distributed GEMM stage moves bytes and signals between devices.
+  Schedules only decide *what* is communicated in each iteration (via their device/iteration
+  mappings); the transport decides *how*. Every transport must provide:
+
+    SupportsDirectPeerAccess: whether kernels may load from and store to peer buffers directly
+      (schedules with a remote C, and schedules where the kernel writes arrival flags, require it.)
+
+    get_async(local_dst, remote_src, bytes, peer_idx, stream): host-side, stream-ordered copy of
+      `bytes` bytes from peer `peer_idx` into a local buffer. Must be capturable in a cuda graph,
+      and complete before any subsequent work on `stream` starts.
+
+    signal(flag_ptr, value, peer_idx): device-side write of an arrival flag owned by `peer_idx`.
+
+    atomic_add(ptr, value, peer_idx): device-side atomic add on a barrier counter owned by
+      `peer_idx`.
+
+  Pointers passed to a transport for peer `peer_idx` are always the ones the caller provided in
+  the `peer_idx`-th entry of the argument, workspace, and exclusive workspace arrays.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+
+#if defined(CUTLASS_ENABLE_NVSHMEM)
+#include <nvshmem.h>
+#include <nvshmemx.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::distributed::transports {
+
+// Default transport: all peers are mapped into this device's address space (i.e. an NVLink
+// domain with peer access enabled), so copies are device-to-device memcpies and signals are
+// plain loads and stores.
+struct PeerAccessTransport {
+  static constexpr bool SupportsDirectPeerAccess = true;
+
+  static cudaError_t
+  get_async(void* local_dst, void const* remote_src, size_t bytes, int peer_idx, cudaStream_t stream) {
+    return cudaMemcpyAsync(local_dst, remote_src, bytes, cudaMemcpyDeviceToDevice, stream);
+  }
+
+  template <class FlagType>
+  CUTLASS_DEVICE
+  static void
+  signal(FlagType* flag_ptr, FlagType value, int peer_idx) {
+    *flag_ptr = value;
+  }
+
+  template <class IntType>
+  CUTLASS_DEVICE
+  static void
+  atomic_add(IntType* ptr, IntType value, int peer_idx) {
+    atomicAdd(ptr, value);
+  }
+};
+
+#if defined(CUTLASS_ENABLE_NVSHMEM)
+
+// NVSHMEM transport: peers may be on other nodes, reachable over InfiniBand or any other
+// NVSHMEM-capable fabric. Requirements:
+//  * device indices are PE indices in NVSHMEM_TEAM_WORLD,
+//  * operands, buffer spaces and exclusive workspaces are allocated on the symmetric heap
+//    (nvshmem_malloc), and every entry in the per-peer pointer arrays holds this PE's own
+//    symmetric address for that object,
+//  * the target is compiled with relocatable device code and linked against NVSHMEM.
+// Kernels cannot dereference peer memory, so only schedules that memcpy their rotating operand
+// (All Gather schedules) are supported.
+struct NvshmemTransport {
+  static constexpr bool SupportsDirectPeerAccess = false;
+
+  static cudaError_t
+  get_async(void* local_dst, void const* remote_src, size_t bytes, int peer_idx, cudaStream_t stream) {
+    nvshmemx_getmem_on_stream(local_dst, remote_src, bytes, peer_idx, stream);
+    return cudaGetLastError();
+  }
+
+  CUTLASS_DEVICE
+  static void
+  signal(uint32_t* flag_ptr, uint32_t value, int peer_idx) {
+    // Order prior puts to the same peer before the flag
+    nvshmem_fence();
+    nvshmem_uint32_p(flag_ptr, value, peer_idx);
+  }
+
+  CUTLASS_DEVICE
+  static void
+  atomic_add(uint32_t* ptr, uint32_t value, int peer_idx) {
+    nvshmem_uint32_atomic_add(ptr, value, peer_idx);
+  }
+};
+
+#endif // defined(CUTLASS_ENABLE_NVSHMEM)
+
+} // namespace cutlass::distributed::transports
+
+///////////////////////////////////////////////////////////////////////////////
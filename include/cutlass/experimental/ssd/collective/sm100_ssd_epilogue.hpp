@@ -50,7 +50,7 @@ template<
   int   StagesOutput,
   bool  HasScaleD_,
   bool  HasBlockScaleD_>
-struct SsdEpilogue {
+struct Sm100SsdEpilogue {
 
   using TileShape = TileShape_;
   using ElementAcc = ElementAcc_;
@@ -532,4 +532,4 @@ struct SsdEpilogue {
   }
 };
 
-}  // namespace cutlass::fmha::collective
+}  // namespace cutlass::ssd::collective
@@ -39,7 +39,7 @@
 #include "cutlass/pipeline/pipeline.hpp"
 #include "cutlass/gemm/gemm.h"
 
-#include "../utils/pipeline.h"
+#include "cutlass/experimental/ssd/collective/sm100_ssd_pipeline.hpp"
 
 namespace cutlass::ssd::collective {
 
@@ -67,7 +67,7 @@ template<
   class TmemLayoutB_,
   class TmemLayoutQ_
 >
-struct SsdMainloopTmaWarpSpecialized {
+struct Sm100SsdMainloopTmaWarpSpecialized {
 
 
   using Element = Element_;
@@ -112,19 +112,19 @@ struct SsdMainloopTmaWarpSpecialized {
 
   using AtomThrShapeMNK = Shape<decltype(shape<0>(typename TiledMmaIntra1::ThrLayoutVMNK{})), _1, _1>;
 
-  using MainloopPipelineX = cutlass::PipelineTmaMultiConsumersAsync<
+  using MainloopPipelineX = PipelineTmaMultiConsumersAsync<
                                StagesInput,
                                ClusterShape,
                                AtomThrShapeMNK>;
-  using MainloopPipelineB = cutlass::PipelineTmaMultiConsumersAsync<
+  using MainloopPipelineB = PipelineTmaMultiConsumersAsync<
                                StagesInput,
                                ClusterShape,
                                AtomThrShapeMNK>;
-  using MainloopPipelineC = cutlass::PipelineTmaMultiConsumersAsync<
+  using MainloopPipelineC = PipelineTmaMultiConsumersAsync<
                                StagesInput,
                                ClusterShape,
                                AtomThrShapeMNK>;
-  using MainloopPipelineDelta = cutlass::PipelineTmaMultiConsumersAsync<
+  using MainloopPipelineDelta = PipelineTmaMultiConsumersAsync<
                                StagesInput,
                                ClusterShape,
                                AtomThrShapeMNK>;
@@ -166,6 +166,7 @@ struct SsdMainloopTmaWarpSpecialized {
   using LayoutB     = decltype(make_layout(make_shape(L, N, int32_t(0), int32_t(0)), make_stride(_1{}, int32_t(0), L, int32_t(0))));  // (L,N,C,B)
   using LayoutC     = decltype(make_layout(make_shape(L, N, int32_t(0), int32_t(0)), make_stride(_1{}, int32_t(0), L, int32_t(0))));  // (L,N,C,B)
   using LayoutDelta = decltype(make_layout(make_shape(L,    int32_t(0), int32_t(0)), make_stride(_1{},             L, int32_t(0))));  // (L,C,B)
+  using LayoutState = decltype(make_layout(make_shape(D, N, int32_t(0)), make_stride(N, _1{}, D*N)));                                 // (D,N,B)
 
   // Not support Mcast
   using GmemTiledCopyX = cute::SM90_TMA_LOAD;
@@ -182,6 +183,9 @@ struct SsdMainloopTmaWarpSpecialized {
     LayoutB        layout_B{};
     LayoutC        layout_C{};
     LayoutDelta    layout_Delta{};
+    // Optional initial state of each (batch, head), laid out as the final state. Zero if null.
+    const Element* ptr_InitState{nullptr};
+    LayoutState    layout_InitState{};
   };
 
   template <class TensorX, class ClusterShapeVMNK>
@@ -248,6 +252,8 @@ struct SsdMainloopTmaWarpSpecialized {
     TMA_C         tma_load_c;
     TensorDelta   tensor_delta;
     TensorDeltaA  tensor_delta_a;
+    const Element* ptr_init_state;
+    LayoutState   layout_init_state;
   };
 
   template<class ProblemShape>
@@ -298,7 +304,9 @@ struct SsdMainloopTmaWarpSpecialized {
       tma_load_b,
       tma_load_c,
       tensor_delta,
-      tensor_delta_a
+      tensor_delta_a,
+      args.ptr_InitState,
+      args.layout_InitState
     };
   }
 
@@ -341,7 +349,8 @@ struct SsdMainloopTmaWarpSpecialized {
   >
   CUTLASS_DEVICE
   void load_x_delta(
-    int const& blk_coord, Params const& params, ProblemShape const& problem_size,
+    int const& blk_coord, int const& chunk_start, int const& num_chunks,
+    Params const& params, ProblemShape const& problem_size,
     MainloopPipelineX& pipeline_x, PipelineStateX& pipeline_x_producer_state,
     MainloopPipelineDelta& pipeline_delta, PipelineStateDelta& pipeline_delta_producer_state,
     cute::tuple<GTensorX> const& load_inputs,
@@ -378,10 +387,9 @@ struct SsdMainloopTmaWarpSpecialized {
       // Disable multicast
       uint16_t mcast_mask_x = 0;
 
-      auto chunk = get<3>(problem_size);
       // Mainloop
       CUTLASS_PRAGMA_NO_UNROLL
-      for (int chunk_idx = 0; chunk_idx < chunk; ++chunk_idx) {
+      for (int chunk_idx = chunk_start; chunk_idx < chunk_start + num_chunks; ++chunk_idx) {
         int write_stage_x = pipeline_x_producer_state.index();
         int write_stage_delta = pipeline_delta_producer_state.index();
 
@@ -465,7 +473,8 @@ struct SsdMainloopTmaWarpSpecialized {
   >
   CUTLASS_DEVICE
   void load_b_c(
-    int const& blk_coord, Params const& params, ProblemShape const& problem_size,
+    int const& blk_coord, int const& chunk_start, int const& num_chunks,
+    Params const& params, ProblemShape const& problem_size,
     MainloopPipelineB& pipeline_b, PipelineStateB& pipeline_b_producer_state,
     MainloopPipelineC& pipeline_c, PipelineStateC& pipeline_c_producer_state,
     cute::tuple<GTensorB> const& load_inputs_b, cute::tuple<GTensorC> const& load_inputs_c, 
@@ -511,10 +520,9 @@ struct SsdMainloopTmaWarpSpecialized {
       uint16_t mcast_mask_b = 0;
       uint16_t mcast_mask_c = 0;
 
-      auto chunk = get<3>(problem_size);
       // Mainloop
       CUTLASS_PRAGMA_NO_UNROLL
-      for (int chunk_idx = 0; chunk_idx < chunk; ++chunk_idx) {
+      for (int chunk_idx = chunk_start; chunk_idx < chunk_start + num_chunks; ++chunk_idx) {
         int write_stage_b = pipeline_b_producer_state.index();
         int write_stage_c = pipeline_c_producer_state.index();
 
@@ -783,11 +791,13 @@ struct SsdMainloopTmaWarpSpecialized {
   }
 
   template<
+    class Params,
     class FragmentC_1, class FragmentC_2,
     class TensorStorage
   >
   CUTLASS_DEVICE
   auto state_init(
+    int const& state_coord, Params const& params,
     cute::tuple<FragmentC_1, FragmentC_2>& acc_inter,
     TensorStorage& shared_tensors) {
 
@@ -810,6 +820,20 @@ struct SsdMainloopTmaWarpSpecialized {
     clear(tTR_rP);
     clear(tTR_rP_compute);
 
+    if (params.ptr_init_state != nullptr) {
+      Tensor mS = make_tensor(make_gmem_ptr(params.ptr_init_state), params.layout_init_state);         // (D, N, B)
+      Tensor gS_ = mS(_,_,state_coord);
+      // Transpose to the (N, D) view of sP
+      Tensor gS = make_tensor(gS_.data(), make_layout(reverse(shape(gS_)), reverse(stride(gS_))));     // (N, D)
+      Tensor tTR_gS = thr_t2r.partition_D(gS);
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int ii = 0; ii < size(tTR_rP_compute); ++ii) {
+        tTR_rP_compute(ii) = static_cast<ElementAcc>(tTR_gS(ii));
+      }
+      type_convert<ElementAcc,Element>(tTR_rP_compute,tTR_rP);
+    }
+
     auto tiled_r2s = make_tiled_copy_D(Copy_Atom<CopyOpR2S, Element>{}, tiled_t2r);
     auto thr_r2s = tiled_r2s.get_slice(thread_idx);
     auto tRS_sP = thr_r2s.partition_D(sP(_,_,_0{}));
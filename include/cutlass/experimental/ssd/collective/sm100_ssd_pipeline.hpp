@@ -37,7 +37,7 @@
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-namespace cutlass {
+namespace cutlass::ssd::collective {
 
 using namespace cute;
 
@@ -222,4 +222,4 @@ private:
   }
 };
 
-}
+}  // namespace cutlass::ssd::collective
@@ -171,4 +171,4 @@ CUTE_DEVICE auto make_acc_into_op(Accumulator const& acc, OperandLayout_TV const
   return operand;
 }
 
-}  // namespace cutlass::fmha::collective
+}  // namespace cutlass::ssd::collective
@@ -54,7 +54,7 @@ template<
   bool  HAS_D_,
   bool  D_HAS_HDIM_,
   bool  HAS_Z_>
-struct SsdEpilogue {
+struct Sm90SsdEpilogue {
 
   using TileShape = TileShape_;
   using ElementAcc = ElementAcc_;
@@ -281,7 +281,8 @@ struct SsdEpilogue {
   >
   CUTLASS_DEVICE
   void load_z(
-    int const& blk_coord, Params const& params, ProblemShape const& problem_size,
+    int const& blk_coord, int const& chunk_start, int const& num_chunks,
+    Params const& params, ProblemShape const& problem_size,
     EpiLoadPipeline& pipeline, PipelineState& pipeline_state,
     cute::tuple<GTensor> const& load_inputs,
     TensorStorage& shared_tensors) {
@@ -311,10 +312,9 @@ struct SsdEpilogue {
         // Disable multicast
         uint16_t mcast_mask_z = 0;
 
-        auto chunk = get<3>(problem_size);
         // Mainloop
         CUTLASS_PRAGMA_NO_UNROLL
-        for (int chunk_idx = 0; chunk_idx < chunk; ++chunk_idx) {
+        for (int chunk_idx = chunk_start; chunk_idx < chunk_start + num_chunks; ++chunk_idx) {
           int write_stage = pipeline_state.index();
 
           // LOCK pipeline_state for _writing_
@@ -834,5 +834,5 @@ struct SsdEpilogue {
   }
 };
 
-}  // namespace cutlass::fmha::collective
+}  // namespace cutlass::ssd::collective
 
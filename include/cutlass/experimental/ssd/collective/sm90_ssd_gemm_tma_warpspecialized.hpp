@@ -33,7 +33,7 @@
 
 #include "cutlass/cutlass.h"
 #include "cutlass/gemm/collective/collective_builder.hpp"
-#include "../collective/common.hpp"
+#include "cutlass/experimental/ssd/collective/sm90_ssd_common.hpp"
 
 namespace cutlass::ssd::collective {
 
@@ -47,7 +47,7 @@ template<
   class TileShape_,
   int Stages_
 >
-struct SsdMainloopTmaWarpSpecialized {
+struct Sm90SsdMainloopTmaWarpSpecialized {
 
   using Element = Element_;
   using ElementDA = ElementDA_;
@@ -141,6 +141,7 @@ struct SsdMainloopTmaWarpSpecialized {
   using LayoutB     = decltype(make_layout(make_shape(L, N, int32_t(0), int32_t(0)), make_stride(_1{}, int32_t(0), L, int32_t(0))));  // (L,N,C,B)
   using LayoutC     = decltype(make_layout(make_shape(L, N, int32_t(0), int32_t(0)), make_stride(_1{}, int32_t(0), L, int32_t(0))));  // (L,N,C,B)
   using LayoutDelta = decltype(make_layout(make_shape(L,    int32_t(0), int32_t(0)), make_stride(_1{},             L, int32_t(0))));  // (L,C,B)
+  using LayoutState = decltype(make_layout(make_shape(D, N, int32_t(0)), make_stride(N, _1{}, D*N)));                                 // (D,N,B)
 
   // Not support Mcast
   using GmemTiledCopyX = cute::SM90_TMA_LOAD;
@@ -157,6 +158,9 @@ struct SsdMainloopTmaWarpSpecialized {
     LayoutB        layout_B{};
     LayoutC        layout_C{};
     LayoutDelta    layout_Delta{};
+    // Optional initial state, the scan starts from a zero state if null
+    const Element* ptr_InitState{nullptr};
+    LayoutState    layout_InitState{};
   };
 
   struct Params {
@@ -190,6 +194,8 @@ struct SsdMainloopTmaWarpSpecialized {
     TMA_C         tma_load_c;
     TensorDelta   tensor_delta;
     TensorDeltaA  tensor_delta_a;
+    const Element* ptr_init_state;
+    LayoutState   layout_init_state;
   };
 
   template<class ProblemShape>
@@ -249,7 +255,9 @@ struct SsdMainloopTmaWarpSpecialized {
       tma_load_b,
       tma_load_c,
       tensor_delta,
-      tensor_delta_a
+      tensor_delta_a,
+      args.ptr_InitState,
+      args.layout_InitState
     };
   }
 
@@ -289,7 +297,8 @@ struct SsdMainloopTmaWarpSpecialized {
   >
   CUTLASS_DEVICE
   void load_x(
-    int const& blk_coord, Params const& params, ProblemShape const& problem_size,
+    int const& blk_coord, int const& chunk_start, int const& num_chunks,
+    Params const& params, ProblemShape const& problem_size,
     MainloopPipeline& pipeline, PipelineState& pipeline_state,
     cute::tuple<GTensor> const& load_inputs,
     TensorStorage& shared_tensors) {
@@ -324,10 +333,9 @@ struct SsdMainloopTmaWarpSpecialized {
       // Disable multicast
       uint16_t mcast_mask_x = 0;
 
-      auto chunk = get<3>(problem_size);
       // Mainloop
       CUTLASS_PRAGMA_NO_UNROLL
-      for (int chunk_idx = 0; chunk_idx < chunk; ++chunk_idx) {
+      for (int chunk_idx = chunk_start; chunk_idx < chunk_start + num_chunks; ++chunk_idx) {
         int write_stage = pipeline_state.index();
 
         // LOCK pipeline_state for _writing_
@@ -398,7 +406,8 @@ struct SsdMainloopTmaWarpSpecialized {
   >
   CUTLASS_DEVICE
   void load_b_c(
-    int const& blk_coord, Params const& params, ProblemShape const& problem_size,
+    int const& blk_coord, int const& chunk_start, int const& num_chunks,
+    Params const& params, ProblemShape const& problem_size,
     MainloopPipelineB& pipeline_b, PipelineStateB& pipeline_state_b,
     MainloopPipelineC& pipeline_c, PipelineStateC& pipeline_state_c,
     cute::tuple<GTensorB> const& load_inputs_b,
@@ -449,10 +458,9 @@ struct SsdMainloopTmaWarpSpecialized {
       uint16_t mcast_mask_b = 0;
       uint16_t mcast_mask_c = 0;
 
-      auto chunk = get<3>(problem_size);
       // Mainloop
       CUTLASS_PRAGMA_NO_UNROLL
-      for (int chunk_idx = 0; chunk_idx < chunk; ++chunk_idx) {
+      for (int chunk_idx = chunk_start; chunk_idx < chunk_start + num_chunks; ++chunk_idx) {
         int write_stage_b = pipeline_state_b.index();
         int write_stage_c = pipeline_state_c.index();
 
@@ -532,7 +540,8 @@ struct SsdMainloopTmaWarpSpecialized {
   >
   CUTLASS_DEVICE
   void load_delta(
-    int const& blk_coord, Params const& params, ProblemShape const& problem_size,
+    int const& blk_coord, int const& chunk_start, int const& num_chunks,
+    Params const& params, ProblemShape const& problem_size,
     MainloopPipeline& pipeline, PipelineState& pipeline_state,
     TensorStorage& shared_tensors) {
     
@@ -552,10 +561,9 @@ struct SsdMainloopTmaWarpSpecialized {
       auto bulk_atom_dt = Copy_Atom<SM90_BULK_COPY_AUTO, Element>{};
       auto bulk_atom_dA = Copy_Atom<SM90_BULK_COPY_AUTO, ElementDA>{};
 
-      auto chunk = get<3>(problem_size);
       // Mainloop
       CUTLASS_PRAGMA_NO_UNROLL
-      for (int chunk_idx = 0; chunk_idx < chunk; ++chunk_idx) {
+      for (int chunk_idx = chunk_start; chunk_idx < chunk_start + num_chunks; ++chunk_idx) {
         int write_stage = pipeline_state.index();
 
         // LOCK pipeline_state for _writing_
@@ -948,38 +956,35 @@ struct SsdMainloopTmaWarpSpecialized {
   }
 
   template<
+    class Params,
     class TensorStorage
   >
   CUTLASS_DEVICE
-  auto state_init(TensorStorage& shared_tensors) {
+  auto state_init(
+    int const& state_coord, Params const& params,
+    TensorStorage& shared_tensors) {
     TiledMmaInter1 tiled_mma;
     Tensor tensor_state = partition_fragment_C(tiled_mma, take<0, 2>(TileShapeInterBMM1{}));
 
-    auto synchronize = [&] () { cutlass::arch::NamedBarrier::sync(128, cutlass::arch::ReservedNamedBarriers::TransposeBarrier); };
     int thread_idx = int(threadIdx.x % 128);
 
-    Tensor sP_ = make_tensor(make_smem_ptr(shared_tensors.smem_p.data()), SmemLayoutP{});           // (D, N)
-    // Transpose
-    auto sP_tmp = make_tensor(sP_.data(), make_layout(reverse(shape(sP_)), reverse(stride(sP_))));  // (N, D)
-    Tensor sP = as_position_independent_swizzle_tensor(sP_tmp); 
-
-    using CopyAtomC = Copy_Atom<SM90_U32x4_STSM_N, Element>;
-    TiledCopy tiled_r2s_atom = make_tiled_copy_C(CopyAtomC{}, tiled_mma);
-
-    using CopyOpR2S = SM90_U16x8_STSM_T;
-    TiledCopy tiled_r2s = make_tiled_copy_S(Copy_Atom<CopyOpR2S, Element>{}, tiled_r2s_atom);
-    ThrCopy thread_r2s = tiled_r2s.get_slice(thread_idx);
-    Tensor tRS_rP = make_tensor<Element>(shape(thread_r2s.partition_S(sP)));
-    Tensor tRS_sP = thread_r2s.partition_D(sP);
-
-    clear(tRS_rP);
     clear(tensor_state);
-    // Store P
-    copy(tiled_r2s, tRS_rP, tRS_sP);
+    if (params.ptr_init_state != nullptr) {
+      Tensor mS = make_tensor(make_gmem_ptr(params.ptr_init_state), params.layout_init_state);         // (D, N, B)
+      Tensor gS_ = mS(_,_,state_coord);                                                               // (D, N)
+      // Transpose
+      Tensor gS = make_tensor(gS_.data(), make_layout(reverse(shape(gS_)), reverse(stride(gS_))));     // (N, D)
+      Tensor tSgS = tiled_mma.get_thread_slice(thread_idx).partition_C(gS);
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int ii = 0; ii < size(tensor_state); ++ii) {
+        tensor_state(ii) = static_cast<ElementAcc>(tSgS(ii));
+      }
+    }
+
+    // The first chunk reads the initial state from smem P
+    post_inter_2(tensor_state, shared_tensors);
 
-    cutlass::arch::fence_view_async_shared(); // ensure smem writes are visible to TMA
-    synchronize(); // ensure all threads have issued their async fence
-    
     return make_tuple(tensor_state);
   }
   template<
@@ -1143,4 +1148,4 @@ struct SsdMainloopTmaWarpSpecialized {
   }
 };
 
-}  // namespace cutlass::fmha::collective
+}  // namespace cutlass::ssd::collective
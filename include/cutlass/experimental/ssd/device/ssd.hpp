@@ -34,6 +34,7 @@
 // common
 #include "cutlass/cutlass.h"
 #include "cutlass/device_kernel.h"
+#include "cute/layout.hpp"
 
 #if !defined(__CUDACC_RTC__)
 #include "cutlass/cluster_launch.hpp"
@@ -267,6 +268,6 @@ public:
 
 ////////////////////////////////////////////////////////////////////////////////
 
-} // namespace cutlass::device
+} // namespace cutlass::ssd::device
 
 ////////////////////////////////////////////////////////////////////////////////
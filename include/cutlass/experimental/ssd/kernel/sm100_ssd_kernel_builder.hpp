@@ -31,10 +31,10 @@
 
 #pragma once
 
-#include "../collective/sm100_ssd_epilogue.hpp"
-#include "../collective/sm100_ssd_gemm_tma_warpspecialized.hpp"
-#include "../kernel/sm100_ssd_kernel_tma_warpspecialized.hpp"
-#include "../kernel/sm100_ssd_tile_scheduler.hpp"
+#include "cutlass/experimental/ssd/collective/sm100_ssd_epilogue.hpp"
+#include "cutlass/experimental/ssd/collective/sm100_ssd_gemm_tma_warpspecialized.hpp"
+#include "cutlass/experimental/ssd/kernel/sm100_ssd_kernel_tma_warpspecialized.hpp"
+#include "cutlass/experimental/ssd/kernel/ssd_tile_scheduler.hpp"
 
 #include "cutlass/cutlass.h"
 #include "cutlass/epilogue/collective/collective_builder.hpp"
@@ -239,7 +239,7 @@ struct Sm100SsdBuilder {
       append(make_shape(get<1>(TileShape{}), get<2>(TileShape{})), Int<1>{}),
       Step<_2,_1,_3>{}));
 
-  using CollectiveMainloop = cutlass::ssd::collective::SsdMainloopTmaWarpSpecialized<
+  using CollectiveMainloop = cutlass::ssd::collective::Sm100SsdMainloopTmaWarpSpecialized<
     Element, ElementDA, ElementAcc, ElementY, TileShape,
     StagesInput, StagesOutput,
     TiledMmaIntra1, TiledMmaIntra2,
@@ -247,12 +247,12 @@ struct Sm100SsdBuilder {
     SmemLayoutX, SmemLayoutB, SmemLayoutC, SmemLayoutP,
     SmemLayoutBT, SmemLayoutPT, SmemLayoutQ,
     TmemLayoutB, TmemLayoutQ>;
-  using CollectiveEpilogue = cutlass::ssd::collective::SsdEpilogue<
+  using CollectiveEpilogue = cutlass::ssd::collective::Sm100SsdEpilogue<
     ElementAcc, Element, ElementDA, TileShape,
     EpilogueTile, SmemLayoutY, SmemLayoutStoreP, SmemLayoutXT, StagesInput, StagesOutput,
     HAS_D_, D_HAS_HDIM_>;
   using TileScheduler = cutlass::ssd::kernel::PersistentTileScheduler;
-  using Kernel = cutlass::ssd::kernel::SsdKernelTmaWarpSpecialized<CollectiveMainloop, CollectiveEpilogue, TileScheduler>;
+  using Kernel = cutlass::ssd::kernel::Sm100SsdKernelTmaWarpSpecialized<CollectiveMainloop, CollectiveEpilogue, TileScheduler>;
 
 };
 
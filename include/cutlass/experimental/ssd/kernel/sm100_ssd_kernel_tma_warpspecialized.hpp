@@ -45,7 +45,7 @@ template<
   class CollectiveEpilogue_,
   class TileScheduler_
 >
-struct SsdKernelTmaWarpSpecialized {
+struct Sm100SsdKernelTmaWarpSpecialized {
 
   using CollectiveMainloop = CollectiveMainloop_;
   using CollectiveEpilogue = CollectiveEpilogue_;
@@ -146,6 +146,8 @@ struct SsdKernelTmaWarpSpecialized {
     typename CollectiveMainloop::Arguments mainloop;
     typename CollectiveEpilogue::Arguments epilogue;
     KernelHardwareInfo hw_info;
+    // Optional B + 1 token offsets of packed variable-length sequences, see PersistentTileScheduler
+    int const* ptr_cu_seqlens{nullptr};
   };
 
   struct Params {
@@ -181,7 +183,7 @@ struct SsdKernelTmaWarpSpecialized {
         args.problem_size,
         CollectiveMainloop::to_underlying_arguments(args.problem_size, args.mainloop, workspace),
         CollectiveEpilogue::to_underlying_arguments(args.problem_size, args.epilogue, workspace),
-        TileScheduler::to_underlying_arguments(args.problem_size, args.hw_info, ClusterShape{}, TileShape{})
+        TileScheduler::to_underlying_arguments(args.problem_size, args.hw_info, ClusterShape{}, TileShape{}, args.ptr_cu_seqlens)
     };
   }
 
@@ -200,10 +202,6 @@ struct SsdKernelTmaWarpSpecialized {
       PreIntra      = 8
     };
 
-    // Parameters
-    // [G, B, EH, C, L, D, N]
-    auto C = get<3>(params.problem_size);
-
     // Shared memory.
     auto& storage = *reinterpret_cast<SharedStorage*>(smem);
   
@@ -391,6 +389,8 @@ struct SsdKernelTmaWarpSpecialized {
       for (; tile_scheduler.is_valid(); ++tile_scheduler) {
         auto blk_coord = tile_scheduler.get_block_coord();
         auto blk_coord_eh = tile_scheduler.get_block_coord_eh();
+        auto chunk_start = tile_scheduler.get_chunk_start();
+        auto num_chunks = tile_scheduler.get_num_chunks();
         // Load D
         collective_epilogue.load_d(
           blk_coord_eh, params.epilogue, params.problem_size,
@@ -401,7 +401,7 @@ struct SsdKernelTmaWarpSpecialized {
         // Load Delta
         // Load DeltaA
         collective_mainloop.load_x_delta(
-          blk_coord, params.mainloop, params.problem_size,
+          blk_coord, chunk_start, num_chunks, params.mainloop, params.problem_size,
           pipeline_x, mainloop_pipe_x_producer,
           pipeline_delta, mainloop_pipe_delta_producer,
           load_input,
@@ -414,10 +414,12 @@ struct SsdKernelTmaWarpSpecialized {
       auto load_input_c = collective_mainloop.load_c_init(params.mainloop, params.problem_size);
       for (; tile_scheduler.is_valid(); ++tile_scheduler) {
         auto blk_coord = tile_scheduler.get_block_coord_b();
+        auto chunk_start = tile_scheduler.get_chunk_start();
+        auto num_chunks = tile_scheduler.get_num_chunks();
         // Load B
         // Load C
         collective_mainloop.load_b_c(
-          blk_coord, params.mainloop, params.problem_size,
+          blk_coord, chunk_start, num_chunks, params.mainloop, params.problem_size,
           pipeline_b, mainloop_pipe_b_producer,
           pipeline_c, mainloop_pipe_c_producer,
           load_input_b, load_input_c,
@@ -428,7 +430,8 @@ struct SsdKernelTmaWarpSpecialized {
     else if (warp_category == WarpCategory::MMAIntra) {
       auto [mma_inputs_1, mma_inputs_2] = collective_mainloop.mma_intra_init(storage.tensors.mainloop);
       for (; tile_scheduler.is_valid(); ++tile_scheduler) {
-        for (int chunk = 0; chunk < C; ++chunk) {
+        auto num_chunks = tile_scheduler.get_num_chunks();
+        for (int chunk = 0; chunk < num_chunks; ++chunk) {
           collective_mainloop.mma_intra(
             pipeline_b, mainloop_pipe_b_consumer,
             pipeline_c, mainloop_pipe_c_consumer,
@@ -443,7 +446,8 @@ struct SsdKernelTmaWarpSpecialized {
     else if (warp_category == WarpCategory::MMAInter) {
       auto [mma_inputs_1, mma_inputs_2] = collective_mainloop.mma_inter_init(storage.tensors.mainloop);
       for (; tile_scheduler.is_valid(); ++tile_scheduler) {
-        for (int chunk = 0; chunk < C; ++chunk) {
+        auto num_chunks = tile_scheduler.get_num_chunks();
+        for (int chunk = 0; chunk < num_chunks; ++chunk) {
           collective_mainloop.mma_inter(
             pipeline_c, mainloop_pipe_c_consumer,
             pipeline_x, mainloop_pipe_x_consumer,
@@ -459,8 +463,10 @@ struct SsdKernelTmaWarpSpecialized {
       for (; tile_scheduler.is_valid(); ++tile_scheduler) {
         auto blk_coord = tile_scheduler.get_block_coord();
         auto blk_coord_eh = tile_scheduler.get_block_coord_eh();
+        auto chunk_start = tile_scheduler.get_chunk_start();
+        auto chunk_end = chunk_start + tile_scheduler.get_num_chunks();
         bool is_first_iteration = true;
-        for (int chunk = 0; chunk < C; ++chunk) {
+        for (int chunk = chunk_start; chunk < chunk_end; ++chunk) {
           collective_mainloop.pre_intra(
             pipeline_delta, mainloop_pipe_delta_consumer,
             pipeline_intra, mainloop_pipe_intra_consumer,
@@ -493,8 +499,11 @@ struct SsdKernelTmaWarpSpecialized {
     }
     else if (warp_category == WarpCategory::PreInter) {
       for (; tile_scheduler.is_valid(); ++tile_scheduler) {
-        auto [tState] = collective_mainloop.state_init(mma_output_inter, storage.tensors.mainloop);
-        for (int chunk = 0; chunk < C; ++chunk) {
+        auto state_coord = tile_scheduler.get_state_coord();
+        auto [tState] = collective_mainloop.state_init(
+          state_coord, params.mainloop, mma_output_inter, storage.tensors.mainloop);
+        auto num_chunks = tile_scheduler.get_num_chunks();
+        for (int chunk = 0; chunk < num_chunks; ++chunk) {
           collective_mainloop.pre_inter(
             pipeline_b, mainloop_pipe_b_consumer,
             pipeline_delta, mainloop_pipe_delta_consumer,
@@ -504,10 +513,9 @@ struct SsdKernelTmaWarpSpecialized {
             storage.tensors.mainloop
           );
         }
-        auto blk_coord = tile_scheduler.get_block_coord();
         // Epilogue Fstate store
         collective_epilogue.store_p(
-          blk_coord, params.epilogue, params.problem_size,
+          state_coord, params.epilogue, params.problem_size,
           epi_store_p_pipeline, epi_store_p_pipe_producer_state,
           storage.tensors.mainloop
         );
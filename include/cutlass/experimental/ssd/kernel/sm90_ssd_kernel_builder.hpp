@@ -31,10 +31,10 @@
 
 #pragma once
 
-#include "../collective/sm90_ssd_epilogue.hpp"
-#include "../collective/sm90_ssd_gemm_tma_warpspecialized.hpp"
-#include "../kernel/sm90_ssd_kernel_tma_warpspecialized.hpp"
-#include "../kernel/sm90_ssd_tile_scheduler.hpp"
+#include "cutlass/experimental/ssd/collective/sm90_ssd_epilogue.hpp"
+#include "cutlass/experimental/ssd/collective/sm90_ssd_gemm_tma_warpspecialized.hpp"
+#include "cutlass/experimental/ssd/kernel/sm90_ssd_kernel_tma_warpspecialized.hpp"
+#include "cutlass/experimental/ssd/kernel/ssd_tile_scheduler.hpp"
 
 #include "cutlass/cutlass.h"
 #include "cutlass/epilogue/collective/collective_builder.hpp"
@@ -102,14 +102,14 @@ struct Sm90SsdBuilder {
       SmemLayoutAtomPartialY{}, 
       make_shape(partial_m, partial_n, Int<StagesY>{})));
                                     
-  using CollectiveMainloop = cutlass::ssd::collective::SsdMainloopTmaWarpSpecialized<Element, ElementDA, ElementAcc, ElementY, TileShape, StagesX>;
-  using CollectiveEpilogue = cutlass::ssd::collective::SsdEpilogue<
+  using CollectiveMainloop = cutlass::ssd::collective::Sm90SsdMainloopTmaWarpSpecialized<Element, ElementDA, ElementAcc, ElementY, TileShape, StagesX>;
+  using CollectiveEpilogue = cutlass::ssd::collective::Sm90SsdEpilogue<
     ElementAcc, ElementY, TileShape,
     EpilogueTile, SmemLayoutX, SmemLayoutY, SmemLayoutPartialY, typename CollectiveMainloop::SmemLayoutP, SmemLayoutZ,
     StagesX, StagesY, StagesZ,
     HAS_D, D_HAS_HDIM, HAS_Z>;
   using TileScheduler = cutlass::ssd::kernel::PersistentTileScheduler;
-  using Kernel = cutlass::ssd::kernel::SsdKernelTmaWarpSpecialized<CollectiveMainloop, CollectiveEpilogue, TileScheduler>;
+  using Kernel = cutlass::ssd::kernel::Sm90SsdKernelTmaWarpSpecialized<CollectiveMainloop, CollectiveEpilogue, TileScheduler>;
 
 };
 
@@ -45,7 +45,7 @@ template<
   class CollectiveEpilogue,
   class TileScheduler
 >
-struct SsdKernelTmaWarpSpecialized {
+struct Sm90SsdKernelTmaWarpSpecialized {
 
   static const int NumLoadWarpGroups = 1;
   // hard code
@@ -126,6 +126,8 @@ struct SsdKernelTmaWarpSpecialized {
     typename CollectiveMainloop::Arguments mainloop;
     typename CollectiveEpilogue::Arguments epilogue;
     KernelHardwareInfo hw_info;
+    // Optional B + 1 token offsets of packed variable-length sequences, see PersistentTileScheduler
+    int const* ptr_cu_seqlens{nullptr};
   };
 
   struct Params {
@@ -169,7 +171,7 @@ struct SsdKernelTmaWarpSpecialized {
         args.problem_size,
         CollectiveMainloop::to_underlying_arguments(args.problem_size, args.mainloop, workspace),
         CollectiveEpilogue::to_underlying_arguments(args.problem_size, args.epilogue, workspace),
-        TileScheduler::to_underlying_arguments(args.problem_size, args.hw_info, ClusterShape{}, TileShape{})
+        TileScheduler::to_underlying_arguments(args.problem_size, args.hw_info, ClusterShape{}, TileShape{}, args.ptr_cu_seqlens)
     };
   }
 
@@ -190,10 +192,6 @@ struct SsdKernelTmaWarpSpecialized {
     };
 
 
-    // Parameters
-    // [G, B, EH, C, L, D, N]
-    auto C = get<3>(params.problem_size);
-
     // Shared memory.
     auto& storage = *reinterpret_cast<SharedStorage*>(smem);
   
@@ -351,9 +349,11 @@ struct SsdKernelTmaWarpSpecialized {
         auto load_input = collective_mainloop.load_x_init(params.mainloop, params.problem_size);
         for (; tile_scheduler.is_valid(); ++tile_scheduler) {
           auto blk_coord = tile_scheduler.get_block_coord();
+          auto chunk_start = tile_scheduler.get_chunk_start();
+          auto num_chunks = tile_scheduler.get_num_chunks();
           // Load X
           collective_mainloop.load_x(
-            blk_coord, params.mainloop, params.problem_size,
+            blk_coord, chunk_start, num_chunks, params.mainloop, params.problem_size,
             pipeline_x, mainloop_pipe_x_producer,
             load_input,
             storage.tensors.mainloop
@@ -368,6 +368,8 @@ struct SsdKernelTmaWarpSpecialized {
         for (; tile_scheduler.is_valid(); ++tile_scheduler) {
           auto blk_coord = tile_scheduler.get_block_coord();
           auto blk_coord_eh = tile_scheduler.get_block_coord_eh();
+          auto chunk_start = tile_scheduler.get_chunk_start();
+          auto num_chunks = tile_scheduler.get_num_chunks();
           // Epiload 
           collective_epilogue.load_d(
             blk_coord_eh, params.epilogue, params.problem_size,
@@ -377,7 +379,7 @@ struct SsdKernelTmaWarpSpecialized {
           // Load Delta
           // Load DeltaA
           collective_mainloop.load_delta(
-            blk_coord, params.mainloop, params.problem_size,
+            blk_coord, chunk_start, num_chunks, params.mainloop, params.problem_size,
             pipeline_delta, mainloop_pipe_delta_producer,
             storage.tensors.mainloop
           );
@@ -392,9 +394,11 @@ struct SsdKernelTmaWarpSpecialized {
         auto load_input_c = collective_mainloop.load_c_init(params.mainloop, params.problem_size);
         for (; tile_scheduler.is_valid(); ++tile_scheduler) {
           auto blk_coord = tile_scheduler.get_block_coord_b();
+          auto chunk_start = tile_scheduler.get_chunk_start();
+          auto num_chunks = tile_scheduler.get_num_chunks();
           // Load B
           collective_mainloop.load_b_c(
-            blk_coord, params.mainloop, params.problem_size,
+            blk_coord, chunk_start, num_chunks, params.mainloop, params.problem_size,
             pipeline_b, mainloop_pipe_b_producer,
             pipeline_c, mainloop_pipe_c_producer,
             load_input_b,
@@ -413,9 +417,11 @@ struct SsdKernelTmaWarpSpecialized {
         auto load_input = collective_epilogue.load_z_init(params.epilogue, params.problem_size);
         for (; tile_scheduler.is_valid(); ++tile_scheduler) {
           auto blk_coord = tile_scheduler.get_block_coord();
-          // Load X
+          auto chunk_start = tile_scheduler.get_chunk_start();
+          auto num_chunks = tile_scheduler.get_num_chunks();
+          // Load Z
           collective_epilogue.load_z(
-            blk_coord, params.epilogue, params.problem_size,
+            blk_coord, chunk_start, num_chunks, params.epilogue, params.problem_size,
             pipeline_z, epi_load_pipe_z_producer,
             load_input,
             storage.tensors.epilogue
@@ -432,7 +438,9 @@ struct SsdKernelTmaWarpSpecialized {
       TileScheduler tile_scheduler{params.tile_scheduler};
       cutlass::arch::warpgroup_reg_alloc<MmaRegisterRequirement>();
       for (; tile_scheduler.is_valid(); ++tile_scheduler) {
-        for (int chunk = 0; chunk < C; ++chunk) {
+        auto chunk_start = tile_scheduler.get_chunk_start();
+        auto chunk_end = chunk_start + tile_scheduler.get_num_chunks();
+        for (int chunk = chunk_start; chunk < chunk_end; ++chunk) {
           auto blk_coord = tile_scheduler.get_block_coord();
           // IntraBMM1
           // Wait B
@@ -471,10 +479,13 @@ struct SsdKernelTmaWarpSpecialized {
       TileScheduler tile_scheduler{params.tile_scheduler};
       cutlass::arch::warpgroup_reg_alloc<MmaRegisterRequirement>();
       for (; tile_scheduler.is_valid(); ++tile_scheduler) {
-        auto [tState] = collective_mainloop.state_init(storage.tensors.mainloop);
+        auto state_coord = tile_scheduler.get_state_coord();
+        auto [tState] = collective_mainloop.state_init(state_coord, params.mainloop, storage.tensors.mainloop);
         auto blk_coord_eh = tile_scheduler.get_block_coord_eh();
+        auto chunk_start = tile_scheduler.get_chunk_start();
+        auto chunk_end = chunk_start + tile_scheduler.get_num_chunks();
         bool is_first_iteration = true;
-        for (int chunk = 0; chunk < C; ++chunk) {
+        for (int chunk = chunk_start; chunk < chunk_end; ++chunk) {
           auto blk_coord = tile_scheduler.get_block_coord();
           // Pre Inter1
           // Wait delta
@@ -538,10 +549,9 @@ struct SsdKernelTmaWarpSpecialized {
           ++epi_load_pipe_d_consumer;
         }
         
-        auto blk_coord = tile_scheduler.get_block_coord();
         // Epilogue Fstate store
         collective_epilogue.store_p(
-          blk_coord, params.epilogue, params.problem_size,
+          state_coord, params.epilogue, params.problem_size,
           epi_store_p_pipeline, epi_store_p_pipe_producer_state,
           storage.tensors.mainloop
         );
@@ -550,4 +560,4 @@ struct SsdKernelTmaWarpSpecialized {
   }
 };
 
-}  // namespace cutlass::fmha::kernel
+}  // namespace cutlass::ssd::kernel
@@ -31,28 +31,20 @@
 
 #pragma once
 
-#include <algorithm>
-#include <random>
-
-#include "cutlass/coord.h"
-#include "cutlass/util/host_tensor.h"
-#include "cutlass/tensor_view.h"
-#include "cutlass/util/tensor_view_io.h"
-#include "cutlass/util/reference/host/gemm.h"
+#include "cutlass/cutlass.h"
 #include "cutlass/arch/arch.h"
-#include "cutlass/layout/matrix.h"
-#include "cutlass/util/packed_stride.hpp"
+#include "cutlass/kernel_hardware_info.hpp"
 #include "cutlass/cuda_host_adapter.hpp"
 
-#include "cute/int_tuple.hpp"
-#include "cute/atom/mma_traits_sm100.hpp"
-#include "cute/util/debug.hpp"
-#include "cute/config.hpp"
+#include "cute/tensor.hpp"
 
 namespace cutlass::ssd::kernel {
 
 using namespace cute;
 
+// Inclusive prefix sum of dt * A over the L tokens of every chunk, consumed by the chunked scan as
+// `ptr_DeltaA`. The input and output tensors are packed as (L,C,EH*B). For variable-length batches
+// packed along the chunk mode, launch with B = 1 and C equal to the total number of chunks.
 template<
   class Element_,
   class ElementD_,
@@ -191,4 +183,4 @@ private:
 
 };
 
-} // End namespace cutlass
+} // namespace cutlass::ssd::kernel
@@ -0,0 +1,228 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/arch/arch.h"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/cuda_host_adapter.hpp"
+
+#include "cute/tensor.hpp"
+
+namespace cutlass::ssd::kernel {
+
+using namespace cute;
+
+// Single-token step of the SSD recurrence for autoregressive decoding after a chunked scan.
+//
+// For every (batch, head) pair the state S (D x N) is advanced in place by one token
+//   S = exp(dt * A) * S + dt * x * B^T
+//   y = S * C + D * x            (D optional)
+//   y = y * z * sigmoid(z)       (Z optional)
+// where dt is `ptr_Delta` and dt * A is `ptr_DeltaA`. The state has the layout of the final state
+// written by the chunked scan, so the output of a prefill can be passed directly. One block
+// processes one (batch, head) pair: each warp owns rows d of the state and its lanes stride over
+// n, so that state accesses are coalesced and y is reduced within the warp.
+template<
+  class Element_,
+  class ElementDA_,
+  class ElementAcc_,
+  bool HAS_D_ = true,
+  bool HAS_Z_ = true>
+struct SsdDecodeKernel {
+  using Element = Element_;
+  using ElementDA = ElementDA_;
+  using ElementAcc = ElementAcc_;
+  static constexpr bool HAS_D = HAS_D_;
+  static constexpr bool HAS_Z = HAS_Z_;
+
+  // Required by `device_kernel`
+  static constexpr int MaxThreadsPerBlock = 128;
+  static constexpr int MinBlocksPerMultiprocessor = 1;
+  using ArchTag = arch::Sm80;
+
+  static constexpr int NumWarps = MaxThreadsPerBlock / NumThreadsPerWarp;
+
+  struct SharedStorage {
+    /* empty, no smem needed */
+  };
+
+  static constexpr int SharedStorageSize = sizeof(SharedStorage);
+
+  using ProblemShape = cute::tuple<int, int, int, int, int>; // g, b, eh, d, n
+
+  using LayoutX     = Layout<Shape<int, int>, Stride<_1, int>>;                // (D,EH*B)
+  using LayoutB     = Layout<Shape<int, int>, Stride<_1, int>>;                // (N,G*B)
+  using LayoutDelta = Layout<Shape<int>, Stride<int>>;                         // (EH*B)
+  using LayoutD     = Layout<Shape<int, int>, Stride<int, int>>;               // (D,EH), stride 0 along D if shared by the head
+  using LayoutState = Layout<Shape<int, int, int>, Stride<int, _1, int>>;      // (D,N,EH*B)
+
+  // X, Z and Y share layout_X, B and C share layout_B, Delta and DeltaA share layout_Delta
+  struct DecodeArguments {
+    const Element* ptr_X{nullptr};
+    const ElementDA* ptr_DeltaA{nullptr};
+    const Element* ptr_Delta{nullptr};
+    const Element* ptr_B{nullptr};
+    const Element* ptr_C{nullptr};
+    const Element* ptr_D{nullptr};
+    const Element* ptr_Z{nullptr};
+    Element* ptr_Y{nullptr};
+    Element* ptr_State{nullptr};
+    LayoutX     layout_X{};
+    LayoutB     layout_B{};
+    LayoutDelta layout_Delta{};
+    LayoutD     layout_D{};
+    LayoutState layout_State{};
+  };
+
+  struct Arguments {
+    ProblemShape problem_shape{};
+    DecodeArguments decode{};
+    KernelHardwareInfo hw_info{};
+  };
+
+  struct Params {
+    ProblemShape problem_shape{};
+    DecodeArguments decode{};
+    KernelHardwareInfo hw_info{};
+  };
+
+  static Params
+  to_underlying_arguments(Arguments const& args, void* workspace) {
+    return Params{args.problem_shape, args.decode, args.hw_info};
+  }
+
+  static Status
+  can_implement(Arguments const& args) {
+    auto [G, B, EH, D, N] = args.problem_shape;
+    if (G <= 0 || B <= 0 || EH <= 0 || D <= 0 || N <= 0 || EH % G != 0) {
+      CUTLASS_TRACE_HOST("  can_implement: invalid problem shape, EH must be a multiple of G.\n");
+      return Status::kErrorInvalidProblem;
+    }
+    auto const& decode = args.decode;
+    if (decode.ptr_X == nullptr || decode.ptr_DeltaA == nullptr || decode.ptr_Delta == nullptr ||
+        decode.ptr_B == nullptr || decode.ptr_C == nullptr || decode.ptr_Y == nullptr || decode.ptr_State == nullptr) {
+      CUTLASS_TRACE_HOST("  can_implement: missing input or output pointer.\n");
+      return Status::kErrorInvalidProblem;
+    }
+    if ((HAS_D && decode.ptr_D == nullptr) || (HAS_Z && decode.ptr_Z == nullptr)) {
+      CUTLASS_TRACE_HOST("  can_implement: D and Z must be provided when enabled.\n");
+      return Status::kErrorInvalidProblem;
+    }
+    return Status::kSuccess;
+  }
+
+  static size_t
+  get_workspace_size(Arguments const& args) {
+    return size_t(0);
+  }
+
+  static Status
+  initialize_workspace(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr,
+    CudaHostAdapter *cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  static dim3
+  get_grid_shape(Params const& params) {
+    auto [G, B, EH, D, N] = params.problem_shape;
+    return dim3(B*EH, 1, 1);
+  }
+
+  static dim3
+  get_block_shape() {
+    return dim3(MaxThreadsPerBlock, 1, 1);
+  }
+
+  CUTLASS_DEVICE
+  void
+  operator()(Params params, [[maybe_unused]] char* smem_buf = nullptr) {
+    auto [G, B, EH, D, N] = params.problem_shape;
+    auto const& decode = params.decode;
+
+    int blk_idx = blockIdx.x;
+    int warp_idx = threadIdx.x / NumThreadsPerWarp;
+    int lane_idx = threadIdx.x % NumThreadsPerWarp;
+
+    int b = blk_idx / EH;
+    int eh = blk_idx % EH;
+    int g = eh / (EH / G);
+
+    auto mX     = make_tensor(make_gmem_ptr(decode.ptr_X),      decode.layout_X);
+    auto mZ     = make_tensor(make_gmem_ptr(decode.ptr_Z),      decode.layout_X);
+    auto mY     = make_tensor(make_gmem_ptr(decode.ptr_Y),      decode.layout_X);
+    auto mB     = make_tensor(make_gmem_ptr(decode.ptr_B),      decode.layout_B);
+    auto mC     = make_tensor(make_gmem_ptr(decode.ptr_C),      decode.layout_B);
+    auto mDelta = make_tensor(make_gmem_ptr(decode.ptr_Delta),  decode.layout_Delta);
+    auto mDA    = make_tensor(make_gmem_ptr(decode.ptr_DeltaA), decode.layout_Delta);
+    auto mD     = make_tensor(make_gmem_ptr(decode.ptr_D),      decode.layout_D);
+    auto mS     = make_tensor(make_gmem_ptr(decode.ptr_State),  decode.layout_State);
+
+    auto tX = mX(_,blk_idx);
+    auto tZ = mZ(_,blk_idx);
+    auto tY = mY(_,blk_idx);
+    auto tB = mB(_,G*b+g);
+    auto tC = mC(_,G*b+g);
+    auto tS = mS(_,_,blk_idx);
+
+    ElementAcc delta = static_cast<ElementAcc>(mDelta(blk_idx));
+    ElementAcc decay = expf(static_cast<ElementAcc>(mDA(blk_idx)));
+
+    for (int d = warp_idx; d < D; d += NumWarps) {
+      ElementAcc x = static_cast<ElementAcc>(tX(d));
+      ElementAcc dx = delta * x;
+      ElementAcc y = ElementAcc(0);
+      for (int n = lane_idx; n < N; n += NumThreadsPerWarp) {
+        ElementAcc s = decay * static_cast<ElementAcc>(tS(d,n)) + dx * static_cast<ElementAcc>(tB(n));
+        tS(d,n) = static_cast<Element>(s);
+        y += s * static_cast<ElementAcc>(tC(n));
+      }
+      CUTLASS_PRAGMA_UNROLL
+      for (int offset = NumThreadsPerWarp / 2; offset > 0; offset /= 2) {
+        y += __shfl_xor_sync(0xffffffff, y, offset);
+      }
+      if (lane_idx == 0) {
+        if constexpr (HAS_D) {
+          y += static_cast<ElementAcc>(mD(d,eh)) * x;
+        }
+        if constexpr (HAS_Z) {
+          ElementAcc z = static_cast<ElementAcc>(tZ(d));
+          y = y * z / (ElementAcc(1) + expf(-z));
+        }
+        tY(d) = static_cast<Element>(y);
+      }
+    }
+  }
+};
+
+} // namespace cutlass::ssd::kernel
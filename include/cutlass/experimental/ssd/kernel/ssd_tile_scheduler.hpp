@@ -39,11 +39,27 @@ namespace cutlass::ssd::kernel {
 
 ////////////////////////////////////////////////////////////////////////////////
 
+// Persistent scheduler assigning one (batch, head) pair per block.
+//
+// For fixed-length batches every block scans all C chunks of its sequence and the sequence tensors
+// are indexed by b * EH + eh (X, Delta, Y, Z) and by b * G + g (B, C).
+//
+// For variable-length batches (`ptr_cu_seqlens != nullptr`) the B sequences are packed along the
+// chunk mode of tensors without a batch mode: X, Delta, Y and Z are indexed by eh and B, C by g.
+// The device array `ptr_cu_seqlens` holds B + 1 token offsets into the packed chunk mode. Each
+// offset must be a multiple of the chunk length L so that every sequence starts on a chunk
+// boundary, and the tail of the last chunk of a sequence must be zero padded (in particular
+// Delta = DeltaA = 0) so that it neither contributes to nor decays the state. Initial and final
+// states keep their batch mode and are indexed by b * EH + eh in both modes. Sequences must not be
+// empty.
 struct PersistentTileScheduler {
 
   struct Params {
     int num_blocks;
     int num_groups;
+    int num_chunks;
+    int chunk_size;
+    int const* ptr_cu_seqlens;
     FastDivmod divmod_eh;
     FastDivmod divmod_ngroup_ratio;
 
@@ -59,7 +75,8 @@ struct PersistentTileScheduler {
   template<class ProblemSize, class ClusterShape, class TileShape>
   static Params to_underlying_arguments(
       ProblemSize const& problem_size, KernelHardwareInfo hw_info,
-      ClusterShape const& cluster_shape, TileShape const& tile_shape)
+      ClusterShape const& cluster_shape, TileShape const& tile_shape,
+      int const* ptr_cu_seqlens = nullptr)
   {
     using namespace cute;
     auto [G, B, EH, C, L, D, N] = problem_size;
@@ -81,6 +98,9 @@ struct PersistentTileScheduler {
     return Params {
       num_blocks,
       G,
+      C,
+      L,
+      ptr_cu_seqlens,
       {EH},
       {ngroup_ratio},
       hw_info
@@ -98,28 +118,64 @@ struct PersistentTileScheduler {
   }
 
   CUTLASS_DEVICE
-  auto get_block_coord() {
-    return block_idx;
+  bool is_varlen() const {
+    return params.ptr_cu_seqlens != nullptr;
+  }
+
+  // Batch coordinate of X, Delta, Y and Z
+  CUTLASS_DEVICE
+  int get_block_coord() {
+    return is_varlen() ? get_block_coord_eh() : block_idx;
   }
 
+  // Batch coordinate of B and C
   CUTLASS_DEVICE
-  auto get_block_coord_b() {
+  int get_block_coord_b() {
     using namespace cute;
     int eh_idx, b_idx;
     int g_idx, rest_idx;
     params.divmod_eh(b_idx, eh_idx, block_idx);
     params.divmod_ngroup_ratio(g_idx, rest_idx, eh_idx);
-    return (params.num_groups * b_idx + g_idx);
+    return is_varlen() ? g_idx : (params.num_groups * b_idx + g_idx);
   }
 
   CUTLASS_DEVICE
-  auto get_block_coord_eh() {
+  int get_block_coord_eh() {
     using namespace cute;
     int eh_idx, b_idx;
     params.divmod_eh(b_idx, eh_idx, block_idx);
     return eh_idx;
   }
 
+  // Batch coordinate of the initial and final states
+  CUTLASS_DEVICE
+  int get_state_coord() {
+    return block_idx;
+  }
+
+  // First chunk of the sequence along the chunk mode
+  CUTLASS_DEVICE
+  int get_chunk_start() {
+    if (is_varlen()) {
+      int eh_idx, b_idx;
+      params.divmod_eh(b_idx, eh_idx, block_idx);
+      return params.ptr_cu_seqlens[b_idx] / params.chunk_size;
+    }
+    return 0;
+  }
+
+  // Number of chunks of the sequence
+  CUTLASS_DEVICE
+  int get_num_chunks() {
+    if (is_varlen()) {
+      int eh_idx, b_idx;
+      params.divmod_eh(b_idx, eh_idx, block_idx);
+      int seqlen = params.ptr_cu_seqlens[b_idx + 1] - params.ptr_cu_seqlens[b_idx];
+      return (seqlen + params.chunk_size - 1) / params.chunk_size;
+    }
+    return params.num_chunks;
+  }
+
   CUTLASS_DEVICE
   PersistentTileScheduler& operator++() {
     block_idx += gridDim.x;
@@ -0,0 +1,291 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/gemm/collective/builders/sm100_common.inl"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::collective {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// Returns the number of smem tiles for the load and quantization stages, or overrides with manual count.
+template<
+  int CapacityBytes,
+  class ElementA,
+  class ElementAMma,
+  class ElementB,
+  class CtaTileShape_MNK,
+  class SmemLayoutAtomSFA,
+  class SmemLayoutAtomSFB,
+  int AccumulatorStageCount,
+  int stages
+>
+constexpr cute::tuple<int, int>
+sm100_compute_stage_count_or_override_blockscaled_input_quant(StageCount<stages> stage_count) {
+  return cute::make_tuple(stages, stages);
+}
+
+template<
+  int CapacityBytes,
+  class ElementA,
+  class ElementAMma,
+  class ElementB,
+  class CtaTileShape_MNK,
+  class SmemLayoutAtomSFA,
+  class SmemLayoutAtomSFB,
+  int AccumulatorStageCount,
+  int carveout_bytes
+>
+constexpr cute::tuple<int, int>
+sm100_compute_stage_count_or_override_blockscaled_input_quant(StageCountAutoCarveout<carveout_bytes> stage_count) {
+  constexpr int SmemCapacityAfterMma2AccumCarveout = CapacityBytes - (carveout_bytes + AccumulatorStageCount * 32);
+
+  // Mainload2Transform and Mainload2Mma Pipelines: wide A, B and SFB
+  constexpr auto load2transform_pipeline_bytes = sizeof(typename cutlass::PipelineTmaTransformAsync<1>::SharedStorage);
+  constexpr auto load2mma_pipeline_bytes = sizeof(typename cutlass::PipelineTmaUmmaAsync<1>::SharedStorage);
+  constexpr auto a_bits = cute::sizeof_bits_v<ElementA>;
+  constexpr auto b_bits = cute::sizeof_bits_v<ElementB>;
+  constexpr auto stage_sfb_bytes = size(filter_zeros(SmemLayoutAtomSFB{}));
+
+  constexpr int ab_stage_bytes =
+    cutlass::bits_to_bytes(a_bits * size<0>(CtaTileShape_MNK{}) * size<2>(CtaTileShape_MNK{})) +
+    cutlass::bits_to_bytes(b_bits * size<1>(CtaTileShape_MNK{}) * size<2>(CtaTileShape_MNK{})) +
+    static_cast<int>(stage_sfb_bytes) +
+    static_cast<int>(load2transform_pipeline_bytes) + static_cast<int>(load2mma_pipeline_bytes);
+
+  // Transform2Mma Pipeline: quantized A and SFA
+  constexpr auto transform2mma_pipeline_bytes = sizeof(typename cutlass::PipelineUmmaConsumerAsync<1>::SharedStorage);
+  constexpr auto a_compute_bits = cute::sizeof_bits_v<ElementAMma>;
+  constexpr auto stage_sfa_bytes = size(filter_zeros(SmemLayoutAtomSFA{}));
+  constexpr int ab_compute_stage_bytes =
+    cutlass::bits_to_bytes(a_compute_bits * size<0>(CtaTileShape_MNK{}) * size<2>(CtaTileShape_MNK{})) +
+    static_cast<int>(stage_sfa_bytes) +
+    static_cast<int>(transform2mma_pipeline_bytes);
+
+  constexpr int Transform2MmaStageCount = SmemCapacityAfterMma2AccumCarveout / (ab_stage_bytes + ab_compute_stage_bytes);
+
+  constexpr int SmemCapacityAfterABComputeCarveout = SmemCapacityAfterMma2AccumCarveout - (Transform2MmaStageCount * ab_compute_stage_bytes);
+
+  // Can we boost the number of buffers for A and B?
+  constexpr int Load2TransformStageCount = SmemCapacityAfterABComputeCarveout / ab_stage_bytes;
+
+  static_assert(Load2TransformStageCount >= 2 && Transform2MmaStageCount >= 2, "Not enough SMEM capacity for selected tile size");
+  return cute::make_tuple(Load2TransformStageCount, Transform2MmaStageCount);
+}
+
+} // namespace detail
+
+// Block scaled GEMM builder for a wide A quantized in the kernel to the block scaled format of B.
+// ElementA is a plain 16b type, ElementPairB a block scaled type such as nv_float4_t<float_e2m1_t>.
+template <
+  class ArchTag,
+  class ElementA,
+  class GmemLayoutATag,
+  int AlignmentA,
+  class ElementPairB,
+  class GmemLayoutBTag,
+  int AlignmentB,
+  class ElementAccumulator,
+  class TileShape_MNK,        // (MmaAtomShapeM, MmaAtomShapeN, TileK)
+  class ClusterShape_MNK,     // Static cluster shape or dynamic (int, int, _1)
+  class StageCountType,
+  class BuilderScheduleTag
+>
+struct CollectiveBuilder<
+    ArchTag,
+    arch::OpClassBlockScaledTensorOp,
+    ElementA,
+    GmemLayoutATag,
+    AlignmentA,
+    ElementPairB,
+    GmemLayoutBTag,
+    AlignmentB,
+    ElementAccumulator,
+    TileShape_MNK,
+    ClusterShape_MNK,
+    StageCountType,
+    BuilderScheduleTag,
+    cute::enable_if_t<
+      (cute::is_same_v<ArchTag, arch::Sm100>) &&
+      (cute::is_base_of_v<KernelScheduleSm100BlockScaledInputQuantGemm, BuilderScheduleTag>) &&
+      ((cute::sizeof_bits_v<ElementA> * AlignmentA) % (8 * detail::tma_alignment_bytes) == 0)>>
+{
+  // The quantized A takes the block scaled type of B, so the MMA is selected as for a (B, B) problem
+  using HelperScheduleTag = KernelTmaWarpSpecialized1SmBlockScaledSm100;
+  using ElementSF = typename detail::blockscaled::blockscaled_type<HelperScheduleTag, ElementPairB>::sf_type;
+  using ElementB = typename detail::blockscaled::blockscaled_type<HelperScheduleTag, ElementPairB>::data_type;
+
+  static constexpr cute::UMMA::Major UmmaMajorA = cutlass::gemm::collective::detail::tag_to_umma_major_A<GmemLayoutATag>();
+  static constexpr cute::UMMA::Major UmmaMajorB = cutlass::gemm::collective::detail::tag_to_umma_major_B<GmemLayoutBTag>();
+
+  static_assert(cute::is_static_v<TileShape_MNK>, "TileShape has to be static");
+  static_assert(cute::sizeof_bits_v<ElementA> == 16, "ElementA should be a 16b type.");
+  static_assert(UmmaMajorA == cute::UMMA::Major::K, "A must be K-major.");
+  static_assert(detail::blockscaled::check_input_datatypes<HelperScheduleTag, ElementPairB, ElementPairB, UmmaMajorA, UmmaMajorB>(), "Incorrect input types");
+  static_assert(detail::sm1xx_blockscaled_gemm_is_aligned<ElementB, AlignmentB, ElementB, AlignmentB, HelperScheduleTag>(),
+                "Incorrect alignment of B.");
+
+  static constexpr auto Instr = detail::blockscaled::select_instr<ElementPairB, ElementPairB, ElementAccumulator, UmmaMajorA, UmmaMajorB, HelperScheduleTag>();
+
+  using TiledMma = typename cutlass::gemm::collective::detail::TrivialBlockscaledMma<ElementPairB, ElementPairB, ElementAccumulator,
+                                                                  TileShape_MNK, ClusterShape_MNK,
+                                                                  UmmaMajorA, UmmaMajorB, Instr, HelperScheduleTag, false /*is_2sm*/>::type;
+
+  static constexpr bool UseMxf8f6f4 = Instr == detail::blockscaled::BlockScaledInstr::MXF4F6F8;
+
+  // Data type used by MMA instruction
+  using ElementAMma = decltype(cutlass::gemm::collective::detail::sm1xx_kernel_input_element_to_mma_input_element<ElementB, UseMxf8f6f4>());
+  using ElementBMma = ElementAMma;
+  using ElementBMma_SmemAllocType = cute::conditional_t<UseMxf8f6f4, uint8_t, ElementBMma>;
+
+  static constexpr uint32_t SFVectorSize = TiledMma::SFVecSize;
+
+  using AtomThrID = typename TiledMma::AtomThrID;
+  using Sm1xxBlkScaledConfig = cutlass::detail::Sm1xxBlockScaledConfig<SFVectorSize>;
+  using AtomThrShapeMNK = Shape<decltype(shape<0>(typename TiledMma::ThrLayoutVMNK{})), _1, _1>;
+  using CtaTileShape_MNK = decltype(shape_div(TileShape_MNK{}, AtomThrShapeMNK{}));
+
+  // ((MMA_TILE_M,MMA_TILE_K), MMA_M, MMA_K)
+  using MmaShapeA_MK = decltype(partition_shape_A(TiledMma{}, make_shape(cute::size<0>(TileShape_MNK{}),
+                                                                         cute::size<2>(TileShape_MNK{}))));
+  // ((MMA_TILE_N,MMA_TILE_K), MMA_N, MMA_K)
+  using MmaShapeB_NK = decltype(partition_shape_B(TiledMma{}, make_shape(cute::size<1>(TileShape_MNK{}),
+                                                                         cute::size<2>(TileShape_MNK{}))));
+
+  // A passes through the transformation warps and can not use TMA 2SM instructions.
+  using GmemTiledCopyA = decltype(detail::sm90_cluster_shape_to_tma_atom(cute::size<1>(ClusterShape_MNK{})));
+  using GmemTiledCopyB = decltype(cutlass::gemm::collective::detail::sm100_cluster_shape_to_tma_atom_B(
+      ClusterShape_MNK{}, AtomThrID{}));
+  using GmemTiledCopySFB = decltype(cutlass::gemm::collective::detail::sm100_cluster_shape_to_tma_atom_SFB(
+      ClusterShape_MNK{}, AtomThrID{}));
+  using GmemTiledCopyPairB = decltype(cute::make_tuple(GmemTiledCopyB{}, GmemTiledCopySFB{}));
+
+  //
+  // Construct SMEM layout (SmemLayoutAtom) for A, quantized A, and SFA
+  //
+  using BlockTileA_M = decltype(cute::size<0,0>(MmaShapeA_MK{}) * cute::size<1>(MmaShapeA_MK{}));
+  using BlockTileA_K = decltype(cute::size<0,1>(MmaShapeA_MK{}) * cute::size<2>(MmaShapeA_MK{}));
+  using SmemLayoutAtomA = decltype(cutlass::gemm::collective::detail::sm100_smem_selector<
+      UmmaMajorA, ElementA, BlockTileA_M, BlockTileA_K>());
+  using SmemLayoutAtomACompute = decltype(cutlass::gemm::collective::detail::sm100_smem_selector<
+      UmmaMajorA, ElementAMma, BlockTileA_M, BlockTileA_K>());
+  using SmemLayoutAtomSFA = decltype(Sm1xxBlkScaledConfig::deduce_smem_layoutSFA(TiledMma{}, TileShape_MNK{}));
+  using SmemLayoutAtomsA = decltype(cute::make_tuple(SmemLayoutAtomA{}, SmemLayoutAtomACompute{}, SmemLayoutAtomSFA{}));
+
+  //
+  // Construct SMEM layout (SmemLayoutAtom) for B and SFB
+  //
+  using BlockTileB_N = decltype(cute::size<0,0>(MmaShapeB_NK{}) * cute::size<1>(MmaShapeB_NK{}));
+  using BlockTileB_K = decltype(cute::size<0,1>(MmaShapeB_NK{}) * cute::size<2>(MmaShapeB_NK{}));
+  using SmemLayoutAtomB = decltype(cutlass::gemm::collective::detail::sm100_smem_selector<
+      UmmaMajorB, ElementBMma_SmemAllocType, BlockTileB_N, BlockTileB_K>());
+  using SmemLayoutAtomSFB = decltype(Sm1xxBlkScaledConfig::deduce_smem_layoutSFB(TiledMma{}, TileShape_MNK{}));
+  using SmemLayoutAtomsB = decltype(cute::make_tuple(SmemLayoutAtomB{}, SmemLayoutAtomSFB{}));
+
+  //
+  // Construct Strides for A, B, and SFB
+  //
+  using StrideA = cutlass::gemm::TagToStrideA_t<GmemLayoutATag>;
+  using StrideB = cutlass::gemm::TagToStrideB_t<GmemLayoutBTag>;
+  using LayoutSFB = decltype(Sm1xxBlkScaledConfig::deduce_layoutSFB());
+  using StridePairB = decltype(cute::make_tuple(StrideB{}, LayoutSFB{}));
+
+  static constexpr int MMA_N = cute::size<1>(TileShape_MNK{});
+  static constexpr int AccumulatorPipelineStageCount = (MMA_N == 256) ? 1 : 2;
+
+  // SmemCarveout
+  static constexpr int SchedulerPipelineStageCount = 3;
+
+  // CLCPipeline = PipelineCLCFetchAsync
+  static constexpr auto CLCPipelineStorage = sizeof(typename cutlass::PipelineCLCFetchAsync<SchedulerPipelineStageCount, ClusterShape_MNK>::SharedStorage);
+  // CLC (scheduler) response
+  static constexpr auto CLCResponseStorage = SchedulerPipelineStageCount * detail::CLCResponseSize;
+  // CLC Throttle pipeline storage
+  static constexpr auto CLCThrottlePipelineStorage = sizeof(typename cutlass::PipelineAsync<SchedulerPipelineStageCount>::SharedStorage);
+  // Tmem dealloc
+  static constexpr auto TmemDeallocStorage = sizeof(cutlass::arch::ClusterBarrier);
+  // Tmem ptr storage
+  static constexpr auto TmemBasePtrsStorage = sizeof(uint32_t);
+
+  // Smem usage that's not part of CollectiveEpilogue::SharedStorage & CollectiveMainloop::SharedStorage
+  static constexpr auto KernelSmemCarveout = static_cast<int>( CLCPipelineStorage +
+                                                               CLCResponseStorage +
+                                                               CLCThrottlePipelineStorage +
+                                                               TmemDeallocStorage +
+                                                               TmemBasePtrsStorage);
+
+  // Reduce SMEM capacity available for buffers considering barrier allocations.
+  static constexpr int ReducedSmemCapacityBytes = detail::sm100_reduced_smem_capacity_bytes<ArchTag, KernelSmemCarveout>();
+
+  static constexpr auto stage_info = cutlass::gemm::collective::detail::sm100_compute_stage_count_or_override_blockscaled_input_quant<
+      ReducedSmemCapacityBytes, ElementA, ElementAMma, ElementBMma_SmemAllocType, CtaTileShape_MNK,
+      SmemLayoutAtomSFA, SmemLayoutAtomSFB, AccumulatorPipelineStageCount>(StageCountType{});
+
+  static constexpr int Load2TransformPipelineStageCount = get<0>(stage_info);
+  static constexpr int Transform2MmaPipelineStageCount = get<1>(stage_info);
+
+  using DispatchPolicy = cutlass::gemm::MainloopSm100TmaUmmaWarpSpecializedBlockScaledInputQuant<
+    Load2TransformPipelineStageCount,
+    Transform2MmaPipelineStageCount,
+    SchedulerPipelineStageCount,
+    AccumulatorPipelineStageCount,
+    ClusterShape_MNK,
+    ArchTag
+  >;
+
+  using CollectiveOp = cutlass::gemm::collective::CollectiveMma<
+      DispatchPolicy,
+      TileShape_MNK,
+      ElementA,
+      StrideA,
+      cute::tuple<ElementB, ElementSF>,
+      StridePairB,
+      TiledMma,
+      GmemTiledCopyA,
+      SmemLayoutAtomsA,
+      void,
+      cute::identity,
+      GmemTiledCopyPairB,
+      SmemLayoutAtomsB,
+      void,
+      cute::identity
+    >;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
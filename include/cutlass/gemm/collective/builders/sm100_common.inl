@@ -718,7 +718,8 @@ sm100_make_trivial_mixed_input_tiled_mma() {
   constexpr int N = cute::size<1>(TileShape_MNK{});
   //MMA 1Sm requested
   if constexpr (cute::is_base_of_v<KernelSchedule1Sm, KernelScheduleType> ) {
-    if constexpr (UmmaMajorA == cute::UMMA::Major::K  && !cute::is_base_of_v<KernelTmaWarpSpecializedMixedInputSmemSm100, KernelScheduleType>) {
+    if constexpr (UmmaMajorA == cute::UMMA::Major::K  && !(cute::is_base_of_v<KernelTmaWarpSpecializedMixedInputSmemSm100, KernelScheduleType> ||
+                                                        cute::is_base_of_v<KernelTmaWarpSpecializedPtrArrayMixedInputSmemSm100, KernelScheduleType>)) {
       if constexpr     (cute::is_same_v<ElementBMma, cutlass::half_t> || cute::is_same_v<ElementBMma, cutlass::bfloat16_t>) {
         return make_tiled_mma(cute::SM100_MMA_F16BF16_TS<ElementAMma, ElementBMma, ElementAccumulator,
                                                       M, N,  UmmaMajorA,  UmmaMajorB>{});
@@ -750,7 +751,8 @@ sm100_make_trivial_mixed_input_tiled_mma() {
   }
   //MMA 2Sm requested
   else if constexpr (cute::is_base_of_v<KernelSchedule2Sm, KernelScheduleType>) {
-    if constexpr (UmmaMajorA == cute::UMMA::Major::K  && !cute::is_base_of_v<KernelTmaWarpSpecializedMixedInputSmemSm100, KernelScheduleType>) {
+    if constexpr (UmmaMajorA == cute::UMMA::Major::K  && !(cute::is_base_of_v<KernelTmaWarpSpecializedMixedInputSmemSm100, KernelScheduleType> ||
+                                                        cute::is_base_of_v<KernelTmaWarpSpecializedPtrArrayMixedInputSmemSm100, KernelScheduleType>)) {
       if constexpr     (cute::is_same_v<ElementBMma, cutlass::half_t> || cute::is_same_v<ElementBMma, cutlass::bfloat16_t>) {
         return make_tiled_mma(cute::SM100_MMA_F16BF16_2x1SM_TS<ElementAMma, ElementBMma, ElementAccumulator,
                                                       M, N,  UmmaMajorA,  UmmaMajorB>{});
@@ -88,7 +88,8 @@ sm100_compute_stage_count_or_override_mixed_input(StageCountAutoCarveout<carveou
 
   constexpr int TmemColumns = 512;
 
-  constexpr bool IsAComputeinTmem = UmmaMajorA == cute::UMMA::Major::K && !cute::is_base_of_v<KernelTmaWarpSpecializedMixedInputSmemSm100, KernelScheduleType>;
+  constexpr bool IsAComputeinTmem = UmmaMajorA == cute::UMMA::Major::K && !(cute::is_base_of_v<KernelTmaWarpSpecializedMixedInputSmemSm100, KernelScheduleType> ||
+                                                                            cute::is_base_of_v<KernelTmaWarpSpecializedPtrArrayMixedInputSmemSm100, KernelScheduleType>);
   constexpr bool IsAComputeinSmem = !IsAComputeinTmem;
 
   // Detect 2x2 TMEM layout
@@ -140,12 +141,18 @@ sm100_compute_stage_count_or_override_mixed_input(StageCountAutoCarveout<carveou
 
 } // namespace detail
 
-template <typename LayoutScale>
+// Number of K elements sharing one scale in SMEM. Groups wider than the tile (and runtime group sizes,
+// which the mainloop requires to be multiples of the tile K) store a single scale column per k-tile.
+template <typename LayoutScale, int TileK>
 constexpr int get_ScaleGranularityK() {
   if constexpr (cute::is_void_v<LayoutScale>) {
     return 1;
-  } else {
-    return size<1,0>(LayoutScale{});
+  } 
+  else if constexpr (not cute::is_static_v<decltype(get<1,0>(shape(LayoutScale{})))>) {
+    return TileK;
+  } 
+  else {
+    return cute::min(int(size<1,0>(LayoutScale{})), TileK);
   }
 }
 
@@ -249,7 +256,8 @@ struct CollectiveBuilder<
   static constexpr int MMA_M = cute::size<0,0>(MmaShapeA_MK{});
   using CopyAtomPairA = cutlass::gemm::collective::detail::CollectiveMmaEmulatedCopyType<
     Copy_Atom<AutoVectorizingCopyWithAssumedAlignment<128>, ElementA>,
-    cute::conditional_t<(UmmaMajorA == cute::UMMA::Major::K && !cute::is_base_of_v<KernelTmaWarpSpecializedMixedInputSmemSm100, KernelScheduleType>),
+    cute::conditional_t<(UmmaMajorA == cute::UMMA::Major::K && !(cute::is_base_of_v<KernelTmaWarpSpecializedMixedInputSmemSm100, KernelScheduleType> ||
+                                                                 cute::is_base_of_v<KernelTmaWarpSpecializedPtrArrayMixedInputSmemSm100, KernelScheduleType>)),
                         cute::conditional_t<(MMA_M == 64 && size(AtomThrID{}) == 1), SM100_TMEM_STORE_16dp256b1x, SM100_TMEM_STORE_32dp32b8x>, // TS Implementation
                         Copy_Atom<AutoVectorizingCopyWithAssumedAlignment<128>, ElementA>>                                         // SS Implementation
   >;
@@ -283,7 +291,7 @@ struct CollectiveBuilder<
 
   // SmemCarveout
   static constexpr int SchedulerPipelineStageCount = 3;
-  static constexpr bool IsArrayOfPointersGemm = (cute::is_base_of_v<KernelScheduleSm100PtrArrayFastFP32Gemm, KernelScheduleType>);
+  static constexpr bool IsArrayOfPointersGemm = (cute::is_base_of_v<KernelScheduleSm100PtrArrayMixedInputGemm, KernelScheduleType>);
 
   // CLCPipeline = PipelineCLCFetchAsync
   static constexpr auto CLCPipelineStorage = sizeof(typename cutlass::PipelineCLCFetchAsync<SchedulerPipelineStageCount, ClusterShape_MNK>::SharedStorage);
@@ -296,7 +304,7 @@ struct CollectiveBuilder<
   // Tmem ptr storage
   static constexpr auto TmemBasePtrsStorage = sizeof(uint32_t);
   // Tensormap Storage
-  static constexpr size_t TensorMapStorage = IsArrayOfPointersGemm ? sizeof(cute::TmaDescriptor) * 2 /* for A and B */ : 0;
+  static constexpr size_t TensorMapStorage = IsArrayOfPointersGemm ? sizeof(cute::TmaDescriptor) * 4 /* for A, B, scale and zero */ : 0;
 
   // Smem usage that's not part of CollectiveEpilogue::SharedStorage & CollectiveMainloop::SharedStorage
   static constexpr auto KernelSmemCarveout = static_cast<int>( CLCPipelineStorage +
@@ -309,7 +317,7 @@ struct CollectiveBuilder<
   // Reduce SMEM capacity available for buffers considering extra B smem and barrier smem allocations
   static constexpr int ReducedSmemCapacityBytes = detail::sm100_reduced_smem_capacity_bytes<ArchTag, KernelSmemCarveout>();
 
-  static constexpr int ScaleGranularityK = get_ScaleGranularityK<LayoutScale>();
+  static constexpr int ScaleGranularityK = get_ScaleGranularityK<cute::remove_pointer_t<LayoutScale>, size<2>(CtaTileShape_MNK{})>();
   static constexpr auto stage_info = cutlass::gemm::collective::detail::sm100_compute_stage_count_or_override_mixed_input<
   ReducedSmemCapacityBytes, TmaElementA, ElementAMma, ElementScale, ElementZero, ElementB, CtaTileShape_MNK, TiledMma, KernelScheduleType, UmmaMajorA, ScaleGranularityK>(StageCountType{});
   
@@ -317,15 +325,23 @@ struct CollectiveBuilder<
   static constexpr int Transform2MmaPipelineStageCount = get<1>(stage_info);
   static constexpr int AccumulatorPipelineStageCount = get<2>(stage_info);
 
-  static_assert(!IsArrayOfPointersGemm, "mixed input does not support grouped gemm on Blackwell");
-
-  using DispatchPolicy = cutlass::gemm::MainloopSm100TmaUmmaWarpSpecializedMixedInput<
-    Load2TransformPipelineStageCount,
-    Transform2MmaPipelineStageCount,
-    SchedulerPipelineStageCount,
-    AccumulatorPipelineStageCount,
-    ClusterShape_MNK,
-    ArchTag
+  using DispatchPolicy = cute::conditional_t<IsArrayOfPointersGemm,
+    cutlass::gemm::MainloopSm100ArrayTmaUmmaWarpSpecializedMixedInput<
+      Load2TransformPipelineStageCount,
+      Transform2MmaPipelineStageCount,
+      SchedulerPipelineStageCount,
+      AccumulatorPipelineStageCount,
+      ClusterShape_MNK,
+      ArchTag
+    >,
+    cutlass::gemm::MainloopSm100TmaUmmaWarpSpecializedMixedInput<
+      Load2TransformPipelineStageCount,
+      Transform2MmaPipelineStageCount,
+      SchedulerPipelineStageCount,
+      AccumulatorPipelineStageCount,
+      ClusterShape_MNK,
+      ArchTag
+    >
   >;
   using CollectiveOp = cutlass::gemm::collective::CollectiveMma<
     DispatchPolicy,
@@ -0,0 +1,244 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+#pragma once
+
+#include "cutlass/gemm/collective/builders/sm100_common.inl"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::collective {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+template<
+  int CapacityBytes,
+  class CtaTileShape_MNK,
+  int NumSlices,
+  int carveout_bytes
+>
+constexpr cute::tuple<int, int, int>
+sm100_compute_stage_count_or_override_ozaki_fp64(StageCountAutoCarveout<carveout_bytes> stage_count) {
+  constexpr int CtaM = get<0>(CtaTileShape_MNK{});
+  constexpr int CtaN = get<1>(CtaTileShape_MNK{});
+  // The accumulator threads hold the INT32 band, the FP64 k-tile and the FP64 global accumulators in registers
+  static_assert(CtaN <= 64, "Can't support CtaN>64 tiles");
+  constexpr int CtaK = get<2>(CtaTileShape_MNK{});
+  constexpr int TmemColumns = 512;
+
+  // One INT32 accumulator stage per band
+  constexpr int AccumulatorStageCount = TmemColumns / CtaN;
+  // The exponent ring holds ceil(AccumulatorStageCount / NumSlices) stages beyond Transform2MmaStageCount
+  constexpr int exponent_stage_bytes = static_cast<int>(sizeof(int32_t)) * (CtaM + CtaN);
+
+  constexpr int SmemCapacityAfterMma2AccumCarveout = CapacityBytes - (carveout_bytes + AccumulatorStageCount * 32 +
+    cute::ceil_div(AccumulatorStageCount, NumSlices) * exponent_stage_bytes);
+
+  constexpr auto load2transform_pipeline_bytes = sizeof(typename cutlass::PipelineTmaTransformAsync<1>::SharedStorage);
+  constexpr int ab_stage_bytes =
+    cutlass::bits_to_bytes(cute::sizeof_bits_v<double> * CtaM * CtaK) +
+    cutlass::bits_to_bytes(cute::sizeof_bits_v<double> * CtaN * CtaK) +
+    static_cast<int>(load2transform_pipeline_bytes);
+
+  constexpr auto transform2mma_pipeline_bytes = sizeof(typename cutlass::PipelineUmmaConsumerAsync<1>::SharedStorage);
+  constexpr int ab_compute_stage_bytes =
+    cutlass::bits_to_bytes(NumSlices * cute::sizeof_bits_v<int8_t> * CtaM * CtaK) +
+    cutlass::bits_to_bytes(NumSlices * cute::sizeof_bits_v<int8_t> * CtaN * CtaK) +
+    exponent_stage_bytes +
+    static_cast<int>(transform2mma_pipeline_bytes);
+
+  constexpr int Transform2MmaStageCount = SmemCapacityAfterMma2AccumCarveout / (ab_stage_bytes + ab_compute_stage_bytes);
+
+  constexpr int SmemCapacityAfterABComputeCarveout = SmemCapacityAfterMma2AccumCarveout - (Transform2MmaStageCount * ab_compute_stage_bytes);
+  // Can we boost the number of buffers for A and B?
+  constexpr int Load2TransformStageCount = SmemCapacityAfterABComputeCarveout / ab_stage_bytes;
+
+  static_assert(Load2TransformStageCount >= 2 && Transform2MmaStageCount >= 2 && AccumulatorStageCount >= NumSlices, "Not enough SMEM or TMEM capacity for selected tile size");
+  return cute::make_tuple(Load2TransformStageCount, Transform2MmaStageCount, AccumulatorStageCount);
+}
+
+} // namespace detail
+
+
+// FP64 emulation (Ozaki scheme with INT8 slices) MMA kernels builder
+template <
+  class ArchTag,
+  class GmemLayoutATag,
+  int AlignmentA,
+  class GmemLayoutBTag,
+  int AlignmentB,
+  class ElementAccumulator,
+  class TileShape_MNK,  // The Cluster-level TileShape
+  class ClusterShape_MNK,
+  class StageCountType,
+  class BuilderScheduleTag
+>
+struct CollectiveBuilder<
+    ArchTag,
+    arch::OpClassTensorOp,
+    double,          // ElementA
+    GmemLayoutATag,  // LayoutA
+    AlignmentA,
+    double,          // ElementB
+    GmemLayoutBTag,  // LayoutB
+    AlignmentB,
+    ElementAccumulator,
+    TileShape_MNK,    // (MmaAtomShapeM, MmaAtomShapeN, TileK)
+    ClusterShape_MNK, // Static cluster shape or dynamic (int, int, int)
+    StageCountType,
+    BuilderScheduleTag,
+    cute::enable_if_t<
+      (cute::is_same_v<ArchTag, arch::Sm100>) &&
+      (not cute::is_tuple<GmemLayoutATag>::value && not cute::is_tuple<GmemLayoutBTag>::value) &&
+      (cute::is_base_of_v<KernelScheduleSm100OzakiFP64Gemm, BuilderScheduleTag>) &&
+      ((sizeof(double) * AlignmentA) % detail::tma_alignment_bytes == 0) &&
+      ((sizeof(double) * AlignmentB) % detail::tma_alignment_bytes == 0)>>
+{
+  static_assert(cute::is_same_v<ElementAccumulator, double>, "FP64 emulation requires a double accumulator");
+
+  static constexpr cute::UMMA::Major UmmaMajorA = cutlass::gemm::collective::detail::tag_to_umma_major_A<GmemLayoutATag>();
+  static constexpr cute::UMMA::Major UmmaMajorB = cutlass::gemm::collective::detail::tag_to_umma_major_B<GmemLayoutBTag>();
+  // The transformation threads write the INT8 slices K-major regardless of the input layouts
+  static constexpr cute::UMMA::Major UmmaMajorACompute = cute::UMMA::Major::K;
+  static constexpr cute::UMMA::Major UmmaMajorBCompute = cute::UMMA::Major::K;
+
+  using ElementA = double;
+  using ElementB = double;
+  using ElementAMma = int8_t;
+  using ElementBMma = int8_t;
+  using ElementAccumulatorMma = int32_t;
+
+  // 7 slices of 7 bits retain 49 bits of every scaled mantissa
+  static constexpr int NumSlices = 7;
+
+  using TiledMma = decltype(detail::sm100_make_1sm_trivial_tiled_mma<ElementAMma, ElementBMma, ElementAccumulatorMma,
+                                                                     TileShape_MNK, ClusterShape_MNK,
+                                                                     UmmaMajorACompute, UmmaMajorBCompute>());
+  using AtomThrID = typename TiledMma::AtomThrID;
+  using AtomThrShapeMNK = Shape<decltype(shape<0>(typename TiledMma::ThrLayoutVMNK{})), _1, _1>;
+  using CtaTileShape_MNK = decltype(shape_div(TileShape_MNK{}, AtomThrShapeMNK{}));
+
+  // ((MMA_TILE_M,MMA_TILE_K), MMA_M, MMA_K)
+  using MmaShapeA_MK = decltype(partition_shape_A(TiledMma{}, make_shape(cute::size<0>(TileShape_MNK{}),
+                                                                         cute::size<2>(TileShape_MNK{}))));
+  // ((MMA_TILE_N,MMA_TILE_K), MMA_N, MMA_K)
+  using MmaShapeB_NK = decltype(partition_shape_B(TiledMma{}, make_shape(cute::size<1>(TileShape_MNK{}),
+                                                                         cute::size<2>(TileShape_MNK{}))));
+
+  using BlockTileA_M = decltype(cute::size<0,0>(MmaShapeA_MK{}) * cute::size<1>(MmaShapeA_MK{}));
+  using BlockTileA_K = decltype(cute::size<0,1>(MmaShapeA_MK{}) * cute::size<2>(MmaShapeA_MK{}));
+
+  using SmemLayoutAtomA = decltype(cutlass::gemm::collective::detail::sm100_smem_selector<UmmaMajorA, ElementA,
+    BlockTileA_M, BlockTileA_K>());
+  using SmemLayoutAtomACompute =  decltype(cutlass::gemm::collective::detail::sm100_smem_selector<UmmaMajorACompute, ElementAMma,
+    BlockTileA_M, BlockTileA_K>());
+
+  // Input transform kernel can not use TMA 2SM instructions.
+  using GmemTiledCopyA = decltype(detail::sm90_cluster_shape_to_tma_atom(cute::size<1>(ClusterShape_MNK{})));
+  using SmemLayoutAtomPairA = cutlass::gemm::collective::detail::CollectiveMmaEmulatedLayoutAtomType<
+    SmemLayoutAtomA, SmemLayoutAtomACompute>;
+
+  using BlockTileB_N = decltype(cute::size<0,0>(MmaShapeB_NK{}) * cute::size<1>(MmaShapeB_NK{}));
+  using BlockTileB_K = decltype(cute::size<0,1>(MmaShapeB_NK{}) * cute::size<2>(MmaShapeB_NK{}));
+
+  // Input transform kernel can not use TMA 2SM instructions.
+  using GmemTiledCopyB = decltype(detail::sm90_cluster_shape_to_tma_atom(cute::size<0>(ClusterShape_MNK{})));
+
+  using SmemLayoutAtomB = decltype(cutlass::gemm::collective::detail::sm100_smem_selector<UmmaMajorB, ElementB,
+    BlockTileB_N, BlockTileB_K>());
+  using SmemLayoutAtomBCompute = decltype(cutlass::gemm::collective::detail::sm100_smem_selector<UmmaMajorBCompute, ElementBMma,
+    BlockTileB_N, BlockTileB_K>());
+
+  using SmemLayoutAtomPairB = cutlass::gemm::collective::detail::CollectiveMmaEmulatedLayoutAtomType<
+    SmemLayoutAtomB, SmemLayoutAtomBCompute>;
+
+  // SmemCarveout
+  static constexpr int SchedulerPipelineStageCount = 3;
+  // CLCPipeline = PipelineCLCFetchAsync
+  static constexpr auto CLCPipelineStorage = sizeof(typename cutlass::PipelineCLCFetchAsync<SchedulerPipelineStageCount, ClusterShape_MNK>::SharedStorage);
+  // CLC (scheduler) response
+  static constexpr auto CLCResponseStorage = SchedulerPipelineStageCount * detail::CLCResponseSize;
+  // CLC Throttle pipeline storage
+  static constexpr auto CLCThrottlePipelineStorage = sizeof(typename cutlass::PipelineAsync<SchedulerPipelineStageCount>::SharedStorage);
+  // Tmem dealloc
+  static constexpr auto TmemDeallocStorage = sizeof(cutlass::arch::ClusterBarrier);
+  // Tmem ptr storage
+  static constexpr auto TmemBasePtrsStorage = sizeof(uint32_t);
+
+  // Smem usage that's not part of CollectiveEpilogue::SharedStorage & CollectiveMainloop::SharedStorage
+  static constexpr auto KernelSmemCarveout = static_cast<int>( CLCPipelineStorage +
+                                                               CLCResponseStorage +
+                                                               CLCThrottlePipelineStorage +
+                                                               TmemDeallocStorage +
+                                                               TmemBasePtrsStorage);
+
+  // Reduce SMEM capacity available for buffers considering extra B smem and barrier smem allocations
+  static constexpr int ReducedSmemCapacityBytes = detail::sm100_reduced_smem_capacity_bytes<ArchTag, KernelSmemCarveout>();
+  static constexpr auto stage_info = cutlass::gemm::collective::detail::sm100_compute_stage_count_or_override_ozaki_fp64<
+    ReducedSmemCapacityBytes, CtaTileShape_MNK, NumSlices>(StageCountType{});
+
+  static constexpr int Load2TransformPipelineStageCount = get<0>(stage_info);
+  static constexpr int Transform2MmaPipelineStageCount = get<1>(stage_info);
+  static constexpr int AccumulatorPipelineStageCount = get<2>(stage_info);
+
+  using AccumulatorCopyAtom = cute::SM100_TMEM_LOAD_32dp32b32x;
+
+  using DispatchPolicy = cutlass::gemm::MainloopSm100TmaUmmaWarpSpecializedOzakiF64<
+      Load2TransformPipelineStageCount,
+      Transform2MmaPipelineStageCount,
+      SchedulerPipelineStageCount,
+      AccumulatorPipelineStageCount,
+      NumSlices,
+      ClusterShape_MNK,
+      AccumulatorCopyAtom,
+      ArchTag>;
+  using CollectiveOp = cutlass::gemm::collective::CollectiveMma<
+    DispatchPolicy,
+    TileShape_MNK,
+    ElementA,
+    cutlass::gemm::TagToStrideA_t<GmemLayoutATag>,
+    ElementB,
+    cutlass::gemm::TagToStrideB_t<GmemLayoutBTag>,
+    TiledMma,
+    GmemTiledCopyA,
+    SmemLayoutAtomPairA,
+    void,
+    cute::identity,
+    GmemTiledCopyB,
+    SmemLayoutAtomPairB,
+    void,
+    cute::identity
+  >;
+};
+
+} // namespace cutlass::gemm::collective
@@ -248,8 +248,14 @@ struct CollectiveBuilder<
   using SmemShape_N = decltype(shape_div(shape<1>(TileShape_MNK{}), shape_div(shape<1>(TileShape_MNK{}), size<1>(TileShape_MNK{}) / size(AtomThrID{}))));
   using SmemShape_K = decltype(cute::get<2>(TileShape_MNK{}));
 
-  using GmemTiledCopyA = decltype(cutlass::gemm::collective::detail::sm100_cluster_shape_to_tma_atom_A(
-    ClusterShape_MNK{}, AtomThrID{}));
+  static constexpr bool IsGatherA = cute::is_same_v<KernelTmaWarpSpecialized1SmGatherASm100, BuilderScheduleTag>;
+  static_assert(not IsGatherA || UmmaMajorA == cute::UMMA::Major::K, "Gathered A requires a K-major A layout.");
+
+  // Gathered A rows are loaded with tile::gather4 and are never multicast
+  using GmemTiledCopyA = cute::conditional_t<IsGatherA,
+    SM100_TMA_LOAD_2D_GATHER4,
+    decltype(cutlass::gemm::collective::detail::sm100_cluster_shape_to_tma_atom_A(
+      ClusterShape_MNK{}, AtomThrID{}))>;
   using GmemTiledCopyB = decltype(cutlass::gemm::collective::detail::sm100_cluster_shape_to_tma_atom_B(
       ClusterShape_MNK{}, AtomThrID{}));
 
@@ -317,12 +323,21 @@ struct CollectiveBuilder<
             ArchTag
           >
         >,
-      cutlass::gemm::MainloopSm100TmaUmmaWarpSpecialized<
-          PipelineStages,
-          SchedulerPipelineStageCount,
-          AccumulatorPipelineStageCount,
-          ClusterShape_MNK,
-          ArchTag
+      cute::conditional_t<IsGatherA,
+        cutlass::gemm::MainloopSm100TmaUmmaWarpSpecializedGatherA<
+            PipelineStages,
+            SchedulerPipelineStageCount,
+            AccumulatorPipelineStageCount,
+            ClusterShape_MNK,
+            ArchTag
+        >,
+        cutlass::gemm::MainloopSm100TmaUmmaWarpSpecialized<
+            PipelineStages,
+            SchedulerPipelineStageCount,
+            AccumulatorPipelineStageCount,
+            ClusterShape_MNK,
+            ArchTag
+        >
       >
     >;
 
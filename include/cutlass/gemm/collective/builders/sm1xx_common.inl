@@ -140,7 +140,9 @@ constexpr uint32_t find_vector_size() {
                 cute::is_same_v<BuilderScheduleTag, KernelPtrArrayTmaWarpSpecialized1SmNvf4Sm100> ||
                 cute::is_same_v<BuilderScheduleTag, KernelPtrArrayTmaWarpSpecialized2SmNvf4Sm100> ||
                 cute::is_same_v<BuilderScheduleTag, KernelTmaWarpSpecializedNvf4Sm120> ||
-                cute::is_same_v<BuilderScheduleTag, KernelTmaWarpSpecializedPingpongNvf4Sm120>
+                cute::is_same_v<BuilderScheduleTag, KernelTmaWarpSpecializedPingpongNvf4Sm120> ||
+                cute::is_same_v<BuilderScheduleTag, KernelPtrArrayTmaWarpSpecializedNvf4Sm120> ||
+                cute::is_same_v<BuilderScheduleTag, KernelPtrArrayTmaWarpSpecializedPingpongNvf4Sm120>
                 || cute::is_same_v<BuilderScheduleTag, KernelTmaWarpSpecialized1SmBlockScaledMxNvf4UltraVs16Sm103>
                 || cute::is_same_v<BuilderScheduleTag, KernelTmaWarpSpecialized2SmBlockScaledMxNvf4UltraVs16Sm103>
                 || cute::is_same_v<BuilderScheduleTag, KernelTmaWarpSpecialized1SmBlockScaledMxNvf4UltraVs16Sm103DisablePrefetch>
@@ -422,6 +424,15 @@ compute_carveout_from_epi() {
          cutlass::round_up(sizeof(typename CollectiveEpilogue::PipelineStorage), pipeline_alignment);
 }
 
+// Shared memory of the epilogue that is not aliased with the mainloop stages in kernels that alias its tensors
+template<class CollectiveEpilogue>
+constexpr int
+compute_aliased_carveout_from_epi() {
+  constexpr int pipeline_alignment = 16;
+
+  return cutlass::round_up(sizeof(typename CollectiveEpilogue::PipelineStorage), pipeline_alignment);
+}
+
 namespace blockscaled {
 
 enum class BlockScaledInstr {
@@ -33,6 +33,7 @@
 #include "cutlass/arch/mma.h"
 #include "cutlass/gemm/gemm.h"
 #include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/collective/collective_builder_decl.hpp"
 #include "cutlass/detail/layout.hpp"
 #include "cutlass/detail/collective.hpp"
 #include "cutlass/detail/dependent_false.hpp"
@@ -56,6 +57,32 @@ constexpr int tma_alignment_bytes = 16;
 constexpr int cp_async_min_alignment_bytes = 4;
 constexpr int sm90_smem_capacity_bytes = 232448;
 
+// Returns whether the kernel dispatched for a schedule aliases the epilogue tensor storage with the
+// mainloop stages. Non-persistent warp-specialized kernels only run the epilogue once the mainloop drained.
+template <class KernelScheduleType>
+constexpr bool
+sm90_kernel_aliases_epilogue_smem() {
+  return cute::is_base_of_v<KernelTmaWarpSpecialized, KernelScheduleType> ||
+         cute::is_base_of_v<KernelCpAsyncWarpSpecialized, KernelScheduleType>;
+}
+
+// Maps the stage count type of a builder onto the one used to size its mainloop, only carving out the
+// unaliased epilogue storage of StageCountAutoCarveoutEpiAliased for kernels that alias the epilogue tensors
+template <class StageCountType, class KernelScheduleType>
+struct sm90_stage_count_for_kernel {
+  using type = StageCountType;
+};
+
+template <class CollectiveEpilogue, class KernelScheduleType>
+struct sm90_stage_count_for_kernel<StageCountAutoCarveoutEpiAliased<CollectiveEpilogue>, KernelScheduleType> {
+  using type = cute::conditional_t<sm90_kernel_aliases_epilogue_smem<KernelScheduleType>(),
+    StageCountAutoCarveout<StageCountAutoCarveoutEpiAliased<CollectiveEpilogue>::aliased_bytes>,
+    StageCountAutoCarveoutEpi<CollectiveEpilogue>>;
+};
+
+template <class StageCountType, class KernelScheduleType>
+using sm90_stage_count_for_kernel_t = typename sm90_stage_count_for_kernel<StageCountType, KernelScheduleType>::type;
+
 // Maps 2.x A matrix layout tag to respective GMMA major mode enum
 template <class ElementA, class LayoutA>
 constexpr cute::GMMA::Major
@@ -324,6 +351,22 @@ ss_smem_selector()
   }
 }
 
+// Helper for SS GMMA smem selection of 8-bit operands that may be MN-major in gmem.
+// Operands transposed in smem are staged MN-major with the layout the warp-cooperative
+// transposition requires, all others use the K-major layout WGMMA reads.
+template <bool TransposeInSmem, class ElementType, class BLK_MN, class BLK_K>
+CUTE_HOST_DEVICE constexpr
+auto
+ss_smem_selector_transposable()
+{
+  if constexpr (TransposeInSmem) {
+    return rs_smem_selector<cute::GMMA::Major::MN, ElementType, BLK_MN, BLK_K, true>();
+  }
+  else {
+    return ss_smem_selector<cute::GMMA::Major::K, ElementType, BLK_MN, BLK_K>();
+  }
+}
+
 // Helper for SS GMMA smem selection that considers a tensor TileShape:
 //   (BLK_MN, BLK_K)
 //   or hierarchically
@@ -42,12 +42,14 @@
 #if !defined(__CUDACC_RTC__)
 #include "cutlass/gemm/collective/builders/sm100_umma_builder.inl"
 #include "cutlass/gemm/collective/builders/sm100_9xBF16_umma_builder.inl"
+#include "cutlass/gemm/collective/builders/sm100_ozaki_fp64_umma_builder.inl"
 #include "cutlass/gemm/collective/builders/sm100_sparse_umma_builder.inl"
 #include "cutlass/gemm/collective/builders/sm100_blockscaled_umma_builder.inl"
 #include "cutlass/gemm/collective/builders/sm100_blockwise_umma_builder.inl"
 #include "cutlass/gemm/collective/builders/sm100_blockscaled_sparse_umma_builder.inl"
 #include "cutlass/gemm/collective/builders/sm100_simt_builder.inl"
 #include "cutlass/gemm/collective/builders/sm100_mixed_input_umma_builder.inl"
+#include "cutlass/gemm/collective/builders/sm100_blockscaled_input_quant_umma_builder.inl"
 #include "cutlass/gemm/collective/builders/sm100_cpasync_umma_builder.inl"
 #include "cutlass/gemm/collective/builders/sm100_mixed_tma_cpasync_umma_builder.inl"
 #include "cutlass/gemm/collective/builders/sm100_blockscaled_mixed_tma_cpasync_umma_builder.inl"
@@ -61,11 +61,23 @@ template<class CollectiveEpilogue>
 constexpr int
 compute_carveout_from_epi();
 
+template<class CollectiveEpilogue>
+constexpr int
+compute_aliased_carveout_from_epi();
+
 } // namespace detail
 
 template<class CollectiveEpilogue>
 struct StageCountAutoCarveoutEpi : StageCountAutoCarveout<detail::compute_carveout_from_epi<CollectiveEpilogue>()> {};
 
+// Carves out the epilogue shared memory as StageCountAutoCarveoutEpi does, except for kernels whose epilogue
+// only runs once the mainloop has drained and whose epilogue tensors therefore alias the mainloop stages.
+// Builders of such kernels only carve out the epilogue pipeline storage and fill the rest with mainloop stages.
+template<class CollectiveEpilogue>
+struct StageCountAutoCarveoutEpiAliased : StageCountAutoCarveoutEpi<CollectiveEpilogue> {
+  static constexpr int aliased_bytes = detail::compute_aliased_carveout_from_epi<CollectiveEpilogue>();
+};
+
 using StageCountAuto = StageCountAutoCarveout<0>;
 
 // Used to automatically let the builder pick the kernel schedule.
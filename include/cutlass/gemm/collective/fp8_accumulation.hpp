@@ -40,7 +40,9 @@
 /// This class provides API to promote (add) or scale (multiply_add) the results 
 /// from the tensor core accumulators to the main accumulators when the number 
 /// of MMAs reaches the max number of MMA interval specified by user, after that
-/// the tensor core accumulators are zeroed.
+/// the tensor core accumulators are zeroed. An interval of 0 never promotes
+/// within the mainloop: the tensor core accumulators are promoted once, as
+/// the residue, which is the fastest setting for short K.
 //////////////////////////////////////////////////////////////////////////////
 
 namespace cutlass::gemm::collective {
@@ -170,6 +172,10 @@ public:
   CUTLASS_DEVICE
   void promote_if_needed(TensorAccumOrig &accum_) {
     mma_count_ += mma_count_per_mainloop_iteration_;
+    // The interval is uniform across the warp group, so never promoting skips the vote
+    if (accum_promotion_interval_ == 0) {
+      return;
+    }
     reset_accum_flag_ = __shfl_sync(0xffffffff, mma_count_ == accum_promotion_interval_, 0);
     if (reset_accum_flag_) {
       promote_core(accum_);
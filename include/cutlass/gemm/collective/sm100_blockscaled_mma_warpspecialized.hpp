@@ -671,6 +671,16 @@ struct CollectiveMma<
     return tmem_storage;
   }
 
+  // TMEM columns spanned by the tensors of init_tmem_tensors() as packed by set_tmem_offsets()
+  template <class EpilogueTile, bool IsOverlappingAccum = false>
+  CUTE_HOST_DEVICE static constexpr
+  uint32_t
+  tmem_allocation_columns() {
+    using TmemTensors = decltype(init_tmem_tensors<EpilogueTile, IsOverlappingAccum>(EpilogueTile{}));
+    return cutlass::detail::tmem_allocation_columns(
+      decltype(TmemTensors::accumulators){}, decltype(TmemTensors::tCtSFA){}, decltype(TmemTensors::tCtSFB){});
+  }
+
   template <class TmemStorage>
   CUTLASS_DEVICE static
   void
@@ -160,6 +160,8 @@ struct CollectiveMma<
   using TransformB = TransformB_;
   using ArchTag = typename DispatchPolicy::ArchTag;
 
+  static_assert(cute::is_same_v<InternalStrideA, StrideA> && cute::is_same_v<InternalStrideB, StrideB>,
+    "Grouped GEMM is not supported by the emulated FP32 mainloop");
   static_assert(cute::is_same_v<ElementA, float>, "Input type A should be float");
   static_assert(cute::is_same_v<ElementB, float>, "Input type B should be float");
   static_assert(cute::is_same_v<ElementAMma, cutlass::bfloat16_t>, "Compute type A should be cutlass::bfloat16_t");
@@ -1057,13 +1059,14 @@ struct CollectiveMma<
                                                     mainloop_params.ptr_B[next_batch]);
   }
 
-  template <class TensorMapA, class TensorMapB>
+  template <class TensorMapA, class TensorMapB, class ProblemShape>
   CUTLASS_DEVICE
   void
   tensormaps_perform_update(
       TensorMapStorage& shared_tensormap,
       Params const& mainloop_params,
       cute::tuple<TensorMapA, TensorMapB> const& input_tensormaps,
+      [[maybe_unused]] ProblemShape problem_shape,
       int32_t next_batch,
       uint32_t lane_predicate) {
     if (lane_predicate) {
@@ -146,6 +146,8 @@ public:
   using TransformA = TransformA_;
   using TransformB = TransformB_;
 
+  static_assert(cute::is_same_v<InternalStrideA, StrideA> && cute::is_same_v<InternalStrideB, StrideB>,
+    "Grouped GEMM is not supported by the emulated complex mainloop");
   static_assert(cute::is_same_v<typename ElementA::value_type, float>, "Underlying input type for A should be float");
   static_assert(cute::is_same_v<typename ElementB::value_type, float>, "Underlying input type for B should be float");
   static_assert(cute::is_same_v<ElementAMmaRaw, bfloat16_t>, "Underlying compute type for A should be bfloat16_t");
@@ -1127,13 +1129,14 @@ public:
                                                     mainloop_params.ptr_B[next_batch]);
   }
 
-  template <class TensorMapA, class TensorMapB>
+  template <class TensorMapA, class TensorMapB, class ProblemShape>
   CUTLASS_DEVICE
   void
   tensormaps_perform_update(
       TensorMapStorage& shared_tensormap,
       Params const& mainloop_params,
       cute::tuple<TensorMapA, TensorMapB> const& input_tensormaps,
+      [[maybe_unused]] ProblemShape problem_shape,
       int32_t next_batch,
       uint32_t lane_predicate) {
     if (lane_predicate) {
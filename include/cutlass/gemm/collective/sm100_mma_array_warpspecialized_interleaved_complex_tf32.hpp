@@ -117,6 +117,7 @@ struct CollectiveMma<
   using ElementB = complex<float>;
   using StrideB = StrideB_;
   using InternalStrideB  = cute::remove_pointer_t<StrideB>;
+  static constexpr bool IsGroupedGemmKernel = !cute::is_same_v<InternalStrideA, StrideA>;
 
 private:
   // ElementAMma and ElementBMma are cutlass::complex<tfloat32_t>, which are used as SMEM and RF data type.
@@ -210,7 +211,7 @@ public:
   using SmemLayoutA = decltype(UMMA::tile_to_mma_shape(
       SmemLayoutAtomA{},
       append(CtaShapeA_MK{}, Int<DispatchPolicy::ComputationPipelineStageCount>{}),
-             (cute::conditional_t<cutlass::gemm::detail::is_mn_major<StrideA>(), Step<_2,_1,_3>, Step<_1,_2,_3>>{})));
+             (cute::conditional_t<cutlass::gemm::detail::is_mn_major<InternalStrideA>(), Step<_2,_1,_3>, Step<_1,_2,_3>>{})));
 
   using SmemLayoutACompute = decltype(UMMA::tile_to_mma_shape(
       SmemLayoutAtomACompute{},
@@ -219,7 +220,7 @@ public:
   using SmemLayoutB = decltype(UMMA::tile_to_mma_shape(
       SmemLayoutAtomB{},
       append(CtaShapeB_NK{}, Int<DispatchPolicy::ComputationPipelineStageCount>{}),
-             (cute::conditional_t<cutlass::gemm::detail::is_mn_major<StrideB>(), Step<_2,_1,_3>, Step<_1,_2,_3>>{})));
+             (cute::conditional_t<cutlass::gemm::detail::is_mn_major<InternalStrideB>(), Step<_2,_1,_3>, Step<_1,_2,_3>>{})));
 
   using SmemLayoutBCompute = decltype(UMMA::tile_to_mma_shape(
       SmemLayoutAtomBCompute{},
@@ -288,7 +289,7 @@ public:
 
     using TMA_A = decltype(make_tma_atom_A_sm100<ElementAMmaRaw>(
         GmemTiledCopyA{},
-        make_tensor(recast_ptr<ElementA>(nullptr), repeat_like(StrideA{}, int32_t(0)), StrideA{}),
+        make_tensor(recast_ptr<ElementA>(nullptr), repeat_like(InternalStrideA{}, int32_t(0)), InternalStrideA{}),
         SmemLayoutA{}(_,_,_,cute::Int<0>{}),
         TileShape{},
         TiledMma{},
@@ -296,7 +297,7 @@ public:
       );
     using TMA_B = decltype(make_tma_atom_B_sm100<ElementBMmaRaw>(
         GmemTiledCopyB{},
-        make_tensor(recast_ptr<ElementB>(nullptr), repeat_like(StrideB{}, int32_t(0)), StrideB{}),
+        make_tensor(recast_ptr<ElementB>(nullptr), repeat_like(InternalStrideB{}, int32_t(0)), InternalStrideB{}),
         SmemLayoutB{}(_,_,_,cute::Int<0>{}),
         TileShape{},
         TiledMma{},
@@ -309,7 +310,9 @@ public:
     dim3 cluster_shape_fallback;
     cute::TmaDescriptor* tensormaps;
     ElementA const** ptr_A;
+    StrideA dA;
     ElementB const** ptr_B;
+    StrideB dB;
   };
 
   CUTLASS_DEVICE
@@ -333,17 +336,39 @@ public:
   to_underlying_arguments(ProblemShape problem_shape, Arguments const& args, void* workspace, cutlass::KernelHardwareInfo const& hw_info = cutlass::KernelHardwareInfo{}) {
     (void) workspace;
 
-    // Tensor shapes for Ptr-Array are initialized correctly here.
-    auto [M,N,K,mock_L] = problem_shape.get_host_problem_shape(0);
+    // These tensor shapes (only applicable for grouped gemm) and pointers are only used to create tensormap/tma desc.
+    // These will be replaced with correct values before the initial tma load.
+    auto init_shape = repeat_like(append<4>(typename ProblemShape::UnderlyingProblemShape{}, 1), int32_t(1));
+    auto init_M = get<0>(init_shape);
+    auto init_N = get<1>(init_shape);
+    auto init_K = get<2>(init_shape);
     // Batches/Groups are managed by using appropriate pointers to input matrices
-    mock_L = 1;
+    auto mock_L = get<3>(init_shape);
 
     // Tensor pointers will be fixed before the first access
     ElementA const* ptr_A_first_batch = nullptr;
     ElementB const* ptr_B_first_batch = nullptr;
 
-    Tensor tensor_a = make_tensor(ptr_A_first_batch, make_layout(make_shape(M,K,mock_L), args.dA));
-    Tensor tensor_b = make_tensor(ptr_B_first_batch, make_layout(make_shape(N,K,mock_L), args.dB));
+    InternalStrideA stride_a;
+    InternalStrideB stride_b;
+    if constexpr (IsGroupedGemmKernel) {
+      // Strides for Grouped Gemm will be replaced prior to the first access regardless.
+      stride_a = InternalStrideA{};
+      stride_b = InternalStrideB{};
+    }
+    else {
+      // Tensor shapes for Ptr-Array are initialized correctly only here.
+      auto problem_shape_MNK = problem_shape.get_host_problem_shape(0);
+      init_M = get<0>(problem_shape_MNK);
+      init_N = get<1>(problem_shape_MNK);
+      init_K = get<2>(problem_shape_MNK);
+
+      stride_a = args.dA;
+      stride_b = args.dB;
+    }
+
+    Tensor tensor_a = make_tensor(ptr_A_first_batch, make_layout(make_shape(init_M,init_K,mock_L), stride_a));
+    Tensor tensor_b = make_tensor(ptr_B_first_batch, make_layout(make_shape(init_N,init_K,mock_L), stride_b));
 
     auto cluster_shape = cutlass::detail::select_cluster_shape(ClusterShape{}, hw_info.cluster_shape);
     // Cluster layout for TMA construction
@@ -393,7 +418,9 @@ public:
       hw_info.cluster_shape_fallback,
       reinterpret_cast<cute::TmaDescriptor*>(workspace),
       reinterpret_cast<ElementA const**>(args.ptr_A),
-      reinterpret_cast<ElementB const**>(args.ptr_B)
+      args.dA,
+      reinterpret_cast<ElementB const**>(args.ptr_B),
+      args.dB
     };
   }
 
@@ -418,13 +445,19 @@ public:
       ProblemShape problem_shape,
       [[maybe_unused]] Arguments const& args) {
     constexpr int tma_alignment_bits = 128;
-    auto [M,N,K,L] = problem_shape.get_host_problem_shape(0);
-
-    bool implementable = true;
     constexpr int min_tma_aligned_elements_A = tma_alignment_bits / cutlass::sizeof_bits<ElementA>::value;
-    implementable = implementable && cutlass::detail::check_alignment<min_tma_aligned_elements_A>(cute::make_shape(M,K,L), StrideA{});
     constexpr int min_tma_aligned_elements_B = tma_alignment_bits / cutlass::sizeof_bits<ElementB>::value;
-    implementable = implementable && cutlass::detail::check_alignment<min_tma_aligned_elements_B>(cute::make_shape(N,K,L), StrideB{});
+
+    bool implementable = true;
+    if (problem_shape.is_host_problem_shape_available()) {
+      // Check alignment for all problem sizes
+      for (int i = 0; i < problem_shape.groups(); i++) {
+        auto problem_shape_MNKL = append<4>(problem_shape.get_host_problem_shape(i), 1);
+        auto [M,N,K,L] = problem_shape_MNKL;
+        implementable = implementable && cutlass::detail::check_alignment<min_tma_aligned_elements_A>(cute::make_shape(M,K,L), InternalStrideA{});
+        implementable = implementable && cutlass::detail::check_alignment<min_tma_aligned_elements_B>(cute::make_shape(N,K,L), InternalStrideB{});
+      }
+    }
 
     if (!implementable) {
       CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum alignment requirements for TMA.\n");
@@ -914,13 +947,61 @@ public:
                                                     mainloop_params.ptr_B[next_batch]);
   }
 
-  template <class TensorMapA, class TensorMapB>
+  // Replace dim and strides for the global tensor - used only for Grouped GEMM (to be done by single thread)
+  template <class ProblemShape_MNKL>
+  CUTLASS_DEVICE
+  void
+  tensormaps_replace_global_tensor_properties(
+      TensorMapStorage& shared_tensormap,
+      Params const& mainloop_params,
+      int32_t next_group,
+      ProblemShape_MNKL problem_shape_mnkl) {
+    const uint32_t M = get<0>(problem_shape_mnkl);
+    const uint32_t N = get<1>(problem_shape_mnkl);
+    const uint32_t K = get<2>(problem_shape_mnkl);
+    // Replace all dims for consistency
+    constexpr int MaxTensorRank = 5;
+    cute::array<uint32_t, MaxTensorRank> prob_shape_A  = {1,1,1,1,1};
+    cute::array<uint64_t, MaxTensorRank> prob_stride_A = {0,0,0,0,0};
+    cute::array<uint32_t, MaxTensorRank> prob_shape_B  = {1,1,1,1,1};
+    cute::array<uint64_t, MaxTensorRank> prob_stride_B = {0,0,0,0,0};
+
+    // The TMA descriptors view the complex inputs as interleaved real valued ElementAMmaRaw/ElementBMmaRaw
+    ElementA const* ptr_A = nullptr;
+    Tensor tensor_a = recast<ElementAMmaRaw>(make_tensor(ptr_A, make_shape(M,K,Int<1>{}), mainloop_params.dA[next_group]));
+
+    ElementB const* ptr_B = nullptr;
+    Tensor tensor_b = recast<ElementBMmaRaw>(make_tensor(ptr_B, make_shape(N,K,Int<1>{}), mainloop_params.dB[next_group]));
+
+    cute::detail::fill_tma_gmem_shape_stride(*observed_tma_load_a_, tensor_a,
+                                             prob_shape_A, prob_stride_A);
+    cute::detail::fill_tma_gmem_shape_stride(*observed_tma_load_b_, tensor_b,
+                                             prob_shape_B, prob_stride_B);
+
+    // Convert strides to byte strides
+    for (uint64_t& stride : prob_stride_A) {
+      stride = (stride * sizeof_bits_v<ElementAMmaRaw>) / 8;
+    }
+    for (uint64_t& stride : prob_stride_B) {
+      stride = (stride * sizeof_bits_v<ElementBMmaRaw>) / 8;
+    }
+
+    cute::tma_descriptor_replace_dims_strides_in_shared_mem(shared_tensormap.smem_tensormap_A,
+                                                            prob_shape_A,
+                                                            prob_stride_A);
+    cute::tma_descriptor_replace_dims_strides_in_shared_mem(shared_tensormap.smem_tensormap_B,
+                                                            prob_shape_B,
+                                                            prob_stride_B);
+  }
+
+  template <class TensorMapA, class TensorMapB, class ProblemShape>
   CUTLASS_DEVICE
   void
   tensormaps_perform_update(
       TensorMapStorage& shared_tensormap,
       Params const& mainloop_params,
       cute::tuple<TensorMapA, TensorMapB> const& input_tensormaps,
+      ProblemShape problem_shape,
       int32_t next_batch,
       uint32_t lane_predicate) {
     if (lane_predicate) {
@@ -929,6 +1010,13 @@ public:
 
       // Replacing global_address for the next batch
       tensormaps_replace_global_address(shared_tensormap, mainloop_params, next_batch);
+
+      if constexpr (IsGroupedGemmKernel) {
+        auto problem_shape_MNKL = append<4>(problem_shape.get_problem_shape(next_batch), 1);
+        // Replacing global dims and strides for the next batch
+        tensormaps_replace_global_tensor_properties(shared_tensormap,
+          mainloop_params, next_batch, problem_shape_MNKL);
+      }
     }
   }
 
@@ -58,7 +58,11 @@ using namespace cute;
 
 
 
-// WarpSpecialized Mainloop
+// WarpSpecialized Mainloop loading A with TMA and B with cp.async.
+//   If ptr_gather_B_indices is set, rows of B are gathered: row n of the logical (N,K) B operand is
+//   row ptr_gather_B_indices[n] of the source (num_rows_B,K) matrix, e.g. an embedding table or the
+//   tokens routed to an expert. Indices must lie in [0, num_rows_B). Only K-major B and L == 1 are
+//   supported in this mode. Rows of A are gathered by swapping the operands (D^T = B^T A^T).
 // Both DMA Load and MMA methods of this class must be run by a single thread that's picked by elect_one
 template <
   int Stages,
@@ -247,9 +251,11 @@ struct CollectiveMma<
   // Host side kernel arguments
   struct Arguments {
     ArrayElementA const* ptr_A{nullptr};
-    ArrayElementB const* ptr_B{nullptr};
+    ArrayElementB const* ptr_B{nullptr};       // Source B matrix of num_rows_B rows if rows are gathered
     RuntimeDataTypeA runtime_data_type_a{};
     RuntimeDataTypeB runtime_data_type_b{};
+    int32_t const* ptr_gather_B_indices{nullptr}; // Optional N row indices into the source B matrix
+    int32_t num_rows_B{0};
   };
 
   // Device side kernel params
@@ -273,6 +279,9 @@ struct CollectiveMma<
 
     RuntimeDataTypeA runtime_data_type_a;
     RuntimeDataTypeB runtime_data_type_b;
+
+    int32_t const* ptr_gather_B_indices{nullptr};
+    int64_t gather_B_row_stride{0};
   };
 
   CUTLASS_DEVICE
@@ -303,6 +312,8 @@ struct CollectiveMma<
     StrideA stride_a = cutlass::make_internal_packed_stride(StrideA{}, shape_a);
     Tensor tensor_a = make_tensor(ptr_A, make_layout(shape_a, stride_a));
 
+    StrideB stride_b = cutlass::make_internal_packed_stride(StrideB{}, make_shape(N, K, L));
+
     auto cluster_layout_vmnk = tiled_divide(make_layout(ClusterShape{}), make_tile(typename TiledMma::AtomThrID{}));
 
     typename Params::TMA_A tma_load_a = make_tma_atom_A_sm100<TmaInternalElementA>(
@@ -317,7 +328,9 @@ struct CollectiveMma<
       tma_load_a,
       args.ptr_B,
       args.runtime_data_type_a,
-      args.runtime_data_type_b
+      args.runtime_data_type_b,
+      args.ptr_gather_B_indices,
+      int64_t(get<0>(stride_b))
     };
   }
 
@@ -344,7 +357,22 @@ struct CollectiveMma<
     if (!implementable) {
       CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum alignment requirements for CpAsync.\n");
     }
-    
+
+    if (implementable && args.ptr_gather_B_indices != nullptr) {
+      if constexpr (::cutlass::gemm::detail::is_major<0,StrideB>()) {
+        CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Gathered B requires a K-major B.\n");
+        implementable = false;
+      }
+      if (L != 1) {
+        CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Gathered B only supports L == 1.\n");
+        implementable = false;
+      }
+      if (N > 0 && args.num_rows_B <= 0) {
+        CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Gathered B requires a non-empty source matrix.\n");
+        implementable = false;
+      }
+    }
+
     return implementable;
   }
 
@@ -622,6 +650,17 @@ struct CollectiveMma<
       tBpB(n,0) = elem_less(get<0>(tBcBk(0,n,0)), N);  // blk_n coord < N
     }
 
+    // Offsets of gathered rows from the dense rows addressed by tBgB, loaded once per tile
+    bool const is_gather_b = params.ptr_gather_B_indices != nullptr;
+    Tensor tBoB = make_tensor<int64_t>(make_shape(size<0>(tBpB)));
+    if (is_gather_b) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int n = 0; n < size<0>(tBpB); ++n) {
+        int row = get<0>(tBcBk(0,n,0));
+        tBoB(n) = tBpB(n,0) ? (int64_t(params.ptr_gather_B_indices[row]) - row) * params.gather_B_row_stride : 0;
+      }
+    }
+
     // we will process the last tile after the mainloop
     if (k_residue != 0) {
       --k_tile_count;
@@ -634,7 +673,12 @@ struct CollectiveMma<
       mainloop_pipeline.producer_acquire(mainloop_pipe_producer_state);
       int write_stage = mainloop_pipe_producer_state.index();
 
-      copy_if(gmem_to_smem_b_tiled_copy, tBpB, tBgB(_,_,_,*k_tile_iter), tBsB(_,_,_,write_stage));
+      if (is_gather_b) {
+        copy_gathered_b(gmem_to_smem_b_tiled_copy, tBpB, tBoB, tBgB(_,_,_,*k_tile_iter), tBsB(_,_,_,write_stage));
+      }
+      else {
+        copy_if(gmem_to_smem_b_tiled_copy, tBpB, tBgB(_,_,_,*k_tile_iter), tBsB(_,_,_,write_stage));
+      }
 
       mainloop_pipeline.producer_commit_local(mainloop_pipe_producer_state, cutlass::arch::cpasync_barrier_arrive);
       --k_tile_count;
@@ -649,13 +693,27 @@ struct CollectiveMma<
       mainloop_pipeline.producer_acquire(mainloop_pipe_producer_state);
       int write_stage = mainloop_pipe_producer_state.index();
 
-      CUTLASS_PRAGMA_UNROLL
-      for (int k = 0; k < size<2>(tBsB); ++k) {
-        if (int(get<1>(tBcBk(0,0,k))) >= 0) {      // blk_k coord < K
-          copy_if(gmem_to_smem_b_tiled_copy, tBpB(_,k), tBgB(_,_,k,*k_tile_iter), tBsB(_,_,k,write_stage));
+      if (is_gather_b) {
+        // Zero-fill the k residue through the predicates of the gathered copy
+        Tensor tBpB_k = make_tensor<bool>(make_shape(size<0>(tBpB), size<1>(tBpB)));
+        CUTLASS_PRAGMA_UNROLL
+        for (int n = 0; n < size<0>(tBpB_k); ++n) {
+          CUTLASS_PRAGMA_UNROLL
+          for (int k = 0; k < size<1>(tBpB_k); ++k) {
+            tBpB_k(n,k) = tBpB(n,0) && int(get<1>(tBcBk(0,0,k))) >= 0;      // blk_k coord < K
+          }
         }
-        else {
-          clear(tBsB(_,_,k,write_stage));
+        copy_gathered_b(gmem_to_smem_b_tiled_copy, tBpB_k, tBoB, tBgB(_,_,_,*k_tile_iter), tBsB(_,_,_,write_stage));
+      }
+      else {
+        CUTLASS_PRAGMA_UNROLL
+        for (int k = 0; k < size<2>(tBsB); ++k) {
+          if (int(get<1>(tBcBk(0,0,k))) >= 0) {      // blk_k coord < K
+            copy_if(gmem_to_smem_b_tiled_copy, tBpB(_,k), tBgB(_,_,k,*k_tile_iter), tBsB(_,_,k,write_stage));
+          }
+          else {
+            clear(tBsB(_,_,k,write_stage));
+          }
         }
       }
       ++k_tile_iter;
@@ -671,6 +729,24 @@ struct CollectiveMma<
     return cute::make_tuple(mainloop_pipe_producer_state, k_tile_iter);
   }
 
+  /// Copies one (CPY,CPY_N,CPY_K) k-tile of gathered B rows. Each row is read at its offset in tBoB
+  /// from the dense row addressed by tBgB; rows and k blocks with a false predicate are zero-filled.
+  template <class TiledCopyB, class PredTensor, class OffsetTensor, class SrcTensor, class DstTensor>
+  CUTLASS_DEVICE static void
+  copy_gathered_b(
+    TiledCopyB const& tiled_copy,
+    PredTensor const& tBpB,      // (CPY_N,CPY_K)
+    OffsetTensor const& tBoB,    // (CPY_N)
+    SrcTensor const& tBgB,       // (CPY,CPY_N,CPY_K)
+    DstTensor&& tBsB) {          // (CPY,CPY_N,CPY_K)
+    CUTLASS_PRAGMA_UNROLL
+    for (int n = 0; n < size<1>(tBsB); ++n) {
+      Tensor tBgB_n = tBgB(_,n,_);
+      Tensor tBsB_n = tBsB(_,n,_);
+      copy_if(tiled_copy, tBpB(n,_), make_tensor(tBgB_n.data() + tBoB(n), tBgB_n.layout()), tBsB_n);
+    }
+  }
+
   /// Perform a Producer Epilogue to prevent early exit of ctas in a Cluster
   CUTLASS_DEVICE void
   load_tail_tma(MainloopPipelineTMA mainloop_pipeline, MainloopPipelineTMAState mainloop_pipe_producer_state) {
@@ -368,18 +368,26 @@ struct CollectiveMma<
     LayoutSFA layout_SFA;
     LayoutSFB layout_SFB;
 
+    ElementAccumulator const* ptr_SFA;
+    ElementAccumulator const* ptr_SFB;
+    Shape<int32_t,int32_t,int32_t> scale_granularity;
+
     CUTLASS_DEVICE
     LoadSFParams (
         KTileCount k_tiles_,
         GTensorScaleA gSFA_mkl_, GTensorScaleB gSFB_nkl_,
         IdentTensorScaleA identSFA_mkl_, IdentTensorScaleB identSFB_nkl_,
         STensorScaleA sSFA_, STensorScaleB sSFB_,
-        LayoutSFA layout_SFA_, LayoutSFB layout_SFB_)
+        LayoutSFA layout_SFA_, LayoutSFB layout_SFB_,
+        ElementAccumulator const* ptr_SFA_, ElementAccumulator const* ptr_SFB_,
+        Shape<int32_t,int32_t,int32_t> scale_granularity_)
     : k_tiles(k_tiles_)
     , gSFA_mkl(gSFA_mkl_), gSFB_nkl(gSFB_nkl_)
     , identSFA_mkl(identSFA_mkl_), identSFB_nkl(identSFB_nkl_)
     , sSFA(sSFA_), sSFB(sSFB_)
-    , layout_SFA(layout_SFA_), layout_SFB(layout_SFB_) {}
+    , layout_SFA(layout_SFA_), layout_SFB(layout_SFB_)
+    , ptr_SFA(ptr_SFA_), ptr_SFB(ptr_SFB_)
+    , scale_granularity(scale_granularity_) {}
   };
 
   template<class FragmentA, class FragmentB>
@@ -424,6 +432,9 @@ struct CollectiveMma<
     LayoutSFB layout_SFB{};
     RuntimeDataTypeA runtime_data_type_a{};
     RuntimeDataTypeB runtime_data_type_b{};
+    // Run-time scaling granularity (M,N,K) of SFA and SFB, see ScaleConfig::tile_atom_to_shape_SFA.
+    // Zeros select the compile-time ScaleGranularity of their mode.
+    Shape<int32_t,int32_t,int32_t> scale_granularity{0, 0, 0};
   };
 
   // Device side kernel params
@@ -461,6 +472,7 @@ struct CollectiveMma<
     LayoutSFA layout_SFA;
     ElementAccumulator const* ptr_SFB;
     LayoutSFB layout_SFB;
+    Shape<int32_t,int32_t,int32_t> scale_granularity;
   };
 
   CUTLASS_DEVICE
@@ -548,7 +560,9 @@ struct CollectiveMma<
       args.ptr_SFA,
       args.layout_SFA,
       args.ptr_SFB,
-      args.layout_SFB
+      args.layout_SFB,
+      cutlass::detail::resolve_blockwise_scale_granularity<ScaleGranularityM, ScaleGranularityN, ScaleGranularityK>(
+          args.scale_granularity)
     };
   }
 
@@ -574,14 +588,27 @@ struct CollectiveMma<
       CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum alignment requirements for TMA.\n");
     }
 
-    bool implementable_sf = cutlass::detail::check_alignment<CopyAlignmentSFA>(args.layout_SFA);
-    implementable_sf = implementable_sf && cutlass::detail::check_alignment<CopyAlignmentSFB>(args.layout_SFB);
+    auto scale_granularity = cutlass::detail::resolve_blockwise_scale_granularity<
+        ScaleGranularityM, ScaleGranularityN, ScaleGranularityK>(args.scale_granularity);
+    bool implementable_sf_granularity = cutlass::detail::is_blockwise_scale_granularity_supported<
+        ScaleGranularityM, ScaleGranularityN, ScaleGranularityK>(scale_granularity);
+
+    if (!implementable_sf_granularity) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Scale granularity must be a multiple of the compile-time scale granularity.\n");
+    }
+
+    // Scales at a run-time granularity are fetched one element at a time and need no vector alignment
+    bool runtime_granularity = get<0>(scale_granularity) != ScaleGranularityM ||
+                               get<1>(scale_granularity) != ScaleGranularityN ||
+                               get<2>(scale_granularity) != ScaleGranularityK;
+    bool implementable_sf = runtime_granularity || cutlass::detail::check_alignment<CopyAlignmentSFA>(args.layout_SFA);
+    implementable_sf = implementable_sf && (runtime_granularity || cutlass::detail::check_alignment<CopyAlignmentSFB>(args.layout_SFB));
 
     if (!implementable_sf) {
       CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum alignment requirements for Scale Factors.\n");
     }
 
-    return implementable && implementable_sf;
+    return implementable && implementable_sf && implementable_sf_granularity;
   }
 
   /// Issue Tma Descriptor Prefetch -- ideally from a single thread for best performance
@@ -746,7 +773,10 @@ struct CollectiveMma<
       identSFA_mkl, identSFB_nkl,                     // for predicating scale tensor copies
       sSFA, sSFB,                                     // for scale tensor values
       mainloop_params.layout_SFA,                     // for predicating scale tensor copies
-      mainloop_params.layout_SFB                      // for predicating scale tensor copies
+      mainloop_params.layout_SFB,                     // for predicating scale tensor copies
+      mainloop_params.ptr_SFA,                        // for scales at run-time granularity
+      mainloop_params.ptr_SFB,                        // for scales at run-time granularity
+      mainloop_params.scale_granularity
     };
     return load_params;
   }
@@ -909,7 +939,9 @@ struct CollectiveMma<
           gSFA_mkl, gSFB_nkl,
           identSFA_mkl, identSFB_nkl,
           sSFA, sSFB,
-          layout_SFA, layout_SFB] = load_inputs;
+          layout_SFA, layout_SFB,
+          ptr_SFA, ptr_SFB,
+          scale_granularity] = load_inputs;
 
     // slice out the work coord from partitioned tensors
     GmemTiledCopySFA scale_copy_a{};
@@ -945,6 +977,11 @@ struct CollectiveMma<
     Tensor thr_tile_pSFA = make_fragment_like<bool>(tSFAgSFA_k_compact(_0{},_,_,_0{}));
     Tensor thr_tile_pSFB = make_fragment_like<bool>(tSFBgSFB_k_compact(_0{},_,_,_0{}));
 
+    // Scales coarser than the compile-time granularity are fetched per smem entry
+    using CopyAtomRuntimeSF = Copy_Atom<SM80_CP_ASYNC_CACHEALWAYS<ElementAccumulator>, ElementAccumulator>;
+    auto [sf_m, sf_n, sf_k] = scale_granularity;
+    bool runtime_granularity = sf_m != ScaleGranularityM || sf_n != ScaleGranularityN || sf_k != ScaleGranularityK;
+
     // Issue the loads
     CUTLASS_PRAGMA_NO_UNROLL
     while (k_tile_count > 0) {
@@ -965,10 +1002,23 @@ struct CollectiveMma<
             shape(filter_zeros(layout_SFB))) && threadIdx.x % 32 < size(scale_copy_b);
       }
 
-      copy_if(scale_copy_a, thr_tile_pSFA, tSFAgSFA_k_compact(_,_,_,*k_tile_iter), 
-          tSFAsSFA_compact(_,_,_,mainloop_sf_pipe_producer_state.index()));
-      copy_if(scale_copy_b, thr_tile_pSFB, tSFBgSFB_k_compact(_,_,_,*k_tile_iter), 
-          tSFBsSFB_compact(_,_,_,mainloop_sf_pipe_producer_state.index()));
+      if (runtime_granularity) {
+        int k_offset = *k_tile_iter * size<2>(CtaShape_MNK{});
+        cutlass::detail::copy_blockwise_scales(
+            CopyAtomRuntimeSF{}, ptr_SFA, layout_SFA, sf_m, sf_k,
+            get<0>(cta_coord_mnkl) * size<0>(CtaShape_MNK{}), k_offset, get<3>(cta_coord_mnkl),
+            sSFA(_,_,mainloop_sf_pipe_producer_state.index()), threadIdx.x % NumThreadsPerWarp, NumThreadsPerWarp);
+        cutlass::detail::copy_blockwise_scales(
+            CopyAtomRuntimeSF{}, ptr_SFB, layout_SFB, sf_n, sf_k,
+            get<1>(cta_coord_mnkl) * size<1>(CtaShape_MNK{}), k_offset, get<3>(cta_coord_mnkl),
+            sSFB(_,_,mainloop_sf_pipe_producer_state.index()), threadIdx.x % NumThreadsPerWarp, NumThreadsPerWarp);
+      }
+      else {
+        copy_if(scale_copy_a, thr_tile_pSFA, tSFAgSFA_k_compact(_,_,_,*k_tile_iter), 
+            tSFAsSFA_compact(_,_,_,mainloop_sf_pipe_producer_state.index()));
+        copy_if(scale_copy_b, thr_tile_pSFB, tSFBgSFB_k_compact(_,_,_,*k_tile_iter), 
+            tSFBsSFB_compact(_,_,_,mainloop_sf_pipe_producer_state.index()));
+      }
       mainloop_sf_pipeline.producer_commit(mainloop_sf_pipe_producer_state, cutlass::arch::cpasync_barrier_arrive_noinc);
 
       __syncwarp();
@@ -265,8 +265,19 @@ public:
                               AtomThrShapeMNK>;
   using Mma2AccumPipelineState = typename Mma2AccumPipeline::PipelineState;
 
+  // The K group size of the scale/zero layout may only be known at runtime (see Sm100MixedInputRuntimeGroupScaleConfig).
+  // In that case smem holds one scale/zero column per k-tile, and the producer selects the column of the group the k-tile falls in.
+  static constexpr bool IsRuntimeScaleGranularityK = not cute::is_static_v<decltype(get<1,0>(shape(LayoutScale{})))>;
+  static_assert(cute::is_static_v<decltype(get<0,0>(shape(LayoutScale{})))>, "The scale granularity along MN must be static.");
   static constexpr int ScaleGranularityMN = size<0,0>(LayoutScale{});
-  static constexpr int ScaleGranularityK = size<1,0>(LayoutScale{});
+  static constexpr int ScaleGranularityK = IsRuntimeScaleGranularityK ? size<2>(TileShape{}) : size<1,0>(LayoutScale{});
+  // Layout seen by the scale/zero TMA. With a runtime group size each group is presented as a single k-tile wide group.
+  using TmaLayoutScale = cute::conditional_t<IsRuntimeScaleGranularityK,
+      Layout<decltype(make_shape(get<0>(shape(LayoutScale{})), 
+                                 make_shape(Int<ScaleGranularityK>{}, get<1,1>(shape(LayoutScale{}))), 
+                                 get<2>(shape(LayoutScale{})))), 
+             cute::remove_cvref_t<decltype(stride(LayoutScale{}))>>,
+      LayoutScale>;
   using ScaleConfig = cutlass::detail::Sm100MixedInputBlockwiseScaleConfig<
       ScaleGranularityMN, 
       ScaleGranularityK>; 
@@ -440,7 +451,7 @@ public:
 
     using TMA_Scale = decltype(make_tma_atom_A_sm100(
         GmemTiledCopyScale{},
-        make_tensor(static_cast<NonVoidElementScale const*>(nullptr), LayoutScale{}),
+        make_tensor(static_cast<NonVoidElementScale const*>(nullptr), TmaLayoutScale{}),
         SmemLayoutScale{}(_,_,_,cute::Int<0>{}),
         TileShape{},
         TiledMma{},
@@ -449,7 +460,9 @@ public:
 
     TMA_Scale tma_load_scale;
     TMA_Scale tma_load_zero;
-    
+    // Number of consecutive k-tiles sharing one scale/zero column. Only used with a runtime group size.
+    int reload_factor = 1;
+
   };
 
   struct EmptyScaleParams {};
@@ -505,6 +518,20 @@ public:
     }
   }
 
+  // Rebuild the user's scale/zero layout as TmaLayoutScale, replacing a runtime group size with one k-tile.
+  CUTLASS_HOST_DEVICE static constexpr TmaLayoutScale
+  get_tma_layout_scale(LayoutScale const& layout_S) {
+    if constexpr (IsRuntimeScaleGranularityK) {
+      return make_layout(make_shape(get<0>(layout_S.shape()),
+                                    make_shape(Int<ScaleGranularityK>{}, get<1,1>(layout_S.shape())),
+                                    get<2>(layout_S.shape())),
+                         layout_S.stride());
+    }
+    else {
+      return layout_S;
+    }
+  }
+
   template <class ProblemShape>
   static constexpr Params
   to_underlying_arguments(
@@ -576,8 +603,14 @@ public:
     } 
     else if constexpr (ModeHasScales) {
       ElementScale const* ptr_S = args.ptr_S;
-    
-      Tensor tensor_scale = make_tensor(detail::get_logical_ptr(ptr_S), args.layout_S);
+
+      TmaLayoutScale layout_S_tma = get_tma_layout_scale(args.layout_S);
+      int reload_factor = 1;
+      if constexpr (IsRuntimeScaleGranularityK) {
+        reload_factor = ceil_div(size<1,0>(args.layout_S), ScaleGranularityK);
+      }
+
+      Tensor tensor_scale = make_tensor(detail::get_logical_ptr(ptr_S), layout_S_tma);
       typename Params::TMA_Scale tma_load_scale = make_tma_atom_A_sm100<ElementScale>(
         GmemTiledCopyScale{},
         tensor_scale,
@@ -587,7 +620,7 @@ public:
         cluster_layout_vmnk);
 
       if constexpr(KernelConversionMode == ConversionMode::ConvertAndScale) {
-        typename Params::TMAScaleParams scale_params{tma_load_scale, {}};
+        typename Params::TMAScaleParams scale_params{tma_load_scale, {}, reload_factor};
         return { 
           scale_params,
           tma_load_a, 
@@ -599,7 +632,7 @@ public:
           args.dA, args.dB };
       }
       else if constexpr(KernelConversionMode == ConversionMode::ConvertAndScaleWithZero) {
-        Tensor tensor_zero = make_tensor(detail::get_logical_ptr(args.ptr_Z), args.layout_S);
+        Tensor tensor_zero = make_tensor(detail::get_logical_ptr(args.ptr_Z), layout_S_tma);
         typename Params::TMA_Scale tma_load_zero = make_tma_atom_A_sm100<ElementScale>(
               GmemTiledCopyScale{},
               tensor_zero,
@@ -608,7 +641,7 @@ public:
               TiledMma{},
               cluster_layout_vmnk);
 
-        typename Params::TMAScaleParams scale_params{tma_load_scale, tma_load_zero};
+        typename Params::TMAScaleParams scale_params{tma_load_scale, tma_load_zero, reload_factor};
         return { 
           scale_params,
           tma_load_a, 
@@ -659,6 +692,13 @@ public:
       check_aligned_S = cutlass::detail::check_alignment<min_tma_aligned_elements_scale>(args.layout_S);
       check_mode_args = check_mode_args && (args.ptr_S != nullptr);
 
+      if constexpr (IsRuntimeScaleGranularityK) {
+        // A group must cover whole k-tiles, unless a single group spans the entire K extent.
+        int const group_size = size<1,0>(args.layout_S);
+        check_mode_args = check_mode_args && (group_size > 0);
+        check_mode_args = check_mode_args && (group_size == K || (group_size % ScaleGranularityK) == 0);
+      }
+
       if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale) {
         check_mode_args = check_mode_args && (args.ptr_Z == nullptr);
       }
@@ -794,13 +834,18 @@ public:
         auto tSgS_mkl = get<0>(extra_input_partitions);
         auto tSgS = tSgS_mkl(_, get<0>(cta_coord_mnkl) / size(typename TiledMma::AtomThrID{}), _, get<3>(cta_coord_mnkl));
         auto tSsS = get<1>(extra_input_partitions);
-        copy(params.tma_load_scale.with(*load2xform_tma_barrier, mcast_mask_a), tSgS(_,*k_tile_iter), tSsS(_,tile_A_write_stage));
+        // With a runtime group size, consecutive k-tiles of the same group reload the same scale/zero column.
+        int scale_k_tile = *k_tile_iter;
+        if constexpr (IsRuntimeScaleGranularityK) {
+          scale_k_tile /= params.reload_factor;
+        }
+        copy(params.tma_load_scale.with(*load2xform_tma_barrier, mcast_mask_a), tSgS(_,scale_k_tile), tSsS(_,tile_A_write_stage));
 
         if constexpr (KernelConversionMode == ConversionMode::ConvertAndScaleWithZero) {
           auto tZgZ_mkl = get<2>(extra_input_partitions);
           auto tZgZ = tZgZ_mkl(_, get<0>(cta_coord_mnkl) / size(typename TiledMma::AtomThrID{}), _, get<3>(cta_coord_mnkl));
           auto tZsZ = get<3>(extra_input_partitions);
-          copy(params.tma_load_zero.with(*load2xform_tma_barrier, mcast_mask_a), tZgZ(_,*k_tile_iter), tZsZ(_,tile_A_write_stage));
+          copy(params.tma_load_zero.with(*load2xform_tma_barrier, mcast_mask_a), tZgZ(_,scale_k_tile), tZsZ(_,tile_A_write_stage));
         }
       } 
       else {
@@ -929,7 +974,7 @@ public:
       // Separate out problem shape for convenience
       auto [M,N,K,L] = problem_shape_MNKL;
 
-      Tensor mS_mkl = params.tma_load_scale.get_tma_tensor(shape(LayoutScale{}));
+      Tensor mS_mkl = params.tma_load_scale.get_tma_tensor(shape(TmaLayoutScale{}));
       Tensor gS_mkl = local_tile(mS_mkl, TileShape{}, make_coord(_,_,_), Step<_1, X,_1>{});
 
       Tensor sS  = make_tensor(make_smem_ptr(shared_storage.input.smem_scale.begin()), SmemLayoutScale{});
@@ -949,7 +994,7 @@ public:
           cute::make_tuple(tSgS_mkl, tSsS));
       }
       else if constexpr (KernelConversionMode == ConversionMode::ConvertAndScaleWithZero) {
-        Tensor mZ_mkl = params.tma_load_scale.get_tma_tensor(shape(LayoutScale{}));
+        Tensor mZ_mkl = params.tma_load_scale.get_tma_tensor(shape(TmaLayoutScale{}));
         Tensor gZ_mkl = local_tile(mS_mkl, TileShape{}, make_coord(_,_,_), Step<_1, X,_1>{});
         Tensor sZ  = make_tensor(make_smem_ptr(shared_storage.input.smem_zero.begin()), SmemLayoutScale{});
 
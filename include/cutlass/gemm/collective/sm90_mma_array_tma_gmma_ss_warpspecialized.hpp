@@ -51,6 +51,36 @@ using namespace cute;
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace detail {
+
+// Number of groups whose tensormaps are built by each CTA of the prebuild kernel
+static constexpr int TensorMapPrebuildThreadCount = 32;
+
+// Builds the A and B tensormaps of every group in global memory before the GEMM, so that the
+// mainloop only switches descriptor pointers at group boundaries. Each thread builds one group.
+template <class CollectiveMainloop, class ProblemShape>
+__global__ void
+prebuild_tensormaps_kernel(
+    typename CollectiveMainloop::Params params,
+    ProblemShape problem_shapes) {
+
+#if defined(__CUDA_ARCH__)
+  __shared__ typename CollectiveMainloop::TensorMapStorage shared_tensormaps[TensorMapPrebuildThreadCount];
+
+  int32_t const groups = problem_shapes.groups();
+  // Threads past the last group rebuild it, as the releasing copy must be executed by the whole warp
+  int32_t const group = cute::min(int32_t(blockIdx.x * TensorMapPrebuildThreadCount + threadIdx.x), groups - 1);
+
+  CollectiveMainloop collective_mainloop;
+  collective_mainloop.tensormaps_prebuild(params, shared_tensormaps[threadIdx.x],
+    append<4>(problem_shapes.get_problem_shape(group), 1), group);
+#endif
+}
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 // WarpSpecialized Mainloop
 template <
   int Stages,
@@ -193,6 +223,9 @@ struct CollectiveMma<
     StrideA dA;
     ElementB const** ptr_B;
     StrideB dB;
+    // Build the tensormaps of all groups in the workspace before the GEMM, instead of updating
+    // a per-SM copy of them at every group switch
+    bool prebuild_tensormaps = false;
   };
 
   // Device side kernel params
@@ -205,8 +238,14 @@ struct CollectiveMma<
     StrideA dA;
     InternalElementB const** ptr_B;
     StrideB dB;
+    bool prebuilt_tensormaps = false;
+    int32_t groups = 0;
   };
 
+  // Kernels may load each group through the tensormaps in Params::tensormaps if
+  // Params::prebuilt_tensormaps is set
+  static constexpr bool SupportsPrebuiltTensorMaps = true;
+
   //
   // Methods
   //
@@ -271,7 +310,9 @@ struct CollectiveMma<
       reinterpret_cast<InternalElementA const**>(args.ptr_A),
       args.dA,
       reinterpret_cast<InternalElementB const**>(args.ptr_B),
-      args.dB
+      args.dB,
+      args.prebuild_tensormaps,
+      problem_shapes.groups()
     };
   }
 
@@ -280,6 +321,10 @@ struct CollectiveMma<
   get_workspace_size(ProblemShape const& problem_shape, Arguments const& args, int sm_count) {
     constexpr uint32_t NumInputTensors = 2;
     constexpr size_t SizeOfCuTensorMap = sizeof(cute::TmaDescriptor);
+    if (args.prebuild_tensormaps) {
+      // Allocate gmem space for input tensormaps per each group, A tensormaps followed by B tensormaps
+      return (NumInputTensors * SizeOfCuTensorMap * problem_shape.groups());
+    }
     // Allocate gmem space for input tensormaps per each SM, A tensormap copies followed by B tensormap copies
     return (NumInputTensors * SizeOfCuTensorMap * sm_count);
   }
@@ -287,7 +332,37 @@ struct CollectiveMma<
   template <class ProblemShape>
   static cutlass::Status
   initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream, CudaHostAdapter* cuda_adapter = nullptr) {
+    if (not args.prebuild_tensormaps || problem_shape.groups() == 0) {
+      return cutlass::Status::kSuccess;
+    }
+    if (workspace == nullptr) {
+      CUTLASS_TRACE_HOST("  initialize_workspace: prebuilt tensormaps require a workspace.\n");
+      return cutlass::Status::kErrorWorkspaceNull;
+    }
+
+    Params params = to_underlying_arguments(problem_shape, args, workspace);
+    int32_t const blocks = (problem_shape.groups() + detail::TensorMapPrebuildThreadCount - 1) / detail::TensorMapPrebuildThreadCount;
+
+#if defined(__CUDACC__)
+    if (cuda_adapter != nullptr) {
+      CUTLASS_TRACE_HOST("  initialize_workspace: prebuilt tensormaps are not supported with a CudaHostAdapter.\n");
+      return cutlass::Status::kErrorNotSupported;
+    }
+    detail::prebuild_tensormaps_kernel<CollectiveMma, ProblemShape>
+      <<<blocks, detail::TensorMapPrebuildThreadCount, 0, stream>>>(params, problem_shape);
+
+    cudaError_t result = cudaGetLastError();
+    if (result != cudaSuccess) {
+      CUTLASS_TRACE_HOST("  initialize_workspace: tensormap prebuild kernel launch failed with error: " << cudaGetErrorString(result));
+      return cutlass::Status::kErrorInternal;
+    }
     return cutlass::Status::kSuccess;
+#else
+    CUTLASS_UNUSED(params);
+    CUTLASS_UNUSED(blocks);
+    CUTLASS_UNUSED(stream);
+    return cutlass::Status::kErrorNotSupported;
+#endif
   }
 
   template<class ProblemShape>
@@ -755,6 +830,56 @@ struct CollectiveMma<
     cute::tma_descriptor_fence_acquire(get<1>(input_tensormaps));
   }
 
+  //
+  // Methods for prebuilt tensormaps, one pair per group in Params::tensormaps
+  //
+
+  // Builds the tensormaps of one group in global memory (to be done by one thread of each group,
+  // but the entire warp must call this function collectively)
+  template <class ProblemShape_MNKL>
+  CUTLASS_DEVICE
+  void
+  tensormaps_prebuild(
+      Params const& mainloop_params,
+      TensorMapStorage& shared_tensormaps,
+      ProblemShape_MNKL problem_shape_mnkl,
+      int32_t group) {
+    cute::TmaDescriptor* gmem_tensormap = reinterpret_cast<cute::TmaDescriptor*>(mainloop_params.tensormaps);
+
+    shared_tensormaps.smem_tensormap_A = *mainloop_params.tma_load_a.get_tma_descriptor();
+    shared_tensormaps.smem_tensormap_B = *mainloop_params.tma_load_b.get_tma_descriptor();
+
+    tensormaps_replace_global_address(shared_tensormaps, mainloop_params, group);
+    if constexpr (IsGroupedGemmKernel) {
+      tensormaps_replace_global_tensor_properties(shared_tensormaps,
+        mainloop_params, group, problem_shape_mnkl);
+    }
+    __syncwarp();
+
+    tensormaps_cp_fence_release(shared_tensormaps,
+      cute::make_tuple(&gmem_tensormap[group], &gmem_tensormap[group + mainloop_params.groups]));
+  }
+
+  // Returns the prebuilt tensormaps of a group, and prefetches those of the group after it,
+  // which is usually the next one this CTA works on
+  CUTLASS_DEVICE auto
+  tensormaps_prebuilt(
+      Params const& mainloop_params,
+      int32_t batch) {
+    cute::TmaDescriptor* gmem_tensormap = reinterpret_cast<cute::TmaDescriptor*>(mainloop_params.tensormaps);
+
+    if (cute::elect_one_sync()) {
+      cute::prefetch_tma_descriptor(&gmem_tensormap[batch]);
+      cute::prefetch_tma_descriptor(&gmem_tensormap[batch + mainloop_params.groups]);
+      if (batch + 1 < mainloop_params.groups) {
+        cute::prefetch_tma_descriptor(&gmem_tensormap[batch + 1]);
+        cute::prefetch_tma_descriptor(&gmem_tensormap[batch + 1 + mainloop_params.groups]);
+      }
+    }
+
+    return cute::make_tuple(&gmem_tensormap[batch], &gmem_tensormap[batch + mainloop_params.groups]);
+  }
+
   template <class InputTensors, class ProblemShape_MNKL>
   CUTLASS_DEVICE
   InputTensors
@@ -188,7 +188,7 @@ struct CollectiveMma<
     StrideA dA;
     ElementB const** ptr_B;
     StrideB dB;
-    uint32_t mma_promotion_interval = 4;
+    uint32_t mma_promotion_interval = 4;  // MMAs between promotions to the main accumulators, 0 to never promote early
   };
 
   // Device side kernel params
@@ -310,6 +310,13 @@ struct CollectiveMma<
 
     if (!implementable) {
       CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum alignment requirements for TMA.\n");
+      return implementable;
+    }
+
+    /* MMA promotion interval should be a multiple of the number of MMA instructions issued by each mainloop iteration. */
+    implementable = args.mma_promotion_interval % (size<2>(TileShape{})() / TiledMma().template tile_size_mnk<2>()()) == 0;
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: MMA promotion interval is not a multiple of number of MMA instructions per tile.\n");
     }
     return implementable;
   }
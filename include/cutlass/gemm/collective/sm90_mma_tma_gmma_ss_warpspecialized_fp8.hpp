@@ -34,6 +34,7 @@
 #include "cutlass/cutlass.h"
 #include "cutlass/gemm/dispatch_policy.hpp"
 #include "cutlass/gemm/collective/fp8_accumulation.hpp"
+#include "cutlass/transform/collective/sm90_wgmma_transpose.hpp"
 #include "cutlass/trace.h"
 #include "cutlass/numeric_types.h"
 
@@ -136,6 +137,55 @@ struct CollectiveMma<
       make_shape(shape<1>(TileShape{}), shape<2>(TileShape{}), Int<DispatchPolicy::Stages>{}),
       cute::conditional_t< ::cutlass::gemm::detail::is_major<0,StrideB>(), Step<_2,_1,_3>, Step<_1,_2,_3>>{}));
 
+  // WGMMA reads 8-bit operands K-major only. MN-major A and B are loaded by TMA into MN-major smem
+  // and transposed in place by the consumer warps before the GMMAs of their k-tile are issued.
+  static constexpr bool TransposeA = ::cutlass::gemm::detail::is_major<0,StrideA>();
+  static constexpr bool TransposeB = ::cutlass::gemm::detail::is_major<0,StrideB>();
+
+  using TransposeOperandA = decltype(cutlass::transform::collective::detail::make_transpose_operand_b(
+                                      0, 0, TiledMma{}, SmemLayoutA{}, SmemLayoutAtomA{},
+                                      ElementA{}, cute::bool_constant<TransposeA>{}));
+  using TransposeOperandB = decltype(cutlass::transform::collective::detail::make_transpose_operand_b(
+                                      0, 0, TiledMma{}, SmemLayoutB{}, SmemLayoutAtomB{},
+                                      ElementB{}, cute::bool_constant<TransposeB>{}));
+
+  using GmmaSmemLayoutAtomA = decltype(transform::collective::detail::gmma_smem_transpose_or_passthrough<
+      TransposeA, SmemLayoutAtomA, ElementA>());
+  using GmmaSmemLayoutAtomB = decltype(transform::collective::detail::gmma_smem_transpose_or_passthrough<
+      TransposeB, SmemLayoutAtomB, ElementB>());
+
+  // Smem layouts GMMA reads, which differ from the TMA smem layouts of transposed operands
+  using GmmaSmemLayoutA = decltype(tile_to_shape(
+      GmmaSmemLayoutAtomA{},
+      make_shape(shape<0>(TileShape{}), shape<2>(TileShape{}), Int<DispatchPolicy::Stages>{}),
+      cute::conditional_t< ::cutlass::gemm::detail::is_major<0,StrideA>(), Step<_2,_1,_3>, Step<_1,_2,_3>>{}));
+  using GmmaSmemLayoutB = decltype(tile_to_shape(
+      GmmaSmemLayoutAtomB{},
+      make_shape(shape<1>(TileShape{}), shape<2>(TileShape{}), Int<DispatchPolicy::Stages>{}),
+      cute::conditional_t< ::cutlass::gemm::detail::is_major<0,StrideB>(), Step<_2,_1,_3>, Step<_1,_2,_3>>{}));
+
+  static_assert(TransposeA xor (cute::is_same_v<SmemLayoutA, GmmaSmemLayoutA>),
+    "Should be same layout if not TransposeA.");
+  static_assert(TransposeB xor (cute::is_same_v<SmemLayoutB, GmmaSmemLayoutB>),
+    "Should be same layout if not TransposeB.");
+  static_assert(!TransposeA || (cutlass::bits_to_bytes((size<1>(SmemLayoutA{}) * sizeof_bits<ElementA>::value))) == 128,
+    "SmemLayoutA K must be 128bytes to be transposed.");
+  static_assert(!TransposeB || (cutlass::bits_to_bytes((size<1>(SmemLayoutB{}) * sizeof_bits<ElementB>::value))) == 128,
+    "SmemLayoutB K must be 128bytes to be transposed.");
+
+  static constexpr bool uses_universal_transposition() {
+    if constexpr (TransposeA || TransposeB) {
+      return (TransposeA && transform::collective::detail::use_universal_transposition<SmemLayoutAtomA, ElementA>()) ||
+             (TransposeB && transform::collective::detail::use_universal_transposition<SmemLayoutAtomB, ElementB>());
+    }
+    else {
+      return false;
+    }
+  }
+
+  static_assert(!uses_universal_transposition(),
+    "MN-major fp8 operands must be staged in 128B swizzled MN-major smem to be transposed.");
+
   static_assert(DispatchPolicy::Stages >= 2, "Specialization requires Stages set to value 1 or more.");
   static_assert(cute::is_base_of<cute::GMMA::DescriptorIterator, typename TiledMma::FrgTypeA>::value &&
                 cute::is_base_of<cute::GMMA::DescriptorIterator, typename TiledMma::FrgTypeB>::value,
@@ -164,7 +214,7 @@ struct CollectiveMma<
     StrideA dA;
     ElementB const* ptr_B;
     StrideB dB;
-    uint32_t mma_promotion_interval = 4;
+    uint32_t mma_promotion_interval = 4;  // MMAs between promotions to the main accumulators, 0 to never promote early
   };
 
   // Device side kernel params
@@ -430,8 +480,18 @@ struct CollectiveMma<
     static_assert(cute::is_void_v<SmemCopyAtomB>,
       "SM90 GMMA mainloops cannot have a non-void copy atom for smem sourced instructions.");
 
-    Tensor sA = make_tensor(make_smem_ptr(shared_tensors.smem_A.data()), SmemLayoutA{});          // (BLK_M,BLK_K,PIPE)
-    Tensor sB = make_tensor(make_smem_ptr(shared_tensors.smem_B.data()), SmemLayoutB{});          // (BLK_N,BLK_K,PIPE)
+    Tensor sA_ = make_tensor(make_smem_ptr(shared_tensors.smem_A.data()), SmemLayoutA{});         // (BLK_M,BLK_K,PIPE)
+    Tensor sA  = as_position_independent_swizzle_tensor(sA_);                                     // (BLK_M,BLK_K,PIPE)
+    Tensor sB_ = make_tensor(make_smem_ptr(shared_tensors.smem_B.data()), SmemLayoutB{});         // (BLK_N,BLK_K,PIPE)
+    Tensor sB  = as_position_independent_swizzle_tensor(sB_);                                     // (BLK_N,BLK_K,PIPE)
+
+    // If TransposeA/B, GMMA will read from the transposed layout of the same smem
+    Tensor gmma_sA_position_dependent = make_tensor(make_smem_ptr(shared_tensors.smem_A.data()),
+                                          GmmaSmemLayoutA{});                                     // (BLK_M,BLK_K,PIPE)
+    Tensor gmma_sA = as_position_independent_swizzle_tensor(gmma_sA_position_dependent);          // (BLK_M,BLK_K,PIPE)
+    Tensor gmma_sB_position_dependent = make_tensor(make_smem_ptr(shared_tensors.smem_B.data()),
+                                          GmmaSmemLayoutB{});                                     // (BLK_N,BLK_K,PIPE)
+    Tensor gmma_sB = as_position_independent_swizzle_tensor(gmma_sB_position_dependent);          // (BLK_N,BLK_K,PIPE)
 
     //
     // Define C accumulators and A/B partitioning
@@ -454,8 +514,8 @@ struct CollectiveMma<
     TiledMma tiled_mma;
     auto thread_mma = tiled_mma.get_slice(warp_group_thread_layout(warp_group_idx));
 
-    Tensor tCsA = thread_mma.partition_A(sA);                                                 // (MMA,MMA_M,MMA_K,PIPE)
-    Tensor tCsB = thread_mma.partition_B(sB);                                                 // (MMA,MMA_N,MMA_K,PIPE)
+    Tensor tCsA = thread_mma.partition_A(gmma_sA_position_dependent);                         // (MMA,MMA_M,MMA_K,PIPE)
+    Tensor tCsB = thread_mma.partition_B(gmma_sB_position_dependent);                         // (MMA,MMA_N,MMA_K,PIPE)
 
     // Allocate "fragments/descriptors"
     Tensor tCrA = thread_mma.make_fragment_A(tCsA);                                           // (MMA,MMA_M,MMA_K,PIPE)
@@ -477,6 +537,26 @@ struct CollectiveMma<
     // We release buffers to producer warps(dma load) with some mmas in flight
     PipelineState smem_pipe_release = smem_pipe_read;
 
+    int warp_idx = canonical_warp_idx_sync();
+    [[maybe_unused]] int warp_group_thread_idx = thread_idx % NumThreadsPerWarpGroup;
+
+    TransposeOperandA transpose_A = cutlass::transform::collective::detail::make_transpose_operand_b(
+                                      warp_idx, warp_group_thread_idx, tiled_mma, SmemLayoutA{},
+                                      SmemLayoutAtomA{}, ElementA{}, cute::bool_constant<TransposeA>{});
+    TransposeOperandB transpose_B = cutlass::transform::collective::detail::make_transpose_operand_b(
+                                      warp_idx, warp_group_thread_idx, tiled_mma, SmemLayoutB{},
+                                      SmemLayoutAtomB{}, ElementB{}, cute::bool_constant<TransposeB>{});
+
+    // Transpose the MN-major operands of a k-tile in smem and make them visible to GMMA
+    auto transpose_operands = [&] (int read_stage) {
+      if constexpr (TransposeA || TransposeB) {
+        transpose_A(sA, gmma_sA, read_stage, 0);
+        transpose_B(sB, gmma_sB, read_stage, 0);
+        cutlass::arch::fence_view_async_shared();
+        cutlass::arch::NamedBarrier::sync(size(TiledMma{}), cutlass::arch::ReservedNamedBarriers::TransposeBarrier);
+      }
+    };
+
     // Prologue GMMAs
     int prologue_mma_count = min(K_PIPE_MMAS, k_tile_count);
 
@@ -496,6 +576,7 @@ struct CollectiveMma<
       }
 
       int read_stage = smem_pipe_read.index();
+      transpose_operands(read_stage);
       warpgroup_arrive();
       // Unroll the K mode manually to set scale D to 1
       CUTLASS_PRAGMA_UNROLL
@@ -527,6 +608,7 @@ struct CollectiveMma<
       //
 
       int read_stage = smem_pipe_read.index();
+      transpose_operands(read_stage);
 
       if (accumulation.prepare_if_needed()) {
         tiled_mma.accumulate_ = GMMA::ScaleOut::Zero;
@@ -233,6 +233,9 @@ struct CollectiveMma<
     LayoutSFA layout_SFA;
     ElementBlockScale const* ptr_SFB;
     LayoutSFB layout_SFB;
+    // Run-time scaling granularity (M,N,K) of SFA and SFB, see ScaleConfig::tile_atom_to_shape_SFA.
+    // Zeros select the compile-time ScaleGranularity of their mode.
+    Shape<int32_t,int32_t,int32_t> scale_granularity{0, 0, 0};
   };
 
   // Device side kernel params
@@ -292,6 +295,7 @@ struct CollectiveMma<
     ElementBlockScale const* ptr_SFB;
     LayoutSFA layout_SFA;
     LayoutSFB layout_SFB;
+    Shape<int32_t,int32_t,int32_t> scale_granularity;
   };
 
   //
@@ -364,6 +368,8 @@ struct CollectiveMma<
       args.ptr_SFB,
       args.layout_SFA,
       args.layout_SFB,
+      cutlass::detail::resolve_blockwise_scale_granularity<ScaleGranularityM, ScaleGranularityN, ScaleGranularityK>(
+          args.scale_granularity)
     };
   }
 
@@ -396,6 +402,19 @@ struct CollectiveMma<
       implementable = false;
       CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem size doesn't meet the minimum alignment requirements for using TMA to load scale B.\n");
     }
+    auto scale_granularity = cutlass::detail::resolve_blockwise_scale_granularity<
+        ScaleGranularityM, ScaleGranularityN, ScaleGranularityK>(args.scale_granularity);
+    if (!cutlass::detail::is_blockwise_scale_granularity_supported<
+        ScaleGranularityM, ScaleGranularityN, ScaleGranularityK>(scale_granularity)) {
+      implementable = false;
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Scale granularity must be a multiple of the compile-time scale granularity.\n");
+    }
+    // Scales loaded by TMA are fetched as whole tiles and cannot be coarsened at run time
+    if ((IsTmaLoadSFA && (get<0>(scale_granularity) != ScaleGranularityM || get<2>(scale_granularity) != ScaleGranularityK)) ||
+        (IsTmaLoadSFB && (get<1>(scale_granularity) != ScaleGranularityN || get<2>(scale_granularity) != ScaleGranularityK))) {
+      implementable = false;
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Run-time scale granularity is not supported for scales loaded by TMA.\n");
+    }
     return implementable;
   }
 
@@ -664,6 +683,11 @@ struct CollectiveMma<
     auto SFA_shape = shape(mainloop_params.layout_SFA);
     auto SFB_shape = shape(mainloop_params.layout_SFB);
 
+    // Scales coarser than the compile-time granularity are fetched per smem entry
+    auto [sf_m, sf_n, sf_k] = mainloop_params.scale_granularity;
+    bool runtime_granularity_sfa = sf_m != ScaleGranularityM || sf_k != ScaleGranularityK;
+    bool runtime_granularity_sfb = sf_n != ScaleGranularityN || sf_k != ScaleGranularityK;
+
     // Mainloop
     CUTLASS_PRAGMA_NO_UNROLL
     for ( ; k_tile_count > 0; --k_tile_count) {
@@ -689,10 +713,26 @@ struct CollectiveMma<
       int write_stage = smem_pipe_write.index();
       // Copy scale tensors from global memory to shared memory
       if constexpr (!IsTmaLoadSFA) {
-        copy_if(scale_copy_a, tSFApSFA, filter_zeros(tSFAgSFA_k(_,_,_,*k_tile_iter)), filter_zeros(tSFAsSFA(_,_,_,write_stage)));
+        if (runtime_granularity_sfa) {
+          cutlass::detail::copy_blockwise_scales(
+              CopyAtomSFA{}, mainloop_params.ptr_SFA, mainloop_params.layout_SFA, sf_m, sf_k,
+              m_coord * size<0>(TileShape{}), *k_tile_iter * size<2>(TileShape{}), l_coord,
+              sSFA(_,_,write_stage), thread_idx, NumThreadsPerWarp);
+        }
+        else {
+          copy_if(scale_copy_a, tSFApSFA, filter_zeros(tSFAgSFA_k(_,_,_,*k_tile_iter)), filter_zeros(tSFAsSFA(_,_,_,write_stage)));
+        }
       }
       if constexpr (!IsTmaLoadSFB) {
-        copy_if(scale_copy_b, tSFBpSFB, filter_zeros(tSFBgSFB_k(_,_,_,*k_tile_iter)), filter_zeros(tSFBsSFB(_,_,_,write_stage)));
+        if (runtime_granularity_sfb) {
+          cutlass::detail::copy_blockwise_scales(
+              CopyAtomSFB{}, mainloop_params.ptr_SFB, mainloop_params.layout_SFB, sf_n, sf_k,
+              n_coord * size<1>(TileShape{}), *k_tile_iter * size<2>(TileShape{}), l_coord,
+              sSFB(_,_,write_stage), thread_idx, NumThreadsPerWarp);
+        }
+        else {
+          copy_if(scale_copy_b, tSFBpSFB, filter_zeros(tSFBgSFB_k(_,_,_,*k_tile_iter)), filter_zeros(tSFBsSFB(_,_,_,write_stage)));
+        }
       }
       if constexpr (!IsTmaLoadSFA || !IsTmaLoadSFB) {
         pipeline.producer_commit(smem_pipe_write, cutlass::arch::cpasync_barrier_arrive_noinc);
@@ -232,7 +232,7 @@ struct CollectiveMma<
     StrideB dB{};
     ElementE const* ptr_E{};
     LayoutE layout_e{};
-    uint32_t mma_promotion_interval = 4;
+    uint32_t mma_promotion_interval = 4;  // MMAs between promotions to the main accumulators, 0 to never promote early
   };
 
   // Device side kernel params
@@ -0,0 +1,324 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*!
+  \file
+  \brief A GEMM handle that picks the mainloop stage count of a 3.x kernel per problem at run time.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/trace.h"
+
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::device {
+
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+  GemmStageDispatch is a stateful GEMM handle over several instantiations of one CUTLASS 3.x kernel
+  that differ only in their mainloop stage count, e.g. built by the collective builders with
+  StageCount<2>, StageCount<4> and StageCountAutoCarveout. It exposes the host API of
+  GemmUniversalAdapter and, in initialize(), binds the instantiation best suited to the problem:
+
+    - the one with the fewest stages that still covers every K tile of a work tile, freeing shared
+      memory for problems with a short K, or
+    - the one with the most stages if no instantiation covers the K extent.
+
+  Instantiations that cannot implement the problem are skipped. Problem shapes that are not cute
+  tuples (grouped GEMM) have no single K extent and always select the deepest pipeline. Callers
+  with their own policy bind an instantiation explicitly with initialize_variant().
+
+  Arguments are those of the first kernel. All kernels must share their tile shape and epilogue,
+  and mainloop arguments with the same members: the collectives declare them inside the class
+  template, so instantiations that differ only in stages have distinct but identical argument
+  types, which are copied across. Only the instantiated stage counts are compiled, rather than one
+  kernel per problem in a manifest.
+*/
+template <class... GemmKernels_>
+class GemmStageDispatch {
+public:
+
+  static_assert(sizeof...(GemmKernels_) > 0, "GemmStageDispatch requires at least one kernel.");
+
+  using Variants = std::tuple<GemmUniversalAdapter<GemmKernels_>...>;
+  template <int I>
+  using Variant = std::tuple_element_t<I, Variants>;
+  static constexpr int NumVariants = int(sizeof...(GemmKernels_));
+
+  using GemmKernel = typename Variant<0>::GemmKernel;
+  using Arguments = typename Variant<0>::Arguments;
+  using TileShape = typename Variant<0>::TileShape;
+  using ProblemShape = typename GemmKernel::ProblemShape;
+
+  static_assert((cute::is_same_v<typename GemmKernels_::EpilogueArguments, typename GemmKernel::EpilogueArguments> && ...),
+    "All kernels of a GemmStageDispatch must share their epilogue.");
+  static_assert(((sizeof(typename GemmKernels_::MainloopArguments) == sizeof(typename GemmKernel::MainloopArguments) &&
+                  std::is_trivially_copyable_v<typename GemmKernels_::MainloopArguments>) && ...),
+    "All kernels of a GemmStageDispatch must take the same, trivially copyable, mainloop arguments.");
+  static_assert((cute::is_same_v<typename GemmUniversalAdapter<GemmKernels_>::TileShape, TileShape> && ...),
+    "All kernels of a GemmStageDispatch must share their tile shape.");
+  static_assert(((GemmUniversalAdapter<GemmKernels_>::kStages > 0) && ...),
+    "GemmStageDispatch requires mainloops that expose their stage count.");
+
+  /// Mainloop stage count of each instantiation
+  static constexpr int kStages[] = { GemmUniversalAdapter<GemmKernels_>::kStages... };
+
+private:
+
+  Variants ops_;
+  int selected_ = -1;
+
+  template <class VariantArguments>
+  static VariantArguments
+  to_variant_arguments_(Arguments const& args) {
+    if constexpr (cute::is_same_v<VariantArguments, Arguments>) {
+      return args;
+    }
+    else {
+      VariantArguments variant_args{};
+      variant_args.mode = args.mode;
+      variant_args.problem_shape = args.problem_shape;
+      std::memcpy(&variant_args.mainloop, &args.mainloop, sizeof(args.mainloop));
+      variant_args.epilogue = args.epilogue;
+      variant_args.hw_info = args.hw_info;
+      variant_args.scheduler = args.scheduler;
+      return variant_args;
+    }
+  }
+
+  template <class Fn, size_t... Is>
+  Status visit_(int variant, Fn&& fn, std::index_sequence<Is...>) {
+    Status status = Status::kErrorInvalidProblem;
+    (void)((variant == int(Is) && (status = fn(std::get<Is>(ops_)), true)) || ...);
+    return status;
+  }
+
+  template <class Fn>
+  Status visit_(int variant, Fn&& fn) {
+    return visit_(variant, static_cast<Fn&&>(fn), std::make_index_sequence<NumVariants>{});
+  }
+
+public:
+
+  /// Number of K tiles of a work tile, or -1 if the problem shape has no single K extent
+  static int
+  k_tile_count(Arguments const& args) {
+    if constexpr (cute::is_tuple<ProblemShape>::value) {
+      auto problem_shape_MNKL = cute::append<4>(args.problem_shape, 1);
+      return cutlass::ceil_div(int(cute::get<2>(problem_shape_MNKL)), int(cute::size<2>(TileShape{})));
+    }
+    else {
+      return -1;
+    }
+  }
+
+  /// Returns the index of the instantiation initialize() binds for the problem, or -1 if none
+  /// can implement it
+  static int
+  select(Arguments const& args) {
+    bool const implementable[] = {
+      (GemmUniversalAdapter<GemmKernels_>::can_implement(
+        to_variant_arguments_<typename GemmKernels_::Arguments>(args)) == Status::kSuccess)...
+    };
+    int const k_tiles = k_tile_count(args);
+    auto covers = [k_tiles] (int variant) {
+      return k_tiles > 0 && kStages[variant] >= k_tiles;
+    };
+
+    int best = -1;
+    for (int variant = 0; variant < NumVariants; ++variant) {
+      if (!implementable[variant]) {
+        continue;
+      }
+      if (best < 0) {
+        best = variant;
+      }
+      else if (covers(variant)) {
+        // Shallowest pipeline that covers the K extent
+        if (!covers(best) || kStages[variant] < kStages[best]) {
+          best = variant;
+        }
+      }
+      else if (!covers(best) && kStages[variant] > kStages[best]) {
+        // Otherwise the deepest pipeline
+        best = variant;
+      }
+    }
+
+    CUTLASS_TRACE_HOST("GemmStageDispatch::select() - k_tiles: " << k_tiles
+      << ", stages: " << (best >= 0 ? kStages[best] : 0));
+    return best;
+  }
+
+  /// Determines whether any instantiation can execute the given problem.
+  static Status
+  can_implement(Arguments const& args) {
+    return select(args) >= 0 ? Status::kSuccess : Status::kInvalid;
+  }
+
+  /// Gets the workspace size, large enough for whichever instantiation is bound
+  static size_t
+  get_workspace_size(Arguments const& args) {
+    size_t workspace_bytes = 0;
+    ((workspace_bytes = cute::max(workspace_bytes, GemmUniversalAdapter<GemmKernels_>::get_workspace_size(
+      to_variant_arguments_<typename GemmKernels_::Arguments>(args)))), ...);
+    return workspace_bytes;
+  }
+
+  /// Index of the bound instantiation, or -1 before initialization
+  int selected_variant() const {
+    return selected_;
+  }
+
+  /// Stage count of the bound instantiation, or 0 before initialization
+  int selected_stages() const {
+    return selected_ >= 0 ? kStages[selected_] : 0;
+  }
+
+  /// Initializes the instantiation at index `variant` from arguments and binds it.
+  Status
+  initialize_variant(
+    int variant,
+    Arguments const& args,
+    void* workspace = nullptr,
+    cudaStream_t stream = nullptr,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+
+    CUTLASS_TRACE_HOST("GemmStageDispatch::initialize_variant() - variant: " << variant);
+
+    selected_ = -1;
+    Status status = visit_(variant, [&] (auto& op) {
+      using VariantArguments = typename cute::remove_cvref_t<decltype(op)>::Arguments;
+      return op.initialize(to_variant_arguments_<VariantArguments>(args), workspace, stream, cuda_adapter);
+    });
+    if (status == Status::kSuccess) {
+      selected_ = variant;
+    }
+    return status;
+  }
+
+  /// Selects the instantiation for the problem, then initializes it from arguments.
+  Status
+  initialize(
+    Arguments const& args,
+    void* workspace = nullptr,
+    cudaStream_t stream = nullptr,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+
+    int variant = select(args);
+    if (variant < 0) {
+      selected_ = -1;
+      return Status::kErrorInvalidProblem;
+    }
+    return initialize_variant(variant, args, workspace, stream, cuda_adapter);
+  }
+
+  /// Update API. Rebinds and initializes another instantiation if the new arguments select one.
+  Status
+  update(Arguments const& args, void* workspace = nullptr) {
+    int variant = select(args);
+    if (variant < 0 || variant != selected_) {
+      return initialize(args, workspace);
+    }
+    return visit_(selected_, [&] (auto& op) {
+      using VariantArguments = typename cute::remove_cvref_t<decltype(op)>::Arguments;
+      return op.update(to_variant_arguments_<VariantArguments>(args), workspace);
+    });
+  }
+
+  /// Launches the bound instantiation without updating its params.
+  Status
+  run(
+    cudaStream_t stream = nullptr,
+    CudaHostAdapter *cuda_adapter = nullptr,
+    bool launch_with_pdl = false) {
+    if (selected_ < 0) {
+      CUTLASS_TRACE_HOST("GemmStageDispatch::run() - no instantiation bound");
+      return Status::kErrorInternal;
+    }
+    return visit_(selected_, [&] (auto& op) {
+      return op.run(stream, cuda_adapter, launch_with_pdl);
+    });
+  }
+
+  /// Selects and initializes an instantiation from the arguments, then launches it.
+  Status
+  run(
+    Arguments const& args,
+    void* workspace = nullptr,
+    cudaStream_t stream = nullptr,
+    CudaHostAdapter *cuda_adapter = nullptr,
+    bool launch_with_pdl = false) {
+    Status status = initialize(args, workspace, stream, cuda_adapter);
+    if (Status::kSuccess == status) {
+      status = run(stream, cuda_adapter, launch_with_pdl);
+    }
+    return status;
+  }
+
+  /// Selects and initializes an instantiation from the arguments, then launches it.
+  Status
+  operator()(
+    Arguments const& args,
+    void* workspace = nullptr,
+    cudaStream_t stream = nullptr,
+    CudaHostAdapter *cuda_adapter = nullptr,
+    bool launch_with_pdl = false) {
+    return run(args, workspace, stream, cuda_adapter, launch_with_pdl);
+  }
+
+  /// Launches the bound instantiation without updating its params.
+  Status
+  operator()(cudaStream_t stream = nullptr, CudaHostAdapter *cuda_adapter = nullptr, bool launch_with_pdl = false) {
+    return run(stream, cuda_adapter, launch_with_pdl);
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+/// GemmStageDispatch over `KernelForStages<S>` for each stage count `S` in `Stages...`
+template <template <int> class KernelForStages, int... Stages>
+using GemmStageDispatchOver = GemmStageDispatch<KernelForStages<Stages>...>;
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::device
+
+////////////////////////////////////////////////////////////////////////////////
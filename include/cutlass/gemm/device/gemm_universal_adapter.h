@@ -47,6 +47,7 @@
 #include "cutlass/kernel_launch.h"
 #if !defined(__CUDACC_RTC__)
 #include "cutlass/cluster_launch.hpp"
+#include "cutlass/pipeline/pipeline_trace.hpp"
 #include "cutlass/trace.h"
 #endif // !defined(__CUDACC_RTC__)
 
@@ -319,7 +320,8 @@ public:
     CUTLASS_TRACE_HOST("GemmUniversal::initialize() - workspace "
       << workspace << ", stream: " << (stream ? "non-null" : "null"));
 
-    // Initialize the workspace
+    // Initialize the workspace. The scheduler workspace is cleared unless the caller sets
+    // args.scheduler.reuse_workspace for a workspace it knows to be left clear by a previous launch.
     Status status = GemmKernel::initialize_workspace(args, workspace, stream, cuda_adapter);
     if (status != Status::kSuccess) {
       return status;
@@ -415,6 +417,8 @@ public:
       
       [[maybe_unused]] void* kernel_params[] = {&params};
 
+      cutlass::pipeline_trace_setup();
+
       if constexpr (kEnableCudaHostAdapter) {
         //
         // Use the cuda host adapter
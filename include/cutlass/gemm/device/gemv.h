@@ -80,6 +80,9 @@ public:
   using Arguments = typename GemvKernel::Arguments;
   using Params = typename GemvKernel::Params;
 
+  /// Split-K is supported by the row-major kernel
+  static bool const kSupportsSplitK = platform::is_same<LayoutA, layout::RowMajor>::value;
+
 private:
 
   Params params_;
@@ -97,17 +100,23 @@ public:
 
   /// Gets the workspace size
   static size_t get_workspace_size(Arguments const &args) {
-    
-    return 0;
+    if constexpr (kSupportsSplitK) {
+      return GemvKernel::get_workspace_size(args);
+    }
+    else {
+      return 0;
+    }
   }
 
   /// Computes the grid shape
   static dim3 get_grid_shape(Arguments const &args, dim3 const &block) { 
-    if(platform::is_same<LayoutA, layout::ColumnMajor>::value) {
-      return dim3((args.problem_size.row() + (block.x - 1)) / block.x, 1, args.batch_count % 65536);
+    if constexpr (kSupportsSplitK) {
+      return dim3((args.problem_size.row() + (block.y - 1)) / block.y,
+                  GemvKernel::get_split_k_slices(args),
+                  args.batch_count % 65536);
     }
     else {
-      return dim3((args.problem_size.row() + (block.y - 1)) / block.y, 1, args.batch_count % 65536);
+      return dim3((args.problem_size.row() + (block.x - 1)) / block.x, 1, args.batch_count % 65536);
     }
   }
 
@@ -123,13 +132,40 @@ public:
 
   /// Initializes Gemv state from arguments.
   Status initialize(Arguments const &args, void *workspace = nullptr, cudaStream_t stream = nullptr) {
-    params_ = Params(args);
+    if constexpr (kSupportsSplitK) {
+      size_t semaphore_size = GemvKernel::get_semaphore_workspace_size(args);
+
+      if (semaphore_size) {
+        if (!workspace) {
+          return Status::kErrorWorkspaceNull;
+        }
+
+        // Zero the split-K arrival counters. The kernel resets them after each use.
+        uint8_t *ptr_semaphore = static_cast<uint8_t *>(workspace) + GemvKernel::get_partials_workspace_size(args);
+        cudaError_t result = cudaMemsetAsync(ptr_semaphore, 0, semaphore_size, stream);
+
+        if (result != cudaSuccess) {
+          CUTLASS_TRACE_HOST("  cudaMemsetAsync() returned error " << cudaGetErrorString(result));
+          return Status::kErrorInternal;
+        }
+      }
+
+      params_ = Params(args, workspace);
+    }
+    else {
+      params_ = Params(args);
+    }
     return Status::kSuccess;
   }
 
   /// Lightweight update given a subset of arguments
   Status update(Arguments const &args, void *workspace = nullptr) {
-    return params_.update(args);    
+    if constexpr (kSupportsSplitK) {
+      return params_.update(args, workspace);
+    }
+    else {
+      return params_.update(args);
+    }
   }
 
   /// Runs the kernel using initialized state.
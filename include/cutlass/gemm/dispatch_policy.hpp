@@ -31,6 +31,7 @@
 #pragma once
 
 #include "cutlass/arch/arch.h"
+#include "cutlass/blas3_types.h"
 #include "cutlass/gemm/gemm.h"
 
 #include "cute/layout.hpp"
@@ -74,7 +75,9 @@ namespace detail {
 enum class KernelInputTransformType {
     FastF32,
     InterleavedComplexTF32,
-    MixedInput
+    MixedInput,
+    BlockScaledInputQuant,
+    OzakiF64
 };
 
 } // namespace detail
@@ -95,6 +98,18 @@ struct Has_SwapAB <T, CUTE_STL_NAMESPACE::void_t<decltype(T::SwapAB)>>
 template <typename T>
 static constexpr bool Has_SwapAB_v = Has_SwapAB<T>::value;
 
+// Has_PrebuiltTensorMaps<T>::value will be true only if:
+//   class T has member SupportsPrebuiltTensorMaps and T::SupportsPrebuiltTensorMaps is true
+template <typename T, typename = void>
+struct Has_PrebuiltTensorMaps { static constexpr bool value = false; };
+
+template <typename T>
+struct Has_PrebuiltTensorMaps <T, CUTE_STL_NAMESPACE::void_t<decltype(T::SupportsPrebuiltTensorMaps)>>
+{ static constexpr bool value = T::SupportsPrebuiltTensorMaps; };
+
+template <typename T>
+static constexpr bool Has_PrebuiltTensorMaps_v = Has_PrebuiltTensorMaps<T>::value;
+
 // additional producer warp role check for block scaling mainloop
 template<typename T>
 struct HasAuxiliaryLoad : cute::false_type{};
@@ -156,6 +171,31 @@ struct KernelTmaWarpSpecializedCooperativeFP8FastAccum: KernelTmaWarpSpecialized
 struct KernelPtrArrayTmaWarpSpecializedCooperativeFP8FastAccum : KernelPtrArrayTmaWarpSpecializedCooperative { };
 struct KernelPtrArrayTmaWarpSpecializedPingpongFP8FastAccum : KernelPtrArrayTmaWarpSpecializedPingpong { };
 
+// Block-sparse (BSR) A operand policies, to be paired with the BlockSparseScheduler tile scheduler
+struct KernelTmaWarpSpecializedCooperativeBlockSparse : KernelTmaWarpSpecializedCooperative { };
+struct KernelTmaWarpSpecializedPingpongBlockSparse : KernelTmaWarpSpecializedPingpong { };
+
+// Triangular operand policies, to be paired with the TriangularOperandScheduler tile scheduler of the same side
+// and fill mode. The operand on the side of the multiplication given by SideMode (A for kLeft, B for kRight) is
+// square and only its triangle given by FillMode is referenced. DiagType::kZero excludes the diagonal, as needed
+// by the second pass of a SYMM.
+template <SideMode SideMode_, FillMode FillMode_, DiagType DiagType_ = DiagType::kNonUnit>
+struct KernelTmaWarpSpecializedCooperativeTriangularOperand : KernelTmaWarpSpecializedCooperative {
+  static constexpr SideMode kSideMode = SideMode_;
+  static constexpr FillMode kFillMode = FillMode_;
+  static constexpr DiagType kDiagType = DiagType_;
+};
+
+template <class KernelSchedule>
+struct is_triangular_operand_kernel_schedule : cute::false_type {};
+
+template <SideMode SideMode_, FillMode FillMode_, DiagType DiagType_>
+struct is_triangular_operand_kernel_schedule<
+    KernelTmaWarpSpecializedCooperativeTriangularOperand<SideMode_, FillMode_, DiagType_>> : cute::true_type {};
+
+template <class KernelSchedule>
+constexpr bool is_triangular_operand_kernel_schedule_v = is_triangular_operand_kernel_schedule<KernelSchedule>::value;
+
 //////////////////////////////////////////////////////////////////////////////
 
 // Policies for dispatch of epilogue
@@ -394,6 +434,57 @@ struct MainloopSm90TmaGmmaWarpSpecializedSparseFP8
   : MainloopSm90TmaGmmaWarpSpecializedSparse<Stages, ClusterShape, KernelSchedule> {
 };
 
+// n-buffer in smem (Hopper TMA), pipelined with Hopper sparse GMMA and TMA, Warp specialized dynamic schedule for Ptr-Array and Grouped Gemm
+template<
+  int Stages_,
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  class KernelSchedule = KernelPtrArrayTmaWarpSpecializedCooperative
+>
+struct MainloopSm90ArrayTmaGmmaWarpSpecializedSparse {
+  constexpr static int Stages = Stages_;
+  using ClusterShape = ClusterShape_;
+  using ArchTag = arch::Sm90;
+  using Schedule = KernelSchedule;
+  static_assert(
+    cute::is_base_of_v<KernelPtrArrayTmaWarpSpecializedCooperative, KernelSchedule> ||
+    cute::is_base_of_v<KernelPtrArrayTmaWarpSpecializedPingpong, KernelSchedule>,
+    "KernelSchedule must be one of the Ptr-Array or Grouped Gemm TMA Warp Specialized Cooperative or Pingpong policies");
+};
+
+// n-buffer in smem (Hopper TMA), pipelined with Hopper GMMA and TMA, Warp specialized dynamic schedule
+// With A stored as block compressed sparse rows (BSR) of tile sized blocks, only non-zero blocks are loaded
+template<
+  int Stages_,
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  class KernelSchedule = KernelTmaWarpSpecializedCooperativeBlockSparse
+>
+struct MainloopSm90TmaGmmaWarpSpecializedBlockSparse {
+  constexpr static int Stages = Stages_;
+  using ClusterShape = ClusterShape_;
+  using ArchTag = arch::Sm90;
+  using Schedule = KernelSchedule;
+  static_assert(
+    cute::is_base_of_v<KernelTmaWarpSpecializedCooperative, Schedule> ||
+    cute::is_base_of_v<KernelTmaWarpSpecializedPingpong, Schedule>,
+    "KernelSchedule must be one of the persistent warp specialized policies");
+};
+
+// n-buffer in smem (Hopper TMA), pipelined with Hopper GMMA and TMA, Warp specialized dynamic schedule
+// With a triangular A or B operand, only the K tiles intersecting its triangle are loaded
+template<
+  int Stages_,
+  class ClusterShape_,
+  class KernelSchedule
+>
+struct MainloopSm90TmaGmmaWarpSpecializedTriangularOperand {
+  constexpr static int Stages = Stages_;
+  using ClusterShape = ClusterShape_;
+  using ArchTag = arch::Sm90;
+  using Schedule = KernelSchedule;
+  static_assert(is_triangular_operand_kernel_schedule_v<Schedule>,
+    "KernelSchedule must be a KernelTmaWarpSpecializedCooperativeTriangularOperand policy");
+};
+
 // Mixed precision version n-buffer in rmem (Hopper TMA), pipelined with Hopper GMMA and TMA, Warp specialized dynamic schedule for Ptr-Array and Grouped Gemm
 template<
   int Stages_,
@@ -579,6 +670,16 @@ struct KernelPtrArrayTmaWarpSpecializedInputTransformSm100 final {
   static constexpr int AccumulatorPipelineStageCount = AccumulatorPipelineStageCount_;
 };
 
+// Ptr-Array Mixed Input Transform GEMM
+template<
+  int SchedulerPipelineStageCount_,
+  int AccumulatorPipelineStageCount_
+>
+struct KernelPtrArrayTmaWarpSpecializedMixedInputTransformSm100 final {
+  static constexpr int SchedulerPipelineStageCount = SchedulerPipelineStageCount_;
+  static constexpr int AccumulatorPipelineStageCount = AccumulatorPipelineStageCount_;
+};
+
 
 // SM120 kernel schedules
 template<int SchedulerPipelineStageCount_>
@@ -712,6 +813,7 @@ struct KernelScheduleSm100 {};
 struct KernelScheduleSm100DenseGemm : KernelScheduleSm100 {};   // Base policy
 // Dense GEMM: Specialize for 1SM vs 2SM
 struct KernelTmaWarpSpecialized1SmSm100 final : KernelSchedule1Sm, KernelScheduleSm100DenseGemm {};  // Use for 1SM Dense GEMM Kernels for Collective Mainloop Builder
+struct KernelTmaWarpSpecialized1SmGatherASm100 final : KernelSchedule1Sm, KernelScheduleSm100DenseGemm {};  // Use for 1SM Dense GEMM Kernels with TMA gather4 of A rows for Collective Mainloop Builder
 struct KernelTmaWarpSpecialized2SmSm100 final : KernelSchedule2Sm, KernelScheduleSm100DenseGemm {};  // Use for 2SM Dense GEMM Kernels for Collective Mainloop Builder
 struct KernelWarpSpecialized1SmSm100    final : KernelSchedule1Sm, KernelScheduleSm100DenseGemm {};  // Use for 1SM Dense GEMM Kernels for Collective Mainloop Builder Without TMA
 struct KernelMixedTmaCpAsyncWarpSpecialized1SmSm100 final : KernelSchedule1Sm, KernelScheduleSm100DenseGemm {};
@@ -766,6 +868,12 @@ struct KernelTmaWarpSpecialized2SmFastFP32Sm100 final : KernelSchedule2Sm, Kerne
 struct KernelTmaWarpSpecialized1SmFastFP32SmemSm100 final : KernelSchedule1Sm, KernelTmaWarpSpecializedFastFP32SmemSm100 { };
 struct KernelTmaWarpSpecialized2SmFastFP32SmemSm100 final : KernelSchedule2Sm, KernelTmaWarpSpecializedFastFP32SmemSm100 { };
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+// SM100 FP64 emulation (Ozaki scheme with INT8 slices) GEMM Dispatch Policies
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+struct KernelScheduleSm100OzakiFP64Gemm : KernelScheduleSm100 {};
+struct KernelTmaWarpSpecialized1SmOzakiFP64Sm100 final : KernelSchedule1Sm, KernelScheduleSm100OzakiFP64Gemm { };
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 // SM100 Mixed Precision Input GEMM Dispatch Policies
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -776,6 +884,22 @@ struct KernelTmaWarpSpecialized1SmMixedInputSmemSm100 final : KernelSchedule1Sm,
 struct KernelTmaWarpSpecialized2SmMixedInputSm100 final : KernelSchedule2Sm, KernelScheduleSm100MixedInputGemm { };
 struct KernelTmaWarpSpecialized2SmMixedInputSmemSm100 final : KernelSchedule2Sm, KernelTmaWarpSpecializedMixedInputSmemSm100 { };
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+// SM100 Ptr-Array Mixed Precision Input GEMM Dispatch Policies
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+struct KernelScheduleSm100PtrArrayMixedInputGemm           : KernelScheduleSm100MixedInputGemm {};
+struct KernelTmaWarpSpecializedPtrArrayMixedInputSmemSm100 : KernelScheduleSm100PtrArrayMixedInputGemm { };
+struct KernelPtrArrayTmaWarpSpecialized1SmMixedInputSm100     final : KernelSchedule1Sm, KernelScheduleSm100PtrArrayMixedInputGemm { };
+struct KernelPtrArrayTmaWarpSpecialized1SmMixedInputSmemSm100 final : KernelSchedule1Sm, KernelTmaWarpSpecializedPtrArrayMixedInputSmemSm100 { };
+struct KernelPtrArrayTmaWarpSpecialized2SmMixedInputSm100     final : KernelSchedule2Sm, KernelScheduleSm100PtrArrayMixedInputGemm { };
+struct KernelPtrArrayTmaWarpSpecialized2SmMixedInputSmemSm100 final : KernelSchedule2Sm, KernelTmaWarpSpecializedPtrArrayMixedInputSmemSm100 { };
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+// SM100 Block Scaled GEMM with in-kernel A quantization Dispatch Policies
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+struct KernelScheduleSm100BlockScaledInputQuantGemm : KernelScheduleSm100 {};
+struct KernelTmaWarpSpecialized1SmBlockScaledInputQuantSm100 final : KernelSchedule1Sm, KernelScheduleSm100BlockScaledInputQuantGemm { };
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 // SM100 Ptr-Array FastF32 (9xBF16) GEMM Dispatch Policies
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -942,6 +1066,13 @@ struct KernelTmaWarpSpecializedMxf4Sm120             final : KernelScheduleMxNvf
 struct KernelTmaWarpSpecializedPingpongMxf4Sm120     final : KernelScheduleMxNvf4Sm120, KernelTmaWarpSpecializedPingpong { };
 struct KernelTmaWarpSpecializedMxf8f6f4Sm120         final : KernelScheduleMxf8f6f4Sm120, KernelTmaWarpSpecializedCooperative { };
 struct KernelTmaWarpSpecializedPingpongMxf8f6f4Sm120 final : KernelScheduleMxf8f6f4Sm120, KernelTmaWarpSpecializedPingpong { };
+// Block Scaled Grouped GEMM: Specialize for instruction type, scale factor vector size.
+struct KernelPtrArrayTmaWarpSpecializedNvf4Sm120             final : KernelScheduleMxNvf4Sm120, KernelPtrArrayTmaWarpSpecializedCooperative { };
+struct KernelPtrArrayTmaWarpSpecializedPingpongNvf4Sm120     final : KernelScheduleMxNvf4Sm120, KernelPtrArrayTmaWarpSpecializedPingpong { };
+struct KernelPtrArrayTmaWarpSpecializedMxf4Sm120             final : KernelScheduleMxNvf4Sm120, KernelPtrArrayTmaWarpSpecializedCooperative { };
+struct KernelPtrArrayTmaWarpSpecializedPingpongMxf4Sm120     final : KernelScheduleMxNvf4Sm120, KernelPtrArrayTmaWarpSpecializedPingpong { };
+struct KernelPtrArrayTmaWarpSpecializedMxf8f6f4Sm120         final : KernelScheduleMxf8f6f4Sm120, KernelPtrArrayTmaWarpSpecializedCooperative { };
+struct KernelPtrArrayTmaWarpSpecializedPingpongMxf8f6f4Sm120 final : KernelScheduleMxf8f6f4Sm120, KernelPtrArrayTmaWarpSpecializedPingpong { };
 // Blockwise Scaled GEMM
 struct KernelScheduleSm120Blockwise: KernelScheduleSm120 { };
 struct KernelTmaWarpSpecializedBlockwiseCooperativeSm120 final : KernelScheduleSm120Blockwise, KernelTmaWarpSpecializedCooperative { };
@@ -1034,6 +1165,23 @@ struct MainloopSm100TmaUmmaWarpSpecialized {
   constexpr static bool IsOverlappingAccum = false;
 };
 
+// n-buffer in smem, pipelined with Blackwell UMMA and TMA, Warp specialized dynamic schedule
+// A rows are gathered from an index array with TMA tile::gather4
+template<
+  int Stages_,
+  int SchedulerPipelineStageCount_,
+  int AccumulatorPipelineStageCount_,
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  class ArchTag_ = arch::Sm100
+>
+struct MainloopSm100TmaUmmaWarpSpecializedGatherA {
+  constexpr static int Stages = Stages_;
+  using ClusterShape = ClusterShape_;
+  using ArchTag = ArchTag_;
+  using Schedule = KernelTmaWarpSpecializedSm100<SchedulerPipelineStageCount_, AccumulatorPipelineStageCount_>;
+  constexpr static bool IsOverlappingAccum = false;
+};
+
 // n-buffer in smem, pipelined with Blackwell UMMA and TMA, Warp specialized dynamic schedule
 template<
   int Stages_,
@@ -1163,6 +1311,44 @@ struct MainloopSm100TmaUmmaWarpSpecializedFastF32 {
 };
 
 
+// FP64 emulation: each row of A and each column of B is scaled by a power of two per k-tile
+// and split into NumSlices_ signed INT8 digits. Integer UMMAs of the digit pairs (i, j) with
+// i + j < NumSlices_ are exact, and the bands of equal weight are recombined in FP64 registers.
+template<
+  // Number of Pipeline stages for
+  // MainloopLoad <-> Conversion <-> MainLoad
+  int Load2TransformPipelineStageCount_,
+  // Number of Pipeline stages for
+  // MainloopLoad <-> Conversion <-> MainLoad
+  int Transform2MmaPipelineStageCount_,
+  // TileScheduler pipeline depth
+  int SchedulerPipelineStageCount_,
+  // Accmulator pipeline depth
+  int AccumulatorPipelineStageCount_,
+  // Number of 7-bit INT8 digits each FP64 operand is split into.
+  // 7 slices keep 49 bits of the scaled mantissa, 8 slices keep 56 bits.
+  int NumSlices_,
+  // ClusterShape for the kernel
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  // The TMEM_LOAD atom to be used for loading local accumulator
+  // from TMEM to registers
+  class AccumulatorCopyAtom_ = cute::SM100_TMEM_LOAD_32dp32b32x,
+  class ArchTag_ = arch::Sm100
+>
+struct MainloopSm100TmaUmmaWarpSpecializedOzakiF64 {
+  constexpr static int Load2TransformPipelineStageCount = Load2TransformPipelineStageCount_;
+  constexpr static int Transform2MmaPipelineStageCount = Transform2MmaPipelineStageCount_;
+  constexpr static int NumSlices = NumSlices_;
+  constexpr static detail::KernelInputTransformType InputTransformType = detail::KernelInputTransformType::OzakiF64;
+  using ClusterShape = ClusterShape_;
+  using AccumulatorCopyAtom = AccumulatorCopyAtom_;
+  using ArchTag = ArchTag_;
+  using Schedule = KernelTmaWarpSpecializedInputTransformSm100<SchedulerPipelineStageCount_, AccumulatorPipelineStageCount_>;
+
+  // For backwards compatibility with GemmUniversalAdapter.
+  constexpr static int Stages = Load2TransformPipelineStageCount;
+};
+
 template<
   // Number of Pipeline stages for
   // MainloopLoad <-> Transformation
@@ -1220,6 +1406,67 @@ struct MainloopSm100TmaUmmaWarpSpecializedMixedInput {
   constexpr static int Stages = Load2TransformPipelineStageCount;
 };
 
+// n-buffer in smem, pipelined with Blackwell Mixed Input kernel with UMMA (HwScaled) and TMA,
+// Ptr-Array and Grouped GEMM variant with per-batch (per-group) operand and scale pointers
+template<
+  // Number of Pipeline stages for
+  // MainloopLoad <-> Conversion <-> MainLoad
+  int Load2TransformPipelineStageCount_,
+  // Number of Pipeline stages for
+  // MainloopLoad <-> Conversion <-> MainLoad
+  int Transform2MmaPipelineStageCount_,
+  // TileScheduler pipeline depth
+  int SchedulerPipelineStageCount_,
+  // Accmulator pipeline depth
+  int AccumulatorPipelineStageCount_,
+  // ClusterShape for the kernel
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  class ArchTag_ = arch::Sm100
+>
+struct MainloopSm100ArrayTmaUmmaWarpSpecializedMixedInput {
+  constexpr static int Load2TransformPipelineStageCount = Load2TransformPipelineStageCount_;
+  constexpr static int Load2MmaPipelineStageCount = Load2TransformPipelineStageCount_;
+  constexpr static int Transform2MmaPipelineStageCount = Transform2MmaPipelineStageCount_;
+  constexpr static detail::KernelInputTransformType InputTransformType = detail::KernelInputTransformType::MixedInput;
+  using ClusterShape = ClusterShape_;
+  using ArchTag = ArchTag_;
+  using Schedule = KernelPtrArrayTmaWarpSpecializedMixedInputTransformSm100<SchedulerPipelineStageCount_, AccumulatorPipelineStageCount_>;
+
+  // For backwards compatibility with GemmUniversalAdapter.
+  constexpr static int Stages = Load2TransformPipelineStageCount;
+};
+
+
+// n-buffer in smem, pipelined with Blackwell block scaled UMMA and TMA, where a wide A operand is
+// quantized to the block scaled data type (with its scale factors) by the transformation warps
+template<
+  // Number of Pipeline stages for
+  // MainloopLoad <-> Quantization and MainloopLoad <-> MMA
+  int Load2TransformPipelineStageCount_,
+  // Number of Pipeline stages for
+  // Quantization <-> MMA
+  int Transform2MmaPipelineStageCount_,
+  // TileScheduler pipeline depth
+  int SchedulerPipelineStageCount_,
+  // Accmulator pipeline depth
+  int AccumulatorPipelineStageCount_,
+  // ClusterShape for the kernel
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  class ArchTag_ = arch::Sm100
+>
+struct MainloopSm100TmaUmmaWarpSpecializedBlockScaledInputQuant {
+  constexpr static int Load2TransformPipelineStageCount = Load2TransformPipelineStageCount_;
+  constexpr static int Load2MmaPipelineStageCount = Load2TransformPipelineStageCount_;
+  constexpr static int Transform2MmaPipelineStageCount = Transform2MmaPipelineStageCount_;
+  constexpr static detail::KernelInputTransformType InputTransformType = detail::KernelInputTransformType::BlockScaledInputQuant;
+  using ClusterShape = ClusterShape_;
+  using ArchTag = ArchTag_;
+  using Schedule = KernelTmaWarpSpecializedMixedInputTransformSm100<SchedulerPipelineStageCount_, AccumulatorPipelineStageCount_>;
+
+  // For backwards compatibility with GemmUniversalAdapter.
+  constexpr static int Stages = Load2TransformPipelineStageCount;
+};
+
 
 // n-buffer in smem, pipelined with Blackwell UMMA and TMA, Warp specialized dynamic schedule
 template<
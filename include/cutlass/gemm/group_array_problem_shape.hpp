@@ -57,10 +57,22 @@ struct GroupProblemShape {
   int32_t num_groups = 1;
   UnderlyingProblemShape* problem_shapes = nullptr;
   UnderlyingProblemShape const* host_problem_shapes = nullptr;
+  // Optional device-resident group count, e.g. written by a router kernel. When provided, num_groups
+  // is an upper bound used for host-side sizing and kernels only visit the first
+  // min(*device_num_groups, num_groups) groups.
+  int32_t const* device_num_groups = nullptr;
 
 
   CUTLASS_HOST_DEVICE
-  int32_t groups() const { return num_groups; }
+  int32_t groups() const {
+#if defined(__CUDA_ARCH__)
+    if (device_num_groups != nullptr) {
+      int32_t device_groups = *device_num_groups;
+      return device_groups < num_groups ? device_groups : num_groups;
+    }
+#endif
+    return num_groups;
+  }
 
   CUTLASS_HOST_DEVICE
   UnderlyingProblemShape const
@@ -79,6 +91,12 @@ struct GroupProblemShape {
   is_host_problem_shape_available() const {
     return host_problem_shapes != nullptr;
   }
+
+  CUTLASS_HOST_DEVICE
+  bool
+  is_device_group_count_available() const {
+    return device_num_groups != nullptr;
+  }
 };
 
 template <class ProblemShape_>
@@ -0,0 +1,500 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Batched GEMM kernel for many tiny problems of a compile-time fixed size
+
+    Strided batched GEMMs of 8x8 to 64x64 problems waste most of a threadblock tile when each
+    batch entry is mapped to at least one CTA. This kernel instead assigns whole problems to
+    warps: each warp of a CTA computes one problem at a time and strides through the batch,
+    prefetching the operands of its next problem with cp.async while computing the current one.
+
+    The warp-wide MMA is sized to the problem. 16-bit operands use a single SM80 tensor core atom
+    (m16n8k16, or m16n8k8 when K is not a multiple of 16) and double operands the m8n8k4 atom. Other
+    types use an 8x4 arrangement of FMA threads. Problem extents that are not a multiple of the MMA
+    tile are zero padded in shared memory and predicated in the epilogue.
+
+      D[i] = alpha * A[i] * B[i] + beta * C[i]      i in [0, batch_count)
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/layout/matrix.h"
+#include "cutlass/gemm/gemm.h"
+#include "cutlass/arch/memory_sm80.h"
+
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace gemm {
+namespace kernel {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+/// Warp-wide MMA of GemmBatchedTiny: FMA threads arranged 8x4 over (M, N)
+template <typename ElementA, typename ElementB, typename ElementAccumulator, int K>
+struct DefaultGemmBatchedTinyMma {
+  using TiledMma = decltype(cute::make_tiled_mma(
+    cute::UniversalFMA<ElementAccumulator, ElementA, ElementB, ElementAccumulator>{},
+    cute::Layout<cute::Shape<cute::_8, cute::_4, cute::_1>>{}));
+};
+
+/// Warp-wide MMA of GemmBatchedTiny: one m16n8k16 or m16n8k8 tensor core atom
+template <int K>
+struct DefaultGemmBatchedTinyMma<half_t, half_t, float, K> {
+  using TiledMma = decltype(cute::make_tiled_mma(
+    cute::conditional_t<K % 16 == 0, cute::SM80_16x8x16_F32F16F16F32_TN, cute::SM80_16x8x8_F32F16F16F32_TN>{}));
+};
+
+template <int K>
+struct DefaultGemmBatchedTinyMma<half_t, half_t, half_t, K> {
+  using TiledMma = decltype(cute::make_tiled_mma(
+    cute::conditional_t<K % 16 == 0, cute::SM80_16x8x16_F16F16F16F16_TN, cute::SM80_16x8x8_F16F16F16F16_TN>{}));
+};
+
+template <int K>
+struct DefaultGemmBatchedTinyMma<bfloat16_t, bfloat16_t, float, K> {
+  using TiledMma = decltype(cute::make_tiled_mma(
+    cute::conditional_t<K % 16 == 0, cute::SM80_16x8x16_F32BF16BF16F32_TN, cute::SM80_16x8x8_F32BF16BF16F32_TN>{}));
+};
+
+/// Warp-wide MMA of GemmBatchedTiny: one m8n8k4 double precision tensor core atom
+template <int K>
+struct DefaultGemmBatchedTinyMma<double, double, double, K> {
+  using TiledMma = decltype(cute::make_tiled_mma(cute::SM80_8x8x4_F64F64F64F64_TN{}));
+};
+
+/// Largest vector, at most 128b, whose length divides a contiguous extent of kExtent elements
+template <typename Element, int kExtent>
+constexpr int gemm_batched_tiny_access_size() {
+  int access = 128 / sizeof_bits<Element>::value;
+  while (access > 1 && kExtent % access != 0) {
+    access /= 2;
+  }
+  return access;
+}
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <
+  typename Shape_,                      ///< Problem size of every batch entry (concept: GemmShape)
+  typename ElementA_,                   ///< Data type of A
+  typename LayoutA_,                    ///< Layout of A (RowMajor or ColumnMajor)
+  typename ElementB_,                   ///< Data type of B
+  typename LayoutB_,                    ///< Layout of B (RowMajor or ColumnMajor)
+  typename ElementC_,                   ///< Data type of C and D
+  typename LayoutC_,                    ///< Layout of C and D (RowMajor or ColumnMajor)
+  typename ElementAccumulator_,         ///< Data type of the accumulators
+  typename EpilogueOutputOp_,           ///< Elementwise output operator, e.g. LinearCombination
+  int kStages_ = 2,                     ///< Problems of a warp in flight, the first computed and the rest prefetched
+  int kWarpCount_ = 0,                  ///< Warps per CTA, 0 for as many as fit 48 KB of smem up to 4
+  typename TiledMma_ = typename detail::DefaultGemmBatchedTinyMma<
+    ElementA_, ElementB_, ElementAccumulator_, Shape_::kK>::TiledMma
+>
+struct GemmBatchedTiny {
+public:
+
+  using Shape = Shape_;
+  using ElementA = ElementA_;
+  using LayoutA = LayoutA_;
+  using ElementB = ElementB_;
+  using LayoutB = LayoutB_;
+  using ElementC = ElementC_;
+  using LayoutC = LayoutC_;
+  using ElementAccumulator = ElementAccumulator_;
+  using EpilogueOutputOp = EpilogueOutputOp_;
+  using TiledMma = TiledMma_;
+
+  static_assert(decltype(cute::size(TiledMma{}))::value == 32, "Each problem is computed by one warp.");
+  static_assert(kStages_ >= 2, "At least one problem must be prefetched.");
+
+  static int const kM = Shape::kM;
+  static int const kN = Shape::kN;
+  static int const kK = Shape::kK;
+  static int const kStages = kStages_;
+
+  /// Problem extents rounded up to the warp-wide MMA tile
+  static int const kMmaM = decltype(cute::tile_size<0>(TiledMma{}))::value;
+  static int const kMmaN = decltype(cute::tile_size<1>(TiledMma{}))::value;
+  static int const kMmaK = decltype(cute::tile_size<2>(TiledMma{}))::value;
+  static int const kTileM = (kM + kMmaM - 1) / kMmaM * kMmaM;
+  static int const kTileN = (kN + kMmaN - 1) / kMmaN * kMmaN;
+  static int const kTileK = (kK + kMmaK - 1) / kMmaK * kMmaK;
+  static bool const kPadded = kTileM != kM || kTileN != kN || kTileK != kK;
+
+  static bool const kIsRowMajorA = platform::is_same<LayoutA, layout::RowMajor>::value;
+  static bool const kIsColumnMajorB = platform::is_same<LayoutB, layout::ColumnMajor>::value;
+  static bool const kIsRowMajorC = platform::is_same<LayoutC, layout::RowMajor>::value;
+
+  static_assert(kIsRowMajorA || platform::is_same<LayoutA, layout::ColumnMajor>::value, "A must be row- or column-major.");
+  static_assert(kIsColumnMajorB || platform::is_same<LayoutB, layout::RowMajor>::value, "B must be row- or column-major.");
+  static_assert(kIsRowMajorC || platform::is_same<LayoutC, layout::ColumnMajor>::value, "C must be row- or column-major.");
+
+  /// Operands are copied to smem as lines of their contiguous mode. The smem tiles keep the
+  /// layout of the operand in gmem, with the contiguous mode padded to the MMA tile.
+  static int const kContiguousA = kIsRowMajorA ? kK : kM;
+  static int const kStridedA = kIsRowMajorA ? kM : kK;
+  static int const kSmemLineA = kIsRowMajorA ? kTileK : kTileM;
+  static int const kContiguousB = kIsColumnMajorB ? kK : kN;
+  static int const kStridedB = kIsColumnMajorB ? kN : kK;
+  static int const kSmemLineB = kIsColumnMajorB ? kTileK : kTileN;
+  static int const kContiguousC = kIsRowMajorC ? kN : kM;
+
+  static int const kAccessA = detail::gemm_batched_tiny_access_size<ElementA, kContiguousA>();
+  static int const kAccessB = detail::gemm_batched_tiny_access_size<ElementB, kContiguousB>();
+  static int const kAccessC = detail::gemm_batched_tiny_access_size<ElementC, kContiguousC>();
+
+  static_assert(kAccessA * sizeof_bits<ElementA>::value >= 32 && kAccessB * sizeof_bits<ElementB>::value >= 32,
+    "The contiguous extents of A and B must span a multiple of 32b.");
+
+  using SmemLayoutA = cute::conditional_t<kIsRowMajorA,
+    cute::Layout<cute::Shape<cute::Int<kTileM>, cute::Int<kTileK>>, cute::Stride<cute::Int<kTileK>, cute::_1>>,
+    cute::Layout<cute::Shape<cute::Int<kTileM>, cute::Int<kTileK>>, cute::Stride<cute::_1, cute::Int<kTileM>>>>;
+  using SmemLayoutB = cute::conditional_t<kIsColumnMajorB,
+    cute::Layout<cute::Shape<cute::Int<kTileN>, cute::Int<kTileK>>, cute::Stride<cute::Int<kTileK>, cute::_1>>,
+    cute::Layout<cute::Shape<cute::Int<kTileN>, cute::Int<kTileK>>, cute::Stride<cute::_1, cute::Int<kTileN>>>>;
+
+  static int const kStageBytes = int(
+    sizeof(ElementA) * cute::cosize_v<SmemLayoutA> + sizeof(ElementB) * cute::cosize_v<SmemLayoutB>);
+  static int const kWarpCount = kWarpCount_ > 0 ? kWarpCount_ :
+    const_max(1, const_min(4, (48 << 10) / (kStages * kStageBytes)));
+  static int const kThreadCount = kWarpCount * 32;
+
+  static int const kCount = EpilogueOutputOp::kCount;
+
+  //
+  // Structures
+  //
+
+  /// Argument structure
+  struct Arguments {
+    int batch_count{0};
+
+    typename EpilogueOutputOp::Params epilogue{};
+
+    ElementA const *ptr_A{nullptr};
+    int64_t lda{0};
+    int64_t batch_stride_A{0};
+    ElementB const *ptr_B{nullptr};
+    int64_t ldb{0};
+    int64_t batch_stride_B{0};
+    ElementC const *ptr_C{nullptr};
+    int64_t ldc{0};
+    int64_t batch_stride_C{0};
+    ElementC *ptr_D{nullptr};
+    int64_t ldd{0};
+    int64_t batch_stride_D{0};
+  };
+
+  using Params = Arguments;
+
+  /// Shared memory storage structure
+  struct SharedStorage {
+    struct Stage {
+      cute::array_aligned<ElementA, cute::cosize_v<SmemLayoutA>> A;
+      cute::array_aligned<ElementB, cute::cosize_v<SmemLayoutB>> B;
+    };
+
+    Stage stages[kWarpCount][kStages];
+  };
+
+  //
+  // Methods
+  //
+
+  CUTLASS_DEVICE
+  GemmBatchedTiny() { }
+
+  static Status can_implement(Arguments const &args) {
+    if (args.batch_count < 0 || (args.batch_count > 0 && (args.ptr_A == nullptr || args.ptr_B == nullptr || args.ptr_D == nullptr))) {
+      return Status::kErrorInvalidProblem;
+    }
+    if (args.lda < kContiguousA || args.ldb < kContiguousB || args.ldd < kContiguousC) {
+      return Status::kErrorInvalidProblem;
+    }
+
+    auto is_aligned = [](void const *ptr, int64_t ld, int64_t batch_stride, int access, int bytes_per_element) {
+      return reinterpret_cast<uintptr_t>(ptr) % (access * bytes_per_element) == 0 &&
+             ld % access == 0 && batch_stride % access == 0;
+    };
+
+    if (!is_aligned(args.ptr_A, args.lda, args.batch_stride_A, kAccessA, int(sizeof(ElementA))) ||
+        !is_aligned(args.ptr_B, args.ldb, args.batch_stride_B, kAccessB, int(sizeof(ElementB))) ||
+        !is_aligned(args.ptr_D, args.ldd, args.batch_stride_D, kAccessC, int(sizeof(ElementC)))) {
+      return Status::kErrorMisalignedOperand;
+    }
+    if (args.ptr_C != nullptr) {
+      if (args.ldc < kContiguousC) {
+        return Status::kErrorInvalidProblem;
+      }
+      if (!is_aligned(args.ptr_C, args.ldc, args.batch_stride_C, kAccessC, int(sizeof(ElementC)))) {
+        return Status::kErrorMisalignedOperand;
+      }
+    }
+    return Status::kSuccess;
+  }
+
+  static dim3 get_block_shape() {
+    return dim3(kThreadCount, 1, 1);
+  }
+
+  /// Returns the grid covering the batch, limited to cta_limit CTAs striding through it
+  static dim3 get_grid_shape(Params const &params, int cta_limit) {
+    int ctas = (params.batch_count + kWarpCount - 1) / kWarpCount;
+    if (cta_limit > 0) {
+      ctas = const_min(ctas, cta_limit);
+    }
+    return dim3(ctas, 1, 1);
+  }
+
+  /// Executes the batched GEMM
+  CUTLASS_DEVICE
+  void operator()(Params const &params, SharedStorage &shared_storage) {
+    using namespace cute;
+
+    int warp_idx = canonical_warp_idx_sync();
+    int lane_idx = int(threadIdx.x % 32);
+
+    int problem_stride = int(gridDim.x) * kWarpCount;
+    int first_problem = int(blockIdx.x) * kWarpCount + warp_idx;
+
+    if (first_problem >= params.batch_count) {
+      return;
+    }
+
+    typename SharedStorage::Stage *stages = shared_storage.stages[warp_idx];
+
+    if constexpr (kPadded) {
+      // cp.async only writes the problem extent, so the padding stays zero
+      CUTLASS_PRAGMA_UNROLL
+      for (int s = 0; s < kStages; ++s) {
+        for (int i = lane_idx; i < int(cosize_v<SmemLayoutA>); i += 32) {
+          stages[s].A[i] = ElementA(0);
+        }
+        for (int i = lane_idx; i < int(cosize_v<SmemLayoutB>); i += 32) {
+          stages[s].B[i] = ElementB(0);
+        }
+      }
+      __syncwarp();
+    }
+
+    // Prefetch the first kStages - 1 problems of this warp
+    int load_problem = first_problem;
+    CUTLASS_PRAGMA_UNROLL
+    for (int s = 0; s < kStages - 1; ++s) {
+      if (load_problem < params.batch_count) {
+        load_operands(params, load_problem, stages[s], lane_idx);
+      }
+      arch::cp_async_fence();
+      load_problem += problem_stride;
+    }
+
+    TiledMma tiled_mma;
+    auto thr_mma = tiled_mma.get_thread_slice(lane_idx);
+
+    using TileShapeMN = cute::Shape<Int<kTileM>, Int<kTileN>>;
+    Tensor tCcD = thr_mma.partition_C(make_identity_tensor(TileShapeMN{}));        // (MMA,MMA_M,MMA_N)
+    Tensor accum = partition_fragment_C(tiled_mma, TileShapeMN{});                 // (MMA,MMA_M,MMA_N)
+
+    static_assert(decltype(size(accum))::value % kCount == 0,
+      "The epilogue vector length must divide the accumulators of a thread.");
+
+    EpilogueOutputOp output_op(params.epilogue);
+    bool source_needed = output_op.is_source_needed();
+
+    int read_stage = 0;
+    int write_stage = kStages - 1;
+
+    for (int problem = first_problem; problem < params.batch_count; problem += problem_stride) {
+
+      // Prefetch into the stage computed by the previous iteration
+      if (load_problem < params.batch_count) {
+        load_operands(params, load_problem, stages[write_stage], lane_idx);
+      }
+      arch::cp_async_fence();
+      load_problem += problem_stride;
+
+      arch::cp_async_wait<kStages - 1>();
+      __syncwarp();
+
+      //
+      // Mainloop over the k-blocks of the MMA
+      //
+
+      Tensor sA = make_tensor(make_smem_ptr(stages[read_stage].A.data()), SmemLayoutA{});   // (TILE_M,TILE_K)
+      Tensor sB = make_tensor(make_smem_ptr(stages[read_stage].B.data()), SmemLayoutB{});   // (TILE_N,TILE_K)
+
+      Tensor tCsA = thr_mma.partition_A(sA);                                       // (MMA,MMA_M,MMA_K)
+      Tensor tCsB = thr_mma.partition_B(sB);                                       // (MMA,MMA_N,MMA_K)
+      Tensor tCrA = make_fragment_like(tCsA(_,_,0));                               // (MMA,MMA_M)
+      Tensor tCrB = make_fragment_like(tCsB(_,_,0));                               // (MMA,MMA_N)
+
+      clear(accum);
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int k_block = 0; k_block < size<2>(tCsA); ++k_block) {
+        copy(tCsA(_,_,k_block), tCrA);
+        copy(tCsB(_,_,k_block), tCrB);
+        gemm(tiled_mma, accum, tCrA, tCrB, accum);
+      }
+
+      // The stage is refilled by the next iteration
+      __syncwarp();
+
+      //
+      // Epilogue straight from registers
+      //
+
+      Tensor tCgD = thr_mma.partition_C(make_tensor(
+        make_gmem_ptr(params.ptr_D + problem * params.batch_stride_D), make_layout(TileShapeMN{}, stride_C(params.ldd))));
+
+      Tensor tCrC = make_tensor<ElementC>(shape(accum));
+      Tensor tCrD = make_tensor<ElementC>(shape(accum));
+
+      if (source_needed) {
+        Tensor tCgC = thr_mma.partition_C(make_tensor(
+          make_gmem_ptr(params.ptr_C + problem * params.batch_stride_C), make_layout(TileShapeMN{}, stride_C(params.ldc))));
+
+        if constexpr (kPadded) {
+          clear(tCrC);
+          CUTLASS_PRAGMA_UNROLL
+          for (int i = 0; i < size(tCrC); ++i) {
+            if (elem_less(tCcD(i), make_coord(Int<kM>{}, Int<kN>{}))) {
+              tCrC(i) = tCgC(i);
+            }
+          }
+        }
+        else {
+          copy(AutoVectorizingCopyWithAssumedAlignment<kAccessC * sizeof_bits<ElementC>::value>{}, tCgC, tCrC);
+        }
+      }
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size(accum); i += kCount) {
+        typename EpilogueOutputOp::FragmentAccumulator frag_accum;
+        typename EpilogueOutputOp::FragmentSource frag_source;
+
+        CUTLASS_PRAGMA_UNROLL
+        for (int e = 0; e < kCount; ++e) {
+          frag_accum[e] = accum(i + e);
+          frag_source[e] = tCrC(i + e);
+        }
+
+        typename EpilogueOutputOp::FragmentOutput frag_D =
+          source_needed ? output_op(frag_accum, frag_source) : output_op(frag_accum);
+
+        CUTLASS_PRAGMA_UNROLL
+        for (int e = 0; e < kCount; ++e) {
+          tCrD(i + e) = frag_D[e];
+        }
+      }
+
+      if constexpr (kPadded) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(tCrD); ++i) {
+          if (elem_less(tCcD(i), make_coord(Int<kM>{}, Int<kN>{}))) {
+            tCgD(i) = tCrD(i);
+          }
+        }
+      }
+      else {
+        copy(AutoVectorizingCopyWithAssumedAlignment<kAccessC * sizeof_bits<ElementC>::value>{}, tCrD, tCgD);
+      }
+
+      read_stage = (read_stage + 1 == kStages) ? 0 : read_stage + 1;
+      write_stage = (write_stage + 1 == kStages) ? 0 : write_stage + 1;
+    }
+
+    // Retire the empty groups committed past the end of the batch
+    arch::cp_async_wait<0>();
+  }
+
+private:
+
+  /// (M,N) strides of C or D with leading dimension ld
+  CUTLASS_DEVICE
+  static auto stride_C(int64_t ld) {
+    if constexpr (kIsRowMajorC) {
+      return cute::make_stride(ld, cute::_1{});
+    }
+    else {
+      return cute::make_stride(cute::_1{}, ld);
+    }
+  }
+
+  /// Copies the operands of one problem into a stage with vectorized cp.async
+  CUTLASS_DEVICE
+  static void load_operands(
+    Params const &params,
+    int problem,
+    typename SharedStorage::Stage &stage,
+    int lane_idx) {
+
+    copy_operand<kContiguousA, kStridedA, kSmemLineA, kAccessA>(
+      stage.A.data(), params.ptr_A + problem * params.batch_stride_A, params.lda, lane_idx);
+    copy_operand<kContiguousB, kStridedB, kSmemLineB, kAccessB>(
+      stage.B.data(), params.ptr_B + problem * params.batch_stride_B, params.ldb, lane_idx);
+  }
+
+  template <int kContiguous, int kStrided, int kSmemLine, int kAccess, typename Element>
+  CUTLASS_DEVICE
+  static void copy_operand(Element *smem, Element const *gmem, int64_t ld, int lane_idx) {
+    static int const kVectorsPerLine = kContiguous / kAccess;
+    static int const kVectors = kVectorsPerLine * kStrided;
+    static int const kAccessBytes = kAccess * sizeof_bits<Element>::value / 8;
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int v = lane_idx; v < kVectors; v += 32) {
+      int line = v / kVectorsPerLine;
+      int column = (v % kVectorsPerLine) * kAccess;
+      arch::cp_async<kAccessBytes, arch::CacheOperation::Always>(
+        smem + line * kSmemLine + column, gmem + line * ld + column);
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace kernel
+} // namespace gemm
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
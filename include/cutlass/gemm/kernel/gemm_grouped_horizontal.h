@@ -0,0 +1,520 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Grouped GEMM kernel whose problems may each use a different epilogue.
+
+    All problems share the threadblock-scoped mainloop, and thus the element types and layouts
+    of A and B and the accumulator type. Each problem selects one of several epilogues at runtime,
+    which may differ in output operator, element type of C and D, and access granularity. Tiles of
+    all problems are load-balanced by the grouped problem visitor within one persistent launch.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/aligned_buffer.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/gemm/gemm.h"
+#include "cutlass/matrix_coord.h"
+#include "cutlass/complex.h"
+
+#include "cutlass/layout/matrix.h"
+#include "cutlass/trace.h"
+#include "cutlass/gemm/kernel/gemm_grouped_problem_visitor.h"
+
+#include "cute/container/tuple.hpp"
+#include "cute/numeric/math.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace gemm {
+namespace kernel {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Horizontally fused grouped GEMM.
+///
+/// Problem `i` is computed with epilogue `epilogue_idx[i]` of `Epilogues_`, using the output
+/// operator parameters of that epilogue. Problems needing distinct output operator parameters
+/// may list the same epilogue type more than once. Pointers to C and D are type-erased, and must
+/// point to the element type of the epilogue selected by the problem.
+///
+/// Epilogues must operate on the accumulator tile of `Mma_` with row-major outputs.
+template <
+  typename Mma_,                           ///! Threadblock-scoped matrix multiply-accumulate
+  typename ThreadblockSwizzle_,            ///! Threadblock swizzling function
+  GroupScheduleMode GroupScheduleMode_,    ///! Type of scheduling to perform
+  typename... Epilogues_                   ///! Epilogues selectable by each problem
+>
+struct GemmGroupedHorizontal {
+public:
+
+  using Mma = Mma_;
+  using Epilogues = cute::tuple<Epilogues_...>;
+  using ThreadblockSwizzle = ThreadblockSwizzle_;
+  static GroupScheduleMode const kGroupScheduleMode = GroupScheduleMode_;
+  static bool const kTransposed = false;
+
+  static int const kEpilogueCount = int(sizeof...(Epilogues_));
+
+  static_assert(kEpilogueCount > 0, "At least one epilogue is required.");
+
+  template <int I>
+  using EpilogueAt = cute::tuple_element_t<I, Epilogues>;
+
+  // The first epilogue provides the output types reported to the device-level operator
+  using Epilogue = EpilogueAt<0>;
+  using EpilogueOutputOp = typename Epilogue::OutputOp;
+
+  static_assert((cute::is_same_v<typename Epilogues_::AccumulatorTile, typename Mma::FragmentC> && ...),
+    "Epilogues must consume the accumulator tile of the mainloop.");
+
+  static_assert((cute::is_same_v<typename Epilogues_::OutputTileIterator::Layout, layout::RowMajor> && ...),
+    "Epilogues must produce row-major outputs.");
+
+  using ElementA = typename Mma::IteratorA::Element;
+  using LayoutA = typename Mma::IteratorA::Layout;
+  using ElementB = typename Mma::IteratorB::Element;
+  using LayoutB = typename Mma::IteratorB::Layout;
+  using ElementC = typename Epilogue::OutputTileIterator::Element;
+  using LayoutC = layout::RowMajor;
+
+  static ComplexTransform const kTransformA = Mma::kTransformA;
+  static ComplexTransform const kTransformB = Mma::kTransformB;
+
+  // Type definitions about the mainloop.
+  using Operator = typename Mma::Operator;
+  using OperatorClass = typename Mma::Operator::OperatorClass;
+  using ThreadblockShape = typename Mma::Shape;
+  using WarpShape = typename Mma::Operator::Shape;
+  using InstructionShape = typename Mma::Policy::Operator::InstructionShape;
+  using ArchTag = typename Mma::ArchTag;
+
+  static int const kStages = Mma::kStages;
+  static int const kAlignmentA = Mma::IteratorA::AccessType::kElements;
+  static int const kAlignmentB = Mma::IteratorB::AccessType::kElements;
+  static int const kAlignmentC = Epilogue::OutputTileIterator::kElementsPerAccess;
+
+  /// Warp count (concept: GemmShape)
+  using WarpCount = typename Mma::WarpCount;
+  static int const kThreadCount = 32 * WarpCount::kCount;
+
+  using ProblemVisitor = GemmGroupedProblemVisitor<
+                            ThreadblockShape,
+                            kGroupScheduleMode,
+                            kThreadCount,
+                            kThreadCount,
+                            kTransposed>;
+
+  /// Output operator parameters of each epilogue
+  using OutputOpParams = cute::tuple<typename Epilogues_::OutputOp::Params...>;
+
+  //
+  // Structures
+  //
+
+  /// Argument structure
+  struct Arguments {
+
+    //
+    // Data members
+    //
+
+    GemmCoord *problem_sizes{nullptr};
+    int problem_count{0};
+    int threadblock_count{0};
+
+    OutputOpParams output_op{};
+
+    /// Index of the epilogue used by each problem. May be null if there is only one epilogue.
+    int const *epilogue_idx{nullptr};
+
+    ElementA ** ptr_A{nullptr};
+    ElementB ** ptr_B{nullptr};
+    void ** ptr_C{nullptr};
+    void ** ptr_D{nullptr};
+
+    typename LayoutA::Stride::LongIndex *lda{nullptr};
+    typename LayoutB::Stride::LongIndex *ldb{nullptr};
+    typename LayoutC::Stride::LongIndex *ldc{nullptr};
+    typename LayoutC::Stride::LongIndex *ldd{nullptr};
+
+    // Only used by device-level operator
+    GemmCoord *host_problem_sizes{nullptr};
+
+    //
+    // Methods
+    //
+
+    /// Default ctor
+    Arguments() = default;
+
+    /// Ctor
+    CUTLASS_HOST_DEVICE
+    Arguments(
+      GemmCoord *problem_sizes,
+      int problem_count,
+      int threadblock_count,
+      OutputOpParams output_op,
+      int const *epilogue_idx,
+      ElementA ** ptr_A,
+      ElementB ** ptr_B,
+      void ** ptr_C,
+      void ** ptr_D,
+      typename LayoutA::Stride::LongIndex *lda,
+      typename LayoutB::Stride::LongIndex *ldb,
+      typename LayoutC::Stride::LongIndex *ldc,
+      typename LayoutC::Stride::LongIndex *ldd,
+      GemmCoord *host_problem_sizes=nullptr
+    ):
+      problem_sizes(problem_sizes),
+      problem_count(problem_count),
+      threadblock_count(threadblock_count),
+      output_op(output_op),
+      epilogue_idx(epilogue_idx),
+      ptr_A(ptr_A),
+      ptr_B(ptr_B),
+      ptr_C(ptr_C),
+      ptr_D(ptr_D),
+      lda(lda),
+      ldb(ldb),
+      ldc(ldc),
+      ldd(ldd),
+      host_problem_sizes(host_problem_sizes)
+    {
+
+    }
+  };
+
+  //
+  // Structure for precomputing values in host memory and passing to kernels
+  //
+
+  /// Parameters structure
+  struct Params {
+
+    typename ProblemVisitor::Params problem_visitor{};
+    int threadblock_count{0};
+
+    OutputOpParams output_op{};
+
+    int const *epilogue_idx{nullptr};
+
+    ElementA ** ptr_A{nullptr};
+    ElementB ** ptr_B{nullptr};
+    void ** ptr_C{nullptr};
+    void ** ptr_D{nullptr};
+
+    typename LayoutA::Stride::LongIndex *lda{nullptr};
+    typename LayoutB::Stride::LongIndex *ldb{nullptr};
+    typename LayoutC::Stride::LongIndex *ldc{nullptr};
+    typename LayoutC::Stride::LongIndex *ldd{nullptr};
+
+    //
+    // Methods
+    //
+
+    Params() = default;
+
+    CUTLASS_HOST_DEVICE
+    Params(Arguments const &args,
+          void *workspace = nullptr,
+          int tile_count = 0):
+      problem_visitor(args.problem_sizes, args.problem_count, workspace, tile_count),
+      threadblock_count(args.threadblock_count),
+      output_op(args.output_op),
+      epilogue_idx(args.epilogue_idx),
+      ptr_A(args.ptr_A),
+      ptr_B(args.ptr_B),
+      ptr_C(args.ptr_C),
+      ptr_D(args.ptr_D),
+      lda(args.lda),
+      ldb(args.ldb),
+      ldc(args.ldc),
+      ldd(args.ldd)
+    {
+
+    }
+
+    CUTLASS_HOST_DEVICE
+    void update(
+      Arguments const &args,
+      void *workspace = nullptr,
+      int tile_count = 0) {
+
+      problem_visitor = typename ProblemVisitor::Params(args.problem_sizes, args.problem_count,
+                                                        workspace, tile_count);
+      threadblock_count = args.threadblock_count;
+      output_op = args.output_op;
+      epilogue_idx = args.epilogue_idx;
+      ptr_A = args.ptr_A;
+      ptr_B = args.ptr_B;
+      ptr_C = args.ptr_C;
+      ptr_D = args.ptr_D;
+      lda = args.lda;
+      ldb = args.ldb;
+      ldc = args.ldc;
+      ldd = args.ldd;
+    }
+  };
+
+  /// Shared memory of the largest epilogue, reinterpreted as the storage of the selected one
+  static int const kEpilogueSharedStorageBytes =
+    cute::max(1, int(sizeof(typename Epilogues_::SharedStorage))...);
+
+  static int const kEpilogueSharedStorageAlign =
+    cute::max(16, int(alignof(typename Epilogues_::SharedStorage))...);
+
+  /// Shared memory storage structure
+  struct SharedStorage {
+    union {
+      typename Mma::SharedStorage main_loop;
+      AlignedBuffer<uint8_t, kEpilogueSharedStorageBytes, kEpilogueSharedStorageAlign> epilogue;
+    } kernel;
+
+    // ProblemVisitor shared storage can't be overlapped with others
+    typename ProblemVisitor::SharedStorage problem_visitor;
+  };
+
+public:
+
+  //
+  // Methods
+  //
+
+  CUTLASS_DEVICE
+  GemmGroupedHorizontal() { }
+
+  /// Determines whether kernel satisfies alignment
+  static Status can_implement(cutlass::gemm::GemmCoord const & problem_size) {
+    return Status::kSuccess;
+  }
+
+  static Status can_implement(Arguments const &args) {
+    if (kEpilogueCount > 1 && args.problem_count > 0 && args.epilogue_idx == nullptr) {
+      CUTLASS_TRACE_HOST("GemmGroupedHorizontal::can_implement() - epilogue_idx is required "
+        "when selecting among several epilogues");
+      return Status::kErrorInvalidProblem;
+    }
+    return Status::kSuccess;
+  }
+
+private:
+
+  /// Runs epilogue I if the problem selects it, and otherwise tries the next one
+  template <int I>
+  CUTLASS_DEVICE
+  static void run_epilogue(
+    int epilogue_idx,
+    Params const &params,
+    SharedStorage &shared_storage,
+    int32_t problem_idx,
+    GemmCoord const &problem_size,
+    GemmCoord const &threadblock_offset,
+    typename Mma::FragmentC const &accumulators,
+    int thread_idx,
+    int warp_idx,
+    int lane_idx) {
+
+    if constexpr (I < kEpilogueCount) {
+      if (epilogue_idx != I) {
+        run_epilogue<I + 1>(epilogue_idx, params, shared_storage, problem_idx, problem_size,
+          threadblock_offset, accumulators, thread_idx, warp_idx, lane_idx);
+        return;
+      }
+
+      using EpilogueI = EpilogueAt<I>;
+      using ElementOutput = typename EpilogueI::OutputTileIterator::Element;
+
+      typename EpilogueI::OutputOp output_op(cute::get<I>(params.output_op));
+
+      ElementOutput *ptr_C = reinterpret_cast<ElementOutput *>(params.ptr_C[problem_idx]);
+      ElementOutput *ptr_D = reinterpret_cast<ElementOutput *>(params.ptr_D[problem_idx]);
+
+      LayoutC layout_C(params.ldc[problem_idx]);
+      LayoutC layout_D(params.ldd[problem_idx]);
+
+      typename EpilogueI::OutputTileIterator::Params params_C(layout_C);
+      typename EpilogueI::OutputTileIterator::Params params_D(layout_D);
+
+      // Tile iterator loading from source tensor.
+      typename EpilogueI::OutputTileIterator iterator_C(
+        params_C,
+        ptr_C,
+        problem_size.mn(),
+        thread_idx,
+        threadblock_offset.mn()
+      );
+
+      // Tile iterator writing to destination tensor.
+      typename EpilogueI::OutputTileIterator iterator_D(
+        params_D,
+        ptr_D,
+        problem_size.mn(),
+        thread_idx,
+        threadblock_offset.mn()
+      );
+
+      EpilogueI epilogue(
+        *reinterpret_cast<typename EpilogueI::SharedStorage *>(shared_storage.kernel.epilogue.data()),
+        thread_idx,
+        warp_idx,
+        lane_idx);
+
+      // Execute the epilogue operator to update the destination tensor.
+      epilogue(
+        output_op,
+        iterator_D,
+        accumulators,
+        iterator_C);
+    }
+  }
+
+public:
+
+  /// Executes one GEMM
+  CUTLASS_DEVICE
+  void operator()(Params const &params, SharedStorage &shared_storage) {
+
+    //
+    // Problem visitor.
+    //
+    ProblemVisitor problem_visitor(
+      params.problem_visitor,
+      shared_storage.problem_visitor,
+      blockIdx.x);
+
+    // Outer 'persistent' loop to iterate over tiles
+    while (problem_visitor.next_tile()) {
+
+      GemmCoord problem_size  = problem_visitor.problem_size();
+      int32_t problem_idx     = problem_visitor.problem_index();
+      int32_t threadblock_idx = int32_t(problem_visitor.threadblock_idx());
+
+      GemmCoord grid_shape = problem_visitor.grid_shape(problem_size);
+
+      cutlass::gemm::GemmCoord threadblock_offset(
+        int(threadblock_idx / grid_shape.n()) * Mma::Shape::kM,
+        int(threadblock_idx % grid_shape.n()) * Mma::Shape::kN,
+        0);
+
+      // Load element pointers
+      ElementA *ptr_A = params.ptr_A[problem_idx];
+      typename LayoutA::LongIndex ldm_A = params.lda[problem_idx];
+
+      ElementB *ptr_B = params.ptr_B[problem_idx];
+      typename LayoutB::LongIndex ldm_B = params.ldb[problem_idx];
+
+      // Compute initial location in logical coordinates
+      cutlass::MatrixCoord tb_offset_A{
+        threadblock_offset.m(),
+        0,
+      };
+
+      cutlass::MatrixCoord tb_offset_B{
+        0,
+        threadblock_offset.n()
+      };
+
+      // Compute position within threadblock
+      int thread_idx = threadIdx.x;
+
+      // Construct iterators to A and B operands
+      typename Mma::IteratorA iterator_A(
+        LayoutA(ldm_A),
+        ptr_A,
+        {problem_size.m(), problem_size.k()},
+        thread_idx,
+        tb_offset_A);
+
+      typename Mma::IteratorB iterator_B(
+        LayoutB(ldm_B),
+        ptr_B,
+        {problem_size.k(), problem_size.n()},
+        thread_idx,
+        tb_offset_B);
+
+      typename Mma::FragmentC accumulators;
+
+      accumulators.clear();
+
+      // Broadcast the warp_id computed by lane 0 to ensure dependent code
+      // is compiled as warp-uniform.
+      int warp_idx = canonical_warp_idx_sync();
+
+      int lane_idx = threadIdx.x % 32;
+
+      //
+      // Matrix multiply phase
+      //
+
+      // Construct thread-scoped matrix multiply
+      Mma mma(shared_storage.kernel.main_loop, thread_idx, warp_idx, lane_idx);
+
+      // Compute threadblock-scoped matrix multiply-add
+      int gemm_k_iterations = (problem_size.k() + Mma::Shape::kK - 1) / Mma::Shape::kK;
+
+      // Wait for all threads to finish their epilogue phases from the previous tile.
+      __syncthreads();
+
+      // Compute threadblock-scoped matrix multiply-add
+      mma(
+        gemm_k_iterations,
+        accumulators,
+        iterator_A,
+        iterator_B,
+        accumulators);
+
+      //
+      // Epilogue
+      //
+
+      // The selection is uniform across the threadblock
+      int epilogue_idx = (kEpilogueCount > 1) ? params.epilogue_idx[problem_idx] : 0;
+
+      run_epilogue<0>(epilogue_idx, params, shared_storage, problem_idx, problem_size,
+        threadblock_offset, accumulators, thread_idx, warp_idx, lane_idx);
+
+      // Next tile
+      problem_visitor.advance(gridDim.x);
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace kernel
+} // namespace gemm
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
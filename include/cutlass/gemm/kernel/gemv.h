@@ -40,6 +40,8 @@
 #include "cutlass/matrix_coord.h"
 #include "cutlass/complex.h"
 #include "cutlass/tensor_ref.h"
+#include "cutlass/barrier.h"
+#include "cutlass/kernel_hardware_info.h"
 
 #include "cutlass/arch/memory.h"
 #include "cutlass/arch/cache_operation.h"
@@ -401,6 +403,15 @@ public:
                                   std::min(static_cast<int>(kThreadCount / (kElementsPerAccess * sizeof(ElementA))), 16)
                                   : kThreadsPerRow_;
 
+  // number of rows computed by one thread block
+  static int const kRowsPerThreadblock = kThreadCount / kThreadsPerRow;
+
+  // minimum K extent of a split-K slice when the number of slices is chosen automatically
+  static int const kMinSplitKSize = 1024;
+
+  // resident threads per SM assumed when choosing the number of split-K slices automatically
+  static int const kMaxThreadsPerSm = 2048;
+
   //
   // Structures
   //
@@ -422,6 +433,13 @@ public:
     int64_t         batch_stride_C;
     int64_t         batch_stride_D;
 
+    /// Number of slices the K dimension is split into. Partial sums are reduced in-kernel by the
+    /// last slice of each row block. A non-positive value selects the count from hw_info.sm_count.
+    int             split_k_slices = 1;
+
+    /// Used to choose split_k_slices automatically. The SM count is queried if left zero.
+    KernelHardwareInfo hw_info{};
+
     //
     // Methods
     //
@@ -493,7 +511,50 @@ public:
     }
   };
 
-  using Params = Arguments;
+  /// Parameters structure
+  struct Params : Arguments {
+
+    int                 gemm_k_size;    ///< K extent covered by each split-K slice
+    ElementAccumulator *ptr_partials;   ///< Partial sums of all but the last split-K slice
+    int                *ptr_semaphore;  ///< Arrival counter per (batch, row block)
+
+    //
+    // Methods
+    //
+
+    Params(): gemm_k_size(0), ptr_partials(nullptr), ptr_semaphore(nullptr) { }
+
+    Params(Arguments const &args, void *workspace = nullptr):
+      Arguments(args),
+      gemm_k_size(0),
+      ptr_partials(nullptr),
+      ptr_semaphore(nullptr)
+    {
+      init_split_k(workspace);
+    }
+
+    Status update(Arguments const &args, void *workspace = nullptr) {
+      Arguments::update(args);
+      this->split_k_slices = args.split_k_slices;
+      this->hw_info = args.hw_info;
+      init_split_k(workspace);
+
+      return Status::kSuccess;
+    }
+
+  private:
+
+    void init_split_k(void *workspace) {
+      this->split_k_slices = get_split_k_slices(*this);
+      gemm_k_size = get_gemm_k_size(this->problem_size.column(), this->split_k_slices);
+
+      if (workspace) {
+        ptr_partials = static_cast<ElementAccumulator *>(workspace);
+        ptr_semaphore = reinterpret_cast<int *>(
+          static_cast<uint8_t *>(workspace) + get_partials_workspace_size(*this));
+      }
+    }
+  };
 
   /// Shared memory storage structure
   union SharedStorage {
@@ -521,28 +582,109 @@ public:
     return can_implement(args.problem_size);
   }
 
+  /// K extent of each split-K slice, rounded to whole K tiles to keep the vector loads aligned
+  static int get_gemm_k_size(int problem_k, int split_k_slices) {
+    int const tile_k = kThreadsPerRow * kElementsPerAccess;
+    int const k_tiles = (problem_k + tile_k - 1) / tile_k;
+    return ((k_tiles + split_k_slices - 1) / split_k_slices) * tile_k;
+  }
+
+  /// Returns the number of split-K slices to launch
+  static int get_split_k_slices(Arguments const &args) {
+    int const problem_k = args.problem_size.column();
+    int const tile_k = kThreadsPerRow * kElementsPerAccess;
+    int const k_tiles = (problem_k + tile_k - 1) / tile_k;
+
+    int split_k_slices = args.split_k_slices;
+
+    if (split_k_slices <= 0) {
+      // Launch enough slices to fill every SM with row blocks
+      int sm_count = args.hw_info.sm_count;
+      if (sm_count <= 0) {
+        sm_count = KernelHardwareInfo::query_device_multiprocessor_count(args.hw_info.device_id);
+      }
+      int const row_blocks = (args.problem_size.row() + kRowsPerThreadblock - 1) / kRowsPerThreadblock *
+                             std::max(args.batch_count, 1);
+      int const target_blocks = sm_count * std::max(1, kMaxThreadsPerSm / kThreadCount);
+      split_k_slices = (target_blocks + row_blocks - 1) / std::max(row_blocks, 1);
+
+      // Keep enough K per slice to amortize the reduction
+      split_k_slices = std::min(split_k_slices, problem_k / std::max(int(kMinSplitKSize), tile_k));
+    }
+
+    split_k_slices = std::max(1, std::min(split_k_slices, k_tiles));
+
+    // Do not launch slices that would be left without any K tiles
+    if (problem_k > 0) {
+      split_k_slices = (problem_k + get_gemm_k_size(problem_k, split_k_slices) - 1) /
+                       get_gemm_k_size(problem_k, split_k_slices);
+    }
+
+    return split_k_slices;
+  }
+
+  /// Bytes of workspace holding the partial sums of all but the last split-K slice
+  static size_t get_partials_workspace_size(Arguments const &args) {
+    int const split_k_slices = get_split_k_slices(args);
+    if (split_k_slices <= 1) {
+      return 0;
+    }
+    size_t bytes = sizeof(ElementAccumulator) * size_t(split_k_slices - 1) *
+                   size_t(args.batch_count) * size_t(args.problem_size.row());
+    return (bytes + 127) / 128 * 128;
+  }
+
+  /// Bytes of workspace holding one arrival counter per (batch, row block)
+  static size_t get_semaphore_workspace_size(Arguments const &args) {
+    if (get_split_k_slices(args) <= 1) {
+      return 0;
+    }
+    int const row_blocks = (args.problem_size.row() + kRowsPerThreadblock - 1) / kRowsPerThreadblock;
+    return sizeof(int) * size_t(args.batch_count) * size_t(row_blocks);
+  }
+
+  static size_t get_workspace_size(Arguments const &args) {
+    return get_partials_workspace_size(args) + get_semaphore_workspace_size(args);
+  }
+
   /// Executes one GEMV
   CUTLASS_DEVICE
   void operator()(Params const &params, SharedStorage &shared_storage) {
-    
+
+    // K range of this split-K slice
+    int const k_begin = blockIdx.y * params.gemm_k_size;
+    int const k_end = std::min(params.problem_size.column(), k_begin + params.gemm_k_size);
+
     // Loop over batch indices
     for (int batch_idx = blockIdx.z; batch_idx < params.batch_count; batch_idx += gridDim.z) {
       int idx_col_k = threadIdx.x;
       int idx_row_m = blockIdx.x * blockDim.y + threadIdx.y;
 
-      if (idx_row_m < params.problem_size.row()) {
-        // problem_size (row = m, column = k)
-        // matrix A (batch, m, k)
-        // vector B (batch, 1, k)
-        // vector C (batch, m, 1)
-        // vector D (batch, m, 1)
+      bool const is_row_valid = idx_row_m < params.problem_size.row();
+
+      ElementAccumulator accum = 0.f;
+
+      EpilogueOutputOp output_op(params.output_op);
+      typename EpilogueOutputOp::FragmentOutput source_fragment;
+
+      // problem_size (row = m, column = k)
+      // matrix A (batch, m, k)
+      // vector B (batch, 1, k)
+      // vector C (batch, m, 1)
+      // vector D (batch, m, 1)
+
+      // move in the batch dimension
+      ElementA const *ptr_A = params.ref_A.data() + batch_idx * params.batch_stride_A;
+      ElementB const *ptr_B = params.ptr_B + batch_idx * params.batch_stride_B;
 
-        // move in the batch dimension
-        ElementA const *ptr_A = params.ref_A.data() + batch_idx * params.batch_stride_A;
-        ElementB const *ptr_B = params.ptr_B + batch_idx * params.batch_stride_B;
+      ElementC const *ptr_C = params.ptr_C + batch_idx * params.batch_stride_C;
+      ElementC *ptr_D = params.ptr_D + batch_idx * params.batch_stride_D;
 
-        ElementC const *ptr_C = params.ptr_C + batch_idx * params.batch_stride_C;
-        ElementC *ptr_D = params.ptr_D + batch_idx * params.batch_stride_D;
+      // move in the m dimension
+      ptr_C += idx_row_m;
+      ptr_D += idx_row_m;
+
+      if (is_row_valid) {
 
         // move in the k dimension
         ptr_A += idx_col_k * kElementsPerAccess;
@@ -550,23 +692,19 @@ public:
 
         // move in the m dimension
         ptr_A += idx_row_m * params.problem_size.column();
-        ptr_C += idx_row_m;
-        ptr_D += idx_row_m;
 
         NumericArrayConverter<ElementAccumulator, ElementA, kElementsPerAccess, Round> srcA_converter;
         NumericArrayConverter<ElementAccumulator, ElementB, kElementsPerAccess, Round> srcB_converter;
 
-        ElementAccumulator accum = 0.f;
-
         FragmentB fragB;
         FragmentA fragA;
 
-        int unroll_col_k = 0;
+        int unroll_col_k = k_begin;
 
         // rows of the rolling tile
         int const tileA_k = kThreadsPerRow * kElementsPerAccess;
 
-        for (; unroll_col_k < params.problem_size.column() / tileA_k * tileA_k; unroll_col_k += tileA_k) {
+        for (; unroll_col_k < k_begin + (k_end - k_begin) / tileA_k * tileA_k; unroll_col_k += tileA_k) {
 
           // fetch from matrix A
           arch::global_load<FragmentA,
@@ -590,42 +728,86 @@ public:
 
         // calculate the rest of K elements
         // each thread fetch 1 element each time
-        for (int k = unroll_col_k + idx_col_k; k < params.problem_size.column(); k += kThreadsPerRow) {
+        for (int k = unroll_col_k + idx_col_k; k < k_end; k += kThreadsPerRow) {
           ElementB b = *(ptr_B - idx_col_k * kElementsPerAccess + k);
           ElementA a = *(ptr_A - idx_col_k * kElementsPerAccess + k);
 
           accum += ElementAccumulator(a) * ElementAccumulator(b);
         }
 
-        EpilogueOutputOp output_op(params.output_op);
-        typename EpilogueOutputOp::FragmentOutput source_fragment;
-
         // prefetch from source matrix C
         if (output_op.is_source_needed()) {         
           source_fragment[0] = *(ptr_C);
         }
 
-        typename EpilogueOutputOp::FragmentAccumulator accum_fragment;
-        typename EpilogueOutputOp::FragmentOutput output_fragment;
-
         for (int mask = (kThreadsPerRow >> 1); mask > 0; mask >>= 1) {
           accum += __shfl_xor_sync(0xFFFFFFFF, accum, mask, 32);
         }
+      }
 
-        if (idx_col_k == 0) {
-          accum_fragment[0] = accum;
+      // Only the last split-K slice continues to the epilogue
+      if (params.split_k_slices > 1 &&
+          !reduce_split_k(params, batch_idx, idx_row_m, is_row_valid && idx_col_k == 0, accum)) {
+        continue;
+      }
 
-          if (output_op.is_source_needed()) {
-            output_fragment = output_op(accum_fragment, source_fragment);
-          }
-          else {
-            output_fragment = output_op(accum_fragment);
-          }
+      if (is_row_valid && idx_col_k == 0) {
+        typename EpilogueOutputOp::FragmentAccumulator accum_fragment;
+        typename EpilogueOutputOp::FragmentOutput output_fragment;
+
+        accum_fragment[0] = accum;
 
-          *ptr_D = output_fragment[0];
+        if (output_op.is_source_needed()) {
+          output_fragment = output_op(accum_fragment, source_fragment);
         }
+        else {
+          output_fragment = output_op(accum_fragment);
+        }
+
+        *ptr_D = output_fragment[0];
+      }
+    }
+  }
+
+private:
+
+  /// Exchanges partial sums between the split-K slices of a row block. Slices that are not last
+  /// publish their partials and return false. The last slice waits for all earlier slices, which are
+  /// scheduled before it, adds their partials in slice order, and returns true.
+  CUTLASS_DEVICE
+  bool reduce_split_k(
+    Params const &params,
+    int batch_idx,
+    int idx_row_m,
+    bool is_row_owner,
+    ElementAccumulator &accum) {
+
+    int const thread_idx = threadIdx.y * blockDim.x + threadIdx.x;
+    int const split_k_idx = blockIdx.y;
+    int const last_split_k_idx = params.split_k_slices - 1;
+    int const flag_idx = batch_idx * gridDim.x + blockIdx.x;
+
+    auto partial_offset = [&](int slice) {
+      return (int64_t(slice) * params.batch_count + batch_idx) * params.problem_size.row() + idx_row_m;
+    };
+
+    if (split_k_idx < last_split_k_idx) {
+      if (is_row_owner) {
+        params.ptr_partials[partial_offset(split_k_idx)] = accum;
+      }
+      Barrier::arrive_inc(params.ptr_semaphore, thread_idx, flag_idx);
+      return false;
+    }
+
+    // Wait for the other slices and reset the counter for the next launch
+    Barrier::wait_eq_reset(params.ptr_semaphore, thread_idx, flag_idx, last_split_k_idx);
+
+    if (is_row_owner) {
+      for (int slice = 0; slice < last_split_k_idx; ++slice) {
+        accum += params.ptr_partials[partial_offset(slice)];
       }
     }
+    return true;
   }
 };
 
@@ -0,0 +1,94 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+
+/*! \file
+    \brief L2 prefetch of a caller-specified buffer from the tail of a persistent kernel.
+
+    Decode steps run chains of memory-bound GEMMs, so the weights of the next layer can be pulled
+    into L2 while the current kernel is still computing. Once a CTA's mainloop producer warp has
+    issued the loads of its last tile it has nothing left to do, so it spends the remaining time
+    issuing cp.async.bulk.prefetch.L2 for its share of the buffer. The buffer is split into chunks
+    that are distributed round-robin over all CTAs of the grid.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cute/arch/copy_sm90_tma.hpp"
+
+namespace cutlass::gemm::kernel::detail {
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct L2PrefetchArguments {
+  void const* ptr = nullptr;   // 16B aligned, prefetch disabled if null
+  size_t bytes = 0;            // multiple of 16
+};
+
+struct L2Prefetch {
+  // Bytes per prefetch instruction
+  static constexpr uint32_t ChunkBytes = 32 * 1024;
+
+  static bool
+  can_implement(L2PrefetchArguments const& args) {
+    if (args.ptr == nullptr) {
+      return true;
+    }
+    bool implementable = (reinterpret_cast<uintptr_t>(args.ptr) % 16 == 0) && (args.bytes % 16 == 0);
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: L2 prefetch buffer must be 16B aligned and a multiple of 16B.\n");
+    }
+    return implementable;
+  }
+
+  // Called by a single thread of each CTA once it has no more loads to issue
+  CUTLASS_DEVICE static void
+  issue(L2PrefetchArguments const& args) {
+    if (args.ptr == nullptr) {
+      return;
+    }
+    uint64_t cta_idx = blockIdx.x + uint64_t(gridDim.x) * (blockIdx.y + uint64_t(gridDim.y) * blockIdx.z);
+    uint64_t cta_count = uint64_t(gridDim.x) * gridDim.y * gridDim.z;
+    uint64_t chunk_count = (args.bytes + ChunkBytes - 1) / ChunkBytes;
+    char const* ptr = static_cast<char const*>(args.ptr);
+
+    for (uint64_t chunk = cta_idx; chunk < chunk_count; chunk += cta_count) {
+      uint64_t offset = chunk * ChunkBytes;
+      uint32_t bytes = static_cast<uint32_t>(cute::min(uint64_t(ChunkBytes), args.bytes - offset));
+      cute::SM90_BULK_COPY_G2S::PREFETCH::copy(ptr + offset, bytes);
+    }
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::kernel::detail
@@ -0,0 +1,438 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Segmented GEMV kernels applying many low-rank (LoRA) adapters to one batch of tokens
+
+    Tokens of a batch are grouped into segments of consecutive rows, and each segment applies the
+    adapter pair (A_i, B_i) selected by its adapter index. A per-token adapter index (BGMV) is the
+    special case of segments holding one token each.
+
+      shrink:  S[t, :] = X[t, :] * A_i^T      A_i is (rank, hidden) row-major
+      expand:  D[t, :] = alpha * S[t, :] * B_i^T + beta * C[t, :]     B_i is (n, rank) row-major
+
+    Both kernels are tuned for adapter ranks of at most a few dozen, which are far too narrow to
+    fill a tensor core tile. The expand kernel adds the adapter output to C, which may alias D to
+    accumulate onto the base projection in place. To fold that residual add into the epilogue of
+    the base GEMM instead, run the expand kernel with beta = 0 and pass its D as the C operand of
+    the base GEMM with beta = 1.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/numeric_conversion.h"
+
+#include "cutlass/arch/memory.h"
+#include "cutlass/arch/cache_operation.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace gemm {
+namespace kernel {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+/// Segments of consecutive tokens sharing one adapter
+struct SgmvSegments {
+  int num_segments{0};
+  int const *ptr_segment_offsets{nullptr};   ///< (num_segments + 1) first token of each segment, then num_tokens
+  int const *ptr_adapter_indices{nullptr};   ///< (num_segments) adapter of each segment, negative for none
+
+  /// Returns the adapter applied to a token
+  CUTLASS_DEVICE
+  int adapter_of(int token) const {
+    // Last segment starting at or before the token
+    int lo = 0;
+    int hi = num_segments;
+    while (hi - lo > 1) {
+      int mid = (lo + hi) / 2;
+      if (ptr_segment_offsets[mid] <= token) {
+        lo = mid;
+      }
+      else {
+        hi = mid;
+      }
+    }
+    return ptr_adapter_indices[lo];
+  }
+};
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Shrink: S = X * A_i^T for the adapter i of each token.
+///
+/// Each warp computes kRanksPerWarp consecutive columns of S for one token, its lanes striding over
+/// the hidden dimension in vectors of kElementsPerAccess. Splitting the rank across warps keeps the
+/// grid wide enough to fill the GPU for the few tokens of a decode step.
+template <
+  typename ElementX_,                   ///< Data type of the input activations X
+  typename ElementW_,                   ///< Data type of the adapter weights A_i
+  typename ElementS_,                   ///< Data type of the low-rank output S
+  typename ElementAccumulator_ = float, ///< Data type of the inner products
+  int kElementsPerAccess_ = 8,          ///< Vector length of loads along the hidden dimension
+  int kRanksPerWarp_ = 4,               ///< Columns of S computed by each warp
+  int kThreadCount_ = 256               ///< Number of threads per CTA
+>
+struct SgmvShrink {
+public:
+
+  using ElementX = ElementX_;
+  using ElementW = ElementW_;
+  using ElementS = ElementS_;
+  using ElementAccumulator = ElementAccumulator_;
+
+  static int const kElementsPerAccess = kElementsPerAccess_;
+  static int const kRanksPerWarp = kRanksPerWarp_;
+  static int const kThreadCount = kThreadCount_;
+  static int const kWarpCount = kThreadCount / 32;
+
+  static_assert(kThreadCount % 32 == 0, "Threads must be a multiple of the warp size.");
+
+  static FloatRoundStyle const Round = FloatRoundStyle::round_to_nearest;
+
+  using FragmentX = Array<ElementX, kElementsPerAccess>;
+  using FragmentW = Array<ElementW, kElementsPerAccess>;
+  using FragmentCompute = Array<ElementAccumulator, kElementsPerAccess>;
+
+  //
+  // Structures
+  //
+
+  /// Argument structure
+  struct Arguments {
+    int num_tokens{0};
+    int hidden{0};                            ///< Input features, the K extent of the shrink
+    int rank{0};                              ///< Adapter rank, the columns of S
+
+    detail::SgmvSegments segments{};
+
+    ElementX const *ptr_X{nullptr};           ///< (num_tokens, hidden) row-major
+    int64_t ldx{0};
+    ElementW const * const *ptr_A{nullptr};   ///< Per adapter, (rank, hidden) row-major with leading dimension hidden
+    ElementS *ptr_S{nullptr};                 ///< (num_tokens, rank) row-major
+    int64_t lds{0};
+  };
+
+  using Params = Arguments;
+
+  /// Shared memory storage structure
+  struct SharedStorage { };
+
+  //
+  // Methods
+  //
+
+  CUTLASS_DEVICE
+  SgmvShrink() { }
+
+  static Status can_implement(Arguments const &args) {
+    if (args.num_tokens < 0 || args.rank <= 0 || args.hidden <= 0 || args.segments.num_segments <= 0) {
+      return Status::kErrorInvalidProblem;
+    }
+    if (args.hidden % kElementsPerAccess != 0 || args.ldx % kElementsPerAccess != 0) {
+      return Status::kErrorMisalignedOperand;
+    }
+    return Status::kSuccess;
+  }
+
+  static dim3 get_block_shape() {
+    return dim3(32, kWarpCount, 1);
+  }
+
+  static dim3 get_grid_shape(Params const &params) {
+    int rank_groups = (params.rank + kRanksPerWarp - 1) / kRanksPerWarp;
+    int64_t warps = int64_t(params.num_tokens) * rank_groups;
+    return dim3(int((warps + kWarpCount - 1) / kWarpCount), 1, 1);
+  }
+
+  /// Executes the shrink
+  CUTLASS_DEVICE
+  void operator()(Params const &params, SharedStorage &shared_storage) {
+
+    int lane_idx = threadIdx.x;
+    int rank_groups = (params.rank + kRanksPerWarp - 1) / kRanksPerWarp;
+    int64_t warp_idx = int64_t(blockIdx.x) * kWarpCount + threadIdx.y;
+
+    if (warp_idx >= int64_t(params.num_tokens) * rank_groups) {
+      return;
+    }
+
+    int token = int(warp_idx / rank_groups);
+    int rank_begin = int(warp_idx % rank_groups) * kRanksPerWarp;
+    int adapter = params.segments.adapter_of(token);
+
+    ElementAccumulator accum[kRanksPerWarp];
+    CUTLASS_PRAGMA_UNROLL
+    for (int r = 0; r < kRanksPerWarp; ++r) {
+      accum[r] = ElementAccumulator(0);
+    }
+
+    if (adapter >= 0) {
+      ElementX const *ptr_X = params.ptr_X + token * params.ldx;
+      ElementW const *ptr_A = params.ptr_A[adapter] + int64_t(rank_begin) * params.hidden;
+
+      NumericArrayConverter<ElementAccumulator, ElementX, kElementsPerAccess, Round> convert_X;
+      NumericArrayConverter<ElementAccumulator, ElementW, kElementsPerAccess, Round> convert_W;
+
+      for (int k = lane_idx * kElementsPerAccess; k < params.hidden; k += 32 * kElementsPerAccess) {
+        FragmentX frag_X;
+        arch::global_load<FragmentX, sizeof(FragmentX), arch::CacheOperation::Always>(
+          frag_X, ptr_X + k, true);
+        FragmentCompute x = convert_X(frag_X);
+
+        CUTLASS_PRAGMA_UNROLL
+        for (int r = 0; r < kRanksPerWarp; ++r) {
+          FragmentW frag_W;
+          arch::global_load<FragmentW, sizeof(FragmentW), arch::CacheOperation::Always>(
+            frag_W, ptr_A + int64_t(r) * params.hidden + k, rank_begin + r < params.rank);
+          FragmentCompute w = convert_W(frag_W);
+
+          CUTLASS_PRAGMA_UNROLL
+          for (int e = 0; e < kElementsPerAccess; ++e) {
+            accum[r] += x[e] * w[e];
+          }
+        }
+      }
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int r = 0; r < kRanksPerWarp; ++r) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int mask = 16; mask > 0; mask >>= 1) {
+          accum[r] += __shfl_xor_sync(0xFFFFFFFF, accum[r], mask, 32);
+        }
+      }
+    }
+
+    // Lane r stores column rank_begin + r; tokens without an adapter store zeros
+    NumericConverter<ElementS, ElementAccumulator, Round> convert_S;
+    CUTLASS_PRAGMA_UNROLL
+    for (int r = 0; r < kRanksPerWarp; ++r) {
+      if (lane_idx == r % 32 && rank_begin + r < params.rank) {
+        params.ptr_S[token * params.lds + rank_begin + r] = convert_S(accum[r]);
+      }
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Expand: D = alpha * S * B_i^T + beta * C for the adapter i of each token.
+///
+/// Each thread computes one output column for kTokensPerCta consecutive tokens. It keeps row n of
+/// B_i in registers and reloads it only when the adapter changes between tokens, so a segment
+/// streams its adapter once per CTA. The rows of S are staged in shared memory.
+template <
+  typename ElementS_,                   ///< Data type of the low-rank input S
+  typename ElementW_,                   ///< Data type of the adapter weights B_i
+  typename ElementC_,                   ///< Data type of the source C and output D
+  typename ElementAccumulator_,         ///< Data type of the inner products
+  typename EpilogueOutputOp_,           ///< Epilogue of one output element, e.g. LinearCombination<ElementC, 1, ...>
+  int kMaxRank_ = 64,                   ///< Largest adapter rank supported
+  int kElementsPerAccess_ = 8,          ///< Vector length of loads along the rank of B_i
+  int kTokensPerCta_ = 8,               ///< Tokens computed by each CTA
+  int kThreadCount_ = 256               ///< Number of threads per CTA, each computing one output column
+>
+struct SgmvExpand {
+public:
+
+  using ElementS = ElementS_;
+  using ElementW = ElementW_;
+  using ElementC = ElementC_;
+  using ElementAccumulator = ElementAccumulator_;
+  using EpilogueOutputOp = EpilogueOutputOp_;
+
+  static int const kMaxRank = kMaxRank_;
+  static int const kElementsPerAccess = kElementsPerAccess_;
+  static int const kTokensPerCta = kTokensPerCta_;
+  static int const kThreadCount = kThreadCount_;
+
+  static_assert(kMaxRank % kElementsPerAccess == 0, "Maximum rank must be a multiple of the access width.");
+  static_assert(EpilogueOutputOp::kCount == 1, "The epilogue computes one output element per thread.");
+
+  static FloatRoundStyle const Round = FloatRoundStyle::round_to_nearest;
+
+  using FragmentW = Array<ElementW, kElementsPerAccess>;
+  using FragmentCompute = Array<ElementAccumulator, kElementsPerAccess>;
+
+  //
+  // Structures
+  //
+
+  /// Argument structure
+  struct Arguments {
+    int num_tokens{0};
+    int n{0};                                 ///< Output features, the columns of D
+    int rank{0};                              ///< Adapter rank, the K extent of the expand
+
+    detail::SgmvSegments segments{};
+
+    typename EpilogueOutputOp::Params output_op{};
+
+    ElementS const *ptr_S{nullptr};           ///< (num_tokens, rank) row-major
+    int64_t lds{0};
+    ElementW const * const *ptr_B{nullptr};   ///< Per adapter, (n, rank) row-major with leading dimension rank
+    ElementC const *ptr_C{nullptr};           ///< (num_tokens, n) row-major, may alias ptr_D
+    int64_t ldc{0};
+    ElementC *ptr_D{nullptr};                 ///< (num_tokens, n) row-major
+    int64_t ldd{0};
+  };
+
+  using Params = Arguments;
+
+  /// Shared memory storage structure
+  struct SharedStorage {
+    ElementAccumulator S[kTokensPerCta][kMaxRank];
+    int adapter[kTokensPerCta];
+  };
+
+  //
+  // Methods
+  //
+
+  CUTLASS_DEVICE
+  SgmvExpand() { }
+
+  static Status can_implement(Arguments const &args) {
+    if (args.num_tokens < 0 || args.n <= 0 || args.rank <= 0 || args.segments.num_segments <= 0) {
+      return Status::kErrorInvalidProblem;
+    }
+    if (args.rank > kMaxRank) {
+      return Status::kErrorNotSupported;
+    }
+    if (args.rank % kElementsPerAccess != 0) {
+      return Status::kErrorMisalignedOperand;
+    }
+    return Status::kSuccess;
+  }
+
+  static dim3 get_block_shape() {
+    return dim3(kThreadCount, 1, 1);
+  }
+
+  static dim3 get_grid_shape(Params const &params) {
+    return dim3((params.n + kThreadCount - 1) / kThreadCount,
+                (params.num_tokens + kTokensPerCta - 1) / kTokensPerCta,
+                1);
+  }
+
+  /// Executes the expand
+  CUTLASS_DEVICE
+  void operator()(Params const &params, SharedStorage &shared_storage) {
+
+    int col = blockIdx.x * kThreadCount + threadIdx.x;
+    int token_begin = blockIdx.y * kTokensPerCta;
+    int token_count = min(kTokensPerCta, params.num_tokens - token_begin);
+
+    // Stage the rows of S and the adapter of each token
+    NumericConverter<ElementAccumulator, ElementS, Round> convert_S;
+    for (int i = threadIdx.x; i < token_count * params.rank; i += kThreadCount) {
+      int t = i / params.rank;
+      int r = i % params.rank;
+      shared_storage.S[t][r] = convert_S(params.ptr_S[(token_begin + t) * params.lds + r]);
+    }
+    for (int t = threadIdx.x; t < token_count; t += kThreadCount) {
+      shared_storage.adapter[t] = params.segments.adapter_of(token_begin + t);
+    }
+    __syncthreads();
+
+    if (col >= params.n) {
+      return;
+    }
+
+    EpilogueOutputOp output_op(params.output_op);
+    NumericArrayConverter<ElementAccumulator, ElementW, kElementsPerAccess, Round> convert_W;
+
+    ElementAccumulator b[kMaxRank];
+    int loaded_adapter = -1;
+
+    for (int t = 0; t < token_count; ++t) {
+      int adapter = shared_storage.adapter[t];
+      ElementAccumulator accum = ElementAccumulator(0);
+
+      if (adapter >= 0) {
+        // Row col of B_i, reloaded only when the adapter changes
+        if (adapter != loaded_adapter) {
+          ElementW const *ptr_B = params.ptr_B[adapter] + int64_t(col) * params.rank;
+          CUTLASS_PRAGMA_UNROLL
+          for (int r = 0; r < kMaxRank; r += kElementsPerAccess) {
+            FragmentW frag_W;
+            arch::global_load<FragmentW, sizeof(FragmentW), arch::CacheOperation::Always>(
+              frag_W, ptr_B + r, r < params.rank);
+            FragmentCompute w = convert_W(frag_W);
+            CUTLASS_PRAGMA_UNROLL
+            for (int e = 0; e < kElementsPerAccess; ++e) {
+              b[r + e] = r < params.rank ? w[e] : ElementAccumulator(0);
+            }
+          }
+          loaded_adapter = adapter;
+        }
+
+        CUTLASS_PRAGMA_UNROLL
+        for (int r = 0; r < kMaxRank; ++r) {
+          if (r < params.rank) {
+            accum += shared_storage.S[t][r] * b[r];
+          }
+        }
+      }
+
+      typename EpilogueOutputOp::FragmentAccumulator accum_fragment;
+      typename EpilogueOutputOp::FragmentOutput output_fragment;
+      accum_fragment[0] = accum;
+
+      int64_t token = token_begin + t;
+      if (output_op.is_source_needed()) {
+        typename EpilogueOutputOp::FragmentOutput source_fragment;
+        source_fragment[0] = params.ptr_C[token * params.ldc + col];
+        output_fragment = output_op(accum_fragment, source_fragment);
+      }
+      else {
+        output_fragment = output_op(accum_fragment);
+      }
+
+      params.ptr_D[token * params.ldd + col] = output_fragment[0];
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace kernel
+} // namespace gemm
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -136,7 +136,11 @@ public:
   //For the case of RCGroupedGemm we are still GroupedGemm but our StrideA will not match with InternalStrideA
   // Hence it's better to take this decision based upon StrideB
   static constexpr bool IsGroupedGemmKernel = !(cute::is_same_v<StrideB, InternalStrideB>);
-  using TileSchedulerTag = cute::conditional_t<IsGroupedGemmKernel, GroupScheduler, TileSchedulerTag_>;
+  // Grouped GEMMs use the static group scheduler unless the dynamic or expert arrival group scheduler is requested
+  using TileSchedulerTag = cute::conditional_t<IsGroupedGemmKernel &&
+      not cute::is_same_v<TileSchedulerTag_, DynamicGroupScheduler> &&
+      not cute::is_same_v<TileSchedulerTag_, ExpertArrivalGroupScheduler>,
+    GroupScheduler, TileSchedulerTag_>;
 
   using TileScheduler = typename detail::TileSchedulerSelector<
     TileSchedulerTag, ArchTag, CtaShape_MNK, ClusterShape, SchedulerPipelineStageCount, ProblemShape>::Scheduler;
@@ -144,6 +148,8 @@ public:
   using TileSchedulerParams = typename TileScheduler::Params;
 
   static constexpr bool IsSchedDynamicPersistent = TileScheduler::IsDynamicPersistent;
+  // Tiles wait for the rows of A that other devices push into this one
+  static constexpr bool IsExpertArrivalGroupScheduler = cute::is_same_v<TileSchedulerTag, ExpertArrivalGroupScheduler>;
   static constexpr bool IsTensorMapUpdateAsync = IsGroupedGemmKernel && not IsSchedDynamicPersistent;
   static constexpr bool IsDynamicCluster = not cute::is_static_v<ClusterShape>;
   static constexpr uint32_t MinTensorMapWorkspaceAlignment = 64;
@@ -417,6 +423,9 @@ public:
     implementable &= CollectiveMainloop::can_implement(args.problem_shape, args.mainloop);
     implementable &= CollectiveEpilogue::can_implement(args.problem_shape, args.epilogue);
     implementable &= TileScheduler::can_implement(args.scheduler, args.hw_info);
+    if constexpr (IsGroupedGemmKernel && IsSchedDynamicPersistent) {
+      implementable &= TileScheduler::can_implement(args.problem_shape);
+    }
     if (!implementable) {
       CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Mainloop, Epilogue or Scheduler don't meet the requirements for Ptr Array Gemm or Grouped Gemm.\n");
       return implementable;
@@ -588,8 +597,9 @@ public:
     };
 
     int32_t sm_id = static_cast<int32_t>(cutlass::arch::SmId());
-    if constexpr (IsGroupedGemmKernel) {
-      // In case user wants to engage less SMs than available on device
+    if constexpr (IsGroupedGemmKernel && not IsSchedDynamicPersistent) {
+      // In case user wants to engage less SMs than available on device.
+      // The dynamic group scheduler launches a full grid, so it keeps the hardware SM ID.
       sm_id = blockIdx.x + (blockIdx.y * gridDim.x);
     }
     auto tensormaps_init_main_load = [&] () {
@@ -719,7 +729,7 @@ public:
     }();
 
     auto tensor_map_ready_pipeline = [&] () {
-      if constexpr (IsGroupedGemmKernel) {
+      if constexpr (IsTensorMapUpdateAsync) {
         // TMA update ready pipeline
         typename TensorMapReadyPipeline::Params tensor_map_ready_pipeline_params;
 
@@ -975,6 +985,10 @@ public:
           }
         }
 
+        if constexpr (IsExpertArrivalGroupScheduler) {
+          scheduler.wait_for_input_tiles(work_tile_info);
+        }
+
         // Start mainloop prologue loads, arrive on the epilogue residual load barrier, resume mainloop loads
         auto [mainloop_producer_state_next, k_tile_iter_next] = collective_mainloop.load(
           params.mainloop,
@@ -1034,7 +1048,7 @@ public:
         arch::warpgroup_reg_dealloc<GenericRegisterRequirement>();
       }
 
-      // Grouped GEMM uses static tile scheduler
+      // Grouped GEMM uses static tile scheduler unless the dynamic group scheduler is requested
       if constexpr (IsSchedDynamicPersistent) {
         // Whether a new CLC query must be performed.
         // See comment below where this variable is updated for a description of
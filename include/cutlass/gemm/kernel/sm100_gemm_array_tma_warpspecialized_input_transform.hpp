@@ -75,7 +75,7 @@ public:
   // Type Aliases
   //
   using ProblemShape = ProblemShape_;
-  static_assert(rank(typename ProblemShape::UnderlyingProblemShape{}) == 4,
+  static_assert(rank(typename ProblemShape::UnderlyingProblemShape{}) == 3 or rank(typename ProblemShape::UnderlyingProblemShape{}) == 4,
     "ProblemShape{} should be <M,N,K> or <M,N,K,L>");
   static constexpr bool IsGdcEnabled = cutlass::arch::IsGdcGloballyEnabled;
 
@@ -116,10 +116,13 @@ public:
   // CLC pipeline depth
   // determines how many waves (stages-1) a warp can race ahead
   static constexpr uint32_t SchedulerPipelineStageCount = DispatchPolicy::Schedule::SchedulerPipelineStageCount;
+  static constexpr bool IsGroupedGemmKernel = !(cute::is_same_v<StrideB, InternalStrideB>);
   // TileID scheduler
-  using TileSchedulerTag = TileScheduler_;
+  // Grouped GEMMs use the static group scheduler unless the dynamic group scheduler is requested
+  using TileSchedulerTag = cute::conditional_t<IsGroupedGemmKernel && not cute::is_same_v<TileScheduler_, DynamicGroupScheduler>,
+    GroupScheduler, TileScheduler_>;
   using TileScheduler = typename detail::TileSchedulerSelector<
-    TileScheduler_, ArchTag, CtaShape_MNK, ClusterShape, SchedulerPipelineStageCount>::Scheduler;
+    TileSchedulerTag, ArchTag, CtaShape_MNK, ClusterShape, SchedulerPipelineStageCount, ProblemShape>::Scheduler;
   using TileSchedulerArguments = typename TileScheduler::Arguments;
   using TileSchedulerParams = typename TileScheduler::Params;
 
@@ -302,29 +305,48 @@ public:
       args.scheduler, problem_shapes.get_host_problem_shape(0), args.hw_info, NumFixupBarriers, NumEpilogueSubTiles, CollectiveEpilogue::NumAccumulatorMtxs);
     workspace_offset = round_nearest(workspace_offset, MinTensorMapWorkspaceAlignment);
 
+    TileSchedulerParams scheduler;
+    if constexpr (IsGroupedGemmKernel) {
+      scheduler = TileScheduler::to_underlying_arguments(
+        problem_shapes, TileShape{}, AtomThrShapeMNK{}, ClusterShape{},
+        args.hw_info, args.scheduler, scheduler_workspace);
+    }
+    else {
+      scheduler = TileScheduler::to_underlying_arguments(
+        problem_shapes.get_host_problem_shape(), TileShape{}, AtomThrShapeMNK{}, ClusterShape{},
+        args.hw_info, args.scheduler, scheduler_workspace);
+    }
+
     return {
       args.mode,
       problem_shapes,
       CollectiveMainloop::to_underlying_arguments(problem_shapes, args.mainloop, mainloop_workspace, args.hw_info),
       CollectiveEpilogue::to_underlying_arguments(problem_shapes, args.epilogue, epilogue_workspace),
-      TileScheduler::to_underlying_arguments(
-        problem_shapes.get_host_problem_shape(), TileShape{}, AtomThrShapeMNK{}, ClusterShape{},
-        args.hw_info, args.scheduler, scheduler_workspace
-      )
-      ,args.hw_info
+      scheduler,
+      args.hw_info
     };
   }
 
   static bool
   can_implement(Arguments const& args) {
-    bool implementable = (args.mode == GemmUniversalMode::kArray && rank(typename ProblemShape::UnderlyingProblemShape{}) == 4);
+    bool implementable = true;
+    if constexpr (IsGroupedGemmKernel) {
+      // Group GEMM currently only supports rank-3 problem shapes
+      implementable &= (args.mode == GemmUniversalMode::kGrouped && rank(typename ProblemShape::UnderlyingProblemShape{}) == 3);
+    }
+    else {
+      implementable &= (args.mode == GemmUniversalMode::kArray && rank(typename ProblemShape::UnderlyingProblemShape{}) == 4);
+    }
     if (!implementable) {
-      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Arguments or Problem Shape don't meet the requirements.\n");
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Arguments or Problem Shape don't meet the requirements for Ptr Array Gemm or Grouped Gemm.\n");
       return implementable;
     }
     implementable &= CollectiveMainloop::can_implement(args.problem_shape, args.mainloop);
     implementable &= CollectiveEpilogue::can_implement(args.problem_shape, args.epilogue);
     implementable &= TileScheduler::can_implement(args.scheduler, args.hw_info);
+    if constexpr (IsGroupedGemmKernel && IsSchedDynamicPersistent) {
+      implementable &= TileScheduler::can_implement(args.problem_shape);
+    }
 
     if constexpr (IsDynamicCluster) {
       static constexpr int MaxClusterSize = 16;
@@ -398,14 +420,26 @@ public:
   static dim3
   get_grid_shape(Params const& params) {
     auto cluster_shape = cutlass::detail::select_cluster_shape(ClusterShape{}, params.hw_info.cluster_shape);
-    return TileScheduler::get_grid_shape(
-        params.scheduler,
-        params.problem_shape.get_host_problem_shape(),
-        TileShape{},
-        AtomThrShapeMNK{},
-        cluster_shape,
-        params.hw_info
-       );
+    if constexpr (IsGroupedGemmKernel) {
+      return TileScheduler::get_grid_shape(
+          params.scheduler,
+          params.problem_shape,
+          TileShape{},
+          AtomThrShapeMNK{},
+          cluster_shape,
+          params.hw_info
+         );
+    }
+    else {
+      return TileScheduler::get_grid_shape(
+          params.scheduler,
+          params.problem_shape.get_host_problem_shape(),
+          TileShape{},
+          AtomThrShapeMNK{},
+          cluster_shape,
+          params.hw_info
+         );
+    }
 }
 
   static dim3
@@ -678,6 +712,21 @@ public:
     typename TileScheduler::WorkTileInfo work_tile_info = scheduler.initial_work_tile_info(cluster_shape);
     auto cta_coord_mnkl = scheduler.work_tile_to_cta_coord(work_tile_info);
 
+    if constexpr (IsGroupedGemmKernel) {
+      if (not work_tile_info.is_valid()) {
+        // When problem shapes are only on device, the grid launched may be larger than the total number of blocks across groups
+        pipeline_init_wait(cluster_size);
+        return;
+      }
+    }
+
+    int32_t sm_id = static_cast<int32_t>(cutlass::arch::SmId());
+    if constexpr (IsGroupedGemmKernel && not IsSchedDynamicPersistent) {
+      // In case user wants to engage less SMs than available on device.
+      // The dynamic group scheduler launches a full grid, so it keeps the hardware SM ID.
+      sm_id = blockIdx.x + (blockIdx.y * gridDim.x);
+    }
+
     // Optionally append 1s until problem shape is rank-4 in case it is only rank-3 (MNK)
     auto problem_shape_MNKL = append<4>(problem_shape.get_problem_shape(work_tile_info.L_idx), 1);
 
@@ -703,7 +752,7 @@ public:
       bool do_load_order_arrive = is_epi_load_needed;
       auto load_inputs = collective_mainloop.load_init(
           problem_shape_MNKL, params.mainloop, shared_storage.tensors.mainloop,
-          params.hw_info.sm_count, static_cast<int32_t>(cutlass::arch::SmId()));
+          params.hw_info.sm_count, sm_id);
       Tensor gA_mkl = get<0>(load_inputs);
       // Fetch a copy of tensormaps for the CTA from Params
       auto input_tensormaps = get<rank(load_inputs) - 1>(load_inputs);
@@ -720,11 +769,15 @@ public:
 
       do {
         int32_t curr_batch = idx2crd(work_tile_info.L_idx, shape<4>(gA_mkl)); // Usually just returns work_tile_info.L_idx;
+        if constexpr (IsGroupedGemmKernel) {
+          problem_shape_MNKL = append<4>(problem_shape.get_problem_shape(curr_batch), 1);
+        }
         if (did_batch_change) {
           collective_mainloop.tensormaps_perform_update(
             shared_storage.tensormaps.mainloop,
             params.mainloop,
             input_tensormaps,
+            problem_shape,
             curr_batch,
             lane_predicate
           );
@@ -817,6 +870,9 @@ public:
       tmem_allocation_result_barrier.arrive_and_wait_unaligned();
 
       do {
+        if constexpr (IsGroupedGemmKernel) {
+          problem_shape_MNKL = append<4>(problem_shape.get_problem_shape(work_tile_info.L_idx), 1);
+        }
         auto k_tile_count = TileScheduler::get_work_k_tile_count(work_tile_info, problem_shape_MNKL, CtaShape_MNK{});
         auto k_tile_start = TileScheduler::get_work_k_tile_start(work_tile_info);
         auto k_tile_iter = cute::make_coord_iterator(idx2crd(k_tile_start, shape<3>(gA_mkl)), shape<3>(gA_mkl));
@@ -930,6 +986,9 @@ public:
       epilogue_throttle_barrier.arrive();
 
       do {
+        if constexpr (IsGroupedGemmKernel) {
+          problem_shape_MNKL = append<4>(problem_shape.get_problem_shape(work_tile_info.L_idx), 1);
+        }
         auto k_tile_count = TileScheduler::get_work_k_tile_count(work_tile_info, problem_shape_MNKL, CtaShape_MNK{});
         // Fetch next work tile
         auto [next_work_tile_info, increment_pipe] = scheduler.fetch_next_work(
@@ -993,7 +1052,7 @@ public:
       bool do_tail_load = false;
       // Fetch a copy of tensormaps for the CTA from Params
       auto epi_load_tensormap = get<0>(collective_epilogue.load_init(
-          params.epilogue, shared_storage.tensormaps.epilogue, params.hw_info.sm_count, static_cast<int32_t>(cutlass::arch::SmId())));
+          params.epilogue, shared_storage.tensormaps.epilogue, params.hw_info.sm_count, sm_id));
       // Initial batch's tensor address update
       // Even the first tile for a CTA can be from any of the batches.
       // And during initialization of the first TMA descriptor on host, we don't initialize to the first batch due to that args value being device-only.
@@ -1034,6 +1093,9 @@ public:
             do_load_order_wait = false;
           }
 
+          if constexpr (IsGroupedGemmKernel) {
+            problem_shape_MNKL = append<4>(problem_shape.get_problem_shape(curr_batch), 1);
+          }
           epi_load_pipe_producer_state = collective_epilogue.load(
             epi_load_pipeline,
             epi_load_pipe_producer_state,
@@ -1084,7 +1146,7 @@ public:
       auto warp_idx_in_epi = canonical_warp_idx_sync() - static_cast<int>(WarpCategory::Epilogue);
       // Fetch a copy of tensormaps for the CTA from Params
       auto epi_store_tensormap = get<0>(collective_epilogue.store_init(
-          params.epilogue, shared_storage.tensormaps.epilogue, params.hw_info.sm_count, static_cast<int32_t>(cutlass::arch::SmId())));
+          params.epilogue, shared_storage.tensormaps.epilogue, params.hw_info.sm_count, sm_id));
       // Initial batch's tensor address update
       // Even the first tile for a CTA can be from any of the batches.
       // And during initialization of the first TMA descriptor on host, we don't initialize to the first batch due to that args value being device-only.
@@ -1113,6 +1175,9 @@ public:
           ++clc_pipeline_consumer_state;
         }
 
+        if constexpr (IsGroupedGemmKernel) {
+          problem_shape_MNKL = append<4>(problem_shape.get_problem_shape(curr_batch), 1);
+        }
         auto k_tile_count = TileScheduler::get_work_k_tile_count(work_tile_info, problem_shape_MNKL, CtaShape_MNK{});
 
         if constexpr (InputTransformType == cutlass::gemm::detail::KernelInputTransformType::FastF32) {
@@ -45,7 +45,9 @@
 #include "cutlass/gemm/dispatch_policy.hpp"
 #include "cutlass/detail/mainloop_fusion_helper_scale_factor.hpp"
 #include "cutlass/gemm/kernel/sm100_tile_scheduler.hpp"
+#include "cutlass/gemm/kernel/l2_prefetch.hpp"
 #include "cutlass/pipeline/pipeline.hpp"
+#include "cutlass/pipeline/pipeline_trace.hpp"
 #include "cutlass/detail/sm100_tmem_helper.hpp"
 
 #include "cute/tensor.hpp"
@@ -178,6 +180,11 @@ public:
   using TmemAllocator = cute::conditional_t<cute::size(cute::shape<0>(typename TiledMma::ThrLayoutVMNK{})) == 1,
       cute::TMEM::Allocator1Sm, cute::TMEM::Allocator2Sm>;
 
+  // TMEM columns held by each CTA. Holding less than the full capacity lets the CTAs of a dependent grid
+  // launched at launch_dependent_grids() allocate TMEM while this grid drains its final accumulators.
+  static constexpr uint32_t TmemAllocationColumns =
+      cutlass::detail::Sm100TmemAllocationColumns<CollectiveMainloop, EpilogueTile, IsOverlappingAccum>::value;
+
   // Kernel level shared memory storage
   struct SharedStorage {
     struct PipelineStorage : cute::aligned_struct<16, _1> {
@@ -219,6 +226,8 @@ public:
     EpilogueArguments epilogue{};
     KernelHardwareInfo hw_info{};
     TileSchedulerArguments scheduler{};
+    // Buffer prefetched into L2 once the mainloop loads are done, e.g. the next layer's weights
+    detail::L2PrefetchArguments l2_prefetch{};
   };
 
   // Kernel device entry point API
@@ -229,6 +238,7 @@ public:
     EpilogueParams epilogue{};
     TileSchedulerParams scheduler{};
     KernelHardwareInfo hw_info{}; 
+    detail::L2PrefetchArguments l2_prefetch{};
   };
 
   enum class WarpCategory : int32_t {
@@ -294,6 +304,7 @@ public:
         args.hw_info, args.scheduler, scheduler_workspace
       )
       ,args.hw_info
+      ,args.l2_prefetch
     };
   }
 
@@ -308,6 +319,7 @@ public:
     implementable &= CollectiveMainloop::can_implement(args.problem_shape, args.mainloop);
     implementable &= CollectiveEpilogue::can_implement(args.problem_shape, args.epilogue);
     implementable &= TileScheduler::can_implement(args.scheduler, args.hw_info);
+    implementable &= detail::L2Prefetch::can_implement(args.l2_prefetch);
 
     if constexpr (IsDynamicCluster) {
       static constexpr int MaxClusterSize = 16;
@@ -636,6 +648,7 @@ public:
         }
 
         // Start mainloop prologue loads, arrive on the epilogue residual load barrier, resume mainloop loads
+        uint64_t load_trace_start = pipeline_trace_timestamp();
         auto [mainloop_producer_state_next, k_tile_iter_next] = collective_mainloop.load(
           mainloop_pipeline,
           mainloop_pipe_producer_state,
@@ -658,14 +671,17 @@ public:
           k_tile_iter_next, k_tile_count - k_tile_prologue
         );
         mainloop_pipe_producer_state = mainloop_producer_state_next_;
+        pipeline_trace_emit_region<NumThreadsPerWarp>(PipelineTraceEvent::kMainloopLoad, load_trace_start);
 
         // Sync warp to prevent non-participating threads entering next wave early
         __syncwarp();
+        uint64_t fetch_trace_start = pipeline_trace_timestamp();
         auto [next_work_tile_info, increment_pipe] = scheduler.fetch_next_work(
           work_tile_info,
           clc_pipeline,
           clc_pipe_consumer_state
         );
+        pipeline_trace_emit_region<NumThreadsPerWarp>(PipelineTraceEvent::kSchedulerFetch, fetch_trace_start);
         work_tile_info = next_work_tile_info;
         cta_coord_mnkl = scheduler.work_tile_to_cta_coord(work_tile_info);
         requires_clc_query = increment_pipe;
@@ -675,6 +691,10 @@ public:
       } while (work_tile_info.is_valid());
       collective_mainloop.load_tail(mainloop_pipeline, mainloop_pipe_producer_state);
 
+      // Nothing left to load, warm L2 for the caller while the MMA and epilogue warps finish
+      if (lane_predicate) {
+        detail::L2Prefetch::issue(params.l2_prefetch);
+      }
     }
 
     else if (is_participant.sched) {
@@ -698,11 +718,13 @@ public:
           }
 
           // Fetch next work tile
+          uint64_t fetch_trace_start = pipeline_trace_timestamp();
           auto [next_work_tile_info, increment_pipe] = scheduler.fetch_next_work(
             work_tile_info,
             clc_pipeline,
             clc_pipe_consumer_state
           );
+          pipeline_trace_emit_region<NumThreadsPerWarp>(PipelineTraceEvent::kSchedulerFetch, fetch_trace_start);
 
           // Only perform a new CLC query if we consumed a new CLC query result in
           // `fetch_next_work`. An example of a case in which CLC `fetch_next_work` does
@@ -724,8 +746,10 @@ public:
 
     else if (is_participant.mma) {
       // Tmem allocation sequence
-      tmem_allocator.allocate(TmemAllocator::Sm100TmemCapacityColumns, &shared_storage.tmem_base_ptr);
+      uint64_t alloc_trace_start = pipeline_trace_timestamp();
+      tmem_allocator.allocate(TmemAllocationColumns, &shared_storage.tmem_base_ptr);
       __syncwarp();
+      pipeline_trace_emit_region<NumThreadsPerWarp>(PipelineTraceEvent::kTmemAlloc, alloc_trace_start);
       tmem_allocation_result_barrier.arrive();
       uint32_t tmem_base_ptr = shared_storage.tmem_base_ptr;
       collective_mainloop.set_tmem_offsets(tmem_storage, tmem_base_ptr);
@@ -738,11 +762,13 @@ public:
         auto k_tile_count = TileScheduler::get_work_k_tile_count(work_tile_info, problem_shape_MNKL, CtaShape_MNK{});
 
         // Fetch next work tile
+        uint64_t fetch_trace_start = pipeline_trace_timestamp();
         auto [next_work_tile_info, increment_pipe] = scheduler.fetch_next_work(
           work_tile_info,
           clc_pipeline,
           clc_pipe_consumer_state
         );
+        pipeline_trace_emit_region<NumThreadsPerWarp>(PipelineTraceEvent::kSchedulerFetch, fetch_trace_start);
 
         if (increment_pipe) {
           ++clc_pipe_consumer_state;
@@ -759,6 +785,7 @@ public:
         }();
 
         if (is_mma_leader_cta) {
+          uint64_t mma_trace_start = pipeline_trace_timestamp();
           mainloop_pipe_consumer_state = collective_mainloop.mma(
             cute::make_tuple(mainloop_pipeline, accumulator_pipeline),
             cute::make_tuple(mainloop_pipe_consumer_state, accumulator_pipe_producer_state),
@@ -768,6 +795,7 @@ public:
             k_tile_count
             );
           accumulator_pipeline.producer_commit(accumulator_pipe_producer_state);
+          pipeline_trace_emit_region<NumThreadsPerWarp>(PipelineTraceEvent::kMainloopMma, mma_trace_start);
         }
         ++accumulator_pipe_producer_state;
         work_tile_info = next_work_tile_info;
@@ -800,7 +828,7 @@ public:
       }
 
       // Free entire tmem allocation
-      tmem_allocator.free(tmem_base_ptr, TmemAllocator::Sm100TmemCapacityColumns);
+      tmem_allocator.free(tmem_base_ptr, TmemAllocationColumns);
     }
 
     else if (is_participant.epi_load) {
@@ -816,11 +844,13 @@ public:
         bool compute_epilogue = TileScheduler::compute_epilogue(work_tile_info, params.scheduler);
 
         // Get current work tile and fetch next work tile
+        uint64_t fetch_trace_start = pipeline_trace_timestamp();
         auto [next_work_tile_info, increment_pipe] = scheduler.fetch_next_work(
           work_tile_info,
           clc_pipeline,
           clc_pipe_consumer_state
         );
+        pipeline_trace_emit_region<NumThreadsPerWarp>(PipelineTraceEvent::kSchedulerFetch, fetch_trace_start);
         work_tile_info = next_work_tile_info;
 
         if (increment_pipe) {
@@ -874,11 +904,13 @@ public:
       bool do_tail_store = false;
       do {
         // Fetch next work tile
+        uint64_t fetch_trace_start = pipeline_trace_timestamp();
         auto [next_work_tile_info, increment_pipe] = scheduler.fetch_next_work(
           work_tile_info,
           clc_pipeline,
           clc_pipe_consumer_state
         );
+        pipeline_trace_emit_region<NumEpilogueThreads>(PipelineTraceEvent::kSchedulerFetch, fetch_trace_start);
 
         if (increment_pipe) {
           ++clc_pipe_consumer_state;
@@ -908,6 +940,7 @@ public:
         // Epilogue and write to gD
         //
         if (scheduler.compute_epilogue(work_tile_info)) {
+          uint64_t epi_trace_start = pipeline_trace_timestamp();
           auto [load_state_next, store_state_next, acc_state_next] = collective_epilogue.template store<IsOverlappingAccum>(
             epi_load_pipeline,
             epi_load_pipe_consumer_state,
@@ -923,6 +956,7 @@ public:
             accumulator,
             shared_storage.tensors.epilogue
           );
+          pipeline_trace_emit_region<NumEpilogueThreads>(PipelineTraceEvent::kEpilogue, epi_trace_start);
           epi_load_pipe_consumer_state = load_state_next;
           epi_store_pipe_producer_state = store_state_next;
           accumulator_pipe_consumer_state = acc_state_next;
@@ -946,10 +980,12 @@ public:
       // performed is in split-K if a cluster is only assigned non-final splits (for which
       // the cluster does not compute the epilogue).
       if (do_tail_store) {
+        uint64_t tail_trace_start = pipeline_trace_timestamp();
         collective_epilogue.store_tail(
           epi_load_pipeline, epi_load_pipe_consumer_state,
           epi_store_pipeline, epi_store_pipe_producer_state,
           CtaShape_MNK{});
+        pipeline_trace_emit_region<NumEpilogueThreads>(PipelineTraceEvent::kEpilogueTail, tail_trace_start);
       }
     }
 
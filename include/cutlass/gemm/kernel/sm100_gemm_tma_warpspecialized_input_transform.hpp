@@ -969,7 +969,14 @@ public:
       tmem_allocation_result_barrier.arrive_and_wait_unaligned();
 
       auto accum_inputs = [&]() {
+        if constexpr (InputTransformType == cutlass::gemm::detail::KernelInputTransformType::OzakiF64) {
+          // The recombination of the bands reads the exponents of the slices
+          return collective_mainloop.accum_init(bulk_tmem, typename CollectiveEpilogue::CopyOpT2R{}, typename CollectiveEpilogue::EpilogueTile{},
+                                                shared_storage.tensors.mainloop);
+        }
+        else {
           return collective_mainloop.accum_init(bulk_tmem, typename CollectiveEpilogue::CopyOpT2R{}, typename CollectiveEpilogue::EpilogueTile{});
+        }
       }();
       bool do_tail_store = false;
       do {
@@ -986,7 +993,8 @@ public:
 
         auto k_tile_count = TileScheduler::get_work_k_tile_count(work_tile_info, problem_shape_MNKL, CtaShape_MNK{});
 
-        if constexpr (InputTransformType == cutlass::gemm::detail::KernelInputTransformType::FastF32) {
+        if constexpr (InputTransformType == cutlass::gemm::detail::KernelInputTransformType::FastF32 ||
+                      InputTransformType == cutlass::gemm::detail::KernelInputTransformType::OzakiF64) {
           auto [mma2accum_pipeline_consumer_state_next,tTR_rGlobAcc] =
               collective_mainloop.accum(
                 accum_inputs,
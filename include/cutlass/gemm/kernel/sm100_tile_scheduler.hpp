@@ -120,6 +120,7 @@ public:
     auto cs = cutlass::detail::select_cluster_shape(ClusterShape_{}, hw_info.cluster_shape);
 
     dim3 problem_blocks = get_tiled_cta_shape_mnl(problem_shape_mnkl, tile_shape, cs);
+    uint64_t problem_k = static_cast<uint64_t>(cute::size(cute::get<2>(problem_shape_mnkl)));
 
     Params params;
     params.initialize(
@@ -127,7 +128,9 @@ public:
       to_gemm_coord(cs),
       hw_info,
       args.max_swizzle_size,
-      args.raster_order
+      args.raster_order,
+      Params::UnderlyingParams::get_operand_panel_bytes(cute::size<0>(tile_shape), problem_k),
+      Params::UnderlyingParams::get_operand_panel_bytes(cute::size<1>(tile_shape), problem_k)
     );
     return params;
   }
@@ -148,14 +151,18 @@ public:
 
     dim3 problem_blocks = get_tiled_cta_shape_mnl(problem_shape_mnkl, tile_shape_mnk,
                                                   atom_thr_shape_mnk, selected_cluster_shape);
+    uint64_t problem_k = static_cast<uint64_t>(cute::size(cute::get<2>(problem_shape_mnkl)));
 
+    // Operand panels are sized per CTA, which only holds its share of the MMA tile
     Params params;
     params.initialize(
       problem_blocks,
       to_gemm_coord(selected_cluster_shape),
       hw_info,
       args.max_swizzle_size,
-      args.raster_order
+      args.raster_order,
+      Params::UnderlyingParams::get_operand_panel_bytes(cute::size<0>(tile_shape_mnk) / cute::size<0>(atom_thr_shape_mnk), problem_k),
+      Params::UnderlyingParams::get_operand_panel_bytes(cute::size<1>(tile_shape_mnk) / cute::size<1>(atom_thr_shape_mnk), problem_k)
     );
     return params;
   }
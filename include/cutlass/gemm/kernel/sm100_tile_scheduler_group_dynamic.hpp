@@ -0,0 +1,483 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+
+#pragma once
+
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/fast_math.h"
+#include "cutlass/trace.h"
+#include "cutlass/pipeline/pipeline.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_group.hpp"
+#include "cutlass/gemm/kernel/sm100_tile_scheduler.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler_params.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::kernel::detail {
+
+//////////////////// Blackwell Grouped Dynamic Scheduler /////////////////////////
+
+// This tile scheduler hands out the output tiles of a grouped GEMM via Cluster Launch Control (CLC).
+//
+// When host-side problem shapes are available, the number of output tiles of every group is known
+// before launch. The grid is then launched with one cluster per output cluster tile, linearized
+// along grid.x across all groups. Clusters that become resident cancel the launch of pending ones
+// via CLC and compute their tiles instead, so that work is balanced across however many SMs the
+// kernel actually occupies. In particular, when launched into a green context or alongside other
+// kernels, only the SMs available to the GEMM pick up tiles, and no cluster waits for an SM that
+// is held by a co-scheduled kernel before the tail of the GEMM can drain.
+//
+// A cancelled cluster ID is mapped to a group and a tile within it exactly as the group scheduler
+// maps its linear index, including per-group swizzling and rasterization. The mapping is performed
+// independently by each consumer thread, walking the groups from the one of the previous tile.
+
+template<class GroupProblemShape, class ClusterShape_, uint32_t Stages_>
+class PersistentTileSchedulerSm100GroupDynamic {
+
+private:
+  using CLCScheduler = PersistentTileSchedulerSm100<ClusterShape_, Stages_>;
+  using GroupScheduler = PersistentTileSchedulerSm90Group<GroupProblemShape, Stages_>;
+
+public:
+  using ClusterShape = ClusterShape_;
+  using ProblemShape = typename GroupProblemShape::UnderlyingProblemShape;
+  using Params = PersistentTileSchedulerSm100GroupDynamicParams<GroupProblemShape>;
+  using UnderlyingParams = PersistentTileSchedulerSm90GroupParams<GroupProblemShape>;
+  using WorkTileInfo = typename GroupScheduler::WorkTileInfo;
+  using Arguments = typename GroupScheduler::Arguments;
+  using RasterOrder = typename UnderlyingParams::RasterOrder;
+  using RasterOrderOptions = typename UnderlyingParams::RasterOrderOptions;
+
+  static constexpr bool IsDynamicPersistent = true;
+  static constexpr uint32_t Stages = Stages_;
+
+  using CLCResponse = typename CLCScheduler::CLCResponse;
+  using Pipeline = typename CLCScheduler::Pipeline;
+
+  // Output cluster tiles of a group, in units of clusters
+  struct GroupInfo {
+    int32_t group_idx = 0;
+    uint64_t start_cluster_idx = 0;
+    uint64_t total_clusters = 0;
+    uint64_t clusters_along_raster_order = 0;
+    int32_t log_swizzle_size = 0;
+  };
+
+  //
+  // Static Host Methods
+  //
+
+  template <class TileShape, class AtomThrShape, class ClusterShape>
+  static Params
+  to_underlying_arguments(
+    GroupProblemShape problem_shapes,
+    TileShape tile_shape_mnk,
+    AtomThrShape atom_thr_shape_mnk,
+    ClusterShape cluster_shape_mnk,
+    KernelHardwareInfo const& hw_info,
+    Arguments const& args,
+    [[maybe_unused]] void* workspace = nullptr) {
+
+    static_assert(cute::is_static<TileShape>::value);
+
+    auto selected_cluster_shape = cutlass::detail::select_cluster_shape(cluster_shape_mnk, hw_info.cluster_shape);
+    auto cta_shape = shape_div(tile_shape_mnk, atom_thr_shape_mnk); // For 2SM kernels, use CTA tile shape
+
+    dim3 problem_blocks = GroupScheduler::get_tiled_cta_shape_mnl(
+      problem_shapes,
+      hw_info,
+      cta_shape, selected_cluster_shape);
+
+    Params params;
+    params.initialize(
+      problem_blocks,
+      problem_shapes,
+      to_gemm_coord(cta_shape),
+      to_gemm_coord(selected_cluster_shape),
+      hw_info,
+      args.max_swizzle_size,
+      args.raster_order
+    );
+    params.divmod_cluster_shape_m_ = FastDivmod(params.cluster_shape_.m());
+
+    if (problem_shapes.is_host_problem_shape_available()) {
+      for (int32_t group = 0; group < problem_shapes.groups(); ++group) {
+        params.problem_clusters_ += get_group_info(group, problem_shapes.get_host_problem_shape(group), params).total_clusters;
+      }
+    }
+    else {
+      CUTLASS_TRACE_HOST("  to_underlying_arguments(): Dynamic group scheduler requires host problem shapes.\n");
+    }
+
+    return params;
+  }
+
+  static bool
+  can_implement(Arguments const& args, KernelHardwareInfo const&) {
+    return true;
+  }
+
+  static bool
+  can_implement(GroupProblemShape const& problem_shapes) {
+    if (!problem_shapes.is_host_problem_shape_available()) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Dynamic group scheduler requires host problem shapes to size the launch grid.\n");
+      return false;
+    }
+    return true;
+  }
+
+  // Given the inputs, computes the physical grid we should launch: one cluster per output cluster tile.
+  template<class BlockShape, class AtomThrShape, class ClusterShape>
+  CUTLASS_HOST_DEVICE
+  static dim3
+  get_grid_shape(
+      Params const& params,
+      [[maybe_unused]] GroupProblemShape const& problem_shapes,
+      [[maybe_unused]] BlockShape cta_shape,
+      [[maybe_unused]] AtomThrShape atom_thr_shape,
+      ClusterShape cluster_shape,
+      [[maybe_unused]] KernelHardwareInfo hw_info) {
+    auto cluster_shape_mnk = to_gemm_coord(cluster_shape);
+    return dim3(static_cast<uint32_t>(params.problem_clusters_) * cluster_shape_mnk.m(), cluster_shape_mnk.n(), 1);
+  }
+
+  // Returns the output cluster tiles of a group as the group scheduler tiles it
+  CUTLASS_HOST_DEVICE
+  static GroupInfo
+  get_group_info(int32_t group_idx, ProblemShape problem_shape, UnderlyingParams const& params) {
+    GroupInfo group_info;
+    group_info.group_idx = group_idx;
+
+    int64_t ctas_along_m = cute::size(cute::ceil_div(cute::shape<0>(problem_shape), params.cta_shape_.m()));
+    int64_t ctas_along_n = cute::size(cute::ceil_div(cute::shape<1>(problem_shape), params.cta_shape_.n()));
+    ctas_along_m = ctas_along_m > 0 ? ctas_along_m : 1;
+    ctas_along_n = ctas_along_n > 0 ? ctas_along_n : 1;
+    group_info.log_swizzle_size = get_log_swizzle_size(ctas_along_m, ctas_along_n, params.max_swizzle_size_);
+
+    uint64_t swizzle_size = uint64_t(1) << group_info.log_swizzle_size;
+    uint64_t clusters_along_m = round_up(uint64_t(ceil_div(ctas_along_m, int64_t(params.cluster_shape_.m()))), swizzle_size);
+    uint64_t clusters_along_n = round_up(uint64_t(ceil_div(ctas_along_n, int64_t(params.cluster_shape_.n()))), swizzle_size);
+    group_info.total_clusters = clusters_along_m * clusters_along_n;
+    group_info.clusters_along_raster_order =
+      params.raster_order_ == RasterOrder::AlongN ? clusters_along_n : clusters_along_m;
+    return group_info;
+  }
+
+  // Calculate the log of the swizzle size based on the problem CTAs and the max swizzle size
+  CUTLASS_HOST_DEVICE
+  static int32_t
+  get_log_swizzle_size(int64_t problem_ctas_m, int64_t problem_ctas_n, int max_swizzle_size) {
+    int64_t min_cta_dim = problem_ctas_m < problem_ctas_n ? problem_ctas_m : problem_ctas_n;
+    if (max_swizzle_size >= 8 && min_cta_dim >= 6) {
+      return 3;
+    }
+    else if (max_swizzle_size >= 4 && min_cta_dim >= 3) {
+      return 2;
+    }
+    else if (max_swizzle_size >= 2 && min_cta_dim >= 2) {
+      return 1;
+    }
+    else {
+      return 0;
+    }
+  }
+
+  //
+  // Constructors
+  //
+
+  // Note: constructing this tile scheduler can touch global memory that was
+  // written to by the prior kernel.
+  CUTLASS_DEVICE
+  PersistentTileSchedulerSm100GroupDynamic(CLCResponse* clc_response_ptr, Params const& params, dim3 block_id_in_cluster)
+    : clc_response_ptr_(clc_response_ptr),
+      params_(params),
+      block_id_in_cluster_(block_id_in_cluster),
+      groups_(params.problem_shapes_.groups()) {
+    if (groups_ > 0) {
+      current_group_info_ = get_group_info(0, params_.problem_shapes_.get_problem_shape(0), params_);
+    }
+  }
+
+  //
+  // Work Tile API
+  //
+
+  // Returns the initial work tile info that will be computed over
+  template <class ClusterShape>
+  CUTLASS_DEVICE
+  WorkTileInfo
+  initial_work_tile_info(ClusterShape) {
+    return get_work_for_cta(blockIdx.x, blockIdx.y, /*valid=*/true);
+  }
+
+  CUTLASS_DEVICE
+  static auto
+  work_tile_to_cta_coord(WorkTileInfo work_tile_info) {
+    return make_coord(
+      work_tile_info.M_idx,
+      work_tile_info.N_idx,
+      _,
+      work_tile_info.L_idx
+    );
+  }
+
+  CUTLASS_DEVICE
+  PipelineState<Stages>
+  advance_to_next_work(Pipeline& clc_pipeline, PipelineState<Stages> clc_pipe_producer_state) const {
+    uint32_t mbarrier_addr = clc_pipeline.producer_get_barrier(clc_pipe_producer_state);
+    // Wait for clcID buffer to become empty with a flipped phase
+    clc_pipeline.producer_acquire(clc_pipe_producer_state);
+
+    if (cute::elect_one_sync()) {
+      CLCScheduler::issue_clc_query(clc_pipe_producer_state, mbarrier_addr, clc_response_ptr_);
+    }
+
+    ++clc_pipe_producer_state;
+    return clc_pipe_producer_state;
+  }
+
+  // Kernel helper function to get next work tile
+  template <class TileSchedulerPipeline, class TileSchedulerPipelineState>
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(
+    WorkTileInfo,
+    TileSchedulerPipeline& scheduler_pipeline,
+    TileSchedulerPipelineState scheduler_pipe_consumer_state) {
+
+    scheduler_pipeline.consumer_wait(scheduler_pipe_consumer_state);
+    uint32_t smem_addr = cute::cast_smem_ptr_to_uint(&clc_response_ptr_[scheduler_pipe_consumer_state.index()]);
+    auto clc_work_tile = CLCScheduler::work_tile_info_from_clc_response(smem_addr);
+    scheduler_pipeline.consumer_release(scheduler_pipe_consumer_state);
+
+    // The response holds the ID of the first CTA of the cancelled cluster
+    auto work_tile = get_work_for_cta(
+      static_cast<uint32_t>(clc_work_tile.M_idx) + block_id_in_cluster_.x,
+      static_cast<uint32_t>(clc_work_tile.N_idx) + block_id_in_cluster_.y,
+      clc_work_tile.is_valid());
+
+    // Return true to indicate that the tile scheduler pipeline state should be advanced
+    return cute::make_tuple(work_tile, true);
+  }
+
+  //
+  // K Tile API
+  //
+  template <class ProblemShapeMNKL, class TileShape, class Shape>
+  CUTLASS_DEVICE
+  auto
+  get_k_tile_iterator(WorkTileInfo const& work_tile_info, ProblemShapeMNKL problem_shape_MNKL, TileShape tile_shape, Shape) {
+    auto k_tiles = cute::ceil_div(cute::get<2>(problem_shape_MNKL), cute::get<2>(tile_shape));
+    return cute::make_coord_iterator(k_tiles);
+  }
+
+  template <class ProblemShapeMNKL, class TileShape>
+  CUTLASS_HOST_DEVICE
+  static int
+  get_work_k_tile_count(WorkTileInfo const& work_tile_info, ProblemShapeMNKL problem_shape_MNKL, TileShape tile_shape) {
+    // All work units returned by this scheduler cover the entire K iteration
+    // space of the output tile assigned to the work unit.
+    return cute::size(cute::ceil_div(cute::get<2>(problem_shape_MNKL), cute::get<2>(tile_shape)));
+  }
+
+  CUTLASS_HOST_DEVICE
+  static uint32_t
+  get_work_k_tile_start(WorkTileInfo const&) {
+    // All work units returned by this scheduler start from K tile 0
+    return 0u;
+  }
+
+  // Returns whether the block assigned this work should compute the epilogue for the corresponding
+  // output tile. For the dynamic group tile scheduler, this is always true.
+  CUTLASS_HOST_DEVICE
+  static bool
+  compute_epilogue(WorkTileInfo const&, Params const&) {
+    return true;
+  }
+
+  CUTLASS_HOST_DEVICE
+  static bool
+  compute_epilogue(WorkTileInfo const&) {
+    return true;
+  }
+
+  // Returns whether fixup is needed for `work_tile_info`. None of the work units returned by
+  // this scheduler require fixup, since none of the work units partition the reduction extent.
+  CUTLASS_HOST_DEVICE
+  static bool
+  requires_fixup(Params const& params, WorkTileInfo const work_tile_info) {
+    return false;
+  }
+
+  // Performs the reduction across splits for a given output tile. No fixup is required for
+  // work units returned by this scheduler.
+  template <class FrgTensorC>
+  CUTLASS_DEVICE
+  void
+  fixup(WorkTileInfo const&, FrgTensorC&, uint32_t, uint32_t, uint32_t = 1) const { }
+
+  template <
+    bool IsComplex,
+    class TiledMma,
+    class AccEngine,
+    class AccLayout,
+    class AccumulatorPipeline,
+    class AccumulatorPipelineState,
+    class CopyOpT2R
+  >
+  CUTLASS_DEVICE
+  AccumulatorPipelineState
+  fixup(
+      TiledMma const& ,
+      WorkTileInfo const&,
+      cute::Tensor<AccEngine, AccLayout>&,
+      AccumulatorPipeline,
+      AccumulatorPipelineState acc_pipe_consumer_state,
+      CopyOpT2R) const {
+    return acc_pipe_consumer_state;
+  }
+
+  CUTLASS_DEVICE
+  static bool
+  valid_warpgroup_in_work_tile(WorkTileInfo const& work_tile_info) {
+    return true;
+  }
+
+  CUTLASS_DEVICE
+  static bool
+  requires_separate_reduction(Params const& params) {
+    return false;
+  }
+
+  // The dynamic group tile scheduler does not require any additional workspace
+  template <class ProblemShape, class ElementAccumulator>
+  static size_t
+  get_workspace_size(Arguments const& args, ProblemShape problem_shape, KernelHardwareInfo const& hw_info, uint32_t, uint32_t = 1, uint32_t = 1) {
+    return 0;
+  }
+
+  template <class ElementAccumulator, class ProblemShape, class TileShapeMNK, class AtomThrShape, class ClusterShape>
+  static size_t
+  get_workspace_size(Arguments const& args, ProblemShape problem_shape, TileShapeMNK, AtomThrShape, ClusterShape, KernelHardwareInfo const& hw_info,
+      uint32_t reduction_warp_groups, uint32_t num_accumulator_mtxs = 1) {
+    return 0;
+  }
+
+  template <class ProblemShape, class ElementAccumulator>
+  static cutlass::Status
+  initialize_workspace(Arguments const&, void*, cudaStream_t, ProblemShape const&, KernelHardwareInfo const&, uint32_t, uint32_t = 1, uint32_t = 1, CudaHostAdapter *cuda_adapter = nullptr) {
+    return cutlass::Status::kSuccess;
+  }
+
+  template <class ElementAccumulator, class ProblemShape, class TileShapeMNK, class AtomThrShape, class ClusterShape>
+  static cutlass::Status
+  initialize_workspace(Arguments const&, void*, cudaStream_t, ProblemShape const&, TileShapeMNK, AtomThrShape, ClusterShape, KernelHardwareInfo const&,
+      uint32_t, uint32_t = 1, CudaHostAdapter *cuda_adapter = nullptr) {
+    return cutlass::Status::kSuccess;
+  }
+
+private:
+  //
+  // Methods
+  //
+
+  // Maps the CTA at (cta_x, cta_y) of the launch grid to its output tile. grid.x enumerates
+  // the CTAs of all output cluster tiles along M, and grid.y the CTAs of a cluster along N.
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_work_for_cta(uint32_t cta_x, uint32_t cta_y, bool valid) {
+    if (!valid || groups_ <= 0) {
+      return WorkTileInfo::invalid_work_tile();
+    }
+
+    int cluster_idx_in_grid, cluster_offset_m;
+    params_.divmod_cluster_shape_m_(cluster_idx_in_grid, cluster_offset_m, static_cast<int>(cta_x));
+    int cluster_offset_n = static_cast<int>(cta_y);
+    uint64_t cluster_idx = static_cast<uint64_t>(cluster_idx_in_grid);
+
+    // Cancelled cluster IDs increase for a given cluster in practice, so the search resumes from
+    // the group of the previous tile. Restart from the first group otherwise.
+    auto& group_info = current_group_info_;
+    if (cluster_idx < group_info.start_cluster_idx) {
+      group_info = get_group_info(0, params_.problem_shapes_.get_problem_shape(0), params_);
+    }
+    while (cluster_idx >= group_info.start_cluster_idx + group_info.total_clusters) {
+      int32_t next_group_idx = group_info.group_idx + 1;
+      if (next_group_idx >= groups_) {
+        return WorkTileInfo::invalid_work_tile();
+      }
+      uint64_t next_start_cluster_idx = group_info.start_cluster_idx + group_info.total_clusters;
+      group_info = get_group_info(next_group_idx, params_.problem_shapes_.get_problem_shape(next_group_idx), params_);
+      group_info.start_cluster_idx = next_start_cluster_idx;
+    }
+
+    // Swizzle and rasterize the cluster tile within its group as the group scheduler does
+    uint64_t cluster_id = cluster_idx - group_info.start_cluster_idx;
+    uint64_t offset = cluster_id & ((uint64_t(1) << group_info.log_swizzle_size) - 1);
+    uint64_t extra = cluster_id >> group_info.log_swizzle_size;
+
+    uint64_t cluster_idx_minor_div_swizzle = extra / group_info.clusters_along_raster_order;
+    uint64_t cluster_idx_major = extra % group_info.clusters_along_raster_order;
+    uint64_t cluster_idx_minor = (cluster_idx_minor_div_swizzle << group_info.log_swizzle_size) + offset;
+
+    uint64_t cluster_idx_m, cluster_idx_n;
+    if (params_.raster_order_ == RasterOrder::AlongN) {
+      cluster_idx_m = cluster_idx_minor;
+      cluster_idx_n = cluster_idx_major;
+    }
+    else {
+      cluster_idx_m = cluster_idx_major;
+      cluster_idx_n = cluster_idx_minor;
+    }
+
+    return {
+      static_cast<int32_t>(cluster_idx_m * params_.cluster_shape_.m() + cluster_offset_m),
+      static_cast<int32_t>(cluster_idx_n * params_.cluster_shape_.n() + cluster_offset_n),
+      group_info.group_idx,
+      1
+    };
+  }
+
+  //
+  // Data Members
+  //
+  CLCResponse *clc_response_ptr_ = nullptr;
+  Params const& params_;
+  dim3 block_id_in_cluster_ = {0, 0, 0};
+  int32_t groups_ = 0;
+  GroupInfo current_group_info_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+} // end namespace cutlass::gemm::kernel::detail
@@ -0,0 +1,218 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+
+#pragma once
+
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/fast_math.h"
+#include "cutlass/trace.h"
+#include "cutlass/barrier.h"
+#include "cutlass/arch/barrier.h"
+#include "cutlass/gemm/kernel/sm100_tile_scheduler_group.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler_params.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::kernel::detail {
+
+//////////////////// Blackwell Grouped Expert Arrival Scheduler /////////////////////////
+
+// Static group scheduler for grouped GEMMs whose A operands are filled in by other devices while
+// the GEMM runs, as for the expert GEMMs of an expert-parallel mixture of experts: every device
+// pushes the rows of its tokens routed to an expert into the A buffer of the expert on the device
+// that owns it (see cutlass/experimental/distributed/kernel/ep_dispatch_combine.hpp).
+//
+// Output tiles are mapped exactly as by PersistentTileSchedulerSm100Group. The rows of A of each
+// group are counted as they arrive in ptr_arrival_counters, one counter per arrival_tile_m rows and
+// max_arrival_tiles counters per group, and the mainloop producer of a tile waits until all rows of A
+// the tile reads have arrived before loading them. Tiles of an expert therefore start as soon as its
+// tokens are in, overlapping the dispatch with the GEMMs of the experts whose tokens arrived first.
+//
+// The counters are raised at system scope by the senders, in this device's memory, and must be zero
+// before the first sender starts. Since tiles wait on work outside of the grid, the senders must make
+// progress while the GEMM occupies its SMs, e.g. by launching the GEMM on fewer SMs than the device
+// has (KernelHardwareInfo::sm_count) and leaving the rest to the dispatch.
+template<class GroupProblemShape, int SchedulerPipelineStageCount>
+class PersistentTileSchedulerSm100GroupExpertArrival
+  : public PersistentTileSchedulerSm100Group<GroupProblemShape, SchedulerPipelineStageCount> {
+
+  using BaseScheduler = PersistentTileSchedulerSm100Group<GroupProblemShape, SchedulerPipelineStageCount>;
+
+public:
+  using UnderlyingScheduler = typename BaseScheduler::UnderlyingScheduler;
+  using UnderlyingParams = typename BaseScheduler::Params;
+  using Params = PersistentTileSchedulerSm100GroupExpertArrivalParams<GroupProblemShape>;
+  using WorkTileInfo = typename BaseScheduler::WorkTileInfo;
+  using RasterOrder = typename BaseScheduler::RasterOrder;
+  using RasterOrderOptions = typename BaseScheduler::RasterOrderOptions;
+  using CLCResponse = typename BaseScheduler::CLCResponse;
+
+  using CounterType = int32_t;
+
+  // Rows arrive over NVLink at a much lower rate than a poll of the counters, so back off between polls
+  using CounterWait = cutlass::detail::BackoffWait<64, 1024>;
+
+  struct Arguments : BaseScheduler::Arguments {
+    // (groups, max_arrival_tiles) rows of A that have arrived, per arrival_tile_m rows of each group.
+    // Without it, no tile waits and the scheduler behaves as the group scheduler.
+    CounterType const* ptr_arrival_counters = nullptr;
+    // Upper bound on ceil_div(M, arrival_tile_m) of any group, the stride between the counters of groups
+    int32_t max_arrival_tiles = 0;
+    // Rows of A covered by each counter; need not match the CTA tile
+    int32_t arrival_tile_m = 0;
+  };
+
+  //
+  // Static Host Methods
+  //
+
+  template <class TileShape, class AtomThrShape, class ClusterShape>
+  static Params
+  to_underlying_arguments(
+    GroupProblemShape problem_shapes,
+    TileShape tile_shape_mnk,
+    AtomThrShape atom_thr_shape_mnk,
+    ClusterShape cluster_shape_mnk,
+    KernelHardwareInfo const& hw_info,
+    Arguments const& args,
+    void* workspace = nullptr) {
+
+    Params params;
+    static_cast<UnderlyingParams&>(params) = BaseScheduler::to_underlying_arguments(
+      problem_shapes, tile_shape_mnk, atom_thr_shape_mnk, cluster_shape_mnk, hw_info, args, workspace);
+
+    if (args.ptr_arrival_counters == nullptr) {
+      return params;
+    }
+
+    if (problem_shapes.is_host_problem_shape_available()) {
+      for (int32_t group_idx = 0; group_idx < problem_shapes.groups(); ++group_idx) {
+        auto problem_shape = problem_shapes.get_host_problem_shape(group_idx);
+        int arrival_tiles = ceil_div(static_cast<int>(cute::size<0>(problem_shape)), args.arrival_tile_m);
+        if (arrival_tiles > args.max_arrival_tiles) {
+          CUTLASS_TRACE_HOST("to_underlying_arguments(): " << arrival_tiles << " arrival tiles of group " << group_idx
+            << " exceed max_arrival_tiles " << args.max_arrival_tiles);
+        }
+      }
+    }
+
+    params.arrival_counters_ = args.ptr_arrival_counters;
+    params.max_arrival_tiles_ = args.max_arrival_tiles;
+    params.arrival_tile_m_ = args.arrival_tile_m;
+    return params;
+  }
+
+  static bool
+  can_implement(Arguments const& args, KernelHardwareInfo const& hw_info) {
+    if (args.ptr_arrival_counters != nullptr && (args.max_arrival_tiles <= 0 || args.arrival_tile_m <= 0)) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Expert arrival group scheduler requires max_arrival_tiles and arrival_tile_m.\n");
+      return false;
+    }
+    return BaseScheduler::can_implement(args, hw_info);
+  }
+
+  //
+  // Device Methods
+  //
+
+  CUTLASS_DEVICE
+  PersistentTileSchedulerSm100GroupExpertArrival() { }
+
+  CUTLASS_DEVICE
+  PersistentTileSchedulerSm100GroupExpertArrival(CLCResponse* clc_response_ptr, Params const& params)
+    : BaseScheduler(clc_response_ptr, params),
+      problem_shapes_(params.params_sm90_.problem_shapes_),
+      cta_tile_m_(static_cast<int32_t>(params.params_sm90_.cta_shape_.m())),
+      arrival_counters_(params.arrival_counters_),
+      max_arrival_tiles_(params.max_arrival_tiles_),
+      arrival_tile_m_(params.arrival_tile_m_) { }
+
+  CUTLASS_DEVICE
+  PersistentTileSchedulerSm100GroupExpertArrival(CLCResponse* clc_response_ptr, Params const& params, dim3 /* block_id_in_cluster */)
+    : PersistentTileSchedulerSm100GroupExpertArrival(clc_response_ptr, params) { }
+
+  // Waits until all rows of A read by a work tile have arrived. Called by all threads of the mainloop
+  // producer warp before the loads of the tile are issued.
+  CUTLASS_DEVICE
+  void
+  wait_for_input_tiles(WorkTileInfo const& work_tile_info) const {
+    if (arrival_counters_ == nullptr) {
+      return;
+    }
+
+    int32_t group_idx = work_tile_info.L_idx;
+    int32_t problem_m = static_cast<int32_t>(cute::size<0>(problem_shapes_.get_problem_shape(group_idx)));
+    int32_t row_begin = work_tile_info.M_idx * cta_tile_m_;
+    int32_t row_end = cute::min(problem_m, row_begin + cta_tile_m_);
+    if (row_begin >= row_end) {
+      return;
+    }
+
+    if (canonical_lane_idx() == 0) {
+      CounterType const* group_counters = arrival_counters_ + group_idx * max_arrival_tiles_;
+      CUTLASS_PRAGMA_NO_UNROLL
+      for (int32_t tile_idx = row_begin / arrival_tile_m_; tile_idx * arrival_tile_m_ < row_end; ++tile_idx) {
+        CounterType expected = cute::min(arrival_tile_m_, problem_m - tile_idx * arrival_tile_m_);
+        CounterWait wait;
+        while (ld_acquire_sys(group_counters + tile_idx) < expected) {
+          wait.backoff();
+        }
+      }
+    }
+    __syncwarp();
+
+    // Order the TMA loads of A after the acquire of the counters
+    cutlass::arch::fence_view_async_global();
+  }
+
+private:
+  // Load of a counter raised by other devices, as a strong acquire at system scope
+  CUTLASS_DEVICE
+  static CounterType
+  ld_acquire_sys(CounterType const* ptr) {
+    CounterType state = 0;
+#if defined(__CUDA_ARCH__)
+    asm volatile ("ld.acquire.sys.global.b32 %0, [%1];\n" : "=r"(state) : "l"(ptr) : "memory");
+#endif
+    return state;
+  }
+
+  GroupProblemShape problem_shapes_{};
+  int32_t cta_tile_m_ = 0;
+  CounterType const* arrival_counters_ = nullptr;
+  int32_t max_arrival_tiles_ = 0;
+  int32_t arrival_tile_m_ = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+} // end namespace cutlass::gemm::kernel::detail
@@ -225,6 +225,10 @@ public:
       CUTLASS_TRACE_HOST(" CAN IMPLEMENT: Stream-K scheduler requires cluster shape and fallback cluster shape to be the same.\n");
       return false;
     }
+    if (args.reduction_mode == UnderlyingStreamKScheduler::ReductionMode::Separate) {
+      CUTLASS_TRACE_HOST(" CAN IMPLEMENT: SM100 stream-K scheduler does not support separate reduction.\n");
+      return false;
+    }
     return UnderlyingStreamKScheduler::can_implement(args, hw_info);
   }
 
@@ -489,6 +493,10 @@ public:
     CudaHostAdapter *cuda_adapter = nullptr,
     uint32_t ktile_start_alignment_count = 1) {
 
+    if (args.reuse_workspace) {
+      return Status::kSuccess;
+    }
+
     auto problem_shape_mnkl = cute::append<4>(problem_shape, 1);
 
     auto cs = cutlass::detail::select_cluster_shape(ClusterShape{}, hw_info.cluster_shape);
@@ -536,6 +544,10 @@ public:
       CudaHostAdapter *cuda_adapter = nullptr,
       uint32_t ktile_start_alignment_count = 1) {
 
+    if (args.reuse_workspace) {
+      return Status::kSuccess;
+    }
+
     auto problem_shape_mnkl = cute::append<4>(problem_shape, 1);
 
     auto cs = cutlass::detail::select_cluster_shape(cluster_shape_mnk, hw_info.cluster_shape);
@@ -612,7 +624,7 @@ public:
     uint32_t barrier_idx,
     uint32_t num_accumulator_mtxs = 1) const {
 
-    using BarrierManager = SyncManager<cutlass::detail::SyncwarpSync, NumThreadsPerWarp>;
+    using BarrierManager = SyncManager<cutlass::detail::SyncwarpSync, NumThreadsPerWarp, typename UnderlyingStreamKScheduler::FixupBarrierWait>;
 
     UnderlyingStreamKScheduler s;
     return s.template fixup_helper<FrgTensorC, BarrierManager>(
@@ -717,7 +729,7 @@ public:
         constexpr uint32_t Offset = static_cast<int>(cutlass::arch::ReservedNamedBarriers::StreamkBarrier0);
         constexpr uint32_t MaxNumNamedBarriers = 1;
         constexpr uint32_t BarrierIdx = 0;
-        using BarrierManager = NamedBarrierManager<ThreadsForFixup, Offset, MaxNumNamedBarriers>;
+        using BarrierManager = NamedBarrierManager<ThreadsForFixup, Offset, MaxNumNamedBarriers, typename UnderlyingStreamKScheduler::FixupBarrierWait>;
         constexpr int NumAccumulatorMtx = IsComplex ? 2 : 1;
 
         UnderlyingStreamKScheduler::template fixup_helper<cute::remove_cvref_t<decltype(accumulators)>, BarrierManager>(
@@ -946,7 +958,7 @@ private:
     constexpr uint32_t Offset = static_cast<int>(cutlass::arch::ReservedNamedBarriers::StreamkBarrier0);
     constexpr uint32_t MaxNumNamedBarriers = 1;
     constexpr uint32_t BarrierIdx = 0;
-    using BarrierManager = NamedBarrierManager<ThreadsForFixup, Offset, MaxNumNamedBarriers>;
+    using BarrierManager = NamedBarrierManager<ThreadsForFixup, Offset, MaxNumNamedBarriers, typename UnderlyingStreamKScheduler::FixupBarrierWait>;
 
     // When accumulators reside in TMEM, perform TMEM -> RF loads before performing fixup,
     // and perform RF -> TMEM stores after fixup (when the split must compute the epilogue)
@@ -154,6 +154,9 @@ public:
     cute::conditional_t<cute::is_same_v<SchedulerTag, void>, void, ProblemShape> // Use void for default scheduler.
   >::Scheduler;
 
+  // Tiles of a group wait for the output tiles of the earlier group they read
+  static constexpr bool IsDependentGroupScheduler = cute::is_same_v<SchedulerTag, DependentGroupScheduler>;
+
   using TileSchedulerArguments = typename TileScheduler::Arguments;
   using TileSchedulerParams = typename TileScheduler::Params;
   using TileSchedulerResponse = typename TileSchedulerResponseGetter<TileScheduler>::Type;
@@ -167,6 +170,7 @@ public:
   static constexpr uint32_t MinBlocksPerMultiprocessor = 1;
   static constexpr uint32_t NumProducerThreads = CollectiveMainloop::NumProducerThreadEvents;
   static constexpr bool     IsMainloopAuxiliaryLoadNeeded = detail::HasAuxiliaryLoad_v<typename CollectiveMainloop::DispatchPolicy>;
+  static constexpr bool     IsPrebuiltTensorMapSupported = detail::Has_PrebuiltTensorMaps_v<CollectiveMainloop>;
 
   /// Register requirement for Load and Math WGs
   static constexpr int RegsPerThread =
@@ -649,21 +653,38 @@ public:
         int32_t const sm_idx = blockIdx.x + (blockIdx.y * gridDim.x);
         int32_t const sm_count = params.hw_info.sm_count;
 
+        // Tensormaps of all groups are built in gmem before the kernel, rather than updated per group
+        bool const use_prebuilt_tensormaps = [&] () {
+          if constexpr (IsPrebuiltTensorMapSupported) {
+            return params.mainloop.prebuilt_tensormaps;
+          }
+          else {
+            return false;
+          }
+        } ();
+
         // Fetch a copy of tensormaps for the CTA
         auto input_tensormaps = collective_mainloop.tensormaps_init(params.mainloop, shared_storage.tensormaps.mainloop, sm_count, sm_idx);
 
-        // Update tensormap for the initial batch for the CTA
-        collective_mainloop.tensormaps_perform_update(
-          shared_storage.tensormaps.mainloop,
-          params.mainloop,
-          input_tensormaps,
-          problem_shape_MNKL,
-          curr_batch
-        );
-        // Ensure warp is converged before issuing tensormap fence release
-        __syncwarp();
-        // Entire warp must do this (i.e. it's aligned)
-        collective_mainloop.tensormaps_cp_fence_release(shared_storage.tensormaps.mainloop, input_tensormaps);
+        if (use_prebuilt_tensormaps) {
+          if constexpr (IsPrebuiltTensorMapSupported) {
+            input_tensormaps = collective_mainloop.tensormaps_prebuilt(params.mainloop, curr_batch);
+          }
+        }
+        else {
+          // Update tensormap for the initial batch for the CTA
+          collective_mainloop.tensormaps_perform_update(
+            shared_storage.tensormaps.mainloop,
+            params.mainloop,
+            input_tensormaps,
+            problem_shape_MNKL,
+            curr_batch
+          );
+          // Ensure warp is converged before issuing tensormap fence release
+          __syncwarp();
+          // Entire warp must do this (i.e. it's aligned)
+          collective_mainloop.tensormaps_cp_fence_release(shared_storage.tensormaps.mainloop, input_tensormaps);
+        }
 
         bool do_load_order_arrive = true;
         bool did_batch_change = true;
@@ -690,7 +711,13 @@ public:
 
           if (did_batch_change) {
             load_inputs = collective_mainloop.tensors_perform_update(load_inputs, params.mainloop, problem_shape_MNKL, curr_batch);
-            collective_mainloop.tensormaps_fence_acquire(input_tensormaps);
+            if (not use_prebuilt_tensormaps) {
+              collective_mainloop.tensormaps_fence_acquire(input_tensormaps);
+            }
+          }
+
+          if constexpr (IsDependentGroupScheduler) {
+            scheduler.wait_for_input_tiles(work_tile_info);
           }
 
           collective_mainloop.load(
@@ -730,17 +757,24 @@ public:
               gA_mkl = get<0>(load_inputs);
               gB_nkl = get<1>(load_inputs);
             }
-            collective_mainloop.tensormaps_perform_update(
-              shared_storage.tensormaps.mainloop,
-              params.mainloop,
-              input_tensormaps,
-              problem_shape_MNKL,
-              curr_batch
-            );
-            // Ensure warp is converged before issuing tensor replace
-            __syncwarp();
-            // Entire warp must do this (i.e. it's aligned)
-            collective_mainloop.tensormaps_cp_fence_release(shared_storage.tensormaps.mainloop, input_tensormaps);
+            if (use_prebuilt_tensormaps) {
+              if constexpr (IsPrebuiltTensorMapSupported) {
+                input_tensormaps = collective_mainloop.tensormaps_prebuilt(params.mainloop, curr_batch);
+              }
+            }
+            else {
+              collective_mainloop.tensormaps_perform_update(
+                shared_storage.tensormaps.mainloop,
+                params.mainloop,
+                input_tensormaps,
+                problem_shape_MNKL,
+                curr_batch
+              );
+              // Ensure warp is converged before issuing tensor replace
+              __syncwarp();
+              // Entire warp must do this (i.e. it's aligned)
+              collective_mainloop.tensormaps_cp_fence_release(shared_storage.tensormaps.mainloop, input_tensormaps);
+            }
           }
         } while (work_tile_info.is_valid()); // Scheduler work fetch loop
 
@@ -1038,6 +1072,10 @@ public:
           epi_load_pipe_consumer_state = epi_load_pipe_consumer_state_next;
           epi_store_pipe_producer_state = epi_store_pipe_producer_state_next;
           do_store_tail = true;
+
+          if constexpr (IsDependentGroupScheduler) {
+            scheduler.template arrive_output_tile<NumMmaThreads>(work_tile_info, mma_thread_idx);
+          }
         }
 
         // Get next work tile
@@ -134,6 +134,10 @@ public:
       and cute::is_base_of_v<GroupScheduler, TileScheduler_>
     ),
     "Ptr-Array Pingpong and Grouped Gemm Pingpong kernel only supports group-compatible schedulers (TileScheduler_ must derive from GroupScheduler).");
+  static_assert(not cute::is_same_v<TileScheduler_, GroupStreamKScheduler>,
+    "Grouped Gemm Pingpong kernel does not support GroupStreamKScheduler, whose fixup assumes the consumer warp groups cooperate on each output tile.");
+  static_assert(not cute::is_same_v<TileScheduler_, DependentGroupScheduler>,
+    "Grouped Gemm Pingpong kernel does not support DependentGroupScheduler, which publishes each output tile once both consumer warp groups have stored it.");
 
   using SchedulerTag = cute::conditional_t<
     cute::is_void_v<TileScheduler_>,
@@ -166,6 +170,7 @@ public:
   static constexpr uint32_t MinBlocksPerMultiprocessor = 1;
   static constexpr uint32_t NumProducerThreads = CollectiveMainloop::NumProducerThreadEvents;
   static constexpr bool     IsMainloopAuxiliaryLoadNeeded = detail::HasAuxiliaryLoad_v<typename CollectiveMainloop::DispatchPolicy>;
+  static constexpr bool     IsPrebuiltTensorMapSupported = detail::Has_PrebuiltTensorMaps_v<CollectiveMainloop>;
 
   /// Register requirement for Load and Math WGs
   static constexpr int RegsPerThread =
@@ -687,21 +692,38 @@ public:
         int32_t const sm_idx = blockIdx.x + (blockIdx.y * gridDim.x);
         int32_t const sm_count = params.hw_info.sm_count;
 
+        // Tensormaps of all groups are built in gmem before the kernel, rather than updated per group
+        bool const use_prebuilt_tensormaps = [&] () {
+          if constexpr (IsPrebuiltTensorMapSupported) {
+            return params.mainloop.prebuilt_tensormaps;
+          }
+          else {
+            return false;
+          }
+        } ();
+
         // Fetch a copy of tensormaps for the CTA
         auto input_tensormaps = collective_mainloop.tensormaps_init(params.mainloop, shared_storage.tensormaps.mainloop, sm_count, sm_idx);
 
-        // Update tensormap for the initial batch for the CTA
-        collective_mainloop.tensormaps_perform_update(
-          shared_storage.tensormaps.mainloop,
-          params.mainloop,
-          input_tensormaps,
-          problem_shape_MNKL,
-          curr_batch
-        );
-        // Ensure warp is converged before issuing tensormap fence release
-        __syncwarp();
-        // Entire warp must do this (i.e. it's aligned)
-        collective_mainloop.tensormaps_cp_fence_release(shared_storage.tensormaps.mainloop, input_tensormaps);
+        if (use_prebuilt_tensormaps) {
+          if constexpr (IsPrebuiltTensorMapSupported) {
+            input_tensormaps = collective_mainloop.tensormaps_prebuilt(params.mainloop, curr_batch);
+          }
+        }
+        else {
+          // Update tensormap for the initial batch for the CTA
+          collective_mainloop.tensormaps_perform_update(
+            shared_storage.tensormaps.mainloop,
+            params.mainloop,
+            input_tensormaps,
+            problem_shape_MNKL,
+            curr_batch
+          );
+          // Ensure warp is converged before issuing tensormap fence release
+          __syncwarp();
+          // Entire warp must do this (i.e. it's aligned)
+          collective_mainloop.tensormaps_cp_fence_release(shared_storage.tensormaps.mainloop, input_tensormaps);
+        }
 
         bool do_load_order_arrive = true;
         bool did_batch_change = true;
@@ -728,7 +750,9 @@ public:
 
           if (did_batch_change) {
             load_inputs = collective_mainloop.tensors_perform_update(load_inputs, params.mainloop, problem_shape_MNKL, curr_batch);
-            collective_mainloop.tensormaps_fence_acquire(input_tensormaps);
+            if (not use_prebuilt_tensormaps) {
+              collective_mainloop.tensormaps_fence_acquire(input_tensormaps);
+            }
           }
 
           collective_mainloop.load(
@@ -768,17 +792,24 @@ public:
               gA_mkl = get<0>(load_inputs);
               gB_nkl = get<1>(load_inputs);
             }
-            collective_mainloop.tensormaps_perform_update(
-              shared_storage.tensormaps.mainloop,
-              params.mainloop,
-              input_tensormaps,
-              problem_shape_MNKL,
-              curr_batch
-            );
-            // Ensure warp is converged before issuing tensor replace
-            __syncwarp();
-            // Entire warp must do this (i.e. it's aligned)
-            collective_mainloop.tensormaps_cp_fence_release(shared_storage.tensormaps.mainloop, input_tensormaps);
+            if (use_prebuilt_tensormaps) {
+              if constexpr (IsPrebuiltTensorMapSupported) {
+                input_tensormaps = collective_mainloop.tensormaps_prebuilt(params.mainloop, curr_batch);
+              }
+            }
+            else {
+              collective_mainloop.tensormaps_perform_update(
+                shared_storage.tensormaps.mainloop,
+                params.mainloop,
+                input_tensormaps,
+                problem_shape_MNKL,
+                curr_batch
+              );
+              // Ensure warp is converged before issuing tensor replace
+              __syncwarp();
+              // Entire warp must do this (i.e. it's aligned)
+              collective_mainloop.tensormaps_cp_fence_release(shared_storage.tensormaps.mainloop, input_tensormaps);
+            }
           }
         } while (work_tile_info.is_valid()); // Scheduler work fetch loop
 
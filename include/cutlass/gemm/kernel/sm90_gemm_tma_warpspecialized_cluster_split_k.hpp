@@ -0,0 +1,542 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/arch/barrier.h"
+#include "cutlass/arch/mma_sm90.h"
+#include "cutlass/epilogue/collective/detail.hpp"
+#include "cutlass/gemm/gemm.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler.hpp"
+#include "cutlass/pipeline/pipeline.hpp"
+#include "cutlass/trace.h"
+
+#include "cute/tensor.hpp"
+#include "cute/arch/cluster_sm90.hpp"
+
+#include "cutlass/arch/grid_dependency_control.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::kernel {
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Non-persistent TMA warp-specialized GEMM splitting the K dimension of each output tile across the
+// CTAs of a (Splits,1,1) cluster. Each CTA runs the mainloop over its slice of K tiles with a CTA-local
+// pipeline (the mainloop is built for a 1x1x1 cluster). Once the leader CTA (rank 0) has drained its
+// mainloop, its mainloop shared memory is reused as a reduction buffer with one slot per peer CTA: the
+// peers write their accumulators into their slot with st.async, which completes the transaction bytes
+// of an mbarrier in the leader. The leader adds the partials to its own accumulators and runs the only
+// epilogue. No global workspace and no separate reduction kernel are needed, but the mainloop storage
+// must hold (Splits-1) accumulator tiles, which favors small tiles and skinny problems.
+template <
+  class ProblemShape_,
+  class CollectiveMainloop_,
+  class CollectiveEpilogue_,
+  int Splits_
+>
+class GemmUniversal<
+  ProblemShape_,
+  CollectiveMainloop_,
+  CollectiveEpilogue_,
+  ClusterSplitKScheduler<Splits_>,
+  cute::enable_if_t<cute::is_base_of_v<cutlass::gemm::KernelTmaWarpSpecialized, typename CollectiveMainloop_::DispatchPolicy::Schedule>>
+>
+{
+public:
+  //
+  // Type Aliases
+  //
+  using ProblemShape = ProblemShape_;
+  static_assert(cute::rank(ProblemShape{}) == 3 || cute::rank(ProblemShape{}) == 4,
+    "ProblemShape{} should be <M,N,K> or <M,N,K,L>");
+
+  static constexpr bool IsGdcEnabled = cutlass::arch::IsGdcGloballyEnabled;
+  static constexpr int Splits = Splits_;
+
+  // Mainloop derived types
+  using CollectiveMainloop = CollectiveMainloop_;
+  using TileShape = typename CollectiveMainloop::TileShape;
+  using TiledMma  = typename CollectiveMainloop::TiledMma;
+  using ArchTag   = typename CollectiveMainloop::ArchTag;
+  using ElementA  = typename CollectiveMainloop::ElementA;
+  using StrideA   = typename CollectiveMainloop::StrideA;
+  using ElementB  = typename CollectiveMainloop::ElementB;
+  using StrideB   = typename CollectiveMainloop::StrideB;
+  using ElementAccumulator = typename CollectiveMainloop::ElementAccumulator;
+  using MainloopDispatchPolicy = typename CollectiveMainloop::DispatchPolicy;
+  using MainloopClusterShape = typename MainloopDispatchPolicy::ClusterShape;
+  using MainloopArguments = typename CollectiveMainloop::Arguments;
+  using MainloopParams = typename CollectiveMainloop::Params;
+  static_assert(ArchTag::kMinComputeCapability >= 90);
+  static_assert(cute::is_static_v<MainloopClusterShape> && cute::size(MainloopClusterShape{}) == 1,
+    "Cluster split-K requires a mainloop built for a 1x1x1 cluster; the kernel forms the cluster from the K splits.");
+  static_assert(sizeof_bits<ElementAccumulator>::value == 32, "Cluster split-K reduces 32-bit accumulators.");
+
+  // The launch cluster spans the K splits of one output tile
+  using ClusterShape = cute::Shape<cute::Int<Splits>, cute::_1, cute::_1>;
+  struct DispatchPolicy : MainloopDispatchPolicy {
+    using ClusterShape = typename GemmUniversal::ClusterShape;
+  };
+
+  // Epilogue derived types
+  using CollectiveEpilogue = CollectiveEpilogue_;
+  using ElementC = typename CollectiveEpilogue::ElementC;
+  using StrideC  = typename CollectiveEpilogue::StrideC;
+  using ElementD = typename CollectiveEpilogue::ElementD;
+  using StrideD  = typename CollectiveEpilogue::StrideD;
+  using EpilogueArguments = typename CollectiveEpilogue::Arguments;
+  using EpilogueParams = typename CollectiveEpilogue::Params;
+
+  using TileSchedulerTag = ClusterSplitKScheduler<Splits>;
+  using TileScheduler = typename detail::TileSchedulerSelector<
+    TileSchedulerTag, ArchTag, TileShape, MainloopClusterShape>::Scheduler;
+
+  using TileSchedulerArguments = typename TileScheduler::Arguments;
+
+  static constexpr uint32_t NumLoadWarpGroups = 1;
+  static constexpr uint32_t NumMmaWarpGroups = 1;
+  static constexpr uint32_t MaxThreadsPerBlock = CUTE_STATIC_V(size(TiledMma{})) + (NumLoadWarpGroups * NumThreadsPerWarpGroup);
+  static constexpr uint32_t MinBlocksPerMultiprocessor = 1;
+  static_assert(size(TiledMma{}) == NumThreadsPerWarpGroup, "Cluster split-K uses a single MMA warp group.");
+
+  // Each peer CTA transfers one full accumulator tile to the leader
+  static constexpr int AccumulatorsPerCta = size<0>(TileShape{}) * size<1>(TileShape{});
+  static constexpr uint32_t ReductionTransactionBytes =
+    (Splits - 1) * AccumulatorsPerCta * sizeof(ElementAccumulator);
+
+  // Kernel level shared memory storage
+  struct SharedStorage {
+    struct TensorStorage {
+      // The reduction buffer is filled only after the leader's mainloop has drained
+      union MainloopReductionStorage {
+        using MainloopTensorStorage = typename CollectiveMainloop::TensorStorage;
+
+        MainloopTensorStorage mainloop;
+        alignas(16) ElementAccumulator reduction[(Splits - 1) * AccumulatorsPerCta];
+      } mainloop_reduction;
+
+      // Epilogue loads of the leader may overlap its reduction, so epilogue storage is not aliased
+      using EpilogueTensorStorage = typename CollectiveEpilogue::TensorStorage;
+      EpilogueTensorStorage epilogue;
+    } tensors;
+
+    struct PipelineStorage : cute::aligned_struct<16, _1> {
+      using MainloopPipelineStorage = typename CollectiveMainloop::PipelineStorage;
+      using EpiLoadPipelineStorage = typename CollectiveEpilogue::PipelineStorage;
+
+      alignas(16) MainloopPipelineStorage mainloop;
+      alignas(16) EpiLoadPipelineStorage epi_load;
+      alignas(16) arch::ClusterTransactionBarrier reduction_full;  // Leader: all partials have landed
+      alignas(16) arch::ClusterBarrier reduction_ready;            // Peers: the leader's buffer is free
+    } pipelines;
+  };
+
+  static constexpr int SharedStorageSize = sizeof(SharedStorage);
+
+  // Device side arguments
+  struct Arguments {
+    GemmUniversalMode mode{};
+    ProblemShape problem_shape{};
+    MainloopArguments mainloop{};
+    EpilogueArguments epilogue{};
+    KernelHardwareInfo hw_info{};
+    TileSchedulerArguments scheduler{};
+  };
+
+  // Kernel entry point API
+  struct Params {
+    GemmUniversalMode mode{};
+    ProblemShape problem_shape{};
+    MainloopParams mainloop{};
+    EpilogueParams epilogue{};
+  };
+
+  //
+  // Methods
+  //
+
+  // Convert to underlying arguments. In this case, a simple copy for the aliased type.
+  static Params
+  to_underlying_arguments(Arguments const& args, void* workspace) {
+    (void) workspace;
+    auto problem_shape = args.problem_shape;
+    if constexpr (detail::Has_SwapAB_v<CollectiveMainloop>) {
+      // swap M/N
+      get<0>(problem_shape) = get<1>(args.problem_shape);
+      get<1>(problem_shape) = get<0>(args.problem_shape);
+    }
+    return {
+      args.mode,
+      problem_shape,
+      CollectiveMainloop::to_underlying_arguments(args.problem_shape, args.mainloop, workspace),
+      CollectiveEpilogue::to_underlying_arguments(args.problem_shape, args.epilogue, workspace)
+    };
+  }
+
+  static bool
+  can_implement(Arguments const& args) {
+    bool implementable = (args.mode == GemmUniversalMode::kGemm) or
+        (args.mode == GemmUniversalMode::kBatched && cute::rank(ProblemShape{}) == 4);
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Arguments or Problem Shape don't meet the requirements.\n");
+      return implementable;
+    }
+
+    // Every CTA of the cluster must own at least one K tile
+    auto problem_shape_MNKL = append<4>(args.problem_shape, Int<1>{});
+    int k_tile_count = cute::ceil_div(int(get<2>(problem_shape_MNKL)), int(size<2>(TileShape{})));
+    if (k_tile_count < Splits) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Cluster split-K needs at least one K tile per split.\n");
+      return false;
+    }
+
+    implementable &= CollectiveMainloop::can_implement(args.problem_shape, args.mainloop);
+    implementable &= CollectiveEpilogue::can_implement(args.problem_shape, args.epilogue);
+    return implementable;
+  }
+
+  static size_t
+  get_workspace_size(Arguments const& args) {
+    return 0;
+  }
+
+  static cutlass::Status
+  initialize_workspace(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  // Computes the kernel launch grid shape based on runtime parameters
+  static dim3
+  get_grid_shape(Params const& params) {
+    auto problem_shape_MNKL = append<4>(params.problem_shape, Int<1>{});
+    int tiles_m = cute::ceil_div(int(get<0>(problem_shape_MNKL)), int(size<0>(TileShape{})));
+    int tiles_n = cute::ceil_div(int(get<1>(problem_shape_MNKL)), int(size<1>(TileShape{})));
+    return dim3(Splits * tiles_m, tiles_n, int(get<3>(problem_shape_MNKL)));
+  }
+
+  static dim3
+  get_block_shape() {
+    return dim3(MaxThreadsPerBlock, 1, 1);
+  }
+
+  CUTLASS_DEVICE
+  void
+  operator()(Params const& params, char* smem_buf) {
+    using namespace cute;
+    using X = Underscore;
+
+#if defined(__CUDA_ARCH_FEAT_SM90_ALL)
+#  define ENABLE_SM90_KERNEL_LEVEL 1
+#endif
+
+// Any Tensor Op MMA Atom in the WGMMA ISA is arch conditional to sm90a.
+#if ! defined(ENABLE_SM90_KERNEL_LEVEL)
+    CUTE_INVALID_CONTROL_PATH("ERROR : Arch conditional MMA instruction used without targeting sm90a compute capability. Aborting.\n");
+#else
+
+    enum class WarpGroupRole {
+      Producer = 0,
+      Consumer = 1,
+    };
+    enum class ProducerWarpRole {
+      MainloopEpilogue = 0,
+      Warp1 = 1,
+      Warp2 = 2,
+      Warp3 = 3
+    };
+
+    // Kernel level shared memory storage
+    SharedStorage& shared_storage = *reinterpret_cast<SharedStorage*>(smem_buf);
+
+    int thread_idx = int(threadIdx.x);
+    int lane_idx = canonical_lane_idx();
+    int warp_idx = canonical_warp_idx_sync();
+    int warp_idx_in_warp_group = warp_idx % NumWarpsPerWarpGroup;
+    int warp_group_thread_idx = thread_idx % NumThreadsPerWarpGroup;
+    auto warp_group_role = WarpGroupRole(canonical_warp_group_idx());
+    auto producer_warp_role = ProducerWarpRole(warp_idx_in_warp_group);
+    int lane_predicate = cute::elect_one_sync();
+
+    // The rank in the cluster is the K split of this CTA; rank 0 reduces the partials and stores D
+    int split_idx = int(cute::block_rank_in_cluster());
+    bool is_leader = split_idx == 0;
+
+    // Issue Tma Descriptor Prefetch from a single thread
+    if ((warp_idx == 0) && lane_predicate) {
+      CollectiveMainloop::prefetch_tma_descriptors(params.mainloop);
+      CollectiveEpilogue::prefetch_tma_descriptors(params.epilogue);
+    }
+
+    // Reduction barriers
+    if ((warp_idx == 0) && lane_predicate) {
+      if (is_leader) {
+        shared_storage.pipelines.reduction_full.init(1);
+      }
+      else {
+        shared_storage.pipelines.reduction_ready.init(1);
+      }
+      cutlass::arch::fence_barrier_init();
+    }
+
+    // Mainloop Load pipeline, local to the CTA
+    using MainloopPipeline = typename CollectiveMainloop::MainloopPipeline;
+    typename MainloopPipeline::Params mainloop_pipeline_params;
+    if (warp_group_role == WarpGroupRole::Producer && producer_warp_role == ProducerWarpRole::MainloopEpilogue) {
+      mainloop_pipeline_params.role = MainloopPipeline::ThreadCategory::Producer;
+    }
+    if (warp_group_role == WarpGroupRole::Consumer) {
+      mainloop_pipeline_params.role = MainloopPipeline::ThreadCategory::Consumer;
+    }
+    mainloop_pipeline_params.is_leader = warp_group_thread_idx == 0;
+    mainloop_pipeline_params.num_consumers = NumThreadsPerWarpGroup;
+    mainloop_pipeline_params.transaction_bytes = params.mainloop.tma_transaction_bytes;
+    MainloopPipeline mainloop_pipeline(shared_storage.pipelines.mainloop, mainloop_pipeline_params, MainloopClusterShape{});
+
+    // Epilogue Load pipeline
+    using EpiLoadPipeline = typename CollectiveEpilogue::LoadPipeline;
+    typename EpiLoadPipeline::Params epi_load_pipeline_params;
+    if (warp_group_role == WarpGroupRole::Producer && producer_warp_role == ProducerWarpRole::MainloopEpilogue) {
+      epi_load_pipeline_params.role = EpiLoadPipeline::ThreadCategory::Producer;
+    }
+    if (warp_group_role == WarpGroupRole::Consumer) {
+      epi_load_pipeline_params.role = EpiLoadPipeline::ThreadCategory::Consumer;
+    }
+    epi_load_pipeline_params.dst_blockid = cute::block_rank_in_cluster();
+    epi_load_pipeline_params.producer_arv_count = NumThreadsPerWarp;
+    epi_load_pipeline_params.consumer_arv_count = NumThreadsPerWarpGroup;
+    if constexpr (CollectiveEpilogue::RequiresTransactionBytes) {
+      epi_load_pipeline_params.transaction_bytes = params.epilogue.tma_transaction_bytes;
+    }
+    EpiLoadPipeline epi_load_pipeline(shared_storage.pipelines.epi_load, epi_load_pipeline_params);
+
+    // Epilogue Store pipeline
+    using EpiStorePipeline = typename CollectiveEpilogue::StorePipeline;
+    typename EpiStorePipeline::Params epi_store_pipeline_params;
+    epi_store_pipeline_params.always_wait = true;
+    EpiStorePipeline epi_store_pipeline(epi_store_pipeline_params);
+
+    // Initialize starting pipeline states for the collectives
+    // Epilogue store pipe is producer-only (consumer is TMA unit, waits via scoreboarding)
+    typename CollectiveMainloop::PipelineState mainloop_pipe_consumer_state;
+    typename CollectiveEpilogue::LoadPipelineState epi_load_pipe_consumer_state;
+
+    // For the DMA Load (producer) we start with an opposite phase
+    // i.e., we skip all waits since we know that the buffer is indeed empty
+    PipelineState mainloop_pipe_producer_state = cutlass::make_producer_start_state<MainloopPipeline>();
+    PipelineState epi_load_pipe_producer_state = cutlass::make_producer_start_state<EpiLoadPipeline>();
+    PipelineState epi_store_pipe_producer_state = cutlass::make_producer_start_state<EpiStorePipeline>();
+
+    // The reduction barriers are accessed across the cluster, so their init must be visible cluster-wide
+    cute::cluster_arrive_relaxed();
+
+    static_assert(cute::rank(StrideA{}) == 3, "StrideA must be rank-3: [M, K, L]. If batch mode is not needed, set L stride to Int<0>.");
+    static_assert(cute::rank(StrideB{}) == 3, "StrideB must be rank-3: [N, K, L]. If batch mode is not needed, set L stride to Int<0>.");
+    static_assert(cute::rank(StrideC{}) == 3, "StrideC must be rank-3: [M, N, L]. If batch mode is not needed, set L stride to Int<0>.");
+    static_assert(cute::rank(StrideD{}) == 3, "StrideD must be rank-3: [M, N, L]. If batch mode is not needed, set L stride to Int<0>.");
+
+    auto blk_shape = TileShape{}; // (BLK_M,BLK_N,BLK_K)
+    TiledMma tiled_mma;
+
+    // Optionally append 1s until problem shape is rank-4 in case it is only rank-3 (MNK)
+    auto problem_shape_MNKL = append<4>(params.problem_shape, Int<1>{});
+
+    // In a warp specialized kernel, collectives expose data movement and compute operations separately
+    CollectiveMainloop collective_mainloop;
+    CollectiveEpilogue collective_epilogue(params.epilogue, shared_storage.tensors.epilogue);
+
+    // Prepare and partition the input tensors
+    auto load_inputs = collective_mainloop.load_init(problem_shape_MNKL, params.mainloop);
+    static_assert(cute::tuple_size_v<decltype(load_inputs)> >= 2, "Output of load_init must have at least two elements (A, B)");
+
+    // Extract out partitioned A and B.
+    Tensor gA_mkl = get<0>(load_inputs);
+    Tensor gB_nkl = get<1>(load_inputs);
+
+    // The CTAs of a cluster share the output tile
+    auto m_coord = idx2crd(int(blockIdx.x) / Splits, shape<2>(gA_mkl));
+    auto n_coord = idx2crd(int(blockIdx.y), shape<2>(gB_nkl));
+    auto l_coord = idx2crd(int(blockIdx.z), shape<4>(gB_nkl));
+    auto blk_coord = make_coord(m_coord, n_coord, _, l_coord);
+
+    // Balance the K tiles over the splits, the first (k_tiles % Splits) splits taking one extra tile
+    int k_tiles = int(size<3>(gA_mkl));
+    int k_tiles_per_split = k_tiles / Splits;
+    int k_tiles_remainder = k_tiles % Splits;
+    int k_tile_begin = split_idx * k_tiles_per_split + cute::min(split_idx, k_tiles_remainder);
+    int k_tile_count = k_tiles_per_split + (split_idx < k_tiles_remainder ? 1 : 0);
+    auto k_tile_iter = cute::make_coord_iterator(idx2crd(k_tile_begin, shape<3>(gA_mkl)), shape<3>(gA_mkl));
+
+    // Wait for all thread blocks in the Cluster
+    cute::cluster_wait();
+
+    if (warp_group_role == WarpGroupRole::Producer) {
+      if (producer_warp_role == ProducerWarpRole::MainloopEpilogue) {
+        // Ensure that the prefetched kernel does not touch
+        // unflushed global memory prior to this instruction
+        cutlass::arch::wait_on_dependent_grids();
+        collective_mainloop.load(
+          params.mainloop,
+          mainloop_pipeline,
+          mainloop_pipe_producer_state,
+          load_inputs,
+          blk_coord,
+          k_tile_iter, k_tile_count,
+          lane_idx,
+          0,  // the mainloop cluster is the CTA itself
+          shared_storage.tensors.mainloop_reduction.mainloop
+        );
+        // Update starting mainloop pipeline state for the pipeline drain
+        mainloop_pipe_producer_state.advance(k_tile_count);
+        // Make sure mainloop consumer has been waited upon before issuing epilogue load
+        collective_mainloop.load_tail(mainloop_pipeline, mainloop_pipe_producer_state);
+
+        if (is_leader && collective_epilogue.is_producer_load_needed()) {
+          // Ensure warp is converged before issuing epilogue loads
+          __syncwarp();
+          epi_load_pipe_producer_state = collective_epilogue.load(
+            epi_load_pipeline,
+            epi_load_pipe_producer_state,
+            problem_shape_MNKL,
+            blk_shape,
+            blk_coord,
+            tiled_mma,
+            lane_idx,
+            shared_storage.tensors.epilogue
+          );
+          collective_epilogue.load_tail(epi_load_pipeline, epi_load_pipe_producer_state);
+        }
+      }
+      cute::cluster_arrive_relaxed();
+    }
+    else if (warp_group_role == WarpGroupRole::Consumer) {
+      Tensor accumulators = partition_fragment_C(tiled_mma, take<0,2>(blk_shape));                 // (MMA,MMA_M,MMA_N)
+
+      collective_mainloop.mma(
+        mainloop_pipeline,
+        mainloop_pipe_consumer_state,
+        accumulators,
+        k_tile_count,
+        warp_group_thread_idx,
+        shared_storage.tensors.mainloop_reduction.mainloop,
+        params.mainloop
+      );
+
+      // Make sure the math instructions are done and free buffers before entering the reduction
+      collective_mainloop.mma_tail(
+        mainloop_pipeline,
+        mainloop_pipe_consumer_state,
+        k_tile_count
+      );
+
+      // Hint on an early release of global memory resources.
+      // The timing of calling this function only influences performance,
+      // not functional correctness.
+      cutlass::arch::launch_dependent_grids();
+
+      // Each thread owns the same accumulator coordinates in every CTA, so the partials are exchanged
+      // in fragment order, interleaved across threads to keep the shared memory accesses conflict-free
+      ElementAccumulator* reduction = shared_storage.tensors.mainloop_reduction.reduction;
+
+      if (is_leader) {
+        // All MMA threads must be done with the mainloop buffers before the peers overwrite them
+        cutlass::arch::NamedBarrier::arrive_and_wait(NumThreadsPerWarpGroup,
+          cutlass::arch::ReservedNamedBarriers::StreamkBarrier0);
+        if (warp_group_thread_idx == 0) {
+          shared_storage.pipelines.reduction_full.arrive_and_expect_tx(ReductionTransactionBytes);
+          CUTLASS_PRAGMA_UNROLL
+          for (int peer = 1; peer < Splits; ++peer) {
+            shared_storage.pipelines.reduction_ready.arrive(peer);
+          }
+        }
+
+        shared_storage.pipelines.reduction_full.wait(0);
+        CUTLASS_PRAGMA_UNROLL
+        for (int peer = 1; peer < Splits; ++peer) {
+          ElementAccumulator const* partial = reduction + (peer - 1) * AccumulatorsPerCta + warp_group_thread_idx;
+          CUTLASS_PRAGMA_UNROLL
+          for (int i = 0; i < size(accumulators); ++i) {
+            accumulators(i) += partial[i * NumThreadsPerWarpGroup];
+          }
+        }
+        cute::cluster_arrive_relaxed();
+
+        // Epilogue and write to gD
+        auto [epi_load_pipe_consumer_state_next, epi_store_pipe_producer_state_next] =
+        collective_epilogue.store(
+          epi_load_pipeline,
+          epi_load_pipe_consumer_state,
+          epi_store_pipeline,
+          epi_store_pipe_producer_state,
+          problem_shape_MNKL,
+          blk_shape,
+          blk_coord,
+          accumulators,
+          tiled_mma,
+          warp_group_thread_idx,
+          shared_storage.tensors.epilogue
+        );
+
+        collective_epilogue.store_tail(
+          epi_load_pipeline,
+          epi_load_pipe_consumer_state_next,
+          epi_store_pipeline,
+          epi_store_pipe_producer_state_next
+        );
+      }
+      else {
+        shared_storage.pipelines.reduction_ready.wait(0);
+
+        uint32_t reduction_full_addr = cute::cast_smem_ptr_to_uint(&shared_storage.pipelines.reduction_full);
+        ElementAccumulator* partial = reduction + (split_idx - 1) * AccumulatorsPerCta + warp_group_thread_idx;
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(accumulators); ++i) {
+          uint32_t partial_addr = cute::cast_smem_ptr_to_uint(partial + i * NumThreadsPerWarpGroup);
+          cute::store_shared_remote(reinterpret_cast<uint32_t const&>(accumulators(i)), partial_addr, reduction_full_addr, 0);
+        }
+        cute::cluster_arrive_relaxed();
+      }
+    }
+
+    // No CTA may exit while the leader still waits on partials in flight from its peers
+    cute::cluster_wait();
+#endif
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::kernel
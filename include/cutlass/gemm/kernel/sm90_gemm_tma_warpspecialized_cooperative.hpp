@@ -41,10 +41,13 @@
 #include "cutlass/gemm/gemm.h"
 #include "cutlass/gemm/dispatch_policy.hpp"
 #include "cutlass/gemm/kernel/tile_scheduler.hpp"
+#include "cutlass/gemm/kernel/l2_prefetch.hpp"
 #include "cutlass/pipeline/pipeline.hpp"
+#include "cutlass/pipeline/pipeline_trace.hpp"
 #include "cute/tensor.hpp"
 #include "cutlass/trace.h"
 #include "cutlass/gemm/kernel/gemm_universal_decl.h"
+#include "cutlass/conv/detail.hpp"
 #include "cutlass/arch/grid_dependency_control.h"
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -69,8 +72,13 @@ public:
   // Type Aliases
   //
   using ProblemShape = ProblemShape_;
-  static_assert(cute::rank(ProblemShape{}) == 3 or cute::rank(ProblemShape{}) == 4,
+
+  // Implicit GEMM convolutions (ConvUniversal) run through this kernel with a ConvProblemShape,
+  // which is lowered to the linearized <M,N,K,L> of the collective mainloop.
+  static constexpr bool IsConvProblemShape = not (cute::is_tuple_v<ProblemShape> || IsCutlass3ArrayKernel<ProblemShape>::value);
+  static_assert(IsConvProblemShape || (cute::rank(ProblemShape{}) == 3 or cute::rank(ProblemShape{}) == 4),
     "ProblemShape{} should be <M,N,K> or <M,N,K,L>");
+  using IsConvProblemShapeType = cute::conditional_t<IsConvProblemShape, cute::true_type, cute::false_type>;
 
   // Mainloop derived types
   using CollectiveMainloop = CollectiveMainloop_;
@@ -191,17 +199,23 @@ public:
     EpilogueArguments epilogue{};
     KernelHardwareInfo hw_info{};
     TileSchedulerArguments scheduler{};
+    // Buffer prefetched into L2 once the mainloop loads are done, e.g. the next layer's weights
+    detail::L2PrefetchArguments l2_prefetch{};
   };
 
+  // Problem shape seen by the tile scheduler and the epilogue, the <M,N,K,L> of the mainloop for convolutions
+  using ProblemShapeMNKL = decltype(cutlass::conv::detail::get_problem_shape_MNKL_helper<CollectiveMainloop>(ProblemShape{}, IsConvProblemShapeType{}));
+
   // Kernel entry point API
   struct Params {
     GemmUniversalMode mode{};
-    ProblemShape problem_shape{};
+    ProblemShapeMNKL problem_shape{};
     MainloopParams mainloop{};
     EpilogueParams epilogue{};
     KernelHardwareInfo hw_info{};
     TileSchedulerParams scheduler{};
     void* workspace{nullptr};
+    detail::L2PrefetchArguments l2_prefetch{};
   };
 
   //
@@ -214,11 +228,13 @@ public:
   to_underlying_arguments(Arguments const& args, void* workspace) {
     CUTLASS_TRACE_HOST("to_underlying_arguments():");
 
-    auto problem_shape = args.problem_shape;
+    auto sched_problem_shape = cutlass::conv::detail::get_problem_shape_MNKL_helper<CollectiveMainloop>(args.problem_shape, IsConvProblemShapeType{});
+    auto epi_problem_shape = cutlass::conv::detail::get_transformed_problem_shape_MNKL(args.problem_shape);
+    auto problem_shape = sched_problem_shape;
     if constexpr (detail::Has_SwapAB_v<CollectiveMainloop>) {
       // swap M/N
-      get<0>(problem_shape) = get<1>(args.problem_shape);
-      get<1>(problem_shape) = get<0>(args.problem_shape);
+      get<0>(problem_shape) = get<1>(sched_problem_shape);
+      get<1>(problem_shape) = get<0>(sched_problem_shape);
     }
     auto problem_shape_MNKL = append<4>(problem_shape, 1);
 
@@ -251,12 +267,12 @@ public:
     size_t workspace_offset = 0;
 
     void* epilogue_workspace = workspace_ptr + workspace_offset;
-    workspace_offset += CollectiveEpilogue::get_workspace_size(args.problem_shape, args.epilogue);
+    workspace_offset += CollectiveEpilogue::get_workspace_size(epi_problem_shape, args.epilogue);
     workspace_offset = round_nearest(workspace_offset,  MinWorkspaceAlignment);
 
     void* scheduler_workspace = workspace_ptr + workspace_offset;
-    workspace_offset += TileScheduler::template get_workspace_size<ProblemShape, ElementAccumulator>(
-      args.scheduler, args.problem_shape, args.hw_info, NumMmaWarpGroups);
+    workspace_offset += TileScheduler::template get_workspace_size<ProblemShapeMNKL, ElementAccumulator>(
+      args.scheduler, sched_problem_shape, args.hw_info, NumMmaWarpGroups);
     workspace_offset = round_nearest(workspace_offset,  MinWorkspaceAlignment);
 
     void* mainloop_workspace = nullptr;
@@ -272,10 +288,11 @@ public:
       args.mode,
       problem_shape,
       CollectiveMainloop::to_underlying_arguments(args.problem_shape, args.mainloop, mainloop_workspace),
-      CollectiveEpilogue::to_underlying_arguments(args.problem_shape, args.epilogue, epilogue_workspace),
+      CollectiveEpilogue::to_underlying_arguments(epi_problem_shape, args.epilogue, epilogue_workspace),
       hw_info,
       scheduler,
-      workspace
+      workspace,
+      args.l2_prefetch
     };
   }
 
@@ -287,9 +304,11 @@ public:
       CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Arguments or Problem Shape don't meet the requirements.\n");
       return implementable;
     }
+    auto epi_problem_shape = cutlass::conv::detail::get_transformed_problem_shape_MNKL(args.problem_shape);
     implementable &= CollectiveMainloop::can_implement(args.problem_shape, args.mainloop);
-    implementable &= CollectiveEpilogue::can_implement(args.problem_shape, args.epilogue);
+    implementable &= CollectiveEpilogue::can_implement(epi_problem_shape, args.epilogue);
     implementable &= TileScheduler::can_implement(args.scheduler, args.hw_info);
+    implementable &= detail::L2Prefetch::can_implement(args.l2_prefetch);
     return implementable;
   }
 
@@ -297,12 +316,14 @@ public:
   get_workspace_size(Arguments const& args) {
     size_t workspace_size = 0;
     constexpr uint32_t NumEpilogueSubTiles = CollectiveEpilogue::get_store_pipe_increment(TileShape{});
+    auto sched_problem_shape = cutlass::conv::detail::get_problem_shape_MNKL_helper<CollectiveMainloop>(args.problem_shape, IsConvProblemShapeType{});
+    auto epi_problem_shape = cutlass::conv::detail::get_transformed_problem_shape_MNKL(args.problem_shape);
 
-    workspace_size += CollectiveEpilogue::get_workspace_size(args.problem_shape, args.epilogue);
+    workspace_size += CollectiveEpilogue::get_workspace_size(epi_problem_shape, args.epilogue);
     workspace_size = round_nearest(workspace_size,  MinWorkspaceAlignment);
 
-    workspace_size += TileScheduler::template get_workspace_size<ProblemShape, ElementAccumulator>(
-      args.scheduler, args.problem_shape, args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles);
+    workspace_size += TileScheduler::template get_workspace_size<ProblemShapeMNKL, ElementAccumulator>(
+      args.scheduler, sched_problem_shape, args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles);
     workspace_size = round_nearest(workspace_size,  MinWorkspaceAlignment);
     return workspace_size;
   }
@@ -315,18 +336,20 @@ public:
     size_t workspace_offset = 0;
     constexpr uint32_t NumEpilogueSubTiles = CollectiveEpilogue::get_store_pipe_increment(TileShape{});
     static constexpr uint32_t NumAccumulatorMtxs = 1;
+    auto sched_problem_shape = cutlass::conv::detail::get_problem_shape_MNKL_helper<CollectiveMainloop>(args.problem_shape, IsConvProblemShapeType{});
+    auto epi_problem_shape = cutlass::conv::detail::get_transformed_problem_shape_MNKL(args.problem_shape);
 
-    status = CollectiveEpilogue::initialize_workspace(args.problem_shape, args.epilogue, workspace_ptr + workspace_offset, stream, cuda_adapter);
-    workspace_offset += CollectiveEpilogue::get_workspace_size(args.problem_shape, args.epilogue);
+    status = CollectiveEpilogue::initialize_workspace(epi_problem_shape, args.epilogue, workspace_ptr + workspace_offset, stream, cuda_adapter);
+    workspace_offset += CollectiveEpilogue::get_workspace_size(epi_problem_shape, args.epilogue);
     workspace_offset = round_nearest(workspace_offset,  MinWorkspaceAlignment);
     if (status != Status::kSuccess) {
       return status;
     }
 
-    status = TileScheduler::template initialize_workspace<ProblemShape, ElementAccumulator>(
-      args.scheduler, workspace_ptr + workspace_offset, stream, args.problem_shape, args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles, NumAccumulatorMtxs, cuda_adapter);
-    workspace_offset += TileScheduler::template get_workspace_size<ProblemShape, ElementAccumulator>(
-      args.scheduler, args.problem_shape, args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles);
+    status = TileScheduler::template initialize_workspace<ProblemShapeMNKL, ElementAccumulator>(
+      args.scheduler, workspace_ptr + workspace_offset, stream, sched_problem_shape, args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles, NumAccumulatorMtxs, cuda_adapter);
+    workspace_offset += TileScheduler::template get_workspace_size<ProblemShapeMNKL, ElementAccumulator>(
+      args.scheduler, sched_problem_shape, args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles);
     workspace_offset = round_nearest(workspace_offset,  MinWorkspaceAlignment);
     if (status != Status::kSuccess) {
       return status;
@@ -352,6 +375,18 @@ public:
     return dim3(MaxThreadsPerBlock, 1, 1);
   }
 
+  // The conv mainloop tiles have no batch mode, see load_init of the collective
+  template <class TensorB>
+  CUTLASS_DEVICE static auto
+  get_l_coord(int L_idx, TensorB const& gB_nkl) {
+    if constexpr (IsConvProblemShape) {
+      return Int<0>{};
+    }
+    else {
+      return idx2crd(L_idx, shape<4>(gB_nkl));
+    }
+  }
+
   CUTLASS_DEVICE
   void
   operator()(Params const& params, char* smem_buf) {
@@ -373,10 +408,10 @@ public:
     static_assert(size<0>(TileShape{}) >= 128,
         "Cooperative kernel requires Tile Size to be greater than or equal to 128 along the M-dimension.");
 
-    static_assert(cute::rank(StrideA{}) == 3, "StrideA must be rank-3: [M, K, L]. If batch mode is not needed, set L stride to Int<0>.");
-    static_assert(cute::rank(StrideB{}) == 3, "StrideB must be rank-3: [N, K, L]. If batch mode is not needed, set L stride to Int<0>.");
-    static_assert(cute::rank(StrideC{}) == 3, "StrideC must be rank-3: [M, N, L]. If batch mode is not needed, set L stride to Int<0>.");
-    static_assert(cute::rank(StrideD{}) == 3, "StrideD must be rank-3: [M, N, L]. If batch mode is not needed, set L stride to Int<0>.");
+    static_assert(IsConvProblemShape || cute::rank(StrideA{}) == 3, "StrideA must be rank-3: [M, K, L]. If batch mode is not needed, set L stride to Int<0>.");
+    static_assert(IsConvProblemShape || cute::rank(StrideB{}) == 3, "StrideB must be rank-3: [N, K, L]. If batch mode is not needed, set L stride to Int<0>.");
+    static_assert(IsConvProblemShape || cute::rank(StrideC{}) == 3, "StrideC must be rank-3: [M, N, L]. If batch mode is not needed, set L stride to Int<0>.");
+    static_assert(IsConvProblemShape || cute::rank(StrideD{}) == 3, "StrideD must be rank-3: [M, N, L]. If batch mode is not needed, set L stride to Int<0>.");
 
     /* In the Cooperative kernel, Consumer0 and Consumer1 collaborate on the same tile */
     enum class WarpGroupRole {
@@ -614,7 +649,7 @@ public:
           // Compute m_coord, n_coord, l_coord with the post-tiled m-shape and n-shape
           auto m_coord = idx2crd(work_tile_info.M_idx, shape<2>(gA_mkl));
           auto n_coord = idx2crd(work_tile_info.N_idx, shape<2>(gB_nkl));
-          auto l_coord = idx2crd(work_tile_info.L_idx, shape<4>(gB_nkl));
+          auto l_coord = get_l_coord(work_tile_info.L_idx, gB_nkl);
           auto blk_coord = make_coord(m_coord, n_coord, _, l_coord);
 
           // Get the number of K tiles to compute for this work as well as the starting K tile offset of the work.
@@ -628,6 +663,7 @@ public:
             ++scheduler_pipe_throttle_producer_state;
           }
 
+          uint64_t load_trace_start = pipeline_trace_timestamp();
           collective_mainloop.load(
             params.mainloop,
             mainloop_pipeline,
@@ -639,6 +675,7 @@ public:
             block_rank_in_cluster,
             shared_storage.tensors.mainloop
           );
+          pipeline_trace_emit_region<NumThreadsPerWarp>(PipelineTraceEvent::kMainloopLoad, load_trace_start);
           // Update starting pipeline state for the next tile
           mainloop_pipe_producer_state.advance(work_k_tile_count);
 
@@ -648,10 +685,12 @@ public:
             do_load_order_arrive = false;
           }
           // Get next work tile
+          uint64_t fetch_trace_start = pipeline_trace_timestamp();
           auto [next_work_tile_info, increment_pipe] = scheduler.fetch_next_work(work_tile_info,
                                                                             scheduler_pipeline,             
                                                                             scheduler_pipe_consumer_state
                                                                            );
+          pipeline_trace_emit_region<NumThreadsPerWarp>(PipelineTraceEvent::kSchedulerFetch, fetch_trace_start);
 
           work_tile_info = next_work_tile_info;
           if constexpr (IsSchedDynamicPersistent) { 
@@ -665,6 +704,10 @@ public:
         // Make sure all Consumer Warp Groups have been waited upon
         collective_mainloop.load_tail(mainloop_pipeline, mainloop_pipe_producer_state);
 
+        // Nothing left to load, warm L2 for the caller while the consumers finish
+        if (lane_predicate) {
+          detail::L2Prefetch::issue(params.l2_prefetch);
+        }
       }
       else if (producer_warp_role == ProducerWarpRole::MainloopAux) {
         if constexpr (IsMainloopAuxiliaryLoadNeeded) {
@@ -678,7 +721,7 @@ public:
             // Compute m_coord, n_coord, l_coord with the post-tiled m-shape and n-shape
             auto m_coord = idx2crd(work_tile_info.M_idx, shape<2>(gA_mkl));
             auto n_coord = idx2crd(work_tile_info.N_idx, shape<2>(gB_nkl));
-            auto l_coord = idx2crd(work_tile_info.L_idx, shape<4>(gB_nkl));
+            auto l_coord = get_l_coord(work_tile_info.L_idx, gB_nkl);
             auto blk_coord = make_coord(m_coord, n_coord, _, l_coord);
 
             // Get the number of K tiles to compute for this work as well as the starting K tile offset of the work.
@@ -731,7 +774,7 @@ public:
             // Compute m_coord, n_coord, l_coord with the post-tiled m-shape and n-shape
             auto m_coord = idx2crd(work_tile_info.M_idx, shape<2>(gA_mkl));
             auto n_coord = idx2crd(work_tile_info.N_idx, shape<2>(gB_nkl));
-            auto l_coord = idx2crd(work_tile_info.L_idx, shape<4>(gB_nkl));
+            auto l_coord = get_l_coord(work_tile_info.L_idx, gB_nkl);
             auto blk_coord = make_coord(m_coord, n_coord, _, l_coord);
             
             epi_load_pipe_producer_state =
@@ -778,7 +821,7 @@ public:
         // Compute m_coord, n_coord, l_coord with the post-tiled m-shape and n-shape
         auto m_coord = idx2crd(work_tile_info.M_idx, shape<2>(gA_mkl));
         auto n_coord = idx2crd(work_tile_info.N_idx, shape<2>(gB_nkl));
-        auto l_coord = idx2crd(work_tile_info.L_idx, shape<4>(gB_nkl));
+        auto l_coord = get_l_coord(work_tile_info.L_idx, gB_nkl);
         auto blk_coord = make_coord(m_coord, n_coord, _, l_coord);
         auto work_k_tile_count = TileScheduler::get_work_k_tile_count(work_tile_info, problem_shape_MNKL, blk_shape);
         // Allocate the accumulators for the (M,N) blk_shape
@@ -786,7 +829,8 @@ public:
         // MSVC CTAD breaks if we say "Tensor" here, so we use "auto" instead.
         auto accumulators = partition_fragment_C(tiled_mma, take<0,2>(blk_shape));                 // (MMA,MMA_M,MMA_N)
         if (TileScheduler::valid_warpgroup_in_work_tile(work_tile_info)) {
-          if constexpr (IsSm120Family) {
+          uint64_t mma_trace_start = pipeline_trace_timestamp();
+          if constexpr (IsSm120Family || IsConvProblemShape) {
             collective_mainloop.mma(
               mainloop_pipeline,
               mainloop_pipe_consumer_state,
@@ -816,6 +860,7 @@ public:
             mainloop_pipe_consumer_state,
             work_k_tile_count
           );
+          pipeline_trace_emit_region<NumThreadsPerWarpGroup>(PipelineTraceEvent::kMainloopMma, mma_trace_start);
 
           // Update starting mainloop pipeline state for the next tile
           mainloop_pipe_consumer_state.advance(work_k_tile_count);
@@ -840,6 +885,7 @@ public:
 
         if (TileScheduler::compute_epilogue(work_tile_info, params.scheduler)) {
           // Epilogue and write to gD
+          uint64_t epi_trace_start = pipeline_trace_timestamp();
           auto [epi_load_pipe_consumer_state_next, epi_store_pipe_producer_state_next] =
           collective_epilogue.store(
             epi_load_pipeline,
@@ -855,16 +901,19 @@ public:
             shared_storage.tensors.epilogue,
             work_tile_info.reduction_subtile_idx()
           );
+          pipeline_trace_emit_region<NumThreadsPerWarpGroup>(PipelineTraceEvent::kEpilogue, epi_trace_start);
           epi_load_pipe_consumer_state = epi_load_pipe_consumer_state_next;
           epi_store_pipe_producer_state = epi_store_pipe_producer_state_next;
           do_store_tail = true;
         }
 
         // Get next work tile
+        uint64_t fetch_trace_start = pipeline_trace_timestamp();
         auto [next_work_tile_info, increment_pipe] = scheduler.fetch_next_work(work_tile_info,
                                                                           scheduler_pipeline,
                                                                           scheduler_pipe_consumer_state
                                                                           );
+        pipeline_trace_emit_region<NumThreadsPerWarpGroup>(PipelineTraceEvent::kSchedulerFetch, fetch_trace_start);
         work_tile_info = next_work_tile_info;
         if constexpr (IsSchedDynamicPersistent) { 
           if (increment_pipe) {
@@ -874,12 +923,14 @@ public:
       } // Scheduler work fetch loop
 
       if (do_store_tail) {
+        uint64_t tail_trace_start = pipeline_trace_timestamp();
         collective_epilogue.store_tail(
           epi_load_pipeline,
           epi_load_pipe_consumer_state,
           epi_store_pipeline,
           epi_store_pipe_producer_state
         );
+        pipeline_trace_emit_region<NumThreadsPerWarpGroup>(PipelineTraceEvent::kEpilogueTail, tail_trace_start);
       }
     } // Consumer Warp Groups End
 #endif
@@ -42,8 +42,10 @@
 #include "cutlass/gemm/dispatch_policy.hpp"
 #include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
 #include "cutlass/gemm/kernel/tile_scheduler.hpp"
+#include "cutlass/gemm/kernel/l2_prefetch.hpp"
 #include "cutlass/gemm/kernel/gemm_universal_decl.h"
 #include "cutlass/pipeline/pipeline.hpp"
+#include "cutlass/pipeline/pipeline_trace.hpp"
 #include "cutlass/trace.h"
 
 #include "cute/tensor.hpp"
@@ -195,6 +197,8 @@ public:
     EpilogueArguments epilogue{};
     KernelHardwareInfo hw_info{};
     TileSchedulerArguments scheduler{};
+    // Buffer prefetched into L2 once the mainloop loads are done, e.g. the next layer's weights
+    detail::L2PrefetchArguments l2_prefetch{};
   };
 
   // Kernel entry point API
@@ -205,6 +209,7 @@ public:
     EpilogueParams epilogue{};
     KernelHardwareInfo hw_info{};
     TileSchedulerParams scheduler{};
+    detail::L2PrefetchArguments l2_prefetch{};
   };
 
   //
@@ -273,7 +278,8 @@ public:
       hw_info,
       TileScheduler::to_underlying_arguments(
         problem_shape_MNKL, TileShape{}, ClusterShape{}, hw_info, args.scheduler, scheduler_workspace, NumEpilogueSubTiles
-      )
+      ),
+      args.l2_prefetch
     };
   }
 
@@ -288,6 +294,7 @@ public:
     implementable &= CollectiveMainloop::can_implement(args.problem_shape, args.mainloop);
     implementable &= CollectiveEpilogue::can_implement(args.problem_shape, args.epilogue);
     implementable &= TileScheduler::can_implement(args.scheduler, args.hw_info);
+    implementable &= detail::L2Prefetch::can_implement(args.l2_prefetch);
 
     return implementable;
   }
@@ -643,6 +650,7 @@ public:
             ++scheduler_pipe_throttle_producer_state;
           }
 
+          uint64_t load_trace_start = pipeline_trace_timestamp();
           collective_mainloop.load(
             params.mainloop,
             mainloop_pipeline,
@@ -654,6 +662,7 @@ public:
             block_rank_in_cluster,
             shared_storage.tensors.mainloop
           );
+          pipeline_trace_emit_region<NumThreadsPerWarp>(PipelineTraceEvent::kMainloopLoad, load_trace_start);
           // Update starting pipeline state for the next tile
           mainloop_pipe_producer_state.advance(k_tile_count);
 
@@ -663,6 +672,7 @@ public:
             do_load_order_arrive = false;
           }
 
+          uint64_t fetch_trace_start = pipeline_trace_timestamp();
           if constexpr (IsSchedDynamicPersistent) {  
             // Get next work tile
             auto [next_work_tile_info, increment_pipe] =
@@ -680,6 +690,7 @@ public:
           scheduler.advance_to_next_work();
           work_tile_info = scheduler.get_current_work();
           }
+          pipeline_trace_emit_region<NumThreadsPerWarp>(PipelineTraceEvent::kSchedulerFetch, fetch_trace_start);
         } // Scheduler work fetch loop
 
         // Make sure all Consumer Warp Groups have been waited upon
@@ -690,7 +701,11 @@ public:
             scheduler.fetch_next_work(
                 work_tile_info, scheduler_pipeline, scheduler_pipe_consumer_state);
         }
-        
+
+        // Nothing left to load, warm L2 for the caller while the consumers finish
+        if (lane_predicate) {
+          detail::L2Prefetch::issue(params.l2_prefetch);
+        }
       } // Mainloop Producer Warp End
 
       else if (producer_warp_role == ProducerWarpRole::MainloopAux) {
@@ -849,6 +864,7 @@ public:
         // Order two Math WG's MMA one after the other, helps hide Epilogue
         math_wg_order_barrier.wait();
 
+        uint64_t mma_trace_start = pipeline_trace_timestamp();
         if constexpr (IsSm120Family) {
           collective_mainloop.mma(
             mainloop_pipeline,
@@ -882,6 +898,7 @@ public:
           mainloop_pipe_consumer_state,
           k_tile_count
         );
+        pipeline_trace_emit_region<NumThreadsPerWarpGroup>(PipelineTraceEvent::kMainloopMma, mma_trace_start);
         // Update starting mainloop pipeline state for the next tile
         mainloop_pipe_consumer_state.advance(k_tile_count * NumMmaWarpGroups);
 
@@ -899,6 +916,7 @@ public:
         math_wg_order_barrier.wait();
 
         // Epilogue and write to gD
+        uint64_t epi_trace_start = pipeline_trace_timestamp();
         auto [epi_load_pipe_consumer_state_next, epi_store_pipe_producer_state_next] =
         collective_epilogue.store(
           epi_load_pipeline,
@@ -913,10 +931,12 @@ public:
           warp_group_thread_idx,
           shared_storage.tensors.epilogue
         );
+        pipeline_trace_emit_region<NumThreadsPerWarpGroup>(PipelineTraceEvent::kEpilogue, epi_trace_start);
 
         // TMA store pipeline wait is only visible to TMA-issuing warp, so for multiple-consumer kernels
         // we need to wait for all TMA stores to complete before issuing consumer order barrier arrives
         // to ensure next math consumer doesn't overwrite smem of in-flight TMA stores of current consumer.
+        uint64_t tail_trace_start = pipeline_trace_timestamp();
         auto [epi_load_pipe_consumer_state_next_, epi_store_pipe_producer_state_next_] =
         collective_epilogue.store_tail(
           epi_load_pipeline,
@@ -924,6 +944,7 @@ public:
           epi_store_pipeline,
           epi_store_pipe_producer_state_next
         );
+        pipeline_trace_emit_region<NumThreadsPerWarpGroup>(PipelineTraceEvent::kEpilogueTail, tail_trace_start);
 
         // Update starting load/store pipeline states for the next tile
         // state has already been incremented by 1 tile in collective calls, advance once again for ping pong
@@ -935,6 +956,7 @@ public:
         // Cue for next Math WG's Epilogue to start
         math_wg_order_barrier.arrive();
 
+        uint64_t fetch_trace_start = pipeline_trace_timestamp();
         if constexpr (IsSchedDynamicPersistent) {  
           // Get next work tile
           auto [next_work_tile_info, increment_pipe] = 
@@ -952,6 +974,7 @@ public:
         scheduler.advance_to_next_work(NumMmaWarpGroups);
         work_tile_info = scheduler.get_current_work();
         }
+        pipeline_trace_emit_region<NumThreadsPerWarpGroup>(PipelineTraceEvent::kSchedulerFetch, fetch_trace_start);
       } // Scheduler work fetch loop
     } // Consumer Warp Groups End
 #endif
@@ -0,0 +1,197 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/trace.h"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
+
+namespace cutlass::gemm::kernel::detail {
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Persistent Thread Block (TB) scheduler for GEMMs with a block-sparse A operand.
+//
+// A is stored in block compressed sparse row (BSR) format with blocks of the CTA tile shape
+// (BLK_M, BLK_K): block row m owns the non-zero blocks [block_row_offsets[m], block_row_offsets[m+1]).
+// Output tiles are mapped exactly as in PersistentTileSchedulerSm90, but every work tile carries the
+// range of non-zero blocks of its block row in place of the dense K tile range. The mainloop iterates
+// over these block positions, so the work per output tile scales with the density of its block row.
+// Tiles of empty block rows have no K tiles and only run the epilogue.
+class PersistentTileSchedulerSm90BlockSparse : public PersistentTileSchedulerSm90 {
+
+  using BaseScheduler = PersistentTileSchedulerSm90;
+  using BaseWorkTileInfo = typename BaseScheduler::WorkTileInfo;
+
+public:
+  using UnderlyingParams = typename BaseScheduler::Params;
+  using Params = PersistentTileSchedulerSm90BlockSparseParams;
+  using RasterOrder = typename BaseScheduler::RasterOrder;
+  using RasterOrderOptions = typename BaseScheduler::RasterOrderOptions;
+
+  struct WorkTileInfo : BaseWorkTileInfo {
+    // Position of the first non-zero block of the block row and the number of non-zero blocks
+    int32_t k_tile_start = 0;
+    int32_t k_tile_count = 0;
+
+    CUTLASS_HOST_DEVICE
+    static WorkTileInfo
+    invalid_work_tile() {
+      return {BaseWorkTileInfo::invalid_work_tile(), 0, 0};
+    }
+  };
+
+  struct Arguments : BaseScheduler::Arguments {
+    // Device-side BSR row offsets of A, with ceil_div(M, BLK_M) + 1 entries
+    int32_t const* block_row_offsets = nullptr;
+  };
+
+  //
+  // Static Host Methods
+  //
+
+  template <class ProblemShapeMNKL, class TileShape, class ClusterShape>
+  static Params
+  to_underlying_arguments(
+      ProblemShapeMNKL problem_shape_mnkl,
+      TileShape tile_shape,
+      ClusterShape cluster_shape,
+      KernelHardwareInfo const& hw_info,
+      Arguments const& arguments,
+      void* workspace=nullptr,
+      const uint32_t epilogue_subtile = 1,
+      uint32_t ktile_start_alignment_count = 1u) {
+
+    static_assert(cute::size<0>(ClusterShape{}) == 1,
+      "Block-sparse scheduler requires a cluster size of 1 along M.");
+
+    Params params;
+    static_cast<UnderlyingParams&>(params) = BaseScheduler::to_underlying_arguments(
+      problem_shape_mnkl, tile_shape, cluster_shape, hw_info, arguments, workspace,
+      epilogue_subtile, ktile_start_alignment_count);
+    params.block_row_offsets_ = arguments.block_row_offsets;
+    params.block_rows_ = static_cast<int32_t>(
+      cute::size(cute::ceil_div(cute::shape<0>(problem_shape_mnkl), cute::shape<0>(tile_shape))));
+    return params;
+  }
+
+  static bool
+  can_implement(Arguments const& args, KernelHardwareInfo const& hw_info) {
+    if (args.block_row_offsets == nullptr) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Block-sparse scheduler requires the BSR row offsets of A.\n");
+      return false;
+    }
+    return BaseScheduler::can_implement(args, hw_info);
+  }
+
+  //
+  // Device Methods
+  //
+
+  PersistentTileSchedulerSm90BlockSparse() = default;
+
+  CUTLASS_DEVICE explicit PersistentTileSchedulerSm90BlockSparse(Params const& params_)
+    : BaseScheduler(params_)
+    , block_row_offsets_(params_.block_row_offsets_)
+    , block_rows_(params_.block_rows_) { }
+
+  // Returns the initial work tile info that will be computed over
+  template <class ClusterShape>
+  CUTLASS_DEVICE
+  WorkTileInfo
+  initial_work_tile_info(ClusterShape) {
+    return get_current_work();
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work() const {
+    return to_block_sparse_work(BaseScheduler::get_current_work());
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work_for_linear_idx(uint64_t linear_idx) const {
+    return to_block_sparse_work(BaseScheduler::get_current_work_for_linear_idx(linear_idx));
+  }
+
+  // Kernel helper function to get next work tile. Output tiles are never split, so the next work
+  // tile always comes from the next linear index.
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(WorkTileInfo) {
+    BaseScheduler::advance_to_next_work();
+    return cute::make_tuple(get_current_work(), true);
+  }
+
+  template <class TileSchedulerPipeline, class TileSchedulerPipelineState>
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(
+      WorkTileInfo work_tile_info,
+      TileSchedulerPipeline&,
+      TileSchedulerPipelineState) {
+    return fetch_next_work(work_tile_info);
+  }
+
+  // Number of non-zero blocks in the block row of the work tile
+  template <class ProblemShape, class TileShape>
+  CUTLASS_HOST_DEVICE
+  static int
+  get_work_k_tile_count(WorkTileInfo const& work_tile_info, ProblemShape, TileShape) {
+    return work_tile_info.k_tile_count;
+  }
+
+  // Position of the first non-zero block of the block row among all blocks of A
+  CUTLASS_HOST_DEVICE
+  static uint32_t
+  get_work_k_tile_start(WorkTileInfo const& work_tile_info) {
+    return static_cast<uint32_t>(work_tile_info.k_tile_start);
+  }
+
+private:
+  CUTLASS_DEVICE
+  WorkTileInfo
+  to_block_sparse_work(BaseWorkTileInfo const& base_work) const {
+    WorkTileInfo work_tile_info{base_work, 0, 0};
+    // Tiles introduced by rounding the grid up to the cluster and swizzle sizes have no blocks
+    if (base_work.is_valid() && base_work.M_idx < block_rows_) {
+      int32_t k_tile_start = block_row_offsets_[base_work.M_idx];
+      work_tile_info.k_tile_start = k_tile_start;
+      work_tile_info.k_tile_count = block_row_offsets_[base_work.M_idx + 1] - k_tile_start;
+    }
+    return work_tile_info;
+  }
+
+  int32_t const* block_row_offsets_ = nullptr;
+  int32_t block_rows_ = 0;
+};
+
+} // namespace cutlass::gemm::kernel::detail
@@ -0,0 +1,254 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
+#include "cutlass/pipeline/sm90_pipeline.hpp"
+#include "cute/arch/cluster_sm90.hpp"
+
+namespace cutlass::gemm::kernel::detail {
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Dynamic persistent Thread Block (TB) scheduler.
+//
+// Each CTA starts on the same tile the static persistent scheduler would assign it. Subsequent
+// tiles are claimed from a global atomic counter held in the workspace rather than by striding
+// through the tile space by the grid size. CTAs that finish early therefore pick up the tiles
+// left behind by slower CTAs, which balances the tail wave when CTAs are delayed by contention
+// (e.g., co-running kernels or uneven K-loop latency). Claimed linear indices are mapped onto
+// output tiles with the same swizzle and raster order as PersistentTileSchedulerSm90.
+//
+// The scheduler warp performs the atomic and broadcasts the claimed index to the remaining warps
+// of the CTA through the scheduler pipeline in shared memory. The counters reset themselves once
+// every CTA has observed the end of the tile space, so relaunching the kernel (including from a
+// CUDA graph) does not require the workspace to be cleared again.
+template <
+  class ClusterShape_,
+  uint32_t Stages_
+>
+class PersistentTileSchedulerSm90Dynamic : public PersistentTileSchedulerSm90 {
+
+  using BaseScheduler = PersistentTileSchedulerSm90;
+
+public:
+  using ClusterShape = ClusterShape_;
+  using Params = PersistentTileSchedulerSm90DynamicParams;
+  using RasterOrder = typename BaseScheduler::RasterOrder;
+  using RasterOrderOptions = typename BaseScheduler::RasterOrderOptions;
+  using Arguments = typename BaseScheduler::Arguments;
+  using WorkTileInfo = typename BaseScheduler::WorkTileInfo;
+
+  static constexpr bool IsDynamicPersistent = true;
+
+  // SM90 dispatch policies do not pick a scheduler pipeline depth; use a double-buffered
+  // pipeline so that the next claim can be issued while the current one is consumed.
+  static constexpr uint32_t Stages = Stages_ > 0 ? Stages_ : 2;
+
+  // Claims are made independently by each CTA, which is only consistent when every CTA of a
+  // cluster works on its own cluster tile.
+  static_assert(cute::is_static_v<ClusterShape> && cute::size(ClusterShape{}) == 1,
+    "The SM90 dynamic persistent tile scheduler only supports 1x1x1 clusters.");
+
+  // Number of 64b counters held in the workspace
+  static constexpr int NumCounters = 2;
+
+  // The kernel layer sizes the scheduler pipeline transactions by the CLC response, so the
+  // claimed linear tile index takes its place.
+  struct CLCResponse { uint64_t linear_idx = 0; };
+
+  // Async pipeline that also carries the fields the kernel layer sets up for the CLC pipeline.
+  // Claims are exchanged within a CTA, so they are not used.
+  class Pipeline : public PipelineAsync<Stages> {
+    using PipelineBase = PipelineAsync<Stages>;
+  public:
+    struct Params : PipelineBase::Params {
+      uint32_t producer_blockid = 0;
+      uint32_t transaction_bytes = 0;
+    };
+
+    CUTLASS_DEVICE
+    Pipeline(typename PipelineBase::SharedStorage& storage, Params const& params)
+      : PipelineBase(storage, params) { }
+  };
+  using PipelineStorage = typename Pipeline::SharedStorage;
+
+  using ThrottlePipeline = PipelineAsync<Stages>;
+  using ThrottlePipelineStorage = typename ThrottlePipeline::SharedStorage;
+
+  class SharedStorage {
+  public:
+    CUTLASS_DEVICE PipelineStorage& pipeline() { return pipeline_; }
+    CUTLASS_DEVICE ThrottlePipelineStorage& throttle_pipeline() { return throttle_pipeline_; }
+    CUTLASS_DEVICE CLCResponse* data() { return data_; }
+
+  private:
+    alignas(16) PipelineStorage pipeline_;
+    alignas(16) ThrottlePipelineStorage throttle_pipeline_;
+    alignas(16) CLCResponse data_[Stages];
+  };
+
+  //
+  // Static Host Methods
+  //
+
+  template <class ProblemShapeMNKL, class TileShape, class ClusterShape>
+  static Params
+  to_underlying_arguments(
+      ProblemShapeMNKL problem_shape_mnkl,
+      TileShape tile_shape,
+      ClusterShape cluster_shape,
+      KernelHardwareInfo const& hw_info,
+      Arguments const& arguments,
+      void* workspace = nullptr,
+      const uint32_t epilogue_subtile = 1,
+      uint32_t ktile_start_alignment_count = 1u) {
+
+    Params params;
+    static_cast<typename BaseScheduler::Params&>(params) = BaseScheduler::to_underlying_arguments(
+      problem_shape_mnkl, tile_shape, cluster_shape, hw_info, arguments, workspace,
+      epilogue_subtile, ktile_start_alignment_count);
+    params.tile_counter_ = reinterpret_cast<uint64_t*>(workspace);
+    return params;
+  }
+
+  template <class ProblemShape, class ElementAccumulator>
+  static size_t
+  get_workspace_size(Arguments const&, ProblemShape, KernelHardwareInfo const&, uint32_t, const uint32_t = 1, uint32_t = 1) {
+    return NumCounters * sizeof(uint64_t);
+  }
+
+  // The counters only need to be cleared once; they are reset by the last CTA of each launch.
+  // Clearing is skipped when the arguments request to reuse a workspace initialized before.
+  template <class ProblemShape, class ElementAccumulator>
+  static cutlass::Status
+  initialize_workspace(Arguments const& args, void* workspace, cudaStream_t stream, ProblemShape, KernelHardwareInfo const&,
+    uint32_t, const uint32_t = 1, uint32_t = 1, CudaHostAdapter* cuda_adapter = nullptr) {
+    if (args.reuse_workspace) {
+      return Status::kSuccess;
+    }
+    return zero_workspace(workspace, NumCounters * sizeof(uint64_t), stream, cuda_adapter);
+  }
+
+  //
+  // Device Methods
+  //
+
+  CUTLASS_HOST_DEVICE
+  PersistentTileSchedulerSm90Dynamic() { }
+
+  CUTLASS_DEVICE explicit PersistentTileSchedulerSm90Dynamic(Params const& params)
+    : BaseScheduler(params)
+    , tile_counter_(params.tile_counter_) {
+#if defined(__CUDA_ARCH__)
+    total_grid_size_ = uint64_t(gridDim.x) * uint64_t(gridDim.y) * uint64_t(gridDim.z);
+#else
+    CUTLASS_ASSERT(false && "This line should never be reached");
+#endif
+  }
+
+  CUTLASS_DEVICE
+  void
+  set_data_ptr(CLCResponse* response_ptr) {
+    response_ptr_ = response_ptr;
+  }
+
+  // Claims the next linear tile index from the global counter and publishes it to the
+  // consumers of the scheduler pipeline.
+  CUTLASS_DEVICE
+  typename Pipeline::PipelineState
+  advance_to_next_work(Pipeline& scheduler_pipeline, typename Pipeline::PipelineState scheduler_pipe_producer_state) const {
+    // Wait for the response slot to be released by all consumers
+    scheduler_pipeline.producer_acquire(scheduler_pipe_producer_state);
+
+    if (cute::elect_one_sync()) {
+#if defined(__CUDA_ARCH__)
+      auto* counters = reinterpret_cast<unsigned long long*>(tile_counter_);
+      uint64_t linear_idx = total_grid_size_ + atomicAdd(&counters[0], 1ull);
+
+      if (linear_idx >= scheduler_params.blocks_per_problem_) {
+        // Each CTA running the scheduler observes the end of the tile space exactly once. CTAs
+        // whose initial tile was already out of range never claim and are not counted.
+        uint64_t active_ctas = cute::min(total_grid_size_, scheduler_params.blocks_per_problem_);
+        if (atomicAdd(&counters[1], 1ull) == active_ctas - 1) {
+          atomicExch(&counters[0], 0ull);
+          atomicExch(&counters[1], 0ull);
+        }
+      }
+
+      response_ptr_[scheduler_pipe_producer_state.index()].linear_idx = linear_idx;
+#endif
+      scheduler_pipeline.producer_commit(scheduler_pipe_producer_state);
+    }
+
+    ++scheduler_pipe_producer_state;
+    return scheduler_pipe_producer_state;
+  }
+
+  // Kernel helper function to get next work tile
+  template <class TileSchedulerPipeline, class TileSchedulerPipelineState>
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(
+      WorkTileInfo work_tile_info,
+      TileSchedulerPipeline& scheduler_pipeline,
+      TileSchedulerPipelineState scheduler_pipe_consumer_state) {
+
+    scheduler_pipeline.consumer_wait(scheduler_pipe_consumer_state);
+    uint64_t linear_idx = reinterpret_cast<CLCResponse volatile*>(response_ptr_)[scheduler_pipe_consumer_state.index()].linear_idx;
+    scheduler_pipeline.consumer_release(scheduler_pipe_consumer_state);
+
+    // Return true to indicate that the tile scheduler pipeline state should be advanced
+    return cute::make_tuple(get_current_work_for_linear_idx(linear_idx), true);
+  }
+
+  // Work tiles are always full output tiles, so a tile is never continued and the next
+  // tile is only known once it has been claimed through the pipeline.
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(WorkTileInfo work_tile_info) {
+    return cute::make_tuple(work_tile_info, true);
+  }
+
+  // Whether a tile is the last one a CTA processes is decided by other CTAs' claims.
+  CUTLASS_DEVICE
+  bool
+  is_last_tile(WorkTileInfo&, uint32_t = 1) const {
+    return false;
+  }
+
+private:
+  uint64_t* tile_counter_ = nullptr;
+  CLCResponse* response_ptr_ = nullptr;
+  uint64_t total_grid_size_ = 0;
+};
+
+} // namespace cutlass::gemm::kernel::detail
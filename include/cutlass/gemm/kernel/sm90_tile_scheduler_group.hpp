@@ -246,7 +246,7 @@ public:
   }
 
   // Calculate the log of the swizzle size based on the problem CTAs and the max swizzle size
-  CUTLASS_DEVICE
+  CUTLASS_HOST_DEVICE
   static int32_t
   get_log_swizzle_size(int problem_ctas_m, int problem_ctas_n, int max_swizzle_size) {
     int min_cta_dim = platform::min(problem_ctas_m, problem_ctas_n);
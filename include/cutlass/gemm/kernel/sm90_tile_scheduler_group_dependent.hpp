@@ -0,0 +1,258 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/barrier.h"
+#include "cutlass/trace.h"
+#include "cutlass/workspace.h"
+#include "cutlass/arch/barrier.h"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_group.hpp"
+#include "cute/arch/copy_sm90_tma.hpp"
+
+namespace cutlass::gemm::kernel::detail {
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Persistent Thread Block (TB) scheduler for grouped GEMMs whose groups form a chain (or a DAG) of
+// dependent problems, e.g. the small GEMMs of a decoder layer at decode batch sizes, executed by a
+// single persistent launch instead of one launch per GEMM.
+//
+// Output tiles are mapped exactly as by PersistentTileSchedulerSm90Group, so every CTA visits its
+// tiles in increasing group order. The A operand of group g may be the D output of an earlier group
+// ptr_producer_group[g] (a device-side array, negative for groups reading only external inputs) with
+// the same M. Each CTA counts the output tiles it completes per M tile of its group in global memory,
+// and the mainloop producer of a tile of group g waits until all N tiles of the same M tile of the
+// producer group are complete before loading A. Tiles of later groups therefore start as soon as their
+// inputs are ready, while tiles of unrelated groups proceed freely. Since each tile only waits on
+// tiles of earlier groups, and so on smaller linear work indices, the persistent grid always makes
+// progress.
+//
+// The counters live in the kernel workspace, max_tiles_m per group for up to max_groups groups, and
+// are cleared by initialize_workspace() before each run. Only the A operand is waited on; B and C must
+// not be written by the same launch.
+template <class GroupProblemShape, int SchedulerPipelineStageCount>
+class PersistentTileSchedulerSm90GroupDependent
+  : public PersistentTileSchedulerSm90Group<GroupProblemShape, SchedulerPipelineStageCount> {
+
+  using BaseScheduler = PersistentTileSchedulerSm90Group<GroupProblemShape, SchedulerPipelineStageCount>;
+
+public:
+  using WorkTileInfo = typename BaseScheduler::WorkTileInfo;
+  using ProblemShape = typename BaseScheduler::ProblemShape;
+  using UnderlyingParams = typename BaseScheduler::Params;
+  using Params = PersistentTileSchedulerSm90GroupDependentParams<GroupProblemShape>;
+  using RasterOrder = typename BaseScheduler::RasterOrder;
+  using RasterOrderOptions = typename BaseScheduler::RasterOrderOptions;
+  using SchedulerResponse = typename BaseScheduler::SchedulerResponse;
+
+  using CounterType = int32_t;
+
+  // Output tiles take much longer than a poll of the counters, so back off between polls
+  using CounterWait = cutlass::detail::BackoffWait<>;
+
+  struct Arguments : BaseScheduler::Arguments {
+    // (groups) index of the earlier group whose output D is the A operand of each group, or a negative
+    // value if none. Without it, no group waits on another and the scheduler behaves as the group scheduler.
+    int32_t const* ptr_producer_group = nullptr;
+    // Upper bounds on the number of groups and on the number of M tiles of any group, which size the counters
+    int32_t max_groups = 0;
+    int32_t max_tiles_m = 0;
+  };
+
+  //
+  // Static Host Methods
+  //
+
+  template <class TileShape, class ClusterShape>
+  static Params
+  to_underlying_arguments(
+    GroupProblemShape problem_shapes,
+    TileShape tile_shape,
+    ClusterShape cluster_shape,
+    KernelHardwareInfo const& hw_info,
+    Arguments const& arguments,
+    void* workspace=nullptr,
+    const uint32_t epilogue_subtile = 1,
+    uint32_t ktile_start_alignment_count = 1u) {
+
+    Params params;
+    static_cast<UnderlyingParams&>(params) = BaseScheduler::to_underlying_arguments(
+      problem_shapes, tile_shape, cluster_shape, hw_info, arguments, workspace,
+      epilogue_subtile, ktile_start_alignment_count);
+
+    if (arguments.ptr_producer_group == nullptr) {
+      return params;
+    }
+
+    if (problem_shapes.groups() > arguments.max_groups) {
+      CUTLASS_TRACE_HOST("to_underlying_arguments(): " << problem_shapes.groups()
+        << " groups exceed max_groups " << arguments.max_groups);
+    }
+    if (problem_shapes.is_host_problem_shape_available()) {
+      for (int32_t group_idx = 0; group_idx < problem_shapes.groups(); ++group_idx) {
+        auto problem_shape = problem_shapes.get_host_problem_shape(group_idx);
+        int tiles_m = cute::size(cute::ceil_div(cute::shape<0>(problem_shape), cute::shape<0>(tile_shape)));
+        if (tiles_m > arguments.max_tiles_m) {
+          CUTLASS_TRACE_HOST("to_underlying_arguments(): " << tiles_m << " M tiles of group " << group_idx
+            << " exceed max_tiles_m " << arguments.max_tiles_m);
+        }
+      }
+    }
+
+    params.ptr_producer_group_ = arguments.ptr_producer_group;
+    params.tile_counters_ = reinterpret_cast<CounterType*>(workspace);
+    params.max_tiles_m_ = arguments.max_tiles_m;
+    return params;
+  }
+
+  static bool
+  can_implement(Arguments const& args, KernelHardwareInfo const& hw_info) {
+    if (args.ptr_producer_group != nullptr && (args.max_groups <= 0 || args.max_tiles_m <= 0)) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Dependent group scheduler requires max_groups and max_tiles_m.\n");
+      return false;
+    }
+    return BaseScheduler::can_implement(args, hw_info);
+  }
+
+  template <class ProblemShape_, class ElementAccumulator>
+  static size_t
+  get_workspace_size(Arguments const& args, ProblemShape_, KernelHardwareInfo const&, uint32_t,
+    const uint32_t = 1, uint32_t = 1) {
+
+    if (args.ptr_producer_group == nullptr) {
+      return 0;
+    }
+    return round_nearest(size_t(args.max_groups) * size_t(args.max_tiles_m) * sizeof(CounterType), MinWorkspaceAlignment);
+  }
+
+  // The counters only ever grow within a run, so they are cleared before each run
+  template <class ProblemShape_, class ElementAccumulator>
+  static cutlass::Status
+  initialize_workspace(Arguments const& args, void* workspace, cudaStream_t stream, ProblemShape_ problem_shape,
+    KernelHardwareInfo const& hw_info, uint32_t mma_warp_groups, const uint32_t = 1, uint32_t = 1,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+
+    if (args.ptr_producer_group == nullptr) {
+      return Status::kSuccess;
+    }
+    size_t workspace_size = get_workspace_size<ProblemShape_, ElementAccumulator>(args, problem_shape, hw_info, mma_warp_groups);
+    return zero_workspace(workspace, workspace_size, stream, cuda_adapter);
+  }
+
+  //
+  // Device Methods
+  //
+
+  PersistentTileSchedulerSm90GroupDependent() = default;
+
+  CUTLASS_DEVICE explicit PersistentTileSchedulerSm90GroupDependent(Params const& params_, SchedulerResponse* response_ptr)
+    : BaseScheduler(params_, response_ptr)
+    , ptr_producer_group_(params_.ptr_producer_group_)
+    , tile_counters_(params_.tile_counters_)
+    , max_tiles_m_(params_.max_tiles_m_) { }
+
+  // Number of output tiles of a group along M and N, excluding the tiles padding the swizzle and cluster
+  CUTLASS_DEVICE
+  cute::tuple<int32_t, int32_t>
+  get_tiles_mn(int32_t group_idx) const {
+    auto const& params = this->scheduler_params;
+    ProblemShape problem_shape = params.problem_shapes_.get_problem_shape(group_idx);
+    if constexpr (is_tuple<decltype(cute::shape<0>(problem_shape))>::value ||
+                  is_tuple<decltype(cute::shape<1>(problem_shape))>::value) {
+      return cute::make_tuple(
+        static_cast<int32_t>(cute::size(cute::ceil_div(cute::shape<0>(problem_shape), params.cta_shape_.m()))),
+        static_cast<int32_t>(cute::size(cute::ceil_div(cute::shape<1>(problem_shape), params.cta_shape_.n()))));
+    }
+    else {
+      return cute::make_tuple(
+        static_cast<int32_t>(params.divmod_cta_shape_m_.divide(cute::shape<0>(problem_shape) + params.divmod_cta_shape_m_.divisor - 1)),
+        static_cast<int32_t>(params.divmod_cta_shape_n_.divide(cute::shape<1>(problem_shape) + params.divmod_cta_shape_n_.divisor - 1)));
+    }
+  }
+
+  // Waits until the rows of A read by a work tile have been written by the producer group. Called by
+  // all threads of the mainloop producer warp before the loads of the tile are issued.
+  CUTLASS_DEVICE
+  void
+  wait_for_input_tiles(WorkTileInfo const& work_tile_info) const {
+    if (ptr_producer_group_ == nullptr) {
+      return;
+    }
+    int32_t producer_group = ptr_producer_group_[work_tile_info.L_idx];
+    if (producer_group < 0) {
+      return;
+    }
+
+    auto [producer_tiles_m, producer_tiles_n] = get_tiles_mn(producer_group);
+    if (work_tile_info.M_idx >= producer_tiles_m) {
+      return;
+    }
+
+    using Barrier = cutlass::GenericBarrier<cutlass::detail::SyncwarpSync, CounterWait>;
+    int counter_idx = producer_group * max_tiles_m_ + work_tile_info.M_idx;
+    Barrier::wait_lt(tile_counters_, canonical_lane_idx(), counter_idx, producer_tiles_n);
+
+    // Order the TMA loads of A after the acquire of the counter
+    cutlass::arch::fence_view_async_global();
+  }
+
+  // Publishes a completed output tile to the groups that read it. Called by all NumThreads consumer
+  // threads after the epilogue of the tile has been issued; waits for the TMA stores of the tile to
+  // be written to global memory.
+  template <int NumThreads>
+  CUTLASS_DEVICE
+  void
+  arrive_output_tile(WorkTileInfo const& work_tile_info, int thread_idx) const {
+    if (ptr_producer_group_ == nullptr) {
+      return;
+    }
+
+    auto [tiles_m, tiles_n] = get_tiles_mn(work_tile_info.L_idx);
+    if (work_tile_info.M_idx >= tiles_m || work_tile_info.N_idx >= tiles_n) {
+      return;
+    }
+
+    cute::tma_store_wait_writes<0>();
+    cutlass::arch::fence_view_async_global();
+
+    using Barrier = cutlass::GenericBarrier<cutlass::detail::NamedBarrierSync<
+      NumThreads, static_cast<int>(cutlass::arch::ReservedNamedBarriers::EpilogueBarrier)>>;
+    int counter_idx = work_tile_info.L_idx * max_tiles_m_ + work_tile_info.M_idx;
+    Barrier::arrive_inc(tile_counters_, thread_idx, counter_idx);
+  }
+
+private:
+  int32_t const* ptr_producer_group_ = nullptr;
+  CounterType* tile_counters_ = nullptr;
+  int32_t max_tiles_m_ = 0;
+};
+
+} // namespace cutlass::gemm::kernel::detail
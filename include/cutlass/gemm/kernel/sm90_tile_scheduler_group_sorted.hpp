@@ -0,0 +1,365 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/trace.h"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_group.hpp"
+
+namespace cutlass::gemm::kernel::detail {
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Number of threads used by the group sort pre-pass kernel
+static constexpr int GroupSortThreadCount = 256;
+
+// Pre-pass for the size-sorted group scheduler. Computes the number of output tiles of every group
+// from the device-side problem shapes, writes the group indices ordered by decreasing tile count
+// (ties broken by group index) to group_order, and the exclusive prefix sum of the tile counts in
+// that order to group_tile_offsets. Runs as a single CTA.
+template <class Scheduler>
+__global__ void
+sort_groups_by_tile_count_kernel(
+    typename Scheduler::UnderlyingParams params,
+    int32_t* group_order,
+    uint64_t* group_tile_offsets) {
+
+#if defined(__CUDA_ARCH__)
+  __shared__ uint64_t shared_tile_counts[GroupSortThreadCount];
+
+  int32_t const groups = params.problem_shapes_.groups();
+  int const thread_idx = threadIdx.x;
+
+  auto get_tile_count = [&] (int32_t group_idx) -> uint64_t {
+    if (group_idx >= groups) {
+      return 0;
+    }
+    return Scheduler::get_group_info(group_idx, params.problem_shapes_.get_problem_shape(group_idx), params).total_tiles;
+  };
+
+  // Rank each group by the number of groups that are scheduled before it
+  for (int32_t group_base = 0; group_base < groups; group_base += GroupSortThreadCount) {
+    int32_t group_idx = group_base + thread_idx;
+    uint64_t tile_count = get_tile_count(group_idx);
+    int32_t rank = 0;
+
+    for (int32_t other_base = 0; other_base < groups; other_base += GroupSortThreadCount) {
+      __syncthreads();
+      shared_tile_counts[thread_idx] = get_tile_count(other_base + thread_idx);
+      __syncthreads();
+
+      int32_t other_count = cute::min(GroupSortThreadCount, groups - other_base);
+      for (int32_t i = 0; i < other_count; ++i) {
+        uint64_t other_tile_count = shared_tile_counts[i];
+        rank += (other_tile_count > tile_count ||
+                (other_tile_count == tile_count && other_base + i < group_idx)) ? 1 : 0;
+      }
+    }
+
+    if (group_idx < groups) {
+      group_order[rank] = group_idx;
+      group_tile_offsets[rank + 1] = tile_count;
+    }
+  }
+
+  __syncthreads();
+
+  // Scan the tile counts in scheduling order with a single warp
+  if (thread_idx < NumThreadsPerWarp) {
+    uint64_t running_offset = 0;
+    for (int32_t rank_base = 0; rank_base < groups; rank_base += NumThreadsPerWarp) {
+      int32_t rank = rank_base + thread_idx;
+      uint64_t offset = rank < groups ? group_tile_offsets[rank + 1] : 0;
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 1; i < NumThreadsPerWarp; i *= 2) {
+        auto n = __shfl_up_sync(0xffffffff, offset, i);
+        offset = thread_idx >= i ? offset + n : offset;
+      }
+
+      if (rank < groups) {
+        group_tile_offsets[rank + 1] = running_offset + offset;
+      }
+      running_offset += __shfl_sync(0xffffffff, offset, NumThreadsPerWarp - 1);
+    }
+
+    if (thread_idx == 0) {
+      group_tile_offsets[0] = 0;
+    }
+  }
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Persistent Thread Block (TB) scheduler for grouped GEMMs that visits groups in order of
+// decreasing tile count.
+//
+// The group scheduler walks groups in the order they are given, so when group sizes are heavily
+// skewed (e.g., MoE experts with uneven token counts) the tiles of a large group that happens to
+// come last form a long tail. This scheduler instead consumes a device-side table produced by
+// sort_groups() -- a small pre-pass kernel enqueued on the same stream ahead of the GEMM -- holding
+// the group order and the prefix sum of tile counts in that order. Linear work indices are located
+// in the table with a binary search, and tiles within a group are mapped with the same swizzle and
+// raster order as PersistentTileSchedulerSm90Group. Problem sizes are never read back to the host.
+template <class GroupProblemShape, int SchedulerPipelineStageCount>
+class PersistentTileSchedulerSm90GroupSorted
+  : public PersistentTileSchedulerSm90Group<GroupProblemShape, SchedulerPipelineStageCount> {
+
+  using BaseScheduler = PersistentTileSchedulerSm90Group<GroupProblemShape, SchedulerPipelineStageCount>;
+  using GroupInfo = typename BaseScheduler::GroupInfo;
+
+public:
+  using WorkTileInfo = typename BaseScheduler::WorkTileInfo;
+  using ProblemShape = typename BaseScheduler::ProblemShape;
+  using UnderlyingParams = typename BaseScheduler::Params;
+  using Params = PersistentTileSchedulerSm90GroupSortedParams<GroupProblemShape>;
+  using RasterOrder = typename BaseScheduler::RasterOrder;
+  using RasterOrderOptions = typename BaseScheduler::RasterOrderOptions;
+  using SchedulerResponse = typename BaseScheduler::SchedulerResponse;
+
+  struct Arguments : BaseScheduler::Arguments {
+    // Device-side group order and tile offsets written by sort_groups()
+    int32_t const* group_order = nullptr;
+    uint64_t const* group_tile_offsets = nullptr;
+  };
+
+  //
+  // Static Host Methods
+  //
+
+  template <class TileShape, class ClusterShape>
+  static Params
+  to_underlying_arguments(
+    GroupProblemShape problem_shapes,
+    TileShape tile_shape,
+    ClusterShape cluster_shape,
+    KernelHardwareInfo const& hw_info,
+    Arguments const& arguments,
+    void* workspace=nullptr,
+    const uint32_t epilogue_subtile = 1,
+    uint32_t ktile_start_alignment_count = 1u) {
+
+    Params params;
+    static_cast<UnderlyingParams&>(params) = BaseScheduler::to_underlying_arguments(
+      problem_shapes, tile_shape, cluster_shape, hw_info, arguments, workspace,
+      epilogue_subtile, ktile_start_alignment_count);
+    params.group_order_ = arguments.group_order;
+    params.group_tile_offsets_ = arguments.group_tile_offsets;
+    return params;
+  }
+
+  static bool
+  can_implement(Arguments const& args, KernelHardwareInfo const& hw_info) {
+    if (args.group_order == nullptr || args.group_tile_offsets == nullptr) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Sorted group scheduler requires the tables written by sort_groups().\n");
+      return false;
+    }
+    return BaseScheduler::can_implement(args, hw_info);
+  }
+
+  // Number of elements of the group_order and group_tile_offsets tables for a given group count
+  static size_t
+  get_group_order_size(int32_t groups) {
+    return static_cast<size_t>(groups);
+  }
+
+  static size_t
+  get_group_tile_offsets_size(int32_t groups) {
+    return static_cast<size_t>(groups) + 1;
+  }
+
+  // Enqueues the pre-pass that fills group_order and group_tile_offsets on the given stream. The
+  // tile and cluster shapes, hardware info and scheduler arguments must match those of the GEMM
+  // so that the tile counts agree with the ones the scheduler derives on the device. Only the
+  // device-side problem shapes are read.
+  template <class TileShape, class ClusterShape>
+  static Status
+  sort_groups(
+    GroupProblemShape problem_shapes,
+    TileShape tile_shape,
+    ClusterShape cluster_shape,
+    KernelHardwareInfo const& hw_info,
+    Arguments const& arguments,
+    int32_t* group_order,
+    uint64_t* group_tile_offsets,
+    cudaStream_t stream = nullptr) {
+
+    if (group_order == nullptr || group_tile_offsets == nullptr) {
+      CUTLASS_TRACE_HOST("  sort_groups(): group order tables are not allocated.\n");
+      return Status::kErrorWorkspaceNull;
+    }
+
+    UnderlyingParams params = BaseScheduler::to_underlying_arguments(
+      problem_shapes, tile_shape, cluster_shape, hw_info, arguments);
+
+#if defined(__CUDACC__)
+    sort_groups_by_tile_count_kernel<PersistentTileSchedulerSm90GroupSorted>
+      <<<1, GroupSortThreadCount, 0, stream>>>(params, group_order, group_tile_offsets);
+
+    cudaError_t result = cudaGetLastError();
+    if (result != cudaSuccess) {
+      CUTLASS_TRACE_HOST("  sort_groups(): kernel launch failed with error: " << cudaGetErrorString(result));
+      return Status::kErrorInternal;
+    }
+    return Status::kSuccess;
+#else
+    CUTLASS_UNUSED(params);
+    CUTLASS_UNUSED(stream);
+    return Status::kErrorNotSupported;
+#endif
+  }
+
+  //
+  // Device Methods
+  //
+
+  PersistentTileSchedulerSm90GroupSorted() = default;
+
+  CUTLASS_DEVICE explicit PersistentTileSchedulerSm90GroupSorted(Params const& params_, SchedulerResponse* response_ptr)
+    : BaseScheduler(params_, response_ptr)
+    , group_order_(params_.group_order_)
+    , group_tile_offsets_(params_.group_tile_offsets_) {
+    // Start without a current group so that the first lookup searches the table
+    this->current_group_info_ = GroupInfo{};
+  }
+
+  // Returns the tile count and tiling of a group as the group scheduler computes it
+  CUTLASS_DEVICE
+  static GroupInfo
+  get_group_info(int32_t group_idx, ProblemShape problem_shape, UnderlyingParams const& params) {
+    GroupInfo group_info;
+    group_info.group_idx = group_idx;
+
+    uint64_t ctas_along_m = cute::size(cute::ceil_div(cute::shape<0>(problem_shape), params.cta_shape_.m()));
+    uint64_t ctas_along_n = cute::size(cute::ceil_div(cute::shape<1>(problem_shape), params.cta_shape_.n()));
+    group_info.log_swizzle_size = BaseScheduler::get_log_swizzle_size(ctas_along_m, ctas_along_n, params.max_swizzle_size_);
+    auto problem_blocks_m = round_up(ctas_along_m, (1 << group_info.log_swizzle_size) * params.cluster_shape_.m());
+    auto problem_blocks_n = round_up(ctas_along_n, (1 << group_info.log_swizzle_size) * params.cluster_shape_.n());
+    group_info.total_tiles = problem_blocks_m * problem_blocks_n;
+    group_info.problem_blocks_along_raster_order =
+      params.raster_order_ == RasterOrder::AlongN ? problem_blocks_n : problem_blocks_m;
+    return group_info;
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work_for_linear_idx(uint64_t linear_idx) {
+    auto& params = this->scheduler_params;
+    auto& group_info = this->current_group_info_;
+    int32_t const groups = params.problem_shapes_.groups();
+
+    if (groups <= 0 || linear_idx >= group_tile_offsets_[groups]) {
+      return WorkTileInfo::invalid_work_tile();
+    }
+
+    if (linear_idx < group_info.start_linear_idx ||
+        linear_idx >= group_info.start_linear_idx + group_info.total_tiles) {
+      // Find the last group in scheduling order that starts at or before linear_idx. Groups
+      // without tiles are ordered last and never match an in-range index.
+      int32_t lo = 0;
+      int32_t hi = groups - 1;
+      while (lo < hi) {
+        int32_t mid = (lo + hi + 1) / 2;
+        if (group_tile_offsets_[mid] <= linear_idx) {
+          lo = mid;
+        }
+        else {
+          hi = mid - 1;
+        }
+      }
+
+      int32_t group_idx = group_order_[lo];
+      group_info = get_group_info(group_idx, params.problem_shapes_.get_problem_shape(group_idx), params);
+      group_info.start_linear_idx = group_tile_offsets_[lo];
+    }
+
+    // The current group covers linear_idx, so no further search takes place here
+    return BaseScheduler::template get_work_idx_m_and_n<WorkTileInfo>(
+              linear_idx,
+              group_info,
+              params.problem_shapes_,
+              this->cached_problem_shapes_,
+              params.cta_shape_,
+              params.cluster_shape_,
+              params.divmod_cluster_shape_major_,
+              params.divmod_cluster_shape_minor_,
+              params.divmod_cta_shape_m_,
+              params.divmod_cta_shape_n_,
+              params.max_swizzle_size_,
+              params.raster_order_);
+  }
+
+  template <typename TileSchedulerPipeline, typename TileSchedulerPipelineState, typename CallbackBeforeCommit = WorkTileInfo(*)(WorkTileInfo)>
+  CUTLASS_DEVICE
+  auto
+  advance_to_next_work(
+    TileSchedulerPipeline& scheduler_pipeline,
+    TileSchedulerPipelineState scheduler_pipe_producer_state,
+    uint32_t advance_count = 1,
+    CallbackBeforeCommit callback_before_commit = [] (WorkTileInfo info) { return info;}) {
+
+    this->current_work_linear_idx_ += this->total_grid_size_ * uint64_t(advance_count);
+    auto work_tile = get_current_work_for_linear_idx(this->current_work_linear_idx_);
+    using WorkTileWithCallbackInfo = decltype(callback_before_commit(work_tile));
+    WorkTileWithCallbackInfo work_tile_with_callback_info = work_tile;
+    scheduler_pipeline.producer_acquire(scheduler_pipe_producer_state);
+    if (work_tile_with_callback_info.is_valid()) {
+      work_tile_with_callback_info = callback_before_commit(work_tile);
+    }
+
+    if (cute::elect_one_sync()) {
+      reinterpret_cast<WorkTileWithCallbackInfo *>(this->response_ptr_)[scheduler_pipe_producer_state.index()] = work_tile_with_callback_info;
+      cutlass::arch::fence_view_async_shared();
+      scheduler_pipeline.producer_commit(scheduler_pipe_producer_state);
+    }
+    return cute::make_tuple(work_tile_with_callback_info, true);
+  }
+
+  // Returns the initial work tile info that will be computed over
+  template <class ClusterShape, typename CallbackBeforeCommit = WorkTileInfo(*)(WorkTileInfo)>
+  CUTLASS_DEVICE
+  auto
+  initial_work_tile_info(ClusterShape, CallbackBeforeCommit callback_before_commit = [] (WorkTileInfo response) { return response;}) {
+    auto work_tile = get_current_work_for_linear_idx(this->current_work_linear_idx_);
+    using WorkTileWithCallbackInfo = decltype(callback_before_commit(work_tile));
+    WorkTileWithCallbackInfo work_tile_with_callback_info = work_tile;
+    if (work_tile_with_callback_info.is_valid()) {
+      work_tile_with_callback_info = callback_before_commit(work_tile);
+    }
+    return work_tile_with_callback_info;
+  }
+
+private:
+  int32_t const* group_order_ = nullptr;
+  uint64_t const* group_tile_offsets_ = nullptr;
+};
+
+} // namespace cutlass::gemm::kernel::detail
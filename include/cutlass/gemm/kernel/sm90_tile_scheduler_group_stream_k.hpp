@@ -0,0 +1,515 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/barrier.h"
+#include "cutlass/block_striped.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/trace.h"
+#include "cutlass/workspace.h"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_group.hpp"
+
+namespace cutlass::gemm::kernel::detail {
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Persistent Thread Block (TB) scheduler for grouped GEMMs that splits the K dimension of the
+// output tiles of the final wave.
+//
+// When the total tile count across groups is not a multiple of the persistent grid size, the last
+// wave of the group scheduler leaves CTAs idle while a few tiles -- often of a single large group
+// with a deep K -- finish. This scheduler maps all earlier tiles exactly as PersistentTileSchedulerSm90Group
+// does and splits each of the remaining tiles into up to max_splits contiguous ranges of K tiles,
+// so that the final wave covers the grid. The splits of a tile accumulate their partials in the
+// global workspace in K order, and the final split adds them to its accumulators and computes the
+// epilogue. The decomposition is chosen on the host and therefore requires host problem shapes; it is
+// only applied for 1x1x1 clusters.
+template <class GroupProblemShape, class TileShape_, int SchedulerPipelineStageCount>
+class PersistentTileSchedulerSm90GroupStreamK
+  : public PersistentTileSchedulerSm90Group<GroupProblemShape, SchedulerPipelineStageCount> {
+
+  using BaseScheduler = PersistentTileSchedulerSm90Group<GroupProblemShape, SchedulerPipelineStageCount>;
+
+public:
+  struct WorkTileInfo {
+    int32_t M_idx = 0;
+    int32_t N_idx = 0;
+    int32_t L_idx = 0;
+    int32_t is_valid_tile = 0;
+
+    // First K tile and number of K tiles of a split output tile
+    int32_t K_idx = 0;
+    uint32_t k_tile_count = 0;
+
+    // Index of the output tile among the split output tiles, or -1 if the tile is not split
+    int32_t sk_tile_idx = -1;
+    bool is_final_sk_split = true;
+
+    CUTLASS_HOST_DEVICE
+    bool
+    is_valid() const {
+      return is_valid_tile != 0;
+    }
+
+    CUTLASS_HOST_DEVICE
+    static WorkTileInfo
+    invalid_work_tile() {
+      return {-1, -1, -1, 0};
+    }
+
+    CUTLASS_HOST_DEVICE
+    bool
+    is_split() const {
+      return sk_tile_idx >= 0;
+    }
+
+    CUTLASS_HOST_DEVICE
+    bool
+    is_final_split(uint32_t) const {
+      return is_final_sk_split;
+    }
+
+    CUTLASS_HOST_DEVICE
+    int32_t
+    reduction_subtile_idx() const {
+      return -1;
+    }
+  };
+
+  using ProblemShape = typename BaseScheduler::ProblemShape;
+  using UnderlyingParams = typename BaseScheduler::Params;
+  using Params = PersistentTileSchedulerSm90GroupStreamKParams<GroupProblemShape>;
+  using RasterOrder = typename BaseScheduler::RasterOrder;
+  using RasterOrderOptions = typename BaseScheduler::RasterOrderOptions;
+  using PipelineStorage = typename BaseScheduler::PipelineStorage;
+  using ThrottlePipelineStorage = typename BaseScheduler::ThrottlePipelineStorage;
+  using SchedulerResponse = WorkTileInfo;
+
+  class SharedStorage {
+  public:
+    CUTLASS_DEVICE PipelineStorage pipeline() { return pipeline_; }
+    // Pipeline throttle is not needed here as the scheduling is not dynamic.
+    CUTLASS_DEVICE ThrottlePipelineStorage throttle_pipeline() { return ThrottlePipelineStorage{}; }
+    CUTLASS_DEVICE SchedulerResponse* data() { return data_; }
+
+  private:
+    alignas(16) PipelineStorage pipeline_;
+    alignas(16) SchedulerResponse data_[SchedulerPipelineStageCount];
+  };
+
+  // Use a dummy barrier manager to simply get the type used to store the barrier
+  using BarrierType = typename NamedBarrierManager<1>::T;
+
+  // Splits wait on one another for whole partial tiles, so back off between polls of the locks
+  using FixupBarrierWait = cutlass::detail::BackoffWait<>;
+
+  // Locks are reserved for up to this many MMA warp groups per split output tile
+  static constexpr uint32_t MaxNumNamedBarriers = 2;
+
+  struct Arguments : BaseScheduler::Arguments {
+    // Maximum number of K splits of each output tile of the final wave. A value of 1 disables splitting.
+    int max_splits = 8;
+  };
+
+  //
+  // Static Host Methods
+  //
+
+  template <class TileShape, class ClusterShape>
+  static Params
+  to_underlying_arguments(
+    GroupProblemShape problem_shapes,
+    TileShape tile_shape,
+    ClusterShape cluster_shape,
+    KernelHardwareInfo const& hw_info,
+    Arguments const& arguments,
+    void* workspace=nullptr,
+    const uint32_t epilogue_subtile = 1,
+    uint32_t ktile_start_alignment_count = 1u) {
+
+    Params params;
+    static_cast<UnderlyingParams&>(params) = BaseScheduler::to_underlying_arguments(
+      problem_shapes, tile_shape, cluster_shape, hw_info, arguments, workspace,
+      epilogue_subtile, ktile_start_alignment_count);
+
+    if (arguments.max_splits <= 1 || cute::size(cluster_shape) != 1 ||
+        !problem_shapes.is_host_problem_shape_available() || workspace == nullptr) {
+      return params;
+    }
+
+    uint32_t max_sk_tiles = get_max_sk_tiles(hw_info);
+    params.lock_workspace_ = workspace;
+    params.reduction_workspace_ = reinterpret_cast<uint8_t*>(workspace) + get_lock_workspace_size(max_sk_tiles);
+
+    dim3 problem_blocks = BaseScheduler::get_tiled_cta_shape_mnl(problem_shapes, hw_info, tile_shape, cluster_shape);
+    dim3 grid = UnderlyingParams::get_grid_shape(
+      problem_blocks, to_gemm_coord(cluster_shape), hw_info, arguments.max_swizzle_size, arguments.raster_order,
+      /* truncate_by_problem_size = */false);
+    uint64_t grid_size = uint64_t(grid.x) * uint64_t(grid.y) * uint64_t(grid.z);
+
+    // Tile count of each group as the group scheduler computes it on the device
+    auto get_group_tiles = [&] (int32_t group_idx) -> uint64_t {
+      auto problem_shape = problem_shapes.get_host_problem_shape(group_idx);
+      int ctas_along_m = cute::size(cute::ceil_div(cute::shape<0>(problem_shape), cute::shape<0>(tile_shape)));
+      int ctas_along_n = cute::size(cute::ceil_div(cute::shape<1>(problem_shape), cute::shape<1>(tile_shape)));
+      int32_t log_swizzle_size = BaseScheduler::get_log_swizzle_size(ctas_along_m, ctas_along_n, params.max_swizzle_size_);
+      return uint64_t(round_up(ctas_along_m, 1 << log_swizzle_size)) * uint64_t(round_up(ctas_along_n, 1 << log_swizzle_size));
+    };
+
+    int32_t const groups = problem_shapes.groups();
+    uint64_t total_tiles = 0;
+    for (int32_t group_idx = 0; group_idx < groups; ++group_idx) {
+      total_tiles += get_group_tiles(group_idx);
+    }
+
+    // Tiles of the final, partial wave
+    uint64_t sk_tiles = total_tiles % grid_size;
+    if (sk_tiles == 0 || sk_tiles > max_sk_tiles) {
+      return params;
+    }
+    uint64_t sk_tile_start = total_tiles - sk_tiles;
+
+    // Split as far as the idle CTAs and the shallowest K of the groups in the final wave allow
+    uint64_t splits = cute::min(uint64_t(arguments.max_splits), grid_size / sk_tiles);
+    uint64_t group_start = 0;
+    for (int32_t group_idx = 0; group_idx < groups; ++group_idx) {
+      uint64_t group_tiles = get_group_tiles(group_idx);
+      if (group_tiles > 0 && group_start + group_tiles > sk_tile_start) {
+        auto problem_shape = problem_shapes.get_host_problem_shape(group_idx);
+        uint64_t k_tiles = cute::size(cute::ceil_div(cute::shape<2>(problem_shape), cute::shape<2>(tile_shape)));
+        splits = cute::min(splits, k_tiles);
+      }
+      group_start += group_tiles;
+    }
+
+    if (splits < 2) {
+      return params;
+    }
+
+    CUTLASS_TRACE_HOST("to_underlying_arguments(): Splitting " << sk_tiles << " of " << total_tiles
+      << " tiles " << splits << " ways along K");
+
+    params.sk_tile_start_ = sk_tile_start;
+    params.sk_tiles_ = static_cast<uint32_t>(sk_tiles);
+    params.sk_splits_ = static_cast<uint32_t>(splits);
+    return params;
+  }
+
+  // Given the inputs, computes the physical grid we should launch. When the final wave is split,
+  // the grid is not truncated by the tile count, so that the splits can occupy the whole device.
+  template<class TileShape, class ClusterShape>
+  CUTLASS_HOST_DEVICE static
+  dim3
+  get_grid_shape(
+    Params const& params,
+    GroupProblemShape const& problem_shapes,
+    TileShape tile_shape,
+    ClusterShape cluster_shape,
+    KernelHardwareInfo hw_info,
+    Arguments arguments,
+    bool truncate_by_problem_size=true) {
+
+    if (params.sk_splits_ > 1) {
+      dim3 problem_blocks = BaseScheduler::get_tiled_cta_shape_mnl(problem_shapes, hw_info, tile_shape, cluster_shape);
+      return UnderlyingParams::get_grid_shape(
+        problem_blocks, to_gemm_coord(cluster_shape), hw_info, arguments.max_swizzle_size, arguments.raster_order,
+        /* truncate_by_problem_size = */false);
+    }
+    return BaseScheduler::get_grid_shape(
+      params, problem_shapes, tile_shape, cluster_shape, hw_info, arguments, truncate_by_problem_size);
+  }
+
+  static bool
+  can_implement(Arguments const& args, KernelHardwareInfo const& hw_info) {
+    if (args.max_splits < 1) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Group stream-K scheduler requires max_splits >= 1.\n");
+      return false;
+    }
+    return BaseScheduler::can_implement(args, hw_info);
+  }
+
+  // Split output tiles never outnumber the CTAs of the persistent grid
+  static uint32_t
+  get_max_sk_tiles(KernelHardwareInfo const& hw_info) {
+    int sm_count = hw_info.sm_count;
+    if (sm_count <= 0) {
+      sm_count = KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+    }
+    return static_cast<uint32_t>(sm_count);
+  }
+
+  static size_t
+  get_lock_workspace_size(uint32_t max_sk_tiles) {
+    return round_nearest(size_t(max_sk_tiles) * MaxNumNamedBarriers * sizeof(BarrierType), MinWorkspaceAlignment);
+  }
+
+  // The workspace holds the locks and the partial accumulators of the largest possible final wave
+  template <class ProblemShape_, class ElementAccumulator>
+  static size_t
+  get_workspace_size(Arguments const& args, ProblemShape_, KernelHardwareInfo const& hw_info, uint32_t,
+    const uint32_t = 1, uint32_t = 1) {
+
+    if (args.max_splits <= 1) {
+      return 0;
+    }
+    uint32_t max_sk_tiles = get_max_sk_tiles(hw_info);
+    size_t tile_size = size_t(cute::size<0>(TileShape_{})) * size_t(cute::size<1>(TileShape_{})) * sizeof(ElementAccumulator);
+    return get_lock_workspace_size(max_sk_tiles) + size_t(max_sk_tiles) * tile_size;
+  }
+
+  // The locks are reset by the final split of each tile, so they only need clearing once here
+  template <class ProblemShape_, class ElementAccumulator>
+  static cutlass::Status
+  initialize_workspace(Arguments const& args, void* workspace, cudaStream_t stream, ProblemShape_,
+    KernelHardwareInfo const& hw_info, uint32_t, const uint32_t = 1, uint32_t = 1,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+
+    if (args.max_splits <= 1) {
+      return Status::kSuccess;
+    }
+    return zero_workspace(workspace, get_lock_workspace_size(get_max_sk_tiles(hw_info)), stream, cuda_adapter);
+  }
+
+  //
+  // Device Methods
+  //
+
+  PersistentTileSchedulerSm90GroupStreamK() = default;
+
+  CUTLASS_DEVICE explicit PersistentTileSchedulerSm90GroupStreamK(Params const& params_, SchedulerResponse* response_ptr)
+    : BaseScheduler(params_, reinterpret_cast<typename BaseScheduler::SchedulerResponse*>(response_ptr))
+    , sk_tile_start_(params_.sk_tile_start_)
+    , sk_tiles_(params_.sk_tiles_)
+    , sk_splits_(params_.sk_splits_) { }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work_for_linear_idx(uint64_t linear_idx) {
+    auto& params = this->scheduler_params;
+    bool const is_split = sk_splits_ > 1 && linear_idx >= sk_tile_start_;
+
+    // Each split output tile occupies sk_splits_ consecutive linear indices, one per split
+    uint64_t tile_linear_idx = linear_idx;
+    uint32_t split_idx = 0;
+    if (is_split) {
+      uint64_t sk_unit_idx = linear_idx - sk_tile_start_;
+      if (sk_unit_idx >= uint64_t(sk_tiles_) * sk_splits_) {
+        return WorkTileInfo::invalid_work_tile();
+      }
+      tile_linear_idx = sk_tile_start_ + sk_unit_idx / sk_splits_;
+      split_idx = static_cast<uint32_t>(sk_unit_idx % sk_splits_);
+    }
+    else if (params.pre_processed_problem_shapes && linear_idx >= params.blocks_across_problem_) {
+      return WorkTileInfo::invalid_work_tile();
+    }
+
+    WorkTileInfo work_tile_info = BaseScheduler::template get_work_idx_m_and_n<WorkTileInfo>(
+              tile_linear_idx,
+              this->current_group_info_,
+              params.problem_shapes_,
+              this->cached_problem_shapes_,
+              params.cta_shape_,
+              params.cluster_shape_,
+              params.divmod_cluster_shape_major_,
+              params.divmod_cluster_shape_minor_,
+              params.divmod_cta_shape_m_,
+              params.divmod_cta_shape_n_,
+              params.max_swizzle_size_,
+              params.raster_order_);
+
+    if (is_split && work_tile_info.is_valid()) {
+      ProblemShape problem_shape = params.problem_shapes_.get_problem_shape(work_tile_info.L_idx);
+      uint32_t k_tiles = cute::size(cute::ceil_div(cute::shape<2>(problem_shape), cute::shape<2>(TileShape_{})));
+      uint32_t k_tile_end = (split_idx + 1) * k_tiles / sk_splits_;
+      work_tile_info.K_idx = static_cast<int32_t>(split_idx * k_tiles / sk_splits_);
+      work_tile_info.k_tile_count = k_tile_end - work_tile_info.K_idx;
+      work_tile_info.sk_tile_idx = static_cast<int32_t>(tile_linear_idx - sk_tile_start_);
+      work_tile_info.is_final_sk_split = split_idx == sk_splits_ - 1;
+    }
+    return work_tile_info;
+  }
+
+  template <typename TileSchedulerPipeline, typename TileSchedulerPipelineState, typename CallbackBeforeCommit = WorkTileInfo(*)(WorkTileInfo)>
+  CUTLASS_DEVICE
+  auto
+  advance_to_next_work(
+    TileSchedulerPipeline& scheduler_pipeline,
+    TileSchedulerPipelineState scheduler_pipe_producer_state,
+    uint32_t advance_count = 1,
+    CallbackBeforeCommit callback_before_commit = [] (WorkTileInfo info) { return info;}) {
+
+    this->current_work_linear_idx_ += this->total_grid_size_ * uint64_t(advance_count);
+    auto work_tile = get_current_work_for_linear_idx(this->current_work_linear_idx_);
+    using WorkTileWithCallbackInfo = decltype(callback_before_commit(work_tile));
+    WorkTileWithCallbackInfo work_tile_with_callback_info = work_tile;
+    scheduler_pipeline.producer_acquire(scheduler_pipe_producer_state);
+    if (work_tile_with_callback_info.is_valid()) {
+      work_tile_with_callback_info = callback_before_commit(work_tile);
+    }
+
+    if (cute::elect_one_sync()) {
+      reinterpret_cast<WorkTileWithCallbackInfo *>(this->response_ptr_)[scheduler_pipe_producer_state.index()] = work_tile_with_callback_info;
+      cutlass::arch::fence_view_async_shared();
+      scheduler_pipeline.producer_commit(scheduler_pipe_producer_state);
+    }
+    return cute::make_tuple(work_tile_with_callback_info, true);
+  }
+
+  // Returns the initial work tile info that will be computed over
+  template <class ClusterShape, typename CallbackBeforeCommit = WorkTileInfo(*)(WorkTileInfo)>
+  CUTLASS_DEVICE
+  auto
+  initial_work_tile_info(ClusterShape, CallbackBeforeCommit callback_before_commit = [] (WorkTileInfo response) { return response;}) {
+    auto work_tile = get_current_work_for_linear_idx(this->current_work_linear_idx_);
+    using WorkTileWithCallbackInfo = decltype(callback_before_commit(work_tile));
+    WorkTileWithCallbackInfo work_tile_with_callback_info = work_tile;
+    if (work_tile_with_callback_info.is_valid()) {
+      work_tile_with_callback_info = callback_before_commit(work_tile);
+    }
+    return work_tile_with_callback_info;
+  }
+
+  // Kernel helper function to get next work tile
+  template <typename WorkTileWithCallbackInfo, typename TileSchedulerPipeline, typename TileSchedulerPipelineState>
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(
+    WorkTileWithCallbackInfo work_tile_with_callback_info,
+    TileSchedulerPipeline& scheduler_pipeline,
+    TileSchedulerPipelineState scheduler_pipe_consumer_state) {
+
+    scheduler_pipeline.consumer_wait(scheduler_pipe_consumer_state);
+    work_tile_with_callback_info = reinterpret_cast<WorkTileWithCallbackInfo *>(this->response_ptr_)[scheduler_pipe_consumer_state.index()];
+    cutlass::arch::fence_view_async_shared();
+    scheduler_pipeline.consumer_release(scheduler_pipe_consumer_state);
+
+    return cute::make_tuple(work_tile_with_callback_info, true);
+  }
+
+  // Only the final split of an output tile computes its epilogue
+  CUTLASS_HOST_DEVICE
+  static bool
+  compute_epilogue(WorkTileInfo const& work_tile_info, Params const&) {
+    return work_tile_info.is_final_sk_split;
+  }
+
+  CUTLASS_DEVICE
+  static bool
+  continue_current_work(WorkTileInfo&) {
+    return false;
+  }
+
+  CUTLASS_DEVICE
+  static bool
+  valid_warpgroup_in_work_tile(WorkTileInfo const&) {
+    return true;
+  }
+
+  template <class ProblemShape_MNKL, class TileShape>
+  CUTLASS_HOST_DEVICE
+  static int
+  get_work_k_tile_count(WorkTileInfo const& work_tile_info, ProblemShape_MNKL problem_shape, TileShape tile_shape) {
+    if (work_tile_info.is_split()) {
+      return static_cast<int>(work_tile_info.k_tile_count);
+    }
+    return cute::size(cute::ceil_div(cute::get<2>(problem_shape), cute::get<2>(tile_shape)));
+  }
+
+  CUTLASS_HOST_DEVICE
+  static uint32_t
+  get_work_k_tile_start(WorkTileInfo const& work_tile_info) {
+    return static_cast<uint32_t>(work_tile_info.K_idx);
+  }
+
+  // Performs the reduction across the splits of a split output tile. Splits take turns in K order:
+  // the lock of the tile counts the K tiles whose partials have been accumulated in the workspace,
+  // so each split waits until it equals its own first K tile. The first split stores its partials,
+  // later ones add theirs, and the final split adds the workspace partials to its accumulators and
+  // resets the lock. The result is therefore deterministic.
+  template <class FrgTensorC>
+  CUTLASS_DEVICE
+  static void
+  fixup(
+    Params const& params,
+    WorkTileInfo const& work_tile_info,
+    FrgTensorC& accumulators,
+    uint32_t,
+    uint32_t barrier_idx) {
+
+    if (!work_tile_info.is_split()) {
+      return;
+    }
+
+    static constexpr uint32_t Offset = static_cast<int>(cutlass::arch::ReservedNamedBarriers::StreamkBarrier0);
+    using BarrierManager = NamedBarrierManager<NumThreadsPerWarpGroup, Offset, MaxNumNamedBarriers, FixupBarrierWait>;
+    using ElementAccumulator = typename FrgTensorC::value_type;
+    using AccumulatorArrayT = Array<ElementAccumulator, size(FrgTensorC{})>;
+    using BlockStripedReduceT = BlockStripedReduce<BarrierManager::ThreadCount, AccumulatorArrayT>;
+
+    uint64_t lock_idx = uint64_t(work_tile_info.sk_tile_idx) * MaxNumNamedBarriers + barrier_idx;
+
+    // Each MMA warp group reduces its own part of the tile with BlockStripedReduce, so the
+    // start of its reduction space is the same across all of its threads
+    uint64_t reduction_offset =
+      uint64_t(cute::size<0>(TileShape_{})) * uint64_t(cute::size<1>(TileShape_{})) * uint64_t(work_tile_info.sk_tile_idx) +
+      uint64_t(size(accumulators)) * barrier_idx * BarrierManager::ThreadCount;
+
+    AccumulatorArrayT* reduction_workspace_array = reinterpret_cast<AccumulatorArrayT*>(
+      reinterpret_cast<ElementAccumulator*>(params.reduction_workspace_) + reduction_offset);
+    AccumulatorArrayT* accumulator_array = reinterpret_cast<AccumulatorArrayT*>(accumulators.data());
+
+    uint32_t barrier_group_thread_idx = threadIdx.x % BarrierManager::ThreadCount;
+
+    if (work_tile_info.K_idx == 0) {
+      // The first split initializes the partials in the workspace
+      BlockStripedReduceT::store(reduction_workspace_array, *accumulator_array, barrier_group_thread_idx);
+      BarrierManager::arrive_inc(barrier_idx, params.lock_workspace_, barrier_group_thread_idx, lock_idx, work_tile_info.k_tile_count);
+    }
+    else if (!work_tile_info.is_final_sk_split) {
+      // Wait until the preceding splits added their partials
+      BarrierManager::wait_eq(barrier_idx, params.lock_workspace_, barrier_group_thread_idx, lock_idx, work_tile_info.K_idx);
+      BlockStripedReduceT::reduce(reduction_workspace_array, *accumulator_array, barrier_group_thread_idx);
+      BarrierManager::arrive_inc(barrier_idx, params.lock_workspace_, barrier_group_thread_idx, lock_idx, work_tile_info.k_tile_count);
+    }
+    else {
+      // The final split adds the reduced partials to its accumulators and computes the epilogue
+      BarrierManager::wait_eq_reset(barrier_idx, params.lock_workspace_, barrier_group_thread_idx, lock_idx, work_tile_info.K_idx);
+      BlockStripedReduceT::load_add(*accumulator_array, reduction_workspace_array, barrier_group_thread_idx);
+    }
+  }
+
+private:
+  uint64_t sk_tile_start_ = 0;
+  uint32_t sk_tiles_ = 0;
+  uint32_t sk_splits_ = 1;
+};
+
+} // namespace cutlass::gemm::kernel::detail
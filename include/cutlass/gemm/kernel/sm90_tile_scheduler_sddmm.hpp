@@ -0,0 +1,275 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/trace.h"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
+
+namespace cutlass::gemm::kernel::detail {
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Persistent Thread Block (TB) scheduler for sampled dense-dense matrix products (SDDMM), visiting only
+// the output tiles of a block-sparse output mask.
+//
+// The mask is stored in block compressed sparse row (BSR) format with blocks of the CTA tile shape
+// (BLK_M, BLK_N), the same metadata as the A operand of the block-sparse GEMM
+// (PersistentTileSchedulerSm90BlockSparse): block row m owns the non-zero blocks
+// [block_row_offsets[m], block_row_offsets[m+1]), whose block columns are block_col_indices. The
+// underlying persistent scheduler walks a grid of one CTA along N and as many CTAs along M as there are
+// non-zero blocks, and the linear index of each CTA is mapped onto the non-zero block of the same index.
+// Every batch uses the same mask. Tiles are computed densely along K; elements of a visited tile that
+// are zero in an element-wise mask must be masked by the consumer of the output.
+class PersistentTileSchedulerSm90Sddmm : public PersistentTileSchedulerSm90 {
+
+  using BaseScheduler = PersistentTileSchedulerSm90;
+
+public:
+  using UnderlyingParams = typename BaseScheduler::Params;
+  using Params = PersistentTileSchedulerSm90SddmmParams;
+  using WorkTileInfo = typename BaseScheduler::WorkTileInfo;
+  using RasterOrder = typename BaseScheduler::RasterOrder;
+  using RasterOrderOptions = typename BaseScheduler::RasterOrderOptions;
+
+  struct Arguments : BaseScheduler::Arguments {
+    // Device-side BSR row offsets of the mask, with ceil_div(M, BLK_M) + 1 entries
+    int32_t const* block_row_offsets = nullptr;
+    // Device-side block column index of each non-zero block, sorted within each block row
+    int32_t const* block_col_indices = nullptr;
+    // Number of non-zero blocks, block_row_offsets[ceil_div(M, BLK_M)], which sizes the grid
+    int32_t num_blocks = 0;
+  };
+
+  //
+  // Static Host Methods
+  //
+
+  // Logical grid of CTAs walked by the underlying persistent scheduler. A grid without blocks still
+  // launches one CTA, which finds no work.
+  template <class ProblemShapeMNKL>
+  CUTLASS_HOST_DEVICE
+  static dim3
+  get_sddmm_cta_shape_mnl(ProblemShapeMNKL problem_shape_mnkl, int32_t num_blocks) {
+    return dim3(
+      static_cast<uint32_t>(cute::max(num_blocks, 1)),
+      1u,
+      static_cast<uint32_t>(cute::size<3>(problem_shape_mnkl)));
+  }
+
+  template <class ProblemShapeMNKL, class TileShape, class ClusterShape>
+  static Params
+  to_underlying_arguments(
+      ProblemShapeMNKL problem_shape_mnkl,
+      TileShape tile_shape,
+      ClusterShape cluster_shape,
+      KernelHardwareInfo const& hw_info,
+      Arguments const& arguments,
+      [[maybe_unused]] void* workspace=nullptr,
+      [[maybe_unused]] const uint32_t epilogue_subtile = 1,
+      [[maybe_unused]] uint32_t ktile_start_alignment_count = 1u) {
+
+    static_assert(cute::is_static<ClusterShape>::value);
+    static_assert(cute::size(ClusterShape{}) == 1,
+      "SDDMM scheduler requires a cluster size of 1, as neighbouring non-zero blocks share no operand tiles.");
+
+    auto problem_shape = cute::append<4>(problem_shape_mnkl, cute::Int<1>{});
+
+    // Swizzling is meaningless on the single column of the underlying grid
+    Params params;
+    params.initialize(
+      get_sddmm_cta_shape_mnl(problem_shape, arguments.num_blocks),
+      to_gemm_coord(cluster_shape),
+      hw_info,
+      /* max_swizzle_size = */ 1,
+      arguments.raster_order
+    );
+    params.block_row_offsets_ = arguments.block_row_offsets;
+    params.block_col_indices_ = arguments.block_col_indices;
+    params.block_rows_ = static_cast<int32_t>(
+      cute::size(cute::ceil_div(cute::shape<0>(problem_shape), cute::shape<0>(tile_shape))));
+    params.num_blocks_ = arguments.num_blocks;
+    return params;
+  }
+
+  static bool
+  can_implement(Arguments const& args, KernelHardwareInfo const& hw_info) {
+    if (args.num_blocks < 0 ||
+        (args.num_blocks > 0 && (args.block_row_offsets == nullptr || args.block_col_indices == nullptr))) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: SDDMM scheduler requires the BSR row offsets and column indices of the mask.\n");
+      return false;
+    }
+    if (args.raster_order == RasterOrderOptions::L2Aware) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: SDDMM scheduler does not support L2Aware rasterization.\n");
+      return false;
+    }
+    return BaseScheduler::can_implement(args, hw_info);
+  }
+
+  // Given the inputs, computes the physical grid we should launch.
+  template<class ProblemShapeMNKL, class BlockShape, class ClusterShape>
+  CUTLASS_HOST_DEVICE static
+  dim3
+  get_grid_shape(
+      [[maybe_unused]] Params const& params,
+      ProblemShapeMNKL problem_shape_mnk,
+      [[maybe_unused]] BlockShape cta_shape,
+      ClusterShape cluster_shape,
+      KernelHardwareInfo hw_info,
+      Arguments arguments = Arguments{},
+      [[maybe_unused]] bool truncate_by_problem_size=true) {
+
+    auto problem_shape_mnkl = cute::append<4>(problem_shape_mnk, cute::Int<1>{});
+
+    return Params::get_grid_shape(
+      get_sddmm_cta_shape_mnl(problem_shape_mnkl, arguments.num_blocks),
+      to_gemm_coord(cluster_shape),
+      hw_info,
+      /* max_swizzle_size = */ 1,
+      arguments.raster_order,
+      /* truncate_by_problem_size = */true
+    );
+  }
+
+  //
+  // Device Methods
+  //
+
+  PersistentTileSchedulerSm90Sddmm() = default;
+
+  CUTLASS_DEVICE explicit PersistentTileSchedulerSm90Sddmm(Params const& params_)
+    : BaseScheduler(params_)
+    , block_row_offsets_(params_.block_row_offsets_)
+    , block_col_indices_(params_.block_col_indices_)
+    , block_rows_(params_.block_rows_)
+    , num_blocks_(params_.num_blocks_) { }
+
+  // Returns the initial work tile info that will be computed over
+  template <class ClusterShape>
+  CUTLASS_DEVICE
+  WorkTileInfo
+  initial_work_tile_info(ClusterShape) {
+    return get_current_work();
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work() const {
+    return to_sddmm_work(BaseScheduler::get_current_work());
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work_for_linear_idx(uint64_t linear_idx) const {
+    return to_sddmm_work(BaseScheduler::get_current_work_for_linear_idx(linear_idx));
+  }
+
+  // Kernel helper function to get next work tile. Output tiles are never split, so the next work
+  // tile always comes from the next linear index.
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(WorkTileInfo) {
+    BaseScheduler::advance_to_next_work();
+    return cute::make_tuple(get_current_work(), true);
+  }
+
+  template <class TileSchedulerPipeline, class TileSchedulerPipelineState>
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(
+      WorkTileInfo work_tile_info,
+      TileSchedulerPipeline&,
+      TileSchedulerPipelineState) {
+    return fetch_next_work(work_tile_info);
+  }
+
+  // Returns the position of the block (block_row, block_col) among the non-zero blocks of the mask, or
+  // -1 if it is zero. Block columns are searched by bisection within the block row.
+  CUTLASS_HOST_DEVICE
+  static int32_t
+  find_block(int32_t const* block_row_offsets, int32_t const* block_col_indices, int32_t block_row, int32_t block_col) {
+    int32_t begin = block_row_offsets[block_row];
+    int32_t end = block_row_offsets[block_row + 1];
+    while (begin < end) {
+      int32_t mid = begin + (end - begin) / 2;
+      int32_t col = block_col_indices[mid];
+      if (col == block_col) {
+        return mid;
+      }
+      if (col < block_col) {
+        begin = mid + 1;
+      }
+      else {
+        end = mid;
+      }
+    }
+    return -1;
+  }
+
+private:
+  // Maps a work tile of the underlying grid onto the non-zero block of the same index. Its block row
+  // is the last one whose offset does not exceed the index, which skips empty block rows.
+  CUTLASS_DEVICE
+  WorkTileInfo
+  to_sddmm_work(WorkTileInfo const& base_work) const {
+    if (not base_work.is_valid()) {
+      return base_work;
+    }
+
+    int32_t block_idx = base_work.M_idx;
+    if (block_idx >= num_blocks_) {
+      return WorkTileInfo::invalid_work_tile();
+    }
+
+    int32_t lo = 0;
+    int32_t hi = block_rows_ - 1;
+    while (lo < hi) {
+      int32_t mid = lo + (hi - lo + 1) / 2;
+      if (block_row_offsets_[mid] <= block_idx) {
+        lo = mid;
+      }
+      else {
+        hi = mid - 1;
+      }
+    }
+
+    WorkTileInfo work_tile_info = base_work;
+    work_tile_info.M_idx = lo;
+    work_tile_info.N_idx = block_col_indices_[block_idx];
+    return work_tile_info;
+  }
+
+  int32_t const* block_row_offsets_ = nullptr;
+  int32_t const* block_col_indices_ = nullptr;
+  int32_t block_rows_ = 0;
+  int32_t num_blocks_ = 0;
+};
+
+} // namespace cutlass::gemm::kernel::detail
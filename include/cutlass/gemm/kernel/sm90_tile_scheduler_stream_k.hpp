@@ -84,6 +84,10 @@ public:
   // Use a dummy barrier manager to simply get the type used to store the barrier
   using BarrierType = typename NamedBarrierManager<1>::T;
 
+  // Peers wait on one another for whole partial tiles, so back off between polls of the fixup flags
+  // rather than spinning on them
+  using FixupBarrierWait = cutlass::detail::BackoffWait<>;
+
   using Params = PersistentTileSchedulerSm90StreamKParams;
   using ReductionMode = Params::ReductionMode;
   using DecompositionMode = Params::DecompositionMode;
@@ -167,6 +171,7 @@ public:
       raster_order = args.raster_order;
       reduction_mode = args.reduction_mode;
       decomposition_mode = args.decomposition_mode;
+      reuse_workspace = args.reuse_workspace;
       return *this;
     }
 
@@ -178,6 +183,7 @@ public:
       raster_order = args.raster_order;
       reduction_mode = args.reduction_mode;
       decomposition_mode = args.decomposition_mode;
+      reuse_workspace = args.reuse_workspace;
       return *this;
     }
 
@@ -199,6 +205,10 @@ public:
     RasterOrderOptions raster_order = RasterOrderOptions::Heuristic;
     ReductionMode reduction_mode = ReductionMode::Deterministic;
     DecompositionMode decomposition_mode = DecompositionMode::Heuristic;
+    // The locks used for reduction are reset by the kernel before it exits. If set, initialize_workspace()
+    // does not clear them again. This is only valid if the workspace was initialized for the same
+    // decomposition (see Params::has_same_workspace_layout()) and has not been modified since.
+    bool reuse_workspace = false;
   };
 
   // Sink scheduler params as a member
@@ -413,7 +423,7 @@ public:
     uint32_t barrier_idx) {
     static constexpr uint32_t Offset = static_cast<int>(cutlass::arch::ReservedNamedBarriers::StreamkBarrier0);
     static constexpr uint32_t MaxNumNamedBarriers = 2;
-    using BarrierManager = NamedBarrierManager<NumThreadsPerWarpGroup, Offset, MaxNumNamedBarriers>;
+    using BarrierManager = NamedBarrierManager<NumThreadsPerWarpGroup, Offset, MaxNumNamedBarriers, FixupBarrierWait>;
     return fixup_helper<FrgTensorC, BarrierManager>(
       params, work_tile_info, accumulators, num_barriers, barrier_idx);
   }
@@ -444,7 +454,17 @@ public:
     uint64_t reduction_tile_idx = tile_idx;
     uint64_t num_peers = 0;
     uint64_t reduction_peer_offset = 0;
-    if (
+    if (params.requires_separate_reduction() && params.divmod_splits_.divisor > 1) {
+      // In parallel split-K, each split writes its partials to the portion of the workspace given by
+      // its position in K, and the separate reduction unit of the tile reads the portions of all splits.
+      num_peers = params.divmod_splits_.divisor;
+      reduction_tile_idx = tile_idx * num_peers;
+      if (!work_tile_info.is_reduction_unit()) {
+        uint32_t peer_rank = tree_peer_rank(params, tile_idx, work_tile_info.K_idx);
+        reduction_peer_offset = peer_rank * cute::size<0>(TileShape{}) * cute::size<1>(TileShape{}) * num_accumulator_mtxs;
+      }
+    }
+    else if (
       params.requires_separate_reduction()
       ) {
       // If separate reduction is to be performed, each stream-K unit writes its partials
@@ -456,6 +476,18 @@ public:
       reduction_tile_idx = tile_idx * Params::max_peers_per_tile(params.sk_units_, params.sk_tiles_);
       reduction_peer_offset = peer_id_in_output_tile * cute::size<0>(TileShape{}) * cute::size<1>(TileShape{}) * num_accumulator_mtxs;
     }
+    else if (params.reduction_mode_ == ReductionMode::DeterministicTree) {
+      // Each peer other than the final split writes its partials to its own portion of the workspace,
+      // indexed by the position of the peer in K. The final split reads the portions of all peers
+      // preceding it, of which there are as many as its own position.
+      uint32_t peer_rank = tree_peer_rank(params, tile_idx, work_tile_info.K_idx);
+      num_peers = peer_rank;
+      reduction_tile_idx = tile_idx * Params::tree_reduction_peers_per_tile(
+        params.divmod_splits_.divisor, params.sk_units_, params.sk_tiles_);
+      if (!compute_epilogue(work_tile_info, params)) {
+        reduction_peer_offset = peer_rank * cute::size<0>(TileShape{}) * cute::size<1>(TileShape{}) * num_accumulator_mtxs;
+      }
+    }
 
     // Reductions use BlockStripedReduce with a width of BarrierManager::ThreadCount under the hood.
     // Thus, the start of the reduction space is the same across all threads in a warp group.
@@ -483,6 +515,9 @@ public:
     uint32_t reduction_tiles = 0;
     if (params.divmod_splits_.divisor > 1) {
       reduction_tiles = params.units_per_problem_;
+      if (params.requires_separate_reduction()) {
+        reduction_tiles *= params.divmod_splits_.divisor;
+      }
     }
     else if (
       params.requires_separate_reduction()
@@ -492,19 +527,56 @@ public:
     else {
       reduction_tiles = params.sk_tiles_;
     }
+    if (params.reduction_mode_ == ReductionMode::DeterministicTree && !params.requires_separate_reduction()) {
+      reduction_tiles *= Params::tree_reduction_peers_per_tile(
+        params.divmod_splits_.divisor, params.sk_units_, params.sk_tiles_);
+    }
 
     uint64_t reduction_workspace_size = Params::get_reduction_workspace_size(
       reduction_tiles, to_gemm_coord(TileShape{}), sizeof_bits<ElementAccumulator>::value, num_accumulator_mtxs);
     BarrierType* lock_workspace = reinterpret_cast<BarrierType*>(
       reinterpret_cast<uint8_t*>(params.reduction_workspace_) + reduction_workspace_size);
 
+    // Each lock has a single final waiter (the reduction unit or the final split of the tile), whose
+    // wait is only satisfied once all other peers have arrived. It resets the lock after the last of
+    // its accumulator matrices has waited, so that the lock workspace is clear again when the kernel
+    // exits and need not be zeroed before the next launch.
+    auto wait_final = [&](uint64_t val) {
+      if (idx_accumulator_mtxs == (num_accumulator_mtxs - 1)) {
+        BarrierManager::wait_eq_reset(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, val);
+      }
+      else {
+        BarrierManager::wait_eq(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, val);
+      }
+    };
+
     if (work_tile_info.is_reduction_unit()) {
       // Wait until the peers collaborating on this output tile have all written
       // their accumulators to workspace.
-      BarrierManager::wait_eq(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, num_peers);
+      wait_final(num_peers);
 
       separate_reduction<FrgTensorC, BarrierManager>(accumulators, num_barriers, group_reduction_workspace, barrier_group_thread_idx, num_peers, num_accumulator_mtxs);
     }
+    else if (params.reduction_mode_ == ReductionMode::DeterministicTree && !params.requires_separate_reduction()) {
+      using BlockStripedT = BlockStriped<BarrierManager::ThreadCount, AccumulatorArrayT>;
+
+      if (!compute_epilogue(work_tile_info, params)) {
+        // Peers store their partials with vectorized accesses, without waiting on one another
+        BlockStripedT::store(reduction_workspace_array, *accumulator_array, barrier_group_thread_idx);
+
+        // Signal our arrival. As in the turnstile, the barrier counts the K tiles whose partials
+        // have been written, so that the final split can wait for all of those preceding it.
+        if (idx_accumulator_mtxs == (num_accumulator_mtxs - 1)) {
+          BarrierManager::arrive_inc(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, work_tile_info.k_tile_count);
+        }
+      }
+      else {
+        // Wait until all preceding splits have written their partials
+        wait_final(work_tile_info.K_idx);
+
+        tree_reduction<FrgTensorC, BarrierManager>(accumulators, group_reduction_workspace, barrier_group_thread_idx, num_peers, num_accumulator_mtxs);
+      }
+    }
     else if (!compute_epilogue(work_tile_info, params)) {
       if (
         params.requires_separate_reduction()
@@ -543,7 +615,7 @@ public:
     }
     else {
       // Wait until the preceding split added its accumulators
-      BarrierManager::wait_eq(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, work_tile_info.K_idx);
+      wait_final(work_tile_info.K_idx);
 
       // The block computing the final split for the tile adds previously-reduced partials
       // to its accumulators and computes the epilogue.
@@ -566,6 +638,9 @@ public:
 
     AccumulatorArrayT* accumulator_array = reinterpret_cast<AccumulatorArrayT*>(accumulators.data());
 
+    // Reduction units compute no MMAs, so their accumulators hold no partials of their own
+    accumulator_array->clear();
+
     plus<AccumulatorArrayT> add_fragments;
     uint64_t peer_offset = cute::size<0>(TileShape{}) * cute::size<1>(TileShape{}) * num_accumulator_mtxs;
 
@@ -578,6 +653,122 @@ public:
     }
   }
 
+  // Adds the partials written by num_peers peers to the accumulators of the final split. Partials are
+  // loaded with vectorized accesses two peers at a time, and the sum of each pair is added to the
+  // accumulators in order of K, so the result does not depend on the order in which peers arrived.
+  template <class FrgTensorC, class BarrierManager>
+  CUTLASS_DEVICE
+  static void
+  tree_reduction(
+      FrgTensorC& accumulators,
+      typename FrgTensorC::value_type* reduction_workspace,
+      uint32_t thread_idx,
+      uint64_t num_peers,
+      uint32_t num_accumulator_mtxs) {
+    using AccumulatorArrayT = Array<typename FrgTensorC::value_type, size(FrgTensorC{})>;
+    using AccessT = StripedAccessType<AccumulatorArrayT>;
+    using AccessArrayT = Array<typename FrgTensorC::value_type, AccessT::kElements>;
+    static constexpr int Stripes = BlockStriped<BarrierManager::ThreadCount, AccumulatorArrayT, AccessT>::kStripes;
+
+    AccessArrayT* access_data = reinterpret_cast<AccessArrayT*>(accumulators.data());
+
+    plus<AccessArrayT> add;
+    uint64_t peer_offset = cute::size<0>(TileShape{}) * cute::size<1>(TileShape{}) * num_accumulator_mtxs;
+
+    uint64_t i = 0;
+    for (; i + 1 < num_peers; i += 2) {
+      AccessT const* access_peer0 = reinterpret_cast<AccessT const*>(reduction_workspace + (i * peer_offset));
+      AccessT const* access_peer1 = reinterpret_cast<AccessT const*>(reduction_workspace + ((i + 1) * peer_offset));
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int s = 0; s < Stripes; ++s) {
+        AccessArrayT pair = add(access_peer0[(BarrierManager::ThreadCount * s) + thread_idx],
+                                access_peer1[(BarrierManager::ThreadCount * s) + thread_idx]);
+        access_data[s] = add(access_data[s], pair);
+      }
+    }
+
+    if (i < num_peers) {
+      AccessT const* access_peer = reinterpret_cast<AccessT const*>(reduction_workspace + (i * peer_offset));
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int s = 0; s < Stripes; ++s) {
+        access_data[s] = add(access_data[s], access_peer[(BarrierManager::ThreadCount * s) + thread_idx]);
+      }
+    }
+  }
+
+  // Returns the position in K of the peer whose work on output tile `tile_idx` starts at k tile `k_tile`,
+  // i.e., the number of peers computing earlier K tiles of the output tile. This follows the assignment
+  // of k tiles to units in get_current_work_iter_start_possible_update_work_tile_k_remaining.
+  CUTLASS_DEVICE
+  static uint32_t
+  tree_peer_rank(Params const& params, uint64_t tile_idx, uint32_t k_tile) {
+    if (params.divmod_splits_.divisor > 1) {
+      // Splits are of equal size, except for the leading big units that compute one extra k tile
+      uint32_t big_unit_k_tiles = params.big_units_ * params.divmod_k_tiles_per_sk_big_unit_.divisor;
+      if (k_tile < big_unit_k_tiles) {
+        return params.divmod_k_tiles_per_sk_big_unit_.divide(k_tile);
+      }
+      return params.big_units_ + params.divmod_k_tiles_per_sk_unit_.divide(k_tile - big_unit_k_tiles);
+    }
+
+    if (k_tile == 0) {
+      return 0;
+    }
+
+    uint64_t tile_in_group, group_idx;
+    params.divmod_sk_groups_(tile_in_group, group_idx, params.div_cluster_size(tile_idx));
+
+    uint64_t sk_cluster_tiles_in_group = params.divmod_sk_groups_.divide(params.div_cluster_size(params.sk_tiles_));
+    if (group_idx < params.big_groups_) {
+      ++sk_cluster_tiles_in_group;
+    }
+    uint32_t k_tiles_per_output_tile = params.divmod_tiles_per_output_tile_.divisor;
+    uint64_t k_tiles_in_group = sk_cluster_tiles_in_group * params.get_cluster_size() * k_tiles_per_output_tile;
+    uint64_t k_tiles_per_unit = params.divmod_sk_units_per_group_.divide(k_tiles_in_group);
+    uint64_t big_units = params.div_cluster_size(
+      k_tiles_in_group - (k_tiles_per_unit * params.divmod_sk_units_per_group_.divisor));
+
+    // Starting k tile of unit `unit` within the group, after the adjustments that avoid
+    // splits of fewer than min_iters_per_sk_unit_ k tiles
+    auto unit_start = [&](uint64_t unit) {
+      uint64_t start = unit * k_tiles_per_unit + cute::min(unit, big_units);
+      int unused, start_tile_k_tile;
+      params.divmod_tiles_per_output_tile_(unused, start_tile_k_tile, static_cast<int>(start));
+      if (start_tile_k_tile < Params::min_iters_per_sk_unit_) {
+        start -= start_tile_k_tile;
+      }
+      else if (start_tile_k_tile > (k_tiles_per_output_tile - Params::min_iters_per_sk_unit_)) {
+        start += k_tiles_per_output_tile - start_tile_k_tile;
+      }
+      else if (params.ktile_start_alignment_count_ == 2 && start_tile_k_tile % 2 != 0) {
+        start -= 1;
+      }
+      return start;
+    };
+
+    // Find the last unit that starts at or before the beginning of the output tile. Adjustments only
+    // move the start of a unit within the output tile it falls into, so this is the unit before the
+    // first one whose unadjusted start lies beyond the beginning of the output tile.
+    uint64_t tile_start = tile_in_group * k_tiles_per_output_tile;
+    uint64_t big_unit_k_tiles = big_units * (k_tiles_per_unit + 1);
+    uint64_t unit = tile_start < big_unit_k_tiles ?
+      tile_start / (k_tiles_per_unit + 1) :
+      big_units + (tile_start - big_unit_k_tiles) / k_tiles_per_unit;
+
+    // Count the distinct peer starts within the output tile up to and including `k_tile`
+    uint32_t rank = 0;
+    uint64_t prev_start = tile_start;
+    for (uint64_t start = unit_start(++unit); start <= tile_start + k_tile; start = unit_start(++unit)) {
+      if (start > prev_start) {
+        ++rank;
+        prev_start = start;
+      }
+    }
+    return rank;
+  }
+
   // Returns whether the block assigned this work should compute the epilogue for the corresponding
   // output tile. For the case of stream-K, this should only occur if the work is marked as the final split.
   CUTLASS_HOST_DEVICE
@@ -658,6 +849,10 @@ public:
     [[maybe_unused]] uint32_t num_accumulator_mtxs = 1,
     CudaHostAdapter* cuda_adapter = nullptr) {
 
+    if (args.reuse_workspace) {
+      return Status::kSuccess;
+    }
+
     auto problem_shape_mnkl = cute::append<4>(problem_shape, 1);
 
     ClusterShape cluster_shape;
@@ -1012,16 +1207,25 @@ private:
       get_current_work_cta_m_n_in_cluster(params, linear_idx, block_id_in_cluster);
 
     uint64_t output_tile_id = linear_idx;
-    if (linear_idx >= params.units_per_problem_ * params.divmod_splits_.divisor) {
+    uint64_t split_units = params.units_per_problem_ * params.divmod_splits_.divisor;
+    if (linear_idx >= split_units) {
       // Separate-reduction work
       auto cluster_size = params.get_cluster_size();
       // Divide up the linearized separate reduction units into clusters
-      uint64_t cluster_linear_reduction_unit_idx = params.div_cluster_size((linear_idx - params.units_per_problem_));
+      uint64_t cluster_linear_reduction_unit_idx = params.div_cluster_size((linear_idx - split_units));
       uint64_t cluster_tile_idx, epi_subtile_idx;
       params.divmod_epilogue_subtile_(cluster_tile_idx, epi_subtile_idx, cluster_linear_reduction_unit_idx);
       // Bring the linearized tile ID back into the space of tiles, rather than clusters
       output_tile_id = cluster_tile_idx * cluster_size;
 
+      // Offset by the position of the CTA within the cluster, as is done for the units computing the tile
+      if (params.raster_order_ == RasterOrder::AlongN) {
+        output_tile_id += cta_n_in_cluster * params.divmod_cluster_shape_minor_.divisor;
+      }
+      else {
+        output_tile_id += cta_m_in_cluster * params.divmod_cluster_shape_minor_.divisor;
+      }
+
       work_tile_info.setup_separate_reduction(epi_subtile_idx);
     }
     else if (linear_idx >= params.sk_units_ && params.divmod_splits_.divisor == 1) {
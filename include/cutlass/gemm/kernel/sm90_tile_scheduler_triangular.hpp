@@ -0,0 +1,286 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/blas3_types.h"
+#include "cutlass/trace.h"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
+
+namespace cutlass::gemm::kernel::detail {
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Persistent Thread Block (TB) scheduler visiting only the output tiles of one triangle of the output,
+// as needed by symmetric rank-k (SYRK) and rank-2k (SYR2K) updates.
+//
+// Work is assigned in units of cluster tiles. A cluster tile at cluster coordinates (i, j) is visited
+// if it intersects the lower (i >= j) or upper (i <= j) triangle selected by FillMode_. Cluster tiles
+// must be square, so that these are exactly the tiles intersecting the triangle of elements below or
+// above the diagonal. Elements of visited tiles lying outside of the triangle are computed as well and
+// must be masked by the epilogue (see fusion::LinCombTriangular).
+//
+// The underlying persistent scheduler walks a grid of as many clusters along M as there are visited
+// cluster tiles, and one cluster along N. The linear index of each of its clusters is mapped onto the
+// tiles of the triangle row by row, so the number of CTAs launched and the number of tiles visited
+// are about half of those of a full GEMM.
+template <FillMode FillMode_>
+class PersistentTileSchedulerSm90Triangular : public PersistentTileSchedulerSm90 {
+
+  using BaseScheduler = PersistentTileSchedulerSm90;
+
+  static_assert(FillMode_ == FillMode::kLower || FillMode_ == FillMode::kUpper,
+    "Triangular scheduler requires FillMode::kLower or FillMode::kUpper.");
+
+public:
+  static constexpr FillMode kFillMode = FillMode_;
+
+  using UnderlyingParams = typename BaseScheduler::Params;
+  using Params = PersistentTileSchedulerSm90TriangularParams;
+  using WorkTileInfo = typename BaseScheduler::WorkTileInfo;
+  using Arguments = typename BaseScheduler::Arguments;
+  using RasterOrder = typename BaseScheduler::RasterOrder;
+  using RasterOrderOptions = typename BaseScheduler::RasterOrderOptions;
+
+  //
+  // Static Host Methods
+  //
+
+  // Number of cluster tiles (i, j) with j <= i of a rows x cols grid
+  CUTLASS_HOST_DEVICE
+  static uint64_t
+  get_triangle_cluster_count(int32_t rows, int32_t cols) {
+    uint64_t diagonal = static_cast<uint64_t>(cute::min(rows, cols));
+    uint64_t count = diagonal * (diagonal + 1) / 2;
+    if (rows > cols) {
+      count += static_cast<uint64_t>(rows - cols) * static_cast<uint64_t>(cols);
+    }
+    return count;
+  }
+
+  // Extents (rows, cols) of the grid of cluster tiles, oriented such that the triangle is the lower one
+  template <class ProblemShapeMNKL, class TileShape, class ClusterShape>
+  CUTLASS_HOST_DEVICE
+  static cute::tuple<int32_t, int32_t>
+  get_oriented_cluster_grid(ProblemShapeMNKL problem_shape_mnkl, TileShape tile_shape, ClusterShape cluster_shape) {
+    auto clusters_m = static_cast<int32_t>(cute::ceil_div(
+      cute::size(cute::ceil_div(cute::shape<0>(problem_shape_mnkl), cute::shape<0>(tile_shape))), cute::size<0>(cluster_shape)));
+    auto clusters_n = static_cast<int32_t>(cute::ceil_div(
+      cute::size(cute::ceil_div(cute::shape<1>(problem_shape_mnkl), cute::shape<1>(tile_shape))), cute::size<1>(cluster_shape)));
+    if constexpr (kFillMode == FillMode::kLower) {
+      return {clusters_m, clusters_n};
+    }
+    else {
+      return {clusters_n, clusters_m};
+    }
+  }
+
+  // Logical grid of CTAs walked by the underlying persistent scheduler
+  template <class ProblemShapeMNKL, class TileShape, class ClusterShape>
+  CUTLASS_HOST_DEVICE
+  static dim3
+  get_triangular_cta_shape_mnl(ProblemShapeMNKL problem_shape_mnkl, TileShape tile_shape, ClusterShape cluster_shape) {
+    auto [rows, cols] = get_oriented_cluster_grid(problem_shape_mnkl, tile_shape, cluster_shape);
+    uint64_t triangle_clusters = get_triangle_cluster_count(rows, cols);
+    return dim3(
+      static_cast<uint32_t>(triangle_clusters * cute::size<0>(cluster_shape)),
+      static_cast<uint32_t>(cute::size<1>(cluster_shape)),
+      static_cast<uint32_t>(cute::size<3>(problem_shape_mnkl)));
+  }
+
+  template <class ProblemShapeMNKL, class TileShape, class ClusterShape>
+  static Params
+  to_underlying_arguments(
+      ProblemShapeMNKL problem_shape_mnkl,
+      TileShape tile_shape,
+      ClusterShape cluster_shape,
+      KernelHardwareInfo const& hw_info,
+      Arguments const& arguments,
+      [[maybe_unused]] void* workspace=nullptr,
+      [[maybe_unused]] const uint32_t epilogue_subtile = 1,
+      [[maybe_unused]] uint32_t ktile_start_alignment_count = 1u) {
+
+    static_assert(cute::is_static<TileShape>::value);
+    static_assert(cute::is_static<ClusterShape>::value);
+    static_assert(cute::size<0>(TileShape{}) * cute::size<0>(ClusterShape{}) ==
+                  cute::size<1>(TileShape{}) * cute::size<1>(ClusterShape{}),
+      "Triangular scheduler requires cluster tiles of equal extents along M and N.");
+
+    auto problem_shape = cute::append<4>(problem_shape_mnkl, cute::Int<1>{});
+    auto [rows, cols] = get_oriented_cluster_grid(problem_shape, tile_shape, cluster_shape);
+
+    // Swizzling is meaningless on the single cluster column of the underlying grid
+    Params params;
+    params.initialize(
+      get_triangular_cta_shape_mnl(problem_shape, tile_shape, cluster_shape),
+      to_gemm_coord(cluster_shape),
+      hw_info,
+      /* max_swizzle_size = */ 1,
+      arguments.raster_order
+    );
+    params.rows_ = rows;
+    params.cols_ = cols;
+    return params;
+  }
+
+  static bool
+  can_implement(Arguments const& args, KernelHardwareInfo const& hw_info) {
+    if (args.raster_order == RasterOrderOptions::L2Aware) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Triangular scheduler does not support L2Aware rasterization.\n");
+      return false;
+    }
+    return BaseScheduler::can_implement(args, hw_info);
+  }
+
+  // Given the inputs, computes the physical grid we should launch.
+  template<class ProblemShapeMNKL, class BlockShape, class ClusterShape>
+  CUTLASS_HOST_DEVICE static
+  dim3
+  get_grid_shape(
+      [[maybe_unused]] Params const& params,
+      ProblemShapeMNKL problem_shape_mnk,
+      BlockShape cta_shape,
+      ClusterShape cluster_shape,
+      KernelHardwareInfo hw_info,
+      Arguments arguments = Arguments{},
+      [[maybe_unused]] bool truncate_by_problem_size=true) {
+
+    auto problem_shape_mnkl = cute::append<4>(problem_shape_mnk, cute::Int<1>{});
+
+    return Params::get_grid_shape(
+      get_triangular_cta_shape_mnl(problem_shape_mnkl, cta_shape, cluster_shape),
+      to_gemm_coord(cluster_shape),
+      hw_info,
+      /* max_swizzle_size = */ 1,
+      arguments.raster_order,
+      /* truncate_by_problem_size = */true
+    );
+  }
+
+  //
+  // Device Methods
+  //
+
+  PersistentTileSchedulerSm90Triangular() = default;
+
+  CUTLASS_DEVICE explicit PersistentTileSchedulerSm90Triangular(Params const& params_)
+    : BaseScheduler(params_)
+    , rows_(params_.rows_)
+    , cols_(params_.cols_) { }
+
+  // Returns the initial work tile info that will be computed over
+  template <class ClusterShape>
+  CUTLASS_DEVICE
+  WorkTileInfo
+  initial_work_tile_info(ClusterShape) {
+    return get_current_work();
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work() const {
+    return to_triangular_work(BaseScheduler::get_current_work());
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work_for_linear_idx(uint64_t linear_idx) const {
+    return to_triangular_work(BaseScheduler::get_current_work_for_linear_idx(linear_idx));
+  }
+
+  // Kernel helper function to get next work tile. Output tiles are never split, so the next work
+  // tile always comes from the next linear index.
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(WorkTileInfo) {
+    BaseScheduler::advance_to_next_work();
+    return cute::make_tuple(get_current_work(), true);
+  }
+
+  template <class TileSchedulerPipeline, class TileSchedulerPipelineState>
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(
+      WorkTileInfo work_tile_info,
+      TileSchedulerPipeline&,
+      TileSchedulerPipelineState) {
+    return fetch_next_work(work_tile_info);
+  }
+
+private:
+  // Maps a work tile of the underlying grid onto the cluster tile of the triangle of the same index.
+  // Offsets of the CTA within its cluster are kept.
+  CUTLASS_DEVICE
+  WorkTileInfo
+  to_triangular_work(WorkTileInfo const& base_work) const {
+    if (not base_work.is_valid()) {
+      return base_work;
+    }
+
+    int32_t cluster_m = static_cast<int32_t>(scheduler_params.cluster_shape_m_);
+    int32_t cluster_n = static_cast<int32_t>(scheduler_params.cluster_shape_n_);
+    uint64_t idx = static_cast<uint64_t>(base_work.M_idx / cluster_m);
+
+    // Rows of the square part of the triangle hold i + 1 cluster tiles, the following ones hold cols_
+    int32_t row, col;
+    uint64_t diagonal = static_cast<uint64_t>(cute::min(rows_, cols_));
+    uint64_t square_clusters = diagonal * (diagonal + 1) / 2;
+    if (idx < square_clusters) {
+      uint64_t r = static_cast<uint64_t>((cutlass::fast_sqrt(8.0 * static_cast<double>(idx) + 1.0) - 1.0) / 2.0);
+      // Correct for rounding of the floating-point square root
+      while (r * (r + 1) / 2 > idx) {
+        --r;
+      }
+      while ((r + 1) * (r + 2) / 2 <= idx) {
+        ++r;
+      }
+      row = static_cast<int32_t>(r);
+      col = static_cast<int32_t>(idx - r * (r + 1) / 2);
+    }
+    else {
+      uint64_t rest = idx - square_clusters;
+      row = static_cast<int32_t>(diagonal + rest / static_cast<uint64_t>(cols_));
+      col = static_cast<int32_t>(rest % static_cast<uint64_t>(cols_));
+    }
+
+    int32_t cluster_idx_m = kFillMode == FillMode::kLower ? row : col;
+    int32_t cluster_idx_n = kFillMode == FillMode::kLower ? col : row;
+
+    WorkTileInfo work_tile_info = base_work;
+    work_tile_info.M_idx = cluster_idx_m * cluster_m + base_work.M_idx % cluster_m;
+    work_tile_info.N_idx = cluster_idx_n * cluster_n + base_work.N_idx;
+    return work_tile_info;
+  }
+
+  int32_t rows_ = 0;
+  int32_t cols_ = 0;
+};
+
+} // namespace cutlass::gemm::kernel::detail
@@ -0,0 +1,217 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+#pragma once
+
+#include "cutlass/blas3_types.h"
+#include "cutlass/trace.h"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
+
+namespace cutlass::gemm::kernel::detail {
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Persistent Thread Block (TB) scheduler for products with a triangular operand, as in TRMM and SYMM.
+//
+// The triangular operand is square and is A (SideMode::kLeft, K == M) or B (SideMode::kRight, K == N).
+// Output tiles are mapped exactly as in PersistentTileSchedulerSm90, but every work tile carries the
+// range of K tiles in which the row block (left) or column block (right) of the triangular operand it
+// reads is not entirely zero. For a row block of A at M tile m and R = BLK_M / BLK_K, a lower A has
+// non-zero K tiles [0, (m+1)*R) and an upper A has non-zero K tiles [m*R, k_tiles). The mainloop only
+// loads and multiplies these K tiles, so a TRMM costs about half of the equivalent GEMM. Elements of
+// the R K tiles overlapping the diagonal block lying in the zero triangle are masked by the mainloop
+// (see MainloopSm90TmaGmmaWarpSpecializedTriangularOperand).
+template <SideMode SideMode_, FillMode FillMode_>
+class PersistentTileSchedulerSm90TriangularOperand : public PersistentTileSchedulerSm90 {
+
+  using BaseScheduler = PersistentTileSchedulerSm90;
+  using BaseWorkTileInfo = typename BaseScheduler::WorkTileInfo;
+
+  static_assert(SideMode_ == SideMode::kLeft || SideMode_ == SideMode::kRight,
+    "Triangular operand scheduler requires SideMode::kLeft or SideMode::kRight.");
+  static_assert(FillMode_ == FillMode::kLower || FillMode_ == FillMode::kUpper,
+    "Triangular operand scheduler requires FillMode::kLower or FillMode::kUpper.");
+
+public:
+  static constexpr SideMode kSideMode = SideMode_;
+  static constexpr FillMode kFillMode = FillMode_;
+
+  // Whether the non-zero K tiles of a block lead up to the diagonal block (lower A, upper B), rather
+  // than start from it (upper A, lower B)
+  static constexpr bool kTrailingDiagonal =
+    (kSideMode == SideMode::kLeft) == (kFillMode == FillMode::kLower);
+
+  using UnderlyingParams = typename BaseScheduler::Params;
+  using Params = PersistentTileSchedulerSm90TriangularOperandParams;
+  using Arguments = typename BaseScheduler::Arguments;
+  using RasterOrder = typename BaseScheduler::RasterOrder;
+  using RasterOrderOptions = typename BaseScheduler::RasterOrderOptions;
+
+  struct WorkTileInfo : BaseWorkTileInfo {
+    // First K tile and number of K tiles of the non-zero blocks of the triangular operand
+    int32_t k_tile_start = 0;
+    int32_t k_tile_count = 0;
+
+    CUTLASS_HOST_DEVICE
+    static WorkTileInfo
+    invalid_work_tile() {
+      return {BaseWorkTileInfo::invalid_work_tile(), 0, 0};
+    }
+  };
+
+  //
+  // Static Host Methods
+  //
+
+  template <class ProblemShapeMNKL, class TileShape, class ClusterShape>
+  static Params
+  to_underlying_arguments(
+      ProblemShapeMNKL problem_shape_mnkl,
+      TileShape tile_shape,
+      ClusterShape cluster_shape,
+      KernelHardwareInfo const& hw_info,
+      Arguments const& arguments,
+      void* workspace=nullptr,
+      const uint32_t epilogue_subtile = 1,
+      uint32_t ktile_start_alignment_count = 1u) {
+
+    // The tile extent of the triangular operand along M (left) or N (right)
+    constexpr int TriangularMode = kSideMode == SideMode::kLeft ? 0 : 1;
+    static_assert(cute::is_static<TileShape>::value);
+    static_assert(cute::size<TriangularMode>(TileShape{}) % cute::size<2>(TileShape{}) == 0,
+      "Triangular operand scheduler requires the tile extent of the triangular operand to be a multiple of the K tile.");
+    // Tiles of a cluster along this mode have different K ranges and cannot share the other operand
+    static_assert(cute::size<TriangularMode>(ClusterShape{}) == 1,
+      "Triangular operand scheduler requires a cluster size of 1 along the mode of the triangular operand.");
+
+    Params params;
+    static_cast<UnderlyingParams&>(params) = BaseScheduler::to_underlying_arguments(
+      problem_shape_mnkl, tile_shape, cluster_shape, hw_info, arguments, workspace,
+      epilogue_subtile, ktile_start_alignment_count);
+    params.k_tiles_ = static_cast<int32_t>(
+      cute::size(cute::ceil_div(cute::shape<2>(problem_shape_mnkl), cute::shape<2>(tile_shape))));
+    params.diagonal_k_tiles_ = static_cast<int32_t>(
+      cute::size<TriangularMode>(TileShape{}) / cute::size<2>(TileShape{}));
+    return params;
+  }
+
+  //
+  // Device Methods
+  //
+
+  PersistentTileSchedulerSm90TriangularOperand() = default;
+
+  CUTLASS_DEVICE explicit PersistentTileSchedulerSm90TriangularOperand(Params const& params_)
+    : BaseScheduler(params_)
+    , k_tiles_(params_.k_tiles_)
+    , diagonal_k_tiles_(params_.diagonal_k_tiles_) { }
+
+  // Returns the initial work tile info that will be computed over
+  template <class ClusterShape>
+  CUTLASS_DEVICE
+  WorkTileInfo
+  initial_work_tile_info(ClusterShape) {
+    return get_current_work();
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work() const {
+    return to_triangular_operand_work(BaseScheduler::get_current_work());
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work_for_linear_idx(uint64_t linear_idx) const {
+    return to_triangular_operand_work(BaseScheduler::get_current_work_for_linear_idx(linear_idx));
+  }
+
+  // Kernel helper function to get next work tile. Output tiles are never split, so the next work
+  // tile always comes from the next linear index.
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(WorkTileInfo) {
+    BaseScheduler::advance_to_next_work();
+    return cute::make_tuple(get_current_work(), true);
+  }
+
+  template <class TileSchedulerPipeline, class TileSchedulerPipelineState>
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(
+      WorkTileInfo work_tile_info,
+      TileSchedulerPipeline&,
+      TileSchedulerPipelineState) {
+    return fetch_next_work(work_tile_info);
+  }
+
+  // Number of non-zero K tiles of the block of the triangular operand read by the work tile
+  template <class ProblemShape, class TileShape>
+  CUTLASS_HOST_DEVICE
+  static int
+  get_work_k_tile_count(WorkTileInfo const& work_tile_info, ProblemShape, TileShape) {
+    return work_tile_info.k_tile_count;
+  }
+
+  // First non-zero K tile of the block of the triangular operand read by the work tile
+  CUTLASS_HOST_DEVICE
+  static uint32_t
+  get_work_k_tile_start(WorkTileInfo const& work_tile_info) {
+    return static_cast<uint32_t>(work_tile_info.k_tile_start);
+  }
+
+private:
+  CUTLASS_DEVICE
+  WorkTileInfo
+  to_triangular_operand_work(BaseWorkTileInfo const& base_work) const {
+    WorkTileInfo work_tile_info{base_work, 0, 0};
+    if (!base_work.is_valid()) {
+      return work_tile_info;
+    }
+    int32_t diagonal_k_tile = (kSideMode == SideMode::kLeft ? base_work.M_idx : base_work.N_idx) * diagonal_k_tiles_;
+    // Tiles introduced by rounding the grid up to the cluster and swizzle sizes have no K tiles
+    if (diagonal_k_tile < k_tiles_) {
+      if constexpr (kTrailingDiagonal) {
+        work_tile_info.k_tile_count = cute::min(k_tiles_, diagonal_k_tile + diagonal_k_tiles_);
+      }
+      else {
+        work_tile_info.k_tile_start = diagonal_k_tile;
+        work_tile_info.k_tile_count = k_tiles_ - diagonal_k_tile;
+      }
+    }
+    return work_tile_info;
+  }
+
+  int32_t k_tiles_ = 0;
+  int32_t diagonal_k_tiles_ = 0;
+};
+
+} // namespace cutlass::gemm::kernel::detail
@@ -92,6 +92,9 @@ public:
   struct Arguments {
     int max_swizzle_size = 1;
     RasterOrderOptions raster_order = RasterOrderOptions::Heuristic;
+    // Only read by schedulers whose workspace is reset by the kernel before it exits (e.g., the
+    // dynamic persistent scheduler). If set, initialize_workspace() does not clear it again.
+    bool reuse_workspace = false;
   };
 
   template <class ProblemShapeMNKL, class TileShape, class ClusterShape>
@@ -112,13 +115,17 @@ public:
 
     dim3 problem_blocks = get_tiled_cta_shape_mnl(problem_shape_mnkl, tile_shape, cluster_shape);
 
+    uint64_t problem_k = static_cast<uint64_t>(cute::size(cute::get<2>(problem_shape_mnkl)));
+
     Params params;
     params.initialize(
       problem_blocks,
       to_gemm_coord(cluster_shape),
       hw_info,
       arguments.max_swizzle_size,
-      arguments.raster_order
+      arguments.raster_order,
+      Params::get_operand_panel_bytes(cute::size<0>(tile_shape), problem_k),
+      Params::get_operand_panel_bytes(cute::size<1>(tile_shape), problem_k)
     );
 
     return params;
@@ -36,6 +36,7 @@
 */
 
 #include "cutlass/arch/arch.h"
+#include "cutlass/blas3_types.h"
 #include "cutlass/detail/dependent_false.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -52,10 +53,46 @@ struct StreamKScheduler { };
 
 struct GroupScheduler { }; // Only used for Grouped GEMMs
 
+struct SortedGroupScheduler : GroupScheduler { }; // Grouped GEMMs visiting the largest groups first
+
+struct GroupStreamKScheduler : GroupScheduler { }; // Grouped GEMMs splitting the K dimension of final-wave tiles (SM90 cooperative)
+
+struct DependentGroupScheduler : GroupScheduler { }; // Grouped GEMMs whose groups read the outputs of earlier groups (SM90 cooperative)
+
+struct DynamicGroupScheduler : GroupScheduler { }; // Grouped GEMMs balanced by cluster launch control (SM100)
+
+struct ExpertArrivalGroupScheduler : GroupScheduler { }; // Grouped GEMMs whose A rows are pushed in by other devices, as for expert-parallel MoE (SM100)
+
 struct DynamicPersistentScheduler { };
 
 struct StaticPersistentScheduler { };
 
+struct BlockSparseScheduler { }; // Only used with block-sparse (BSR) A operands
+
+struct SddmmScheduler { }; // Visits only the output tiles of a block-sparse (BSR) output mask, as for SDDMM
+
+// Splits the K dimension of each output tile across the CTAs of a (Splits,1,1) cluster and reduces the
+// partial accumulators through distributed shared memory (SM90 non-persistent warp-specialized)
+template <int Splits>
+struct ClusterSplitKScheduler {
+  static_assert(Splits == 2 || Splits == 4, "Cluster split-K supports 2 or 4 splits.");
+  static constexpr int kSplits = Splits;
+};
+
+// Visits only the output tiles of the lower or upper triangle, as for rank-k updates (SYRK, SYR2K)
+template <FillMode FillMode_>
+struct TriangularScheduler {
+  static constexpr FillMode kFillMode = FillMode_;
+};
+
+// Visits the K tiles of the non-zero blocks of a square triangular A (left) or B (right) operand, as for
+// products with a triangular or symmetric operand (TRMM, SYMM)
+template <SideMode SideMode_, FillMode FillMode_>
+struct TriangularOperandScheduler {
+  static constexpr SideMode kSideMode = SideMode_;
+  static constexpr FillMode kFillMode = FillMode_;
+};
+
 } // namespace cutlass::gemm
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -64,13 +101,32 @@ struct StaticPersistentScheduler { };
 
 #include "cutlass/gemm/kernel/sm90_tile_scheduler_stream_k.hpp"
 #include "cutlass/gemm/kernel/sm90_tile_scheduler_group.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_group_sorted.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_group_stream_k.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_group_dependent.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_dynamic.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_block_sparse.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_sddmm.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_triangular.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_triangular_operand.hpp"
 #include "cutlass/gemm/kernel/sm100_tile_scheduler.hpp"            
 #include "cutlass/gemm/kernel/sm100_tile_scheduler_stream_k.hpp"   
 #include "cutlass/gemm/kernel/sm100_tile_scheduler_group.hpp"      
+#include "cutlass/gemm/kernel/sm100_tile_scheduler_group_dynamic.hpp"
+#include "cutlass/gemm/kernel/sm100_tile_scheduler_group_expert_arrival.hpp"
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace cutlass::gemm::kernel::detail {
 
+template <class TileSchedulerTag>
+struct is_cluster_split_k_scheduler : cute::false_type { };
+
+template <int Splits>
+struct is_cluster_split_k_scheduler<ClusterSplitKScheduler<Splits>> : cute::true_type { };
+
+template <class TileSchedulerTag>
+constexpr bool is_cluster_split_k_scheduler_v = is_cluster_split_k_scheduler<TileSchedulerTag>::value;
+
 //
 // Selectors mapping tile scheduler tag and arch tag to a tile scheduler class
 //
@@ -142,6 +198,23 @@ struct TileSchedulerSelector<
   using Scheduler = PersistentTileSchedulerSm90StreamK<TileShape, ClusterShape>;
 };
 
+// Cluster split-K launches one cluster per output tile; the scheduler only supplies the arguments
+template <
+  int Splits,
+  class TileShape,
+  class ClusterShape
+  , uint32_t SchedulerPipelineStageCount
+>
+struct TileSchedulerSelector<
+    ClusterSplitKScheduler<Splits>,
+    arch::Sm90,
+    TileShape,
+    ClusterShape
+    , SchedulerPipelineStageCount
+  > {
+  using Scheduler = PersistentTileSchedulerSm90;
+};
+
 template <
   class ArchTag,
   class TileShape,
@@ -158,6 +231,89 @@ struct TileSchedulerSelector<
   using Scheduler = PersistentTileSchedulerSm90;
 };
 
+// SM90 dynamic tile scheduler
+template <
+  class TileShape,
+  class ClusterShape,
+  uint32_t SchedulerPipelineStageCount
+>
+struct TileSchedulerSelector<
+    DynamicPersistentScheduler,
+    arch::Sm90,
+    TileShape,
+    ClusterShape
+    , SchedulerPipelineStageCount
+  > {
+  using Scheduler = PersistentTileSchedulerSm90Dynamic<ClusterShape, SchedulerPipelineStageCount>;
+};
+
+// SM90 block-sparse tile scheduler
+template <
+  class TileShape,
+  class ClusterShape,
+  uint32_t SchedulerPipelineStageCount
+>
+struct TileSchedulerSelector<
+    BlockSparseScheduler,
+    arch::Sm90,
+    TileShape,
+    ClusterShape
+    , SchedulerPipelineStageCount
+  > {
+  using Scheduler = PersistentTileSchedulerSm90BlockSparse;
+};
+
+// SM90 SDDMM tile scheduler
+template <
+  class TileShape,
+  class ClusterShape,
+  uint32_t SchedulerPipelineStageCount
+>
+struct TileSchedulerSelector<
+    SddmmScheduler,
+    arch::Sm90,
+    TileShape,
+    ClusterShape
+    , SchedulerPipelineStageCount
+  > {
+  using Scheduler = PersistentTileSchedulerSm90Sddmm;
+};
+
+// SM90 triangular tile scheduler
+template <
+  FillMode FillMode_,
+  class TileShape,
+  class ClusterShape,
+  uint32_t SchedulerPipelineStageCount
+>
+struct TileSchedulerSelector<
+    TriangularScheduler<FillMode_>,
+    arch::Sm90,
+    TileShape,
+    ClusterShape
+    , SchedulerPipelineStageCount
+  > {
+  using Scheduler = PersistentTileSchedulerSm90Triangular<FillMode_>;
+};
+
+// SM90 triangular operand tile scheduler
+template <
+  SideMode SideMode_,
+  FillMode FillMode_,
+  class TileShape,
+  class ClusterShape,
+  uint32_t SchedulerPipelineStageCount
+>
+struct TileSchedulerSelector<
+    TriangularOperandScheduler<SideMode_, FillMode_>,
+    arch::Sm90,
+    TileShape,
+    ClusterShape
+    , SchedulerPipelineStageCount
+  > {
+  using Scheduler = PersistentTileSchedulerSm90TriangularOperand<SideMode_, FillMode_>;
+};
+
 template <
   class TileShape,
   class ClusterShape, 
@@ -175,6 +331,57 @@ struct TileSchedulerSelector<
   using Scheduler = PersistentTileSchedulerSm90Group<GroupProblemShape, SchedulerPipelineStageCount>;
 };
 
+template <
+  class TileShape,
+  class ClusterShape, 
+  uint32_t SchedulerPipelineStageCount, 
+  class GroupProblemShape
+>
+struct TileSchedulerSelector<
+    SortedGroupScheduler,
+    arch::Sm90,
+    TileShape,
+    ClusterShape
+    , SchedulerPipelineStageCount
+    , GroupProblemShape
+  > {
+  using Scheduler = PersistentTileSchedulerSm90GroupSorted<GroupProblemShape, SchedulerPipelineStageCount>;
+};
+
+template <
+  class TileShape,
+  class ClusterShape,
+  uint32_t SchedulerPipelineStageCount,
+  class GroupProblemShape
+>
+struct TileSchedulerSelector<
+    GroupStreamKScheduler,
+    arch::Sm90,
+    TileShape,
+    ClusterShape
+    , SchedulerPipelineStageCount
+    , GroupProblemShape
+  > {
+  using Scheduler = PersistentTileSchedulerSm90GroupStreamK<GroupProblemShape, TileShape, SchedulerPipelineStageCount>;
+};
+
+template <
+  class TileShape,
+  class ClusterShape,
+  uint32_t SchedulerPipelineStageCount,
+  class GroupProblemShape
+>
+struct TileSchedulerSelector<
+    DependentGroupScheduler,
+    arch::Sm90,
+    TileShape,
+    ClusterShape
+    , SchedulerPipelineStageCount
+    , GroupProblemShape
+  > {
+  using Scheduler = PersistentTileSchedulerSm90GroupDependent<GroupProblemShape, SchedulerPipelineStageCount>;
+};
+
 template <class TileShape, class ClusterShape, uint32_t SchedulerPipelineStageCount>
 struct TileSchedulerSelector<
     PersistentScheduler,
@@ -257,6 +464,42 @@ struct TileSchedulerSelector<
   using Scheduler = PersistentTileSchedulerSm100Group<GroupProblemShape, SchedulerPipelineStageCount>;
 };
 
+// SM100 dynamic group tile scheduler
+template <
+  class TileShape,
+  class ClusterShape,
+  uint32_t SchedulerPipelineStageCount,
+  class GroupProblemShape
+>
+struct TileSchedulerSelector<
+    DynamicGroupScheduler,
+    arch::Sm100,
+    TileShape,
+    ClusterShape,
+    SchedulerPipelineStageCount,
+    GroupProblemShape
+  > {
+  using Scheduler = PersistentTileSchedulerSm100GroupDynamic<GroupProblemShape, ClusterShape, SchedulerPipelineStageCount>;
+};
+
+// SM100 expert arrival group tile scheduler
+template <
+  class TileShape,
+  class ClusterShape,
+  uint32_t SchedulerPipelineStageCount,
+  class GroupProblemShape
+>
+struct TileSchedulerSelector<
+    ExpertArrivalGroupScheduler,
+    arch::Sm100,
+    TileShape,
+    ClusterShape,
+    SchedulerPipelineStageCount,
+    GroupProblemShape
+  > {
+  using Scheduler = PersistentTileSchedulerSm100GroupExpertArrival<GroupProblemShape, SchedulerPipelineStageCount>;
+};
+
 // SM100 stream-K scheduler
 template <class TileShape, class ClusterShape, uint32_t SchedulerPipelineStageCount>
 struct TileSchedulerSelector<
@@ -345,6 +588,42 @@ struct TileSchedulerSelector<
   using Scheduler = PersistentTileSchedulerSm100Group<GroupProblemShape, SchedulerPipelineStageCount>;
 };
 
+// SM103 dynamic group tile scheduler
+template <
+  class TileShape,
+  class ClusterShape,
+  uint32_t SchedulerPipelineStageCount,
+  class GroupProblemShape
+>
+struct TileSchedulerSelector<
+    DynamicGroupScheduler,
+    arch::Sm103,
+    TileShape,
+    ClusterShape,
+    SchedulerPipelineStageCount,
+    GroupProblemShape
+  > {
+  using Scheduler = PersistentTileSchedulerSm100GroupDynamic<GroupProblemShape, ClusterShape, SchedulerPipelineStageCount>;
+};
+
+// SM103 expert arrival group tile scheduler
+template <
+  class TileShape,
+  class ClusterShape,
+  uint32_t SchedulerPipelineStageCount,
+  class GroupProblemShape
+>
+struct TileSchedulerSelector<
+    ExpertArrivalGroupScheduler,
+    arch::Sm103,
+    TileShape,
+    ClusterShape,
+    SchedulerPipelineStageCount,
+    GroupProblemShape
+  > {
+  using Scheduler = PersistentTileSchedulerSm100GroupExpertArrival<GroupProblemShape, SchedulerPipelineStageCount>;
+};
+
 template <class TileShape, class ClusterShape, uint32_t SchedulerPipelineStageCount>
 struct TileSchedulerSelector<
     StreamKScheduler,
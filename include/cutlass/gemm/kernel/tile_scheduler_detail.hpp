@@ -43,7 +43,10 @@ enum class RasterOrder {
 enum class RasterOrderOptions {
   Heuristic,
   AlongM,
-  AlongN
+  AlongN,
+  // Chooses the raster order like Heuristic and sizes the swizzle so that tiles are walked in
+  // super-tiles whose operand panels fit in L2. Overrides max_swizzle_size.
+  L2Aware
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -66,7 +69,26 @@ enum class ReductionMode {
   // Due to the nondeterminsitic ordering of accumulation, deterministic numeric behavior cannot
   // be guaranteed with this mode (e.g., floating-point rounding error will depend on the order
   // of accumulation)
-  Nondeterministic
+  Nondeterministic,
+
+  // Participating CTAs write their partial values to their own portion of the workspace without
+  // waiting on one another. The CTA computing the final split waits for all of them and adds the
+  // partials to its accumulators pairwise in order of the K extent covered by each CTA.
+  //
+  // The order of accumulation depends only on the decomposition, so numeric behavior is deterministic
+  // while only the final CTA waits. This requires a workspace partial per participating CTA.
+  DeterministicTree,
+
+  // Parallel split-K. Each split writes its partial values to its own portion of the workspace and
+  // moves on to its next unit of work without computing the epilogue. Once all splits have been
+  // scheduled, the same persistent kernel schedules one reduction unit per output tile. Reduction
+  // units are spread across all SMs, and each sums the partials of its tile in order of K and runs
+  // the full epilogue (including any auxiliary loads and broadcasts of a fusion).
+  //
+  // Numeric behavior is deterministic. This requires a workspace partial per split of every output tile.
+  // Only split-K decompositions are supported. Stream-K decompositions fall back to Deterministic.
+  // Only the SM90 stream-K scheduler supports this mode.
+  Separate
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -77,6 +77,18 @@ get_max_cta_occupancy(int max_sm_per_gpc, GemmCoord cluster_shape, int sm_count)
   return cta_per_device;
 }
 
+// Returns the number of SMs covered by a persistent grid of single-CTA clusters. When max_active_clusters
+// was queried against a green context stream, it is scoped to that context's SM partition, which may hold
+// fewer SMs than the device. Sizing the grid to the partition keeps CTAs from queueing for SMs that the
+// kernel cannot run on.
+CUTLASS_HOST_DEVICE
+static int
+get_persistent_sm_count(KernelHardwareInfo const& hw_info) {
+  int const sm_count = hw_info.sm_count;
+  int const max_active_clusters = hw_info.max_active_clusters;
+  return (max_active_clusters > 0 && max_active_clusters < sm_count) ? max_active_clusters : sm_count;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 //
@@ -120,23 +132,33 @@ struct PersistentTileSchedulerSm90Params {
       cluster_shape,
       hw_info,
       max_swizzle_size,
-      raster_order_option
+      raster_order_option,
+      get_operand_panel_bytes(tile_shape.m(), problem_shape.k()),
+      get_operand_panel_bytes(tile_shape.n(), problem_shape.k())
     );
   }
 
   // Version of initialize that takes in as input the number of CTAs in the M and N and L dimensions.
   // This is useful for calculating the tiled shape when a mode of problem and/or CTA shape has rank > 1,
   // for which using CuTe algebra for calculating tile shapes is easiest.
+  //
+  // panel_bytes_m and panel_bytes_n are the bytes of A and B read by a single CTA tile over the
+  // full K extent. They are only used by RasterOrderOptions::L2Aware and may be zero if unknown.
   void
   initialize(
     dim3 problem_blocks,
     GemmCoord cluster_shape,
     KernelHardwareInfo const& hw_info,
     int max_swizzle_size,
-    RasterOrderOptions raster_order_option
+    RasterOrderOptions raster_order_option,
+    uint64_t panel_bytes_m = 0,
+    uint64_t panel_bytes_n = 0
   ) {
 
-    CUTLASS_UNUSED(hw_info);
+    if (raster_order_option == RasterOrderOptions::L2Aware) {
+      max_swizzle_size = get_l2_aware_swizzle_size(
+        problem_blocks, cluster_shape, with_l2_cache_size(hw_info), panel_bytes_m, panel_bytes_n);
+    }
 
     // Round up to nearest multiple of swizzle_size along each mode
     auto log_swizzle_size = get_log_swizzle_size(problem_blocks.x, problem_blocks.y, max_swizzle_size);
@@ -222,6 +244,13 @@ struct PersistentTileSchedulerSm90Params {
     int const sm_count = hw_info.sm_count;
     int const max_active_clusters = hw_info.max_active_clusters;
 
+    // Operand sizes are not available here, so the swizzle is sized from the wave shape alone.
+    // Kernels launch with the swizzle recorded in their Params, so this only affects callers
+    // requesting L2Aware directly.
+    if (raster_order_option == RasterOrderOptions::L2Aware) {
+      max_swizzle_size = get_l2_aware_swizzle_size(problem_blocks, cluster_shape, hw_info, 0, 0);
+    }
+
     // Round up to nearest multiple of swizzle_size along each mode
     auto log_swizzle_size = get_log_swizzle_size(problem_blocks.x, problem_blocks.y, max_swizzle_size);
     auto problem_blocks_m = round_up(problem_blocks.x, (1 << log_swizzle_size) * cluster_shape.m());
@@ -257,10 +286,10 @@ struct PersistentTileSchedulerSm90Params {
     auto cluster_size = cluster_shape.m() * cluster_shape.n();
     if (cluster_size == 1) {
       if (raster_order == RasterOrder::AlongN) {
-        launch_grid.y = possibly_truncate(sm_count, problem_blocks_total);
+        launch_grid.y = possibly_truncate(get_persistent_sm_count(hw_info), problem_blocks_total);
       }
       else {
-        launch_grid.x = possibly_truncate(sm_count, problem_blocks_total);
+        launch_grid.x = possibly_truncate(get_persistent_sm_count(hw_info), problem_blocks_total);
       }
     }
     // In case the maximum number of clusters that could co-exist on the target device is
@@ -326,6 +355,69 @@ struct PersistentTileSchedulerSm90Params {
     }
   }
 
+  // Returns the swizzle size used by RasterOrderOptions::L2Aware.
+  //
+  // The tile space is walked in super-tiles that are `swizzle` clusters wide along the minor mode
+  // of the raster order. The width is first chosen so that one wave of co-resident clusters
+  // covers a roughly square region of the output, which minimizes the number of distinct A and B
+  // panels read concurrently. It is then narrowed until the minor-mode operand panels of one
+  // super-tile fit in half of L2, so that they stay resident while the super-tile sweeps along
+  // the major mode and are fetched from DRAM only once.
+  CUTLASS_HOST_DEVICE
+  static int
+  get_l2_aware_swizzle_size(
+    dim3 problem_blocks,
+    GemmCoord cluster_shape,
+    KernelHardwareInfo const& hw_info,
+    uint64_t panel_bytes_m,
+    uint64_t panel_bytes_n
+  ) {
+    // Largest swizzle supported by get_log_swizzle_size
+    constexpr int max_l2_aware_swizzle_size = 8;
+
+    int const cluster_size = cluster_shape.m() * cluster_shape.n();
+    int const wave_clusters = hw_info.max_active_clusters != 0 ?
+      hw_info.max_active_clusters : hw_info.sm_count / cluster_size;
+
+    int swizzle = 1;
+    while (swizzle < max_l2_aware_swizzle_size && (4 * swizzle * swizzle) <= wave_clusters) {
+      swizzle *= 2;
+    }
+
+    // AlongN walks the N mode first, so super-tiles span the M mode and reuse the A panels.
+    RasterOrder raster_order = get_rasterization_order(problem_blocks.x, problem_blocks.y, RasterOrderOptions::L2Aware);
+    uint64_t const minor_panel_bytes = raster_order == RasterOrder::AlongN ?
+      panel_bytes_m * cluster_shape.m() : panel_bytes_n * cluster_shape.n();
+
+    if (hw_info.l2_cache_size > 0 && minor_panel_bytes > 0) {
+      uint64_t const l2_budget = static_cast<uint64_t>(hw_info.l2_cache_size) / 2;
+      while (swizzle > 1 && static_cast<uint64_t>(swizzle) * minor_panel_bytes > l2_budget) {
+        swizzle /= 2;
+      }
+    }
+    return swizzle;
+  }
+
+  // Returns a copy of hw_info with the L2 cache size queried from the device if it was not provided
+  static KernelHardwareInfo
+  with_l2_cache_size(KernelHardwareInfo const& hw_info) {
+    KernelHardwareInfo l2_hw_info = hw_info;
+#if !defined(__CUDACC_RTC__)
+    if (l2_hw_info.l2_cache_size <= 0) {
+      l2_hw_info.l2_cache_size = KernelHardwareInfo::query_device_l2_cache_size(hw_info.device_id);
+    }
+#endif
+    return l2_hw_info;
+  }
+
+  // Estimates the bytes of one operand read by a CTA tile of the given extent over the full K
+  // mode. Operand types are not visible to the tile schedulers, so 16-bit operands are assumed.
+  CUTLASS_HOST_DEVICE
+  static uint64_t
+  get_operand_panel_bytes(uint64_t tile_extent, uint64_t problem_k) {
+    return tile_extent * problem_k * 2;
+  }
+
   CUTLASS_HOST_DEVICE
   static RasterOrder
   get_rasterization_order(
@@ -334,7 +426,8 @@ struct PersistentTileSchedulerSm90Params {
     RasterOrderOptions raster_order_option
   ) {
 
-    if (raster_order_option == RasterOrderOptions::Heuristic) {
+    if (raster_order_option == RasterOrderOptions::Heuristic ||
+        raster_order_option == RasterOrderOptions::L2Aware) {
       if (tiles_n > tiles_m) {
         return RasterOrder::AlongM;
       }
@@ -385,6 +478,25 @@ struct PersistentTileSchedulerSm90Params {
 
 ////////////////////////////////////////////////////////////////////////////////
 
+// Parameters for SM90 dynamic persistent scheduler. Work is mapped onto output tiles exactly as
+// in the static persistent scheduler; the only addition is the global tile counter from which
+// CTAs claim work after their first tile.
+struct PersistentTileSchedulerSm90DynamicParams : PersistentTileSchedulerSm90Params {
+  // Workspace holding two counters: the number of tiles claimed beyond the initial wave and
+  // the number of CTAs that have observed the end of the tile space.
+  uint64_t* tile_counter_ = nullptr;
+
+  // Returns whether the counters of `other` are those of this launch. They are reset by the kernel
+  // before it exits, so a workspace initialized for `other` need not be cleared again.
+  CUTLASS_HOST_DEVICE
+  bool
+  has_same_workspace_layout(PersistentTileSchedulerSm90DynamicParams const& other) const {
+    return tile_counter_ == other.tile_counter_;
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
 // Parameters for SM90 persistent stream-K scheduler
 struct PersistentTileSchedulerSm90StreamKParams {
   using ReductionMode = cutlass::gemm::kernel::detail::ReductionMode;
@@ -522,6 +634,22 @@ struct PersistentTileSchedulerSm90StreamKParams {
     return separate_reduction_units_ > 0;
   }
 
+  // Returns whether the reduction locks of this decomposition occupy the same portion of the
+  // same workspace as those of `other`. Locks are reset by the kernel before it exits, so a
+  // workspace initialized for `other` need not be cleared again for this decomposition.
+  CUTLASS_HOST_DEVICE
+  bool
+  has_same_workspace_layout(PersistentTileSchedulerSm90StreamKParams const& other) const {
+    return reduction_workspace_ == other.reduction_workspace_ &&
+           units_per_problem_ == other.units_per_problem_ &&
+           divmod_splits_.divisor == other.divmod_splits_.divisor &&
+           sk_tiles_ == other.sk_tiles_ &&
+           sk_units_ == other.sk_units_ &&
+           reduction_mode_ == other.reduction_mode_ &&
+           divmod_epilogue_subtile_.divisor == other.divmod_epilogue_subtile_.divisor &&
+           separate_reduction_units_ == other.separate_reduction_units_;
+  }
+
   // Returns the maximum number of peers that can collaborate on a given output tile
   CUTLASS_HOST_DEVICE
   static uint32_t
@@ -534,6 +662,20 @@ struct PersistentTileSchedulerSm90StreamKParams {
     return static_cast<uint32_t>(sk_units / sk_tiles + 2);
   }
 
+  // Returns the number of partials held in workspace per output tile for ReductionMode::DeterministicTree.
+  // Every peer but the one computing the final split writes its own partial.
+  CUTLASS_HOST_DEVICE
+  static uint32_t
+  tree_reduction_peers_per_tile(uint32_t splits, uint64_t sk_units, uint64_t sk_tiles) {
+    if (splits > 1) {
+      return splits - 1;
+    }
+    if (sk_tiles == 0) {
+      return 0;
+    }
+    return max_peers_per_tile(sk_units, sk_tiles) - 1;
+  }
+
   // Initializes members. This variant of the method should only be used when
   // problem_shape and tile_shape contain modes of only rank 1.
   void
@@ -669,8 +811,10 @@ struct PersistentTileSchedulerSm90StreamKParams {
     // Grouping is disabled when separate reduction is used because grouping is primarily an attempt
     // to improve L2 locality, and L2-locality optimizations are unnecessary when the the kernel
     // is a single wave (which is the case for separate reduction).
+    // Tree reductions size their per-peer workspace with max_peers_per_tile, which assumes a single group.
     if (
       do_separate_reduction
+      || reduction_mode == ReductionMode::DeterministicTree
       ) {
       groups = 1;
     }
@@ -999,7 +1143,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
         k_tiles_per_group,
         k_tiles_per_sk_unit,
         sk_big_groups,
-        reduction_mode,
+        // Separate reduction units are only scheduled for split-K
+        reduction_mode == ReductionMode::Separate ? ReductionMode::Deterministic : reduction_mode,
         1, /*epilogue_subtile*/
         0  /*reduction_units*/
       );
@@ -1242,8 +1387,19 @@ struct PersistentTileSchedulerSm90StreamKParams {
 
       if (split_k_required || split_k_selected) {
         // Basic split-K variant requires workspace for all output tiles
+        uint64_t reduction_tiles = output_tiles;
+        uint32_t k_splits = split_k_required ? static_cast<uint32_t>(splits) : static_cast<uint32_t>(sk_units / sk_tiles);
+        if (reduction_mode == ReductionMode::DeterministicTree) {
+          // Each split but the final one writes to its own location in scratch space
+          reduction_tiles *= tree_reduction_peers_per_tile(k_splits, sk_units, sk_tiles);
+        }
+        else if (reduction_mode == ReductionMode::Separate && k_splits > 1) {
+          // Each split writes to its own location in scratch space, which is read by the
+          // separate reduction unit of the output tile
+          reduction_tiles *= k_splits;
+        }
         barrier_workspace_size = get_barrier_workspace_size(output_tiles, mma_warp_groups, barrier_bits);
-        reduction_workspace_size = get_reduction_workspace_size(output_tiles, tile_shape, accumulator_bits, num_accumulator_mtxs);
+        reduction_workspace_size = get_reduction_workspace_size(reduction_tiles, tile_shape, accumulator_bits, num_accumulator_mtxs);
       }
       else {
         uint64_t reduction_tiles = sk_tiles;
@@ -1255,6 +1411,9 @@ struct PersistentTileSchedulerSm90StreamKParams {
           // as there are the maximum number of peers that can collaborate on an output tile.
           reduction_tiles *= max_peers_per_tile(sk_units, sk_tiles);
         }
+        else if (reduction_mode == ReductionMode::DeterministicTree) {
+          reduction_tiles *= tree_reduction_peers_per_tile(1, sk_units, sk_tiles);
+        }
 
         // Though separate reduction requires a larger reduction workspace, only one barrier
         // is needed per output tile. Each peer will increment the barrier by one once the peer has
@@ -1529,7 +1688,11 @@ struct PersistentTileSchedulerSm90StreamKParams {
     sk_tiles_ = 0;
     sk_units_ = 0;
     divmod_sk_units_per_group_ = FastDivmodU64(1u);
-    separate_reduction_units_ = 0;
+
+    // Parallel split-K schedules one separate reduction unit per output tile after all splits
+    divmod_epilogue_subtile_ = FastDivmodU64(1u);
+    separate_reduction_units_ = (reduction_mode == ReductionMode::Separate && splits > 1) ?
+      static_cast<uint32_t>(units_per_problem_) : 0;
   }
 
   // Set params for streamk(streamk, separate-reduction included) decomposition.
@@ -1758,10 +1921,10 @@ struct PersistentTileSchedulerSm90GroupParams {
     auto cluster_size = cluster_shape.m() * cluster_shape.n();
     if (cluster_size == 1) {
       if (raster_order == RasterOrder::AlongN) {
-        launch_grid.y = possibly_truncate(sm_count, problem_blocks_total);
+        launch_grid.y = possibly_truncate(get_persistent_sm_count(hw_info), problem_blocks_total);
       }
       else {
-        launch_grid.x = possibly_truncate(sm_count, problem_blocks_total);
+        launch_grid.x = possibly_truncate(get_persistent_sm_count(hw_info), problem_blocks_total);
       }
     }
     // In case the maximum number of clusters that could co-exist on the target device is
@@ -1807,7 +1970,8 @@ struct PersistentTileSchedulerSm90GroupParams {
     RasterOrderOptions raster_order_option
   ) {
 
-    if (raster_order_option == RasterOrderOptions::Heuristic) {
+    if (raster_order_option == RasterOrderOptions::Heuristic ||
+        raster_order_option == RasterOrderOptions::L2Aware) {
       if (tiles_n > tiles_m) {
         return RasterOrder::AlongM;
       }
@@ -1829,6 +1993,102 @@ struct PersistentTileSchedulerSm90GroupParams {
 
 ////////////////////////////////////////////////////////////////////////////////
 
+// Parameters for SM90 size-sorted group scheduler. Each group is mapped onto output tiles exactly
+// as in the group scheduler; the only addition is the device-side table describing the order in
+// which groups are visited, as produced by the group sort pre-pass.
+template<class GroupProblemShape>
+struct PersistentTileSchedulerSm90GroupSortedParams : PersistentTileSchedulerSm90GroupParams<GroupProblemShape> {
+  // Group indices in the order they are scheduled, largest tile count first
+  int32_t const* group_order_ = nullptr;
+  // Exclusive prefix sum of tile counts in scheduling order, with groups() + 1 entries
+  uint64_t const* group_tile_offsets_ = nullptr;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Parameters for SM90 group stream-K scheduler. Output tiles before sk_tile_start_ are scheduled as by
+// the group scheduler; the sk_tiles_ tiles from there on form the final wave and are each split into
+// sk_splits_ contiguous ranges of K tiles.
+template <class GroupProblemShape>
+struct PersistentTileSchedulerSm90GroupStreamKParams : PersistentTileSchedulerSm90GroupParams<GroupProblemShape> {
+  // Linear index of the first split output tile
+  uint64_t sk_tile_start_ = 0;
+  // Number of split output tiles
+  uint32_t sk_tiles_ = 0;
+  // Number of K splits of each split output tile. A value of 1 disables splitting.
+  uint32_t sk_splits_ = 1;
+  // Locks ordering the splits of each split output tile, one per MMA warp group
+  void* lock_workspace_ = nullptr;
+  // Partial accumulators of the split output tiles
+  void* reduction_workspace_ = nullptr;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Parameters for SM90 dependent group scheduler. Output tiles are mapped exactly as by the group
+// scheduler; the additions describe which earlier group produces the A operand of each group and the
+// counters of completed output tiles, max_tiles_m_ per group.
+template <class GroupProblemShape>
+struct PersistentTileSchedulerSm90GroupDependentParams : PersistentTileSchedulerSm90GroupParams<GroupProblemShape> {
+  // Index of the group whose output is the A operand of each group, or a negative value if none
+  int32_t const* ptr_producer_group_ = nullptr;
+  // Completed output tiles of each M tile of each group
+  int32_t* tile_counters_ = nullptr;
+  // Stride between the counters of consecutive groups
+  int32_t max_tiles_m_ = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Parameters for SM90 block-sparse scheduler. Output tiles are mapped exactly as in the persistent
+// scheduler; the additions describe the block rows of a BSR A operand whose blocks match the CTA tile.
+struct PersistentTileSchedulerSm90BlockSparseParams : PersistentTileSchedulerSm90Params {
+  // Offsets of the first non-zero block of each block row, with block_rows_ + 1 entries
+  int32_t const* block_row_offsets_ = nullptr;
+  // Number of block rows of A, i.e. the number of CTA tiles along M
+  int32_t block_rows_ = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Parameters for SM90 SDDMM scheduler. The underlying persistent scheduler parameters describe a grid
+// of one CTA tile per non-zero block of the output mask, which is stored in BSR format with blocks of
+// the CTA tile shape (BLK_M, BLK_N).
+struct PersistentTileSchedulerSm90SddmmParams : PersistentTileSchedulerSm90Params {
+  // Offsets of the first non-zero block of each block row, with block_rows_ + 1 entries
+  int32_t const* block_row_offsets_ = nullptr;
+  // Block column (N tile) index of each non-zero block
+  int32_t const* block_col_indices_ = nullptr;
+  // Number of block rows of the mask, i.e. the number of CTA tiles along M
+  int32_t block_rows_ = 0;
+  // Number of non-zero blocks of the mask
+  int32_t num_blocks_ = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Parameters for SM90 triangular scheduler. The underlying persistent scheduler parameters describe a
+// grid of one cluster along N and as many clusters along M as there are cluster tiles in the triangle.
+// Each of them is mapped onto a cluster tile of the rows_ x cols_ grid of cluster tiles, oriented such
+// that the triangle is the lower one.
+struct PersistentTileSchedulerSm90TriangularParams : PersistentTileSchedulerSm90Params {
+  // Extents of the oriented grid of cluster tiles
+  int32_t rows_ = 0;
+  int32_t cols_ = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Parameters for SM90 persistent tile schedulers of products with a triangular operand (TRMM, SYMM)
+struct PersistentTileSchedulerSm90TriangularOperandParams : PersistentTileSchedulerSm90Params {
+  // Number of K tiles of the problem
+  int32_t k_tiles_ = 0;
+  // Number of K tiles spanned by one CTA tile of the triangular operand along M (left) or N (right)
+  int32_t diagonal_k_tiles_ = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
 
 //
 // Parameters for SM100 tile schedulers
@@ -1867,7 +2127,9 @@ struct PersistentTileSchedulerSm100Params {
       cluster_shape,
       hw_info,
       max_swizzle_size,
-      raster_order_option
+      raster_order_option,
+      UnderlyingParams::get_operand_panel_bytes(tile_shape.m(), problem_shape.k()),
+      UnderlyingParams::get_operand_panel_bytes(tile_shape.n(), problem_shape.k())
     );
   }
 
@@ -1876,10 +2138,18 @@ struct PersistentTileSchedulerSm100Params {
       GemmCoord cluster_shape,
       KernelHardwareInfo const& hw_info,
       int max_swizzle_size,
-      RasterOrderOptions raster_order_option) {
+      RasterOrderOptions raster_order_option,
+      uint64_t panel_bytes_m = 0,
+      uint64_t panel_bytes_n = 0) {
+
+    if (raster_order_option == RasterOrderOptions::L2Aware) {
+      max_swizzle_size = UnderlyingParams::get_l2_aware_swizzle_size(
+        problem_blocks, cluster_shape, UnderlyingParams::with_l2_cache_size(hw_info), panel_bytes_m, panel_bytes_n);
+    }
 
     raster_order_ = UnderlyingParams::get_rasterization_order(problem_tiles_m_, problem_tiles_n_, raster_order_option);
-    if (raster_order_option == RasterOrderOptions::Heuristic && raster_order_ == RasterOrder::AlongN) {
+    if ((raster_order_option == RasterOrderOptions::Heuristic || raster_order_option == RasterOrderOptions::L2Aware) &&
+        raster_order_ == RasterOrder::AlongN) {
       // The current implementation of AlongN rasterization for B100 requires swapping the number of clusters along the
       // X and Y dimensions of the grid. However, since the grid Y dimension has a smaller range of allowed values
       // than the grid X dimension, we must check whether the swapped grid would exceed the grid Y limit. If the
@@ -1907,13 +2177,18 @@ struct PersistentTileSchedulerSm100Params {
   // Version of initialize that takes in as input the number of CTAs in the M and N and L dimensions.
   // This is useful for calculating the tiled shape when a mode of problem and/or CTA shape has rank > 1,
   // for which using CuTe algebra for calculating tile shapes is easiest.
+  //
+  // panel_bytes_m and panel_bytes_n are only used by RasterOrderOptions::L2Aware; see
+  // PersistentTileSchedulerSm90Params::initialize.
   void
   initialize(
       dim3 problem_blocks,
       GemmCoord cluster_shape,
       KernelHardwareInfo const& hw_info,
       int max_swizzle_size,
-      RasterOrderOptions raster_order_option
+      RasterOrderOptions raster_order_option,
+      uint64_t panel_bytes_m = 0,
+      uint64_t panel_bytes_n = 0
   ) {
 
     // Cluster counters in m, n and l dimensions of the problem tiles
@@ -1923,7 +2198,8 @@ struct PersistentTileSchedulerSm100Params {
     divmod_cluster_shape_m_ = FastDivmod(cluster_shape.m());
     divmod_cluster_shape_n_ = FastDivmod(cluster_shape.n());
 
-    initialize_swizzle(problem_blocks, cluster_shape, hw_info, max_swizzle_size, raster_order_option);
+    initialize_swizzle(problem_blocks, cluster_shape, hw_info, max_swizzle_size, raster_order_option,
+                       panel_bytes_m, panel_bytes_n);
   }
 
   // Given the inputs, computes the physical grid we should launch.
@@ -2073,6 +2349,14 @@ struct PersistentTileSchedulerSm100StreamKParams {
   UnderlyingStreamKParams sk_params_{};
   UnderlyingParams sm100_params_{};
 
+  // Returns whether the reduction locks of this decomposition occupy the same portion of the
+  // same workspace as those of `other`.
+  CUTLASS_HOST_DEVICE
+  bool
+  has_same_workspace_layout(PersistentTileSchedulerSm100StreamKParams const& other) const {
+    return sk_params_.has_same_workspace_layout(other.sk_params_);
+  }
+
   // Initializes members. This variant of the method should only be used when
   // problem_shape and tile_shape contain modes of only rank 1.
   void
@@ -2508,10 +2792,10 @@ struct PersistentTileSchedulerSm100GroupParams {
       auto cluster_size = cluster_shape.m() * cluster_shape.n();
       if (cluster_size == 1) {
         if (raster_order == RasterOrder::AlongN) {
-          launch_grid.y = possibly_truncate(sm_count, problem_blocks_total);
+          launch_grid.y = possibly_truncate(get_persistent_sm_count(hw_info), problem_blocks_total);
         }
         else {
-          launch_grid.x = possibly_truncate(sm_count, problem_blocks_total);
+          launch_grid.x = possibly_truncate(get_persistent_sm_count(hw_info), problem_blocks_total);
         }
       }
       // In case the maximum number of clusters that could co-exist on the target device is
@@ -2570,6 +2854,33 @@ struct PersistentTileSchedulerSm100GroupParams {
 
 ////////////////////////////////////////////////////////////////////////////////
 
+// Parameters for SM100 dynamic group scheduler. Groups are tiled exactly as in the group scheduler;
+// the additions describe the launch grid, which holds one cluster per output cluster tile across
+// all groups so that cluster launch control can hand the tiles out to whichever clusters are resident.
+template<class GroupProblemShape>
+struct PersistentTileSchedulerSm100GroupDynamicParams : PersistentTileSchedulerSm90GroupParams<GroupProblemShape> {
+  FastDivmod divmod_cluster_shape_m_{};
+  // Total number of output cluster tiles across all groups, as computed from the host problem shapes
+  uint64_t problem_clusters_ = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Parameters for SM100 expert arrival group scheduler. Groups are tiled exactly as in the group
+// scheduler; the additions describe the arrival counters of the rows of A of each group, one per
+// arrival_tile_m_ rows and max_arrival_tiles_ per group, which are raised by other devices.
+template<class GroupProblemShape>
+struct PersistentTileSchedulerSm100GroupExpertArrivalParams : PersistentTileSchedulerSm100GroupParams<GroupProblemShape> {
+  // Rows of A that have arrived, per arrival tile of each group
+  int32_t const* arrival_counters_ = nullptr;
+  // Stride between the counters of consecutive groups
+  int32_t max_arrival_tiles_ = 0;
+  // Rows of A covered by each counter
+  int32_t arrival_tile_m_ = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
 
 } // namespace detail
 } // namespace kernel
@@ -34,6 +34,7 @@
 #if !defined(__CUDACC_RTC__)
 #include "cuda_runtime.h"
 #include "cutlass/cluster_launch.hpp"
+#include "cutlass/cuda_host_adapter.hpp"
 #include "cutlass/trace.h"
 #endif
 #include <cute/int_tuple.hpp>
@@ -51,16 +52,60 @@ struct KernelHardwareInfo {
 
   // Kernel properties
   int max_active_clusters = 0;              // Maximum number of clusters that could co-exist on the target device.
+                                            // Scoped to the SM partition when queried with a green context stream.
   dim3 cluster_shape = {0,0,0};             
   dim3 cluster_shape_fallback = {0,0,0};    
 
+  // Hardware properties used by L2-aware rasterization
+  int l2_cache_size = 0;                    // Size of the L2 cache in bytes. Zero if unknown.
+
   //
   // Methods
   //
 
 #if !defined(__CUDACC_RTC__)
+  // Query the number of SMs provisioned to the green context that `stream` was created in, or to
+  // the calling thread's current context if `stream` is null. Returns 0 if the stream does not
+  // belong to a green context or the driver does not support SM resource queries.
+  static inline int
+  query_context_multiprocessor_count(cudaStream_t stream = nullptr) {
+#if defined(CUDA_HOST_ADAPTER_GREEN_CONTEXT_ENABLED)
+    CUdevResource resource;
+    if (stream != nullptr) {
+      CUgreenCtx green_ctx = nullptr;
+      CUresult result = CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuStreamGetGreenCtx)(
+        reinterpret_cast<CUstream>(stream), &green_ctx);
+      if (result != CUDA_SUCCESS || green_ctx == nullptr) {
+        return 0;
+      }
+      result = CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuGreenCtxGetDevResource)(
+        green_ctx, &resource, CU_DEV_RESOURCE_TYPE_SM);
+      if (result != CUDA_SUCCESS) {
+        CUTLASS_TRACE_HOST("  cuGreenCtxGetDevResource() returned error " << result);
+        return 0;
+      }
+      return static_cast<int>(resource.sm.smCount);
+    }
+    CUcontext ctx = nullptr;
+    if (CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuCtxGetCurrent)(&ctx) != CUDA_SUCCESS || ctx == nullptr) {
+      return 0;
+    }
+    if (CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuCtxGetDevResource)(
+          ctx, &resource, CU_DEV_RESOURCE_TYPE_SM) != CUDA_SUCCESS) {
+      return 0;
+    }
+    return static_cast<int>(resource.sm.smCount);
+#else
+    (void)stream;
+    return 0;
+#endif
+  }
+
+  // Query the number of SMs available to kernels launched on `stream` from the calling thread.
+  // This is the device SM count unless the stream, or the current context, is a green context
+  // holding a subset of the SMs, in which case persistent kernels must size their grid to it.
   static inline int
-  query_device_multiprocessor_count(int device_id = 0) {
+  query_device_multiprocessor_count(int device_id = 0, cudaStream_t stream = nullptr) {
     cudaError_t result = cudaGetDevice(&device_id);
     if (result != cudaSuccess) {
       CUTLASS_TRACE_HOST(
@@ -77,9 +122,29 @@ struct KernelHardwareInfo {
         << cudaGetErrorString(result));
       return 0;
     }
+    int partition_count = query_context_multiprocessor_count(stream);
+    if (partition_count > 0 && partition_count < multiprocessor_count) {
+      CUTLASS_TRACE_HOST("  green context provisions " << partition_count << " of "
+        << multiprocessor_count << " SMs");
+      return partition_count;
+    }
     return multiprocessor_count;
   }
 
+  static inline int
+  query_device_l2_cache_size(int device_id = 0) {
+    int l2_cache_size;
+    cudaError_t result = cudaDeviceGetAttribute(&l2_cache_size,
+      cudaDevAttrL2CacheSize, device_id);
+    if (result != cudaSuccess) {
+      CUTLASS_TRACE_HOST(
+        "  cudaDeviceGetAttribute() returned error "
+        << cudaGetErrorString(result));
+      return 0;
+    }
+    return l2_cache_size;
+  }
+
   // Query maximum number of active clusters that could co-exist on the target device
   // based on kernel properties such as cluster dims and threadblock dims.
   // When a green context stream is provided, the occupancy query is scoped to the
@@ -127,19 +192,21 @@ struct KernelHardwareInfo {
   }
 
   // Create a KernelHardwareInfo by querying device properties.
-  // When a green context stream is provided, max_active_clusters is queried
-  // against that stream's green context partition instead of the full device.
+  // When a green context stream is provided, sm_count and max_active_clusters are
+  // queried against that stream's green context partition instead of the full device.
   template <typename Kernel>
   static inline KernelHardwareInfo
   make_kernel_hardware_info(int const device_id = 0, int sm_count = 0, int max_active_clusters = 0,
                             cudaStream_t stream = nullptr) {
     if (sm_count == 0) {
-      sm_count = query_device_multiprocessor_count(device_id);
+      sm_count = query_device_multiprocessor_count(device_id, stream);
     }
     if (max_active_clusters == 0) {
       max_active_clusters = query_device_max_active_clusters<Kernel>(stream);
     }
-    return {device_id, sm_count, max_active_clusters};
+    KernelHardwareInfo hw_info{device_id, sm_count, max_active_clusters};
+    hw_info.l2_cache_size = query_device_l2_cache_size(device_id);
+    return hw_info;
   }
 #endif
 };
@@ -46,6 +46,12 @@
 #include "cutlass/array.h"
 #include "cutlass/half.h"
 #include "cutlass/bfloat16.h"
+#include "cutlass/detail/host_numeric_conversion.hpp"
+
+// Stochastic rounding conversions (cvt.rs) are available on the arch-specific SM100 and SM103 targets
+#if (defined(CUTLASS_ARCH_MMA_SM100A_ENABLED) || defined(CUTLASS_ARCH_MMA_SM103A_ENABLED))
+#  define CUDA_PTX_CVT_RS_ENABLED 1
+#endif
 
 namespace cutlass {
 
@@ -839,6 +845,90 @@ struct NumericConverterClamp<cutlass::half_t, S> {
 //
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+#if !defined(__CUDACC_RTC__)
+
+namespace detail {
+
+/// Selects a vectorized host routine for converting contiguous arrays of S to T with the given
+/// rounding style. Conversions without one report kSupported = false.
+template <typename T, typename S, FloatRoundStyle Round>
+struct HostBulkConverter {
+  static bool const kSupported = false;
+};
+
+template <>
+struct HostBulkConverter<cutlass::half_t, float, FloatRoundStyle::round_to_nearest> {
+  static bool const kSupported = true;
+  static void convert(cutlass::half_t *dst, float const *src, size_t count) {
+    host_convert_float_to_half_rn(dst, src, count);
+  }
+};
+
+template <FloatRoundStyle Round>
+struct HostBulkConverter<float, cutlass::half_t, Round> {
+  static bool const kSupported = true;
+  static void convert(float *dst, cutlass::half_t const *src, size_t count) {
+    host_convert_half_to_float(dst, src, count);
+  }
+};
+
+template <>
+struct HostBulkConverter<cutlass::bfloat16_t, float, FloatRoundStyle::round_to_nearest> {
+  static bool const kSupported = true;
+  static void convert(cutlass::bfloat16_t *dst, float const *src, size_t count) {
+    host_convert_float_to_bfloat16_rn(dst, src, count);
+  }
+};
+
+template <FloatRoundStyle Round>
+struct HostBulkConverter<float, cutlass::bfloat16_t, Round> {
+  static bool const kSupported = true;
+  static void convert(float *dst, cutlass::bfloat16_t const *src, size_t count) {
+    host_convert_bfloat16_to_float(dst, src, count);
+  }
+};
+
+template <FloatRoundStyle Round>
+struct HostBulkConverter<float, cutlass::float_e4m3_t, Round> {
+  static bool const kSupported = true;
+  static void convert(float *dst, cutlass::float_e4m3_t const *src, size_t count) {
+    host_convert_float8_to_float(dst, src, count);
+  }
+};
+
+template <FloatRoundStyle Round>
+struct HostBulkConverter<float, cutlass::float_e5m2_t, Round> {
+  static bool const kSupported = true;
+  static void convert(float *dst, cutlass::float_e5m2_t const *src, size_t count) {
+    host_convert_float8_to_float(dst, src, count);
+  }
+};
+
+} // namespace detail
+
+/// Converts a contiguous host array of S into T. Uses the vectorized host routines when one is
+/// available for the type pair and rounding style, and NumericConverter otherwise.
+template <
+  typename T,
+  typename S,
+  FloatRoundStyle Round = FloatRoundStyle::round_to_nearest
+>
+void host_numeric_array_convert(T *dst, S const *src, size_t count) {
+  if constexpr (detail::HostBulkConverter<T, S, Round>::kSupported) {
+    detail::HostBulkConverter<T, S, Round>::convert(dst, src, count);
+  }
+  else {
+    NumericConverter<T, S, Round> convert_op;
+    for (size_t i = 0; i < count; ++i) {
+      dst[i] = convert_op(src[i]);
+    }
+  }
+}
+
+#endif // !defined(__CUDACC_RTC__)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Conversion operator for Array
 template <
   typename T,
@@ -861,6 +951,15 @@ struct NumericArrayConverter {
   static result_type convert(source_type const & s) {
 
     result_type result;
+
+    #if !defined(__CUDA_ARCH__) && !defined(__CUDACC_RTC__)
+    if constexpr (detail::HostBulkConverter<T, S, Round>::kSupported &&
+                  platform::is_same<Transform, cutlass::transform::thread::UnaryTransform::Identity>::value) {
+      detail::HostBulkConverter<T, S, Round>::convert(result.data(), s.data(), N);
+      return result;
+    }
+    #endif
+
     NumericConverter<T, S, Round> convert_;
 
     CUTLASS_PRAGMA_UNROLL
@@ -999,6 +1098,14 @@ struct NumericArrayConverter<cutlass::half_t, float, N, Round> {
   CUTLASS_HOST_DEVICE
   static result_type convert(source_type const & source) {
 
+    #if !defined(__CUDA_ARCH__) && !defined(__CUDACC_RTC__)
+    if constexpr (detail::HostBulkConverter<cutlass::half_t, float, Round>::kSupported) {
+      result_type result;
+      detail::HostBulkConverter<cutlass::half_t, float, Round>::convert(result.data(), source.data(), N);
+      return result;
+    }
+    #endif
+
     NumericArrayConverter<cutlass::half_t, float, 2, Round> convert_vector_;
     NumericConverter<cutlass::half_t, float, Round> convert_element_;
 
@@ -1040,6 +1147,14 @@ struct NumericArrayConverter<float, cutlass::half_t, N, Round> {
   CUTLASS_HOST_DEVICE
   static result_type convert(source_type const & source) {
 
+    #if !defined(__CUDA_ARCH__) && !defined(__CUDACC_RTC__)
+    if constexpr (detail::HostBulkConverter<float, cutlass::half_t, Round>::kSupported) {
+      result_type result;
+      detail::HostBulkConverter<float, cutlass::half_t, Round>::convert(result.data(), source.data(), N);
+      return result;
+    }
+    #endif
+
     NumericArrayConverter<float, cutlass::half_t, 2, Round> convert_vector_;
     NumericConverter<float, cutlass::half_t, Round> convert_element_;
 
@@ -7996,6 +8111,204 @@ struct FastNumericArrayConverter<int8_t, float, N, Round> {
   result_type operator()(source_type const &s) const { return convert(s); }
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Stochastic rounding
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Converts a float to a narrower floating-point type with stochastic rounding.
+///
+/// The result is one of the two representable values bracketing the source, rounded away from zero with a
+/// probability equal to the distance to the value toward zero in units of the destination ulp. `random_bits`
+/// must be uniformly distributed. As with cvt.rs.satfinite, values beyond the largest finite magnitude of the
+/// destination saturate to it and NaN is preserved.
+template <
+  typename T,
+  typename S
+>
+struct NumericConverterStochasticRound {
+
+  static_assert(cutlass::platform::is_same<S, float>::value,
+    "Stochastic rounding is only supported from float sources.");
+  static_assert(cutlass::sizeof_bits<T>::value <= 16,
+    "Stochastic rounding is only supported to 16b or narrower floating-point types.");
+
+  using result_type = T;
+  using source_type = S;
+
+  CUTLASS_HOST_DEVICE
+  static result_type convert(source_type const & s, uint32_t random_bits) {
+
+    // Sign-magnitude encoding: consecutive magnitudes are consecutive representable values
+    constexpr int kBits = cutlass::sizeof_bits<T>::value;
+    using Storage = typename cutlass::platform::conditional<(kBits > 8), uint16_t, uint8_t>::type;
+    constexpr uint32_t kSignMask = 1u << (kBits - 1);
+
+    if (s != s) {
+      return NumericConverter<T, S>::convert(s);
+    }
+
+    uint32_t const sign = (s < 0.f) ? kSignMask : 0u;
+    float const a = (s < 0.f) ? -s : s;
+
+    T const max_finite = cutlass::platform::numeric_limits<T>::max();
+    if (a >= float(max_finite)) {
+      return T::bitcast(Storage(sign | max_finite.storage));
+    }
+
+    T const nearest = NumericConverter<T, S>::convert(a);
+    uint32_t const mag = nearest.storage;
+    float const nearest_f = float(nearest);
+    if (nearest_f == a) {
+      return T::bitcast(Storage(sign | mag));
+    }
+
+    uint32_t const lo_mag = (nearest_f > a) ? mag - 1 : mag;
+    uint32_t const hi_mag = lo_mag + 1;
+    float const lo = float(T::bitcast(Storage(lo_mag)));
+    float const hi = float(T::bitcast(Storage(hi_mag)));
+
+    // 24 random bits are enough to resolve the fraction of any source float below the destination ulp
+    float const threshold = (a - lo) / (hi - lo);
+    float const u = float(random_bits >> 8) * (1.f / float(1u << 24));
+    return T::bitcast(Storage(sign | (u < threshold ? hi_mag : lo_mag)));
+  }
+
+  CUTLASS_HOST_DEVICE
+  result_type operator()(source_type const &s, uint32_t random_bits) const {
+    return convert(s, random_bits);
+  }
+};
+
+namespace detail {
+
+/// Packed cvt.rs conversions. kElements is the number of values converted by one instruction, which
+/// consumes a single 32b word of random bits. kElements == 1 denotes no hardware support.
+template <typename T>
+struct StochasticRoundPacked {
+  static constexpr int kElements = 1;
+};
+
+#if defined(CUDA_PTX_CVT_RS_ENABLED)
+
+template <>
+struct StochasticRoundPacked<cutlass::bfloat16_t> {
+  static constexpr int kElements = 2;
+
+  CUTLASS_DEVICE
+  static Array<cutlass::bfloat16_t, 2> convert(float const *source, uint32_t random_bits) {
+    uint32_t out;
+    asm volatile("cvt.rs.satfinite.bf16x2.f32 %0, %1, %2, %3;\n"
+      : "=r"(out) : "f"(source[1]), "f"(source[0]), "r"(random_bits));
+    return reinterpret_cast<Array<cutlass::bfloat16_t, 2> const &>(out);
+  }
+};
+
+template <>
+struct StochasticRoundPacked<cutlass::half_t> {
+  static constexpr int kElements = 2;
+
+  CUTLASS_DEVICE
+  static Array<cutlass::half_t, 2> convert(float const *source, uint32_t random_bits) {
+    uint32_t out;
+    asm volatile("cvt.rs.satfinite.f16x2.f32 %0, %1, %2, %3;\n"
+      : "=r"(out) : "f"(source[1]), "f"(source[0]), "r"(random_bits));
+    return reinterpret_cast<Array<cutlass::half_t, 2> const &>(out);
+  }
+};
+
+template <>
+struct StochasticRoundPacked<cutlass::float_e4m3_t> {
+  static constexpr int kElements = 4;
+
+  CUTLASS_DEVICE
+  static Array<cutlass::float_e4m3_t, 4> convert(float const *source, uint32_t random_bits) {
+    uint32_t out;
+    asm volatile("cvt.rs.satfinite.e4m3x4.f32 %0, {%1, %2, %3, %4}, %5;\n"
+      : "=r"(out) : "f"(source[3]), "f"(source[2]), "f"(source[1]), "f"(source[0]), "r"(random_bits));
+    return reinterpret_cast<Array<cutlass::float_e4m3_t, 4> const &>(out);
+  }
+};
+
+template <>
+struct StochasticRoundPacked<cutlass::float_e5m2_t> {
+  static constexpr int kElements = 4;
+
+  CUTLASS_DEVICE
+  static Array<cutlass::float_e5m2_t, 4> convert(float const *source, uint32_t random_bits) {
+    uint32_t out;
+    asm volatile("cvt.rs.satfinite.e5m2x4.f32 %0, {%1, %2, %3, %4}, %5;\n"
+      : "=r"(out) : "f"(source[3]), "f"(source[2]), "f"(source[1]), "f"(source[0]), "r"(random_bits));
+    return reinterpret_cast<Array<cutlass::float_e5m2_t, 4> const &>(out);
+  }
+};
+
+template <>
+struct StochasticRoundPacked<cutlass::float_e2m1_t> {
+  static constexpr int kElements = 4;
+
+  CUTLASS_DEVICE
+  static Array<cutlass::float_e2m1_t, 4> convert(float const *source, uint32_t random_bits) {
+    uint16_t out;
+    asm volatile("cvt.rs.satfinite.e2m1x4.f32 %0, {%1, %2, %3, %4}, %5;\n"
+      : "=h"(out) : "f"(source[3]), "f"(source[2]), "f"(source[1]), "f"(source[0]), "r"(random_bits));
+    return reinterpret_cast<Array<cutlass::float_e2m1_t, 4> const &>(out);
+  }
+};
+
+#endif // defined(CUDA_PTX_CVT_RS_ENABLED)
+
+} // namespace detail
+
+/// Converts an array of floats with stochastic rounding, consuming one word of random bits per element.
+/// When cvt.rs is available, each packed instruction uses the random word of the first element it converts.
+template <
+  typename T,
+  typename S,
+  int N
+>
+struct NumericArrayConverterStochasticRound {
+
+  using result_type = Array<T, N>;
+  using source_type = Array<S, N>;
+  using random_type = Array<uint32_t, N>;
+
+  CUTLASS_HOST_DEVICE
+  static result_type convert(source_type const & s, random_type const & random_bits) {
+    result_type result;
+
+  #if defined(__CUDA_ARCH__)
+    constexpr int kPacked = detail::StochasticRoundPacked<T>::kElements;
+    if constexpr (kPacked > 1 && N % kPacked == 0 && cutlass::platform::is_same<S, float>::value) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < N; i += kPacked) {
+        Array<T, kPacked> packed = detail::StochasticRoundPacked<T>::convert(s.data() + i, random_bits[i]);
+        CUTLASS_PRAGMA_UNROLL
+        for (int j = 0; j < kPacked; ++j) {
+          result[i + j] = packed[j];
+        }
+      }
+      return result;
+    }
+  #endif
+
+    NumericConverterStochasticRound<T, S> convert_;
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < N; ++i) {
+      result[i] = convert_(s[i], random_bits[i]);
+    }
+
+    return result;
+  }
+
+  CUTLASS_HOST_DEVICE
+  result_type operator()(source_type const &s, random_type const &random_bits) const {
+    return convert(s, random_bits);
+  }
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// Defines preferred rounding mode for a pair of types
@@ -0,0 +1,146 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Counter-based Philox4x32-10 random number generator usable from host and device code.
+
+    The generator matches the Philox4x32-10 generator of cuRAND and of Random123 (Salmon et al., "Parallel
+    Random Numbers: As Easy as 1, 2, 3", SC'11) for the same key and counter, so every thread can derive an
+    independent stream from its coordinates without keeping state in global memory.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#if defined(__CUDACC_RTC__)
+#include CUDA_STD_HEADER(cstdint)
+#else
+#include <cstdint>
+#endif
+#include "cutlass/array.h"
+
+namespace cutlass {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Philox4x32 generator with a configurable number of rounds (10 is the standard choice)
+template <int Rounds = 10>
+struct Philox4x32 {
+
+  using Counter = Array<uint32_t, 4>;
+  using Key = Array<uint32_t, 2>;
+  using result_type = Array<uint32_t, 4>;
+
+  static constexpr uint32_t kMultiplierA = 0xD2511F53u;
+  static constexpr uint32_t kMultiplierB = 0xCD9E8D57u;
+  static constexpr uint32_t kWeylA = 0x9E3779B9u;
+  static constexpr uint32_t kWeylB = 0xBB67AE85u;
+
+  Counter counter;
+  Key key;
+
+  /// Constructs a generator for the given 64b seed and 128b starting counter
+  CUTLASS_HOST_DEVICE
+  Philox4x32(uint64_t seed = 0, uint32_t c0 = 0, uint32_t c1 = 0, uint32_t c2 = 0, uint32_t c3 = 0) {
+    key[0] = uint32_t(seed);
+    key[1] = uint32_t(seed >> 32);
+    counter[0] = c0;
+    counter[1] = c1;
+    counter[2] = c2;
+    counter[3] = c3;
+  }
+
+  /// Stateless Philox bijection: maps a counter to four random words under the given key
+  CUTLASS_HOST_DEVICE
+  static result_type generate(Counter ctr, Key k) {
+    CUTLASS_PRAGMA_UNROLL
+    for (int r = 0; r < Rounds; ++r) {
+      uint32_t hi0, lo0, hi1, lo1;
+      mulhilo(kMultiplierA, ctr[0], hi0, lo0);
+      mulhilo(kMultiplierB, ctr[2], hi1, lo1);
+      Counter next;
+      next[0] = hi1 ^ ctr[1] ^ k[0];
+      next[1] = lo1;
+      next[2] = hi0 ^ ctr[3] ^ k[1];
+      next[3] = lo0;
+      ctr = next;
+      k[0] += kWeylA;
+      k[1] += kWeylB;
+    }
+    return ctr;
+  }
+
+  /// Returns the next four random words and advances the counter
+  CUTLASS_HOST_DEVICE
+  result_type operator()() {
+    result_type result = generate(counter, key);
+    advance(1);
+    return result;
+  }
+
+  /// Skips `n` blocks of four random words
+  CUTLASS_HOST_DEVICE
+  void advance(uint64_t n) {
+    uint32_t lo = uint32_t(n);
+    uint32_t hi = uint32_t(n >> 32);
+    counter[0] += lo;
+    if (counter[0] < lo) {
+      ++hi;
+    }
+    counter[1] += hi;
+    if (counter[1] < hi) {
+      if (++counter[2] == 0) {
+        ++counter[3];
+      }
+    }
+  }
+
+private:
+
+  CUTLASS_HOST_DEVICE
+  static void mulhilo(uint32_t a, uint32_t b, uint32_t &hi, uint32_t &lo) {
+  #if defined(__CUDA_ARCH__)
+    hi = __umulhi(a, b);
+    lo = a * b;
+  #else
+    uint64_t product = uint64_t(a) * uint64_t(b);
+    hi = uint32_t(product >> 32);
+    lo = uint32_t(product);
+  #endif
+  }
+};
+
+using Philox4x32_10 = Philox4x32<10>;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
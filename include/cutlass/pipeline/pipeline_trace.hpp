@@ -0,0 +1,369 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Stall instrumentation for the asynchronous pipelines.
+
+    When CUTLASS_ENABLE_PIPELINE_TRACE is defined, every blocking producer_acquire() and
+    consumer_wait() of the SM90 and SM100 pipelines records the time one lane of the waiting warp
+    spent on the barrier into a device buffer. The warp-specialized SM90 and SM100 GEMM kernels
+    additionally record the regions each warp role spends in the mainloop, the epilogue, the tile
+    scheduler and TMEM allocation. pipeline_trace_setup() allocates the buffer and
+    pipeline_trace_collect() copies the accumulated records back to the host, where they can be
+    reduced to per-stage stall histograms or written as a Chrome trace (chrome://tracing, Perfetto).
+
+    Without CUTLASS_ENABLE_PIPELINE_TRACE the device hooks compile to nothing.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cute/arch/util.hpp"
+
+#if defined(__CUDACC_RTC__)
+#include CUDA_STD_HEADER(cstdint)
+#else
+#include <cstdint>
+#endif
+
+#if !defined(__CUDACC_RTC__)
+#include <algorithm>
+#include <cstdio>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <vector>
+#endif
+
+namespace cutlass {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Pipeline operation during which a warp waited on a barrier, or kernel region a warp role executed
+enum class PipelineTraceEvent : uint16_t {
+  kNone = 0,
+  kProducerAcquire = 1,   ///< producer waiting for a consumer to release a stage
+  kConsumerWait = 2,      ///< consumer waiting for a producer to fill a stage
+  kMainloopLoad = 3,      ///< producer issuing the mainloop loads of one tile
+  kMainloopMma = 4,       ///< consumer issuing the mainloop MMAs of one tile
+  kEpilogue = 5,          ///< epilogue of one tile
+  kEpilogueTail = 6,      ///< draining the epilogue pipelines after the last tile
+  kSchedulerFetch = 7,    ///< fetching the next work tile from the tile scheduler
+  kTmemAlloc = 8          ///< allocating tensor memory
+};
+
+/// One wait or region recorded by a warp
+struct PipelineTraceRecord {
+  uint64_t start;         ///< %globaltimer at the start of the wait or region (ns)
+  uint32_t duration;      ///< time spent waiting or in the region (ns)
+  uint16_t event;         ///< PipelineTraceEvent
+  uint16_t stage;         ///< pipeline stage waited on, zero for regions
+  uint32_t block;         ///< linear block index within the grid
+  uint32_t warp;          ///< warp index within the block
+  uint32_t pipeline;      ///< shared memory address of the pipeline's barriers, zero for regions
+  uint32_t sm;            ///< SM on which the block ran
+};
+
+/// Number of records retained per device. Once the buffer is full, new records overwrite the
+/// oldest ones.
+constexpr uint32_t pipeline_trace_cap = 1 << 20;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ENABLE_PIPELINE_TRACE)
+
+#if !defined(__CUDACC_RTC__)
+inline std::mutex pipeline_trace_mutex;
+inline std::vector<void*> pipeline_trace_buf_list;
+#endif
+
+#if defined(__NVCC__) || (defined(__clang__) && defined(__CUDA__))
+/// Record count followed by a ring of pipeline_trace_cap records
+CUTLASS_DEVICE uint32_t* pipeline_trace_buf;
+#endif
+
+#endif // defined(CUTLASS_ENABLE_PIPELINE_TRACE)
+
+/// Returns the time at which a wait begins, or zero if tracing is disabled
+CUTLASS_DEVICE
+uint64_t pipeline_trace_timestamp() {
+  #if defined(CUTLASS_ENABLE_PIPELINE_TRACE) && defined(__CUDA_ARCH__)
+  uint64_t time64;
+  asm volatile (
+    "mov.u64 %0, %%globaltimer;\n"
+    : "=l"(time64) :
+  );
+  return time64;
+  #else
+  return 0;
+  #endif
+}
+
+/// Records a wait that began at `start`. Only the first lane of each warp emits a record.
+CUTLASS_DEVICE
+void pipeline_trace_emit(PipelineTraceEvent event, uint32_t stage, void const* barriers, uint64_t start) {
+  #if defined(CUTLASS_ENABLE_PIPELINE_TRACE) && defined(__CUDA_ARCH__)
+  if (pipeline_trace_buf == nullptr || (threadIdx.x % 32) != 0) {
+    return;
+  }
+  uint64_t end = pipeline_trace_timestamp();
+  uint32_t at = atomicAdd(&pipeline_trace_buf[0], 1u) % pipeline_trace_cap;
+  uint32_t sm;
+  asm volatile ("mov.u32 %0, %%smid;\n" : "=r"(sm));
+
+  PipelineTraceRecord record;
+  record.start = start;
+  record.duration = static_cast<uint32_t>(end - start);
+  record.event = static_cast<uint16_t>(event);
+  record.stage = static_cast<uint16_t>(stage);
+  record.block = blockIdx.x + gridDim.x * (blockIdx.y + gridDim.y * blockIdx.z);
+  record.warp = (threadIdx.x + blockDim.x * (threadIdx.y + blockDim.y * threadIdx.z)) / 32;
+  record.pipeline = barriers != nullptr ? cute::cast_smem_ptr_to_uint(barriers) : 0u;
+  record.sm = sm;
+
+  // Records start after a 16B header holding the record count
+  reinterpret_cast<PipelineTraceRecord*>(pipeline_trace_buf + 4)[at] = record;
+  #else
+  CUTLASS_UNUSED(event);
+  CUTLASS_UNUSED(stage);
+  CUTLASS_UNUSED(barriers);
+  CUTLASS_UNUSED(start);
+  #endif
+}
+
+/// Records a kernel region that began at `start`. Only the first thread of every
+/// `ThreadsPerRecord` threads emits a record, so a warp group executing a role together is recorded
+/// once, by its first warp.
+template <int ThreadsPerRecord = NumThreadsPerWarpGroup>
+CUTLASS_DEVICE
+void pipeline_trace_emit_region(PipelineTraceEvent event, uint64_t start) {
+  static_assert(ThreadsPerRecord % NumThreadsPerWarp == 0, "Regions are recorded per warp or per group of warps.");
+  #if defined(CUTLASS_ENABLE_PIPELINE_TRACE) && defined(__CUDA_ARCH__)
+  if ((threadIdx.x % ThreadsPerRecord) == 0) {
+    pipeline_trace_emit(event, 0, nullptr, start);
+  }
+  #else
+  CUTLASS_UNUSED(event);
+  CUTLASS_UNUSED(start);
+  #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(__CUDACC_RTC__)
+
+/// Allocates the trace buffer of every device on first use. Records accumulate across launches
+/// until they are collected.
+inline void pipeline_trace_setup() {
+  #if defined(CUTLASS_ENABLE_PIPELINE_TRACE)
+  #if defined(__NVCC__) || (defined(__clang__) && defined(__CUDA__))
+  std::scoped_lock lock(pipeline_trace_mutex);
+  if (!pipeline_trace_buf_list.empty()) {
+    return;
+  }
+  auto fail = [] () {
+    fprintf(stderr, "pipeline_trace_setup() failed\n");
+    std::terminate();
+  };
+  int orig_device = 0;
+  int device_count = 0;
+  if (cudaGetDevice(&orig_device) != cudaSuccess ||
+      cudaGetDeviceCount(&device_count) != cudaSuccess) {
+    fail();
+  }
+  size_t bytes = 4 * sizeof(uint32_t) + pipeline_trace_cap * sizeof(PipelineTraceRecord);
+  for (int device = 0; device < device_count; device++) {
+    void* buf = nullptr;
+    if (cudaSetDevice(device) != cudaSuccess ||
+        cudaMalloc(&buf, bytes) != cudaSuccess ||
+        cudaMemset(buf, 0, 4 * sizeof(uint32_t)) != cudaSuccess ||
+        cudaMemcpyToSymbol(pipeline_trace_buf, &buf, sizeof(buf)) != cudaSuccess) {
+      fail();
+    }
+    pipeline_trace_buf_list.push_back(buf);
+  }
+  if (cudaSetDevice(orig_device) != cudaSuccess) {
+    fail();
+  }
+  #endif
+  #endif // defined(CUTLASS_ENABLE_PIPELINE_TRACE)
+}
+
+/// Synchronizes the current device and returns the records accumulated since the last call, or the
+/// most recent pipeline_trace_cap of them, ordered by start time. Returns an empty vector if
+/// tracing is disabled.
+inline std::vector<PipelineTraceRecord> pipeline_trace_collect() {
+  std::vector<PipelineTraceRecord> records;
+  #if defined(CUTLASS_ENABLE_PIPELINE_TRACE)
+  #if defined(__NVCC__) || (defined(__clang__) && defined(__CUDA__))
+  std::scoped_lock lock(pipeline_trace_mutex);
+  int device = 0;
+  if (cudaGetDevice(&device) != cudaSuccess || size_t(device) >= pipeline_trace_buf_list.size() ||
+      cudaDeviceSynchronize() != cudaSuccess) {
+    return records;
+  }
+  uint32_t* buf = static_cast<uint32_t*>(pipeline_trace_buf_list[device]);
+  uint32_t count = 0;
+  if (cudaMemcpy(&count, buf, sizeof(count), cudaMemcpyDeviceToHost) != cudaSuccess) {
+    return records;
+  }
+  records.resize(count < pipeline_trace_cap ? count : pipeline_trace_cap);
+  if (!records.empty() &&
+      cudaMemcpy(records.data(), buf + 4, records.size() * sizeof(PipelineTraceRecord),
+                 cudaMemcpyDeviceToHost) != cudaSuccess) {
+    records.clear();
+  }
+  if (count > pipeline_trace_cap) {
+    // The ring wrapped: slots hold records from different passes over the buffer
+    std::sort(records.begin(), records.end(),
+      [] (PipelineTraceRecord const& lhs, PipelineTraceRecord const& rhs) { return lhs.start < rhs.start; });
+  }
+  (void)cudaMemset(buf, 0, sizeof(uint32_t));
+  #endif
+  #endif // defined(CUTLASS_ENABLE_PIPELINE_TRACE)
+  return records;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline char const* to_string(PipelineTraceEvent event) {
+  switch (event) {
+    case PipelineTraceEvent::kProducerAcquire: return "producer_acquire";
+    case PipelineTraceEvent::kConsumerWait: return "consumer_wait";
+    case PipelineTraceEvent::kMainloopLoad: return "mainloop_load";
+    case PipelineTraceEvent::kMainloopMma: return "mainloop_mma";
+    case PipelineTraceEvent::kEpilogue: return "epilogue";
+    case PipelineTraceEvent::kEpilogueTail: return "epilogue_tail";
+    case PipelineTraceEvent::kSchedulerFetch: return "scheduler_fetch";
+    case PipelineTraceEvent::kTmemAlloc: return "tmem_alloc";
+    default: break;
+  }
+  return "none";
+}
+
+/// Distribution of the waits of one event on one stage of one pipeline. Bucket i counts waits
+/// lasting [2^i, 2^(i+1)) ns; bucket 0 also counts waits shorter than 1 ns.
+struct PipelineStallHistogram {
+  static constexpr int kBuckets = 32;
+
+  uint64_t count = 0;
+  uint64_t total_ns = 0;
+  uint32_t max_ns = 0;
+  uint64_t buckets[kBuckets] = {};
+
+  void add(uint32_t duration) {
+    int bucket = 0;
+    while (bucket + 1 < kBuckets && (duration >> (bucket + 1)) != 0) {
+      ++bucket;
+    }
+    ++buckets[bucket];
+    ++count;
+    total_ns += duration;
+    max_ns = duration > max_ns ? duration : max_ns;
+  }
+};
+
+/// Key of a histogram: pipeline (shared memory address), event and stage
+using PipelineStallKey = std::tuple<uint32_t, PipelineTraceEvent, uint32_t>;
+
+/// Reduces records to one histogram per pipeline, event and stage
+inline std::map<PipelineStallKey, PipelineStallHistogram>
+pipeline_trace_histograms(std::vector<PipelineTraceRecord> const& records) {
+  std::map<PipelineStallKey, PipelineStallHistogram> histograms;
+  for (auto const& record : records) {
+    PipelineStallKey key{record.pipeline, static_cast<PipelineTraceEvent>(record.event), record.stage};
+    histograms[key].add(record.duration);
+  }
+  return histograms;
+}
+
+/// Prints one line per pipeline, event and stage with the number of waits, their mean and maximum
+/// duration, and the nonempty histogram buckets
+inline std::ostream& pipeline_trace_print_histograms(std::ostream& out, std::vector<PipelineTraceRecord> const& records) {
+  for (auto const& [key, histogram] : pipeline_trace_histograms(records)) {
+    out << "pipeline=0x" << std::hex << std::get<0>(key) << std::dec
+        << " " << to_string(std::get<1>(key))
+        << " stage=" << std::get<2>(key)
+        << " waits=" << histogram.count
+        << " mean_ns=" << (histogram.count ? histogram.total_ns / histogram.count : 0)
+        << " max_ns=" << histogram.max_ns
+        << " buckets_log2_ns=";
+    char const* sep = "";
+    for (int i = 0; i < PipelineStallHistogram::kBuckets; ++i) {
+      if (histogram.buckets[i]) {
+        out << sep << i << ":" << histogram.buckets[i];
+        sep = ",";
+      }
+    }
+    out << "\n";
+  }
+  return out;
+}
+
+/// Writes the records in the Chrome trace event format. Each block is a process and each warp a
+/// thread, so that the waits and regions of the producer and consumer warps appear on separate
+/// timelines.
+inline std::ostream& pipeline_trace_write_chrome_trace(std::ostream& out, std::vector<PipelineTraceRecord> const& records) {
+  uint64_t origin = ~uint64_t(0);
+  for (auto const& record : records) {
+    origin = record.start < origin ? record.start : origin;
+  }
+
+  out << "{\"traceEvents\":[";
+  char const* sep = "\n";
+  for (auto const& record : records) {
+    uint64_t ts = record.start - origin;
+    // Regions are not tied to a pipeline
+    std::string cat = record.pipeline != 0 ? "stage" + std::to_string(record.stage) : "region";
+    out << sep
+        << "{\"name\":\"" << to_string(static_cast<PipelineTraceEvent>(record.event))
+        << "\",\"cat\":\"" << cat
+        << "\",\"ph\":\"X\",\"ts\":" << ts / 1000 << "." << (ts % 1000) / 100 << (ts % 100) / 10 << ts % 10
+        << ",\"dur\":" << record.duration / 1000 << "." << (record.duration % 1000) / 100
+        << (record.duration % 100) / 10 << record.duration % 10
+        << ",\"pid\":" << record.block
+        << ",\"tid\":" << record.warp
+        << ",\"args\":{\"stage\":" << record.stage
+        << ",\"sm\":" << record.sm
+        << ",\"pipeline\":" << record.pipeline << "}}";
+    sep = ",\n";
+  }
+  out << "\n]}\n";
+  return out;
+}
+
+#endif // !defined(__CUDACC_RTC__)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
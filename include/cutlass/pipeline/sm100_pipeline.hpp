@@ -1097,7 +1097,9 @@ private:
     // 1. Wait for empty barrier to be ready
     // 2. Set the transaction bytes set to occur on the Full barrier for all blocks
     if (barrier_token == BarrierStatus::WaitAgain) {
+      uint64_t trace_start = pipeline_trace_timestamp();
       empty_barrier_ptr_[stage].wait(phase);
+      pipeline_trace_emit(PipelineTraceEvent::kProducerAcquire, stage, empty_barrier_ptr_, trace_start);
     }
 
     full_barrier_ptr_[stage].arrive_and_expect_tx(params_.transaction_bytes, lane_idx_, uint32_t(lane_idx_ < cluster_size_));
@@ -1124,7 +1126,9 @@ private:
   void consumer_wait(uint32_t stage, uint32_t phase, ConsumerToken barrier_token) {
     detail::pipeline_check_is_consumer(params_.role);
     if (barrier_token == BarrierStatus::WaitAgain) {
+      uint64_t trace_start = pipeline_trace_timestamp();
       full_barrier_ptr_[stage].wait(phase);
+      pipeline_trace_emit(PipelineTraceEvent::kConsumerWait, stage, full_barrier_ptr_, trace_start);
     }
   }
 
@@ -1324,7 +1328,9 @@ private:
   void producer_acquire(uint32_t stage, uint32_t phase, bool load_e, ProducerToken barrier_token) {
     detail::pipeline_check_is_producer(params_.role);
     if (barrier_token == BarrierStatus::WaitAgain) {
+      uint64_t trace_start = pipeline_trace_timestamp();
       empty_barrier_ptr_[stage].wait(phase);
+      pipeline_trace_emit(PipelineTraceEvent::kProducerAcquire, stage, empty_barrier_ptr_, trace_start);
     }
     uint32_t bytes_now = load_e ? params_metadata_.transaction_bytes + params_metadata_.metadata_transaction_bytes : params_metadata_.transaction_bytes;
 
@@ -42,6 +42,7 @@
 #include "cutlass/cutlass.h"
 #include "cutlass/arch/barrier.h"
 #include "cutlass/detail/dependent_false.hpp"
+#include "cutlass/pipeline/pipeline_trace.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -348,7 +349,8 @@ public:
 
       if (cluster_size == 1) {
         is_signaling_thread_ = true;
-        dst_blockid_ = 0;
+        // The pipeline is CTA-local, but the CTA may still be launched as part of a larger cluster
+        dst_blockid_ = cute::block_rank_in_cluster();
       }
       else {
         // STEP 1 : Use Cute Layout function to generate an optimal dst block-id (0-15)
@@ -510,7 +512,9 @@ private:
 
   CUTLASS_DEVICE
   void producer_acquire(uint32_t stage, uint32_t phase) {
+    uint64_t trace_start = pipeline_trace_timestamp();
     empty_barrier_ptr_[stage].wait(phase);
+    pipeline_trace_emit(PipelineTraceEvent::kProducerAcquire, stage, empty_barrier_ptr_, trace_start);
 
     if (params_.is_leader) {
       full_barrier_ptr_[stage].arrive_and_expect_tx(params_.transaction_bytes);
@@ -531,7 +535,9 @@ private:
   void producer_acquire(uint32_t stage, uint32_t phase, ProducerToken barrier_token) {
     detail::pipeline_check_is_producer(params_.role);
     if (barrier_token != BarrierStatus::WaitDone) {
+      uint64_t trace_start = pipeline_trace_timestamp();
       empty_barrier_ptr_[stage].wait(phase);
+      pipeline_trace_emit(PipelineTraceEvent::kProducerAcquire, stage, empty_barrier_ptr_, trace_start);
     }
 
     if (params_.is_leader) {
@@ -610,7 +616,9 @@ private:
   CUTLASS_DEVICE
   void consumer_wait(uint32_t stage, uint32_t phase) {
     detail::pipeline_check_is_consumer(params_.role);
+    uint64_t trace_start = pipeline_trace_timestamp();
     full_barrier_ptr_[stage].wait(phase);
+    pipeline_trace_emit(PipelineTraceEvent::kConsumerWait, stage, full_barrier_ptr_, trace_start);
   }
 
   // Wait for producer to commit transactions (done by TMA)
@@ -618,7 +626,9 @@ private:
   void consumer_wait(uint32_t stage, uint32_t phase, ConsumerToken barrier_token) {
     detail::pipeline_check_is_consumer(params_.role);
     if (barrier_token == BarrierStatus::WaitAgain) {
+      uint64_t trace_start = pipeline_trace_timestamp();
       full_barrier_ptr_[stage].wait(phase);
+      pipeline_trace_emit(PipelineTraceEvent::kConsumerWait, stage, full_barrier_ptr_, trace_start);
     }
   }
 
@@ -934,7 +944,9 @@ private:
   void producer_acquire(uint32_t stage, uint32_t phase, ProducerToken barrier_token) {
     detail::pipeline_check_is_producer(params_.role);
     if (barrier_token == BarrierStatus::WaitAgain) {
+      uint64_t trace_start = pipeline_trace_timestamp();
       empty_barrier_ptr_[stage].wait(phase);
+      pipeline_trace_emit(PipelineTraceEvent::kProducerAcquire, stage, empty_barrier_ptr_, trace_start);
     }
   }
 
@@ -980,7 +992,9 @@ private:
   void consumer_wait(uint32_t stage, uint32_t phase, ConsumerToken barrier_token) {
     detail::pipeline_check_is_consumer(params_.role);
     if (barrier_token == BarrierStatus::WaitAgain) {
+      uint64_t trace_start = pipeline_trace_timestamp();
       full_barrier_ptr_[stage].wait(phase);
+      pipeline_trace_emit(PipelineTraceEvent::kConsumerWait, stage, full_barrier_ptr_, trace_start);
     }
   }
 
@@ -1185,7 +1199,9 @@ private:
   void producer_acquire(uint32_t stage, uint32_t phase, ProducerToken barrier_token) {
     detail::pipeline_check_is_producer(params_.role);
     if (barrier_token == BarrierStatus::WaitAgain) {
+      uint64_t trace_start = pipeline_trace_timestamp();
       empty_barrier_ptr_[stage].wait(phase);
+      pipeline_trace_emit(PipelineTraceEvent::kProducerAcquire, stage, empty_barrier_ptr_, trace_start);
     }
   }
 
@@ -1220,7 +1236,9 @@ private:
     detail::pipeline_check_is_consumer(params_.role);
     bool done = full_barrier_ptr_[stage].test_wait(phase);
     if (!done) {
+      uint64_t trace_start = pipeline_trace_timestamp();
       full_barrier_ptr_[stage].wait(phase);
+      pipeline_trace_emit(PipelineTraceEvent::kConsumerWait, stage, full_barrier_ptr_, trace_start);
     }
   }
 
@@ -1228,7 +1246,9 @@ private:
   void consumer_wait(uint32_t stage, uint32_t phase, ConsumerToken barrier_token) {
     detail::pipeline_check_is_consumer(params_.role);
     if (barrier_token == BarrierStatus::WaitAgain) {
+      uint64_t trace_start = pipeline_trace_timestamp();
       full_barrier_ptr_[stage].wait(phase);
+      pipeline_trace_emit(PipelineTraceEvent::kConsumerWait, stage, full_barrier_ptr_, trace_start);
     }
   }
 
@@ -0,0 +1,762 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Device-wide reduction over an arbitrary set of modes of an affine tensor
+*/
+
+#pragma once
+
+#include <climits>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/device_kernel.h"
+#include "cutlass/kernel_hardware_info.h"
+#include "cutlass/trace.h"
+
+#include "cute/layout.hpp"
+
+#include "cutlass/epilogue/thread/activation.h"
+#include "cutlass/reduction/kernel/tensor_reduce_affine_strided.h"
+#include "cutlass/reduction/kernel/tensor_reduce_affine_contiguous.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace reduction {
+namespace device {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Tensor reduction operator over any subset of the modes of an affine tensor.
+///
+/// The source tensor is described by a flat CuTe layout of rank Rank and the reduced modes by a
+/// bitmask whose bit i selects mode i. The destination layout has the same rank and an extent of
+/// one in each reduced mode. For example, reducing H and W of an NHWC tensor uses the mask 0b0110
+/// and a destination of shape (N, 1, 1, C).
+///
+/// Modes of extent one are dropped and modes which are contiguous with one another in both tensors
+/// are coalesced. If the unit-stride mode of the source is kept, the reduction is performed by
+/// kernel::TensorReductionAffineStrided with vectorized accesses along that mode. Otherwise the
+/// reduced modes are traversed by kernel::TensorReductionAffineContiguous.
+///
+/// Either kernel completes the reduction in one pass, or splits the reduced modes across CTAs and
+/// completes it with a second kernel reducing the partials in a device workspace. The plan with the
+/// lower estimated cost is chosen.
+///
+/// Accesses are VectorLength elements wide (128b by default) whenever the extent of the unit-stride
+/// mode, the remaining strides and the pointers are divisible by it. Otherwise a scalar kernel is used.
+template <
+  int Rank,                                   ///< Rank of source tensor (e.g. NDHWC => 5)
+  typename ElementOutput_,                    ///< Data type of output tensor
+  typename ElementSource_,                    ///< Data type of source tensor
+  typename ReductionOp_,                      ///< Reduction operator
+  int VectorLength = 128 / sizeof_bits<ElementSource_>::value,   ///< Vector length for memory
+  typename ElementCompute_ = ElementOutput_,  ///< Internal compute type - input type of reduction operation
+  typename PreOp_ = epilogue::thread::Identity<ElementCompute_>,  ///< Elementwise operator applied to source elements
+  typename PostOp_ = epilogue::thread::Identity<ElementCompute_>, ///< Elementwise operator applied to reduced elements
+  int Threads = 256,                          ///< Number of participating threads
+  int BatchSize = 4                           ///< Number of elements to load per batch
+>
+struct TensorReductionMultiAxis {
+
+  static int const kRank = Rank;
+  static int const kVectorLength = VectorLength;
+  static int const kThreads = Threads;
+  static int const kBatchSize = BatchSize;
+
+  /// The underlying kernels have kRank outer modes, kRank inner modes and one unit-stride mode.
+  /// Modes which are not needed by a problem have an extent of one.
+  static int const kKernelRank = 2 * kRank + 1;
+
+  using ElementOutput = ElementOutput_;
+  using ElementSource = ElementSource_;
+  using ReductionOp = ReductionOp_;
+  using ElementCompute = ElementCompute_;
+  using PreOp = PreOp_;
+  using PostOp = PostOp_;
+
+  template <int V>
+  using StridedKernel = kernel::TensorReductionAffineStrided<
+    kKernelRank, kRank + 1, ElementOutput, ElementSource, ReductionOp, V, ElementCompute,
+    kThreads, kBatchSize, PreOp, PostOp>;
+
+  template <int V>
+  using StridedFinalKernel = kernel::TensorReductionAffineStridedFinal<
+    kKernelRank, kRank + 1, ElementOutput, ElementSource, ReductionOp, V, ElementCompute,
+    kThreads, kBatchSize, PreOp, PostOp>;
+
+  template <int V>
+  using ContiguousKernel = kernel::TensorReductionAffineContiguous<
+    kKernelRank, kRank, ElementOutput, ElementSource, ReductionOp, V, ElementCompute,
+    kThreads, kBatchSize, PreOp, PostOp>;
+
+  template <int V>
+  using ContiguousFinalKernel = kernel::TensorReductionAffineContiguousFinal<
+    kKernelRank, kRank, ElementOutput, ElementSource, ReductionOp, V, ElementCompute,
+    kThreads, kBatchSize, PreOp, PostOp>;
+
+  /// Approximate number of bytes streamed by one CTA over the latency of an additional kernel launch.
+  /// Used to weigh the second pass of a split reduction against its added parallelism.
+  static int64_t const kLaunchCostBytes = 32 * 1024;
+
+  /// Launch configuration for one vector length
+  struct Plan {
+
+    /// Vector length of memory accesses
+    int vector_length = 1;
+
+    /// CUDA Grid shape (.x => contiguous, .y => outer, .z => inner)
+    dim3 grid_shape = dim3(0, 0, 0);
+
+    /// CUDA Threadblock shape (.x => contiguous, .y => outer, .z => inner)
+    dim3 threadblock_shape = dim3(0, 0, 0);
+
+    /// CUDA grid shape for the final reduction step if needed
+    dim3 grid_final = dim3(0, 0, 0);
+
+    /// CUDA threadblock shape for the final reduction step if needed
+    dim3 threadblock_final = dim3(0, 0, 0);
+
+    /// Number of workspaces needed. Zero if the reduction completes in one pass.
+    int workspace_count = 0;
+
+    /// Stride (units of bytes) between workspaces
+    int64_t workspace_stride = 0;
+
+    /// Size (in bytes) of the device workspace
+    int64_t workspace_size = 0;
+
+    /// Estimated cost of the plan
+    int64_t cost = 0;
+  };
+
+  //
+  // Data members
+  //
+
+  /// Internal status field
+  Status status;
+
+  /// True if the unit-stride mode is reduced, selecting TensorReductionAffineContiguous
+  bool contiguous;
+
+  /// True if the layouts permit accesses of kVectorLength elements
+  bool vectorizable;
+
+  /// Extent of the kernel modes (outer modes, inner modes and the unit-stride mode)
+  Coord<kKernelRank> extent;
+
+  /// Source stride (units of elements) of each kernel mode but the unit-stride mode
+  int64_t src_stride[kKernelRank - 1];
+
+  /// Destination stride (units of elements) of each outer kernel mode
+  int64_t dst_stride[kRank];
+
+  /// Number of points in the outer index space
+  int64_t outer_count;
+
+  /// Number of elements in the inner index space, excluding the unit-stride mode
+  int64_t inner_count;
+
+  /// Plan using accesses of kVectorLength elements
+  Plan plan_vector;
+
+  /// Plan using accesses of one element
+  Plan plan_scalar;
+
+private:
+
+  /// One mode of the problem
+  struct Mode {
+    int64_t extent;
+    int64_t src_stride;
+    int64_t dst_stride;
+  };
+
+  //
+  // Methods
+  //
+
+  /// Helper to reshape 'count' such that it is less than 2 x 'ext'
+  static int reshape_pow2(int64_t ext, int count) {
+    if (ext > count) {
+      return 1;
+    }
+    int x = 1;
+    for (; count >= ext * 2; ) {
+      count >>= 1;
+      x <<= 1;
+    }
+    return x;
+  }
+
+  static int64_t ceil_div(int64_t a, int64_t b) {
+    return (a + b - 1) / b;
+  }
+
+  /// Orders modes by decreasing source stride and merges modes which are contiguous with the
+  /// next one in the source and, if 'match_dst' is set, in the destination.
+  static void coalesce(Mode *modes, int &count, bool match_dst) {
+
+    for (int i = 1; i < count; ++i) {
+      for (int j = i; j > 0 && modes[j - 1].src_stride < modes[j].src_stride; --j) {
+        Mode tmp = modes[j - 1];
+        modes[j - 1] = modes[j];
+        modes[j] = tmp;
+      }
+    }
+
+    int merged = 0;
+    for (int i = 0; i < count; ++i) {
+      if (merged) {
+        Mode &prev = modes[merged - 1];
+        Mode const &mode = modes[i];
+
+        bool src_contiguous = (prev.src_stride == mode.src_stride * mode.extent);
+        bool dst_contiguous = !match_dst || (prev.dst_stride == mode.dst_stride * mode.extent);
+
+        if (src_contiguous && dst_contiguous && prev.extent * mode.extent <= INT_MAX) {
+          prev.extent *= mode.extent;
+          prev.src_stride = mode.src_stride;
+          prev.dst_stride = mode.dst_stride;
+          continue;
+        }
+      }
+      modes[merged++] = modes[i];
+    }
+    count = merged;
+  }
+
+  /// Estimated cost, in bytes streamed per concurrently running CTA
+  static int64_t estimate_cost(
+    int64_t src_bytes,
+    int64_t dst_bytes,
+    int64_t workspace_bytes,
+    int64_t ctas,
+    int64_t final_ctas,
+    int64_t target_ctas) {
+
+    int64_t cost = (src_bytes + workspace_bytes) / std::max(int64_t(1), std::min(ctas, target_ctas));
+
+    if (workspace_bytes) {
+      cost += (workspace_bytes + dst_bytes) / std::max(int64_t(1), std::min(final_ctas, target_ctas));
+      cost += kLaunchCostBytes;
+    }
+    else {
+      cost += dst_bytes / std::max(int64_t(1), std::min(ctas, target_ctas));
+    }
+
+    return cost;
+  }
+
+  /// Plans a reduction by TensorReductionAffineStrided
+  Plan plan_strided(int vector_length, int target_ctas) const {
+
+    Plan plan;
+    plan.vector_length = vector_length;
+
+    int64_t extent_c = extent[kKernelRank - 1];
+    int64_t vectors_c = ceil_div(extent_c, vector_length);
+
+    // Threads along the unit-stride mode, with the remaining threads assigned to the inner modes
+    // or, if there are too few inner elements to occupy them, to the outer modes.
+    int cta_ways = reshape_pow2(vectors_c, kThreads);
+    int cta_threads_x = kThreads / cta_ways;
+    int cta_threads_z = std::min(cta_ways, 64);
+
+    while (cta_threads_z > 1 && cta_threads_z / 2 >= inner_count) {
+      cta_threads_z /= 2;
+    }
+
+    // Only the CTA-wide reduction over .z synchronizes, so .y is only used if .z is not
+    int cta_threads_y = (cta_threads_z == 1 ? kThreads / cta_threads_x : 1);
+
+    while (cta_threads_y > 1 && cta_threads_y / 2 >= outer_count) {
+      cta_threads_y /= 2;
+    }
+
+    plan.threadblock_shape = dim3(cta_threads_x, cta_threads_y, cta_threads_z);
+
+    int64_t cta_count_x = ceil_div(vectors_c, cta_threads_x);
+    int64_t cta_count_y = std::max(int64_t(1), target_ctas / cta_count_x);
+    cta_count_y = std::min(cta_count_y, ceil_div(outer_count, cta_threads_y));
+    cta_count_y = std::min(cta_count_y, int64_t(65535));
+
+    int64_t src_bytes = outer_count * inner_count * extent_c * sizeof_bits<ElementSource>::value / 8;
+    int64_t dst_bytes = outer_count * extent_c * sizeof_bits<ElementOutput>::value / 8;
+    int64_t partial_bytes = outer_count * extent_c * sizeof_bits<ElementCompute>::value / 8;
+
+    plan.grid_shape = dim3(int(cta_count_x), int(cta_count_y), 1);
+    plan.cost = estimate_cost(src_bytes, dst_bytes, 0, cta_count_x * cta_count_y, 0, target_ctas);
+
+    // Consider splitting the inner modes across CTAs
+    int64_t cta_count_z = std::max(int64_t(1), target_ctas / (cta_count_x * cta_count_y));
+    cta_count_z = std::min(cta_count_z, ceil_div(inner_count, cta_threads_z));
+    cta_count_z = std::min(cta_count_z, int64_t(65535));
+
+    if (cta_count_z > 1) {
+
+      int64_t final_count_y = std::min(outer_count, int64_t(65535));
+
+      int64_t cost = estimate_cost(
+        src_bytes,
+        dst_bytes,
+        partial_bytes * cta_count_z,
+        cta_count_x * cta_count_y * cta_count_z,
+        cta_count_x * final_count_y,
+        target_ctas);
+
+      if (cost < plan.cost) {
+        plan.grid_shape.z = int(cta_count_z);
+        plan.grid_final = dim3(int(cta_count_x), int(final_count_y), 1);
+        plan.threadblock_final = dim3(cta_threads_x, 1, 1);
+        plan.workspace_count = int(cta_count_z);
+        plan.workspace_stride = extent_c * sizeof_bits<ElementCompute>::value / 8;
+        plan.workspace_size = partial_bytes * cta_count_z;
+        plan.cost = cost;
+      }
+    }
+
+    return plan;
+  }
+
+  /// Plans a reduction by TensorReductionAffineContiguous
+  Plan plan_contiguous(int vector_length, int target_ctas) const {
+
+    Plan plan;
+    plan.vector_length = vector_length;
+
+    int64_t inner_elements = inner_count * extent[kKernelRank - 1];
+    int64_t inner_vectors = inner_elements / vector_length;
+
+    // The CTA-wide reduction is a tree over a power-of-two number of threads
+    int cta_threads_x = std::min(32, kThreads);
+    while (cta_threads_x < kThreads && cta_threads_x < inner_vectors) {
+      cta_threads_x *= 2;
+    }
+
+    plan.threadblock_shape = dim3(cta_threads_x, 1, 1);
+
+    int64_t cta_count_y = std::min(outer_count, int64_t(target_ctas));
+    cta_count_y = std::max(int64_t(1), std::min(cta_count_y, int64_t(65535)));
+
+    int64_t src_bytes = outer_count * inner_elements * sizeof_bits<ElementSource>::value / 8;
+    int64_t dst_bytes = outer_count * sizeof_bits<ElementOutput>::value / 8;
+    int64_t partial_bytes = outer_count * sizeof_bits<ElementCompute>::value / 8;
+
+    plan.grid_shape = dim3(1, int(cta_count_y), 1);
+    plan.cost = estimate_cost(src_bytes, dst_bytes, 0, cta_count_y, 0, target_ctas);
+
+    // Consider splitting the inner modes across CTAs
+    int64_t cta_count_z = std::max(int64_t(1), target_ctas / cta_count_y);
+    cta_count_z = std::min(cta_count_z, ceil_div(inner_vectors, cta_threads_x));
+    cta_count_z = std::min(cta_count_z, int64_t(65535));
+
+    if (cta_count_z > 1) {
+
+      int final_threads = int(std::min(outer_count, int64_t(kThreads)));
+      int64_t final_ctas = ceil_div(outer_count, final_threads);
+
+      int64_t cost = estimate_cost(
+        src_bytes,
+        dst_bytes,
+        partial_bytes * cta_count_z,
+        cta_count_y * cta_count_z,
+        final_ctas,
+        target_ctas);
+
+      if (cost < plan.cost) {
+        plan.grid_shape.z = int(cta_count_z);
+        plan.grid_final = dim3(int(final_ctas), 1, 1);
+        plan.threadblock_final = dim3(final_threads, 1, 1);
+        plan.workspace_count = int(cta_count_z);
+        plan.workspace_stride = partial_bytes;
+        plan.workspace_size = partial_bytes * cta_count_z;
+        plan.cost = cost;
+      }
+    }
+
+    return plan;
+  }
+
+  /// Launches the reduction kernel and, if the plan requires it, the final reduction kernel
+  template <typename ReductionKernel, typename FinalReductionKernel>
+  Status launch(
+    Plan const &plan,
+    ElementOutput *dst_ptr,
+    ElementSource const *src_ptr,
+    void *device_workspace_ptr,
+    ElementCompute reduction_identity,
+    ReductionOp reduction_op,
+    PreOp pre_op,
+    PostOp post_op,
+    cudaStream_t stream) {
+
+    using Params = typename ReductionKernel::Params;
+
+    // Construct the parameters
+    Params params(
+      extent,
+      dst_ptr,
+      dst_stride,
+      src_ptr,
+      src_stride,
+      static_cast<ElementCompute *>(device_workspace_ptr),
+      plan.workspace_stride,
+      plan.workspace_count,
+      reduction_op,
+      reduction_identity,
+      pre_op,
+      post_op);
+
+    // Shared memory size
+    int shared_mem_bytes = sizeof(typename ReductionKernel::SharedStorage);
+
+    // Launch the kernel
+    cutlass::arch::synclog_setup();
+    Kernel<ReductionKernel><<< plan.grid_shape, plan.threadblock_shape, shared_mem_bytes, stream >>>(params);
+
+    if (cudaPeekAtLastError() != cudaSuccess) {
+      return Status::kErrorInternal;
+    }
+
+    // Final reduction kernel
+    if (plan.workspace_count) {
+
+      Kernel<FinalReductionKernel><<< plan.grid_final, plan.threadblock_final, 0, stream >>>(params);
+
+      if (cudaPeekAtLastError() != cudaSuccess) {
+        return Status::kErrorInternal;
+      }
+    }
+
+    return Status::kSuccess;
+  }
+
+public:
+
+  /// Default ctor
+  TensorReductionMultiAxis():
+    status(Status::kErrorInvalidProblem),
+    contiguous(false),
+    vectorizable(false),
+    extent(),
+    outer_count(0),
+    inner_count(0) { }
+
+  /// Constructs and plans a reduction over the modes of 'src_layout' selected by 'reduced_modes'
+  template <class SrcShape, class SrcStride, class DstShape, class DstStride>
+  TensorReductionMultiAxis(
+    cute::Layout<SrcShape, SrcStride> const &src_layout, ///< Layout of source tensor
+    cute::Layout<DstShape, DstStride> const &dst_layout, ///< Layout of destination tensor
+    uint32_t reduced_modes,                   ///< Bit i is set if mode i is reduced
+    int target_threadblock_count = 0          ///< Number of concurrent CTAs (0 => twice the SM count)
+  ): TensorReductionMultiAxis() {
+
+    status = initialize(src_layout, dst_layout, reduced_modes, target_threadblock_count);
+  }
+
+  /// Plans a reduction over the modes of 'src_layout' selected by 'reduced_modes'
+  template <class SrcShape, class SrcStride, class DstShape, class DstStride>
+  Status initialize(
+    cute::Layout<SrcShape, SrcStride> const &src_layout, ///< Layout of source tensor
+    cute::Layout<DstShape, DstStride> const &dst_layout, ///< Layout of destination tensor
+    uint32_t reduced_modes,                   ///< Bit i is set if mode i is reduced
+    int target_threadblock_count = 0) {       ///< Number of concurrent CTAs (0 => twice the SM count)
+
+    static_assert(decltype(cute::rank(src_layout))::value == kRank &&
+                  decltype(cute::rank(dst_layout))::value == kRank,
+                  "Source and destination layouts must be of rank Rank.");
+    static_assert(decltype(cute::depth(src_layout))::value <= 1 &&
+                  decltype(cute::depth(dst_layout))::value <= 1,
+                  "Source and destination layouts must be flat.");
+
+    Coord<kRank, int64_t> src_extent;
+    Coord<kRank, int64_t> dst_extent;
+    int64_t src_stride_[kRank];
+    int64_t dst_stride_[kRank];
+
+    cute::for_each(cute::make_seq<kRank>{}, [&](auto i) {
+      src_extent[i] = int64_t(cute::size<i>(src_layout));
+      dst_extent[i] = int64_t(cute::size<i>(dst_layout));
+      src_stride_[i] = int64_t(cute::stride<i>(src_layout));
+      dst_stride_[i] = int64_t(cute::stride<i>(dst_layout));
+    });
+
+    for (int p = 0; p < kRank; ++p) {
+      int64_t expected = ((reduced_modes >> p) & 1) ? 1 : src_extent[p];
+      if (dst_extent[p] != expected) {
+        CUTLASS_TRACE_HOST("  TensorReductionMultiAxis: destination extent of mode " << p
+          << " is " << dst_extent[p] << ", expected " << expected);
+        status = Status::kErrorInvalidProblem;
+        return status;
+      }
+    }
+
+    return initialize(src_extent, src_stride_, dst_stride_, reduced_modes, target_threadblock_count);
+  }
+
+  /// Plans a reduction over the modes selected by 'reduced_modes' given extents and strides
+  /// (units of elements) of each mode
+  Status initialize(
+    Coord<kRank, int64_t> src_extent,         ///< Extent of source tensor
+    int64_t const src_stride_[],              ///< Stride vector of source tensor (of length kRank)
+    int64_t const dst_stride_[],              ///< Stride vector of destination tensor (of length kRank)
+    uint32_t reduced_modes,                   ///< Bit i is set if mode i is reduced
+    int target_threadblock_count = 0) {       ///< Number of concurrent CTAs (0 => twice the SM count)
+
+    status = Status::kSuccess;
+
+    if (target_threadblock_count <= 0) {
+      target_threadblock_count = 2 * KernelHardwareInfo::query_device_multiprocessor_count();
+      if (target_threadblock_count <= 0) {
+        target_threadblock_count = 128;
+      }
+    }
+
+    //
+    // Partition the modes into kept and reduced modes, and find the unit-stride mode
+    //
+
+    Mode kept[kRank];
+    Mode reduced[kRank];
+    int kept_count = 0;
+    int reduced_count = 0;
+
+    Mode unit{1, 1, 1};
+    contiguous = false;
+
+    for (int p = 0; p < kRank; ++p) {
+
+      if (src_extent[p] < 1 || src_extent[p] > INT_MAX) {
+        CUTLASS_TRACE_HOST("  TensorReductionMultiAxis: invalid extent " << src_extent[p] << " of mode " << p);
+        status = Status::kErrorInvalidProblem;
+        return status;
+      }
+
+      if (src_extent[p] == 1) {
+        continue;
+      }
+
+      bool is_reduced = ((reduced_modes >> p) & 1);
+      Mode mode{src_extent[p], src_stride_[p], is_reduced ? 0 : dst_stride_[p]};
+
+      // The strided kernel stores along the unit-stride mode of the source, so a kept unit-stride
+      // mode must also have unit stride in the destination.
+      if (unit.extent == 1 && mode.src_stride == 1 && (is_reduced || mode.dst_stride == 1)) {
+        unit = mode;
+        contiguous = is_reduced;
+      }
+      else if (is_reduced) {
+        reduced[reduced_count++] = mode;
+      }
+      else {
+        kept[kept_count++] = mode;
+      }
+    }
+
+    coalesce(kept, kept_count, true);
+    coalesce(reduced, reduced_count, false);
+
+    // Fold the innermost mode of the same kind into the unit-stride mode if they are contiguous
+    Mode *same = (contiguous ? reduced : kept);
+    int &same_count = (contiguous ? reduced_count : kept_count);
+
+    while (same_count &&
+           same[same_count - 1].src_stride == unit.extent &&
+           (contiguous || same[same_count - 1].dst_stride == unit.extent) &&
+           same[same_count - 1].extent * unit.extent <= INT_MAX) {
+
+      unit.extent *= same[same_count - 1].extent;
+      --same_count;
+    }
+
+    //
+    // Assign the kernel modes. Unused modes lead each group with an extent of one.
+    //
+
+    outer_count = 1;
+    inner_count = 1;
+
+    for (int p = 0; p < kKernelRank; ++p) {
+      extent[p] = 1;
+    }
+    for (int p = 0; p < kKernelRank - 1; ++p) {
+      src_stride[p] = 0;
+    }
+    for (int p = 0; p < kRank; ++p) {
+      dst_stride[p] = 0;
+    }
+
+    for (int i = 0; i < kept_count; ++i) {
+      int p = kRank - kept_count + i;
+      extent[p] = int(kept[i].extent);
+      src_stride[p] = kept[i].src_stride;
+      dst_stride[p] = kept[i].dst_stride;
+      outer_count *= kept[i].extent;
+    }
+
+    for (int i = 0; i < reduced_count; ++i) {
+      int p = 2 * kRank - reduced_count + i;
+      extent[p] = int(reduced[i].extent);
+      src_stride[p] = reduced[i].src_stride;
+      inner_count *= reduced[i].extent;
+    }
+
+    extent[kKernelRank - 1] = int(unit.extent);
+
+    //
+    // Vector accesses require the unit-stride extent and all other strides to be divisible by the
+    // vector length. Pointer alignment is verified when the reduction is launched.
+    //
+
+    vectorizable = (kVectorLength > 1 && unit.extent % kVectorLength == 0);
+
+    for (int p = 0; p < kKernelRank - 1; ++p) {
+      vectorizable = vectorizable && (src_stride[p] % kVectorLength == 0);
+    }
+
+    if (!contiguous) {
+      for (int p = 0; p < kRank; ++p) {
+        vectorizable = vectorizable && (dst_stride[p] % kVectorLength == 0);
+      }
+    }
+
+    //
+    // Plan the parallel mapping strategy.
+    //
+
+    if (contiguous) {
+      plan_scalar = plan_contiguous(1, target_threadblock_count);
+      plan_vector = (vectorizable ? plan_contiguous(kVectorLength, target_threadblock_count) : plan_scalar);
+    }
+    else {
+      plan_scalar = plan_strided(1, target_threadblock_count);
+      plan_vector = (vectorizable ? plan_strided(kVectorLength, target_threadblock_count) : plan_scalar);
+    }
+
+    return status;
+  }
+
+  /// Simple check to verify the object is initialized correctly
+  bool good() const {
+    return status == Status::kSuccess;
+  }
+
+  /// Returns the plan used for the given pointers
+  Plan const &plan(ElementOutput const *dst_ptr, ElementSource const *src_ptr) const {
+
+    int const kSourceAlignment = kVectorLength * sizeof_bits<ElementSource>::value / 8;
+    int const kOutputAlignment = kVectorLength * sizeof_bits<ElementOutput>::value / 8;
+
+    bool aligned = (reinterpret_cast<uintptr_t>(src_ptr) % kSourceAlignment == 0) &&
+                   (contiguous || reinterpret_cast<uintptr_t>(dst_ptr) % kOutputAlignment == 0);
+
+    return (vectorizable && aligned ? plan_vector : plan_scalar);
+  }
+
+  /// Returns the size (in bytes) of a temporary workspace needed for reduction across CTAs
+  int64_t workspace_size() const {
+
+    // Error condition
+    if (!good()) {
+      return 0;
+    }
+
+    return std::max(plan_vector.workspace_size, plan_scalar.workspace_size);
+  }
+
+  /// Performs a reduction
+  Status reduce(
+    ElementOutput *dst_ptr,                       ///< Pointer to destination tensor
+    ElementSource const *src_ptr,                 ///< Pointer to source tensor
+    void *device_workspace_ptr = nullptr,         ///< Device workspace
+    ElementCompute reduction_identity = ElementCompute(), ///< Reduction identity element
+    ReductionOp reduction_op = ReductionOp(),     ///< Reduction operator
+    PreOp pre_op = PreOp(),                       ///< Elementwise operator applied to source elements
+    PostOp post_op = PostOp(),                    ///< Elementwise operator applied to reduced elements
+    cudaStream_t stream = nullptr) {              ///< CUDA Stream into which all kernels are launched
+
+    // Initial status check
+    if (!good()) {
+      return status;
+    }
+
+    Plan const &selected = plan(dst_ptr, src_ptr);
+
+    // Guard against null workspace
+    if (selected.workspace_count && device_workspace_ptr == nullptr) {
+      return Status::kErrorWorkspaceNull;
+    }
+
+    if (contiguous) {
+      if (selected.vector_length == kVectorLength) {
+        return launch<ContiguousKernel<kVectorLength>, ContiguousFinalKernel<kVectorLength>>(
+          selected, dst_ptr, src_ptr, device_workspace_ptr, reduction_identity, reduction_op, pre_op, post_op, stream);
+      }
+      return launch<ContiguousKernel<1>, ContiguousFinalKernel<1>>(
+        selected, dst_ptr, src_ptr, device_workspace_ptr, reduction_identity, reduction_op, pre_op, post_op, stream);
+    }
+    else {
+      if (selected.vector_length == kVectorLength) {
+        return launch<StridedKernel<kVectorLength>, StridedFinalKernel<kVectorLength>>(
+          selected, dst_ptr, src_ptr, device_workspace_ptr, reduction_identity, reduction_op, pre_op, post_op, stream);
+      }
+      return launch<StridedKernel<1>, StridedFinalKernel<1>>(
+        selected, dst_ptr, src_ptr, device_workspace_ptr, reduction_identity, reduction_op, pre_op, post_op, stream);
+    }
+  }
+
+  /// Helper to use overloaded function call operator
+  Status operator()(
+    ElementOutput *dst_ptr,                       ///< Pointer to destination tensor
+    ElementSource const *src_ptr,                 ///< Pointer to source tensor
+    void *device_workspace_ptr = nullptr,         ///< Device workspace
+    ElementCompute reduction_identity = ElementCompute(), ///< Reduction identity element
+    ReductionOp reduction_op = ReductionOp(),     ///< Reduction operator
+    PreOp pre_op = PreOp(),                       ///< Elementwise operator applied to source elements
+    PostOp post_op = PostOp(),                    ///< Elementwise operator applied to reduced elements
+    cudaStream_t stream = nullptr) {              ///< CUDA Stream into which all kernels are launched
+
+    return reduce(dst_ptr, src_ptr, device_workspace_ptr, reduction_identity, reduction_op, pre_op, post_op, stream);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace device
+} // namespace reduction
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
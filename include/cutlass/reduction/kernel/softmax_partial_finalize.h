@@ -0,0 +1,202 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Kernel completing a row softmax from the partial statistics of Sm90SoftmaxPartialColReduction
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/platform/platform.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace reduction {
+namespace kernel {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Rescales the exponentials written by the partial softmax epilogue so that each row of D
+/// becomes softmax(Z). Blocks of BlockN columns of a row were exponentiated relative to the
+/// block max, so each block is multiplied by exp(max(m, n_blk) - max(m)) / sum(m).
+///
+/// One warp completes each row: the lanes first merge the partial (max, sum) pairs of the row,
+/// then rescale it in place one block of columns at a time, in vectors of Alignment elements.
+/// Rows of a single block were normalized by the epilogue and are left unchanged.
+template <
+  typename ElementD_,                   ///< Data type of the exponentials, rescaled in place
+  typename ElementPartial_,             ///< Data type of the partial row max and sum
+  typename ElementCompute_ = float,     ///< Internal compute type
+  int Alignment = 128 / sizeof_bits<ElementD_>::value,  ///< Vector length of accesses to D
+  int Threads = 256                     ///< Number of threads per CTA
+>
+class SoftmaxPartialFinalize {
+public:
+
+  using ElementD = ElementD_;
+  using ElementPartial = ElementPartial_;
+  using ElementCompute = ElementCompute_;
+
+  static int const kAlignment = Alignment;
+  static int const kThreads = Threads;
+  static int const kRowsPerCta = kThreads / 32;
+
+  static_assert(kThreads % 32 == 0, "Threads must be a multiple of the warp size.");
+
+  //
+  // Arguments
+  //
+
+  struct Arguments {
+    int m{0};
+    int n{0};
+    int batch_count{1};
+    int block_n{0};                          ///< Columns per partial, EPI_N of the GEMM epilogue
+    ElementD* ptr_D{nullptr};                ///< (M,N,L) row-major exponentials
+    int64_t ldd{0};
+    int64_t batch_stride_D{0};
+    ElementPartial const* ptr_max{nullptr};  ///< (M,ceil_div(N,block_n),L) m-major partial row max
+    ElementPartial const* ptr_sum{nullptr};  ///< (M,ceil_div(N,block_n),L) m-major partial row sum
+    int64_t ld_partial{0};                   ///< Stride between blocks of columns
+    int64_t batch_stride_partial{0};
+  };
+
+  using Params = Arguments;
+
+  struct SharedStorage { };
+
+  //
+  // Methods
+  //
+
+  static dim3 block_shape() {
+    return dim3(kThreads, 1, 1);
+  }
+
+  static dim3 grid_shape(Params const &params) {
+    return dim3((params.m + kRowsPerCta - 1) / kRowsPerCta, params.batch_count, 1);
+  }
+
+  static bool can_implement(Arguments const &args) {
+    if (args.m <= 0 || args.n <= 0 || args.block_n <= 0 || args.batch_count <= 0) {
+      return false;
+    }
+    if (args.ptr_D == nullptr || args.ptr_max == nullptr || args.ptr_sum == nullptr) {
+      // Rows of a single block need no finalization
+      return args.n <= args.block_n;
+    }
+    return args.block_n % kAlignment == 0 && args.n % kAlignment == 0 &&
+           args.ldd % kAlignment == 0 && args.batch_stride_D % kAlignment == 0 &&
+           reinterpret_cast<uintptr_t>(args.ptr_D) % (sizeof(ElementD) * kAlignment) == 0;
+  }
+
+  CUTLASS_DEVICE
+  SoftmaxPartialFinalize() { }
+
+  CUTLASS_DEVICE
+  void operator()(Params const &params, SharedStorage &shared_storage) {
+
+    int lane_idx = threadIdx.x % 32;
+    int row = blockIdx.x * kRowsPerCta + threadIdx.x / 32;
+    int batch = blockIdx.y;
+    int block_count = (params.n + params.block_n - 1) / params.block_n;
+
+    if (row >= params.m || block_count <= 1) {
+      return;
+    }
+
+    ElementPartial const *row_max = params.ptr_max + batch * params.batch_stride_partial + row;
+    ElementPartial const *row_sum = params.ptr_sum + batch * params.batch_stride_partial + row;
+
+    NumericConverter<ElementCompute, ElementPartial> convert_partial;
+
+    // Merge the partial statistics of the row, first across the blocks of each lane, then across lanes
+    ElementCompute max = -platform::numeric_limits<ElementCompute>::max();
+    ElementCompute sum = ElementCompute(0);
+
+    for (int blk = lane_idx; blk < block_count; blk += 32) {
+      ElementCompute blk_max = convert_partial(row_max[blk * params.ld_partial]);
+      ElementCompute blk_sum = convert_partial(row_sum[blk * params.ld_partial]);
+      ElementCompute new_max = fast_max(max, blk_max);
+      sum = sum * fast_exp(max - new_max) + blk_sum * fast_exp(blk_max - new_max);
+      max = new_max;
+    }
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int offset = 16; offset > 0; offset /= 2) {
+      ElementCompute other_max = __shfl_xor_sync(0xFFFFFFFF, max, offset);
+      ElementCompute other_sum = __shfl_xor_sync(0xFFFFFFFF, sum, offset);
+      ElementCompute new_max = fast_max(max, other_max);
+      sum = sum * fast_exp(max - new_max) + other_sum * fast_exp(other_max - new_max);
+      max = new_max;
+    }
+
+    ElementCompute inv_sum = sum > ElementCompute(0) ? ElementCompute(1) / sum : ElementCompute(0);
+
+    // Rescale the row one block of columns at a time
+    using FragmentD = Array<ElementD, kAlignment>;
+    using FragmentCompute = Array<ElementCompute, kAlignment>;
+    NumericArrayConverter<ElementCompute, ElementD, kAlignment> convert_input;
+    NumericArrayConverter<ElementD, ElementCompute, kAlignment> convert_output;
+
+    ElementD *row_D = params.ptr_D + batch * params.batch_stride_D + row * params.ldd;
+
+    for (int blk = 0; blk < block_count; ++blk) {
+      ElementCompute scale = fast_exp(convert_partial(row_max[blk * params.ld_partial]) - max) * inv_sum;
+
+      int col_begin = blk * params.block_n;
+      int col_end = min(params.n, col_begin + params.block_n);
+
+      for (int col = col_begin + lane_idx * kAlignment; col < col_end; col += 32 * kAlignment) {
+        FragmentD *access = reinterpret_cast<FragmentD *>(row_D + col);
+        FragmentCompute frag = convert_input(*access);
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < kAlignment; ++i) {
+          frag[i] *= scale;
+        }
+        *access = convert_output(frag);
+      }
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace kernel
+} // namespace reduction
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -41,6 +41,7 @@
 #include "cutlass/numeric_conversion.h"
 #include "cutlass/device_kernel.h"
 
+#include "cutlass/epilogue/thread/activation.h"
 #include "cutlass/reduction/thread/reduction_operators.h"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -61,7 +62,9 @@ template <
   int VectorLength  = 1,                      ///< Vector length for memory
   typename ElementCompute = ElementOutput,    ///< Internal compute type - input type of reduction operation
   int Threads = 256,                          ///< Number of participating threads
-  int BatchSize = 4                           ///< Number of elements to load per batch
+  int BatchSize = 4,                          ///< Number of elements to load per batch
+  typename PreOp = epilogue::thread::Identity<ElementCompute>,  ///< Elementwise operator applied to source elements
+  typename PostOp = epilogue::thread::Identity<ElementCompute>  ///< Elementwise operator applied to reduced elements
 >
 struct TensorReductionAffineContiguousParams {
 
@@ -87,6 +90,8 @@ struct TensorReductionAffineContiguousParams {
   ReductionOp reduction_op;                     /// Reduction operator
   ElementCompute reduction_identity;            /// Identity element used by reduction operator
   ElementCompute *device_workspace;             /// Pointer to device workspace for inter-CTA reductions
+  PreOp pre_op;                                 /// Elementwise operator applied to source elements
+  PostOp post_op;                               /// Elementwise operator applied to reduced elements
 
   //
   // Methods
@@ -109,7 +114,9 @@ struct TensorReductionAffineContiguousParams {
     int64_t workspace_stride_,                  ///< Stride between workspaces
     int workspace_count_,                       ///< Number of workspaces
     ReductionOp reduction_op_,                  ///< Reduction operator
-    ElementCompute reduction_identity_ = ElementCompute() ///< Identity element used by reduction operator
+    ElementCompute reduction_identity_ = ElementCompute(), ///< Identity element used by reduction operator
+    PreOp pre_op_ = PreOp(),                    ///< Elementwise operator applied to source elements
+    PostOp post_op_ = PostOp()                  ///< Elementwise operator applied to reduced elements
   ):
     extent(extent_),
     inner_count(1),
@@ -120,7 +127,9 @@ struct TensorReductionAffineContiguousParams {
     workspace_stride(workspace_stride_),
     workspace_count(workspace_count_),
     reduction_op(reduction_op_),
-    reduction_identity(reduction_identity_) {
+    reduction_identity(reduction_identity_),
+    pre_op(pre_op_),
+    post_op(post_op_) {
 
     // Initialize divisors for fast div-mod
     for (int p = 1; p < kRank; ++p) {
@@ -163,7 +172,9 @@ template <
   int VectorLength  = 1,                      ///< Vector length for memory
   typename ElementCompute = ElementOutput,    ///< Internal compute type - input type of reduction operation
   int Threads = 256,                          ///< Number of participating threads
-  int BatchSize = 4                           ///< Number of elements to load per batch
+  int BatchSize = 4,                          ///< Number of elements to load per batch
+  typename PreOp = epilogue::thread::Identity<ElementCompute>,  ///< Elementwise operator applied to source elements
+  typename PostOp = epilogue::thread::Identity<ElementCompute>  ///< Elementwise operator applied to reduced elements
 >
 class TensorReductionAffineContiguous {
 public:
@@ -193,7 +204,9 @@ public:
     VectorLength,
     ElementCompute,
     Threads,
-    BatchSize
+    BatchSize,
+    PreOp,
+    PostOp
   >;
 
 private:
@@ -251,6 +264,7 @@ private:
 
     NumericArrayConverter<ElementCompute, ElementSource, VectorLength> convert_source;
     ReductionOp reduction_op(params.reduction_op);
+    PreOp pre_op(params.pre_op);
 
     //
     // Early exit or initialize to identity element
@@ -306,6 +320,11 @@ private:
         if (guards[b]) {
           auto cvt = convert_source(source_fragment[b]);
 
+          CUTLASS_PRAGMA_UNROLL
+          for (int i = 0; i < kVectorLength; ++i) {
+            cvt[i] = pre_op(cvt[i]);
+          }
+
           accumulator = cutlass::reduction::thread::detail::ApplyArrayOperator(
             reduction_op, 
             accumulator, 
@@ -410,9 +429,10 @@ public:
         // Store the result after possible final reduction within the CTA
         if (threadIdx.z == 0 && threadIdx.x == 0) {
 
-          // Convert to output type and store
+          // Apply the elementwise operator, convert to output type and store
+          PostOp post_op(params.post_op);
           NumericConverter<ElementOutput, ElementCompute> convert_output;
-          ElementOutput cvt = convert_output(result);
+          ElementOutput cvt = convert_output(post_op(result));
 
           *reinterpret_cast<ElementOutput *>(dst_byte_ptr + dst_byte_offset) = cvt;
         }
@@ -478,7 +498,9 @@ template <
   int VectorLength  = 1,                      ///< Vector length for memory
   typename ElementCompute = ElementOutput,    ///< Internal compute type - input type of reduction operation
   int Threads = 256,                          ///< Number of participating threads
-  int BatchSize = 4                           ///< Number of elements to load per batch
+  int BatchSize = 4,                          ///< Number of elements to load per batch
+  typename PreOp = epilogue::thread::Identity<ElementCompute>,  ///< Elementwise operator applied to source elements
+  typename PostOp = epilogue::thread::Identity<ElementCompute>  ///< Elementwise operator applied to reduced elements
 >
 class TensorReductionAffineContiguousFinal {
 public:
@@ -503,7 +525,9 @@ public:
     VectorLength,
     ElementCompute,
     Threads,
-    BatchSize
+    BatchSize,
+    PreOp,
+    PostOp
   >;
 
 private:
@@ -580,10 +604,11 @@ public:
 
       ElementCompute result = reduce_indices_(params, params.device_workspace + idx_linear);
 
-      // Convert to output type and store
+      // Apply the elementwise operator, convert to output type and store
+      PostOp post_op(params.post_op);
       NumericConverter<ElementOutput, ElementCompute> convert_output;
 
-      *reinterpret_cast<ElementOutput *>(dst_byte_ptr + dst_byte_offset) = convert_output(result);
+      *reinterpret_cast<ElementOutput *>(dst_byte_ptr + dst_byte_offset) = convert_output(post_op(result));
 
       // Update indices and pointers
       idx_linear += gridDim.x * blockDim.x;
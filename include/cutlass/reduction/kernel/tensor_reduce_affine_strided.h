@@ -41,6 +41,7 @@
 #include "cutlass/numeric_conversion.h"
 #include "cutlass/device_kernel.h"
 
+#include "cutlass/epilogue/thread/activation.h"
 #include "cutlass/reduction/thread/reduction_operators.h"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -62,7 +63,9 @@ template <
   int VectorLength  = 1,                      ///< Vector length for memory
   typename ElementCompute = ElementOutput,    ///< Internal compute type - input type of reduction operation
   int Threads = 256,                          ///< Number of participating threads
-  int BatchSize = 4                           ///< Number of elements to load per batch
+  int BatchSize = 4,                          ///< Number of elements to load per batch
+  typename PreOp = epilogue::thread::Identity<ElementCompute>,  ///< Elementwise operator applied to source elements
+  typename PostOp = epilogue::thread::Identity<ElementCompute>  ///< Elementwise operator applied to reduced elements
 >
 struct TensorReductionAffineStridedParams {
 
@@ -89,6 +92,8 @@ struct TensorReductionAffineStridedParams {
   ReductionOp reduction_op;                     /// Reduction operator
   ElementCompute reduction_identity;            /// Identity element for reduction operator
   ElementCompute *device_workspace;             /// Pointer to device workspace for inter-CTA reductions
+  PreOp pre_op;                                 /// Elementwise operator applied to source elements
+  PostOp post_op;                               /// Elementwise operator applied to reduced elements
 
   //
   // Methods
@@ -111,7 +116,9 @@ struct TensorReductionAffineStridedParams {
     int64_t workspace_stride_,                  ///< Stride between workspaces
     int workspace_count_,                       ///< Number of workspaces
     ReductionOp reduction_op_,                  ///< Reduction operator
-    ElementCompute reduction_identity_  = ElementCompute() ///< Identity element for reduction operator
+    ElementCompute reduction_identity_  = ElementCompute(), ///< Identity element for reduction operator
+    PreOp pre_op_ = PreOp(),                    ///< Elementwise operator applied to source elements
+    PostOp post_op_ = PostOp()                  ///< Elementwise operator applied to reduced elements
   ):
     extent(extent_),
     inner_count(1),
@@ -123,7 +130,9 @@ struct TensorReductionAffineStridedParams {
     workspace_stride(workspace_stride_),
     workspace_count(workspace_count_),
     reduction_op(reduction_op_),
-    reduction_identity(reduction_identity_) {
+    reduction_identity(reduction_identity_),
+    pre_op(pre_op_),
+    post_op(post_op_) {
 
     // Initialize divisors for fast div-mod
     for (int p = 1; p < kRank; ++p) {
@@ -166,7 +175,9 @@ template <
   int VectorLength  = 1,                      ///< Vector length for memory
   typename ElementCompute = ElementOutput,    ///< Internal compute type - input type of reduction operation
   int Threads = 256,                          ///< Number of participating threads
-  int BatchSize = 4                           ///< Number of elements to load per batch
+  int BatchSize = 4,                          ///< Number of elements to load per batch
+  typename PreOp = epilogue::thread::Identity<ElementCompute>,  ///< Elementwise operator applied to source elements
+  typename PostOp = epilogue::thread::Identity<ElementCompute>  ///< Elementwise operator applied to reduced elements
 >
 class TensorReductionAffineStrided {
 public:
@@ -196,7 +207,9 @@ public:
     VectorLength,
     ElementCompute,
     Threads,
-    BatchSize
+    BatchSize,
+    PreOp,
+    PostOp
   >;
 
 private:
@@ -253,6 +266,7 @@ private:
 
     NumericArrayConverter<ElementCompute, ElementSource, VectorLength> convert_source;
     ReductionOp reduction_op(params.reduction_op);
+    PreOp pre_op(params.pre_op);
 
     // Accumulated output
     ComputeFragment identity_frag;
@@ -309,6 +323,11 @@ private:
 
           auto cvt = convert_source(source_fragment[b]);
 
+          CUTLASS_PRAGMA_UNROLL
+          for (int i = 0; i < kVectorLength; ++i) {
+            cvt[i] = pre_op(cvt[i]);
+          }
+
           accumulator = cutlass::reduction::thread::detail::ApplyArrayOperator(
             reduction_op,
              accumulator, 
@@ -401,7 +420,14 @@ public:
         // Store the result after possible final reduction within the CTA
         if (threadIdx.z == 0) {
 
-          // Convert to output type and store
+          // Apply the elementwise operator, convert to output type and store
+          PostOp post_op(params.post_op);
+
+          CUTLASS_PRAGMA_UNROLL
+          for (int i = 0; i < kVectorLength; ++i) {
+            result[i] = post_op(result[i]);
+          }
+
           NumericArrayConverter<ElementOutput, ElementCompute, VectorLength> convert_output;
           auto cvt = convert_output(result);
 
@@ -471,7 +497,9 @@ template <
   int VectorLength  = 1,                      ///< Vector length for memory
   typename ElementCompute = ElementOutput,    ///< Internal compute type - input type of reduction operation
   int Threads = 256,                          ///< Number of participating threads
-  int BatchSize = 4                           ///< Number of elements to load per batch
+  int BatchSize = 4,                          ///< Number of elements to load per batch
+  typename PreOp = epilogue::thread::Identity<ElementCompute>,  ///< Elementwise operator applied to source elements
+  typename PostOp = epilogue::thread::Identity<ElementCompute>  ///< Elementwise operator applied to reduced elements
 >
 class TensorReductionAffineStridedFinal {
 public:
@@ -499,7 +527,9 @@ public:
     VectorLength,
     ElementCompute,
     Threads,
-    BatchSize
+    BatchSize,
+    PreOp,
+    PostOp
   >;
 
 private:
@@ -613,7 +643,14 @@ public:
         params, 
         src_byte_ptr + src_byte_offset);
 
-      // Convert to output type and store
+      // Apply the elementwise operator, convert to output type and store
+      PostOp post_op(params.post_op);
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kVectorLength; ++i) {
+        result[i] = post_op(result[i]);
+      }
+
       NumericArrayConverter<ElementOutput, ElementCompute, VectorLength> convert_output;
       auto cvt = convert_output(result);
 
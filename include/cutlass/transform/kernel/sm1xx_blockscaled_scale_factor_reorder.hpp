@@ -0,0 +1,279 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+  \brief Device-side conversion of linear block scale factors into the SM100/SM103 scale factor layouts
+*/
+
+#pragma once
+
+#include "cute/numeric/numeric_types.hpp"  // cute::sizeof_bits_v, cute::uint128_t
+#include "cute/tensor.hpp"                 // cute::Tensor, cute::make_tensor, cute::tile_to_shape
+#include "cutlass/arch/arch.h"             // cutlass::arch::Sm80
+#include "cutlass/cutlass.h"               // cutlass::Status
+#include "cutlass/fast_math.h"             // cutlass::ceil_div
+#include "cutlass/cuda_host_adapter.hpp"   // cutlass::CudaHostAdapter
+
+namespace cutlass::transform::kernel {
+
+using namespace cute;
+
+// Reorders block scale factors stored linearly, one row of ceil(K/SFVecSize) scale factors per M (or N)
+// index, into the tiled layout consumed by the block scaled GEMMs:
+//   tile_to_shape(BlockScaledConfig::SfAtom, (MN,K,L), Step<_2,_1,_3>)
+// which is BlockScaledConfig::tile_atom_to_shape_SFA((MN,_,K,L)) and tile_atom_to_shape_SFB((_,MN,K,L)).
+// BlockScaledConfig is cutlass::detail::Sm1xxBlockScaledConfig (SM100) or Sm103BlockScaledConfig (SM103).
+//
+// Each CTA stages a (128 x TileSF) tile of scale factors in smem, reading every row with 128b loads, and
+// writes the corresponding TileSF / 4 contiguous SF atoms with 128b stores. Rows and scale factors that
+// pad the problem up to whole SF atoms are written as zero.
+template <
+  class ElementSF_,
+  class BlockScaledConfig_
+>
+class SM1xxBlockScaledScaleFactorReorder {
+public:
+  using ElementSF = ElementSF_;
+  using BlockScaledConfig = BlockScaledConfig_;
+  using SfAtom = typename BlockScaledConfig::SfAtom;
+  static constexpr int SFVecSize = BlockScaledConfig::SFVecSize;
+
+  static_assert(cute::sizeof_bits_v<ElementSF> == 8, "Only 8-bit scale factors are supported.");
+  static_assert(size<0>(SfAtom{}) == 128 && size<1,1>(SfAtom{}) == 4 && stride<1,0>(SfAtom{}) == 0,
+                "Only K-major SF atoms of 128 rows and 4 scale factors are supported.");
+
+  // (MN,K,L) with K counted in elements of the scaled operand
+  using ProblemShape = cute::Shape<int, int, int>;
+  // (MN,ceil(K/SFVecSize),L) linear scale factors
+  using StrideSF = cute::Stride<int64_t, cute::_1, int64_t>;
+  using LayoutSF = decltype(cute::tile_to_shape(SfAtom{}, ProblemShape{}, Step<_2,_1,_3>{}));
+
+  // (128,4) -> offset of the atom with one coordinate per scale factor. The 4 scale factors of a row are
+  // contiguous, so each 32b word of an atom holds a single row.
+  using SfAtomCompact = decltype(make_layout(cute::layout<0>(SfAtom{}), cute::layout<1,1>(SfAtom{})));
+  static_assert(stride<1>(SfAtomCompact{}) == 1, "Scale factors of a row must be contiguous in the SF atom.");
+
+  //
+  // Tiling
+  //
+
+  using TileMN = _128;
+  using TileSF = _32;
+  static constexpr int AtomsPerTile = TileSF{} / size<1>(SfAtomCompact{});
+  static constexpr int AtomBytes = size(SfAtomCompact{});
+  // (TileMN,TileSF) -> offset within the contiguous destination of the tile
+  using LayoutTile = decltype(cute::tile_to_shape(SfAtomCompact{}, Shape<TileMN, TileSF>{}, Step<_2,_1>{}));
+  static_assert(cosize(LayoutTile{}) == size(LayoutTile{}), "SF atom must be compact.");
+
+  // The smem tile is stored as 32b words, padded so that both a thread per row and a warp reading
+  // consecutive atom rows are free of bank conflicts
+  static constexpr int WordsPerRow = TileSF{} / 4;
+  static constexpr int SmemWordsPerRow = WordsPerRow + 1;
+  static constexpr int VecBits = 128;
+  static constexpr int WordsPerVec = VecBits / 32;
+  static constexpr int VecsPerTile = size(LayoutTile{}) * 8 / VecBits;
+
+  // Required by `device_kernel`
+  static constexpr int MaxThreadsPerBlock = TileMN{};
+  static constexpr int MinBlocksPerMultiprocessor = 1;
+  // Plain SIMT kernel, it runs on any architecture that produces the scale factors
+  using ArchTag = arch::Sm80;
+
+  struct SharedStorage {
+    alignas(16) uint32_t smem_SF[TileMN{} * SmemWordsPerRow];
+  };
+
+  static constexpr int SharedStorageSize = sizeof(SharedStorage);
+
+  struct Arguments {
+    ProblemShape problem_shape{};                 // (MN,K,L)
+    ElementSF const* ptr_SF{nullptr};             // (MN,ceil(K/SFVecSize),L) linear scale factors
+    StrideSF dSF{};
+    ElementSF* ptr_SF_reordered{nullptr};         // cosize(LayoutSF) scale factors
+  };
+
+  struct Params {
+    ProblemShape problem_shape{};
+    ElementSF const* ptr_SF{nullptr};
+    StrideSF dSF{};
+    ElementSF* ptr_SF_reordered{nullptr};
+    LayoutSF layout_SF_reordered{};
+    int sf_k{0};
+    int tiles_mn{0};
+    int tiles_k{0};
+    bool vectorized_load{false};
+  };
+
+public:
+  static LayoutSF
+  get_layout_SF_reordered(ProblemShape const& problem_shape) {
+    return cute::tile_to_shape(SfAtom{}, problem_shape, Step<_2,_1,_3>{});
+  }
+
+  static Params
+  to_underlying_arguments(Arguments const& args, void* workspace = nullptr) {
+    CUTLASS_TRACE_HOST("SM1xxBlockScaledScaleFactorReorder::to_underlying_arguments()");
+    CUTLASS_UNUSED(workspace);
+    auto [MN, K, L] = args.problem_shape;
+
+    Params params;
+    params.problem_shape = args.problem_shape;
+    params.ptr_SF = args.ptr_SF;
+    params.dSF = args.dSF;
+    params.ptr_SF_reordered = args.ptr_SF_reordered;
+    params.layout_SF_reordered = get_layout_SF_reordered(args.problem_shape);
+    params.sf_k = cutlass::ceil_div(K, SFVecSize);
+    params.tiles_mn = cutlass::ceil_div(MN, int(TileMN{}));
+    params.tiles_k = cutlass::ceil_div(params.sf_k, int(TileSF{}));
+    params.vectorized_load = (reinterpret_cast<uintptr_t>(args.ptr_SF) % (VecBits / 8) == 0) &&
+                             (get<0>(args.dSF) % (VecBits / 8) == 0) &&
+                             (L == 1 || get<2>(args.dSF) % (VecBits / 8) == 0);
+    return params;
+  }
+
+  static Status
+  can_implement(Arguments const& args) {
+    if (args.ptr_SF == nullptr || args.ptr_SF_reordered == nullptr) {
+      CUTLASS_TRACE_HOST("SM1xxBlockScaledScaleFactorReorder CAN NOT IMPLEMENT: Scale factor pointers are null");
+      return Status::kErrorInvalidProblem;
+    }
+    if (reinterpret_cast<uintptr_t>(args.ptr_SF_reordered) % (VecBits / 8) != 0) {
+      CUTLASS_TRACE_HOST("SM1xxBlockScaledScaleFactorReorder CAN NOT IMPLEMENT: Reordered scale factors must be 16B aligned");
+      return Status::kErrorMisalignedOperand;
+    }
+    CUTLASS_TRACE_HOST("SM1xxBlockScaledScaleFactorReorder::can_implement() (True)");
+    return Status::kSuccess;
+  }
+
+  static size_t
+  get_workspace_size(Arguments const& args) {
+    CUTLASS_UNUSED(args);
+    return 0;
+  }
+
+  static Status
+  initialize_workspace(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr,
+    CudaHostAdapter *cuda_adapter = nullptr) {
+    CUTLASS_UNUSED(args);
+    CUTLASS_UNUSED(workspace);
+    CUTLASS_UNUSED(stream);
+    CUTLASS_UNUSED(cuda_adapter);
+    return Status::kSuccess;
+  }
+
+  static dim3
+  get_grid_shape(Params const& params) {
+    return dim3(params.tiles_k, params.tiles_mn, get<2>(params.problem_shape));
+  }
+
+  static dim3
+  get_block_shape() {
+    return dim3(MaxThreadsPerBlock, 1, 1);
+  }
+
+  CUTE_DEVICE
+  void
+  operator()(Params const& params, char* smem_buf) {
+    SharedStorage& shared_storage = *reinterpret_cast<SharedStorage*>(smem_buf);
+    auto [MN, K, L] = params.problem_shape;
+    int tile_k = blockIdx.x;
+    int tile_mn = blockIdx.y;
+    int l = blockIdx.z;
+    int mn0 = tile_mn * TileMN{};
+    int sf0 = tile_k * TileSF{};
+
+    //
+    // Stage the (TileMN,TileSF) source tile in smem, one row per thread
+    //
+    int row = threadIdx.x;
+    uint32_t* sRow = shared_storage.smem_SF + row * SmemWordsPerRow;
+    if (mn0 + row < MN) {
+      ElementSF const* gRow = params.ptr_SF + (mn0 + row) * get<0>(params.dSF) + l * get<2>(params.dSF) + sf0;
+      if (params.vectorized_load && sf0 + TileSF{} <= params.sf_k) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int v = 0; v < WordsPerRow / WordsPerVec; ++v) {
+          uint128_t vec = reinterpret_cast<uint128_t const*>(gRow)[v];
+          CUTLASS_PRAGMA_UNROLL
+          for (int w = 0; w < WordsPerVec; ++w) {
+            sRow[v * WordsPerVec + w] = reinterpret_cast<uint32_t const*>(&vec)[w];
+          }
+        }
+      }
+      else {
+        CUTLASS_PRAGMA_UNROLL
+        for (int w = 0; w < WordsPerRow; ++w) {
+          uint32_t word = 0;
+          CUTLASS_PRAGMA_UNROLL
+          for (int b = 0; b < 4; ++b) {
+            if (sf0 + w * 4 + b < params.sf_k) {
+              word |= uint32_t(reinterpret_cast<uint8_t const&>(gRow[w * 4 + b])) << (8 * b);
+            }
+          }
+          sRow[w] = word;
+        }
+      }
+    }
+    else {
+      CUTLASS_PRAGMA_UNROLL
+      for (int w = 0; w < WordsPerRow; ++w) {
+        sRow[w] = 0;
+      }
+    }
+    __syncthreads();
+
+    //
+    // Write the SF atoms of the tile, which are contiguous in the destination
+    //
+    int const atoms_k = cutlass::ceil_div(params.sf_k, int(size<1>(SfAtomCompact{})));
+    int const tile_atoms = cute::min(int(AtomsPerTile), atoms_k - tile_k * AtomsPerTile);
+    int const tile_vecs = tile_atoms * AtomBytes * 8 / VecBits;
+    ElementSF* gTile = params.ptr_SF_reordered + params.layout_SF_reordered(mn0, sf0 * SFVecSize, l);
+    constexpr auto inverse_tile = right_inverse(LayoutTile{});
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int v = threadIdx.x; v < VecsPerTile; v += MaxThreadsPerBlock) {
+      if (v < tile_vecs) {
+        uint128_t vec;
+        CUTLASS_PRAGMA_UNROLL
+        for (int w = 0; w < WordsPerVec; ++w) {
+          // offset -> (row,sf) coordinate of the tile
+          int idx = inverse_tile((v * WordsPerVec + w) * 4);
+          int src_row = idx % TileMN{};
+          int src_sf = idx / TileMN{};
+          reinterpret_cast<uint32_t*>(&vec)[w] = shared_storage.smem_SF[src_row * SmemWordsPerRow + src_sf / 4];
+        }
+        reinterpret_cast<uint128_t*>(gTile)[v] = vec;
+      }
+    }
+  }
+};
+
+} // namespace cutlass::transform::kernel
@@ -0,0 +1,412 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+  \brief Device-side weight prepacking for SM90 mixed input GEMM kernels
+*/
+
+#pragma once
+
+#include "cute/numeric/numeric_types.hpp"  // cute::sizeof_bits_v, cute::uint_bit_t
+#include "cute/tensor.hpp"                 // cute::Tensor, cute::make_tensor, cute::tile_to_shape
+#include "cutlass/arch/arch.h"             // cutlass::arch::Sm90
+#include "cutlass/array.h"                 // cutlass::Array
+#include "cutlass/cutlass.h"               // cutlass::Status
+#include "cutlass/fast_math.h"             // cutlass::ceil_div
+#include "cutlass/numeric_types.h"         // cutlass::int4b_t, cutlass::float_e2m1_t
+#include "cutlass/cuda_host_adapter.hpp"   // cutlass::CudaHostAdapter
+
+namespace cutlass::transform::kernel {
+
+using namespace cute;
+
+// Prepacks quantized weights, group scales and zeros for the SM90 mixed input mainloop
+// (sm90_mma_tma_gmma_rs_warpspecialized_mixed_input.hpp) in a single launch.
+//
+// * The (N,K,L) K-major quantized operand is reordered into tile_to_shape(LayoutAtomQuant, (N,K,L)),
+//   where LayoutAtomQuant is typically cutlass::compute_memory_reordering_atom<ElementMma>().
+//   Each CTA stages a tile of source rows in smem with vectorized loads and writes the reordered
+//   tile with 128b stores, so global traffic is one read and one write of the weights.
+// * With UseScaleLookupTable (int4 / e2m1 weights with 8-bit scales), signed int4 weights are re-encoded
+//   so that positive and negative values share their magnitude bits, and every scale is expanded into the
+//   cutlass::Array<ElementScale, 8> of scaled lookup table values consumed by the mainloop.
+// * Otherwise scales and zeros are copied into the destination buffers unchanged.
+template <
+  class ElementQuant_,
+  class LayoutAtomQuant_,
+  class ElementScale_ = void,
+  class ElementZero_ = void,
+  bool UseScaleLookupTable_ = false
+>
+class SM90MixedInputWeightPrepacker {
+public:
+  using ElementQuant = ElementQuant_;
+  using LayoutAtomQuant = LayoutAtomQuant_;
+  using ElementScale = ElementScale_;
+  using ElementZero = ElementZero_;
+  static constexpr bool UseScaleLookupTable = UseScaleLookupTable_;
+
+  static constexpr bool HasScale = not cute::is_void_v<ElementScale>;
+  static constexpr bool HasZero = not cute::is_void_v<ElementZero>;
+  static constexpr int QuantBits = cute::sizeof_bits_v<ElementQuant>;
+
+  static_assert(QuantBits == 4 || QuantBits == 8, "Only 4-bit and 8-bit quantized weights are supported.");
+  static_assert(HasScale || not HasZero, "Zeros require scales.");
+  static_assert(not UseScaleLookupTable || (QuantBits == 4 && HasScale && not HasZero),
+                "The scale lookup table requires 4-bit weights and scales without zeros.");
+
+  // Signed int4 weights read through the lookup table use the unified sign-magnitude encoding
+  static constexpr bool UseUnifiedEncoding = UseScaleLookupTable && cute::is_same_v<ElementQuant, cutlass::int4b_t>;
+
+  using ElementScalePacked = cute::conditional_t<UseScaleLookupTable, cutlass::Array<ElementScale, 8>, ElementScale>;
+
+  // (N,K,L) K-major source weights
+  using StrideB = cute::Stride<int64_t, cute::_1, int64_t>;
+  using ProblemShape = cute::Shape<int, int, int>;
+  using LayoutB_Reordered = decltype(cute::tile_to_shape(LayoutAtomQuant{}, ProblemShape{}));
+
+  static_assert(rank(LayoutAtomQuant{}) == 2, "LayoutAtomQuant must be rank 2 (N,K)");
+  static_assert(cute::is_static_v<LayoutAtomQuant>, "LayoutAtomQuant must be static");
+
+  using AtomN = decltype(size<0>(LayoutAtomQuant{}));
+  using AtomK = decltype(size<1>(LayoutAtomQuant{}));
+
+  //
+  // Tiling
+  //
+
+  // Source rows are read in 64B segments, so TileK spans one or more reordering atoms
+  using TileK = Int<AtomK{} * cute::max(1, 512 / int(QuantBits * AtomK{}))>;
+  // Atoms are contiguous along N in the reordered layout, so the TileN rows of each atom column are
+  // written as one contiguous chunk
+  using TileN = Int<AtomN{} * cute::max(1, 128 / int(AtomN{}))>;
+  using TileShape = Shape<TileN, TileK>;
+
+  // A source vector never straddles two K atoms since K is a multiple of AtomK
+  static constexpr int SrcVecBits = cute::min(128, int(AtomK{}) * QuantBits);
+  static constexpr int SrcVecElems = SrcVecBits / QuantBits;
+  static constexpr int DstVecBits = 128;
+  static constexpr int DstVecElems = DstVecBits / QuantBits;
+  using SrcVecType = cute::uint_bit_t<SrcVecBits>;
+  using DstVecType = cute::uint_bit_t<DstVecBits>;
+
+  // (TileN,AtomK) -> offset within the contiguous destination chunk of one atom column
+  using LayoutChunk = decltype(cute::tile_to_shape(LayoutAtomQuant{}, Shape<TileN, AtomK>{}));
+  static_assert(cosize(LayoutAtomQuant{}) == size(LayoutAtomQuant{}), "LayoutAtomQuant must be compact.");
+  static_assert((size(LayoutAtomQuant{}) * QuantBits) % DstVecBits == 0,
+                "LayoutAtomQuant must span a multiple of 128b.");
+
+  static constexpr int ScalesPerThread = UseScaleLookupTable ? 2 : 8;
+
+  // Required by `device_kernel`
+  static constexpr int MaxThreadsPerBlock = 128;
+  static constexpr int MinBlocksPerMultiprocessor = 1;
+  using ArchTag = arch::Sm90;
+
+  struct SharedStorage {
+    alignas(16) cute::ArrayEngine<ElementQuant, size(TileShape{})> smem_B;
+  };
+
+  static constexpr int SharedStorageSize = sizeof(SharedStorage);
+
+  struct Arguments {
+    ProblemShape problem_shape{};                 // (N,K,L)
+    ElementQuant const* ptr_B{nullptr};
+    StrideB dB{};
+    ElementQuant* ptr_B_reordered{nullptr};
+    int group_size{0};                            // Scale group size along K
+    ElementScale const* ptr_S{nullptr};           // (N,ceil(K/group_size),L) scales, packed
+    ElementScalePacked* ptr_S_packed{nullptr};
+    ElementZero const* ptr_Z{nullptr};            // (N,ceil(K/group_size),L) zeros, packed
+    ElementZero* ptr_Z_packed{nullptr};
+  };
+
+  struct Params {
+    ProblemShape problem_shape{};
+    ElementQuant const* ptr_B{nullptr};
+    StrideB dB{};
+    ElementQuant* ptr_B_reordered{nullptr};
+    LayoutB_Reordered layout_B_reordered{};
+    int tiles_n{0};
+    int tiles_k{0};
+    int num_b_tiles{0};
+    ElementScale const* ptr_S{nullptr};
+    ElementScalePacked* ptr_S_packed{nullptr};
+    ElementZero const* ptr_Z{nullptr};
+    ElementZero* ptr_Z_packed{nullptr};
+    int64_t num_scales{0};
+    int num_scale_blocks{0};
+  };
+
+public:
+  static Params
+  to_underlying_arguments(Arguments const& args, void* workspace = nullptr) {
+    CUTLASS_TRACE_HOST("SM90MixedInputWeightPrepacker::to_underlying_arguments()");
+    CUTLASS_UNUSED(workspace);
+    auto [N, K, L] = args.problem_shape;
+
+    Params params;
+    params.problem_shape = args.problem_shape;
+    params.ptr_B = args.ptr_B;
+    params.dB = args.dB;
+    params.ptr_B_reordered = args.ptr_B_reordered;
+    params.layout_B_reordered = cute::tile_to_shape(LayoutAtomQuant{}, args.problem_shape);
+    params.tiles_n = cutlass::ceil_div(N, int(TileN{}));
+    params.tiles_k = cutlass::ceil_div(K, int(TileK{}));
+    params.num_b_tiles = params.tiles_n * params.tiles_k * L;
+
+    if constexpr (HasScale) {
+      if (args.ptr_S != nullptr) {
+        params.ptr_S = args.ptr_S;
+        params.ptr_S_packed = args.ptr_S_packed;
+        params.ptr_Z = args.ptr_Z;
+        params.ptr_Z_packed = args.ptr_Z_packed;
+        params.num_scales = int64_t(N) * cutlass::ceil_div(K, args.group_size) * L;
+        params.num_scale_blocks = int(cutlass::ceil_div(params.num_scales, int64_t(MaxThreadsPerBlock * ScalesPerThread)));
+      }
+    }
+    return params;
+  }
+
+  static Status
+  can_implement(Arguments const& args) {
+    auto [N, K, L] = args.problem_shape;
+    if (N % AtomN{} != 0 || K % AtomK{} != 0) {
+      CUTLASS_TRACE_HOST("SM90MixedInputWeightPrepacker CAN NOT IMPLEMENT: (N,K) is not a multiple of the reordering atom");
+      return Status::kErrorInvalidProblem;
+    }
+    if (args.ptr_B == nullptr || args.ptr_B_reordered == nullptr) {
+      CUTLASS_TRACE_HOST("SM90MixedInputWeightPrepacker CAN NOT IMPLEMENT: Weight pointers are null");
+      return Status::kErrorInvalidProblem;
+    }
+    bool aligned = (reinterpret_cast<uintptr_t>(args.ptr_B) % (SrcVecBits / 8) == 0) &&
+                   (reinterpret_cast<uintptr_t>(args.ptr_B_reordered) % (DstVecBits / 8) == 0) &&
+                   ((get<0>(args.dB) * QuantBits) % SrcVecBits == 0) &&
+                   (L == 1 || (get<2>(args.dB) * QuantBits) % SrcVecBits == 0);
+    if (!aligned) {
+      CUTLASS_TRACE_HOST("SM90MixedInputWeightPrepacker CAN NOT IMPLEMENT: Weights do not meet the vector alignment requirements");
+      return Status::kErrorMisalignedOperand;
+    }
+    if constexpr (HasScale) {
+      if (args.ptr_S != nullptr) {
+        if (args.group_size <= 0 || args.ptr_S_packed == nullptr) {
+          CUTLASS_TRACE_HOST("SM90MixedInputWeightPrepacker CAN NOT IMPLEMENT: Scales require a positive group size and a destination");
+          return Status::kErrorInvalidProblem;
+        }
+        if constexpr (HasZero) {
+          if ((args.ptr_Z == nullptr) != (args.ptr_Z_packed == nullptr)) {
+            CUTLASS_TRACE_HOST("SM90MixedInputWeightPrepacker CAN NOT IMPLEMENT: Zeros require both a source and a destination");
+            return Status::kErrorInvalidProblem;
+          }
+        }
+      }
+    }
+    CUTLASS_TRACE_HOST("SM90MixedInputWeightPrepacker::can_implement() (True)");
+    return Status::kSuccess;
+  }
+
+  static size_t
+  get_workspace_size(Arguments const& args) {
+    CUTLASS_UNUSED(args);
+    return 0;
+  }
+
+  static Status
+  initialize_workspace(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr,
+    CudaHostAdapter *cuda_adapter = nullptr) {
+    CUTLASS_UNUSED(args);
+    CUTLASS_UNUSED(workspace);
+    CUTLASS_UNUSED(stream);
+    CUTLASS_UNUSED(cuda_adapter);
+    return Status::kSuccess;
+  }
+
+  // Weight tiles first, then the scale and zero blocks
+  static dim3
+  get_grid_shape(Params const& params) {
+    return dim3(params.num_b_tiles + params.num_scale_blocks, 1, 1);
+  }
+
+  static dim3
+  get_block_shape() {
+    return dim3(MaxThreadsPerBlock, 1, 1);
+  }
+
+  CUTE_DEVICE
+  void
+  operator()(Params const& params, char* smem_buf) {
+    if (int(blockIdx.x) < params.num_b_tiles) {
+      reorder_weights(params, smem_buf, blockIdx.x);
+    }
+    else {
+      if constexpr (HasScale) {
+        pack_scales(params, blockIdx.x - params.num_b_tiles);
+      }
+    }
+  }
+
+  // Re-encodes the positive values of eight int4 nibbles so that they share magnitude bits with
+  // their negation (1 <-> 0b0111, ..., 7 <-> 0b0001); zero and negative values are unchanged.
+  CUTE_HOST_DEVICE
+  static uint32_t
+  unified_encode_int4(uint32_t w) {
+    uint32_t low3 = w & 0x77777777u;
+    uint32_t positive = (low3 | (low3 >> 1) | (low3 >> 2)) & ~(w >> 3) & 0x11111111u;
+    // 8 - x == (x ^ 0b111) + 1 for x in [1,7], and neither step carries out of a nibble
+    return (w ^ (positive * 7u)) + positive;
+  }
+
+  // Scaled lookup table values of the quantized codes, in the order the mainloop selects them
+  template <class Scale = ElementScale>
+  CUTE_HOST_DEVICE
+  static ElementScalePacked
+  pack_scale(Scale scale) {
+    if constexpr (UseScaleLookupTable) {
+      ElementScalePacked packed;
+      float s = float(scale);
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < 8; ++i) {
+        if constexpr (cute::is_same_v<ElementQuant, cutlass::float_e2m1_t>) {
+          constexpr float E2M1Lut[8] = {0.0f, -0.5f, -1.0f, -1.5f, -2.0f, -3.0f, -4.0f, -6.0f};
+          packed[i] = ElementScale(s * E2M1Lut[i]);
+        }
+        else if constexpr (cute::is_same_v<ElementQuant, cutlass::uint4b_t>) {
+          packed[i] = ElementScale(s * float(8 - i));
+        }
+        else {
+          packed[i] = ElementScale(s * float(i - 8));
+        }
+      }
+      return packed;
+    }
+    else {
+      return scale;
+    }
+  }
+
+private:
+
+  CUTE_DEVICE
+  static void
+  reorder_weights(Params const& params, char* smem_buf, int tile_idx) {
+    SharedStorage& shared_storage = *reinterpret_cast<SharedStorage*>(smem_buf);
+    auto [N, K, L] = params.problem_shape;
+    auto [tile_n, tile_k, l] = idx2crd(tile_idx, make_shape(params.tiles_n, params.tiles_k, L));
+    int n0 = tile_n * TileN{};
+    int k0 = tile_k * TileK{};
+
+    //
+    // Stage the (TileN,TileK) source tile in smem
+    //
+    Tensor mB = make_tensor(make_gmem_ptr<ElementQuant>(params.ptr_B), make_layout(params.problem_shape, params.dB));    // (N,K,L)
+    Tensor gB = local_tile(mB(_,_,l), TileShape{}, make_coord(tile_n, tile_k));                            // (TileN,TileK)
+    Tensor sB = make_tensor(make_smem_ptr(shared_storage.smem_B.begin()),
+                            make_layout(TileShape{}, LayoutRight{}));                                      // (TileN,TileK)
+
+    Tensor gB_vec = recast<SrcVecType const>(gB);                                                          // (TileN,TileK/SrcVecElems)
+    Tensor sB_vec = recast<SrcVecType>(sB);
+    constexpr int VecsPerRow = TileK{} / SrcVecElems;
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int v = threadIdx.x; v < int(size(sB_vec)); v += MaxThreadsPerBlock) {
+      int row = v / VecsPerRow;
+      int col = v % VecsPerRow;
+      if (n0 + row < N && k0 + col * SrcVecElems < K) {
+        sB_vec(row, col) = gB_vec(row, col);
+      }
+    }
+    __syncthreads();
+
+    //
+    // Write each atom column of the tile as one contiguous reordered chunk
+    //
+    Tensor mB_reordered = make_tensor(make_gmem_ptr<ElementQuant>(params.ptr_B_reordered), params.layout_B_reordered);   // (N,K,L)
+    constexpr int ChunkElems = size(LayoutChunk{});
+    constexpr int AtomElems = size(LayoutAtomQuant{});
+    int const atoms_n = N / AtomN{};
+    int const atoms_k = K / AtomK{};
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int c = 0; c < TileK{} / AtomK{}; ++c) {
+      int k_atom = tile_k * (TileK{} / AtomK{}) + c;
+      if (k_atom >= atoms_k) {
+        break;
+      }
+      // chunk offset -> source element in smem
+      Tensor sChunk = local_tile(sB, Shape<TileN, AtomK>{}, make_coord(_0{}, c));                        // (TileN,AtomK)
+      Tensor sChunk_ordered = make_tensor(sChunk.data(), composition(sChunk.layout(), right_inverse(LayoutChunk{})));
+      Tensor gChunk = make_tensor(mB_reordered.data() + mB_reordered.layout()(n0, k_atom * AtomK{}, l),
+                                  make_layout(Int<ChunkElems>{}));
+      Tensor gChunk_vec = recast<DstVecType>(gChunk);
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int v = threadIdx.x; v < ChunkElems / DstVecElems; v += MaxThreadsPerBlock) {
+        if (tile_n * (TileN{} / AtomN{}) + (v * DstVecElems) / AtomElems >= atoms_n) {
+          continue;
+        }
+        Tensor frg = make_tensor<ElementQuant>(Int<DstVecElems>{});
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < DstVecElems; ++i) {
+          frg(i) = sChunk_ordered(v * DstVecElems + i);
+        }
+        if constexpr (UseUnifiedEncoding) {
+          Tensor frg_u32 = recast<uint32_t>(frg);
+          CUTLASS_PRAGMA_UNROLL
+          for (int i = 0; i < size(frg_u32); ++i) {
+            frg_u32(i) = unified_encode_int4(frg_u32(i));
+          }
+        }
+        gChunk_vec(v) = recast<DstVecType>(frg)(0);
+      }
+    }
+  }
+
+  CUTE_DEVICE
+  static void
+  pack_scales(Params const& params, int block_idx) {
+    int64_t begin = (int64_t(block_idx) * MaxThreadsPerBlock + threadIdx.x) * ScalesPerThread;
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < ScalesPerThread; ++i) {
+      int64_t idx = begin + i;
+      if (idx < params.num_scales) {
+        params.ptr_S_packed[idx] = pack_scale(params.ptr_S[idx]);
+        if constexpr (HasZero) {
+          if (params.ptr_Z != nullptr) {
+            params.ptr_Z_packed[idx] = params.ptr_Z[idx];
+          }
+        }
+      }
+    }
+  }
+};
+
+} // namespace cutlass::transform::kernel
@@ -53,6 +53,31 @@ namespace cutlass::transform::kernel {
 
 using namespace cute;
 
+namespace detail {
+
+// Maps the raw bits of an ElementA value onto an unsigned integer that orders values by magnitude.
+// Floating-point types are sign-magnitude encoded, so masking out the sign bit suffices.
+template <class ElementA, class RawUnit>
+CUTE_HOST_DEVICE constexpr
+uint32_t
+structured_sparse_magnitude(RawUnit raw) {
+  constexpr int RawBits = cute::sizeof_bits_v<RawUnit>;
+  static_assert(RawBits >= 8 && RawBits <= 32, "Magnitude pruning requires 8 to 32 bit elements");
+
+  if constexpr (cute::is_same_v<ElementA, int8_t>) {
+    int32_t value = static_cast<int8_t>(raw);
+    return static_cast<uint32_t>(value < 0 ? -value : value);
+  }
+  else if constexpr (cute::is_same_v<ElementA, uint8_t>) {
+    return static_cast<uint32_t>(raw);
+  }
+  else {
+    return static_cast<uint32_t>(raw) & ((uint32_t(1) << (RawBits - 1)) - 1);
+  }
+}
+
+} // namespace detail
+
 template<
   class ProblemShape_,
   class ElementA_,
@@ -105,6 +130,9 @@ public:
   static constexpr int TensorAAlignmentK = typename SparseConfig::TensorAAlignmentK{};
   static constexpr int TensorAAlignmentM = typename SparseConfig::TensorAAlignmentM{};
 
+  // Magnitude pruning selects among individual elements, not packed sub-byte pairs
+  static constexpr bool IsPruneSupported = ElemsARawPerElementAMmaRaw == 1 && cute::sizeof_bits_v<ElementAMmaRaw> >= 8;
+
   // Required by `device_kernel`
   static constexpr int MaxThreadsPerBlock = TensorEAtomM{};
   static constexpr int MinBlocksPerMultiprocessor = 1;
@@ -123,6 +151,8 @@ public:
     StrideA dA{};
     void* ptr_ACompress{nullptr};
     void* ptr_E{nullptr};
+    // Keep the largest-magnitude elements of each chunk instead of requiring A to be structured sparse
+    bool prune{false};
   };
 
   using TransformParams = TransformArguments;
@@ -145,7 +175,7 @@ public:
   to_underlying_arguments(Arguments const& args, void* workspace = nullptr) {
     CUTLASS_TRACE_HOST("SM90StructuredSparseCompressor::to_underlying_arguments()");
     return Params{{args.problem_shape},
-                  {args.transform.ptr_A, args.transform.dA, args.transform.ptr_ACompress, args.transform.ptr_E},
+                  {args.transform.ptr_A, args.transform.dA, args.transform.ptr_ACompress, args.transform.ptr_E, args.transform.prune},
                   {args.hw_info},
                   workspace};
   }
@@ -157,6 +187,10 @@ public:
       CUTLASS_TRACE_HOST("SM90 Sparse Compressor CAN NOT IMPLEMENT: GemmK not multiplier of logical chunk size");
       return Status::kErrorInvalidProblem;
     }
+    if (args.transform.prune && not IsPruneSupported) {
+      CUTLASS_TRACE_HOST("SM90 Sparse Compressor CAN NOT IMPLEMENT: magnitude pruning requires unpacked 8 to 32 bit elements");
+      return Status::kErrorInvalidProblem;
+    }
     CUTLASS_TRACE_HOST("SM90StructuredSparseCompressor::can_implement() (True)");
     return Status::kSuccess;
   }
@@ -297,7 +331,7 @@ private:
   structure_sparse_compress(Params params, void* smem_buf) {
     // * Input Params
     auto [GemmM, GemmN, GemmK, GemmL] = params.problem_shape;
-    auto [ptr_A, dA, ptr_ACompress, ptr_E] = params.transform;
+    auto [ptr_A, dA, ptr_ACompress, ptr_E, prune] = params.transform;
     SharedStorage& shared_storage = *reinterpret_cast<SharedStorage*>(smem_buf);
 
     [[maybe_unused]] const int gridDim_X = gridDim.x;
@@ -434,11 +468,39 @@ private:
           //  non_zero_elt_log_idx = [0, 3]
           int non_zero_elt_log_idx[OneChunkSizeAC{}] = { 0 };
 
+          // * Prune Chunk to the OneChunkSizeAC Largest Magnitudes, ties broken towards lower index
+          // Pruned elements are treated as zeros below, so that a chunk with fewer nonzero elements
+          // than physical slots is compressed exactly as if it had been pruned beforehand.
+          bool keep_elt[OneChunkSizeA{}];
+          CUTE_UNROLL
+          for (int elt_log_idx = 0; elt_log_idx < OneChunkSizeA{}; ++elt_log_idx) {
+            keep_elt[elt_log_idx] = true;
+          }
+          if constexpr (IsPruneSupported) {
+            if (prune) {
+              uint32_t magnitude[OneChunkSizeA{}];
+              CUTE_UNROLL
+              for (int elt_log_idx = 0; elt_log_idx < OneChunkSizeA{}; ++elt_log_idx) {
+                magnitude[elt_log_idx] = detail::structured_sparse_magnitude<ElementA>(ElementAMmaRawUnit{tAsA[elt_log_idx]});
+              }
+              CUTE_UNROLL
+              for (int elt_log_idx = 0; elt_log_idx < OneChunkSizeA{}; ++elt_log_idx) {
+                int rank = 0;
+                CUTE_UNROLL
+                for (int other_idx = 0; other_idx < OneChunkSizeA{}; ++other_idx) {
+                  rank += (magnitude[other_idx] > magnitude[elt_log_idx]) ||
+                          (magnitude[other_idx] == magnitude[elt_log_idx] && other_idx < elt_log_idx);
+                }
+                keep_elt[elt_log_idx] = rank < OneChunkSizeAC{};
+              }
+            }
+          }
+
           // * Find None Zero Element Idx within Chunk
           CUTE_UNROLL
           for (int elt_log_idx = 0; elt_log_idx < OneChunkSizeA{}; ++elt_log_idx) {
             // Iterate through all ElementAMma within one logical chunk
-            ElementAMmaRawUnit tAsA_i = tAsA[elt_log_idx];
+            ElementAMmaRawUnit tAsA_i = keep_elt[elt_log_idx] ? ElementAMmaRawUnit{tAsA[elt_log_idx]} : ElementAMmaRawUnit{0};
             
             // Mask off the signed bit s.t. negative zero is same as positive zero
             ElementAMmaRawUnit tAsA_i_negzero_masked_out = tAsA_i;
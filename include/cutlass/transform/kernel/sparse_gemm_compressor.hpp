@@ -221,6 +221,44 @@ public:
     }    // end of chunk_idx
   }
 
+  /**
+   * @brief Zero out all but the largest-magnitude elements of each chunk, matching the
+   *        pruning applied on device by a compressor launched with `prune` set
+   */
+  void structure_sparse_magnitude_prune(void* host_a_ptr) {
+
+    constexpr int ChunkSize = LogicalElemsAMmaRawPerChunk;
+    constexpr int KeepSize = ChunkSize / ElementASparsity::value;
+    using ChunkElement = cute::uint_bit_t<cute::sizeof_bits_v<ElementAMmaRaw>>;
+
+    cute::Tensor gA_eltA = cute::make_tensor(
+        cute::recast_ptr<ElementA>(host_a_ptr),
+        cute::make_layout(make_shape(M, K, L), dA));
+
+    // Input TensorA is handled in unit of ElementAMmaRaw instead of ElementA
+    cute::Tensor gA = cute::recast<ChunkElement>(gA_eltA);
+
+    // Extract out the Chunk from K-mode
+    Tensor gA_chunk = cute::zipped_divide(gA, cute::Shape<_1,cute::Int<ChunkSize>>{}); // (Chunk, Rest)
+
+    auto rest_shape = cute::shape<1>(gA_chunk);
+    for (auto iter = cute::make_coord_iterator(rest_shape); iter != cute::ForwardCoordIteratorSentinel{}; ++iter) {
+      std::array<uint32_t, ChunkSize> magnitude{};
+      for (int c = 0; c < ChunkSize; ++c) {
+        magnitude[c] = detail::structured_sparse_magnitude<ElementA>(ChunkElement{gA_chunk(c, *iter)});
+      }
+      for (int c = 0; c < ChunkSize; ++c) {                                // for each elem within chunk
+        int rank = 0;
+        for (int other = 0; other < ChunkSize; ++other) {
+          rank += (magnitude[other] > magnitude[c]) || (magnitude[other] == magnitude[c] && other < c);
+        }
+        if (rank >= KeepSize) {
+          gA_chunk(c, *iter) = ChunkElement{0};
+        }
+      }  // end of within chunk
+    }    // end of chunk_idx
+  }
+
   int M{-1};
   int K{-1};
   int L{-1};
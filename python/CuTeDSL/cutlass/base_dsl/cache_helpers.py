@@ -14,6 +14,7 @@ This module provides jit cache load/dump helper functions
 """
 
 from collections import OrderedDict
+from contextlib import contextmanager
 import os
 import io
 import sys
@@ -22,7 +23,7 @@ import random
 import tempfile
 import time
 from typing import Any
-from collections.abc import Callable
+from collections.abc import Callable, Iterator
 from pathlib import Path
 import hashlib
 from functools import lru_cache
@@ -329,6 +330,59 @@ def dump_cache_to_path(
         )
 
 
+# Number of lock files shared by the entries of one file cache directory
+FILE_CACHE_LOCK_SHARDS = 64
+
+
+@contextmanager
+def file_cache_lock(
+    dsl_name: str,
+    file: str,
+    path: str | None = None,
+) -> Iterator[None]:
+    """Hold an exclusive lock on one entry of the file cache.
+
+    Processes sharing a cache directory take this lock before compiling a module that
+    missed the cache, so a module requested by many processes at once is compiled by one
+    of them and loaded by the others. The lock is released by the OS if its holder dies.
+    Entries hash onto a fixed set of FILE_CACHE_LOCK_SHARDS lock files, so the cache
+    directory does not collect one lock file per module; entries sharing a shard are
+    compiled one at a time. Locking is skipped where ``fcntl`` is unavailable or the lock
+    file cannot be created.
+
+    :param dsl_name: The name of the DSL.
+    :type dsl_name: str
+    :param file: The name of the cache entry to lock.
+    :type file: str
+    :param path: The path to the cache directory, defaults to get_default_generated_ir_path(dsl_name)
+    :type path: str, optional
+    """
+    try:
+        import fcntl
+    except ImportError:
+        yield
+        return
+
+    if path is None:
+        path = get_default_generated_ir_path(dsl_name)
+    shard = int(hashlib.sha256(file.encode()).hexdigest(), 16) % FILE_CACHE_LOCK_SHARDS
+    lock_file = os.path.join(path, f"{dsl_name.lower()}_cache_{shard:02d}.lock")
+    try:
+        os.makedirs(path, exist_ok=True)
+        fd = os.open(lock_file, os.O_RDWR | os.O_CREAT, 0o666)
+    except OSError as e:
+        log().warning(f"{dsl_name} failed with opening cache lock {lock_file}: {e}")
+        yield
+        return
+
+    try:
+        log().debug("JIT cache : waiting for lock [%s]", lock_file)
+        fcntl.flock(fd, fcntl.LOCK_EX)
+        yield
+    finally:
+        os.close(fd)
+
+
 class JitCacheDict:
     def __init__(self, max_elems: int | None = None):
         """
@@ -28,7 +28,7 @@ import re
 import inspect
 import argparse
 import hashlib
-from contextlib import contextmanager
+from contextlib import ExitStack, contextmanager
 from functools import lru_cache, wraps
 from collections import namedtuple, OrderedDict
 from abc import ABC, abstractmethod
@@ -1718,6 +1718,29 @@ class BaseDSL(metaclass=DSLSingletonMeta):
 
         return module, module_hash, result
 
+    def _load_from_file_cache(
+        self, module_hash: str, file_lock: ExitStack
+    ) -> JitCompiledFunction | None:
+        """Load a module from the file cache, taking the file cache lock on a miss.
+
+        Processes sharing the cache directory compile each module once: on a miss this waits
+        for any process already compiling the module and loads its result. If the module is
+        still missing, the lock is left on ``file_lock`` for the caller to hold while it
+        compiles and writes the module.
+        """
+        fn = load_cache_from_path(
+            self.name, module_hash, bytecode_reader=read_bytecode_and_check_crc32
+        )
+        if fn is not None or self.envar.disable_file_caching:
+            return fn
+        file_lock.enter_context(file_cache_lock(self.name, module_hash))
+        fn = load_cache_from_path(
+            self.name, module_hash, bytecode_reader=read_bytecode_and_check_crc32
+        )
+        if fn is not None:
+            file_lock.close()
+        return fn
+
     def compile_and_cache(
         self,
         module: ir.Module,
@@ -1753,13 +1776,10 @@ class BaseDSL(metaclass=DSLSingletonMeta):
         )
         shared_libs = self.get_shared_libs()
         # try load the file cache
-        load_from_file_cache = False
+        file_lock = ExitStack()
         if not no_cache:
-            fn = load_cache_from_path(
-                self.name, module_hash, bytecode_reader=read_bytecode_and_check_crc32
-            )
+            fn = self._load_from_file_cache(module_hash, file_lock)
             if fn is not None:
-                load_from_file_cache = True
                 self.jit_cache.set(module_hash, fn, funcBody=funcBody)
 
         cached_jit_func = None if no_cache else self.jit_cache.get(module_hash)
@@ -1776,29 +1796,41 @@ class BaseDSL(metaclass=DSLSingletonMeta):
                 function_name,
                 module_hash,
             )
-            # Compile and JIT MLIR module
-            if gen_jit_engine:
-                if self.envar.jit_time_profiling:
-                    engine = self.profiler(self.compile_and_jit)(
-                        module, pipeline, shared_libs, function_name=function_name
-                    )
-                else:
-                    engine = self.compile_and_jit(
-                        module, pipeline, shared_libs, function_name=function_name
-                    )
-            else:
-                if self.envar.jit_time_profiling:
-                    self.profiler(self.compiler_provider.compile)(
-                        module,
-                        pipeline,
-                    )
+            # Compile and JIT MLIR module, holding the file cache lock taken on a file
+            # cache miss until the compiled module has been written through
+            with file_lock:
+                if gen_jit_engine:
+                    if self.envar.jit_time_profiling:
+                        engine = self.profiler(self.compile_and_jit)(
+                            module, pipeline, shared_libs, function_name=function_name
+                        )
+                    else:
+                        engine = self.compile_and_jit(
+                            module, pipeline, shared_libs, function_name=function_name
+                        )
                 else:
-                    self.compiler_provider.compile(
-                        module,
-                        pipeline,
+                    if self.envar.jit_time_profiling:
+                        self.profiler(self.compiler_provider.compile)(
+                            module,
+                            pipeline,
+                        )
+                    else:
+                        self.compiler_provider.compile(
+                            module,
+                            pipeline,
+                        )
+                    engine = None
+                # write through the file cache if enabled.
+                if not no_cache and not self.envar.disable_file_caching:
+                    dump_cache_to_path(
+                        self.name,
+                        JitCompiledFunction(module, None, None, None, None, [], False, None),  # type: ignore[arg-type]
+                        module_hash,
+                        bytecode_writer=lambda f: write_bytecode_with_crc32(f, module),
                     )
-                engine = None
         else:
+            # An in-memory hit needs no file cache lock
+            file_lock.close()
             log().info(
                 "JIT cache hit IN-FILE function=[%s] module_hash=[%s]",
                 function_name,
@@ -1848,16 +1880,6 @@ class BaseDSL(metaclass=DSLSingletonMeta):
         if not no_cache:
             # module stored in cache is compiled.
             self.jit_cache.set(module_hash, fn, funcBody=funcBody)
-            # write through the file cache if enabled.
-            if not self.envar.disable_file_caching and not load_from_file_cache:
-                dump_cache_to_path(
-                    self.name,
-                    fn,
-                    module_hash,
-                    bytecode_writer=lambda f: write_bytecode_with_crc32(
-                        f, fn.ir_module
-                    ),
-                )
 
         return fn
 
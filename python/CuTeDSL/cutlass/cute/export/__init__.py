@@ -10,6 +10,11 @@
 # is strictly prohibited.
 
 from .c_header_generator import CuteCHeaderGenerator
+from .library_operation import (
+    GemmOperationDescription,
+    export_to_library,
+    export_library_entry_point,
+)
 
 from .export import object_file_version as _object_file_version
 from .export import CuteSignatureProcessor as _CuteSignatureProcessor
@@ -46,4 +51,7 @@ _ExternalBinaryModule.load_provider = _LoadProvider(
 
 __all__ = [
     "CuteCHeaderGenerator",
+    "GemmOperationDescription",
+    "export_to_library",
+    "export_library_entry_point",
 ]
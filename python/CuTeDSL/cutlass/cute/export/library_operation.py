@@ -0,0 +1,488 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: LicenseRef-NvidiaProprietary
+#
+# Use of this software is governed by the terms and conditions of the
+# NVIDIA End User License Agreement (EULA), available at:
+# https://docs.nvidia.com/cutlass/latest/media/docs/pythonDSL/license.html
+#
+# Any use, reproduction, disclosure, or distribution of this software
+# and related documentation outside the scope permitted by the EULA
+# is strictly prohibited.
+
+"""Export of compiled GEMM functions as ``cutlass::library::Operation`` implementations.
+
+``export_to_library`` builds on ``export_to_c``: next to the header and object file, it writes a
+``<file_name>_operation.h`` header defining an operation which translates the
+``GemmUniversalConfiguration`` and ``GemmUniversalArguments`` of the CUTLASS library into the arguments
+of the exported wrapper function. ``export_library_entry_point`` writes the source of the entry point
+through which ``cutlass::library::Manifest`` appends such operations when their shared library is listed
+in ``CUTLASS_LIBRARY_EXTERNAL_OPERATIONS``, which makes them visible to ``cutlass_profiler``.
+"""
+
+from dataclasses import dataclass
+import os
+import re
+from typing import Any
+
+from cutlass.base_dsl.common import DSLRuntimeError
+from ..runtime import Tensor, Pointer
+from ..typing import SymInt
+
+# Extents of each GEMM mode in GemmUniversalArguments
+_mode_extents = {
+    "M": "int64_t(arguments->problem_size.m())",
+    "N": "int64_t(arguments->problem_size.n())",
+    "K": "int64_t(arguments->problem_size.k())",
+    "L": "int64_t(arguments->batch_count)",
+}
+
+# Row and column modes of each operand in the conventions of the CUTLASS library
+_operand_modes = {
+    "A": ("M", "K"),
+    "B": ("K", "N"),
+    "C": ("M", "N"),
+    "D": ("M", "N"),
+}
+
+# C types of the epilogue scalars to which GemmUniversalArguments::alpha and beta point
+_epilogue_c_types = {
+    "f32": "float",
+    "f64": "double",
+    "s32": "int32_t",
+}
+
+entry_point_name = "cutlass_library_initialize_external"
+
+
+@dataclass
+class GemmOperationDescription:
+    """Describes an exported GEMM to the CUTLASS library. Element types, layouts and the opcode class are
+    given by the names ``cutlass::library::from_string`` accepts, e.g. ``"f16"``, ``"column"``, ``"row"``
+    and ``"tensorop"``. Layouts follow the library's conventions, in which B is a K-by-N matrix.
+    """
+
+    name: str
+    element_a: str
+    layout_a: str
+    element_b: str
+    layout_b: str
+    element_c: str
+    layout_c: str
+    element_accumulator: str
+    minimum_compute_capability: int
+    maximum_compute_capability: int = 1024
+    element_d: str | None = None
+    layout_d: str | None = None
+    element_epilogue: str | None = None
+    alignment_a: int = 1
+    alignment_b: int = 1
+    alignment_c: int = 1
+    alignment_d: int | None = None
+    tile_shape: tuple[int, int, int] = (0, 0, 0)
+    cluster_shape: tuple[int, int, int] = (1, 1, 1)
+    warp_count: tuple[int, int, int] = (0, 0, 0)
+    stages: int = 0
+    instruction_shape: tuple[int, int, int] = (0, 0, 0)
+    opcode_class: str = "tensorop"
+
+    def __post_init__(self) -> None:
+        if self.element_d is None:
+            self.element_d = self.element_c
+        if self.layout_d is None:
+            self.layout_d = self.layout_c
+        if self.element_epilogue is None:
+            self.element_epilogue = self.element_accumulator
+        if self.alignment_d is None:
+            self.alignment_d = self.alignment_c
+
+    def layout(self, operand: str) -> str:
+        return getattr(self, "layout_" + operand.lower())
+
+    def alignment(self, operand: str) -> int:
+        return getattr(self, "alignment_" + operand.lower())
+
+
+def _parse_argument(argument: str) -> tuple[str, str]:
+    """Splits an argument of the exported wrapper function, e.g. ``"float alpha"``, into its type and name."""
+    match = re.match(r"^(.*?)\s*(\**)\s*(\w+)$", argument.strip())
+    if match is None:
+        raise DSLRuntimeError(f"Unable to parse wrapper function argument: {argument}")
+    return (match.group(1) + match.group(2)).strip(), match.group(3)
+
+
+class _OperationEmitter:
+    """Emits the statements of the generated operation for each argument of the wrapper function."""
+
+    def __init__(self, description: GemmOperationDescription):
+        self.description = description
+        self.checks: list[str] = []
+        self.statements: list[str] = []
+        self.call_args: list[str] = []
+        self.uses_scalars = False
+        self.uses_batch = False
+
+    def _stride(self, operand: str, mode: str) -> str:
+        """Expression of the stride of ``mode`` in an operand of the CUTLASS library."""
+        if mode == "L":
+            return f"arguments->batch_stride_{operand}"
+        row, col = _operand_modes[operand]
+        if mode not in (row, col):
+            raise DSLRuntimeError(f"Operand {operand} has no mode {mode}")
+        column_major = self.description.layout(operand) in ("column", "col", "n")
+        contiguous = row if column_major else col
+        return "int64_t(1)" if mode == contiguous else f"arguments->ld{operand.lower()}"
+
+    def _check(self, condition: str) -> None:
+        if any(condition in check for check in self.checks):
+            return
+        self.checks.append(f"    if (!({condition})) {{\n      return Status::kErrorNotSupported;\n    }}")
+
+    def tensor(self, c_type: str, name: str, arg: Any, operand: str, modes: tuple[str, ...]) -> None:
+        shape, stride = tuple(arg.shape), tuple(arg.stride)
+        if len(modes) != len(shape) or any(isinstance(s, tuple) for s in shape + stride):
+            raise DSLRuntimeError(
+                f"Tensor {name} must be flat and have one mode name per mode, got modes {modes} for shape {shape}"
+            )
+        self.uses_batch |= "L" in modes
+        struct_type = c_type.rstrip("*").strip()
+        stride_type = "int32_t" if arg._use_32bit_stride else "int64_t"
+        data = f"arguments->{operand}"
+        if operand != "D":
+            data = f"const_cast<void *>({data})"
+        self.statements.append(f"    {struct_type} {name};\n    {name}.data = {data};")
+
+        shape_idx, stride_idx = 0, 0
+        for mode, extent, mode_stride, shape_dynamic, stride_dynamic in zip(
+            modes, shape, stride, arg.dynamic_shapes_mask, arg.dynamic_strides_mask
+        ):
+            extent_expr = _mode_extents[mode]
+            stride_expr = self._stride(operand, mode)
+            if shape_dynamic:
+                self.statements.append(
+                    f"    {name}.dynamic_shapes[{shape_idx}] = int32_t({extent_expr});"
+                )
+                shape_idx += 1
+                if isinstance(extent, SymInt) and extent.divisibility > 1:
+                    self._check(f"{extent_expr} % {extent.divisibility} == 0")
+            else:
+                self._check(f"{extent_expr} == {int(extent)}")
+            if stride_dynamic:
+                self.statements.append(
+                    f"    {name}.dynamic_strides[{stride_idx}] = {stride_type}({stride_expr});"
+                )
+                stride_idx += 1
+                if isinstance(mode_stride, SymInt) and mode_stride.divisibility > 1:
+                    self._check(f"{stride_expr} % {mode_stride.divisibility} == 0")
+            elif stride_expr != "int64_t(1)" or int(mode_stride) != 1:
+                # A static stride along a batch mode of extent 1 is never used
+                if not (mode == "L" and not shape_dynamic and int(extent) == 1):
+                    self._check(f"{stride_expr} == {int(mode_stride)}")
+        self.call_args.append("&" + name)
+
+    def pointer(self, operand: str) -> None:
+        data = f"arguments->{operand}"
+        self.call_args.append(data if operand == "D" else f"const_cast<void *>({data})")
+
+    def scalar(self, c_type: str, role: str) -> None:
+        if role in ("alpha", "beta"):
+            epilogue_type = _epilogue_c_types.get(self.description.element_epilogue)
+            if epilogue_type is None:
+                raise DSLRuntimeError(
+                    f"Binding {role} requires an epilogue of type {', '.join(_epilogue_c_types.keys())}"
+                )
+            self.uses_scalars = True
+            self.call_args.append(f"{c_type}(*static_cast<{epilogue_type} const *>(arguments->{role}))")
+        else:
+            self.uses_batch |= role == "L"
+            self.call_args.append(f"{c_type}({_mode_extents[role]})")
+
+    def alignment_checks(self, operands: set[str]) -> None:
+        for operand in sorted(operands):
+            alignment = self.description.alignment(operand)
+            if alignment <= 1:
+                continue
+            row, col = _operand_modes[operand]
+            column_major = self.description.layout(operand) in ("column", "col", "n")
+            contiguous = row if column_major else col
+            self._check(f"{_mode_extents[contiguous]} % {alignment} == 0")
+            self._check(f"arguments->ld{operand.lower()} % {alignment} == 0")
+
+
+def export_to_library(
+    compiled_fn: Any,
+    file_path: str,
+    file_name: str,
+    *args: Any,
+    description: GemmOperationDescription,
+    bindings: dict[str, Any],
+    function_prefix: str = "",
+    **kwargs: Any,
+) -> None:
+    """Exports a compiled GEMM function as a ``cutlass::library::Operation``.
+
+    The header and object file of ``export_to_c`` are written to ``file_path``, along with
+    ``<file_name>_operation.h``. The latter defines ``<function_prefix>_initialize(Manifest &)``, which appends
+    the operation to a manifest.
+
+    ``bindings`` maps each argument name of the compiled function to its role in the GEMM:
+
+    - ``("A", ("M", "K", "L"))``: a tensor holding an operand, with the GEMM mode of each of its modes.
+      Operands are ``"A"``, ``"B"``, ``"C"`` and ``"D"``, and modes ``"M"``, ``"N"``, ``"K"`` and ``"L"`` (batch).
+    - ``"A"``, ``"B"``, ``"C"`` or ``"D"``: a pointer to an operand.
+    - ``"alpha"`` or ``"beta"``: an epilogue scalar.
+    - ``"M"``, ``"N"``, ``"K"`` or ``"L"``: an extent of the problem.
+    - ``"stream"``: the stream to launch on.
+
+    Static extents and strides of tensors are checked by ``can_implement``, as are the divisibility
+    constraints of ``cute.SymInt`` and the alignments in ``description``.
+
+    @param compiled_fn: The jit-compiled function from `cute.compile`.
+    @param file_path: The path to the directory where the files will be saved.
+    @param file_name: The name of the files.
+    @param args: The arguments the function was compiled with.
+    @param description: The description of the operation in the CUTLASS library.
+    @param bindings: The role of each argument of the compiled function.
+    @param function_prefix: The prefix of the exported symbols. Default to the `file_name`.
+    @param kwargs: The keyword arguments the function was compiled with.
+    """
+    if function_prefix is None or function_prefix == "":
+        function_prefix = file_name
+
+    c_header_arguments = compiled_fn.c_header_arguments
+    if not c_header_arguments:
+        raise DSLRuntimeError(f"Function cannot be exported: {c_header_arguments}")
+
+    compiled_fn.export_to_c(file_path, file_name, function_prefix)
+
+    emitter = _OperationEmitter(description)
+    operands = set()
+    execution_args = compiled_fn.execution_args
+    rectified_args = execution_args.get_rectified_args(args, kwargs)
+    runtime_args = {
+        param.name: arg
+        for param, arg in zip(execution_args.signature.parameters.values(), rectified_args)
+        if arg is not None
+    }
+
+    for argument in c_header_arguments.arguments:
+        c_type, name = _parse_argument(
+            argument.replace(c_header_arguments.dummy_prefix_name, function_prefix)
+        )
+        if name not in bindings:
+            raise DSLRuntimeError(f"Argument {name} has no binding")
+        binding = bindings[name]
+        arg = runtime_args.get(name)
+
+        if isinstance(binding, tuple):
+            operand, modes = binding
+            if not isinstance(arg, Tensor):
+                raise DSLRuntimeError(f"Argument {name} is bound to a tensor but is not a tensor")
+            emitter.tensor(c_type, name, arg, operand, tuple(modes))
+            operands.add(operand)
+        elif binding in _operand_modes:
+            if not isinstance(arg, Pointer):
+                raise DSLRuntimeError(f"Argument {name} is bound to a pointer but is not a pointer")
+            emitter.pointer(binding)
+            operands.add(binding)
+        elif binding == "stream":
+            emitter.call_args.append("stream")
+        elif binding in ("alpha", "beta") or binding in _mode_extents:
+            emitter.scalar(c_type, binding)
+        else:
+            raise DSLRuntimeError(f"Unknown binding {binding} for argument {name}")
+
+    emitter.alignment_checks(operands)
+
+    dsl_name = compiled_fn.export_provider.dsl._get_dsl().name
+    wrapper_function_name = f"{dsl_name.lower()}_{function_prefix}_wrapper"
+    returns_status = (
+        execution_args.signature.return_annotation is not execution_args.signature.empty
+    )
+    call = f"{wrapper_function_name}(&module_, {', '.join(emitter.call_args)})"
+    if returns_status:
+        run_call = f"    if ({call} != 0) {{\n      return Status::kErrorInternal;\n    }}"
+    else:
+        run_call = f"    {call};"
+
+    header = _operation_template.format(
+        file_name=file_name,
+        prefix=function_prefix,
+        d=description,
+        mode_check=(
+            "(config->mode != GemmUniversalMode::kGemm || config->batch_count != 1) && "
+            "config->mode != GemmUniversalMode::kBatched"
+            if emitter.uses_batch
+            else "config->mode != GemmUniversalMode::kGemm || config->batch_count != 1"
+        ),
+        scalar_check=(
+            "\n    if (arguments->pointer_mode != ScalarPointerMode::kHost) {\n"
+            "      return Status::kErrorNotSupported;\n    }"
+            if emitter.uses_scalars
+            else ""
+        ),
+        checks="\n".join(emitter.checks),
+        statements="\n".join(emitter.statements),
+        run_call=run_call,
+        tile=", ".join(str(x) for x in description.tile_shape),
+        cluster=", ".join(str(x) for x in description.cluster_shape),
+        warps=", ".join(str(x) for x in description.warp_count),
+        instruction=", ".join(str(x) for x in description.instruction_shape),
+    )
+    try:
+        with open(os.path.join(file_path, file_name + "_operation.h"), "w") as f:
+            f.write(header)
+    except Exception as e:
+        raise DSLRuntimeError(f"Error writing operation header file: {e}") from e
+
+
+def export_library_entry_point(
+    file_path: str,
+    file_name: str,
+    exports: list[tuple[str, str]],
+) -> None:
+    """Writes ``<file_name>.cpp``, defining the entry point of a shared library of exported operations.
+
+    @param file_path: The path to the directory where the source will be saved.
+    @param file_name: The name of the source.
+    @param exports: The `(file_name, function_prefix)` of each `export_to_library` call whose operation the library holds.
+    """
+    includes = "\n".join(f'#include "{name}_operation.h"' for name, _ in exports)
+    calls = "\n".join(f"  {prefix}_initialize(manifest);" for _, prefix in exports)
+    source = _entry_point_template.format(
+        includes=includes, calls=calls, entry_point=entry_point_name
+    )
+    try:
+        with open(os.path.join(file_path, file_name + ".cpp"), "w") as f:
+            f.write(source)
+    except Exception as e:
+        raise DSLRuntimeError(f"Error writing entry point source file: {e}") from e
+
+
+_operation_template = """\
+#pragma once
+
+#include <mutex>
+#include <string>
+
+#include "cutlass/library/library.h"
+#include "cutlass/library/manifest.h"
+#include "cutlass/library/util.h"
+
+#include "{file_name}.h"
+
+namespace {prefix}_library {{
+
+using namespace cutlass::library;
+using cutlass::Status;
+
+class Operation : public cutlass::library::Operation {{
+  std::string name_;
+  GemmDescription description_;
+  mutable {prefix}_Kernel_Module_t module_;
+  mutable std::once_flag module_loaded_;
+
+  static TensorDescription tensor(char const *element, char const *layout, int alignment) {{
+    return TensorDescription(
+      from_string<NumericTypeID>(element), from_string<LayoutTypeID>(layout), alignment, 24, 56);
+  }}
+
+public:
+
+  Operation(): name_("{d.name}") {{
+    description_.name = name_.c_str();
+    description_.provider = Provider::kCUTLASS;
+    description_.kind = OperationKind::kGemm;
+    description_.gemm_kind = GemmKind::kUniversal;
+    description_.tile_description = TileDescription(
+      cutlass::gemm::GemmCoord({tile}),
+      {d.stages},
+      cutlass::gemm::GemmCoord({warps}),
+      MathInstructionDescription(
+        cutlass::gemm::GemmCoord({instruction}),
+        from_string<NumericTypeID>("{d.element_accumulator}"),
+        from_string<OpcodeClassID>("{d.opcode_class}")),
+      {d.minimum_compute_capability},
+      {d.maximum_compute_capability},
+      cutlass::gemm::GemmCoord({cluster}));
+    description_.A = tensor("{d.element_a}", "{d.layout_a}", {d.alignment_a});
+    description_.B = tensor("{d.element_b}", "{d.layout_b}", {d.alignment_b});
+    description_.C = tensor("{d.element_c}", "{d.layout_c}", {d.alignment_c});
+    description_.D = tensor("{d.element_d}", "{d.layout_d}", {d.alignment_d});
+    description_.element_epilogue = from_string<NumericTypeID>("{d.element_epilogue}");
+  }}
+
+  OperationDescription const &description() const override {{
+    return description_;
+  }}
+
+  Status can_implement(void const *configuration_ptr, void const *arguments_ptr) const override {{
+    auto const *config = static_cast<GemmUniversalConfiguration const *>(configuration_ptr);
+    auto const *arguments = static_cast<GemmUniversalArguments const *>(arguments_ptr);
+    if (!config || !arguments) {{
+      return Status::kErrorInvalidProblem;
+    }}
+    if ({mode_check}) {{
+      return Status::kErrorNotSupported;
+    }}{scalar_check}
+{checks}
+    return Status::kSuccess;
+  }}
+
+  uint64_t get_host_workspace_size(void const *configuration) const override {{
+    return 0;
+  }}
+
+  uint64_t get_device_workspace_size(void const *configuration, void const *arguments = nullptr) const override {{
+    return 0;
+  }}
+
+  Status initialize(
+    void const *configuration,
+    void *host_workspace,
+    void *device_workspace = nullptr,
+    cudaStream_t stream = nullptr) const override {{
+
+    // The module is loaded on first use and left loaded for the lifetime of the process
+    std::call_once(module_loaded_, [this]() {{ {prefix}_Kernel_Module_Load(&module_); }});
+    return Status::kSuccess;
+  }}
+
+  Status run(
+    void const *arguments_ptr,
+    void *host_workspace,
+    void *device_workspace = nullptr,
+    cudaStream_t stream = nullptr) const override {{
+
+    auto const *arguments = static_cast<GemmUniversalArguments const *>(arguments_ptr);
+    std::call_once(module_loaded_, [this]() {{ {prefix}_Kernel_Module_Load(&module_); }});
+{statements}
+{run_call}
+    return Status::kSuccess;
+  }}
+}};
+
+}} // namespace {prefix}_library
+
+/// Appends the exported operation to the manifest
+inline void {prefix}_initialize(cutlass::library::Manifest &manifest) {{
+  manifest.append(new {prefix}_library::Operation());
+}}
+"""
+
+_entry_point_template = """\
+#include "cutlass/library/manifest.h"
+
+{includes}
+
+#if defined(_WIN32)
+#define CUTLASS_EXTERNAL_OPERATIONS_EXPORT __declspec(dllexport)
+#else
+#define CUTLASS_EXTERNAL_OPERATIONS_EXPORT __attribute__((visibility("default")))
+#endif
+
+/// Called by cutlass::library::Manifest::initialize() when this library is listed in
+/// CUTLASS_LIBRARY_EXTERNAL_OPERATIONS
+extern "C" CUTLASS_EXTERNAL_OPERATIONS_EXPORT void {entry_point}(cutlass::library::Manifest &manifest) {{
+{calls}
+}}
+"""
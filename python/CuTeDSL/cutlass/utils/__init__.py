@@ -127,6 +127,8 @@ from .tensor_helpers import (
     create_cute_tensor_for_fp8,
 )
 
+from .autotune import autotune, AutotuneCache
+
 __all__ = [
     "get_smem_capacity_in_bytes",
     "get_kernel_smem_size",
@@ -190,4 +192,6 @@ __all__ = [
     "is_fp8_dtype",
     "create_cute_tensor_for_fp8",
     "distributed",
+    "autotune",
+    "AutotuneCache",
 ]
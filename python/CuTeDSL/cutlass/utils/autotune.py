@@ -0,0 +1,394 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: LicenseRef-NvidiaProprietary
+#
+# Use of this software is governed by the terms and conditions of the
+# NVIDIA End User License Agreement (EULA), available at:
+# https://docs.nvidia.com/cutlass/latest/media/docs/pythonDSL/license.html
+#
+# Any use, reproduction, disclosure, or distribution of this software
+# and related documentation outside the scope permitted by the EULA
+# is strictly prohibited.
+
+"""Autotuning of ``@cute.jit`` functions with persistent results.
+
+Kernels commonly expose tile, cluster and stage choices as ``Constexpr``
+parameters. ``autotune`` sweeps a set of such choices the first time a
+problem is seen, compiling the candidates and benchmarking them with a cold
+L2, and records the winner keyed by problem signature and GPU in
+an ``AutotuneCache`` on disk. Later calls in the same process reuse the tuned
+compiled kernel directly; later processes compile only the recorded winner.
+
+Usage::
+
+    from cutlass.utils import autotune
+
+    @autotune(
+        configs={"mma_tiler_mn": [(128, 128), (256, 128)], "cluster_shape_mn": [(1, 1), (2, 1)]},
+        key=["a", "b", "c"],
+        stream_arg="stream",
+    )
+    @cute.jit
+    def gemm(a, b, c, stream, mma_tiler_mn: cutlass.Constexpr = (128, 128),
+             cluster_shape_mn: cutlass.Constexpr = (1, 1)):
+        ...
+
+    gemm(a, b, c, stream)  # tunes, or compiles the recorded winner
+    gemm(a, b, c, stream)  # launches the tuned kernel
+
+The cache file defaults to ``autotune.json`` in the CuTe DSL cache directory
+(``CUTE_DSL_CACHE_DIR``) and can be overridden with ``CUTE_DSL_AUTOTUNE_CACHE``.
+Set ``CUTE_DSL_LOG_AUTOTUNE=1`` to log the sweep.
+"""
+
+from __future__ import annotations
+
+import functools
+import inspect
+import json
+import logging
+import os
+import tempfile
+import threading
+from itertools import product
+from time import time
+from typing import Any, Callable, Dict, List, Optional, Sequence
+
+import cuda.bindings.driver as cuda_driver
+
+
+_CACHE_VERSION = 1
+
+# The DSL compiles through a process-wide singleton whose per-compilation state
+# (kernel info, compile options, decorator location) is reset after each
+# compile, so compilations must not overlap
+_compile_lock = threading.Lock()
+
+_logger = logging.getLogger(__name__)
+if not _logger.handlers:
+    _handler = logging.StreamHandler()
+    _handler.setFormatter(
+        logging.Formatter("%(asctime)s - %(name)s - %(levelname)s - %(message)s")
+    )
+    _logger.addHandler(_handler)
+if os.environ.get("CUTE_DSL_LOG_AUTOTUNE", "0") != "0":
+    _logger.setLevel(logging.INFO)
+
+
+def _to_json(value: Any) -> Any:
+    if isinstance(value, (list, tuple)):
+        return [_to_json(v) for v in value]
+    if isinstance(value, (bool, int, float, str)) or value is None:
+        return value
+    raise TypeError(
+        f"Autotuned parameter value {value!r} of type {type(value).__name__} cannot be persisted"
+    )
+
+
+def _from_json(value: Any) -> Any:
+    # Configurations are usually shapes, which kernels expect as tuples
+    if isinstance(value, list):
+        return tuple(_from_json(v) for v in value)
+    return value
+
+
+class AutotuneCache:
+    """Tuned configurations persisted as JSON, keyed by function, GPU and problem signature.
+
+    Stores re-read the file and replace it atomically, so processes tuning
+    different problems concurrently do not lose each other's results.
+
+    :param path: Path of the cache file, defaults to ``CUTE_DSL_AUTOTUNE_CACHE`` or
+        ``autotune.json`` in the CuTe DSL cache directory
+    :type path: str, optional
+    """
+
+    def __init__(self, path: Optional[str] = None) -> None:
+        if path is None:
+            path = os.environ.get("CUTE_DSL_AUTOTUNE_CACHE")
+        if path is None:
+            from cutlass.base_dsl.cache_helpers import get_default_generated_ir_path
+
+            path = os.path.join(get_default_generated_ir_path(), "autotune.json")
+        self.path = path
+        self._lock = threading.Lock()
+        self._entries: Optional[Dict[str, Dict[str, Any]]] = None
+
+    def _read(self) -> Dict[str, Dict[str, Any]]:
+        try:
+            with open(self.path) as f:
+                content = json.load(f)
+        except FileNotFoundError:
+            return {}
+        except (OSError, ValueError) as e:
+            _logger.warning(f"Ignoring unreadable autotune cache {self.path}: {e}")
+            return {}
+        if content.get("version") != _CACHE_VERSION:
+            return {}
+        return content.get("entries", {})
+
+    def lookup(self, key: str) -> Optional[Dict[str, Any]]:
+        """Returns the configuration recorded for ``key``, or None"""
+        with self._lock:
+            if self._entries is None:
+                self._entries = self._read()
+            entry = self._entries.get(key)
+        if entry is None:
+            return None
+        return {name: _from_json(value) for name, value in entry["config"].items()}
+
+    def store(self, key: str, config: Dict[str, Any], time_us: float) -> None:
+        """Records ``config`` as the tuned configuration of ``key``"""
+        entry = {
+            "config": {name: _to_json(value) for name, value in config.items()},
+            "time_us": time_us,
+        }
+        with self._lock:
+            entries = self._read()
+            entries[key] = entry
+            self._entries = entries
+
+            directory = os.path.dirname(self.path) or "."
+            try:
+                os.makedirs(directory, exist_ok=True)
+                fd, tmp_path = tempfile.mkstemp(dir=directory, suffix=".tmp")
+                with os.fdopen(fd, "w") as f:
+                    json.dump(
+                        {"version": _CACHE_VERSION, "entries": entries},
+                        f,
+                        indent=2,
+                        sort_keys=True,
+                    )
+                os.replace(tmp_path, self.path)
+            except OSError as e:
+                _logger.warning(f"Could not write autotune cache {self.path}: {e}")
+
+
+def _describe(value: Any) -> str:
+    """Renders an argument as part of a problem signature"""
+    shape = getattr(value, "shape", None)
+    if shape is not None:
+        dtype = getattr(value, "element_type", None) or getattr(value, "dtype", None)
+        stride = getattr(value, "stride", None)
+        if callable(stride):
+            stride = stride()
+        return f"{type(value).__name__}(shape={tuple(shape)}, stride={stride}, dtype={dtype})"
+    return repr(value)
+
+
+@functools.lru_cache(maxsize=None)
+def _device_name(device_id: int) -> str:
+    from cutlass.utils import HardwareInfo
+
+    hardware_info = HardwareInfo(device_id)
+    major, minor = hardware_info.get_compute_capability()
+    return f"{hardware_info.get_device_name()} (sm_{major}{minor})"
+
+
+def _device_signature() -> str:
+    """Names the GPU of the current context"""
+    err, device = cuda_driver.cuCtxGetDevice()
+    return _device_name(int(device) if err == cuda_driver.CUresult.CUDA_SUCCESS else 0)
+
+
+class _TunedKernel:
+    """Compiled kernel of one configuration, called with the arguments of the jit function.
+
+    Compilation removes the Constexpr parameters from the signature of the
+    compiled function, so they are dropped from the arguments of each call.
+    """
+
+    def __init__(self, compiled_func: Any, config: Dict[str, Any]) -> None:
+        self.compiled_func = compiled_func
+        self.config = config
+        constexpr_args = compiled_func.execution_args.get_constexpr_args()
+        self.constexpr_names = {arg["argument_name"] for arg in constexpr_args}
+        self.constexpr_indexes = sorted(
+            (arg["argument_index"] for arg in constexpr_args if arg["argument_index"] is not None),
+            reverse=True,
+        )
+
+    def __call__(self, *args: Any, **kwargs: Any) -> Any:
+        args_list = list(args)
+        for index in self.constexpr_indexes:
+            if index < len(args_list):
+                del args_list[index]
+        kwargs = {k: v for k, v in kwargs.items() if k not in self.constexpr_names}
+        return self.compiled_func(*args_list, **kwargs)
+
+
+class autotune:
+    """Decorator autotuning the Constexpr parameters of a ``@cute.jit`` function.
+
+    On the first call with a new problem signature, every combination of
+    ``configs`` is compiled and benchmarked with ``cutlass.testing``'s autotuning benchmark, which flushes
+    the L2 cache before each iteration. Candidates raising ``CantImplementError``,
+    ``ValueError`` or ``TypeError`` are skipped. The fastest configuration is
+    recorded in ``cache`` and its compiled kernel is launched.
+
+    The problem signature is formed from the arguments named in ``key``
+    (all arguments but ``stream_arg`` if omitted), rendering tensors by shape,
+    stride and dtype. The stream never takes part in the signature, since it
+    would tie recorded results to one process.
+    It is combined with the name of the function and the GPU name and compute
+    capability, so results recorded on one GPU are not applied to another.
+
+    :param configs: Parameter names and the values to sweep
+    :type configs: Dict[str, List[Any]]
+    :param key: Names of the arguments forming the problem signature, defaults to all arguments
+    :type key: List[str], optional
+    :param stream_arg: Name of the argument holding the stream the kernel is launched in
+    :type stream_arg: str, optional
+    :param warmup_iterations: Warmup iterations per candidate, defaults to 10
+    :type warmup_iterations: int, optional
+    :param iterations: Timed iterations per candidate, defaults to 100
+    :type iterations: int, optional
+    :param cache: Persistent store of tuned configurations, defaults to ``AutotuneCache()``
+    :type cache: AutotuneCache, optional
+    """
+
+    def __init__(
+        self,
+        configs: Dict[str, List[Any]],
+        key: Optional[List[str]] = None,
+        *,
+        stream_arg: Optional[str] = None,
+        warmup_iterations: int = 10,
+        iterations: int = 100,
+        cache: Optional[AutotuneCache] = None,
+    ) -> None:
+        if not configs:
+            raise ValueError("configs must name at least one parameter to tune")
+        self.configs = configs
+        self.key = key
+        self.stream_arg = stream_arg
+        self.warmup_iterations = warmup_iterations
+        self.iterations = iterations
+        self.cache = cache
+
+    def __call__(self, func: Callable[..., Any]) -> Callable[..., Any]:
+        signature = inspect.signature(func)
+        for name in self.configs:
+            if name not in signature.parameters:
+                raise ValueError(f"{func.__qualname__} has no parameter named {name}")
+
+        cache = self.cache if self.cache is not None else AutotuneCache()
+        tuned: Dict[str, _TunedKernel] = {}
+        tuned_lock = threading.Lock()
+        func_name = f"{func.__module__}.{func.__qualname__}"
+
+        @functools.wraps(func)
+        def wrapper(*args: Any, **kwargs: Any) -> Any:
+            bound = signature.bind_partial(*args, **kwargs).arguments
+            names = self.key if self.key is not None else [
+                name for name in bound if name not in self.configs
+            ]
+            problem = ", ".join(
+                f"{name}={_describe(bound[name])}"
+                for name in names
+                if name in bound and name != self.stream_arg
+            )
+            tuning_key = f"{func_name}|{_device_signature()}|{problem}"
+
+            kernel = tuned.get(tuning_key)
+            if kernel is None:
+                with tuned_lock:
+                    kernel = tuned.get(tuning_key)
+                    if kernel is None:
+                        kernel = self._resolve(func, cache, tuning_key, bound, args, kwargs)
+                        tuned[tuning_key] = kernel
+            return kernel(*args, **kwargs)
+
+        wrapper.__name__ = func.__name__ + "_autotune_wrapper"
+        wrapper.__qualname__ = func.__qualname__ + "_autotune_wrapper"
+        return wrapper
+
+    def _compile(
+        self, func: Callable[..., Any], config: Dict[str, Any], args: Sequence[Any], kwargs: Dict[str, Any]
+    ) -> Any:
+        from cutlass.cute import compile
+
+        with _compile_lock:
+            return compile(func, *args, **{**kwargs, **config})
+
+    def _resolve(
+        self,
+        func: Callable[..., Any],
+        cache: AutotuneCache,
+        tuning_key: str,
+        bound: Dict[str, Any],
+        args: Sequence[Any],
+        kwargs: Dict[str, Any],
+    ) -> _TunedKernel:
+        config = cache.lookup(tuning_key)
+        if config is not None:
+            _logger.info(f"Using recorded configuration {config} for {tuning_key}")
+            return _TunedKernel(self._compile(func, config, args, kwargs), config)
+
+        return self._tune(func, cache, tuning_key, bound, args, kwargs)
+
+    def _tune(
+        self,
+        func: Callable[..., Any],
+        cache: AutotuneCache,
+        tuning_key: str,
+        bound: Dict[str, Any],
+        args: Sequence[Any],
+        kwargs: Dict[str, Any],
+    ) -> _TunedKernel:
+        from cutlass.testing import CantImplementError, _benchmark_for_autotune
+
+        names = list(self.configs.keys())
+        candidates = [
+            dict(zip(names, values)) for values in product(*self.configs.values())
+        ]
+        _logger.info(f"Tuning {len(candidates)} configurations for {tuning_key}")
+        start = time()
+
+        def compile_candidate(config: Dict[str, Any]) -> Any:
+            try:
+                return self._compile(func, config, args, kwargs)
+            except NotImplementedError:
+                raise
+            except Exception as e:
+                return e
+
+        results = [compile_candidate(config) for config in candidates]
+        _logger.info(f"Compiled candidates in {time() - start:.2f} s")
+
+        stream = bound.get(self.stream_arg) if self.stream_arg is not None else None
+
+        best_time = float("inf")
+        best: Optional[_TunedKernel] = None
+        for config, result in zip(candidates, results):
+            if isinstance(result, (CantImplementError, ValueError, TypeError)):
+                _logger.info(f"   {config}: configuration skipped: {result}")
+                continue
+            if isinstance(result, Exception):
+                _logger.info(f"   {config}: compilation error skipped: {result}")
+                continue
+
+            kernel = _TunedKernel(result, config)
+            cur_time = _benchmark_for_autotune(
+                kernel,
+                *args,
+                warmup_iterations=self.warmup_iterations,
+                iterations=self.iterations,
+                use_cold_l2=True,
+                print_verbose=False,
+                current_stream=stream,
+                **kwargs,
+            )
+            _logger.info(f"   {config}: {cur_time} us")
+            if cur_time < best_time:
+                best_time = cur_time
+                best = kernel
+
+        if best is None:
+            raise ValueError(f"No configuration of {tuning_key} could be compiled and run")
+
+        _logger.info(
+            f"Best configuration: {best.config}, execution time: {best_time} us, "
+            f"total tuning time: {time() - start:.2f} s"
+        )
+        cache.store(tuning_key, best.config, best_time)
+        return best
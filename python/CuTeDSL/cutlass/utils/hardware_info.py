@@ -147,6 +147,25 @@ class HardwareInfo:
             )
         )
 
+    def get_device_name(self) -> str:
+        name = self._checkCudaErrors(driver.cuDeviceGetName(256, self.device))
+        return name.split(b"\0", 1)[0].decode()
+
+    def get_compute_capability(self) -> tuple[int, int]:
+        major = self._checkCudaErrors(
+            driver.cuDeviceGetAttribute(
+                driver.CUdevice_attribute.CU_DEVICE_ATTRIBUTE_COMPUTE_CAPABILITY_MAJOR,
+                self.device,
+            )
+        )
+        minor = self._checkCudaErrors(
+            driver.cuDeviceGetAttribute(
+                driver.CUdevice_attribute.CU_DEVICE_ATTRIBUTE_COMPUTE_CAPABILITY_MINOR,
+                self.device,
+            )
+        )
+        return major, minor
+
     def get_device_multiprocessor_count(self) -> int:
         return self._checkCudaErrors(
             driver.cuDeviceGetAttribute(
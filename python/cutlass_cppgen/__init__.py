@@ -81,7 +81,8 @@ def cuda_install_path():
         _CUDA_INSTALL_PATH = os.getenv("CUDA_INSTALL_PATH", _cuda_install_path_from_nvcc())
     return _CUDA_INSTALL_PATH
 
-CACHE_FILE = "compiled_cache.db"
+# Directory of the on-disk kernel cache. It may be shared by concurrent processes.
+CACHE_DIR = os.getenv("CUTLASS_CACHE_DIR", "compiled_cache")
 
 from cutlass_library import (
     DataType,
@@ -248,6 +248,13 @@ def get_gemm_arguments_3x(mainloop_arguments, epilogue_functor, scheduler_args,
             ("max_active_clusters", ctypes.c_int),
             ("cluster_shape", dim3_),
             ("cluster_shape_fallback", dim3_),
+            ("l2_cache_size", ctypes.c_int),
+        ]
+
+    class _L2PrefetchArguments(ctypes.Structure):
+        _fields_ = [
+            ("ptr", ctypes.c_void_p),
+            ("bytes", ctypes.c_size_t),
         ]
 
     class _GemmArguments(ctypes.Structure):
@@ -258,6 +265,8 @@ def get_gemm_arguments_3x(mainloop_arguments, epilogue_functor, scheduler_args,
             ("epilogue", _EpilogueArguments),
             ("hw_info", _HardwareInfo),
             ("scheduler", type(scheduler_args)),
+            # Left zero-initialized, which disables the L2 prefetch
+            ("l2_prefetch", _L2PrefetchArguments),
         ]
 
     return _GemmArguments, _EpilogueArguments, _EpilogueOutputOpParams, _HardwareInfo
@@ -31,9 +31,7 @@
 #################################################################################################
 
 import ctypes
-import json
 import os
-import sqlite3
 import subprocess
 import tempfile
 
@@ -44,8 +42,9 @@ nvrtc = lazy_import("cuda.nvrtc")
 from cutlass_library import SubstituteTemplate
 
 import cutlass_cppgen
-from cutlass_cppgen import CACHE_FILE, CUTLASS_PATH, cuda_install_path, logger
+from cutlass_cppgen import CACHE_DIR, CUTLASS_PATH, cuda_install_path, logger
 from cutlass_cppgen.backend.gemm_operation import GemmOperationUniversal
+from cutlass_cppgen.backend.kernel_cache import KernelCache
 from cutlass_cppgen.backend.library import ApiVersion
 from cutlass_cppgen.backend.utils.device import device_cc
 
@@ -123,34 +122,13 @@ def convertToBinaryData(filename):
     return blobData
 
 
-def CDLLBin(host_binary):
-    tempfile.tempdir = "./"
-    temp_so = tempfile.NamedTemporaryFile(prefix="host_func", suffix=".so", delete=True)
-    with open(temp_so.name, "wb") as file:
-        file.write(host_binary)
-    host_lib = ctypes.CDLL(temp_so.name)
-    return host_lib
-
-
 class ArtifactManager:
     """
     Artifact manager
     """
 
     def __init__(self) -> None:
-        connection = sqlite3.connect(CACHE_FILE)
-        cursor = connection.cursor()
-        # Create the table if it does not already exist
-        sqlite_create_table_query = """
-        CREATE TABLE IF NOT EXISTS compiled_operations(op_key TEXT NOT NULL UNIQUE,
-                                                        cubin BLOB NOT NULL,
-                                                        hostbin BLOB NOT NULL,
-                                                        op_name TEXT NOT NULL,
-                                                        op_attrs TEXT NOT NULL)
-        """
-        cursor.execute(sqlite_create_table_query)
-        connection.commit()
-        cursor.close()
+        self.cache = KernelCache(CACHE_DIR)
 
         self._nvrtc_compile_options = ["-std=c++17", "-default-device"]
         self._nvcc_compile_options = [
@@ -161,6 +139,10 @@ class ArtifactManager:
         self.nvcc()
         self.compiled_cache_device = {}
         self.compiled_cache_host = {}
+        # Modules and host libraries loaded from the disk cache, keyed by path. Operations compiled
+        # together share these, so each is loaded only once per process.
+        self._loaded_modules = {}
+        self._loaded_host_libs = {}
 
     def nvrtc(self):
         self.backend = "nvrtc"
@@ -170,61 +152,54 @@ class ArtifactManager:
         self.backend = "nvcc"
         self.default_compile_options = self._nvcc_compile_options
 
-    def insert_operation(self, op_key, cubin, hostfile, op_name, op_attrs):
-        connection = sqlite3.connect(CACHE_FILE)
-        cursor = connection.cursor()
-        sqlite_insert_blob_query = """ INSERT OR IGNORE INTO compiled_operations (op_key, cubin, hostbin, op_name, op_attrs) VALUES (?, ?, ?, ?, ?)"""
-
-        hostbin = convertToBinaryData(hostfile)
-
-        data_tuple = (op_key, cubin, hostbin, op_name, json.dumps(op_attrs))
-
-        cursor.execute(sqlite_insert_blob_query, data_tuple)
-        connection.commit()
-        cursor.close()
+    def insert_operation(self, op_key, arch, cubin_name, hostbin_name, op_name, op_attrs):
+        self.cache.store(op_key, arch, cubin_name, hostbin_name, op_name, op_attrs)
 
-    def load_operation(self, op_key, extra_funcs):
-        connection = sqlite3.connect(CACHE_FILE)
-        cursor = connection.cursor()
-        sqlite_fetch_blob_query = """SELECT * from compiled_operations where op_key = ?"""
-        cursor.execute(sqlite_fetch_blob_query, (op_key,))
-        record = cursor.fetchall()
-        if len(record) == 0:
+    def load_operation(self, op_key, arch, extra_funcs):
+        entry = self.cache.load(op_key, arch)
+        if entry is None:
             return False
-        for row in record:
-            key, cubin_image, host_binary, operation_name, op_attr = row
-            op_attr = json.loads(op_attr)
-            err, module = cuda.cuModuleLoadData(cubin_image)
+
+        module = self._loaded_modules.get(entry.cubin_path)
+        if module is None:
+            err, module = cuda.cuModuleLoadData(convertToBinaryData(entry.cubin_path))
             if err != cuda.CUresult.CUDA_SUCCESS:
                 raise RuntimeError("Cuda Error: {}".format(err))
+            self._loaded_modules[entry.cubin_path] = module
 
-            err, kernel = cuda.cuModuleGetFunction(module, bytes(str.encode(operation_name)))
-            self.compiled_cache_device[key] = kernel
+        err, kernel = cuda.cuModuleGetFunction(module, bytes(str.encode(entry.op_name)))
+        self.compiled_cache_device[op_key] = kernel
 
-            compiled_host_fns = {}
-            host_lib = CDLLBin(host_binary)
+        host_lib = self._loaded_host_libs.get(entry.hostbin_path)
+        if host_lib is None:
+            host_lib = ctypes.CDLL(entry.hostbin_path)
+            self._loaded_host_libs[entry.hostbin_path] = host_lib
 
-            func_name = operation_name + "_get_params"
-            func = getattr(host_lib, func_name)
-            func.restype = ctypes.POINTER(ctypes.c_char * op_attr[0])
-            compiled_host_fns["get_args"] = func
+        compiled_host_fns = {}
+        operation_name = entry.op_name
+        op_attr = entry.op_attrs
 
-            func_name = operation_name + "_shared_memory_size"
-            func = getattr(host_lib, func_name)
-            compiled_host_fns["shared_memory_capacity"] = func()
+        func_name = operation_name + "_get_params"
+        func = getattr(host_lib, func_name)
+        func.restype = ctypes.POINTER(ctypes.c_char * op_attr[0])
+        compiled_host_fns["get_args"] = func
 
-            for attr in op_attr:
-                if isinstance(attr, str):
-                    func_name = operation_name + "_" + attr
-                    func = getattr(host_lib, func_name)
+        func_name = operation_name + "_shared_memory_size"
+        func = getattr(host_lib, func_name)
+        compiled_host_fns["shared_memory_capacity"] = func()
 
-                    # Set the return type of the function
-                    if attr in extra_funcs and extra_funcs[attr] != None:
-                        func.restype = extra_funcs[attr]
+        for attr in op_attr:
+            if isinstance(attr, str):
+                func_name = operation_name + "_" + attr
+                func = getattr(host_lib, func_name)
 
-                    compiled_host_fns[attr] = func
+                # Set the return type of the function
+                if attr in extra_funcs and extra_funcs[attr] != None:
+                    func.restype = extra_funcs[attr]
 
-            self.compiled_cache_host[key] = compiled_host_fns
+                compiled_host_fns[attr] = func
+
+        self.compiled_cache_host[op_key] = compiled_host_fns
         return True
 
     def emit_compile_(self, operation_list, compilation_options, host_compilation_options):
@@ -374,31 +349,62 @@ class ArtifactManager:
         if compile_options is None:
             compile_options = CompilationOptions(
                 self.default_compile_options, arch, include_paths)
-        # save the cubin
+        # Cache entries are keyed on the architecture the device code is compiled for
+        arch = compile_options.arch
+
+        # Everything besides the emitted source that changes the compiled artifacts
+        key_options = [cutlass_cppgen.__version__, cutlass_cppgen.nvcc_version()] + list(compile_options.flags)
+
         operation_key = []
         operation_list = []
         for operation in operations:
             # step 1: get kernel string as key
-            key = operation.rt_module.emit() + operation.procedural_name() + self.backend
-            # step 1: check if the operation is in cache
-            compiled_kernel = self.compiled_cache_device.get(key)
-
-            if compiled_kernel is None and not bypass_cache:
-                hit = self.load_operation(key, getattr( operation.rt_module, "extra_funcs", {}))
-                if hit:
-                    compiled_kernel = self.compiled_cache_device.get(key)
-                    assert compiled_kernel is not None
-            if compiled_kernel is not None:
-                operation.rt_module.kernel = compiled_kernel
-                compiled_host_fns = self.compiled_cache_host.get(key)
-                assert compiled_host_fns is not None
-                for key in compiled_host_fns.keys():
-                    setattr(operation.rt_module, key, compiled_host_fns[key])
-                operation.rt_module.initialize()
-            else:
+            key = KernelCache.make_key(
+                operation.rt_module.emit() + operation.procedural_name(), arch, self.backend, key_options)
+            # step 2: check if the operation is in cache
+            if not self._attach_cached(operation.rt_module, key, arch, not bypass_cache):
                 operation_list.append(operation.rt_module)
                 operation_key.append(key)
 
+        if len(operation_list) == 0:
+            return
+
+        with self.cache.lock(operation_key):
+            # Another process may have compiled some of the operations while this one waited for their locks
+            if not bypass_cache:
+                remaining = [(op, key) for op, key in zip(operation_list, operation_key)
+                             if not self._attach_cached(op, key, arch, True)]
+                operation_list = [op for op, _ in remaining]
+                operation_key = [key for _, key in remaining]
+            self._compile_and_insert(operation_list, operation_key, arch, compile_options, host_compile_options)
+
+    def _attach_cached(self, rt_module, key, arch, use_disk_cache):
+        """
+        Sets the kernel and host functions of ``rt_module`` from the in-process cache or, if ``use_disk_cache``
+        is set, from the disk cache. Returns whether the operation was found.
+        """
+        compiled_kernel = self.compiled_cache_device.get(key)
+
+        if compiled_kernel is None and use_disk_cache:
+            hit = self.load_operation(key, arch, getattr(rt_module, "extra_funcs", {}))
+            if hit:
+                compiled_kernel = self.compiled_cache_device.get(key)
+                assert compiled_kernel is not None
+        if compiled_kernel is None:
+            return False
+
+        rt_module.kernel = compiled_kernel
+        compiled_host_fns = self.compiled_cache_host.get(key)
+        assert compiled_host_fns is not None
+        for attr in compiled_host_fns.keys():
+            setattr(rt_module, attr, compiled_host_fns[attr])
+        rt_module.initialize()
+        return True
+
+    def _compile_and_insert(self, operation_list, operation_key, arch, compile_options, host_compile_options):
+        """
+        Compiles ``operation_list`` into a single module and records each operation in the caches
+        """
         if len(operation_list) > 0:
             cubin_image, host_lib, host_file = self.emit_compile_(
                 operation_list, compile_options, host_compile_options)
@@ -457,6 +463,9 @@ class ArtifactManager:
                 operation_attr.append(op_attr)
                 self.compiled_cache_host[key] = compiled_host_fns
 
+            # The device image and host library are shared by all operations of the module
+            cubin_name = self.cache.store_object(cubin_image, ".cubin")
+            hostbin_name = self.cache.store_object(convertToBinaryData(host_file.name), ".so")
             for (key, operation_name, operation_attr,) in zip(operation_key, operation_name, operation_attr):
                 self.insert_operation(
-                    key, cubin_image, host_file.name, operation_name, operation_attr)
+                    key, arch, cubin_name, hostbin_name, operation_name, operation_attr)
@@ -0,0 +1,208 @@
+#################################################################################################
+#
+# Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+"""
+Content-addressed on-disk cache of compiled kernels, shared between processes.
+
+The cache directory is laid out as follows:
+
+.. code-block:: text
+
+    <cache_dir>/objects/<sha256>.cubin      device images, named by the hash of their contents
+    <cache_dir>/objects/<sha256>.so         host libraries, named by the hash of their contents
+    <cache_dir>/sm<cc>/<key>.json           entry of an operation compiled for compute capability ``cc``
+    <cache_dir>/locks/<key>.lock            lock taken while the operation is compiled
+
+Entries and objects are written to a temporary file and renamed into place, so a reader never observes
+a partially written file. A process that misses an entry takes its lock before compiling it, and other
+processes missing the same entry wait on that lock and then load the result instead of compiling it again.
+"""
+
+import contextlib
+import hashlib
+import json
+import os
+import tempfile
+
+if os.name == "nt":
+    import msvcrt
+else:
+    import fcntl
+
+
+def _hash(data: bytes) -> str:
+    return hashlib.sha256(data).hexdigest()
+
+
+def _write_atomic(path: str, data: bytes):
+    """
+    Writes ``data`` to ``path`` so that concurrent readers see either no file or the complete file
+    """
+    fd, temp_path = tempfile.mkstemp(dir=os.path.dirname(path), prefix=".tmp")
+    try:
+        with os.fdopen(fd, "wb") as file:
+            file.write(data)
+        os.replace(temp_path, path)
+    except BaseException:
+        os.unlink(temp_path)
+        raise
+
+
+@contextlib.contextmanager
+def _file_lock(path: str):
+    """
+    Holds an exclusive, cross-process lock on ``path`` for the duration of the context
+    """
+    with open(path, "a+b") as file:
+        if os.name == "nt":
+            file.seek(0)
+            # LK_LOCK retries for about ten seconds before failing
+            while True:
+                try:
+                    msvcrt.locking(file.fileno(), msvcrt.LK_LOCK, 1)
+                    break
+                except OSError:
+                    pass
+        else:
+            fcntl.flock(file.fileno(), fcntl.LOCK_EX)
+        try:
+            yield
+        finally:
+            if os.name == "nt":
+                file.seek(0)
+                msvcrt.locking(file.fileno(), msvcrt.LK_UNLCK, 1)
+            else:
+                fcntl.flock(file.fileno(), fcntl.LOCK_UN)
+
+
+class KernelCacheEntry:
+    """
+    Compiled artifacts of a single operation
+    """
+
+    def __init__(self, cubin_path: str, hostbin_path: str, op_name: str, op_attrs: list):
+        self.cubin_path = cubin_path
+        self.hostbin_path = hostbin_path
+        self.op_name = op_name
+        self.op_attrs = op_attrs
+
+
+class KernelCache:
+    """
+    On-disk cache of compiled operations.
+
+    :param cache_dir: directory holding the cache. It may be shared by any number of processes.
+    :type cache_dir: str
+    """
+
+    def __init__(self, cache_dir: str):
+        self.cache_dir = os.path.abspath(cache_dir)
+        self.objects_dir = os.path.join(self.cache_dir, "objects")
+        self.locks_dir = os.path.join(self.cache_dir, "locks")
+        os.makedirs(self.objects_dir, exist_ok=True)
+        os.makedirs(self.locks_dir, exist_ok=True)
+
+    @staticmethod
+    def make_key(source: str, arch: int, backend: str, options: list) -> str:
+        """
+        Returns the key of an operation, which covers everything that affects its compiled artifacts
+
+        :param source: emitted source and procedural name of the operation
+        :type source: str
+        :param arch: compute capability the operation is compiled for
+        :type arch: int
+        :param backend: compiler used for the device code
+        :type backend: str
+        :param options: device compilation options
+        :type options: list
+
+        :rtype: str
+        """
+        material = "\n".join([source, f"sm{arch}", backend] + [str(opt) for opt in options])
+        return _hash(material.encode())
+
+    def _entry_path(self, key: str, arch: int) -> str:
+        return os.path.join(self.cache_dir, f"sm{arch}", key + ".json")
+
+    def load(self, key: str, arch: int):
+        """
+        Returns the entry stored under ``key`` for ``arch``, or ``None`` if there is none
+
+        :rtype: KernelCacheEntry
+        """
+        try:
+            with open(self._entry_path(key, arch), "r") as file:
+                record = json.load(file)
+        except (FileNotFoundError, json.JSONDecodeError):
+            return None
+        cubin_path = os.path.join(self.objects_dir, record["cubin"])
+        hostbin_path = os.path.join(self.objects_dir, record["hostbin"])
+        if not (os.path.isfile(cubin_path) and os.path.isfile(hostbin_path)):
+            return None
+        return KernelCacheEntry(cubin_path, hostbin_path, record["op_name"], record["op_attrs"])
+
+    def store_object(self, data: bytes, suffix: str) -> str:
+        """
+        Stores ``data`` under the hash of its contents and returns the resulting file name
+
+        :rtype: str
+        """
+        name = _hash(data) + suffix
+        path = os.path.join(self.objects_dir, name)
+        if not os.path.isfile(path):
+            _write_atomic(path, data)
+        return name
+
+    def store(self, key: str, arch: int, cubin_name: str, hostbin_name: str, op_name: str, op_attrs: list):
+        """
+        Records an entry for ``key`` that refers to objects previously stored with ``store_object``
+        """
+        path = self._entry_path(key, arch)
+        os.makedirs(os.path.dirname(path), exist_ok=True)
+        record = {
+            "cubin": cubin_name,
+            "hostbin": hostbin_name,
+            "op_name": op_name,
+            "op_attrs": op_attrs,
+        }
+        _write_atomic(path, json.dumps(record).encode())
+
+    @contextlib.contextmanager
+    def lock(self, keys: list):
+        """
+        Holds the locks of all of ``keys`` for the duration of the context. Locks are taken in sorted
+        order so that processes compiling overlapping sets of operations cannot deadlock.
+        """
+        with contextlib.ExitStack() as stack:
+            for key in sorted(set(keys)):
+                stack.enter_context(_file_lock(os.path.join(self.locks_dir, key + ".lock")))
+            yield
@@ -76,6 +76,22 @@ The module can later be used in Python via:
 
     # Run the module
     D = cutlass_gemm.run(A, B, C)
+
+Each ``run`` method accepts an optional ``out`` argument through which a preallocated output
+can be provided. Workspace and the device copies of grouped GEMM arguments are cached per
+CUDA stream, so a steady stream of calls performs no CUDA allocations. Calls may be captured
+into CUDA graphs: work issued during capture draws its device memory from the graph's private
+memory pool, and host data copied to the device during capture is retained so that replays
+remain valid.
+
+.. highlight:: python
+.. code-block:: python
+
+    D = torch.empty((512, 512), device='cuda')
+    graph = torch.cuda.CUDAGraph()
+    with torch.cuda.graph(graph):
+        cutlass_gemm.run(A, B, C, out=D)
+    graph.replay()
 """
 
 import logging
@@ -95,24 +111,103 @@ if is_torch_available():
 
 
 _PYTORCH_CUDA_TEMPLATE = common._CSTYLE_AUTOGEN_COMMENT + """
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
 #include <cuda_runtime.h>
 #include <torch/extension.h>
 #include <ATen/ATen.h>
 #include <ATen/cuda/CUDAContext.h>
+#include <c10/cuda/CUDAGuard.h>
 #include "cutlass/cutlass.h"
 #include "cutlass/util/device_memory.h"
 
-// helper function allocating the memory
-void* device_memory_allocation(size_t size, int device_id=0) {
-    if (size > 0) {
-        torch::Device device(torch::kCUDA, device_id);
-        cudaStream_t stream = at::cuda::getCurrentCUDAStream();
-        torch::TensorOptions options = torch::TensorOptions().dtype(torch::kI8).device(device);
-        at::Tensor device_tensor = torch::empty({(long)size,}, options);
-        return reinterpret_cast<void*>(device_tensor.data_ptr());
+// Returns whether work issued to the stream is being captured into a CUDA graph
+bool stream_is_capturing(cudaStream_t stream) {
+    cudaStreamCaptureStatus capture_status = cudaStreamCaptureStatusNone;
+    C10_CUDA_CHECK(cudaStreamIsCapturing(stream, &capture_status));
+    return capture_status != cudaStreamCaptureStatusNone;
+}
+
+// Device memory reused by every call issued to the same stream. Work on a stream executes
+// in issue order, so a call can overwrite memory read by the previous call on that stream.
+struct StreamCache {
+    at::Tensor workspace;
+    at::Tensor arguments;
+};
+
+std::mutex stream_cache_mutex;
+std::map<std::pair<int, cudaStream_t>, StreamCache> stream_caches;
+
+// Pinned host buffers that copies captured into CUDA graphs read from on every replay
+std::vector<at::Tensor> captured_host_buffers;
+
+// Returns an uninitialized device buffer of at least `size` bytes for use by work issued to
+// `stream` on the current device. Outside of graph capture, the buffer is cached per stream
+// and grows only when a call needs more memory than any previous call. Work captured into a
+// CUDA graph outlives the cache entry, so it is given a buffer from the graph's private pool.
+// The returned tensor must be kept alive until the work using it has been issued.
+at::Tensor stream_buffer(size_t size, cudaStream_t stream, at::Tensor StreamCache::*member) {
+    if (size == 0) {
+        return at::Tensor();
+    }
+
+    torch::TensorOptions options = torch::TensorOptions().dtype(torch::kUInt8).device(torch::kCUDA, at::cuda::current_device());
+    if (stream_is_capturing(stream)) {
+        return torch::empty({(int64_t)size,}, options);
+    }
+
+    std::lock_guard<std::mutex> lock(stream_cache_mutex);
+    at::Tensor& buffer = stream_caches[{at::cuda::current_device(), stream}].*member;
+    if (!buffer.defined() || (size_t)buffer.numel() < size) {
+        buffer = torch::empty({(int64_t)size,}, options);
+    }
+    return buffer;
+}
+
+// Workspace of a kernel launched on `stream`
+at::Tensor stream_workspace(size_t size, cudaStream_t stream) {
+    return stream_buffer(size, stream, &StreamCache::workspace);
+}
+
+void* workspace_ptr(const at::Tensor& workspace) {
+    return workspace.defined() ? workspace.data_ptr() : nullptr;
+}
+
+// Returns a pinned host buffer of at least `size` bytes for staging a copy to the device.
+// Buffers come from PyTorch's caching host allocator, which does not reuse one until the
+// copies recorded against it have completed. Copies captured into a CUDA graph read the
+// buffer again on every replay, so such buffers are retained for the lifetime of the module.
+at::Tensor staging_buffer(size_t size, cudaStream_t stream) {
+    at::Tensor buffer = at::empty({(int64_t)size,}, torch::TensorOptions().dtype(torch::kUInt8).pinned_memory(true));
+    if (stream_is_capturing(stream)) {
+        std::lock_guard<std::mutex> lock(stream_cache_mutex);
+        captured_host_buffers.push_back(buffer);
+    }
+    return buffer;
+}
+
+// Copies the first `size` bytes of a staging buffer to device memory that later calls on `stream` reuse
+at::Tensor upload_arguments(const at::Tensor& host, size_t size, cudaStream_t stream) {
+    at::Tensor device = stream_buffer(size, stream, &StreamCache::arguments);
+    if (stream_is_capturing(stream)) {
+        C10_CUDA_CHECK(cudaMemcpyAsync(device.data_ptr(), host.data_ptr(), size, cudaMemcpyHostToDevice, stream));
     } else {
-        return nullptr;
+        // Records the copy with the caching host allocator so that the staging buffer outlives it
+        device.narrow(0, 0, size).copy_(host.narrow(0, 0, size), /*non_blocking=*/true);
     }
+    return device;
+}
+
+// Checks that a preallocated output matches the tensor the kernel would otherwise allocate
+void check_output(const at::Tensor& out, at::IntArrayRef sizes, at::ScalarType dtype, const at::Device& device,
+                  at::MemoryFormat memory_format = at::MemoryFormat::Contiguous) {
+    TORCH_CHECK(out.sizes() == sizes, "Expected output of size ", sizes, " but got ", out.sizes());
+    TORCH_CHECK(out.scalar_type() == dtype, "Expected output of type ", dtype, " but got ", out.scalar_type());
+    TORCH_CHECK(out.device() == device, "Expected output on ", device, " but got ", out.device());
+    TORCH_CHECK(out.is_contiguous(memory_format), "Expected output in ", memory_format, " memory format");
 }
 
 ${includes}
@@ -126,15 +221,18 @@ _PYTORCH_GEMM_CPP_TEMPLATE = common._CSTYLE_AUTOGEN_COMMENT + """
 #include <pybind11/stl.h>
 
 // CUDA forward declarations
-at::Tensor ${name}_kernel(const at::Tensor& A, const at::Tensor& B, at::optional<const at::Tensor> C=at::nullopt, float alpha=1.f, float beta=0.f);
+at::Tensor ${name}_kernel(const at::Tensor& A, const at::Tensor& B, at::optional<const at::Tensor> C=at::nullopt, float alpha=1.f, float beta=0.f,
+                          at::optional<at::Tensor> out=at::nullopt);
 
 // C++ interface
-at::Tensor ${name}(const at::Tensor& A, const at::Tensor& B, at::optional<const at::Tensor> C=at::nullopt, float alpha=1.f, float beta=0.f) {
-  return ${name}_kernel(A, B, C, alpha, beta);
+at::Tensor ${name}(const at::Tensor& A, const at::Tensor& B, at::optional<const at::Tensor> C=at::nullopt, float alpha=1.f, float beta=0.f,
+                   at::optional<at::Tensor> out=at::nullopt) {
+  return ${name}_kernel(A, B, C, alpha, beta, out);
 }
 
 PYBIND11_MODULE(TORCH_EXTENSION_NAME, m) {
-  m.def("run", py::overload_cast<const at::Tensor&, const at::Tensor&, at::optional<const at::Tensor>, float, float>(&${name}), py::arg("A"), py::arg("B"), py::arg("C") = nullptr, py::arg("alpha") = 1.f, py::arg("beta") = 0.f);
+  m.def("run", py::overload_cast<const at::Tensor&, const at::Tensor&, at::optional<const at::Tensor>, float, float, at::optional<at::Tensor>>(&${name}),
+        py::arg("A"), py::arg("B"), py::arg("C") = nullptr, py::arg("alpha") = 1.f, py::arg("beta") = 0.f, py::arg("out") = nullptr);
 }
 """
 
@@ -144,16 +242,18 @@ _PYTORCH_GROUPED_GEMM_CPP_TEMPLATE = common._CSTYLE_AUTOGEN_COMMENT + """
 #include <pybind11/stl.h>
 
 // CUDA forward declarations
-std::vector<at::Tensor> ${name}_kernel(const std::vector<at::Tensor>& A, const std::vector<at::Tensor>& B, at::optional<const std::vector<at::Tensor>> C=at::nullopt, float alpha=1.f, float beta=0.f);
+std::vector<at::Tensor> ${name}_kernel(const std::vector<at::Tensor>& A, const std::vector<at::Tensor>& B, at::optional<const std::vector<at::Tensor>> C=at::nullopt, float alpha=1.f, float beta=0.f,
+                                       at::optional<const std::vector<at::Tensor>> out=at::nullopt);
 
 // C++ interface
-std::vector<at::Tensor> ${name}(const std::vector<at::Tensor>& A, const std::vector<at::Tensor>& B, at::optional<const std::vector<at::Tensor>> C=at::nullopt, float alpha=1.f, float beta=0.f) {
-  return ${name}_kernel(A, B, C, alpha, beta);
+std::vector<at::Tensor> ${name}(const std::vector<at::Tensor>& A, const std::vector<at::Tensor>& B, at::optional<const std::vector<at::Tensor>> C=at::nullopt, float alpha=1.f, float beta=0.f,
+                                at::optional<const std::vector<at::Tensor>> out=at::nullopt) {
+  return ${name}_kernel(A, B, C, alpha, beta, out);
 }
 
 PYBIND11_MODULE(TORCH_EXTENSION_NAME, m) {
-  m.def("run", py::overload_cast<const std::vector<at::Tensor>&, const std::vector<at::Tensor>&, at::optional<const std::vector<at::Tensor>>, float, float>(&${name}),
-        py::arg("A"), py::arg("B"), py::arg("C") = nullptr, py::arg("alpha") = 1.f, py::arg("beta") = 0.f);
+  m.def("run", py::overload_cast<const std::vector<at::Tensor>&, const std::vector<at::Tensor>&, at::optional<const std::vector<at::Tensor>>, float, float, at::optional<const std::vector<at::Tensor>>>(&${name}),
+        py::arg("A"), py::arg("B"), py::arg("C") = nullptr, py::arg("alpha") = 1.f, py::arg("beta") = 0.f, py::arg("out") = nullptr);
 }
 """
 
@@ -167,26 +267,26 @@ at::Tensor ${name}_kernel(
     const at::Tensor& A, const at::Tensor& B, at::optional<const at::Tensor> C=at::nullopt,
     std::tuple<int, int> stride={1, 1}, std::tuple<int, int> padding={0, 0}, std::tuple<int, int> dilation={1, 1},
     float alpha=1.f, float beta=0.f,
-    std::string split_k_mode="serial", int split_k_slices=1);
+    std::string split_k_mode="serial", int split_k_slices=1, at::optional<at::Tensor> out=at::nullopt);
 
 // C++ interface
 at::Tensor ${name}(
     const at::Tensor& A, const at::Tensor& B, at::optional<const at::Tensor> C=at::nullopt,
     std::tuple<int, int> stride={1, 1}, std::tuple<int, int> padding={0, 0}, std::tuple<int, int> dilation={1, 1},
     float alpha=1.f, float beta=0.f,
-    std::string split_k_mode="serial", int split_k_slices=1) {
-    return ${name}_kernel(A, B, C, stride, padding, dilation, alpha, beta, split_k_mode, split_k_slices);
+    std::string split_k_mode="serial", int split_k_slices=1, at::optional<at::Tensor> out=at::nullopt) {
+    return ${name}_kernel(A, B, C, stride, padding, dilation, alpha, beta, split_k_mode, split_k_slices, out);
 }
 
 PYBIND11_MODULE(TORCH_EXTENSION_NAME, m) {
   m.def("run",
   py::overload_cast<
     const at::Tensor&, const at::Tensor&, at::optional<const at::Tensor>,
-    std::tuple<int, int>, std::tuple<int, int>, std::tuple<int, int>, float, float,  std::string, int>(
+    std::tuple<int, int>, std::tuple<int, int>, std::tuple<int, int>, float, float, std::string, int, at::optional<at::Tensor>>(
         &${name}), py::arg("A"), py::arg("B"), py::arg("C") = nullptr,
         py::arg("stride") = std::make_tuple(1, 1), py::arg("padding") = std::make_tuple(1, 1), py::arg("dilation") = std::make_tuple(1, 1),
         py::arg("alpha") = 1.f, py::arg("beta") = 0.f,
-        py::arg("split_k_mode") = "serial", py::arg("split_k_slices") = 1);
+        py::arg("split_k_mode") = "serial", py::arg("split_k_slices") = 1, py::arg("out") = nullptr);
 }
 """
 
@@ -200,26 +300,26 @@ at::Tensor ${name}_kernel(
     std::tuple<int, int, int, int> result_size, const at::Tensor& A, const at::Tensor& B, at::optional<const at::Tensor> C=at::nullopt,
     std::tuple<int, int> stride={1, 1}, std::tuple<int, int> padding={0, 0}, std::tuple<int, int> dilation={1, 1},
     float alpha=1.f, float beta=0.f,
-    std::string split_k_mode="serial", int split_k_slices=1);
+    std::string split_k_mode="serial", int split_k_slices=1, at::optional<at::Tensor> out=at::nullopt);
 
 // C++ interface
 at::Tensor ${name}(
     std::tuple<int, int, int, int> result_size, const at::Tensor& A, const at::Tensor& B, at::optional<const at::Tensor> C=at::nullopt,
     std::tuple<int, int> stride={1, 1}, std::tuple<int, int> padding={0, 0}, std::tuple<int, int> dilation={1, 1},
     float alpha=1.f, float beta=0.f,
-    std::string split_k_mode="serial", int split_k_slices=1) {
-    return ${name}_kernel(result_size, A, B, C, stride, padding, dilation, alpha, beta, split_k_mode, split_k_slices);
+    std::string split_k_mode="serial", int split_k_slices=1, at::optional<at::Tensor> out=at::nullopt) {
+    return ${name}_kernel(result_size, A, B, C, stride, padding, dilation, alpha, beta, split_k_mode, split_k_slices, out);
 }
 
 PYBIND11_MODULE(TORCH_EXTENSION_NAME, m) {
   m.def("run",
   py::overload_cast<
     std::tuple<int, int, int, int>, const at::Tensor&, const at::Tensor&, at::optional<const at::Tensor>,
-    std::tuple<int, int>, std::tuple<int, int>, std::tuple<int, int>, float, float, std::string, int>(
+    std::tuple<int, int>, std::tuple<int, int>, std::tuple<int, int>, float, float, std::string, int, at::optional<at::Tensor>>(
         &${name}), py::arg("result_size"), py::arg("A"), py::arg("B"), py::arg("C") = nullptr,
         py::arg("stride") = std::make_tuple(1, 1), py::arg("padding") = std::make_tuple(1, 1), py::arg("dilation") = std::make_tuple(1, 1),
         py::arg("alpha") = 1.f, py::arg("beta") = 0.f,
-        py::arg("split_k_mode") = "serial", py::arg("split_k_slices") = 1);
+        py::arg("split_k_mode") = "serial", py::arg("split_k_slices") = 1, py::arg("out") = nullptr);
 }
 """
 
@@ -261,22 +361,35 @@ _CUTLASS_TYPE_TO_TORCH_TYPE = {
 _PYTORCH_GEMM_IMPL_TEMPLATE_2x = (
     common._CUTLASS_KERNEL_RUN_GEMM_2x
     + """
-at::Tensor ${name}_kernel(const at::Tensor& A, const at::Tensor& B, at::optional<const at::Tensor> C, float alpha, float beta) {
+at::Tensor ${name}_kernel(const at::Tensor& A, const at::Tensor& B, at::optional<const at::Tensor> C, float alpha, float beta,
+                          at::optional<at::Tensor> out) {
     int M = A.size(0);
     int N = B.size(1);
     int K = A.size(1);
 
+    const c10::cuda::CUDAGuard device_guard(B.device());
+    cudaStream_t stream = at::cuda::getCurrentCUDAStream();
+
+    // Keeps a contiguous copy of C alive until the kernel has been launched
+    at::Tensor C_contiguous = (C == at::nullopt) ? at::Tensor() : C->contiguous();
     typename DeviceKernel::ElementC* ptrC = (C == at::nullopt) ?
                                             nullptr :
-                                            reinterpret_cast<typename DeviceKernel::ElementC*>(C->contiguous().data_ptr());
-    at::Tensor D = B.new_empty({M, N}, ${torch_type_C});
+                                            reinterpret_cast<typename DeviceKernel::ElementC*>(C_contiguous.data_ptr());
+    at::Tensor D;
+    if (out != at::nullopt) {
+        check_output(*out, {M, N}, ${torch_type_C}, B.device());
+        D = *out;
+    } else {
+        D = B.new_empty({M, N}, ${torch_type_C});
+    }
 
     cutlass::Status status = ${name}_kernel_run(M, N, K,
                                                 reinterpret_cast<typename DeviceKernel::ElementA*>(A.contiguous().data_ptr()),
                                                 reinterpret_cast<typename DeviceKernel::ElementB*>(B.contiguous().data_ptr()),
                                                 ptrC,
-                                                reinterpret_cast<typename DeviceKernel::ElementC*>(D.contiguous().data_ptr()),
-                                                ElementCompute(alpha), ElementCompute(beta));
+                                                reinterpret_cast<typename DeviceKernel::ElementC*>(D.data_ptr()),
+                                                ElementCompute(alpha), ElementCompute(beta),
+                                                stream);
 
     TORCH_CHECK(status == cutlass::Status::kSuccess, "CUTLASS kernel failed");
     return D;
@@ -287,33 +400,52 @@ at::Tensor ${name}_kernel(const at::Tensor& A, const at::Tensor& B, at::optional
 _PYTORCH_GEMM_IMPL_TEMPLATE_3x = (
     common._CUTLASS_KERNEL_RUN_GEMM_3x
     + """
-bool hw_info_queried = false;
-cutlass::KernelHardwareInfo hw_info;
+// Hardware info of each device, queried on first use
+std::map<int, cutlass::KernelHardwareInfo> hw_infos;
+
+const cutlass::KernelHardwareInfo& query_hw_info(int device_id) {
+    std::lock_guard<std::mutex> lock(stream_cache_mutex);
+    auto it = hw_infos.find(device_id);
+    if (it == hw_infos.end()) {
+        cutlass::KernelHardwareInfo hw_info;
+        hw_info.device_id = device_id;
+        hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(device_id);
+        it = hw_infos.emplace(device_id, hw_info).first;
+    }
+    return it->second;
+}
 
-at::Tensor ${name}_kernel(const at::Tensor& A, const at::Tensor& B, at::optional<const at::Tensor> C, float alpha, float beta) {
+at::Tensor ${name}_kernel(const at::Tensor& A, const at::Tensor& B, at::optional<const at::Tensor> C, float alpha, float beta,
+                          at::optional<at::Tensor> out) {
     int M = A.size(0);
     int N = B.size(1);
     int K = A.size(1);
     int L = 1;
 
-    // Query hardware info if we haven't already
-    if (!hw_info_queried) {
-        hw_info.device_id = 0;
-        hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
-    }
+    const c10::cuda::CUDAGuard device_guard(B.device());
+    cudaStream_t stream = at::cuda::getCurrentCUDAStream();
 
+    // Keeps a contiguous copy of C alive until the kernel has been launched
+    at::Tensor C_contiguous = (C == at::nullopt) ? at::Tensor() : C->contiguous();
     typename DeviceKernel::ElementC* ptrC = (C == at::nullopt) ?
                                             nullptr :
-                                            reinterpret_cast<typename DeviceKernel::ElementC*>(C->contiguous().data_ptr());
-    at::Tensor D = B.new_empty({M, N}, ${torch_type_C});
+                                            reinterpret_cast<typename DeviceKernel::ElementC*>(C_contiguous.data_ptr());
+    at::Tensor D;
+    if (out != at::nullopt) {
+        check_output(*out, {M, N}, ${torch_type_C}, B.device());
+        D = *out;
+    } else {
+        D = B.new_empty({M, N}, ${torch_type_C});
+    }
 
     cutlass::Status status = ${name}_kernel_run(M, N, K, L,
                                                 reinterpret_cast<typename DeviceKernel::ElementA*>(A.contiguous().data_ptr()),
                                                 reinterpret_cast<typename DeviceKernel::ElementB*>(B.contiguous().data_ptr()),
                                                 ptrC,
-                                                reinterpret_cast<typename DeviceKernel::ElementC*>(D.contiguous().data_ptr()),
+                                                reinterpret_cast<typename DeviceKernel::ElementC*>(D.data_ptr()),
                                                 ElementCompute(alpha), ElementCompute(beta),
-                                                hw_info);
+                                                query_hw_info(B.device().index()),
+                                                stream);
 
     TORCH_CHECK(status == cutlass::Status::kSuccess, "CUTLASS kernel failed");
     return D;
@@ -325,14 +457,23 @@ at::Tensor ${name}_kernel(const at::Tensor& A, const at::Tensor& B, at::optional
 _PYTORCH_GROUPED_GEMM_IMPL_TEMPLATE = (
     common._CUTLASS_KERNEL_RUN_GROUPED_GEMM_2x
     + """
-std::vector<at::Tensor> ${name}_kernel(const std::vector<at::Tensor>& A, const std::vector<at::Tensor>& B, at::optional<const std::vector<at::Tensor>> C, float alpha, float beta) {
+std::vector<at::Tensor> ${name}_kernel(const std::vector<at::Tensor>& A, const std::vector<at::Tensor>& B, at::optional<const std::vector<at::Tensor>> C, float alpha, float beta,
+                                       at::optional<const std::vector<at::Tensor>> out) {
     size_t num = A.size();
+    TORCH_CHECK(B.size() == num, "Expected ", num, " B operands but got ", B.size());
+    TORCH_CHECK(out == at::nullopt || out->size() == num, "Expected ", num, " outputs but got ", out->size());
+    if (num == 0) {
+        return {};
+    }
+
+    const c10::cuda::CUDAGuard device_guard(B[0].device());
+    cudaStream_t stream = at::cuda::getCurrentCUDAStream();
 
-    // To avoid performing many small cudaMallocs and host-to-device copies,
-    // we serialize the grouped GEMM arguments on the host, allocate one
-    // large chunk of device memory, and perform a single cudaMemcpy to
-    // copy the host data to the device. Allocation overheads could be
-    // avoided by using a memory pool.
+    // To avoid performing many small allocations and host-to-device copies,
+    // we serialize the grouped GEMM arguments into one pinned staging buffer
+    // and perform a single asynchronous copy into device memory that is
+    // cached per stream. Neither buffer is allocated from CUDA in steady state,
+    // and both remain valid for replays when the call is captured into a CUDA graph.
 
     // Calculate the total size of the data to be copied from host to device
     size_t total_size = sizeof(cutlass::gemm::GemmCoord) +
@@ -358,8 +499,8 @@ std::vector<at::Tensor> ${name}_kernel(const std::vector<at::Tensor>& A, const s
     int64_t padding = 8 - (total_size % 8);
     total_size += padding;
 
-    uint8_t* host_data = new uint8_t[total_size];
-    cutlass::DeviceAllocation<uint8_t> device_data(total_size);
+    at::Tensor host_buffer = staging_buffer(total_size, stream);
+    uint8_t* host_data = host_buffer.data_ptr<uint8_t>();
 
     uint8_t* start = host_data;
     cutlass::gemm::GemmCoord* problem_sizes_host = reinterpret_cast<cutlass::gemm::GemmCoord*>(start);
@@ -395,6 +536,10 @@ std::vector<at::Tensor> ${name}_kernel(const std::vector<at::Tensor>& A, const s
     int64_t* ldc_host = reinterpret_cast<int64_t*>(start);
     start += num * sizeof(int64_t);
 
+    // Operands are kept alive until the kernel has been launched, since the
+    // pointers serialized above may refer to contiguous copies of them
+    std::vector<at::Tensor> operands;
+    operands.reserve(3 * num);
     std::vector<at::Tensor> D(num);
 
     bool need_C = (C != at::nullopt) && (beta != 0.f);
@@ -403,40 +548,49 @@ std::vector<at::Tensor> ${name}_kernel(const std::vector<at::Tensor>& A, const s
         int N = B[i].size(1);
         int K = A[i].size(1);
         *(problem_sizes_host + i) = {M, N, K};
-        *(ptr_A_host + i) = reinterpret_cast<typename DeviceKernel::ElementA*>(A[i].contiguous().data_ptr());
-        *(ptr_B_host + i) = reinterpret_cast<typename DeviceKernel::ElementB*>(B[i].contiguous().data_ptr());
+
+        operands.push_back(A[i].contiguous());
+        *(ptr_A_host + i) = reinterpret_cast<typename DeviceKernel::ElementA*>(operands.back().data_ptr());
+        operands.push_back(B[i].contiguous());
+        *(ptr_B_host + i) = reinterpret_cast<typename DeviceKernel::ElementB*>(operands.back().data_ptr());
 
         if (need_C) {
-            *(ptr_C_host + i) = reinterpret_cast<typename DeviceKernel::ElementC*>(C->at(i).contiguous().data_ptr());
+            operands.push_back(C->at(i).contiguous());
+            *(ptr_C_host + i) = reinterpret_cast<typename DeviceKernel::ElementC*>(operands.back().data_ptr());
         }
         else {
             *(ptr_C_host + i) = nullptr;
         }
 
-        D[i] = B[i].new_empty({M, N}, ${torch_type_C});
-        *(ptr_D_host + i) = reinterpret_cast<typename DeviceKernel::ElementC*>(D[i].contiguous().data_ptr());
+        if (out != at::nullopt) {
+            check_output(out->at(i), {M, N}, ${torch_type_C}, B[i].device());
+            D[i] = out->at(i);
+        } else {
+            D[i] = B[i].new_empty({M, N}, ${torch_type_C});
+        }
+        *(ptr_D_host + i) = reinterpret_cast<typename DeviceKernel::ElementC*>(D[i].data_ptr());
 
         *(lda_host + i) = DeviceKernel::LayoutA::packed({M, K}).stride(0);
         *(ldb_host + i) = DeviceKernel::LayoutB::packed({K, N}).stride(0);
         *(ldc_host + i) = DeviceKernel::LayoutC::packed({M, N}).stride(0);
     }
 
-    device_data.copy_from_host(host_data);
+    at::Tensor device_buffer = upload_arguments(host_buffer, total_size, stream);
+    uint8_t* device_data = device_buffer.data_ptr<uint8_t>();
 
     cutlass::Status status = ${name}_kernel_run(
         num,
-        reinterpret_cast<cutlass::gemm::GemmCoord*>(device_data.get()),
-        reinterpret_cast<DeviceKernel::ElementA**>(device_data.get() + ptr_A_offset),
-        reinterpret_cast<DeviceKernel::ElementB**>(device_data.get() + ptr_B_offset),
-        reinterpret_cast<DeviceKernel::ElementC**>(device_data.get() + ptr_C_offset),
-        reinterpret_cast<DeviceKernel::ElementC**>(device_data.get() + ptr_D_offset),
-        reinterpret_cast<int64_t*>(device_data.get() + lda_offset),
-        reinterpret_cast<int64_t*>(device_data.get() + ldb_offset),
-        reinterpret_cast<int64_t*>(device_data.get() + ldc_offset),
-        reinterpret_cast<int64_t*>(device_data.get() + ldc_offset),
-        ElementCompute(alpha), ElementCompute(beta));
-
-    delete[] host_data;
+        reinterpret_cast<cutlass::gemm::GemmCoord*>(device_data),
+        reinterpret_cast<DeviceKernel::ElementA**>(device_data + ptr_A_offset),
+        reinterpret_cast<DeviceKernel::ElementB**>(device_data + ptr_B_offset),
+        reinterpret_cast<DeviceKernel::ElementC**>(device_data + ptr_C_offset),
+        reinterpret_cast<DeviceKernel::ElementC**>(device_data + ptr_D_offset),
+        reinterpret_cast<int64_t*>(device_data + lda_offset),
+        reinterpret_cast<int64_t*>(device_data + ldb_offset),
+        reinterpret_cast<int64_t*>(device_data + ldc_offset),
+        reinterpret_cast<int64_t*>(device_data + ldc_offset),
+        ElementCompute(alpha), ElementCompute(beta),
+        stream);
 
     TORCH_CHECK(status == cutlass::Status::kSuccess, "CUTLASS kernel failed");
     return D;
@@ -445,6 +599,7 @@ std::vector<at::Tensor> ${name}_kernel(const std::vector<at::Tensor>& A, const s
 )
 
 _PYTORCH_CONV2D_IMPL_TEMPLATE_2x = """
+    const c10::cuda::CUDAGuard device_guard(B.device());
     cudaStream_t stream = at::cuda::getCurrentCUDAStream();
 
     cutlass::Status status = ${name}_kernel_run(
@@ -454,7 +609,7 @@ _PYTORCH_CONV2D_IMPL_TEMPLATE_2x = """
         ptrC,
         reinterpret_cast<typename UnderlyingKernel::ElementC*>(D.data_ptr()),
         alpha, beta,
-        split_k_mode, stream, B.device().index());
+        split_k_mode, stream);
 
     TORCH_CHECK(status == cutlass::Status::kSuccess, "CUTLASS kernel failed");
     return D;
@@ -466,7 +621,7 @@ _PYTORCH_CONV2D_FPROP_IMPL_TEMPLATE_2x = (
     + """
 at::Tensor ${name}_kernel(const at::Tensor& A, const at::Tensor& B, at::optional<const at::Tensor> C=at::nullopt,
     std::tuple<int, int> stride={1, 1}, std::tuple<int, int> padding={0, 0}, std::tuple<int, int> dilation={1, 1},
-    float alpha=1.f, float beta=0.f, std::string split_k_mode="serial", int split_k_slices=1) {
+    float alpha=1.f, float beta=0.f, std::string split_k_mode="serial", int split_k_slices=1, at::optional<at::Tensor> out=at::nullopt) {
     int N, H, W, C_, K, R, S, P, Q;
     N = A.size(0);
     C_ = A.size(1);
@@ -494,8 +649,14 @@ at::Tensor ${name}_kernel(const at::Tensor& A, const at::Tensor& B, at::optional
                                             nullptr :
                                             reinterpret_cast<typename UnderlyingKernel::ElementC*>(C->data_ptr());
 
-    torch::TensorOptions options = torch::TensorOptions().dtype(${torch_type_C}).device(B.device()).memory_format(at::MemoryFormat::ChannelsLast);
-    at::Tensor D = torch::zeros({N, K, P, Q}, options);
+    at::Tensor D;
+    if (out != at::nullopt) {
+        check_output(*out, {N, K, P, Q}, ${torch_type_C}, B.device(), at::MemoryFormat::ChannelsLast);
+        D = *out;
+    } else {
+        torch::TensorOptions options = torch::TensorOptions().dtype(${torch_type_C}).device(B.device()).memory_format(at::MemoryFormat::ChannelsLast);
+        D = torch::zeros({N, K, P, Q}, options);
+    }
 """ + _PYTORCH_CONV2D_IMPL_TEMPLATE_2x
 )
 
@@ -505,7 +666,7 @@ _PYTORCH_CONV2D_DGRAD_IMPL_TEMPLATE_2x = (
     + """
 at::Tensor ${name}_kernel(std::tuple<int, int, int, int> input_size, const at::Tensor& A, const at::Tensor& B, at::optional<const at::Tensor> C=at::nullopt,
     std::tuple<int, int> stride={1, 1}, std::tuple<int, int> padding={0, 0}, std::tuple<int, int> dilation={1, 1}, float alpha=1.f, float beta=0.f,
-    std::string split_k_mode="serial", int split_k_slices=1) {
+    std::string split_k_mode="serial", int split_k_slices=1, at::optional<at::Tensor> out=at::nullopt) {
     int N, H, W, C_, K, R, S;
     N = std::get<0>(input_size);
     C_ = std::get<1>(input_size);
@@ -530,8 +691,14 @@ at::Tensor ${name}_kernel(std::tuple<int, int, int, int> input_size, const at::T
                                             nullptr :
                                             reinterpret_cast<typename UnderlyingKernel::ElementC*>(C->data_ptr());
 
-    torch::TensorOptions options = torch::TensorOptions().dtype(${torch_type_C}).device(B.device()).memory_format(at::MemoryFormat::ChannelsLast);
-    at::Tensor D = torch::empty({N, C_, H, W}, options);
+    at::Tensor D;
+    if (out != at::nullopt) {
+        check_output(*out, {N, C_, H, W}, ${torch_type_C}, B.device(), at::MemoryFormat::ChannelsLast);
+        D = *out;
+    } else {
+        torch::TensorOptions options = torch::TensorOptions().dtype(${torch_type_C}).device(B.device()).memory_format(at::MemoryFormat::ChannelsLast);
+        D = torch::empty({N, C_, H, W}, options);
+    }
 """ + _PYTORCH_CONV2D_IMPL_TEMPLATE_2x
 )
 
@@ -541,7 +708,7 @@ _PYTORCH_CONV2D_WGRAD_IMPL_TEMPLATE_2x = (
     + """
 at::Tensor ${name}_kernel(std::tuple<int, int, int, int> weight_size, const at::Tensor& A, const at::Tensor& B, at::optional<const at::Tensor> C=at::nullopt,
     std::tuple<int, int> stride={1, 1}, std::tuple<int, int> padding={0, 0}, std::tuple<int, int> dilation={1, 1}, float alpha=1.f, float beta=0.f,
-    std::string split_k_mode="serial", int split_k_slices=1) {
+    std::string split_k_mode="serial", int split_k_slices=1, at::optional<at::Tensor> out=at::nullopt) {
     int N, H, W, C_, K, R, S;
     K = std::get<0>(weight_size);
     C_ = std::get<1>(weight_size);
@@ -566,8 +733,14 @@ at::Tensor ${name}_kernel(std::tuple<int, int, int, int> weight_size, const at::
                                             nullptr :
                                             reinterpret_cast<typename UnderlyingKernel::ElementC*>(C->data_ptr());
 
-    torch::TensorOptions options = torch::TensorOptions().dtype(${torch_type_C}).device(B.device()).memory_format(at::MemoryFormat::ChannelsLast);
-    at::Tensor D = torch::empty({K, C_, R, S}, options);
+    at::Tensor D;
+    if (out != at::nullopt) {
+        check_output(*out, {K, C_, R, S}, ${torch_type_C}, B.device(), at::MemoryFormat::ChannelsLast);
+        D = *out;
+    } else {
+        torch::TensorOptions options = torch::TensorOptions().dtype(${torch_type_C}).device(B.device()).memory_format(at::MemoryFormat::ChannelsLast);
+        D = torch::empty({K, C_, R, S}, options);
+    }
 """ + _PYTORCH_CONV2D_IMPL_TEMPLATE_2x
 )
 
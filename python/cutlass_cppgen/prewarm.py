@@ -0,0 +1,115 @@
+#################################################################################################
+#
+# Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+"""
+Compiles the kernels listed in a configuration file ahead of time, populating the on-disk kernel cache
+(see ``cutlass_cppgen.CACHE_DIR``) so that later processes sharing the cache never compile them.
+
+The configuration file is a JSON list of kernels, each an object of the form:
+
+.. code-block:: json
+
+    {
+        "op": "Gemm",
+        "element": "f16",
+        "layout": "RowMajor",
+        "element_accumulator": "f32",
+        "tile_description": {"threadblock_shape": [128, 128, 32], "warp_count": [2, 2, 1], "stages": 3},
+        "alignment_A": 8,
+        "alignment_B": 8,
+        "alignment_C": 8
+    }
+
+``op`` names a class in ``cutlass_cppgen.op`` (e.g., ``Gemm``, ``GroupedGemm``, ``Conv2d``). ``tile_description``
+is assigned to the plan's ``tile_description`` property, the ``alignment`` keys are passed to its ``compile`` method,
+and all other keys are passed to its constructor.
+Values of ``element*`` and ``layout*`` keys are names of ``cutlass_cppgen.DataType`` and
+``cutlass_cppgen.LayoutType`` members, respectively.
+
+Example usage:
+
+.. code-block:: bash
+
+    CUTLASS_CACHE_DIR=/shared/cutlass_cache python -m cutlass_cppgen.prewarm kernels.json
+"""
+
+import argparse
+import json
+
+import cutlass_cppgen
+from cutlass_cppgen import DataType, LayoutType, logger
+
+_COMPILE_KEYS = ["alignment_A", "alignment_B", "alignment_C"]
+
+
+def _convert_value(key: str, value):
+    if isinstance(value, str):
+        if key.startswith("element"):
+            return DataType[value]
+        if key.startswith("layout"):
+            return LayoutType[value]
+    return value
+
+
+def prewarm(config_file: str) -> int:
+    """
+    Compiles every kernel listed in ``config_file``
+
+    :param config_file: path to the JSON configuration file
+    :type config_file: str
+
+    :return: number of kernels compiled or loaded from the cache
+    :rtype: int
+    """
+    with open(config_file, "r") as file:
+        kernels = json.load(file)
+
+    for idx, kernel in enumerate(kernels):
+        kernel = dict(kernel)
+        op_class = getattr(cutlass_cppgen.op, kernel.pop("op"))
+        tile_description = kernel.pop("tile_description", None)
+        compile_args = {key: kernel.pop(key) for key in _COMPILE_KEYS if key in kernel}
+        plan = op_class(**{key: _convert_value(key, value) for key, value in kernel.items()})
+        # The setter completes a partially specified tile description from the plan's defaults
+        plan.tile_description = tile_description
+        operation = plan.compile(**compile_args)
+        logger.info(f"Prewarmed kernel {idx}: {operation.procedural_name()}")
+
+    return len(kernels)
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Compiles CUTLASS kernels into the on-disk kernel cache")
+    parser.add_argument("config_file", help="JSON file listing the kernels to compile")
+    args = parser.parse_args()
+    count = prewarm(args.config_file)
+    print(f"Prewarmed {count} kernels into '{cutlass_cppgen.CACHE_DIR}'")
@@ -285,6 +285,34 @@ class EmitConv2dInstance:
   >::Kernel;
 """
 
+    self.template_winograd = """
+  // Conv2d${conv_kind_name} ${iterator_algorithm_name} kernel instance "${operation_name}"
+  using ${operation_name}_base =
+  typename cutlass::conv::kernel::DefaultConv2d${conv_kind_name}Winograd<
+    ${element_a},
+    ${layout_a},
+    ${element_b},
+    ${layout_b},
+    ${element_c},
+    ${layout_c},
+    ${element_accumulator},
+    ${opcode_class},
+    ${arch},
+    cutlass::gemm::GemmShape<${threadblock_shape_m}, ${threadblock_shape_n}, ${threadblock_shape_k}>,
+    cutlass::gemm::GemmShape<${warp_shape_m}, ${warp_shape_n}, ${warp_shape_k} >,
+    cutlass::gemm::GemmShape<${instruction_shape_m}, ${instruction_shape_n}, ${instruction_shape_k}>,
+    ${epilogue_functor}<
+      ${element_c},
+      1,
+      ${element_accumulator},
+      ${element_epilogue}
+    >,
+    ${output_tile},
+    ${math_operator},
+    ${align_a}
+  >::Kernel;
+"""
+
   def arch_number_to_type(self, arch: int):
     return f"cutlass::arch::Sm{arch}"
 
@@ -338,6 +366,11 @@ class EmitConv2dInstance:
       'align_b': str(operation.B.alignment),
     }
 
+    if operation.iterator_algorithm == IteratorAlgorithm.Winograd:
+      _LOGGER.debug("***   iterator_algorithm=Winograd")
+      values['output_tile'] = str(operation.tile_description.output_tile)
+      return SubstituteTemplate(self.template_winograd, values)
+
     if operation.group_mode == GroupMode.NoneGroup:
       _LOGGER.debug("***   group_mode=NoneGroup")
       return SubstituteTemplate(self.template, values)
@@ -502,7 +535,7 @@ ${stub_end}
     _LOGGER.debug('***   configuration_path (file to write): ' +
                   str(self.configuration_path))
     _LOGGER.debug('***   configuration_name: ' + self.configuration_name)
-    self.configuration_file = open(self.configuration_path, "w")
+    self.configuration_file = GeneratedFile(self.configuration_path)
 
     self.configuration_file.write(SubstituteTemplate(self.header_template, {
       'configuration_name': self.configuration_name
@@ -596,6 +629,9 @@ ${stub_end}
       if operation.group_mode == GroupMode.Depthwise:
         kernel_name = 'DirectConvolution'
         operation_wrapper = 'DirectConv2dOperation'
+      elif operation.iterator_algorithm == IteratorAlgorithm.Winograd:
+        kernel_name = 'WinogradConvolution'
+        operation_wrapper = 'Conv2dOperation'
       else:
         kernel_name = 'ImplicitGemmConvolution'
         operation_wrapper = 'Conv2dOperation'
@@ -289,6 +289,8 @@ class GemmOperation:
 
     if self.mixed_input_mode != None:
       extended_name = extended_name + self.mixed_input_mode_name()
+    if isinstance(self.epilogue_functor, EpilogueFunctor3x):
+      extended_name = extended_name + EpilogueFunctor3xSuffixes.get(self.epilogue_functor, "")
     return extended_name
 
   def datatype_name_3x(self):
@@ -828,6 +830,15 @@ class EmitGemmUniversal3xInstance:
       ${element_epilogue}
     >"""
 
+    self.per_row_col_scale_epilogue_functor_template = \
+"""${epilogue_functor}<
+      ${element_d},
+      ${element_epilogue},
+      ${element_epilogue},
+      ${element_c},
+      ${element_epilogue}
+    >"""
+
     self.gemm_template = """
 
 using ${operation_name}_epilogue =
@@ -978,6 +989,9 @@ ${compile_guard_end}
         'epilogue_functor': EpilogueFunctor3xTag[operation.epilogue_functor],
       }
       epilogue_functor = SubstituteTemplate(self.builtin_epilogue_functor_template, values)
+
+      if operation.epilogue_functor == EpilogueFunctor3x.LinCombPerRowScalePerColScale:
+        epilogue_functor = SubstituteTemplate(self.per_row_col_scale_epilogue_functor_template, values)
       
       if is_block_scaled(operation.gemm_kind) and operation.ScaleFactorD.element != DataType.void:
         epilogue_functor =  self.emit_block_scale_epilogue_functor(operation)
@@ -1562,7 +1576,7 @@ void initialize_${configuration_name}(Manifest &manifest) {
     _LOGGER.debug("***   configuration_path (file to write): " +
                   str(self.configuration_path))
 
-    self.configuration_file = open(self.configuration_path, "w")
+    self.configuration_file = GeneratedFile(self.configuration_path)
     self.configuration_file.write(self.header_template)
     self.configuration_file.write(self.separator)
 
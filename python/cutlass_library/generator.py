@@ -470,6 +470,48 @@ def CreateRankKOperator(manifest, layouts, fill_modes, tile_descriptions, data_t
 
   return operations
 
+#
+def CreateRankK3xOperator(manifest, layouts, fill_modes, tile_descriptions, data_type, \
+  alignment_constraints, schedules, blas_mode = BlasMode.symmetric):
+
+  element_a, element_c, element_epilogue = data_type
+
+  operations = []
+
+  # by default, only generate the largest tile and largest alignment
+  if manifest.kernel_filter == '':
+    tile_descriptions = [tile_descriptions[0],]
+    alignment_constraints = [alignment_constraints[0],]
+
+  for layout in layouts:
+    for fill_mode in fill_modes:
+      for tile_description, (kernel_schedule, epilogue_schedule) in zip(tile_descriptions, schedules):
+        for alignment in alignment_constraints:
+
+          # The epilogue stores C with TMA, which requires 16B alignment
+          alignment_c = 128 // DataTypeSize[element_c]
+
+          A = TensorDescription(element_a, layout[0], alignment)
+          C = SymmetricTensorDescription(element_c, layout[1], fill_mode, alignment_c)
+
+          # Rank-K update
+          new_operation = RankKOperation(RankKKind.Universal3x, tile_description.minimum_compute_capability, \
+            tile_description, A, C, element_epilogue, blas_mode = blas_mode, \
+            kernel_schedule = kernel_schedule, epilogue_schedule = epilogue_schedule)
+
+          manifest.append(new_operation)
+          operations.append(new_operation)
+
+          # Rank-2K update
+          new_operation = Rank2KOperation(RankKKind.Universal3x, tile_description.minimum_compute_capability, \
+            tile_description, A, C, element_epilogue, blas_mode = blas_mode, \
+            kernel_schedule = kernel_schedule, epilogue_schedule = epilogue_schedule)
+
+          manifest.append(new_operation)
+          operations.append(new_operation)
+
+  return operations
+
 #
 def CreateTrmmOperator(manifest, layouts, side_modes, fill_modes, diag_types, tile_descriptions, data_type, \
   alignment_constraints, complex_transforms = None, epilogue_functor = EpilogueFunctor.LinearCombination, \
@@ -770,6 +812,33 @@ def CreateConv2dFewChannelsOperator(manifest, layout, tile_descriptions, data_ty
 
   return operations
 
+# Convolution for 2D fprop operations implemented with Winograd minimal filtering (3x3, unit stride)
+def CreateConv2dWinogradOperator(manifest, layout, tile_descriptions, data_type, alignment_constraints, \
+  epilogue_functor = EpilogueFunctor.LinearCombination):
+
+  element_a, element_b, element_c, element_epilogue = data_type
+
+  # by default, only generate the largest alignment
+  if manifest.kernel_filter == '':
+    alignment_constraints = [alignment_constraints[0],]
+
+  operations = []
+
+  for tile in tile_descriptions:
+    for alignment in alignment_constraints:
+
+      A = TensorDescription(element_a, layout[0], alignment)
+      B = TensorDescription(element_b, layout[1], alignment)
+      C = TensorDescription(element_c, layout[2], 1)
+
+      new_operation = Conv2dOperation(ConvKind.Fprop, IteratorAlgorithm.Winograd, tile.minimum_compute_capability, tile,\
+        A, B, C, element_epilogue, StrideSupport.Unity, epilogue_functor)
+
+      manifest.append(new_operation)
+      operations.append(new_operation)
+
+  return operations
+
 # Convolution for 3D operations
 def CreateConv3dOperator(manifest, layout, tile_descriptions, data_type, alignment, \
   conv_kinds = [ConvKind.Fprop, ConvKind.Dgrad, ConvKind.Wgrad], epilogue_functor = EpilogueFunctor.LinearCombination):
@@ -2636,6 +2705,46 @@ def GenerateSM80_PlanarComplexTensorOp_16816(manifest, cuda_version):
       CreateGemmPlanarComplexOperator(manifest, layouts, tile_descriptions, \
         data_type_mixed, alignment_constraints, complex_transforms)
 
+#
+def GenerateSM80_TensorOp_16816_winograd(manifest, cuda_version):
+
+  if not CudaToolkitVersionSatisfies(cuda_version, 11, 0):
+    return
+
+  math_instructions = [
+    MathInstruction(                                  \
+      [16, 8, 16],                                    \
+      DataType.f16, DataType.f16, DataType.f32,       \
+      OpcodeClass.TensorOp,                           \
+      MathOperation.multiply_add),
+    MathInstruction(                                  \
+      [16, 8, 16],                                    \
+      DataType.bf16, DataType.bf16, DataType.f32,     \
+      OpcodeClass.TensorOp,                           \
+      MathOperation.multiply_add),
+  ]
+
+  min_cc = 80
+  max_cc = 1024
+
+  alignment_constraints = [8, 4, 2]
+
+  for math_inst in math_instructions:
+    tile_descriptions = [
+      WinogradTileDescription([32, 32, 16], 2, [2, 2, 1], math_inst, min_cc, max_cc),
+      WinogradTileDescription([16, 32, 16], 4, [1, 4, 1], math_inst, min_cc, max_cc),
+    ]
+
+    data_type = [
+      math_inst.element_a,
+      math_inst.element_b,
+      math_inst.element_accumulator,
+      math_inst.element_accumulator,
+    ]
+
+    conv_layout = (LayoutType.TensorNHWC, LayoutType.TensorNHWC, LayoutType.TensorNHWC)
+    CreateConv2dWinogradOperator(manifest, conv_layout, tile_descriptions, data_type, alignment_constraints)
+
 #
 def GenerateSM80_TensorOp_16816_mixed_input_upcast_a(manifest, cuda_version):
 
@@ -4908,6 +5017,7 @@ def GenerateSM80_Simt_complex(manifest, cuda_version):
 #
 def GenerateSM80(manifest, cuda_version):
   GenerateSM80_TensorOp_16816(manifest, cuda_version)
+  GenerateSM80_TensorOp_16816_winograd(manifest, cuda_version)
   GenerateSM80_SparseTensorOp_16832(manifest, cuda_version)
   GenerateSM80_PlanarComplexTensorOp_16816(manifest, cuda_version)
   GenerateSM80_TensorOp_1688(manifest, cuda_version)
@@ -5362,6 +5472,73 @@ def GenerateSM90_TensorOp_16b_WGMMA_alignx_gemm(manifest, cuda_version):
                                               stream_k_schedules,
                                               tile_schedulers=[TileSchedulerType.StreamK])
 
+# Skinny GEMMs for small M (e.g. LLM decode). Library clients compute D = A * B with M <= 16 as
+# D^T = B^T * A^T, which maps the small dimension onto a narrow CTA tile N and the large one onto
+# the 64- or 128-row WGMMA tile. The transpose of a column-major D is row-major, hence the row-major
+# C layouts below. Clusters along M multicast the shared narrow operand, and split-K is provided
+# by the stream-K scheduler.
+def GenerateSM90_TensorOp_16b_WGMMA_small_n_gemm(manifest, cuda_version):
+  if not CudaToolkitVersionSatisfies(cuda_version, 12, 1):
+    return
+
+  # layouts for ABC and their alignments.
+  layouts = [
+    [[LayoutType.RowMajor,    8], [LayoutType.ColumnMajor, 8], [LayoutType.RowMajor, 8]],
+    [[LayoutType.RowMajor,    8], [LayoutType.RowMajor,    8], [LayoutType.RowMajor, 8]],
+    [[LayoutType.ColumnMajor, 8], [LayoutType.ColumnMajor, 8], [LayoutType.RowMajor, 8]],
+    [[LayoutType.ColumnMajor, 8], [LayoutType.RowMajor,    8], [LayoutType.RowMajor, 8]],
+  ]
+
+  math_instructions = [
+    MathInstruction(
+      [64, 16, 16],
+      DataType.f16, DataType.f16, DataType.f32,
+      OpcodeClass.TensorOp,
+      MathOperation.multiply_add),
+    MathInstruction(
+      [64, 16, 16],
+      DataType.bf16, DataType.bf16, DataType.f32,
+      OpcodeClass.TensorOp,
+      MathOperation.multiply_add),
+  ]
+
+  min_cc = 90
+  max_cc = 90
+
+  # Narrow tiles only need TMA epilogues: they tolerate the ragged extent along N.
+  data_parallel_schedules = [
+    [KernelScheduleType.TmaWarpSpecializedPingpong, EpilogueScheduleType.TmaWarpSpecialized],
+    [KernelScheduleType.TmaWarpSpecialized, EpilogueScheduleType.TmaWarpSpecialized],
+  ]
+  stream_k_schedules = [
+    [KernelScheduleType.TmaWarpSpecializedCooperative, EpilogueScheduleType.TmaWarpSpecializedCooperative],
+  ]
+
+  for math_inst in math_instructions:
+    math_inst_stub = copy.deepcopy(math_inst)
+    math_inst_stub.instruction_shape = [0, 0, 0]
+
+    data_types = [
+      generate_data_types_from_math_instruction(
+        math_inst,
+        element_source=math_inst.element_a,
+        element_dest=math_inst.element_a),
+      generate_data_types_from_math_instruction(
+        math_inst,
+        element_source=DataType.void,
+        element_dest=math_inst.element_a),
+    ]
+
+    for cluster_shape in [[1, 1, 1], [2, 1, 1]]:
+      data_parallel_tile = TileDescription([64, 16, 128], 0, [4, 1, 1], math_inst_stub, min_cc, max_cc, cluster_shape)
+      stream_k_tile = TileDescription([128, 16, 128], 0, [4, 1, 1], math_inst_stub, min_cc, max_cc, cluster_shape)
+
+      for layout, data_type in product(layouts, data_types):
+        CreateGemmUniversal3xOperator(manifest, [layout], [data_parallel_tile], data_type, data_parallel_schedules)
+        CreateGemmUniversal3xOperator(manifest, [layout], [stream_k_tile], data_type, stream_k_schedules,
+                                      tile_schedulers=[TileSchedulerType.StreamK])
+
+
 def GenerateSM90_SparseTensorOp_16b_WGMMA_gemm(manifest, cuda_version):
   if not CudaToolkitVersionSatisfies(cuda_version, 12, 2):
     return
@@ -5648,6 +5825,40 @@ def GenerateSM90_TensorOp_int8_WGMMA_gemm(manifest, cuda_version):
                                               stream_k_schedules,
                                               tile_schedulers=[TileSchedulerType.StreamK])
 
+    # INT8 inference kernels dequantizing the s32 accumulator with per-token (row) and
+    # per-channel (column) scales straight to 16-bit outputs
+    if math_inst.element_a != DataType.s8:
+      continue
+
+    data_types_dequant = [
+      generate_data_types_from_math_instruction(
+        math_inst,
+        element_source=DataType.void,
+        element_dest=element_dest,
+        element_epilogue=DataType.f32
+      )
+      for element_dest in [DataType.bf16, DataType.f16]
+    ]
+
+    for layout in layouts:
+        for data_type in data_types_dequant:
+            layout = fix_alignments(data_type, layout, alignment_bits=128)
+
+            schedules, _ = get_valid_schedules(
+              tile_description=tile_desc,
+              cuda_version=cuda_version,
+              is_aligned=is_aligned,
+              data_types=data_type,
+              instantiation_level=instantiation_level,
+              layout=layout,
+            )
+            # The scale broadcasts are fusion callbacks of the TMA epilogues
+            schedules = [schedule for schedule in schedules if is_tma_epilogue(schedule[1])]
+
+            if len(schedules):
+              CreateGemmUniversal3xOperator(manifest, [layout], [tile_desc], data_type, schedules,
+                                            epilogue_functor=EpilogueFunctor3x.LinCombPerRowScalePerColScale)
+
 
 def GenerateSM90_TensorOp_int8_WGMMA_alignx_gemm(manifest, cuda_version):
   if not CudaToolkitVersionSatisfies(cuda_version, 12, 0):
@@ -6330,6 +6541,56 @@ def GenerateSM90_TensorOp_1684_rank_k(manifest, cuda_version):
     data_type, alignment_constraints, BlasMode.symmetric)
 #
 
+#
+def GenerateSM90_TensorOp_16b_WGMMA_rank_k(manifest, cuda_version):
+
+  if not CudaToolkitVersionSatisfies(cuda_version, 12, 0):
+    return
+
+  layouts = [
+    (LayoutType.RowMajor, LayoutType.ColumnMajor),
+    (LayoutType.ColumnMajor, LayoutType.ColumnMajor),
+  ]
+
+  fill_modes = [
+    FillMode.Lower, FillMode.Upper,
+  ]
+
+  math_instructions = [
+    MathInstruction(
+      [64, 128, 16],
+      DataType.f16, DataType.f16, DataType.f32,
+      OpcodeClass.TensorOp,
+      MathOperation.multiply_add),
+    MathInstruction(
+      [64, 128, 16],
+      DataType.bf16, DataType.bf16, DataType.f32,
+      OpcodeClass.TensorOp,
+      MathOperation.multiply_add),
+  ]
+
+  min_cc = 90
+  max_cc = 90
+
+  alignment_constraints = [8,]
+
+  # The triangular tile scheduler requires square cluster tiles
+  schedules = [
+    (KernelScheduleType.TmaWarpSpecializedCooperative, EpilogueScheduleType.TmaWarpSpecializedCooperative),
+    (KernelScheduleType.TmaWarpSpecializedPingpong, EpilogueScheduleType.TmaWarpSpecialized),
+  ]
+
+  for math_inst in math_instructions:
+    tile_descriptions = [
+      TileDescription([128, 128, 64], 0, [4, 1, 1], math_inst, min_cc, max_cc, [1, 1, 1]),
+      TileDescription([64, 128, 64], 0, [4, 1, 1], math_inst, min_cc, max_cc, [2, 1, 1]),
+    ]
+
+    data_type = [math_inst.element_a, DataType.f32, DataType.f32]
+
+    CreateRankK3xOperator(manifest, layouts, fill_modes, tile_descriptions, \
+      data_type, alignment_constraints, schedules, BlasMode.symmetric)
+
 #
 def GenerateSM90_TensorOp_1684_rank_k_complex(manifest, cuda_version):
 
@@ -9820,6 +10081,29 @@ def GenerateSM100_TensorOp_int8_UMMA_gemm(manifest, cuda_version):
         [[KernelScheduleType.TmaWarpSpecialized1SmSm100, EpilogueScheduleType.TmaWarpSpecialized1Sm]],
         tile_schedulers=tile_schedulers)
 
+    # INT8 inference kernels dequantizing with per-token (row) and per-channel (column) scales
+    data_types_dequant = [
+      {
+        "a_type"   : math_inst.element_a,
+        "b_type"   : math_inst.element_b,
+        "c_type"   : DataType.void,
+        "d_type"   : element_dest,
+        "acc_type" : math_inst.element_accumulator,
+        "epi_type" : epi_type,
+      }
+      for element_dest in [DataType.bf16, DataType.f16]
+    ]
+    # Activations are row-major and weights column-major (TN) in quantized inference
+    layouts_dequant = [layout for layout in layouts
+                       if layout[0][0] == LayoutType.RowMajor and layout[1][0] == LayoutType.ColumnMajor]
+    # Set alignment d based on Destination format.
+    for layout in layouts_dequant:
+      layout[2][1] = 128 // DataTypeSize[data_types_dequant[0]["d_type"]]
+
+    CreateGemmUniversal3xOperator(manifest, layouts_dequant, tile_descriptions, data_types_dequant,
+      [[KernelScheduleType.TmaWarpSpecialized1SmSm100, EpilogueScheduleType.TmaWarpSpecialized1Sm]],
+      epilogue_functor=EpilogueFunctor3x.LinCombPerRowScalePerColScale)
+
   # 2xSM MMA kernels
   math_instructions_2sm = [
     MathInstruction(
@@ -9922,6 +10206,29 @@ def GenerateSM100_TensorOp_int8_UMMA_gemm(manifest, cuda_version):
       CreateGemmUniversal3xOperator(manifest, layouts, tile_descriptions, data_types_mixed,
         [[KernelScheduleType.TmaWarpSpecialized2SmSm100, epi_schedule]], tile_schedulers=tile_schedulers)
 
+    # INT8 inference kernels dequantizing with per-token (row) and per-channel (column) scales
+    data_types_dequant = [
+      {
+        "a_type"   : math_inst.element_a,
+        "b_type"   : math_inst.element_b,
+        "c_type"   : DataType.void,
+        "d_type"   : element_dest,
+        "acc_type" : math_inst.element_accumulator,
+        "epi_type" : epi_type,
+      }
+      for element_dest in [DataType.bf16, DataType.f16]
+    ]
+    # Activations are row-major and weights column-major (TN) in quantized inference
+    layouts_dequant = [layout for layout in layouts
+                       if layout[0][0] == LayoutType.RowMajor and layout[1][0] == LayoutType.ColumnMajor]
+    # Set alignment d based on Destination format.
+    for layout in layouts_dequant:
+      layout[2][1] = 128 // DataTypeSize[data_types_dequant[0]["d_type"]]
+
+    CreateGemmUniversal3xOperator(manifest, layouts_dequant, tile_descriptions, data_types_dequant,
+      [[KernelScheduleType.TmaWarpSpecialized2SmSm100, epi_schedule]],
+      epilogue_functor=EpilogueFunctor3x.LinCombPerRowScalePerColScale)
+
 
 def GenerateSM100_SparseTensorOp_32b_UMMA_gemm(manifest, cuda_version):
   if not CudaToolkitVersionSatisfies(cuda_version, 12, 0):
@@ -10647,10 +10954,12 @@ def GenerateSM100_SparseTensorOp_mixed_8bits_UMMA_gemm(manifest, cuda_version):
 
 
 # SM100 Interleaved Complex Tf32 Kernels
-def GenerateSM100_TensorOp_32b_UMMA_gemm_complex(manifest, cuda_version):
-  if not CudaToolkitVersionSatisfies(cuda_version, 12, 0):
+def GenerateSM100_TensorOp_32b_UMMA_gemm_complex(manifest, cuda_version, gemm_kind=GemmKind.Universal3x):
+  if not CudaToolkitVersionSatisfies(cuda_version, 12, 3 if is_grouped(gemm_kind) else 0):
     return
 
+  grouped = is_grouped(gemm_kind)
+
   # layouts for ABC and their alignments.
   layouts = [
     [[LayoutType.ColumnMajor, 2], [LayoutType.ColumnMajor, 2], [LayoutType.ColumnMajor, 2]],
@@ -10713,9 +11022,10 @@ def GenerateSM100_TensorOp_32b_UMMA_gemm_complex(manifest, cuda_version):
                           , DynamicClusterShape
                          ]                     
 
+  # Grouped kernels always use the group tile scheduler
   tile_schedulers = [
     TileSchedulerType.Default, TileSchedulerType.StreamK
-  ]
+  ] if not grouped else [TileSchedulerType.Default]
 
   # 1xSM MMA kernels
   for math_inst in math_instructions_1sm:
@@ -10730,9 +11040,10 @@ def GenerateSM100_TensorOp_32b_UMMA_gemm_complex(manifest, cuda_version):
           0, [4, 1, 1], math_inst, min_cc, max_cc, cluster_shape))
 
     CreateGemmUniversal3xOperator(manifest, layouts, tile_descriptions, data_types,
-      [[KernelScheduleType.InterleavedComplexTF32TmaWarpSpecialized1SmSm100, EpilogueScheduleType.NoSmemWarpSpecialized1Sm]],
+      [[to_grouped_schedule(KernelScheduleType.InterleavedComplexTF32TmaWarpSpecialized1SmSm100, grouped),
+        to_grouped_schedule(EpilogueScheduleType.NoSmemWarpSpecialized1Sm, grouped)]],
       complex_transforms,
-      tile_schedulers=tile_schedulers)
+      tile_schedulers=tile_schedulers, gemm_kind=gemm_kind)
 
   # 2xSM MMA kernels
   math_instructions_2sm = [
@@ -10765,9 +11076,10 @@ def GenerateSM100_TensorOp_32b_UMMA_gemm_complex(manifest, cuda_version):
           0, [4, 1, 1], math_inst, min_cc, max_cc, cluster_shape))
 
     CreateGemmUniversal3xOperator(manifest, layouts, tile_descriptions, data_types,
-      [[KernelScheduleType.InterleavedComplexTF32TmaWarpSpecialized2SmSm100, EpilogueScheduleType.NoSmemWarpSpecialized2Sm]],
+      [[to_grouped_schedule(KernelScheduleType.InterleavedComplexTF32TmaWarpSpecialized2SmSm100, grouped),
+        to_grouped_schedule(EpilogueScheduleType.NoSmemWarpSpecialized2Sm, grouped)]],
       complex_transforms,
-      tile_schedulers=tile_schedulers)
+      tile_schedulers=tile_schedulers, gemm_kind=gemm_kind)
 
 def GenerateSM100_TensorOp_FastF32_UMMA_gemm_complex_stream_k(manifest, cuda_version):
   if not CudaToolkitVersionSatisfies(cuda_version, 12, 0):
@@ -10870,6 +11182,66 @@ def GenerateSM100_TensorOp_FastF32_UMMA_gemm_complex_stream_k(manifest, cuda_ver
       complex_transforms,
       tile_schedulers=tile_schedulers)
 
+# DGEMM emulated with INT8 UMMAs on FP64 operands split into 7-bit slices (Ozaki scheme)
+def GenerateSM100_TensorOp_OzakiF64_UMMA_gemm(manifest, cuda_version):
+  if not CudaToolkitVersionSatisfies(cuda_version, 12, 8):
+    return
+
+  # layouts for ABC and their alignments.
+  layouts = [
+    [[LayoutType.ColumnMajor, 2], [LayoutType.ColumnMajor, 2], [LayoutType.ColumnMajor, 2]],
+    [[LayoutType.ColumnMajor, 2], [LayoutType.RowMajor,    2], [LayoutType.ColumnMajor, 2]],
+    [[LayoutType.RowMajor,    2], [LayoutType.ColumnMajor, 2], [LayoutType.ColumnMajor, 2]],
+    [[LayoutType.RowMajor,    2], [LayoutType.RowMajor,    2], [LayoutType.ColumnMajor, 2]],
+  ]
+
+  data_types = [
+    {
+      "a_type"   : DataType.f64,
+      "b_type"   : DataType.f64,
+      "c_type"   : DataType.f64,
+      "d_type"   : DataType.f64,
+      "acc_type" : DataType.f64,
+      "epi_type" : DataType.f64,
+    }
+  ]
+
+  min_cc = 100
+  max_cc = 100
+
+  math_instructions_1sm = [
+    MathInstruction(
+      [128, 32, 32],
+      DataType.s8, DataType.s8, DataType.f64,
+      OpcodeClass.TensorOp,
+      MathOperation.multiply_add),
+  ]
+
+  cluster_shapes_1sm = [
+    [1,1,1], [2,1,1]
+    , DynamicClusterShape
+  ]
+
+  tile_schedulers = [
+    TileSchedulerType.Default, TileSchedulerType.StreamK,
+  ]
+
+  # 1xSM MMA kernels
+  for math_inst in math_instructions_1sm:
+    tile_descriptions = []
+    for cluster_shape in cluster_shapes_1sm:
+      multiplier = (1, 1, 1) if cluster_shape == DynamicClusterShape else cluster_shape
+      tile_descriptions.append(
+        TileDescription([
+          math_inst.instruction_shape[0] * multiplier[0],
+          math_inst.instruction_shape[1] * multiplier[1],
+          math_inst.instruction_shape[2]],
+          0, [4, 1, 1], math_inst, min_cc, max_cc, cluster_shape))
+
+    CreateGemmUniversal3xOperator(manifest, layouts, tile_descriptions, data_types,
+      [[KernelScheduleType.TmaWarpSpecialized1SmOzakiFP64Sm100, EpilogueScheduleType.OzakiF64NoSmemWarpSpecialized1Sm]],
+      tile_schedulers=tile_schedulers)
+
 
 # Conv Utility functions
 def make_dims_and_alignments_triple(dim: int, bit_per_element_A: int, bit_per_element_B: int, bit_per_element_C: int):
@@ -11234,7 +11606,7 @@ def GenerateSM120_TensorOp_mixed_8bits_UMMA_gemm_with_block_scaled(manifest, cud
 
   def is_pingpong(kernel_schedule):
     if kernel_schedule == KernelScheduleType.Mxf8f6f4TmaWarpSpecializedPingpongSm120 or \
-       kernel_schedule == KernelScheduleType.PtrArrayTmaWarpSpecializedPingpong:
+       kernel_schedule == KernelScheduleType.PtrArrayMxf8f6f4TmaWarpSpecializedPingpongSm120:
       return True
     else:
       return False
@@ -11383,14 +11755,17 @@ def GenerateSM120_TensorOp_fp4_UMMA_gemm_with_block_scaled(manifest, cuda_versio
   def is_pingpong(kernel_schedule):
     if kernel_schedule == KernelScheduleType.Nvf4TmaWarpSpecializedPingpongSm120 or \
        kernel_schedule == KernelScheduleType.Mxf4TmaWarpSpecializedPingpongSm120 or \
-       kernel_schedule == KernelScheduleType.PtrArrayTmaWarpSpecializedPingpong:
+       kernel_schedule == KernelScheduleType.PtrArrayNvf4TmaWarpSpecializedPingpongSm120 or \
+       kernel_schedule == KernelScheduleType.PtrArrayMxf4TmaWarpSpecializedPingpongSm120:
       return True
     else:
       return False
 
   def is_nvf4(kernel_schedule):
     if kernel_schedule == KernelScheduleType.Nvf4TmaWarpSpecializedCooperativeSm120 or \
-       kernel_schedule == KernelScheduleType.Nvf4TmaWarpSpecializedPingpongSm120:
+       kernel_schedule == KernelScheduleType.Nvf4TmaWarpSpecializedPingpongSm120 or \
+       kernel_schedule == KernelScheduleType.PtrArrayNvf4TmaWarpSpecializedCooperativeSm120 or \
+       kernel_schedule == KernelScheduleType.PtrArrayNvf4TmaWarpSpecializedPingpongSm120:
       return True
     else:
       return False
@@ -11413,12 +11788,12 @@ def GenerateSM120_TensorOp_fp4_UMMA_gemm_with_block_scaled(manifest, cuda_versio
   
   math_instructions = []
 
-  kernel_schedules = list(set([
+  kernel_schedules = [
     to_grouped_schedule(KernelScheduleType.Nvf4TmaWarpSpecializedCooperativeSm120, grouped),
     to_grouped_schedule(KernelScheduleType.Nvf4TmaWarpSpecializedPingpongSm120, grouped),
     to_grouped_schedule(KernelScheduleType.Mxf4TmaWarpSpecializedCooperativeSm120, grouped),
     to_grouped_schedule(KernelScheduleType.Mxf4TmaWarpSpecializedPingpongSm120, grouped)
-  ])) # ensure no duplicates
+  ]
 
   for instr_size, a_type, b_type, acc_type, sf_type in product(instruction_sizes, ab_types, ab_types, acc_types, sf_types):
     math_instructions.append(
@@ -11433,16 +11808,12 @@ def GenerateSM120_TensorOp_fp4_UMMA_gemm_with_block_scaled(manifest, cuda_versio
   for math_inst in math_instructions:
     for kernel_schedule in kernel_schedules:
       tile_descriptions = []
-      is_grouped_schedule = grouped
       tile_sizes = tile_sizes_pingpong if is_pingpong(kernel_schedule) else tile_sizes_cooperative
       for tile_size in tile_sizes:
         # nvf4 kernel only supports ue4m3 SF
         # mxf4 kernel only supports ue8m0 SF
-        # grouped schedules only support ue8m0 (MXF4); NVF4 (ue4m3) grouped requires
-        # NVF4-specific PtrArray schedule tags not yet available
-        if (is_grouped_schedule and math_inst.element_scale_factor == DataType.ue8m0) or \
-           (not is_grouped_schedule and math_inst.element_scale_factor == DataType.ue4m3 and is_nvf4(kernel_schedule)) or \
-           (not is_grouped_schedule and math_inst.element_scale_factor == DataType.ue8m0 and not is_nvf4(kernel_schedule)):
+        if (math_inst.element_scale_factor == DataType.ue4m3 and is_nvf4(kernel_schedule)) or \
+           (math_inst.element_scale_factor == DataType.ue8m0 and not is_nvf4(kernel_schedule)):
           tile_descriptions.append(
             TileDescription(tile_size, 0, [4, 1, 1], math_inst, min_cc, max_cc, cluster_shape))
 
@@ -12034,6 +12405,7 @@ def GenerateSM100(manifest, cuda_version):
   # grouped GEMM
   GenerateSM100_TensorOp_fp8_UMMA_gemm(manifest, cuda_version, gemm_kind=GemmKind.GroupedUniversal3x)
   GenerateSM100_TensorOp_16b_UMMA_gemm(manifest, cuda_version, gemm_kind=GemmKind.GroupedUniversal3x)
+  GenerateSM100_TensorOp_32b_UMMA_gemm_complex(manifest, cuda_version, gemm_kind=GemmKind.GroupedUniversal3x)
   # MOE grouped GEMM
   GenerateSM100_TensorOp_16b_UMMA_moe_gemm(manifest, cuda_version)
   GenerateSM100_TensorOp_fp8_UMMA_moe_gemm(manifest, cuda_version)
@@ -12049,6 +12421,9 @@ def GenerateSM100(manifest, cuda_version):
   GenerateSM100_TensorOp_32b_UMMA_gemm_complex(manifest, cuda_version)
   # CGemm with 9xBF16
   GenerateSM100_TensorOp_FastF32_UMMA_gemm_complex_stream_k(manifest, cuda_version)
+  # DGemm with INT8 slices
+  if not bool(set(manifest.compute_capabilities_feature_set).intersection(arch_family_cc)):
+    GenerateSM100_TensorOp_OzakiF64_UMMA_gemm(manifest, cuda_version)
 
   #
   # Sparse Gemm
@@ -12483,6 +12858,7 @@ def GenerateSM90_Conv3x(manifest, cuda_version,
 def GenerateSM90(manifest, cuda_version):
   GenerateSM90_TensorOp_16b_WGMMA_gemm(manifest, cuda_version)
   GenerateSM90_TensorOp_16b_WGMMA_alignx_gemm(manifest, cuda_version)
+  GenerateSM90_TensorOp_16b_WGMMA_small_n_gemm(manifest, cuda_version)
   GenerateSM90_TensorOp_tf32_WGMMA_gemm(manifest, cuda_version)
   GenerateSM90_TensorOp_tf32_WGMMA_alignx_gemm(manifest, cuda_version)
   GenerateSM90_TensorOp_int8_WGMMA_gemm(manifest, cuda_version)
@@ -12496,6 +12872,7 @@ def GenerateSM90(manifest, cuda_version):
   GenerateSM90_TensorOp_1684_complex(manifest, cuda_version)
   GenerateSM90_TensorOp_1684_complex_gaussian(manifest, cuda_version)
   GenerateSM90_TensorOp_1684_rank_k(manifest, cuda_version)
+  GenerateSM90_TensorOp_16b_WGMMA_rank_k(manifest, cuda_version)
   GenerateSM90_TensorOp_1684_rank_k_complex(manifest, cuda_version)
   GenerateSM90_TensorOp_1684_rank_k_complex_gaussian(manifest, cuda_version)
   GenerateSM90_TensorOp_1684_trmm(manifest, cuda_version)
@@ -12563,6 +12940,9 @@ def define_parser():
                         help='Specify the output log file containing all enabled kernels in this build')
   parser.add_argument("--interface-dir", default=None, required=False, help="Interface header to kernels")
   parser.add_argument("--disable-full-archs-compilation", action="store_true", required=False, help="Disable compilation for every archs in --architectures")
+  parser.add_argument("--lazy-loading", action="store_true", required=False, help="Emit kernels as shard libraries loaded at runtime for the detected compute capability")
+  parser.add_argument("--dispatch-table-file", default=None, required=False, help="Path of a GEMM autotuning cache saved by cutlass::library::GemmAutotuneCache::save(). Only the operations it selects are generated, and its selections are built into the library as the default dispatch table.")
+  parser.add_argument("--shards-per-arch", default=0, type=int, required=False, help="Compile the kernels of each operation kind and compute capability through this many translation units with balanced estimated compile cost. 0 emits one translation unit per configuration.")
   parser.add_argument("--log-level", default='info', type=numeric_log_level, required=False,
                       help='Logging level to be used by the generator script')
   parser.add_argument('--instantiation-level', type=str, default="", required=False, help="Instantiation level for SM90 kernels. Set to `max` and make sure `--kernels` is not empty to generate all possible configurations.")
@@ -35,6 +35,8 @@ Data types and tags used for emitting CUTLASS C++ kernels
 """
 
 import enum
+import io
+import os
 import re
 
 # The following block implements enum.auto() for Python 3.5 variants that don't include it such
@@ -565,8 +567,11 @@ class KernelScheduleType(enum.Enum):
 
   InterleavedComplexTF32TmaWarpSpecialized1SmSm100 = enum_auto()
   InterleavedComplexTF32TmaWarpSpecialized2SmSm100 = enum_auto()
+  PtrArrayInterleavedComplexTF32TmaWarpSpecialized1SmSm100 = enum_auto()
+  PtrArrayInterleavedComplexTF32TmaWarpSpecialized2SmSm100 = enum_auto()
   TmaWarpSpecialized1SmFastFP32Sm100 = enum_auto()
   TmaWarpSpecialized2SmFastFP32Sm100 = enum_auto()
+  TmaWarpSpecialized1SmOzakiFP64Sm100 = enum_auto()
 
   # FP4 Ultra
   MxNvf4UltraTmaWarpSpecialized1SmVs16Sm103 = enum_auto()
@@ -605,6 +610,12 @@ class KernelScheduleType(enum.Enum):
   Nvf4TmaWarpSpecializedPingpongSm120 = enum_auto()
   Mxf4TmaWarpSpecializedCooperativeSm120 = enum_auto()
   Mxf4TmaWarpSpecializedPingpongSm120 = enum_auto()
+  PtrArrayMxf8f6f4TmaWarpSpecializedCooperativeSm120 = enum_auto()
+  PtrArrayMxf8f6f4TmaWarpSpecializedPingpongSm120 = enum_auto()
+  PtrArrayNvf4TmaWarpSpecializedCooperativeSm120 = enum_auto()
+  PtrArrayNvf4TmaWarpSpecializedPingpongSm120 = enum_auto()
+  PtrArrayMxf4TmaWarpSpecializedCooperativeSm120 = enum_auto()
+  PtrArrayMxf4TmaWarpSpecializedPingpongSm120 = enum_auto()
 
   SparseMxf8f6f4TmaWarpSpecializedSm120 = enum_auto()
   SparseMxf8f6f4TmaWarpSpecializedAcc2x4Sm120 = enum_auto()  
@@ -690,8 +701,11 @@ KernelScheduleTag = {
   KernelScheduleType.MxNvf4UltraTmaWarpSpecialized2SmVs32Sm103DisablePrefetch: 'cutlass::gemm::KernelTmaWarpSpecialized2SmBlockScaledMxNvf4UltraVs32Sm103DisablePrefetch',
   KernelScheduleType.InterleavedComplexTF32TmaWarpSpecialized1SmSm100: 'cutlass::gemm::KernelTmaWarpSpecialized1SmInterleavedComplexTF32Sm100',
   KernelScheduleType.InterleavedComplexTF32TmaWarpSpecialized2SmSm100: 'cutlass::gemm::KernelTmaWarpSpecialized2SmInterleavedComplexTF32Sm100',
+  KernelScheduleType.PtrArrayInterleavedComplexTF32TmaWarpSpecialized1SmSm100: 'cutlass::gemm::KernelPtrArrayTmaWarpSpecialized1SmInterleavedComplexTF32Sm100',
+  KernelScheduleType.PtrArrayInterleavedComplexTF32TmaWarpSpecialized2SmSm100: 'cutlass::gemm::KernelPtrArrayTmaWarpSpecialized2SmInterleavedComplexTF32Sm100',
   KernelScheduleType.TmaWarpSpecialized1SmFastFP32Sm100: 'cutlass::gemm::KernelTmaWarpSpecialized1SmFastFP32Sm100',
   KernelScheduleType.TmaWarpSpecialized2SmFastFP32Sm100: 'cutlass::gemm::KernelTmaWarpSpecialized2SmFastFP32Sm100',
+  KernelScheduleType.TmaWarpSpecialized1SmOzakiFP64Sm100: 'cutlass::gemm::KernelTmaWarpSpecialized1SmOzakiFP64Sm100',
   KernelScheduleType.PtrArrayTmaWarpSpecializedCooperative: 'cutlass::gemm::KernelPtrArrayTmaWarpSpecializedCooperative',
   KernelScheduleType.PtrArrayTmaWarpSpecializedCooperativeFP8FastAccum: 'cutlass::gemm::KernelPtrArrayTmaWarpSpecializedCooperativeFP8FastAccum',
   KernelScheduleType.PtrArrayTmaWarpSpecializedPingpong: 'cutlass::gemm::KernelPtrArrayTmaWarpSpecializedPingpong',
@@ -728,6 +742,12 @@ KernelScheduleTag = {
   KernelScheduleType.Nvf4TmaWarpSpecializedPingpongSm120: 'cutlass::gemm::KernelTmaWarpSpecializedPingpongNvf4Sm120',
   KernelScheduleType.Mxf4TmaWarpSpecializedCooperativeSm120: 'cutlass::gemm::KernelTmaWarpSpecializedMxf4Sm120',
   KernelScheduleType.Mxf4TmaWarpSpecializedPingpongSm120: 'cutlass::gemm::KernelTmaWarpSpecializedPingpongMxf4Sm120',
+  KernelScheduleType.PtrArrayMxf8f6f4TmaWarpSpecializedCooperativeSm120: 'cutlass::gemm::KernelPtrArrayTmaWarpSpecializedMxf8f6f4Sm120',
+  KernelScheduleType.PtrArrayMxf8f6f4TmaWarpSpecializedPingpongSm120: 'cutlass::gemm::KernelPtrArrayTmaWarpSpecializedPingpongMxf8f6f4Sm120',
+  KernelScheduleType.PtrArrayNvf4TmaWarpSpecializedCooperativeSm120: 'cutlass::gemm::KernelPtrArrayTmaWarpSpecializedNvf4Sm120',
+  KernelScheduleType.PtrArrayNvf4TmaWarpSpecializedPingpongSm120: 'cutlass::gemm::KernelPtrArrayTmaWarpSpecializedPingpongNvf4Sm120',
+  KernelScheduleType.PtrArrayMxf4TmaWarpSpecializedCooperativeSm120: 'cutlass::gemm::KernelPtrArrayTmaWarpSpecializedMxf4Sm120',
+  KernelScheduleType.PtrArrayMxf4TmaWarpSpecializedPingpongSm120: 'cutlass::gemm::KernelPtrArrayTmaWarpSpecializedPingpongMxf4Sm120',
 
   KernelScheduleType.F8f6f4SparseTmaWarpSpecializedCooperativeSm120: 'cutlass::gemm::KernelScheduleSparseF8f6f4Sm120',
 
@@ -815,8 +835,11 @@ KernelScheduleSuffixes = {
   KernelScheduleType.MxNvf4UltraTmaWarpSpecialized2SmVs32Sm103TmaPrefetch: '_o_vs32_ultra_2sm_tmapf',
   KernelScheduleType.InterleavedComplexTF32TmaWarpSpecialized1SmSm100: '_1sm',
   KernelScheduleType.InterleavedComplexTF32TmaWarpSpecialized2SmSm100: '_2sm',
+  KernelScheduleType.PtrArrayInterleavedComplexTF32TmaWarpSpecialized1SmSm100: '_1sm',
+  KernelScheduleType.PtrArrayInterleavedComplexTF32TmaWarpSpecialized2SmSm100: '_2sm',
   KernelScheduleType.TmaWarpSpecialized1SmFastFP32Sm100: '_FastF32_1sm',
   KernelScheduleType.TmaWarpSpecialized2SmFastFP32Sm100: '_FastF32_2sm',
+  KernelScheduleType.TmaWarpSpecialized1SmOzakiFP64Sm100: '_OzakiF64_1sm',
   KernelScheduleType.PtrArrayTmaWarpSpecializedCooperative: '_warpspecialized_cooperative',
   KernelScheduleType.PtrArrayTmaWarpSpecializedCooperativeFP8FastAccum: '_warpspecialized_cooperative_fp8_fastaccum',
   KernelScheduleType.PtrArrayTmaWarpSpecializedPingpong: '_warpspecialized_pingpong',
@@ -855,6 +878,12 @@ KernelScheduleSuffixes = {
   KernelScheduleType.Nvf4TmaWarpSpecializedPingpongSm120: '_pingpong_o_vs16',
   KernelScheduleType.Mxf4TmaWarpSpecializedCooperativeSm120: '_cooperative_o_vs32',
   KernelScheduleType.Mxf4TmaWarpSpecializedPingpongSm120: '_pingpong_o_vs32',
+  KernelScheduleType.PtrArrayMxf8f6f4TmaWarpSpecializedCooperativeSm120: '_cooperative_q',
+  KernelScheduleType.PtrArrayMxf8f6f4TmaWarpSpecializedPingpongSm120: '_pingpong_q',
+  KernelScheduleType.PtrArrayNvf4TmaWarpSpecializedCooperativeSm120: '_cooperative_o_vs16',
+  KernelScheduleType.PtrArrayNvf4TmaWarpSpecializedPingpongSm120: '_pingpong_o_vs16',
+  KernelScheduleType.PtrArrayMxf4TmaWarpSpecializedCooperativeSm120: '_cooperative_o_vs32',
+  KernelScheduleType.PtrArrayMxf4TmaWarpSpecializedPingpongSm120: '_pingpong_o_vs32',
 
   KernelScheduleType.SparseMxf8f6f4TmaWarpSpecializedSm120: '_q',
   KernelScheduleType.SparseMxf8f6f4TmaWarpSpecializedAcc2x4Sm120: '_acc2x4_q',
@@ -876,6 +905,7 @@ class EpilogueScheduleType(enum.Enum):
   NoSmemWarpSpecialized2Sm = enum_auto()
   FastF32NoSmemWarpSpecialized1Sm = enum_auto()
   FastF32NoSmemWarpSpecialized2Sm = enum_auto()
+  OzakiF64NoSmemWarpSpecialized1Sm = enum_auto()
   BlockwiseNoSmemWarpSpecialized1Sm = enum_auto()
   BlockwiseNoSmemWarpSpecialized2Sm = enum_auto()
   PtrArrayNoSmemWarpSpecialized1Sm = enum_auto()
@@ -910,6 +940,7 @@ EpilogueScheduleTag = {
   EpilogueScheduleType.NoSmemWarpSpecialized2Sm: 'cutlass::epilogue::NoSmemWarpSpecialized2Sm',
   EpilogueScheduleType.FastF32NoSmemWarpSpecialized1Sm: 'cutlass::epilogue::FastF32NoSmemWarpSpecialized1Sm',
   EpilogueScheduleType.FastF32NoSmemWarpSpecialized2Sm: 'cutlass::epilogue::FastF32NoSmemWarpSpecialized2Sm',
+  EpilogueScheduleType.OzakiF64NoSmemWarpSpecialized1Sm: 'cutlass::epilogue::OzakiF64NoSmemWarpSpecialized1Sm',
   EpilogueScheduleType.BlockwiseNoSmemWarpSpecialized1Sm: 'cutlass::epilogue::BlockwiseNoSmemWarpSpecialized1Sm',
   EpilogueScheduleType.BlockwiseNoSmemWarpSpecialized2Sm: 'cutlass::epilogue::BlockwiseNoSmemWarpSpecialized2Sm',
   EpilogueScheduleType.PtrArrayNoSmemWarpSpecialized1Sm: 'cutlass::epilogue::PtrArrayNoSmemWarpSpecialized1Sm',
@@ -945,6 +976,7 @@ EpilogueScheduleSuffixes = {
   EpilogueScheduleType.NoSmemWarpSpecialized2Sm: '_epi_nosmem',
   EpilogueScheduleType.FastF32NoSmemWarpSpecialized1Sm: '_epi_nosmem_fastf32',
   EpilogueScheduleType.FastF32NoSmemWarpSpecialized2Sm: '_epi_nosmem_fastf32',
+  EpilogueScheduleType.OzakiF64NoSmemWarpSpecialized1Sm: '_epi_nosmem_ozakif64',
   EpilogueScheduleType.BlockwiseNoSmemWarpSpecialized1Sm: '_epi_nosmem',
   EpilogueScheduleType.BlockwiseNoSmemWarpSpecialized2Sm: '_epi_nosmem',
   EpilogueScheduleType.PtrArrayNoSmemWarpSpecialized1Sm: '_epi_nosmem',
@@ -973,11 +1005,18 @@ EpilogueScheduleSuffixes = {
 class EpilogueFunctor3x(enum.Enum):
   LinearCombination = enum_auto()
   LinearCombinationBlockScaleFactor = enum_auto() 
+  LinCombPerRowScalePerColScale = enum_auto()
 
 #
 EpilogueFunctor3xTag = {
   EpilogueFunctor3x.LinearCombination: 'cutlass::epilogue::fusion::LinearCombination',
   EpilogueFunctor3x.LinearCombinationBlockScaleFactor: 'cutlass::epilogue::fusion::LinCombBlockScaleFactor',  
+  EpilogueFunctor3x.LinCombPerRowScalePerColScale: 'cutlass::epilogue::fusion::LinCombPerRowScalePerColScale',
+}
+
+# Kernel name suffixes of epilogue functors other than the linear combination
+EpilogueFunctor3xSuffixes = {
+  EpilogueFunctor3x.LinCombPerRowScalePerColScale: '_rowcolscale',
 }
 
 # TMA epilogues have certain alignment requirements as calculated in get_tma_alignment(data_type)
@@ -1026,6 +1065,8 @@ def to_grouped_schedule(schedule, grouped):
     KernelScheduleType.Mxf8f6f4TmaWarpSpecialized2SmSm100 : KernelScheduleType.PtrArrayMxf8f6f4TmaWarpSpecialized2SmSm100,
     KernelScheduleType.BlockwiseTmaWarpSpecialized1SmSm100 : KernelScheduleType.PtrArrayBlockwiseTmaWarpSpecialized1SmSm100,
     KernelScheduleType.BlockwiseTmaWarpSpecialized2SmSm100 : KernelScheduleType.PtrArrayBlockwiseTmaWarpSpecialized2SmSm100,
+    KernelScheduleType.InterleavedComplexTF32TmaWarpSpecialized1SmSm100 : KernelScheduleType.PtrArrayInterleavedComplexTF32TmaWarpSpecialized1SmSm100,
+    KernelScheduleType.InterleavedComplexTF32TmaWarpSpecialized2SmSm100 : KernelScheduleType.PtrArrayInterleavedComplexTF32TmaWarpSpecialized2SmSm100,
     EpilogueScheduleType.TmaWarpSpecialized1Sm: EpilogueScheduleType.PtrArrayTmaWarpSpecialized1Sm,
     EpilogueScheduleType.TmaWarpSpecialized2Sm: EpilogueScheduleType.PtrArrayTmaWarpSpecialized2Sm,
     EpilogueScheduleType.NoSmemWarpSpecialized1Sm: EpilogueScheduleType.PtrArrayNoSmemWarpSpecialized1Sm,
@@ -1046,12 +1087,12 @@ def to_grouped_schedule(schedule, grouped):
     KernelScheduleType.MxNvf4UltraTmaWarpSpecialized1SmVs32Sm103TmaPrefetch: KernelScheduleType.PtrArrayMxNvf4UltraTmaWarpSpecialized1SmVs32Sm103TmaPrefetch,
     KernelScheduleType.MxNvf4UltraTmaWarpSpecialized2SmVs32Sm103TmaPrefetch: KernelScheduleType.PtrArrayMxNvf4UltraTmaWarpSpecialized2SmVs32Sm103TmaPrefetch,
     # SM120
-    KernelScheduleType.Mxf8f6f4TmaWarpSpecializedCooperativeSm120: KernelScheduleType.PtrArrayTmaWarpSpecializedCooperative,
-    KernelScheduleType.Mxf8f6f4TmaWarpSpecializedPingpongSm120: KernelScheduleType.PtrArrayTmaWarpSpecializedPingpong,
-    KernelScheduleType.Nvf4TmaWarpSpecializedCooperativeSm120: KernelScheduleType.PtrArrayTmaWarpSpecializedCooperative,
-    KernelScheduleType.Nvf4TmaWarpSpecializedPingpongSm120: KernelScheduleType.PtrArrayTmaWarpSpecializedPingpong,
-    KernelScheduleType.Mxf4TmaWarpSpecializedCooperativeSm120: KernelScheduleType.PtrArrayTmaWarpSpecializedCooperative,
-    KernelScheduleType.Mxf4TmaWarpSpecializedPingpongSm120: KernelScheduleType.PtrArrayTmaWarpSpecializedPingpong,
+    KernelScheduleType.Mxf8f6f4TmaWarpSpecializedCooperativeSm120: KernelScheduleType.PtrArrayMxf8f6f4TmaWarpSpecializedCooperativeSm120,
+    KernelScheduleType.Mxf8f6f4TmaWarpSpecializedPingpongSm120: KernelScheduleType.PtrArrayMxf8f6f4TmaWarpSpecializedPingpongSm120,
+    KernelScheduleType.Nvf4TmaWarpSpecializedCooperativeSm120: KernelScheduleType.PtrArrayNvf4TmaWarpSpecializedCooperativeSm120,
+    KernelScheduleType.Nvf4TmaWarpSpecializedPingpongSm120: KernelScheduleType.PtrArrayNvf4TmaWarpSpecializedPingpongSm120,
+    KernelScheduleType.Mxf4TmaWarpSpecializedCooperativeSm120: KernelScheduleType.PtrArrayMxf4TmaWarpSpecializedCooperativeSm120,
+    KernelScheduleType.Mxf4TmaWarpSpecializedPingpongSm120: KernelScheduleType.PtrArrayMxf4TmaWarpSpecializedPingpongSm120,
   }
 
   return group_schedule_map[schedule]
@@ -1230,6 +1271,48 @@ def SubstituteTemplate(template, values):
 
 ###################################################################################################
 
+#
+class GeneratedFile(io.StringIO):
+  """
+  Text file for emitted sources. Content is buffered and written to `path` on close()
+  only if it differs from the file on disk, so that regenerating unchanged sources
+  preserves their timestamps and does not trigger recompilation.
+
+  The paths of all files closed since the last call to reset_written() are recorded
+  in GeneratedFile.written, from which stale sources of previous runs are identified.
+  """
+
+  written = set()
+
+  def __init__(self, path):
+    super().__init__()
+    self.name = path
+
+  @classmethod
+  def reset_written(cls):
+    cls.written = set()
+
+  def close(self):
+    if self.closed:
+      return
+    content = self.getvalue()
+    super().close()
+
+    GeneratedFile.written.add(os.path.abspath(self.name))
+
+    if os.path.isfile(self.name):
+      with open(self.name, "r") as existing_file:
+        if existing_file.read() == content:
+          return
+
+    with open(self.name, "w") as output_file:
+      output_file.write(content)
+
+  def __exit__(self, exception_type, exception_value, traceback):
+    self.close()
+
+###################################################################################################
+
 #
 class GemmKind(enum.Enum):
   Gemm = enum_auto()
@@ -1273,10 +1356,12 @@ GemmKindNames = {
 #
 class RankKKind(enum.Enum):
   Universal = enum_auto()
+  Universal3x = enum_auto()
 
 #
 RankKKindNames = {
-  RankKKind.Universal: "rank_k"
+  RankKKind.Universal: "rank_k",
+  RankKKind.Universal3x: "rank_k"
 }
 
 #
@@ -1388,6 +1473,7 @@ class IteratorAlgorithm(enum.Enum):
   FixedChannels = 2
   FewChannels = 3
   FixedStrideDilation = 4
+  Winograd = 5
 
 #
 IteratorAlgorithmTag = {
@@ -1395,7 +1481,8 @@ IteratorAlgorithmTag = {
   IteratorAlgorithm.Optimized: 'cutlass::conv::IteratorAlgorithm::kOptimized',
   IteratorAlgorithm.FixedChannels: 'cutlass::conv::IteratorAlgorithm::kFixedChannels',
   IteratorAlgorithm.FewChannels: 'cutlass::conv::IteratorAlgorithm::kFewChannels',
-  IteratorAlgorithm.FixedStrideDilation: 'cutlass::conv::IteratorAlgorithm::kFixedStrideDilation'
+  IteratorAlgorithm.FixedStrideDilation: 'cutlass::conv::IteratorAlgorithm::kFixedStrideDilation',
+  IteratorAlgorithm.Winograd: 'cutlass::conv::IteratorAlgorithm::kWinograd'
 }
 
 IteratorAlgorithmNames = {
@@ -1403,7 +1490,8 @@ IteratorAlgorithmNames = {
   IteratorAlgorithm.Optimized: 'optimized',
   IteratorAlgorithm.FixedChannels: 'fixed_channels',
   IteratorAlgorithm.FewChannels: 'few_channels',
-  IteratorAlgorithm.FixedStrideDilation: 'fixed_stride_dilation'
+  IteratorAlgorithm.FixedStrideDilation: 'fixed_stride_dilation',
+  IteratorAlgorithm.Winograd: 'winograd'
 }
 
 #
@@ -1561,6 +1649,16 @@ class Direct2dConvFixedStrideDilationTileDescription:
                                                   self.dilation[1])
     return str_name
 
+#
+class WinogradTileDescription(TileDescription):
+  def __init__(self, threadblock_shape, output_tile, warp_count, math_instruction, min_compute, max_compute):
+    super().__init__(threadblock_shape, 1, warp_count, math_instruction, min_compute, max_compute)
+    self.output_tile = output_tile
+
+  def procedural_name(self):
+    return "%dx%d_%dx%d_f%dx%d" % (self.threadblock_shape[0], self.threadblock_shape[1], self.threadblock_shape[2],
+                                   self.stages, self.output_tile, self.output_tile)
+
 #
 class TensorDescription:
   def __init__(self, element, layout, alignment = 1, complex_transform = ComplexTransform.none):
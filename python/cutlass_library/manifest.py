@@ -66,6 +66,16 @@ except ImportError:
 _LOGGER = logging.getLogger(__name__)
 
 
+def _estimate_compile_cost(operation):
+  """
+  Relative compile time of an operation's instantiation, used to balance the
+  translation units emitted with --shards-per-arch. CUTLASS 3.x kernels (SM90 and later)
+  instantiate collective mainloops and epilogues and take several times longer to
+  compile than CUTLASS 2.x kernels.
+  """
+  return 4 if getattr(operation, 'arch', 0) >= 90 else 1
+
+
 class EmitOperationKindAll:
   """
   Emit the OperationKind-level CUTLASS library initialization code.
@@ -118,6 +128,17 @@ void initialize_all_${operation_name}_operations(Manifest &manifest) {
     self.configuration_prototype_template = "void initialize_${configuration_name}(Manifest &manifest);\n"
     self.configuration_template ="  initialize_${configuration_name}(manifest);\n"
 
+    # With lazy loading, operations live in separate shard libraries loaded by the Manifest
+    self.lazy_loading = bool(getattr(args, 'lazy_loading', False))
+    self.shard_table_begin_template = "  static ManifestShard const shards[] = {\n"
+    self.shard_template = "    {\"cutlass_${operation_name}_sm${min_cc}_${subclass_name}\", \"cutlass_library_initialize_sm${min_cc}_${subclass_name}_${operation_name}_operations\", ${min_cc}},\n"
+    self.shard_table_end_template = """  };
+
+  for (auto const &shard : shards) {
+    manifest.load_shard(shard);
+  }
+"""
+
     self.epilogue_template ="""}
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -139,25 +160,34 @@ void initialize_all_${operation_name}_operations(Manifest &manifest) {
     self.top_level_path = os.path.join(self.operation_path, f"all_{OperationKindNames[self.kind]}_operations.cu")
     _LOGGER.debug(f"***   top_level_path (file to write): {str(self.top_level_path)}")
 
-    self.top_level_file = open(self.top_level_path, "w")
+    self.top_level_file = GeneratedFile(self.top_level_path)
     self.top_level_file.write(self.header_template)
 
     self.source_files = [self.top_level_path,]
 
     self.configurations = []
 
+    # (min_cc, subclass_name) of each shard when lazy loading is enabled
+    self.shards = []
+
     return self
 
   #
-  def emit(self, operations):
+  def emit(self, operations, subclasses = None):
     _LOGGER.debug('*** EmitOperationKindAll::emit')
     _LOGGER.debug(f"***   len(operations): {len(operations)}")
     _LOGGER.debug(f"***   min_cc list: {sorted(min_cc for min_cc, _ in operations.items())}")
 
+    if self.lazy_loading:
+      for min_cc in sorted(subclasses.keys()):
+        for subclass_name in sorted(subclasses[min_cc]):
+          self.shards.append((min_cc, subclass_name))
+      return
+
     for min_cc, configurations in sorted(operations.items()):
       _LOGGER.debug(f"***   min_cc={min_cc}")
 
-      for configuration_name, _ in configurations.items():
+      for configuration_name, _ in sorted(configurations.items()):
         _LOGGER.debug(f"***     configuration_name={configuration_name}")
         self.configurations.append(configuration_name)
         self.top_level_file.write(SubstituteTemplate(self.configuration_prototype_template, {'configuration_name': configuration_name} ))
@@ -171,6 +201,16 @@ void initialize_all_${operation_name}_operations(Manifest &manifest) {
     for configuration_name in self.configurations:
       self.top_level_file.write(SubstituteTemplate(self.configuration_template, {'configuration_name': configuration_name}))
 
+    if self.shards:
+      self.top_level_file.write(self.shard_table_begin_template)
+      for min_cc, subclass_name in self.shards:
+        self.top_level_file.write(SubstituteTemplate(self.shard_template, {
+          'min_cc': str(min_cc),
+          'subclass_name': subclass_name,
+          'operation_name': OperationKindNames[self.kind]
+        }))
+      self.top_level_file.write(self.shard_table_end_template)
+
     self.top_level_file.write(self.epilogue_template)
     self.top_level_file.close()
 
@@ -256,6 +296,25 @@ void initialize_all_sm${min_cc}_${subclass_name}_${operation_name}_operations(Ma
 } // namespace cutlass
 
 """
+    # Unmangled entry point through which the Manifest initializes a lazily loaded shard
+    self.lazy_loading = bool(getattr(args, 'lazy_loading', False))
+    self.shard_entry_template = """
+extern "C" void cutlass_library_initialize_sm${min_cc}_${subclass_name}_${operation_name}_operations(
+  cutlass::library::Manifest &manifest) {
+  cutlass::library::initialize_all_sm${min_cc}_${subclass_name}_${operation_name}_operations(manifest);
+}
+"""
+
+    # With --shards-per-arch, configuration sources are compiled through this many translation
+    # units per {operation_kind x cc}, each including a cost-balanced subset of them
+    self.shards_per_arch = int(getattr(args, 'shards_per_arch', 0) or 0)
+    self.shard_header_template = """
+/*
+ Generated by manifest.py - Do not edit.
+*/
+
+"""
+    self.shard_include_template = "#include \"${configuration_file}\"\n"
 
   #
   def __enter__(self):
@@ -266,12 +325,12 @@ void initialize_all_sm${min_cc}_${subclass_name}_${operation_name}_operations(Ma
 
     self.operation_path = os.path.join(self.generated_path, OperationKindNames[self.kind], str(self.min_cc))
     _LOGGER.debug(f"***   operation_path (directory to make): {str(self.operation_path)}")
-    os.makedirs(self.operation_path)
+    os.makedirs(self.operation_path, exist_ok=True)
 
     self.top_level_path = os.path.join(self.operation_path, f"all_sm{self.min_cc}_{OperationKindNames[self.kind]}_operations.cu")
     _LOGGER.debug(f"***   top_level_path (file to write): {str(self.top_level_path)}")
 
-    self.top_level_file = open(self.top_level_path, "w")
+    self.top_level_file = GeneratedFile(self.top_level_path)
     self.top_level_file.write(self.header_template)
 
     self.source_files = {}
@@ -284,6 +343,9 @@ void initialize_all_sm${min_cc}_${subclass_name}_${operation_name}_operations(Ma
     # Configurations in each sub class
     self.subclass_configurations = {}
 
+    # (configuration_path, estimated compile cost) of the configurations in each sub class
+    self.subclass_configuration_files = {}
+
     return self
 
   #
@@ -303,9 +365,10 @@ void initialize_all_sm${min_cc}_${subclass_name}_${operation_name}_operations(Ma
     if extended_name not in self.subclass_files:
       subclass_path = os.path.join(self.operation_path, extended_name)
       _LOGGER.debug(f"***     subclass_path: {str(subclass_path)}")
-      os.mkdir(subclass_path)
+      os.makedirs(subclass_path, exist_ok=True)
 
       self.subclass_configurations[extended_name] = []
+      self.subclass_configuration_files[extended_name] = []
 
       # Open a new top-level file for this sub class
       subclass_top_level_path = os.path.join(
@@ -313,7 +376,7 @@ void initialize_all_sm${min_cc}_${subclass_name}_${operation_name}_operations(Ma
       _LOGGER.debug('***     subclass_top_level_path (min_cc, extended_name, ' +
                     'OperationKind): ' + str(subclass_top_level_path))
 
-      self.subclass_files[extended_name] = open(subclass_top_level_path, "w")
+      self.subclass_files[extended_name] = GeneratedFile(subclass_top_level_path)
       self.subclass_files[extended_name].write(self.header_template)
 
       self.source_files[extended_name] = [subclass_top_level_path]
@@ -327,14 +390,59 @@ void initialize_all_sm${min_cc}_${subclass_name}_${operation_name}_operations(Ma
 
       _LOGGER.debug('***   configuration_emitter.configuration_path: ' +
                     str(configuration_emitter.configuration_path))
-      self.source_files[extended_name].append(configuration_emitter.configuration_path)
+      configuration_path = configuration_emitter.configuration_path
+
+    if self.shards_per_arch > 0:
+      cost = sum(_estimate_compile_cost(operation) for operation in operations)
+      self.subclass_configuration_files[extended_name].append((configuration_path, cost))
+    else:
+      self.source_files[extended_name].append(configuration_path)
 
     self.subclass_configurations[extended_name].append(configuration_name)
     self.subclass_files[extended_name].write(SubstituteTemplate(self.configuration_prototype_template, {'configuration_name': configuration_name} ))
 
+  #
+  def emit_shards(self):
+    """
+    Distributes the configuration sources of all sub classes over self.shards_per_arch
+    translation units. Each sub class receives a share of the translation units in proportion
+    to its estimated compile cost, and its configurations are assigned to those translation
+    units longest first, each to the least loaded one.
+    """
+    total_cost = sum(cost for files in self.subclass_configuration_files.values() for _, cost in files)
+
+    for subclass_name, files in sorted(self.subclass_configuration_files.items()):
+      subclass_cost = sum(cost for _, cost in files)
+      shard_count = max(1, round(self.shards_per_arch * subclass_cost / max(total_cost, 1)))
+      shard_count = min(shard_count, len(files))
+
+      shards = [[0, []] for _ in range(shard_count)]
+      for configuration_path, cost in sorted(files, key=lambda entry: (-entry[1], entry[0])):
+        shard = min(shards, key=lambda entry: entry[0])
+        shard[0] += cost
+        shard[1].append(configuration_path)
+
+      subclass_dir = os.path.dirname(self.subclass_files[subclass_name].name)
+      for shard_idx, (cost, configuration_paths) in enumerate(shards):
+        shard_path = os.path.join(subclass_dir,
+          f"all_sm{self.min_cc}_{subclass_name}_{OperationKindNames[self.kind]}_shard{shard_idx}.cu").replace('\\', '/')
+        _LOGGER.debug(f"***   shard {shard_path}: {len(configuration_paths)} configurations, cost {cost}")
+
+        with GeneratedFile(shard_path) as shard_file:
+          shard_file.write(self.shard_header_template)
+          for configuration_path in sorted(configuration_paths):
+            shard_file.write(SubstituteTemplate(self.shard_include_template, {
+              'configuration_file': os.path.basename(configuration_path)
+            }))
+
+        self.source_files[subclass_name].append(shard_path)
+
   #
   def __exit__(self, exception_type, exception_value, traceback):
-    _LOGGER.debug("*** EmitOperationKindLibrary::__exit__")    
+    _LOGGER.debug("*** EmitOperationKindLibrary::__exit__")
+    if self.shards_per_arch > 0:
+      self.emit_shards()
+
     for subclass_name, subclass_file in sorted(self.subclass_files.items()):
       subclass_cfg = {
         'min_cc': str(self.min_cc),
@@ -366,6 +474,10 @@ void initialize_all_sm${min_cc}_${subclass_name}_${operation_name}_operations(Ma
           }))
 
       subclass_file.write(self.epilogue_template)
+
+      if self.lazy_loading:
+        subclass_file.write(SubstituteTemplate(self.shard_entry_template, subclass_cfg))
+
       subclass_file.close()
 
       # Write the call to initialize_all for this subclass to the top-level file
@@ -432,9 +544,13 @@ ${fn_calls}
 \t\tvoid initialize_all(Manifest &manifest) {
 \t\t\tmanifest.reserve(${operation_count});\n
 ${fn_calls}
+${dispatch_entries}
 \t\t}
 '''
 
+    self.dispatch_entries = []
+    self.dispatch_entry_template = "\t\t\tmanifest.append_dispatch_entry(\"${key}\", \"${operation_name}\");"
+
     self.top_level_suffix = '''
 \t} // namespace library
 } // namespace cutlass
@@ -448,7 +564,7 @@ ${fn_calls}
     self.top_level_path = os.path.join(self.generated_path, 'initialize_all.cpp')
     _LOGGER.debug("***   top_level_path: " + str(self.top_level_path))
 
-    self.top_level_file = open(self.top_level_path, "w")
+    self.top_level_file = GeneratedFile(self.top_level_path)
     self.top_level_file.write(self.top_level_hdr_template)
 
     self.source_files = [self.top_level_path,]
@@ -468,6 +584,11 @@ ${fn_calls}
       "\t\t\tinitialize_all_${operation_kind}_operations(manifest);",
       {'operation_kind': operation_name}))
 
+  #
+  def emit_dispatch_entry(self, key, operation_name):
+    self.dispatch_entries.append(SubstituteTemplate(self.dispatch_entry_template,
+      {'key': key, 'operation_name': operation_name}))
+
   #
   def __exit__(self, exception_type, exception_value, traceback):
     _LOGGER.debug("*** EmitInterfaceLibrary::__exit__")
@@ -476,7 +597,8 @@ ${fn_calls}
 
     # Write out initialize_all method
     self.top_level_file.write(SubstituteTemplate(self.top_level_initialize,
-                              {'operation_count': self.operation_count, 'fn_calls':"\n".join(self.fn_calls)}))
+                              {'operation_count': self.operation_count, 'fn_calls':"\n".join(self.fn_calls),
+                               'dispatch_entries': "\n".join(self.dispatch_entries)}))
 
     self.top_level_file.write(self.top_level_suffix)
     self.top_level_file.close()
@@ -511,6 +633,8 @@ class Manifest:
     self.compute_capabilities_feature_set = ['50',]
     self.curr_build_dir = '.'
     self.filter_by_cc = True
+    self.shards_per_arch = 0
+    self.dispatch_table = []
 
     if self.args:
       self.kernel_filter = self.args.kernels
@@ -558,6 +682,19 @@ class Manifest:
       self.operation_count = 0
       self.operations_by_name = {}
       self.disable_full_archs_compilation = args.disable_full_archs_compilation
+      self.shards_per_arch = int(getattr(args, 'shards_per_arch', 0) or 0)
+
+      # Restrict the library to the operations selected in a dispatch table file. Those may have
+      # been selected from any kernel set, so the default pruning of tile sizes is not applied.
+      if getattr(args, 'dispatch_table_file', None):
+        if self.kernel_filter == '':
+          self.kernel_filter = 'all'
+        self.dispatch_table = self.get_dispatch_table(args.dispatch_table_file)
+        for operation_name in sorted(set(name for _, name in self.dispatch_table)):
+          self.add_kernel_filter(f"^{re.escape(operation_name)}$")
+        _LOGGER.info("Using {entry_count} dispatch table entries from {table_file}".format(
+          entry_count = len(self.dispatch_table),
+          table_file = args.dispatch_table_file))
       self.is_kernel_filter_set_to_all = args.instantiation_level == "max" and args.kernels != ''
       self.instantiation_level = 0
       try:
@@ -601,6 +738,25 @@ class Manifest:
     else:
         return []
 
+  #
+  def get_dispatch_table(self, dispatch_table_file):
+    """
+    Reads operation selections saved by cutlass::library::GemmAutotuneCache::save(). Each line
+    holds a serialized GemmAutotuneKey, the name of the operation selected for it and, for operations
+    with a dynamic cluster shape, the cluster shapes it was tuned at. Cluster shapes are chosen at
+    launch, so only the operation names are built into the library.
+    """
+    dispatch_table = []
+    with open(dispatch_table_file, 'r') as table_file:
+      for line in table_file:
+        fields = line.split()
+        if not fields or fields[0].startswith('#'):
+          continue
+        if len(fields) not in (2, 3):
+          raise RuntimeError(f"Invalid dispatch table entry in {dispatch_table_file}: {line.strip()}")
+        dispatch_table.append((fields[0], fields[1]))
+    return sorted(dispatch_table)
+
   #
   def filter_out_kernels(self, kernel_name, kernel_filter_list):
 
@@ -733,7 +889,7 @@ class Manifest:
   #
 
   def emit_manifest_cmake(self, manifest_path, top_level_path, source_files):
-    with open(manifest_path, "w") as manifest_file:
+    with GeneratedFile(manifest_path) as manifest_file:
 
       target_text = SubstituteTemplate("""cutlass_target_sources(cutlass_library_objs PRIVATE
       """, { })
@@ -752,6 +908,10 @@ class Manifest:
             target_text = SubstituteTemplate("""cutlass_add_cutlass_library(
       SUFFIX ${kind}_sm${min_cc}_${subclass}
 """, { 'min_cc': str(min_cc), 'kind': OperationKindNames[kind], 'subclass': subclass })
+
+            # Sources are already combined into balanced shards; do not batch them again
+            if self.shards_per_arch > 0:
+              target_text += "      BATCH_SOURCES OFF\n"
             manifest_file.write(target_text + '\n\n')
 
             for source_file in source_files[kind][min_cc][subclass]:
@@ -827,17 +987,23 @@ class Manifest:
 
     generated_path = os.path.join(self.curr_build_dir, 'generated')
 
-    # create generated/
-    if os.path.exists(generated_path):
-      shutil.rmtree(generated_path)
-
-    os.mkdir(generated_path)
+    # Sources are rewritten only if their content changes. Those of a previous run which are
+    # not regenerated are removed at the end.
+    os.makedirs(generated_path, exist_ok=True)
+    GeneratedFile.reset_written()
 
     with interface_emitters[target](generated_path, self.operation_count, self.args) as iface_emitter:
       top_level_path = iface_emitter.top_level_path
       for operation_kind in self.operations.keys():
         iface_emitter.emit(OperationKindNames[operation_kind])
 
+      # Selections of operations which are not part of this library are dropped
+      for key, operation_name in self.dispatch_table:
+        if operation_name in self.operations_by_name:
+          iface_emitter.emit_dispatch_entry(key, operation_name)
+        else:
+          _LOGGER.warning(f"Dispatch table entry {key} selects {operation_name}, which is not generated.")
+
     source_files = {}
     for kind in self.operations.keys():
       source_files[kind] = {}
@@ -847,7 +1013,8 @@ class Manifest:
     for operation_kind, ops in self.operations.items():
       for min_cc, configurations in sorted(ops.items()):
         with operation_emitters[target](generated_path, min_cc, operation_kind, self.args) as operation_kind_emitter:
-          for configuration_name, operations in configurations.items():
+          # Emit configurations in a fixed order such that regenerated sources are identical
+          for configuration_name, operations in sorted(configurations.items()):
             _LOGGER.info(f"Emitting {configuration_name} with {len(operations)} operation{'' if len(operations) == 1 else 's'}.")
             operation_kind_emitter.emit(configuration_name, operations)
 
@@ -858,11 +1025,27 @@ class Manifest:
 
       # Emit top level all_{gemm, conv2d, ...}_operations.cu files
       with kind_emitters[target](generated_path, operation_kind, self.args) as operation_kind_emitter:
-        operation_kind_emitter.emit(ops)
+        operation_kind_emitter.emit(ops, source_files[operation_kind])
 
     # write the manifest.cmake file containing paths from all targets
     manifest_path = os.path.join(generated_path, "manifest.cmake")
 
     self.emit_manifest_cmake(manifest_path, top_level_path, source_files)
 
+    self.remove_stale_files(generated_path)
+
+  #
+  def remove_stale_files(self, generated_path):
+    """
+    Removes files and directories under generated_path not written by the current run
+    """
+    for dirpath, dirnames, filenames in os.walk(generated_path, topdown=False):
+      for filename in filenames:
+        path = os.path.join(dirpath, filename)
+        if os.path.abspath(path) not in GeneratedFile.written:
+          _LOGGER.debug(f"Removing stale generated file {path}")
+          os.remove(path)
+      if dirpath != generated_path and not os.listdir(dirpath):
+        os.rmdir(dirpath)
+
 ###################################################################################################
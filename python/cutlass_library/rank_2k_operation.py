@@ -60,7 +60,8 @@ class Rank2KOperation:
   #
   def __init__(self, rank_k_kind, arch, tile_description, A, C, element_epilogue, \
       epilogue_functor = EpilogueFunctor.LinearCombination, swizzling_functor = SwizzlingFunctor.Identity8, \
-      blas_mode = BlasMode.symmetric):
+      blas_mode = BlasMode.symmetric, kernel_schedule = KernelScheduleType.ScheduleAuto, \
+      epilogue_schedule = EpilogueScheduleType.ScheduleAuto):
 
     self.blas_mode = blas_mode
     self.operation_kind = OperationKind.Rank2K
@@ -74,6 +75,8 @@ class Rank2KOperation:
     self.element_epilogue = element_epilogue
     self.epilogue_functor = epilogue_functor
     self.swizzling_functor = swizzling_functor
+    self.kernel_schedule = kernel_schedule
+    self.epilogue_schedule = epilogue_schedule
 
   #
   def is_complex(self):
@@ -183,7 +186,7 @@ class Rank2KOperation:
 
     alignment = max([self.A.alignment, self.C.alignment])
 
-    return SubstituteTemplate(
+    name = SubstituteTemplate(
       "cutlass_${opcode_class}_${extended_name}_${threadblock}_${layout}_${fill_mode}_align${alignment}",
       {
         'opcode_class': opcode_class_name,
@@ -195,6 +198,11 @@ class Rank2KOperation:
       }
     )
 
+    if self.rank_k_kind == RankKKind.Universal3x:
+      name += KernelScheduleSuffixes[self.kernel_schedule] + EpilogueScheduleSuffixes[self.epilogue_schedule]
+
+    return name
+
   #
   def configuration_name(self):
     ''' The full procedural name indicates architecture, extended name, tile size, and layout. '''
@@ -317,6 +325,88 @@ using Operation_${operation_name} =
 
     return SubstituteTemplate(rank_k_template, values)
 
+#
+class EmitRank2KUniversal3xInstance:
+  ''' Responsible for emitting a CUTLASS 3.x template definition'''
+
+  def __init__(self, rank = 2):
+    self.rank = rank
+    self.rank_k_template = """
+using ${operation_name}_epilogue =
+  typename cutlass::epilogue::collective::CollectiveBuilder<
+    ${arch}, ${opcode_class},
+    cute::Shape<cute::_${tile_shape_m}, cute::_${tile_shape_n}, cute::_${tile_shape_k}>,
+    cute::Shape<cute::_${cluster_shape_m}, cute::_${cluster_shape_n}, cute::_${cluster_shape_k}>,
+    cutlass::epilogue::collective::EpilogueTileAuto,
+    ${element_accumulator}, ${element_epilogue},
+    ${element_c}, ${layout_c}, ${align_c},
+    ${element_c}, ${layout_c}, ${align_c},
+    ${epilogue_schedule},
+    cutlass::epilogue::fusion::LinCombTriangular<${fill_mode}, ${element_c}, ${element_epilogue}>
+  >::CollectiveOp;
+
+using ${operation_name}_mainloop =
+  typename cutlass::gemm::collective::CollectiveBuilder<
+    ${arch}, ${opcode_class},
+    ${element_a}, ${layout_a}, ${align_a},
+    ${element_a}, ${layout_b}, ${align_a},
+    ${element_accumulator},
+    cute::Shape<cute::_${tile_shape_m}, cute::_${tile_shape_n}, cute::_${tile_shape_k}>,
+    cute::Shape<cute::_${cluster_shape_m}, cute::_${cluster_shape_n}, cute::_${cluster_shape_k}>,
+    cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename ${operation_name}_epilogue::SharedStorage))>,
+    ${kernel_schedule}
+  >::CollectiveOp;
+
+// ${operation_description} operator ${operation_name}
+using ${operation_name}_base = cutlass::gemm::kernel::GemmUniversal<
+    cute::Shape<int,int,int,int>,
+    ${operation_name}_mainloop,
+    ${operation_name}_epilogue,
+    cutlass::gemm::TriangularScheduler<${fill_mode}>>;
+
+// Define named type
+struct ${operation_name} :
+  public ${operation_name}_base { };
+
+using Operation_${operation_name} = cutlass::gemm::device::GemmUniversalAdapter<${operation_name}>;
+"""
+
+  def emit(self, operation):
+
+    tile_shape = operation.tile_description.threadblock_shape
+    cluster_shape = operation.tile_description.cluster_shape
+
+    # The (N,K) B operand of the kernel is A itself, a K-major A is a K-major B
+    layout_b = TransposedLayout[operation.A.layout]
+
+    values = {
+      'operation_name': operation.procedural_name(),
+      'operation_description': 'Rank 2K' if self.rank == 2 else 'Rank K',
+      'element_a': DataTypeTag[operation.A.element],
+      'layout_a': LayoutTag[operation.A.layout],
+      'layout_b': LayoutTag[layout_b],
+      'align_a': str(operation.A.alignment),
+      'element_c': DataTypeTag[operation.C.element],
+      'layout_c': LayoutTag[operation.C.layout],
+      'align_c': str(operation.C.alignment),
+      'fill_mode': FillModeTag[operation.C.fill_mode],
+      'element_accumulator': DataTypeTag[operation.accumulator_type()],
+      'element_epilogue': DataTypeTag[operation.element_epilogue],
+      'opcode_class': OpcodeClassTag[operation.tile_description.math_instruction.opcode_class],
+      'arch': "cutlass::arch::Sm%d" % operation.arch,
+      'tile_shape_m': str(tile_shape[0]),
+      'tile_shape_n': str(tile_shape[1]),
+      'tile_shape_k': str(tile_shape[2]),
+      'cluster_shape_m': str(cluster_shape[0]),
+      'cluster_shape_n': str(cluster_shape[1]),
+      'cluster_shape_k': str(cluster_shape[2]),
+      'kernel_schedule': KernelScheduleTag[operation.kernel_schedule],
+      'epilogue_schedule': EpilogueScheduleTag[operation.epilogue_schedule],
+    }
+
+    return SubstituteTemplate(self.rank_k_template, values)
+
+
 ###################################################################################################
 
 
@@ -333,10 +423,12 @@ class EmitRank2KConfigurationLibrary:
 
     self.instance_emitter = {
       RankKKind.Universal: EmitRank2KUniversalInstance,
+      RankKKind.Universal3x: EmitRank2KUniversal3xInstance,
     }
 
     self.rank_k_kind_wrappers = {
       RankKKind.Universal: 'Rank2KOperation',
+      RankKKind.Universal3x: 'RankKOperation3x',
     }
 
     self.instance_template = {
@@ -346,6 +438,11 @@ ${compile_guard_start}
     Operation_${operation_name}
   >("${operation_name}"));
 ${compile_guard_end}
+""",
+      RankKKind.Universal3x: """
+  manifest.append(new ${rank_k_kind}<
+    Operation_${operation_name}, 2
+  >("${operation_name}"));
 """
     }
 
@@ -361,6 +458,14 @@ ${compile_guard_end}
 
 #include "library_internal.h"
 #include "rank_2k_operation.h"
+#include "rank_k_operation_3x.hpp"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/fusion/operations.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -392,7 +497,7 @@ void initialize_${configuration_name}(Manifest &manifest) {
 """
 
   def __enter__(self):
-    self.configuration_file = open(self.configuration_path, "w")
+    self.configuration_file = GeneratedFile(self.configuration_path)
     self.configuration_file.write(self.header_template)
 
     self.instance_definitions = []
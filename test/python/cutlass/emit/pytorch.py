@@ -150,6 +150,20 @@ class PyTorchExtensionTest(unittest.TestCase):
         D = mod.run(A, B, C, alpha, beta)
         assert torch.allclose(D, D_ref)
 
+        D = torch.empty_like(C)
+        D_out = mod.run(A, B, C, alpha, beta, out=D)
+        assert D_out.data_ptr() == D.data_ptr()
+        assert torch.allclose(D, D_ref)
+
+        # Capture into a CUDA graph on a side stream, as required by PyTorch
+        D.zero_()
+        graph = torch.cuda.CUDAGraph()
+        with torch.cuda.graph(graph):
+            mod.run(A, B, C, alpha, beta, out=D)
+        graph.replay()
+        torch.cuda.synchronize()
+        assert torch.allclose(D, D_ref)
+
     def test_grouped_gemm(self):
         random.seed(2023)
 
@@ -185,6 +199,23 @@ class PyTorchExtensionTest(unittest.TestCase):
         Ds = mod.run(As, Bs, Cs, alpha, beta)
         check_all(Ds, Ds_ref)
 
+        Ds = [torch.empty_like(c) for c in Cs]
+        Ds_out = mod.run(As, Bs, Cs, alpha, beta, out=Ds)
+        assert all(x.data_ptr() == y.data_ptr() for x, y in zip(Ds_out, Ds))
+        check_all(Ds, Ds_ref)
+
+        # Arguments copied to the device during capture must remain valid for every replay,
+        # including after later calls have reused the cached argument buffers
+        for D in Ds:
+            D.zero_()
+        graph = torch.cuda.CUDAGraph()
+        with torch.cuda.graph(graph):
+            mod.run(As, Bs, Cs, alpha, beta, out=Ds)
+        mod.run(As[::-1], Bs[::-1], Cs[::-1], alpha, beta)
+        graph.replay()
+        torch.cuda.synchronize()
+        check_all(Ds, Ds_ref)
+
     def test_conv2d_fprop(self):
         torch.manual_seed(2023)
 
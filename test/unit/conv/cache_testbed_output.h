@@ -447,6 +447,11 @@ inline std::string LayoutTypeName<cutlass::layout::TensorNHWC>() {
   return "nhwc";
 }
 
+template <>
+inline std::string LayoutTypeName<cutlass::layout::TensorNCHW>() {
+  return "nchw";
+}
+
 template <>
 inline std::string LayoutTypeName<cutlass::layout::TensorNCxHWx<32>>() {
   return "nc32hw32";
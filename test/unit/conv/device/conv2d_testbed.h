@@ -428,7 +428,8 @@ public:
       tensor_C.host_ref(),
       tensor_D_reference.host_ref(),
       alpha, 
-      beta);
+      beta,
+      0 /* num_threads, all hardware threads */);
 
 #endif
 
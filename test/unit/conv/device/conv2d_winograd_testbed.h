@@ -0,0 +1,382 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Winograd Conv2d fprop testbed
+*/
+#pragma once
+
+#include <fstream>
+
+#include "../../common/cutlass_unit_test.h"
+#include "conv2d_problems.h"
+#include "cutlass/conv/device/winograd_convolution.h"
+
+#include "cutlass/core_io.h"
+#include "cutlass/cutlass.h"
+#include "cutlass/util/host_tensor.h"
+#include "cutlass/util/reference/host/convolution.h"
+#include "cutlass/util/reference/host/tensor_compare.h"
+#include "cutlass/util/reference/host/tensor_fill.h"
+#include "cutlass/util/reference/host/tensor_reduce.h"
+#include "cutlass/util/tensor_view_io.h"
+
+namespace test {
+namespace conv {
+namespace device {
+
+template <typename Conv2d>
+class TestbedWinogradConv2d {
+ public:
+
+  using ElementA = typename Conv2d::ElementA;
+  using LayoutA = typename Conv2d::LayoutA;
+  using ElementB = typename Conv2d::ElementB;
+  using LayoutB = typename Conv2d::LayoutB;
+  using ElementC = typename Conv2d::ElementC;
+  using LayoutC = typename Conv2d::LayoutC;
+  using ElementAccumulator = typename Conv2d::ElementAccumulator;
+  using ElementCompute = typename Conv2d::ElementCompute;
+  using EpilogueOutputOp = typename Conv2d::EpilogueOutputOp;
+
+  static cutlass::conv::Operator const kConvolutionalOperator = Conv2d::kConvolutionalOperator;
+
+ public:
+  /// Initialization
+  cutlass::Distribution::Kind init_A;
+  cutlass::Distribution::Kind init_B;
+  cutlass::Distribution::Kind init_C;
+  uint64_t seed;
+
+  /// Tolerated relative Frobenius norm error, zero requires bitwise equality. F(2x2, 3x3) is exact
+  /// for the integer-valued inputs used here, while the fractional F(4x4, 3x3) filter transform
+  /// rounds the transformed filter to the input precision.
+  double epsilon;
+
+  cutlass::HostTensor<ElementA, LayoutA> tensor_A;
+  cutlass::HostTensor<ElementB, LayoutB> tensor_B;
+  cutlass::HostTensor<ElementC, LayoutC> tensor_C;
+  cutlass::HostTensor<ElementC, LayoutC> tensor_D_computed;
+  cutlass::HostTensor<ElementC, LayoutC> tensor_D_reference;
+
+  int tested_problem_count;
+
+ public:
+  TestbedWinogradConv2d(cutlass::Distribution::Kind init_A_ = cutlass::Distribution::Uniform,
+                        cutlass::Distribution::Kind init_B_ = cutlass::Distribution::Uniform,
+                        cutlass::Distribution::Kind init_C_ = cutlass::Distribution::Uniform,
+                        uint64_t seed_ = 2080)
+      : init_A(init_A_), init_B(init_B_), init_C(init_C_), seed(seed_),
+        epsilon(Conv2d::kOutputTile == 2 ? 0.0 : 1e-2), tested_problem_count(0) {}
+
+  /// Helper to initialize a tensor view
+  template <typename Element, typename Layout>
+  void initialize_tensor(cutlass::TensorView<Element, Layout> view,
+                         cutlass::Distribution::Kind dist_kind,
+                         uint64_t seed) {
+    if (dist_kind == cutlass::Distribution::Uniform) {
+      int scope;
+      int bits = cutlass::sizeof_bits<Element>::value;
+
+      if (bits <= 8) {
+        scope = 2;
+      } else if (bits == 16) {
+        scope = 5;
+      } else {
+        scope = 8;
+      }
+      cutlass::reference::host::TensorFillRandomUniform(view, seed, scope, -scope, 0);
+    } else if (dist_kind == cutlass::Distribution::Identity) {
+      cutlass::reference::host::TensorFillIdentity(view);
+    } else if (dist_kind == cutlass::Distribution::Gaussian) {
+      cutlass::reference::host::TensorFillRandomGaussian(view, seed, 0, 0.5);
+    } else if (dist_kind == cutlass::Distribution::Sequential) {
+      cutlass::reference::host::BlockFillSequential(view.data(), view.capacity());
+    } else {
+    }
+  }
+
+  void initialize(cutlass::conv::Conv2dProblemSize const &problem_size, uint64_t seed = 2019) {
+    tensor_A.resize(implicit_gemm_tensor_a_extent(kConvolutionalOperator, problem_size));
+    tensor_B.resize(implicit_gemm_tensor_b_extent(kConvolutionalOperator, problem_size));
+    tensor_C.resize(implicit_gemm_tensor_c_extent(kConvolutionalOperator, problem_size));
+    tensor_D_computed.resize(implicit_gemm_tensor_c_extent(kConvolutionalOperator, problem_size));
+    tensor_D_reference.resize(implicit_gemm_tensor_c_extent(kConvolutionalOperator, problem_size));
+
+    initialize_tensor(tensor_A.host_view(), init_A, seed);
+    initialize_tensor(tensor_B.host_view(), init_B, seed * 17);
+    initialize_tensor(tensor_C.host_view(), init_C, seed * 39);
+
+    tensor_A.sync_device();
+    tensor_B.sync_device();
+    tensor_C.sync_device();
+    tensor_D_computed.sync_device();
+    tensor_D_reference.sync_device();
+  }
+
+  bool sufficient() const {
+    //
+    // Determine SMEM requirements and waive if not satisfied
+    //
+
+    size_t smem_size = sizeof(typename Conv2d::UnderlyingKernel::SharedStorage);
+
+    cudaDeviceProp properties;
+    int device_idx;
+    cudaError_t result = cudaGetDevice(&device_idx);
+
+    if (result != cudaSuccess) {
+      throw std::runtime_error("cudaGetDevice() API call failed.");
+    }
+
+    result = cudaGetDeviceProperties(&properties, device_idx);
+
+    if (result != cudaSuccess) {
+      throw std::runtime_error("cudaGetDeviceProperties() failed");
+    }
+
+    if (properties.sharedMemPerBlockOptin < smem_size) {
+      return false;
+    }
+
+    return true;
+  }
+
+  /// Executes one test
+  bool run(cutlass::conv::Conv2dProblemSize const &problem_size,
+           ElementCompute alpha = ElementCompute(1),
+           ElementCompute beta = ElementCompute(0)) {
+
+    // Waive test if insufficient CUDA device
+    if (!sufficient()) {
+      if (CUTLASS_TEST_UNIT_ENABLE_WARNINGS) {
+        std::cerr << "Test waived due to insufficient CUDA device." << std::endl;
+      }
+      return true;
+    }
+
+    // increment tested problem count run by the testbed
+    tested_problem_count++;
+
+    initialize(problem_size);
+
+    // configure the operator
+    Conv2d conv2d_op;
+
+    typename Conv2d::Arguments conv2d_args(problem_size,
+                                           tensor_A.device_ref(),
+                                           tensor_B.device_ref(),
+                                           tensor_C.device_ref(),
+                                           tensor_D_computed.device_ref(),
+                                           {alpha, beta});
+
+    cutlass::Status status = conv2d_op.can_implement(conv2d_args);
+
+    EXPECT_TRUE(status == cutlass::Status::kSuccess);
+    if (status != cutlass::Status::kSuccess) {
+      return false;
+    }
+
+    // the workspace holds the transformed filter
+    size_t workspace_size = Conv2d::get_workspace_size(conv2d_args);
+
+    cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
+
+    status = conv2d_op.initialize(conv2d_args, workspace.get());
+
+    EXPECT_TRUE(status == cutlass::Status::kSuccess);
+    if (status != cutlass::Status::kSuccess) {
+      return false;
+    }
+
+    // run conv2d operator
+    status = conv2d_op();
+
+    EXPECT_TRUE(status == cutlass::Status::kSuccess);
+    if (status != cutlass::Status::kSuccess) {
+      return false;
+    }
+
+    cudaError_t result = cudaDeviceSynchronize();
+    EXPECT_EQ(result, cudaSuccess) << " device reference error: " << cudaGetErrorString(result);
+
+    tensor_D_computed.sync_host();
+
+    cutlass::reference::host::Conv2d<ElementA,
+                                     LayoutA,
+                                     ElementB,
+                                     LayoutB,
+                                     ElementC,
+                                     LayoutC,
+                                     ElementCompute,
+                                     ElementAccumulator>(kConvolutionalOperator,
+                                                         problem_size,
+                                                         tensor_A.host_ref(),
+                                                         tensor_B.host_ref(),
+                                                         tensor_C.host_ref(),
+                                                         tensor_D_reference.host_ref(),
+                                                         alpha,
+                                                         beta);
+
+    bool passed = false;
+
+    if (epsilon == 0) {
+      passed = cutlass::reference::host::TensorEquals(
+        tensor_D_computed.host_view(),
+        tensor_D_reference.host_view());
+    }
+    else {
+      double norm_reference = cutlass::reference::host::TensorNorm(tensor_D_reference.host_view());
+      double norm_diff = cutlass::reference::host::TensorNormDiff(
+        tensor_D_computed.host_view(),
+        tensor_D_reference.host_view());
+
+      passed = norm_diff <= epsilon * norm_reference;
+    }
+
+    EXPECT_TRUE(passed);
+
+    if (!passed) {
+      std::stringstream fname;
+
+      fname << "error_Conv2d_Winograd_device_fprop_"
+            << "nhwc_"
+            << problem_size.N << "x"
+            << problem_size.H << "x"
+            << problem_size.W << "x"
+            << problem_size.C
+            << "_krsc_"
+            << problem_size.K << "x"
+            << problem_size.R << "x"
+            << problem_size.S << "x"
+            << problem_size.C
+            << "_padding_"
+            << problem_size.pad_h << "x"
+            << problem_size.pad_w << "_"
+            << (problem_size.mode == cutlass::conv::Mode::kCrossCorrelation ? "xcorr_" : "conv_")
+            << "f" << Conv2d::kOutputTile << "x" << Conv2d::kOutputTile << "_"
+            << Conv2d::ThreadblockShape::kM << "x"
+            << Conv2d::ThreadblockShape::kN << "x"
+            << Conv2d::ThreadblockShape::kK << ".txt";
+
+      std::cout << fname.str() << std::endl;
+
+      std::ofstream results(fname.str());
+
+      results << problem_size << std::endl;
+
+      results
+        << "\nA:\n" << tensor_A.host_view() << "\n"
+        << "\nB:\n" << tensor_B.host_view() << "\n"
+        << "\nC:\n" << tensor_C.host_view() << "\n"
+        << "\nD reference:\n" << tensor_D_reference.host_view() << "\n"
+        << "\nD computed:\n" << tensor_D_computed.host_view() << "\n";
+    }
+
+    return passed;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Runs the unit-stride 3x3 problems of the standard conv2d test lists plus sizes that exercise
+/// partial output tiles, channel residues and unpadded inputs
+template <typename Conv2d>
+bool TestAllWinogradConv2d(
+  const Conv2dProblemVector &conv_test_sizes = Conv2dProblemVector()) {
+
+  bool passed = true;
+
+  TestbedWinogradConv2d<Conv2d> testbed;
+
+  TestbedConv2dProblemSizes conv_problems(Conv2d::UnderlyingKernel::kAccessSize);
+
+  Conv2dProblemVector winograd_sizes = {
+    // partial tiles along P and Q
+    cutlass::conv::Conv2dProblemSize({1, 7, 9, 16}, {8, 3, 3, 16}, {1, 1, 1, 1}, {1, 1}, {1, 1}),
+    // no padding, output smaller than one tile
+    cutlass::conv::Conv2dProblemSize({2, 5, 4, 24}, {40, 3, 3, 24}, {0, 0, 0, 0}, {1, 1}, {1, 1}),
+    // channel count not a multiple of the threadblock K
+    cutlass::conv::Conv2dProblemSize({1, 13, 11, 40}, {72, 3, 3, 40}, {1, 1, 1, 1}, {1, 1}, {1, 1}),
+    // asymmetric spatial extent with batching
+    cutlass::conv::Conv2dProblemSize({3, 17, 6, 64}, {64, 3, 3, 64}, {1, 1, 1, 1}, {1, 1}, {1, 1}),
+  };
+
+  std::vector<Conv2dProblemVector const *> problem_vectors = {
+    &conv_test_sizes,
+    &winograd_sizes,
+    &conv_problems.conv2d_default_sizes,
+    &conv_problems.conv2d_resnet50_sizes,
+  };
+
+  for (Conv2dProblemVector const *problem_vector : problem_vectors) {
+    for (auto conv_problem : *problem_vector) {
+
+      typename Conv2d::Arguments args(conv_problem);
+      args.split_k_mode = cutlass::conv::SplitKMode::kSerial;
+
+      // Winograd F(m x m, 3 x 3) only covers unit-stride, non-dilated 3x3 filters
+      if (Conv2d::can_implement(args) != cutlass::Status::kSuccess) {
+        continue;
+      }
+
+      passed = testbed.run(conv_problem);
+
+      if (!passed) {
+        return false;
+      }
+
+      passed = testbed.run(conv_problem.reset_mode(cutlass::conv::Mode::kConvolution));
+
+      if (!passed) {
+        return false;
+      }
+
+      // epilogue with source accumulation
+      passed = testbed.run(conv_problem, 2, 1);
+
+      if (!passed) {
+        return false;
+      }
+    }
+  }
+
+  EXPECT_GT(testbed.tested_problem_count, 0);
+
+  return passed;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace device
+} // namespace conv
+} // namespace test
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
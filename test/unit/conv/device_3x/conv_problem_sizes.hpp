@@ -893,6 +893,48 @@ get_grouped_conv_problem_vector<3, cutlass::conv::Operator::kWgrad>(int GroupsPe
   return problem_shapes;
 }
 
+// Specialization for 2D fprop problems, GroupsPerTile is unused since each CTA tile covers one group
+template<>
+std::vector<cutlass::conv::ConvProblemShape<cutlass::conv::Operator::kFprop, 2>> inline
+get_grouped_conv_problem_vector<2, cutlass::conv::Operator::kFprop>(int GroupsPerTile) {
+  using ProblemShape = cutlass::conv::ConvProblemShape<cutlass::conv::Operator::kFprop, 2>;
+  std::vector<ProblemShape> problem_shapes;
+  // channel_per_group == 64
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {1, 8, 8, 256},   // nhwc
+    {512, 3, 3, 64},  // krsc
+    {1, 1},           // padding lower (pad_h, pad_w)
+    {1, 1},           // padding upper (pad_h, pad_w)
+    {1, 1},           // stride (stride_h, stride_w)
+    {1, 1},           // dilation (dilation_h, dilation_w)
+    4                 // groups
+  });
+  // channel_per_group == 128, strided
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {2, 15, 15, 256}, // nhwc
+    {256, 3, 3, 128}, // krsc
+    {1, 1},           // padding lower (pad_h, pad_w)
+    {1, 1},           // padding upper (pad_h, pad_w)
+    {2, 2},           // stride (stride_h, stride_w)
+    {1, 1},           // dilation (dilation_h, dilation_w)
+    2                 // groups
+  });
+  // channel_per_group == 64, 1x1 filter
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {1, 16, 16, 512}, // nhwc
+    {1024, 1, 1, 64}, // krsc
+    {0, 0},           // padding lower (pad_h, pad_w)
+    {0, 0},           // padding upper (pad_h, pad_w)
+    {1, 1},           // stride (stride_h, stride_w)
+    {1, 1},           // dilation (dilation_h, dilation_w)
+    8                 // groups
+  });
+  return problem_shapes;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 // Unit Stride Dgrad
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1380,6 +1422,135 @@ get_conv_problem_vector<3, cutlass::conv::Operator::kDgrad, true>() {
   return problem_shapes;
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+// Strided Dgrad, decomposed into unit-stride stride phases
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<int SpatialDim>
+std::vector<cutlass::conv::ConvProblemShape<cutlass::conv::Operator::kDgrad, SpatialDim>>
+inline
+get_strided_dgrad_problem_vector();
+
+// Specialization for 2D dgrad problems
+template<>
+std::vector<cutlass::conv::ConvProblemShape<cutlass::conv::Operator::kDgrad, 2>> inline
+get_strided_dgrad_problem_vector<2>() {
+  using ProblemShape = cutlass::conv::ConvProblemShape<cutlass::conv::Operator::kDgrad, 2>;
+  std::vector<ProblemShape> problem_shapes;
+  // 3x3 filter, stride 2
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {1, 16, 16, 64},  // nhwc
+    {64, 3, 3, 64},   // krsc
+    {1, 1},           // padding lower (pad_h, pad_w)
+    {1, 1},           // padding upper (pad_h, pad_w)
+    {2, 2},           // stride (stride_h, stride_w)
+    {1, 1},           // dilation (dilation_h, dilation_w)
+    1                 // groups
+  });
+  // 4x4 filter, stride 2, the upsampling layer of a decoder
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {2, 16, 16, 64},  // nhwc
+    {128, 4, 4, 64},  // krsc
+    {1, 1},           // padding lower (pad_h, pad_w)
+    {1, 1},           // padding upper (pad_h, pad_w)
+    {2, 2},           // stride (stride_h, stride_w)
+    {1, 1},           // dilation (dilation_h, dilation_w)
+    1                 // groups
+  });
+  // 1x1 filter, stride 2, odd extents: three of four stride phases have no filter tap
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {1, 15, 15, 128}, // nhwc
+    {64, 1, 1, 128},  // krsc
+    {0, 0},           // padding lower (pad_h, pad_w)
+    {0, 0},           // padding upper (pad_h, pad_w)
+    {2, 2},           // stride (stride_h, stride_w)
+    {1, 1},           // dilation (dilation_h, dilation_w)
+    1                 // groups
+  });
+  // 5x3 filter, asymmetric stride and padding
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {1, 19, 13, 64},  // nhwc
+    {64, 5, 3, 64},   // krsc
+    {2, 1},           // padding lower (pad_h, pad_w)
+    {1, 0},           // padding upper (pad_h, pad_w)
+    {3, 2},           // stride (stride_h, stride_w)
+    {1, 1},           // dilation (dilation_h, dilation_w)
+    1                 // groups
+  });
+  // 3x3 filter, stride divides dilation: odd rows have no filter tap
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {1, 17, 16, 64},  // nhwc
+    {64, 3, 3, 64},   // krsc
+    {2, 1},           // padding lower (pad_h, pad_w)
+    {2, 1},           // padding upper (pad_h, pad_w)
+    {2, 1},           // stride (stride_h, stride_w)
+    {2, 1},           // dilation (dilation_h, dilation_w)
+    1                 // groups
+  });
+  return problem_shapes;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+// Fprop over a 2x upsampled activation, nhwc is the upsampled extent
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<cutlass::conv::ConvProblemShape<cutlass::conv::Operator::kFprop, 2>>
+inline
+get_upsample_conv_problem_vector() {
+  using ProblemShape = cutlass::conv::ConvProblemShape<cutlass::conv::Operator::kFprop, 2>;
+  std::vector<ProblemShape> problem_shapes;
+  // decoder block, 3x3 filter, same padding
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {2, 16, 16, 64},  // nhwc
+    {128, 3, 3, 64},  // krsc
+    {1, 1},           // padding lower (pad_h, pad_w)
+    {1, 1},           // padding upper (pad_h, pad_w)
+    {1, 1},           // stride (stride_h, stride_w)
+    {1, 1},           // dilation (dilation_h, dilation_w)
+    1                 // groups
+  });
+  // non-square, partial M and N tiles
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {1, 10, 22, 128}, // nhwc
+    {96, 3, 3, 128},  // krsc
+    {1, 1},           // padding lower (pad_h, pad_w)
+    {1, 1},           // padding upper (pad_h, pad_w)
+    {1, 1},           // stride (stride_h, stride_w)
+    {1, 1},           // dilation (dilation_h, dilation_w)
+    1                 // groups
+  });
+  // strided and dilated taps
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {1, 12, 12, 64},  // nhwc
+    {64, 3, 3, 64},   // krsc
+    {2, 2},           // padding lower (pad_h, pad_w)
+    {2, 2},           // padding upper (pad_h, pad_w)
+    {2, 1},           // stride (stride_h, stride_w)
+    {2, 2},           // dilation (dilation_h, dilation_w)
+    1                 // groups
+  });
+  // 1x1 filter
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {1, 8, 8, 64},    // nhwc
+    {64, 1, 1, 64},   // krsc
+    {0, 0},           // padding lower (pad_h, pad_w)
+    {0, 0},           // padding upper (pad_h, pad_w)
+    {1, 1},           // stride (stride_h, stride_w)
+    {1, 1},           // dilation (dilation_h, dilation_w)
+    1                 // groups
+  });
+  return problem_shapes;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 } // namespace cutlass::test
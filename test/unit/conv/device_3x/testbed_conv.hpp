@@ -136,6 +136,89 @@ template <class Conv>
 struct SparseConvParams {
 };
 
+// Fprop kernels reading a 2x upsampled view of a low resolution activation
+template <class Conv, class = void>
+struct IsUpsampleConv : cute::false_type {};
+
+template <class Conv>
+struct IsUpsampleConv<Conv, cute::void_t<decltype(Conv::DispatchPolicy::Upsample)>> : cute::true_type {};
+
+template <class Conv>
+struct UpsampleConvParams {
+  using ElementA = typename Conv::ConvKernel::ElementA;
+  using ElementB = typename Conv::ConvKernel::ElementB;
+
+  static constexpr cutlass::conv::Operator ConvOp = Conv::DispatchPolicy::ConvOp;
+  static constexpr int NumSpatialDimensions = Conv::NumSpatialDimensions;
+  using ProblemShape = cutlass::conv::ConvProblemShape<ConvOp, NumSpatialDimensions>;
+
+  thrust::universal_vector<ElementA> tensor_A_input;
+
+  // Fills the [N,H,W,C] input and writes its upsampled [N,2H,2W,C] view into tensor_A,
+  // which the reference convolution reads
+  bool initialize(
+    ProblemShape const& problem_shape,
+    thrust::universal_vector<ElementA>& tensor_A,
+    uint64_t seed) {
+    int N = problem_shape.shape_A[0];
+    int H = problem_shape.shape_A[1] / 2;
+    int W = problem_shape.shape_A[2] / 2;
+    int C = problem_shape.shape_A[3];
+    tensor_A_input.resize(size_t(N) * H * W * C);
+    initialize_values(tensor_A_input, cutlass::Distribution::Uniform, seed);
+
+    auto input = [&](int n, int h, int w, int c) {
+      return static_cast<float>(tensor_A_input[((size_t(n) * H + h) * W + w) * C + c]);
+    };
+    // half-pixel centers, clamped to the edge
+    auto taps = [](int x, int extent, int& i0, int& i1, float& w1) {
+      int i = x / 2;
+      if (x % 2) {
+        i0 = i; i1 = std::min(i + 1, extent - 1); w1 = 0.25f;
+      }
+      else {
+        i0 = std::max(i - 1, 0); i1 = i; w1 = 0.75f;
+      }
+    };
+
+    for (int n = 0; n < N; ++n) {
+      for (int h = 0; h < 2 * H; ++h) {
+        for (int w = 0; w < 2 * W; ++w) {
+          for (int c = 0; c < C; ++c) {
+            float value;
+            if constexpr (Conv::DispatchPolicy::Upsample == cutlass::conv::UpsampleMode::kNearest) {
+              value = input(n, h / 2, w / 2, c);
+            }
+            else {
+              int h0, h1, w0, w1;
+              float wh, ww;
+              taps(h, H, h0, h1, wh);
+              taps(w, W, w0, w1, ww);
+              float top    = input(n, h0, w0, c) + ww * (input(n, h0, w1, c) - input(n, h0, w0, c));
+              float bottom = input(n, h1, w0, c) + ww * (input(n, h1, w1, c) - input(n, h1, w0, c));
+              value = top + wh * (bottom - top);
+            }
+            tensor_A[((size_t(n) * 2 * H + h) * 2 * W + w) * C + c] = ElementA(value);
+          }
+        }
+      }
+    }
+    return true;
+  }
+
+  auto get_mainloop_arguments(
+    [[maybe_unused]] ProblemShape const& problem_shape,
+    [[maybe_unused]] thrust::universal_vector<ElementA>& tensor_A,
+    thrust::universal_vector<ElementB>& tensor_B
+  ) {
+    auto args = typename Conv::ConvKernel::MainloopArguments {
+      tensor_A_input.data().get(),
+      tensor_B.data().get(),
+    };
+    return args;
+  }
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 template <class Conv, bool isSparseEnabled_ = false>
 struct ConvTestbed {
@@ -149,7 +232,9 @@ struct ConvTestbed {
 
   // ConvTest for sparse kernel
   static constexpr bool isSparseEnabled = isSparseEnabled_;
-  using ConvParams = cute::conditional_t<isSparseEnabled, SparseConvParams<Conv>, DenseConvParams<Conv>>;
+  static constexpr bool isUpsampleEnabled = IsUpsampleConv<Conv>::value;
+  using ConvParams = cute::conditional_t<isSparseEnabled, SparseConvParams<Conv>,
+                     cute::conditional_t<isUpsampleEnabled, UpsampleConvParams<Conv>, DenseConvParams<Conv>>>;
   ConvParams params;
 
   //
@@ -178,6 +263,10 @@ struct ConvTestbed {
 
   static constexpr bool IsResidualEnabled = cutlass::epilogue::collective::detail::IsThreadEpilogueOpWithResidualAdd<FusionOp>::value;
 
+  // Per-channel scaled ops with amax quantize their output with scale_d for any output type
+  static constexpr bool IsOutputQuantEnabled = IsPerChannelScaleEnabled && FusionOp::IsAbsMaxSupported;
+  using ElementAmax = non_void_t<typename FusionOp::ElementAmax, ElementCompute>;
+
   using StrideC  = typename Conv::ConvKernel::StrideC;
   using StrideD  = typename Conv::ConvKernel::StrideD;
   using ThreadEpilogueOp = typename Conv::ConvKernel::CollectiveEpilogue::ThreadEpilogueOp;
@@ -208,6 +297,8 @@ struct ConvTestbed {
   thrust::universal_vector<ElementBias> tensor_bias;
   thrust::universal_vector<ElementScalar> tensor_alpha;
   thrust::universal_vector<ElementScalar> tensor_beta;
+  thrust::universal_vector<ElementAmax> abs_max_D;
+  ElementScalar scale_d = ElementScalar(1);
 
   // Return true on success, else false
   bool initialize(ProblemShape const& problem_shape, uint64_t seed = 6090) {
@@ -239,6 +330,9 @@ struct ConvTestbed {
     if constexpr (isSparseEnabled) {
       flag &= params.initialize(problem_shape, tensor_B, static_cast<int>(seed + 2023));
     }
+    else if constexpr (isUpsampleEnabled) {
+      flag &= params.initialize(problem_shape, tensor_A, seed);
+    }
 
     return flag;
   }
@@ -401,13 +495,13 @@ struct ConvTestbed {
       stride_D,
     };
 
-    auto args = typename Conv::Arguments {
+    auto args = cutlass::conv::kernel::make_conv_arguments<typename Conv::ConvKernel>(
       problem_shape,
       mainloop_args, // MainloopArguments
       epilogue_args, // EpilogueArguments
       hw_info,
       scheduler_args
-    };
+    );
 
     auto &fusion_args = args.epilogue.thread;
 
@@ -419,6 +513,12 @@ struct ConvTestbed {
       fusion_args.beta_ptr = tensor_beta.data().get();
     }
 
+    if constexpr (IsOutputQuantEnabled) {
+      abs_max_D.assign(1, ElementAmax(0));
+      fusion_args.scale_d = scale_d;
+      fusion_args.amax_D_ptr = abs_max_D.data().get();
+    }
+
     if constexpr (IsBiasEnabled) {
       fusion_args.bias_ptr = tensor_bias.data().get();
     }
@@ -515,6 +615,11 @@ struct ConvTestbed {
       epilogue_fusion_params.tensor_bias = mBias;
     }
 
+    if constexpr (IsOutputQuantEnabled) {
+      epilogue_fusion_params.scale_d = scale_d;
+      epilogue_fusion_params.compute_abs_max_D = true;
+    }
+
     auto padding = cute::reverse(problem_shape.lower_padding);
     auto tstride = cute::reverse(problem_shape.traversal_stride);
     auto dilation = cute::reverse(problem_shape.dilation);
@@ -605,6 +710,20 @@ struct ConvTestbed {
       passed = compare_reference(mD_ref, mD_computed, mA, mB, mAlpha, mBeta, mBias, this->epsilon);
     #endif
 
+    if constexpr (IsOutputQuantEnabled) {
+      // amax is not part of the cached result, recompute the reference if needed
+      if (cached_result_loaded && passed) {
+        reference_impl.compute_reference();
+      }
+      auto ref = static_cast<float>(epilogue_fusion_params.abs_max_D);
+      auto act = static_cast<float>(ElementAmax(abs_max_D[0]));
+      auto abs_error = std::abs(act - ref);
+      if (std::isnan(abs_error) || abs_error > std::max(this->epsilon, 1e-5f) * std::max(std::abs(ref), 1.0f)) {
+        passed = false;
+        printf("amax_D: %f, %f\n", ref, act);
+      }
+    }
+
     EXPECT_TRUE(passed);
     return passed;
   }
@@ -763,6 +882,97 @@ bool TestAllConv(double alpha = 1.0, double beta = 0.0, float epsilon = 0.0f,
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+template <typename Conv>
+bool TestAllGroupConv(double alpha = 1.0, double beta = 0.0, float epsilon = 0.0f, int GroupsPerTile = 1) {
+  using ElementScalar = typename Conv::EpilogueOutputOp::ElementScalar;
+
+  bool passed = true;
+  ConvTestbed<Conv> testbed;
+  testbed.epsilon = epsilon;
+  auto problem_vector = get_grouped_conv_problem_vector<
+      Conv::NumSpatialDimensions, Conv::DispatchPolicy::ConvOp>(GroupsPerTile);
+
+  for (auto conv_problem : problem_vector) {
+    #if CUTLASS_DEBUG_TRACE_LEVEL > 0
+    print(conv_problem);
+    #endif
+
+    passed = testbed.run(
+      conv_problem,
+      cutlass::from_real<ElementScalar>(alpha),
+      cutlass::from_real<ElementScalar>(beta));
+
+    if (!passed) {
+      printf("Failed test for "); print(conv_problem);
+      return false;
+    }
+  }
+
+  return passed;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename Conv>
+bool TestAllStridedDgradConv(double alpha = 1.0, double beta = 0.0, float epsilon = 0.0f) {
+  using ElementScalar = typename Conv::EpilogueOutputOp::ElementScalar;
+
+  bool passed = true;
+  ConvTestbed<Conv> testbed;
+  testbed.epsilon = epsilon;
+  auto problem_vector = get_strided_dgrad_problem_vector<Conv::NumSpatialDimensions>();
+
+  for (auto conv_problem : problem_vector) {
+    #if CUTLASS_DEBUG_TRACE_LEVEL > 0
+    print(conv_problem);
+    #endif
+
+    passed = testbed.run(
+      conv_problem,
+      cutlass::from_real<ElementScalar>(alpha),
+      cutlass::from_real<ElementScalar>(beta));
+
+    if (!passed) {
+      printf("Failed test for "); print(conv_problem);
+      return false;
+    }
+  }
+
+  return passed;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename Conv>
+bool TestAllUpsampleConv(double alpha = 1.0, double beta = 0.0, float epsilon = 0.0f) {
+  using ElementScalar = typename Conv::EpilogueOutputOp::ElementScalar;
+
+  bool passed = true;
+  ConvTestbed<Conv> testbed;
+  testbed.epsilon = epsilon;
+  auto problem_vector = get_upsample_conv_problem_vector();
+
+  for (auto conv_problem : problem_vector) {
+    #if CUTLASS_DEBUG_TRACE_LEVEL > 0
+    print(conv_problem);
+    #endif
+
+    passed = testbed.run(
+      conv_problem,
+      cutlass::from_real<ElementScalar>(alpha),
+      cutlass::from_real<ElementScalar>(beta));
+
+    if (!passed) {
+      printf("Failed test for "); print(conv_problem);
+      return false;
+    }
+  }
+
+  return passed;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 } // namespace test::conv::device
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -32,9 +32,14 @@
     \brief Unit tests for conversion operators.
 */
 
+#include <cmath>
+#include <cstring>
+#include <vector>
+
 #include "../common/cutlass_unit_test.h"
 
 #include "cutlass/numeric_conversion.h"
+#include "cutlass/philox.h"
 
 #include "cutlass/layout/matrix.h"
 #include "cutlass/util/host_tensor.h"
@@ -153,6 +158,64 @@ void run_test_with_scalefactor(const char dest_name[], const char source_name[],
   }
 }
 
+/// Stochastically rounds `source` once per element of every thread's fragment
+template <typename Destination, int Count>
+__global__ void convert_stochastic_round(
+  cutlass::Array<Destination, Count> *destination,
+  float source,
+  uint64_t seed) {
+
+  cutlass::Array<float, Count> frg_source;
+  frg_source.fill(source);
+
+  cutlass::Philox4x32_10 rng(seed, 0, threadIdx.x + blockIdx.x * blockDim.x);
+  cutlass::Array<uint32_t, Count> random_bits;
+  for (int i = 0; i < Count; i += 4) {
+    auto words = rng();
+    for (int j = 0; j < 4 && i + j < Count; ++j) {
+      random_bits[i + j] = words[j];
+    }
+  }
+
+  cutlass::NumericArrayConverterStochasticRound<Destination, float, Count> convert;
+  destination[threadIdx.x + blockIdx.x * blockDim.x] = convert(frg_source, random_bits);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Checks that every result is one of the two neighbors of the source and that the mean is unbiased
+template <typename Destination, int Count>
+void run_test_stochastic_round(const char dest_name[], float source, float lo, float hi) {
+  int const kThreads = 256;
+  int const kBlocks = 64;
+  int const kN = kThreads * kBlocks * Count;
+
+  cutlass::HostTensor<Destination, cutlass::layout::RowMajor> destination({1, kN});
+
+  convert_stochastic_round<Destination, Count><<< kBlocks, kThreads >>>(
+    reinterpret_cast<cutlass::Array<Destination, Count> *>(destination.device_data()),
+    source,
+    2024);
+
+  destination.sync_host();
+  auto destination_ref = destination.host_ref();
+
+  double sum = 0;
+  for (int i = 0; i < kN; ++i) {
+    float result = float(destination_ref.at({0, i}));
+    EXPECT_TRUE(result == lo || result == hi)
+      << "Destination type: " << dest_name << " " << result << ", Source: " << source;
+    sum += result;
+  }
+
+  // The standard deviation of the mean is at most (hi - lo) / (2 * sqrt(kN))
+  double mean = sum / kN;
+  EXPECT_NEAR(mean, double(source), 6 * double(hi - lo) / (2 * std::sqrt(double(kN))))
+    << "Destination type: " << dest_name << ", Count: " << Count;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 } // namespace kernel
 } // namespace core
 } // namespace test
@@ -826,5 +889,126 @@ TYPED_TEST(VectorArrayConverterTest, array_263) {
   TestFixture::template emit_test<263>();
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(NumericConversion, f32x8_to_bf16x8_stochastic_round) {
+  test::core::kernel::run_test_stochastic_round<cutlass::bfloat16_t, 8>("bfloat16_t", 1.00125f, 1.0f, 1.0078125f);
+  test::core::kernel::run_test_stochastic_round<cutlass::bfloat16_t, 7>("bfloat16_t", -3.14159f, -3.140625f, -3.15625f);
+}
+
+TEST(NumericConversion, f32x8_to_f16x8_stochastic_round) {
+  test::core::kernel::run_test_stochastic_round<cutlass::half_t, 8>("half_t", 1.0003f, 1.0f, 1.0009765625f);
+  // Saturates to the largest finite value
+  test::core::kernel::run_test_stochastic_round<cutlass::half_t, 8>("half_t", 65504.0f, 65504.0f, 65504.0f);
+}
+
+TEST(NumericConversion, f32x8_to_fe4m3x8_stochastic_round) {
+  test::core::kernel::run_test_stochastic_round<cutlass::float_e4m3_t, 8>("float_e4m3_t", 1.1f, 1.0f, 1.125f);
+  // Subnormal range
+  test::core::kernel::run_test_stochastic_round<cutlass::float_e4m3_t, 8>("float_e4m3_t", -0.003f, -0.001953125f, -0.00390625f);
+}
+
+TEST(NumericConversion, f32x8_to_fe5m2x8_stochastic_round) {
+  test::core::kernel::run_test_stochastic_round<cutlass::float_e5m2_t, 8>("float_e5m2_t", -0.3f, -0.25f, -0.3125f);
+}
+
+TEST(NumericConversion, f32x16_to_fe2m1x16_stochastic_round) {
+  test::core::kernel::run_test_stochastic_round<cutlass::float_e2m1_t, 16>("float_e2m1_t", 2.5f, 2.0f, 3.0f);
+  test::core::kernel::run_test_stochastic_round<cutlass::float_e2m1_t, 16>("float_e2m1_t", -0.1f, 0.0f, -0.5f);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test {
+namespace core {
+namespace host {
+
+/// Floats whose upper halves cover every 16b pattern and whose lower halves exercise rounding
+inline std::vector<float> rounding_sweep() {
+  uint32_t const lower[] = {0x0000u, 0x0001u, 0x7fffu, 0x8000u, 0x8001u, 0xffffu};
+  std::vector<float> values;
+  for (uint32_t upper = 0; upper < (1u << 16); ++upper) {
+    for (uint32_t low : lower) {
+      uint32_t bits = (upper << 16) | low;
+      float f;
+      std::memcpy(&f, &bits, sizeof(f));
+      values.push_back(f);
+    }
+  }
+  return values;
+}
+
+/// Compares a bulk host conversion against the scalar converter. NaN payloads may differ between
+/// the SIMD and software paths, so NaNs are only required to stay NaNs.
+template <typename Destination, typename Source>
+void run_bulk_test(std::vector<Source> const &source) {
+  std::vector<Destination> bulk(source.size());
+  cutlass::host_numeric_array_convert(bulk.data(), source.data(), source.size());
+
+  cutlass::NumericConverter<Destination, Source> convert;
+  for (size_t i = 0; i < source.size(); ++i) {
+    Destination expected = convert(source[i]);
+    if (std::isnan(float(expected))) {
+      EXPECT_TRUE(std::isnan(float(bulk[i]))) << "index " << i;
+    }
+    else {
+      EXPECT_EQ(0, std::memcmp(&expected, &bulk[i], sizeof(Destination)))
+        << "index " << i << ": " << float(expected) << " vs " << float(bulk[i]);
+    }
+  }
+}
+
+template <typename Source>
+std::vector<Source> all_bit_patterns() {
+  std::vector<Source> values;
+  for (uint32_t bits = 0; bits < (1u << (8 * sizeof(Source))); ++bits) {
+    Source x;
+    std::memcpy(&x, &bits, sizeof(Source));
+    values.push_back(x);
+  }
+  return values;
+}
+
+} // namespace host
+} // namespace core
+} // namespace test
+
+TEST(NumericConversion, host_bulk_f32_to_f16_rn) {
+  test::core::host::run_bulk_test<cutlass::half_t, float>(test::core::host::rounding_sweep());
+}
+
+TEST(NumericConversion, host_bulk_f16_to_f32) {
+  test::core::host::run_bulk_test<float, cutlass::half_t>(test::core::host::all_bit_patterns<cutlass::half_t>());
+}
+
+TEST(NumericConversion, host_bulk_f32_to_bf16_rn) {
+  test::core::host::run_bulk_test<cutlass::bfloat16_t, float>(test::core::host::rounding_sweep());
+}
+
+TEST(NumericConversion, host_bulk_bf16_to_f32) {
+  test::core::host::run_bulk_test<float, cutlass::bfloat16_t>(test::core::host::all_bit_patterns<cutlass::bfloat16_t>());
+}
+
+TEST(NumericConversion, host_bulk_fe4m3_to_f32) {
+  test::core::host::run_bulk_test<float, cutlass::float_e4m3_t>(test::core::host::all_bit_patterns<cutlass::float_e4m3_t>());
+}
+
+TEST(NumericConversion, host_bulk_fe5m2_to_f32) {
+  test::core::host::run_bulk_test<float, cutlass::float_e5m2_t>(test::core::host::all_bit_patterns<cutlass::float_e5m2_t>());
+}
+
+TEST(NumericConversion, host_array_converter_f32x37_to_f16x37) {
+  cutlass::Array<float, 37> source;
+  for (int i = 0; i < 37; ++i) {
+    source[i] = float(i - 18) * 0.3331f;
+  }
+  cutlass::NumericArrayConverter<cutlass::half_t, float, 37> convert_array;
+  cutlass::NumericConverter<cutlass::half_t, float> convert;
+  cutlass::Array<cutlass::half_t, 37> result = convert_array(source);
+  for (int i = 0; i < 37; ++i) {
+    EXPECT_EQ(result[i].raw(), convert(source[i]).raw());
+  }
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////////////
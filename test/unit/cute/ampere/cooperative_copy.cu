@@ -285,6 +285,36 @@ TYPED_TEST(SM80_CuTe_Ampere, CooperativeCopyDefault1DFallback)
                                 value_type>(gmem_layout, smem_layout);
 }
 
+// Full vectors with a residue: 144 vectors of 128b over 128 threads
+TYPED_TEST(SM80_CuTe_Ampere, CooperativeCopyDefault1DResidue)
+{
+  using value_type = float;
+  constexpr uint32_t count = 576;
+  auto gmem_layout = make_layout(make_shape(Int<count>{}));
+  auto smem_layout = make_layout(make_shape(Int<count>{}));
+  constexpr uint32_t thread_block_size = 128;
+  test_cooperative_copy_default<typename TestFixture::mode,
+                                TestFixture::max_vec_bits,
+                                thread_block_size,
+                                value_type>(gmem_layout, smem_layout);
+}
+
+TEST(SM80_CuTe_Ampere, CooperativeCopyVectorBits)
+{
+  using value_type = cute::half_t;
+  auto gmem_tensor = make_tensor(make_gmem_ptr<value_type>(nullptr), make_layout(make_shape(Int<1152>{})));
+  auto smem_tensor = make_tensor(make_smem_ptr<value_type>(nullptr), make_layout(make_shape(Int<1152>{})));
+  // Not limited by the 9 elements per thread of 128 threads
+  CUTE_STATIC_ASSERT_V(cooperative_copy_vector_bits<128>(gmem_tensor, smem_tensor) == Int<128>{});
+
+  // Transposed layouts share no vector
+  auto smem_tensor_t = make_tensor(make_smem_ptr<value_type>(nullptr),
+                                   make_layout(make_shape(Int<32>{}, Int<36>{}), LayoutRight{}));
+  auto gmem_tensor_t = make_tensor(make_gmem_ptr<value_type>(nullptr),
+                                   make_layout(make_shape(Int<32>{}, Int<36>{})));
+  CUTE_STATIC_ASSERT_V(cooperative_copy_vector_bits<128>(gmem_tensor_t, smem_tensor_t) == Int<16>{});
+}
+
 // Fast path
 TYPED_TEST(SM80_CuTe_Ampere, CooperativeCopyDefault2D)
 {
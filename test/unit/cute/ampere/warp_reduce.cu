@@ -0,0 +1,129 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+#include "cutlass_unit_test.h"
+
+#include <vector>
+
+#include <thrust/host_vector.h>
+#include <thrust/device_vector.h>
+
+#include <cute/tensor.hpp>
+#include <cute/algorithm/tensor_reduce.hpp>
+
+using namespace cute;
+
+namespace {
+
+constexpr int FragSize = 4;
+
+template <int SegmentSize, int LaneStride, bool Warpgroup, class T, class BinaryOp>
+__global__ void
+warp_reduce_kernel(T const* g_in, T* g_out, BinaryOp op)
+{
+  __shared__ T smem[FragSize * 128];
+
+  int tid = threadIdx.x;
+  Tensor frg = make_tensor<T>(Int<FragSize>{});
+  for (int i = 0; i < FragSize; ++i) {
+    frg(i) = g_in[tid * FragSize + i];
+  }
+
+  if constexpr (Warpgroup) {
+    warpgroup_reduce<SegmentSize,LaneStride>(frg, make_tensor(make_smem_ptr(smem), Int<FragSize * 128>{}), tid, 1, op);
+  } else {
+    warp_reduce<SegmentSize,LaneStride>(frg, op);
+  }
+
+  for (int i = 0; i < FragSize; ++i) {
+    g_out[tid * FragSize + i] = frg(i);
+  }
+}
+
+template <int SegmentSize, int LaneStride, bool Warpgroup = false, class T, class BinaryOp>
+void
+test_warp_reduce(BinaryOp op, T init)
+{
+  constexpr int NumThreads = 128;
+  thrust::host_vector<T> h_in(NumThreads * FragSize);
+  for (int i = 0; i < int(h_in.size()); ++i) {
+    h_in[i] = T((i * 7) % 13) - T(6);
+  }
+  thrust::device_vector<T> d_in = h_in;
+  thrust::device_vector<T> d_out(h_in.size());
+
+  warp_reduce_kernel<SegmentSize,LaneStride,Warpgroup><<<1, NumThreads>>>(
+    thrust::raw_pointer_cast(d_in.data()),
+    thrust::raw_pointer_cast(d_out.data()),
+    op);
+  ASSERT_EQ(cudaDeviceSynchronize(), cudaSuccess);
+  thrust::host_vector<T> h_out = d_out;
+
+  for (int tid = 0; tid < NumThreads; ++tid) {
+    uint32_t mask = detail::warp_segment_mask<SegmentSize,LaneStride>(tid % 32);
+    for (int i = 0; i < FragSize; ++i) {
+      T ref = init;
+      for (int t = 0; t < NumThreads; ++t) {
+        bool same_warp = (t / 32) == (tid / 32);
+        if ((Warpgroup || same_warp) && ((mask >> (t % 32)) & 1)) {
+          ref = op(ref, h_in[t * FragSize + i]);
+        }
+      }
+      EXPECT_EQ(h_out[tid * FragSize + i], ref) << "tid " << tid << " element " << i;
+    }
+  }
+}
+
+} // end namespace
+
+TEST(SM80_CuTe_Ampere, WarpReduceShuffle)
+{
+  test_warp_reduce<32,1>(plus{}, 0.0f);
+  test_warp_reduce< 8,4>(plus{}, 0.0f);
+  test_warp_reduce< 4,1>(max_fn{}, -1e30f);
+  test_warp_reduce< 2,16>(plus{}, 0.0);
+  test_warp_reduce< 4,8>(plus{}, cutlass::half_t(0));
+}
+
+TEST(SM80_CuTe_Ampere, WarpReduceRedux)
+{
+  test_warp_reduce<32,1>(plus{}, 0);
+  test_warp_reduce<16,2>(min_fn{}, 1 << 30);
+  test_warp_reduce< 8,4>(max_fn{}, -(1 << 30));
+  test_warp_reduce<32,1>(bit_xor{}, uint32_t(0));
+}
+
+TEST(SM80_CuTe_Ampere, WarpgroupReduce)
+{
+  test_warp_reduce<32,1,true>(plus{}, 0.0f);
+  test_warp_reduce< 8,4,true>(plus{}, 0.0f);
+  test_warp_reduce< 4,1,true>(max_fn{}, -(1 << 30));
+}
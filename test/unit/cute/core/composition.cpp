@@ -587,4 +587,24 @@ TEST(CuTe_core, Composition)
 
    test_composition(a, b);
   }
+
+  CUTLASS_TRACE_HOST("-------------------------------");
+  CUTLASS_TRACE_HOST("Static vs dynamic results"      );
+  CUTLASS_TRACE_HOST("-------------------------------");
+
+  {
+    auto a = make_layout(Shape<_4,Shape<_2,_3>>{}, Stride<_6,Stride<_3,_1>>{});
+    auto b = make_layout(Shape<_4,_6>{}, Stride<_1,_4>{});
+    auto d = make_layout(make_shape(4, make_shape(2, 3)), make_stride(6, make_stride(3, 1)));
+
+    auto rs = composition(a, b);
+    auto rd = composition(d, b);
+    static_assert(is_static<decltype(rs)>::value);
+
+    test_composition(a, b);
+    test_composition(d, b);
+    for (int c = 0; c < size(b); ++c) {
+      EXPECT_EQ(rs(c), rd(c));
+    }
+  }
 }
@@ -41,6 +41,7 @@
 #include <thrust/device_vector.h>
 
 #include <cute/tensor.hpp>
+#include <cute/algorithm/cooperative_copy.hpp>
 
 using namespace cute;
 
@@ -51,7 +52,7 @@ struct SharedStorage {
 };
 
 #if CUDA_12_0_SM90_FEATURES_SUPPORTED
-template <class T, class GmemLayout, class SmemLayout>
+template <bool Cooperative, class T, class GmemLayout, class SmemLayout>
 __global__ void
 bulk_copy_test_device_cute(T const* g_in,
                            T      * g_out,
@@ -93,10 +94,17 @@ bulk_copy_test_device_cute(T const* g_in,
     initialize_barrier(bulk_copy_mbar[0], 1 /*numThreads*/);
     set_barrier_transaction_bytes(bulk_copy_mbar[0], transaction_bytes);
 
-    copy(blkcp.with(bulk_copy_mbar[0]), gA, sA);
+    if constexpr (not Cooperative) {
+      copy(blkcp.with(bulk_copy_mbar[0]), gA, sA);
+    }
   }
   __syncthreads();
 
+  if constexpr (Cooperative) {
+    // Distribute the bulk copies of the chunks across the threads
+    cooperative_copy<128>(threadIdx.x, gA, sA, blkcp.with(bulk_copy_mbar[0]));
+  }
+
   /// Wait on the shared memory barrier until the phase bit flips from kPhaseBit value
   constexpr int kPhaseBit = 0;
   wait_barrier(bulk_copy_mbar[0], kPhaseBit);
@@ -119,7 +127,7 @@ bulk_copy_test_device_cute(T const* g_in,
   }
 }
 
-template <class T, class GLayout, class SLayout>
+template <class T, bool Cooperative = false, class GLayout, class SLayout>
 void run_and_validate(GLayout gmem_layout,
                       SLayout smem_layout)
 {
@@ -132,10 +140,10 @@ void run_and_validate(GLayout gmem_layout,
   thrust::device_vector<T> d_out(d_in.size(), T(-1));
 
   int32_t smem_size = static_cast<int32_t>(sizeof(SharedStorage<T, decltype(smem_layout)>));
-  bulk_copy_test_device_cute<<<1, 128, smem_size>>>(thrust::raw_pointer_cast(d_in.data()),
-                                                    thrust::raw_pointer_cast(d_out.data()),
-                                                    gmem_layout,
-                                                    smem_layout);
+  bulk_copy_test_device_cute<Cooperative><<<1, 128, smem_size>>>(thrust::raw_pointer_cast(d_in.data()),
+                                                                 thrust::raw_pointer_cast(d_out.data()),
+                                                                 gmem_layout,
+                                                                 smem_layout);
   // Transfering results back to host
   thrust::host_vector<T> h_out = d_out;
 
@@ -193,4 +201,30 @@ TEST(SM90_CuTe_BLKCP, NonCompact)
   run_and_validate<tfloat32_t>(gmem_layout, smem_layout);
   }
 }
+
+TEST(SM90_CuTe_BLKCP, Cooperative)
+{
+
+  {
+  auto smem_layout = make_layout(Shape<_32,_32>{}, GenColMajor{});
+  auto gmem_layout = smem_layout;
+  run_and_validate<    int8_t, true>(gmem_layout, smem_layout);
+  run_and_validate<    half_t, true>(gmem_layout, smem_layout);
+  run_and_validate<tfloat32_t, true>(gmem_layout, smem_layout);
+  }
+  {
+  auto smem_layout = make_layout(Shape<_32,_32>{}, Stride<_1,Int<48>>{});
+  auto gmem_layout = smem_layout;
+  run_and_validate<    int8_t, true>(gmem_layout, smem_layout);
+  run_and_validate<    half_t, true>(gmem_layout, smem_layout);
+  run_and_validate<tfloat32_t, true>(gmem_layout, smem_layout);
+  }
+  {
+  auto smem_layout = make_layout(Shape<_32,_32>{}, Stride<_1,Int<48>>{});
+  auto gmem_layout = make_layout(Shape<Shape<_16,_2>, Shape<_4,_8>>{}, Stride<Stride<_1,_64>,Stride<_16,_128>>{});
+  run_and_validate<    int8_t, true>(gmem_layout, smem_layout);
+  run_and_validate<    half_t, true>(gmem_layout, smem_layout);
+  run_and_validate<tfloat32_t, true>(gmem_layout, smem_layout);
+  }
+}
 #endif // #if CUDA_12_0_SM90_FEATURES_SUPPORTED
@@ -0,0 +1,114 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Tests for the host-side TMA descriptor cache.
+*/
+
+// The cache only takes effect in translation units compiled with it enabled
+#define CUTE_ENABLE_TMA_DESCRIPTOR_CACHE
+
+#include "cutlass_unit_test.h"
+
+#include <cstring>
+
+#include <thrust/device_vector.h>
+
+#include <cute/tensor.hpp>
+
+using namespace cute;
+
+#if CUDA_12_0_SM90_FEATURES_SUPPORTED
+
+namespace {
+
+template <class Tma>
+bool same_descriptor(Tma const& a, Tma const& b) {
+  return std::memcmp(a.get_tma_descriptor(), b.get_tma_descriptor(), sizeof(TmaDescriptor)) == 0;
+}
+
+} // namespace
+
+TEST(SM90_CuTe_Hopper, Tma_Descriptor_Cache)
+{
+  using T = cute::half_t;
+  thrust::device_vector<T> d_a(256 * 256);
+  thrust::device_vector<T> d_b(256 * 256);
+
+  auto& cache = TMA::DescriptorCache::get();
+  cache.clear();
+
+  auto gmem_layout = make_layout(make_shape(256, 256), GenRowMajor{});
+  Tensor gA = make_tensor(make_gmem_ptr(thrust::raw_pointer_cast(d_a.data())), gmem_layout);
+  Tensor gB = make_tensor(make_gmem_ptr(thrust::raw_pointer_cast(d_b.data())), gmem_layout);
+  auto smem_layout = make_layout(Shape<_64,_64>{}, GenRowMajor{});
+
+  auto tma_a0 = make_tma_copy(SM90_TMA_LOAD{}, gA, smem_layout);
+  EXPECT_EQ(cache.hits(), 0u);
+  EXPECT_EQ(cache.misses(), 1u);
+  EXPECT_EQ(cache.size(), 1u);
+
+  // Same tensor and box: reuse the descriptor
+  auto tma_a1 = make_tma_copy(SM90_TMA_LOAD{}, gA, smem_layout);
+  EXPECT_EQ(cache.hits(), 1u);
+  EXPECT_EQ(cache.size(), 1u);
+  EXPECT_TRUE(same_descriptor(tma_a0, tma_a1));
+
+  // Another pointer: encode a new descriptor
+  auto tma_b = make_tma_copy(SM90_TMA_LOAD{}, gB, smem_layout);
+  EXPECT_EQ(cache.misses(), 2u);
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_FALSE(same_descriptor(tma_a0, tma_b));
+
+  // Another box
+  auto tma_a2 = make_tma_copy(SM90_TMA_LOAD{}, gA, make_layout(Shape<_32,_64>{}, GenRowMajor{}));
+  EXPECT_EQ(cache.misses(), 3u);
+  EXPECT_EQ(cache.size(), 3u);
+  (void) tma_a2;
+
+  // Disabled: neither looked up nor cached
+  cache.set_enabled(false);
+  auto tma_a3 = make_tma_copy(SM90_TMA_LOAD{}, gA, smem_layout);
+  EXPECT_EQ(cache.hits(), 1u);
+  EXPECT_EQ(cache.misses(), 3u);
+  EXPECT_TRUE(same_descriptor(tma_a0, tma_a3));
+  cache.set_enabled(true);
+
+  // A full cache is cleared before the next insertion
+  cache.set_capacity(3);
+  auto tma_a4 = make_tma_copy(SM90_TMA_LOAD{}, gA, make_layout(Shape<_16,_64>{}, GenRowMajor{}));
+  EXPECT_EQ(cache.size(), 1u);
+  (void) tma_a4;
+
+  cache.set_capacity(4096);
+  cache.clear();
+}
+
+#endif // #if CUDA_12_0_SM90_FEATURES_SUPPORTED
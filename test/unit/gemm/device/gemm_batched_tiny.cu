@@ -0,0 +1,328 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the batched GEMM of many tiny fixed-size problems
+*/
+
+#include <iostream>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/epilogue/thread/linear_combination.h"
+#include "cutlass/gemm/kernel/gemm_batched_tiny.h"
+#include "cutlass/gemm/device/gemm_batched_tiny.h"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "cutlass/util/host_tensor.h"
+#include "cutlass/util/reference/host/tensor_fill.h"
+#include "cutlass/util/reference/host/tensor_copy.h"
+#include "cutlass/util/reference/host/tensor_compare.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test {
+namespace gemm {
+
+/// Runs a batch of tiny problems with padded leading dimensions and compares to a host reference
+template <typename Gemm>
+class TestbedGemmBatchedTiny {
+public:
+
+  using GemmKernel = typename Gemm::GemmKernel;
+  using ElementA = typename GemmKernel::ElementA;
+  using ElementB = typename GemmKernel::ElementB;
+  using ElementC = typename GemmKernel::ElementC;
+  using ElementAccumulator = typename GemmKernel::ElementAccumulator;
+  using ElementCompute = typename GemmKernel::EpilogueOutputOp::ElementCompute;
+
+  using Layout = cutlass::layout::RowMajor;
+
+  static int const kM = GemmKernel::kM;
+  static int const kN = GemmKernel::kN;
+  static int const kK = GemmKernel::kK;
+
+  uint64_t seed;
+
+  cutlass::HostTensor<ElementA, Layout> tensor_A;      ///< One problem per row
+  cutlass::HostTensor<ElementB, Layout> tensor_B;
+  cutlass::HostTensor<ElementC, Layout> tensor_C;
+  cutlass::HostTensor<ElementC, Layout> tensor_D;
+  cutlass::HostTensor<ElementC, Layout> reference_D;
+
+  TestbedGemmBatchedTiny(uint64_t seed_ = 2026): seed(seed_) { }
+
+  static int64_t offset(bool contiguous_rows, int row, int column, int64_t ld) {
+    return contiguous_rows ? row * ld + column : column * ld + row;
+  }
+
+  /// Runs one batch. Leading dimensions exceed the problem extent by ld_padding accesses.
+  bool run(int batch_count, ElementCompute alpha, ElementCompute beta, int ld_padding = 0) {
+
+    int64_t lda = GemmKernel::kContiguousA + ld_padding * GemmKernel::kAccessA;
+    int64_t ldb = GemmKernel::kContiguousB + ld_padding * GemmKernel::kAccessB;
+    int64_t ldc = GemmKernel::kContiguousC + ld_padding * GemmKernel::kAccessC;
+    int64_t batch_stride_A = lda * GemmKernel::kStridedA;
+    int64_t batch_stride_B = ldb * GemmKernel::kStridedB;
+    int64_t batch_stride_C = ldc * (GemmKernel::kIsRowMajorC ? kM : kN);
+
+    //
+    // Initialize
+    //
+
+    tensor_A.resize({batch_count, int(batch_stride_A)});
+    tensor_B.resize({batch_count, int(batch_stride_B)});
+    tensor_C.resize({batch_count, int(batch_stride_C)});
+    tensor_D.resize({batch_count, int(batch_stride_C)});
+    reference_D.resize({batch_count, int(batch_stride_C)}, false);
+
+    cutlass::reference::host::TensorFillRandomUniform(tensor_A.host_view(), seed + 1, 2, -2, 0);
+    cutlass::reference::host::TensorFillRandomUniform(tensor_B.host_view(), seed + 2, 2, -2, 0);
+    cutlass::reference::host::TensorFillRandomUniform(tensor_C.host_view(), seed + 3, 2, -2, 0);
+    // Elements outside of the problems must not be written
+    cutlass::reference::host::TensorFill(tensor_D.host_view(), ElementC(-1));
+    cutlass::reference::host::TensorCopy(reference_D.host_view(), tensor_D.host_view());
+
+    tensor_A.sync_device();
+    tensor_B.sync_device();
+    tensor_C.sync_device();
+    tensor_D.sync_device();
+
+    //
+    // Run the kernel
+    //
+
+    typename Gemm::Arguments args;
+    args.batch_count = batch_count;
+    args.epilogue = {alpha, beta};
+    args.ptr_A = tensor_A.device_data();
+    args.lda = lda;
+    args.batch_stride_A = batch_stride_A;
+    args.ptr_B = tensor_B.device_data();
+    args.ldb = ldb;
+    args.batch_stride_B = batch_stride_B;
+    args.ptr_C = tensor_C.device_data();
+    args.ldc = ldc;
+    args.batch_stride_C = batch_stride_C;
+    args.ptr_D = tensor_D.device_data();
+    args.ldd = ldc;
+    args.batch_stride_D = batch_stride_C;
+
+    Gemm gemm_op;
+
+    EXPECT_EQ(Gemm::can_implement(args), cutlass::Status::kSuccess);
+
+    cutlass::Status status = gemm_op(args);
+    EXPECT_EQ(status, cutlass::Status::kSuccess);
+
+    cudaError_t result = cudaDeviceSynchronize();
+    EXPECT_EQ(result, cudaSuccess) << " CUDA error: " << cudaGetErrorString(result);
+    if (status != cutlass::Status::kSuccess || result != cudaSuccess) {
+      return false;
+    }
+
+    //
+    // Reference
+    //
+
+    for (int p = 0; p < batch_count; ++p) {
+      ElementA const *A = tensor_A.host_data() + p * batch_stride_A;
+      ElementB const *B = tensor_B.host_data() + p * batch_stride_B;
+      ElementC const *C = tensor_C.host_data() + p * batch_stride_C;
+      ElementC *D = reference_D.host_data() + p * batch_stride_C;
+
+      for (int m = 0; m < kM; ++m) {
+        for (int n = 0; n < kN; ++n) {
+          ElementAccumulator accum = ElementAccumulator(0);
+          for (int k = 0; k < kK; ++k) {
+            accum += ElementAccumulator(A[offset(GemmKernel::kIsRowMajorA, m, k, lda)]) *
+                     ElementAccumulator(B[offset(!GemmKernel::kIsColumnMajorB, k, n, ldb)]);
+          }
+          int64_t idx = offset(GemmKernel::kIsRowMajorC, m, n, ldc);
+          D[idx] = ElementC(alpha * ElementCompute(accum) + beta * ElementCompute(C[idx]));
+        }
+      }
+    }
+
+    tensor_D.sync_host();
+
+    bool passed = cutlass::reference::host::TensorEquals(reference_D.host_view(), tensor_D.host_view());
+    EXPECT_TRUE(passed) << " batch_count: " << batch_count << ", ld_padding: " << ld_padding;
+    return passed;
+  }
+};
+
+/// Runs batches that do and do not fill the co-resident CTAs
+template <typename Gemm>
+bool TestAllGemmBatchedTiny() {
+  using ElementCompute = typename Gemm::GemmKernel::EpilogueOutputOp::ElementCompute;
+
+  TestbedGemmBatchedTiny<Gemm> testbed;
+
+  // Large enough for the CTAs to stride through the batch, small enough for the host reference
+  int const kLargeBatch = (1 << 26) / (Gemm::GemmKernel::kM * Gemm::GemmKernel::kN * Gemm::GemmKernel::kK) + 1;
+
+  bool passed = true;
+  for (int batch_count : {1, 7, 1000, kLargeBatch}) {
+    passed = passed && testbed.run(batch_count, ElementCompute(1), ElementCompute(0));
+    passed = passed && testbed.run(batch_count, ElementCompute(2), ElementCompute(-1), 1);
+  }
+  return passed;
+}
+
+} // namespace gemm
+} // namespace test
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ARCH_MMA_SM80_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM80_Device_GemmBatchedTiny_f16t_f16n_f16t_tensor_op_f32, 16x16x16) {
+
+  using EpilogueOp = cutlass::epilogue::thread::LinearCombination<cutlass::half_t, 2, float, float>;
+
+  using Gemm = cutlass::gemm::device::GemmBatchedTiny<
+    cutlass::gemm::kernel::GemmBatchedTiny<
+      cutlass::gemm::GemmShape<16, 16, 16>,
+      cutlass::half_t, cutlass::layout::RowMajor,
+      cutlass::half_t, cutlass::layout::ColumnMajor,
+      cutlass::half_t, cutlass::layout::RowMajor,
+      float, EpilogueOp>>;
+
+  EXPECT_TRUE(test::gemm::TestAllGemmBatchedTiny<Gemm>());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM80_Device_GemmBatchedTiny_f16n_f16t_f32n_tensor_op_f32, 32x32x32) {
+
+  using EpilogueOp = cutlass::epilogue::thread::LinearCombination<float, 1, float, float>;
+
+  using Gemm = cutlass::gemm::device::GemmBatchedTiny<
+    cutlass::gemm::kernel::GemmBatchedTiny<
+      cutlass::gemm::GemmShape<32, 32, 32>,
+      cutlass::half_t, cutlass::layout::ColumnMajor,
+      cutlass::half_t, cutlass::layout::RowMajor,
+      float, cutlass::layout::ColumnMajor,
+      float, EpilogueOp, 3>>;
+
+  EXPECT_TRUE(test::gemm::TestAllGemmBatchedTiny<Gemm>());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM80_Device_GemmBatchedTiny_f16t_f16n_f16t_tensor_op_f16, 8x8x8_padded) {
+
+  using EpilogueOp = cutlass::epilogue::thread::LinearCombination<cutlass::half_t, 1, cutlass::half_t, cutlass::half_t>;
+
+  using Gemm = cutlass::gemm::device::GemmBatchedTiny<
+    cutlass::gemm::kernel::GemmBatchedTiny<
+      cutlass::gemm::GemmShape<8, 8, 8>,
+      cutlass::half_t, cutlass::layout::RowMajor,
+      cutlass::half_t, cutlass::layout::ColumnMajor,
+      cutlass::half_t, cutlass::layout::RowMajor,
+      cutlass::half_t, EpilogueOp>>;
+
+  EXPECT_TRUE(test::gemm::TestAllGemmBatchedTiny<Gemm>());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM80_Device_GemmBatchedTiny_bf16t_bf16t_bf16t_tensor_op_f32, 24x40x24_padded) {
+
+  using EpilogueOp = cutlass::epilogue::thread::LinearCombination<cutlass::bfloat16_t, 1, float, float>;
+
+  using Gemm = cutlass::gemm::device::GemmBatchedTiny<
+    cutlass::gemm::kernel::GemmBatchedTiny<
+      cutlass::gemm::GemmShape<24, 40, 24>,
+      cutlass::bfloat16_t, cutlass::layout::RowMajor,
+      cutlass::bfloat16_t, cutlass::layout::RowMajor,
+      cutlass::bfloat16_t, cutlass::layout::RowMajor,
+      float, EpilogueOp>>;
+
+  EXPECT_TRUE(test::gemm::TestAllGemmBatchedTiny<Gemm>());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM80_Device_GemmBatchedTiny_f16t_f16n_f32t_tensor_op_f32, 64x64x64) {
+
+  using EpilogueOp = cutlass::epilogue::thread::LinearCombination<float, 2, float, float>;
+
+  using Gemm = cutlass::gemm::device::GemmBatchedTiny<
+    cutlass::gemm::kernel::GemmBatchedTiny<
+      cutlass::gemm::GemmShape<64, 64, 64>,
+      cutlass::half_t, cutlass::layout::RowMajor,
+      cutlass::half_t, cutlass::layout::ColumnMajor,
+      float, cutlass::layout::RowMajor,
+      float, EpilogueOp>>;
+
+  EXPECT_TRUE(test::gemm::TestAllGemmBatchedTiny<Gemm>());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM80_Device_GemmBatchedTiny_f64t_f64n_f64t_tensor_op_f64, 8x8x8) {
+
+  using EpilogueOp = cutlass::epilogue::thread::LinearCombination<double, 1, double, double>;
+
+  using Gemm = cutlass::gemm::device::GemmBatchedTiny<
+    cutlass::gemm::kernel::GemmBatchedTiny<
+      cutlass::gemm::GemmShape<8, 8, 8>,
+      double, cutlass::layout::RowMajor,
+      double, cutlass::layout::ColumnMajor,
+      double, cutlass::layout::RowMajor,
+      double, EpilogueOp>>;
+
+  EXPECT_TRUE(test::gemm::TestAllGemmBatchedTiny<Gemm>());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM80_Device_GemmBatchedTiny_f32t_f32t_f32n_simt_f32, 12x12x12_padded) {
+
+  using EpilogueOp = cutlass::epilogue::thread::LinearCombination<float, 1, float, float>;
+
+  using Gemm = cutlass::gemm::device::GemmBatchedTiny<
+    cutlass::gemm::kernel::GemmBatchedTiny<
+      cutlass::gemm::GemmShape<12, 12, 12>,
+      float, cutlass::layout::RowMajor,
+      float, cutlass::layout::RowMajor,
+      float, cutlass::layout::ColumnMajor,
+      float, EpilogueOp>>;
+
+  EXPECT_TRUE(test::gemm::TestAllGemmBatchedTiny<Gemm>());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // defined(CUTLASS_ARCH_MMA_SM80_SUPPORTED)
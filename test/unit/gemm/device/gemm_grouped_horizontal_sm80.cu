@@ -0,0 +1,396 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for device-wide horizontally fused GEMM interface
+
+*/
+
+#include <iostream>
+#include <fstream>
+#include <list>
+
+#include "../../common/cutlass_unit_test.h"
+#include "cutlass/cutlass.h"
+
+#include "cutlass/gemm/gemm.h"
+#include "cutlass/gemm/kernel/default_gemm_grouped.h"
+#include "cutlass/gemm/kernel/gemm_grouped_horizontal.h"
+#include "cutlass/gemm/device/gemm_grouped_horizontal.h"
+#include "cutlass/epilogue/thread/linear_combination.h"
+#include "cutlass/epilogue/thread/linear_combination_relu.h"
+
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/reference/host/gemm.h"
+#include "cutlass/util/reference/host/tensor_compare.h"
+#include "cutlass/util/reference/host/tensor_fill.h"
+#include "cutlass/util/reference/host/tensor_norm.h"
+#include "cutlass/util/tensor_view_io.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ARCH_MMA_SM80_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Computes a group whose problems alternate between a linear combination with half-precision
+/// outputs and a linear combination with ReLU and single-precision outputs.
+template <typename Gemm>
+struct TestbedGroupedHorizontal {
+
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+  using LayoutA = typename Gemm::LayoutA;
+  using LayoutB = typename Gemm::LayoutB;
+  using LayoutC = cutlass::layout::RowMajor;
+  using ElementAccumulator = typename Gemm::ElementAccumulator;
+
+  using Epilogue0 = typename Gemm::GemmKernel::template EpilogueAt<0>;
+  using Epilogue1 = typename Gemm::GemmKernel::template EpilogueAt<1>;
+  using ElementOutput0 = typename Epilogue0::OutputTileIterator::Element;
+  using ElementOutput1 = typename Epilogue1::OutputTileIterator::Element;
+  using ElementCompute = float;
+
+  int problem_count;
+  uint32_t seed;
+
+  std::vector<cutlass::gemm::GemmCoord> problem_sizes_host;
+  std::vector<int> epilogue_idx_host;
+  std::vector<int64_t> lda_host, ldb_host, ldc_host;
+
+  std::vector<std::vector<ElementA>> host_A;
+  std::vector<std::vector<ElementB>> host_B;
+  std::vector<std::vector<float>> host_C;
+
+  std::list<cutlass::DeviceAllocation<uint8_t>> blocks;
+
+  std::vector<ElementA *> ptr_A_host;
+  std::vector<ElementB *> ptr_B_host;
+  std::vector<void *> ptr_C_host;
+  std::vector<void *> ptr_D_host;
+
+  TestbedGroupedHorizontal(int problem_count_, uint32_t seed_ = 3080):
+    problem_count(problem_count_), seed(seed_) { }
+
+  template <typename Element>
+  void *to_device(std::vector<Element> const &host) {
+    blocks.emplace_back(host.size() * sizeof(Element));
+    cutlass::device_memory::copy_to_device(
+      reinterpret_cast<Element *>(blocks.back().get()), host.data(), host.size());
+    return blocks.back().get();
+  }
+
+  template <typename Element>
+  std::vector<Element> to_host(void const *ptr, size_t count) {
+    std::vector<Element> host(count);
+    cutlass::device_memory::copy_to_host(host.data(), reinterpret_cast<Element const *>(ptr), count);
+    return host;
+  }
+
+  template <typename Element, typename Layout>
+  std::vector<Element> random_matrix(Layout layout, cutlass::MatrixCoord extent, uint32_t seed) {
+    std::vector<Element> matrix(layout.capacity(extent));
+    cutlass::reference::host::TensorFillRandomUniform(
+      cutlass::TensorView<Element, Layout>(matrix.data(), layout, extent), seed, 4, -4, 0);
+    return matrix;
+  }
+
+  void initialize() {
+    srand(seed);
+
+    for (int i = 0; i < problem_count; ++i) {
+      // Problems with single-precision outputs only require a four-element alignment in N
+      cutlass::gemm::GemmCoord problem(
+        8 * (rand() % 48) + 24,
+        (i % 2) ? 4 * (rand() % 96) + 12 : 8 * (rand() % 48) + 24,
+        8 * (rand() % 48) + 24);
+
+      problem_sizes_host.push_back(problem);
+      epilogue_idx_host.push_back(i % 2);
+
+      lda_host.push_back(LayoutA::packed({problem.m(), problem.k()}).stride(0));
+      ldb_host.push_back(LayoutB::packed({problem.k(), problem.n()}).stride(0));
+      ldc_host.push_back(LayoutC::packed({problem.m(), problem.n()}).stride(0));
+
+      host_A.push_back(random_matrix<ElementA>(LayoutA(lda_host.back()), {problem.m(), problem.k()}, seed * 2021 + i));
+      host_B.push_back(random_matrix<ElementB>(LayoutB(ldb_host.back()), {problem.k(), problem.n()}, seed * 2022 + i));
+      host_C.push_back(random_matrix<float>(LayoutC(ldc_host.back()), {problem.m(), problem.n()}, seed * 2023 + i));
+
+      ptr_A_host.push_back(reinterpret_cast<ElementA *>(to_device(host_A.back())));
+      ptr_B_host.push_back(reinterpret_cast<ElementB *>(to_device(host_B.back())));
+
+      if (epilogue_idx_host.back() == 0) {
+        std::vector<ElementOutput0> C(host_C.back().begin(), host_C.back().end());
+        ptr_C_host.push_back(to_device(C));
+        ptr_D_host.push_back(to_device(std::vector<ElementOutput0>(C.size())));
+      }
+      else {
+        std::vector<ElementOutput1> C(host_C.back().begin(), host_C.back().end());
+        ptr_C_host.push_back(to_device(C));
+        ptr_D_host.push_back(to_device(std::vector<ElementOutput1>(C.size())));
+      }
+    }
+  }
+
+  template <typename ElementOutput>
+  bool verify_problem(int i, ElementCompute alpha, ElementCompute beta, bool relu) {
+    cutlass::gemm::GemmCoord problem = problem_sizes_host.at(i);
+
+    LayoutA layout_A(lda_host.at(i));
+    LayoutB layout_B(ldb_host.at(i));
+    LayoutC layout_C(ldc_host.at(i));
+
+    cutlass::MatrixCoord extent_C{problem.m(), problem.n()};
+
+    std::vector<ElementOutput> matrix_C(host_C.at(i).begin(), host_C.at(i).end());
+    std::vector<ElementOutput> matrix_D = to_host<ElementOutput>(ptr_D_host.at(i), matrix_C.size());
+    std::vector<ElementOutput> matrix_Ref(matrix_C.size());
+
+    cutlass::TensorView<ElementA, LayoutA> view_A(host_A.at(i).data(), layout_A, {problem.m(), problem.k()});
+    cutlass::TensorView<ElementB, LayoutB> view_B(host_B.at(i).data(), layout_B, {problem.k(), problem.n()});
+    cutlass::TensorView<ElementOutput, LayoutC> view_C(matrix_C.data(), layout_C, extent_C);
+    cutlass::TensorView<ElementOutput, LayoutC> view_D(matrix_D.data(), layout_C, extent_C);
+    cutlass::TensorView<ElementOutput, LayoutC> view_Ref(matrix_Ref.data(), layout_C, extent_C);
+
+    cutlass::reference::host::Gemm<
+        ElementA, LayoutA,
+        ElementB, LayoutB,
+        ElementOutput, LayoutC,
+        ElementCompute, ElementAccumulator
+    > reference_gemm;
+
+    reference_gemm(problem, alpha, view_A, view_B, beta, view_C, view_Ref, ElementAccumulator(0));
+
+    if (relu) {
+      for (auto &x : matrix_Ref) {
+        x = (float(x) < 0.f) ? ElementOutput(0) : x;
+      }
+    }
+
+    EXPECT_GT(cutlass::reference::host::TensorNorm(view_Ref), 0);
+
+    bool passed = cutlass::reference::host::TensorEquals(view_D, view_Ref);
+
+    if (!passed) {
+      std::ofstream file("testbed_grouped_horizontal_errors.txt");
+
+      file
+        << "problem: " << problem << "  [group: " << i << ", epilogue: " << epilogue_idx_host.at(i) << "]\n"
+        << ", alpha: " << alpha << ", beta: " << beta << "\n\n";
+
+      file
+        << "A =\n" << view_A
+        << "\nB =\n" << view_B
+        << "\nC =\n" << view_C
+        << "\n\nReference =\n" << view_Ref
+        << "\nComputed =\n" << view_D;
+    }
+
+    return passed;
+  }
+
+  bool run(ElementCompute alpha = ElementCompute(1), ElementCompute beta = ElementCompute(0)) {
+
+    initialize();
+
+    int threadblock_count = Gemm::sufficient(problem_sizes_host.data(), problem_count);
+
+    // Early exit
+    if (!threadblock_count) {
+      if (CUTLASS_TEST_UNIT_ENABLE_WARNINGS) {
+        std::cerr << "Test waived due to insufficient CUDA device resources." << std::endl;
+      }
+      return true;
+    }
+
+    cutlass::DeviceAllocation<cutlass::gemm::GemmCoord> problem_sizes(problem_count);
+    cutlass::DeviceAllocation<int> epilogue_idx(problem_count);
+    cutlass::DeviceAllocation<ElementA *> ptr_A(problem_count);
+    cutlass::DeviceAllocation<ElementB *> ptr_B(problem_count);
+    cutlass::DeviceAllocation<void *> ptr_C(problem_count);
+    cutlass::DeviceAllocation<void *> ptr_D(problem_count);
+    cutlass::DeviceAllocation<int64_t> lda(problem_count);
+    cutlass::DeviceAllocation<int64_t> ldb(problem_count);
+    cutlass::DeviceAllocation<int64_t> ldc(problem_count);
+
+    problem_sizes.copy_from_host(problem_sizes_host.data());
+    epilogue_idx.copy_from_host(epilogue_idx_host.data());
+    ptr_A.copy_from_host(ptr_A_host.data());
+    ptr_B.copy_from_host(ptr_B_host.data());
+    ptr_C.copy_from_host(ptr_C_host.data());
+    ptr_D.copy_from_host(ptr_D_host.data());
+    lda.copy_from_host(lda_host.data());
+    ldb.copy_from_host(ldb_host.data());
+    ldc.copy_from_host(ldc_host.data());
+
+    typename Gemm::OutputOpParams output_op{
+      typename Epilogue0::OutputOp::Params(alpha, beta),
+      typename Epilogue1::OutputOp::Params(alpha, beta)};
+
+    typename Gemm::Arguments args(
+      problem_sizes.get(),
+      problem_count,
+      threadblock_count,
+      output_op,
+      epilogue_idx.get(),
+      ptr_A.get(),
+      ptr_B.get(),
+      ptr_C.get(),
+      ptr_D.get(),
+      lda.get(),
+      ldb.get(),
+      ldc.get(),
+      ldc.get(),
+      problem_sizes_host.data()
+    );
+
+    Gemm gemm;
+
+    EXPECT_EQ(gemm.can_implement(args), cutlass::Status::kSuccess);
+
+    size_t workspace_size = gemm.get_workspace_size(args);
+    cutlass::DeviceAllocation<uint8_t> workspace(workspace_size);
+
+    cutlass::Status status = gemm.initialize(args, workspace.get());
+
+    if (status != cutlass::Status::kSuccess) {
+      return false;
+    }
+
+    status = gemm.run();
+
+    if (status != cutlass::Status::kSuccess) {
+      return false;
+    }
+
+    cudaError_t result = cudaDeviceSynchronize();
+
+    EXPECT_EQ(result, cudaSuccess)
+      << "Kernel execution error: " << cudaGetErrorString(result);
+
+    if (result != cudaSuccess) {
+      return false;
+    }
+
+    for (int i = 0; i < problem_count; ++i) {
+      bool passed = (epilogue_idx_host.at(i) == 0) ?
+        verify_problem<ElementOutput0>(i, alpha, beta, false) :
+        verify_problem<ElementOutput1>(i, alpha, beta, true);
+      if (!passed) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+};
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <cutlass::gemm::kernel::GroupScheduleMode GroupScheduleMode_>
+struct GroupedHorizontalKernel_f16t_f16n_tensor_op_f32 {
+
+  using ElementAccumulator = float;
+
+  template <typename OutputOp>
+  using DefaultKernel = typename cutlass::gemm::kernel::DefaultGemmGrouped<
+    cutlass::half_t,
+    cutlass::layout::RowMajor,
+    cutlass::ComplexTransform::kNone,
+    8,
+    cutlass::half_t,
+    cutlass::layout::ColumnMajor,
+    cutlass::ComplexTransform::kNone,
+    8,
+    typename OutputOp::ElementOutput, cutlass::layout::RowMajor,
+    ElementAccumulator,
+    cutlass::arch::OpClassTensorOp,
+    cutlass::arch::Sm80,
+    cutlass::gemm::GemmShape<128, 128, 32>,
+    cutlass::gemm::GemmShape<64, 64, 32>,
+    cutlass::gemm::GemmShape<16, 8, 16>,
+    OutputOp,
+    cutlass::gemm::threadblock::GemmBatchedIdentityThreadblockSwizzle,
+    3,
+    GroupScheduleMode_>::GemmKernel;
+
+  // Half-precision outputs accessed in 128b vectors
+  using Kernel0 = DefaultKernel<cutlass::epilogue::thread::LinearCombination<
+    cutlass::half_t, 8, ElementAccumulator, ElementAccumulator>>;
+
+  // Single-precision outputs with ReLU accessed in 128b vectors
+  using Kernel1 = DefaultKernel<cutlass::epilogue::thread::LinearCombinationRelu<
+    float, 4, ElementAccumulator, ElementAccumulator>>;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmGroupedHorizontal<
+    typename Kernel0::Mma,
+    typename Kernel0::ThreadblockSwizzle,
+    GroupScheduleMode_,
+    typename Kernel0::Epilogue,
+    typename Kernel1::Epilogue>;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM80_Device_GemmGroupedHorizontal_f16t_f16n_f16t_f32t_tensor_op_f32, 128x128x32_64x64x32) {
+
+  using GemmKernel = typename GroupedHorizontalKernel_f16t_f16n_tensor_op_f32<
+    cutlass::gemm::kernel::GroupScheduleMode::kDeviceOnly>::GemmKernel;
+
+  using Gemm = cutlass::gemm::device::GemmGroupedHorizontal<GemmKernel>;
+
+  TestbedGroupedHorizontal<Gemm> testbed(24);
+
+  bool passed = testbed.run(1.f, 0.f);
+  EXPECT_TRUE(passed);
+}
+
+TEST(SM80_Device_GemmGroupedHorizontal_f16t_f16n_f16t_f32t_tensor_op_f32, 128x128x32_64x64x32_precompute) {
+
+  using GemmKernel = typename GroupedHorizontalKernel_f16t_f16n_tensor_op_f32<
+    cutlass::gemm::kernel::GroupScheduleMode::kHostPrecompute>::GemmKernel;
+
+  using Gemm = cutlass::gemm::device::GemmGroupedHorizontal<GemmKernel>;
+
+  TestbedGroupedHorizontal<Gemm> testbed(27);
+
+  bool passed = testbed.run(2.f, 1.f);
+  EXPECT_TRUE(passed);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // #if defined(CUTLASS_ARCH_MMA_SM80_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -203,9 +203,20 @@ struct IsDefaultEpilogue<cutlass::epilogue::collective::DefaultEpilogue<args...>
   static constexpr bool value = true;
 };
 
-template<class ...args>
-struct IsDefaultEpilogue<cutlass::epilogue::collective::detail::Sm90TmaWarpSpecializedAdapter<args...>> {
-  static constexpr bool value = true;
+template <typename Epilogue, typename = void>
+struct IsSm90NoSmemEpilogue {
+  static constexpr bool value = false;
+};
+
+template <typename Epilogue>
+struct IsSm90NoSmemEpilogue<Epilogue, cute::void_t<typename Epilogue::DispatchPolicy>> {
+  static constexpr bool value = cute::is_same_v<typename Epilogue::DispatchPolicy, cutlass::epilogue::Sm90NoSmemWarpSpecialized>;
+};
+
+// The direct store EVT epilogue is wrapped by the adapter as well, but takes fusion callback arguments
+template<class EpilogueOp>
+struct IsDefaultEpilogue<cutlass::epilogue::collective::detail::Sm90TmaWarpSpecializedAdapter<EpilogueOp>> {
+  static constexpr bool value = not IsSm90NoSmemEpilogue<EpilogueOp>::value;
 };
 
 template <typename Epilogue, typename = void>
@@ -1919,7 +1930,8 @@ struct HostCollectiveEpilogue {
   static constexpr bool IsColBiasEnabled        = FusionOp::IsPerColBiasSupported;
   static_assert(not (IsColBiasEnabled && IsRowBiasEnabled));
 
-  static constexpr bool IsDeBiasEnabled      = FusionOp::IsDePerRowBiasSupported;
+  static constexpr bool IsDeBiasEnabled      = FusionOp::IsDePerRowBiasSupported or FusionOp::IsDePerColBiasSupported;
+  static constexpr bool IsDeColBiasEnabled   = FusionOp::IsDePerColBiasSupported;
   static constexpr bool IsPerRowScaleEnabled = FusionOp::IsPerRowScaleSupported;
   static constexpr bool IsPerColScaleEnabled = FusionOp::IsPerColScaleSupported;
   static constexpr bool IsScaleFactorEnabled = FusionOp::IsScaleFactorSupported;
@@ -2142,8 +2154,8 @@ struct HostCollectiveEpilogue {
     }
 
     if constexpr (IsDeBiasEnabled) {
-      bias.resize(col_vector_coord);
-      reference_dbias.resize(col_vector_coord);
+      bias.resize(IsDeColBiasEnabled ? row_vector_coord : col_vector_coord);
+      reference_dbias.resize(IsDeColBiasEnabled ? row_vector_coord : col_vector_coord);
       cutlass::reference::host::TensorFill(bias.host_view(), ElementBias(0));
       cutlass::reference::host::TensorFill(reference_dbias.host_view(), ElementBias(0));
       bias.sync_device();
@@ -2531,7 +2543,7 @@ struct HostCollectiveEpilogue {
     auto D = cute::make_tensor(detail::make_iterator(reference_D.host_data()),
         cute::make_layout(cute::make_shape(M, N, L), stride_d));
     auto Bias = cute::make_tensor(detail::make_iterator(IsDeBiasEnabled ? reference_dbias.host_data() : bias.host_data()),
-        cute::make_layout(cute::make_shape(IsRowBiasEnabled ? M : N)));
+        cute::make_layout(cute::make_shape((IsRowBiasEnabled or (IsDeBiasEnabled and not IsDeColBiasEnabled)) ? M : N)));
     auto Aux = cute::make_tensor(detail::make_iterator(IsAuxInEnabled ? tensor_Aux.host_data() : reference_Aux.host_data()),
         cute::make_layout(cute::make_shape(M, N, L), stride_Aux));
     auto Valpha = [&](){
@@ -2598,7 +2610,7 @@ struct HostCollectiveEpilogue {
       decltype(SfD),
       Int<SFD_VectorSize>,
       cutlass::plus<ElementCompute>,
-      IsColBiasEnabled
+      IsColBiasEnabled or IsDeColBiasEnabled
       , SfGenStrategy
     > epilogue_params{};
 
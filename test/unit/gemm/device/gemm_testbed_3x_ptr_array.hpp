@@ -1905,6 +1905,9 @@ struct TestbedImpl {
 
   static constexpr bool IsGroupGemm = CollectiveEpilogue::IsGroupGemm;
 
+  // Load through tensormaps prebuilt for all groups, if the mainloop supports them
+  bool prebuild_tensormaps = false;
+
   //
   // Methods
   //
@@ -2064,6 +2067,9 @@ struct TestbedImpl {
     typename HostCollectiveMainloopType::Arguments mainloop_args;
 
     mainloop_args = collective_mma_inputs.to_args(problem_shapes);
+    if constexpr (cutlass::gemm::kernel::detail::Has_PrebuiltTensorMaps_v<typename Gemm::GemmKernel::CollectiveMainloop>) {
+      mainloop_args.prebuild_tensormaps = prebuild_tensormaps;
+    }
 
     if constexpr (IsGroupGemm) {
       arguments =
@@ -2198,11 +2204,13 @@ template <
   typename Gemm,
   template <class T> class ActivationFunctor = cutlass::epilogue::thread::Identity
 >
-bool TestAll(double alpha = 1.0, double beta = 0.0, CheckEquality check_relative_equality = CheckEquality::RELATIVE) {
+bool TestAll(double alpha = 1.0, double beta = 0.0, CheckEquality check_relative_equality = CheckEquality::RELATIVE,
+             bool prebuild_tensormaps = false) {
   using ElementScalar = typename Gemm::EpilogueOutputOp::ElementScalar;
   using ProblemShapeType = typename Gemm::GemmKernel::ProblemShape;
 
   Testbed3x<Gemm, ActivationFunctor> testbed(check_relative_equality, ScalarLoc::ON_DEVICE, VectorScale::DISABLED);
+  testbed.impl_.prebuild_tensormaps = prebuild_tensormaps;
 
   int max_alignment = std::max(Gemm::kAlignmentA, Gemm::kAlignmentB);
   std::vector<int> problem_size_m = {max_alignment, 512 - 3 * max_alignment};
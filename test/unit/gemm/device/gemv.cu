@@ -281,7 +281,8 @@ public:
     int64_t batch_stride_C,
     int64_t batch_stride_D,
     ElementCompute alpha,
-    ElementCompute beta) {
+    ElementCompute beta,
+    int split_k_slices = 1) {
 
     this->initialize(problem_size, batch_count);
 
@@ -303,6 +304,10 @@ public:
       batch_stride_D
     };
 
+    if constexpr (Gemv::kSupportsSplitK) {
+      arguments.split_k_slices = split_k_slices;
+    }
+
     Gemv gemm_op;
 
     cutlass::Status status = gemm_op.can_implement(arguments);
@@ -397,6 +402,61 @@ bool TestAllGemv() {
   return true;
 }
 
+template <typename Gemv> 
+bool TestAllGemvSplitK() {
+
+  using ElementCompute = typename Gemv::EpilogueOutputOp::ElementCompute;
+
+  int Batch[] = {
+    1, 3
+  };
+
+  int M[] = {
+    1, 5, 33
+  };
+
+  int K[] = {
+    1024, 4104
+  };
+
+  // 0 selects the number of slices from the SM count
+  int SplitKSlices[] = {
+    0, 2, 3, 7
+  };
+
+  double Beta[] = {
+    0, 1.25
+  };
+
+  for (int b : Batch) {
+    for (int m : M) {
+      for (int k : K) {
+        for (int split_k_slices : SplitKSlices) {
+          for (double beta : Beta) {
+
+            TestbedGemv<Gemv> testbed;
+
+            if (!testbed.run(
+                    {m, k},
+                    b,
+                    m * k,
+                    k,
+                    m,
+                    m,
+                    ElementCompute(1.25),
+                    ElementCompute(beta),
+                    split_k_slices)) {
+              return false;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
 } // namespace gemm
 } // namespace test
 
@@ -433,6 +493,37 @@ TEST(SM50_Device_Gemv_f16n_f16_f16_simt_f32, RowMajorA) {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+TEST(SM50_Device_Gemv_f16n_f16_f16_simt_f32, RowMajorA_SplitK) {
+
+  using ElementInput = cutlass::half_t;
+  using ElementOutput = cutlass::half_t;
+  using LayoutA = cutlass::layout::RowMajor;
+  using ElementAccumulator = float;
+  int const kElementsPerAccess = 8;
+  
+  using EpilogueOp = cutlass::epilogue::thread::LinearCombination<
+      ElementOutput,
+      1,
+      ElementAccumulator,
+      ElementAccumulator>;
+
+  using Gemv = cutlass::gemm::device::Gemv<
+      cutlass::gemm::kernel::Gemv<
+          ElementInput,           // Element A
+          LayoutA,                // Layout A
+          ElementInput,           // Element B
+          ElementOutput,          // Element C
+          ElementAccumulator,     // Element accumulator
+          EpilogueOp,             // Output operator
+          kElementsPerAccess      // Element access granularity
+          >
+      >;
+
+  EXPECT_TRUE(test::gemm::TestAllGemvSplitK<Gemv>());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 TEST(SM50_Device_Gemv_f32n_f32_f32_simt_f32, RowMajorA) {
 
   using ElementInput = float;
@@ -464,6 +555,37 @@ TEST(SM50_Device_Gemv_f32n_f32_f32_simt_f32, RowMajorA) {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+TEST(SM50_Device_Gemv_f32n_f32_f32_simt_f32, RowMajorA_SplitK) {
+
+  using ElementInput = float;
+  using ElementOutput = float;
+  using LayoutA = cutlass::layout::RowMajor;
+  using ElementAccumulator = float;
+  int const kElementsPerAccess = 4;
+  
+  using EpilogueOp = cutlass::epilogue::thread::LinearCombination<
+      ElementOutput,
+      1,
+      ElementAccumulator,
+      ElementAccumulator>;
+
+  using Gemv = cutlass::gemm::device::Gemv<
+      cutlass::gemm::kernel::Gemv<
+          ElementInput,           // Element A
+          LayoutA,                // Layout A
+          ElementInput,           // Element B
+          ElementOutput,          // Element C
+          ElementAccumulator,     // Element accumulator
+          EpilogueOp,             // Output operator
+          kElementsPerAccess      // Element access granularity
+          >
+      >;
+
+  EXPECT_TRUE(test::gemm::TestAllGemvSplitK<Gemv>());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 TEST(SM50_Device_Gemv_f64n_f64_f64_simt_f64, RowMajorA) {
 
   using ElementInput = double;
@@ -216,7 +216,7 @@ struct MultistageTestbed {
 
     reference_gemm(
         problem_size, alpha, tensor_A.host_ref(), tensor_B.host_ref(), beta,
-        reference_D.host_ref(), ElementAccumulator(0));
+        reference_D.host_ref(), ElementAccumulator(0), 0 /* num_threads, all hardware threads */);
 
     tensor_D.sync_host();
 
@@ -0,0 +1,347 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the segmented multi-LoRA shrink and expand (SGMV) kernels
+*/
+
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/epilogue/thread/linear_combination.h"
+#include "cutlass/gemm/kernel/sgmv.h"
+#include "cutlass/gemm/device/sgmv.h"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "cutlass/util/host_tensor.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/reference/host/tensor_fill.h"
+#include "cutlass/util/reference/host/tensor_copy.h"
+#include "cutlass/util/reference/host/tensor_compare.h"
+#include "cutlass/util/reference/host/tensor_norm.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test {
+namespace gemm {
+
+/// Runs the shrink and expand kernels over segments of tokens and compares to a host reference
+template <typename Shrink, typename Expand>
+class TestbedSgmv {
+public:
+
+  using ElementX = typename Shrink::SgmvKernel::ElementX;
+  using ElementW = typename Shrink::SgmvKernel::ElementW;
+  using ElementS = typename Shrink::SgmvKernel::ElementS;
+  using ElementC = typename Expand::SgmvKernel::ElementC;
+  using ElementCompute = typename Expand::SgmvKernel::EpilogueOutputOp::ElementCompute;
+
+  using Layout = cutlass::layout::RowMajor;
+
+  uint64_t seed;
+
+  cutlass::HostTensor<ElementX, Layout> tensor_X;
+  cutlass::HostTensor<ElementW, Layout> tensor_A;      ///< Adapters stacked along rows
+  cutlass::HostTensor<ElementW, Layout> tensor_B;      ///< Adapters stacked along rows
+  cutlass::HostTensor<ElementS, Layout> tensor_S;
+  cutlass::HostTensor<ElementC, Layout> tensor_C;
+  cutlass::HostTensor<ElementC, Layout> tensor_D;
+  cutlass::HostTensor<ElementS, Layout> reference_S;
+  cutlass::HostTensor<ElementC, Layout> reference_D;
+
+  cutlass::DeviceAllocation<int> segment_offsets;
+  cutlass::DeviceAllocation<int> adapter_indices;
+  cutlass::DeviceAllocation<ElementW const *> ptr_A;
+  cutlass::DeviceAllocation<ElementW const *> ptr_B;
+
+  TestbedSgmv(uint64_t seed_ = 2025): seed(seed_) { }
+
+  /// Runs one problem. Segment lengths may be zero and adapter indices may be negative.
+  bool run(
+    int hidden,
+    int n,
+    int rank,
+    int adapter_count,
+    std::vector<int> const &segment_lengths,
+    std::vector<int> const &segment_adapters,
+    ElementCompute alpha,
+    ElementCompute beta,
+    bool in_place = false) {
+
+    int num_segments = int(segment_lengths.size());
+    std::vector<int> offsets(num_segments + 1, 0);
+    for (int s = 0; s < num_segments; ++s) {
+      offsets[s + 1] = offsets[s] + segment_lengths[s];
+    }
+    int num_tokens = offsets[num_segments];
+
+    //
+    // Initialize
+    //
+
+    tensor_X.resize({num_tokens, hidden});
+    tensor_A.resize({adapter_count * rank, hidden});
+    tensor_B.resize({adapter_count * n, rank});
+    tensor_S.resize({num_tokens, rank});
+    tensor_C.resize({num_tokens, n});
+    tensor_D.resize({num_tokens, n});
+    reference_S.resize({num_tokens, rank}, false);
+    reference_D.resize({num_tokens, n}, false);
+
+    cutlass::reference::host::TensorFillRandomUniform(tensor_X.host_view(), seed + 1, 2, -2, 0);
+    cutlass::reference::host::TensorFillRandomUniform(tensor_A.host_view(), seed + 2, 2, -2, 0);
+    cutlass::reference::host::TensorFillRandomUniform(tensor_B.host_view(), seed + 3, 2, -2, 0);
+    cutlass::reference::host::TensorFillRandomUniform(tensor_C.host_view(), seed + 4, 2, -2, 0);
+    cutlass::reference::host::TensorFill(tensor_S.host_view(), ElementS(-1));
+
+    tensor_X.sync_device();
+    tensor_A.sync_device();
+    tensor_B.sync_device();
+    tensor_C.sync_device();
+    tensor_S.sync_device();
+    if (in_place) {
+      cutlass::reference::host::TensorCopy(tensor_D.host_view(), tensor_C.host_view());
+    }
+    tensor_D.sync_device();
+
+    std::vector<ElementW const *> host_ptr_A(adapter_count);
+    std::vector<ElementW const *> host_ptr_B(adapter_count);
+    for (int i = 0; i < adapter_count; ++i) {
+      host_ptr_A[i] = tensor_A.device_data() + int64_t(i) * rank * hidden;
+      host_ptr_B[i] = tensor_B.device_data() + int64_t(i) * n * rank;
+    }
+
+    segment_offsets.reset(num_segments + 1);
+    adapter_indices.reset(num_segments);
+    ptr_A.reset(adapter_count);
+    ptr_B.reset(adapter_count);
+    segment_offsets.copy_from_host(offsets.data());
+    adapter_indices.copy_from_host(segment_adapters.data());
+    ptr_A.copy_from_host(host_ptr_A.data());
+    ptr_B.copy_from_host(host_ptr_B.data());
+
+    cutlass::gemm::kernel::detail::SgmvSegments segments{
+      num_segments, segment_offsets.get(), adapter_indices.get()};
+
+    //
+    // Run the kernels
+    //
+
+    typename Shrink::Arguments shrink_args;
+    shrink_args.num_tokens = num_tokens;
+    shrink_args.hidden = hidden;
+    shrink_args.rank = rank;
+    shrink_args.segments = segments;
+    shrink_args.ptr_X = tensor_X.device_data();
+    shrink_args.ldx = hidden;
+    shrink_args.ptr_A = ptr_A.get();
+    shrink_args.ptr_S = tensor_S.device_data();
+    shrink_args.lds = rank;
+
+    typename Expand::Arguments expand_args;
+    expand_args.num_tokens = num_tokens;
+    expand_args.n = n;
+    expand_args.rank = rank;
+    expand_args.segments = segments;
+    expand_args.output_op = {alpha, beta};
+    expand_args.ptr_S = tensor_S.device_data();
+    expand_args.lds = rank;
+    expand_args.ptr_B = ptr_B.get();
+    expand_args.ptr_C = in_place ? tensor_D.device_data() : tensor_C.device_data();
+    expand_args.ldc = n;
+    expand_args.ptr_D = tensor_D.device_data();
+    expand_args.ldd = n;
+
+    Shrink shrink_op;
+    Expand expand_op;
+
+    EXPECT_EQ(Shrink::can_implement(shrink_args), cutlass::Status::kSuccess);
+    EXPECT_EQ(Expand::can_implement(expand_args), cutlass::Status::kSuccess);
+
+    cutlass::Status status = shrink_op(shrink_args);
+    EXPECT_EQ(status, cutlass::Status::kSuccess);
+    status = expand_op(expand_args);
+    EXPECT_EQ(status, cutlass::Status::kSuccess);
+
+    cudaError_t result = cudaDeviceSynchronize();
+    EXPECT_EQ(result, cudaSuccess) << " CUDA error: " << cudaGetErrorString(result);
+    if (status != cutlass::Status::kSuccess || result != cudaSuccess) {
+      return false;
+    }
+
+    //
+    // Reference
+    //
+
+    for (int s = 0; s < num_segments; ++s) {
+      int adapter = segment_adapters[s];
+      for (int t = offsets[s]; t < offsets[s + 1]; ++t) {
+        for (int r = 0; r < rank; ++r) {
+          float accum = 0;
+          if (adapter >= 0) {
+            for (int k = 0; k < hidden; ++k) {
+              accum += float(tensor_X.at({t, k})) * float(tensor_A.at({adapter * rank + r, k}));
+            }
+          }
+          reference_S.at({t, r}) = ElementS(accum);
+        }
+        for (int j = 0; j < n; ++j) {
+          float accum = 0;
+          if (adapter >= 0) {
+            for (int r = 0; r < rank; ++r) {
+              accum += float(reference_S.at({t, r})) * float(tensor_B.at({adapter * n + j, r}));
+            }
+          }
+          reference_D.at({t, j}) = ElementC(
+            float(alpha) * accum + float(beta) * float(tensor_C.at({t, j})));
+        }
+      }
+    }
+
+    tensor_S.sync_host();
+    tensor_D.sync_host();
+
+    EXPECT_GT(cutlass::reference::host::TensorNorm(reference_D.host_view()), 0);
+
+    bool passed_S = cutlass::reference::host::TensorRelativelyEquals(
+      reference_S.host_view(), tensor_S.host_view(), ElementS(1e-3), ElementS(1e-3));
+    bool passed_D = cutlass::reference::host::TensorRelativelyEquals(
+      reference_D.host_view(), tensor_D.host_view(), ElementC(1e-2), ElementC(1e-2));
+
+    EXPECT_TRUE(passed_S) << " mismatched shrink output";
+    EXPECT_TRUE(passed_D) << " mismatched expand output";
+
+    return passed_S && passed_D;
+  }
+};
+
+/// Covers multi-token segments, empty segments, tokens without an adapter and one token per segment
+template <typename Shrink, typename Expand>
+bool TestAllSgmv(int rank) {
+
+  using ElementCompute = typename Expand::SgmvKernel::EpilogueOutputOp::ElementCompute;
+
+  struct Problem {
+    int hidden;
+    int n;
+    std::vector<int> segment_lengths;
+    std::vector<int> segment_adapters;
+  };
+
+  std::vector<Problem> problems = {
+    // Prefill with a few long segments
+    {512, 1024, {37, 0, 64, 5}, {2, 0, -1, 1}},
+    // Decode with one token per segment (BGMV)
+    {1024, 264, {1, 1, 1, 1, 1, 1, 1}, {0, 3, 3, -1, 1, 2, 0}},
+    // Hidden dimension not a multiple of the warp stride
+    {136, 40, {3, 11}, {1, 0}},
+  };
+
+  for (auto const &problem : problems) {
+    for (bool in_place : {false, true}) {
+      TestbedSgmv<Shrink, Expand> testbed;
+      bool passed = testbed.run(
+        problem.hidden, problem.n, rank, 4,
+        problem.segment_lengths, problem.segment_adapters,
+        ElementCompute(1), in_place ? ElementCompute(1) : ElementCompute(0.5), in_place);
+      if (!passed) {
+        std::cerr << "hidden: " << problem.hidden << ", n: " << problem.n << ", rank: " << rank
+                  << ", in place: " << in_place << std::endl;
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+} // namespace gemm
+} // namespace test
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM50_Device_Sgmv_f16_f32_f16_simt_f32, Rank16) {
+
+  using ElementInput = cutlass::half_t;
+  using ElementOutput = cutlass::half_t;
+  using ElementAccumulator = float;
+
+  using EpilogueOp = cutlass::epilogue::thread::LinearCombination<
+      ElementOutput, 1, ElementAccumulator, ElementAccumulator>;
+
+  using Shrink = cutlass::gemm::device::Sgmv<
+      cutlass::gemm::kernel::SgmvShrink<ElementInput, ElementInput, float, ElementAccumulator>>;
+  using Expand = cutlass::gemm::device::Sgmv<
+      cutlass::gemm::kernel::SgmvExpand<float, ElementInput, ElementOutput, ElementAccumulator, EpilogueOp, 16>>;
+
+  EXPECT_TRUE((test::gemm::TestAllSgmv<Shrink, Expand>(16)));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM50_Device_Sgmv_f16_f32_f16_simt_f32, Rank8_MaxRank64) {
+
+  using ElementInput = cutlass::half_t;
+  using ElementOutput = cutlass::half_t;
+  using ElementAccumulator = float;
+
+  using EpilogueOp = cutlass::epilogue::thread::LinearCombination<
+      ElementOutput, 1, ElementAccumulator, ElementAccumulator>;
+
+  using Shrink = cutlass::gemm::device::Sgmv<
+      cutlass::gemm::kernel::SgmvShrink<ElementInput, ElementInput, float, ElementAccumulator, 8, 8>>;
+  using Expand = cutlass::gemm::device::Sgmv<
+      cutlass::gemm::kernel::SgmvExpand<float, ElementInput, ElementOutput, ElementAccumulator, EpilogueOp, 64>>;
+
+  EXPECT_TRUE((test::gemm::TestAllSgmv<Shrink, Expand>(8)));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM50_Device_Sgmv_f16_f16_f16_simt_f32, Rank32) {
+
+  using ElementInput = cutlass::half_t;
+  using ElementOutput = cutlass::half_t;
+  using ElementAccumulator = float;
+
+  using EpilogueOp = cutlass::epilogue::thread::LinearCombination<
+      ElementOutput, 1, ElementAccumulator, ElementAccumulator>;
+
+  using Shrink = cutlass::gemm::device::Sgmv<
+      cutlass::gemm::kernel::SgmvShrink<ElementInput, ElementInput, ElementInput, ElementAccumulator>>;
+  using Expand = cutlass::gemm::device::Sgmv<
+      cutlass::gemm::kernel::SgmvExpand<ElementInput, ElementInput, ElementOutput, ElementAccumulator, EpilogueOp, 32>>;
+
+  EXPECT_TRUE((test::gemm::TestAllSgmv<Shrink, Expand>(32)));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,276 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the Sm100 blockscaled mainloop that quantizes a 16b A to the block scaled type of B in SMEM
+*/
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+
+#include "cutlass/epilogue/dispatch_policy.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/host_tensor.h"
+#include "cutlass/util/packed_stride.hpp"
+#include "cutlass/util/reference/host/gett.hpp"
+
+#include "../../../common/cutlass_unit_test.h"
+
+using namespace cute;
+
+#if defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
+
+namespace test::gemm::device {
+
+// Quantizes A on the host with the same recipe as the mainloop, runs the plain host blockscaled GEMM
+// on the quantized A, SFA, B and SFB, and compares it with the kernel that quantizes A in SMEM.
+template <class Gemm, class ElementPairB>
+bool testBlockScaledInputQuant(int m, int n, int k, float norm_constant) {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using CollectiveMainloop = typename GemmKernel::CollectiveMainloop;
+  using Sm1xxBlkScaledConfig = typename CollectiveMainloop::Sm1xxBlkScaledConfig;
+  using ElementA = typename CollectiveMainloop::ElementA;
+  using ElementData = typename ElementPairB::DataType;
+  using ElementSF = typename ElementPairB::ScaleFactorType;
+  using ElementD = float;
+  constexpr int SFVecSize = Sm1xxBlkScaledConfig::SFVecSize;
+
+  auto stride_A = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, {m, k, 1});
+  auto stride_B = cutlass::make_cute_packed_stride(typename CollectiveMainloop::StrideB{}, {n, k, 1});
+  auto stride_C = cutlass::make_cute_packed_stride(typename GemmKernel::StrideC{}, {m, n, 1});
+  auto stride_D = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, {m, n, 1});
+  auto layout_A = make_layout(make_shape(m, k, 1), stride_A);
+  auto layout_B = make_layout(make_shape(n, k, 1), stride_B);
+  auto layout_D = make_layout(make_shape(m, n, 1), stride_D);
+  auto layout_SFA = Sm1xxBlkScaledConfig::tile_atom_to_shape_SFA(make_shape(m, n, k, 1));
+  auto layout_SFB = Sm1xxBlkScaledConfig::tile_atom_to_shape_SFB(make_shape(m, n, k, 1));
+
+  std::vector<ElementA> host_A(m * k);
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < k; ++j) {
+      // Rows differ in magnitude so that the scale factors differ
+      host_A[i * k + j] = ElementA(float((i * 7 + j * 3) % 13 - 6) * float(1 << (i % 5)) * 0.125f);
+    }
+  }
+  // A zero vector must quantize to zero rather than NaN
+  for (int j = 0; j < SFVecSize && m > 1; ++j) {
+    host_A[k + j] = ElementA(0);
+  }
+
+  cutlass::HostTensor<ElementData, cutlass::layout::PackedVectorLayout> block_A_quant(cutlass::make_Coord(m * k));
+  cutlass::HostTensor<ElementSF, cutlass::layout::PackedVectorLayout> block_SFA(cutlass::make_Coord(size(filter_zeros(layout_SFA))));
+  cutlass::HostTensor<ElementData, cutlass::layout::PackedVectorLayout> block_B(cutlass::make_Coord(n * k));
+  cutlass::HostTensor<ElementSF, cutlass::layout::PackedVectorLayout> block_SFB(cutlass::make_Coord(size(filter_zeros(layout_SFB))));
+  cutlass::HostTensor<ElementD, cutlass::layout::PackedVectorLayout> block_C(cutlass::make_Coord(m * n));
+  cutlass::HostTensor<ElementD, cutlass::layout::PackedVectorLayout> block_ref_D(cutlass::make_Coord(m * n));
+
+  Tensor tensor_A_quant = make_tensor(recast_ptr<ElementData>(block_A_quant.host_data()), layout_A);
+  Tensor tensor_SFA = make_tensor(block_SFA.host_data(), layout_SFA);
+  Tensor tensor_B = make_tensor(recast_ptr<ElementData>(block_B.host_data()), layout_B);
+  Tensor tensor_SFB = make_tensor(block_SFB.host_data(), layout_SFB);
+  Tensor tensor_C = make_tensor(block_C.host_data(), layout_D);
+  Tensor tensor_ref_D = make_tensor(block_ref_D.host_data(), layout_D);
+
+  for (int j = 0; j < n; ++j) {
+    for (int kk = 0; kk < k; ++kk) {
+      tensor_B(j, kk, 0) = ElementData(float((j * 3 + kk * 5) % 5 - 2));
+    }
+  }
+  for (int i = 0; i < int(block_SFB.size()); ++i) {
+    block_SFB.host_data()[i] = ElementSF(0.5f * float(1 << (i % 3)));
+  }
+  for (int i = 0; i < m * n; ++i) {
+    block_C.host_data()[i] = ElementD(0);
+  }
+
+  // Host quantization of A, SF = amax * norm_constant / max(ElementData) and A_quant = A * norm_constant / SF
+  float fp_max = float(cutlass::platform::numeric_limits<ElementData>::max());
+  float norm_constant_scaled_down = norm_constant * cutlass::reciprocal_approximate_ftz<float>{}(fp_max);
+  for (int i = 0; i < m; ++i) {
+    for (int kb = 0; kb < k; kb += SFVecSize) {
+      float amax = 0.0f;
+      for (int j = kb; j < kb + SFVecSize; ++j) {
+        amax = std::max(amax, std::abs(float(host_A[i * k + j])));
+      }
+      ElementSF sf = cutlass::NumericConverter<ElementSF, float>{}(amax * norm_constant_scaled_down);
+      float sf_rcp;
+      if constexpr (cute::is_same_v<ElementSF, cutlass::float_ue8m0_t>) {
+        sf_rcp = float(cutlass::reciprocal_approximate<ElementSF>{}(sf));
+      }
+      else {
+        sf_rcp = cutlass::reciprocal_approximate_ftz<float>{}(float(sf));
+      }
+      float scale = cutlass::minimum_with_nan_propagation<float>{}(
+          norm_constant * sf_rcp, cutlass::platform::numeric_limits<float>::max());
+      for (int j = kb; j < kb + SFVecSize; ++j) {
+        tensor_SFA(i, j, 0) = sf;
+        tensor_A_quant(i, j, 0) = cutlass::NumericConverter<ElementData, float>{}(float(host_A[i * k + j]) * scale);
+      }
+    }
+  }
+
+  // Plain blockscaled GEMM on the quantized A, the dequantized A is norm_constant * A
+  float alpha = 1.0f / norm_constant;
+  cutlass::reference::host::GettBlockScalingMainloopParams<
+      float, decltype(tensor_A_quant), decltype(tensor_SFA), decltype(tensor_B), decltype(tensor_SFB)
+    > mainloop_params{tensor_A_quant, tensor_SFA, tensor_B, tensor_SFB};
+  cutlass::reference::host::GettBlockScalingEpilogueParams<
+      float, float, float, decltype(tensor_C), decltype(tensor_ref_D)
+    > epilogue_params{alpha, 0.0f, tensor_C, tensor_ref_D};
+  cutlass::reference::host::Gemm3x(mainloop_params, epilogue_params);
+
+  block_B.sync_device();
+  block_SFB.sync_device();
+  cutlass::DeviceAllocation<ElementA> A_block(host_A.size());
+  cutlass::DeviceAllocation<ElementD> D_block(m * n);
+  A_block.copy_from_host(host_A.data());
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {m, n, k, 1},
+    {A_block.get(), stride_A, block_B.device_data(), stride_B, block_SFB.device_data(), layout_SFB, norm_constant},
+    {{alpha, 0.0f}, nullptr, stride_C, D_block.get(), stride_D}
+  };
+
+  Gemm gemm_op;
+  cutlass::Status status = gemm_op.can_implement(arguments);
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  if (status != cutlass::Status::kSuccess) {
+    return false;
+  }
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  status = gemm_op.initialize(arguments, workspace.get());
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  status = gemm_op.run();
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  cudaError_t result = cudaDeviceSynchronize();
+  EXPECT_EQ(result, cudaSuccess) << "Error at Kernel Sync.";
+  if (status != cutlass::Status::kSuccess || result != cudaSuccess) {
+    return false;
+  }
+
+  std::vector<ElementD> host_D(m * n);
+  D_block.copy_to_host(host_D.data());
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < n; ++j) {
+      // A quantized value that lands on the other side of a rounding boundary in the kernel only
+      // perturbs a single product, so the tolerance scales with the magnitude of the dot product
+      float abs_sum = 0.0f;
+      for (int kk = 0; kk < k; ++kk) {
+        abs_sum += std::abs(float(host_A[i * k + kk]) * float(tensor_B(j, kk, 0)) * float(tensor_SFB(j, kk, 0)));
+      }
+      float expected = tensor_ref_D(i, j, 0);
+      float actual = host_D[i * n + j];
+      if (!(std::abs(actual - expected) <= 1e-2f * abs_sum + 1e-3f)) {
+        std::cout << "D mismatch at (" << i << ", " << j << "): " << actual << " vs " << expected << std::endl;
+        return false;
+      }
+    }
+  }
+
+  // norm_constant must be positive
+  arguments.mainloop.norm_constant = 0.0f;
+  EXPECT_NE(gemm_op.can_implement(arguments), cutlass::Status::kSuccess);
+
+  return true;
+}
+
+template <class ElementPairB, class TileShape_MNK, class ClusterShape_MNK>
+static bool run_blockscaled_input_quant_test(int m, int n, int k, float norm_constant = 1.0f) {
+  constexpr int AlignmentB = 128 / cute::sizeof_bits_v<typename ElementPairB::DataType>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm100, cutlass::arch::OpClassBlockScaledTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      void, cutlass::layout::RowMajor, 4,
+      float, cutlass::layout::RowMajor, 4,
+      cutlass::epilogue::TmaWarpSpecialized1Sm
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm100, cutlass::arch::OpClassBlockScaledTensorOp,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      ElementPairB, cutlass::layout::ColumnMajor, AlignmentB,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::gemm::KernelTmaWarpSpecialized1SmBlockScaledInputQuantSm100
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue>;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+  return testBlockScaledInputQuant<Gemm, ElementPairB>(m, n, k, norm_constant);
+}
+
+} // namespace test::gemm::device
+
+TEST(SM100Only_Device_Gemm_f16t_nvf4n_void_f32t_bstensorop_f32_input_quant, 128x128x256_1x1x1_1sm) {
+  using ElementPairB = cutlass::nv_float4_t<cutlass::float_e2m1_t>;
+  using TileShape = Shape<_128,_128,_256>;
+  using ClusterShape = Shape<_1,_1,_1>;
+  EXPECT_TRUE((test::gemm::device::run_blockscaled_input_quant_test<ElementPairB, TileShape, ClusterShape>(256, 256, 512)));
+  EXPECT_TRUE((test::gemm::device::run_blockscaled_input_quant_test<ElementPairB, TileShape, ClusterShape>(200, 384, 256, /*norm_constant=*/4.0f)));
+}
+
+TEST(SM100Only_Device_Gemm_f16t_nvf4n_void_f32t_bstensorop_f32_input_quant, 128x256x256_1x2x1_1sm) {
+  using ElementPairB = cutlass::nv_float4_t<cutlass::float_e2m1_t>;
+  using TileShape = Shape<_128,_256,_256>;
+  using ClusterShape = Shape<_1,_2,_1>;
+  EXPECT_TRUE((test::gemm::device::run_blockscaled_input_quant_test<ElementPairB, TileShape, ClusterShape>(256, 512, 512)));
+}
+
+TEST(SM100Only_Device_Gemm_f16t_mxf8n_void_f32t_bstensorop_f32_input_quant, 128x128x128_1x1x1_1sm) {
+  using ElementPairB = cutlass::mx_float8_t<cutlass::float_e4m3_t>;
+  using TileShape = Shape<_128,_128,_128>;
+  using ClusterShape = Shape<_1,_1,_1>;
+  EXPECT_TRUE((test::gemm::device::run_blockscaled_input_quant_test<ElementPairB, TileShape, ClusterShape>(256, 256, 512)));
+  EXPECT_TRUE((test::gemm::device::run_blockscaled_input_quant_test<ElementPairB, TileShape, ClusterShape>(200, 384, 256, /*norm_constant=*/4.0f)));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
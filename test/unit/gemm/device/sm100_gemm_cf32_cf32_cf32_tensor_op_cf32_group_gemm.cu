@@ -0,0 +1,165 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for device-wide Grouped GEMM interface with interleaved complex TF32 operands
+*/
+
+#include <iostream>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x_ptr_array.hpp"
+
+#if defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
+
+using namespace cute;
+
+namespace {
+
+template <
+  class TransformA,
+  class TransformB,
+  class LayoutA,
+  class LayoutB,
+  class MmaTileShape,
+  class ClusterShape,
+  class KernelSchedule,
+  class EpilogueSchedule,
+  class TileScheduler = void
+>
+struct GroupedComplexTF32Gemm {
+  using ElementA = cutlass::complex<float>;
+  using ElementB = cutlass::complex<float>;
+  using ElementC = cutlass::complex<float>;
+  using ElementD = cutlass::complex<float>;
+  using ElementAccumulator = cutlass::complex<float>;
+  using LayoutC = cutlass::layout::ColumnMajor;
+  static constexpr int Alignment = 2;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm100, cutlass::arch::OpClassTensorOp,
+      MmaTileShape, ClusterShape,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      ElementAccumulator, ElementAccumulator,
+      ElementC, LayoutC *, Alignment,
+      ElementD, LayoutC *, Alignment,
+      EpilogueSchedule
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm100, cutlass::arch::OpClassTensorOp,
+      cute::tuple<ElementA, TransformA>, LayoutA *, Alignment,
+      cute::tuple<ElementB, TransformB>, LayoutB *, Alignment,
+      ElementAccumulator,
+      MmaTileShape, ClusterShape,
+      cutlass::gemm::collective::StageCountAutoCarveout<
+        static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      cutlass::gemm::GroupProblemShape<Shape<int,int,int>>,
+      CollectiveMainloop,
+      CollectiveEpilogue,
+      TileScheduler
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+} // namespace
+
+TEST(SM100_Device_Gemm_cf32n_cf32t_cf32n_tensor_op_1sm_cf32_group, 128x64x16_1x1x1) {
+  using Gemm = typename GroupedComplexTF32Gemm<
+      cute::identity, cute::identity,
+      cutlass::layout::ColumnMajor, cutlass::layout::RowMajor,
+      Shape<_128,_64,_16>, Shape<_1,_1,_1>,
+      cutlass::gemm::KernelPtrArrayTmaWarpSpecialized1SmInterleavedComplexTF32Sm100,
+      cutlass::epilogue::PtrArrayNoSmemWarpSpecialized1Sm
+    >::Gemm;
+  using namespace test::gemm::device;
+  bool result = TestSmall<Gemm, true>(1.0, 2.0);
+  EXPECT_TRUE(result);
+}
+
+TEST(SM100_Device_Gemm_cf32t_cf32n_cf32n_tensor_op_1sm_cf32_group, 128x64x16_1x2x1_conjugate) {
+  using Gemm = typename GroupedComplexTF32Gemm<
+      cute::conjugate, cute::identity,
+      cutlass::layout::RowMajor, cutlass::layout::ColumnMajor,
+      Shape<_128,_64,_16>, Shape<_1,_2,_1>,
+      cutlass::gemm::KernelPtrArrayTmaWarpSpecialized1SmInterleavedComplexTF32Sm100,
+      cutlass::epilogue::PtrArrayNoSmemWarpSpecialized1Sm
+    >::Gemm;
+  using namespace test::gemm::device;
+  bool result = TestSmall<Gemm, true>(1.0, 0.0);
+  EXPECT_TRUE(result);
+}
+
+TEST(SM100_Device_Gemm_cf32n_cf32n_cf32n_tensor_op_2sm_cf32_group, 256x64x16_2x1x1) {
+  using Gemm = typename GroupedComplexTF32Gemm<
+      cute::identity, cute::conjugate,
+      cutlass::layout::ColumnMajor, cutlass::layout::ColumnMajor,
+      Shape<_256,_64,_16>, Shape<_2,_1,_1>,
+      cutlass::gemm::KernelPtrArrayTmaWarpSpecialized2SmInterleavedComplexTF32Sm100,
+      cutlass::epilogue::PtrArrayNoSmemWarpSpecialized2Sm
+    >::Gemm;
+  using namespace test::gemm::device;
+  bool result = TestSmall<Gemm, true>(2.0, 1.0);
+  EXPECT_TRUE(result);
+}
+
+TEST(SM100_Device_Gemm_cf32n_cf32t_cf32n_tensor_op_1sm_cf32_group, 128x64x16_1x1x1_dynamic_scheduler) {
+  using Gemm = typename GroupedComplexTF32Gemm<
+      cute::identity, cute::identity,
+      cutlass::layout::ColumnMajor, cutlass::layout::RowMajor,
+      Shape<_128,_64,_16>, Shape<_1,_1,_1>,
+      cutlass::gemm::KernelPtrArrayTmaWarpSpecialized1SmInterleavedComplexTF32Sm100,
+      cutlass::epilogue::PtrArrayNoSmemWarpSpecialized1Sm,
+      cutlass::gemm::DynamicGroupScheduler
+    >::Gemm;
+  using namespace test::gemm::device;
+  bool result = TestSmall<Gemm, true>(1.0, 2.0);
+  EXPECT_TRUE(result);
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
@@ -0,0 +1,219 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for Sm100 f16_f16_f16 GEMMs with the gated (GLU) activation epilogue
+*/
+
+#include <cmath>
+#include <vector>
+#include <iostream>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/epilogue/collective/collective_builder_gated.hpp"
+#include "cutlass/gemm/collective/collective_builder_gated.hpp"
+#include "cutlass/epilogue/thread/activation.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
+
+using namespace cute;
+
+namespace test::gemm::device {
+
+// Runs a (M, 2N, K) GEMM whose gate and up columns of B alternate, and checks the (M, N) output
+// D(m,n) = Z(m,2n) * SiLu(Z(m,2n+1)) with Z = alpha * A * B + beta * C against a host reference.
+template <class Gemm>
+bool testGatedAct(int m, int n, int k, float alpha, float beta) {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+  using ElementC = typename Gemm::ElementC;
+  using ElementD = cutlass::half_t;
+  using StrideD = cutlass::gemm::TagToStrideC_t<cutlass::layout::RowMajor>;
+
+  int n2 = 2 * n;
+  std::vector<ElementA> host_A(m * k);
+  std::vector<ElementB> host_B(k * n2);
+  std::vector<ElementC> host_C(m * n2);
+  for (int i = 0; i < m * k; ++i) {
+    host_A[i] = ElementA(float((i * 7) % 5 - 2));
+  }
+  for (int i = 0; i < k * n2; ++i) {
+    host_B[i] = ElementB(float((i * 3) % 5 - 2));
+  }
+  for (int i = 0; i < m * n2; ++i) {
+    host_C[i] = ElementC(float((i * 11) % 7 - 3));
+  }
+
+  // Host reference, A is row-major, B column-major and C and D row-major
+  std::vector<float> ref_D(m * n);
+  for (int i = 0; i < m; ++i) {
+    float z[2];
+    for (int j = 0; j < n; ++j) {
+      for (int h = 0; h < 2; ++h) {
+        int col = 2 * j + h;
+        float acc = 0.0f;
+        for (int kk = 0; kk < k; ++kk) {
+          acc += float(host_A[i * k + kk]) * float(host_B[col * k + kk]);
+        }
+        z[h] = alpha * acc + beta * float(host_C[i * n2 + col]);
+      }
+      ref_D[i * n + j] = z[0] * (z[1] / (1.0f + std::exp(-z[1])));
+    }
+  }
+
+  cutlass::DeviceAllocation<ElementA> A_block(host_A.size());
+  cutlass::DeviceAllocation<ElementB> B_block(host_B.size());
+  cutlass::DeviceAllocation<ElementC> C_block(host_C.size());
+  cutlass::DeviceAllocation<ElementD> D_block(m * n);
+  A_block.copy_from_host(host_A.data());
+  B_block.copy_from_host(host_B.data());
+  C_block.copy_from_host(host_C.data());
+
+  auto stride_A = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, {m, k, 1});
+  auto stride_B = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, {n2, k, 1});
+  auto stride_C = cutlass::make_cute_packed_stride(typename GemmKernel::StrideC{}, {m, n2, 1});
+  auto stride_D = cutlass::make_cute_packed_stride(StrideD{}, {m, n, 1});
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {m, n2, k, 1},
+    {A_block.get(), stride_A, B_block.get(), stride_B},
+    {{}, C_block.get(), stride_C, nullptr, {}}
+  };
+  auto& fusion_args = arguments.epilogue.thread;
+  fusion_args.alpha = alpha;
+  fusion_args.beta = beta;
+  fusion_args.ptr_D = D_block.get();
+  fusion_args.dD = stride_D;
+
+  Gemm gemm_op;
+  cutlass::Status status = gemm_op.can_implement(arguments);
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  if (status != cutlass::Status::kSuccess) {
+    return false;
+  }
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  status = gemm_op.initialize(arguments, workspace.get());
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  status = gemm_op.run();
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  cudaError_t result = cudaDeviceSynchronize();
+  EXPECT_EQ(result, cudaSuccess) << "Error at Kernel Sync.";
+  if (status != cutlass::Status::kSuccess || result != cudaSuccess) {
+    return false;
+  }
+
+  std::vector<ElementD> host_D(m * n);
+  D_block.copy_to_host(host_D.data());
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < n; ++j) {
+      float expected = ref_D[i * n + j];
+      float actual = float(host_D[i * n + j]);
+      if (std::abs(actual - expected) > 1e-2f * std::abs(expected) + 1e-2f) {
+        std::cout << "D mismatch at (" << i << ", " << j << "): " << actual << " vs " << expected << std::endl;
+        return false;
+      }
+    }
+  }
+
+  // An odd number of columns cannot be split into gate and up pairs
+  arguments.problem_shape = {m, n2 - 1, k, 1};
+  EXPECT_NE(gemm_op.can_implement(arguments), cutlass::Status::kSuccess);
+
+  return true;
+}
+
+template <class TileShape_MNK, class ClusterShape_MNK, class KernelSchedule, class EpilogueSchedule>
+static bool run_gated_act_test(int m, int n, int k, float alpha = 0.0625f, float beta = 0.0f) {
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilderGated<
+      cutlass::arch::Sm100, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float, float, float,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      EpilogueSchedule,
+      cutlass::epilogue::thread::SiLu,
+      false
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilderGated<
+      cutlass::arch::Sm100, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue>;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+  return testGatedAct<Gemm>(m, n, k, alpha, beta);
+}
+
+} // namespace test::gemm::device
+
+TEST(SM100Only_Device_Gemm_f16t_f16n_f16t_tensor_op_f32_gated_silu, 128x128x64_1x1x1_1sm) {
+  auto run = [](int m, int n, int k, float alpha, float beta) {
+    return test::gemm::device::run_gated_act_test<Shape<_128,_128,_64>, Shape<_1,_1,_1>,
+        cutlass::gemm::KernelTmaWarpSpecialized1SmSm100, cutlass::epilogue::TmaWarpSpecialized1Sm>(m, n, k, alpha, beta);
+  };
+  EXPECT_TRUE(run(/*m=*/256, /*n=*/128, /*k=*/128, 0.0625f, 0.0f));
+  // Residue in M and in the output N, and a source tensor
+  EXPECT_TRUE(run(/*m=*/200, /*n=*/88, /*k=*/192, 0.0625f, 0.5f));
+}
+
+TEST(SM100Only_Device_Gemm_f16t_f16n_f16t_tensor_op_f32_gated_silu, 256x128x64_2x1x1_2sm) {
+  auto run = [](int m, int n, int k, float alpha, float beta) {
+    return test::gemm::device::run_gated_act_test<Shape<_256,_128,_64>, Shape<_2,_1,_1>,
+        cutlass::gemm::KernelTmaWarpSpecialized2SmSm100, cutlass::epilogue::TmaWarpSpecialized2Sm>(m, n, k, alpha, beta);
+  };
+  EXPECT_TRUE(run(/*m=*/512, /*n=*/192, /*k=*/128, 0.0625f, 0.0f));
+  EXPECT_TRUE(run(/*m=*/328, /*n=*/72, /*k=*/64, 0.0625f, 0.5f));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
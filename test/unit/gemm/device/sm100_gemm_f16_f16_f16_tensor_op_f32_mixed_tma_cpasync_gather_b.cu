@@ -0,0 +1,229 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the Sm100 mixed TMA/cp.async mainloop gathering the rows of B loaded with cp.async
+*/
+
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
+
+using namespace cute;
+
+namespace test::gemm::device {
+
+// Row n of B is row indices[n] of a (num_rows_B, K) source matrix. The indices are out of order,
+// skip source rows and repeat some of them, and the last source row is always gathered.
+static std::vector<int32_t> make_gather_b_indices(int n, int num_rows_B) {
+  std::vector<int32_t> indices(n);
+  for (int i = 0; i < n; ++i) {
+    indices[i] = (i * 29 + 5) % num_rows_B;
+    if (i % 3 == 2) {
+      indices[i] = indices[i - 1];
+    }
+  }
+  if (n > 1) {
+    indices[n - 1] = num_rows_B - 1;
+    indices[n / 2] = indices[0];
+  }
+  return indices;
+}
+
+template <class Gemm>
+bool testGatherB(int m, int n, int k, int num_rows_B) {
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+  using ElementD = typename Gemm::ElementD;
+  using GemmKernel = typename Gemm::GemmKernel;
+
+  std::vector<ElementA> host_A(m * k);
+  std::vector<ElementB> host_B(num_rows_B * k);
+  for (int i = 0; i < m * k; ++i) {
+    host_A[i] = ElementA(float((i * 7) % 5 - 2));
+  }
+  for (int i = 0; i < num_rows_B * k; ++i) {
+    host_B[i] = ElementB(float((i * 3) % 5 - 2));
+  }
+  std::vector<int32_t> host_indices = make_gather_b_indices(n, num_rows_B);
+
+  // Host reference, A is row-major and the source B column-major (K-major rows)
+  std::vector<float> ref_D(m * n);
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < n; ++j) {
+      int row = host_indices[j];
+      float acc = 0.0f;
+      for (int kk = 0; kk < k; ++kk) {
+        acc += float(host_A[i * k + kk]) * float(host_B[row * k + kk]);
+      }
+      ref_D[i * n + j] = acc;
+    }
+  }
+
+  cutlass::DeviceAllocation<ElementA> A_block(host_A.size());
+  cutlass::DeviceAllocation<ElementB> B_block(host_B.size());
+  cutlass::DeviceAllocation<int32_t> indices_block(host_indices.size());
+  cutlass::DeviceAllocation<ElementD> D_block(m * n);
+  A_block.copy_from_host(host_A.data());
+  B_block.copy_from_host(host_B.data());
+  indices_block.copy_from_host(host_indices.data());
+
+  auto stride_C = cutlass::make_cute_packed_stride(typename GemmKernel::StrideC{}, {m, n, 1});
+  auto stride_D = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, {m, n, 1});
+
+  // The mixed mainloop derives the packed strides of A and B from the problem shape
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {m, n, k, 1},
+    {A_block.get(), B_block.get()},
+    {{1.0f, 0.0f}, nullptr, stride_C, D_block.get(), stride_D}
+  };
+  arguments.mainloop.ptr_gather_B_indices = indices_block.get();
+  arguments.mainloop.num_rows_B = num_rows_B;
+
+  Gemm gemm_op;
+  cutlass::Status status = gemm_op.can_implement(arguments);
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  if (status != cutlass::Status::kSuccess) {
+    return false;
+  }
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  status = gemm_op.initialize(arguments, workspace.get());
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  status = gemm_op.run();
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  cudaError_t result = cudaDeviceSynchronize();
+  EXPECT_EQ(result, cudaSuccess) << "Error at Kernel Sync.";
+  if (status != cutlass::Status::kSuccess || result != cudaSuccess) {
+    return false;
+  }
+
+  std::vector<ElementD> host_D(m * n);
+  D_block.copy_to_host(host_D.data());
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < n; ++j) {
+      if (float(host_D[i * n + j]) != ref_D[i * n + j]) {
+        std::cout << "D mismatch at (" << i << ", " << j << ") gathered from row " << host_indices[j] << ": "
+                  << float(host_D[i * n + j]) << " vs " << ref_D[i * n + j] << std::endl;
+        return false;
+      }
+    }
+  }
+
+  // The gathered mode requires a non-empty source matrix and L == 1
+  typename Gemm::Arguments no_rows = arguments;
+  no_rows.mainloop.num_rows_B = 0;
+  EXPECT_NE(gemm_op.can_implement(no_rows), cutlass::Status::kSuccess);
+
+  typename Gemm::Arguments batched = arguments;
+  batched.mode = cutlass::gemm::GemmUniversalMode::kBatched;
+  batched.problem_shape = {m, n, k, 2};
+  EXPECT_NE(gemm_op.can_implement(batched), cutlass::Status::kSuccess);
+
+  return true;
+}
+
+template <class TileShape_MNK, class ClusterShape_MNK, class KernelSchedule>
+static bool run_gather_b_test(int m, int n, int k, int num_rows_B) {
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm100, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      void, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::epilogue::collective::EpilogueScheduleAuto
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm100, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue>;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+  return testGatherB<Gemm>(m, n, k, num_rows_B);
+}
+
+} // namespace test::gemm::device
+
+TEST(SM100Only_Device_Gemm_f16t_f16n_f16t_tensor_op_f32_mixed_tma_cpasync_gather_b, 128x64x64_1x1x1_1sm) {
+  using TileShape = Shape<_128,_64,_64>;
+  using ClusterShape = Shape<_1,_1,_1>;
+  using KernelSchedule = cutlass::gemm::KernelMixedTmaCpAsyncWarpSpecialized1SmSm100;
+  EXPECT_TRUE((test::gemm::device::run_gather_b_test<TileShape, ClusterShape, KernelSchedule>(/*m=*/256, /*n=*/256, /*k=*/256, /*num_rows_B=*/300)));
+  // N and K are not tile multiples (zero-filled rows and k residue), and fewer source rows than N
+  EXPECT_TRUE((test::gemm::device::run_gather_b_test<TileShape, ClusterShape, KernelSchedule>(/*m=*/200, /*n=*/136, /*k=*/200, /*num_rows_B=*/61)));
+  // A single output tile
+  EXPECT_TRUE((test::gemm::device::run_gather_b_test<TileShape, ClusterShape, KernelSchedule>(/*m=*/128, /*n=*/24, /*k=*/40, /*num_rows_B=*/1000)));
+}
+
+TEST(SM100Only_Device_Gemm_f16t_f16n_f16t_tensor_op_f32_mixed_tma_cpasync_gather_b, 128x64x64_2x1x1_1sm) {
+  using TileShape = Shape<_128,_64,_64>;
+  using ClusterShape = Shape<_2,_1,_1>;
+  using KernelSchedule = cutlass::gemm::KernelMixedTmaCpAsyncWarpSpecialized1SmSm100;
+  EXPECT_TRUE((test::gemm::device::run_gather_b_test<TileShape, ClusterShape, KernelSchedule>(/*m=*/512, /*n=*/192, /*k=*/128, /*num_rows_B=*/1000)));
+  EXPECT_TRUE((test::gemm::device::run_gather_b_test<TileShape, ClusterShape, KernelSchedule>(/*m=*/264, /*n=*/100, /*k=*/72, /*num_rows_B=*/61)));
+}
+
+TEST(SM100Only_Device_Gemm_f16t_f16n_f16t_tensor_op_f32_mixed_tma_cpasync_gather_b, 256x128x64_2x1x1_2sm) {
+  using TileShape = Shape<_256,_128,_64>;
+  using ClusterShape = Shape<_2,_1,_1>;
+  using KernelSchedule = cutlass::gemm::KernelMixedTmaCpAsyncWarpSpecialized2SmSm100;
+  EXPECT_TRUE((test::gemm::device::run_gather_b_test<TileShape, ClusterShape, KernelSchedule>(/*m=*/512, /*n=*/384, /*k=*/256, /*num_rows_B=*/500)));
+  EXPECT_TRUE((test::gemm::device::run_gather_b_test<TileShape, ClusterShape, KernelSchedule>(/*m=*/256, /*n=*/200, /*k=*/136, /*num_rows_B=*/61)));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
@@ -0,0 +1,216 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for Sm100 f16_f16 GEMMs with the TMA reduce-add epilogue schedules, which accumulate
+    alpha * A @ B into D in place (D += alpha * A @ B)
+*/
+
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
+
+using namespace cute;
+
+namespace test::gemm::device {
+
+// Launches the GEMM twice into the same D, which must then hold D0 + 2 * alpha * A @ B. Each launch
+// rounds alpha * A @ B to ElementD and adds it to D, rounding the sum to ElementD.
+template <class Gemm>
+bool testSm100ReduceAdd(int m, int n, int k) {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+  using ElementD = typename Gemm::ElementD;
+
+  constexpr float alpha = 0.5f;
+  constexpr int launches = 2;
+
+  std::vector<ElementA> host_A(m * k);
+  std::vector<ElementB> host_B(n * k);
+  std::vector<ElementD> host_D(m * n);
+  for (int i = 0; i < m * k; ++i) {
+    host_A[i] = ElementA(float((i * 7) % 5 - 2));
+  }
+  for (int i = 0; i < n * k; ++i) {
+    host_B[i] = ElementB(float((i * 3) % 5 - 2));
+  }
+  for (int i = 0; i < m * n; ++i) {
+    host_D[i] = ElementD(float((i * 5) % 7 - 3));
+  }
+
+  // Host reference, A is row-major, B column-major and D row-major
+  std::vector<ElementD> ref_D(m * n);
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < n; ++j) {
+      float acc = 0.0f;
+      for (int kk = 0; kk < k; ++kk) {
+        acc += float(host_A[i * k + kk]) * float(host_B[j * k + kk]);
+      }
+      ElementD update = ElementD(alpha * acc);
+      ElementD ref = host_D[i * n + j];
+      for (int launch = 0; launch < launches; ++launch) {
+        ref = ElementD(float(ref) + float(update));
+      }
+      ref_D[i * n + j] = ref;
+    }
+  }
+
+  cutlass::DeviceAllocation<ElementA> A_block(host_A.size());
+  cutlass::DeviceAllocation<ElementB> B_block(host_B.size());
+  cutlass::DeviceAllocation<ElementD> D_block(host_D.size());
+  A_block.copy_from_host(host_A.data());
+  B_block.copy_from_host(host_B.data());
+  D_block.copy_from_host(host_D.data());
+
+  auto stride_A = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, {m, k, 1});
+  auto stride_B = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, {n, k, 1});
+  auto stride_C = cutlass::make_cute_packed_stride(typename GemmKernel::StrideC{}, {m, n, 1});
+  auto stride_D = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, {m, n, 1});
+
+  // C is void, the prior contents of D are accumulated into by the TMA reduction
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {m, n, k, 1},
+    {A_block.get(), stride_A, B_block.get(), stride_B},
+    {{alpha, 0.0f}, nullptr, stride_C, D_block.get(), stride_D}
+  };
+
+  Gemm gemm_op;
+  cutlass::Status status = gemm_op.can_implement(arguments);
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  if (status != cutlass::Status::kSuccess) {
+    return false;
+  }
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  status = gemm_op.initialize(arguments, workspace.get());
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  for (int launch = 0; launch < launches && status == cutlass::Status::kSuccess; ++launch) {
+    status = gemm_op.run();
+    EXPECT_EQ(status, cutlass::Status::kSuccess);
+  }
+  cudaError_t result = cudaDeviceSynchronize();
+  EXPECT_EQ(result, cudaSuccess) << "Error at Kernel Sync.";
+  if (status != cutlass::Status::kSuccess || result != cudaSuccess) {
+    return false;
+  }
+
+  D_block.copy_to_host(host_D.data());
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < n; ++j) {
+      if (float(host_D[i * n + j]) != float(ref_D[i * n + j])) {
+        std::cout << "D mismatch at (" << i << ", " << j << "): "
+                  << float(host_D[i * n + j]) << " vs " << float(ref_D[i * n + j]) << std::endl;
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+template <class ElementD, class TileShape_MNK, class ClusterShape_MNK, class KernelSchedule, class EpilogueSchedule>
+static bool run_sm100_reduce_add_test(int m, int n, int k) {
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm100, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      void, cutlass::layout::RowMajor, 128 / cutlass::sizeof_bits<ElementD>::value,
+      ElementD, cutlass::layout::RowMajor, 128 / cutlass::sizeof_bits<ElementD>::value,
+      EpilogueSchedule
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm100, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue>;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+  return testSm100ReduceAdd<Gemm>(m, n, k);
+}
+
+} // namespace test::gemm::device
+
+TEST(SM100Only_Device_Gemm_f16t_f16n_f32t_tensor_op_f32_reduce_add, 128x128x64_1x1x1_1sm) {
+  using namespace test::gemm::device;
+  EXPECT_TRUE((run_sm100_reduce_add_test<float, Shape<_128,_128,_64>, Shape<_1,_1,_1>,
+                 cutlass::gemm::KernelTmaWarpSpecialized1SmSm100,
+                 cutlass::epilogue::TmaWarpSpecialized1SmReduceAdd>(/*m=*/256, /*n=*/256, /*k=*/256)));
+  // Partial tiles in M and N are reduced into only within bounds
+  EXPECT_TRUE((run_sm100_reduce_add_test<float, Shape<_128,_128,_64>, Shape<_1,_1,_1>,
+                 cutlass::gemm::KernelTmaWarpSpecialized1SmSm100,
+                 cutlass::epilogue::TmaWarpSpecialized1SmReduceAdd>(/*m=*/200, /*n=*/136, /*k=*/64)));
+}
+
+TEST(SM100Only_Device_Gemm_f16t_f16n_f16t_tensor_op_f32_reduce_add, 128x128x64_1x2x1_1sm) {
+  using namespace test::gemm::device;
+  EXPECT_TRUE((run_sm100_reduce_add_test<cutlass::half_t, Shape<_128,_128,_64>, Shape<_1,_2,_1>,
+                 cutlass::gemm::KernelTmaWarpSpecialized1SmSm100,
+                 cutlass::epilogue::TmaWarpSpecialized1SmReduceAdd>(/*m=*/256, /*n=*/384, /*k=*/128)));
+}
+
+TEST(SM100Only_Device_Gemm_f16t_f16n_bf16t_tensor_op_f32_reduce_add, 256x128x64_2x1x1_2sm) {
+  using namespace test::gemm::device;
+  EXPECT_TRUE((run_sm100_reduce_add_test<cutlass::bfloat16_t, Shape<_256,_128,_64>, Shape<_2,_1,_1>,
+                 cutlass::gemm::KernelTmaWarpSpecialized2SmSm100,
+                 cutlass::epilogue::TmaWarpSpecialized2SmReduceAdd>(/*m=*/512, /*n=*/256, /*k=*/128)));
+  EXPECT_TRUE((run_sm100_reduce_add_test<cutlass::bfloat16_t, Shape<_256,_128,_64>, Shape<_2,_1,_1>,
+                 cutlass::gemm::KernelTmaWarpSpecialized2SmSm100,
+                 cutlass::epilogue::TmaWarpSpecialized2SmReduceAdd>(/*m=*/264, /*n=*/200, /*k=*/72)));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
@@ -79,7 +79,8 @@ bool groupwise_test(
     Int<ScaleGranularityM>, Int<ScaleGranularityN>, Int<ScaleGranularityK>, C<Is2SM>,
     LayoutA, LayoutB, LayoutCD,
     MmaTileShape, ClusterShape,
-    C<NoSmemEpilogue>) {
+    C<NoSmemEpilogue>,
+    cute::Shape<int,int,int> scale_granularity = cute::Shape<int,int,int>{0, 0, 0}) {
   using Epilogue1SM = conditional_t<NoSmemEpilogue, cutlass::epilogue::BlockwiseNoSmemWarpSpecialized1Sm, cutlass::epilogue::TmaWarpSpecialized1Sm>;
   using Epilogue2SM = conditional_t<NoSmemEpilogue, cutlass::epilogue::BlockwiseNoSmemWarpSpecialized2Sm, cutlass::epilogue::TmaWarpSpecialized2Sm>;
   using ScaleConfig = cutlass::detail::Sm100BlockwiseScaleConfig<ScaleGranularityM, ScaleGranularityN, ScaleGranularityK, SFAMajor, SFBMajor>;
@@ -153,8 +154,18 @@ bool groupwise_test(
   stride_C = cutlass::make_cute_packed_stride(StrideC{}, cute::make_shape(M, N, 1));
   stride_D = cutlass::make_cute_packed_stride(StrideD{}, cute::make_shape(M, N, 1));
 
-  layout_SFA = ScaleConfig::tile_atom_to_shape_SFA(make_shape(M, N, K, 1));
-  layout_SFB = ScaleConfig::tile_atom_to_shape_SFB(make_shape(M, N, K, 1));
+  // Scale factors at a run-time granularity coarser than the compile-time one of the kernel
+  bool is_runtime_granularity = get<0>(scale_granularity) > 0 || get<1>(scale_granularity) > 0 || get<2>(scale_granularity) > 0;
+  auto sf_vec_shape = cutlass::detail::resolve_blockwise_scale_granularity<
+      ScaleGranularityM, ScaleGranularityN, ScaleGranularityK>(scale_granularity);
+  if (is_runtime_granularity) {
+    layout_SFA = ScaleConfig::tile_atom_to_shape_SFA(make_shape(M, N, K, 1), sf_vec_shape);
+    layout_SFB = ScaleConfig::tile_atom_to_shape_SFB(make_shape(M, N, K, 1), sf_vec_shape);
+  }
+  else {
+    layout_SFA = ScaleConfig::tile_atom_to_shape_SFA(make_shape(M, N, K, 1));
+    layout_SFB = ScaleConfig::tile_atom_to_shape_SFB(make_shape(M, N, K, 1));
+  }
 
   thrust::universal_vector<cutlass::float_e4m3_t> tensor_A(M * K);
   thrust::universal_vector<float> tensor_SFA(cute::size(cute::filter_zeros(layout_SFA)));
@@ -189,7 +200,8 @@ bool groupwise_test(
     {thrust::raw_pointer_cast(tensor_A.data()), stride_A, 
      thrust::raw_pointer_cast(tensor_B.data()), stride_B,
      thrust::raw_pointer_cast(tensor_SFA.data()), layout_SFA,
-     thrust::raw_pointer_cast(tensor_SFB.data()), layout_SFB},
+     thrust::raw_pointer_cast(tensor_SFB.data()), layout_SFB,
+     {}, {}, scale_granularity},
     {
       {}, // epilogue.thread
       thrust::raw_pointer_cast(tensor_C.data()), stride_C,
@@ -219,8 +231,12 @@ bool groupwise_test(
       cute::make_layout(cute::make_shape(M, N, 1), stride_C));
   auto D = cute::make_tensor(thrust::raw_pointer_cast(tensor_ref_D.data()),
       cute::make_layout(cute::make_shape(M, N, 1), stride_D));
-  auto SFA = cute::make_tensor(thrust::raw_pointer_cast(tensor_SFA.data()), layout_SFA);
-  auto SFB = cute::make_tensor(thrust::raw_pointer_cast(tensor_SFB.data()), layout_SFB);
+  // The reference indexes the scale factors at their actual granularity
+  using ReferenceScaleConfig = cutlass::detail::RuntimeBlockwiseScaleConfig<SFAMajor, SFBMajor>;
+  auto SFA = cute::make_tensor(thrust::raw_pointer_cast(tensor_SFA.data()),
+      ReferenceScaleConfig::tile_atom_to_shape_SFA(make_shape(M, N, K, 1), sf_vec_shape));
+  auto SFB = cute::make_tensor(thrust::raw_pointer_cast(tensor_SFB.data()),
+      ReferenceScaleConfig::tile_atom_to_shape_SFB(make_shape(M, N, K, 1), sf_vec_shape));
 
   cutlass::reference::host::GettBlockScalingMainloopParams<
       float,
@@ -339,6 +355,35 @@ TEST(SM100_Device_Gemm_e4m3t_e4m3n_e4m3t_tensorop_2sm_f32_align16_blockwise, 256
 
 }
 
+TEST(SM100_Device_Gemm_e4m3t_e4m3n_e4m3t_tensorop_1sm_f32_align16_blockwise, 128x128x128_1x1x1_1x1x128_kernel_1x128x128_runtime_scale) {
+
+  bool passed = groupwise_test<UMMA::Major::MN, UMMA::Major::K>(
+      Int<1>{}, Int<1>{}, Int<128>{}, false_type{},
+      cutlass::layout::RowMajor{}, cutlass::layout::ColumnMajor{}, 
+      cutlass::layout::RowMajor{}, 
+      Shape<_128,_128,_128>{},
+      Shape<_1,_1,_1>{},
+      false_type{},
+      cute::Shape<int,int,int>{1, 128, 128});
+
+  EXPECT_TRUE(passed);
+
+}
+
+TEST(SM100_Device_Gemm_e4m3t_e4m3n_e4m3t_tensorop_2sm_f32_align16_blockwise, 256x128x128_2x1x1_1x1x128_kernel_per_tensor_runtime_scale) {
 
+  // Granularities beyond the problem extents give a single scale factor per operand
+  bool passed = groupwise_test<UMMA::Major::MN, UMMA::Major::MN>(
+      Int<1>{}, Int<1>{}, Int<128>{}, true_type{},
+      cutlass::layout::RowMajor{}, cutlass::layout::ColumnMajor{}, 
+      cutlass::layout::RowMajor{}, 
+      Shape<_256,_128,_128>{},
+      Shape<_2,_1,_1>{},
+      false_type{},
+      cute::Shape<int,int,int>{1 << 20, 1 << 20, 1 << 20});
+
+  EXPECT_TRUE(passed);
+
+}
 
 #endif // #if defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
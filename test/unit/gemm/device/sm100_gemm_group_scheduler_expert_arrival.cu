@@ -0,0 +1,321 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests that the expert arrival group scheduler only starts tiles once the rows of A they read
+    have been dispatched into the expert buffers.
+*/
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/gemm/group_array_problem_shape.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler.hpp"
+#include "cutlass/experimental/distributed/device/ep_dispatch_combine.hpp"
+#include "cutlass/util/device_memory.h"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
+
+using namespace cute;
+using ProblemShape = Shape<int,int,int>;
+using GroupProblemShape = cutlass::gemm::GroupProblemShape<ProblemShape>;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Kernel walking the linear work indices assigned to each block as the persistent GEMM does. Before
+/// a tile "loads", it waits on the scheduler and counts the elements of the rows of A it reads that
+/// do not hold their token yet. Token t holds the values t * hidden + col, and expert_tokens lists
+/// the token expected in each row of each expert buffer.
+template <class Scheduler>
+__global__
+void
+run_group_expert_arrival_scheduler(
+    int* tile_done,
+    int* violations,
+    int const* tile_offsets,
+    int const* tiles_n,
+    int32_t const* const* expert_ptrs,
+    int const* expert_tokens,
+    int const* expert_token_offsets,
+    int hidden,
+    ProblemShape const* problem_shapes,
+    int tile_m,
+    typename Scheduler::Params params) {
+
+  Scheduler scheduler{nullptr, params};
+  typename Scheduler::UnderlyingScheduler tile_mapper{params.params_sm90_, nullptr};
+
+  uint64_t grid_size = uint64_t(gridDim.x) * uint64_t(gridDim.y);
+  uint64_t linear_idx = uint64_t(blockIdx.x) * uint64_t(gridDim.y) + uint64_t(blockIdx.y);
+  auto work_tile_info = tile_mapper.get_current_work_for_linear_idx(linear_idx);
+
+  while (work_tile_info.is_valid()) {
+    int group = work_tile_info.L_idx;
+    int m = work_tile_info.M_idx;
+    int n = work_tile_info.N_idx;
+    int problem_m = get<0>(problem_shapes[group]);
+    int tiles_m = (problem_m + tile_m - 1) / tile_m;
+    bool is_output_tile = m < tiles_m && n < tiles_n[group];
+
+    scheduler.wait_for_input_tiles(work_tile_info);
+
+    if (is_output_tile) {
+      int missing = 0;
+      for (int row = m * tile_m; row < min(problem_m, (m + 1) * tile_m); ++row) {
+        int token = expert_tokens[expert_token_offsets[group] + row];
+        for (int col = threadIdx.x; col < hidden; col += blockDim.x) {
+          int32_t value = *reinterpret_cast<int32_t const volatile*>(expert_ptrs[group] + int64_t(row) * hidden + col);
+          missing += value != token * hidden + col;
+        }
+      }
+      if (missing != 0) {
+        atomicAdd(violations, missing);
+      }
+      if (threadIdx.x == 0) {
+        atomicExch(tile_done + tile_offsets[group] + m * tiles_n[group] + n, 1);
+      }
+    }
+
+    linear_idx += grid_size;
+    work_tile_info = tile_mapper.get_current_work_for_linear_idx(linear_idx);
+  }
+}
+
+/// Host-side wrapper routing num_tokens tokens to top_k distinct experts each, and dispatching them
+/// on a separate stream while the scheduler kernel runs. Returns false on failure.
+template <class TileShape>
+bool
+test_group_expert_arrival_scheduler(
+  int num_experts,
+  int num_tokens,
+  int top_k,
+  int hidden,
+  int gemm_n,
+  int arrival_tile_m,
+  TileShape tile_shape,
+  int sm_count) {
+
+  using ClusterShape = Shape<_1,_1,_1>;
+  using AtomThrShape = Shape<_1,_1,_1>;
+  using Scheduler = typename cutlass::gemm::kernel::detail::TileSchedulerSelector<
+    cutlass::gemm::ExpertArrivalGroupScheduler, cutlass::arch::Sm100, TileShape, ClusterShape, 8, GroupProblemShape>::Scheduler;
+
+  // Route each token to top_k distinct experts, filling the rows of each expert in routing order
+  std::mt19937 rng(2026);
+  std::vector<int32_t> host_expert_idx(size_t(num_tokens) * top_k);
+  std::vector<int32_t> host_expert_row(size_t(num_tokens) * top_k);
+  std::vector<std::vector<int>> row_tokens(num_experts);
+  std::vector<int> experts(num_experts);
+  for (int token = 0; token < num_tokens; ++token) {
+    for (int expert = 0; expert < num_experts; ++expert) {
+      experts[expert] = expert;
+    }
+    std::shuffle(experts.begin(), experts.end(), rng);
+    for (int k = 0; k < top_k; ++k) {
+      int expert = experts[k];
+      host_expert_idx[token * top_k + k] = expert;
+      host_expert_row[token * top_k + k] = static_cast<int32_t>(row_tokens[expert].size());
+      row_tokens[expert].push_back(token);
+    }
+  }
+
+  std::vector<ProblemShape> problem_shapes;
+  std::vector<int> host_tiles_n(num_experts);
+  std::vector<int> host_tile_offsets(num_experts + 1, 0);
+  std::vector<int> host_expert_tokens;
+  std::vector<int> host_expert_token_offsets(num_experts + 1, 0);
+  int max_arrival_tiles = 0;
+  for (int expert = 0; expert < num_experts; ++expert) {
+    int rows = static_cast<int>(row_tokens[expert].size());
+    problem_shapes.push_back({rows, gemm_n, hidden});
+    int tiles_m = static_cast<int>(cute::ceil_div(rows, size<0>(tile_shape)));
+    host_tiles_n[expert] = static_cast<int>(cute::ceil_div(gemm_n, size<1>(tile_shape)));
+    host_tile_offsets[expert + 1] = host_tile_offsets[expert] + tiles_m * host_tiles_n[expert];
+    host_expert_tokens.insert(host_expert_tokens.end(), row_tokens[expert].begin(), row_tokens[expert].end());
+    host_expert_token_offsets[expert + 1] = static_cast<int>(host_expert_tokens.size());
+    max_arrival_tiles = std::max(max_arrival_tiles, (rows + arrival_tile_m - 1) / arrival_tile_m);
+  }
+  int total_tiles = host_tile_offsets[num_experts];
+
+  // Tokens, expert buffers and arrival counters of a single device
+  std::vector<int32_t> host_tokens(size_t(num_tokens) * hidden);
+  for (size_t idx = 0; idx < host_tokens.size(); ++idx) {
+    host_tokens[idx] = static_cast<int32_t>(idx);
+  }
+  cutlass::DeviceAllocation<int32_t> tokens(host_tokens.size());
+  tokens.copy_from_host(host_tokens.data());
+
+  cutlass::DeviceAllocation<int32_t> expert_buffer(size_t(num_tokens) * top_k * hidden);
+  std::vector<int32_t*> host_expert_ptrs(num_experts);
+  for (int expert = 0; expert < num_experts; ++expert) {
+    host_expert_ptrs[expert] = expert_buffer.get() + size_t(host_expert_token_offsets[expert]) * hidden;
+  }
+  cutlass::DeviceAllocation<int32_t*> expert_ptrs(num_experts);
+  expert_ptrs.copy_from_host(host_expert_ptrs.data());
+
+  cutlass::DeviceAllocation<int32_t> arrival_counters(size_t(num_experts) * max_arrival_tiles);
+  int32_t* host_counter_ptr = arrival_counters.get();
+  cutlass::DeviceAllocation<int32_t*> counter_ptrs(1);
+  counter_ptrs.copy_from_host(&host_counter_ptr);
+
+  cutlass::DeviceAllocation<int32_t> expert_idx(host_expert_idx.size());
+  cutlass::DeviceAllocation<int32_t> expert_row(host_expert_row.size());
+  expert_idx.copy_from_host(host_expert_idx.data());
+  expert_row.copy_from_host(host_expert_row.data());
+
+  cutlass::DeviceAllocation<ProblemShape> device_problem_shapes(num_experts);
+  device_problem_shapes.copy_from_host(problem_shapes.data());
+  GroupProblemShape group_problem_shape{num_experts, device_problem_shapes.get(), problem_shapes.data()};
+  cutlass::KernelHardwareInfo hw_info{0, sm_count};
+
+  typename Scheduler::Arguments args;
+  args.ptr_arrival_counters = arrival_counters.get();
+  args.max_arrival_tiles = max_arrival_tiles;
+  args.arrival_tile_m = arrival_tile_m;
+
+  if (!Scheduler::can_implement(args, hw_info)) {
+    std::cout << "can_implement() failed" << std::endl;
+    return false;
+  }
+
+  auto params = Scheduler::to_underlying_arguments(group_problem_shape, tile_shape, AtomThrShape{}, ClusterShape{}, hw_info, args);
+  dim3 grid = Scheduler::get_grid_shape(params, group_problem_shape, tile_shape, AtomThrShape{}, ClusterShape{}, hw_info);
+
+  cutlass::DeviceAllocation<int> tile_done(total_tiles);
+  cutlass::DeviceAllocation<int> violations(1);
+  cutlass::DeviceAllocation<int> tile_offsets(num_experts + 1);
+  cutlass::DeviceAllocation<int> tiles_n(num_experts);
+  cutlass::DeviceAllocation<int> expert_tokens(host_expert_tokens.size());
+  cutlass::DeviceAllocation<int> expert_token_offsets(num_experts + 1);
+  tile_offsets.copy_from_host(host_tile_offsets.data());
+  tiles_n.copy_from_host(host_tiles_n.data());
+  expert_tokens.copy_from_host(host_expert_tokens.data());
+  expert_token_offsets.copy_from_host(host_expert_token_offsets.data());
+
+  cudaError_t err = cudaMemset((void*)tile_done.get(), 0, sizeof(int) * total_tiles);
+  if (err == cudaSuccess) {
+    err = cudaMemset((void*)violations.get(), 0, sizeof(int));
+  }
+  if (err == cudaSuccess) {
+    err = cudaMemset((void*)arrival_counters.get(), 0, sizeof(int32_t) * arrival_counters.size());
+  }
+  if (err == cudaSuccess) {
+    err = cudaMemset((void*)expert_buffer.get(), 0xff, sizeof(int32_t) * expert_buffer.size());
+  }
+  if (err == cudaSuccess) {
+    err = cudaDeviceSynchronize();
+  }
+  if (err != cudaSuccess) {
+    std::cout << __FILE__ << ":" << __LINE__ << " initialization failed with error: " << cudaGetErrorString(err) << std::endl;
+    return false;
+  }
+
+  // The scheduler kernel occupies at most sm_count SMs, and the dispatch runs alongside it
+  cudaStream_t gemm_stream, dispatch_stream;
+  cudaStreamCreateWithFlags(&gemm_stream, cudaStreamNonBlocking);
+  cudaStreamCreateWithFlags(&dispatch_stream, cudaStreamNonBlocking);
+
+  run_group_expert_arrival_scheduler<Scheduler><<<grid, 32, 0, gemm_stream>>>(
+    tile_done.get(), violations.get(), tile_offsets.get(), tiles_n.get(), expert_ptrs.get(),
+    expert_tokens.get(), expert_token_offsets.get(), hidden, device_problem_shapes.get(),
+    size<0>(tile_shape), params);
+
+  cutlass::distributed::kernel::ExpertRouting routing;
+  routing.expert_idx = expert_idx.get();
+  routing.expert_row = expert_row.get();
+  routing.num_tokens = num_tokens;
+  routing.top_k = top_k;
+  routing.num_local_experts = num_experts;
+
+  err = cutlass::distributed::device::launch_ep_dispatch(
+    static_cast<int32_t const*>(tokens.get()), hidden, hidden, routing, expert_ptrs.get(), hidden,
+    counter_ptrs.get(), max_arrival_tiles, arrival_tile_m, /*num_ctas=*/2, dispatch_stream);
+
+  if (err == cudaSuccess) {
+    err = cudaDeviceSynchronize();
+  }
+  cudaStreamDestroy(gemm_stream);
+  cudaStreamDestroy(dispatch_stream);
+  if (err != cudaSuccess) {
+    std::cout << __FILE__ << ":" << __LINE__
+              << " scheduler or dispatch kernel failed with error: "
+              << cudaGetErrorString(err) << std::endl;
+    return false;
+  }
+
+  // Every output tile must be computed, and none before the rows it reads arrived
+  std::vector<int> host_tile_done(total_tiles);
+  int host_violations = 0;
+  tile_done.copy_to_host(host_tile_done.data());
+  violations.copy_to_host(&host_violations);
+
+  for (int tile = 0; tile < total_tiles; ++tile) {
+    if (host_tile_done[tile] != 1) {
+      std::cout << "Tile " << tile << " was not computed" << std::endl;
+      return false;
+    }
+  }
+  if (host_violations != 0) {
+    std::cout << host_violations << " elements of A were read before they arrived" << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM100_Device_Gemm_group_scheduler_expert_arrival, counter_per_cta_tile) {
+  using TileShape = Shape<_128,_128,_64>;
+
+  EXPECT_TRUE(test_group_expert_arrival_scheduler(8, 1024, 2, 512, 512, 128, TileShape{}, /*sm_count=*/16));
+  EXPECT_TRUE(test_group_expert_arrival_scheduler(8, 1024, 2, 512, 512, 128, TileShape{}, /*sm_count=*/ 4));
+}
+
+TEST(SM100_Device_Gemm_group_scheduler_expert_arrival, counters_finer_than_cta_tile) {
+  using TileShape = Shape<_128,_256,_64>;
+
+  // Ragged experts, with several counters per M tile that do not all start on a tile boundary
+  EXPECT_TRUE(test_group_expert_arrival_scheduler(16, 700, 4, 256, 1024, 48, TileShape{}, /*sm_count=*/16));
+}
+
+TEST(SM100_Device_Gemm_group_scheduler_expert_arrival, counters_coarser_than_cta_tile) {
+  using TileShape = Shape<_64,_128,_64>;
+
+  EXPECT_TRUE(test_group_expert_arrival_scheduler(4, 333, 1, 384, 256, 256, TileShape{}, /*sm_count=*/8));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
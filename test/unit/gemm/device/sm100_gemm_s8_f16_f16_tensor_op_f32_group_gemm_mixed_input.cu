@@ -0,0 +1,329 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the Sm100 grouped GEMM with a narrow, scaled A operand (mixed input)
+*/
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/group_array_problem_shape.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/detail/sm100_mixed_dtype_blockwise_layout.hpp"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
+
+using namespace cute;
+
+namespace test::gemm::device {
+
+using GroupedMixedInputProblemShape = cutlass::gemm::GroupProblemShape<Shape<int,int,int>>;
+
+// Each group quantizes A along K with its own group size, which must cover whole k-tiles or all of K.
+// Groups of a static scale config all use ScaleConfig's granularity and ignore group_sizes.
+template <class Gemm, class ScaleConfig, bool RuntimeGroupSize>
+bool testGroupedMixedInput(
+    std::vector<typename GroupedMixedInputProblemShape::UnderlyingProblemShape> const& problem_sizes,
+    std::vector<int> const& group_sizes,
+    float alpha, float beta) {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using CollectiveMainloop = typename GemmKernel::CollectiveMainloop;
+  using ElementA = typename CollectiveMainloop::ElementA;
+  using ElementB = typename CollectiveMainloop::ElementB;
+  using ElementScale = typename CollectiveMainloop::ElementScale;
+  using ElementC = typename Gemm::ElementC;
+  using ElementD = typename Gemm::ElementD;
+  using InternalStrideA = typename GemmKernel::InternalStrideA;
+  using InternalStrideB = typename GemmKernel::InternalStrideB;
+  using InternalStrideC = typename GemmKernel::InternalStrideC;
+  using InternalStrideD = typename GemmKernel::InternalStrideD;
+  using InternalLayoutScale = typename CollectiveMainloop::InternalLayoutScale;
+
+  // Powers of two keep the dequantized A exact in the MMA type
+  float const scale_values[4] = {0.5f, 1.0f, 2.0f, 0.25f};
+
+  int const num_groups = static_cast<int>(problem_sizes.size());
+
+  std::vector<cutlass::DeviceAllocation<ElementA>> A_blocks(num_groups);
+  std::vector<cutlass::DeviceAllocation<ElementB>> B_blocks(num_groups);
+  std::vector<cutlass::DeviceAllocation<ElementScale>> S_blocks(num_groups);
+  std::vector<cutlass::DeviceAllocation<ElementC>> C_blocks(num_groups);
+  std::vector<cutlass::DeviceAllocation<ElementD>> D_blocks(num_groups);
+  std::vector<std::vector<float>> ref_D(num_groups);
+
+  std::vector<ElementA const*> ptr_A_host(num_groups);
+  std::vector<ElementB const*> ptr_B_host(num_groups);
+  std::vector<ElementScale const*> ptr_S_host(num_groups);
+  std::vector<ElementC const*> ptr_C_host(num_groups);
+  std::vector<ElementD*> ptr_D_host(num_groups);
+  std::vector<InternalStrideA> stride_A_host(num_groups);
+  std::vector<InternalStrideB> stride_B_host(num_groups);
+  std::vector<InternalStrideC> stride_C_host(num_groups);
+  std::vector<InternalStrideD> stride_D_host(num_groups);
+  std::vector<InternalLayoutScale> layout_S_host(num_groups);
+
+  for (int g = 0; g < num_groups; ++g) {
+    auto [m, n, k] = problem_sizes[g];
+    int const group_size = RuntimeGroupSize ? group_sizes[g] : int(size<1,0>(ScaleConfig::deduce_layout_scale()));
+    int const scale_k = (k + group_size - 1) / group_size;
+
+    // A is row-major (M,K), B column-major (N,K), C and D row-major (M,N), and the scales are M-major (M,K/group)
+    std::vector<ElementA> host_A(m * k);
+    std::vector<ElementB> host_B(n * k);
+    std::vector<ElementScale> host_S(m * scale_k);
+    std::vector<ElementC> host_C(m * n);
+    for (int i = 0; i < m; ++i) {
+      for (int kk = 0; kk < k; ++kk) {
+        host_A[i * k + kk] = ElementA((i * 7 + kk * 3 + g) % 9 - 4);
+      }
+      for (int s = 0; s < scale_k; ++s) {
+        host_S[s * m + i] = ElementScale(scale_values[(i + 3 * s + g) % 4]);
+      }
+      for (int j = 0; j < n; ++j) {
+        host_C[i * n + j] = ElementC(float((i + 2 * j + g) % 5 - 2));
+      }
+    }
+    for (int j = 0; j < n; ++j) {
+      for (int kk = 0; kk < k; ++kk) {
+        host_B[j * k + kk] = ElementB(float((j * 5 + kk * 11 + g) % 7 - 3));
+      }
+    }
+
+    // Host reference, A is dequantized with its group's scale before the regular GEMM
+    ref_D[g].resize(m * n);
+    for (int i = 0; i < m; ++i) {
+      for (int j = 0; j < n; ++j) {
+        float acc = 0.0f;
+        for (int kk = 0; kk < k; ++kk) {
+          float a = float(host_A[i * k + kk]) * float(host_S[(kk / group_size) * m + i]);
+          acc += a * float(host_B[j * k + kk]);
+        }
+        ref_D[g][i * n + j] = alpha * acc + beta * float(host_C[i * n + j]);
+      }
+    }
+
+    A_blocks[g].reset(host_A.size());
+    B_blocks[g].reset(host_B.size());
+    S_blocks[g].reset(host_S.size());
+    C_blocks[g].reset(host_C.size());
+    D_blocks[g].reset(m * n);
+    A_blocks[g].copy_from_host(host_A.data());
+    B_blocks[g].copy_from_host(host_B.data());
+    S_blocks[g].copy_from_host(host_S.data());
+    C_blocks[g].copy_from_host(host_C.data());
+
+    ptr_A_host[g] = A_blocks[g].get();
+    ptr_B_host[g] = B_blocks[g].get();
+    ptr_S_host[g] = S_blocks[g].get();
+    ptr_C_host[g] = C_blocks[g].get();
+    ptr_D_host[g] = D_blocks[g].get();
+    stride_A_host[g] = cutlass::make_cute_packed_stride(InternalStrideA{}, {m, k, 1});
+    stride_B_host[g] = cutlass::make_cute_packed_stride(InternalStrideB{}, {n, k, 1});
+    stride_C_host[g] = cutlass::make_cute_packed_stride(InternalStrideC{}, {m, n, 1});
+    stride_D_host[g] = cutlass::make_cute_packed_stride(InternalStrideD{}, {m, n, 1});
+    if constexpr (RuntimeGroupSize) {
+      layout_S_host[g] = ScaleConfig::tile_atom_to_shape_scale(make_shape(m, k, 1), group_size);
+    }
+    else {
+      layout_S_host[g] = ScaleConfig::tile_atom_to_shape_scale(make_shape(m, k, 1));
+    }
+  }
+
+  cutlass::DeviceAllocation<typename GroupedMixedInputProblemShape::UnderlyingProblemShape> problem_sizes_device(num_groups);
+  cutlass::DeviceAllocation<ElementA const*> ptr_A(num_groups);
+  cutlass::DeviceAllocation<ElementB const*> ptr_B(num_groups);
+  cutlass::DeviceAllocation<ElementScale const*> ptr_S(num_groups);
+  cutlass::DeviceAllocation<ElementC const*> ptr_C(num_groups);
+  cutlass::DeviceAllocation<ElementD*> ptr_D(num_groups);
+  cutlass::DeviceAllocation<InternalStrideA> stride_A(num_groups);
+  cutlass::DeviceAllocation<InternalStrideB> stride_B(num_groups);
+  cutlass::DeviceAllocation<InternalStrideC> stride_C(num_groups);
+  cutlass::DeviceAllocation<InternalStrideD> stride_D(num_groups);
+  cutlass::DeviceAllocation<InternalLayoutScale> layout_S(num_groups);
+  problem_sizes_device.copy_from_host(problem_sizes.data());
+  ptr_A.copy_from_host(ptr_A_host.data());
+  ptr_B.copy_from_host(ptr_B_host.data());
+  ptr_S.copy_from_host(ptr_S_host.data());
+  ptr_C.copy_from_host(ptr_C_host.data());
+  ptr_D.copy_from_host(ptr_D_host.data());
+  stride_A.copy_from_host(stride_A_host.data());
+  stride_B.copy_from_host(stride_B_host.data());
+  stride_C.copy_from_host(stride_C_host.data());
+  stride_D.copy_from_host(stride_D_host.data());
+  layout_S.copy_from_host(layout_S_host.data());
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = 0;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGrouped,
+    {num_groups, problem_sizes_device.get(), problem_sizes.data()},
+    {ptr_A.get(), stride_A.get(), ptr_B.get(), stride_B.get(), ptr_S.get(), layout_S.get()},
+    {{}, ptr_C.get(), stride_C.get(), ptr_D.get(), stride_D.get()},
+    hw_info
+  };
+  arguments.epilogue.thread.alpha = alpha;
+  arguments.epilogue.thread.beta = beta;
+
+  Gemm gemm_op;
+  cutlass::Status status = gemm_op.can_implement(arguments);
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  if (status != cutlass::Status::kSuccess) {
+    return false;
+  }
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  status = gemm_op.initialize(arguments, workspace.get());
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  status = gemm_op.run();
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  cudaError_t result = cudaDeviceSynchronize();
+  EXPECT_EQ(result, cudaSuccess) << "Error at Kernel Sync.";
+  if (status != cutlass::Status::kSuccess || result != cudaSuccess) {
+    return false;
+  }
+
+  for (int g = 0; g < num_groups; ++g) {
+    auto [m, n, k] = problem_sizes[g];
+    std::vector<ElementD> host_D(m * n);
+    D_blocks[g].copy_to_host(host_D.data());
+    for (int i = 0; i < m * n; ++i) {
+      float ref = ref_D[g][i];
+      if (std::abs(float(host_D[i]) - ref) > 1e-2f * std::abs(ref) + 1e-2f) {
+        std::cout << "D mismatch in group " << g << " at (" << i / n << ", " << i % n << "): "
+                  << float(host_D[i]) << " vs " << ref << std::endl;
+        return false;
+      }
+    }
+  }
+
+  // The scale mode requires the per-group scale pointers
+  typename Gemm::Arguments no_scales = arguments;
+  no_scales.mainloop.ptr_S = nullptr;
+  EXPECT_NE(gemm_op.can_implement(no_scales), cutlass::Status::kSuccess);
+
+  return true;
+}
+
+template <class TileShape_MNK, class ClusterShape_MNK, class KernelSchedule, class EpilogueSchedule,
+          class ScaleConfig, bool RuntimeGroupSize = false>
+static bool run_grouped_mixed_input_test(
+    std::vector<typename GroupedMixedInputProblemShape::UnderlyingProblemShape> const& problem_sizes,
+    std::vector<int> const& group_sizes = {},
+    float alpha = 1.0f, float beta = 0.5f) {
+  using LayoutScale = decltype(ScaleConfig::deduce_layout_scale());
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm100, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      cutlass::half_t, cutlass::layout::RowMajor *, 8,
+      cutlass::half_t, cutlass::layout::RowMajor *, 8,
+      EpilogueSchedule
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm100, cutlass::arch::OpClassTensorOp,
+      cute::tuple<int8_t, cutlass::half_t>, cute::tuple<cutlass::layout::RowMajor *, LayoutScale *>, 16,
+      cutlass::half_t, cutlass::layout::ColumnMajor *, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      GroupedMixedInputProblemShape,
+      CollectiveMainloop,
+      CollectiveEpilogue>;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+  return testGroupedMixedInput<Gemm, ScaleConfig, RuntimeGroupSize>(problem_sizes, group_sizes, alpha, beta);
+}
+
+static std::vector<Shape<int,int,int>> grouped_mixed_input_problem_sizes() {
+  return {
+    {256, 128, 256},
+    {136, 200, 384},
+    { 64,  72, 128},
+    {384, 256, 512}
+  };
+}
+
+} // namespace test::gemm::device
+
+TEST(SM100Only_Device_Gemm_s8t_f16n_f16t_tensor_op_1sm_f32_group_mixed_input, 128x128x128_1x1x1) {
+  using namespace test::gemm::device;
+  using ScaleConfig = cutlass::detail::Sm100MixedInputBlockwiseScaleConfig<1, 128>;
+  EXPECT_TRUE((run_grouped_mixed_input_test<
+      Shape<_128,_128,_128>, Shape<_1,_1,_1>,
+      cutlass::gemm::KernelPtrArrayTmaWarpSpecialized1SmMixedInputSm100,
+      cutlass::epilogue::PtrArrayTmaWarpSpecialized1Sm,
+      ScaleConfig>(grouped_mixed_input_problem_sizes())));
+}
+
+TEST(SM100Only_Device_Gemm_s8t_f16n_f16t_tensor_op_1sm_f32_group_mixed_input, 128x128x128_1x2x1_runtime_group_size) {
+  using namespace test::gemm::device;
+  using ScaleConfig = cutlass::detail::Sm100MixedInputRuntimeGroupScaleConfig<1>;
+  // Group sizes are whole k-tiles, except the second group which uses a single group over all of K
+  EXPECT_TRUE((run_grouped_mixed_input_test<
+      Shape<_128,_128,_128>, Shape<_1,_2,_1>,
+      cutlass::gemm::KernelPtrArrayTmaWarpSpecialized1SmMixedInputSm100,
+      cutlass::epilogue::PtrArrayTmaWarpSpecialized1Sm,
+      ScaleConfig, true>(grouped_mixed_input_problem_sizes(), {128, 384, 128, 256})));
+}
+
+TEST(SM100Only_Device_Gemm_s8t_f16n_f16t_tensor_op_2sm_f32_group_mixed_input, 256x128x128_2x1x1) {
+  using namespace test::gemm::device;
+  using ScaleConfig = cutlass::detail::Sm100MixedInputBlockwiseScaleConfig<1, 128>;
+  EXPECT_TRUE((run_grouped_mixed_input_test<
+      Shape<_256,_128,_128>, Shape<_2,_1,_1>,
+      cutlass::gemm::KernelPtrArrayTmaWarpSpecialized2SmMixedInputSm100,
+      cutlass::epilogue::PtrArrayTmaWarpSpecialized2Sm,
+      ScaleConfig>(grouped_mixed_input_problem_sizes(), {}, 2.0f, 1.0f)));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
@@ -170,4 +170,81 @@ TEST(SM103_Device_Gemm_e2m1t_e2m1n_f32t_tensorop_2sm_f32_vs16_streamk, 512x384x7
   auto pass = test::gemm::device::TestSmall<Gemm, false /*force_legacy_epilogue*/>(1.0, 0.0);
   EXPECT_TRUE(pass);
 }
+// Problem sizes spanning several 768-wide K tiles, so that split-K and stream-K units start and end
+// within the K extent and each unit loads the scale factor tiles of its own K range.
+TEST(SM103_Device_Gemm_e2m1t_e2m1n_f32t_tensorop_1sm_f32_streamk, 128x128x768_1x1x1) {
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+    cutlass::arch::Sm103, cutlass::arch::OpClassTensorOp,
+    cute::Shape<cute::_128, cute::_128, Int<768>>,
+    cute::Shape<cute::_1, cute::_1, cute::_1>,
+    cutlass::epilogue::collective::EpilogueTileAuto,
+    float, float,
+    void,  cutlass::layout::RowMajor, 4,
+    float, cutlass::layout::RowMajor, 4,
+    cutlass::epilogue::TmaWarpSpecialized1Sm
+  >::CollectiveOp;
+  
+  using CollectiveMainloop =  typename cutlass::gemm::collective::CollectiveBuilder<
+    cutlass::arch::Sm103, cutlass::arch::OpClassBlockScaledTensorOp,
+    cute::tuple<cutlass::float_e2m1_t,cutlass::float_ue8m0_t>, cutlass::layout::RowMajor, 32,
+    cute::tuple<cutlass::float_e2m1_t,cutlass::float_ue8m0_t>, cutlass::layout::ColumnMajor, 32,
+    float,
+    cute::Shape<cute::_128, cute::_128, Int<768>>,
+    cute::Shape<cute::_1, cute::_1, cute::_1>,
+    cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+    cutlass::gemm::KernelTmaWarpSpecialized1SmBlockScaledMxNvf4UltraVs32Sm103
+  >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      cute::Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue,
+      cutlass::gemm::StreamKScheduler
+    >;
+
+  using namespace test::gemm::device;
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+  auto pass = test::gemm::device::TestSmall<Gemm, false /*force_legacy_epilogue*/>(1.0, 0.0,
+      CheckEquality::RELATIVE, ScalarLoc::ON_DEVICE, VectorScale::ENABLED, {768 * 3 + 128, 768 * 8});
+  EXPECT_TRUE(pass);
+}
+
+TEST(SM103_Device_Gemm_e2m1t_e2m1n_f32t_tensorop_2sm_f32_vs16_streamk, 256x256x768_2x1x1_multi_k_tile) {
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+    cutlass::arch::Sm103, cutlass::arch::OpClassTensorOp,
+    cute::Shape<cute::_256, cute::_128, Int<768>>,
+    cute::Shape<cute::_2, cute::_1, cute::_1>,
+    cutlass::epilogue::collective::EpilogueTileAuto,
+    float, float,
+    void,  cutlass::layout::RowMajor, 4,
+    float, cutlass::layout::RowMajor, 4,
+    cutlass::epilogue::TmaWarpSpecialized2Sm
+  >::CollectiveOp;
+  
+  using CollectiveMainloop =  typename cutlass::gemm::collective::CollectiveBuilder<
+    cutlass::arch::Sm103, cutlass::arch::OpClassBlockScaledTensorOp,
+    cute::tuple<cutlass::float_e2m1_t,cutlass::float_ue8m0_t>, cutlass::layout::RowMajor, 32,
+    cute::tuple<cutlass::float_e2m1_t,cutlass::float_ue8m0_t>, cutlass::layout::ColumnMajor, 32,
+    float,
+    cute::Shape<cute::_256, cute::_128, Int<768>>,
+    cute::Shape<cute::_2, cute::_1, cute::_1>,
+    cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+    cutlass::gemm::KernelTmaWarpSpecialized2SmBlockScaledMxNvf4UltraVs16Sm103
+  >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      cute::Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue,
+      cutlass::gemm::StreamKScheduler
+    >;
+
+  using namespace test::gemm::device;
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+  auto pass = test::gemm::device::TestSmall<Gemm, false /*force_legacy_epilogue*/>(1.0, 0.0,
+      CheckEquality::RELATIVE, ScalarLoc::ON_DEVICE, VectorScale::ENABLED, {768 * 2 + 256, 768 * 5});
+  EXPECT_TRUE(pass);
+}
 #endif // defined(CUTLASS_ARCH_MMA_SM103_SUPPORTED)
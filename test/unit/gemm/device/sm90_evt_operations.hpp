@@ -308,6 +308,81 @@ public:
   using EVTModule = cute::conditional_t<cutlass::epilogue::fusion::detail::is_fp8_v<ElementAux>, EVTModuleAuxFp8, EVTModuleAuxNotFp8>;
 
 };
+
+// Z = scale_a * scale_b * alpha * acc + scale_c * beta * C
+// if D is fp8
+//   amax_d = max(abs(elements in activation(Z)))
+//   D = scale_d * activation(Z)
+// else
+//   D = activation(Z)
+// D is stored again in LayoutTransposed
+template <class Gemm, template <class> class ActivationFn, class ElementD, class LayoutTransposed>
+class HostScaledLinCombEltActAmaxDualLayout {
+public:
+  using ElementC = typename Gemm::GemmKernel::ElementC;
+  using LayoutC = cutlass::detail::StrideToLayoutTagC_t<typename Gemm::GemmKernel::StrideC>;
+  using LayoutD = cutlass::detail::StrideToLayoutTagC_t<typename Gemm::GemmKernel::StrideD>;
+
+  template <typename T>
+  using amax = cutlass::maximum_absolute_value_reduction<T, true>;
+  using EVTModule = HEVT<
+    HostAuxStore<ElementD, LayoutD, true>,
+    HEVT<
+      HostAuxStore<ElementD, LayoutTransposed, false>,
+      HEVT<
+        HostCompute<cutlass::epilogue::fusion::detail::ScaleOutOp<ElementD>::template Op>,
+        HEVT<
+          HostScalarReduce<amax, float>,
+          HEVT<
+            HostCompute<ActivationFn>,
+            HEVT<
+              HostCompute<cutlass::homogeneous_multiply_add>,
+              HostScalarBroadcast<1, 2, cute::Stride<cute::_0,cute::_0,int64_t>>, // scale_c * beta
+              HostAuxLoad<ElementC, LayoutC, true>, // C
+              HEVT<
+                HostCompute<cutlass::multiplies>,
+                HostScalarBroadcast<1, 3, cute::Stride<cute::_0,cute::_0,int64_t>>, // scale_a * scale_b * alpha
+                HostAccumulator<>
+              >
+            >
+          >
+        >,
+        HostScalarBroadcast<1> // scale_d
+      >
+    >
+  >;
+};
+
+// D = alpha * per-row scale * per-col scale * acc + beta * C
+template <class Gemm, class ElementD, class ElementScale = float>
+class HostLinCombPerRowScalePerColScale {
+public:
+  using ElementC = typename Gemm::GemmKernel::ElementC;
+  using LayoutC = cutlass::detail::StrideToLayoutTagC_t<typename Gemm::GemmKernel::StrideC>;
+  using LayoutD = cutlass::detail::StrideToLayoutTagC_t<typename Gemm::GemmKernel::StrideD>;
+
+  using EVTModule = HEVT<
+    HostAuxStore<ElementD, LayoutD, true>,
+    HEVT<
+      HostCompute<cutlass::homogeneous_multiply_add>,
+      HostScalarBroadcast<1, 1, cute::Stride<cute::_0,cute::_0,int64_t>>, // beta
+      HostAuxLoad<ElementC, LayoutC, true>, // C
+      HEVT<
+        HostCompute<cutlass::multiplies>,
+        HostScalarBroadcast<2, 1, cute::Stride<cute::_0,cute::_0,int64_t>>, // alpha
+        HEVT<
+          HostCompute<cutlass::multiplies>,
+          HostColBroadcast<ElementScale, cute::Stride<cute::_1,cute::_0,int64_t>>, // per-row scale
+          HEVT<
+            HostCompute<cutlass::multiplies>,
+            HostRowBroadcast<ElementScale, cute::Stride<cute::_0,cute::_1,int64_t>>, // per-col scale
+            HostAccumulator<>
+          >
+        >
+      >
+    >
+  >;
+};
 } // namespace test::gemm::device
 
 //////////////////////////////////////////////////////////////////////////////
@@ -527,10 +602,12 @@ template<
   class ElementOutput,
   class ElementCompute,
   class ElementScalar = ElementCompute,
-  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest,
+  class CtaTileShapeMNK = void // required if GmemReduceFn is not atomic
 >
 using Sm90LinCombScalarReduce =
-  Sm90EVT<Sm90ScalarReduction<RegReduceFn, GmemReduceFn, ElementReduce, ElementCompute, RoundStyle>, // per column reduce
+  Sm90EVT<Sm90ScalarReduction<RegReduceFn, GmemReduceFn, ElementReduce, ElementCompute, RoundStyle,
+                              Stride<_0,_0,_0>, true, CtaTileShapeMNK>, // scalar reduce
     Sm90EVT<Sm90Compute<homogeneous_multiply_add, ElementOutput, ElementCompute, RoundStyle>, // beta * C + alpha * acc
       Sm90ScalarBroadcast<ElementScalar>, // beta
       Sm90SrcFetch<ElementOutput>, // C
@@ -0,0 +1,263 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for device-wide GEMM with a block-sparse (BSR) A operand
+*/
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Runs D = alpha * A * B + beta * C with a random BSR A whose block rows have the given number of
+/// non-zero blocks, and compares against a host reference of the equivalent dense product.
+template <class Gemm>
+bool
+test_block_sparse_gemm(int m, int n, int k, std::vector<int> const& blocks_per_row, float alpha = 1.f, float beta = 0.5f) {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using TileShape = typename GemmKernel::TileShape;
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+  using ElementC = typename Gemm::ElementC;
+  using ElementD = typename Gemm::ElementD;
+  using StrideA = typename Gemm::GemmKernel::StrideA;
+  using StrideB = typename Gemm::GemmKernel::StrideB;
+  using StrideC = typename Gemm::GemmKernel::StrideC;
+  using StrideD = typename Gemm::GemmKernel::StrideD;
+
+  constexpr int BlockM = size<0>(TileShape{});
+  constexpr int BlockK = size<2>(TileShape{});
+  int block_rows = cute::ceil_div(m, BlockM);
+  int block_cols = cute::ceil_div(k, BlockK);
+
+  // Block row offsets and distinct, sorted block column indices of each block row
+  std::mt19937 rng(2026);
+  std::vector<int32_t> row_offsets(block_rows + 1, 0);
+  std::vector<int32_t> col_indices;
+  for (int row = 0; row < block_rows; ++row) {
+    int count = std::min(blocks_per_row[row % blocks_per_row.size()], block_cols);
+    std::vector<int> cols(block_cols);
+    std::iota(cols.begin(), cols.end(), 0);
+    std::shuffle(cols.begin(), cols.end(), rng);
+    cols.resize(count);
+    std::sort(cols.begin(), cols.end());
+    col_indices.insert(col_indices.end(), cols.begin(), cols.end());
+    row_offsets[row + 1] = row_offsets[row] + count;
+  }
+  int num_blocks = row_offsets[block_rows];
+
+  // Blocks are stored row-major within the block, one after the other
+  std::uniform_int_distribution<int> dist(-2, 2);
+  std::vector<ElementA> blocks(size_t(std::max(num_blocks, 1)) * BlockM * BlockK);
+  std::vector<ElementB> tensor_b(size_t(n) * k);
+  std::vector<ElementC> tensor_c(size_t(m) * n);
+  for (auto& x : blocks)   { x = ElementA(dist(rng)); }
+  for (auto& x : tensor_b) { x = ElementB(dist(rng)); }
+  for (auto& x : tensor_c) { x = ElementC(dist(rng)); }
+
+  // Host reference over the dense equivalent of A
+  std::vector<float> reference(size_t(m) * n);
+  for (int row = 0; row < block_rows; ++row) {
+    for (int i = row * BlockM; i < std::min(m, (row + 1) * BlockM); ++i) {
+      for (int j = 0; j < n; ++j) {
+        float acc = 0.f;
+        for (int p = row_offsets[row]; p < row_offsets[row + 1]; ++p) {
+          for (int kk = 0; kk < BlockK; ++kk) {
+            int kg = col_indices[p] * BlockK + kk;
+            if (kg < k) {
+              acc += float(blocks[(size_t(p) * BlockM + (i - row * BlockM)) * BlockK + kk]) * float(tensor_b[size_t(j) * k + kg]);
+            }
+          }
+        }
+        reference[size_t(i) * n + j] = alpha * acc + beta * float(tensor_c[size_t(i) * n + j]);
+      }
+    }
+  }
+
+  cutlass::DeviceAllocation<ElementA> device_blocks(blocks.size());
+  cutlass::DeviceAllocation<ElementB> device_b(tensor_b.size());
+  cutlass::DeviceAllocation<ElementC> device_c(tensor_c.size());
+  cutlass::DeviceAllocation<ElementD> device_d(tensor_c.size());
+  cutlass::DeviceAllocation<int32_t> device_row_offsets(row_offsets.size());
+  cutlass::DeviceAllocation<int32_t> device_col_indices(std::max<size_t>(col_indices.size(), 1));
+  device_blocks.copy_from_host(blocks.data());
+  device_b.copy_from_host(tensor_b.data());
+  device_c.copy_from_host(tensor_c.data());
+  device_row_offsets.copy_from_host(row_offsets.data());
+  if (!col_indices.empty()) {
+    device_col_indices.copy_from_host(col_indices.data());
+  }
+
+  StrideA stride_a = cutlass::make_cute_packed_stride(StrideA{}, cute::make_shape(BlockM, BlockK, std::max(num_blocks, 1)));
+  StrideB stride_b = cutlass::make_cute_packed_stride(StrideB{}, cute::make_shape(n, k, 1));
+  StrideC stride_c = cutlass::make_cute_packed_stride(StrideC{}, cute::make_shape(m, n, 1));
+  StrideD stride_d = cutlass::make_cute_packed_stride(StrideD{}, cute::make_shape(m, n, 1));
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(0);
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {m, n, k, 1},
+    {device_blocks.get(), stride_a, device_b.get(), stride_b, device_col_indices.get(), num_blocks},
+    {{alpha, beta}, device_c.get(), stride_c, device_d.get(), stride_d},
+    hw_info
+  };
+  arguments.scheduler.block_row_offsets = device_row_offsets.get();
+
+  Gemm gemm;
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cout << "can_implement() failed" << std::endl;
+    return false;
+  }
+
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  cutlass::Status status = gemm.initialize(arguments, workspace.get());
+  if (status == cutlass::Status::kSuccess) {
+    status = gemm.run();
+  }
+  if (status != cutlass::Status::kSuccess) {
+    std::cout << "GEMM failed with status " << cutlassGetStatusString(status) << std::endl;
+    return false;
+  }
+
+  cudaError_t err = cudaDeviceSynchronize();
+  if (err != cudaSuccess) {
+    std::cout << __FILE__ << ":" << __LINE__ << " kernel failed with error: " << cudaGetErrorString(err) << std::endl;
+    return false;
+  }
+
+  // Inputs are small integers, so the products are exact in the f32 accumulator
+  std::vector<ElementD> tensor_d(tensor_c.size());
+  device_d.copy_to_host(tensor_d.data());
+  for (size_t i = 0; i < tensor_d.size(); ++i) {
+    if (float(tensor_d[i]) != float(ElementD(reference[i]))) {
+      std::cout << "Error at (" << i / n << "," << i % n << "): got " << float(tensor_d[i])
+                << ", expected " << reference[i] << std::endl;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class TileShape, class ClusterShape, class KernelSchedule, class EpilogueSchedule>
+struct BlockSparseGemm {
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape, ClusterShape,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      EpilogueSchedule
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape, ClusterShape,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue,
+      cutlass::gemm::BlockSparseScheduler
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_block_sparse, 128x128x64_1x1x1_cooperative) {
+  using Gemm = typename BlockSparseGemm<
+    Shape<_128,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperativeBlockSparse,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>::Gemm;
+
+  // Includes empty and fully dense block rows, and ragged M and K
+  EXPECT_TRUE(test_block_sparse_gemm<Gemm>(1024, 512, 1024, {3, 0, 16, 1}));
+  EXPECT_TRUE(test_block_sparse_gemm<Gemm>(1000, 264, 1000, {2, 5, 0}));
+  EXPECT_TRUE(test_block_sparse_gemm<Gemm>(256, 256, 512, {0}));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_block_sparse, 128x128x64_1x2x1_cooperative) {
+  using Gemm = typename BlockSparseGemm<
+    Shape<_128,_128,_64>, Shape<_1,_2,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperativeBlockSparse,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>::Gemm;
+
+  EXPECT_TRUE(test_block_sparse_gemm<Gemm>(1024, 1024, 2048, {4, 1, 0, 32, 8}));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_block_sparse, 64x128x64_1x1x1_pingpong) {
+  using Gemm = typename BlockSparseGemm<
+    Shape<_64,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedPingpongBlockSparse,
+    cutlass::epilogue::TmaWarpSpecialized>::Gemm;
+
+  EXPECT_TRUE(test_block_sparse_gemm<Gemm>(1024, 512, 1024, {3, 0, 16, 1}));
+  EXPECT_TRUE(test_block_sparse_gemm<Gemm>(520, 136, 768, {12, 0, 2}));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
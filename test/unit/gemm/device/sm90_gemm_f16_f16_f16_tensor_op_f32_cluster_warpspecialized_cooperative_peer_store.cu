@@ -0,0 +1,284 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for Sm90 f16_f16_f16 with cooperative EVT epilogue
+    D = alpha * acc, reduced into a peer buffer with per-tile completion flags
+*/
+
+#include <iostream>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/util/reference/device/tensor_compare.h"
+#include "cutlass/util/reference/device/tensor_fill.h"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x_evt.hpp"
+#include "sm90_evt_operations.hpp"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+namespace test::gemm::device {
+
+// Runs the peer store GEMM twice with a single rank, reducing into a zeroed local buffer,
+// and checks the buffer holds twice the base GEMM's D and every tile was signaled twice
+template <class Gemm, class GemmWithPeerStore>
+bool testEVTPeerStoreWithoutD() {
+  using ProblemShapeType = typename Gemm::GemmKernel::ProblemShape;
+  using GemmKernel = typename Gemm::GemmKernel;
+  using TileShape = typename GemmKernel::TileShape;
+
+  int max_alignment = std::max(Gemm::kAlignmentA, Gemm::kAlignmentB);
+  std::vector<int> problem_size_m = {max_alignment, 512 - 3 * max_alignment};
+  std::vector<int> problem_size_n = {max_alignment, 512 - 2 * max_alignment};
+  std::vector<int> problem_size_k = {max_alignment, 512};
+
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+  using ElementD = typename Gemm::ElementD;
+  cutlass::DeviceAllocation<ElementA> A_block;
+  cutlass::DeviceAllocation<ElementB> B_block;
+  cutlass::DeviceAllocation<ElementD> ref_D_block;
+  cutlass::DeviceAllocation<ElementD> peer_D_block;
+  cutlass::DeviceAllocation<uint32_t> tile_flags;
+  cutlass::DeviceAllocation<uint8_t> workspace;
+
+  constexpr int NumRuns = 2;
+
+  for (int m : problem_size_m) {
+  for (int n : problem_size_n) {
+    for (int k : problem_size_k) {
+    int l = 1;
+    ProblemShapeType problem_size{m, n, k, l};
+
+    int tiles = cute::ceil_div(m, size<0>(TileShape{})) * cute::ceil_div(n, size<1>(TileShape{})) * l;
+
+    A_block.reset(m * k);
+    B_block.reset(k * n);
+    ref_D_block.reset(m * n);
+    peer_D_block.reset(m * n);
+    tile_flags.reset(tiles);
+
+    // Small integers keep the reduction exact in F16
+    cutlass::reference::device::BlockFillRandomUniform(A_block.get(), A_block.size(), 2023, ElementA(2), ElementA(-2), 0);
+    cutlass::reference::device::BlockFillRandomUniform(B_block.get(), B_block.size(), 2024, ElementB(2), ElementB(-2), 0);
+    cudaMemset(peer_D_block.get(), 0, peer_D_block.bytes());
+    cudaMemset(tile_flags.get(), 0, tile_flags.bytes());
+
+    auto stride_A = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, {m, k, 1});
+    auto stride_B = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, {n, k, 1});
+    auto stride_C = cutlass::make_cute_packed_stride(typename GemmKernel::StrideC{}, {m, n, 1});
+    auto stride_D = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, {m, n, 1});
+
+    constexpr float alpha = 1.0;
+
+    // Reference: D = NumRuns * alpha * acc
+    Gemm gemm_op_base;
+    auto arguments_base = typename Gemm::Arguments {
+      cutlass::gemm::GemmUniversalMode::kGemm,
+      problem_size,
+      {
+        A_block.get(), stride_A,
+        B_block.get(), stride_B
+      },
+      {   // Epilogue arguments
+        {}, // thread
+        nullptr, stride_C,
+        ref_D_block.get(), stride_D,
+      },  // Epilogue arguments end
+      /*hw_info=*/{},
+      /*scheduler_args=*/{}
+    };
+    arguments_base.epilogue.thread = {
+      // binary op : alpha * acc
+      {{alpha * NumRuns}},  // leaf op+args : alpha
+      {},                   // leaf op+args : acc
+      {}                    // binary args : multiplies
+    };
+
+    GemmWithPeerStore gemm_op;
+    auto arguments = typename GemmWithPeerStore::Arguments{
+      cutlass::gemm::GemmUniversalMode::kGemm,
+      problem_size,
+      {
+        A_block.get(), stride_A,
+        B_block.get(), stride_B
+      },
+      {   // Epilogue arguments
+        {}, // thread
+        nullptr, stride_C,
+        nullptr, stride_D,
+      },  // Epilogue arguments end
+      /*hw_info=*/{},
+      /*scheduler_args=*/{}
+    };
+    arguments.epilogue.thread = {
+      // unary op: peer store D
+      {
+        // binary op : alpha * acc
+        {{alpha}},  // leaf op+args : alpha
+        {},         // leaf op+args : acc
+        {}          // binary args : multiplies
+      },
+      {peer_D_block.get(), stride_D, tile_flags.get()}
+    };
+
+    cutlass::Status status;
+    cudaError_t result;
+
+    status = gemm_op_base.can_implement(arguments_base);
+    EXPECT_EQ(status, cutlass::Status::kSuccess) << "Error gemm base not supported";
+    workspace.reset(Gemm::get_workspace_size(arguments_base));
+    status = gemm_op_base.initialize(arguments_base, workspace.get());
+    status = gemm_op_base.run();
+    result = cudaDeviceSynchronize();
+    EXPECT_EQ(result, cudaSuccess) << "Error at Base Kernel Sync.";
+
+    status = gemm_op.can_implement(arguments);
+    EXPECT_EQ(status, cutlass::Status::kSuccess);
+    workspace.reset(GemmWithPeerStore::get_workspace_size(arguments));
+    for (int run = 0; run < NumRuns; ++run) {
+      status = gemm_op.initialize(arguments, workspace.get());
+      status = gemm_op.run();
+    }
+    result = cudaDeviceSynchronize();
+    EXPECT_EQ(result, cudaSuccess) << "Error at Kernel Sync.";
+
+    bool passed = cutlass::reference::device::BlockCompareEqual(peer_D_block.get(), ref_D_block.get(), m * n);
+    if (!passed) {
+      return false;
+    }
+
+    std::vector<uint32_t> host_flags(tiles);
+    tile_flags.copy_to_host(host_flags.data());
+    for (uint32_t flag : host_flags) {
+      if (flag != NumRuns) {
+        return false;
+      }
+    }
+    }
+  }
+  }
+  return true;
+}
+
+template <class ElementCompute, class ElementAccumulator>
+static constexpr auto select_evt_d() {
+  using namespace cutlass::epilogue::fusion;
+  constexpr auto RoundStyle = cutlass::FloatRoundStyle::round_to_nearest;
+  using BinaryCompute0 = Sm90EVT<Sm90Compute<
+                                   cutlass::multiplies,
+                                   ElementCompute,
+                                   ElementCompute,
+                                   RoundStyle>,                          // alpha * acc
+                            Sm90ScalarBroadcast<ElementAccumulator>,  // alpha
+                            Sm90AccFetch                              // acc
+                         >;
+  return BinaryCompute0{};
+}
+
+} // namespace test::gemm::device
+
+template <cutlass::epilogue::fusion::PeerStoreOp Op, class LayoutC>
+static bool run_peer_store_test() {
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::ColumnMajor;
+  using TileShape_MNK = Shape<_256,_128,_64>;
+  using ClusterShape_MNK = Shape<_2,_2,_1>;
+
+  using EpilogueSchedule = cutlass::epilogue::TmaWarpSpecializedCooperative;
+  using EpilogueTileType = cutlass::epilogue::collective::EpilogueTileAuto;
+
+  using namespace cutlass::epilogue::fusion;
+
+  constexpr auto RoundStyle = cutlass::FloatRoundStyle::round_to_nearest;
+
+  using EVT_D = decltype(test::gemm::device::select_evt_d<cutlass::half_t, float>());
+  using StrideD = cutlass::detail::TagToStrideC_t<LayoutC>;
+  using PeerStore = Sm90AuxPeerStore<cutlass::half_t, RoundStyle, StrideD, 8, Op>;
+
+  constexpr auto select_kernel = [](auto has_d) {
+    using FusionCallbacks =
+        cute::conditional_t<decltype(has_d){}, EVT_D, Sm90EVT<PeerStore, EVT_D>>;
+    using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+        cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+        TileShape_MNK, ClusterShape_MNK,
+        EpilogueTileType,
+        float, float,
+        void, LayoutC, 8,
+        cute::conditional_t<decltype(has_d){}, cutlass::half_t, void>, LayoutC, 8,
+        EpilogueSchedule,
+        FusionCallbacks
+      >::CollectiveOp;
+    using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+        cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+        cutlass::half_t, LayoutA, 8,
+        cutlass::half_t, LayoutB, 8,
+        float,
+        TileShape_MNK, ClusterShape_MNK,
+        cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+        cutlass::gemm::KernelTmaWarpSpecializedCooperative
+      >::CollectiveOp;
+
+    using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+        Shape<int,int,int,int>,
+        CollectiveMainloop,
+        CollectiveEpilogue>;
+
+    return GemmKernel{};
+  };
+
+  using GemmKernel = decltype(select_kernel(cute::C<true>{}));
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+  using GemmKernelWithPeerStore = decltype(select_kernel(cute::C<false>{}));
+  using GemmWithPeerStore = cutlass::gemm::device::GemmUniversalAdapter<GemmKernelWithPeerStore>;
+
+  return test::gemm::device::testEVTPeerStoreWithoutD<Gemm, GemmWithPeerStore>();
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_cooperative_epilogue, 256x128x64_2x2x1_VoidC_VoidD_PeerReduceF16_RowMajor) {
+  bool passed = run_peer_store_test<cutlass::epilogue::fusion::PeerStoreOp::PeerReduce, cutlass::layout::RowMajor>();
+  EXPECT_TRUE(passed);
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
@@ -0,0 +1,280 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the Sm90 fused cross-entropy loss and cross-entropy gradient epilogues
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+namespace test::gemm::device {
+
+template <class FusionOperation, class ElementD>
+struct CrossEntropyGemm {
+  using TileShape_MNK = Shape<_128,_128,_64>;
+  using ClusterShape_MNK = Shape<_1,_1,_1>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      ElementD, cutlass::layout::RowMajor, 8,
+      cutlass::epilogue::TmaWarpSpecializedCooperative,
+      FusionOperation
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::gemm::KernelTmaWarpSpecializedCooperative
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue>;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+template <class Gemm>
+static bool run_cross_entropy_gemm(typename Gemm::Arguments const& arguments) {
+  Gemm gemm_op;
+  cutlass::Status status = gemm_op.can_implement(arguments);
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  if (status != cutlass::Status::kSuccess) {
+    return false;
+  }
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  status = gemm_op.initialize(arguments, workspace.get());
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  status = gemm_op.run();
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  cudaError_t result = cudaDeviceSynchronize();
+  EXPECT_EQ(result, cudaSuccess) << "Error at Kernel Sync.";
+  return status == cutlass::Status::kSuccess && result == cudaSuccess;
+}
+
+// Forward: Z = alpha * A @ B + beta * C (m, n) is reduced to the per-row logsumexp and loss without writing Z.
+// Backward: a second GEMM on the same operands writes dloss * (softmax(Z) - onehot(target)) using that logsumexp.
+// Every 7th row is ignored, and targets are spread over all N tiles including the last, partial one.
+static bool testCrossEntropy(int m, int n, int k, bool per_row_dloss) {
+  using LossGemm = typename CrossEntropyGemm<
+      cutlass::epilogue::fusion::LinCombCrossEntropy<cutlass::half_t, float, float>, void>::Gemm;
+  using GradGemm = typename CrossEntropyGemm<
+      cutlass::epilogue::fusion::LinCombCrossEntropyGrad<cutlass::half_t, float>, cutlass::half_t>::Gemm;
+  using half_t = cutlass::half_t;
+
+  constexpr float alpha = 0.0625f;
+  constexpr float beta = 0.5f;
+  constexpr int32_t ignore_index = -100;
+
+  std::vector<half_t> host_A(m * k);
+  std::vector<half_t> host_B(n * k);
+  std::vector<half_t> host_C(m * n);
+  std::vector<int32_t> host_target(m);
+  std::vector<float> host_dloss(m);
+  for (int i = 0; i < m * k; ++i) {
+    host_A[i] = half_t(float((i * 7) % 5 - 2));
+  }
+  for (int i = 0; i < n * k; ++i) {
+    host_B[i] = half_t(float((i * 3) % 5 - 2));
+  }
+  for (int i = 0; i < m * n; ++i) {
+    host_C[i] = half_t(float((i * 5) % 9 - 4));
+  }
+  for (int i = 0; i < m; ++i) {
+    host_target[i] = (i % 7 == 6) ? ignore_index : (i * 37 + 5) % n;
+    host_dloss[i] = per_row_dloss ? float(i % 3 + 1) * 0.25f : 1.0f;
+  }
+  host_target[0] = n - 1;
+
+  // Host reference, A is row-major and B column-major
+  std::vector<float> ref_Z(m * n);
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < n; ++j) {
+      float acc = 0.0f;
+      for (int kk = 0; kk < k; ++kk) {
+        acc += float(host_A[i * k + kk]) * float(host_B[j * k + kk]);
+      }
+      ref_Z[i * n + j] = alpha * acc + beta * float(host_C[i * n + j]);
+    }
+  }
+  std::vector<float> ref_lse(m);
+  std::vector<float> ref_loss(m);
+  std::vector<float> ref_grad(m * n);
+  for (int i = 0; i < m; ++i) {
+    float row_max = *std::max_element(ref_Z.begin() + i * n, ref_Z.begin() + (i + 1) * n);
+    float row_sum = 0.0f;
+    for (int j = 0; j < n; ++j) {
+      row_sum += std::exp(ref_Z[i * n + j] - row_max);
+    }
+    ref_lse[i] = row_max + std::log(row_sum);
+    bool ignored = host_target[i] == ignore_index;
+    ref_loss[i] = ignored ? 0.0f : ref_lse[i] - ref_Z[i * n + host_target[i]];
+    for (int j = 0; j < n; ++j) {
+      float prob = std::exp(ref_Z[i * n + j] - ref_lse[i]);
+      ref_grad[i * n + j] = ignored ? 0.0f : host_dloss[i] * (prob - (j == host_target[i] ? 1.0f : 0.0f));
+    }
+  }
+
+  cutlass::DeviceAllocation<half_t> A_block(host_A.size());
+  cutlass::DeviceAllocation<half_t> B_block(host_B.size());
+  cutlass::DeviceAllocation<half_t> C_block(host_C.size());
+  cutlass::DeviceAllocation<int32_t> target_block(m);
+  cutlass::DeviceAllocation<float> dloss_block(m);
+  cutlass::DeviceAllocation<float> lse_block(m);
+  cutlass::DeviceAllocation<float> loss_block(m);
+  cutlass::DeviceAllocation<half_t> grad_block(m * n);
+  A_block.copy_from_host(host_A.data());
+  B_block.copy_from_host(host_B.data());
+  C_block.copy_from_host(host_C.data());
+  target_block.copy_from_host(host_target.data());
+  dloss_block.copy_from_host(host_dloss.data());
+
+  auto stride_A = cutlass::make_cute_packed_stride(typename LossGemm::GemmKernel::StrideA{}, {m, k, 1});
+  auto stride_B = cutlass::make_cute_packed_stride(typename LossGemm::GemmKernel::StrideB{}, {n, k, 1});
+  auto stride_C = cutlass::make_cute_packed_stride(typename LossGemm::GemmKernel::StrideC{}, {m, n, 1});
+  auto stride_D = cutlass::make_cute_packed_stride(typename GradGemm::GemmKernel::StrideD{}, {m, n, 1});
+
+  typename LossGemm::Arguments loss_args{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {m, n, k, 1},
+    {A_block.get(), stride_A, B_block.get(), stride_B},
+    {{}, C_block.get(), stride_C, nullptr, stride_C}
+  };
+  auto& loss_fusion_args = loss_args.epilogue.thread;
+  loss_fusion_args.alpha = alpha;
+  loss_fusion_args.beta = beta;
+  loss_fusion_args.target_ptr = target_block.get();
+  loss_fusion_args.loss_ptr = loss_block.get();
+  loss_fusion_args.lse_ptr = lse_block.get();
+  loss_fusion_args.ignore_index = ignore_index;
+  loss_fusion_args.dStatistic = {_1{}, _0{}, m};
+  if (!run_cross_entropy_gemm<LossGemm>(loss_args)) {
+    return false;
+  }
+
+  // The targets are required
+  typename LossGemm::Arguments no_target = loss_args;
+  no_target.epilogue.thread.target_ptr = nullptr;
+  EXPECT_NE(LossGemm{}.can_implement(no_target), cutlass::Status::kSuccess);
+
+  std::vector<float> host_lse(m);
+  std::vector<float> host_loss(m);
+  lse_block.copy_to_host(host_lse.data());
+  loss_block.copy_to_host(host_loss.data());
+  for (int i = 0; i < m; ++i) {
+    if (std::abs(host_lse[i] - ref_lse[i]) > 1e-3f * std::abs(ref_lse[i]) + 1e-3f) {
+      std::cout << "lse mismatch at row " << i << ": " << host_lse[i] << " vs " << ref_lse[i] << std::endl;
+      return false;
+    }
+    if (std::abs(host_loss[i] - ref_loss[i]) > 1e-3f * std::abs(ref_loss[i]) + 1e-3f) {
+      std::cout << "loss mismatch at row " << i << " with target " << host_target[i] << ": "
+                << host_loss[i] << " vs " << ref_loss[i] << std::endl;
+      return false;
+    }
+  }
+
+  typename GradGemm::Arguments grad_args{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {m, n, k, 1},
+    {A_block.get(), stride_A, B_block.get(), stride_B},
+    {{}, C_block.get(), stride_C, grad_block.get(), stride_D}
+  };
+  auto& grad_fusion_args = grad_args.epilogue.thread;
+  grad_fusion_args.alpha = alpha;
+  grad_fusion_args.beta = beta;
+  grad_fusion_args.target_ptr = target_block.get();
+  grad_fusion_args.lse_ptr = lse_block.get();
+  grad_fusion_args.dloss_ptr = per_row_dloss ? dloss_block.get() : nullptr;
+  grad_fusion_args.dloss = 1.0f;
+  grad_fusion_args.ignore_index = ignore_index;
+  grad_fusion_args.dStatistic = {_1{}, _0{}, m};
+  if (!run_cross_entropy_gemm<GradGemm>(grad_args)) {
+    return false;
+  }
+
+  std::vector<half_t> host_grad(m * n);
+  grad_block.copy_to_host(host_grad.data());
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < n; ++j) {
+      float ref = ref_grad[i * n + j];
+      float got = float(host_grad[i * n + j]);
+      if (std::abs(got - ref) > 1e-2f * std::abs(ref) + 1e-3f) {
+        std::cout << "grad mismatch at (" << i << ", " << j << ") with target " << host_target[i] << ": "
+                  << got << " vs " << ref << std::endl;
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+} // namespace test::gemm::device
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_CrossEntropy) {
+  EXPECT_TRUE(test::gemm::device::testCrossEntropy(/*m=*/256, /*n=*/512, /*k=*/128, /*per_row_dloss=*/false));
+  // N is not a multiple of the tile, so the last tile of each row holds out-of-bounds columns
+  EXPECT_TRUE(test::gemm::device::testCrossEntropy(/*m=*/200, /*n=*/328, /*k=*/64, /*per_row_dloss=*/true));
+  // A single, partial tile along N
+  EXPECT_TRUE(test::gemm::device::testCrossEntropy(/*m=*/77, /*n=*/40, /*k=*/64, /*per_row_dloss=*/true));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
@@ -117,6 +117,9 @@ using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
   EXPECT_TRUE(result);
   result = TestAll<Gemm>(1.0, 0.0);
   EXPECT_TRUE(result);
+  // Tensormaps of all groups prebuilt in the workspace
+  result = TestAll<Gemm>(1.0, 1.0, CheckEquality::RELATIVE, true);
+  EXPECT_TRUE(result);
 }
 
 TEST(SM90_Device_Gemm_f16t_f16t_f32n_tensor_op_gmma_f32_group_gemm, 128x128x64_2x2x1_ReLu) {
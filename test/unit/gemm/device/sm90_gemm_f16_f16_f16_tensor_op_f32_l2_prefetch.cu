@@ -0,0 +1,221 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for Sm90 f16_f16_f16 warp-specialized GEMMs that prefetch a buffer into L2 after the mainloop
+*/
+
+#include <iostream>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+#include "cutlass/util/reference/device/gemm.h"
+#include "cutlass/util/reference/device/tensor_compare.h"
+#include "cutlass/util/reference/device/tensor_fill.h"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+namespace test::gemm::device {
+
+// Runs the GEMM with and without an L2 prefetch buffer and checks both against a reference.
+// The prefetch buffer is not a multiple of the prefetch chunk size, so the last chunk is partial.
+template <class Gemm>
+bool testL2Prefetch() {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using ProblemShapeType = typename GemmKernel::ProblemShape;
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+  using ElementD = typename Gemm::ElementD;
+  using LayoutA = typename Gemm::LayoutA;
+  using LayoutB = typename Gemm::LayoutB;
+  using LayoutD = typename Gemm::LayoutD;
+
+  int max_alignment = std::max(Gemm::kAlignmentA, Gemm::kAlignmentB);
+  std::vector<int> problem_size_m = {max_alignment, 512 - 3 * max_alignment};
+  std::vector<int> problem_size_n = {max_alignment, 512 - 2 * max_alignment};
+  std::vector<int> problem_size_k = {max_alignment, 512};
+
+  size_t prefetch_bytes = 3 * cutlass::gemm::kernel::detail::L2Prefetch::ChunkBytes + 48;
+  cutlass::DeviceAllocation<uint8_t> prefetch_block(prefetch_bytes + 16);
+
+  cutlass::DeviceAllocation<ElementA> A_block;
+  cutlass::DeviceAllocation<ElementB> B_block;
+  cutlass::DeviceAllocation<ElementD> ref_D_block;
+  cutlass::DeviceAllocation<ElementD> D_block;
+  cutlass::DeviceAllocation<ElementD> prefetch_D_block;
+  cutlass::DeviceAllocation<uint8_t> workspace;
+
+  for (int m : problem_size_m) {
+  for (int n : problem_size_n) {
+    for (int k : problem_size_k) {
+    ProblemShapeType problem_size{m, n, k, 1};
+
+    A_block.reset(m * k);
+    B_block.reset(k * n);
+    ref_D_block.reset(m * n);
+    D_block.reset(m * n);
+    prefetch_D_block.reset(m * n);
+
+    // Small integers keep the products exact in F16
+    cutlass::reference::device::BlockFillRandomUniform(A_block.get(), A_block.size(), 2023, ElementA(2), ElementA(-2), 0);
+    cutlass::reference::device::BlockFillRandomUniform(B_block.get(), B_block.size(), 2024, ElementB(2), ElementB(-2), 0);
+
+    cutlass::reference::device::Gemm<
+      ElementA, LayoutA, ElementB, LayoutB, ElementD, LayoutD, float, float> reference_gemm;
+    reference_gemm(
+      {m, n, k}, 1.0f,
+      {A_block.get(), LayoutA::packed({m, k})},
+      {B_block.get(), LayoutB::packed({k, n})},
+      0.0f,
+      {ref_D_block.get(), LayoutD::packed({m, n})},
+      {ref_D_block.get(), LayoutD::packed({m, n})});
+
+    auto stride_A = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, {m, k, 1});
+    auto stride_B = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, {n, k, 1});
+    auto stride_C = cutlass::make_cute_packed_stride(typename GemmKernel::StrideC{}, {m, n, 1});
+    auto stride_D = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, {m, n, 1});
+
+    for (bool prefetch : {false, true}) {
+      ElementD* ptr_D = prefetch ? prefetch_D_block.get() : D_block.get();
+      typename Gemm::Arguments arguments{
+        cutlass::gemm::GemmUniversalMode::kGemm,
+        problem_size,
+        {A_block.get(), stride_A, B_block.get(), stride_B},
+        {{1.0f, 0.0f}, nullptr, stride_C, ptr_D, stride_D},
+        /*hw_info=*/{},
+        /*scheduler=*/{},
+        /*l2_prefetch=*/{prefetch ? prefetch_block.get() + 16 : nullptr, prefetch_bytes}
+      };
+
+      Gemm gemm_op;
+      cutlass::Status status = gemm_op.can_implement(arguments);
+      EXPECT_EQ(status, cutlass::Status::kSuccess);
+      if (status != cutlass::Status::kSuccess) {
+        return false;
+      }
+      workspace.reset(Gemm::get_workspace_size(arguments));
+      status = gemm_op.initialize(arguments, workspace.get());
+      EXPECT_EQ(status, cutlass::Status::kSuccess);
+      status = gemm_op.run();
+      EXPECT_EQ(status, cutlass::Status::kSuccess);
+      cudaError_t result = cudaDeviceSynchronize();
+      EXPECT_EQ(result, cudaSuccess) << "Error at Kernel Sync.";
+      if (status != cutlass::Status::kSuccess || result != cudaSuccess) {
+        return false;
+      }
+
+      // Misaligned prefetch buffers are rejected
+      if (prefetch) {
+        auto misaligned_arguments = arguments;
+        misaligned_arguments.l2_prefetch.ptr = prefetch_block.get() + 8;
+        EXPECT_NE(gemm_op.can_implement(misaligned_arguments), cutlass::Status::kSuccess);
+      }
+    }
+
+    // The prefetch must not change the result
+    if (!cutlass::reference::device::BlockCompareEqual(D_block.get(), ref_D_block.get(), m * n) ||
+        !cutlass::reference::device::BlockCompareEqual(prefetch_D_block.get(), ref_D_block.get(), m * n)) {
+      return false;
+    }
+    }
+  }
+  }
+
+  return true;
+}
+
+template <class KernelSchedule, class EpilogueSchedule, class TileShape_MNK, class ClusterShape_MNK>
+static bool run_l2_prefetch_test() {
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::ColumnMajor;
+  using LayoutC = cutlass::layout::ColumnMajor;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      cutlass::half_t, LayoutC, 8,
+      cutlass::half_t, LayoutC, 8,
+      EpilogueSchedule
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, LayoutA, 8,
+      cutlass::half_t, LayoutB, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue>;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+  return testL2Prefetch<Gemm>();
+}
+
+} // namespace test::gemm::device
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16n_tensor_op_gmma_f32_cooperative_l2_prefetch, 256x128x64_2x1x1) {
+  bool passed = test::gemm::device::run_l2_prefetch_test<
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative,
+    Shape<_256,_128,_64>, Shape<_2,_1,_1>>();
+  EXPECT_TRUE(passed);
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16n_tensor_op_gmma_f32_pingpong_l2_prefetch, 128x128x64_1x2x1) {
+  bool passed = test::gemm::device::run_l2_prefetch_test<
+    cutlass::gemm::KernelTmaWarpSpecializedPingpong,
+    cutlass::epilogue::TmaWarpSpecialized,
+    Shape<_128,_128,_64>, Shape<_1,_2,_1>>();
+  EXPECT_TRUE(passed);
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
@@ -0,0 +1,352 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for Sm90 f16_f16_f16 with a cooperative EVT epilogue that splits the QKV projection
+    into Q and a paged KV cache, with the optional rotary embedding and KV cache quantization
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+namespace test::gemm::device {
+
+// Layout of the QKV destinations. Q is token-major or head-major, the caches are laid out
+// (block, slot, head, dim) or (block, head, slot, dim).
+struct QkvCacheTestConfig {
+  int num_q_heads;
+  int num_kv_heads;
+  int head_dim;
+  int block_size;
+  int num_blocks;
+  bool q_head_major;
+  bool cache_head_major;
+  int rotary_dim;
+  bool quantize;
+};
+
+template <class Gemm, class ElementQ, class ElementCache>
+bool testQkvCacheStore(int m, int k, QkvCacheTestConfig const& cfg) {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+
+  constexpr float alpha = 0.25f;
+  constexpr float sentinel = -3.0f;
+  constexpr int max_position = 64;
+
+  int const D = cfg.head_dim;
+  int const n = (cfg.num_q_heads + 2 * cfg.num_kv_heads) * D;
+  int const num_slots = cfg.num_blocks * cfg.block_size;
+
+  int64_t q_stride_token = cfg.q_head_major ? D : int64_t(cfg.num_q_heads) * D;
+  int64_t q_stride_head = cfg.q_head_major ? int64_t(m) * D : D;
+  int64_t cache_stride_block = int64_t(cfg.block_size) * cfg.num_kv_heads * D;
+  int64_t cache_stride_slot = cfg.cache_head_major ? D : int64_t(cfg.num_kv_heads) * D;
+  int64_t cache_stride_head = cfg.cache_head_major ? int64_t(cfg.block_size) * D : D;
+
+  float const q_scale = cfg.quantize ? 2.0f : 1.0f;
+  float const k_scale = cfg.quantize ? 0.5f : 1.0f;
+  float const v_scale = cfg.quantize ? 0.25f : 1.0f;
+
+  std::vector<ElementA> host_A(m * k);
+  std::vector<ElementB> host_B(n * k);
+  for (int i = 0; i < m * k; ++i) {
+    host_A[i] = ElementA(float((i * 7) % 5 - 2));
+  }
+  for (int i = 0; i < n * k; ++i) {
+    host_B[i] = ElementB(float((i * 3) % 5 - 2));
+  }
+
+  // Tokens go to scrambled, unique cache slots, and every 9th token (e.g. padding) is not cached
+  std::vector<int64_t> host_slot(m);
+  std::vector<int32_t> host_position(m);
+  for (int t = 0; t < m; ++t) {
+    host_slot[t] = (t % 9 == 8) ? -1 : (int64_t(t) * 7) % num_slots;
+    host_position[t] = (t * 5 + 3) % max_position;
+  }
+  std::vector<float> host_cos_sin(max_position * std::max(cfg.rotary_dim, 1));
+  for (int p = 0; p < max_position && cfg.rotary_dim != 0; ++p) {
+    for (int i = 0; i < cfg.rotary_dim / 2; ++i) {
+      float theta = float(p) * std::pow(10000.0f, -2.0f * float(i) / float(cfg.rotary_dim));
+      host_cos_sin[p * cfg.rotary_dim + i] = std::cos(theta);
+      host_cos_sin[p * cfg.rotary_dim + cfg.rotary_dim / 2 + i] = std::sin(theta);
+    }
+  }
+
+  // Host reference, A is row-major and B column-major
+  std::vector<float> ref_Q(int64_t(m) * cfg.num_q_heads * D, sentinel);
+  std::vector<float> ref_K(int64_t(num_slots) * cfg.num_kv_heads * D, sentinel);
+  std::vector<float> ref_V(int64_t(num_slots) * cfg.num_kv_heads * D, sentinel);
+  std::vector<float> row(n);
+  for (int t = 0; t < m; ++t) {
+    for (int j = 0; j < n; ++j) {
+      float acc = 0.0f;
+      for (int kk = 0; kk < k; ++kk) {
+        acc += float(host_A[t * k + kk]) * float(host_B[j * k + kk]);
+      }
+      row[j] = alpha * acc;
+    }
+    for (int h = 0; h < cfg.num_q_heads + cfg.num_kv_heads; ++h) {
+      float* head = row.data() + h * D;
+      for (int i = 0; i < cfg.rotary_dim / 2; ++i) {
+        float cos_theta = host_cos_sin[host_position[t] * cfg.rotary_dim + i];
+        float sin_theta = host_cos_sin[host_position[t] * cfg.rotary_dim + cfg.rotary_dim / 2 + i];
+        float x0 = head[2 * i];
+        float x1 = head[2 * i + 1];
+        head[2 * i]     = x0 * cos_theta - x1 * sin_theta;
+        head[2 * i + 1] = x1 * cos_theta + x0 * sin_theta;
+      }
+    }
+    for (int h = 0; h < cfg.num_q_heads; ++h) {
+      for (int d = 0; d < D; ++d) {
+        ref_Q[t * q_stride_token + h * q_stride_head + d] = float(ElementQ(row[h * D + d] / q_scale));
+      }
+    }
+    if (host_slot[t] < 0) {
+      continue;
+    }
+    int64_t block = host_slot[t] / cfg.block_size;
+    int64_t block_offset = host_slot[t] % cfg.block_size;
+    for (int h = 0; h < cfg.num_kv_heads; ++h) {
+      int64_t offset = block * cache_stride_block + block_offset * cache_stride_slot + h * cache_stride_head;
+      for (int d = 0; d < D; ++d) {
+        ref_K[offset + d] = float(ElementCache(row[(cfg.num_q_heads + h) * D + d] / k_scale));
+        ref_V[offset + d] = float(ElementCache(row[(cfg.num_q_heads + cfg.num_kv_heads + h) * D + d] / v_scale));
+      }
+    }
+  }
+
+  std::vector<ElementQ> host_Q(ref_Q.size(), ElementQ(sentinel));
+  std::vector<ElementCache> host_K(ref_K.size(), ElementCache(sentinel));
+  std::vector<ElementCache> host_V(ref_V.size(), ElementCache(sentinel));
+  std::vector<float> host_scales = {q_scale, k_scale, v_scale};
+
+  cutlass::DeviceAllocation<ElementA> A_block(host_A.size());
+  cutlass::DeviceAllocation<ElementB> B_block(host_B.size());
+  cutlass::DeviceAllocation<int64_t> slot_block(host_slot.size());
+  cutlass::DeviceAllocation<int32_t> position_block(host_position.size());
+  cutlass::DeviceAllocation<float> cos_sin_block(host_cos_sin.size());
+  cutlass::DeviceAllocation<float> scale_block(host_scales.size());
+  cutlass::DeviceAllocation<ElementQ> Q_block(host_Q.size());
+  cutlass::DeviceAllocation<ElementCache> K_block(host_K.size());
+  cutlass::DeviceAllocation<ElementCache> V_block(host_V.size());
+  A_block.copy_from_host(host_A.data());
+  B_block.copy_from_host(host_B.data());
+  slot_block.copy_from_host(host_slot.data());
+  position_block.copy_from_host(host_position.data());
+  cos_sin_block.copy_from_host(host_cos_sin.data());
+  scale_block.copy_from_host(host_scales.data());
+  Q_block.copy_from_host(host_Q.data());
+  K_block.copy_from_host(host_K.data());
+  V_block.copy_from_host(host_V.data());
+
+  auto stride_A = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, {m, k, 1});
+  auto stride_B = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, {n, k, 1});
+  auto stride_C = cutlass::make_cute_packed_stride(typename GemmKernel::StrideC{}, {m, n, 1});
+  auto stride_D = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, {m, n, 1});
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {m, n, k, 1},
+    {A_block.get(), stride_A, B_block.get(), stride_B},
+    {{}, nullptr, stride_C, nullptr, stride_D}
+  };
+  auto& qkv_args = arguments.epilogue.thread.op_1;
+  arguments.epilogue.thread.op_0 = {
+    // binary op : alpha * acc
+    {{alpha}},  // leaf op+args : alpha
+    {},         // leaf op+args : acc
+    {}          // binary args : multiplies
+  };
+  qkv_args.num_q_heads = cfg.num_q_heads;
+  qkv_args.num_kv_heads = cfg.num_kv_heads;
+  qkv_args.head_dim = D;
+  qkv_args.ptr_q = Q_block.get();
+  qkv_args.q_stride_token = q_stride_token;
+  qkv_args.q_stride_head = q_stride_head;
+  qkv_args.ptr_k_cache = K_block.get();
+  qkv_args.ptr_v_cache = V_block.get();
+  qkv_args.block_size = cfg.block_size;
+  qkv_args.cache_stride_block = cache_stride_block;
+  qkv_args.cache_stride_slot = cache_stride_slot;
+  qkv_args.cache_stride_head = cache_stride_head;
+  qkv_args.ptr_slot_mapping = slot_block.get();
+  if (cfg.quantize) {
+    qkv_args.ptr_q_scale = scale_block.get();
+    qkv_args.ptr_k_scale = scale_block.get() + 1;
+    qkv_args.ptr_v_scale = scale_block.get() + 2;
+  }
+  if (cfg.rotary_dim != 0) {
+    qkv_args.rotary_dim = cfg.rotary_dim;
+    qkv_args.ptr_positions = position_block.get();
+    qkv_args.ptr_cos_sin = cos_sin_block.get();
+  }
+
+  Gemm gemm_op;
+  cutlass::Status status = gemm_op.can_implement(arguments);
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  if (status != cutlass::Status::kSuccess) {
+    return false;
+  }
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  status = gemm_op.initialize(arguments, workspace.get());
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  status = gemm_op.run();
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  cudaError_t result = cudaDeviceSynchronize();
+  EXPECT_EQ(result, cudaSuccess) << "Error at Kernel Sync.";
+  if (status != cutlass::Status::kSuccess || result != cudaSuccess) {
+    return false;
+  }
+
+  // The rotated and quantized values may round to a neighboring value of the destination type
+  float const tolerance = cfg.rotary_dim != 0 ? 0.125f : 0.0f;
+  auto compare = [&](char const* name, auto const& got, std::vector<float> const& ref) {
+    for (size_t i = 0; i < ref.size(); ++i) {
+      float value = float(got[i]);
+      if (std::abs(value - ref[i]) > tolerance * std::abs(ref[i]) + (tolerance != 0.0f ? 1e-2f : 0.0f)) {
+        std::cout << name << " mismatch at offset " << i << ": " << value << " vs " << ref[i] << std::endl;
+        return false;
+      }
+    }
+    return true;
+  };
+  Q_block.copy_to_host(host_Q.data());
+  K_block.copy_to_host(host_K.data());
+  V_block.copy_to_host(host_V.data());
+  if (!compare("Q", host_Q, ref_Q) || !compare("K cache", host_K, ref_K) || !compare("V cache", host_V, ref_V)) {
+    return false;
+  }
+
+  // N must hold exactly the Q, K and V heads
+  typename Gemm::Arguments bad_heads = arguments;
+  bad_heads.epilogue.thread.op_1.num_q_heads += 1;
+  EXPECT_NE(gemm_op.can_implement(bad_heads), cutlass::Status::kSuccess);
+
+  // The slot mapping is required for the KV cache
+  typename Gemm::Arguments no_slots = arguments;
+  no_slots.epilogue.thread.op_1.ptr_slot_mapping = nullptr;
+  EXPECT_NE(gemm_op.can_implement(no_slots), cutlass::Status::kSuccess);
+
+  return true;
+}
+
+template <class ElementCache>
+static bool run_qkv_cache_store_test(int m, int k, QkvCacheTestConfig const& cfg) {
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::ColumnMajor;
+  using LayoutC = cutlass::layout::RowMajor;
+  using TileShape_MNK = Shape<_128,_128,_64>;
+  using ClusterShape_MNK = Shape<_2,_1,_1>;
+
+  using namespace cutlass::epilogue::fusion;
+
+  constexpr auto RoundStyle = cutlass::FloatRoundStyle::round_to_nearest;
+
+  using ScaledAcc = Sm90EVT<Sm90Compute<cutlass::multiplies, float, float, RoundStyle>, // alpha * acc
+                      Sm90ScalarBroadcast<float>,                                     // alpha
+                      Sm90AccFetch                                                    // acc
+                    >;
+  using QkvCacheStore = Sm90QkvCacheStore<cutlass::half_t, ElementCache, float, RoundStyle>;
+  using FusionCallbacks = Sm90EVT<QkvCacheStore, ScaledAcc>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      void, LayoutC, 8,
+      void, LayoutC, 8,
+      cutlass::epilogue::TmaWarpSpecializedCooperative,
+      FusionCallbacks
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, LayoutA, 8,
+      cutlass::half_t, LayoutB, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::gemm::KernelTmaWarpSpecializedCooperative
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue>;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+  return testQkvCacheStore<Gemm, cutlass::half_t, ElementCache>(m, k, cfg);
+}
+
+} // namespace test::gemm::device
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_2x1x1_QkvCacheStore) {
+  using namespace test::gemm::device;
+  // Grouped-query attention with token-major Q and a (block, slot, head, dim) cache
+  QkvCacheTestConfig cfg{/*num_q_heads=*/4, /*num_kv_heads=*/2, /*head_dim=*/64, /*block_size=*/16, /*num_blocks=*/16,
+                         /*q_head_major=*/false, /*cache_head_major=*/false, /*rotary_dim=*/0, /*quantize=*/false};
+  EXPECT_TRUE(run_qkv_cache_store_test<cutlass::half_t>(/*m=*/256, /*k=*/128, cfg));
+  EXPECT_TRUE(run_qkv_cache_store_test<cutlass::half_t>(/*m=*/203, /*k=*/64, cfg));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_2x1x1_QkvCacheStoreRotaryFp8) {
+  using namespace test::gemm::device;
+  // Partial rotary embedding, head-major Q and a quantized (block, head, slot, dim) cache
+  QkvCacheTestConfig cfg{/*num_q_heads=*/2, /*num_kv_heads=*/1, /*head_dim=*/128, /*block_size=*/32, /*num_blocks=*/8,
+                         /*q_head_major=*/true, /*cache_head_major=*/true, /*rotary_dim=*/64, /*quantize=*/true};
+  EXPECT_TRUE(run_qkv_cache_store_test<cutlass::float_e4m3_t>(/*m=*/256, /*k=*/128, cfg));
+  EXPECT_TRUE(run_qkv_cache_store_test<cutlass::float_e4m3_t>(/*m=*/131, /*k=*/64, cfg));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
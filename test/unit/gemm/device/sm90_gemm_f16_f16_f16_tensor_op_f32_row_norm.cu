@@ -0,0 +1,331 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the Sm90 RMSNorm/LayerNorm row statistics and row normalization epilogues
+*/
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+namespace test::gemm::device {
+
+template <class FusionOperation>
+struct RowNormGemm {
+  using TileShape_MNK = Shape<_128,_128,_64>;
+  using ClusterShape_MNK = Shape<_1,_1,_1>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::epilogue::TmaWarpSpecializedCooperative,
+      FusionOperation
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::gemm::KernelTmaWarpSpecializedCooperative
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue>;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+template <class Gemm>
+static bool run_row_norm_gemm(typename Gemm::Arguments const& arguments) {
+  Gemm gemm_op;
+  cutlass::Status status = gemm_op.can_implement(arguments);
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  if (status != cutlass::Status::kSuccess) {
+    return false;
+  }
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  status = gemm_op.initialize(arguments, workspace.get());
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  status = gemm_op.run();
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  cudaError_t result = cudaDeviceSynchronize();
+  EXPECT_EQ(result, cudaSuccess) << "Error at Kernel Sync.";
+  return status == cutlass::Status::kSuccess && result == cudaSuccess;
+}
+
+// Producer: X = A0 @ B0 + residual (m, h) with the row sum and sum of squares of X.
+// Consumer: Y = norm(X) @ W + beta * C (m, n), where norm is RMSNorm, or LayerNorm with gamma and shift.
+// Small integer inputs keep X and its statistics exact, so both GEMMs are checked against a host reference.
+static bool testRowNorm(int m, int h, int n, int k, bool layer_norm) {
+  using ProducerGemm = typename RowNormGemm<
+      cutlass::epilogue::fusion::LinCombRowNormStatistics<cutlass::half_t, float>>::Gemm;
+  using ConsumerGemm = typename RowNormGemm<
+      cutlass::epilogue::fusion::RowNormLinCombPerColBias<cutlass::half_t, float, float>>::Gemm;
+  using half_t = cutlass::half_t;
+
+  float const epsilon = 1e-5f;
+  float const beta = 0.5f;
+
+  std::vector<half_t> host_A0(m * k), host_B0(h * k), host_residual(m * h);
+  for (int i = 0; i < m * k; ++i) {
+    host_A0[i] = half_t(float((i * 7) % 5 - 2));
+  }
+  for (int i = 0; i < h * k; ++i) {
+    host_B0[i] = half_t(float((i * 3) % 5 - 2));
+  }
+  for (int i = 0; i < m * h; ++i) {
+    host_residual[i] = half_t(float((i * 11) % 7 - 3));
+  }
+  // Row 1 is constant, which makes its LayerNorm variance zero
+  for (int j = 0; j < k && m > 1; ++j) {
+    host_A0[k + j] = half_t(0);
+  }
+  for (int j = 0; j < h && m > 1; ++j) {
+    host_residual[h + j] = half_t(1);
+  }
+
+  // Host reference for the producer, A0 is row-major and B0 column-major
+  std::vector<float> X(m * h), ref_row_sum(m, 0.0f), ref_row_sum_sq(m, 0.0f);
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < h; ++j) {
+      float acc = 0.0f;
+      for (int kk = 0; kk < k; ++kk) {
+        acc += float(host_A0[i * k + kk]) * float(host_B0[j * k + kk]);
+      }
+      X[i * h + j] = acc + float(host_residual[i * h + j]);
+      ref_row_sum[i] += X[i * h + j];
+      ref_row_sum_sq[i] += X[i * h + j] * X[i * h + j];
+    }
+  }
+
+  // Consumer weights, gamma is folded into W along K and the shift becomes a bias
+  std::vector<float> gamma(h, 1.0f), shift(h, 0.0f);
+  if (layer_norm) {
+    for (int kk = 0; kk < h; ++kk) {
+      gamma[kk] = 0.5f * float(kk % 4 + 1);
+      shift[kk] = 0.25f * float(kk % 3 - 1);
+    }
+  }
+  std::vector<half_t> host_W(n * h), host_C(m * n);
+  std::vector<float> host_col_weight_sum(n, 0.0f), host_bias(n, 0.0f);
+  for (int j = 0; j < n; ++j) {
+    for (int kk = 0; kk < h; ++kk) {
+      float w = float((j * 5 + kk * 3) % 5 - 2);
+      host_W[j * h + kk] = half_t(gamma[kk] * w);
+      host_col_weight_sum[j] += gamma[kk] * w;
+      host_bias[j] += shift[kk] * w;
+    }
+  }
+  for (int i = 0; i < m * n; ++i) {
+    host_C[i] = half_t(float((i * 13) % 9 - 4));
+  }
+
+  std::vector<float> ref_Y(m * n);
+  for (int i = 0; i < m; ++i) {
+    float mean = layer_norm ? ref_row_sum[i] / h : 0.0f;
+    float var = ref_row_sum_sq[i] / h - mean * mean;
+    float rstd = 1.0f / std::sqrt(var + epsilon);
+    for (int j = 0; j < n; ++j) {
+      float acc = 0.0f;
+      for (int kk = 0; kk < h; ++kk) {
+        float x_norm = (X[i * h + kk] - mean) * rstd;
+        acc += (gamma[kk] * x_norm + shift[kk]) * float((j * 5 + kk * 3) % 5 - 2);
+      }
+      ref_Y[i * n + j] = acc + beta * float(host_C[i * n + j]);
+    }
+  }
+
+  cutlass::DeviceAllocation<half_t> A0_block(host_A0.size());
+  cutlass::DeviceAllocation<half_t> B0_block(host_B0.size());
+  cutlass::DeviceAllocation<half_t> residual_block(host_residual.size());
+  cutlass::DeviceAllocation<half_t> X_block(m * h);
+  cutlass::DeviceAllocation<float> row_sum_block(m);
+  cutlass::DeviceAllocation<float> row_sum_sq_block(m);
+  cutlass::DeviceAllocation<half_t> W_block(host_W.size());
+  cutlass::DeviceAllocation<half_t> C_block(host_C.size());
+  cutlass::DeviceAllocation<float> col_weight_sum_block(n);
+  cutlass::DeviceAllocation<float> bias_block(n);
+  cutlass::DeviceAllocation<half_t> Y_block(m * n);
+  A0_block.copy_from_host(host_A0.data());
+  B0_block.copy_from_host(host_B0.data());
+  residual_block.copy_from_host(host_residual.data());
+  W_block.copy_from_host(host_W.data());
+  C_block.copy_from_host(host_C.data());
+  col_weight_sum_block.copy_from_host(host_col_weight_sum.data());
+  bias_block.copy_from_host(host_bias.data());
+  // Stale statistics must be overwritten
+  cudaMemset(row_sum_block.get(), 0x7f, row_sum_block.bytes());
+  cudaMemset(row_sum_sq_block.get(), 0x7f, row_sum_sq_block.bytes());
+
+  //
+  // Producer GEMM
+  //
+
+  {
+    using GemmKernel = typename ProducerGemm::GemmKernel;
+    auto stride_A = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, {m, k, 1});
+    auto stride_B = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, {h, k, 1});
+    auto stride_C = cutlass::make_cute_packed_stride(typename GemmKernel::StrideC{}, {m, h, 1});
+    auto stride_D = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, {m, h, 1});
+
+    typename ProducerGemm::Arguments arguments{
+      cutlass::gemm::GemmUniversalMode::kGemm,
+      {m, h, k, 1},
+      {A0_block.get(), stride_A, B0_block.get(), stride_B},
+      {{}, residual_block.get(), stride_C, X_block.get(), stride_D}
+    };
+    auto& fusion_args = arguments.epilogue.thread;
+    fusion_args.alpha = 1.0f;
+    fusion_args.beta = 1.0f;
+    fusion_args.row_sum_sq_ptr = row_sum_sq_block.get();
+    fusion_args.row_sum_ptr = layer_norm ? row_sum_block.get() : nullptr;
+    fusion_args.dStatistic = {_1{}, _0{}, int64_t(m)};
+
+    if (!run_row_norm_gemm<ProducerGemm>(arguments)) {
+      return false;
+    }
+  }
+
+  std::vector<half_t> host_X(m * h);
+  std::vector<float> host_row_sum(m), host_row_sum_sq(m);
+  X_block.copy_to_host(host_X.data());
+  row_sum_block.copy_to_host(host_row_sum.data());
+  row_sum_sq_block.copy_to_host(host_row_sum_sq.data());
+  for (int i = 0; i < m; ++i) {
+    if (std::abs(host_row_sum_sq[i] - ref_row_sum_sq[i]) > 1e-4f * ref_row_sum_sq[i]) {
+      std::cout << "Row sum of squares mismatch at row " << i << ": " << host_row_sum_sq[i] << " vs " << ref_row_sum_sq[i] << std::endl;
+      return false;
+    }
+    if (layer_norm && host_row_sum[i] != ref_row_sum[i]) {
+      std::cout << "Row sum mismatch at row " << i << ": " << host_row_sum[i] << " vs " << ref_row_sum[i] << std::endl;
+      return false;
+    }
+    for (int j = 0; j < h; ++j) {
+      if (float(host_X[i * h + j]) != X[i * h + j]) {
+        std::cout << "X mismatch at (" << i << ", " << j << "): " << float(host_X[i * h + j]) << " vs " << X[i * h + j] << std::endl;
+        return false;
+      }
+    }
+  }
+
+  //
+  // Consumer GEMM, normalizing X in the epilogue
+  //
+
+  {
+    using GemmKernel = typename ConsumerGemm::GemmKernel;
+    auto stride_A = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, {m, h, 1});
+    auto stride_B = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, {n, h, 1});
+    auto stride_C = cutlass::make_cute_packed_stride(typename GemmKernel::StrideC{}, {m, n, 1});
+    auto stride_D = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, {m, n, 1});
+
+    typename ConsumerGemm::Arguments arguments{
+      cutlass::gemm::GemmUniversalMode::kGemm,
+      {m, n, h, 1},
+      {X_block.get(), stride_A, W_block.get(), stride_B},
+      {{}, C_block.get(), stride_C, Y_block.get(), stride_D}
+    };
+    auto& fusion_args = arguments.epilogue.thread;
+    fusion_args.alpha = 1.0f;
+    fusion_args.beta = beta;
+    fusion_args.norm_extent = h;
+    fusion_args.epsilon = epsilon;
+    fusion_args.row_sum_sq_ptr = row_sum_sq_block.get();
+    fusion_args.row_sum_ptr = layer_norm ? row_sum_block.get() : nullptr;
+    fusion_args.dStatistic = {_1{}, _0{}, int64_t(m)};
+    fusion_args.col_weight_sum_ptr = layer_norm ? col_weight_sum_block.get() : nullptr;
+    fusion_args.dColWeightSum = {_0{}, _1{}, int64_t(n)};
+    fusion_args.bias_ptr = layer_norm ? bias_block.get() : nullptr;
+    fusion_args.dBias = {_0{}, _1{}, int64_t(n)};
+
+    if (!run_row_norm_gemm<ConsumerGemm>(arguments)) {
+      return false;
+    }
+  }
+
+  std::vector<half_t> host_Y(m * n);
+  Y_block.copy_to_host(host_Y.data());
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < n; ++j) {
+      float expected = ref_Y[i * n + j];
+      float actual = float(host_Y[i * n + j]);
+      if (std::abs(actual - expected) > 1e-2f * std::abs(expected) + 5e-2f) {
+        std::cout << "Y mismatch at (" << i << ", " << j << "): " << actual << " vs " << expected << std::endl;
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+} // namespace test::gemm::device
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_row_norm, 128x128x64_rmsnorm) {
+  EXPECT_TRUE(test::gemm::device::testRowNorm(/*m=*/256, /*h=*/384, /*n=*/256, /*k=*/64, /*layer_norm=*/false));
+  // Residues in every mode, the statistics of a row are reduced across a partial CTA
+  EXPECT_TRUE(test::gemm::device::testRowNorm(/*m=*/200, /*h=*/328, /*n=*/136, /*k=*/128, /*layer_norm=*/false));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_row_norm, 128x128x64_layernorm) {
+  EXPECT_TRUE(test::gemm::device::testRowNorm(/*m=*/256, /*h=*/384, /*n=*/256, /*k=*/64, /*layer_norm=*/true));
+  EXPECT_TRUE(test::gemm::device::testRowNorm(/*m=*/200, /*h=*/328, /*n=*/136, /*k=*/128, /*layer_norm=*/true));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
@@ -0,0 +1,254 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for Sm90 f16_f16_f16 with a cooperative EVT epilogue that scatters
+    (and optionally combines) the weighted output rows into a destination tensor
+*/
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+namespace test::gemm::device {
+
+// Row m is written to row index[m] of a (num_dst_rows, N) destination, scaled by weight[m].
+// Without top-k the destination rows are a scrambled subset and every 5th row is dropped (index -1).
+// With top-k each destination row receives top_k output rows, which the epilogue must combine.
+template <class Gemm>
+bool testScatterStore(int m, int n, int k, int num_dst_rows, int top_k, bool use_weights) {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+  using ElementAux = cutlass::half_t;
+
+  constexpr float alpha = 0.5f;
+  constexpr float sentinel = -7.0f;
+  float const weight_values[4] = {0.5f, 1.0f, 2.0f, 0.25f};
+
+  std::vector<ElementA> host_A(m * k);
+  std::vector<ElementB> host_B(n * k);
+  for (int i = 0; i < m * k; ++i) {
+    host_A[i] = ElementA(float((i * 7) % 5 - 2));
+  }
+  for (int i = 0; i < n * k; ++i) {
+    host_B[i] = ElementB(float((i * 3) % 5 - 2));
+  }
+
+  std::vector<int32_t> host_index(m);
+  std::vector<float> host_weight(m);
+  for (int i = 0; i < m; ++i) {
+    if (top_k > 1) {
+      host_index[i] = ((i % num_dst_rows) * 7) % num_dst_rows;
+    }
+    else {
+      host_index[i] = (i % 5 == 4) ? -1 : (i * 7) % num_dst_rows;
+    }
+    host_weight[i] = weight_values[(i * 3) % 4];
+  }
+
+  // Host reference, A is row-major and B column-major. Untouched destination rows keep the sentinel
+  // (or zero when combining).
+  std::vector<float> ref_dst(num_dst_rows * n, top_k > 1 ? 0.0f : sentinel);
+  for (int i = 0; i < m; ++i) {
+    if (host_index[i] < 0) {
+      continue;
+    }
+    for (int j = 0; j < n; ++j) {
+      float acc = 0.0f;
+      for (int kk = 0; kk < k; ++kk) {
+        acc += float(host_A[i * k + kk]) * float(host_B[j * k + kk]);
+      }
+      float row = alpha * acc * (use_weights ? host_weight[i] : 1.0f);
+      float& dst = ref_dst[host_index[i] * n + j];
+      dst = top_k > 1 ? dst + float(ElementAux(row)) : float(ElementAux(row));
+    }
+  }
+
+  std::vector<ElementAux> host_dst(num_dst_rows * n, ElementAux(top_k > 1 ? 0.0f : sentinel));
+
+  cutlass::DeviceAllocation<ElementA> A_block(host_A.size());
+  cutlass::DeviceAllocation<ElementB> B_block(host_B.size());
+  cutlass::DeviceAllocation<int32_t> index_block(host_index.size());
+  cutlass::DeviceAllocation<float> weight_block(host_weight.size());
+  cutlass::DeviceAllocation<ElementAux> dst_block(host_dst.size());
+  A_block.copy_from_host(host_A.data());
+  B_block.copy_from_host(host_B.data());
+  index_block.copy_from_host(host_index.data());
+  weight_block.copy_from_host(host_weight.data());
+  dst_block.copy_from_host(host_dst.data());
+
+  auto stride_A = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, {m, k, 1});
+  auto stride_B = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, {n, k, 1});
+  auto stride_C = cutlass::make_cute_packed_stride(typename GemmKernel::StrideC{}, {m, n, 1});
+  auto stride_D = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, {m, n, 1});
+  auto stride_dst = cutlass::make_cute_packed_stride(cutlass::detail::TagToStrideC_t<cutlass::layout::RowMajor>{}, {num_dst_rows, n, 1});
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {m, n, k, 1},
+    {A_block.get(), stride_A, B_block.get(), stride_B},
+    {{}, nullptr, stride_C, nullptr, stride_D}
+  };
+  arguments.epilogue.thread = {
+    // unary op : scatter store
+    {
+      // binary op : alpha * acc
+      {{alpha}},  // leaf op+args : alpha
+      {},         // leaf op+args : acc
+      {}          // binary args : multiplies
+    },
+    {dst_block.get(), stride_dst, index_block.get(), use_weights ? weight_block.get() : nullptr}
+  };
+
+  Gemm gemm_op;
+  cutlass::Status status = gemm_op.can_implement(arguments);
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  if (status != cutlass::Status::kSuccess) {
+    return false;
+  }
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  status = gemm_op.initialize(arguments, workspace.get());
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  status = gemm_op.run();
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  cudaError_t result = cudaDeviceSynchronize();
+  EXPECT_EQ(result, cudaSuccess) << "Error at Kernel Sync.";
+  if (status != cutlass::Status::kSuccess || result != cudaSuccess) {
+    return false;
+  }
+
+  dst_block.copy_to_host(host_dst.data());
+  for (int i = 0; i < num_dst_rows; ++i) {
+    for (int j = 0; j < n; ++j) {
+      float ref = ref_dst[i * n + j];
+      float got = float(host_dst[i * n + j]);
+      if (std::abs(got - ref) > 1e-3f * std::abs(ref)) {
+        std::cout << "Scatter destination mismatch at (" << i << ", " << j << "): "
+                  << got << " vs " << ref << std::endl;
+        return false;
+      }
+    }
+  }
+
+  // The row indices are required when the destination is set
+  typename Gemm::Arguments no_index = arguments;
+  no_index.epilogue.thread.op_1.ptr_row_index = nullptr;
+  EXPECT_NE(gemm_op.can_implement(no_index), cutlass::Status::kSuccess);
+
+  return true;
+}
+
+template <template <class> class GmemReduceFn>
+static bool run_scatter_store_test(int m, int n, int k, int num_dst_rows, int top_k, bool use_weights) {
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::ColumnMajor;
+  using LayoutC = cutlass::layout::RowMajor;
+  using TileShape_MNK = Shape<_128,_128,_64>;
+  using ClusterShape_MNK = Shape<_1,_2,_1>;
+
+  using namespace cutlass::epilogue::fusion;
+
+  constexpr auto RoundStyle = cutlass::FloatRoundStyle::round_to_nearest;
+
+  using ScaledAcc = Sm90EVT<Sm90Compute<cutlass::multiplies, float, float, RoundStyle>, // alpha * acc
+                      Sm90ScalarBroadcast<float>,                                     // alpha
+                      Sm90AccFetch                                                    // acc
+                    >;
+  using ScatterStore = Sm90AuxScatterStore<cutlass::half_t, float, RoundStyle,
+                         cutlass::detail::TagToStrideC_t<LayoutC>, int32_t, float, GmemReduceFn>;
+  using FusionCallbacks = Sm90EVT<ScatterStore, ScaledAcc>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      void, LayoutC, 8,
+      void, LayoutC, 8,
+      cutlass::epilogue::TmaWarpSpecializedCooperative,
+      FusionCallbacks
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, LayoutA, 8,
+      cutlass::half_t, LayoutB, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::gemm::KernelTmaWarpSpecializedCooperative
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue>;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+  return testScatterStore<Gemm>(m, n, k, num_dst_rows, top_k, use_weights);
+}
+
+} // namespace test::gemm::device
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_1x2x1_ScatterStore) {
+  using namespace test::gemm::device;
+  // Destination rows are unique, with more destination rows than output rows
+  EXPECT_TRUE(run_scatter_store_test<cutlass::first>(/*m=*/256, /*n=*/256, /*k=*/128, /*num_dst_rows=*/300, /*top_k=*/1, /*use_weights=*/false));
+  EXPECT_TRUE(run_scatter_store_test<cutlass::first>(/*m=*/203, /*n=*/136, /*k=*/64, /*num_dst_rows=*/211, /*top_k=*/1, /*use_weights=*/true));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_1x2x1_ScatterReduceTopK2) {
+  using namespace test::gemm::device;
+  // Every destination row (token) combines the weighted rows of its two experts
+  EXPECT_TRUE(run_scatter_store_test<cutlass::atomic_add>(/*m=*/256, /*n=*/256, /*k=*/128, /*num_dst_rows=*/128, /*top_k=*/2, /*use_weights=*/true));
+  EXPECT_TRUE(run_scatter_store_test<cutlass::atomic_add>(/*m=*/202, /*n=*/136, /*k=*/64, /*num_dst_rows=*/101, /*top_k=*/2, /*use_weights=*/true));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
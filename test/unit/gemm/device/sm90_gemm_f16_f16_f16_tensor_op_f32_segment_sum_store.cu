@@ -0,0 +1,256 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for Sm90 f16_f16_f16 with a cooperative EVT epilogue that sums the weighted
+    output columns of each segment into a pooled tensor (embedding-bag pooling)
+*/
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+namespace test::gemm::device {
+
+// Column n of batch l is added to column index[n + l * N] of the (M, num_segments, L) pooled tensor,
+// scaled by weight[n + l * N]. Segments collect columns of several output tiles and every 7th column
+// is skipped (index -1). A non-zero ld_pool pads the segments of the pooled tensor.
+template <class Gemm>
+bool testSegmentSumStore(int m, int n, int k, int l, int num_segments, int64_t ld_pool, bool use_weights) {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+
+  constexpr float alpha = 0.5f;
+  float const weight_values[4] = {0.5f, 1.0f, 2.0f, 0.25f};
+
+  int64_t ld = ld_pool == 0 ? int64_t(m) : ld_pool;
+  int64_t batch_stride_pool = ld * num_segments;
+
+  std::vector<ElementA> host_A(int64_t(m) * k * l);
+  std::vector<ElementB> host_B(int64_t(n) * k * l);
+  for (size_t i = 0; i < host_A.size(); ++i) {
+    host_A[i] = ElementA(float((i * 7) % 5 - 2));
+  }
+  for (size_t i = 0; i < host_B.size(); ++i) {
+    host_B[i] = ElementB(float((i * 3) % 5 - 2));
+  }
+
+  std::vector<int32_t> host_index(n * l);
+  std::vector<float> host_weight(n * l);
+  for (int i = 0; i < n * l; ++i) {
+    host_index[i] = (i % 7 == 6) ? -1 : ((i * 5) + (i / n)) % num_segments;
+    host_weight[i] = weight_values[(i * 3) % 4];
+  }
+
+  // Host reference, A is row-major and B column-major. The weighted products are sums of small
+  // powers of two, so the atomic reduction is exact in any order.
+  std::vector<float> ref_pool(batch_stride_pool * l, 0.0f);
+  for (int b = 0; b < l; ++b) {
+    for (int j = 0; j < n; ++j) {
+      int32_t segment = host_index[b * n + j];
+      if (segment < 0) {
+        continue;
+      }
+      for (int i = 0; i < m; ++i) {
+        float acc = 0.0f;
+        for (int kk = 0; kk < k; ++kk) {
+          acc += float(host_A[(int64_t(b) * m + i) * k + kk]) * float(host_B[(int64_t(b) * n + j) * k + kk]);
+        }
+        float value = alpha * acc * (use_weights ? host_weight[b * n + j] : 1.0f);
+        ref_pool[b * batch_stride_pool + segment * ld + i] += value;
+      }
+    }
+  }
+
+  // The pooled tensor is reduced into and must be zeroed
+  std::vector<float> host_pool(ref_pool.size(), 0.0f);
+
+  cutlass::DeviceAllocation<ElementA> A_block(host_A.size());
+  cutlass::DeviceAllocation<ElementB> B_block(host_B.size());
+  cutlass::DeviceAllocation<int32_t> index_block(host_index.size());
+  cutlass::DeviceAllocation<float> weight_block(host_weight.size());
+  cutlass::DeviceAllocation<float> pool_block(host_pool.size());
+  A_block.copy_from_host(host_A.data());
+  B_block.copy_from_host(host_B.data());
+  index_block.copy_from_host(host_index.data());
+  weight_block.copy_from_host(host_weight.data());
+  pool_block.copy_from_host(host_pool.data());
+
+  auto stride_A = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, {m, k, l});
+  auto stride_B = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, {n, k, l});
+  auto stride_C = cutlass::make_cute_packed_stride(typename GemmKernel::StrideC{}, {m, n, l});
+  auto stride_D = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, {m, n, l});
+
+  typename Gemm::Arguments arguments{
+    l > 1 ? cutlass::gemm::GemmUniversalMode::kBatched : cutlass::gemm::GemmUniversalMode::kGemm,
+    {m, n, k, l},
+    {A_block.get(), stride_A, B_block.get(), stride_B},
+    {{}, nullptr, stride_C, nullptr, stride_D}
+  };
+  arguments.epilogue.thread = {
+    // unary op : segment sum store
+    {
+      // binary op : alpha * acc
+      {{alpha}},  // leaf op+args : alpha
+      {},         // leaf op+args : acc
+      {}          // binary args : multiplies
+    },
+    {pool_block.get(), index_block.get(), use_weights ? weight_block.get() : nullptr, ld_pool, batch_stride_pool}
+  };
+
+  Gemm gemm_op;
+  cutlass::Status status = gemm_op.can_implement(arguments);
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  if (status != cutlass::Status::kSuccess) {
+    return false;
+  }
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  status = gemm_op.initialize(arguments, workspace.get());
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  status = gemm_op.run();
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  cudaError_t result = cudaDeviceSynchronize();
+  EXPECT_EQ(result, cudaSuccess) << "Error at Kernel Sync.";
+  if (status != cutlass::Status::kSuccess || result != cudaSuccess) {
+    return false;
+  }
+
+  pool_block.copy_to_host(host_pool.data());
+  for (int b = 0; b < l; ++b) {
+    for (int s = 0; s < num_segments; ++s) {
+      for (int i = 0; i < ld; ++i) {
+        int64_t idx = b * batch_stride_pool + s * ld + i;
+        if (std::abs(host_pool[idx] - ref_pool[idx]) > 1e-5f * std::abs(ref_pool[idx])) {
+          std::cout << "Pooled mismatch at (" << i << ", " << s << ", " << b << "): "
+                    << host_pool[idx] << " vs " << ref_pool[idx] << std::endl;
+          return false;
+        }
+      }
+    }
+  }
+
+  // The segment indices are required when the pooled tensor is set
+  typename Gemm::Arguments no_index = arguments;
+  no_index.epilogue.thread.op_1.ptr_segment_index = nullptr;
+  EXPECT_NE(gemm_op.can_implement(no_index), cutlass::Status::kSuccess);
+
+  // Pooled segments must not overlap
+  typename Gemm::Arguments overlapping = arguments;
+  overlapping.epilogue.thread.op_1.ld_pool = m - 1;
+  EXPECT_NE(gemm_op.can_implement(overlapping), cutlass::Status::kSuccess);
+
+  return true;
+}
+
+static bool run_segment_sum_store_test(int m, int n, int k, int l, int num_segments, int64_t ld_pool, bool use_weights) {
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::ColumnMajor;
+  using LayoutC = cutlass::layout::ColumnMajor;
+  using TileShape_MNK = Shape<_128,_128,_64>;
+  using ClusterShape_MNK = Shape<_1,_2,_1>;
+
+  using namespace cutlass::epilogue::fusion;
+
+  constexpr auto RoundStyle = cutlass::FloatRoundStyle::round_to_nearest;
+
+  using ScaledAcc = Sm90EVT<Sm90Compute<cutlass::multiplies, float, float, RoundStyle>, // alpha * acc
+                      Sm90ScalarBroadcast<float>,                                     // alpha
+                      Sm90AccFetch                                                    // acc
+                    >;
+  using FusionCallbacks = Sm90EVT<Sm90SegmentSumStore<float, RoundStyle>, ScaledAcc>;
+
+  // The unpooled output is never stored
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      void, LayoutC, 8,
+      void, LayoutC, 8,
+      cutlass::epilogue::TmaWarpSpecializedCooperative,
+      FusionCallbacks
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, LayoutA, 8,
+      cutlass::half_t, LayoutB, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::gemm::KernelTmaWarpSpecializedCooperative
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue>;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+  return testSegmentSumStore<Gemm>(m, n, k, l, num_segments, ld_pool, use_weights);
+}
+
+} // namespace test::gemm::device
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32n_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_1x2x1_SegmentSumStore) {
+  using namespace test::gemm::device;
+  // Bags of about 8 columns spread over all output tiles
+  EXPECT_TRUE(run_segment_sum_store_test(/*m=*/256, /*n=*/512, /*k=*/128, /*l=*/1, /*num_segments=*/64, /*ld_pool=*/0, /*use_weights=*/false));
+  // Per-sample weights, tile residues in M and N, and padded segments
+  EXPECT_TRUE(run_segment_sum_store_test(/*m=*/200, /*n=*/328, /*k=*/64, /*l=*/1, /*num_segments=*/37, /*ld_pool=*/208, /*use_weights=*/true));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32n_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_1x2x1_SegmentSumStoreBatched) {
+  using namespace test::gemm::device;
+  // Each batch indexes its own columns and pools into its own segments
+  EXPECT_TRUE(run_segment_sum_store_test(/*m=*/128, /*n=*/264, /*k=*/128, /*l=*/2, /*num_segments=*/16, /*ld_pool=*/0, /*use_weights=*/true));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
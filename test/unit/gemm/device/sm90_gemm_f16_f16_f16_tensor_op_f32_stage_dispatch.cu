@@ -0,0 +1,119 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the run-time stage count dispatch of device-wide GEMMs
+*/
+
+#include <iostream>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/device/gemm_stage_dispatch.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x.hpp"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+namespace {
+
+using TileShape_MNK = Shape<_128,_128,_64>;
+using ClusterShape_MNK = Shape<_1,_1,_1>;
+
+using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+    cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+    TileShape_MNK, ClusterShape_MNK,
+    cutlass::epilogue::collective::EpilogueTileAuto,
+    float, float,
+    cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+    cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+    cutlass::epilogue::TmaWarpSpecializedCooperative
+  >::CollectiveOp;
+
+template <int Stages>
+using GemmKernelForStages = cutlass::gemm::kernel::GemmUniversal<
+    Shape<int,int,int,int>,
+    typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCount<Stages>,
+      cutlass::gemm::KernelTmaWarpSpecializedCooperative
+    >::CollectiveOp,
+    CollectiveEpilogue
+>;
+
+using GemmDispatch = cutlass::gemm::device::GemmStageDispatchOver<GemmKernelForStages, 4, 2, 3>;
+
+typename GemmDispatch::Arguments make_arguments(int m, int n, int k) {
+  typename GemmDispatch::Arguments args{};
+  args.mode = cutlass::gemm::GemmUniversalMode::kGemm;
+  args.problem_shape = {m, n, k, 1};
+  return args;
+}
+
+} // namespace
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32n_tensor_op_gmma_f32_cooperative_stage_dispatch, select) {
+  static_assert(GemmDispatch::NumVariants == 3);
+  EXPECT_EQ(GemmDispatch::kStages[0], 4);
+
+  // One K tile: the shallowest pipeline
+  EXPECT_EQ(GemmDispatch::k_tile_count(make_arguments(256, 256, 64)), 1);
+  EXPECT_EQ(GemmDispatch::kStages[GemmDispatch::select(make_arguments(256, 256, 64))], 2);
+
+  // Three K tiles: the shallowest pipeline holding all of them
+  EXPECT_EQ(GemmDispatch::kStages[GemmDispatch::select(make_arguments(256, 256, 160))], 3);
+
+  // Long K: the deepest pipeline
+  EXPECT_EQ(GemmDispatch::kStages[GemmDispatch::select(make_arguments(256, 256, 4096))], 4);
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32n_tensor_op_gmma_f32_cooperative_stage_dispatch, variants) {
+  // Each instantiation is a regular kernel behind its own GemmUniversalAdapter
+  EXPECT_TRUE(test::gemm::device::TestAll<GemmDispatch::Variant<0>>(1.0, 0.0));
+  EXPECT_TRUE(test::gemm::device::TestAll<GemmDispatch::Variant<1>>(1.0, 1.0));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
@@ -0,0 +1,245 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for Sm90 f16_f16_f16 GEMMs with the Top-K softmax router epilogue, which also writes
+    the Top-K column indices of each row and the number of rows routed to each column
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+namespace test::gemm::device {
+
+// Logits of row m, covering distinct, tied, and all-negative rows
+inline float topk_router_logit(int m, int n) {
+  switch (m % 5) {
+    case 0:  return float((m * 37 + n * 101) % 61 - 30) / 8.0f;   // mixed signs, occasional ties
+    case 1:  return 1.5f;                                           // all tied
+    case 2:  return -1.0f - 0.25f * float((n * 7) % 5);             // all negative, many ties
+    case 3:  return -2.0f;                                          // all negative and tied
+    default: return -0.5f * float((m + n) % 3) - 0.125f * float(n % 2); // all negative, ties across columns
+  }
+}
+
+// The identity B makes D = softmax(top_k(A)), so that the logits are exactly those written to A.
+// Checks D, the Top-K indices (ties broken towards lower columns) and the per-column counts
+// against a host reference.
+template <class Gemm, int TopK>
+bool testTopKSoftmaxRouter(int m, int n) {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+  using ElementD = typename Gemm::ElementD;
+
+  int k = n;
+
+  std::vector<ElementA> host_A(m * k);
+  std::vector<ElementB> host_B(k * n, ElementB(0));
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < k; ++j) {
+      host_A[i * k + j] = ElementA(topk_router_logit(i, j));
+    }
+  }
+  for (int j = 0; j < n; ++j) {
+    host_B[j * k + j] = ElementB(1);
+  }
+
+  // Host reference
+  std::vector<float> ref_D(m * n, 0.0f);
+  std::vector<int32_t> ref_indices(m * TopK);
+  std::vector<int32_t> ref_counts(n, 0);
+  for (int i = 0; i < m; ++i) {
+    std::vector<int> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+      return float(host_A[i * k + a]) > float(host_A[i * k + b]);
+    });
+    float max_value = float(host_A[i * k + order[0]]);
+    float sum = 0.0f;
+    for (int t = 0; t < TopK; ++t) {
+      sum += std::exp(float(host_A[i * k + order[t]]) - max_value);
+    }
+    for (int t = 0; t < TopK; ++t) {
+      int col = order[t];
+      ref_D[i * n + col] = std::exp(float(host_A[i * k + col]) - max_value) / sum;
+      ref_indices[i * TopK + t] = col;
+      ref_counts[col] += 1;
+    }
+  }
+
+  cutlass::DeviceAllocation<ElementA> A_block(host_A.size());
+  cutlass::DeviceAllocation<ElementB> B_block(host_B.size());
+  cutlass::DeviceAllocation<ElementD> D_block(m * n);
+  cutlass::DeviceAllocation<int32_t> indices_block(m * TopK);
+  cutlass::DeviceAllocation<int32_t> counts_block(n);
+  A_block.copy_from_host(host_A.data());
+  B_block.copy_from_host(host_B.data());
+  cudaMemset(indices_block.get(), 0xff, indices_block.bytes());
+  cudaMemset(counts_block.get(), 0, counts_block.bytes());
+
+  auto stride_A = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, {m, k, 1});
+  auto stride_B = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, {n, k, 1});
+  auto stride_C = cutlass::make_cute_packed_stride(typename GemmKernel::StrideC{}, {m, n, 1});
+  auto stride_D = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, {m, n, 1});
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {m, n, k, 1},
+    {A_block.get(), stride_A, B_block.get(), stride_B},
+    {{}, nullptr, stride_C, D_block.get(), stride_D}
+  };
+  arguments.epilogue.thread.alpha = 1.0f;
+  arguments.epilogue.thread.beta = 0.0f;
+  arguments.epilogue.thread.topk_indices_ptr = indices_block.get();
+  arguments.epilogue.thread.expert_counts_ptr = counts_block.get();
+
+  Gemm gemm_op;
+  cutlass::Status status = gemm_op.can_implement(arguments);
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  if (status != cutlass::Status::kSuccess) {
+    return false;
+  }
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  status = gemm_op.initialize(arguments, workspace.get());
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  status = gemm_op.run();
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  cudaError_t result = cudaDeviceSynchronize();
+  EXPECT_EQ(result, cudaSuccess) << "Error at Kernel Sync.";
+  if (status != cutlass::Status::kSuccess || result != cudaSuccess) {
+    return false;
+  }
+
+  std::vector<ElementD> host_D(m * n);
+  std::vector<int32_t> host_indices(m * TopK);
+  std::vector<int32_t> host_counts(n);
+  D_block.copy_to_host(host_D.data());
+  indices_block.copy_to_host(host_indices.data());
+  counts_block.copy_to_host(host_counts.data());
+
+  for (int i = 0; i < m * TopK; ++i) {
+    if (host_indices[i] != ref_indices[i]) {
+      std::cout << "Top-K index mismatch at row " << i / TopK << ", k = " << i % TopK << ": "
+                << host_indices[i] << " vs " << ref_indices[i] << std::endl;
+      return false;
+    }
+  }
+  for (int j = 0; j < n; ++j) {
+    if (host_counts[j] != ref_counts[j]) {
+      std::cout << "Count mismatch at column " << j << ": "
+                << host_counts[j] << " vs " << ref_counts[j] << std::endl;
+      return false;
+    }
+  }
+  // The softmax is computed from the index-packed logits, which are perturbed in their low mantissa bits
+  for (int i = 0; i < m * n; ++i) {
+    if (std::abs(float(host_D[i]) - ref_D[i]) > 2e-3f) {
+      std::cout << "D mismatch at (" << i / n << ", " << i % n << "): "
+                << float(host_D[i]) << " vs " << ref_D[i] << std::endl;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template <int TopK>
+static bool run_topk_softmax_router_test(int m, int n) {
+  using TileShape_MNK = Shape<_64,_64,_64>;
+  using ClusterShape_MNK = Shape<_1,_1,_1>;
+
+  using FusionOperation = cutlass::epilogue::fusion::LinCombTopKSoftmaxColRouter<TopK, cutlass::half_t, float>;
+
+  // The fusion only supports epilogue tiles matching the CTA tile
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      decltype(cute::take<0,2>(TileShape_MNK{})),
+      float, float,
+      void, cutlass::layout::RowMajor, 1,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::epilogue::TmaWarpSpecialized,
+      FusionOperation
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::gemm::KernelTmaWarpSpecialized
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue>;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+  return testTopKSoftmaxRouter<Gemm, TopK>(m, n);
+}
+
+} // namespace test::gemm::device
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_topk_softmax_router, 64x64x64_TopK1) {
+  EXPECT_TRUE(test::gemm::device::run_topk_softmax_router_test<1>(/*m=*/200, /*n=*/64));
+  EXPECT_TRUE(test::gemm::device::run_topk_softmax_router_test<1>(/*m=*/77, /*n=*/40));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_topk_softmax_router, 64x64x64_TopK8) {
+  EXPECT_TRUE(test::gemm::device::run_topk_softmax_router_test<8>(/*m=*/200, /*n=*/64));
+  EXPECT_TRUE(test::gemm::device::run_topk_softmax_router_test<8>(/*m=*/77, /*n=*/40));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
@@ -0,0 +1,240 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests that Sm90 stream-K and split-K GEMMs using ReductionMode::DeterministicTree produce
+    bitwise-identical output across repeated launches
+*/
+
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+namespace test::gemm::device {
+
+// Launches the GEMM several times with the same arguments and workspace. With the tree reduction,
+// partials are summed in an order that depends only on the decomposition, so every launch must
+// write the same bits to D even though peers arrive in a different order each time. The operands
+// are not integers, so a change in the order of accumulation would show in the low bits of D.
+template <class Gemm>
+bool testSm90DeterministicTree(
+    int m, int n, int k,
+    cutlass::gemm::kernel::detail::DecompositionMode decomposition_mode,
+    int splits = 1) {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+  using ElementC = typename Gemm::ElementC;
+  using ElementD = typename Gemm::ElementD;
+
+  constexpr float alpha = 1.25f;
+  constexpr float beta = -0.5f;
+  constexpr int launches = 8;
+
+  std::vector<ElementA> host_A(m * k);
+  std::vector<ElementB> host_B(n * k);
+  std::vector<ElementC> host_C(m * n);
+  for (int i = 0; i < m * k; ++i) {
+    host_A[i] = ElementA(float((i * 7919) % 1021) / 1021.0f - 0.5f);
+  }
+  for (int i = 0; i < n * k; ++i) {
+    host_B[i] = ElementB(float((i * 104729) % 1031) / 1031.0f - 0.5f);
+  }
+  for (int i = 0; i < m * n; ++i) {
+    host_C[i] = ElementC(float((i * 5) % 7 - 3));
+  }
+
+  cutlass::DeviceAllocation<ElementA> A_block(host_A.size());
+  cutlass::DeviceAllocation<ElementB> B_block(host_B.size());
+  cutlass::DeviceAllocation<ElementC> C_block(host_C.size());
+  cutlass::DeviceAllocation<ElementD> D_block(static_cast<size_t>(m) * n);
+  A_block.copy_from_host(host_A.data());
+  B_block.copy_from_host(host_B.data());
+  C_block.copy_from_host(host_C.data());
+
+  auto stride_A = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, {m, k, 1});
+  auto stride_B = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, {n, k, 1});
+  auto stride_C = cutlass::make_cute_packed_stride(typename GemmKernel::StrideC{}, {m, n, 1});
+  auto stride_D = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, {m, n, 1});
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = 0;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {m, n, k, 1},
+    {A_block.get(), stride_A, B_block.get(), stride_B},
+    {{alpha, beta}, C_block.get(), stride_C, D_block.get(), stride_D},
+    hw_info
+  };
+  arguments.scheduler.splits = splits;
+  arguments.scheduler.decomposition_mode = decomposition_mode;
+  arguments.scheduler.reduction_mode = cutlass::gemm::kernel::detail::ReductionMode::DeterministicTree;
+
+  Gemm gemm_op;
+  cutlass::Status status = gemm_op.can_implement(arguments);
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  if (status != cutlass::Status::kSuccess) {
+    return false;
+  }
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  status = gemm_op.initialize(arguments, workspace.get());
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  if (status != cutlass::Status::kSuccess) {
+    return false;
+  }
+
+  // The kernel resets its reduction locks before exiting, so the workspace is reused as is
+  std::vector<ElementD> first_D(static_cast<size_t>(m) * n);
+  std::vector<ElementD> host_D(static_cast<size_t>(m) * n);
+  for (int launch = 0; launch < launches; ++launch) {
+    cudaMemset(D_block.get(), 0, D_block.bytes());
+    status = gemm_op.run();
+    EXPECT_EQ(status, cutlass::Status::kSuccess);
+    cudaError_t result = cudaDeviceSynchronize();
+    EXPECT_EQ(result, cudaSuccess) << "Error at Kernel Sync.";
+    if (status != cutlass::Status::kSuccess || result != cudaSuccess) {
+      return false;
+    }
+
+    D_block.copy_to_host(launch == 0 ? first_D.data() : host_D.data());
+    if (launch > 0 && std::memcmp(first_D.data(), host_D.data(), host_D.size() * sizeof(ElementD))) {
+      for (size_t i = 0; i < host_D.size(); ++i) {
+        if (std::memcmp(&first_D[i], &host_D[i], sizeof(ElementD))) {
+          std::cout << "Launch " << launch << " differs from the first launch at (" << i / n << ", " << i % n << "): "
+                    << float(host_D[i]) << " vs " << float(first_D[i]) << std::endl;
+          break;
+        }
+      }
+      return false;
+    }
+  }
+
+  // Reproducible results must also be correct. A is row-major, B column-major, C and D row-major.
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < n; ++j) {
+      double acc = 0.0;
+      for (int kk = 0; kk < k; ++kk) {
+        acc += double(host_A[i * k + kk]) * double(host_B[j * k + kk]);
+      }
+      double ref = double(alpha) * acc + double(beta) * double(host_C[i * n + j]);
+      double got = double(first_D[i * n + j]);
+      if (std::abs(got - ref) > 1e-3 * (1.0 + std::abs(ref))) {
+        std::cout << "D mismatch at (" << i << ", " << j << "): " << got << " vs " << ref << std::endl;
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+template <class TileShape_MNK, class ClusterShape_MNK>
+static bool run_sm90_deterministic_tree_test(
+    int m, int n, int k,
+    cutlass::gemm::kernel::detail::DecompositionMode decomposition_mode,
+    int splits = 1) {
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      float, cutlass::layout::RowMajor, 4,
+      float, cutlass::layout::RowMajor, 4,
+      cutlass::epilogue::TmaWarpSpecializedCooperative
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::gemm::KernelTmaWarpSpecializedCooperative
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue,
+      cutlass::gemm::StreamKScheduler>;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+  return testSm90DeterministicTree<Gemm>(m, n, k, decomposition_mode, splits);
+}
+
+} // namespace test::gemm::device
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_cooperative_stream_k, 128x128x64_1x1x1_deterministic_tree) {
+  using namespace test::gemm::device;
+  using DecompositionMode = cutlass::gemm::kernel::detail::DecompositionMode;
+  // Few output tiles and a long K, so that many peers collaborate on each output tile
+  EXPECT_TRUE((run_sm90_deterministic_tree_test<Shape<_128,_128,_64>, Shape<_1,_1,_1>>(
+                 /*m=*/256, /*n=*/256, /*k=*/8192, DecompositionMode::StreamK)));
+  // Partial tiles in M, N and K
+  EXPECT_TRUE((run_sm90_deterministic_tree_test<Shape<_128,_128,_64>, Shape<_1,_1,_1>>(
+                 /*m=*/200, /*n=*/136, /*k=*/4040, DecompositionMode::StreamK)));
+  EXPECT_TRUE((run_sm90_deterministic_tree_test<Shape<_128,_128,_64>, Shape<_1,_1,_1>>(
+                 /*m=*/256, /*n=*/384, /*k=*/2048, DecompositionMode::SplitK, /*splits=*/5)));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_cooperative_stream_k, 128x128x64_2x1x1_deterministic_tree) {
+  using namespace test::gemm::device;
+  using DecompositionMode = cutlass::gemm::kernel::detail::DecompositionMode;
+  EXPECT_TRUE((run_sm90_deterministic_tree_test<Shape<_128,_128,_64>, Shape<_2,_1,_1>>(
+                 /*m=*/512, /*n=*/256, /*k=*/8192, DecompositionMode::StreamK)));
+  EXPECT_TRUE((run_sm90_deterministic_tree_test<Shape<_128,_128,_64>, Shape<_2,_1,_1>>(
+                 /*m=*/256, /*n=*/256, /*k=*/4096, DecompositionMode::SplitK, /*splits=*/3)));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
@@ -0,0 +1,236 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for Sm90 f16_f16_f8 GEMMs with the per-row amax + quantization epilogue
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+namespace test::gemm::device {
+
+// Checks D, the scale factors of each EPI_N block of a row and the full row amax against a host
+// reference. Small integer inputs keep the accumulators exact.
+template <class Gemm, int EpiN>
+bool testPerRowQuantAmax(int m, int n, int k) {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+  using ElementD = typename Gemm::ElementD;
+
+  int n_blocks = (n + EpiN - 1) / EpiN;
+
+  std::vector<ElementA> host_A(m * k);
+  std::vector<ElementB> host_B(k * n);
+  for (int i = 0; i < m * k; ++i) {
+    host_A[i] = ElementA(float((i * 7) % 9 - 4));
+  }
+  for (int i = 0; i < k * n; ++i) {
+    host_B[i] = ElementB(float((i * 5) % 7 - 3));
+  }
+  // Row 1 is all zeros, which must keep a unit scale
+  for (int j = 0; j < k && m > 1; ++j) {
+    host_A[k + j] = ElementA(0);
+  }
+
+  // Host reference, A is row-major and B column-major
+  float const max_output = float(cutlass::platform::numeric_limits<ElementD>::max());
+  std::vector<float> Z(m * n);
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < n; ++j) {
+      float acc = 0.0f;
+      for (int kk = 0; kk < k; ++kk) {
+        acc += float(host_A[i * k + kk]) * float(host_B[j * k + kk]);
+      }
+      Z[i * n + j] = acc;
+    }
+  }
+  std::vector<float> ref_scale(m * n_blocks);
+  std::vector<float> ref_row_amax(m, 0.0f);
+  for (int i = 0; i < m; ++i) {
+    for (int b = 0; b < n_blocks; ++b) {
+      float amax = 0.0f;
+      for (int j = b * EpiN; j < std::min(n, (b + 1) * EpiN); ++j) {
+        amax = std::max(amax, std::abs(Z[i * n + j]));
+      }
+      ref_scale[b * m + i] = amax > 0.0f ? amax / max_output : 1.0f;
+      ref_row_amax[i] = std::max(ref_row_amax[i], amax);
+    }
+  }
+
+  cutlass::DeviceAllocation<ElementA> A_block(host_A.size());
+  cutlass::DeviceAllocation<ElementB> B_block(host_B.size());
+  cutlass::DeviceAllocation<ElementD> D_block(m * n);
+  cutlass::DeviceAllocation<float> scale_block(m * n_blocks);
+  cutlass::DeviceAllocation<float> row_amax_block(m);
+  A_block.copy_from_host(host_A.data());
+  B_block.copy_from_host(host_B.data());
+  // Stale values must be overwritten
+  cudaMemset(row_amax_block.get(), 0x7f, row_amax_block.bytes());
+
+  auto stride_A = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, {m, k, 1});
+  auto stride_B = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, {n, k, 1});
+  auto stride_C = cutlass::make_cute_packed_stride(typename GemmKernel::StrideC{}, {m, n, 1});
+  auto stride_D = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, {m, n, 1});
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {m, n, k, 1},
+    {A_block.get(), stride_A, B_block.get(), stride_B},
+    {{}, nullptr, stride_C, D_block.get(), stride_D}
+  };
+  auto& fusion_args = arguments.epilogue.thread;
+  fusion_args.alpha = 1.0f;
+  fusion_args.beta = 0.0f;
+  fusion_args.scale_factor_ptr = scale_block.get();
+  fusion_args.dScaleFactor = {_1{}, int64_t(m), int64_t(m) * n_blocks};
+  fusion_args.amax_row_ptr = row_amax_block.get();
+  fusion_args.dAmaxRow = {_1{}, _0{}, int64_t(m)};
+
+  Gemm gemm_op;
+  cutlass::Status status = gemm_op.can_implement(arguments);
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  if (status != cutlass::Status::kSuccess) {
+    return false;
+  }
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  status = gemm_op.initialize(arguments, workspace.get());
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  status = gemm_op.run();
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  cudaError_t result = cudaDeviceSynchronize();
+  EXPECT_EQ(result, cudaSuccess) << "Error at Kernel Sync.";
+  if (status != cutlass::Status::kSuccess || result != cudaSuccess) {
+    return false;
+  }
+
+  std::vector<ElementD> host_D(m * n);
+  std::vector<float> host_scale(m * n_blocks);
+  std::vector<float> host_row_amax(m);
+  D_block.copy_to_host(host_D.data());
+  scale_block.copy_to_host(host_scale.data());
+  row_amax_block.copy_to_host(host_row_amax.data());
+
+  for (int i = 0; i < m; ++i) {
+    if (host_row_amax[i] != ref_row_amax[i]) {
+      std::cout << "Row amax mismatch at row " << i << ": " << host_row_amax[i] << " vs " << ref_row_amax[i] << std::endl;
+      return false;
+    }
+    for (int b = 0; b < n_blocks; ++b) {
+      float scale = host_scale[b * m + i];
+      if (std::abs(scale - ref_scale[b * m + i]) > 1e-6f * ref_scale[b * m + i]) {
+        std::cout << "Scale mismatch at (" << i << ", " << b << "): " << scale << " vs " << ref_scale[b * m + i] << std::endl;
+        return false;
+      }
+    }
+    for (int j = 0; j < n; ++j) {
+      // D is within one ULP of the quantized value, and dequantizes back to Z
+      float expected = Z[i * n + j] / ref_scale[(j / EpiN) * m + i];
+      float actual = float(host_D[i * n + j]);
+      if (std::abs(actual) > max_output || std::abs(actual - expected) > 0.125f * std::abs(expected)) {
+        std::cout << "D mismatch at (" << i << ", " << j << "): " << actual << " vs " << expected << std::endl;
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+template <class EpilogueTile>
+static bool run_per_row_quant_amax_test(int m, int n, int k) {
+  using TileShape_MNK = Shape<_64,_128,_64>;
+  using ClusterShape_MNK = Shape<_1,_1,_1>;
+
+  using FusionOperation = cutlass::epilogue::fusion::LinCombPerRowQuantAmax<cutlass::float_e4m3_t, float, float>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      EpilogueTile,
+      float, float,
+      void, cutlass::layout::RowMajor, 16,
+      cutlass::float_e4m3_t, cutlass::layout::RowMajor, 16,
+      cutlass::epilogue::TmaWarpSpecialized,
+      FusionOperation
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::gemm::KernelTmaWarpSpecialized
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue>;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+  return testPerRowQuantAmax<Gemm, size<1>(EpilogueTile{})>(m, n, k);
+}
+
+} // namespace test::gemm::device
+
+TEST(SM90_Device_Gemm_f16t_f16n_f8t_tensor_op_gmma_f32_per_row_quant_amax, 64x128x64_epi_64x128) {
+  EXPECT_TRUE((test::gemm::device::run_per_row_quant_amax_test<Shape<_64,_128>>(/*m=*/200, /*n=*/368, /*k=*/64)));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f8t_tensor_op_gmma_f32_per_row_quant_amax, 64x128x64_epi_64x32) {
+  EXPECT_TRUE((test::gemm::device::run_per_row_quant_amax_test<Shape<_64,_32>>(/*m=*/200, /*n=*/368, /*k=*/64)));
+  EXPECT_TRUE((test::gemm::device::run_per_row_quant_amax_test<Shape<_64,_32>>(/*m=*/64, /*n=*/32, /*k=*/256)));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
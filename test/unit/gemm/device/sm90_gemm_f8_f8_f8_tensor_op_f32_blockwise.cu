@@ -76,7 +76,8 @@ template<cute::GMMA::Major SFAMajor,
 bool groupwise_test(
     Int<ScaleGranularityM>, Int<ScaleGranularityN>, Int<ScaleGranularityK>,
     LayoutA, LayoutB, LayoutCD,
-    MmaTileShape, ClusterShape) {
+    MmaTileShape, ClusterShape,
+    cute::Shape<int,int,int> scale_granularity = cute::Shape<int,int,int>{0, 0, 0}) {
 
   using ScaleConfig = cutlass::detail::Sm90BlockwiseScaleConfig<ScaleGranularityM, ScaleGranularityN, ScaleGranularityK, SFAMajor, SFBMajor>;
   using LayoutSFA             = decltype(ScaleConfig::deduce_layoutSFA());                     // Layout type for SFA matrix operand
@@ -152,8 +153,18 @@ bool groupwise_test(
   stride_C = cutlass::make_cute_packed_stride(StrideC{}, cute::make_shape(M, N, 1));
   stride_D = cutlass::make_cute_packed_stride(StrideD{}, cute::make_shape(M, N, 1));
 
-  layout_SFA = ScaleConfig::tile_atom_to_shape_SFA(make_shape(M, N, K, 1));
-  layout_SFB = ScaleConfig::tile_atom_to_shape_SFB(make_shape(M, N, K, 1));
+  // Scale factors at a run-time granularity coarser than the compile-time one of the kernel
+  bool is_runtime_granularity = get<0>(scale_granularity) > 0 || get<1>(scale_granularity) > 0 || get<2>(scale_granularity) > 0;
+  auto sf_vec_shape = cutlass::detail::resolve_blockwise_scale_granularity<
+      ScaleGranularityM, ScaleGranularityN, ScaleGranularityK>(scale_granularity);
+  if (is_runtime_granularity) {
+    layout_SFA = ScaleConfig::tile_atom_to_shape_SFA(make_shape(M, N, K, 1), sf_vec_shape);
+    layout_SFB = ScaleConfig::tile_atom_to_shape_SFB(make_shape(M, N, K, 1), sf_vec_shape);
+  }
+  else {
+    layout_SFA = ScaleConfig::tile_atom_to_shape_SFA(make_shape(M, N, K, 1));
+    layout_SFB = ScaleConfig::tile_atom_to_shape_SFB(make_shape(M, N, K, 1));
+  }
 
   thrust::universal_vector<cutlass::float_e4m3_t> tensor_A(M * K);
   thrust::universal_vector<float> tensor_SFA(cute::size(cute::filter_zeros(layout_SFA)));
@@ -188,7 +199,8 @@ bool groupwise_test(
     {thrust::raw_pointer_cast(tensor_A.data()), stride_A, 
      thrust::raw_pointer_cast(tensor_B.data()), stride_B,
      thrust::raw_pointer_cast(tensor_SFA.data()), layout_SFA,
-     thrust::raw_pointer_cast(tensor_SFB.data()), layout_SFB},
+     thrust::raw_pointer_cast(tensor_SFB.data()), layout_SFB,
+     scale_granularity},
     {
       {}, // epilogue.thread
       thrust::raw_pointer_cast(tensor_C.data()), stride_C,
@@ -218,8 +230,14 @@ bool groupwise_test(
       cute::make_layout(cute::make_shape(M, N, 1), stride_C));
   auto D = cute::make_tensor(thrust::raw_pointer_cast(tensor_ref_D.data()),
       cute::make_layout(cute::make_shape(M, N, 1), stride_D));
-  auto SFA = cute::make_tensor(thrust::raw_pointer_cast(tensor_SFA.data()), layout_SFA);
-  auto SFB = cute::make_tensor(thrust::raw_pointer_cast(tensor_SFB.data()), layout_SFB);
+  // The reference indexes the scale factors at their actual granularity
+  using ReferenceScaleConfig = cutlass::detail::RuntimeBlockwiseScaleConfig<
+      SFAMajor == cute::GMMA::Major::MN ? cute::UMMA::Major::MN : cute::UMMA::Major::K,
+      SFBMajor == cute::GMMA::Major::MN ? cute::UMMA::Major::MN : cute::UMMA::Major::K>;
+  auto SFA = cute::make_tensor(thrust::raw_pointer_cast(tensor_SFA.data()),
+      ReferenceScaleConfig::tile_atom_to_shape_SFA(make_shape(M, N, K, 1), sf_vec_shape));
+  auto SFB = cute::make_tensor(thrust::raw_pointer_cast(tensor_SFB.data()),
+      ReferenceScaleConfig::tile_atom_to_shape_SFB(make_shape(M, N, K, 1), sf_vec_shape));
 
   cutlass::reference::host::GettBlockScalingMainloopParams<
       float,
@@ -292,4 +310,47 @@ TEST(SM90_Device_Gemm_e4m3t_e4m3n_e4m3t_tensorop_f32_align16_blockwise, 128x128x
 
 }
 
+TEST(SM90_Device_Gemm_e4m3t_e4m3n_e4m3t_tensorop_f32_align16_blockwise, 128x128x128_1x1x1_1x1x128_kernel_1x128x128_runtime_scale) {
+
+  bool passed = groupwise_test<cute::GMMA::Major::MN, cute::GMMA::Major::MN>(
+      Int<1>{}, Int<1>{}, Int<128>{},
+      cutlass::layout::RowMajor{}, cutlass::layout::ColumnMajor{}, 
+      cutlass::layout::RowMajor{}, 
+      Shape<_128,_128,_128>{},
+      Shape<_1,_1,_1>{},
+      cute::Shape<int,int,int>{1, 128, 128});
+
+  EXPECT_TRUE(passed);
+
+}
+
+TEST(SM90_Device_Gemm_e4m3t_e4m3n_e4m3t_tensorop_f32_align16_blockwise, 128x128x128_1x1x1_1x1x128_kernel_128x128x256_runtime_scale) {
+
+  bool passed = groupwise_test<cute::GMMA::Major::MN, cute::GMMA::Major::K>(
+      Int<1>{}, Int<1>{}, Int<128>{},
+      cutlass::layout::RowMajor{}, cutlass::layout::ColumnMajor{}, 
+      cutlass::layout::RowMajor{}, 
+      Shape<_128,_128,_128>{},
+      Shape<_1,_1,_1>{},
+      cute::Shape<int,int,int>{128, 128, 256});
+
+  EXPECT_TRUE(passed);
+
+}
+
+TEST(SM90_Device_Gemm_e4m3t_e4m3n_e4m3t_tensorop_f32_align16_blockwise, 128x128x128_1x1x1_1x1x128_kernel_per_tensor_runtime_scale) {
+
+  // Granularities beyond the problem extents give a single scale factor per operand
+  bool passed = groupwise_test<cute::GMMA::Major::MN, cute::GMMA::Major::MN>(
+      Int<1>{}, Int<1>{}, Int<128>{},
+      cutlass::layout::RowMajor{}, cutlass::layout::ColumnMajor{}, 
+      cutlass::layout::RowMajor{}, 
+      Shape<_128,_128,_128>{},
+      Shape<_1,_1,_1>{},
+      cute::Shape<int,int,int>{1 << 20, 1 << 20, 1 << 20});
+
+  EXPECT_TRUE(passed);
+
+}
+
 #endif // #if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
@@ -31,7 +31,7 @@
 
 /*! \file
     \brief Tests for Sm90 f8_f8_bf16 with EVT epilogue
-    ScaledLinCombPerRowBiasEltAct and ScaledLinCombPerRowBiasEltActAmaxAux
+    ScaledLinCombPerRowBiasEltAct, ScaledLinCombPerRowBiasEltActAmaxAux and ScaledLinCombEltActAmaxDualLayout
 */
 
 #include <iostream>
@@ -252,4 +252,75 @@ TEST(SM90_Device_Gemm_f8t_f8n_f8t_tensor_op_gmma_f32_persistent_epilogue, 64x128
   bool passed = test::gemm::device::TestAllEVT<Gemm, HostReference>(true);
   EXPECT_TRUE(passed);
 }
+
+// Z = scale_a * scale_b * alpha * acc + scale_c * beta * C
+// if D is fp8
+//   amax_d = max(abs(elements in activation(Z)))
+//   D = scale_d * activation(Z)
+// else
+//   D = activation(Z)
+// D is also stored column-major
+TEST(SM90_Device_Gemm_f8t_f8n_f8t_tensor_op_gmma_f32_persistent_epilogue, 64x128x128_1x1x1_ScaledLinCombEltActAmaxDualLayout) {
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::ColumnMajor;
+  using LayoutC = cutlass::layout::RowMajor;
+  using LayoutTransposed = cutlass::layout::ColumnMajor;
+  using TileShape_MNK = Shape<_64,_128,_128>;
+  using ClusterShape_MNK = Shape<_1,_1,_1>;
+
+  using EpilogueSchedule = cutlass::epilogue::TmaWarpSpecialized;
+  using EpilogueTileType = cutlass::epilogue::collective::EpilogueTileAuto;
+  using EpilogueDescriptor = cutlass::epilogue::collective::detail::EpilogueDescriptor<
+    TileShape_MNK, EpilogueTileType, cutlass::float_e4m3_t, cutlass::float_e4m3_t, EpilogueSchedule>;
+  using AuxStoreDescriptor = cutlass::epilogue::collective::detail::AuxStoreDescriptor<
+    EpilogueDescriptor, LayoutTransposed, cutlass::float_e4m3_t>;
+
+  using FusionCallbacks = cutlass::epilogue::fusion::Sm90ScaledLinCombEltActAmaxDualLayout<
+    TileShape_MNK,                               // CtaTileShapeMNK
+    typename EpilogueDescriptor::EpilogueTile,   // EpilogueTile
+    EpilogueDescriptor::StagesD,                 // StagesD
+    typename AuxStoreDescriptor::Stride,         // StrideTransposed
+    typename AuxStoreDescriptor::SmemLayoutAtom, // SmemLayoutAtom
+    typename AuxStoreDescriptor::CopyOpR2S,      // CopyOpR2S
+    cutlass::epilogue::thread::ReLu,             // ActivationFn
+    cutlass::float_e4m3_t,                       // ElementOutput
+    float                                        // ElementCompute
+  >;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      EpilogueTileType,
+      float, float,
+      cutlass::float_e4m3_t, LayoutC, 16,
+      cutlass::float_e4m3_t, LayoutC, 16,
+      EpilogueSchedule,
+      FusionCallbacks
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::float_e4m3_t, LayoutA, 16,
+      cutlass::float_e4m3_t, LayoutB, 16,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::gemm::KernelTmaWarpSpecialized
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+  // Host reference
+  using HostReference = test::gemm::device::HostScaledLinCombEltActAmaxDualLayout<
+    Gemm, cutlass::epilogue::thread::ReLu, cutlass::float_e4m3_t, LayoutTransposed
+  >;
+  bool passed = test::gemm::device::TestAllEVT<Gemm, HostReference>(true);
+  EXPECT_TRUE(passed);
+}
 #endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
@@ -0,0 +1,236 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests that the dependent group scheduler only starts tiles once the tiles they read are complete.
+*/
+
+#include <algorithm>
+#include <vector>
+
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/gemm/group_array_problem_shape.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler.hpp"
+#include "cutlass/util/device_memory.h"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+using ProblemShape = Shape<int,int,int>;
+using GroupProblemShape = cutlass::gemm::GroupProblemShape<ProblemShape>;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Kernel walking the linear work indices assigned to each block as the persistent GEMM does. Before
+/// a tile "loads", it waits on the scheduler and counts the tiles of the producer group's M tile that
+/// are not yet complete; after it "stores", it marks itself complete and publishes the tile. Output
+/// tiles are laid out per group, starting at tile_offsets[group].
+template <class Scheduler>
+__global__
+void
+run_group_dependent_scheduler(
+    int* tile_done,
+    int* violations,
+    int const* tile_offsets,
+    int const* tiles_n,
+    int const* producer_group,
+    ProblemShape const* problem_shapes,
+    int tile_m,
+    typename Scheduler::Params params) {
+
+  Scheduler scheduler{params, nullptr};
+
+  uint64_t grid_size = uint64_t(gridDim.x) * uint64_t(gridDim.y);
+  uint64_t linear_idx = uint64_t(blockIdx.x) * uint64_t(gridDim.y) + uint64_t(blockIdx.y);
+  auto work_tile_info = scheduler.get_current_work_for_linear_idx(linear_idx);
+
+  while (work_tile_info.is_valid()) {
+    int group = work_tile_info.L_idx;
+    int m = work_tile_info.M_idx;
+    int n = work_tile_info.N_idx;
+    int tiles_m = (get<0>(problem_shapes[group]) + tile_m - 1) / tile_m;
+    bool is_output_tile = m < tiles_m && n < tiles_n[group];
+
+    scheduler.wait_for_input_tiles(work_tile_info);
+
+    int producer = producer_group[group];
+    if (threadIdx.x == 0 && is_output_tile && producer >= 0) {
+      for (int producer_n = 0; producer_n < tiles_n[producer]; ++producer_n) {
+        int producer_tile = tile_offsets[producer] + m * tiles_n[producer] + producer_n;
+        if (atomicAdd(tile_done + producer_tile, 0) == 0) {
+          atomicAdd(violations, 1);
+        }
+      }
+    }
+
+    if (threadIdx.x == 0 && is_output_tile) {
+      atomicExch(tile_done + tile_offsets[group] + m * tiles_n[group] + n, 1);
+    }
+    scheduler.template arrive_output_tile<32>(work_tile_info, threadIdx.x);
+
+    linear_idx += grid_size;
+    work_tile_info = scheduler.get_current_work_for_linear_idx(linear_idx);
+  }
+}
+
+/// Host-side wrapper for launching the kernel to test the scheduler. Returns false on failure.
+template <class TileShape>
+bool
+test_group_dependent_scheduler(
+  std::vector<ProblemShape> const& problem_shapes,
+  std::vector<int> const& producer_groups,
+  TileShape tile_shape,
+  int sm_count) {
+
+  using ClusterShape = Shape<_1,_1,_1>;
+  using Scheduler = typename cutlass::gemm::kernel::detail::TileSchedulerSelector<
+    cutlass::gemm::DependentGroupScheduler, cutlass::arch::Sm90, TileShape, ClusterShape, 8, GroupProblemShape>::Scheduler;
+
+  int groups = static_cast<int>(problem_shapes.size());
+  cutlass::DeviceAllocation<ProblemShape> device_problem_shapes(groups);
+  device_problem_shapes.copy_from_host(problem_shapes.data());
+  cutlass::DeviceAllocation<int> producer_group(groups);
+  producer_group.copy_from_host(producer_groups.data());
+
+  GroupProblemShape group_problem_shape{groups, device_problem_shapes.get(), problem_shapes.data()};
+  cutlass::KernelHardwareInfo hw_info{0, sm_count};
+
+  std::vector<int> host_tiles_n(groups);
+  std::vector<int> host_tile_offsets(groups + 1, 0);
+  int max_tiles_m = 0;
+  for (int group = 0; group < groups; ++group) {
+    int tiles_m = static_cast<int>(cute::ceil_div(get<0>(problem_shapes[group]), size<0>(tile_shape)));
+    host_tiles_n[group] = static_cast<int>(cute::ceil_div(get<1>(problem_shapes[group]), size<1>(tile_shape)));
+    host_tile_offsets[group + 1] = host_tile_offsets[group] + tiles_m * host_tiles_n[group];
+    max_tiles_m = std::max(max_tiles_m, tiles_m);
+  }
+  int total_tiles = host_tile_offsets[groups];
+
+  typename Scheduler::Arguments args;
+  args.ptr_producer_group = producer_group.get();
+  args.max_groups = groups;
+  args.max_tiles_m = max_tiles_m;
+
+  if (!Scheduler::can_implement(args, hw_info)) {
+    std::cout << "can_implement() failed" << std::endl;
+    return false;
+  }
+
+  size_t workspace_size = Scheduler::template get_workspace_size<ProblemShape, float>(
+    args, ProblemShape{}, hw_info, /*mma_warp_groups=*/2);
+  cutlass::DeviceAllocation<uint8_t> workspace(workspace_size);
+  cutlass::Status status = Scheduler::template initialize_workspace<ProblemShape, float>(
+    args, workspace.get(), nullptr, ProblemShape{}, hw_info, /*mma_warp_groups=*/2);
+  if (status != cutlass::Status::kSuccess) {
+    std::cout << "initialize_workspace() failed with status " << cutlassGetStatusString(status) << std::endl;
+    return false;
+  }
+
+  auto params = Scheduler::to_underlying_arguments(group_problem_shape, tile_shape, ClusterShape{}, hw_info, args, workspace.get());
+  dim3 grid = Scheduler::get_grid_shape(params, group_problem_shape, tile_shape, ClusterShape{}, hw_info, args);
+
+  cutlass::DeviceAllocation<int> tile_done(total_tiles);
+  cutlass::DeviceAllocation<int> violations(1);
+  cutlass::DeviceAllocation<int> tile_offsets(groups + 1);
+  cutlass::DeviceAllocation<int> tiles_n(groups);
+  tile_offsets.copy_from_host(host_tile_offsets.data());
+  tiles_n.copy_from_host(host_tiles_n.data());
+
+  cudaError_t err = cudaMemset((void*)tile_done.get(), 0, sizeof(int) * total_tiles);
+  if (err == cudaSuccess) {
+    err = cudaMemset((void*)violations.get(), 0, sizeof(int));
+  }
+  if (err != cudaSuccess) {
+    std::cout << __FILE__ << ":" << __LINE__ << " cudaMemset failed with error: " << cudaGetErrorString(err) << std::endl;
+    return false;
+  }
+
+  run_group_dependent_scheduler<Scheduler><<<grid, 32>>>(
+    tile_done.get(), violations.get(), tile_offsets.get(), tiles_n.get(), producer_group.get(),
+    device_problem_shapes.get(), size<0>(tile_shape), params);
+
+  err = cudaDeviceSynchronize();
+  if (err != cudaSuccess) {
+    std::cout << __FILE__ << ":" << __LINE__
+              << " scheduler kernel failed with error: "
+              << cudaGetErrorString(err) << std::endl;
+    return false;
+  }
+
+  // Every output tile must be computed, and none before the tiles it reads
+  std::vector<int> host_tile_done(total_tiles);
+  int host_violations = 0;
+  tile_done.copy_to_host(host_tile_done.data());
+  violations.copy_to_host(&host_violations);
+
+  for (int tile = 0; tile < total_tiles; ++tile) {
+    if (host_tile_done[tile] != 1) {
+      std::cout << "Tile " << tile << " was not computed" << std::endl;
+      return false;
+    }
+  }
+  if (host_violations != 0) {
+    std::cout << host_violations << " tiles started before the tiles they read were complete" << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_group_scheduler_dependent, decode_layer_chain) {
+  using TileShape = Shape<_64,_128,_64>;
+
+  // QKV, output projection, gate/up and down projections of a decoder layer at a batch of 16 tokens,
+  // each reading the output of the previous GEMM
+  std::vector<ProblemShape> problem_shapes = {{16, 6144, 4096}, {16, 4096, 4096}, {16, 28672, 4096}, {16, 4096, 14336}};
+  std::vector<int> producer_groups = {-1, 0, 1, 2};
+
+  EXPECT_TRUE(test_group_dependent_scheduler(problem_shapes, producer_groups, TileShape{}, /*sm_count=*/132));
+  EXPECT_TRUE(test_group_dependent_scheduler(problem_shapes, producer_groups, TileShape{}, /*sm_count=*/ 16));
+}
+
+TEST(SM90_Device_Gemm_group_scheduler_dependent, multiple_m_tiles) {
+  using TileShape = Shape<_128,_128,_64>;
+
+  // A fan-out of two groups reading group 0 and an independent group, with several M tiles each
+  std::vector<ProblemShape> problem_shapes = {{520, 1024, 512}, {520, 384, 1024}, {300, 256, 256}, {520, 640, 1024}};
+  std::vector<int> producer_groups = {-1, 0, -1, 0};
+
+  EXPECT_TRUE(test_group_dependent_scheduler(problem_shapes, producer_groups, TileShape{}, /*sm_count=*/132));
+  EXPECT_TRUE(test_group_dependent_scheduler(problem_shapes, producer_groups, TileShape{}, /*sm_count=*/  4));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
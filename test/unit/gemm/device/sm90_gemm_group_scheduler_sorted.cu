@@ -0,0 +1,272 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests that the size-sorted group scheduler covers every group and visits the largest groups first.
+*/
+
+#include <algorithm>
+#include <numeric>
+
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/gemm/group_array_problem_shape.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler.hpp"
+#include "cutlass/util/device_memory.h"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+using ProblemShape = Shape<int,int,int>;
+using GroupProblemShape = cutlass::gemm::GroupProblemShape<ProblemShape>;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Kernel for walking the linear work indices assigned to each block and logging the output tiles
+/// visited by the block. Tile counters are laid out per group, starting at tile_offsets[group].
+template <class Scheduler>
+__global__
+void
+run_sorted_group_scheduler(
+    int* visit_counters,
+    int const* tile_offsets,
+    int const* tiles_n,
+    int* first_groups,
+    typename Scheduler::Params params) {
+
+  Scheduler scheduler{params, nullptr};
+
+  uint64_t grid_size = uint64_t(gridDim.x) * uint64_t(gridDim.y);
+  uint64_t linear_idx = uint64_t(blockIdx.x) * uint64_t(gridDim.y) + uint64_t(blockIdx.y);
+  auto work_tile_info = scheduler.get_current_work_for_linear_idx(linear_idx);
+
+  if (threadIdx.x == 0) {
+    first_groups[linear_idx] = work_tile_info.is_valid() ? work_tile_info.L_idx : -1;
+  }
+
+  while (work_tile_info.is_valid()) {
+    int group = work_tile_info.L_idx;
+    int m = work_tile_info.M_idx;
+    int n = work_tile_info.N_idx;
+    int tiles_in_group = tile_offsets[group + 1] - tile_offsets[group];
+
+    // Tiles beyond the problem, introduced by rounding up to the swizzle size, are skipped by kernels
+    if (threadIdx.x == 0 && n < tiles_n[group] && m * tiles_n[group] + n < tiles_in_group) {
+      atomicAdd(visit_counters + tile_offsets[group] + m * tiles_n[group] + n, 1);
+    }
+
+    linear_idx += grid_size;
+    work_tile_info = scheduler.get_current_work_for_linear_idx(linear_idx);
+  }
+}
+
+/// Host-side wrapper for sorting the groups and launching the kernel to test the scheduler.
+template <class TileShape>
+bool
+test_sorted_group_scheduler(
+  std::vector<ProblemShape> const& problem_shapes,
+  TileShape tile_shape,
+  int sm_count,
+  int max_swizzle_size = 1,
+  int active_groups = -1) {
+
+  using ClusterShape = Shape<_1,_1,_1>;
+  using Scheduler = typename cutlass::gemm::kernel::detail::TileSchedulerSelector<
+    cutlass::gemm::SortedGroupScheduler, cutlass::arch::Sm90, TileShape, ClusterShape, 8, GroupProblemShape>::Scheduler;
+
+  int groups = static_cast<int>(problem_shapes.size());
+  cutlass::DeviceAllocation<ProblemShape> device_problem_shapes(groups);
+  device_problem_shapes.copy_from_host(problem_shapes.data());
+
+  // Problem sizes are only visible to the device, as they would be when produced by a router kernel.
+  // When requested, the group count is device-resident as well and groups acts as an upper bound.
+  cutlass::DeviceAllocation<int32_t> device_group_count(1);
+  GroupProblemShape group_problem_shape{groups, device_problem_shapes.get(), nullptr};
+  if (active_groups >= 0) {
+    device_group_count.copy_from_host(&active_groups);
+    group_problem_shape.device_num_groups = device_group_count.get();
+  }
+  else {
+    active_groups = groups;
+  }
+  cutlass::KernelHardwareInfo hw_info{0, sm_count};
+
+  cutlass::DeviceAllocation<int32_t> group_order(Scheduler::get_group_order_size(groups));
+  cutlass::DeviceAllocation<uint64_t> group_tile_offsets(Scheduler::get_group_tile_offsets_size(groups));
+
+  typename Scheduler::Arguments args;
+  args.max_swizzle_size = max_swizzle_size;
+  args.group_order = group_order.get();
+  args.group_tile_offsets = group_tile_offsets.get();
+
+  if (!Scheduler::can_implement(args, hw_info)) {
+    std::cout << "can_implement() failed" << std::endl;
+    return false;
+  }
+
+  cutlass::Status status = Scheduler::sort_groups(
+    group_problem_shape, tile_shape, ClusterShape{}, hw_info, args, group_order.get(), group_tile_offsets.get());
+  if (status != cutlass::Status::kSuccess) {
+    std::cout << "sort_groups() failed with status " << cutlassGetStatusString(status) << std::endl;
+    return false;
+  }
+
+  auto params = Scheduler::to_underlying_arguments(group_problem_shape, tile_shape, ClusterShape{}, hw_info, args);
+  dim3 grid = Scheduler::get_grid_shape(params, group_problem_shape, tile_shape, ClusterShape{}, hw_info, args);
+
+  std::vector<int> host_tiles_n(groups);
+  std::vector<int> host_tile_offsets(groups + 1, 0);
+  for (int group = 0; group < groups; ++group) {
+    int tiles_m = static_cast<int>(cute::ceil_div(get<0>(problem_shapes[group]), size<0>(tile_shape)));
+    host_tiles_n[group] = static_cast<int>(cute::ceil_div(get<1>(problem_shapes[group]), size<1>(tile_shape)));
+    host_tile_offsets[group + 1] = host_tile_offsets[group] + tiles_m * host_tiles_n[group];
+  }
+  int total_counters = host_tile_offsets[groups];
+
+  cutlass::DeviceAllocation<int> visit_counters(total_counters);
+  cutlass::DeviceAllocation<int> tile_offsets(groups + 1);
+  cutlass::DeviceAllocation<int> tiles_n(groups);
+  cutlass::DeviceAllocation<int> first_groups(grid.x * grid.y);
+  tile_offsets.copy_from_host(host_tile_offsets.data());
+  tiles_n.copy_from_host(host_tiles_n.data());
+
+  cudaError_t err = cudaMemset((void*)visit_counters.get(), 0, sizeof(int) * total_counters);
+  if (err != cudaSuccess) {
+    std::cout << __FILE__ << ":" << __LINE__ << " cudaMemset failed with error: " << cudaGetErrorString(err) << std::endl;
+    return false;
+  }
+
+  run_sorted_group_scheduler<Scheduler><<<grid, 32>>>(
+    visit_counters.get(), tile_offsets.get(), tiles_n.get(), first_groups.get(), params);
+
+  err = cudaDeviceSynchronize();
+  if (err != cudaSuccess) {
+    std::cout << __FILE__ << ":" << __LINE__
+              << " scheduler kernel failed with error: "
+              << cudaGetErrorString(err) << std::endl;
+    return false;
+  }
+
+  // Groups must be ordered by decreasing tile count
+  std::vector<int32_t> host_group_order(groups);
+  std::vector<uint64_t> host_group_tile_offsets(groups + 1);
+  group_order.copy_to_host(host_group_order.data());
+  group_tile_offsets.copy_to_host(host_group_tile_offsets.data());
+
+  std::vector<int32_t> sorted_groups(host_group_order.begin(), host_group_order.begin() + active_groups);
+  std::sort(sorted_groups.begin(), sorted_groups.end());
+  for (int group = 0; group < active_groups; ++group) {
+    if (sorted_groups[group] != group) {
+      std::cout << "Group order is not a permutation of the groups" << std::endl;
+      return false;
+    }
+  }
+
+  for (int rank = 1; rank < active_groups; ++rank) {
+    uint64_t previous = host_group_tile_offsets[rank] - host_group_tile_offsets[rank - 1];
+    uint64_t current = host_group_tile_offsets[rank + 1] - host_group_tile_offsets[rank];
+    if (current > previous) {
+      std::cout << "Group " << host_group_order[rank] << " with " << current
+                << " tiles is scheduled after group " << host_group_order[rank - 1]
+                << " with " << previous << " tiles" << std::endl;
+      return false;
+    }
+  }
+
+  // The first wave starts on the largest group
+  std::vector<int> host_first_groups(grid.x * grid.y);
+  first_groups.copy_to_host(host_first_groups.data());
+  if (active_groups > 0 && host_first_groups[0] != host_group_order[0]) {
+    std::cout << "First tile is in group " << host_first_groups[0]
+              << " rather than the largest group " << host_group_order[0] << std::endl;
+    return false;
+  }
+
+  // Every output tile of the active groups must be visited exactly once, and no other tile visited
+  std::vector<int> host_visit_counts(total_counters);
+  visit_counters.copy_to_host(host_visit_counts.data());
+
+  for (int i = 0; i < total_counters; ++i) {
+    int expected_count = i < host_tile_offsets[active_groups] ? 1 : 0;
+    if (host_visit_counts[i] != expected_count) {
+      std::cout << "Error at idx: " << i << ". Got count " << host_visit_counts[i] << std::endl;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_group_scheduler_sorted, skewed_groups) {
+  using TileShape = Shape<_128,_128,_64>;
+
+  // Token counts of experts under a skewed routing, including empty experts
+  std::vector<ProblemShape> problem_shapes;
+  for (int m : {128, 4096, 0, 384, 12288, 1, 640, 0, 2048, 130}) {
+    problem_shapes.push_back({m, 1024, 512});
+  }
+
+  EXPECT_TRUE(test_sorted_group_scheduler(problem_shapes, TileShape{}, /*sm_count=*/132));
+  EXPECT_TRUE(test_sorted_group_scheduler(problem_shapes, TileShape{}, /*sm_count=*/ 16, /*max_swizzle_size=*/4));
+}
+
+TEST(SM90_Device_Gemm_group_scheduler_sorted, many_groups) {
+  using TileShape = Shape<_64,_128,_64>;
+
+  // More groups than threads in the sort pre-pass, with repeated sizes
+  std::vector<ProblemShape> problem_shapes;
+  for (int group = 0; group < 600; ++group) {
+    problem_shapes.push_back({64 * ((group * 37) % 11), 256 + 128 * (group % 3), 128});
+  }
+
+  EXPECT_TRUE(test_sorted_group_scheduler(problem_shapes, TileShape{}, /*sm_count=*/132));
+  EXPECT_TRUE(test_sorted_group_scheduler(problem_shapes, TileShape{}, /*sm_count=*/132, /*max_swizzle_size=*/2));
+}
+
+TEST(SM90_Device_Gemm_group_scheduler_sorted, device_group_count) {
+  using TileShape = Shape<_128,_128,_64>;
+
+  std::vector<ProblemShape> problem_shapes;
+  for (int m : {256, 1024, 128, 8192, 512, 0, 4096, 2048}) {
+    problem_shapes.push_back({m, 512, 256});
+  }
+
+  // Only a prefix of the groups is active, and the rest of the table is never written or read
+  EXPECT_TRUE(test_sorted_group_scheduler(problem_shapes, TileShape{}, /*sm_count=*/132, /*max_swizzle_size=*/1, /*active_groups=*/5));
+  EXPECT_TRUE(test_sorted_group_scheduler(problem_shapes, TileShape{}, /*sm_count=*/ 16, /*max_swizzle_size=*/1, /*active_groups=*/0));
+  EXPECT_TRUE(test_sorted_group_scheduler(problem_shapes, TileShape{}, /*sm_count=*/ 16, /*max_swizzle_size=*/4, /*active_groups=*/8));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
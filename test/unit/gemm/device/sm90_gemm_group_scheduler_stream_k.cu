@@ -0,0 +1,256 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests that the group stream-K scheduler covers the K tiles of every output tile exactly once.
+*/
+
+#include <algorithm>
+#include <numeric>
+
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/gemm/group_array_problem_shape.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler.hpp"
+#include "cutlass/util/device_memory.h"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+using ProblemShape = Shape<int,int,int>;
+using GroupProblemShape = cutlass::gemm::GroupProblemShape<ProblemShape>;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Kernel for walking the linear work indices assigned to each block and logging the K tiles and
+/// epilogues of the output tiles visited by the block. Counters of K tiles are laid out per output
+/// tile, with max_k_tiles entries each; output tiles are laid out per group, starting at tile_offsets[group].
+template <class Scheduler, class TileShape>
+__global__
+void
+run_group_stream_k_scheduler(
+    int* k_tile_counters,
+    int* epilogue_counters,
+    int const* tile_offsets,
+    int const* tiles_n,
+    int max_k_tiles,
+    ProblemShape const* problem_shapes,
+    typename Scheduler::Params params) {
+
+  Scheduler scheduler{params, nullptr};
+
+  uint64_t grid_size = uint64_t(gridDim.x) * uint64_t(gridDim.y);
+  uint64_t linear_idx = uint64_t(blockIdx.x) * uint64_t(gridDim.y) + uint64_t(blockIdx.y);
+  auto work_tile_info = scheduler.get_current_work_for_linear_idx(linear_idx);
+
+  while (work_tile_info.is_valid()) {
+    int group = work_tile_info.L_idx;
+    int m = work_tile_info.M_idx;
+    int n = work_tile_info.N_idx;
+    int tile_idx = tile_offsets[group] + m * tiles_n[group] + n;
+
+    if (threadIdx.x == 0) {
+      int k_tile_start = Scheduler::get_work_k_tile_start(work_tile_info);
+      int k_tile_count = Scheduler::get_work_k_tile_count(work_tile_info, problem_shapes[group], TileShape{});
+      for (int k = k_tile_start; k < k_tile_start + k_tile_count; ++k) {
+        atomicAdd(k_tile_counters + tile_idx * max_k_tiles + k, 1);
+      }
+      if (Scheduler::compute_epilogue(work_tile_info, params)) {
+        atomicAdd(epilogue_counters + tile_idx, 1);
+      }
+    }
+
+    linear_idx += grid_size;
+    work_tile_info = scheduler.get_current_work_for_linear_idx(linear_idx);
+  }
+}
+
+/// Host-side wrapper for launching the kernel to test the scheduler. Returns false on failure, and
+/// writes the number of K splits chosen for the final wave to splits.
+template <class TileShape>
+bool
+test_group_stream_k_scheduler(
+  std::vector<ProblemShape> const& problem_shapes,
+  TileShape tile_shape,
+  int sm_count,
+  int max_splits,
+  uint32_t& splits) {
+
+  using ClusterShape = Shape<_1,_1,_1>;
+  using Scheduler = typename cutlass::gemm::kernel::detail::TileSchedulerSelector<
+    cutlass::gemm::GroupStreamKScheduler, cutlass::arch::Sm90, TileShape, ClusterShape, 8, GroupProblemShape>::Scheduler;
+
+  int groups = static_cast<int>(problem_shapes.size());
+  cutlass::DeviceAllocation<ProblemShape> device_problem_shapes(groups);
+  device_problem_shapes.copy_from_host(problem_shapes.data());
+
+  GroupProblemShape group_problem_shape{groups, device_problem_shapes.get(), problem_shapes.data()};
+  cutlass::KernelHardwareInfo hw_info{0, sm_count};
+
+  typename Scheduler::Arguments args;
+  args.max_splits = max_splits;
+
+  if (!Scheduler::can_implement(args, hw_info)) {
+    std::cout << "can_implement() failed" << std::endl;
+    return false;
+  }
+
+  size_t workspace_size = Scheduler::template get_workspace_size<ProblemShape, float>(
+    args, ProblemShape{}, hw_info, /*mma_warp_groups=*/2);
+  cutlass::DeviceAllocation<uint8_t> workspace(workspace_size);
+  cutlass::Status status = Scheduler::template initialize_workspace<ProblemShape, float>(
+    args, workspace.get(), nullptr, ProblemShape{}, hw_info, /*mma_warp_groups=*/2);
+  if (status != cutlass::Status::kSuccess) {
+    std::cout << "initialize_workspace() failed with status " << cutlassGetStatusString(status) << std::endl;
+    return false;
+  }
+
+  auto params = Scheduler::to_underlying_arguments(group_problem_shape, tile_shape, ClusterShape{}, hw_info, args, workspace.get());
+  dim3 grid = Scheduler::get_grid_shape(params, group_problem_shape, tile_shape, ClusterShape{}, hw_info, args);
+  splits = params.sk_splits_;
+
+  std::vector<int> host_tiles_n(groups);
+  std::vector<int> host_tile_offsets(groups + 1, 0);
+  int max_k_tiles = 0;
+  for (int group = 0; group < groups; ++group) {
+    int tiles_m = static_cast<int>(cute::ceil_div(get<0>(problem_shapes[group]), size<0>(tile_shape)));
+    host_tiles_n[group] = static_cast<int>(cute::ceil_div(get<1>(problem_shapes[group]), size<1>(tile_shape)));
+    host_tile_offsets[group + 1] = host_tile_offsets[group] + tiles_m * host_tiles_n[group];
+    max_k_tiles = std::max(max_k_tiles, static_cast<int>(cute::ceil_div(get<2>(problem_shapes[group]), size<2>(tile_shape))));
+  }
+  int total_tiles = host_tile_offsets[groups];
+
+  cutlass::DeviceAllocation<int> k_tile_counters(total_tiles * max_k_tiles);
+  cutlass::DeviceAllocation<int> epilogue_counters(total_tiles);
+  cutlass::DeviceAllocation<int> tile_offsets(groups + 1);
+  cutlass::DeviceAllocation<int> tiles_n(groups);
+  tile_offsets.copy_from_host(host_tile_offsets.data());
+  tiles_n.copy_from_host(host_tiles_n.data());
+
+  cudaError_t err = cudaMemset((void*)k_tile_counters.get(), 0, sizeof(int) * total_tiles * max_k_tiles);
+  if (err == cudaSuccess) {
+    err = cudaMemset((void*)epilogue_counters.get(), 0, sizeof(int) * total_tiles);
+  }
+  if (err != cudaSuccess) {
+    std::cout << __FILE__ << ":" << __LINE__ << " cudaMemset failed with error: " << cudaGetErrorString(err) << std::endl;
+    return false;
+  }
+
+  run_group_stream_k_scheduler<Scheduler, TileShape><<<grid, 32>>>(
+    k_tile_counters.get(), epilogue_counters.get(), tile_offsets.get(), tiles_n.get(), max_k_tiles,
+    device_problem_shapes.get(), params);
+
+  err = cudaDeviceSynchronize();
+  if (err != cudaSuccess) {
+    std::cout << __FILE__ << ":" << __LINE__
+              << " scheduler kernel failed with error: "
+              << cudaGetErrorString(err) << std::endl;
+    return false;
+  }
+
+  // Every K tile of every output tile must be computed exactly once, and every epilogue computed once
+  std::vector<int> host_k_tile_counts(total_tiles * max_k_tiles);
+  std::vector<int> host_epilogue_counts(total_tiles);
+  k_tile_counters.copy_to_host(host_k_tile_counts.data());
+  epilogue_counters.copy_to_host(host_epilogue_counts.data());
+
+  for (int group = 0; group < groups; ++group) {
+    int k_tiles = static_cast<int>(cute::ceil_div(get<2>(problem_shapes[group]), size<2>(tile_shape)));
+    for (int tile = host_tile_offsets[group]; tile < host_tile_offsets[group + 1]; ++tile) {
+      if (host_epilogue_counts[tile] != 1) {
+        std::cout << "Epilogue of tile " << tile << " computed " << host_epilogue_counts[tile] << " times" << std::endl;
+        return false;
+      }
+      for (int k = 0; k < max_k_tiles; ++k) {
+        int expected_count = k < k_tiles ? 1 : 0;
+        if (host_k_tile_counts[tile * max_k_tiles + k] != expected_count) {
+          std::cout << "K tile " << k << " of tile " << tile << " computed "
+                    << host_k_tile_counts[tile * max_k_tiles + k] << " times" << std::endl;
+          return false;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_group_scheduler_stream_k, partial_final_wave) {
+  using TileShape = Shape<_128,_128,_64>;
+
+  // 128 + 24 tiles on 132 SMs leave a final wave of 20 tiles, split 6 ways
+  std::vector<ProblemShape> problem_shapes = {{2048, 1024, 4096}, {384, 1024, 1024}};
+  uint32_t splits = 0;
+
+  EXPECT_TRUE(test_group_stream_k_scheduler(problem_shapes, TileShape{}, /*sm_count=*/132, /*max_splits=*/8, splits));
+  EXPECT_EQ(splits, 6u);
+
+  EXPECT_TRUE(test_group_stream_k_scheduler(problem_shapes, TileShape{}, /*sm_count=*/132, /*max_splits=*/4, splits));
+  EXPECT_EQ(splits, 4u);
+
+  EXPECT_TRUE(test_group_stream_k_scheduler(problem_shapes, TileShape{}, /*sm_count=*/132, /*max_splits=*/1, splits));
+  EXPECT_EQ(splits, 1u);
+}
+
+TEST(SM90_Device_Gemm_group_scheduler_stream_k, ragged_groups) {
+  using TileShape = Shape<_128,_128,_64>;
+
+  // Token counts of experts under a skewed routing, including empty experts and a ragged K. The
+  // final wave of 32 tiles could be split 4 ways, but the last group only has 2 K tiles.
+  std::vector<ProblemShape> problem_shapes;
+  for (int m : {128, 1024, 0, 384, 1, 640, 0, 130}) {
+    problem_shapes.push_back({m, 1024, 1000});
+  }
+  problem_shapes.push_back({256, 256, 128});
+  uint32_t splits = 0;
+
+  EXPECT_TRUE(test_group_stream_k_scheduler(problem_shapes, TileShape{}, /*sm_count=*/132, /*max_splits=*/8, splits));
+  EXPECT_EQ(splits, 2u);
+
+  EXPECT_TRUE(test_group_stream_k_scheduler(problem_shapes, TileShape{}, /*sm_count=*/ 16, /*max_splits=*/8, splits));
+}
+
+TEST(SM90_Device_Gemm_group_scheduler_stream_k, full_final_wave) {
+  using TileShape = Shape<_128,_128,_64>;
+
+  // 264 tiles fill exactly two waves on 132 SMs, so no tile is split
+  std::vector<ProblemShape> problem_shapes = {{4096, 1024, 4096}, {128, 1024, 4096}};
+  uint32_t splits = 0;
+
+  EXPECT_TRUE(test_group_stream_k_scheduler(problem_shapes, TileShape{}, /*sm_count=*/132, /*max_splits=*/8, splits));
+  EXPECT_EQ(splits, 1u);
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
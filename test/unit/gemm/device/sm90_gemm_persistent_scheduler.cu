@@ -0,0 +1,282 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests that the persistent scheduler covers the entire problem space for each rasterization mode.
+*/
+
+#include "cutlass/cluster_launch.hpp"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
+#include "cutlass/util/device_memory.h"
+
+#include "../../common/cutlass_unit_test.h"
+
+// Grids are launched with clusters enabled in these tests,
+// so the CTK version must support cluster launching.
+#if defined(CUTLASS_SM90_CLUSTER_LAUNCH_ENABLED)
+
+using namespace cute;
+using ProblemShape_MNKL = Shape<int, int, int, int>;
+using RasterOrderOptions = cutlass::gemm::kernel::detail::RasterOrderOptions;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Kernel for getting each piece of work for a given block from the scheduler and logging
+/// the output tiles visited by the block.
+template <class Scheduler>
+__global__
+void
+run_scheduler(int* visit_counters, typename Scheduler::Params params, int tiles_m, int tiles_n, int tiles_l) {
+  Scheduler scheduler{params};
+  auto work_tile_info = scheduler.get_current_work();
+
+  while (work_tile_info.is_valid()) {
+    int m = work_tile_info.M_idx;
+    int n = work_tile_info.N_idx;
+    int l = work_tile_info.L_idx;
+
+    // Tiles beyond the problem, introduced by rounding up to the swizzle size, are skipped by kernels
+    if (m < tiles_m && n < tiles_n && l < tiles_l) {
+      atomicAdd(visit_counters + (l * tiles_n + n) * tiles_m + m, 1);
+    }
+
+    scheduler.advance_to_next_work();
+    work_tile_info = scheduler.get_current_work();
+  }
+}
+
+/// Host-side wrapper for launching the kernel to test the scheduler.
+template <
+  class TileShape,
+  class ClusterShape
+>
+bool
+test_scheduler(
+  ProblemShape_MNKL problem_shape_mnkl,
+  TileShape tile_shape,
+  ClusterShape cluster_shape,
+  int sm_count,
+  int l2_cache_size,
+  RasterOrderOptions raster_order,
+  int max_swizzle_size = 1) {
+
+  using Scheduler = cutlass::gemm::kernel::detail::PersistentTileSchedulerSm90;
+
+  cutlass::KernelHardwareInfo hw_info{0, sm_count};
+  hw_info.l2_cache_size = l2_cache_size;
+
+  typename Scheduler::Arguments args{max_swizzle_size, raster_order};
+  auto params = Scheduler::to_underlying_arguments(problem_shape_mnkl, tile_shape, cluster_shape, hw_info, args, nullptr);
+
+  // Launch the grid the kernel would launch, which is derived from the resolved params
+  typename Scheduler::Arguments launch_args{
+    1 << params.log_swizzle_size_,
+    params.raster_order_ == Scheduler::RasterOrder::AlongN ? RasterOrderOptions::AlongN : RasterOrderOptions::AlongM
+  };
+  dim3 grid = Scheduler::get_grid_shape(params, problem_shape_mnkl, tile_shape, cluster_shape, hw_info, launch_args);
+
+  int tiles_m = static_cast<int>(cute::ceil_div(size<0>(problem_shape_mnkl), size<0>(tile_shape)));
+  int tiles_n = static_cast<int>(cute::ceil_div(size<1>(problem_shape_mnkl), size<1>(tile_shape)));
+  int tiles_l = static_cast<int>(size<3>(problem_shape_mnkl));
+
+  auto print_info = [&]() {
+    std::cout << "Failed with problem size "
+      << size<0>(problem_shape_mnkl) << "x"
+      << size<1>(problem_shape_mnkl) << "x"
+      << size<2>(problem_shape_mnkl) << "x"
+      << size<3>(problem_shape_mnkl)
+      << " and grid size " << grid.x << "x"
+      << grid.y << "x" << grid.z
+      << " log_swizzle_size=" << params.log_swizzle_size_
+      << " raster_order=" << (params.raster_order_ == Scheduler::RasterOrder::AlongN ? "N" : "M")
+      << std::endl;
+  };
+
+  int total_counters = tiles_m * tiles_n * tiles_l;
+  cutlass::DeviceAllocation<int> visit_counters(total_counters);
+
+  cudaError_t err = cudaMemset((void*)visit_counters.get(), 0, sizeof(int) * total_counters);
+  if (err != cudaSuccess) {
+    print_info();
+    std::cout << __FILE__ << ":" << __LINE__ << " cudaMemset failed with error: " << cudaGetErrorString(err) << std::endl;
+    return false;
+  }
+
+  // The SM90 scheduler queries the CTA id within a cluster, which requires launching with clusters.
+  cudaLaunchConfig_t launch_config;
+  launch_config.gridDim = grid;
+  launch_config.blockDim = {1, 1, 1};
+  launch_config.dynamicSmemBytes = 0;
+  launch_config.stream = NULL;
+
+  cudaLaunchAttribute launch_attribute[1];
+  launch_attribute[0].id = cudaLaunchAttributeClusterDimension;
+  launch_attribute[0].val.clusterDim.x = static_cast<uint32_t>(cute::get<0>(ClusterShape{}));
+  launch_attribute[0].val.clusterDim.y = static_cast<uint32_t>(cute::get<1>(ClusterShape{}));
+  launch_attribute[0].val.clusterDim.z = static_cast<uint32_t>(cute::get<2>(ClusterShape{}));
+
+  launch_config.attrs = launch_attribute;
+  launch_config.numAttrs = 1;
+
+  void const* kernel = (void const*) run_scheduler<Scheduler>;
+  int* counters_ptr = visit_counters.get();
+  void* kernel_params[] = {
+    &counters_ptr,
+    &params,
+    &tiles_m,
+    &tiles_n,
+    &tiles_l
+  };
+
+  err = cudaLaunchKernelExC(&launch_config, kernel, kernel_params);
+  if (err != cudaSuccess) {
+    print_info();
+    std::cout << __FILE__ << ":" << __LINE__
+              << " cudaLaunchKernelExC failed with error: "
+              << cudaGetErrorString(err) << std::endl;
+    return false;
+  }
+
+  err = cudaDeviceSynchronize();
+  if (err != cudaSuccess) {
+    print_info();
+    std::cout << __FILE__ << ":" << __LINE__
+              << " scheduler kernel failed with error: "
+              << cudaGetErrorString(err) << std::endl;
+    return false;
+  }
+
+  // Every output tile must be visited exactly once
+  std::vector<int> host_visit_counts(total_counters);
+  visit_counters.copy_to_host(host_visit_counts.data());
+
+  for (size_t i = 0; i < host_visit_counts.size(); ++i) {
+    if (host_visit_counts[i] != 1) {
+      print_info();
+      std::cout << "Error at idx: " << i << ". Got count " << host_visit_counts[i] << std::endl;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/// Sweeps problem sizes in units of tiles for a given rasterization mode
+template <
+  class TileShape,
+  class ClusterShape
+>
+bool
+sweep_problems(
+  TileShape tile_shape,
+  ClusterShape cluster_shape,
+  int sm_count,
+  int l2_cache_size,
+  RasterOrderOptions raster_order,
+  int max_swizzle_size = 1) {
+
+  int tile_m = size<0>(tile_shape);
+  int tile_n = size<1>(tile_shape);
+
+  for (int m_blocks = 1; m_blocks <= 20; m_blocks += 3) {
+    for (int n_blocks = 1; n_blocks <= 20; n_blocks += 3) {
+      for (int l = 1; l < 3; ++l) {
+        for (int k : {64, 4096}) {
+          ProblemShape_MNKL problem{m_blocks * tile_m, n_blocks * tile_n, k, l};
+          if (!test_scheduler(problem, tile_shape, cluster_shape, sm_count, l2_cache_size, raster_order, max_swizzle_size)) {
+            return false;
+          }
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_persistent_scheduler, l2_aware_swizzle_size) {
+  using Params = cutlass::gemm::kernel::detail::PersistentTileSchedulerSm90Params;
+
+  cutlass::KernelHardwareInfo hw_info{0, 132};
+  cutlass::gemm::GemmCoord cluster_shape{1, 1, 1};
+  dim3 problem_blocks{64, 32, 1};
+
+  // Without operand sizes, the swizzle is sized so that one wave covers a roughly square region
+  EXPECT_EQ(Params::get_l2_aware_swizzle_size(problem_blocks, cluster_shape, hw_info, 0, 0), 8);
+
+  // Super-tiles shrink once their operand panels no longer fit in L2
+  hw_info.l2_cache_size = 50 << 20;
+  uint64_t panel_bytes = Params::get_operand_panel_bytes(128, 8192);
+  EXPECT_EQ(Params::get_l2_aware_swizzle_size(problem_blocks, cluster_shape, hw_info, panel_bytes, panel_bytes), 8);
+
+  panel_bytes = Params::get_operand_panel_bytes(128, 32768);
+  EXPECT_EQ(Params::get_l2_aware_swizzle_size(problem_blocks, cluster_shape, hw_info, panel_bytes, panel_bytes), 2);
+
+  panel_bytes = Params::get_operand_panel_bytes(128, 1 << 20);
+  EXPECT_EQ(Params::get_l2_aware_swizzle_size(problem_blocks, cluster_shape, hw_info, panel_bytes, panel_bytes), 1);
+
+  // Small devices run small waves
+  hw_info.sm_count = 16;
+  EXPECT_EQ(Params::get_l2_aware_swizzle_size(problem_blocks, cluster_shape, hw_info, 0, 0), 4);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_persistent_scheduler, 128x128x64_1x1x1) {
+  using TileShape_MNK = Shape<_128,_128,_64>;
+  using ClusterShape_MNK = Shape<_1,_1,_1>;
+
+  TileShape_MNK tile_shape;
+  ClusterShape_MNK cluster_shape;
+
+  EXPECT_TRUE(sweep_problems(tile_shape, cluster_shape, /*sm_count=*/132, /*l2_cache_size=*/0, RasterOrderOptions::Heuristic, /*max_swizzle_size=*/4));
+  EXPECT_TRUE(sweep_problems(tile_shape, cluster_shape, /*sm_count=*/132, /*l2_cache_size=*/50 << 20, RasterOrderOptions::L2Aware));
+  EXPECT_TRUE(sweep_problems(tile_shape, cluster_shape, /*sm_count=*/ 16, /*l2_cache_size=*/ 1 << 20, RasterOrderOptions::L2Aware));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_persistent_scheduler, 256x128x64_2x1x1) {
+  using TileShape_MNK = Shape<_256,_128,_64>;
+  using ClusterShape_MNK = Shape<_2,_1,_1>;
+
+  TileShape_MNK tile_shape;
+  ClusterShape_MNK cluster_shape;
+
+  EXPECT_TRUE(sweep_problems(tile_shape, cluster_shape, /*sm_count=*/132, /*l2_cache_size=*/50 << 20, RasterOrderOptions::L2Aware));
+  EXPECT_TRUE(sweep_problems(tile_shape, cluster_shape, /*sm_count=*/ 64, /*l2_cache_size=*/ 4 << 20, RasterOrderOptions::L2Aware));
+}
+
+#endif // defined(CUTLASS_SM90_CLUSTER_LAUNCH_ENABLED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
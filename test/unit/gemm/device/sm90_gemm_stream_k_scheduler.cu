@@ -50,7 +50,9 @@ using ProblemShape_MNKL = Shape<int, int, int, int>;
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// Kernel for getting each piece of work for a given block from the scheduler and logging
-/// the K iterations visited by the block.
+/// the K iterations visited by the block, as well as the output tiles reduced by separate reduction units.
+/// If tree_peer_ranks is non-null, the position in K used by ReductionMode::DeterministicTree is
+/// logged at the first K iteration of each piece of work.
 template <
   class Scheduler,
   class TileShape,
@@ -58,13 +60,17 @@ template <
 >
 __global__
 void
-run_scheduler(int* visit_counters, typename Scheduler::Params params, TileShape tile_shape, ClusterShape cluster_shape, ProblemShape_MNKL problem_shape_mnkl) {
+run_scheduler(int* visit_counters, int* reduction_counters, int* tree_peer_ranks, typename Scheduler::Params params, TileShape tile_shape, ClusterShape cluster_shape, ProblemShape_MNKL problem_shape_mnkl) {
   Scheduler scheduler{params};
   auto work_tile_info = scheduler.get_current_work();
 
   while (work_tile_info.is_valid()) {
     // Increment counters to indicate coverage
     auto tile_idx = Scheduler::output_tile_index(params, work_tile_info);
+    if (work_tile_info.is_reduction_unit()) {
+      atomicAdd(reduction_counters + tile_idx, 1);
+    }
+
     auto offset = tile_idx * params.divmod_tiles_per_output_tile_.divisor + work_tile_info.K_idx;
     for (auto i = 0; i < work_tile_info.k_tile_count; ++i) {
       // Use atomicAdd because the visit counters are shared by multiple thread blocks.
@@ -73,6 +79,10 @@ run_scheduler(int* visit_counters, typename Scheduler::Params params, TileShape
       atomicAdd(visit_counters + offset + i, 1);
     }
 
+    if (tree_peer_ranks != nullptr && !work_tile_info.is_reduction_unit()) {
+      tree_peer_ranks[offset] = static_cast<int>(Scheduler::tree_peer_rank(params, tile_idx, work_tile_info.K_idx));
+    }
+
     bool continue_current = scheduler.continue_current_work(work_tile_info);
     if (!continue_current) {
       scheduler.advance_to_next_work();
@@ -94,12 +104,15 @@ test_scheduler(
   ClusterShape cluster_shape,
   int sm_count,
   int splits=1,
-  bool expect_data_parallel=false) {
+  bool expect_data_parallel=false,
+  cutlass::gemm::kernel::detail::ReductionMode reduction_mode = cutlass::gemm::kernel::detail::ReductionMode::Deterministic) {
 
   using Scheduler = cutlass::gemm::kernel::detail::PersistentTileSchedulerSm90StreamK<TileShape, ClusterShape>;
 
   cutlass::KernelHardwareInfo hw_info{0, sm_count};
-  auto params = Scheduler::to_underlying_arguments(problem_shape_mnkl, tile_shape, cluster_shape, hw_info, {splits}, nullptr);
+  typename Scheduler::Arguments scheduler_args{splits};
+  scheduler_args.reduction_mode = reduction_mode;
+  auto params = Scheduler::to_underlying_arguments(problem_shape_mnkl, tile_shape, cluster_shape, hw_info, scheduler_args, nullptr);
 
   typename Scheduler::Arguments args{};
 
@@ -123,6 +136,7 @@ test_scheduler(
       << " k_tiles_per_sk_unit=" << params.divmod_k_tiles_per_sk_unit_.divisor
       << " k_tiles_per_sk_big_unit=" << params.divmod_k_tiles_per_sk_big_unit_.divisor
       << " units_per_problem=" << params.units_per_problem_
+      << " separate_reduction_units=" << params.separate_reduction_units_
       << " groups=" << params.divmod_sk_groups_.divisor << std::endl;
   };
 
@@ -138,6 +152,10 @@ test_scheduler(
   auto total_counters = blk_m * blk_n * blk_l * params.divmod_tiles_per_output_tile_.divisor;
   cutlass::DeviceAllocation<int> visit_counters(total_counters);
 
+  // Allocate counters indicating the number of separate reduction units that visited each output tile
+  auto total_reduction_counters = blk_m * blk_n * blk_l;
+  cutlass::DeviceAllocation<int> reduction_counters(total_reduction_counters);
+
   // Initialize counters to zero
   cudaError_t err = cudaMemset((void*)visit_counters.get(), 0, sizeof(int) * total_counters);
   if (err != cudaSuccess) {
@@ -146,6 +164,25 @@ test_scheduler(
     return false;
   }
 
+  err = cudaMemset((void*)reduction_counters.get(), 0, sizeof(int) * total_reduction_counters);
+  if (err != cudaSuccess) {
+    print_info();
+    std::cout << __FILE__ << ":" << __LINE__ << " cudaMemset failed with error: " << cudaGetErrorString(err) << std::endl;
+    return false;
+  }
+
+  // Allocate the position in K logged at the first K iteration of each peer (-1 elsewhere) for tree reductions
+  bool check_tree_ranks = reduction_mode == cutlass::gemm::kernel::detail::ReductionMode::DeterministicTree;
+  cutlass::DeviceAllocation<int> tree_peer_ranks(check_tree_ranks ? total_counters : 0);
+  if (check_tree_ranks) {
+    err = cudaMemset((void*)tree_peer_ranks.get(), 0xff, sizeof(int) * total_counters);
+    if (err != cudaSuccess) {
+      print_info();
+      std::cout << __FILE__ << ":" << __LINE__ << " cudaMemset failed with error: " << cudaGetErrorString(err) << std::endl;
+      return false;
+    }
+  }
+
   // Set up cluster and cluster launch. This is needed even for this simple kernel because
   // the SM90 scheduler needs to be able to query the CTA id within a cluster, which requires
   // explicitly launching with clusters.
@@ -172,8 +209,12 @@ test_scheduler(
 
   void const* kernel = (void const*) run_scheduler<Scheduler, TileShape, ClusterShape>;
   int* counters_ptr = visit_counters.get();
+  int* reduction_counters_ptr = reduction_counters.get();
+  int* tree_peer_ranks_ptr = check_tree_ranks ? tree_peer_ranks.get() : nullptr;
   void* kernel_params[] = {
     &counters_ptr,
+    &reduction_counters_ptr,
+    &tree_peer_ranks_ptr,
     &params,
     &tile_shape,
     &cluster_shape,
@@ -212,6 +253,48 @@ test_scheduler(
     }
   }
 
+  // Each output tile must be reduced by exactly one separate reduction unit if separate reduction is used
+  std::vector<int> host_reduction_counts(total_reduction_counters);
+  reduction_counters.copy_to_host(host_reduction_counts.data());
+
+  int expected_reduction_count = params.requires_separate_reduction() ? 1 : 0;
+  for (size_t i = 0; i < host_reduction_counts.size(); ++i) {
+    if (host_reduction_counts[i] != expected_reduction_count) {
+      print_info();
+      std::cout << "Error at tile: " << i << ". Got reduction count " << host_reduction_counts[i] << std::endl;
+      return false;
+    }
+  }
+
+  // For tree reductions, the peers of each output tile must be ranked 0, 1, 2, ... in order of K,
+  // and all peers but the final one must fit in the workspace partials reserved per output tile
+  if (check_tree_ranks) {
+    std::vector<int> host_tree_peer_ranks(total_counters);
+    tree_peer_ranks.copy_to_host(host_tree_peer_ranks.data());
+
+    using Params = typename Scheduler::Params;
+    int k_tiles_per_output_tile = static_cast<int>(params.divmod_tiles_per_output_tile_.divisor);
+    int max_rank = static_cast<int>(Params::tree_reduction_peers_per_tile(
+      params.divmod_splits_.divisor, params.sk_units_, params.sk_tiles_));
+
+    for (size_t tile = 0; tile < static_cast<size_t>(total_reduction_counters); ++tile) {
+      int expected_rank = 0;
+      for (int k = 0; k < k_tiles_per_output_tile; ++k) {
+        int rank = host_tree_peer_ranks[tile * k_tiles_per_output_tile + k];
+        if (rank == -1) {
+          continue;
+        }
+        if (rank != expected_rank || rank > max_rank) {
+          print_info();
+          std::cout << "Error at tile: " << tile << ", k iteration: " << k << ". Got tree peer rank " << rank
+                    << ", expected " << expected_rank << " (at most " << max_rank << ")" << std::endl;
+          return false;
+        }
+        ++expected_rank;
+      }
+    }
+  }
+
   return true;
 }
 
@@ -229,7 +312,8 @@ bool sweep_k(
   bool expect_data_parallel=false,
   int k_start=128,
   int k_stop=16384,
-  int k_step=0) {
+  int k_step=0,
+  cutlass::gemm::kernel::detail::ReductionMode reduction_mode = cutlass::gemm::kernel::detail::ReductionMode::Deterministic) {
 
   if (k_step == 0) {
     k_step = 4 * cute::size<2>(tile_shape);
@@ -237,7 +321,7 @@ bool sweep_k(
 
   for (int k = k_start; k <= k_stop; k += k_step) {
     ProblemShape_MNKL problem{get<0>(problem_shape_mnkl), get<1>(problem_shape_mnkl), k, get<3>(problem_shape_mnkl)};
-    bool passed = test_scheduler(problem, tile_shape, cluster_shape, sm_count, splits, expect_data_parallel);
+    bool passed = test_scheduler(problem, tile_shape, cluster_shape, sm_count, splits, expect_data_parallel, reduction_mode);
     if (!passed) {
       return false;
     }
@@ -301,6 +385,65 @@ bool test_stream_k(
   return true;
 }
 
+/// Executes tests of the scheduler on split-K decompositions that reduce splits in separate reduction units.
+template <
+  class TileShape,
+  class ClusterShape
+>
+bool test_separate_reduction(
+  TileShape tile_shape,
+  ClusterShape cluster_shape,
+  int sm_count) {
+
+  int tile_m = size<0>(tile_shape);
+  int tile_n = size<1>(tile_shape);
+
+  for (int m_blocks = 1; m_blocks <= 12; ++m_blocks) {
+    for (int n_blocks = 1; n_blocks <= 12; ++n_blocks) {
+      for (int splits : {2, 3}) {
+        ProblemShape_MNKL problem{m_blocks * tile_m, n_blocks * tile_n, 1, 2};
+        if (!sweep_k(problem, tile_shape, cluster_shape, sm_count, splits, /*expect_data_parallel=*/false,
+                     /*k_start=*/512, /*k_stop=*/8192, /*k_step=*/0,
+                     cutlass::gemm::kernel::detail::ReductionMode::Separate)) {
+          return false;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+/// Executes tests of the scheduler on stream-K and split-K decompositions with deterministic tree reduction,
+/// checking the position in K assigned to each peer as well as coverage.
+template <
+  class TileShape,
+  class ClusterShape
+>
+bool test_deterministic_tree(
+  TileShape tile_shape,
+  ClusterShape cluster_shape,
+  int sm_count) {
+
+  int tile_m = size<0>(tile_shape);
+  int tile_n = size<1>(tile_shape);
+
+  for (int m_blocks = 1; m_blocks <= 12; ++m_blocks) {
+    for (int n_blocks = 1; n_blocks <= 12; ++n_blocks) {
+      for (int splits : {1, 2, 3}) {
+        ProblemShape_MNKL problem{m_blocks * tile_m, n_blocks * tile_n, 1, 2};
+        if (!sweep_k(problem, tile_shape, cluster_shape, sm_count, splits, /*expect_data_parallel=*/false,
+                     /*k_start=*/128, /*k_stop=*/8192, /*k_step=*/0,
+                     cutlass::gemm::kernel::detail::ReductionMode::DeterministicTree)) {
+          return false;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 TEST(SM90_Device_Gemm_stream_k_scheduler, 256x128x64_2x1x1) {
@@ -333,6 +476,45 @@ TEST(SM90_Device_Gemm_stream_k_scheduler, 128x128x64_2x1x1) {
   EXPECT_TRUE(test_scheduler({128, 512, 2048, 1}, tile_shape, cluster_shape, 114));
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_stream_k_scheduler, 128x128x64_2x1x1_separate_reduction) {
+  using TileShape_MNK = Shape<_128,_128,_64>;
+  using ClusterShape_MNK = Shape<_2,_1,_1>;
+
+  TileShape_MNK tile_shape;
+  ClusterShape_MNK cluster_shape;
+
+  EXPECT_TRUE(test_separate_reduction(tile_shape, cluster_shape, /*sm_count=*/ 16));
+  EXPECT_TRUE(test_separate_reduction(tile_shape, cluster_shape, /*sm_count=*/132));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_stream_k_scheduler, 128x128x64_2x1x1_deterministic_tree) {
+  using TileShape_MNK = Shape<_128,_128,_64>;
+  using ClusterShape_MNK = Shape<_2,_1,_1>;
+
+  TileShape_MNK tile_shape;
+  ClusterShape_MNK cluster_shape;
+
+  EXPECT_TRUE(test_deterministic_tree(tile_shape, cluster_shape, /*sm_count=*/ 16));
+  EXPECT_TRUE(test_deterministic_tree(tile_shape, cluster_shape, /*sm_count=*/132));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_stream_k_scheduler, 128x128x64_1x1x1_deterministic_tree) {
+  using TileShape_MNK = Shape<_128,_128,_64>;
+  using ClusterShape_MNK = Shape<_1,_1,_1>;
+
+  TileShape_MNK tile_shape;
+  ClusterShape_MNK cluster_shape;
+
+  EXPECT_TRUE(test_deterministic_tree(tile_shape, cluster_shape, /*sm_count=*/ 20));
+  EXPECT_TRUE(test_deterministic_tree(tile_shape, cluster_shape, /*sm_count=*/114));
+}
+
 #endif // defined(CUTLASS_SM90_CLUSTER_LAUNCH_ENABLED)
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,265 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for device-wide sampled dense-dense matrix products visiting only the blocks of an output mask
+*/
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/fusion/operations.hpp"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Runs D = alpha * A * B^T on the non-zero blocks of a random BSR mask with blocks of the CTA tile
+/// and compares the compressed blocks against a host reference. Each block row is non-zero with the
+/// given density, so some block rows are empty. Elements of blocks outside of the problem must keep
+/// their poison value.
+template <class Gemm>
+bool
+test_sddmm(int m, int n, int k, float density, int batch = 1, float alpha = 1.f) {
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+  using ElementOutput = cutlass::half_t;
+  using StrideA = typename Gemm::GemmKernel::StrideA;
+  using StrideB = typename Gemm::GemmKernel::StrideB;
+  using StrideC = typename Gemm::GemmKernel::StrideC;
+  using StrideD = typename Gemm::GemmKernel::StrideD;
+  using TileShape = typename Gemm::GemmKernel::TileShape;
+
+  constexpr int BlkM = size<0>(TileShape{});
+  constexpr int BlkN = size<1>(TileShape{});
+  int block_rows = (m + BlkM - 1) / BlkM;
+  int block_cols = (n + BlkN - 1) / BlkN;
+
+  std::mt19937 rng(2026);
+  std::uniform_int_distribution<int> dist(-2, 2);
+  std::uniform_real_distribution<float> coin(0.f, 1.f);
+
+  std::vector<int32_t> block_row_offsets(1, 0);
+  std::vector<int32_t> block_col_indices;
+  for (int i = 0; i < block_rows; ++i) {
+    for (int j = 0; j < block_cols; ++j) {
+      if (coin(rng) < density) {
+        block_col_indices.push_back(j);
+      }
+    }
+    block_row_offsets.push_back(int32_t(block_col_indices.size()));
+  }
+  int num_blocks = int(block_col_indices.size());
+
+  // A is (M,K,L) row-major, B is (N,K,L) row-major
+  std::vector<ElementA> tensor_a(size_t(m) * k * batch);
+  std::vector<ElementB> tensor_b(size_t(n) * k * batch);
+  for (auto& x : tensor_a) { x = ElementA(dist(rng)); }
+  for (auto& x : tensor_b) { x = ElementB(dist(rng)); }
+
+  size_t block_size = size_t(BlkM) * BlkN;
+  std::vector<float> reference(block_size * num_blocks * batch, -99.f);
+  for (int l = 0; l < batch; ++l) {
+    for (int i = 0; i < block_rows; ++i) {
+      for (int b = block_row_offsets[i]; b < block_row_offsets[i + 1]; ++b) {
+        int j = block_col_indices[b];
+        for (int r = 0; r < BlkM && i * BlkM + r < m; ++r) {
+          for (int c = 0; c < BlkN && j * BlkN + c < n; ++c) {
+            float acc = 0.f;
+            for (int kk = 0; kk < k; ++kk) {
+              acc += float(tensor_a[(size_t(l) * m + i * BlkM + r) * k + kk]) *
+                     float(tensor_b[(size_t(l) * n + j * BlkN + c) * k + kk]);
+            }
+            reference[(size_t(l) * num_blocks + b) * block_size + r * BlkN + c] = alpha * acc;
+          }
+        }
+      }
+    }
+  }
+
+  cutlass::DeviceAllocation<ElementA> device_a(tensor_a.size());
+  cutlass::DeviceAllocation<ElementB> device_b(tensor_b.size());
+  cutlass::DeviceAllocation<int32_t> device_row_offsets(block_row_offsets.size());
+  cutlass::DeviceAllocation<int32_t> device_col_indices(cute::max(num_blocks, 1));
+  cutlass::DeviceAllocation<ElementOutput> device_blocks(cute::max(reference.size(), size_t(1)));
+  device_a.copy_from_host(tensor_a.data());
+  device_b.copy_from_host(tensor_b.data());
+  device_row_offsets.copy_from_host(block_row_offsets.data());
+  if (num_blocks > 0) {
+    device_col_indices.copy_from_host(block_col_indices.data());
+    std::vector<ElementOutput> poison(reference.size(), ElementOutput(-99));
+    device_blocks.copy_from_host(poison.data());
+  }
+
+  StrideA stride_a = cutlass::make_cute_packed_stride(StrideA{}, cute::make_shape(m, k, batch));
+  StrideB stride_b = cutlass::make_cute_packed_stride(StrideB{}, cute::make_shape(n, k, batch));
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(0);
+
+  typename Gemm::Arguments arguments{
+    batch > 1 ? cutlass::gemm::GemmUniversalMode::kBatched : cutlass::gemm::GemmUniversalMode::kGemm,
+    {m, n, k, batch},
+    {device_a.get(), stride_a, device_b.get(), stride_b},
+    {{}, nullptr, StrideC{}, nullptr, StrideD{}},
+    hw_info
+  };
+
+  auto& fusion_args = arguments.epilogue.thread;
+  fusion_args.alpha = alpha;
+  fusion_args.blocks_ptr = device_blocks.get();
+  fusion_args.block_row_offsets = device_row_offsets.get();
+  fusion_args.block_col_indices = device_col_indices.get();
+  fusion_args.num_blocks = num_blocks;
+
+  arguments.scheduler.block_row_offsets = device_row_offsets.get();
+  arguments.scheduler.block_col_indices = device_col_indices.get();
+  arguments.scheduler.num_blocks = num_blocks;
+
+  Gemm gemm;
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cout << "can_implement() failed" << std::endl;
+    return false;
+  }
+
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  cutlass::Status status = gemm.initialize(arguments, workspace.get());
+  if (status == cutlass::Status::kSuccess) {
+    status = gemm.run();
+  }
+  if (status != cutlass::Status::kSuccess) {
+    std::cout << "SDDMM failed with status " << cutlassGetStatusString(status) << std::endl;
+    return false;
+  }
+
+  cudaError_t err = cudaDeviceSynchronize();
+  if (err != cudaSuccess) {
+    std::cout << __FILE__ << ":" << __LINE__ << " kernel failed with error: " << cudaGetErrorString(err) << std::endl;
+    return false;
+  }
+
+  // Inputs are small integers, so the products are exact in the f32 accumulator and f16 output
+  std::vector<ElementOutput> blocks(reference.size());
+  if (num_blocks > 0) {
+    device_blocks.copy_to_host(blocks.data());
+  }
+  for (size_t idx = 0; idx < blocks.size(); ++idx) {
+    if (float(blocks[idx]) != reference[idx]) {
+      std::cout << "Error in block " << idx / block_size << " at (" << (idx % block_size) / BlkN << ","
+                << idx % BlkN << "): got " << float(blocks[idx]) << ", expected " << reference[idx] << std::endl;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class TileShape, class KernelSchedule, class EpilogueSchedule>
+struct Sddmm {
+  using ClusterShape = Shape<_1,_1,_1>;
+  using FusionOperation = cutlass::epilogue::fusion::LinCombBlockSparse<cutlass::half_t, float, void>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape, ClusterShape,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      void, cutlass::layout::RowMajor, 8,
+      void, cutlass::layout::RowMajor, 8,
+      EpilogueSchedule,
+      FusionOperation
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape, ClusterShape,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue,
+      cutlass::gemm::SddmmScheduler
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Sddmm_f16t_f16n_f16_tensor_op_gmma_f32, 128x128x64_cooperative) {
+  using Gemm = typename Sddmm<
+    Shape<_128,_128,_64>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>::Gemm;
+
+  EXPECT_TRUE(test_sddmm<Gemm>(1024, 1024, 256, 0.25f));
+  EXPECT_TRUE(test_sddmm<Gemm>(1000, 776, 128, 0.5f));
+  EXPECT_TRUE(test_sddmm<Gemm>(512, 512, 64, 0.3f, 3, 2.f));
+  EXPECT_TRUE(test_sddmm<Gemm>(256, 256, 64, 0.f));
+}
+
+TEST(SM90_Device_Sddmm_f16t_f16n_f16_tensor_op_gmma_f32, 64x128x64_pingpong) {
+  using Gemm = typename Sddmm<
+    Shape<_64,_128,_64>,
+    cutlass::gemm::KernelTmaWarpSpecializedPingpong,
+    cutlass::epilogue::TmaWarpSpecialized>::Gemm;
+
+  EXPECT_TRUE(test_sddmm<Gemm>(1024, 2048, 128, 0.1f));
+  EXPECT_TRUE(test_sddmm<Gemm>(904, 1032, 200, 0.4f));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,367 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+/*! \file
+    \brief Tests for device-wide Grouped and Ptr-Array GEMM with a structured sparse A operand
+*/
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/group_array_problem_shape.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/transform/device/transform_universal_adapter.hpp"
+#include "cutlass/transform/kernel/sparse_gemm_compressor.hpp"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SPARSE_SM90_SUPPORTED) && defined(CUTLASS_ARCH_MMA_MODIFIABLE_TMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Runs D_g = alpha * A_g * B_g + beta * C_g for every group g, where each A_g is a random 2:4
+/// structured sparse matrix compressed on device, and compares against a host reference.
+/// A Ptr-Array GEMM runs all problems as batches, so they must share one problem size.
+template <class Gemm>
+bool
+test_sparse_group_gemm(std::vector<Shape<int,int,int>> const& problems, float alpha = 1.f, float beta = 0.5f) {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using CollectiveMainloop = typename GemmKernel::CollectiveMainloop;
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+  using ElementC = typename Gemm::ElementC;
+  using ElementD = typename Gemm::ElementD;
+  using ElementE = typename CollectiveMainloop::ElementE;
+  using SparseConfig = typename CollectiveMainloop::SparseConfig;
+  using InternalStrideB = typename GemmKernel::InternalStrideB;
+  using InternalStrideC = typename GemmKernel::InternalStrideC;
+  using InternalStrideD = typename GemmKernel::InternalStrideD;
+  constexpr bool IsGroupedGemm = CollectiveMainloop::IsGroupedGemmKernel;
+
+  using LayoutTagA = cutlass::layout::RowMajor;
+  using StrideA = cutlass::gemm::TagToStrideA_t<LayoutTagA>;
+  using CompressorUtility = cutlass::transform::kernel::StructuredSparseCompressorUtility<
+      Shape<int,int,int,int>, ElementA, LayoutTagA, SparseConfig>;
+  using CompressorKernel = cutlass::transform::kernel::StructuredSparseCompressor<
+      Shape<int,int,int,int>, ElementA, LayoutTagA, SparseConfig, cutlass::arch::Sm90>;
+  using Compressor = cutlass::transform::device::TransformUniversalAdapter<CompressorKernel>;
+
+  int groups = static_cast<int>(problems.size());
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(0);
+
+  // Offsets of every group into one allocation per tensor
+  std::vector<int64_t> offset_a, offset_a_comp, offset_e, offset_b, offset_c;
+  int64_t total_a = 0, total_a_comp = 0, total_e = 0, total_b = 0, total_c = 0;
+  for (auto [m, n, k] : problems) {
+    CompressorUtility compressor_utility(make_shape(m, n, k, 1),
+        cutlass::make_cute_packed_stride(StrideA{}, make_shape(m, k, 1)));
+    offset_a.push_back(total_a);
+    offset_a_comp.push_back(total_a_comp);
+    offset_e.push_back(total_e);
+    offset_b.push_back(total_b);
+    offset_c.push_back(total_c);
+    total_a += int64_t(m) * k;
+    total_a_comp += int64_t(compressor_utility.get_tensorA_m_physical()) * compressor_utility.get_tensorA_k_physical();
+    total_e += int64_t(compressor_utility.get_tensor_E_bytes()) / sizeof(ElementE);
+    total_b += int64_t(n) * k;
+    total_c += int64_t(m) * n;
+  }
+
+  std::mt19937 rng(2026);
+  std::uniform_int_distribution<int> dist(-2, 2);
+  std::vector<ElementA> tensor_a(total_a);
+  std::vector<ElementB> tensor_b(total_b);
+  std::vector<ElementC> tensor_c(total_c);
+  for (auto& x : tensor_a) { x = ElementA(dist(rng)); }
+  for (auto& x : tensor_b) { x = ElementB(dist(rng)); }
+  for (auto& x : tensor_c) { x = ElementC(dist(rng)); }
+
+  cutlass::DeviceAllocation<ElementA> device_a(total_a);
+  cutlass::DeviceAllocation<ElementA> device_a_comp(total_a_comp);
+  cutlass::DeviceAllocation<ElementE> device_e(total_e);
+  cutlass::DeviceAllocation<ElementB> device_b(total_b);
+  cutlass::DeviceAllocation<ElementC> device_c(total_c);
+  cutlass::DeviceAllocation<ElementD> device_d(total_c);
+
+  // Zero out A to the sparsity pattern, then compress every group on device
+  for (int g = 0; g < groups; ++g) {
+    auto [m, n, k] = problems[g];
+    StrideA stride_a = cutlass::make_cute_packed_stride(StrideA{}, make_shape(m, k, 1));
+    CompressorUtility compressor_utility(make_shape(m, n, k, 1), stride_a);
+    compressor_utility.structure_sparse_zero_mask_fill(tensor_a.data() + offset_a[g], 2023 + g);
+  }
+  device_a.copy_from_host(tensor_a.data());
+  device_b.copy_from_host(tensor_b.data());
+  device_c.copy_from_host(tensor_c.data());
+
+  for (int g = 0; g < groups; ++g) {
+    auto [m, n, k] = problems[g];
+    typename Compressor::Arguments arguments{
+      {m, n, k, 1},
+      {device_a.get() + offset_a[g],
+       cutlass::make_cute_packed_stride(StrideA{}, make_shape(m, k, 1)),
+       device_a_comp.get() + offset_a_comp[g],
+       device_e.get() + offset_e[g]},
+      {hw_info}
+    };
+
+    Compressor compressor_op;
+    cutlass::DeviceAllocation<uint8_t> workspace(Compressor::get_workspace_size(arguments));
+    if (compressor_op.can_implement(arguments) != cutlass::Status::kSuccess ||
+        compressor_op.initialize(arguments, workspace.get()) != cutlass::Status::kSuccess ||
+        compressor_op.run() != cutlass::Status::kSuccess) {
+      std::cout << "Compressing A of group " << g << " failed" << std::endl;
+      return false;
+    }
+  }
+
+  // Host reference over the zero-masked dense A
+  std::vector<float> reference(total_c);
+  for (int g = 0; g < groups; ++g) {
+    auto [m, n, k] = problems[g];
+    for (int i = 0; i < m; ++i) {
+      for (int j = 0; j < n; ++j) {
+        float acc = 0.f;
+        for (int kk = 0; kk < k; ++kk) {
+          acc += float(tensor_a[offset_a[g] + int64_t(i) * k + kk]) * float(tensor_b[offset_b[g] + int64_t(j) * k + kk]);
+        }
+        int64_t idx = offset_c[g] + int64_t(i) * n + j;
+        reference[idx] = alpha * acc + beta * float(tensor_c[idx]);
+      }
+    }
+  }
+
+  // Per group pointers and strides
+  std::vector<ElementA const*> ptr_a_host;
+  std::vector<ElementE const*> ptr_e_host;
+  std::vector<ElementB const*> ptr_b_host;
+  std::vector<ElementC const*> ptr_c_host;
+  std::vector<ElementD*> ptr_d_host;
+  std::vector<InternalStrideB> stride_b_host;
+  std::vector<InternalStrideC> stride_c_host;
+  std::vector<InternalStrideD> stride_d_host;
+  for (int g = 0; g < groups; ++g) {
+    auto [m, n, k] = problems[g];
+    ptr_a_host.push_back(device_a_comp.get() + offset_a_comp[g]);
+    ptr_e_host.push_back(device_e.get() + offset_e[g]);
+    ptr_b_host.push_back(device_b.get() + offset_b[g]);
+    ptr_c_host.push_back(device_c.get() + offset_c[g]);
+    ptr_d_host.push_back(device_d.get() + offset_c[g]);
+    stride_b_host.push_back(cutlass::make_cute_packed_stride(InternalStrideB{}, make_shape(n, k, 1)));
+    stride_c_host.push_back(cutlass::make_cute_packed_stride(InternalStrideC{}, make_shape(m, n, 1)));
+    stride_d_host.push_back(cutlass::make_cute_packed_stride(InternalStrideD{}, make_shape(m, n, 1)));
+  }
+
+  cutlass::DeviceAllocation<ElementA const*> ptr_a(groups);
+  cutlass::DeviceAllocation<ElementE const*> ptr_e(groups);
+  cutlass::DeviceAllocation<ElementB const*> ptr_b(groups);
+  cutlass::DeviceAllocation<ElementC const*> ptr_c(groups);
+  cutlass::DeviceAllocation<ElementD*> ptr_d(groups);
+  ptr_a.copy_from_host(ptr_a_host.data());
+  ptr_e.copy_from_host(ptr_e_host.data());
+  ptr_b.copy_from_host(ptr_b_host.data());
+  ptr_c.copy_from_host(ptr_c_host.data());
+  ptr_d.copy_from_host(ptr_d_host.data());
+
+  typename Gemm::Arguments arguments;
+  cutlass::DeviceAllocation<Shape<int,int,int>> problem_sizes(groups);
+  cutlass::DeviceAllocation<InternalStrideB> stride_b(groups);
+  cutlass::DeviceAllocation<InternalStrideC> stride_c(groups);
+  cutlass::DeviceAllocation<InternalStrideD> stride_d(groups);
+  if constexpr (IsGroupedGemm) {
+    problem_sizes.copy_from_host(problems.data());
+    stride_b.copy_from_host(stride_b_host.data());
+    stride_c.copy_from_host(stride_c_host.data());
+    stride_d.copy_from_host(stride_d_host.data());
+
+    // Layouts of A and E are derived from the problem size of every group
+    arguments = typename Gemm::Arguments{
+      cutlass::gemm::GemmUniversalMode::kGrouped,
+      {groups, problem_sizes.get(), problems.data()},
+      {ptr_a.get(), {}, ptr_b.get(), stride_b.get(), ptr_e.get(), {}},
+      {{}, ptr_c.get(), stride_c.get(), ptr_d.get(), stride_d.get()},
+      hw_info
+    };
+  }
+  else {
+    auto [m, n, k] = problems[0];
+    for (auto problem : problems) {
+      if (problem != problems[0]) {
+        std::cout << "Ptr-Array GEMM requires one problem size for all batches" << std::endl;
+        return false;
+      }
+    }
+    auto problem_shape_MNKL = make_shape(m, n, k, groups);
+
+    arguments = typename Gemm::Arguments{
+      cutlass::gemm::GemmUniversalMode::kArray,
+      {problem_shape_MNKL},
+      {ptr_a.get(), SparseConfig::fill_layoutA(problem_shape_MNKL),
+       ptr_b.get(), stride_b_host[0],
+       ptr_e.get(), SparseConfig::fill_layoutE(problem_shape_MNKL)},
+      {{}, ptr_c.get(), stride_c_host[0], ptr_d.get(), stride_d_host[0]},
+      hw_info
+    };
+  }
+  arguments.epilogue.thread.alpha = alpha;
+  arguments.epilogue.thread.beta = beta;
+
+  Gemm gemm;
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cout << "can_implement() failed" << std::endl;
+    return false;
+  }
+
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  cutlass::Status status = gemm.initialize(arguments, workspace.get());
+  if (status == cutlass::Status::kSuccess) {
+    status = gemm.run();
+  }
+  if (status != cutlass::Status::kSuccess) {
+    std::cout << "GEMM failed with status " << cutlassGetStatusString(status) << std::endl;
+    return false;
+  }
+
+  cudaError_t err = cudaDeviceSynchronize();
+  if (err != cudaSuccess) {
+    std::cout << __FILE__ << ":" << __LINE__ << " kernel failed with error: " << cudaGetErrorString(err) << std::endl;
+    return false;
+  }
+
+  // Inputs are small integers, so the products are exact in the f32 accumulator
+  std::vector<ElementD> tensor_d(total_c);
+  device_d.copy_to_host(tensor_d.data());
+  for (int g = 0; g < groups; ++g) {
+    int n = get<1>(problems[g]);
+    for (int64_t i = offset_c[g]; i < offset_c[g] + int64_t(get<0>(problems[g])) * n; ++i) {
+      if (float(tensor_d[i]) != float(ElementD(reference[i]))) {
+        std::cout << "Error in group " << g << " at (" << (i - offset_c[g]) / n << "," << (i - offset_c[g]) % n
+                  << "): got " << float(tensor_d[i]) << ", expected " << reference[i] << std::endl;
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class ProblemShape, class LayoutA, class LayoutB, class LayoutC,
+          class TileShape, class ClusterShape, class KernelSchedule, class EpilogueSchedule>
+struct SparseGroupGemm {
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape, ClusterShape,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      cutlass::half_t, LayoutC, 8,
+      cutlass::half_t, LayoutC, 8,
+      EpilogueSchedule
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassSparseTensorOp,
+      cutlass::half_t, LayoutA, 16,
+      cutlass::half_t, LayoutB, 8,
+      float,
+      TileShape, ClusterShape,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      ProblemShape,
+      CollectiveMainloop,
+      CollectiveEpilogue
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Sparse_Gemm_f16t_f16n_f16t_tensorop_f32_group_gemm, 128x128x64_1x2x1_cooperative) {
+  using Gemm = typename SparseGroupGemm<
+    cutlass::gemm::GroupProblemShape<Shape<int,int,int>>,
+    cutlass::layout::RowMajor *, cutlass::layout::ColumnMajor *, cutlass::layout::RowMajor *,
+    Shape<_128,_128,_64>, Shape<_1,_2,_1>,
+    cutlass::gemm::KernelPtrArrayTmaWarpSpecializedCooperative,
+    cutlass::epilogue::PtrArrayTmaWarpSpecializedCooperative>::Gemm;
+
+  EXPECT_TRUE(test_sparse_group_gemm<Gemm>({{256, 256, 512}, {128, 64, 128}, {512, 384, 256}}));
+  // Ragged M, N and K, including a group with a single K tile
+  EXPECT_TRUE(test_sparse_group_gemm<Gemm>({{200, 136, 320}, {64, 512, 64}, {1000, 264, 448}, {8, 8, 128}}));
+  EXPECT_TRUE(test_sparse_group_gemm<Gemm>({{256, 256, 512}}, 2.f, 0.f));
+}
+
+TEST(SM90_Device_Sparse_Gemm_f16t_f16n_f16t_tensorop_f32_group_gemm, 64x128x64_1x1x1_pingpong) {
+  using Gemm = typename SparseGroupGemm<
+    cutlass::gemm::GroupProblemShape<Shape<int,int,int>>,
+    cutlass::layout::RowMajor *, cutlass::layout::ColumnMajor *, cutlass::layout::RowMajor *,
+    Shape<_64,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelPtrArrayTmaWarpSpecializedPingpong,
+    cutlass::epilogue::PtrArrayTmaWarpSpecializedPingpong>::Gemm;
+
+  EXPECT_TRUE(test_sparse_group_gemm<Gemm>({{256, 256, 512}, {128, 64, 128}, {512, 384, 256}}));
+  EXPECT_TRUE(test_sparse_group_gemm<Gemm>({{200, 136, 320}, {64, 512, 64}, {1000, 264, 448}, {8, 8, 128}}));
+}
+
+TEST(SM90_Device_Sparse_Gemm_f16t_f16n_f16t_tensorop_f32_ptr_array, 128x128x64_1x2x1_cooperative) {
+  using Gemm = typename SparseGroupGemm<
+    cutlass::gemm::ArrayProblemShape<Shape<int,int,int,int>>,
+    cutlass::layout::RowMajor, cutlass::layout::ColumnMajor, cutlass::layout::RowMajor,
+    Shape<_128,_128,_64>, Shape<_1,_2,_1>,
+    cutlass::gemm::KernelPtrArrayTmaWarpSpecializedCooperative,
+    cutlass::epilogue::PtrArrayTmaWarpSpecializedCooperative>::Gemm;
+
+  EXPECT_TRUE(test_sparse_group_gemm<Gemm>({{256, 256, 512}, {256, 256, 512}, {256, 256, 512}}));
+  EXPECT_TRUE(test_sparse_group_gemm<Gemm>({{200, 136, 320}, {200, 136, 320}}));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SPARSE_SM90_SUPPORTED) && defined(CUTLASS_ARCH_MMA_MODIFIABLE_TMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,255 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for device-wide symmetric rank-k updates visiting only one triangle of the output
+*/
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+
+#include "cutlass/blas3_types.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/fusion/operations.hpp"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Runs the rank-k update C <= alpha * A * A^T + beta * C of an n x k matrix A on the triangle of
+/// the Gemm's fill mode, and compares against a host reference. Elements of the other triangle must
+/// equal C. If in_place is false, D is a separate, poisoned allocation.
+template <class Gemm, cutlass::FillMode FillMode>
+bool
+test_syrk(int n, int k, bool in_place, float alpha = 1.f, float beta = 0.5f) {
+  using ElementA = typename Gemm::ElementA;
+  using ElementC = typename Gemm::ElementC;
+  using ElementD = typename Gemm::ElementD;
+  using StrideA = typename Gemm::GemmKernel::StrideA;
+  using StrideB = typename Gemm::GemmKernel::StrideB;
+  using StrideC = typename Gemm::GemmKernel::StrideC;
+  using StrideD = typename Gemm::GemmKernel::StrideD;
+
+  std::mt19937 rng(2026);
+  std::uniform_int_distribution<int> dist(-2, 2);
+  std::vector<ElementA> tensor_a(size_t(n) * k);
+  std::vector<ElementC> tensor_c(size_t(n) * n);
+  for (auto& x : tensor_a) { x = ElementA(dist(rng)); }
+  for (auto& x : tensor_c) { x = ElementC(dist(rng)); }
+
+  // A is row-major, C and D are column-major
+  std::vector<float> reference(size_t(n) * n);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < n; ++i) {
+      bool is_inside = FillMode == cutlass::FillMode::kLower ? i >= j : i <= j;
+      float c = float(tensor_c[size_t(j) * n + i]);
+      if (!is_inside) {
+        reference[size_t(j) * n + i] = c;
+        continue;
+      }
+      float acc = 0.f;
+      for (int kk = 0; kk < k; ++kk) {
+        acc += float(tensor_a[size_t(i) * k + kk]) * float(tensor_a[size_t(j) * k + kk]);
+      }
+      reference[size_t(j) * n + i] = alpha * acc + beta * c;
+    }
+  }
+
+  cutlass::DeviceAllocation<ElementA> device_a(tensor_a.size());
+  cutlass::DeviceAllocation<ElementC> device_c(tensor_c.size());
+  cutlass::DeviceAllocation<ElementD> device_d(in_place ? 0 : tensor_c.size());
+  device_a.copy_from_host(tensor_a.data());
+  device_c.copy_from_host(tensor_c.data());
+  if (!in_place) {
+    std::vector<ElementD> poison(tensor_c.size(), ElementD(-99));
+    device_d.copy_from_host(poison.data());
+  }
+  ElementD* ptr_d = in_place ? reinterpret_cast<ElementD*>(device_c.get()) : device_d.get();
+
+  // B = A^T is A itself, viewed as the (N,K) operand
+  StrideA stride_a = cutlass::make_cute_packed_stride(StrideA{}, cute::make_shape(n, k, 1));
+  StrideB stride_b = cutlass::make_cute_packed_stride(StrideB{}, cute::make_shape(n, k, 1));
+  StrideC stride_c = cutlass::make_cute_packed_stride(StrideC{}, cute::make_shape(n, n, 1));
+  StrideD stride_d = cutlass::make_cute_packed_stride(StrideD{}, cute::make_shape(n, n, 1));
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(0);
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {n, n, k, 1},
+    {device_a.get(), stride_a, device_a.get(), stride_b},
+    {{alpha, beta}, device_c.get(), stride_c, ptr_d, stride_d},
+    hw_info
+  };
+
+  Gemm gemm;
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cout << "can_implement() failed" << std::endl;
+    return false;
+  }
+
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  cutlass::Status status = gemm.initialize(arguments, workspace.get());
+  if (status == cutlass::Status::kSuccess) {
+    status = gemm.run();
+  }
+  if (status != cutlass::Status::kSuccess) {
+    std::cout << "GEMM failed with status " << cutlassGetStatusString(status) << std::endl;
+    return false;
+  }
+
+  cudaError_t err = cudaDeviceSynchronize();
+  if (err != cudaSuccess) {
+    std::cout << __FILE__ << ":" << __LINE__ << " kernel failed with error: " << cudaGetErrorString(err) << std::endl;
+    return false;
+  }
+
+  // Inputs are small integers, so the products are exact in the f32 accumulator
+  std::vector<ElementD> tensor_d(tensor_c.size());
+  if (in_place) {
+    device_c.copy_to_host(reinterpret_cast<ElementC*>(tensor_d.data()));
+  }
+  else {
+    device_d.copy_to_host(tensor_d.data());
+  }
+  for (size_t idx = 0; idx < tensor_d.size(); ++idx) {
+    if (float(tensor_d[idx]) != reference[idx]) {
+      std::cout << "Error at (" << idx % n << "," << idx / n << "): got " << float(tensor_d[idx])
+                << ", expected " << reference[idx] << std::endl;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <cutlass::FillMode FillMode, class TileShape, class ClusterShape, class KernelSchedule, class EpilogueSchedule>
+struct TriangularSyrk {
+  using FusionOperation = cutlass::epilogue::fusion::LinCombTriangular<FillMode, float, float>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape, ClusterShape,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      float, cutlass::layout::ColumnMajor, 4,
+      float, cutlass::layout::ColumnMajor, 4,
+      EpilogueSchedule,
+      FusionOperation
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape, ClusterShape,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue,
+      cutlass::gemm::TriangularScheduler<FillMode>
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Syrk_f16t_f32n_tensor_op_gmma_f32_triangular, 128x128x64_1x1x1_cooperative_lower) {
+  constexpr auto Fill = cutlass::FillMode::kLower;
+  using Gemm = typename TriangularSyrk<Fill,
+    Shape<_128,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>::Gemm;
+
+  EXPECT_TRUE((test_syrk<Gemm, Fill>(1024, 512, true)));
+  EXPECT_TRUE((test_syrk<Gemm, Fill>(1000, 776, false)));
+  EXPECT_TRUE((test_syrk<Gemm, Fill>(136, 64, false, 2.f, 0.f)));
+}
+
+TEST(SM90_Device_Syrk_f16t_f32n_tensor_op_gmma_f32_triangular, 128x128x64_1x1x1_cooperative_upper) {
+  constexpr auto Fill = cutlass::FillMode::kUpper;
+  using Gemm = typename TriangularSyrk<Fill,
+    Shape<_128,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>::Gemm;
+
+  EXPECT_TRUE((test_syrk<Gemm, Fill>(1024, 512, true)));
+  EXPECT_TRUE((test_syrk<Gemm, Fill>(1000, 776, false)));
+}
+
+TEST(SM90_Device_Syrk_f16t_f32n_tensor_op_gmma_f32_triangular, 64x128x64_2x1x1_pingpong_lower) {
+  constexpr auto Fill = cutlass::FillMode::kLower;
+  using Gemm = typename TriangularSyrk<Fill,
+    Shape<_64,_128,_64>, Shape<_2,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedPingpong,
+    cutlass::epilogue::TmaWarpSpecialized>::Gemm;
+
+  EXPECT_TRUE((test_syrk<Gemm, Fill>(1024, 512, true)));
+  EXPECT_TRUE((test_syrk<Gemm, Fill>(904, 1032, false)));
+}
+
+TEST(SM90_Device_Syrk_f16t_f32n_tensor_op_gmma_f32_triangular, 64x128x64_2x1x1_pingpong_upper) {
+  constexpr auto Fill = cutlass::FillMode::kUpper;
+  using Gemm = typename TriangularSyrk<Fill,
+    Shape<_64,_128,_64>, Shape<_2,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedPingpong,
+    cutlass::epilogue::TmaWarpSpecialized>::Gemm;
+
+  EXPECT_TRUE((test_syrk<Gemm, Fill>(904, 1032, false)));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,338 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for device-wide products with a triangular operand (TRMM), and symmetric products (SYMM)
+           composed of two of them, which only visit the non-zero blocks of the triangular operand
+*/
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+
+#include "cutlass/blas3_types.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <
+  cutlass::SideMode SideMode,
+  cutlass::FillMode FillMode,
+  cutlass::DiagType DiagType,
+  class LayoutA,
+  class TileShape,
+  class ClusterShape
+>
+struct TriangularOperandGemm {
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape, ClusterShape,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      float, cutlass::layout::ColumnMajor, 4,
+      float, cutlass::layout::ColumnMajor, 4,
+      cutlass::epilogue::TmaWarpSpecializedCooperative
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, LayoutA, 8,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape, ClusterShape,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::gemm::KernelTmaWarpSpecializedCooperativeTriangularOperand<SideMode, FillMode, DiagType>
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue,
+      cutlass::gemm::TriangularOperandScheduler<SideMode, FillMode>
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Runs D <= alpha * A * B + beta * C on device allocations, with A of shape (m,k), B of shape (k,n)
+/// stored column-major, and C and D of shape (m,n) stored column-major
+template <class Gemm>
+bool
+run_gemm(int m, int n, int k,
+    cutlass::half_t const* ptr_a, cutlass::half_t const* ptr_b, float const* ptr_c, float* ptr_d,
+    float alpha, float beta) {
+  using StrideA = typename Gemm::GemmKernel::StrideA;
+  using StrideB = typename Gemm::GemmKernel::StrideB;
+  using StrideC = typename Gemm::GemmKernel::StrideC;
+  using StrideD = typename Gemm::GemmKernel::StrideD;
+
+  StrideA stride_a = cutlass::make_cute_packed_stride(StrideA{}, cute::make_shape(m, k, 1));
+  StrideB stride_b = cutlass::make_cute_packed_stride(StrideB{}, cute::make_shape(n, k, 1));
+  StrideC stride_c = cutlass::make_cute_packed_stride(StrideC{}, cute::make_shape(m, n, 1));
+  StrideD stride_d = cutlass::make_cute_packed_stride(StrideD{}, cute::make_shape(m, n, 1));
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(0);
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {m, n, k, 1},
+    {ptr_a, stride_a, ptr_b, stride_b},
+    {{alpha, beta}, ptr_c, stride_c, ptr_d, stride_d},
+    hw_info
+  };
+
+  Gemm gemm;
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cout << "can_implement() failed" << std::endl;
+    return false;
+  }
+
+  cutlass::DeviceAllocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  cutlass::Status status = gemm.initialize(arguments, workspace.get());
+  if (status == cutlass::Status::kSuccess) {
+    status = gemm.run();
+  }
+  if (status != cutlass::Status::kSuccess) {
+    std::cout << "GEMM failed with status " << cutlassGetStatusString(status) << std::endl;
+    return false;
+  }
+
+  cudaError_t err = cudaDeviceSynchronize();
+  if (err != cudaSuccess) {
+    std::cout << __FILE__ << ":" << __LINE__ << " kernel failed with error: " << cudaGetErrorString(err) << std::endl;
+    return false;
+  }
+  return true;
+}
+
+/// Compares the device result against a host reference. Inputs are small integers, so the products
+/// are exact in the f32 accumulator.
+bool
+verify(int m, cutlass::DeviceAllocation<float>& device_d, std::vector<float> const& reference) {
+  std::vector<float> tensor_d(reference.size());
+  device_d.copy_to_host(tensor_d.data());
+  for (size_t idx = 0; idx < tensor_d.size(); ++idx) {
+    if (tensor_d[idx] != reference[idx]) {
+      std::cout << "Error at (" << idx % m << "," << idx / m << "): got " << tensor_d[idx]
+                << ", expected " << reference[idx] << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Runs the TRMM D <= alpha * op(A) * B + beta * C (left) or D <= alpha * A * op(B) + beta * C (right),
+/// where op() selects the triangle and diagonal of the square triangular operand given by the Gemm.
+/// The unreferenced triangle of the triangular operand holds random values.
+template <class Gemm, cutlass::SideMode SideMode, cutlass::FillMode FillMode, cutlass::DiagType DiagType>
+bool
+test_trmm(int m, int n, float alpha = 1.f, float beta = 0.5f) {
+  int k = SideMode == cutlass::SideMode::kLeft ? m : n;
+
+  std::mt19937 rng(2026);
+  std::uniform_int_distribution<int> dist(-2, 2);
+  std::vector<cutlass::half_t> tensor_a(size_t(m) * k);
+  std::vector<cutlass::half_t> tensor_b(size_t(k) * n);
+  std::vector<float> tensor_c(size_t(m) * n);
+  for (auto& x : tensor_a) { x = cutlass::half_t(dist(rng)); }
+  for (auto& x : tensor_b) { x = cutlass::half_t(dist(rng)); }
+  for (auto& x : tensor_c) { x = float(dist(rng)); }
+
+  // Value of the element (row, col) of the triangular operand as referenced by the product
+  auto triangular = [](int row, int col, float x) {
+    if (row == col) {
+      return DiagType == cutlass::DiagType::kUnit ? 1.f : x;
+    }
+    bool is_inside = FillMode == cutlass::FillMode::kLower ? row > col : row < col;
+    return is_inside ? x : 0.f;
+  };
+
+  // A is row-major, B, C and D are column-major
+  std::vector<float> reference(size_t(m) * n);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < m; ++i) {
+      float acc = 0.f;
+      for (int kk = 0; kk < k; ++kk) {
+        float a = float(tensor_a[size_t(i) * k + kk]);
+        float b = float(tensor_b[size_t(j) * k + kk]);
+        if constexpr (SideMode == cutlass::SideMode::kLeft) {
+          a = triangular(i, kk, a);
+        }
+        else {
+          b = triangular(kk, j, b);
+        }
+        acc += a * b;
+      }
+      reference[size_t(j) * m + i] = alpha * acc + beta * tensor_c[size_t(j) * m + i];
+    }
+  }
+
+  cutlass::DeviceAllocation<cutlass::half_t> device_a(tensor_a.size());
+  cutlass::DeviceAllocation<cutlass::half_t> device_b(tensor_b.size());
+  cutlass::DeviceAllocation<float> device_c(tensor_c.size());
+  cutlass::DeviceAllocation<float> device_d(tensor_c.size());
+  device_a.copy_from_host(tensor_a.data());
+  device_b.copy_from_host(tensor_b.data());
+  device_c.copy_from_host(tensor_c.data());
+
+  if (!run_gemm<Gemm>(m, n, k, device_a.get(), device_b.get(), device_c.get(), device_d.get(), alpha, beta)) {
+    return false;
+  }
+  return verify(m, device_d, reference);
+}
+
+/// Runs the SYMM D <= alpha * A * B + beta * C of a symmetric m x m A of which only the lower triangle
+/// is stored, as two triangular operand GEMMs: D <= alpha * tril(A) * B + beta * C with the row-major A,
+/// then D <= alpha * triu(A^T, 1) * B + D with the same allocation viewed as the column-major A^T.
+template <class GemmLower, class GemmStrictlyUpper>
+bool
+test_symm(int m, int n, float alpha = 1.f, float beta = 0.5f) {
+  std::mt19937 rng(2026);
+  std::uniform_int_distribution<int> dist(-2, 2);
+  std::vector<cutlass::half_t> tensor_a(size_t(m) * m);
+  std::vector<cutlass::half_t> tensor_b(size_t(m) * n);
+  std::vector<float> tensor_c(size_t(m) * n);
+  for (auto& x : tensor_a) { x = cutlass::half_t(dist(rng)); }
+  for (auto& x : tensor_b) { x = cutlass::half_t(dist(rng)); }
+  for (auto& x : tensor_c) { x = float(dist(rng)); }
+
+  std::vector<float> reference(size_t(m) * n);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < m; ++i) {
+      float acc = 0.f;
+      for (int kk = 0; kk < m; ++kk) {
+        float a = i >= kk ? float(tensor_a[size_t(i) * m + kk]) : float(tensor_a[size_t(kk) * m + i]);
+        acc += a * float(tensor_b[size_t(j) * m + kk]);
+      }
+      reference[size_t(j) * m + i] = alpha * acc + beta * tensor_c[size_t(j) * m + i];
+    }
+  }
+
+  cutlass::DeviceAllocation<cutlass::half_t> device_a(tensor_a.size());
+  cutlass::DeviceAllocation<cutlass::half_t> device_b(tensor_b.size());
+  cutlass::DeviceAllocation<float> device_c(tensor_c.size());
+  cutlass::DeviceAllocation<float> device_d(tensor_c.size());
+  device_a.copy_from_host(tensor_a.data());
+  device_b.copy_from_host(tensor_b.data());
+  device_c.copy_from_host(tensor_c.data());
+
+  if (!run_gemm<GemmLower>(m, n, m, device_a.get(), device_b.get(), device_c.get(), device_d.get(), alpha, beta)) {
+    return false;
+  }
+  if (!run_gemm<GemmStrictlyUpper>(m, n, m, device_a.get(), device_b.get(), device_d.get(), device_d.get(), alpha, 1.f)) {
+    return false;
+  }
+  return verify(m, device_d, reference);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Trmm_f16t_f16n_f32n_tensor_op_gmma_f32_triangular_operand, 128x128x64_1x1x1_left_lower_nonunit) {
+  constexpr auto Side = cutlass::SideMode::kLeft;
+  constexpr auto Fill = cutlass::FillMode::kLower;
+  constexpr auto Diag = cutlass::DiagType::kNonUnit;
+  using Gemm = typename TriangularOperandGemm<Side, Fill, Diag, cutlass::layout::RowMajor,
+    Shape<_128,_128,_64>, Shape<_1,_1,_1>>::Gemm;
+
+  EXPECT_TRUE((test_trmm<Gemm, Side, Fill, Diag>(1024, 512)));
+  EXPECT_TRUE((test_trmm<Gemm, Side, Fill, Diag>(1000, 776)));
+  EXPECT_TRUE((test_trmm<Gemm, Side, Fill, Diag>(136, 64, 2.f, 0.f)));
+}
+
+TEST(SM90_Device_Trmm_f16t_f16n_f32n_tensor_op_gmma_f32_triangular_operand, 128x128x64_1x2x1_left_upper_unit) {
+  constexpr auto Side = cutlass::SideMode::kLeft;
+  constexpr auto Fill = cutlass::FillMode::kUpper;
+  constexpr auto Diag = cutlass::DiagType::kUnit;
+  using Gemm = typename TriangularOperandGemm<Side, Fill, Diag, cutlass::layout::RowMajor,
+    Shape<_128,_128,_64>, Shape<_1,_2,_1>>::Gemm;
+
+  EXPECT_TRUE((test_trmm<Gemm, Side, Fill, Diag>(1024, 512)));
+  EXPECT_TRUE((test_trmm<Gemm, Side, Fill, Diag>(1000, 776)));
+}
+
+TEST(SM90_Device_Trmm_f16t_f16n_f32n_tensor_op_gmma_f32_triangular_operand, 128x128x64_2x1x1_right_lower_nonunit) {
+  constexpr auto Side = cutlass::SideMode::kRight;
+  constexpr auto Fill = cutlass::FillMode::kLower;
+  constexpr auto Diag = cutlass::DiagType::kNonUnit;
+  using Gemm = typename TriangularOperandGemm<Side, Fill, Diag, cutlass::layout::RowMajor,
+    Shape<_128,_128,_64>, Shape<_2,_1,_1>>::Gemm;
+
+  EXPECT_TRUE((test_trmm<Gemm, Side, Fill, Diag>(512, 1024)));
+  EXPECT_TRUE((test_trmm<Gemm, Side, Fill, Diag>(776, 1000)));
+}
+
+TEST(SM90_Device_Trmm_f16t_f16n_f32n_tensor_op_gmma_f32_triangular_operand, 128x128x64_1x1x1_right_upper_unit) {
+  constexpr auto Side = cutlass::SideMode::kRight;
+  constexpr auto Fill = cutlass::FillMode::kUpper;
+  constexpr auto Diag = cutlass::DiagType::kUnit;
+  using Gemm = typename TriangularOperandGemm<Side, Fill, Diag, cutlass::layout::RowMajor,
+    Shape<_128,_128,_64>, Shape<_1,_1,_1>>::Gemm;
+
+  EXPECT_TRUE((test_trmm<Gemm, Side, Fill, Diag>(512, 1024)));
+  EXPECT_TRUE((test_trmm<Gemm, Side, Fill, Diag>(776, 1000)));
+}
+
+TEST(SM90_Device_Symm_f16t_f16n_f32n_tensor_op_gmma_f32_triangular_operand, 128x128x64_1x1x1_left_lower) {
+  using GemmLower = typename TriangularOperandGemm<
+    cutlass::SideMode::kLeft, cutlass::FillMode::kLower, cutlass::DiagType::kNonUnit, cutlass::layout::RowMajor,
+    Shape<_128,_128,_64>, Shape<_1,_1,_1>>::Gemm;
+  using GemmStrictlyUpper = typename TriangularOperandGemm<
+    cutlass::SideMode::kLeft, cutlass::FillMode::kUpper, cutlass::DiagType::kZero, cutlass::layout::ColumnMajor,
+    Shape<_128,_128,_64>, Shape<_1,_1,_1>>::Gemm;
+
+  EXPECT_TRUE((test_symm<GemmLower, GemmStrictlyUpper>(1024, 512)));
+  EXPECT_TRUE((test_symm<GemmLower, GemmStrictlyUpper>(1000, 776)));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
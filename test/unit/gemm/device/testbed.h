@@ -276,7 +276,8 @@ struct Testbed {
       tensor_B.host_ref(), 
       beta, 
       reference_D.host_ref(), 
-      ElementAccumulator(0)
+      ElementAccumulator(0),
+      0 /* num_threads, all hardware threads */
     );
 
     if (Relu) {
@@ -0,0 +1,127 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Unit tests for the host-side decoding of pipeline stall and region traces
+*/
+
+#include "../common/cutlass_unit_test.h"
+
+#include <sstream>
+#include <vector>
+
+#include "cutlass/pipeline/pipeline_trace.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+cutlass::PipelineTraceRecord make_record(
+  cutlass::PipelineTraceEvent event, uint32_t stage, uint64_t start, uint32_t duration, uint32_t warp) {
+
+  cutlass::PipelineTraceRecord record{};
+  record.start = start;
+  record.duration = duration;
+  record.event = static_cast<uint16_t>(event);
+  record.stage = static_cast<uint16_t>(stage);
+  record.block = 0;
+  record.warp = warp;
+  record.pipeline = 1024;
+  record.sm = 0;
+  return record;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(PipelineTrace, Histograms) {
+  using cutlass::PipelineTraceEvent;
+
+  std::vector<cutlass::PipelineTraceRecord> records = {
+    make_record(PipelineTraceEvent::kProducerAcquire, 0, 1000, 0, 0),
+    make_record(PipelineTraceEvent::kProducerAcquire, 0, 2000, 3, 0),
+    make_record(PipelineTraceEvent::kProducerAcquire, 0, 3000, 1500, 0),
+    make_record(PipelineTraceEvent::kConsumerWait, 1, 1500, 40, 4),
+  };
+
+  auto histograms = cutlass::pipeline_trace_histograms(records);
+  ASSERT_EQ(histograms.size(), size_t(2));
+
+  auto const& producer = histograms.at({1024, PipelineTraceEvent::kProducerAcquire, 0});
+  EXPECT_EQ(producer.count, uint64_t(3));
+  EXPECT_EQ(producer.total_ns, uint64_t(1503));
+  EXPECT_EQ(producer.max_ns, uint32_t(1500));
+  EXPECT_EQ(producer.buckets[0], uint64_t(1));   // 0 ns
+  EXPECT_EQ(producer.buckets[1], uint64_t(1));   // [2, 4) ns
+  EXPECT_EQ(producer.buckets[10], uint64_t(1));  // [1024, 2048) ns
+
+  auto const& consumer = histograms.at({1024, PipelineTraceEvent::kConsumerWait, 1});
+  EXPECT_EQ(consumer.count, uint64_t(1));
+  EXPECT_EQ(consumer.buckets[5], uint64_t(1));   // [32, 64) ns
+}
+
+TEST(PipelineTrace, ChromeTrace) {
+  using cutlass::PipelineTraceEvent;
+
+  std::vector<cutlass::PipelineTraceRecord> records = {
+    make_record(PipelineTraceEvent::kConsumerWait, 2, 5000, 1250, 4),
+    make_record(PipelineTraceEvent::kProducerAcquire, 1, 7500, 20, 0),
+  };
+
+  std::stringstream ss;
+  cutlass::pipeline_trace_write_chrome_trace(ss, records);
+  std::string trace = ss.str();
+
+  // Timestamps are relative to the earliest record and expressed in microseconds
+  EXPECT_NE(trace.find("\"name\":\"consumer_wait\",\"cat\":\"stage2\",\"ph\":\"X\",\"ts\":0.000,\"dur\":1.250,\"pid\":0,\"tid\":4"), std::string::npos);
+  EXPECT_NE(trace.find("\"name\":\"producer_acquire\",\"cat\":\"stage1\",\"ph\":\"X\",\"ts\":2.500,\"dur\":0.020,\"pid\":0,\"tid\":0"), std::string::npos);
+  EXPECT_EQ(trace.front(), '{');
+}
+
+TEST(PipelineTrace, Regions) {
+  using cutlass::PipelineTraceEvent;
+
+  auto region = make_record(PipelineTraceEvent::kEpilogue, 0, 9000, 4000, 8);
+  region.pipeline = 0;
+  std::vector<cutlass::PipelineTraceRecord> records = {
+    make_record(PipelineTraceEvent::kConsumerWait, 0, 8000, 100, 8),
+    region,
+  };
+
+  std::stringstream ss;
+  cutlass::pipeline_trace_write_chrome_trace(ss, records);
+  std::string trace = ss.str();
+
+  EXPECT_NE(trace.find("\"name\":\"epilogue\",\"cat\":\"region\",\"ph\":\"X\",\"ts\":1.000,\"dur\":4.000,\"pid\":0,\"tid\":8"), std::string::npos);
+  EXPECT_NE(trace.find("\"name\":\"consumer_wait\",\"cat\":\"stage0\""), std::string::npos);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
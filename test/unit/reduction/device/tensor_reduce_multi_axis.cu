@@ -0,0 +1,308 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for TensorReductionMultiAxis
+*/
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "cute/layout.hpp"
+
+#include "cutlass/cutlass.h"
+#include "cutlass/core_io.h"
+#include "cutlass/functional.h"
+#include "cutlass/reduction/device/tensor_reduce_multi_axis.h"
+
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/reference/host/tensor_fill.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Square root applied to the reduced elements of an L2 norm
+struct SquareRoot {
+  CUTLASS_HOST_DEVICE
+  float operator()(float x) const {
+    return sqrtf(x);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Reduces the modes of a packed tensor of shape 'src_shape' selected by 'reduced_modes' and
+/// compares against a host reference. 'dst_shape' has an extent of one in each reduced mode.
+template <typename TensorReduction, typename SrcShape, typename DstShape>
+bool TestMultiAxisReduction(
+  SrcShape const &src_shape,
+  DstShape const &dst_shape,
+  uint32_t reduced_modes,
+  int64_t alignment_offset = 0,
+  typename TensorReduction::ElementCompute reduction_identity = typename TensorReduction::ElementCompute()) {
+
+  using ElementOutput = typename TensorReduction::ElementOutput;
+  using ElementSource = typename TensorReduction::ElementSource;
+  using ElementCompute = typename TensorReduction::ElementCompute;
+
+  auto src_layout = cute::make_layout(src_shape, cute::LayoutRight{});
+  auto dst_layout = cute::make_layout(dst_shape, cute::LayoutRight{});
+
+  int64_t src_size = cute::size(src_layout);
+  int64_t dst_size = cute::size(dst_layout);
+
+  std::vector<ElementSource> src_host(src_size + alignment_offset);
+  std::vector<ElementOutput> dst_host(dst_size + alignment_offset);
+
+  cutlass::reference::host::BlockFillRandomUniform(src_host.data(), src_host.size(), 2023, 3, -3, 0);
+
+  cutlass::DeviceAllocation<ElementSource> src_device(src_host.size());
+  cutlass::DeviceAllocation<ElementOutput> dst_device(dst_host.size());
+
+  src_device.copy_from_host(src_host.data());
+
+  TensorReduction reduction(src_layout, dst_layout, reduced_modes);
+
+  EXPECT_TRUE(reduction.good());
+
+  cutlass::DeviceAllocation<uint8_t> device_workspace(reduction.workspace_size());
+
+  cutlass::Status status = reduction.reduce(
+    dst_device.get() + alignment_offset,
+    src_device.get() + alignment_offset,
+    device_workspace.get(),
+    reduction_identity);
+
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  EXPECT_EQ(cudaDeviceSynchronize(), cudaSuccess);
+
+  dst_device.copy_to_host(dst_host.data());
+
+  //
+  // Reference
+  //
+
+  typename TensorReduction::ReductionOp reduction_op;
+  typename TensorReduction::PreOp pre_op;
+  typename TensorReduction::PostOp post_op;
+
+  std::vector<ElementCompute> reference(dst_size, reduction_identity);
+
+  for (int64_t idx = 0; idx < src_size; ++idx) {
+    auto coord = cute::idx2crd(idx, src_shape);
+
+    int64_t dst_offset = 0;
+    cute::for_each(cute::make_seq<decltype(cute::rank(src_shape))::value>{}, [&](auto i) {
+      if (!((reduced_modes >> i) & 1)) {
+        dst_offset += int64_t(cute::get<i>(coord)) * cute::stride<i>(dst_layout);
+      }
+    });
+
+    ElementCompute element = pre_op(ElementCompute(src_host[alignment_offset + src_layout(coord)]));
+    reference[dst_offset] = reduction_op(reference[dst_offset], element);
+  }
+
+  for (int64_t idx = 0; idx < dst_size; ++idx) {
+
+    ElementCompute expected = ElementCompute(ElementOutput(post_op(reference[idx])));
+    ElementCompute got = ElementCompute(dst_host[alignment_offset + idx]);
+
+    bool equal = (std::abs(float(expected - got)) <= 1e-3f * (1 + std::abs(float(expected))));
+
+    EXPECT_TRUE(equal);
+    if (!equal) {
+      auto const &plan = reduction.plan(dst_device.get() + alignment_offset, src_device.get() + alignment_offset);
+
+      std::cerr
+        << "Error at offset " << idx << std::endl
+        << "  expected: " << expected << std::endl
+        << "       got: " << got << std::endl
+        << "Problem: " << src_shape << " -> " << dst_shape << std::endl
+        << "   Grid: " << plan.grid_shape
+        << "\n  Block: " << plan.threadblock_shape << std::endl
+        << "  Final: " << plan.grid_final
+        << "\n  Block: " << plan.threadblock_final << "\n";
+
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Test tensor reduction from NHWC to NC
+TEST(Reduction_TensorReduceMultiAxis, nhwc_reduce_hw_f32_f16x8) {
+
+  using TensorReduction = cutlass::reduction::device::TensorReductionMultiAxis<
+    4,
+    float,
+    cutlass::half_t,
+    cutlass::plus<float>
+  >;
+
+  static_assert(TensorReduction::kVectorLength == 8, "Expected 128b accesses");
+
+  int const N_indices[] = {1, 3, 32};
+  int const HW_indices[] = {1, 7, 56};
+  int const C_indices[] = {8, 64, 264, 2048};
+
+  for (int N : N_indices) {
+    for (int HW : HW_indices) {
+      for (int C : C_indices) {
+        EXPECT_TRUE(TestMultiAxisReduction<TensorReduction>(
+          cute::make_shape(N, HW, HW, C), cute::make_shape(N, 1, 1, C), 0b0110));
+      }
+    }
+  }
+}
+
+/// Test tensor reduction from NHWC to C
+TEST(Reduction_TensorReduceMultiAxis, nhwc_reduce_nhw_f32x4) {
+
+  using TensorReduction = cutlass::reduction::device::TensorReductionMultiAxis<
+    4,
+    float,
+    float,
+    cutlass::plus<float>
+  >;
+
+  int const N_indices[] = {1, 4, 16};
+  int const HW_indices[] = {3, 28, 112};
+  int const C_indices[] = {4, 32, 96};
+
+  for (int N : N_indices) {
+    for (int HW : HW_indices) {
+      for (int C : C_indices) {
+        EXPECT_TRUE(TestMultiAxisReduction<TensorReduction>(
+          cute::make_shape(N, HW, HW, C), cute::make_shape(1, 1, 1, C), 0b0111));
+      }
+    }
+  }
+}
+
+/// Test tensor reduction from NHWC to N
+TEST(Reduction_TensorReduceMultiAxis, nhwc_reduce_hwc_f32_f16x8) {
+
+  using TensorReduction = cutlass::reduction::device::TensorReductionMultiAxis<
+    4,
+    float,
+    cutlass::half_t,
+    cutlass::plus<float>
+  >;
+
+  int const N_indices[] = {1, 5, 300};
+  int const HW_indices[] = {1, 14, 56};
+  int const C_indices[] = {8, 24, 512};
+
+  for (int N : N_indices) {
+    for (int HW : HW_indices) {
+      for (int C : C_indices) {
+        EXPECT_TRUE(TestMultiAxisReduction<TensorReduction>(
+          cute::make_shape(N, HW, HW, C), cute::make_shape(N, 1, 1, 1), 0b1110));
+      }
+    }
+  }
+}
+
+/// Test tensor reduction from NHWC to NW, reducing both a strided and the contiguous mode
+TEST(Reduction_TensorReduceMultiAxis, nhwc_reduce_hc_f32x4) {
+
+  using TensorReduction = cutlass::reduction::device::TensorReductionMultiAxis<
+    4,
+    float,
+    float,
+    cutlass::maximum<float>
+  >;
+
+  EXPECT_TRUE(TestMultiAxisReduction<TensorReduction>(
+    cute::make_shape(6, 9, 10, 32), cute::make_shape(6, 1, 10, 1), 0b1010, 0, -1000.0f));
+  EXPECT_TRUE(TestMultiAxisReduction<TensorReduction>(
+    cute::make_shape(2, 300, 4, 12), cute::make_shape(2, 1, 4, 1), 0b1010, 0, -1000.0f));
+}
+
+/// Test tensor reduction from NDHWC to NC
+TEST(Reduction_TensorReduceMultiAxis, ndhwc_reduce_dhw_f32_f16x8) {
+
+  using TensorReduction = cutlass::reduction::device::TensorReductionMultiAxis<
+    5,
+    float,
+    cutlass::half_t,
+    cutlass::plus<float>
+  >;
+
+  EXPECT_TRUE(TestMultiAxisReduction<TensorReduction>(
+    cute::make_shape(2, 4, 14, 14, 64), cute::make_shape(2, 1, 1, 1, 64), 0b01110));
+  EXPECT_TRUE(TestMultiAxisReduction<TensorReduction>(
+    cute::make_shape(1, 16, 28, 28, 8), cute::make_shape(1, 1, 1, 1, 8), 0b01110));
+}
+
+/// Test an L2 norm over (H, W) with fused elementwise operators
+TEST(Reduction_TensorReduceMultiAxis, nhwc_norm_hw_f16_f16x8) {
+
+  using TensorReduction = cutlass::reduction::device::TensorReductionMultiAxis<
+    4,
+    cutlass::half_t,
+    cutlass::half_t,
+    cutlass::plus<float>,
+    8,
+    float,
+    cutlass::square<float>,
+    SquareRoot
+  >;
+
+  EXPECT_TRUE(TestMultiAxisReduction<TensorReduction>(
+    cute::make_shape(4, 7, 7, 256), cute::make_shape(4, 1, 1, 256), 0b0110));
+  EXPECT_TRUE(TestMultiAxisReduction<TensorReduction>(
+    cute::make_shape(1, 64, 64, 16), cute::make_shape(1, 64, 1, 1), 0b1100));
+}
+
+/// Test fallback to scalar accesses for extents and pointers which are not 128b aligned
+TEST(Reduction_TensorReduceMultiAxis, nhwc_reduce_hw_unaligned_f32_f16x8) {
+
+  using TensorReduction = cutlass::reduction::device::TensorReductionMultiAxis<
+    4,
+    float,
+    cutlass::half_t,
+    cutlass::plus<float>
+  >;
+
+  EXPECT_TRUE(TestMultiAxisReduction<TensorReduction>(
+    cute::make_shape(3, 9, 9, 13), cute::make_shape(3, 1, 1, 13), 0b0110));
+  EXPECT_TRUE(TestMultiAxisReduction<TensorReduction>(
+    cute::make_shape(3, 9, 9, 64), cute::make_shape(3, 1, 1, 64), 0b0110, 1));
+  EXPECT_TRUE(TestMultiAxisReduction<TensorReduction>(
+    cute::make_shape(3, 9, 9, 64), cute::make_shape(3, 1, 1, 1), 0b1110, 3));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -42,6 +42,7 @@
 // ElementA : fp32
 // LayoutA : row / col
 // Gemm : 1x 2x 3x multiplier of alignment requirement. corner case that smaller than alignment requirement
+// Prune : dense A, magnitude pruned to 2:4 (1:2 for tf32) by the compressor
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 #if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
@@ -92,4 +93,28 @@ TEST(SM90_Structured_Sparse_Gemm_Compressor_Device, f32_n)
   EXPECT_TRUE(testbed.run_auto());
 }
 
+TEST(SM90_Structured_Sparse_Gemm_Compressor_Device, f32_t_prune)
+{
+  // Test Settings
+  using ElementA = float;
+  using LayoutATag = cutlass::layout::RowMajor;
+
+  // Deduct From Test Setting
+  static constexpr cute::GMMA::Major GmmaMajorA = cutlass::gemm::collective::detail::gmma_rs_tag_to_major_A<LayoutATag>();
+  using ElementAMma = cute::sparse_elem<2, ElementA>;
+  using ElementEMma = cute::sparse_elem<4, uint8_t>;
+
+  using SparseConfig = cutlass::Sm90GemmSparseConfig<ElementAMma, GmmaMajorA, ElementEMma, cute::Int<16>>;
+
+  using CompressorKernel = cutlass::transform::kernel::
+      StructuredSparseCompressor<cute::Shape<int, int, int, int>, ElementA, LayoutATag, SparseConfig, cutlass::arch::Sm90>;
+
+  using Compressor = cutlass::transform::device::TransformUniversalAdapter<CompressorKernel>;
+
+  // Test Bed
+  test::transform::device::TestbedSparseGemmCompressor<Compressor> testbed;
+  testbed.prune = true;
+  EXPECT_TRUE(testbed.run_auto());
+}
+
 #endif // #if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
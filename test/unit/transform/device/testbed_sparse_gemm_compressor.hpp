@@ -304,12 +304,19 @@ public:
     EXPECT_TRUE(initialize_tensor(datas.tensor_A_Comp.host_view(), init_A_Comp, seed + 4));
     EXPECT_TRUE(initialize_tensor(datas.tensor_A_Comp_ref.host_view(), init_A_Comp, seed + 5));
 
-    compressor_utility.structure_sparse_zero_mask_fill(datas.tensor_A.host_data(), seed + 6);
+    if (prune) {
+      // Device prunes the dense tensor, the host reference compresses a pre-pruned copy of it
+      datas.tensor_A.sync_device();
+      compressor_utility.structure_sparse_magnitude_prune(datas.tensor_A.host_data());
+    }
+    else {
+      compressor_utility.structure_sparse_zero_mask_fill(datas.tensor_A.host_data(), seed + 6);
+      datas.tensor_A.sync_device();
+    }
 
     // Check for failed device
     CUDA_CHECK_FALSE(cudaGetLastError());
 
-    datas.tensor_A.sync_device();
     datas.tensor_A_Comp.sync_device();
     datas.tensor_E.sync_device();
 
@@ -338,7 +345,8 @@ public:
         {datas.tensor_A.device_data(),
          stride_a,
          datas.tensor_A_Comp.device_data(),
-         datas.tensor_E.device_data()},
+         datas.tensor_E.device_data(),
+         prune},
         {hw_info}
     };
 
@@ -866,6 +874,8 @@ public:
   cutlass::Distribution::Kind init_A_Comp;
   cutlass::Distribution::Kind init_E;
   uint64_t seed;
+  // Compress a dense A by magnitude pruning on device instead of a pre-sparsified A
+  bool prune = false;
 };
 
 }  // namespace device
@@ -0,0 +1,172 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests cutlass::transform::kernel::SM1xxBlockScaledScaleFactorReorder
+*/
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "cutlass/cutlass.h"
+
+#include "cutlass/detail/sm100_blockscaled_layout.hpp"
+#include "cutlass/detail/sm103_blockscaled_layout.hpp"
+#include "cutlass/transform/kernel/sm1xx_blockscaled_scale_factor_reorder.hpp"
+#include "cutlass/transform/device/transform_universal_adapter.hpp"
+
+#include "thrust/universal_vector.h"
+#include "thrust/host_vector.h"
+#include "thrust/device_vector.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class ElementSF, class BlockScaledConfig>
+bool reorder_test(int mn, int k, int l, int ld_padding = 0) {
+  using namespace cute;
+
+  using ReorderKernel = cutlass::transform::kernel::SM1xxBlockScaledScaleFactorReorder<ElementSF, BlockScaledConfig>;
+  using Reorder = cutlass::transform::device::TransformUniversalAdapter<ReorderKernel>;
+
+  constexpr int SFVecSize = BlockScaledConfig::SFVecSize;
+  int sf_k = cutlass::ceil_div(k, SFVecSize);
+  int ld = sf_k + ld_padding;
+
+  thrust::host_vector<uint8_t> h_SF(size_t(mn) * ld * l);
+  for (size_t i = 0; i < h_SF.size(); ++i) {
+    h_SF[i] = static_cast<uint8_t>((i * 37 + i / 7) % 255 + 1);
+  }
+  thrust::device_vector<uint8_t> d_SF = h_SF;
+
+  typename ReorderKernel::ProblemShape problem_shape{mn, k, l};
+  auto layout_SF_reordered = ReorderKernel::get_layout_SF_reordered(problem_shape);
+  // Fill with a non-zero pattern to check that padding is cleared
+  thrust::device_vector<uint8_t> d_SF_reordered(cosize(layout_SF_reordered), 0xff);
+
+  typename ReorderKernel::StrideSF stride_SF{int64_t(ld), _1{}, int64_t(mn) * ld};
+  typename Reorder::Arguments args{
+    problem_shape,
+    reinterpret_cast<ElementSF const*>(d_SF.data().get()),
+    stride_SF,
+    reinterpret_cast<ElementSF*>(d_SF_reordered.data().get())
+  };
+
+  Reorder reorder_op;
+  cutlass::Status status = Reorder::can_implement(args);
+  EXPECT_TRUE(status == cutlass::Status::kSuccess);
+  if (status != cutlass::Status::kSuccess) {
+    return false;
+  }
+
+  size_t workspace_size = Reorder::get_workspace_size(args);
+  thrust::universal_vector<uint8_t> workspace(workspace_size);
+
+  status = reorder_op.initialize(args, workspace.data().get());
+  if (status != cutlass::Status::kSuccess) {
+    cudaError_t error = cudaGetLastError();
+    std::cerr << "This test is not supported: " << cudaGetErrorString(error) << "\n";
+    return false;
+  }
+
+  status = reorder_op();
+  EXPECT_TRUE(status == cutlass::Status::kSuccess);
+  if (status != cutlass::Status::kSuccess) {
+    return false;
+  }
+
+  cudaError_t result = cudaDeviceSynchronize();
+  EXPECT_EQ(result, cudaSuccess) << " Kernel execution error: "
+                                 << cudaGetErrorString(result);
+
+  //
+  // Verification
+  //
+
+  thrust::host_vector<uint8_t> h_SF_reordered = d_SF_reordered;
+  // The reordered layout must match the one the GEMM collectives build for SFA
+  auto layout_SFA = BlockScaledConfig::tile_atom_to_shape_SFA(make_shape(mn, 1, k, l));
+  EXPECT_EQ(cosize(layout_SFA), cosize(layout_SF_reordered));
+
+  // Every scale factor of the padded problem is written exactly once, padding as zero
+  thrust::host_vector<int> h_reference(h_SF_reordered.size(), 0);
+  for (int i = 0; i < l; ++i) {
+    for (int m = 0; m < mn; ++m) {
+      for (int s = 0; s < sf_k; ++s) {
+        h_reference[layout_SFA(m, s * SFVecSize, i)] = h_SF[(size_t(i) * mn + m) * ld + s];
+      }
+    }
+  }
+
+  int32_t errors = 0;
+  int32_t const kErrorLimit = 10;
+  for (size_t i = 0; i < h_SF_reordered.size(); ++i) {
+    if (int(h_SF_reordered[i]) != h_reference[i]) {
+      std::cerr << "Error. SF_reordered[" << i << "]: " << int(h_SF_reordered[i])
+                << ",   expected: " << h_reference[i] << std::endl;
+      if (++errors >= kErrorLimit) {
+        std::cerr << "Aborting on " << kErrorLimit << "nth error." << std::endl;
+        return false;
+      }
+    }
+  }
+
+  return errors == 0;
+}
+
+#if defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED) || defined(CUTLASS_ARCH_MMA_SM103_SUPPORTED)
+
+TEST(Transform_kernel_SM1xxBlockScaledScaleFactorReorder, sm100_nvfp4) {
+  using Config = cutlass::detail::Sm1xxBlockScaledConfig<16>;
+  bool passed = true;
+  passed &= reorder_test<cutlass::float_ue4m3_t, Config>(256, 2048, 1);
+  // Partial tiles along MN and K
+  passed &= reorder_test<cutlass::float_ue4m3_t, Config>(200, 1600, 2);
+  // Unaligned leading dimension falls back to byte loads
+  passed &= reorder_test<cutlass::float_ue4m3_t, Config>(130, 512, 1, 3);
+  EXPECT_TRUE(passed);
+}
+
+TEST(Transform_kernel_SM1xxBlockScaledScaleFactorReorder, sm100_mxf8) {
+  using Config = cutlass::detail::Sm1xxBlockScaledConfig<32>;
+  bool passed = true;
+  passed &= reorder_test<cutlass::float_ue8m0_t, Config>(512, 4096, 1);
+  passed &= reorder_test<cutlass::float_ue8m0_t, Config>(96, 352, 3);
+  EXPECT_TRUE(passed);
+}
+
+TEST(Transform_kernel_SM1xxBlockScaledScaleFactorReorder, sm103_nvfp4) {
+  using Config = cutlass::detail::Sm103BlockScaledConfig<16>;
+  bool passed = true;
+  passed &= reorder_test<cutlass::float_ue4m3_t, Config>(256, 2048, 1);
+  passed &= reorder_test<cutlass::float_ue4m3_t, Config>(384, 1600, 2);
+  passed &= reorder_test<cutlass::float_ue4m3_t, Config>(130, 512, 1, 3);
+  EXPECT_TRUE(passed);
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED) || defined(CUTLASS_ARCH_MMA_SM103_SUPPORTED)
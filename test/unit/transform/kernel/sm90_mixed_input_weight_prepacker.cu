@@ -0,0 +1,220 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests cutlass::transform::kernel::SM90MixedInputWeightPrepacker
+*/
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "cutlass/cutlass.h"
+
+#include "cutlass/transform/kernel/sm90_mixed_input_weight_prepacker.hpp"
+#include "cutlass/transform/device/transform_universal_adapter.hpp"
+#include "cutlass/util/mixed_dtype_utils.hpp"
+
+#include "thrust/universal_vector.h"
+#include "thrust/host_vector.h"
+#include "thrust/device_vector.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Host reference of the int4 unified encoding applied by the prepacker
+inline int unified_encode_int4_reference(int code) {
+  return (code >= 1 && code <= 7) ? 8 - code : code;
+}
+
+template <class ElementQuant,
+          class LayoutAtomQuant,
+          class ElementScale = void,
+          bool UseScaleLookupTable = false>
+bool prepack_test(int n, int k, int l, int group_size = 0) {
+  using namespace cute;
+
+  using PrepackKernel = cutlass::transform::kernel::SM90MixedInputWeightPrepacker<
+      ElementQuant, LayoutAtomQuant, ElementScale, void, UseScaleLookupTable>;
+  using Prepack = cutlass::transform::device::TransformUniversalAdapter<PrepackKernel>;
+
+  constexpr int QuantBits = sizeof_bits_v<ElementQuant>;
+  size_t const bytes_B = size_t(n) * k * l * QuantBits / 8;
+
+  thrust::host_vector<uint8_t> h_B(bytes_B);
+  for (size_t i = 0; i < h_B.size(); ++i) {
+    h_B[i] = static_cast<uint8_t>((i * 37 + i / 7) & 0xff);
+  }
+  thrust::device_vector<uint8_t> d_B = h_B;
+  thrust::device_vector<uint8_t> d_B_reordered(bytes_B, 0);
+
+  typename PrepackKernel::StrideB stride_B{int64_t(k), _1{}, int64_t(n) * k};
+  typename Prepack::Arguments args{
+    {n, k, l},
+    reinterpret_cast<ElementQuant const*>(d_B.data().get()),
+    stride_B,
+    reinterpret_cast<ElementQuant*>(d_B_reordered.data().get())
+  };
+
+  using ScaleStorage = cute::conditional_t<cute::is_void_v<ElementScale>, uint8_t, ElementScale>;
+  using ScalePackedStorage = cute::conditional_t<cute::is_void_v<ElementScale>, uint8_t, typename PrepackKernel::ElementScalePacked>;
+  thrust::host_vector<ScaleStorage> h_S;
+  thrust::device_vector<ScaleStorage> d_S;
+  thrust::device_vector<ScalePackedStorage> d_S_packed;
+  if constexpr (not cute::is_void_v<ElementScale>) {
+    int scale_k = cutlass::ceil_div(k, group_size);
+    h_S.resize(size_t(n) * scale_k * l);
+    for (size_t i = 0; i < h_S.size(); ++i) {
+      h_S[i] = static_cast<ElementScale>(float(int(i % 7) - 3) * 0.25f);
+    }
+    d_S = h_S;
+    d_S_packed.resize(h_S.size());
+    args.group_size = group_size;
+    args.ptr_S = d_S.data().get();
+    args.ptr_S_packed = d_S_packed.data().get();
+  }
+
+  Prepack prepack_op;
+  cutlass::Status status = Prepack::can_implement(args);
+  EXPECT_TRUE(status == cutlass::Status::kSuccess);
+  if (status != cutlass::Status::kSuccess) {
+    return false;
+  }
+
+  size_t workspace_size = Prepack::get_workspace_size(args);
+  thrust::universal_vector<uint8_t> workspace(workspace_size);
+
+  status = prepack_op.initialize(args, workspace.data().get());
+  if (status != cutlass::Status::kSuccess) {
+    cudaError_t error = cudaGetLastError();
+    std::cerr << "This test is not supported: " << cudaGetErrorString(error) << "\n";
+    return false;
+  }
+
+  status = prepack_op();
+  EXPECT_TRUE(status == cutlass::Status::kSuccess);
+  if (status != cutlass::Status::kSuccess) {
+    return false;
+  }
+
+  cudaError_t result = cudaDeviceSynchronize();
+  EXPECT_EQ(result, cudaSuccess) << " Kernel execution error: "
+                                 << cudaGetErrorString(result);
+
+  //
+  // Verification
+  //
+
+  thrust::host_vector<uint8_t> h_B_reordered = d_B_reordered;
+  auto layout_B_reordered = cute::tile_to_shape(LayoutAtomQuant{}, make_shape(n, k, l));
+  Tensor tensor_B = make_tensor(make_gmem_ptr<ElementQuant>(h_B.data()), make_layout(make_shape(n, k, l), stride_B));
+  Tensor tensor_B_reordered = make_tensor(make_gmem_ptr<ElementQuant>(h_B_reordered.data()), layout_B_reordered);
+
+  int32_t errors = 0;
+  int32_t const kErrorLimit = 10;
+  using Storage = cute::uint_bit_t<QuantBits>;
+
+  for (int i = 0; i < size(tensor_B); ++i) {
+    ElementQuant src = tensor_B(i);
+    ElementQuant dst = tensor_B_reordered(i);
+    int expected = int(reinterpret_cast<Storage const&>(src));
+    int actual = int(reinterpret_cast<Storage const&>(dst));
+    if constexpr (PrepackKernel::UseUnifiedEncoding) {
+      expected = unified_encode_int4_reference(expected);
+    }
+    if (expected != actual) {
+      std::cerr << "Error. B[" << i << "]: " << expected << ",   B_reordered: " << actual << std::endl;
+      if (++errors >= kErrorLimit) {
+        std::cerr << "Aborting on " << kErrorLimit << "nth error." << std::endl;
+        return false;
+      }
+    }
+  }
+
+  if constexpr (not cute::is_void_v<ElementScale>) {
+    thrust::host_vector<ScalePackedStorage> h_S_packed = d_S_packed;
+    for (size_t i = 0; i < h_S.size(); ++i) {
+      bool match = true;
+      if constexpr (UseScaleLookupTable) {
+        cutlass::packed_scale_t<ElementScale, ElementQuant> reference(h_S[i]);
+        ScalePackedStorage packed = h_S_packed[i];
+        match = std::memcmp(&reference, &packed, sizeof(ScalePackedStorage)) == 0;
+      }
+      else {
+        match = h_S_packed[i] == h_S[i];
+      }
+      if (!match) {
+        std::cerr << "Error. S[" << i << "] packed incorrectly" << std::endl;
+        if (++errors >= kErrorLimit) {
+          std::cerr << "Aborting on " << kErrorLimit << "nth error." << std::endl;
+          return false;
+        }
+      }
+    }
+  }
+
+  return errors == 0;
+}
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+TEST(Transform_kernel_SM90MixedInputWeightPrepacker, int4_bf16) {
+  using LayoutAtomQuant = decltype(cutlass::compute_memory_reordering_atom<cutlass::bfloat16_t>());
+  bool passed = true;
+  passed &= prepack_test<cutlass::int4b_t, LayoutAtomQuant>(256, 512, 1);
+  // Partial tiles along N and K
+  passed &= prepack_test<cutlass::int4b_t, LayoutAtomQuant>(144, 208, 2);
+  passed &= prepack_test<cutlass::int4b_t, LayoutAtomQuant, cutlass::bfloat16_t>(272, 384, 1, 128);
+  EXPECT_TRUE(passed);
+}
+
+TEST(Transform_kernel_SM90MixedInputWeightPrepacker, int4_bf16_value_shuffle) {
+  using ValueShuffle = cute::Layout<cute::Shape<cute::_2,cute::_4>, cute::Stride<cute::_4,cute::_1>>;
+  using LayoutAtomQuant = decltype(cutlass::compute_memory_reordering_atom<cutlass::bfloat16_t, cute::Layout<cute::Shape<cute::_1,cute::_2>>, ValueShuffle>());
+  bool passed = true;
+  passed &= prepack_test<cutlass::int4b_t, LayoutAtomQuant>(256, 512, 1);
+  passed &= prepack_test<cutlass::int4b_t, LayoutAtomQuant>(48, 160, 3);
+  EXPECT_TRUE(passed);
+}
+
+TEST(Transform_kernel_SM90MixedInputWeightPrepacker, int8_f16) {
+  using LayoutAtomQuant = decltype(cutlass::compute_memory_reordering_atom<cutlass::half_t>());
+  bool passed = true;
+  passed &= prepack_test<int8_t, LayoutAtomQuant>(256, 256, 1);
+  passed &= prepack_test<int8_t, LayoutAtomQuant, cutlass::half_t>(176, 96, 2, 32);
+  EXPECT_TRUE(passed);
+}
+
+TEST(Transform_kernel_SM90MixedInputWeightPrepacker, int4_fp8_lookup_table) {
+  using LayoutAtomQuant = decltype(cutlass::compute_memory_reordering_atom<cutlass::float_e4m3_t>());
+  bool passed = true;
+  passed &= prepack_test<cutlass::int4b_t, LayoutAtomQuant, cutlass::float_e4m3_t, true>(256, 512, 1, 128);
+  passed &= prepack_test<cutlass::int4b_t, LayoutAtomQuant, cutlass::float_e4m3_t, true>(160, 96, 2, 32);
+  EXPECT_TRUE(passed);
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
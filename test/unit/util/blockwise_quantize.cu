@@ -0,0 +1,140 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/detail/blockwise_scale_layout.hpp"
+#include "cutlass/util/device_blockwise_quantize.hpp"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/host_tensor.h"
+#include "cutlass/util/reference/host/tensor_fill.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using ElementIn = cutlass::half_t;
+using ElementQ = cutlass::float_e4m3_t;
+using Layout = cutlass::layout::RowMajor;
+
+/// Checks q * scale against x for a K-major (rows, cols) operand whose blocks span block_rows x
+/// block_cols, where scale_at(r, c) returns the scale of element (r, c)
+template <class ScaleAt>
+void verify_quantized(int rows, int cols, int block_rows, int block_cols,
+                      std::vector<float> const &x, ElementQ const *q, ScaleAt scale_at) {
+  float const q_max = float(cutlass::platform::numeric_limits<ElementQ>::max());
+
+  for (int r0 = 0; r0 < rows; r0 += block_rows) {
+    for (int c0 = 0; c0 < cols; c0 += block_cols) {
+      float amax = 0;
+      for (int r = r0; r < std::min(rows, r0 + block_rows); ++r) {
+        for (int c = c0; c < std::min(cols, c0 + block_cols); ++c) {
+          amax = std::max(amax, std::abs(x[r * cols + c]));
+        }
+      }
+      float scale = scale_at(r0, c0);
+      EXPECT_NEAR(scale, amax / q_max, 1e-6f * amax) << "block (" << r0 << ", " << c0 << ")";
+
+      for (int r = r0; r < std::min(rows, r0 + block_rows); ++r) {
+        for (int c = c0; c < std::min(cols, c0 + block_cols); ++c) {
+          float value = x[r * cols + c];
+          float dequantized = float(q[r * cols + c]) * scale;
+          ASSERT_LE(std::abs(dequantized - value), std::abs(value) / 16 + scale / 256)
+            << "element (" << r << ", " << c << ")";
+        }
+      }
+    }
+  }
+}
+
+template <int SFVecM>
+void run_test(int M, int K) {
+  using namespace cute;
+
+  // Scales of the operand as A of the forward GEMM, and of its transpose as B of the GEMM reducing over M
+  using ScaleConfig = cutlass::detail::Sm1xxBlockwiseScaleConfig<SFVecM, 128, 128>;
+  using ScaleConfigT = cutlass::detail::Sm1xxBlockwiseScaleConfig<128, SFVecM, 128, UMMA::Major::K, UMMA::Major::K>;
+
+  auto layout_sf = ScaleConfig::tile_atom_to_shape_SFA(make_shape(M, 1, K, 1));
+  auto layout_sf_t = ScaleConfigT::tile_atom_to_shape_SFB(make_shape(1, K, M, 1));
+
+  cutlass::HostTensor<ElementIn, Layout> input({M, K});
+  cutlass::HostTensor<ElementQ, Layout> q({M, K});
+  cutlass::HostTensor<ElementQ, Layout> q_t({K, M});
+  cutlass::HostTensor<float, Layout> scale({1, int(size(filter_zeros(layout_sf)))});
+  cutlass::HostTensor<float, Layout> scale_t({1, int(size(filter_zeros(layout_sf_t)))});
+
+  cutlass::reference::host::TensorFillRandomGaussian(input.host_view(), 2026, 0, 4);
+  input.sync_device();
+
+  cutlass::BlockwiseQuantizeArguments<ElementIn, ElementQ, float, decltype(layout_sf), decltype(layout_sf_t)> args{
+    M, K, 1,
+    input.device_data(), K, 0,
+    q.device_data(), K, 0, scale.device_data(), layout_sf,
+    q_t.device_data(), M, 0, scale_t.device_data(), layout_sf_t,
+    false
+  };
+
+  ASSERT_EQ((cutlass::blockwise_quantize<SFVecM, 128>(args)), cudaSuccess);
+  ASSERT_EQ(cudaDeviceSynchronize(), cudaSuccess);
+
+  q.sync_host();
+  q_t.sync_host();
+  scale.sync_host();
+  scale_t.sync_host();
+
+  std::vector<float> x(M * K), x_t(M * K);
+  for (int m = 0; m < M; ++m) {
+    for (int k = 0; k < K; ++k) {
+      x[m * K + k] = x_t[k * M + m] = float(input.at({m, k}));
+    }
+  }
+
+  verify_quantized(M, K, SFVecM, 128, x, q.host_data(),
+    [&](int m, int k) { return scale.host_data()[layout_sf(m, k, 0)]; });
+  verify_quantized(K, M, SFVecM == 1 ? 1 : 128, 128, x_t, q_t.host_data(),
+    [&](int k, int m) { return scale_t.host_data()[layout_sf_t(k, m, 0)]; });
+}
+
+TEST(BlockwiseQuantize, 1x128_256x384) {
+  run_test<1>(256, 384);
+}
+
+TEST(BlockwiseQuantize, 1x128_208x136) {
+  run_test<1>(208, 136);
+}
+
+TEST(BlockwiseQuantize, 128x128_384x256) {
+  run_test<128>(384, 256);
+}
+
+TEST(BlockwiseQuantize, 128x128_144x200) {
+  run_test<128>(144, 200);
+}
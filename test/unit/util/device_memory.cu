@@ -0,0 +1,141 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for stream-ordered device memory allocators
+*/
+
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/util/device_memory.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Writes a sequence to a DeviceAllocation, grows it, copies it, and verifies the copied prefix
+bool TestDeviceAllocationRoundTrip(
+  std::shared_ptr<cutlass::device_memory::DeviceMemoryAllocator> allocator,
+  cudaStream_t stream) {
+
+  size_t const kCapacity = 1000;
+
+  std::vector<int> source(kCapacity);
+  for (size_t i = 0; i < kCapacity; ++i) {
+    source[i] = int(i * 7 + 3);
+  }
+
+  cutlass::DeviceAllocation<int> block(kCapacity, stream, allocator);
+  cutlass::device_memory::copy_to_device_async(block.get(), source.data(), kCapacity, stream);
+
+  block.reallocate(2 * kCapacity);
+  cutlass::DeviceAllocation<int> copy(block);
+  cutlass::DeviceAllocation<int> moved(std::move(copy));
+
+  std::vector<int> destination(kCapacity);
+  cutlass::device_memory::copy_to_host_async(destination.data(), moved.get(), kCapacity, stream);
+
+  if (cudaStreamSynchronize(stream) != cudaSuccess) {
+    return false;
+  }
+
+  return copy.get() == nullptr && moved.size() == 2 * kCapacity && destination == source;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(DeviceMemory, caching_allocator_reuse) {
+
+  cudaStream_t stream;
+  ASSERT_EQ(cudaStreamCreate(&stream), cudaSuccess);
+
+  cutlass::device_memory::CachingDeviceAllocator allocator;
+
+  void *first = allocator.allocate(3000, stream);
+  ASSERT_NE(first, nullptr);
+  allocator.deallocate(first, stream);
+  EXPECT_EQ(allocator.cached_bytes(), size_t(4096));
+
+  // A block freed on the same stream is reused without waiting for the stream
+  void *second = allocator.allocate(4000, stream);
+  EXPECT_EQ(second, first);
+  EXPECT_EQ(allocator.cached_bytes(), size_t(0));
+
+  // Blocks of a different size class are not shared
+  void *third = allocator.allocate(5000, stream);
+  EXPECT_NE(third, first);
+
+  allocator.deallocate(second, stream);
+  allocator.deallocate(third, stream);
+  ASSERT_EQ(cudaStreamSynchronize(stream), cudaSuccess);
+
+  // Once the freeing stream has completed, a block is reused by other streams
+  void *fourth = allocator.allocate(4096, nullptr);
+  EXPECT_EQ(fourth, first);
+  allocator.deallocate(fourth, nullptr);
+
+  allocator.release_cached();
+  EXPECT_EQ(allocator.cached_bytes(), size_t(0));
+
+  cudaStreamDestroy(stream);
+}
+
+TEST(DeviceMemory, device_allocation_malloc_async) {
+
+  cudaStream_t stream;
+  ASSERT_EQ(cudaStreamCreate(&stream), cudaSuccess);
+
+  auto allocator = std::make_shared<cutlass::device_memory::CudaMallocAsyncAllocator>();
+  EXPECT_TRUE(TestDeviceAllocationRoundTrip(allocator, stream));
+  ASSERT_EQ(cudaStreamSynchronize(stream), cudaSuccess);
+
+  cudaStreamDestroy(stream);
+}
+
+TEST(DeviceMemory, device_allocation_caching) {
+
+  cudaStream_t stream;
+  ASSERT_EQ(cudaStreamCreate(&stream), cudaSuccess);
+
+  auto allocator = std::make_shared<cutlass::device_memory::CachingDeviceAllocator>();
+  EXPECT_TRUE(TestDeviceAllocationRoundTrip(allocator, stream));
+
+  cudaStreamDestroy(stream);
+}
+
+TEST(DeviceMemory, device_allocation_default) {
+  EXPECT_TRUE(TestDeviceAllocationRoundTrip(nullptr, nullptr));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
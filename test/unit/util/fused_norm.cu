@@ -0,0 +1,263 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/util/device_fused_norm.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/host_tensor.h"
+#include "cutlass/util/reference/host/tensor_fill.h"
+
+#include <cmath>
+
+using ElementType = cutlass::half_t;
+using Layout = cutlass::layout::RowMajor;
+
+/// Normalizes each row of x in double precision
+template <typename TOut>
+void row_norm_host(bool rms,
+                   cutlass::MatrixCoord tensor_size,
+                   cutlass::TensorRef<TOut, Layout> output,
+                   cutlass::TensorRef<ElementType, Layout> x,
+                   cutlass::TensorRef<ElementType, Layout> gamma,
+                   cutlass::TensorRef<ElementType, Layout> beta,
+                   float epsilon,
+                   float scale,
+                   float &amax) {
+  const int M = tensor_size.row();
+  const int N = tensor_size.column();
+
+  for (int m = 0; m < M; ++m) {
+    double sum = 0;
+    double square_sum = 0;
+
+    for (int n = 0; n < N; ++n) {
+      double inp = static_cast<double>(x.at({m, n}));
+      sum += inp;
+      square_sum += inp * inp;
+    }
+
+    double mean = rms ? 0 : sum / N;
+    double var = square_sum / N - mean * mean;
+    double rstd = 1 / std::sqrt(var + epsilon);
+
+    for (int n = 0; n < N; ++n) {
+      double inp = static_cast<double>(x.at({m, n}));
+      double y = (inp - mean) * rstd * static_cast<double>(gamma.at({0, n}));
+      if (!rms) {
+        y += static_cast<double>(beta.at({0, n}));
+      }
+      amax = std::max(amax, float(std::abs(y)));
+      output.at({m, n}) = TOut(float(y * scale));
+    }
+  }
+}
+
+template <typename TOut>
+float max_abs_diff(cutlass::HostTensor<TOut, Layout> &a, cutlass::HostTensor<TOut, Layout> &b, float &mean_abs_diff) {
+  float max_diff = 0;
+  mean_abs_diff = 0;
+  for (int64_t i = 0; i < a.size(); ++i) {
+    float diff = std::abs(static_cast<float>(a.host_data()[i]) - static_cast<float>(b.host_data()[i]));
+    mean_abs_diff += diff;
+    max_diff = std::max(max_diff, diff);
+  }
+  mean_abs_diff /= float(a.size());
+  return max_diff;
+}
+
+template <typename TOut = ElementType>
+void run_row_test(bool rms, int M, int N, bool with_residual, float tolerance = 0.01f) {
+  cutlass::HostTensor<ElementType, Layout> input, residual, sum, gamma, beta;
+  cutlass::HostTensor<TOut, Layout> output, output_ref;
+  input.reset({M, N});
+  residual.reset({M, N});
+  sum.reset({M, N});
+  gamma.reset({1, N});
+  beta.reset({1, N});
+  output.reset({M, N});
+  output_ref.reset({M, N});
+
+  const unsigned seed = 2026;
+
+  cutlass::reference::host::TensorFillRandomUniform(input.host_view(), seed, ElementType(5), ElementType(-5), 0);
+  cutlass::reference::host::TensorFillRandomUniform(residual.host_view(), seed + 1, ElementType(5), ElementType(-5), 0);
+  cutlass::reference::host::TensorFillRandomUniform(gamma.host_view(), seed + 2, ElementType(1), ElementType(-1), 0);
+  cutlass::reference::host::TensorFillRandomUniform(beta.host_view(), seed + 3, ElementType(1), ElementType(-1), 0);
+
+  for (int64_t i = 0; i < input.size(); ++i) {
+    sum.host_data()[i] = with_residual ? input.host_data()[i] + residual.host_data()[i] : input.host_data()[i];
+  }
+
+  input.sync_device();
+  residual.sync_device();
+  gamma.sync_device();
+  beta.sync_device();
+
+  float const scale = 0.5f;
+  float amax_ref = 0;
+  float amax = 0;
+  cutlass::DeviceAllocation<float> device_scale(1), device_amax(1);
+  device_scale.copy_from_host(&scale);
+  device_amax.copy_from_host(&amax);
+
+  row_norm_host<TOut>(rms, {M, N}, output_ref.host_ref(), sum.host_ref(), gamma.host_ref(), beta.host_ref(),
+                      1e-5f, scale, amax_ref);
+
+  cutlass::TensorRef<ElementType, Layout> ref_residual = with_residual ? residual.device_ref() : cutlass::TensorRef<ElementType, Layout>();
+  cudaError_t result = rms ?
+    cutlass::fused_rmsnorm<ElementType, TOut>({M, N}, output.device_ref(), input.device_ref(), gamma.device_ref(),
+                                              nullptr, 1e-5f, ref_residual, device_scale.get(), device_amax.get()) :
+    cutlass::fused_layernorm<ElementType, TOut>({M, N}, output.device_ref(), input.device_ref(), gamma.device_ref(),
+                                                beta.device_ref(), nullptr, 1e-5f, ref_residual, device_scale.get(), device_amax.get());
+  ASSERT_EQ(result, cudaSuccess);
+  ASSERT_EQ(cudaDeviceSynchronize(), cudaSuccess);
+
+  output.sync_host();
+  residual.sync_host();
+  device_amax.copy_to_host(&amax);
+
+  float mean_abs_diff = 0;
+  float max_diff = max_abs_diff(output, output_ref, mean_abs_diff);
+
+  EXPECT_TRUE(max_diff < tolerance && mean_abs_diff < 0.001f)
+    << "Max absolute difference  : " << max_diff << "\n"
+    << "Mean absolute difference: " << mean_abs_diff;
+
+  EXPECT_NEAR(amax, amax_ref, 0.01f);
+
+  if (with_residual) {
+    float residual_mean_diff = 0;
+    EXPECT_EQ(max_abs_diff(residual, sum, residual_mean_diff), 0.f);
+  }
+}
+
+TEST(FusedLayerNorm, 16x1024) {
+  run_row_test(false, 16, 1024, false);
+}
+
+TEST(FusedLayerNorm, 5x127) {
+  run_row_test(false, 5, 127, false);
+}
+
+TEST(FusedLayerNorm, 3x40000_streaming) {
+  run_row_test(false, 3, 40000, true);
+}
+
+TEST(FusedLayerNorm, 64x4096_fp8_output) {
+  run_row_test<cutlass::float_e4m3_t>(false, 64, 4096, false, 0.3f);
+}
+
+TEST(FusedRMSNorm, 16x1024_residual) {
+  run_row_test(true, 16, 1024, true);
+}
+
+TEST(FusedRMSNorm, 7x12288_residual) {
+  run_row_test(true, 7, 12288, true);
+}
+
+/// GroupNorm of a packed NHWC tensor
+void run_groupnorm_test(int N, int H, int W, int C, int G) {
+  using LayoutNHWC = cutlass::layout::TensorNHWC;
+
+  cutlass::HostTensor<ElementType, LayoutNHWC> input, output;
+  cutlass::HostTensor<ElementType, LayoutNHWC> gamma, beta;
+  input.reset({N, H, W, C});
+  output.reset({N, H, W, C});
+  gamma.reset({1, 1, 1, C});
+  beta.reset({1, 1, 1, C});
+
+  const unsigned seed = 2026;
+
+  cutlass::reference::host::TensorFillRandomUniform(input.host_view(), seed, ElementType(5), ElementType(-5), 0);
+  cutlass::reference::host::TensorFillRandomUniform(gamma.host_view(), seed + 1, ElementType(1), ElementType(-1), 0);
+  cutlass::reference::host::TensorFillRandomUniform(beta.host_view(), seed + 2, ElementType(1), ElementType(-1), 0);
+
+  input.sync_device();
+  gamma.sync_device();
+  beta.sync_device();
+
+  cutlass::DeviceAllocation<uint8_t> workspace(cutlass::fused_groupnorm_workspace_size({N, H, W, C}, G));
+
+  cudaError_t result = cutlass::fused_groupnorm<ElementType>(
+    {N, H, W, C}, G, 1e-5f, output.device_ref(), input.device_ref(), gamma.device_ref(), beta.device_ref(),
+    workspace.get(), nullptr);
+  ASSERT_EQ(result, cudaSuccess);
+  ASSERT_EQ(cudaDeviceSynchronize(), cudaSuccess);
+
+  output.sync_host();
+
+  int cpg = C / G;
+  float max_diff = 0;
+
+  for (int n = 0; n < N; ++n) {
+    for (int g = 0; g < G; ++g) {
+      double sum = 0;
+      double square_sum = 0;
+      for (int h = 0; h < H; ++h) {
+        for (int w = 0; w < W; ++w) {
+          for (int c = g * cpg; c < (g + 1) * cpg; ++c) {
+            double inp = static_cast<double>(input.at({n, h, w, c}));
+            sum += inp;
+            square_sum += inp * inp;
+          }
+        }
+      }
+      double count = double(H) * W * cpg;
+      double mean = sum / count;
+      double rstd = 1 / std::sqrt(square_sum / count - mean * mean + 1e-5);
+
+      for (int h = 0; h < H; ++h) {
+        for (int w = 0; w < W; ++w) {
+          for (int c = g * cpg; c < (g + 1) * cpg; ++c) {
+            double y = (static_cast<double>(input.at({n, h, w, c})) - mean) * rstd *
+                       static_cast<double>(gamma.at({0, 0, 0, c})) + static_cast<double>(beta.at({0, 0, 0, c}));
+            float diff = std::abs(float(ElementType(float(y))) - static_cast<float>(output.at({n, h, w, c})));
+            max_diff = std::max(max_diff, diff);
+          }
+        }
+      }
+    }
+  }
+
+  EXPECT_LT(max_diff, 0.01f);
+}
+
+TEST(FusedGroupNorm, 2x32x32x320_g32) {
+  run_groupnorm_test(2, 32, 32, 320, 32);
+}
+
+TEST(FusedGroupNorm, 1x7x9x24_g3) {
+  run_groupnorm_test(1, 7, 9, 24, 3);
+}
+
+TEST(FusedGroupNorm, 1x16x16x30_g5) {
+  run_groupnorm_test(1, 16, 16, 30, 5);
+}
@@ -0,0 +1,244 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Checks that the multi-threaded host reference GEMM and convolution produce results
+      that are bitwise identical to the single-threaded path.
+*/
+
+#include <cstring>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/half.h"
+#include "cutlass/layout/matrix.h"
+#include "cutlass/layout/tensor.h"
+#include "cutlass/conv/conv2d_problem_size.h"
+#include "cutlass/conv/conv3d_problem_size.h"
+
+#include "cutlass/util/host_tensor.h"
+#include "cutlass/util/reference/host/gemm.h"
+#include "cutlass/util/reference/host/convolution.h"
+#include "cutlass/util/reference/host/tensor_fill.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+template <typename Element, typename Layout>
+bool bitwise_equal(
+  cutlass::HostTensor<Element, Layout> const &lhs,
+  cutlass::HostTensor<Element, Layout> const &rhs) {
+
+  return lhs.capacity() == rhs.capacity() &&
+    !std::memcmp(lhs.host_data(), rhs.host_data(), lhs.capacity() * sizeof(Element));
+}
+
+/// Runs compute_gemm() and compute_gemm_parallel() on the same random operands and returns
+/// true if the outputs match bit for bit.
+template <
+  typename ElementAB,
+  typename LayoutA,
+  typename LayoutB,
+  typename LayoutC
+>
+bool run_gemm_parallel_test(cutlass::gemm::GemmCoord problem_size, int num_threads) {
+
+  cutlass::HostTensor<ElementAB, LayoutA> tensor_A(problem_size.mk(), false);
+  cutlass::HostTensor<ElementAB, LayoutB> tensor_B(problem_size.kn(), false);
+  cutlass::HostTensor<float, LayoutC> tensor_C(problem_size.mn(), false);
+  cutlass::HostTensor<float, LayoutC> tensor_D_serial(problem_size.mn(), false);
+  cutlass::HostTensor<float, LayoutC> tensor_D_parallel(problem_size.mn(), false);
+
+  // Non-integer data so that any change in the accumulation order would show up in the low bits
+  cutlass::reference::host::TensorFillRandomUniform(tensor_A.host_view(), 2023, 2.0, -2.0, -1);
+  cutlass::reference::host::TensorFillRandomUniform(tensor_B.host_view(), 2024, 2.0, -2.0, -1);
+  cutlass::reference::host::TensorFillRandomUniform(tensor_C.host_view(), 2025, 2.0, -2.0, -1);
+
+  float alpha = 1.25f;
+  float beta = -0.75f;
+
+  cutlass::reference::host::compute_gemm<
+    ElementAB, LayoutA, ElementAB, LayoutB, float, LayoutC, float, float>(
+      problem_size, alpha, tensor_A.host_ref(), tensor_B.host_ref(),
+      beta, tensor_C.host_ref(), tensor_D_serial.host_ref(), 0.0f);
+
+  cutlass::reference::host::compute_gemm_parallel<
+    ElementAB, LayoutA, ElementAB, LayoutB, float, LayoutC, float, float>(
+      problem_size, alpha, tensor_A.host_ref(), tensor_B.host_ref(),
+      beta, tensor_C.host_ref(), tensor_D_parallel.host_ref(), 0.0f, num_threads);
+
+  return bitwise_equal(tensor_D_serial, tensor_D_parallel);
+}
+
+/// Runs the host Conv2d reference on one thread and on num_threads threads and returns true if
+/// the outputs match bit for bit.
+bool run_conv2d_parallel_test(
+  cutlass::conv::Operator conv_operator,
+  cutlass::conv::Conv2dProblemSize const &problem_size,
+  int num_threads) {
+
+  using Layout = cutlass::layout::TensorNHWC;
+
+  cutlass::HostTensor<float, Layout> tensor_A(
+    cutlass::conv::implicit_gemm_tensor_a_extent(conv_operator, problem_size), false);
+  cutlass::HostTensor<float, Layout> tensor_B(
+    cutlass::conv::implicit_gemm_tensor_b_extent(conv_operator, problem_size), false);
+  cutlass::HostTensor<float, Layout> tensor_C(
+    cutlass::conv::implicit_gemm_tensor_c_extent(conv_operator, problem_size), false);
+  cutlass::HostTensor<float, Layout> tensor_D_serial(tensor_C.extent(), false);
+  cutlass::HostTensor<float, Layout> tensor_D_parallel(tensor_C.extent(), false);
+
+  cutlass::reference::host::TensorFillRandomUniform(tensor_A.host_view(), 2023, 2.0, -2.0, -1);
+  cutlass::reference::host::TensorFillRandomUniform(tensor_B.host_view(), 2024, 2.0, -2.0, -1);
+  cutlass::reference::host::TensorFillRandomUniform(tensor_C.host_view(), 2025, 2.0, -2.0, -1);
+
+  float alpha = 1.25f;
+  float beta = -0.75f;
+
+  cutlass::reference::host::Conv2d<float, Layout, float, Layout, float, Layout, float>(
+    conv_operator, problem_size,
+    tensor_A.host_ref(), tensor_B.host_ref(), tensor_C.host_ref(), tensor_D_serial.host_ref(),
+    alpha, beta, 1);
+
+  cutlass::reference::host::Conv2d<float, Layout, float, Layout, float, Layout, float>(
+    conv_operator, problem_size,
+    tensor_A.host_ref(), tensor_B.host_ref(), tensor_C.host_ref(), tensor_D_parallel.host_ref(),
+    alpha, beta, num_threads);
+
+  return bitwise_equal(tensor_D_serial, tensor_D_parallel);
+}
+
+/// Same as run_conv2d_parallel_test() for the host Conv3d reference.
+bool run_conv3d_parallel_test(
+  cutlass::conv::Operator conv_operator,
+  cutlass::conv::Conv3dProblemSize const &problem_size,
+  int num_threads) {
+
+  using Layout = cutlass::layout::TensorNDHWC;
+
+  cutlass::HostTensor<float, Layout> tensor_A(
+    cutlass::conv::implicit_gemm_tensor_a_extent(conv_operator, problem_size), false);
+  cutlass::HostTensor<float, Layout> tensor_B(
+    cutlass::conv::implicit_gemm_tensor_b_extent(conv_operator, problem_size), false);
+  cutlass::HostTensor<float, Layout> tensor_C(
+    cutlass::conv::implicit_gemm_tensor_c_extent(conv_operator, problem_size), false);
+  cutlass::HostTensor<float, Layout> tensor_D_serial(tensor_C.extent(), false);
+  cutlass::HostTensor<float, Layout> tensor_D_parallel(tensor_C.extent(), false);
+
+  cutlass::reference::host::TensorFillRandomUniform(tensor_A.host_view(), 2023, 2.0, -2.0, -1);
+  cutlass::reference::host::TensorFillRandomUniform(tensor_B.host_view(), 2024, 2.0, -2.0, -1);
+  cutlass::reference::host::TensorFillRandomUniform(tensor_C.host_view(), 2025, 2.0, -2.0, -1);
+
+  float alpha = 1.25f;
+  float beta = -0.75f;
+
+  cutlass::reference::host::Conv3d<float, Layout, float, Layout, float, Layout, float>(
+    conv_operator, problem_size,
+    tensor_A.host_ref(), tensor_B.host_ref(), tensor_C.host_ref(), tensor_D_serial.host_ref(),
+    alpha, beta, 1);
+
+  cutlass::reference::host::Conv3d<float, Layout, float, Layout, float, Layout, float>(
+    conv_operator, problem_size,
+    tensor_A.host_ref(), tensor_B.host_ref(), tensor_C.host_ref(), tensor_D_parallel.host_ref(),
+    alpha, beta, num_threads);
+
+  return bitwise_equal(tensor_D_serial, tensor_D_parallel);
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// K = 600 spans several of the K blocks compute_gemm() accumulates in, and the odd M and N leave
+// partial tiles on every thread's last row block.
+TEST(HostReferenceParallel, gemm_f32_nt) {
+  cutlass::gemm::GemmCoord problem_size(131, 77, 600);
+
+  EXPECT_TRUE((run_gemm_parallel_test<
+    float, cutlass::layout::ColumnMajor, cutlass::layout::RowMajor, cutlass::layout::ColumnMajor>(
+      problem_size, 4)));
+}
+
+TEST(HostReferenceParallel, gemm_f32_tn) {
+  cutlass::gemm::GemmCoord problem_size(131, 77, 600);
+
+  EXPECT_TRUE((run_gemm_parallel_test<
+    float, cutlass::layout::RowMajor, cutlass::layout::ColumnMajor, cutlass::layout::RowMajor>(
+      problem_size, 4)));
+}
+
+TEST(HostReferenceParallel, gemm_f32_tn_hardware_concurrency) {
+  cutlass::gemm::GemmCoord problem_size(67, 129, 257);
+
+  EXPECT_TRUE((run_gemm_parallel_test<
+    float, cutlass::layout::RowMajor, cutlass::layout::ColumnMajor, cutlass::layout::ColumnMajor>(
+      problem_size, 0)));
+}
+
+TEST(HostReferenceParallel, gemm_f16_nn) {
+  cutlass::gemm::GemmCoord problem_size(131, 77, 600);
+
+  EXPECT_TRUE((run_gemm_parallel_test<
+    cutlass::half_t, cutlass::layout::ColumnMajor, cutlass::layout::ColumnMajor, cutlass::layout::RowMajor>(
+      problem_size, 4)));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(HostReferenceParallel, conv2d) {
+  cutlass::conv::Conv2dProblemSize problem_size(
+    {3, 13, 11, 24},    // input size  (NHWC)
+    {17, 3, 3, 24},     // filter size (KRSC)
+    {1, 1, 1, 1},       // padding (pad_h, _, pad_w, _)
+    {2, 1},             // stride (stride_h, stride_w)
+    {1, 1}              // dilation (dilation_h, dilation_w)
+  );
+
+  EXPECT_TRUE(run_conv2d_parallel_test(cutlass::conv::Operator::kFprop, problem_size, 4));
+  EXPECT_TRUE(run_conv2d_parallel_test(cutlass::conv::Operator::kDgrad, problem_size, 4));
+  EXPECT_TRUE(run_conv2d_parallel_test(cutlass::conv::Operator::kWgrad, problem_size, 4));
+}
+
+TEST(HostReferenceParallel, conv3d) {
+  cutlass::conv::Conv3dProblemSize problem_size(
+    {2, 5, 9, 7, 16},   // input size  (NDHWC)
+    {9, 3, 3, 3, 16},   // filter size (KTRSC)
+    cutlass::Coord<3>({1, 1, 1}),   // padding (pad_d, pad_h, pad_w)
+    cutlass::Coord<3>({1, 2, 1}),   // stride (stride_d, stride_h, stride_w)
+    cutlass::Coord<3>({1, 1, 1})    // dilation (dilation_d, dilation_h, dilation_w)
+  );
+
+  EXPECT_TRUE(run_conv3d_parallel_test(cutlass::conv::Operator::kFprop, problem_size, 4));
+  EXPECT_TRUE(run_conv3d_parallel_test(cutlass::conv::Operator::kDgrad, problem_size, 4));
+  EXPECT_TRUE(run_conv3d_parallel_test(cutlass::conv::Operator::kWgrad, problem_size, 4));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
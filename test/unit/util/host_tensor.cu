@@ -0,0 +1,132 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for pinned HostTensor allocations and stream-ordered transfers
+*/
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/layout/matrix.h"
+
+#include "cutlass/util/host_tensor.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+template <typename Element, typename Tensor>
+bool TestHostTensorAsyncRoundTrip(Tensor &source, Tensor &destination, cudaStream_t stream) {
+
+  int idx = 0;
+  for (int m = 0; m < source.extent().row(); ++m) {
+    for (int n = 0; n < source.extent().column(); ++n, ++idx) {
+      source.at({m, n}) = Element((idx % 15) - 7);
+    }
+  }
+
+  source.sync_device_async(stream);
+
+  cutlass::device_memory::copy_async(
+    destination.device_data(),
+    source.device_data(),
+    source.capacity(),
+    cudaMemcpyDeviceToDevice,
+    stream);
+
+  destination.sync_host_async(stream);
+
+  if (cudaStreamSynchronize(stream) != cudaSuccess) {
+    return false;
+  }
+
+  for (int m = 0; m < source.extent().row(); ++m) {
+    for (int n = 0; n < source.extent().column(); ++n) {
+      if (!(Element(source.at({m, n})) == Element(destination.at({m, n})))) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(HostTensor, pinned_async_round_trip_f16) {
+
+  using Element = cutlass::half_t;
+  using Tensor = cutlass::PinnedHostTensor<Element, cutlass::layout::RowMajor>;
+
+  cudaStream_t stream;
+  ASSERT_EQ(cudaStreamCreate(&stream), cudaSuccess);
+
+  Tensor source({67, 131});
+  Tensor destination({67, 131});
+
+  cudaPointerAttributes attributes;
+  ASSERT_EQ(cudaPointerGetAttributes(&attributes, source.host_data()), cudaSuccess);
+  EXPECT_EQ(attributes.type, cudaMemoryTypeHost);
+
+  EXPECT_TRUE(TestHostTensorAsyncRoundTrip<Element>(source, destination, stream));
+
+  cudaStreamDestroy(stream);
+}
+
+TEST(HostTensor, pinned_async_round_trip_s4) {
+
+  using Element = cutlass::int4b_t;
+  using Tensor = cutlass::PinnedHostTensor<Element, cutlass::layout::ColumnMajor>;
+
+  cudaStream_t stream;
+  ASSERT_EQ(cudaStreamCreate(&stream), cudaSuccess);
+
+  Tensor source({33, 17});
+  Tensor destination({33, 17});
+
+  EXPECT_TRUE(TestHostTensorAsyncRoundTrip<Element>(source, destination, stream));
+
+  cudaStreamDestroy(stream);
+}
+
+TEST(HostTensor, pageable_async_round_trip_f32) {
+
+  using Element = float;
+  using Tensor = cutlass::HostTensor<Element, cutlass::layout::RowMajor>;
+
+  Tensor source({45, 29});
+  Tensor destination({45, 29});
+
+  EXPECT_TRUE(TestHostTensorAsyncRoundTrip<Element>(source, destination, nullptr));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,155 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the counter-based Philox device fill
+*/
+
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/complex.h"
+
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/distribution.h"
+#include "cutlass/util/reference/device/tensor_fill.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Fills a block at an element offset from an aligned allocation and compares it against the
+/// Philox functor evaluated on the host. Distributions are rounded to a few fractional bits so
+/// that host and device math libraries agree exactly.
+template <typename Element, typename Func>
+bool TestBlockFillRandomPhilox(
+  size_t capacity,
+  size_t offset,
+  uint64_t seed,
+  cutlass::Distribution dist,
+  typename Func::Params const &params) {
+
+  size_t bytes = (cutlass::sizeof_bits<Element>::value * (capacity + offset) + 7) / 8;
+  size_t offset_bytes = cutlass::sizeof_bits<Element>::value * offset / 8;
+
+  cutlass::device_memory::allocation<uint8_t> block(bytes);
+  cudaMemset(block.get(), 0, bytes);
+
+  Element *ptr = reinterpret_cast<Element *>(block.get() + offset_bytes);
+  cutlass::reference::device::BlockFillRandomPhilox<Element>(ptr, capacity, seed, dist);
+
+  std::vector<uint8_t> host_block(bytes);
+  cutlass::device_memory::copy_to_host(host_block.data(), block.get(), bytes);
+
+  Element *host_ptr = reinterpret_cast<Element *>(host_block.data() + offset_bytes);
+  Func func{params};
+
+  for (size_t i = 0; i < capacity; ++i) {
+    Element expected = func(i);
+    Element got = cutlass::ReferenceFactory<Element>::get(host_ptr, i);
+    if (!(got == expected)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename Element>
+bool TestBlockFillRandomPhiloxUniform(size_t capacity, size_t offset, double max, double min, int bits) {
+  using Func = cutlass::reference::device::detail::PhiloxRandomUniformFunc<Element>;
+  using UniformReal = typename cutlass::reference::device::detail::UniformDistributionValueType<Element>::Type;
+
+  uint64_t seed = 2080;
+  cutlass::Distribution dist;
+  dist.set_uniform(min, max, bits);
+
+  typename Func::Params params(seed, UniformReal(max), UniformReal(min), bits, 0);
+  return TestBlockFillRandomPhilox<Element, Func>(capacity, offset, seed, dist, params);
+}
+
+template <typename Element>
+bool TestBlockFillRandomPhiloxGaussian(size_t capacity, size_t offset, double mean, double stddev, int bits) {
+  using Func = cutlass::reference::device::detail::PhiloxRandomGaussianFunc<Element>;
+  using Real = typename cutlass::RealType<Element>::Type;
+
+  uint64_t seed = 2080;
+  cutlass::Distribution dist;
+  dist.set_gaussian(mean, stddev, bits);
+
+  typename Func::Params params(seed, Real(mean), Real(stddev), bits);
+  return TestBlockFillRandomPhilox<Element, Func>(capacity, offset, seed, dist, params);
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(BlockFillRandomPhilox, uniform_f32) {
+  EXPECT_TRUE(TestBlockFillRandomPhiloxUniform<float>(1027, 0, 4, -4, 0));
+  EXPECT_TRUE(TestBlockFillRandomPhiloxUniform<float>(1027, 1, 4, -4, 3));
+}
+
+TEST(BlockFillRandomPhilox, uniform_f16) {
+  EXPECT_TRUE(TestBlockFillRandomPhiloxUniform<cutlass::half_t>(4099, 0, 2, -2, 2));
+  EXPECT_TRUE(TestBlockFillRandomPhiloxUniform<cutlass::half_t>(4099, 3, 2, -2, 2));
+}
+
+TEST(BlockFillRandomPhilox, uniform_s4) {
+  EXPECT_TRUE(TestBlockFillRandomPhiloxUniform<cutlass::int4b_t>(1001, 0, 7, -8, 0));
+  EXPECT_TRUE(TestBlockFillRandomPhiloxUniform<cutlass::int4b_t>(1001, 2, 7, -8, 0));
+}
+
+TEST(BlockFillRandomPhilox, uniform_e2m1) {
+  EXPECT_TRUE(TestBlockFillRandomPhiloxUniform<cutlass::float_e2m1_t>(999, 0, 2, -2, 0));
+}
+
+TEST(BlockFillRandomPhilox, uniform_e2m3) {
+  EXPECT_TRUE(TestBlockFillRandomPhiloxUniform<cutlass::float_e2m3_t>(1003, 0, 2, -2, 0));
+}
+
+TEST(BlockFillRandomPhilox, uniform_ue8m0) {
+  EXPECT_TRUE(TestBlockFillRandomPhiloxUniform<cutlass::float_ue8m0_t>(515, 0, 4, 0.25, -1));
+}
+
+TEST(BlockFillRandomPhilox, uniform_cf32) {
+  EXPECT_TRUE(TestBlockFillRandomPhiloxUniform<cutlass::complex<float>>(513, 0, 3, -3, 0));
+}
+
+TEST(BlockFillRandomPhilox, gaussian_f64) {
+  EXPECT_TRUE(TestBlockFillRandomPhiloxGaussian<double>(1025, 0, 0, 1, 3));
+}
+
+TEST(BlockFillRandomPhilox, gaussian_bf16) {
+  EXPECT_TRUE(TestBlockFillRandomPhiloxGaussian<cutlass::bfloat16_t>(2049, 1, 0, 2, 1));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
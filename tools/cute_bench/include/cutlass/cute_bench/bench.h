@@ -0,0 +1,342 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Shared infrastructure of the CuTe primitive microbenchmarks (cutlass_cute_bench)
+
+  Each suite measures one family of CuTe atoms in isolation and appends one Result per
+  configuration to a Report. Bandwidth and throughput are measured with CUDA events over the
+  whole device, latency with clock64() on a single warp issuing a dependent chain, and SMEM
+  bank conflicts are computed from the addresses each configuration actually issues.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <cuda_runtime.h>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/util/command_line.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#define CUTE_BENCH_CUDA_CHECK(status)                                                     \
+  {                                                                                       \
+    cudaError_t error = status;                                                           \
+    if (error != cudaSuccess) {                                                           \
+      std::cerr << "Got bad cuda status: " << cudaGetErrorString(error)                   \
+                << " at line: " << __LINE__ << std::endl;                                 \
+      exit(EXIT_FAILURE);                                                                 \
+    }                                                                                     \
+  }
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace cute_bench {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Command line options
+struct Options {
+
+  bool help{false};
+  int device{0};
+  int warmup_iterations{5};
+  int profiling_iterations{20};
+  std::set<std::string> suites{"copy", "ldsm", "tma", "mma"};
+  std::string output;                         ///< Optional CSV file
+
+  void parse(int argc, char const **argv) {
+    cutlass::CommandLine cmd(argc, argv);
+
+    help = cmd.check_cmd_line_flag("help");
+    cmd.get_cmd_line_argument("device", device, 0);
+    cmd.get_cmd_line_argument("warmup-iterations", warmup_iterations, 5);
+    cmd.get_cmd_line_argument("profiling-iterations", profiling_iterations, 20);
+    cmd.get_cmd_line_argument("output", output, std::string());
+
+    if (cmd.check_cmd_line_flag("suites")) {
+      std::vector<std::string> tokens;
+      cmd.get_cmd_line_arguments("suites", tokens);
+      suites = std::set<std::string>(tokens.begin(), tokens.end());
+    }
+  }
+
+  bool enabled(std::string const &suite) const {
+    return suites.count(suite) != 0;
+  }
+
+  std::ostream & print_usage(std::ostream &out) const {
+    out << "cutlass_cute_bench\n\n"
+        << "  Measures CuTe copy atoms, swizzled SMEM layouts, TMA box shapes and MMA atoms in isolation.\n\n"
+        << "Options:\n\n"
+        << "  --help                        Display this usage statement\n"
+        << "  --device=<int>                CUDA device to run on\n"
+        << "  --suites=<list>               Comma separated subset of copy,ldsm,tma,mma\n"
+        << "  --warmup-iterations=<int>     Launches before timing\n"
+        << "  --profiling-iterations=<int>  Timed launches averaged per result\n"
+        << "  --output=<file>               Also writes the results as CSV\n\n"
+        << "Example:\n\n"
+        << "  $ cutlass_cute_bench --suites=ldsm,tma --output=sm90.csv\n";
+    return out;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Properties of the device the suites run on
+struct DeviceInfo {
+
+  int device{0};
+  int compute_capability{0};                  ///< e.g. 90 for SM90
+  int sm_count{0};
+  int max_smem_per_block{0};                  ///< Opt-in dynamic SMEM limit in bytes
+  double clock_ghz{0};
+  std::string name;
+
+  explicit DeviceInfo(int device_ = 0): device(device_) {
+    cudaDeviceProp prop;
+    CUTE_BENCH_CUDA_CHECK(cudaGetDeviceProperties(&prop, device));
+    compute_capability = prop.major * 10 + prop.minor;
+    sm_count = prop.multiProcessorCount;
+    max_smem_per_block = int(prop.sharedMemPerBlockOptin);
+    name = prop.name;
+
+    int clock_khz = 0;
+    CUTE_BENCH_CUDA_CHECK(cudaDeviceGetAttribute(&clock_khz, cudaDevAttrClockRate, device));
+    clock_ghz = double(clock_khz) / 1.0e6;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Measurement of one primitive in one configuration. Metrics that do not apply are left at zero.
+struct Result {
+
+  std::string suite;                          ///< copy, ldsm, tma or mma
+  std::string primitive;                      ///< CuTe atom, e.g. SM75_U32x4_LDSM_N
+  std::string config;                         ///< Layout, swizzle or box shape
+  double runtime_us{0};                       ///< Average kernel time
+  double bandwidth_gbs{0};                    ///< Bytes moved per second, device wide
+  double throughput_tops{0};                  ///< Math operations per second, device wide
+  double latency_cycles{0};                   ///< Cycles per instruction of a dependent chain
+  int smem_wavefronts{0};                     ///< SMEM wavefronts per warp-wide instruction
+  int smem_ideal_wavefronts{0};               ///< Wavefronts without bank conflicts
+};
+
+/// Collects results and prints them as a table or CSV
+class Report {
+public:
+
+  DeviceInfo const &device;
+  std::vector<Result> results;
+
+  explicit Report(DeviceInfo const &device_): device(device_) { }
+
+  void append(Result const &result) {
+    results.push_back(result);
+    print_row(std::cout, result);
+  }
+
+  static std::ostream & print_header(std::ostream &out) {
+    out << std::left
+        << std::setw(6)  << "suite" << " "
+        << std::setw(36) << "primitive" << " "
+        << std::setw(28) << "config" << " "
+        << std::right
+        << std::setw(10) << "time(us)" << " "
+        << std::setw(10) << "GB/s" << " "
+        << std::setw(10) << "TOP/s" << " "
+        << std::setw(10) << "latency" << " "
+        << std::setw(10) << "conflicts" << "\n";
+    return out;
+  }
+
+  std::ostream & print_row(std::ostream &out, Result const &r) const {
+    auto metric = [&](double value, int precision) {
+      std::ostringstream ss;
+      if (value > 0) {
+        ss << std::fixed << std::setprecision(precision) << value;
+      }
+      else {
+        ss << "-";
+      }
+      return ss.str();
+    };
+
+    std::ostringstream conflicts;
+    if (r.smem_ideal_wavefronts > 0) {
+      conflicts << std::fixed << std::setprecision(2)
+                << double(r.smem_wavefronts) / double(r.smem_ideal_wavefronts) << "x";
+    }
+    else {
+      conflicts << "-";
+    }
+
+    out << std::left
+        << std::setw(6)  << r.suite << " "
+        << std::setw(36) << r.primitive << " "
+        << std::setw(28) << r.config << " "
+        << std::right
+        << std::setw(10) << metric(r.runtime_us, 2) << " "
+        << std::setw(10) << metric(r.bandwidth_gbs, 1) << " "
+        << std::setw(10) << metric(r.throughput_tops, 1) << " "
+        << std::setw(10) << metric(r.latency_cycles, 1) << " "
+        << std::setw(10) << conflicts.str() << std::endl;
+    return out;
+  }
+
+  std::ostream & write_csv(std::ostream &out) const {
+    out << "device,cc,suite,primitive,config,runtime_us,bandwidth_gbs,throughput_tops,"
+        << "latency_cycles,smem_wavefronts,smem_ideal_wavefronts\n";
+    for (Result const &r : results) {
+      out << device.name << "," << device.compute_capability << ","
+          << r.suite << "," << r.primitive << ",\"" << r.config << "\","
+          << r.runtime_us << "," << r.bandwidth_gbs << "," << r.throughput_tops << ","
+          << r.latency_cycles << "," << r.smem_wavefronts << "," << r.smem_ideal_wavefronts << "\n";
+    }
+    return out;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Times a launch functor with CUDA events and returns the average runtime in microseconds
+template <class Launch>
+double time_launches(Options const &options, Launch &&launch) {
+  for (int i = 0; i < options.warmup_iterations; ++i) {
+    launch();
+  }
+  CUTE_BENCH_CUDA_CHECK(cudaGetLastError());
+
+  cudaEvent_t events[2];
+  for (auto &event : events) {
+    CUTE_BENCH_CUDA_CHECK(cudaEventCreate(&event));
+  }
+
+  CUTE_BENCH_CUDA_CHECK(cudaEventRecord(events[0]));
+  for (int i = 0; i < options.profiling_iterations; ++i) {
+    launch();
+  }
+  CUTE_BENCH_CUDA_CHECK(cudaEventRecord(events[1]));
+  CUTE_BENCH_CUDA_CHECK(cudaEventSynchronize(events[1]));
+  CUTE_BENCH_CUDA_CHECK(cudaGetLastError());
+
+  float elapsed_ms = 0;
+  CUTE_BENCH_CUDA_CHECK(cudaEventElapsedTime(&elapsed_ms, events[0], events[1]));
+
+  for (auto &event : events) {
+    CUTE_BENCH_CUDA_CHECK(cudaEventDestroy(event));
+  }
+
+  return 1000.0 * double(elapsed_ms) / double(std::max(options.profiling_iterations, 1));
+}
+
+/// Runs a latency kernel writing its elapsed clock64() cycles to a device word and returns them
+template <class Launch>
+double measure_cycles(Launch &&launch) {
+  long long *cycles = nullptr;
+  CUTE_BENCH_CUDA_CHECK(cudaMalloc(&cycles, sizeof(long long)));
+
+  // The first launch warms up the instruction cache
+  launch(cycles);
+  launch(cycles);
+
+  long long host_cycles = 0;
+  CUTE_BENCH_CUDA_CHECK(cudaMemcpy(&host_cycles, cycles, sizeof(long long), cudaMemcpyDeviceToHost));
+  CUTE_BENCH_CUDA_CHECK(cudaFree(cycles));
+
+  return double(host_cycles);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Model of the 32 x 4B SMEM banks. A warp-wide access of access_bytes per thread is split into
+/// phases of 128 bytes (32, 16 or 8 threads). Within a phase, threads touching the same 4B word
+/// are served by a broadcast, while distinct words mapping to the same bank serialize. The
+/// number of wavefronts of a phase is therefore the largest count of distinct words in a bank.
+///
+/// LDSM is modeled by passing the 16B row addresses of its 8x8 matrices, one phase per matrix.
+inline int smem_wavefronts(std::vector<int64_t> const &byte_addresses, int access_bytes) {
+  int threads_per_phase = 128 / access_bytes;
+  int words_per_access = std::max(access_bytes / 4, 1);
+  int wavefronts = 0;
+
+  for (size_t phase = 0; phase < byte_addresses.size(); phase += threads_per_phase) {
+    std::map<int, std::set<int64_t>> bank_words;
+    size_t phase_end = std::min(byte_addresses.size(), phase + threads_per_phase);
+
+    for (size_t t = phase; t < phase_end; ++t) {
+      for (int w = 0; w < words_per_access; ++w) {
+        int64_t word = byte_addresses[t] / 4 + w;
+        bank_words[int(word % 32)].insert(word);
+      }
+    }
+
+    size_t max_words = 1;
+    for (auto const &bank : bank_words) {
+      max_words = std::max(max_words, bank.second.size());
+    }
+    wavefronts += int(max_words);
+  }
+
+  return wavefronts;
+}
+
+/// Wavefronts of a conflict-free warp-wide access
+inline int smem_ideal_wavefronts(int threads, int access_bytes) {
+  return std::max((threads * access_bytes + 127) / 128, 1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Suites, each appending its results to the report. Suites skip what the device cannot run.
+void run_copy_bench(Options const &options, DeviceInfo const &device, Report &report);
+void run_ldsm_bench(Options const &options, DeviceInfo const &device, Report &report);
+void run_tma_bench(Options const &options, DeviceInfo const &device, Report &report);
+void run_mma_bench(Options const &options, DeviceInfo const &device, Report &report);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cute_bench
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
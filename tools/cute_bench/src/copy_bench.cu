@@ -0,0 +1,173 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Global to shared memory bandwidth of the CuTe copy atoms
+
+  Each CTA streams tiles of a buffer much larger than L2 into a double buffered SMEM tile, either
+  synchronously through registers (UniversalCopy) or with cp.async (SM80_CP_ASYNC_*), for each
+  vector width the atoms support.
+*/
+
+#include <string>
+
+#include "cute/tensor.hpp"
+#include "cute/atom/copy_atom.hpp"
+
+#include "cutlass/cute_bench/bench.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace cute_bench {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+constexpr int kCopyThreads = 256;
+constexpr int kCopyVectorsPerThread = 4;
+constexpr int64_t kCopyBufferBytes = int64_t(1) << 28;
+
+template <class CopyOp, class Vector, bool IsAsync>
+__global__ void __launch_bounds__(kCopyThreads)
+gmem_to_smem_kernel(Vector const *src, int64_t tile_count, Vector *sink) {
+
+  constexpr int kTileVectors = kCopyThreads * kCopyVectorsPerThread;
+  // Raw storage as cute::uint128_t is not trivially constructible
+  __shared__ alignas(16) char smem_storage[2 * kTileVectors * sizeof(Vector)];
+  Vector (*smem)[kTileVectors] = reinterpret_cast<Vector (*)[kTileVectors]>(smem_storage);
+
+  int stage = 0;
+  for (int64_t tile = blockIdx.x; tile < tile_count; tile += gridDim.x) {
+    Vector const *tile_src = src + tile * kTileVectors;
+
+    CUTE_UNROLL
+    for (int i = 0; i < kCopyVectorsPerThread; ++i) {
+      int idx = threadIdx.x + i * kCopyThreads;
+      CopyOp::copy(tile_src[idx], smem[stage][idx]);
+    }
+
+    if constexpr (IsAsync) {
+      // Keep one stage in flight while the other lands
+      cute::cp_async_fence();
+      cute::cp_async_wait<1>();
+    }
+    __syncthreads();
+    stage ^= 1;
+  }
+
+  if constexpr (IsAsync) {
+    cute::cp_async_wait<0>();
+  }
+  __syncthreads();
+
+  // Never taken, keeps the SMEM stores observable
+  if (sink != nullptr) {
+    sink[blockIdx.x * kCopyThreads + threadIdx.x] = smem[0][threadIdx.x];
+  }
+}
+
+template <class CopyOp, class Vector, bool IsAsync>
+void run_gmem_to_smem(
+    Options const &options, DeviceInfo const &device, Report &report,
+    void const *buffer, std::string const &primitive) {
+
+  auto kernel = gmem_to_smem_kernel<CopyOp, Vector, IsAsync>;
+
+  int blocks_per_sm = 0;
+  CUTE_BENCH_CUDA_CHECK(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+    &blocks_per_sm, kernel, kCopyThreads, 0));
+
+  int64_t tile_bytes = int64_t(kCopyThreads) * kCopyVectorsPerThread * sizeof(Vector);
+  int64_t tile_count = kCopyBufferBytes / tile_bytes;
+  int grid = device.sm_count * std::max(blocks_per_sm, 1);
+
+  Result result;
+  result.suite = "copy";
+  result.primitive = primitive;
+  result.config = std::to_string(kCopyThreads) + "thr x " + std::to_string(kCopyVectorsPerThread) +
+                  " x " + std::to_string(sizeof(Vector)) + "B";
+
+  result.runtime_us = time_launches(options, [&]() {
+    kernel<<<grid, kCopyThreads>>>(static_cast<Vector const *>(buffer), tile_count, nullptr);
+  });
+  result.bandwidth_gbs = double(tile_count * tile_bytes) / (result.runtime_us * 1.0e3);
+
+  // Consecutive threads store consecutive vectors
+  std::vector<int64_t> addresses;
+  for (int t = 0; t < 32; ++t) {
+    addresses.push_back(int64_t(t) * sizeof(Vector));
+  }
+  result.smem_wavefronts = smem_wavefronts(addresses, int(sizeof(Vector)));
+  result.smem_ideal_wavefronts = smem_ideal_wavefronts(32, int(sizeof(Vector)));
+
+  report.append(result);
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+void run_copy_bench(Options const &options, DeviceInfo const &device, Report &report) {
+
+  using cute::uint128_t;
+
+  void *buffer = nullptr;
+  CUTE_BENCH_CUDA_CHECK(cudaMalloc(&buffer, kCopyBufferBytes));
+  CUTE_BENCH_CUDA_CHECK(cudaMemset(buffer, 0, kCopyBufferBytes));
+
+  run_gmem_to_smem<cute::UniversalCopy<uint32_t>, uint32_t, false>(
+    options, device, report, buffer, "UniversalCopy<uint32_t>");
+  run_gmem_to_smem<cute::UniversalCopy<uint64_t>, uint64_t, false>(
+    options, device, report, buffer, "UniversalCopy<uint64_t>");
+  run_gmem_to_smem<cute::UniversalCopy<uint128_t>, uint128_t, false>(
+    options, device, report, buffer, "UniversalCopy<uint128_t>");
+
+  if (device.compute_capability >= 80) {
+    run_gmem_to_smem<cute::SM80_CP_ASYNC_CACHEALWAYS<uint32_t>, uint32_t, true>(
+      options, device, report, buffer, "SM80_CP_ASYNC_CACHEALWAYS<uint32_t>");
+    run_gmem_to_smem<cute::SM80_CP_ASYNC_CACHEALWAYS<uint64_t>, uint64_t, true>(
+      options, device, report, buffer, "SM80_CP_ASYNC_CACHEALWAYS<uint64_t>");
+    run_gmem_to_smem<cute::SM80_CP_ASYNC_CACHEALWAYS<uint128_t>, uint128_t, true>(
+      options, device, report, buffer, "SM80_CP_ASYNC_CACHEALWAYS<uint128_t>");
+    run_gmem_to_smem<cute::SM80_CP_ASYNC_CACHEGLOBAL<uint128_t>, uint128_t, true>(
+      options, device, report, buffer, "SM80_CP_ASYNC_CACHEGLOBAL<uint128_t>");
+  }
+
+  CUTE_BENCH_CUDA_CHECK(cudaFree(buffer));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cute_bench
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
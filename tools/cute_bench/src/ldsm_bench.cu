@@ -0,0 +1,194 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief SM75_U32x4_LDSM_N throughput, latency and bank conflicts over swizzled SMEM layouts
+
+  The SMEM tile is a 16 x W row-major tile of 16b elements composed with Swizzle<B,3,3>, the
+  layout CUTLASS mainloops use for K-major operands. Lane t provides the address of row t % 16
+  and 8-element column block t / 16, which is how a 16x16 MMA operand fragment is loaded.
+*/
+
+#include <string>
+
+#include "cute/tensor.hpp"
+#include "cute/atom/copy_atom.hpp"
+
+#include "cutlass/cute_bench/bench.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace cute_bench {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+constexpr int kLdsmThreads = 256;
+constexpr int kLdsmUnroll = 4;
+constexpr int kLdsmIterations = 4096;
+constexpr int kLdsmLatencyIterations = 1024;
+
+template <int B, int Width>
+using LdsmSmemLayout = decltype(cute::composition(
+  cute::Swizzle<B,3,3>{},
+  cute::Layout<cute::Shape<cute::_16, cute::Int<Width>>, cute::Stride<cute::Int<Width>, cute::_1>>{}));
+
+template <class SmemLayout>
+CUTE_HOST_DEVICE
+int ldsm_lane_offset(int lane) {
+  return SmemLayout{}(lane % 16, (lane / 16) * 8);
+}
+
+template <class SmemLayout>
+__global__ void __launch_bounds__(kLdsmThreads)
+ldsm_throughput_kernel(int iterations, uint32_t *sink) {
+
+  __shared__ alignas(128) uint16_t smem[cute::cosize_v<SmemLayout>];
+  for (int i = threadIdx.x; i < cute::cosize_v<SmemLayout>; i += kLdsmThreads) {
+    smem[i] = 0;
+  }
+  __syncthreads();
+
+  auto const *src = reinterpret_cast<cute::uint128_t const *>(
+    smem + ldsm_lane_offset<SmemLayout>(threadIdx.x % 32));
+
+  uint32_t acc = 0;
+  for (int it = 0; it < iterations; ++it) {
+    CUTE_UNROLL
+    for (int u = 0; u < kLdsmUnroll; ++u) {
+      uint32_t d0, d1, d2, d3;
+      cute::SM75_U32x4_LDSM_N::copy(*src, d0, d1, d2, d3);
+      acc ^= d0 ^ d1 ^ d2 ^ d3;
+    }
+  }
+
+  // Never taken, keeps the loads observable
+  if (sink != nullptr) {
+    sink[blockIdx.x * kLdsmThreads + threadIdx.x] = acc;
+  }
+}
+
+/// One warp issuing LDSMs whose addresses depend on the previous result
+template <class SmemLayout>
+__global__ void
+ldsm_latency_kernel(int iterations, long long *cycles) {
+
+  __shared__ alignas(128) uint16_t smem[cute::cosize_v<SmemLayout>];
+  for (int i = threadIdx.x; i < cute::cosize_v<SmemLayout>; i += 32) {
+    smem[i] = 0;
+  }
+  __syncthreads();
+
+  auto const *src = reinterpret_cast<cute::uint128_t const *>(
+    smem + ldsm_lane_offset<SmemLayout>(threadIdx.x));
+
+  uint32_t offset = 0;
+  long long start = clock64();
+  for (int it = 0; it < iterations; ++it) {
+    uint32_t d0, d1, d2, d3;
+    cute::SM75_U32x4_LDSM_N::copy(src[offset], d0, d1, d2, d3);
+    offset = d0;
+  }
+  long long stop = clock64();
+
+  if (threadIdx.x == 0) {
+    *cycles = (stop - start) + offset;
+  }
+}
+
+template <int B, int Width>
+void run_ldsm(Options const &options, DeviceInfo const &device, Report &report) {
+
+  using SmemLayout = LdsmSmemLayout<B, Width>;
+
+  Result result;
+  result.suite = "ldsm";
+  result.primitive = "SM75_U32x4_LDSM_N";
+  result.config = "Swizzle<" + std::to_string(B) + ",3,3> o 16x" + std::to_string(Width) + " 16b";
+
+  auto kernel = ldsm_throughput_kernel<SmemLayout>;
+  int blocks_per_sm = 0;
+  CUTE_BENCH_CUDA_CHECK(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+    &blocks_per_sm, kernel, kLdsmThreads, 0));
+  int grid = device.sm_count * std::max(blocks_per_sm, 1);
+
+  result.runtime_us = time_launches(options, [&]() {
+    kernel<<<grid, kLdsmThreads>>>(kLdsmIterations, nullptr);
+  });
+
+  // Each warp-wide LDSM.x4 moves four 8x8 matrices of 16b elements
+  double bytes = double(grid) * (kLdsmThreads / 32) * kLdsmIterations * kLdsmUnroll * 512;
+  result.bandwidth_gbs = bytes / (result.runtime_us * 1.0e3);
+
+  result.latency_cycles = measure_cycles([&](long long *cycles) {
+    ldsm_latency_kernel<SmemLayout><<<1, 32>>>(kLdsmLatencyIterations, cycles);
+  }) / kLdsmLatencyIterations;
+
+  std::vector<int64_t> addresses;
+  for (int lane = 0; lane < 32; ++lane) {
+    addresses.push_back(int64_t(ldsm_lane_offset<SmemLayout>(lane)) * sizeof(uint16_t));
+  }
+  result.smem_wavefronts = smem_wavefronts(addresses, 16);
+  result.smem_ideal_wavefronts = smem_ideal_wavefronts(32, 16);
+
+  report.append(result);
+}
+
+template <int Width>
+void run_ldsm_swizzles(Options const &options, DeviceInfo const &device, Report &report) {
+  run_ldsm<0, Width>(options, device, report);
+  run_ldsm<1, Width>(options, device, report);
+  run_ldsm<2, Width>(options, device, report);
+  run_ldsm<3, Width>(options, device, report);
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+void run_ldsm_bench(Options const &options, DeviceInfo const &device, Report &report) {
+
+  if (device.compute_capability < 75) {
+    return;
+  }
+
+  // 64B and 128B rows, the widths of the SW64 and SW128 operand layouts
+  run_ldsm_swizzles<32>(options, device, report);
+  run_ldsm_swizzles<64>(options, device, report);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cute_bench
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,88 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Entry point of the CuTe primitive microbenchmarks
+*/
+
+#include <fstream>
+#include <iostream>
+
+#include "cutlass/cute_bench/bench.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const **argv) {
+
+  using namespace cutlass::cute_bench;
+
+  Options options;
+  options.parse(argc, argv);
+
+  if (options.help) {
+    options.print_usage(std::cout);
+    return 0;
+  }
+
+  CUTE_BENCH_CUDA_CHECK(cudaSetDevice(options.device));
+  DeviceInfo device(options.device);
+
+  std::cout << "Device: " << device.name << " (SM" << device.compute_capability << ", "
+            << device.sm_count << " SMs, " << device.clock_ghz << " GHz)\n\n";
+  Report::print_header(std::cout);
+
+  Report report(device);
+
+  if (options.enabled("copy")) {
+    run_copy_bench(options, device, report);
+  }
+  if (options.enabled("ldsm")) {
+    run_ldsm_bench(options, device, report);
+  }
+  if (options.enabled("tma")) {
+    run_tma_bench(options, device, report);
+  }
+  if (options.enabled("mma")) {
+    run_mma_bench(options, device, report);
+  }
+
+  if (!options.output.empty()) {
+    std::ofstream file(options.output);
+    if (!file.good()) {
+      std::cerr << "Could not open " << options.output << " for writing." << std::endl;
+      return -1;
+    }
+    report.write_csv(file);
+  }
+
+  return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
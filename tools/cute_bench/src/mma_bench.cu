@@ -0,0 +1,320 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Throughput and latency of the CuTe MMA atoms
+
+  Warp-level SM80 mma.sync atoms run out of registers with several independent accumulators per
+  warp for throughput and a single dependent accumulator for latency. SM90 GMMA atoms read both
+  operands from SW128 K-major SMEM tiles through descriptors and keep one batch in flight.
+*/
+
+#include <string>
+
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/arch/config.h"
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/cute_bench/bench.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace cute_bench {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+constexpr int kMmaThreads = 256;
+constexpr int kMmaChains = 4;
+constexpr int kMmaIterations = 4096;
+constexpr int kMmaLatencyIterations = 1024;
+
+template <class MmaOp>
+CUTE_HOST_DEVICE constexpr
+int mma_flops() {
+  using Shape_MNK = typename cute::MMA_Traits<MmaOp>::Shape_MNK;
+  return 2 * int(cute::size(Shape_MNK{}));
+}
+
+/// Each warp issues Chains independent accumulations of the same register operands
+template <class MmaOp, int Chains>
+__global__ void __launch_bounds__(kMmaThreads)
+mma_sync_kernel(int iterations, long long *cycles, void *sink) {
+
+  using namespace cute;
+  using Traits = MMA_Traits<MmaOp>;
+  using ElementA = typename Traits::ValTypeA;
+  using ElementB = typename Traits::ValTypeB;
+  using ElementC = typename Traits::ValTypeC;
+
+  Tensor a = make_tensor<ElementA>(size<1>(typename Traits::ALayout{}));
+  Tensor b = make_tensor<ElementB>(size<1>(typename Traits::BLayout{}));
+  Tensor c = make_tensor<ElementC>(make_shape(size<1>(typename Traits::CLayout{}), Int<Chains>{}));
+
+  fill(a, static_cast<ElementA>(int(threadIdx.x % 3)));
+  fill(b, static_cast<ElementB>(int(threadIdx.x % 5)));
+  clear(c);
+
+  MMA_Atom<MmaOp> mma;
+
+  long long start = clock64();
+  for (int it = 0; it < iterations; ++it) {
+    CUTE_UNROLL
+    for (int j = 0; j < Chains; ++j) {
+      Tensor c_j = c(_,j);
+      mma.call(c_j, a, b, c_j);
+    }
+  }
+  long long stop = clock64();
+
+  if (cycles != nullptr && blockIdx.x == 0 && threadIdx.x == 0) {
+    *cycles = stop - start;
+  }
+
+  // Never taken, keeps the accumulators observable
+  if (sink != nullptr) {
+    reinterpret_cast<ElementC *>(sink)[blockIdx.x * kMmaThreads + threadIdx.x] = c(0,0);
+  }
+}
+
+template <class MmaOp>
+void run_mma_sync(Options const &options, DeviceInfo const &device, Report &report,
+                  std::string const &primitive) {
+
+  auto kernel = mma_sync_kernel<MmaOp, kMmaChains>;
+  int blocks_per_sm = 0;
+  CUTE_BENCH_CUDA_CHECK(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+    &blocks_per_sm, kernel, kMmaThreads, 0));
+  int grid = device.sm_count * std::max(blocks_per_sm, 1);
+
+  Result result;
+  result.suite = "mma";
+  result.primitive = primitive;
+  result.config = std::to_string(kMmaThreads / 32) + " warps x " + std::to_string(kMmaChains) + " chains";
+
+  result.runtime_us = time_launches(options, [&]() {
+    kernel<<<grid, kMmaThreads>>>(kMmaIterations, nullptr, nullptr);
+  });
+
+  double ops = double(grid) * (kMmaThreads / 32) * kMmaChains * kMmaIterations * mma_flops<MmaOp>();
+  result.throughput_tops = ops / (result.runtime_us * 1.0e6);
+
+  result.latency_cycles = measure_cycles([&](long long *cycles) {
+    mma_sync_kernel<MmaOp, 1><<<1, 32>>>(kMmaLatencyIterations, cycles, nullptr);
+  }) / kMmaLatencyIterations;
+
+  report.append(result);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+constexpr int kGmmaThreads = 128;
+
+template <class GmmaOp>
+struct GmmaConfig {
+  using Traits = cute::MMA_Traits<GmmaOp>;
+  using ElementA = typename Traits::ValTypeA;
+  using ElementB = typename Traits::ValTypeB;
+  using ElementC = typename Traits::ValTypeC;
+  using Shape_MNK = typename Traits::Shape_MNK;
+
+  // One 128B swizzle row of K per operand row
+  static constexpr int kTileK = 128 / int(sizeof(ElementA));
+
+  using SmemLayoutA = decltype(cute::tile_to_shape(
+    cute::GMMA::Layout_K_SW128_Atom<ElementA>{},
+    cute::make_shape(cute::size<0>(Shape_MNK{}), cute::Int<kTileK>{})));
+  using SmemLayoutB = decltype(cute::tile_to_shape(
+    cute::GMMA::Layout_K_SW128_Atom<ElementB>{},
+    cute::make_shape(cute::size<1>(Shape_MNK{}), cute::Int<kTileK>{})));
+
+  struct SharedStorage {
+    alignas(1024) cute::ArrayEngine<ElementA, cute::cosize_v<SmemLayoutA>> smem_A;
+    alignas(1024) cute::ArrayEngine<ElementB, cute::cosize_v<SmemLayoutB>> smem_B;
+  };
+
+  static constexpr int kFlopsPerTile = 2 * int(cute::size<0>(Shape_MNK{}) * cute::size<1>(Shape_MNK{})) * kTileK;
+};
+
+/// One warpgroup issuing the K blocks of a tile as a batch. Throughput keeps one batch in flight,
+/// latency issues a single instruction per batch and waits for it.
+template <class GmmaOp, bool Latency>
+__global__ void __launch_bounds__(kGmmaThreads)
+gmma_ss_kernel(int iterations, long long *cycles, void *sink) {
+
+#if defined(CUTE_ARCH_MMA_SM90A_ENABLED)
+  using namespace cute;
+  using Config = GmmaConfig<GmmaOp>;
+  using SharedStorage = typename Config::SharedStorage;
+
+  extern __shared__ char shared_memory[];
+  SharedStorage &shared_storage = *reinterpret_cast<SharedStorage *>(shared_memory);
+
+  uint32_t *smem_words = reinterpret_cast<uint32_t *>(shared_memory);
+  for (int i = threadIdx.x; i < int(sizeof(SharedStorage) / sizeof(uint32_t)); i += kGmmaThreads) {
+    smem_words[i] = 0;
+  }
+  __syncthreads();
+
+  Tensor sA = make_tensor(make_smem_ptr(shared_storage.smem_A.begin()), typename Config::SmemLayoutA{});  // (BLK_M,BLK_K)
+  Tensor sB = make_tensor(make_smem_ptr(shared_storage.smem_B.begin()), typename Config::SmemLayoutB{});  // (BLK_N,BLK_K)
+
+  TiledMMA tiled_mma = make_tiled_mma(GmmaOp{});
+  auto thr_mma = tiled_mma.get_thread_slice(threadIdx.x);
+  Tensor tCrA = thr_mma.make_fragment_A(thr_mma.partition_A(sA));                                       // (MMA,MMA_M,MMA_K)
+  Tensor tCrB = thr_mma.make_fragment_B(thr_mma.partition_B(sB));                                       // (MMA,MMA_N,MMA_K)
+  Tensor accum = partition_fragment_C(tiled_mma, take<0,2>(typename Config::Shape_MNK{}));              // (MMA,MMA_M,MMA_N)
+
+  constexpr int kBlocksK = Latency ? 1 : size<2>(tCrA);
+  tiled_mma.accumulate_ = GMMA::ScaleOut::Zero;
+
+  long long start = clock64();
+  warpgroup_fence_operand(accum);
+  for (int it = 0; it < iterations; ++it) {
+    warpgroup_arrive();
+    CUTE_UNROLL
+    for (int k_block = 0; k_block < kBlocksK; ++k_block) {
+      cute::gemm(tiled_mma, tCrA(_,_,k_block), tCrB(_,_,k_block), accum);
+      tiled_mma.accumulate_ = GMMA::ScaleOut::One;
+    }
+    warpgroup_commit_batch();
+    warpgroup_wait<Latency ? 0 : 1>();
+  }
+  warpgroup_wait<0>();
+  warpgroup_fence_operand(accum);
+  long long stop = clock64();
+
+  if (cycles != nullptr && blockIdx.x == 0 && threadIdx.x == 0) {
+    *cycles = stop - start;
+  }
+
+  // Never taken, keeps the accumulators observable
+  if (sink != nullptr) {
+    reinterpret_cast<typename Config::ElementC *>(sink)[blockIdx.x * kGmmaThreads + threadIdx.x] = accum(0);
+  }
+#else
+  // Built without sm_90a, reported as unsupported
+  if (cycles != nullptr && blockIdx.x == 0 && threadIdx.x == 0) {
+    *cycles = 0;
+  }
+#endif
+}
+
+template <class GmmaOp>
+void run_gmma(Options const &options, DeviceInfo const &device, Report &report,
+              std::string const &primitive) {
+
+  using Config = GmmaConfig<GmmaOp>;
+  int smem_size = int(sizeof(typename Config::SharedStorage));
+
+  auto kernel = gmma_ss_kernel<GmmaOp, false>;
+  auto latency_kernel = gmma_ss_kernel<GmmaOp, true>;
+  CUTE_BENCH_CUDA_CHECK(cudaFuncSetAttribute(
+    kernel, cudaFuncAttributeMaxDynamicSharedMemorySize, smem_size));
+  CUTE_BENCH_CUDA_CHECK(cudaFuncSetAttribute(
+    latency_kernel, cudaFuncAttributeMaxDynamicSharedMemorySize, smem_size));
+
+  Result result;
+  result.suite = "mma";
+  result.primitive = primitive;
+  result.config = "SS SW128 K-major, K tile " + std::to_string(Config::kTileK);
+
+  result.latency_cycles = measure_cycles([&](long long *cycles) {
+    latency_kernel<<<1, kGmmaThreads, smem_size>>>(kMmaLatencyIterations, cycles, nullptr);
+  }) / kMmaLatencyIterations;
+
+  if (result.latency_cycles <= 0) {
+    return;
+  }
+
+  int blocks_per_sm = 0;
+  CUTE_BENCH_CUDA_CHECK(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+    &blocks_per_sm, kernel, kGmmaThreads, smem_size));
+  int grid = device.sm_count * std::max(blocks_per_sm, 1);
+
+  result.runtime_us = time_launches(options, [&]() {
+    kernel<<<grid, kGmmaThreads, smem_size>>>(kMmaIterations, nullptr, nullptr);
+  });
+
+  double ops = double(grid) * kMmaIterations * Config::kFlopsPerTile;
+  result.throughput_tops = ops / (result.runtime_us * 1.0e6);
+
+  report.append(result);
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+void run_mma_bench(Options const &options, DeviceInfo const &device, Report &report) {
+
+  using namespace cute;
+
+  if (device.compute_capability >= 80) {
+    run_mma_sync<SM80_16x8x16_F16F16F16F16_TN>(options, device, report, "SM80_16x8x16_F16F16F16F16_TN");
+    run_mma_sync<SM80_16x8x16_F32F16F16F32_TN>(options, device, report, "SM80_16x8x16_F32F16F16F32_TN");
+    run_mma_sync<SM80_16x8x16_F32BF16BF16F32_TN>(options, device, report, "SM80_16x8x16_F32BF16BF16F32_TN");
+    run_mma_sync<SM80_16x8x8_F32TF32TF32F32_TN>(options, device, report, "SM80_16x8x8_F32TF32TF32F32_TN");
+    run_mma_sync<SM80_16x8x32_S32S8S8S32_TN>(options, device, report, "SM80_16x8x32_S32S8S8S32_TN");
+    run_mma_sync<SM80_8x8x4_F64F64F64F64_TN>(options, device, report, "SM80_8x8x4_F64F64F64F64_TN");
+  }
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+  // wgmma is specific to sm_90a
+  if (device.compute_capability == 90) {
+    using GMMA::Major;
+    run_gmma<SM90_64x128x16_F32F16F16_SS<Major::K, Major::K>>(
+      options, device, report, "SM90_64x128x16_F32F16F16_SS");
+    run_gmma<SM90_64x256x16_F32F16F16_SS<Major::K, Major::K>>(
+      options, device, report, "SM90_64x256x16_F32F16F16_SS");
+    run_gmma<SM90_64x128x16_F32BF16BF16_SS<Major::K, Major::K>>(
+      options, device, report, "SM90_64x128x16_F32BF16BF16_SS");
+    run_gmma<SM90_64x128x32_S32S8S8_SS_TN>(
+      options, device, report, "SM90_64x128x32_S32S8S8_SS_TN");
+    run_gmma<SM90_64x128x32_F32E4M3E4M3_SS_TN<>>(
+      options, device, report, "SM90_64x128x32_F32E4M3E4M3_SS_TN");
+  }
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cute_bench
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,244 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief SM90_TMA_LOAD bandwidth and latency over box shapes and SMEM swizzles
+
+  Boxes are K-major 16b tiles whose width is that of the GMMA swizzle atom (16B for INTER up to
+  128B for SW128) and whose height is swept. A single thread per CTA keeps a ring of stages in
+  flight, re-issuing a stage as soon as its mbarrier completes, so the measured bandwidth is that
+  of the TMA unit and memory system alone. Latency is the round trip of one box from DRAM.
+*/
+
+#include <string>
+
+#include "cute/tensor.hpp"
+#include "cute/atom/copy_atom.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/arch/barrier.h"
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/cute_bench/bench.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace cute_bench {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if (__CUDACC_VER_MAJOR__ >= 12)
+
+namespace {
+
+constexpr int kTmaThreads = 128;
+constexpr int kTmaStages = 4;
+constexpr int kTmaLatencyTiles = 1024;
+constexpr int kTmaBufferK = 1024;
+constexpr int64_t kTmaBufferElements = int64_t(1) << 27;
+
+template <class Element, class SmemLayout, int Stages>
+struct TmaSharedStorage {
+  alignas(1024) cute::ArrayEngine<Element, cute::cosize_v<SmemLayout>> smem;
+  alignas(16) cute::uint64_t barriers[Stages];
+};
+
+template <class Element, class SmemLayout, int Stages, class TmaLoad>
+__global__ void __launch_bounds__(kTmaThreads)
+tma_load_kernel(CUTE_GRID_CONSTANT TmaLoad const tma, int m, int k, int tile_limit, long long *cycles) {
+
+  using namespace cute;
+  using SharedStorage = TmaSharedStorage<Element, SmemLayout, Stages>;
+
+  extern __shared__ char shared_memory[];
+  SharedStorage &shared_storage = *reinterpret_cast<SharedStorage *>(shared_memory);
+
+  // Only the elected thread issues and waits, the rest of the CTA only reserves the SM slot
+  if (threadIdx.x != 0) {
+    return;
+  }
+
+  Tensor sA = make_tensor(make_smem_ptr(shared_storage.smem.begin()), SmemLayout{});  // (BOX_M,BOX_K,PIPE)
+  Tensor mA = tma.get_tma_tensor(make_shape(m, k));                                  // (M,K)
+  Tensor gA = local_tile(mA, select<0,1>(shape(SmemLayout{})), make_coord(_,_));     // (BOX_M,BOX_K,TILES_M,TILES_K)
+
+  auto cta_tma = tma.get_slice(Int<0>{});
+  Tensor tAgA = cta_tma.partition_S(gA);                                            // (TMA,TMA_M,TMA_K,TILES_M,TILES_K)
+  Tensor tAsA = cta_tma.partition_D(sA);                                            // (TMA,TMA_M,TMA_K,PIPE)
+
+  int tiles_m = size<3>(tAgA);
+  int tile_count = cute::min(tiles_m * int(size<4>(tAgA)), tile_limit);
+  constexpr uint32_t kTileBytes = uint32_t(size<0>(SmemLayout{}) * size<1>(SmemLayout{}) * sizeof(Element));
+
+  CUTE_UNROLL
+  for (int s = 0; s < Stages; ++s) {
+    initialize_barrier(shared_storage.barriers[s], 1);
+  }
+  cutlass::arch::fence_barrier_init();
+
+  int tile = blockIdx.x;
+  int issued = 0;
+  auto issue = [&](int stage) {
+    set_barrier_transaction_bytes(shared_storage.barriers[stage], kTileBytes);
+    copy(tma.with(shared_storage.barriers[stage]),
+         tAgA(_,_,_,tile % tiles_m,tile / tiles_m), tAsA(_,_,_,stage));
+    tile += gridDim.x;
+    ++issued;
+  };
+
+  long long start = clock64();
+
+  for (int s = 0; s < Stages && tile < tile_count; ++s) {
+    issue(s);
+  }
+
+  uint32_t phases = 0;
+  for (int completed = 0, stage = 0; completed < issued; ++completed) {
+    wait_barrier(shared_storage.barriers[stage], (phases >> stage) & 1);
+    phases ^= (1u << stage);
+    if (tile < tile_count) {
+      issue(stage);
+    }
+    stage = (stage + 1) % Stages;
+  }
+
+  if (cycles != nullptr && blockIdx.x == 0) {
+    *cycles = clock64() - start;
+  }
+}
+
+template <class Element, class SmemAtom, int BoxM, int Stages>
+auto make_tma_pipe_layout() {
+  using namespace cute;
+  return tile_to_shape(SmemAtom{}, make_shape(Int<BoxM>{}, size<1>(SmemAtom{}), Int<Stages>{}));
+}
+
+template <class Element, class SmemAtom, int BoxM, int Stages>
+void launch_tma_load(Element const *buffer, int grid, int tile_limit, long long *cycles) {
+
+  using namespace cute;
+
+  using SmemLayout = decltype(make_tma_pipe_layout<Element, SmemAtom, BoxM, Stages>());
+  using SharedStorage = TmaSharedStorage<Element, SmemLayout, Stages>;
+
+  int k = kTmaBufferK;
+  int m = int(kTmaBufferElements / k);
+  Tensor gA = make_tensor(make_gmem_ptr(buffer), make_layout(make_shape(m, k), LayoutRight{}));
+  auto tma = make_tma_copy(SM90_TMA_LOAD{}, gA, take<0,2>(SmemLayout{}));
+
+  auto kernel = tma_load_kernel<Element, SmemLayout, Stages, decltype(tma)>;
+  int smem_size = int(sizeof(SharedStorage));
+  CUTE_BENCH_CUDA_CHECK(cudaFuncSetAttribute(
+    kernel, cudaFuncAttributeMaxDynamicSharedMemorySize, smem_size));
+
+  kernel<<<grid, kTmaThreads, smem_size>>>(tma, m, k, tile_limit, cycles);
+}
+
+template <class SmemAtom, int BoxM>
+void run_tma(Options const &options, DeviceInfo const &device, Report &report,
+             cutlass::half_t const *buffer, std::string const &atom_name) {
+
+  using namespace cute;
+  using Element = cutlass::half_t;
+
+  using SmemLayout = decltype(make_tma_pipe_layout<Element, SmemAtom, BoxM, kTmaStages>());
+  if (int(sizeof(TmaSharedStorage<Element, SmemLayout, kTmaStages>)) > device.max_smem_per_block) {
+    return;
+  }
+
+  constexpr int kBoxK = size<1>(SmemAtom{});
+  int64_t tile_count = (kTmaBufferElements / kTmaBufferK / BoxM) * (kTmaBufferK / kBoxK);
+
+  Result result;
+  result.suite = "tma";
+  result.primitive = "SM90_TMA_LOAD";
+  result.config = atom_name + " box " + std::to_string(BoxM) + "x" + std::to_string(kBoxK) +
+                  " 16b x" + std::to_string(kTmaStages);
+
+  result.runtime_us = time_launches(options, [&]() {
+    launch_tma_load<Element, SmemAtom, BoxM, kTmaStages>(
+      buffer, device.sm_count, int(tile_count), nullptr);
+  });
+  result.bandwidth_gbs = double(tile_count) * BoxM * kBoxK * sizeof(Element) / (result.runtime_us * 1.0e3);
+
+  result.latency_cycles = measure_cycles([&](long long *cycles) {
+    launch_tma_load<Element, SmemAtom, BoxM, 1>(buffer, 1, kTmaLatencyTiles, cycles);
+  }) / kTmaLatencyTiles;
+
+  report.append(result);
+}
+
+template <class SmemAtom>
+void run_tma_boxes(Options const &options, DeviceInfo const &device, Report &report,
+                   cutlass::half_t const *buffer, std::string const &atom_name) {
+  run_tma<SmemAtom,  64>(options, device, report, buffer, atom_name);
+  run_tma<SmemAtom, 128>(options, device, report, buffer, atom_name);
+  run_tma<SmemAtom, 256>(options, device, report, buffer, atom_name);
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+void run_tma_bench(Options const &options, DeviceInfo const &device, Report &report) {
+
+  using Element = cutlass::half_t;
+
+  if (device.compute_capability < 90) {
+    return;
+  }
+
+  Element *buffer = nullptr;
+  CUTE_BENCH_CUDA_CHECK(cudaMalloc(&buffer, kTmaBufferElements * sizeof(Element)));
+  CUTE_BENCH_CUDA_CHECK(cudaMemset(buffer, 0, kTmaBufferElements * sizeof(Element)));
+
+  run_tma_boxes<cute::GMMA::Layout_K_INTER_Atom<Element>>(options, device, report, buffer, "INTER");
+  run_tma_boxes<cute::GMMA::Layout_K_SW32_Atom<Element>>(options, device, report, buffer, "SW32");
+  run_tma_boxes<cute::GMMA::Layout_K_SW64_Atom<Element>>(options, device, report, buffer, "SW64");
+  run_tma_boxes<cute::GMMA::Layout_K_SW128_Atom<Element>>(options, device, report, buffer, "SW128");
+
+  CUTE_BENCH_CUDA_CHECK(cudaFree(buffer));
+}
+
+#else
+
+void run_tma_bench(Options const &options, DeviceInfo const &device, Report &report) {
+  // TMA descriptors require CUDA 12
+}
+
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cute_bench
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,153 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Concurrent submission of independent library operations.
+
+    A BatchLauncher distributes a list of operations across a pool of streams it owns, or records
+    them as the independent branches of one CUDA graph, and signals the completion of the whole
+    batch with a single event. The batch is ordered after all prior work on the stream it is
+    submitted to, and that stream waits for the batch to complete.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "cutlass/library/library.h"
+#include "cutlass/library/workspace_pool.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace library {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// One operation of a batch. Operations of a batch must not depend on one another.
+struct BatchedOperation {
+
+  /// Operation to launch
+  Operation const *operation = nullptr;
+
+  /// Configuration and arguments structures of the operation's kind (e.g., GemmUniversalConfiguration
+  /// and GemmUniversalArguments). Only accessed during submit().
+  void const *configuration = nullptr;
+  void const *arguments = nullptr;
+
+  /// Device workspace of at least operation->get_device_workspace_size() bytes. If null, the
+  /// workspace is taken from the launcher's workspace pool.
+  void *device_workspace = nullptr;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+class BatchLauncher {
+public:
+
+  /// Strategy by which the operations of a batch are made concurrent
+  enum class Mode {
+    kStreams,           ///< launches operations round-robin on the streams of the launcher
+    kGraph              ///< captures operations as independent branches of a CUDA graph
+  };
+
+private:
+
+  /// Device on which streams, events, and graphs are created
+  int device_idx_;
+
+  Mode mode_;
+
+  /// Streams across which operations are distributed. In graph mode, these are only used for capture.
+  std::vector<cudaStream_t> streams_;
+
+  /// Events recorded at the end of the work on each stream
+  std::vector<cudaEvent_t> join_events_;
+
+  /// Event ordering the batch after prior work on the submitting stream
+  cudaEvent_t fork_event_;
+
+  /// Event recorded once the entire batch has completed
+  cudaEvent_t completion_event_;
+
+  /// Pool providing device workspaces of operations without one. May be null.
+  WorkspacePool *workspace_pool_;
+
+  /// Host workspaces of the most recently submitted batch
+  std::vector<std::vector<uint8_t>> host_workspaces_;
+
+  /// Instantiated graph of the most recent batch in graph mode, updated in place when possible
+  cudaGraphExec_t graph_exec_;
+
+private:
+
+  /// Initializes and runs the operations of a batch on the launcher's streams
+  Status launch_(std::vector<BatchedOperation> const &operations, cudaStream_t stream);
+
+public:
+
+  /// Creates `stream_count` non-blocking streams on the current device. In stream mode, operations
+  /// without a device workspace take one from `workspace_pool`. In graph mode, workspaces are not
+  /// taken from the pool, since stream-ordered allocations would be recorded into the graph.
+  explicit BatchLauncher(
+    int stream_count = 4,
+    Mode mode = Mode::kStreams,
+    WorkspacePool *workspace_pool = nullptr);
+
+  /// Destroys streams, events, and graphs. Synchronizes with any batch still executing.
+  ~BatchLauncher();
+
+  BatchLauncher(BatchLauncher const &) = delete;
+  BatchLauncher &operator=(BatchLauncher const &) = delete;
+
+  /// Submits a batch of independent operations, ordered after prior work on `stream`. Subsequent
+  /// work on `stream` is ordered after the batch. If `completion_event` is not null, it receives an
+  /// event recorded once the batch has completed. The event is owned by the launcher and is
+  /// re-recorded by the next call to submit().
+  ///
+  /// Device workspaces must remain valid until the batch has completed.
+  Status submit(
+    std::vector<BatchedOperation> const &operations,
+    cudaStream_t stream = nullptr,
+    cudaEvent_t *completion_event = nullptr);
+
+  /// Number of streams across which operations are distributed
+  int stream_count() const;
+
+  Mode mode() const;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,162 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Planning of tensor contractions given in einsum notation onto library GEMMs.
+
+    A contraction such as "mhk,nhk->mnh" is mapped onto batched GEMMs without permuting any
+    operand in memory. Each subscript is classified as an M, N, K or batch (L) mode, and the modes
+    of each class are folded into a single GEMM extent whenever their strides are nested in every
+    operand of the class, as hierarchical CuTe layouts of a GETT would be. Modes that cannot be
+    folded are iterated on the host, one GEMM launch per coordinate; unfolded K modes accumulate
+    into D with beta = 1. Operands must have a unit stride mode in the M or K class (A), the N or
+    K class (B), and the M or N class (C and D), so that each is a row- or column-major matrix.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "cutlass/library/library.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace library {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Tensor contraction D = alpha * einsum(A, B) + beta * C
+struct ContractionProblem {
+
+  /// Explicit einsum equation "<A>,<B>-><D>" of single-letter subscripts, e.g. "mhk,nhk->mnh".
+  /// Subscripts may not repeat within an operand. C has the subscripts of D.
+  std::string equation;
+
+  /// Extent of each subscript
+  std::map<char, int64_t> extents;
+
+  /// Strides in elements, one per subscript of the operand in the order of the equation
+  std::vector<int64_t> stride_A;
+  std::vector<int64_t> stride_B;
+  std::vector<int64_t> stride_C;          ///< if empty, the strides of D
+  std::vector<int64_t> stride_D;
+
+  NumericTypeID element_A = NumericTypeID::kF16;
+  NumericTypeID element_B = NumericTypeID::kF16;
+  NumericTypeID element_C = NumericTypeID::kF16;
+  NumericTypeID element_D = NumericTypeID::kF16;
+  NumericTypeID element_compute = NumericTypeID::kF32;
+  NumericTypeID element_scalar = NumericTypeID::kF32;
+};
+
+/// Mode of a contraction iterated on the host
+struct ContractionLoopMode {
+
+  char subscript = 0;
+  int64_t extent = 1;
+
+  /// Offset in elements between consecutive coordinates of the mode in each operand
+  int64_t stride_A = 0;
+  int64_t stride_B = 0;
+  int64_t stride_C = 0;
+  int64_t stride_D = 0;
+
+  /// True for K modes, whose launches accumulate into D
+  bool accumulates = false;
+};
+
+/// Mapping of a contraction onto batched GEMMs D <= alpha * A*B + beta * C
+struct ContractionPlan {
+
+  /// Subscripts folded into each GEMM extent, innermost first
+  std::string modes_M;
+  std::string modes_N;
+  std::string modes_K;
+  std::string modes_L;
+
+  int M = 1;
+  int N = 1;
+  int K = 1;
+  int batch_count = 1;
+
+  NumericTypeID element_A = NumericTypeID::kInvalid;
+  NumericTypeID element_B = NumericTypeID::kInvalid;
+  NumericTypeID element_C = NumericTypeID::kInvalid;
+  NumericTypeID element_D = NumericTypeID::kInvalid;
+  NumericTypeID element_compute = NumericTypeID::kInvalid;
+  NumericTypeID element_scalar = NumericTypeID::kInvalid;
+
+  LayoutTypeID layout_A = LayoutTypeID::kInvalid;
+  LayoutTypeID layout_B = LayoutTypeID::kInvalid;
+  LayoutTypeID layout_C = LayoutTypeID::kInvalid;   ///< layout of both C and D
+
+  int64_t lda = 0;
+  int64_t ldb = 0;
+  int64_t ldc = 0;
+  int64_t ldd = 0;
+
+  int64_t batch_stride_A = 0;
+  int64_t batch_stride_B = 0;
+  int64_t batch_stride_C = 0;
+  int64_t batch_stride_D = 0;
+
+  /// Modes iterated on the host, outermost first. K modes follow all other modes.
+  std::vector<ContractionLoopMode> loop_modes;
+
+  //
+  // Methods
+  //
+
+  /// Number of GEMM launches executing the plan
+  int64_t launch_count() const;
+
+  /// Returns the equivalent plan computing D^T = B^T * A^T, with the roles of A and B and of
+  /// M and N exchanged and all layouts transposed
+  ContractionPlan transposed() const;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Maps `problem` onto batched GEMMs, folding as many modes as possible into the GEMM extents.
+/// Returns Status::kErrorInvalidProblem for malformed equations, strides or extents, and
+/// Status::kErrorNotSupported if the contraction cannot be computed without permuting an operand:
+/// a subscript appearing in only one operand, or an operand without a unit stride in a suitable mode.
+Status plan_contraction(ContractionProblem const &problem, ContractionPlan &plan);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -155,6 +155,49 @@ struct TileDescription {
   }
 };
 
+/// Static resource usage of the kernel implementing an operation on the current device. Recorded
+/// once by Manifest when the operation is added; all fields are zero if it was not recorded.
+struct KernelResourceDescription {
+
+  /// True if the kernel was queried successfully
+  bool valid;
+
+  /// Registers allocated per thread
+  int registers_per_thread;
+
+  /// Statically allocated shared memory per CTA in bytes
+  int static_smem_bytes;
+
+  /// Dynamically allocated shared memory per CTA in bytes
+  int dynamic_smem_bytes;
+
+  /// Local memory per thread in bytes. Nonzero if registers spill.
+  int local_memory_bytes;
+
+  /// Threads per CTA
+  int threads_per_cta;
+
+  /// Maximum number of co-resident CTAs per SM
+  int max_active_ctas_per_sm;
+
+  /// Number of CTAs per cluster. Zero if the cluster shape is chosen at run time.
+  int cluster_size;
+
+  //
+  // Methods
+  //
+
+  KernelResourceDescription():
+    valid(false),
+    registers_per_thread(0),
+    static_smem_bytes(0),
+    dynamic_smem_bytes(0),
+    local_memory_bytes(0),
+    threads_per_cta(0),
+    max_active_ctas_per_sm(0),
+    cluster_size(0) { }
+};
+
 /// High-level description of an operation
 struct OperationDescription {
 
@@ -170,6 +213,9 @@ struct OperationDescription {
   /// Describes the tiled structure of a GEMM-like computation
   TileDescription tile_description;
 
+  /// Resource usage of the kernel, recorded by Manifest
+  KernelResourceDescription resources;
+
   //
   // Methods
   //
@@ -331,6 +377,30 @@ struct GroupedGemmDescription : public OperationDescription {
   bool is_moe{false};
 };
 
+/// Description of a GEMM distributed over the devices of a tensor parallel group
+struct DistributedGemmDescription : public OperationDescription {
+
+  /// Describes the GEMM computed by each device in each stage
+  GemmDescription gemm;
+
+  /// Tiling and communication schedule
+  DistributedGemmSchedule schedule{DistributedGemmSchedule::kInvalid};
+
+  /// Number of devices in the tensor parallel group
+  int tp{1};
+
+  /// Extents of the all gather and reduce scatter axes of two dimensional schedules
+  int tp_all_gather{1};
+  int tp_reduce_scatter{1};
+
+  /// Divisors of the global problem extents giving the operands owned by each device: A is
+  /// (M / shard_A.m()) x (K / shard_A.k()), B is (N / shard_B.n()) x (K / shard_B.k()) and
+  /// C and D are (M / shard_C.m()) x (N / shard_C.n())
+  gemm::GemmCoord shard_A{1, 1, 1};
+  gemm::GemmCoord shard_B{1, 1, 1};
+  gemm::GemmCoord shard_C{1, 1, 1};
+};
+
 /// Description of all GEMM computations
 struct BlockScaledGemmDescription : public OperationDescription {
 
@@ -0,0 +1,229 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Cache of autotuned GEMM operation selections used by library::Handle.
+
+    Entries map a GEMM functional key, device compute capability, problem alignment and a
+    power-of-two bucket of the problem extent onto the name of the fastest measured operation and,
+    for operations with a dynamic cluster shape, the preferred and fallback cluster shapes it was
+    fastest at.
+    Block-scaled GEMMs are keyed likewise, and convolutions and distributed GEMMs by their exact
+    problem size.
+    The cache may be saved to and loaded from a text file so that tuning results persist across
+    processes.
+*/
+
+#pragma once
+
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include "cutlass/library/library.h"
+#include "cutlass/library/operation_table.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace library {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Identifies a class of GEMM problems sharing one autotuning decision
+struct GemmAutotuneKey {
+
+  GemmFunctionalKey functional_key;
+
+  /// Compute capability of the device the decision was made on
+  int compute_capability;
+
+  /// Largest alignment (in elements) satisfied by the problem
+  int alignment;
+
+  /// Problem extents rounded up to the next power of two
+  int m_bucket;
+  int n_bucket;
+  int k_bucket;
+
+  //
+  // Methods
+  //
+
+  GemmAutotuneKey(
+    GemmFunctionalKey const &functional_key,
+    int compute_capability,
+    int alignment,
+    int M,
+    int N,
+    int K
+  ):
+    functional_key(functional_key),
+    compute_capability(compute_capability),
+    alignment(alignment),
+    m_bucket(bucket(M)),
+    n_bucket(bucket(N)),
+    k_bucket(bucket(K)) { }
+
+  /// Rounds a problem extent up to the next power of two
+  static int bucket(int extent) {
+    int result = 1;
+    while (result < extent && result < (1 << 30)) {
+      result <<= 1;
+    }
+    return result;
+  }
+};
+
+/// Returns a whitespace-free string uniquely identifying the key
+std::string to_string(GemmAutotuneKey const &key);
+
+/// Returns a whitespace-free string identifying a class of block-scaled GEMM problems. Extents
+/// are bucketed as in GemmAutotuneKey.
+std::string autotune_key(
+  BlockScaledGemmFunctionalKey const &key, int compute_capability, int alignment, int M, int N, int K);
+
+/// Returns a whitespace-free string identifying a class of blockwise-scaled GEMM problems. Extents
+/// are bucketed as in GemmAutotuneKey.
+std::string autotune_key(
+  BlockwiseGemmFunctionalKey const &key, int compute_capability, int alignment, int M, int N, int K);
+
+/// Returns a whitespace-free string identifying a GEMM distributed over `tp` devices by its local
+/// GEMM and exact global problem size, since the schedule is selected per layer
+std::string autotune_key(
+  GemmFunctionalKey const &key, int compute_capability, int tp, int M, int N, int K, int batch_count);
+
+/// Returns a whitespace-free string identifying a two dimensional convolution problem
+std::string autotune_key(
+  ConvFunctionalKey const &key, int compute_capability, conv::Conv2dProblemSize const &problem_size);
+
+/// Returns a whitespace-free string identifying a three dimensional convolution problem
+std::string autotune_key(
+  ConvFunctionalKey const &key, int compute_capability, conv::Conv3dProblemSize const &problem_size);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Operation selected for a class of problems. Cluster shapes with a zero extent are not part of
+/// the selection, and the cluster shapes of the launch are used instead. Likewise, an invalid
+/// raster order or a zero swizzle size or split-K slice count leaves the launch's value in place.
+struct GemmAutotuneSelection {
+
+  /// Library name of the selected operation
+  std::string operation_name;
+
+  /// Preferred and fallback cluster shapes selected for an operation with a dynamic cluster shape
+  gemm::GemmCoord cluster_shape{};
+  gemm::GemmCoord cluster_shape_fallback{};
+
+  /// Tile scheduler arguments of GemmUniversalArguments selected with the operation, typically
+  /// measured offline by cutlass_profiler --export-tuning-db
+  RasterOrder raster_order{RasterOrder::kInvalid};
+  int swizzle_size{0};
+  int split_k_slices{0};
+
+  /// Returns true if the selection includes cluster shapes
+  bool has_cluster_shape() const {
+    return cluster_shape.product() != 0 && cluster_shape_fallback.product() != 0;
+  }
+
+  /// Returns true if the selection includes any tile scheduler argument
+  bool has_scheduler_arguments() const {
+    return raster_order != RasterOrder::kInvalid || swizzle_size != 0 || split_k_slices != 0;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Thread-safe cache of autotuned operation names. May be shared among several Handles.
+///
+/// Entries are spread over shards by the hash of their key, each guarded by a reader-writer lock,
+/// so that concurrent lookups from many host threads take shared locks on different cache lines
+/// and only an insertion excludes readers of its own shard.
+class GemmAutotuneCache {
+private:
+
+  /// Number of independently locked shards
+  static int const kShardCount = 64;
+
+  struct alignas(64) Shard {
+    mutable std::shared_mutex mutex;
+
+    /// Maps serialized GemmAutotuneKey onto the selected operation
+    std::unordered_map<std::string, GemmAutotuneSelection> entries;
+  };
+
+  Shard shards_[kShardCount];
+
+  /// Returns the shard holding a serialized key
+  Shard &shard(std::string const &key);
+  Shard const &shard(std::string const &key) const;
+
+public:
+
+  GemmAutotuneCache() { }
+
+  /// Finds the name of the operation selected for a key. Returns false if no entry exists.
+  bool find(GemmAutotuneKey const &key, std::string &operation_name) const;
+
+  /// Finds the name of the operation selected for a serialized key
+  bool find(std::string const &key, std::string &operation_name) const;
+
+  /// Finds the selection, including cluster shapes, for a serialized key
+  bool find(std::string const &key, GemmAutotuneSelection &selection) const;
+
+  /// Records the operation selected for a key, replacing any previous entry
+  void insert(GemmAutotuneKey const &key, std::string const &operation_name);
+
+  /// Records the operation selected for a key serialized by to_string(GemmAutotuneKey const &)
+  void insert(std::string const &key, std::string const &operation_name);
+
+  /// Records the selection, including cluster shapes, for a serialized key
+  void insert(std::string const &key, GemmAutotuneSelection const &selection);
+
+  /// Removes all entries
+  void clear();
+
+  /// Number of entries
+  size_t size() const;
+
+  /// Merges entries from a file written by save(), or exported by cutlass_profiler with
+  /// --export-tuning-db. Entries in the file replace existing ones.
+  Status load(std::string const &path);
+
+  /// Writes all entries to a file
+  Status save(std::string const &path) const;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
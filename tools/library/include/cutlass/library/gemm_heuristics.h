@@ -0,0 +1,135 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Analytical cost model ranking GEMM operations for a problem shape without autotuning.
+
+    The model estimates the execution time of each candidate from its GemmDescription as the
+    larger of three terms: MMA work executed in waves of concurrently resident CTAs, operand
+    traffic between L2 and shared memory given the arithmetic intensity of the tile, and DRAM
+    traffic after the reuse of operand panels in L2 among the CTAs of one wave. All terms are in
+    the same relative unit, so estimates are comparable among operations but are not times.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "cutlass/library/library.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace library {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Device properties consumed by the GEMM cost model
+struct GemmHeuristicDeviceInfo {
+
+  /// Compute capability of the device
+  int compute_capability;
+
+  /// Number of SMs
+  int sm_count;
+
+  /// Size of the L2 cache in bytes
+  int64_t l2_cache_bytes;
+
+  /// Shared memory available per SM in bytes
+  int64_t smem_per_sm_bytes;
+
+  /// Ratio of peak dense tensor core throughput on 16b operands (flop/s) to DRAM bandwidth
+  /// (byte/s). If zero, a typical value for the compute capability is used.
+  double machine_balance;
+
+  //
+  // Methods
+  //
+
+  GemmHeuristicDeviceInfo(
+    int compute_capability = 80,
+    int sm_count = 108,
+    int64_t l2_cache_bytes = (40 << 20),
+    int64_t smem_per_sm_bytes = (164 << 10),
+    double machine_balance = 0);
+
+  /// Constructs from the properties of a CUDA device
+  explicit GemmHeuristicDeviceInfo(cudaDeviceProp const &device);
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Terms of the cost estimate of one operation
+struct GemmHeuristicEstimate {
+
+  /// Number of output tiles, including tiles padding the grid to whole clusters
+  int64_t tiles;
+
+  /// Number of waves of concurrently resident CTAs needed to compute all tiles
+  int64_t waves;
+
+  /// Fraction of CTA slots doing useful work, averaged over all waves
+  double wave_efficiency;
+
+  /// Flops per byte of operands loaded into shared memory by one CTA
+  double arithmetic_intensity;
+
+  /// Estimated DRAM traffic in bytes
+  double dram_bytes;
+
+  /// Estimated cost. Only comparable with estimates for the same problem and device.
+  double cost;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Estimates the cost of computing a GEMM of `problem_size` and `batch_count` with an operation
+/// described by `desc`
+GemmHeuristicEstimate estimate_gemm_cost(
+  GemmDescription const &desc,
+  gemm::GemmCoord problem_size,
+  int batch_count,
+  GemmHeuristicDeviceInfo const &device);
+
+/// Sorts `operations` in ascending order of estimated cost. Operations with equal estimates
+/// retain their relative order.
+void rank_gemm_operations(
+  std::vector<Operation const *> &operations,
+  gemm::GemmCoord problem_size,
+  int batch_count,
+  GemmHeuristicDeviceInfo const &device);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
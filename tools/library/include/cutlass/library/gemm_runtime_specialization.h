@@ -0,0 +1,166 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Runtime specialization of GEMM operations on fixed problem constants.
+
+    A GemmRuntimeSpecializer takes the description of a library GEMM operation and the constants of
+    one concrete problem (extents and strides), and JIT-compiles a variant of the operation with
+    NVRTC in which all of them are cute::Int<> compile-time constants. Bounds predication and most
+    address arithmetic then fold away in the generated kernel. Specialized operations are cached and
+    appended to a Manifest, and are run through the ordinary library::Operation interface.
+
+    Specialization requires the library to be built with CUTLASS_LIBRARY_NVRTC=ON. Variants are
+    generated from the SM90 cp.async warp-specialized kernel with a 1x1x1 cluster, whose kernel
+    parameters do not depend on TMA descriptors built on the host.
+*/
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "cutlass/library/library.h"
+#include "cutlass/library/manifest.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace library {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Problem constants baked into a runtime-specialized GEMM. Strides are in elements.
+struct GemmProblemConstants {
+
+  int m{0};
+  int n{0};
+  int k{0};
+  int batch_count{1};
+
+  int64_t lda{0};
+  int64_t ldb{0};
+  int64_t ldc{0};
+  int64_t ldd{0};
+
+  int64_t batch_stride_A{0};
+  int64_t batch_stride_B{0};
+  int64_t batch_stride_C{0};
+  int64_t batch_stride_D{0};
+
+  //
+  // Methods
+  //
+
+  GemmProblemConstants() { }
+
+  /// Captures the constants of the problem described by GEMM universal arguments
+  explicit GemmProblemConstants(GemmUniversalArguments const &arguments);
+
+  /// Returns true if the arguments describe exactly this problem. Batch strides are ignored
+  /// if batch_count is 1.
+  bool matches(
+    gemm::GemmCoord problem_size,
+    int batch_count,
+    int64_t lda,
+    int64_t ldb,
+    int64_t ldc,
+    int64_t ldd) const;
+
+  bool operator==(GemmProblemConstants const &rhs) const;
+};
+
+/// Returns a whitespace-free string uniquely identifying the constants
+std::string to_string(GemmProblemConstants const &constants);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Thread-safe factory and cache of GEMM operations specialized on problem constants
+class GemmRuntimeSpecializer {
+private:
+
+  /// Manifest owning the specialized operations
+  Manifest &manifest_;
+
+  /// Directories searched by NVRTC for CUTLASS, CuTe and CUDA headers
+  std::vector<std::string> include_paths_;
+
+  /// Directory in which compiled cubins persist across processes. Empty to disable.
+  std::string cache_dir_;
+
+  mutable std::mutex mutex_;
+
+  /// Maps the operation name, problem constants and device onto a specialized operation
+  std::unordered_map<std::string, Operation const *> operations_;
+
+  /// Compiler log of the most recent compilation
+  std::string compile_log_;
+
+public:
+
+  /// Specialized operations are appended to `manifest`, which must outlive them. If no include
+  /// paths are given, the CUTLASS and CUDA include directories of the library build are used.
+  explicit GemmRuntimeSpecializer(
+    Manifest &manifest,
+    std::vector<std::string> const &include_paths = {},
+    std::string const &cache_dir = "");
+
+  GemmRuntimeSpecializer(GemmRuntimeSpecializer const &) = delete;
+  GemmRuntimeSpecializer &operator=(GemmRuntimeSpecializer const &) = delete;
+
+  /// Returns an operation computing the GEMM of `description` with all problem constants fixed,
+  /// compiling it for the current device if it is not yet cached. Returns kErrorNotSupported if
+  /// the description, the constants or the device cannot be specialized.
+  Status specialize(
+    Operation const *&operation,
+    GemmDescription const &description,
+    GemmProblemConstants const &constants);
+
+  /// Emits the CUDA C++ source of the specialized kernel without compiling it
+  static Status emit_source(
+    std::string &source,
+    GemmDescription const &description,
+    GemmProblemConstants const &constants);
+
+  /// Number of cached operations
+  size_t size() const;
+
+  /// Compiler log of the most recent compilation, including any errors
+  std::string compile_log() const;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -35,7 +35,14 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <vector>
 #include "cutlass/library/library.h"
+#include "cutlass/library/contraction.h"
+#include "cutlass/library/gemm_autotune_cache.h"
+#include "cutlass/library/workspace_pool.h"
+#include "cutlass/library/prepacked_filter_cache.h"
+#include "cutlass/library/telemetry.h"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -45,12 +52,22 @@ namespace library {
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// Handle object
+///
+/// Thread safety: a Handle holds per-caller state (stream, workspace, last operation, scalar
+/// modes) and must not be used by several threads at once. Concurrent callers each use their own
+/// Handle, typically one per thread or per stream. The operation table read by all Handles is
+/// immutable once Singleton::get() returns, and the autotuning cache, workspace pool, filter
+/// cache and telemetry are thread-safe, so one instance of each may be shared among all Handles
+/// of a process.
 class Handle {
 private:
 
   /// Host workspace
   static int const kHostWorkspaceSize = (4 << 10);
 
+  /// Largest GEMM M dimension for which gemm() considers the skinny tensor core kernels
+  static int const kSmallMMaximum = 16;
+
   /// Provider of operations
   Provider provider_;
 
@@ -74,6 +91,118 @@ private:
 
   int device_idx_;
 
+  /// Number of SMs available to kernels launched on stream_. Smaller than the device SM count when
+  /// stream_ belongs to a green context, so that persistent kernels size their grid to the partition.
+  int sm_count_;
+
+  /// Indicates whether Handle::gemm() measures candidate operations to select among them
+  bool autotune_enabled_;
+
+  /// Number of timed iterations per candidate operation when autotuning
+  int autotune_iterations_;
+
+  /// Cache of autotuned selections, possibly shared with other Handles
+  std::shared_ptr<GemmAutotuneCache> autotune_cache_;
+
+  /// Indicates whether operations not selected by autotuning are chosen by the GEMM cost model
+  bool heuristics_enabled_;
+
+  /// Optional stream-ordered workspace pool, possibly shared with other Handles. When set, it
+  /// supplies device workspaces in place of workspace_.
+  std::shared_ptr<WorkspacePool> workspace_pool_;
+
+  /// Cache of filters transformed for conv operations, possibly shared with other Handles
+  std::shared_ptr<PrepackedFilterCache> filter_cache_;
+
+  /// Optional sampler of launched operations, possibly shared with other Handles
+  std::shared_ptr<OperationTelemetry> telemetry_;
+
+  /// If positive, the device reference provider computes only this many sampled rows of output tiles
+  int reference_sample_count_;
+
+  /// Seed selecting the sampled rows
+  uint64_t reference_sample_seed_;
+
+  /// Per-row (token) and per-col (channel) scales dequantizing the output of gemm_universal()
+  void const *row_scale_;
+  void const *col_scale_;
+
+  /// Indicates whether operations are launched with programmatic dependent launch (PDL)
+  bool pdl_enabled_;
+
+  /// Returns true if `operation` is to be launched with PDL. Kernels targeting architectures
+  /// prior to SM90 are launched without it.
+  bool launch_with_pdl(Operation const *operation) const;
+
+  /// Returns a device workspace of at least `bytes` bytes for use on the current stream, or
+  /// nullptr if none is available.
+  void *acquire_workspace(uint64_t bytes);
+
+  /// Launches `operation` on the current stream. If the telemetry samples the launch, it is timed
+  /// and recorded under `entry_point`, with `problem_size` and `batch_count` as its problem (or
+  /// `problem_key` if given and `problem_size` is empty), and with its PDL flag and cluster shapes
+  /// as its configuration.
+  Status run_operation(
+    Operation const *operation,
+    void const *arguments,
+    void *host_workspace,
+    void *device_workspace,
+    char const *entry_point,
+    gemm::GemmCoord problem_size,
+    int batch_count,
+    bool use_pdl,
+    gemm::GemmCoord const *cluster_shape = nullptr,
+    gemm::GemmCoord const *cluster_shape_fallback = nullptr,
+    std::string const *problem_key = nullptr);
+
+  /// Executes D <= alpha * A*B + beta * C with small M as D^T <= alpha * B^T*A^T + beta * C^T,
+  /// mapping M onto the narrow tile N of a skinny tensor core kernel. Returns
+  /// Status::kErrorNotSupported if no such kernel can implement the problem.
+  Status gemm_small_m(
+    int M,
+    int N,
+    int K,
+    NumericTypeID element_compute,
+    NumericTypeID element_scalar,
+    void const *alpha,
+    NumericTypeID element_A,
+    LayoutTypeID layout_A,
+    ComplexTransform transform_A,
+    void const * ptr_A,
+    int64_t lda,
+    NumericTypeID element_B,
+    LayoutTypeID layout_B,
+    ComplexTransform transform_B,
+    void const * ptr_B,
+    int64_t ldb,
+    void const * beta,
+    NumericTypeID element_C,
+    void const * ptr_C,
+    int64_t ldc,
+    void * ptr_D,
+    int64_t ldd);
+
+  /// Selects an operation among `candidates`, given in descending order of preference, and
+  /// launches it on behalf of `entry_point`. The selection is taken from the autotuning cache under `autotune_key` unless the
+  /// key is empty, then from the GEMM cost model for `problem_size` if heuristics are enabled and
+  /// `rank_by_cost` is set, and otherwise is the first candidate able to implement the problem.
+  /// `use_pdl` refers to the PDL flag of `arguments`. `cluster_shape` and `cluster_shape_fallback`
+  /// optionally refer to the cluster shapes of `arguments`, which autotuning then selects for
+  /// operations with a dynamic cluster shape.
+  Status select_and_run(
+    char const *entry_point,
+    std::vector<Operation const *> const &candidates,
+    std::string const &autotune_key,
+    bool allow_tuning,
+    bool rank_by_cost,
+    gemm::GemmCoord problem_size,
+    int batch_count,
+    void const *configuration,
+    void *arguments,
+    bool &use_pdl,
+    gemm::GemmCoord *cluster_shape = nullptr,
+    gemm::GemmCoord *cluster_shape_fallback = nullptr);
+
 public:
 
   /// Constructor
@@ -95,12 +224,16 @@ public:
   /// Returns compute capability of the selected device
   int compute_capability() const;
 
-  /// Sets the current CUDA stream
+  /// Sets the current CUDA stream. If the stream belongs to a green context, subsequent
+  /// operations are sized to the SMs of its partition.
   void set_stream(cudaStream_t stream);
 
   /// Gets the current CUDA stream
   cudaStream_t get_stream() const;
 
+  /// Gets the number of SMs available to kernels launched on the current stream
+  int get_sm_count() const;
+
   /// Gets the current provider
   Provider get_provider() const;
 
@@ -116,6 +249,16 @@ public:
   /// Sets the size of device workspace, invalidating calls to get_device_workspace()
   void set_workspace_size(size_t bytes);
 
+  /// Sets a stream-ordered workspace pool from which device workspaces are acquired per stream.
+  /// Passing nullptr reverts to the workspace sized by set_workspace_size(). The pool cannot grow
+  /// while the stream is being captured into a CUDA graph, so operations whose workspace exceeds
+  /// the stream's block fail with kErrorNotSupported during capture. Grow it beforehand with
+  /// WorkspacePool::acquire().
+  void set_workspace_pool(std::shared_ptr<WorkspacePool> pool);
+
+  /// Gets the workspace pool, if any
+  std::shared_ptr<WorkspacePool> get_workspace_pool() const;
+
   /// Gets the scalar pointer mode
   ScalarPointerMode get_scalar_pointer_mode() const;
 
@@ -125,6 +268,66 @@ public:
   /// Gets the most recently executed operation
   Operation const *get_last_operation() const;
 
+  /// Enables or disables programmatic dependent launch (PDL). When enabled, SM90 and later kernels
+  /// launched by the computations below may begin while the preceding kernel in the stream drains.
+  void set_pdl(bool enabled);
+
+  /// Returns true if programmatic dependent launch is enabled
+  bool get_pdl() const;
+
+  /// Enables or disables autotuning. When enabled, the first call to gemm() or to gemm_universal()
+  /// in GemmUniversalMode::kGemm for each functional key and problem bucket times all candidate
+  /// operations and caches the fastest one. grouped_gemm(), block_scaled_gemm() and
+  /// blockwise_gemm() are tuned likewise, and conv2d() and conv3d() per exact problem size. Cached
+  /// selections, including those prebuilt into the library from a dispatch table file, are used
+  /// even when autotuning is disabled.
+  void set_autotuning(bool enabled, int iterations = 10);
+
+  /// Returns true if autotuning is enabled
+  bool get_autotuning() const;
+
+  /// Sets the autotuning cache. Caches may be shared among Handles and persisted with
+  /// GemmAutotuneCache::save() and GemmAutotuneCache::load().
+  void set_autotune_cache(std::shared_ptr<GemmAutotuneCache> cache);
+
+  /// Gets the autotuning cache
+  std::shared_ptr<GemmAutotuneCache> get_autotune_cache() const;
+
+  /// Sets the cache of prepacked convolution filters. Caches may be shared among Handles.
+  void set_filter_cache(std::shared_ptr<PrepackedFilterCache> cache);
+
+  /// Gets the cache of prepacked convolution filters
+  std::shared_ptr<PrepackedFilterCache> get_filter_cache() const;
+
+  /// Sets the telemetry sampling the operations launched by the computations below. Telemetry may
+  /// be shared among Handles. Passing nullptr (default) disables sampling.
+  void set_telemetry(std::shared_ptr<OperationTelemetry> telemetry);
+
+  /// Gets the telemetry, if any
+  std::shared_ptr<OperationTelemetry> get_telemetry() const;
+
+  /// Enables or disables heuristic selection. When enabled, the GEMM entry points rank
+  /// candidate operations not selected by autotuning with the cost model of gemm_heuristics.h and
+  /// launch the first one able to implement the problem. Otherwise, the first candidate in order
+  /// of preference is launched.
+  void set_heuristics(bool enabled);
+
+  /// Returns true if heuristic selection is enabled
+  bool get_heuristics() const;
+
+  /// Sets the number of randomly chosen output tile rows computed by the device reference provider
+  /// in gemm_universal(). Elements of D outside the sampled rows are left unchanged. Zero (default)
+  /// computes the full reference.
+  void set_reference_sampling(int sample_count, uint64_t seed = 0);
+
+  /// Gets the number of output tile rows sampled by the device reference provider
+  int get_reference_sample_count() const;
+
+  /// Sets device vectors of M per-row (token) and N per-col (channel) scales of the epilogue compute
+  /// type by which gemm_universal() multiplies alpha * A*B, as in INT8 inference with SmoothQuant.
+  /// Only operations fusing both scales are then selected. Null pointers (default) disable scaling.
+  void set_row_col_scales(void const *row_scale, void const *col_scale);
+
   //
   // Computations
   //
@@ -225,6 +428,284 @@ public:
     int64_t batch_stride_D = 0                /// Batch stride of D operand
   );
 
+  /// Executes a tensor contraction D <= alpha * einsum(A, B) + beta * C mapped onto GEMMs by
+  /// plan_contraction(), launching one gemm_universal() per coordinate of the plan's loop modes.
+  /// If no operation implements the plan, its transposed form is launched instead. Plans with
+  /// accumulating loop modes require ScalarPointerMode::kHost.
+  Status contraction(
+    ContractionPlan const &plan,              /// Plan of the contraction
+    void const *alpha,                        /// Pointer to alpha scalar
+    void const *ptr_A,                        /// Pointer to A tensor
+    void const *ptr_B,                        /// Pointer to B tensor
+    void const *beta,                         /// Pointer to beta scalar
+    void const *ptr_C,                        /// Pointer to C tensor
+    void *ptr_D                               /// Pointer to D tensor
+  );
+
+  /// Executes a grouped GEMM computation: D_i <= alpha * A_i*B_i + beta * C_i for i < problem_count
+  //
+  // Problem sizes are given as (M, N, K) in both host and device memory, and operand pointers as
+  // device arrays of per-group pointers. Only CUTLASS 3.x grouped kernels are considered.
+  //
+  Status grouped_gemm(
+
+    int problem_count,                        /// Number of GEMM problems in the group
+    cute::Shape<int, int, int> const *problem_sizes_host, /// Host array of GEMM problem sizes
+    cute::Shape<int, int, int> const *problem_sizes,      /// Device array of GEMM problem sizes
+
+    int cluster_m,                            /// cluster shape M dimension
+    int cluster_n,                            /// cluster shape N dimension
+    int cluster_k,                            /// cluster shape K dimension
+    int cluster_m_fallback,                   /// Fallback cluster shape M dimension
+    int cluster_n_fallback,                   /// Fallback cluster shape N dimension
+    int cluster_k_fallback,                   /// Fallback cluster shape K dimension
+
+    NumericTypeID element_compute,            /// Data type of internal accumulation
+
+    NumericTypeID element_scalar,             /// Data type of alpha/beta scalars
+
+    void const *alpha,                        /// Pointer to alpha scalar
+
+    NumericTypeID element_A,                  /// Data type of A matrix elements
+    LayoutTypeID layout_A,                    /// Layout of A matrix
+    ComplexTransform transform_A,             /// Complex transformation applied to A matrix - ignored for real-valued matrices
+    void const * const * ptr_A,               /// Device array of pointers to A matrices
+    int64_t const *lda,                       /// Host array of leading dimensions of A matrices
+
+    NumericTypeID element_B,                  /// Data type of B matrix elements
+    LayoutTypeID layout_B,                    /// Layout of B matrix
+    ComplexTransform transform_B,             /// Complex transformation applied to B matrix - ignored for real-valued matrices
+    void const * const * ptr_B,               /// Device array of pointers to B matrices
+    int64_t const *ldb,                       /// Host array of leading dimensions of B matrices
+
+    void const * beta,                        /// Pointer to beta scalar
+
+    NumericTypeID element_C,                  /// Data type of C matrix
+    LayoutTypeID layout_C,                    /// Layout of C matrix
+    void const * const * ptr_C,               /// Device array of pointers to C matrices
+
+    NumericTypeID element_D,                  /// Data type of D matrix
+    LayoutTypeID layout_D,                    /// Layout of D matrix
+    void * const * ptr_D,                     /// Device array of pointers to D matrices
+
+    int64_t const *ldc                        /// Host array of leading dimensions of C and D matrices
+  );
+
+  /// Executes a block-scaled GEMM computation: D <= alpha * (SFA * A)*(SFB * B) + beta * C,
+  /// optionally generating scale factors SFD of the output.
+  Status block_scaled_gemm(
+
+    GemmUniversalMode mode,                   /// indicates the mode in which the kUniversal GEMM is launched
+
+    int M,                                    /// GEMM M dimension
+    int N,                                    /// GEMM N dimension
+    int K,                                    /// GEMM K dimension
+
+    int cluster_m,                            /// cluster shape M dimension
+    int cluster_n,                            /// cluster shape N dimension
+    int cluster_k,                            /// cluster shape K dimension
+    int cluster_m_fallback,                   /// Fallback cluster shape M dimension
+    int cluster_n_fallback,                   /// Fallback cluster shape N dimension
+    int cluster_k_fallback,                   /// Fallback cluster shape K dimension
+
+    NumericTypeID element_compute,            /// Data type of internal accumulation
+
+    NumericTypeID element_scalar,             /// Data type of alpha/beta scalars
+
+    void const *alpha,                        /// Pointer to alpha scalar
+
+    NumericTypeID element_A,                  /// Data type of A matrix elements
+    LayoutTypeID layout_A,                    /// Layout of A matrix
+    void const * ptr_A,                       /// Pointer to A matrix in Global Memory
+    int64_t lda,                              /// Leading dimension of A matrix
+    NumericTypeID element_SFA,                /// Data type of A scale factors
+    void const * ptr_SFA,                     /// Pointer to A scale factors
+
+    NumericTypeID element_B,                  /// Data type of B matrix elements
+    LayoutTypeID layout_B,                    /// Layout of B matrix
+    void const * ptr_B,                       /// Pointer to B matrix in Global Memory
+    int64_t ldb,                              /// Leading dimension of B matrix
+    NumericTypeID element_SFB,                /// Data type of B scale factors
+    void const * ptr_SFB,                     /// Pointer to B scale factors
+
+    int sf_vec_size,                          /// Number of K elements sharing one scale factor
+
+    void const * beta,                        /// Pointer to beta scalar
+
+    NumericTypeID element_C,                  /// Data type of C matrix
+    LayoutTypeID layout_C,                    /// Layout of C matrix
+    void const * ptr_C,                       /// Pointer to C matrix
+    int64_t ldc,                              /// Leading dimension of C matrix
+
+    NumericTypeID element_D,                  /// Data type of D matrix
+    LayoutTypeID layout_D,                    /// Layout of D matrix
+    void * ptr_D,                             /// Pointer to D matrix
+    int64_t ldd,                              /// Leading dimension of D matrix
+
+    NumericTypeID element_SFD,                /// Data type of generated D scale factors
+    LayoutTypeID layout_SFD,                  /// Layout of generated D scale factors
+    void * ptr_SFD,                           /// Pointer to generated D scale factors (may be null if none are generated)
+    int epilogue_sf_vec_size,                 /// Number of D elements sharing one generated scale factor
+    void const * norm_constant,               /// Pointer to the normalization constant used to generate SFD
+
+    int batch_count = 1,                      /// Batch count or number of split-K slices
+
+    int64_t batch_stride_A = 0,               /// Batch stride of A operand
+    int64_t batch_stride_B = 0,               /// Batch stride of B operand
+    int64_t batch_stride_C = 0,               /// Batch stride of C operand
+    int64_t batch_stride_D = 0                /// Batch stride of D operand
+  );
+
+  /// Executes a blockwise-scaled GEMM computation: D <= alpha * (SFA * A)*(SFB * B) + beta * C
+  /// with one scale factor per sf_m_vec_size x sf_k_vec_size block of A and per
+  /// sf_n_vec_size x sf_k_vec_size block of B.
+  Status blockwise_gemm(
+
+    GemmUniversalMode mode,                   /// indicates the mode in which the kUniversal GEMM is launched
+
+    int M,                                    /// GEMM M dimension
+    int N,                                    /// GEMM N dimension
+    int K,                                    /// GEMM K dimension
+
+    int cluster_m,                            /// cluster shape M dimension
+    int cluster_n,                            /// cluster shape N dimension
+    int cluster_k,                            /// cluster shape K dimension
+    int cluster_m_fallback,                   /// Fallback cluster shape M dimension
+    int cluster_n_fallback,                   /// Fallback cluster shape N dimension
+    int cluster_k_fallback,                   /// Fallback cluster shape K dimension
+
+    NumericTypeID element_compute,            /// Data type of internal accumulation
+
+    NumericTypeID element_scalar,             /// Data type of alpha/beta scalars
+
+    void const *alpha,                        /// Pointer to alpha scalar
+
+    NumericTypeID element_A,                  /// Data type of A matrix elements
+    LayoutTypeID layout_A,                    /// Layout of A matrix
+    void const * ptr_A,                       /// Pointer to A matrix in Global Memory
+    int64_t lda,                              /// Leading dimension of A matrix
+    NumericTypeID element_SFA,                /// Data type of A scale factors
+    void const * ptr_SFA,                     /// Pointer to A scale factors
+
+    NumericTypeID element_B,                  /// Data type of B matrix elements
+    LayoutTypeID layout_B,                    /// Layout of B matrix
+    void const * ptr_B,                       /// Pointer to B matrix in Global Memory
+    int64_t ldb,                              /// Leading dimension of B matrix
+    NumericTypeID element_SFB,                /// Data type of B scale factors
+    void const * ptr_SFB,                     /// Pointer to B scale factors
+
+    int sf_m_vec_size,                        /// Number of M elements sharing one scale factor of A
+    int sf_n_vec_size,                        /// Number of N elements sharing one scale factor of B
+    int sf_k_vec_size,                        /// Number of K elements sharing one scale factor
+
+    void const * beta,                        /// Pointer to beta scalar
+
+    NumericTypeID element_C,                  /// Data type of C matrix
+    LayoutTypeID layout_C,                    /// Layout of C matrix
+    void const * ptr_C,                       /// Pointer to C matrix
+    int64_t ldc,                              /// Leading dimension of C matrix
+
+    NumericTypeID element_D,                  /// Data type of D matrix
+    LayoutTypeID layout_D,                    /// Layout of D matrix
+    void * ptr_D,                             /// Pointer to D matrix
+    int64_t ldd,                              /// Leading dimension of D matrix
+
+    int batch_count = 1,                      /// Batch count or number of split-K slices
+
+    int64_t batch_stride_A = 0,               /// Batch stride of A operand
+    int64_t batch_stride_B = 0,               /// Batch stride of B operand
+    int64_t batch_stride_C = 0,               /// Batch stride of C operand
+    int64_t batch_stride_D = 0                /// Batch stride of D operand
+  );
+
+  /// Executes a two dimensional convolution on packed NHWC tensors.
+  //
+  // A, B and C are the implicit GEMM operands of conv_kind (e.g. activations, filters and output
+  // for kFprop), and D has the type and layout of C. Split-K is applied serially.
+  //
+  Status conv2d(
+
+    ConvKind conv_kind,                       /// Convolutional operator (fprop, dgrad, wgrad)
+    conv::Conv2dProblemSize const &problem_size, /// Convolution problem size
+
+    NumericTypeID element_compute,            /// Data type of internal accumulation
+
+    NumericTypeID element_scalar,             /// Data type of alpha/beta scalars
+
+    void const *alpha,                        /// Pointer to alpha scalar
+
+    NumericTypeID element_A,                  /// Data type of A tensor elements
+    LayoutTypeID layout_A,                    /// Layout of A tensor
+    void const * ptr_A,                       /// Pointer to A tensor in Global Memory
+
+    NumericTypeID element_B,                  /// Data type of B tensor elements
+    LayoutTypeID layout_B,                    /// Layout of B tensor
+    void const * ptr_B,                       /// Pointer to B tensor in Global Memory
+
+    void const * beta,                        /// Pointer to beta scalar
+
+    NumericTypeID element_C,                  /// Data type of C and D tensors
+    LayoutTypeID layout_C,                    /// Layout of C and D tensors
+    void const * ptr_C,                       /// Pointer to C tensor
+
+    void * ptr_D                              /// Pointer to D tensor
+  );
+
+  /// Executes a three dimensional convolution on packed NDHWC tensors.
+  //
+  // A, B and C are the implicit GEMM operands of conv_kind (e.g. activations, filters and output
+  // for kFprop), and D has the type and layout of C. Split-K is applied serially.
+  //
+  Status conv3d(
+
+    ConvKind conv_kind,                       /// Convolutional operator (fprop, dgrad, wgrad)
+    conv::Conv3dProblemSize const &problem_size, /// Convolution problem size
+
+    NumericTypeID element_compute,            /// Data type of internal accumulation
+
+    NumericTypeID element_scalar,             /// Data type of alpha/beta scalars
+
+    void const *alpha,                        /// Pointer to alpha scalar
+
+    NumericTypeID element_A,                  /// Data type of A tensor elements
+    LayoutTypeID layout_A,                    /// Layout of A tensor
+    void const * ptr_A,                       /// Pointer to A tensor in Global Memory
+
+    NumericTypeID element_B,                  /// Data type of B tensor elements
+    LayoutTypeID layout_B,                    /// Layout of B tensor
+    void const * ptr_B,                       /// Pointer to B tensor in Global Memory
+
+    void const * beta,                        /// Pointer to beta scalar
+
+    NumericTypeID element_C,                  /// Data type of C and D tensors
+    LayoutTypeID layout_C,                    /// Layout of C and D tensors
+    void const * ptr_C,                       /// Pointer to C tensor
+
+    void * ptr_D                              /// Pointer to D tensor
+  );
+
+  /// Prepacks the CKRS filter of a two dimensional convolution into the KRSC layout read by
+  /// conv2d() as a kTensorNHWC filter. The filter is transformed on the current stream the first
+  /// time it is seen with a given `version` and reused from the filter cache afterwards, so
+  /// applications bump `version` whenever they update the weights in place.
+  Status prepack_conv2d_filter(
+    void const *&packed,                      /// Set to the prepacked KRSC filter
+    void const *filter,                       /// Pointer to CKRS filter in Global Memory
+    uint64_t version,                         /// Version of the filter contents
+    NumericTypeID element,                    /// Data type of filter elements
+    conv::Conv2dProblemSize const &problem_size /// Convolution problem size
+  );
+
+  /// Prepacks the CKTRS filter of a three dimensional convolution into the KTRSC layout read by
+  /// conv3d() as a kTensorNDHWC filter. See prepack_conv2d_filter().
+  Status prepack_conv3d_filter(
+    void const *&packed,                      /// Set to the prepacked KTRSC filter
+    void const *filter,                       /// Pointer to CKTRS filter in Global Memory
+    uint64_t version,                         /// Version of the filter contents
+    NumericTypeID element,                    /// Data type of filter elements
+    conv::Conv3dProblemSize const &problem_size /// Convolution problem size
+  );
+
   /// Planar complex GEMM
   ///
   /// Note, all data types are the real-valued base types used by the planar-complex GEMM kernel.
@@ -350,6 +831,32 @@ public:
 /// Unique pointer storing the handle
 using HandlePtr = std::unique_ptr<Handle>;
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Returns the largest alignment (in units of elements) a GEMM problem satisfies, starting from
+/// a given upper limit. This is the alignment of the autotuning key used by Handle.
+int gemm_problem_alignment(
+  int M,
+  int N,
+  int K,
+  NumericTypeID element_A,
+  void const *ptr_A,
+  int64_t lda,
+  int64_t batch_stride_A,
+  NumericTypeID element_B,
+  void const *ptr_B,
+  int64_t ldb,
+  int64_t batch_stride_B,
+  NumericTypeID element_C,
+  void const * ptr_C,
+  int64_t ldc,
+  int64_t batch_stride_C,
+  void const * ptr_D,
+  int64_t ldd,
+  int64_t batch_stride_D,
+  int max_alignment_in_bytes = 16
+);
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 /// Finds conv2d operation instances with Conv2d::ElementC = Reduction::ElementWorkspace
 Operation const* find_conv_operation_for_parallel_reduction(Operation const *operation);
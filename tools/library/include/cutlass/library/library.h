@@ -128,6 +128,28 @@ public:
     return Status::kSuccess;
   }
 
+  // Patches the kernel node of an instantiated CUDA graph, captured from a prior call to run()
+  // with the same host and device workspaces, such that replaying the graph computes with new
+  // arguments. No workspace initialization is performed; any workspace clears recorded in the
+  // graph are replayed as captured. `kernel_node` is the node of the source graph that was
+  // launched by run(). Returns kErrorNotSupported if the new arguments need a larger device
+  // workspace than the captured run, or lay it out differently (e.g. a different stream-K or
+  // split-K partition).
+  virtual Status update_arguments(
+    void const *arguments,
+    void *host_workspace,
+    void *device_workspace,
+    cudaGraphExec_t graph_exec,
+    cudaGraphNode_t kernel_node) const {
+    return Status::kErrorNotSupported;
+  }
+
+  // Queries the register, shared memory and local memory usage and the occupancy of the kernel on
+  // the current device and records them in description().resources. Called once by Manifest.
+  virtual Status initialize_kernel_resources() {
+    return Status::kErrorNotSupported;
+  }
+
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -330,6 +352,15 @@ struct GemmUniversalArguments {
   int swizzle_size{1};
   int split_k_slices{1};
 
+  // For SM90 FP8 kernels promoting partial accumulations: MMAs between promotions,
+  // 0 to promote only after the mainloop, negative to keep the kernel's default
+  int mma_promotion_interval{-1};
+
+  // For kernels dequantizing with per-row (token) and per-col (channel) scales: vectors of M and N
+  // elements of the epilogue compute type, null to scale by one
+  void const *row_scale{nullptr};
+  void const *col_scale{nullptr};
+
   // For SM90 mixed input dtype kernels
   bool is_sm90_mixed_dtype{false};
   Sm90MixedInputWiderOperand wider_operand{Sm90MixedInputWiderOperand::B};
@@ -344,6 +375,11 @@ struct GemmUniversalArguments {
   int device_index{0};
 
   bool use_pdl{false};
+
+  // For the device reference operation: if positive, only this many randomly chosen rows of
+  // output tiles are computed, and the remaining elements of D are left unchanged
+  int reference_sample_count{0};
+  uint64_t reference_sample_seed{0};
 };
 
 /// Block Scaled GEMM
@@ -609,6 +645,35 @@ struct GroupedGemmBlockwiseArguments : GemmGroupedArguments {
   void* SFB{nullptr};
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// OperationKind: kDistributedGemm
+//
+
+/// GEMM distributed over the devices of a tensor parallel group. Each device owns a shard of
+/// every operand (see DistributedGemmDescription) and configures the operation with its own rank.
+///
+/// initialize() builds the CUDA graph of the calling rank, which synchronizes with its peers
+/// through their workspaces. Every rank must be initialized before any rank calls run(), which
+/// relaunches the graph and takes no arguments.
+struct DistributedGemmConfiguration {
+  gemm::GemmCoord problem_size{};        /// global problem size
+  int batch_count{1};                    /// number of GEMMs in batch (not distributed)
+  int device_idx{0};                     /// rank of the calling device within the group
+
+  void const * const *A{nullptr};        /// packed shard of A owned by each rank
+  void const * const *B{nullptr};        /// packed shard of B owned by each rank
+  void const * const *C{nullptr};        /// packed shard of C owned by each rank
+  void * const *D{nullptr};              /// packed shard of D owned by each rank
+  void * const *workspace{nullptr};      /// device workspace of each rank
+
+  void const *alpha{nullptr};            /// host pointer to alpha scalar
+  void const *beta{nullptr};             /// host pointer to beta scalar
+
+  int copy_sm_count{0};                  /// SMs copying rotating operands instead of copy engines
+  bool use_pdl{false};                   /// Whether to launch the local GEMMs with PDL
+};
+
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 //
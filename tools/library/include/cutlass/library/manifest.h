@@ -40,6 +40,9 @@
 #include <list>
 #include <memory>
 #include <map>
+#include <string>
+#include <utility>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -60,11 +63,41 @@ void initialize_all(Manifest &manifest);
 // init and insert all reduction op in manifest object (manually instantiated in library/reduction)
 void initialize_all_reduction_op(Manifest &manifest);
 
+// init and insert all distributed gemm operations in manifest object (manually instantiated in library/distributed_gemm)
+void initialize_all_distributed_gemm_operations(Manifest &manifest);
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// List of operations
 using OperationVector = std::vector<std::unique_ptr<Operation>>;
 
+/// Prebuilt operation selections, each pairing a serialized GemmAutotuneKey with the name of the
+/// operation to run for it
+using DispatchTable = std::vector<std::pair<std::string, std::string>>;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Describes a separately built shared library of operations which is loaded at runtime when
+/// CUTLASS_LIBRARY_LAZY_LOADING is enabled. Shards are emitted per operation kind, minimum
+/// compute capability and instruction subclass by generator.py.
+struct ManifestShard {
+
+  /// Library name without platform prefix or suffix (e.g. "cutlass_gemm_sm90_...")
+  char const *library_name;
+
+  /// Name of the extern "C" function, void (Manifest &), which appends the shard's operations
+  char const *entry_point;
+
+  /// Minimum compute capability required by all operations in the shard
+  int min_compute_capability;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Name of the extern "C" function, void (Manifest &), which each library listed in
+/// $CUTLASS_LIBRARY_EXTERNAL_OPERATIONS defines to append its operations
+constexpr char const *kExternalOperationsEntryPoint = "cutlass_library_initialize_external";
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// Manifest of CUTLASS Library
@@ -77,6 +110,23 @@ private:
   /// Global list of operations
   OperationVector operations_;
 
+  /// Handles of loaded shard and external libraries. These are never closed, since operations
+  /// and their virtual tables reside in them.
+  std::vector<void *> shard_handles_;
+
+  /// Compute capability of the current device, queried on first use by load_shard()
+  int compute_capability_ = -1;
+
+  /// Operation selections emitted by generator.py with --dispatch-table-file
+  DispatchTable dispatch_table_;
+
+  /// Opens the library at path and calls its entry point on this manifest
+  Status load_library(std::string const &path, char const *entry_point);
+
+  /// Records the kernel resources of operations appended at or after index first, unless disabled
+  /// by setting $CUTLASS_LIBRARY_SKIP_KERNEL_RESOURCES
+  void initialize_kernel_resources(size_t first);
+
 public:
   Manifest (Provider provider = library::Provider::kCUTLASS) : provider_(provider) { }
 
@@ -96,6 +146,24 @@ public:
     operations_.emplace_back(operation_ptr);
   }
 
+  /// Appends a prebuilt operation selection
+  void append_dispatch_entry(char const *key, char const *operation_name) {
+    // This function is inline s.t. it is present in generated libraries
+    // without having to compile or link in manifest.cpp
+    dispatch_table_.emplace_back(key, operation_name);
+  }
+
+  /// Prebuilt operation selections, consulted by library::Handle before its autotuning cache
+  DispatchTable const &dispatch_table() const;
+
+  /// Loads a shard library and appends its operations if they may run on the current device.
+  /// Returns kSuccess if the shard was loaded or skipped as incompatible.
+  Status load_shard(ManifestShard const &shard);
+
+  /// Loads each library in $CUTLASS_LIBRARY_EXTERNAL_OPERATIONS, a list of paths separated by ':'
+  /// (';' on Windows), and calls its kExternalOperationsEntryPoint. Called by initialize().
+  Status load_external_operations();
+
   /// Returns an iterator to the first operation
   OperationVector const &operations() const;
 
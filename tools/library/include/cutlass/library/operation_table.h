@@ -244,6 +244,48 @@ using GemmOperationFunctionalMap = std::unordered_map<
 >;
 
 
+/// Precomputed selection results for one GemmFunctionalKey.
+//
+// The set of operations find_gemm_operation() may return only changes at the compute capability
+// and alignment thresholds of the operations themselves. Candidate lists are precomputed for each
+// pair of thresholds such that a lookup reduces to two short binary searches.
+//
+struct GemmOperationIndexEntry {
+
+  /// Sorted compute capability thresholds
+  std::vector<int> compute_capabilities;
+
+  /// Sorted alignment thresholds (in units of elements)
+  std::vector<int> alignments;
+
+  /// Candidates in descending order of preference, indexed by
+  /// (compute capability threshold * alignments.size() + alignment threshold)
+  std::vector<std::vector<Operation const *>> candidates;
+
+  /// Returns the candidates for a device and problem alignment or nullptr if there are none
+  std::vector<Operation const *> const *find(int compute_capability, int alignment) const {
+
+    auto cc_it = std::upper_bound(compute_capabilities.begin(), compute_capabilities.end(), compute_capability);
+    auto align_it = std::upper_bound(alignments.begin(), alignments.end(), alignment);
+
+    if (cc_it == compute_capabilities.begin() || align_it == alignments.begin()) {
+      return nullptr;
+    }
+
+    size_t idx = size_t(cc_it - compute_capabilities.begin() - 1) * alignments.size() +
+      size_t(align_it - alignments.begin() - 1);
+
+    return candidates[idx].empty() ? nullptr : &candidates[idx];
+  }
+};
+
+/// Maps a GemmFunctionalKey onto precomputed selection results
+using GemmOperationIndex = std::unordered_map<
+  GemmFunctionalKey,
+  GemmOperationIndexEntry,
+  GemmFunctionalKeyHasher
+>;
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -427,6 +469,13 @@ using BlockScaledGemmOperationFunctionalMap = std::unordered_map<
   BlockScaledGemmFunctionalKeyHasher
 >;
 
+/// Maps a BlockScaledGemmFunctionalKey onto precomputed selection results
+using BlockScaledGemmOperationIndex = std::unordered_map<
+  BlockScaledGemmFunctionalKey,
+  GemmOperationIndexEntry,
+  BlockScaledGemmFunctionalKeyHasher
+>;
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -603,6 +652,13 @@ using BlockwiseGemmOperationFunctionalMap = std::unordered_map<
   BlockwiseGemmFunctionalKeyHasher
 >;
 
+/// Maps a BlockwiseGemmFunctionalKey onto precomputed selection results
+using BlockwiseGemmOperationIndex = std::unordered_map<
+  BlockwiseGemmFunctionalKey,
+  GemmOperationIndexEntry,
+  BlockwiseGemmFunctionalKeyHasher
+>;
+
 
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -889,10 +945,52 @@ public:
   // provider (kCUTLASS)
   ReductionOperationFunctionalMap reduction_operations;
 
+  /// Precomputed selection index over gemm_operations, rebuilt by append()
+  GemmOperationIndex gemm_operation_index;
+
+  /// Precomputed selection index over block_scaled_gemm_operations, rebuilt by append()
+  BlockScaledGemmOperationIndex block_scaled_gemm_operation_index;
+
+  /// Precomputed selection index over blockwise_gemm_operations, rebuilt by append()
+  BlockwiseGemmOperationIndex blockwise_gemm_operation_index;
+
 public:
 
   void append(Manifest const &manifest);
 
+  /// Returns GEMM operations usable on a device with the given compute capability for a problem
+  /// with the given alignment, in descending order of preference. Returns nullptr if none exist.
+  std::vector<Operation const *> const *find_gemm_operations(
+    GemmFunctionalKey const &key,
+    int compute_capability,
+    int alignment) const;
+
+  /// Returns block-scaled GEMM operations usable for the given compute capability and alignment,
+  /// in descending order of preference. Returns nullptr if none exist.
+  std::vector<Operation const *> const *find_block_scaled_gemm_operations(
+    BlockScaledGemmFunctionalKey const &key,
+    int compute_capability,
+    int alignment) const;
+
+  /// Returns blockwise-scaled GEMM operations usable for the given compute capability and
+  /// alignment, in descending order of preference. Returns nullptr if none exist.
+  std::vector<Operation const *> const *find_blockwise_gemm_operations(
+    BlockwiseGemmFunctionalKey const &key,
+    int compute_capability,
+    int alignment) const;
+
+  /// Returns conv operations of the given kind (kConv2d or kConv3d) usable on a device with the
+  /// given compute capability, in descending order of compute capability.
+  std::vector<Operation const *> find_conv_operations(
+    OperationKind kind,
+    ConvFunctionalKey const &key,
+    int compute_capability) const;
+
+private:
+
+  /// Recomputes the GEMM selection indices from their operation maps
+  void build_gemm_operation_index();
+
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,117 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Cache of convolution filters transformed once into the layout of the conv operations.
+
+    Inference applications commonly hold filters in the CKTRS layout of their framework, whereas
+    the conv operations of the library read KTRSC filters. Filters are transformed on first use by
+    cutlass::transform::kernel::ConvFilterFormatTransformer and the transformed copy is reused
+    until the application bumps the version of the filter. A cache may be shared by several Handles.
+*/
+
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "cutlass/library/library.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace library {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+class PrepackedFilterCache {
+private:
+
+  /// Transformed copy of one filter
+  struct Entry {
+    void *ptr = nullptr;
+    size_t bytes = 0;
+    uint64_t version = 0;
+    NumericTypeID element = NumericTypeID::kInvalid;
+    std::vector<int> extent;
+  };
+
+  /// Device on which transformed filters are allocated
+  int device_idx_;
+
+  mutable std::mutex mutex_;
+
+  /// Transformed filters keyed by the address of the source filter
+  std::unordered_map<void const *, Entry> entries_;
+
+public:
+
+  /// Constructs an empty cache on the current device
+  PrepackedFilterCache();
+
+  /// Releases all transformed filters. Synchronizes with any work still using them.
+  ~PrepackedFilterCache();
+
+  PrepackedFilterCache(PrepackedFilterCache const &) = delete;
+  PrepackedFilterCache &operator=(PrepackedFilterCache const &) = delete;
+
+  /// Sets `packed` to a KTRSC copy of the CKTRS filter `filter` of the given extent, listed in KTRSC
+  /// order ({K, R, S, C} for 2-D and {K, T, R, S, C} for 3-D convolutions). The filter is
+  /// transformed on `stream` when first seen, or when `version`, `element` or `extent` differ from
+  /// the cached copy; otherwise the cached copy is returned without launching any work. A new
+  /// version overwrites the previous copy in place, so work reading it must precede `stream`.
+  Status get(
+    void const *&packed,
+    void const *filter,
+    uint64_t version,
+    NumericTypeID element,
+    std::vector<int> const &extent,
+    cudaStream_t stream = nullptr);
+
+  /// Releases the transformed copy of a filter, e.g. before its memory is freed and reused
+  void invalidate(void const *filter);
+
+  /// Releases all transformed filters
+  void clear();
+
+  /// Returns the number of cached filters
+  size_t size() const;
+
+  /// Returns the number of bytes of device memory held by cached filters
+  size_t bytes() const;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -42,7 +42,9 @@ namespace library {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
-/// Singleton instance stores a Manifest and Operation table
+/// Singleton instance stores a Manifest and Operation table. Both are built on the first call to
+/// get() and never modified afterwards, so they may be read by any number of threads without
+/// synchronization.
 class Singleton {
 public:
 
@@ -0,0 +1,272 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Sampled telemetry of the operations launched by library::Handle.
+
+    A fixed fraction of the calls to Operation::run() made by the Handles sharing an
+    OperationTelemetry is recorded: the operation launched, the problem it was launched on, the
+    runtime configuration selected with it and its duration, measured with CUDA events around the
+    launch. Events are recycled, and records are completed once their stop event has been reached on
+    the device, during later sampled calls or poll(), so that sampling never synchronizes the stream.
+    Calls that are not sampled cost a single atomic increment.
+
+    Completed records are passed to a user callback, for instance TelemetryHistogram::record(), which
+    aggregates durations per operation and problem in process for periodic export.
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iosfwd>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "cutlass/library/library.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace library {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// One sampled call of Operation::run()
+struct OperationRunRecord {
+
+  /// Handle computation which launched the operation, e.g. "gemm_universal"
+  char const *entry_point = nullptr;
+
+  /// Operation launched
+  Operation const *operation = nullptr;
+
+  /// Name of the operation launched
+  std::string operation_name;
+
+  /// Problem the operation was launched on, e.g. "m=4096,n=4096,k=1024,batch=1"
+  std::string problem_key;
+
+  /// Runtime configuration selected with the operation, e.g. "pdl=1,cluster=2x1x1"
+  std::string config;
+
+  /// Device and stream of the launch
+  int device_idx = -1;
+  cudaStream_t stream = nullptr;
+
+  /// Status returned by Operation::run()
+  Status status = Status::kSuccess;
+
+  /// Duration of the launch in milliseconds, or a negative value if it could not be measured
+  float duration_ms = -1;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Thread-safe sampler of Operation::run() calls. May be shared among Handles on any device.
+class OperationTelemetry {
+public:
+
+  using Callback = std::function<void(OperationRunRecord const &)>;
+
+  /// Events timing a sampled launch
+  struct Timing {
+    cudaEvent_t start = nullptr;
+    cudaEvent_t stop = nullptr;
+    int device_idx = -1;
+  };
+
+private:
+
+  /// Record waiting for its stop event
+  struct Pending {
+    OperationRunRecord record;
+    Timing timing;
+  };
+
+  /// Callback receiving completed records
+  Callback callback_;
+
+  /// One in sampling_period_ calls is sampled; zero disables sampling
+  std::atomic<uint64_t> sampling_period_;
+
+  /// Number of calls seen by sample()
+  std::atomic<uint64_t> call_count_;
+
+  /// Number of samples delivered without a duration because too many records were pending
+  std::atomic<uint64_t> untimed_count_;
+
+  /// Maximum number of records waiting for their stop event
+  size_t max_pending_;
+
+  /// Guards callback_, pending_ and the event pools
+  mutable std::mutex mutex_;
+
+  /// Serializes the invocations of the callback
+  std::mutex delivery_mutex_;
+
+  /// Records in launch order
+  std::deque<Pending> pending_;
+
+  /// Recycled timing events per device
+  std::map<int, std::vector<cudaEvent_t>> event_pools_;
+
+  /// Delivers the records whose stop event has been reached, waiting for them if `wait` is set.
+  /// The callback is invoked with mutex_ released.
+  void deliver(bool wait);
+
+  /// Passes completed records to the callback
+  void invoke(Callback const &callback, std::vector<OperationRunRecord> const &records);
+
+public:
+
+  /// Samples one in `sampling_period` calls (zero disables sampling), keeping at most
+  /// `max_pending` records in flight. Further samples are delivered without a duration.
+  explicit OperationTelemetry(
+    Callback callback = Callback(),
+    uint64_t sampling_period = 1024,
+    size_t max_pending = 256);
+
+  /// Delivers all records still pending, waiting for their launches to complete
+  ~OperationTelemetry();
+
+  OperationTelemetry(OperationTelemetry const &) = delete;
+  OperationTelemetry &operator=(OperationTelemetry const &) = delete;
+
+  /// Sets the callback receiving completed records. Invoked from the threads calling Handle
+  /// computations and poll(), one record at a time per OperationTelemetry.
+  void set_callback(Callback callback);
+
+  /// Sets the sampling period: one in `sampling_period` calls is recorded; zero disables sampling
+  void set_sampling_period(uint64_t sampling_period);
+
+  /// Gets the sampling period
+  uint64_t get_sampling_period() const;
+
+  /// Returns true if a call launching on `stream` is to be recorded. Launches captured into a CUDA
+  /// graph are never recorded.
+  bool sample(cudaStream_t stream);
+
+  /// Records the start event of a sampled launch on the current device. Returns false if the
+  /// launch cannot be timed, in which case the record is delivered without a duration.
+  bool begin(Timing &timing, cudaStream_t stream);
+
+  /// Records the stop event of a sampled launch and queues its record
+  void end(Timing const &timing, OperationRunRecord record);
+
+  /// Delivers the records completed so far, without waiting for pending launches
+  void poll();
+
+  /// Delivers all records, waiting for pending launches to complete
+  void flush();
+
+  /// Number of calls seen, and of samples delivered without a duration because too many records
+  /// were pending, since construction
+  uint64_t call_count() const;
+  uint64_t untimed_count() const;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Thread-safe aggregator of sampled durations per operation, problem and configuration. Durations
+/// are counted in logarithmic buckets, kBucketsPerOctave per power of two starting at 1us.
+class TelemetryHistogram {
+public:
+
+  static int const kBucketsPerOctave = 4;
+  static int const kBucketCount = 28 * kBucketsPerOctave;
+
+  /// Aggregate of one operation, problem and configuration
+  struct Entry {
+    std::string operation_name;
+    std::string problem_key;
+    std::string config;
+
+    /// Number of samples, of which failed to launch or could not be timed
+    uint64_t count = 0;
+    uint64_t failures = 0;
+
+    /// Statistics of the timed samples, in milliseconds
+    double total_ms = 0;
+    float min_ms = 0;
+    float max_ms = 0;
+
+    /// Number of timed samples per duration bucket
+    std::array<uint64_t, kBucketCount> buckets{};
+
+    /// Mean duration in milliseconds
+    double mean_ms() const;
+
+    /// Upper bound of the bucket holding the given quantile in (0, 1], in milliseconds
+    double quantile_ms(double quantile) const;
+  };
+
+private:
+
+  using Key = std::tuple<std::string, std::string, std::string>;
+
+  mutable std::mutex mutex_;
+
+  std::map<Key, Entry> entries_;
+
+public:
+
+  /// Returns the bucket holding a duration in milliseconds
+  static int bucket(float duration_ms);
+
+  /// Returns the upper bound of a bucket in milliseconds
+  static double bucket_upper_bound_ms(int bucket);
+
+  /// Adds a record, e.g. as the callback of an OperationTelemetry
+  void record(OperationRunRecord const &record);
+
+  /// Returns a copy of all entries
+  std::vector<Entry> snapshot() const;
+
+  /// Removes all entries
+  void reset();
+
+  /// Writes one CSV line per entry, with the sample counts, the mean, minimum, maximum and the 50th,
+  /// 90th and 99th percentile durations
+  void write_csv(std::ostream &out) const;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
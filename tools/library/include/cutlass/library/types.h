@@ -154,6 +154,7 @@ enum class OperationKind {
   kSparseGemm,
   kReduction,
   kGroupedGemm,
+  kDistributedGemm,
   kInvalid
 };
 
@@ -253,6 +254,7 @@ enum class IteratorAlgorithmID {
   kOptimized,
   kFixedChannels,
   kFewChannels,
+  kWinograd,
   kInvalid
 };
 
@@ -285,6 +287,17 @@ enum class RasterOrder {
   kAlongN,
   kAlongM,
   kHeuristic,
+  kL2Aware,
+  kInvalid
+};
+
+/// Tiling and communication schedule of a distributed (tensor parallel) GEMM
+enum class DistributedGemmSchedule {
+  kAllGather1DTilingCDRotatingA,
+  kAllGather1DTilingCDRotatingB,
+  kReduceScatter1DTilingARotatingC,
+  kReduceScatter1DTilingBRotatingC,
+  kAllGatherReduceScatter2DTilingCDRotatingAC,
   kInvalid
 };
 
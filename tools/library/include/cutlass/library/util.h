@@ -187,6 +187,13 @@ char const *to_string(RasterOrder type, bool pretty = false);
 template<>
 RasterOrder from_string<RasterOrder>(std::string const &str);
 
+/// Converts a DistributedGemmSchedule enumerant to a string
+char const *to_string(DistributedGemmSchedule type, bool pretty = false);
+
+/// Converts a DistributedGemmSchedule enumerant from a string
+template<>
+DistributedGemmSchedule from_string<DistributedGemmSchedule>(std::string const &str);
+
 /// Converts a bool to a string
 char const *to_string(bool type, bool pretty = false);
 
@@ -214,6 +221,11 @@ bool cast_from_double(std::vector<uint8_t> &bytes, NumericTypeID type, double sr
 
 NumericTypeID dynamic_datatype_to_id(RuntimeDatatype type); 
 
+/// Returns the GEMM description of a GEMM-like operation of kind kGemm, kGroupedGemm,
+/// kDistributedGemm, kBlockScaledGemm or kBlockwiseGemm. Scale factor operands are not described.
+/// The description of a distributed GEMM is that of its local GEMM.
+GemmDescription gemm_operation_description(OperationDescription const &desc);
+
 #define CUDA_CHECK(call)                                                                           \
   do {                                                                                             \
     cudaError_t err = (call);                                                                      \
@@ -0,0 +1,131 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Stream-ordered pool of device workspace allocations.
+
+    Each stream owns at most one workspace block which grows on demand. Blocks are allocated and
+    released with cudaMallocFromPoolAsync() and cudaFreeAsync() on the stream itself, so resizing
+    a workspace never synchronizes the device. A pool may be shared by several Handles and streams.
+    Blocks are spread over independently locked shards by stream, so that Handles on different
+    streams rarely contend.
+
+    A pool never allocates or frees while its stream is being captured into a CUDA graph, since
+    the graph would own the memory. Grow the workspace of a stream before capture by calling
+    acquire() with the largest size the captured work needs.
+*/
+
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+
+#include "cutlass/library/library.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace library {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+class WorkspacePool {
+private:
+
+  /// Workspace block owned by one stream
+  struct Block {
+    void *ptr = nullptr;
+    size_t size = 0;
+  };
+
+  /// Device on which workspaces are allocated
+  int device_idx_;
+
+  /// CUDA memory pool backing all allocations
+  cudaMemPool_t mem_pool_;
+
+  /// Indicates the memory pool was created by, and is destroyed with, this object
+  bool owns_mem_pool_;
+
+  /// Number of independently locked shards
+  static int const kShardCount = 16;
+
+  struct alignas(64) Shard {
+    std::mutex mutex;
+
+    /// Workspace block of each stream
+    std::unordered_map<cudaStream_t, Block> blocks;
+  };
+
+  mutable Shard shards_[kShardCount];
+
+  /// Returns the shard holding the block of a stream
+  Shard &shard(cudaStream_t stream) const;
+
+  /// Returns true if `stream` is being captured into a CUDA graph
+  static bool is_capturing(cudaStream_t stream);
+
+public:
+
+  /// Constructs a workspace pool on the current device. If mem_pool is null, a dedicated memory
+  /// pool is created which retains freed memory for reuse.
+  explicit WorkspacePool(cudaMemPool_t mem_pool = nullptr);
+
+  /// Releases all workspaces. Synchronizes with any work still using them.
+  ~WorkspacePool();
+
+  WorkspacePool(WorkspacePool const &) = delete;
+  WorkspacePool &operator=(WorkspacePool const &) = delete;
+
+  /// Returns a workspace of at least `bytes` bytes, valid for work ordered on `stream` until the
+  /// next call to acquire() or release() with the same stream. Returns nullptr on failure, or if
+  /// the workspace would have to grow while `stream` is being captured.
+  void *acquire(size_t bytes, cudaStream_t stream);
+
+  /// Returns the workspace of a stream to the memory pool, in stream order. Does nothing while
+  /// `stream` is being captured.
+  void release(cudaStream_t stream);
+
+  /// Returns the size of the workspace currently held by a stream
+  size_t workspace_size(cudaStream_t stream) const;
+
+  /// Device on which workspaces are allocated
+  int device() const;
+
+  /// Underlying CUDA memory pool
+  cudaMemPool_t mem_pool() const;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,282 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Concurrent submission of independent library operations.
+*/
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "cutlass/library/batch_launcher.h"
+
+namespace cutlass {
+namespace library {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+BatchLauncher::BatchLauncher(
+  int stream_count,
+  Mode mode,
+  WorkspacePool *workspace_pool):
+  mode_(mode),
+  fork_event_(nullptr),
+  completion_event_(nullptr),
+  workspace_pool_(workspace_pool),
+  graph_exec_(nullptr) {
+
+  if (stream_count < 1) {
+    throw std::invalid_argument("BatchLauncher requires at least one stream");
+  }
+
+  cudaError_t error = cudaGetDevice(&device_idx_);
+  if (error != cudaSuccess) {
+    throw std::runtime_error("cudaGetDevice() failed");
+  }
+
+  for (int i = 0; i < stream_count; ++i) {
+    cudaStream_t stream = nullptr;
+    cudaEvent_t event = nullptr;
+
+    if (cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking) != cudaSuccess) {
+      throw std::runtime_error("cudaStreamCreateWithFlags() failed");
+    }
+    streams_.push_back(stream);
+
+    if (cudaEventCreateWithFlags(&event, cudaEventDisableTiming) != cudaSuccess) {
+      throw std::runtime_error("cudaEventCreateWithFlags() failed");
+    }
+    join_events_.push_back(event);
+  }
+
+  if (cudaEventCreateWithFlags(&fork_event_, cudaEventDisableTiming) != cudaSuccess ||
+      cudaEventCreateWithFlags(&completion_event_, cudaEventDisableTiming) != cudaSuccess) {
+    throw std::runtime_error("cudaEventCreateWithFlags() failed");
+  }
+}
+
+BatchLauncher::~BatchLauncher() {
+
+  int device_before;
+  cudaGetDevice(&device_before);
+  if (device_before != device_idx_) {
+    cudaSetDevice(device_idx_);
+  }
+
+  for (cudaStream_t stream : streams_) {
+    cudaStreamSynchronize(stream);
+  }
+  if (completion_event_) {
+    cudaEventSynchronize(completion_event_);
+  }
+
+  if (graph_exec_) {
+    cudaGraphExecDestroy(graph_exec_);
+  }
+  for (cudaEvent_t event : join_events_) {
+    cudaEventDestroy(event);
+  }
+  if (fork_event_) {
+    cudaEventDestroy(fork_event_);
+  }
+  if (completion_event_) {
+    cudaEventDestroy(completion_event_);
+  }
+  for (cudaStream_t stream : streams_) {
+    cudaStreamDestroy(stream);
+  }
+
+  if (device_before != device_idx_) {
+    cudaSetDevice(device_before);
+  }
+}
+
+Status BatchLauncher::launch_(std::vector<BatchedOperation> const &operations, cudaStream_t stream) {
+
+  int const stream_count = static_cast<int>(std::min(streams_.size(), operations.size()));
+
+  // In graph mode, the first stream is the one being captured and need not wait on itself
+  int const first_forked = (mode_ == Mode::kGraph) ? 1 : 0;
+
+  // Order the work on each stream after prior work on the submitting stream
+  if (cudaEventRecord(fork_event_, stream) != cudaSuccess) {
+    return Status::kErrorInternal;
+  }
+  for (int i = first_forked; i < stream_count; ++i) {
+    if (cudaStreamWaitEvent(streams_[i], fork_event_, 0) != cudaSuccess) {
+      return Status::kErrorInternal;
+    }
+  }
+
+  host_workspaces_.resize(operations.size());
+
+  Status status = Status::kSuccess;
+
+  for (size_t idx = 0; idx < operations.size(); ++idx) {
+
+    BatchedOperation const &batched = operations[idx];
+    cudaStream_t op_stream = streams_[idx % stream_count];
+
+    if (!batched.operation) {
+      status = Status::kErrorInvalidProblem;
+      break;
+    }
+
+    host_workspaces_[idx].resize(batched.operation->get_host_workspace_size(batched.configuration));
+    void *host_workspace = host_workspaces_[idx].data();
+
+    void *device_workspace = batched.device_workspace;
+    uint64_t device_workspace_size =
+      batched.operation->get_device_workspace_size(batched.configuration, batched.arguments);
+
+    if (!device_workspace && device_workspace_size > 0) {
+      // Operations sharing a stream run in order, so they may share the stream's workspace
+      if (mode_ == Mode::kStreams && workspace_pool_) {
+        device_workspace = workspace_pool_->acquire(device_workspace_size, op_stream);
+      }
+      if (!device_workspace) {
+        status = Status::kErrorWorkspaceNull;
+        break;
+      }
+    }
+
+    status = batched.operation->initialize(
+      batched.configuration, host_workspace, device_workspace, op_stream);
+
+    if (status != Status::kSuccess) {
+      break;
+    }
+
+    status = batched.operation->run(
+      batched.arguments, host_workspace, device_workspace, op_stream);
+
+    if (status != Status::kSuccess) {
+      break;
+    }
+  }
+
+  // Join all forked streams back into the submitting stream, also on failure, such that a
+  // capture in progress can be ended.
+  for (int i = first_forked; i < stream_count; ++i) {
+    if (cudaEventRecord(join_events_[i], streams_[i]) != cudaSuccess ||
+        cudaStreamWaitEvent(stream, join_events_[i], 0) != cudaSuccess) {
+      status = Status::kErrorInternal;
+    }
+  }
+
+  return status;
+}
+
+Status BatchLauncher::submit(
+  std::vector<BatchedOperation> const &operations,
+  cudaStream_t stream,
+  cudaEvent_t *completion_event) {
+
+  Status status = Status::kSuccess;
+
+  if (operations.empty()) {
+    // Nothing to launch
+  }
+  else if (mode_ == Mode::kStreams) {
+    status = launch_(operations, stream);
+  }
+  else {
+    cudaStream_t capture_stream = streams_.front();
+
+    // Thread-local capture, such that other threads are not restricted while operations initialize
+    if (cudaStreamBeginCapture(capture_stream, cudaStreamCaptureModeThreadLocal) != cudaSuccess) {
+      return Status::kErrorInternal;
+    }
+
+    status = launch_(operations, capture_stream);
+
+    cudaGraph_t graph = nullptr;
+    cudaError_t error = cudaStreamEndCapture(capture_stream, &graph);
+
+    if (status == Status::kSuccess && error != cudaSuccess) {
+      status = Status::kErrorInternal;
+    }
+
+    if (status == Status::kSuccess && graph_exec_) {
+      // Batches of the same structure only update the parameters of the instantiated graph
+      cudaGraphExecUpdateResultInfo update_info;
+      if (cudaGraphExecUpdate(graph_exec_, graph, &update_info) != cudaSuccess) {
+        (void)cudaGetLastError(); // to clear the error bit
+        cudaGraphExecDestroy(graph_exec_);
+        graph_exec_ = nullptr;
+      }
+    }
+
+    if (status == Status::kSuccess && !graph_exec_) {
+      if (cudaGraphInstantiate(&graph_exec_, graph, 0) != cudaSuccess) {
+        graph_exec_ = nullptr;
+        status = Status::kErrorInternal;
+      }
+    }
+
+    if (graph) {
+      cudaGraphDestroy(graph);
+    }
+
+    if (status == Status::kSuccess && cudaGraphLaunch(graph_exec_, stream) != cudaSuccess) {
+      status = Status::kErrorInternal;
+    }
+  }
+
+  if (status != Status::kSuccess) {
+    return status;
+  }
+
+  if (cudaEventRecord(completion_event_, stream) != cudaSuccess) {
+    return Status::kErrorInternal;
+  }
+
+  if (completion_event) {
+    *completion_event = completion_event_;
+  }
+
+  return Status::kSuccess;
+}
+
+int BatchLauncher::stream_count() const {
+  return static_cast<int>(streams_.size());
+}
+
+BatchLauncher::Mode BatchLauncher::mode() const {
+  return mode_;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
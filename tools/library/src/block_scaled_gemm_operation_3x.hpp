@@ -290,6 +290,9 @@ template <typename FusionArgs>
         case RasterOrder::kAlongM:
           operator_args.scheduler.raster_order = Enum_t::AlongM;
           break;
+        case RasterOrder::kL2Aware:
+          operator_args.scheduler.raster_order = Enum_t::L2Aware;
+          break;
         default: 
           operator_args.scheduler.raster_order = Enum_t::Heuristic;
       }
@@ -690,7 +693,7 @@ public:
     // * Compress DTensorA and get DTensorAC & DTensorE
     cutlass::KernelHardwareInfo hw_info;
     CUDA_CHECK(cudaGetDevice(&hw_info.device_id));
-    hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+    hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id, stream);
     typename Compressor::Arguments arguments{
         {compressor_utility.M, 0, compressor_utility.K, compressor_utility.L},
         {device_a_raw_ptr,
@@ -302,6 +302,9 @@ protected:
         case RasterOrder::kAlongM:
           operator_args.scheduler.raster_order = Enum_t::AlongM;
           break;
+        case RasterOrder::kL2Aware:
+          operator_args.scheduler.raster_order = Enum_t::L2Aware;
+          break;
         default: 
           operator_args.scheduler.raster_order = Enum_t::Heuristic;
       }
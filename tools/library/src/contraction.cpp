@@ -0,0 +1,418 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Planning of tensor contractions given in einsum notation onto library GEMMs.
+*/
+
+#include <algorithm>
+#include <cctype>
+#include <limits>
+
+#include "cutlass/library/contraction.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace library {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Operands of a contraction, indexing the strides of a mode
+enum Operand { kOperandA, kOperandB, kOperandC, kOperandD, kOperandCount };
+
+/// Subscript of a contraction along with its strides in each operand (zero if absent)
+struct Mode {
+  char subscript;
+  int64_t extent;
+  int64_t stride[kOperandCount];
+};
+
+/// Modes of one class folded into a GEMM extent, innermost first, and the modes left over
+struct FoldedModes {
+  std::vector<Mode> folded;
+  std::vector<Mode> unfolded;
+  int64_t extent = 1;
+
+  /// Stride of the folded extent in `operand`, or zero if no mode is folded
+  int64_t stride(Operand operand) const {
+    return folded.empty() ? 0 : folded.front().stride[operand];
+  }
+
+  std::string subscripts() const {
+    std::string str;
+    for (Mode const &mode : folded) {
+      str.push_back(mode.subscript);
+    }
+    return str;
+  }
+};
+
+LayoutTypeID transpose(LayoutTypeID layout) {
+  if (layout == LayoutTypeID::kColumnMajor) {
+    return LayoutTypeID::kRowMajor;
+  }
+  if (layout == LayoutTypeID::kRowMajor) {
+    return LayoutTypeID::kColumnMajor;
+  }
+  return layout;
+}
+
+/// Splits "<A>,<B>-><D>" into the subscripts of each operand, ignoring whitespace
+bool parse_equation(
+  std::string const &equation,
+  std::string &subscripts_A,
+  std::string &subscripts_B,
+  std::string &subscripts_D) {
+
+  std::string str;
+  for (char c : equation) {
+    if (!std::isspace(static_cast<unsigned char>(c))) {
+      str.push_back(c);
+    }
+  }
+
+  size_t arrow = str.find("->");
+  if (arrow == std::string::npos) {
+    return false;
+  }
+  size_t comma = str.find(',');
+  if (comma == std::string::npos || comma > arrow || str.find(',', comma + 1) != std::string::npos) {
+    return false;
+  }
+
+  subscripts_A = str.substr(0, comma);
+  subscripts_B = str.substr(comma + 1, arrow - comma - 1);
+  subscripts_D = str.substr(arrow + 2);
+
+  for (std::string const *subscripts : {&subscripts_A, &subscripts_B, &subscripts_D}) {
+    for (size_t i = 0; i < subscripts->size(); ++i) {
+      char c = (*subscripts)[i];
+      if (!std::isalpha(static_cast<unsigned char>(c)) || subscripts->find(c, i + 1) != std::string::npos) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/// Folds the modes of one class into a single extent. Candidate orders sort the modes by
+/// ascending stride in each of `operands`; the longest prefix of an order whose strides nest in
+/// every operand is folded. Orders whose innermost mode has a unit stride are preferred, then
+/// larger folded extents.
+FoldedModes fold_modes(std::vector<Mode> const &modes, std::vector<Operand> const &operands) {
+
+  FoldedModes best;
+  best.unfolded = modes;
+  bool best_unit_stride = false;
+
+  if (modes.empty()) {
+    return best;
+  }
+
+  for (Operand key : operands) {
+    std::vector<Mode> order = modes;
+    std::stable_sort(order.begin(), order.end(), [key](Mode const &lhs, Mode const &rhs) {
+      return lhs.stride[key] < rhs.stride[key];
+    });
+
+    if (order.front().extent > std::numeric_limits<int>::max()) {
+      continue;
+    }
+
+    size_t count = 1;
+    int64_t extent = order.front().extent;
+    for (; count < order.size(); ++count) {
+      Mode const &mode = order[count];
+      if (extent * mode.extent > std::numeric_limits<int>::max()) {
+        break;
+      }
+      bool nested = true;
+      for (Operand operand : operands) {
+        nested = nested && (mode.stride[operand] == order.front().stride[operand] * extent);
+      }
+      if (!nested) {
+        break;
+      }
+      extent *= mode.extent;
+    }
+
+    bool unit_stride = false;
+    for (Operand operand : operands) {
+      unit_stride = unit_stride || order.front().stride[operand] == 1;
+    }
+
+    if (best.folded.empty() ||
+        (unit_stride && !best_unit_stride) ||
+        (unit_stride == best_unit_stride && extent > best.extent)) {
+      best.folded.assign(order.begin(), order.begin() + count);
+      best.unfolded.assign(order.begin() + count, order.end());
+      best.extent = extent;
+      best_unit_stride = unit_stride;
+    }
+  }
+
+  return best;
+}
+
+/// Determines the layout and leading dimension of a (rows, columns) matrix operand. If a folded
+/// extent is empty, either layout may be valid and `preferred` is chosen when it is. Returns false
+/// if neither folded extent has a unit stride.
+bool matrix_layout(
+  FoldedModes const &rows,
+  FoldedModes const &columns,
+  Operand operand,
+  LayoutTypeID preferred,
+  LayoutTypeID &layout,
+  int64_t &ld) {
+
+  bool unit_rows = !rows.folded.empty() && rows.stride(operand) == 1;
+  bool unit_columns = !columns.folded.empty() && columns.stride(operand) == 1;
+
+  bool column_major = unit_rows || rows.folded.empty();
+  bool row_major = unit_columns || columns.folded.empty();
+
+  if (!column_major && !row_major) {
+    return false;
+  }
+
+  if (column_major && (preferred == LayoutTypeID::kColumnMajor || !row_major)) {
+    layout = LayoutTypeID::kColumnMajor;
+    ld = unit_columns || columns.folded.empty() ? rows.extent : columns.stride(operand);
+  }
+  else {
+    layout = LayoutTypeID::kRowMajor;
+    ld = unit_rows || rows.folded.empty() ? columns.extent : rows.stride(operand);
+  }
+  return true;
+}
+
+/// Appends the unfolded modes of one class to the loop modes of a plan
+void append_loop_modes(ContractionPlan &plan, FoldedModes const &modes, bool accumulates) {
+  for (Mode const &mode : modes.unfolded) {
+    ContractionLoopMode loop_mode;
+    loop_mode.subscript = mode.subscript;
+    loop_mode.extent = mode.extent;
+    loop_mode.stride_A = mode.stride[kOperandA];
+    loop_mode.stride_B = mode.stride[kOperandB];
+    loop_mode.stride_C = mode.stride[kOperandC];
+    loop_mode.stride_D = mode.stride[kOperandD];
+    loop_mode.accumulates = accumulates;
+    plan.loop_modes.push_back(loop_mode);
+  }
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+int64_t ContractionPlan::launch_count() const {
+  int64_t count = 1;
+  for (ContractionLoopMode const &mode : loop_modes) {
+    count *= mode.extent;
+  }
+  return count;
+}
+
+ContractionPlan ContractionPlan::transposed() const {
+  ContractionPlan plan = *this;
+
+  std::swap(plan.modes_M, plan.modes_N);
+  std::swap(plan.M, plan.N);
+  std::swap(plan.element_A, plan.element_B);
+  std::swap(plan.lda, plan.ldb);
+  std::swap(plan.batch_stride_A, plan.batch_stride_B);
+
+  plan.layout_A = transpose(layout_B);
+  plan.layout_B = transpose(layout_A);
+  plan.layout_C = transpose(layout_C);
+
+  for (ContractionLoopMode &mode : plan.loop_modes) {
+    std::swap(mode.stride_A, mode.stride_B);
+  }
+  return plan;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+Status plan_contraction(ContractionProblem const &problem, ContractionPlan &plan) {
+
+  std::string subscripts[kOperandCount];
+  if (!parse_equation(problem.equation, subscripts[kOperandA], subscripts[kOperandB], subscripts[kOperandD])) {
+    return Status::kErrorInvalidProblem;
+  }
+  subscripts[kOperandC] = subscripts[kOperandD];
+
+  std::vector<int64_t> const *strides[kOperandCount] = {
+    &problem.stride_A,
+    &problem.stride_B,
+    problem.stride_C.empty() ? &problem.stride_D : &problem.stride_C,
+    &problem.stride_D
+  };
+
+  for (int operand = 0; operand < kOperandCount; ++operand) {
+    if (strides[operand]->size() != subscripts[operand].size()) {
+      return Status::kErrorInvalidProblem;
+    }
+  }
+
+  //
+  // Classify the modes. Modes of unit extent do not affect addressing and are dropped.
+  //
+
+  std::vector<Mode> modes_M, modes_N, modes_K, modes_L;
+
+  std::string all_subscripts = subscripts[kOperandA] + subscripts[kOperandB] + subscripts[kOperandD];
+
+  for (size_t i = 0; i < all_subscripts.size(); ++i) {
+    char c = all_subscripts[i];
+    if (all_subscripts.find(c) != i) {
+      continue;
+    }
+
+    auto extent_it = problem.extents.find(c);
+    if (extent_it == problem.extents.end() || extent_it->second <= 0) {
+      return Status::kErrorInvalidProblem;
+    }
+
+    Mode mode{c, extent_it->second, {0, 0, 0, 0}};
+    bool present[kOperandCount];
+    for (int operand = 0; operand < kOperandCount; ++operand) {
+      size_t pos = subscripts[operand].find(c);
+      present[operand] = pos != std::string::npos;
+      if (present[operand]) {
+        mode.stride[operand] = (*strides[operand])[pos];
+      }
+    }
+
+    if (mode.extent == 1) {
+      continue;
+    }
+
+    if (present[kOperandA] && present[kOperandB] && present[kOperandD]) {
+      modes_L.push_back(mode);
+    }
+    else if (present[kOperandA] && present[kOperandD]) {
+      modes_M.push_back(mode);
+    }
+    else if (present[kOperandB] && present[kOperandD]) {
+      modes_N.push_back(mode);
+    }
+    else if (present[kOperandA] && present[kOperandB]) {
+      modes_K.push_back(mode);
+    }
+    else {
+      // Reductions over a single operand and broadcasts of the output require permuted copies
+      return Status::kErrorNotSupported;
+    }
+  }
+
+  //
+  // Fold each class into a GEMM extent
+  //
+
+  FoldedModes folded_M = fold_modes(modes_M, {kOperandA, kOperandD, kOperandC});
+  FoldedModes folded_N = fold_modes(modes_N, {kOperandB, kOperandD, kOperandC});
+  FoldedModes folded_K = fold_modes(modes_K, {kOperandA, kOperandB});
+  FoldedModes folded_L = fold_modes(modes_L, {kOperandA, kOperandB, kOperandD, kOperandC});
+
+  if ((!modes_M.empty() && folded_M.folded.empty()) ||
+      (!modes_N.empty() && folded_N.folded.empty()) ||
+      (!modes_K.empty() && folded_K.folded.empty()) ||
+      (!modes_L.empty() && folded_L.folded.empty())) {
+    // A single mode exceeds the range of a GEMM extent
+    return Status::kErrorNotSupported;
+  }
+
+  ContractionPlan result;
+
+  result.modes_M = folded_M.subscripts();
+  result.modes_N = folded_N.subscripts();
+  result.modes_K = folded_K.subscripts();
+  result.modes_L = folded_L.subscripts();
+
+  result.M = int(folded_M.extent);
+  result.N = int(folded_N.extent);
+  result.K = int(folded_K.extent);
+  result.batch_count = int(folded_L.extent);
+
+  result.element_A = problem.element_A;
+  result.element_B = problem.element_B;
+  result.element_C = problem.element_C;
+  result.element_D = problem.element_D;
+  result.element_compute = problem.element_compute;
+  result.element_scalar = problem.element_scalar;
+
+  //
+  // Layouts
+  //
+
+  // K-major operands are preferred where a folded extent is empty. C and D share one layout.
+  LayoutTypeID layout_D;
+  if (!matrix_layout(folded_M, folded_K, kOperandA, LayoutTypeID::kRowMajor, result.layout_A, result.lda) ||
+      !matrix_layout(folded_K, folded_N, kOperandB, LayoutTypeID::kColumnMajor, result.layout_B, result.ldb) ||
+      !matrix_layout(folded_M, folded_N, kOperandD, LayoutTypeID::kColumnMajor, layout_D, result.ldd) ||
+      !matrix_layout(folded_M, folded_N, kOperandC, layout_D, result.layout_C, result.ldc)) {
+    return Status::kErrorNotSupported;
+  }
+
+  if (result.layout_C != layout_D &&
+      (!matrix_layout(folded_M, folded_N, kOperandD, result.layout_C, layout_D, result.ldd) ||
+       result.layout_C != layout_D)) {
+    return Status::kErrorNotSupported;
+  }
+
+  result.batch_stride_A = folded_L.stride(kOperandA);
+  result.batch_stride_B = folded_L.stride(kOperandB);
+  result.batch_stride_C = folded_L.stride(kOperandC);
+  result.batch_stride_D = folded_L.stride(kOperandD);
+
+  //
+  // Modes left over are iterated on the host, with the accumulating K modes innermost
+  //
+
+  append_loop_modes(result, folded_L, false);
+  append_loop_modes(result, folded_M, false);
+  append_loop_modes(result, folded_N, false);
+  append_loop_modes(result, folded_K, true);
+
+  plan = result;
+  return Status::kSuccess;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
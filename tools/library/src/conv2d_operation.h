@@ -40,8 +40,10 @@
 #include "cutlass/conv/kernel/default_depthwise_fprop.h"
 #include "cutlass/conv/kernel/default_conv2d_dgrad.h"
 #include "cutlass/conv/kernel/default_conv2d_wgrad.h"
+#include "cutlass/conv/kernel/default_conv2d_fprop_winograd.h"
 #include "cutlass/conv/device/implicit_gemm_convolution.h"
 #include "cutlass/conv/device/direct_convolution.h"
+#include "cutlass/conv/device/winograd_convolution.h"
 
 #include "cutlass/library/library.h"
 #include "library_internal.h"
@@ -184,6 +184,16 @@ public:
     return static_cast<OperationDescription const&>(description_);
   }
 
+  Status initialize_kernel_resources() override {
+    using ConvKernel = typename Operator::ConvKernel;
+    return query_kernel_resources(
+      description_.resources,
+      reinterpret_cast<void const*>(device_kernel<ConvKernel>),
+      ConvKernel::MaxThreadsPerBlock,
+      ConvKernel::SharedStorageSize,
+      Operator::ClusterShape::kCount);
+  }
+
 private:
   Status update_operator_arguments_from_configuration_2d_or_3d(
     typename Operator::Arguments& out_args,
@@ -360,7 +370,7 @@ public:
     }
 
     auto* op = reinterpret_cast<Operator*>(host_workspace);
-    return op->run(out_args, device_workspace, stream, nullptr, in_args_ptr->use_pdl);
+    return op->run(out_args, device_workspace, stream, nullptr, 0 /* kernel_index */, in_args_ptr->use_pdl);
   }
 
 private:
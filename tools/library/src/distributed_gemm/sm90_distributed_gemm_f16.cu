@@ -0,0 +1,157 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Distributed GEMM instances for SM90: f16 operands and accumulation, TN layout with a
+          column-major output, on 1D meshes of 2, 4 and 8 GPUs and 2D meshes of 2x2 and 2x4 GPUs.
+*/
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/experimental/distributed/kernel/dist_gemm_kernel_wrapper.hpp"
+
+#include "cutlass/library/library.h"
+#include "cutlass/library/manifest.h"
+
+#include "../distributed_gemm_operation_3x.hpp"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::library {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED) && \
+  (__CUDACC_VER_MAJOR__ > 12 || (__CUDACC_VER_MAJOR__ == 12 && __CUDACC_VER_MINOR__ >= 4))
+
+namespace {
+
+using namespace cute;
+
+using ElementA = cutlass::half_t;
+using LayoutA = cutlass::layout::RowMajor;
+using ElementB = cutlass::half_t;
+using LayoutB = cutlass::layout::ColumnMajor;
+using ElementC = cutlass::half_t;
+using LayoutC = cutlass::layout::ColumnMajor;
+using ElementAccumulator = cutlass::half_t;
+
+using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+    cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+    Shape<_128,_256,_64>, Shape<_1,_2,_1>,
+    cutlass::epilogue::collective::EpilogueTileAuto,
+    ElementAccumulator, ElementAccumulator,
+    ElementC, LayoutC, 8,
+    ElementC, LayoutC, 8,
+    cutlass::epilogue::TmaWarpSpecialized
+  >::CollectiveOp;
+
+using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+    cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+    ElementA, LayoutA, 8,
+    ElementB, LayoutB, 8,
+    ElementAccumulator,
+    Shape<_128,_256,_64>, Shape<_1,_2,_1>,
+    cutlass::gemm::collective::StageCountAutoCarveout<
+      static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))
+    >,
+    cutlass::gemm::KernelTmaWarpSpecializedPingpong
+  >::CollectiveOp;
+
+using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+    Shape<int,int,int,int>,
+    CollectiveMainloop,
+    CollectiveEpilogue
+>;
+
+template <typename DistSchedule>
+void append_operation(Manifest &manifest, char const *name) {
+  using DistGemmKernel = cutlass::distributed::kernel::DistributedGemmKernelWrapper<GemmKernel, DistSchedule>;
+  using DistGemm = cutlass::distributed::device::DistributedGemmUniversalAdapter<DistGemmKernel>;
+  manifest.append(new DistributedGemmOperation3x<DistGemm>(name));
+}
+
+} // namespace
+
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+void initialize_sm90_distributed_gemm_f16_operations(Manifest &manifest) {
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED) && \
+  (__CUDACC_VER_MAJOR__ > 12 || (__CUDACC_VER_MAJOR__ == 12 && __CUDACC_VER_MINOR__ >= 4))
+
+  using namespace cutlass::distributed::schedules;
+
+  append_operation<AllGather1D_TilingCD_RotatingA<_2>>(manifest,
+    "cutlass3x_sm90_tensorop_distributed_gemm_f16_f16_f16_f16_128x256x64_1x2x1_pingpong_tn_ag_rotating_a_tp2");
+  append_operation<AllGather1D_TilingCD_RotatingA<_4>>(manifest,
+    "cutlass3x_sm90_tensorop_distributed_gemm_f16_f16_f16_f16_128x256x64_1x2x1_pingpong_tn_ag_rotating_a_tp4");
+  append_operation<AllGather1D_TilingCD_RotatingA<_8>>(manifest,
+    "cutlass3x_sm90_tensorop_distributed_gemm_f16_f16_f16_f16_128x256x64_1x2x1_pingpong_tn_ag_rotating_a_tp8");
+
+  append_operation<AllGather1D_TilingCD_RotatingB<_2>>(manifest,
+    "cutlass3x_sm90_tensorop_distributed_gemm_f16_f16_f16_f16_128x256x64_1x2x1_pingpong_tn_ag_rotating_b_tp2");
+  append_operation<AllGather1D_TilingCD_RotatingB<_4>>(manifest,
+    "cutlass3x_sm90_tensorop_distributed_gemm_f16_f16_f16_f16_128x256x64_1x2x1_pingpong_tn_ag_rotating_b_tp4");
+  append_operation<AllGather1D_TilingCD_RotatingB<_8>>(manifest,
+    "cutlass3x_sm90_tensorop_distributed_gemm_f16_f16_f16_f16_128x256x64_1x2x1_pingpong_tn_ag_rotating_b_tp8");
+
+  append_operation<ReduceScatter1D_TilingA_RotatingC<_2>>(manifest,
+    "cutlass3x_sm90_tensorop_distributed_gemm_f16_f16_f16_f16_128x256x64_1x2x1_pingpong_tn_rs_tiling_a_tp2");
+  append_operation<ReduceScatter1D_TilingA_RotatingC<_4>>(manifest,
+    "cutlass3x_sm90_tensorop_distributed_gemm_f16_f16_f16_f16_128x256x64_1x2x1_pingpong_tn_rs_tiling_a_tp4");
+  append_operation<ReduceScatter1D_TilingA_RotatingC<_8>>(manifest,
+    "cutlass3x_sm90_tensorop_distributed_gemm_f16_f16_f16_f16_128x256x64_1x2x1_pingpong_tn_rs_tiling_a_tp8");
+
+  append_operation<ReduceScatter1D_TilingB_RotatingC<_2>>(manifest,
+    "cutlass3x_sm90_tensorop_distributed_gemm_f16_f16_f16_f16_128x256x64_1x2x1_pingpong_tn_rs_tiling_b_tp2");
+  append_operation<ReduceScatter1D_TilingB_RotatingC<_4>>(manifest,
+    "cutlass3x_sm90_tensorop_distributed_gemm_f16_f16_f16_f16_128x256x64_1x2x1_pingpong_tn_rs_tiling_b_tp4");
+  append_operation<ReduceScatter1D_TilingB_RotatingC<_8>>(manifest,
+    "cutlass3x_sm90_tensorop_distributed_gemm_f16_f16_f16_f16_128x256x64_1x2x1_pingpong_tn_rs_tiling_b_tp8");
+
+  append_operation<AllGatherReduceScatter2D_TilingCD_RotatingAC<_2, _2>>(manifest,
+    "cutlass3x_sm90_tensorop_distributed_gemm_f16_f16_f16_f16_128x256x64_1x2x1_pingpong_tn_ag_rs_2d_tp2x2");
+  append_operation<AllGatherReduceScatter2D_TilingCD_RotatingAC<_2, _4>>(manifest,
+    "cutlass3x_sm90_tensorop_distributed_gemm_f16_f16_f16_f16_128x256x64_1x2x1_pingpong_tn_ag_rs_2d_tp2x4");
+
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::library
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
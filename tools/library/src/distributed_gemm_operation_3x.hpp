@@ -0,0 +1,312 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Defines distributed GEMM operations in CUTLASS Library.
+
+    A distributed GEMM wraps a DistributedGemmUniversalAdapter, whose tiling and communication
+    schedule and tensor parallel degree are fixed at compile time. Each schedule and TP degree is
+    therefore a separate operation, and selecting among them for a problem is left to the caller
+    (i.e. cutlass_profiler --operation=distributed_gemm).
+*/
+
+#pragma once
+
+#include <new>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/library/library.h"
+#include "library_internal.h"
+#include "gemm_operation_3x.hpp"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "cutlass/experimental/distributed/device/dist_gemm_universal_wrapper.hpp"
+#include "cutlass/experimental/distributed/schedules/dist_gemm_1d_schedules.hpp"
+#include "cutlass/experimental/distributed/schedules/dist_gemm_2d_schedules.hpp"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::library {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename DistSchedule> struct DistributedGemmScheduleMap;
+
+template <typename TP> struct DistributedGemmScheduleMap<distributed::schedules::AllGather1D_TilingCD_RotatingA<TP>> {
+  static DistributedGemmSchedule const kId = DistributedGemmSchedule::kAllGather1DTilingCDRotatingA;
+  static int const kAllGather = TP{};
+  static int const kReduceScatter = 1;
+};
+
+template <typename TP> struct DistributedGemmScheduleMap<distributed::schedules::AllGather1D_TilingCD_RotatingB<TP>> {
+  static DistributedGemmSchedule const kId = DistributedGemmSchedule::kAllGather1DTilingCDRotatingB;
+  static int const kAllGather = TP{};
+  static int const kReduceScatter = 1;
+};
+
+template <typename TP> struct DistributedGemmScheduleMap<distributed::schedules::ReduceScatter1D_TilingA_RotatingC<TP>> {
+  static DistributedGemmSchedule const kId = DistributedGemmSchedule::kReduceScatter1DTilingARotatingC;
+  static int const kAllGather = 1;
+  static int const kReduceScatter = TP{};
+};
+
+template <typename TP> struct DistributedGemmScheduleMap<distributed::schedules::ReduceScatter1D_TilingB_RotatingC<TP>> {
+  static DistributedGemmSchedule const kId = DistributedGemmSchedule::kReduceScatter1DTilingBRotatingC;
+  static int const kAllGather = 1;
+  static int const kReduceScatter = TP{};
+};
+
+template <typename TPAllGather, typename TPReduceScatter>
+struct DistributedGemmScheduleMap<distributed::schedules::AllGatherReduceScatter2D_TilingCD_RotatingAC<TPAllGather, TPReduceScatter>> {
+  static DistributedGemmSchedule const kId = DistributedGemmSchedule::kAllGatherReduceScatter2DTilingCDRotatingAC;
+  static int const kAllGather = TPAllGather{};
+  static int const kReduceScatter = TPReduceScatter{};
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename Operator_>
+class DistributedGemmOperation3x : public GemmOperation3xBase<typename Operator_::DeviceGemm> {
+public:
+
+  using Operator = Operator_;
+  using DeviceGemm = typename Operator::DeviceGemm;
+  using OperatorArguments = typename Operator::Arguments;
+  using DistSchedule = typename Operator::DistSchedule;
+  using ElementA = typename Operator::ElementA;
+  using ElementB = typename Operator::ElementB;
+  using ElementC = typename Operator::ElementC;
+  using ElementD = typename Operator::ElementD;
+  using StrideA = typename Operator::StrideA;
+  using StrideB = typename Operator::StrideB;
+  using StrideC = typename Operator::StrideC;
+  using StrideD = typename Operator::StrideD;
+  using ElementCompute = typename Operator::EpilogueOutputOp::ElementCompute;
+  using ClusterShape = typename Operator::GemmKernel::ClusterShape;
+
+  static int const kTP = Operator::TP_;
+
+private:
+
+  /// Per-rank state kept in the host workspace
+  struct HostState {
+    Operator op;
+    void *workspace_ptrs[kTP];
+    void *exclusive_workspace_ptrs[kTP];
+  };
+
+  DistributedGemmDescription description_;
+
+public:
+
+  /// Constructor
+  DistributedGemmOperation3x(char const *name = "unknown_distributed_gemm"):
+    GemmOperation3xBase<DeviceGemm>(name, GemmKind::kUniversal) {
+
+    description_.kind = OperationKind::kDistributedGemm;
+    description_.name = name;
+    description_.provider = Provider::kCUTLASS;
+
+    description_.gemm = GemmOperation3xBase<DeviceGemm>::description_;
+    description_.tile_description = description_.gemm.tile_description;
+
+    description_.schedule = DistributedGemmScheduleMap<DistSchedule>::kId;
+    description_.tp = kTP;
+    description_.tp_all_gather = DistributedGemmScheduleMap<DistSchedule>::kAllGather;
+    description_.tp_reduce_scatter = DistributedGemmScheduleMap<DistSchedule>::kReduceScatter;
+
+    // Shards of a problem divisible by the processor and iteration tilers of any schedule
+    int const extent = kTP * kTP;
+    auto problem_shape = cute::make_shape(extent, extent, extent, 1);
+    auto shape_A = DistSchedule::get_local_a_shape(problem_shape);
+    auto shape_B = DistSchedule::get_local_b_shape(problem_shape);
+    auto shape_C = DistSchedule::get_local_c_shape(problem_shape);
+
+    description_.shard_A = {extent / int(cute::get<0>(shape_A)), 1, extent / int(cute::get<1>(shape_A))};
+    description_.shard_B = {1, extent / int(cute::get<0>(shape_B)), extent / int(cute::get<1>(shape_B))};
+    description_.shard_C = {extent / int(cute::get<0>(shape_C)), extent / int(cute::get<1>(shape_C)), 1};
+  }
+
+  /// Returns the description of the distributed GEMM operation
+  OperationDescription const & description() const override {
+    return description_;
+  }
+
+protected:
+
+  /// Constructs the arguments of the local GEMMs of a rank
+  static OperatorArguments construct_arguments_(
+    DistributedGemmConfiguration const &configuration, int device_idx) {
+
+    auto problem_shape = cute::make_shape(
+      configuration.problem_size.m(),
+      configuration.problem_size.n(),
+      configuration.problem_size.k(),
+      configuration.batch_count);
+
+    OperatorArguments args{};
+    args.mode = gemm::GemmUniversalMode::kGemm;
+    args.problem_shape = problem_shape;
+
+    args.mainloop.ptr_A = configuration.A ? static_cast<ElementA const *>(configuration.A[device_idx]) : nullptr;
+    args.mainloop.dA = cutlass::make_cute_packed_stride(StrideA{}, DistSchedule::get_local_a_shape(problem_shape));
+    args.mainloop.ptr_B = configuration.B ? static_cast<ElementB const *>(configuration.B[device_idx]) : nullptr;
+    args.mainloop.dB = cutlass::make_cute_packed_stride(StrideB{}, DistSchedule::get_local_b_shape(problem_shape));
+
+    if (configuration.alpha) {
+      args.epilogue.thread.alpha = *static_cast<ElementCompute const *>(configuration.alpha);
+    }
+    if (configuration.beta) {
+      args.epilogue.thread.beta = *static_cast<ElementCompute const *>(configuration.beta);
+    }
+    args.epilogue.ptr_C = configuration.C ? static_cast<ElementC const *>(configuration.C[device_idx]) : nullptr;
+    args.epilogue.dC = cutlass::make_cute_packed_stride(StrideC{}, DistSchedule::get_local_c_shape(problem_shape));
+    args.epilogue.ptr_D = configuration.D ? static_cast<ElementD *>(configuration.D[device_idx]) : nullptr;
+    args.epilogue.dD = cutlass::make_cute_packed_stride(StrideD{}, DistSchedule::get_local_d_shape(problem_shape));
+
+    // Preferred cluster can fail if these aren't set explicitly
+    args.hw_info.cluster_shape = dim3(
+      cute::size<0>(ClusterShape{}), cute::size<1>(ClusterShape{}), cute::size<2>(ClusterShape{}));
+    args.hw_info.cluster_shape_fallback = args.hw_info.cluster_shape;
+
+    return args;
+  }
+
+  /// Bytes of a rank's device workspace preceding its exclusive workspace (barriers and flags)
+  static uint64_t get_shared_workspace_size_(DistributedGemmConfiguration const &configuration) {
+    OperatorArguments args_array[kTP];
+    for (int device_idx = 0; device_idx < kTP; ++device_idx) {
+      args_array[device_idx] = construct_arguments_(configuration, device_idx);
+    }
+    return round_nearest(
+      Operator::get_workspace_size(args_array, configuration.device_idx, configuration.copy_sm_count),
+      MinWorkspaceAlignment);
+  }
+
+public:
+
+  /// Returns success if the operation can proceed
+  Status can_implement(
+    void const *configuration_ptr, void const *arguments_ptr) const override {
+
+    DistributedGemmConfiguration const &configuration =
+      *static_cast<DistributedGemmConfiguration const *>(configuration_ptr);
+
+    if (configuration.device_idx < 0 || configuration.device_idx >= kTP) {
+      return Status::kErrorInvalidProblem;
+    }
+
+    return Operator::can_implement(construct_arguments_(configuration, configuration.device_idx));
+  }
+
+  /// Gets the host-side workspace
+  uint64_t get_host_workspace_size(void const *configuration) const override {
+    return sizeof(HostState);
+  }
+
+  /// Gets the device-side workspace of each rank. Peers access the shared part (rotating operand
+  /// buffers) and the exclusive part (arrival flags and barriers) of each rank's workspace.
+  uint64_t get_device_workspace_size(
+    void const *configuration_ptr, void const *arguments_ptr) const override {
+
+    DistributedGemmConfiguration const &configuration =
+      *static_cast<DistributedGemmConfiguration const *>(configuration_ptr);
+
+    return get_shared_workspace_size_(configuration) + Operator::get_exclusive_workspace_size();
+  }
+
+  /// Builds the CUDA graph of the calling rank
+  Status initialize(
+    void const *configuration_ptr,
+    void *host_workspace,
+    void *device_workspace,
+    cudaStream_t stream = nullptr) const override {
+
+    DistributedGemmConfiguration const &configuration =
+      *static_cast<DistributedGemmConfiguration const *>(configuration_ptr);
+
+    if (!configuration.workspace ||
+        configuration.workspace[configuration.device_idx] != device_workspace) {
+      return Status::kErrorWorkspaceNull;
+    }
+
+    HostState *state = new (host_workspace) HostState;
+
+    OperatorArguments args_array[kTP];
+    uint64_t shared_workspace_size = get_shared_workspace_size_(configuration);
+
+    for (int device_idx = 0; device_idx < kTP; ++device_idx) {
+      args_array[device_idx] = construct_arguments_(configuration, device_idx);
+      state->workspace_ptrs[device_idx] = configuration.workspace[device_idx];
+      state->exclusive_workspace_ptrs[device_idx] =
+        static_cast<uint8_t *>(configuration.workspace[device_idx]) + shared_workspace_size;
+    }
+
+    return state->op.initialize(
+      args_array,
+      state->workspace_ptrs,
+      state->exclusive_workspace_ptrs,
+      configuration.device_idx,
+      stream,
+      configuration.use_pdl,
+      configuration.copy_sm_count);
+  }
+
+  /// Relaunches the CUDA graph of the calling rank
+  Status run(
+    void const *arguments_ptr,
+    void *host_workspace,
+    void *device_workspace = nullptr,
+    cudaStream_t stream = nullptr) const override {
+
+    HostState *state = static_cast<HostState *>(host_workspace);
+    return state->op.run(stream);
+  }
+
+  /// Records the resource usage of the local GEMM kernel on the current device
+  Status initialize_kernel_resources() override {
+    using GemmKernel = typename Operator::GemmKernel;
+    auto const &cluster_shape = description_.tile_description.cluster_shape;
+    Status status = query_kernel_resources(
+      description_.resources,
+      reinterpret_cast<void const *>(device_kernel<GemmKernel>),
+      GemmKernel::MaxThreadsPerBlock,
+      GemmKernel::SharedStorageSize,
+      cluster_shape.m() * cluster_shape.n() * cluster_shape.k());
+    description_.gemm.resources = description_.resources;
+    return status;
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::library
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
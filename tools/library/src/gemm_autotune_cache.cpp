@@ -0,0 +1,403 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Cache of autotuned GEMM operation selections used by library::Handle.
+*/
+
+#include <fstream>
+#include <functional>
+#include <sstream>
+
+#include "cutlass/library/gemm_autotune_cache.h"
+#include "cutlass/library/util.h"
+
+namespace cutlass {
+namespace library {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Writes the fields of a GEMM functional key
+static void write_gemm_key(std::ostream &out, GemmFunctionalKey const &k) {
+  out << to_string(k.provider) << ":"
+    << to_string(k.gemm_kind) << ":"
+    << to_string(k.element_compute) << ":"
+    << to_string(k.element_scalar) << ":"
+    << to_string(k.element_A) << ":"
+    << to_string(k.layout_A) << ":"
+    << to_string(k.transform_A) << ":"
+    << to_string(k.element_B) << ":"
+    << to_string(k.layout_B) << ":"
+    << to_string(k.transform_B) << ":"
+    << to_string(k.element_C) << ":"
+    << to_string(k.layout_C) << ":"
+    << to_string(k.element_D) << ":"
+    << to_string(k.layout_D) << ":";
+}
+
+/// Returns a whitespace-free string uniquely identifying the key
+std::string to_string(GemmAutotuneKey const &key) {
+
+  std::stringstream ss;
+
+  write_gemm_key(ss, key.functional_key);
+  ss << "sm" << key.compute_capability << ":"
+    << "align" << key.alignment << ":"
+    << key.m_bucket << "x" << key.n_bucket << "x" << key.k_bucket;
+
+  return ss.str();
+}
+
+/// Writes the functional key fields shared by block-scaled and blockwise-scaled GEMMs
+template <typename Key>
+static void write_scaled_gemm_key(std::ostream &out, Key const &k) {
+  out << to_string(k.provider) << ":"
+    << to_string(k.kind) << ":"
+    << to_string(k.gemm_kind) << ":"
+    << to_string(k.element_compute) << ":"
+    << to_string(k.element_scalar) << ":"
+    << to_string(k.element_A) << ":"
+    << to_string(k.layout_A) << ":"
+    << to_string(k.element_SFA) << ":"
+    << to_string(k.element_B) << ":"
+    << to_string(k.layout_B) << ":"
+    << to_string(k.element_SFB) << ":"
+    << to_string(k.element_C) << ":"
+    << to_string(k.layout_C) << ":"
+    << to_string(k.element_D) << ":"
+    << to_string(k.layout_D) << ":";
+}
+
+/// Writes the device and bucketed problem extents
+static void write_gemm_problem(std::ostream &out, int compute_capability, int alignment, int M, int N, int K) {
+  out << "sm" << compute_capability << ":"
+    << "align" << alignment << ":"
+    << GemmAutotuneKey::bucket(M) << "x" << GemmAutotuneKey::bucket(N) << "x" << GemmAutotuneKey::bucket(K);
+}
+
+std::string autotune_key(
+  BlockScaledGemmFunctionalKey const &key, int compute_capability, int alignment, int M, int N, int K) {
+
+  std::stringstream ss;
+
+  write_scaled_gemm_key(ss, key);
+  ss << to_string(key.element_SFD) << ":"
+    << to_string(key.layout_SFD) << ":"
+    << "sf" << key.SFVecSize << "x" << key.EpilogueSFVecSize << ":";
+  write_gemm_problem(ss, compute_capability, alignment, M, N, K);
+
+  return ss.str();
+}
+
+std::string autotune_key(
+  BlockwiseGemmFunctionalKey const &key, int compute_capability, int alignment, int M, int N, int K) {
+
+  std::stringstream ss;
+
+  write_scaled_gemm_key(ss, key);
+  ss << "sf" << key.SFMVecSize << "x" << key.SFNVecSize << "x" << key.SFKVecSize << ":";
+  write_gemm_problem(ss, compute_capability, alignment, M, N, K);
+
+  return ss.str();
+}
+
+std::string autotune_key(
+  GemmFunctionalKey const &key, int compute_capability, int tp, int M, int N, int K, int batch_count) {
+
+  std::stringstream ss;
+
+  write_gemm_key(ss, key);
+  ss << "sm" << compute_capability << ":"
+    << "tp" << tp << ":"
+    << M << "x" << N << "x" << K << "x" << batch_count;
+
+  return ss.str();
+}
+
+/// Writes the functional key of a convolution
+static void write_conv_key(std::ostream &out, ConvFunctionalKey const &k, int compute_capability) {
+  out << to_string(k.provider) << ":"
+    << to_string(k.conv_kind) << ":"
+    << to_string(k.element_A) << ":"
+    << to_string(k.layout_A) << ":"
+    << to_string(k.element_B) << ":"
+    << to_string(k.layout_B) << ":"
+    << to_string(k.element_C) << ":"
+    << to_string(k.layout_C) << ":"
+    << to_string(k.element_accumulator) << ":"
+    << to_string(k.element_compute) << ":"
+    << "sm" << compute_capability << ":";
+}
+
+std::string autotune_key(
+  ConvFunctionalKey const &key, int compute_capability, conv::Conv2dProblemSize const &problem_size) {
+
+  conv::Conv2dProblemSize const &p = problem_size;
+
+  std::stringstream ss;
+
+  write_conv_key(ss, key, compute_capability);
+  ss << "n" << p.N << "h" << p.H << "w" << p.W << "c" << p.C << "k" << p.K
+    << "r" << p.R << "s" << p.S << "p" << p.P << "q" << p.Q
+    << "pad" << p.pad_h << "x" << p.pad_w
+    << "stride" << p.stride_h << "x" << p.stride_w
+    << "dilation" << p.dilation_h << "x" << p.dilation_w
+    << (p.mode == conv::Mode::kConvolution ? "conv" : "xcorr")
+    << "splitk" << p.split_k_slices << "g" << p.groups;
+
+  return ss.str();
+}
+
+std::string autotune_key(
+  ConvFunctionalKey const &key, int compute_capability, conv::Conv3dProblemSize const &problem_size) {
+
+  conv::Conv3dProblemSize const &p = problem_size;
+
+  std::stringstream ss;
+
+  write_conv_key(ss, key, compute_capability);
+  ss << "n" << p.N << "d" << p.D << "h" << p.H << "w" << p.W << "c" << p.C << "k" << p.K
+    << "t" << p.T << "r" << p.R << "s" << p.S << "z" << p.Z << "p" << p.P << "q" << p.Q
+    << "pad" << p.pad_d << "x" << p.pad_h << "x" << p.pad_w
+    << "stride" << p.stride_d << "x" << p.stride_h << "x" << p.stride_w
+    << "dilation" << p.dilation_d << "x" << p.dilation_h << "x" << p.dilation_w
+    << (p.mode == conv::Mode::kConvolution ? "conv" : "xcorr")
+    << "splitk" << p.split_k_slices << "g" << p.groups;
+
+  return ss.str();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool GemmAutotuneCache::find(GemmAutotuneKey const &key, std::string &operation_name) const {
+  return find(to_string(key), operation_name);
+}
+
+bool GemmAutotuneCache::find(std::string const &key, std::string &operation_name) const {
+  GemmAutotuneSelection selection;
+  if (!find(key, selection)) {
+    return false;
+  }
+
+  operation_name = selection.operation_name;
+  return true;
+}
+
+GemmAutotuneCache::Shard &GemmAutotuneCache::shard(std::string const &key) {
+  return shards_[std::hash<std::string>{}(key) % kShardCount];
+}
+
+GemmAutotuneCache::Shard const &GemmAutotuneCache::shard(std::string const &key) const {
+  return shards_[std::hash<std::string>{}(key) % kShardCount];
+}
+
+bool GemmAutotuneCache::find(std::string const &key, GemmAutotuneSelection &selection) const {
+  Shard const &s = shard(key);
+  std::shared_lock<std::shared_mutex> lock(s.mutex);
+
+  auto it = s.entries.find(key);
+  if (it == s.entries.end()) {
+    return false;
+  }
+
+  selection = it->second;
+  return true;
+}
+
+void GemmAutotuneCache::insert(GemmAutotuneKey const &key, std::string const &operation_name) {
+  insert(to_string(key), operation_name);
+}
+
+void GemmAutotuneCache::insert(std::string const &key, std::string const &operation_name) {
+  GemmAutotuneSelection selection;
+  selection.operation_name = operation_name;
+  insert(key, selection);
+}
+
+void GemmAutotuneCache::insert(std::string const &key, GemmAutotuneSelection const &selection) {
+  Shard &s = shard(key);
+  std::unique_lock<std::shared_mutex> lock(s.mutex);
+  s.entries[key] = selection;
+}
+
+void GemmAutotuneCache::clear() {
+  for (Shard &s : shards_) {
+    std::unique_lock<std::shared_mutex> lock(s.mutex);
+    s.entries.clear();
+  }
+}
+
+size_t GemmAutotuneCache::size() const {
+  size_t count = 0;
+  for (Shard const &s : shards_) {
+    std::shared_lock<std::shared_mutex> lock(s.mutex);
+    count += s.entries.size();
+  }
+  return count;
+}
+
+/// Parses cluster shapes written as <m>x<n>x<k>:<m>x<n>x<k>
+static bool parse_cluster_shapes(std::string const &str, GemmAutotuneSelection &selection) {
+  int extents[6];
+  char separators[5];
+
+  std::stringstream ss(str);
+  ss >> extents[0] >> separators[0] >> extents[1] >> separators[1] >> extents[2] >> separators[2]
+    >> extents[3] >> separators[3] >> extents[4] >> separators[4] >> extents[5];
+
+  if (ss.fail() || !ss.eof() || std::string(separators, 5) != "xx:xx") {
+    return false;
+  }
+
+  selection.cluster_shape = {extents[0], extents[1], extents[2]};
+  selection.cluster_shape_fallback = {extents[3], extents[4], extents[5]};
+  return true;
+}
+
+/// Parses a tile scheduler argument written as <name>=<value>
+static bool parse_scheduler_argument(std::string const &str, GemmAutotuneSelection &selection) {
+  size_t separator = str.find('=');
+  if (separator == std::string::npos) {
+    return false;
+  }
+
+  std::string name = str.substr(0, separator);
+  std::string value = str.substr(separator + 1);
+
+  if (name == "raster") {
+    selection.raster_order = from_string<RasterOrder>(value);
+    return selection.raster_order != RasterOrder::kInvalid;
+  }
+
+  std::stringstream ss(value);
+  int int_value = 0;
+  if (!(ss >> int_value) || !ss.eof() || int_value <= 0) {
+    return false;
+  }
+
+  if (name == "swizzle") {
+    selection.swizzle_size = int_value;
+    return true;
+  }
+  if (name == "split_k") {
+    selection.split_k_slices = int_value;
+    return true;
+  }
+  return false;
+}
+
+/// Each line of the file holds one entry:
+///   <serialized key> <operation name> [<cluster shapes>] [raster=<order>] [swizzle=<n>] [split_k=<n>]
+Status GemmAutotuneCache::load(std::string const &path) {
+
+  std::ifstream file(path);
+  if (!file.good()) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  // Entries are parsed before any is inserted, so that a malformed file leaves the cache unchanged
+  std::unordered_map<std::string, GemmAutotuneSelection> entries;
+
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+
+    std::stringstream ss(line);
+    std::string key;
+    std::string token;
+    GemmAutotuneSelection selection;
+
+    if (!(ss >> key >> selection.operation_name)) {
+      return Status::kErrorInvalidProblem;
+    }
+
+    while (ss >> token) {
+      bool parsed = token.find('=') == std::string::npos ?
+        parse_cluster_shapes(token, selection) : parse_scheduler_argument(token, selection);
+      if (!parsed) {
+        return Status::kErrorInvalidProblem;
+      }
+    }
+
+    entries[key] = selection;
+  }
+
+  for (auto const &entry : entries) {
+    insert(entry.first, entry.second);
+  }
+
+  return Status::kSuccess;
+}
+
+Status GemmAutotuneCache::save(std::string const &path) const {
+
+  std::ofstream file(path);
+  if (!file.good()) {
+    return Status::kErrorInternal;
+  }
+
+  file << "# CUTLASS Library GEMM autotuning cache\n";
+  for (Shard const &s : shards_) {
+    std::shared_lock<std::shared_mutex> lock(s.mutex);
+
+    for (auto const &entry : s.entries) {
+      GemmAutotuneSelection const &selection = entry.second;
+
+      file << entry.first << " " << selection.operation_name;
+      if (selection.has_cluster_shape()) {
+        gemm::GemmCoord const &c = selection.cluster_shape;
+        gemm::GemmCoord const &f = selection.cluster_shape_fallback;
+        file << " " << c.m() << "x" << c.n() << "x" << c.k() << ":" << f.m() << "x" << f.n() << "x" << f.k();
+      }
+      if (selection.raster_order != RasterOrder::kInvalid) {
+        file << " raster=" << to_string(selection.raster_order);
+      }
+      if (selection.swizzle_size != 0) {
+        file << " swizzle=" << selection.swizzle_size;
+      }
+      if (selection.split_k_slices != 0) {
+        file << " split_k=" << selection.split_k_slices;
+      }
+      file << "\n";
+    }
+  }
+
+  return file.good() ? Status::kSuccess : Status::kErrorInternal;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
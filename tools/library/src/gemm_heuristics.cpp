@@ -0,0 +1,259 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Analytical cost model ranking GEMM operations for a problem shape without autotuning.
+*/
+
+#include <algorithm>
+#include <cmath>
+
+#include "cutlass/library/gemm_heuristics.h"
+#include "cutlass/library/util.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace library {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Bandwidth of L2 relative to DRAM
+double const kL2BandwidthRatio = 4.0;
+
+/// Fraction of L2 assumed to hold operands of one problem across waves
+double const kL2ResidentFraction = 0.5;
+
+/// Typical machine balance of 16b tensor core math against DRAM bandwidth
+double default_machine_balance(int compute_capability) {
+  if (compute_capability >= 90) {
+    return 290.0;
+  }
+  if (compute_capability >= 80) {
+    return 150.0;
+  }
+  return 140.0;
+}
+
+/// Math throughput of an operation relative to 16b tensor core math
+double relative_math_throughput(GemmDescription const &desc) {
+
+  if (desc.tile_description.math_instruction.opcode_class == OpcodeClassID::kSimt) {
+    return 1.0 / 16.0;
+  }
+
+  int bits = std::max(sizeof_bits(desc.A.element), sizeof_bits(desc.B.element));
+
+  if (bits >= 64) {
+    return 1.0 / 16.0;
+  }
+  if (bits >= 32) {
+    return 0.5;
+  }
+  if (bits >= 16) {
+    return 1.0;
+  }
+  if (bits >= 8) {
+    return 2.0;
+  }
+  return 4.0;
+}
+
+int64_t ceil_div(int64_t a, int64_t b) {
+  return (a + b - 1) / b;
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+GemmHeuristicDeviceInfo::GemmHeuristicDeviceInfo(
+  int compute_capability,
+  int sm_count,
+  int64_t l2_cache_bytes,
+  int64_t smem_per_sm_bytes,
+  double machine_balance
+):
+  compute_capability(compute_capability),
+  sm_count(sm_count),
+  l2_cache_bytes(l2_cache_bytes),
+  smem_per_sm_bytes(smem_per_sm_bytes),
+  machine_balance(machine_balance > 0 ? machine_balance : default_machine_balance(compute_capability)) { }
+
+GemmHeuristicDeviceInfo::GemmHeuristicDeviceInfo(cudaDeviceProp const &device):
+  GemmHeuristicDeviceInfo(
+    device.major * 10 + device.minor,
+    device.multiProcessorCount,
+    device.l2CacheSize,
+    device.sharedMemPerMultiprocessor) { }
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+GemmHeuristicEstimate estimate_gemm_cost(
+  GemmDescription const &desc,
+  gemm::GemmCoord problem_size,
+  int batch_count,
+  GemmHeuristicDeviceInfo const &device) {
+
+  TileDescription const &tile = desc.tile_description;
+
+  int64_t tile_m = std::max(tile.threadblock_shape.m(), 1);
+  int64_t tile_n = std::max(tile.threadblock_shape.n(), 1);
+  int64_t tile_k = std::max(tile.threadblock_shape.k(), 1);
+
+  // Dynamic cluster shapes are described with non-positive extents
+  int64_t cluster_m = std::max(tile.cluster_shape.m(), 1);
+  int64_t cluster_n = std::max(tile.cluster_shape.n(), 1);
+
+  int64_t M = std::max(problem_size.m(), 1);
+  int64_t N = std::max(problem_size.n(), 1);
+  int64_t K = std::max(problem_size.k(), 1);
+  int64_t batch = std::max(batch_count, 1);
+
+  double bytes_A = sizeof_bits(desc.A.element) / 8.0;
+  double bytes_B = sizeof_bits(desc.B.element) / 8.0;
+  double bytes_C = sizeof_bits(desc.C.element) / 8.0;
+  double bytes_D = sizeof_bits(desc.D.element) / 8.0;
+
+  //
+  // Wave quantization
+  //
+
+  int64_t tiles_m = ceil_div(ceil_div(M, tile_m), cluster_m) * cluster_m;
+  int64_t tiles_n = ceil_div(ceil_div(N, tile_n), cluster_n) * cluster_n;
+  int64_t tiles = tiles_m * tiles_n * batch;
+
+  // SM90 and later kernels are persistent with one CTA per SM. Earlier kernels may be resident
+  // several at once per SM as their pipelined operand buffers fit in shared memory.
+  int64_t ctas_per_sm = 1;
+  if (tile.minimum_compute_capability < 90) {
+    double smem_per_cta = std::max(tile.threadblock_stages, 1) *
+      (tile_m * tile_k * bytes_A + tile_n * tile_k * bytes_B);
+    ctas_per_sm = std::max<int64_t>(1, int64_t(device.smem_per_sm_bytes / std::max(smem_per_cta, 1.0)));
+    ctas_per_sm = std::min<int64_t>(ctas_per_sm, 4);
+  }
+
+  int64_t cluster_size = cluster_m * cluster_n;
+  int64_t concurrent_ctas = std::max<int64_t>(
+    (device.sm_count / cluster_size) * cluster_size * ctas_per_sm, cluster_size);
+
+  int64_t waves = ceil_div(tiles, concurrent_ctas);
+
+  GemmHeuristicEstimate estimate;
+  estimate.tiles = tiles;
+  estimate.waves = waves;
+  estimate.wave_efficiency = double(tiles) / double(waves * concurrent_ctas);
+
+  //
+  // Math. CTAs sharing an SM share its math throughput.
+  //
+
+  int64_t K_padded = ceil_div(K, tile_k) * tile_k;
+  double tile_flops = 2.0 * tile_m * tile_n * K_padded;
+  double sm_throughput = device.machine_balance * relative_math_throughput(desc) / device.sm_count;
+
+  double math_cost = double(waves) * double(ctas_per_sm) * tile_flops / sm_throughput;
+
+  //
+  // Operand traffic from L2 into shared memory. Operand tiles multicast to a cluster are read once.
+  //
+
+  double tile_operand_bytes = (tile_m * bytes_A / cluster_n + tile_n * bytes_B / cluster_m) * K_padded;
+  estimate.arithmetic_intensity = tile_flops / ((tile_m * bytes_A + tile_n * bytes_B) * K_padded);
+
+  double l2_cost = double(tiles) * tile_operand_bytes / kL2BandwidthRatio;
+
+  //
+  // DRAM traffic. Operands of a problem fitting in L2 are read once. Otherwise each wave reads
+  // the panels of A and B covered by its tiles, assumed to be rasterized as a block of
+  // concurrent tiles that is as square as the grid allows.
+  //
+
+  double compulsory_A = M * K * bytes_A;
+  double compulsory_B = N * K * bytes_B;
+  double operand_bytes = batch * (compulsory_A + compulsory_B);
+
+  if (compulsory_A + compulsory_B > kL2ResidentFraction * double(device.l2_cache_bytes)) {
+
+    int64_t wave_tiles = std::min(concurrent_ctas, tiles_m * tiles_n);
+    int64_t wave_rows = std::min<int64_t>(tiles_m,
+      std::max<int64_t>(1, int64_t(std::lround(std::sqrt(double(wave_tiles))))));
+    int64_t wave_cols = std::min<int64_t>(tiles_n, ceil_div(wave_tiles, wave_rows));
+
+    double waves_per_problem = double(tiles_m * tiles_n) / double(wave_tiles);
+    double wave_bytes = (wave_rows * tile_m * bytes_A + wave_cols * tile_n * bytes_B) * K;
+    double no_reuse_bytes = double(tiles) * (tile_m * bytes_A + tile_n * bytes_B) * K;
+
+    operand_bytes = std::min(std::max(batch * waves_per_problem * wave_bytes, operand_bytes), no_reuse_bytes);
+  }
+
+  estimate.dram_bytes = operand_bytes + double(batch) * M * N * (bytes_C + bytes_D);
+
+  double dram_cost = estimate.dram_bytes;
+
+  estimate.cost = std::max(math_cost, std::max(l2_cost, dram_cost));
+
+  return estimate;
+}
+
+/// Sorts operations in ascending order of estimated cost
+void rank_gemm_operations(
+  std::vector<Operation const *> &operations,
+  gemm::GemmCoord problem_size,
+  int batch_count,
+  GemmHeuristicDeviceInfo const &device) {
+
+  std::vector<std::pair<double, Operation const *>> ranked;
+  ranked.reserve(operations.size());
+
+  for (Operation const *operation : operations) {
+    GemmDescription desc = gemm_operation_description(operation->description());
+    ranked.emplace_back(estimate_gemm_cost(desc, problem_size, batch_count, device).cost, operation);
+  }
+
+  std::stable_sort(ranked.begin(), ranked.end(),
+    [](std::pair<double, Operation const *> const &lhs, std::pair<double, Operation const *> const &rhs) {
+      return lhs.first < rhs.first;
+    });
+
+  for (size_t i = 0; i < ranked.size(); ++i) {
+    operations[i] = ranked[i].second;
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
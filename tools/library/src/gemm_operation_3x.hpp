@@ -47,6 +47,7 @@
 #include "cutlass/util/reference/device/tensor_fill.h"
 #include "cutlass/util/reference/device/tensor_compare.h"
 #include "cute/tensor.hpp"
+#include <cstring>
 #include <unordered_map>
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -145,6 +146,35 @@ public:
   GemmDescription const& get_gemm_description() const {
     return description_;
   }
+
+  /// Records the resource usage of the kernel on the current device
+  Status initialize_kernel_resources() override {
+    using GemmKernel = typename Operator::GemmKernel;
+    auto const &cluster_shape = description_.tile_description.cluster_shape;
+    return query_kernel_resources(
+      description_.resources,
+      reinterpret_cast<void const *>(device_kernel<GemmKernel>),
+      GemmKernel::MaxThreadsPerBlock,
+      GemmKernel::SharedStorageSize,
+      cluster_shape.m() * cluster_shape.n() * cluster_shape.k());
+  }
+
+protected:
+
+  /// Scales a device-wide count of co-resident clusters to the `sm_count` SMs provisioned to the
+  /// caller, such as the partition of a green context. Counts are unchanged if `sm_count` is zero
+  /// or covers the whole device.
+  static int partition_max_active_clusters_(int max_active_clusters, int sm_count) {
+    int device_id = 0;
+    int device_sm_count = 0;
+    if (sm_count <= 0 ||
+        cudaGetDevice(&device_id) != cudaSuccess ||
+        cudaDeviceGetAttribute(&device_sm_count, cudaDevAttrMultiProcessorCount, device_id) != cudaSuccess ||
+        sm_count >= device_sm_count) {
+      return max_active_clusters;
+    }
+    return int((int64_t(max_active_clusters) * sm_count) / device_sm_count);
+  }
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -191,6 +221,31 @@ private:
   // mutable because it needs to be set in initialize (see comment in initialize)
   mutable int max_active_clusters{};
 
+  using KernelParams = typename Operator::GemmKernel::Params;
+
+  /// Tile scheduler params of a kernel, which determine how its device workspace is laid out
+  template <class Params, class = void>
+  struct SchedulerParamsOf {
+    using type = uint8_t;
+    static type get(Params const &) { return 0; }
+  };
+
+  template <class Params>
+  struct SchedulerParamsOf<Params, cute::void_t<decltype(std::declval<Params const &>().scheduler)>> {
+    using type = std::decay_t<decltype(std::declval<Params const &>().scheduler)>;
+    static type get(Params const &params) { return params.scheduler; }
+  };
+
+  using SchedulerParams = typename SchedulerParamsOf<KernelParams>::type;
+
+  /// Host workspace holding the operator and the device workspace layout of the last run, which
+  /// is the layout a graph captured from that run clears and reduces through
+  struct HostWorkspace {
+    Operator op;
+    uint64_t device_workspace_size = 0;
+    SchedulerParams scheduler{};
+  };
+
 protected:
 
   /// Constructs the arguments structure given the configuration and arguments
@@ -238,6 +293,41 @@ protected:
     }
   };
 
+  template<class FusionArgs, class = void>
+  struct UpdateRowColScales {
+    static Status update_(FusionArgs& fusion_args, GemmUniversalArguments const &arguments) {
+      // Scales are not silently dropped by epilogues that do not apply them
+      if (arguments.row_scale || arguments.col_scale) {
+        return Status::kErrorNotSupported;
+      }
+      return Status::kSuccess;
+    }
+  };
+
+  template<class FusionArgs>
+  struct UpdateRowColScales<FusionArgs, cute::void_t<decltype(FusionArgs{}.row_scale_ptr), decltype(FusionArgs{}.col_scale_ptr)>> {
+    static Status update_(FusionArgs& fusion_args, GemmUniversalArguments const &arguments) {
+      using ElementScale = cute::remove_pointer_t<decltype(fusion_args.row_scale_ptr)>;
+      fusion_args.row_scale_ptr = static_cast<ElementScale *>(arguments.row_scale);
+      fusion_args.col_scale_ptr = static_cast<ElementScale *>(arguments.col_scale);
+      return Status::kSuccess;
+    }
+  };
+
+  template<class MainloopArgs, class = void>
+  struct UpdateMmaPromotionInterval {
+    static void update_(MainloopArgs& mainloop_args, GemmUniversalArguments const &arguments) { }
+  };
+
+  template<class MainloopArgs>
+  struct UpdateMmaPromotionInterval<MainloopArgs, cute::void_t<decltype(MainloopArgs{}.mma_promotion_interval)>> {
+    static void update_(MainloopArgs& mainloop_args, GemmUniversalArguments const &arguments) {
+      if (arguments.mma_promotion_interval >= 0) {
+        mainloop_args.mma_promotion_interval = static_cast<uint32_t>(arguments.mma_promotion_interval);
+      }
+    }
+  };
+
   template<template<int, class, class> class Policy, int Stages, class ClusterShape, class KernelSchedule>
   static constexpr bool is_sm90_mixed_dtype_mainloop_(Policy<Stages, ClusterShape, KernelSchedule> policy) {
     return (cute::is_same_v<Policy<Stages, ClusterShape, KernelSchedule>,
@@ -358,6 +448,11 @@ protected:
     if (status != Status::kSuccess) {
       return status;
     }
+    status = UpdateRowColScales<decltype(operator_args.epilogue.thread)>::update_(
+      operator_args.epilogue.thread, *arguments);
+    if (status != Status::kSuccess) {
+      return status;
+    }
 
     // TODO: type erase Arguments structure in 3.0 GEMM
     operator_args.problem_shape = cute::make_shape(
@@ -425,6 +520,8 @@ protected:
         arguments->ldc, arguments->batch_stride_C);
     operator_args.epilogue.dD = operator_args.epilogue.dC;
 
+    UpdateMmaPromotionInterval<decltype(operator_args.mainloop)>::update_(operator_args.mainloop, *arguments);
+
     using MainloopPolicy = typename CollectiveMainloop::DispatchPolicy;
     if constexpr(is_sm90_mixed_dtype_mainloop_(MainloopPolicy{})) {
       const int problem_m = arguments->problem_size.m();
@@ -587,6 +684,10 @@ protected:
 
     /* Query device SM count and max active clusters to pass onto the kernel as an argument, where needed */
     operator_args.hw_info.sm_count = arguments->sm_count;
+    if (arguments->sm_count <= 0 && stream != nullptr) {
+      // Scope the persistent grid to the partition of a green context stream
+      operator_args.hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(0, stream);
+    }
     if constexpr (Operator::ArchTag::kMinComputeCapability == 90) {
       operator_args.hw_info.max_active_clusters = max_active_clusters;
     }
@@ -603,6 +704,9 @@ protected:
         case RasterOrder::kAlongM:
           operator_args.scheduler.raster_order = Enum_t::AlongM;
           break;
+        case RasterOrder::kL2Aware:
+          operator_args.scheduler.raster_order = Enum_t::L2Aware;
+          break;
         default:
           operator_args.scheduler.raster_order = Enum_t::Heuristic;
       }
@@ -647,7 +751,7 @@ public:
 
   /// Gets the host-side workspace
   uint64_t get_host_workspace_size(void const *configuration) const override {
-    return sizeof(Operator);
+    return sizeof(HostWorkspace);
   }
 
   /// Gets the device-side workspace
@@ -684,9 +788,10 @@ public:
       max_active_clusters = cutlass::KernelHardwareInfo::query_device_max_active_clusters(
         cluster_dims,
         threads_per_block,
-        kernel_ptr);
+        kernel_ptr,
+        stream);
     }
-    Operator *op = new (host_workspace) Operator;
+    new (host_workspace) HostWorkspace;
     return Status::kSuccess;
   }
 
@@ -703,12 +808,81 @@ public:
       return status;
     }
 
-    Operator *op = static_cast<Operator *>(host_workspace);
+    HostWorkspace *host = static_cast<HostWorkspace *>(host_workspace);
     // We need to call initialize() since we have to rebuild TMA desc for every new set of args
-    status = op->run(args, device_workspace, stream, nullptr, 
+    status = host->op.run(args, device_workspace, stream, nullptr, 
                      static_cast<GemmUniversalArguments const *>(arguments_ptr)->use_pdl);
+    if (status == Status::kSuccess) {
+      host->device_workspace_size = Operator::get_workspace_size(args);
+      host->scheduler = SchedulerParamsOf<KernelParams>::get(host->op.params());
+    }
     return status;
   }
+
+  /// Patches a captured kernel node with new arguments
+  Status update_arguments(
+      void const *arguments_ptr,
+      void *host_workspace,
+      void *device_workspace,
+      cudaGraphExec_t graph_exec,
+      cudaGraphNode_t kernel_node) const override {
+
+    OperatorArguments args;
+    Status status = update_arguments_(args, static_cast<GemmUniversalArguments const *>(arguments_ptr));
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    if (Operator::can_implement(args) != Status::kSuccess) {
+      return Status::kErrorInvalidProblem;
+    }
+
+    HostWorkspace *host = static_cast<HostWorkspace *>(host_workspace);
+
+    // The graph replays the workspace clears of the captured run, so the new problem must fit in
+    // the captured workspace. A stream-K or split-K scheduler must also partition the problem as
+    // captured, otherwise partial tiles and reduction locks would be addressed differently.
+    uint64_t workspace_size = Operator::get_workspace_size(args);
+    if (workspace_size > host->device_workspace_size) {
+      CUTLASS_TRACE_HOST("update_arguments(): workspace of " << workspace_size
+        << " bytes exceeds the captured " << host->device_workspace_size << " bytes");
+      return Status::kErrorNotSupported;
+    }
+
+    // Rebuilds kernel params, including TMA descriptors, without touching the workspace
+    KernelParams params = Operator::GemmKernel::to_underlying_arguments(args, device_workspace);
+
+    if (workspace_size != 0) {
+      SchedulerParams scheduler = SchedulerParamsOf<KernelParams>::get(params);
+      if (std::memcmp(&scheduler, &host->scheduler, sizeof(SchedulerParams)) != 0) {
+        CUTLASS_TRACE_HOST("update_arguments(): workspace layout differs from the captured one");
+        return Status::kErrorNotSupported;
+      }
+    }
+
+    status = host->op.update(args, device_workspace);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    void *kernel_params[] = {&params};
+
+    cudaKernelNodeParams node_params = {};
+    node_params.func = (void *)device_kernel<typename Operator::GemmKernel>;
+    node_params.gridDim = Operator::get_grid_shape(params);
+    node_params.blockDim = Operator::GemmKernel::get_block_shape();
+    node_params.sharedMemBytes = Operator::GemmKernel::SharedStorageSize;
+    node_params.kernelParams = kernel_params;
+    node_params.extra = nullptr;
+
+    cudaError_t result = cudaGraphExecKernelNodeSetParams(graph_exec, kernel_node, &node_params);
+    if (result != cudaSuccess) {
+      CUTLASS_TRACE_HOST("cudaGraphExecKernelNodeSetParams() returned error: " << cudaGetErrorString(result));
+      return Status::kErrorInternal;
+    }
+
+    return Status::kSuccess;
+  }
 };
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
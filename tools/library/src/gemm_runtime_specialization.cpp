@@ -0,0 +1,800 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Runtime specialization of GEMM operations on fixed problem constants.
+*/
+
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+
+#if defined(CUTLASS_LIBRARY_NVRTC_ENABLED)
+#include <cuda.h>
+#include <nvrtc.h>
+#endif
+
+#include "cutlass/trace.h"
+#include "cutlass/library/gemm_runtime_specialization.h"
+#include "cutlass/library/util.h"
+
+namespace cutlass {
+namespace library {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Name of the kernel entry point in the generated source
+constexpr char const *kKernelName = "cutlass_rtc_gemm_kernel";
+
+/// Name of the __constant__ array holding {MaxThreadsPerBlock, SharedStorageSize} of the kernel
+constexpr char const *kAttributesName = "cutlass_rtc_gemm_attributes";
+
+/// Kernel parameters of a specialized GEMM. Mirrored by the generated source, such that the
+/// layout must not change without updating emit_source().
+struct RuntimeSpecializedGemmParams {
+  void const *A;
+  void const *B;
+  void const *C;
+  void *D;
+
+  /// Device pointers to the scalars, or null if the scalars are passed by value
+  void const *alpha_ptr;
+  void const *beta_ptr;
+
+  /// Scalars of type element_epilogue passed by value
+  alignas(16) uint8_t alpha[16];
+  alignas(16) uint8_t beta[16];
+};
+
+/// Returns the C++ name of a numeric type supported by specialized kernels, or nullptr
+char const *cpp_type_name(NumericTypeID type) {
+  switch (type) {
+    case NumericTypeID::kU8: return "uint8_t";
+    case NumericTypeID::kS8: return "int8_t";
+    case NumericTypeID::kS32: return "int32_t";
+    case NumericTypeID::kFE4M3: return "cutlass::float_e4m3_t";
+    case NumericTypeID::kFE5M2: return "cutlass::float_e5m2_t";
+    case NumericTypeID::kF16: return "cutlass::half_t";
+    case NumericTypeID::kBF16: return "cutlass::bfloat16_t";
+    case NumericTypeID::kTF32: return "cutlass::tfloat32_t";
+    case NumericTypeID::kF32: return "float";
+    default: break;
+  }
+  return nullptr;
+}
+
+bool is_row_or_column_major(LayoutTypeID layout) {
+  return layout == LayoutTypeID::kRowMajor || layout == LayoutTypeID::kColumnMajor;
+}
+
+/// Emits a static cute::Stride over (rows, columns, batch). Values are checked to fit in int.
+std::string emit_stride(bool rows_contiguous, int64_t ld, int64_t batch_stride) {
+  std::stringstream ss;
+  ss << "cute::Stride<";
+  if (rows_contiguous) {
+    ss << "cute::Int<1>, cute::Int<" << ld << ">";
+  }
+  else {
+    ss << "cute::Int<" << ld << ">, cute::Int<1>";
+  }
+  ss << ", cute::Int<" << batch_stride << ">>";
+  return ss.str();
+}
+
+/// Returns false if any element of a (rows, columns, batch) operand lies at an offset which does
+/// not fit in int, as static strides are multiplied with int coordinates in the kernel.
+bool offsets_fit_int(int64_t rows, int64_t columns, int64_t batch, bool rows_contiguous,
+                     int64_t ld, int64_t batch_stride) {
+  if (ld < 0 || ld > INT_MAX || batch_stride < 0 || batch_stride > INT_MAX) {
+    return false;
+  }
+  int64_t row_stride = rows_contiguous ? 1 : ld;
+  int64_t column_stride = rows_contiguous ? ld : 1;
+  int64_t max_offset = (rows - 1) * row_stride + (columns - 1) * column_stride + (batch - 1) * batch_stride;
+  return max_offset <= INT_MAX;
+}
+
+/// Batch stride baked into the kernel. Unbatched problems ignore the batch stride.
+int64_t effective_batch_stride(GemmProblemConstants const &constants, int64_t batch_stride) {
+  return constants.batch_count > 1 ? batch_stride : 0;
+}
+
+/// Checks that operations of the description can be specialized on the constants
+Status check_specializable(GemmDescription const &description, GemmProblemConstants const &constants) {
+
+  TileDescription const &tile = description.tile_description;
+
+  if (description.kind != OperationKind::kGemm ||
+      (description.gemm_kind != GemmKind::kGemm && description.gemm_kind != GemmKind::kUniversal)) {
+    CUTLASS_TRACE_HOST("GemmRuntimeSpecializer: only GEMM and universal GEMM operations are supported");
+    return Status::kErrorNotSupported;
+  }
+
+  if (description.provider != Provider::kCUTLASS ||
+      tile.math_instruction.opcode_class != OpcodeClassID::kTensorOp ||
+      tile.minimum_compute_capability != 90) {
+    CUTLASS_TRACE_HOST("GemmRuntimeSpecializer: only CUTLASS SM90 tensor core operations are supported");
+    return Status::kErrorNotSupported;
+  }
+
+  if (description.transform_A != ComplexTransform::kNone ||
+      description.transform_B != ComplexTransform::kNone ||
+      description.split_k_mode != SplitKMode::kNone) {
+    CUTLASS_TRACE_HOST("GemmRuntimeSpecializer: complex transforms and split-K are not supported");
+    return Status::kErrorNotSupported;
+  }
+
+  if (!cpp_type_name(description.A.element) || !cpp_type_name(description.B.element) ||
+      !cpp_type_name(description.C.element) || !cpp_type_name(description.D.element) ||
+      !cpp_type_name(description.element_epilogue) ||
+      !cpp_type_name(tile.math_instruction.element_accumulator)) {
+    CUTLASS_TRACE_HOST("GemmRuntimeSpecializer: unsupported numeric type");
+    return Status::kErrorNotSupported;
+  }
+
+  if (!is_row_or_column_major(description.A.layout) || !is_row_or_column_major(description.B.layout) ||
+      !is_row_or_column_major(description.C.layout) || !is_row_or_column_major(description.D.layout)) {
+    CUTLASS_TRACE_HOST("GemmRuntimeSpecializer: only row-major and column-major operands are supported");
+    return Status::kErrorNotSupported;
+  }
+
+  if (tile.threadblock_shape.m() <= 0 || tile.threadblock_shape.n() <= 0 || tile.threadblock_shape.k() <= 0) {
+    CUTLASS_TRACE_HOST("GemmRuntimeSpecializer: invalid threadblock shape");
+    return Status::kErrorNotSupported;
+  }
+
+  if (constants.m <= 0 || constants.n <= 0 || constants.k <= 0 || constants.batch_count <= 0) {
+    CUTLASS_TRACE_HOST("GemmRuntimeSpecializer: invalid problem extents");
+    return Status::kErrorInvalidProblem;
+  }
+
+  int64_t L = constants.batch_count;
+  bool column_major_A = description.A.layout == LayoutTypeID::kColumnMajor;
+  bool row_major_B = description.B.layout == LayoutTypeID::kRowMajor;
+  bool column_major_C = description.C.layout == LayoutTypeID::kColumnMajor;
+  bool column_major_D = description.D.layout == LayoutTypeID::kColumnMajor;
+
+  if (!offsets_fit_int(constants.m, constants.k, L, column_major_A, constants.lda,
+                       effective_batch_stride(constants, constants.batch_stride_A)) ||
+      !offsets_fit_int(constants.n, constants.k, L, row_major_B, constants.ldb,
+                       effective_batch_stride(constants, constants.batch_stride_B)) ||
+      !offsets_fit_int(constants.m, constants.n, L, column_major_C, constants.ldc,
+                       effective_batch_stride(constants, constants.batch_stride_C)) ||
+      !offsets_fit_int(constants.m, constants.n, L, column_major_D, constants.ldd,
+                       effective_batch_stride(constants, constants.batch_stride_D))) {
+    CUTLASS_TRACE_HOST("GemmRuntimeSpecializer: operand offsets exceed the range of int");
+    return Status::kErrorInvalidProblem;
+  }
+
+  return Status::kSuccess;
+}
+
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+GemmProblemConstants::GemmProblemConstants(GemmUniversalArguments const &arguments):
+  m(arguments.problem_size.m()),
+  n(arguments.problem_size.n()),
+  k(arguments.problem_size.k()),
+  batch_count(arguments.batch_count),
+  lda(arguments.lda),
+  ldb(arguments.ldb),
+  ldc(arguments.ldc),
+  ldd(arguments.ldd),
+  batch_stride_A(arguments.batch_stride_A),
+  batch_stride_B(arguments.batch_stride_B),
+  batch_stride_C(arguments.batch_stride_C),
+  batch_stride_D(arguments.batch_stride_D) { }
+
+bool GemmProblemConstants::matches(
+  gemm::GemmCoord problem_size,
+  int batch_count_,
+  int64_t lda_,
+  int64_t ldb_,
+  int64_t ldc_,
+  int64_t ldd_) const {
+
+  return problem_size.m() == m && problem_size.n() == n && problem_size.k() == k &&
+    batch_count_ == batch_count &&
+    lda_ == lda && ldb_ == ldb && ldc_ == ldc && ldd_ == ldd;
+}
+
+bool GemmProblemConstants::operator==(GemmProblemConstants const &rhs) const {
+  return matches(gemm::GemmCoord(rhs.m, rhs.n, rhs.k), rhs.batch_count, rhs.lda, rhs.ldb, rhs.ldc, rhs.ldd) &&
+    effective_batch_stride(*this, batch_stride_A) == effective_batch_stride(rhs, rhs.batch_stride_A) &&
+    effective_batch_stride(*this, batch_stride_B) == effective_batch_stride(rhs, rhs.batch_stride_B) &&
+    effective_batch_stride(*this, batch_stride_C) == effective_batch_stride(rhs, rhs.batch_stride_C) &&
+    effective_batch_stride(*this, batch_stride_D) == effective_batch_stride(rhs, rhs.batch_stride_D);
+}
+
+/// Returns a whitespace-free string uniquely identifying the constants
+std::string to_string(GemmProblemConstants const &constants) {
+
+  std::stringstream ss;
+
+  ss << constants.m << "x" << constants.n << "x" << constants.k << "x" << constants.batch_count
+    << "_lda" << constants.lda
+    << "_ldb" << constants.ldb
+    << "_ldc" << constants.ldc
+    << "_ldd" << constants.ldd
+    << "_bs" << effective_batch_stride(constants, constants.batch_stride_A)
+    << "_" << effective_batch_stride(constants, constants.batch_stride_B)
+    << "_" << effective_batch_stride(constants, constants.batch_stride_C)
+    << "_" << effective_batch_stride(constants, constants.batch_stride_D);
+
+  return ss.str();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+Status GemmRuntimeSpecializer::emit_source(
+  std::string &source,
+  GemmDescription const &description,
+  GemmProblemConstants const &constants) {
+
+  Status status = check_specializable(description, constants);
+  if (status != Status::kSuccess) {
+    return status;
+  }
+
+  TileDescription const &tile = description.tile_description;
+
+  std::stringstream ss;
+
+  ss << "// Runtime specialization of " << description.name << " on " << to_string(constants) << "\n"
+    << "#include \"cutlass/cutlass.h\"\n"
+    << "#include \"cute/tensor.hpp\"\n"
+    << "#include \"cutlass/gemm/dispatch_policy.hpp\"\n"
+    << "#include \"cutlass/gemm/collective/collective_builder.hpp\"\n"
+    << "#include \"cutlass/epilogue/collective/collective_builder.hpp\"\n"
+    << "#include \"cutlass/gemm/kernel/gemm_universal.hpp\"\n"
+    << "\n"
+    << "using ElementA = " << cpp_type_name(description.A.element) << ";\n"
+    << "using ElementB = " << cpp_type_name(description.B.element) << ";\n"
+    << "using ElementC = " << cpp_type_name(description.C.element) << ";\n"
+    << "using ElementD = " << cpp_type_name(description.D.element) << ";\n"
+    << "using ElementAccumulator = " << cpp_type_name(tile.math_instruction.element_accumulator) << ";\n"
+    << "using ElementCompute = " << cpp_type_name(description.element_epilogue) << ";\n"
+    << "\n"
+    << "using ProblemShape = cute::Shape<cute::Int<" << constants.m << ">, cute::Int<" << constants.n
+      << ">, cute::Int<" << constants.k << ">, cute::Int<" << constants.batch_count << ">>;\n"
+    << "using StrideA = " << emit_stride(description.A.layout == LayoutTypeID::kColumnMajor,
+      constants.lda, effective_batch_stride(constants, constants.batch_stride_A)) << ";\n"
+    << "using StrideB = " << emit_stride(description.B.layout == LayoutTypeID::kRowMajor,
+      constants.ldb, effective_batch_stride(constants, constants.batch_stride_B)) << ";\n"
+    << "using StrideC = " << emit_stride(description.C.layout == LayoutTypeID::kColumnMajor,
+      constants.ldc, effective_batch_stride(constants, constants.batch_stride_C)) << ";\n"
+    << "using StrideD = " << emit_stride(description.D.layout == LayoutTypeID::kColumnMajor,
+      constants.ldd, effective_batch_stride(constants, constants.batch_stride_D)) << ";\n"
+    << "\n"
+    << "using TileShape = cute::Shape<cute::Int<" << tile.threadblock_shape.m() << ">, cute::Int<"
+      << tile.threadblock_shape.n() << ">, cute::Int<" << tile.threadblock_shape.k() << ">>;\n"
+    << "using ClusterShape = cute::Shape<cute::_1, cute::_1, cute::_1>;\n"
+    << "\n"
+    << "using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<\n"
+    << "    cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,\n"
+    << "    TileShape, ClusterShape, cutlass::epilogue::collective::EpilogueTileAuto,\n"
+    << "    ElementAccumulator, ElementCompute,\n"
+    << "    ElementC, StrideC, " << description.C.alignment << ",\n"
+    << "    ElementD, StrideD, " << description.D.alignment << ",\n"
+    << "    cutlass::epilogue::NoSmemWarpSpecialized\n"
+    << "  >::CollectiveOp;\n"
+    << "\n"
+    << "using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<\n"
+    << "    cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,\n"
+    << "    ElementA, StrideA, " << description.A.alignment << ",\n"
+    << "    ElementB, StrideB, " << description.B.alignment << ",\n"
+    << "    ElementAccumulator, TileShape, ClusterShape,\n"
+    << "    cutlass::gemm::collective::StageCountAutoCarveout<\n"
+    << "      static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,\n"
+    << "    cutlass::gemm::KernelCpAsyncWarpSpecialized\n"
+    << "  >::CollectiveOp;\n"
+    << "\n"
+    << "using GemmKernel = cutlass::gemm::kernel::GemmUniversal<\n"
+    << "    ProblemShape, CollectiveMainloop, CollectiveEpilogue>;\n"
+    << "\n"
+    << "// Mirrors RuntimeSpecializedGemmParams of the host\n"
+    << "struct RuntimeSpecializedGemmParams {\n"
+    << "  void const *A;\n"
+    << "  void const *B;\n"
+    << "  void const *C;\n"
+    << "  void *D;\n"
+    << "  void const *alpha_ptr;\n"
+    << "  void const *beta_ptr;\n"
+    << "  alignas(16) unsigned char alpha[16];\n"
+    << "  alignas(16) unsigned char beta[16];\n"
+    << "};\n"
+    << "\n"
+    << "extern \"C\" __constant__ int " << kAttributesName << "[2] = {\n"
+    << "  int(GemmKernel::MaxThreadsPerBlock), int(GemmKernel::SharedStorageSize)};\n"
+    << "\n"
+    << "extern \"C\" __global__ void\n"
+    << "__launch_bounds__(GemmKernel::MaxThreadsPerBlock, GemmKernel::MinBlocksPerMultiprocessor)\n"
+    << kKernelName << "(RuntimeSpecializedGemmParams const args) {\n"
+    << "  extern __shared__ char smem[];\n"
+    << "\n"
+    << "  using ThreadParams = typename CollectiveEpilogue::ThreadEpilogueOp::Params;\n"
+    << "  ThreadParams thread = args.alpha_ptr ?\n"
+    << "    ThreadParams(static_cast<ElementCompute const *>(args.alpha_ptr),\n"
+    << "                 static_cast<ElementCompute const *>(args.beta_ptr)) :\n"
+    << "    ThreadParams(*reinterpret_cast<ElementCompute const *>(args.alpha),\n"
+    << "                 *reinterpret_cast<ElementCompute const *>(args.beta));\n"
+    << "\n"
+    << "  // Parameters of this mainloop and epilogue are their arguments, so no host-side\n"
+    << "  // to_underlying_arguments() is needed\n"
+    << "  typename GemmKernel::Params params{\n"
+    << "    " << (constants.batch_count > 1 ? "cutlass::gemm::GemmUniversalMode::kBatched" :
+                                              "cutlass::gemm::GemmUniversalMode::kGemm") << ",\n"
+    << "    ProblemShape{},\n"
+    << "    {static_cast<ElementA const *>(args.A), StrideA{},\n"
+    << "     static_cast<ElementB const *>(args.B), StrideB{}},\n"
+    << "    {thread,\n"
+    << "     static_cast<ElementC const *>(args.C), StrideC{},\n"
+    << "     static_cast<ElementD *>(args.D), StrideD{}}\n"
+    << "  };\n"
+    << "\n"
+    << "  GemmKernel op;\n"
+    << "  op(params, smem);\n"
+    << "}\n";
+
+  source = ss.str();
+  return Status::kSuccess;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_LIBRARY_NVRTC_ENABLED)
+
+namespace {
+
+/// Stable 64-bit FNV-1a hash used to name cached cubins
+uint64_t fnv1a(std::string const &str, uint64_t hash = 0xcbf29ce484222325ull) {
+  for (char c : str) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 0x100000001b3ull;
+  }
+  return hash;
+}
+
+bool is_aligned(void const *ptr, int alignment, NumericTypeID element) {
+  int64_t bytes = int64_t(alignment) * sizeof_bits(element) / 8;
+  return bytes <= 1 || (reinterpret_cast<uintptr_t>(ptr) % bytes) == 0;
+}
+
+/// GEMM operation running a kernel JIT-compiled for fixed problem constants
+class GemmRuntimeSpecializedOperation : public Operation {
+private:
+
+  std::string name_;
+
+  GemmDescription description_;
+
+  GemmProblemConstants constants_;
+
+  CUmodule module_;
+
+  CUfunction kernel_;
+
+  dim3 grid_;
+
+  dim3 block_;
+
+  int smem_size_;
+
+public:
+
+  GemmRuntimeSpecializedOperation(
+    GemmDescription const &description,
+    GemmProblemConstants const &constants,
+    CUmodule module,
+    CUfunction kernel,
+    int threads,
+    int smem_size
+  ):
+    name_(std::string(description.name) + "_rtc_" + to_string(constants)),
+    description_(description),
+    constants_(constants),
+    module_(module),
+    kernel_(kernel),
+    block_(threads, 1, 1),
+    smem_size_(smem_size) {
+
+    description_.name = name_.c_str();
+    description_.gemm_kind = GemmKind::kUniversal;
+    description_.tile_description.cluster_shape = gemm::GemmCoord(1, 1, 1);
+    description_.tile_description.minimum_compute_capability = 90;
+    description_.tile_description.maximum_compute_capability = 90;
+
+    gemm::GemmCoord const &tile = description.tile_description.threadblock_shape;
+    grid_ = dim3(
+      (constants.m + tile.m() - 1) / tile.m(),
+      (constants.n + tile.n() - 1) / tile.n(),
+      constants.batch_count);
+  }
+
+  ~GemmRuntimeSpecializedOperation() override {
+    // The context may already be destroyed during process teardown, so errors are ignored
+    cuModuleUnload(module_);
+  }
+
+  OperationDescription const & description() const override {
+    return description_;
+  }
+
+  Status can_implement(
+    void const *configuration_ptr,
+    void const *arguments_ptr) const override {
+
+    GemmUniversalConfiguration const *configuration =
+      static_cast<GemmUniversalConfiguration const *>(configuration_ptr);
+
+    GemmUniversalArguments const *arguments =
+      static_cast<GemmUniversalArguments const *>(arguments_ptr);
+
+    if (configuration) {
+      if (configuration->mode != GemmUniversalMode::kGemm &&
+          configuration->mode != GemmUniversalMode::kBatched) {
+        return Status::kErrorNotSupported;
+      }
+      if (!constants_.matches(configuration->problem_size, configuration->batch_count,
+            configuration->lda, configuration->ldb, configuration->ldc, configuration->ldd)) {
+        return Status::kErrorInvalidProblem;
+      }
+    }
+
+    if (arguments) {
+      if (!(GemmProblemConstants(*arguments) == constants_)) {
+        return Status::kErrorInvalidProblem;
+      }
+      if (!is_aligned(arguments->A, description_.A.alignment, description_.A.element) ||
+          !is_aligned(arguments->B, description_.B.alignment, description_.B.element) ||
+          !is_aligned(arguments->C, description_.C.alignment, description_.C.element) ||
+          !is_aligned(arguments->D, description_.D.alignment, description_.D.element)) {
+        return Status::kErrorMisalignedOperand;
+      }
+      if (arguments->pointer_mode != ScalarPointerMode::kHost &&
+          arguments->pointer_mode != ScalarPointerMode::kDevice) {
+        return Status::kErrorInvalidProblem;
+      }
+    }
+
+    return Status::kSuccess;
+  }
+
+  uint64_t get_host_workspace_size(void const *configuration) const override {
+    return 0;
+  }
+
+  uint64_t get_device_workspace_size(
+    void const *configuration,
+    void const *arguments = nullptr) const override {
+    return 0;
+  }
+
+  Status initialize(
+    void const *configuration,
+    void *host_workspace,
+    void *device_workspace = nullptr,
+    cudaStream_t stream = nullptr) const override {
+    return Status::kSuccess;
+  }
+
+  Status run(
+    void const *arguments_ptr,
+    void *host_workspace,
+    void *device_workspace = nullptr,
+    cudaStream_t stream = nullptr) const override {
+
+    GemmUniversalArguments const *arguments =
+      static_cast<GemmUniversalArguments const *>(arguments_ptr);
+
+    RuntimeSpecializedGemmParams params;
+    std::memset(&params, 0, sizeof(params));
+
+    params.A = arguments->A;
+    params.B = arguments->B;
+    params.C = arguments->C;
+    params.D = arguments->D;
+
+    if (arguments->pointer_mode == ScalarPointerMode::kDevice) {
+      params.alpha_ptr = arguments->alpha;
+      params.beta_ptr = arguments->beta;
+    }
+    else {
+      if (!arguments->alpha || !arguments->beta) {
+        return Status::kErrorInvalidProblem;
+      }
+      size_t scalar_bytes = sizeof_bits(description_.element_epilogue) / 8;
+      std::memcpy(params.alpha, arguments->alpha, scalar_bytes);
+      std::memcpy(params.beta, arguments->beta, scalar_bytes);
+    }
+
+    void *kernel_params[] = {&params};
+
+    CUresult result = cuLaunchKernel(
+      kernel_,
+      grid_.x, grid_.y, grid_.z,
+      block_.x, block_.y, block_.z,
+      smem_size_,
+      reinterpret_cast<CUstream>(stream),
+      kernel_params,
+      nullptr);
+
+    if (result != CUDA_SUCCESS) {
+      CUTLASS_TRACE_HOST("GemmRuntimeSpecializedOperation::run() cuLaunchKernel() failed with " << int(result));
+      return Status::kErrorInternal;
+    }
+
+    return Status::kSuccess;
+  }
+};
+
+/// Compiles source to a cubin for the given architecture
+Status compile_cubin(
+  std::vector<char> &cubin,
+  std::string &log,
+  std::string const &source,
+  std::vector<std::string> const &options) {
+
+  nvrtcProgram program;
+  nvrtcResult result = nvrtcCreateProgram(&program, source.c_str(), "cutlass_rtc_gemm.cu", 0, nullptr, nullptr);
+  if (result != NVRTC_SUCCESS) {
+    log = nvrtcGetErrorString(result);
+    return Status::kErrorInternal;
+  }
+
+  std::vector<char const *> option_ptrs;
+  for (std::string const &option : options) {
+    option_ptrs.push_back(option.c_str());
+  }
+
+  result = nvrtcCompileProgram(program, static_cast<int>(option_ptrs.size()), option_ptrs.data());
+
+  size_t log_size = 0;
+  nvrtcGetProgramLogSize(program, &log_size);
+  log.assign(log_size, '\0');
+  if (log_size) {
+    nvrtcGetProgramLog(program, &log[0]);
+    log.resize(log_size - 1);
+  }
+
+  if (result == NVRTC_SUCCESS) {
+    size_t cubin_size = 0;
+    result = nvrtcGetCUBINSize(program, &cubin_size);
+    if (result == NVRTC_SUCCESS) {
+      cubin.resize(cubin_size);
+      result = nvrtcGetCUBIN(program, cubin.data());
+    }
+  }
+
+  nvrtcDestroyProgram(&program);
+
+  return result == NVRTC_SUCCESS ? Status::kSuccess : Status::kErrorInternal;
+}
+
+bool read_file(std::vector<char> &data, std::string const &path) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file.good()) {
+    return false;
+  }
+  data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  return !data.empty();
+}
+
+void write_file(std::vector<char> const &data, std::string const &path) {
+  // Writes to a temporary first so that concurrent processes never read partial cubins
+  std::string temp_path = path + ".tmp" + std::to_string(reinterpret_cast<uintptr_t>(&data));
+  {
+    std::ofstream file(temp_path, std::ios::binary);
+    file.write(data.data(), data.size());
+    if (!file.good()) {
+      return;
+    }
+  }
+  std::rename(temp_path.c_str(), path.c_str());
+}
+
+} // namespace
+
+#endif // defined(CUTLASS_LIBRARY_NVRTC_ENABLED)
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+GemmRuntimeSpecializer::GemmRuntimeSpecializer(
+  Manifest &manifest,
+  std::vector<std::string> const &include_paths,
+  std::string const &cache_dir
+):
+  manifest_(manifest),
+  include_paths_(include_paths),
+  cache_dir_(cache_dir) {
+
+  if (include_paths_.empty()) {
+#if defined(CUTLASS_LIBRARY_NVRTC_CUTLASS_INCLUDE_DIR)
+    include_paths_.push_back(CUTLASS_LIBRARY_NVRTC_CUTLASS_INCLUDE_DIR);
+#endif
+#if defined(CUTLASS_LIBRARY_NVRTC_BINARY_INCLUDE_DIR)
+    include_paths_.push_back(CUTLASS_LIBRARY_NVRTC_BINARY_INCLUDE_DIR);
+#endif
+#if defined(CUTLASS_LIBRARY_NVRTC_CUDA_INCLUDE_DIR)
+    include_paths_.push_back(CUTLASS_LIBRARY_NVRTC_CUDA_INCLUDE_DIR);
+#endif
+  }
+}
+
+Status GemmRuntimeSpecializer::specialize(
+  Operation const *&operation,
+  GemmDescription const &description,
+  GemmProblemConstants const &constants) {
+
+  operation = nullptr;
+
+  int device_idx = 0;
+  if (cudaGetDevice(&device_idx) != cudaSuccess) {
+    return Status::kErrorInternal;
+  }
+
+  std::string key = std::string(description.name) + ":" + to_string(constants) + ":" +
+    std::to_string(device_idx);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  auto it = operations_.find(key);
+  if (it != operations_.end()) {
+    operation = it->second;
+    return Status::kSuccess;
+  }
+
+#if !defined(CUTLASS_LIBRARY_NVRTC_ENABLED)
+
+  CUTLASS_TRACE_HOST("GemmRuntimeSpecializer: the library was built without CUTLASS_LIBRARY_NVRTC");
+  return Status::kErrorNotSupported;
+
+#else
+
+  int cc_major = 0;
+  int cc_minor = 0;
+  if (cudaDeviceGetAttribute(&cc_major, cudaDevAttrComputeCapabilityMajor, device_idx) != cudaSuccess ||
+      cudaDeviceGetAttribute(&cc_minor, cudaDevAttrComputeCapabilityMinor, device_idx) != cudaSuccess) {
+    return Status::kErrorInternal;
+  }
+
+  // Specialized kernels use architecture-specific SM90 features
+  if (cc_major * 10 + cc_minor != 90) {
+    CUTLASS_TRACE_HOST("GemmRuntimeSpecializer: specialized kernels require an SM90 device");
+    return Status::kErrorArchMismatch;
+  }
+
+  std::string source;
+  Status status = emit_source(source, description, constants);
+  if (status != Status::kSuccess) {
+    return status;
+  }
+
+  std::vector<std::string> options = {
+    "--gpu-architecture=sm_90a",
+    "--std=c++17",
+    "--expt-relaxed-constexpr",
+    "-DNDEBUG"
+  };
+  for (std::string const &path : include_paths_) {
+    options.push_back("--include-path=" + path);
+  }
+
+  std::string cubin_path;
+  if (!cache_dir_.empty()) {
+    uint64_t hash = fnv1a(source);
+    for (std::string const &option : options) {
+      hash = fnv1a(option, fnv1a(std::string(1, '\0'), hash));
+    }
+    std::stringstream ss;
+    ss << cache_dir_ << "/cutlass_rtc_gemm_" << std::hex << std::setw(16) << std::setfill('0') << hash << ".cubin";
+    cubin_path = ss.str();
+  }
+
+  std::vector<char> cubin;
+  if (cubin_path.empty() || !read_file(cubin, cubin_path)) {
+    status = compile_cubin(cubin, compile_log_, source, options);
+    if (status != Status::kSuccess) {
+      CUTLASS_TRACE_HOST("GemmRuntimeSpecializer: compilation failed:\n" << compile_log_);
+      return status;
+    }
+    if (!cubin_path.empty()) {
+      write_file(cubin, cubin_path);
+    }
+  }
+
+  // Modules are loaded into the current context, which the runtime creates on first use
+  cudaFree(nullptr);
+
+  CUmodule module;
+  if (cuModuleLoadData(&module, cubin.data()) != CUDA_SUCCESS) {
+    CUTLASS_TRACE_HOST("GemmRuntimeSpecializer: cuModuleLoadData() failed");
+    return Status::kErrorInternal;
+  }
+
+  CUfunction kernel;
+  CUdeviceptr attributes_ptr;
+  size_t attributes_bytes = 0;
+  int attributes[2] = {0, 0};
+
+  if (cuModuleGetFunction(&kernel, module, kKernelName) != CUDA_SUCCESS ||
+      cuModuleGetGlobal(&attributes_ptr, &attributes_bytes, module, kAttributesName) != CUDA_SUCCESS ||
+      attributes_bytes != sizeof(attributes) ||
+      cuMemcpyDtoH(attributes, attributes_ptr, sizeof(attributes)) != CUDA_SUCCESS) {
+    CUTLASS_TRACE_HOST("GemmRuntimeSpecializer: failed to query the specialized kernel");
+    cuModuleUnload(module);
+    return Status::kErrorInternal;
+  }
+
+  int smem_size = attributes[1];
+  if (smem_size >= (48 << 10) &&
+      cuFuncSetAttribute(kernel, CU_FUNC_ATTRIBUTE_MAX_DYNAMIC_SHARED_SIZE_BYTES, smem_size) != CUDA_SUCCESS) {
+    CUTLASS_TRACE_HOST("GemmRuntimeSpecializer: failed to set the shared memory size");
+    cuModuleUnload(module);
+    return Status::kErrorInternal;
+  }
+
+  GemmRuntimeSpecializedOperation *specialized = new GemmRuntimeSpecializedOperation(
+    description, constants, module, kernel, attributes[0], smem_size);
+
+  manifest_.append(specialized);
+  operations_[key] = specialized;
+  operation = specialized;
+
+  return Status::kSuccess;
+
+#endif
+}
+
+size_t GemmRuntimeSpecializer::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return operations_.size();
+}
+
+std::string GemmRuntimeSpecializer::compile_log() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return compile_log_;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -248,6 +248,9 @@ protected:
         case RasterOrder::kAlongM:
           operator_args.scheduler.raster_order = Enum_t::AlongM;
           break;
+        case RasterOrder::kL2Aware:
+          operator_args.scheduler.raster_order = Enum_t::L2Aware;
+          break;
         default:
           operator_args.scheduler.raster_order = Enum_t::Heuristic;
       }
@@ -445,6 +448,7 @@ public:
       cluster_dims,
       threads_per_block,
       kernel_ptr);
+    args->max_active_clusters = this->partition_max_active_clusters_(args->max_active_clusters, args->sm_count);
 
     if (args->max_active_clusters == 0) {
       std::cerr << "Max Active Clusters could not be queried. " 
@@ -663,7 +667,7 @@ public:
     }
 
     Operator* op = static_cast<Operator*>(host_workspace);
-    status = op->run(operator_args, device_workspace, stream, nullptr);
+    status = op->run(operator_args, device_workspace, stream, nullptr, args.use_pdl);
     return status;
   }
 };
@@ -864,7 +868,7 @@ public:
     }
 
     Operator* op = static_cast<Operator*>(host_workspace);
-    status = op->run(operator_args, device_workspace, stream, nullptr);
+    status = op->run(operator_args, device_workspace, stream, nullptr, args.use_pdl);
     return status;
   }
 };
@@ -1018,6 +1022,9 @@ protected:
         case RasterOrder::kAlongM:
           operator_args.scheduler.raster_order = Enum_t::AlongM;
           break;
+        case RasterOrder::kL2Aware:
+          operator_args.scheduler.raster_order = Enum_t::L2Aware;
+          break;
         default:
           operator_args.scheduler.raster_order = Enum_t::Heuristic;
       }
@@ -1200,6 +1207,7 @@ public:
       cluster_dims,
       threads_per_block,
       kernel_ptr);
+    args->max_active_clusters = this->partition_max_active_clusters_(args->max_active_clusters, args->sm_count);
 
     if (args->max_active_clusters == 0) {
       std::cerr << "Max Active Clusters could not be queried. " 
@@ -1365,7 +1373,7 @@ public:
     }
 
     Operator* op = static_cast<Operator*>(host_workspace);
-    status = op->run(operator_args, device_workspace, stream, nullptr);
+    status = op->run(operator_args, device_workspace, stream, nullptr, args.use_pdl);
     return status;
   }
 };
@@ -32,19 +32,40 @@
 /*! \file
     \brief CUTLASS Library handle.
 */
+#include <algorithm>
 #include <iostream>
+#include <sstream>
 #include <stdexcept>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <vector>
 
+#include "cutlass/library/gemm_heuristics.h"
 #include "cutlass/library/handle.h"
 #include "cutlass/library/singleton.h"
 #include "cutlass/library/util.h"
 
+#include "cutlass/kernel_hardware_info.h"
+
 namespace cutlass {
 namespace library {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Describes the device to the cost model with the SMs available to the handle's stream, which
+/// are a subset of the device's when the stream belongs to a green context
+static GemmHeuristicDeviceInfo heuristic_device_info(cudaDeviceProp const &device, int sm_count) {
+  GemmHeuristicDeviceInfo device_info(device);
+  if (sm_count > 0) {
+    device_info.sm_count = sm_count;
+  }
+  return device_info;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Constructor
 Handle::Handle(
   cudaStream_t stream,
@@ -55,7 +76,17 @@ Handle::Handle(
   workspace_(nullptr),
   workspace_size_(0),
   scalar_pointer_mode_(ScalarPointerMode::kHost),
-  last_operation_(nullptr) {
+  last_operation_(nullptr),
+  autotune_enabled_(false),
+  autotune_iterations_(10),
+  autotune_cache_(std::make_shared<GemmAutotuneCache>()),
+  filter_cache_(std::make_shared<PrepackedFilterCache>()),
+  heuristics_enabled_(false),
+  reference_sample_count_(0),
+  reference_sample_seed_(0),
+  row_scale_(nullptr),
+  col_scale_(nullptr),
+  pdl_enabled_(false) {
 
   cudaError_t error = cudaGetDevice(&device_idx_);
   if (error != cudaSuccess) {
@@ -67,9 +98,21 @@ Handle::Handle(
     throw std::runtime_error("cudaGetDeviceProperties() failed");
   }
 
+  sm_count_ = KernelHardwareInfo::query_device_multiprocessor_count(device_idx_, stream_);
+
   set_workspace_size(workspace_size);
 
-  Singleton::get();
+  // Selections prebuilt into the library are used whether or not autotuning is enabled
+  for (auto const &entry : Singleton::get().manifest.dispatch_table()) {
+    autotune_cache_->insert(entry.first, entry.second);
+  }
+
+  // A tuning database exported by cutlass_profiler (--export-tuning-db) takes precedence over
+  // prebuilt selections. A database that cannot be read is ignored.
+  char const *tuning_db = std::getenv("CUTLASS_LIBRARY_TUNING_DB");
+  if (tuning_db && *tuning_db) {
+    autotune_cache_->load(tuning_db);
+  }
 }
 
 /// Destructor
@@ -102,6 +145,19 @@ Handle::Handle(Handle && handle) {
   workspace_ = handle.workspace_;
   stream_ = handle.stream_;
   scalar_pointer_mode_ = handle.scalar_pointer_mode_;
+  autotune_enabled_ = handle.autotune_enabled_;
+  autotune_iterations_ = handle.autotune_iterations_;
+  autotune_cache_ = handle.autotune_cache_;
+  heuristics_enabled_ = handle.heuristics_enabled_;
+  workspace_pool_ = handle.workspace_pool_;
+  filter_cache_ = handle.filter_cache_;
+  telemetry_ = handle.telemetry_;
+  reference_sample_count_ = handle.reference_sample_count_;
+  reference_sample_seed_ = handle.reference_sample_seed_;
+  row_scale_ = handle.row_scale_;
+  col_scale_ = handle.col_scale_;
+  pdl_enabled_ = handle.pdl_enabled_;
+  sm_count_ = handle.sm_count_;
 
   handle.workspace_ = nullptr;
   handle.workspace_size_ = 0;
@@ -116,6 +172,19 @@ Handle & Handle::operator=(Handle && handle) {
   workspace_ = handle.workspace_;
   stream_ = handle.stream_;
   scalar_pointer_mode_ = handle.scalar_pointer_mode_;
+  autotune_enabled_ = handle.autotune_enabled_;
+  autotune_iterations_ = handle.autotune_iterations_;
+  autotune_cache_ = handle.autotune_cache_;
+  heuristics_enabled_ = handle.heuristics_enabled_;
+  workspace_pool_ = handle.workspace_pool_;
+  filter_cache_ = handle.filter_cache_;
+  telemetry_ = handle.telemetry_;
+  reference_sample_count_ = handle.reference_sample_count_;
+  reference_sample_seed_ = handle.reference_sample_seed_;
+  row_scale_ = handle.row_scale_;
+  col_scale_ = handle.col_scale_;
+  pdl_enabled_ = handle.pdl_enabled_;
+  sm_count_ = handle.sm_count_;
 
   handle.workspace_ = nullptr;
   handle.workspace_size_ = 0;
@@ -132,6 +201,7 @@ int Handle::compute_capability() const {
 /// Sets the current CUDA stream
 void Handle::set_stream(cudaStream_t stream) {
   stream_ = stream;
+  sm_count_ = KernelHardwareInfo::query_device_multiprocessor_count(device_idx_, stream_);
 }
 
 /// Gets the current CUDA stream
@@ -139,6 +209,11 @@ cudaStream_t Handle::get_stream() const {
   return stream_;
 }
 
+/// Gets the number of SMs available to kernels launched on the current stream
+int Handle::get_sm_count() const {
+  return sm_count_;
+}
+
 /// Gets the current provider
 Provider Handle::get_provider() const {
   return provider_;
@@ -198,6 +273,84 @@ void Handle::set_workspace_size(size_t bytes) {
   }
 }
 
+/// Sets the stream-ordered workspace pool
+void Handle::set_workspace_pool(std::shared_ptr<WorkspacePool> pool) {
+  if (pool && pool->device() != device_idx_) {
+    throw std::runtime_error("Workspace pool belongs to a different device");
+  }
+  workspace_pool_ = pool;
+}
+
+/// Gets the workspace pool
+std::shared_ptr<WorkspacePool> Handle::get_workspace_pool() const {
+  return workspace_pool_;
+}
+
+/// Returns a device workspace of at least the requested size for use on the current stream
+void *Handle::acquire_workspace(uint64_t bytes) {
+  if (workspace_pool_) {
+    return workspace_pool_->acquire(size_t(bytes), stream_);
+  }
+  return (bytes <= uint64_t(workspace_size_)) ? workspace_ : nullptr;
+}
+
+/// Launches an operation on the current stream, recording the launch if it is sampled
+Status Handle::run_operation(
+  Operation const *operation,
+  void const *arguments,
+  void *host_workspace,
+  void *device_workspace,
+  char const *entry_point,
+  gemm::GemmCoord problem_size,
+  int batch_count,
+  bool use_pdl,
+  gemm::GemmCoord const *cluster_shape,
+  gemm::GemmCoord const *cluster_shape_fallback,
+  std::string const *problem_key) {
+
+  if (!telemetry_ || !telemetry_->sample(stream_)) {
+    return operation->run(arguments, host_workspace, device_workspace, stream_);
+  }
+
+  // Launches that cannot be timed are recorded without a duration
+  OperationTelemetry::Timing timing;
+  telemetry_->begin(timing, stream_);
+
+  Status status = operation->run(arguments, host_workspace, device_workspace, stream_);
+
+  OperationRunRecord record;
+  record.entry_point = entry_point;
+  record.operation = operation;
+  record.operation_name = operation->description().name;
+  record.device_idx = device_idx_;
+  record.stream = stream_;
+  record.status = status;
+
+  std::stringstream problem;
+  if (problem_key && problem_size.product() == 0) {
+    problem << *problem_key;
+  }
+  else {
+    problem << "m=" << problem_size.m() << ",n=" << problem_size.n() << ",k=" << problem_size.k()
+      << ",batch=" << batch_count;
+  }
+  record.problem_key = problem.str();
+
+  std::stringstream config;
+  config << "pdl=" << (use_pdl ? 1 : 0);
+  if (cluster_shape && cluster_shape->product() != 0) {
+    config << ",cluster=" << cluster_shape->m() << "x" << cluster_shape->n() << "x" << cluster_shape->k();
+  }
+  if (cluster_shape_fallback && cluster_shape_fallback->product() != 0) {
+    config << ",cluster_fallback=" << cluster_shape_fallback->m() << "x" << cluster_shape_fallback->n()
+      << "x" << cluster_shape_fallback->k();
+  }
+  record.config = config.str();
+
+  telemetry_->end(timing, std::move(record));
+  return status;
+}
+
 /// Gets the scalar pointer mode
 ScalarPointerMode Handle::get_scalar_pointer_mode() const {
   return scalar_pointer_mode_;
@@ -213,17 +366,95 @@ Operation const *Handle::get_last_operation() const {
   return last_operation_;
 }
 
-///////////////////////////////////////////////////////////////////////////////////////////////////
+/// Enables or disables programmatic dependent launch
+void Handle::set_pdl(bool enabled) {
+  pdl_enabled_ = enabled;
+}
+
+/// Returns true if programmatic dependent launch is enabled
+bool Handle::get_pdl() const {
+  return pdl_enabled_;
+}
+
+/// Returns true if the operation is to be launched with programmatic dependent launch
+bool Handle::launch_with_pdl(Operation const *operation) const {
+  return pdl_enabled_ &&
+    operation->description().tile_description.minimum_compute_capability >= 90;
+}
+
+/// Enables or disables autotuning
+void Handle::set_autotuning(bool enabled, int iterations) {
+  autotune_enabled_ = enabled;
+  autotune_iterations_ = std::max(iterations, 1);
+}
+
+/// Returns true if autotuning is enabled
+bool Handle::get_autotuning() const {
+  return autotune_enabled_;
+}
+
+/// Sets the autotuning cache
+void Handle::set_autotune_cache(std::shared_ptr<GemmAutotuneCache> cache) {
+  autotune_cache_ = cache ? cache : std::make_shared<GemmAutotuneCache>();
+}
+
+/// Gets the autotuning cache
+std::shared_ptr<GemmAutotuneCache> Handle::get_autotune_cache() const {
+  return autotune_cache_;
+}
+
+/// Sets the cache of prepacked convolution filters
+void Handle::set_filter_cache(std::shared_ptr<PrepackedFilterCache> cache) {
+  filter_cache_ = cache ? cache : std::make_shared<PrepackedFilterCache>();
+}
+
+/// Gets the cache of prepacked convolution filters
+std::shared_ptr<PrepackedFilterCache> Handle::get_filter_cache() const {
+  return filter_cache_;
+}
+
+/// Sets the telemetry sampling launched operations
+void Handle::set_telemetry(std::shared_ptr<OperationTelemetry> telemetry) {
+  telemetry_ = telemetry;
+}
+
+/// Gets the telemetry
+std::shared_ptr<OperationTelemetry> Handle::get_telemetry() const {
+  return telemetry_;
+}
+
+/// Enables or disables heuristic selection
+void Handle::set_heuristics(bool enabled) {
+  heuristics_enabled_ = enabled;
+}
+
+/// Returns true if heuristic selection is enabled
+bool Handle::get_heuristics() const {
+  return heuristics_enabled_;
+}
+
+/// Sets the number of output tile rows sampled by the device reference provider
+void Handle::set_reference_sampling(int sample_count, uint64_t seed) {
+  reference_sample_count_ = std::max(sample_count, 0);
+  reference_sample_seed_ = seed;
+}
+
+/// Gets the number of output tile rows sampled by the device reference provider
+int Handle::get_reference_sample_count() const {
+  return reference_sample_count_;
+}
 
-/// Returns the maximum required alignment for each operator
-static int maximum_alignment_requirement(GemmDescription const &desc) {
-  return std::max(
-    std::max(desc.A.alignment, desc.B.alignment), desc.C.alignment);
+/// Sets the per-row and per-col scales dequantizing the output of gemm_universal()
+void Handle::set_row_col_scales(void const *row_scale, void const *col_scale) {
+  row_scale_ = row_scale;
+  col_scale_ = col_scale;
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Returns the largest alignment (in units of elements) the problem satisfies, starting from a
 /// given upper limit.
-static int gemm_problem_alignment(
+int gemm_problem_alignment(
   int M,
   int N,
   int K,
@@ -242,7 +473,7 @@ static int gemm_problem_alignment(
   void const * ptr_D,
   int64_t ldd,
   int64_t batch_stride_D,
-  int max_alignment_in_bytes = 16
+  int max_alignment_in_bytes
 ) {
 
   void const *pointers[] = {
@@ -306,44 +537,284 @@ static int gemm_problem_alignment(
   return 0;
 }
 
-/// Find the best kernel in descending order of preference.
-static Operation const * find_gemm_operation(
-  GemmOperationFunctionalMap::const_iterator operators_it,
-  GemmPreferenceKey const preference_key) {
+/// Measures the average time in milliseconds of initializing and running an operation.
+/// Returns a negative value if the operation cannot be run on the given problem.
+static float time_gemm_operation(
+  Operation const *operation,
+  void const *configuration,
+  void *arguments,
+  std::function<void *(uint64_t)> const &acquire_workspace,
+  cudaStream_t stream,
+  int iterations) {
 
-  auto cc_it = operators_it->second.upper_bound(preference_key);
+  if (operation->initialize_with_arguments(arguments) != Status::kSuccess ||
+    operation->can_implement(configuration, arguments) != Status::kSuccess) {
+    return -1;
+  }
 
-  if (cc_it == operators_it->second.begin()) {
-    return nullptr;
+  uint64_t device_workspace_size = operation->get_device_workspace_size(configuration, arguments);
+  void *device_workspace = acquire_workspace(device_workspace_size);
+
+  if (device_workspace_size && !device_workspace) {
+    return -1;
   }
 
-  Operation const *operation = nullptr;
+  std::vector<char> host_workspace(operation->get_host_workspace_size(configuration) + 1);
 
-  // Search in descending order of compute capability
-  do {
-    --cc_it;
+  // Warmup iteration also verifies the operation runs at all
+  Status status = operation->initialize(configuration, host_workspace.data(), device_workspace, stream);
+  if (status == Status::kSuccess) {
+    status = operation->run(arguments, host_workspace.data(), device_workspace, stream);
+  }
+  if (status != Status::kSuccess) {
+    return -1;
+  }
 
-    // Search tile sizes in order, for now.
-    for (auto const * op : cc_it->second) {
+  // Destroys whichever events were created on every return path
+  struct TimingEvents {
+    cudaEvent_t events[2] = {nullptr, nullptr};
 
-      GemmDescription const &desc = static_cast<GemmDescription const &>(op->description());
+    ~TimingEvents() {
+      for (auto event : events) {
+        if (event) {
+          cudaEventDestroy(event);
+        }
+      }
+    }
+  } timing;
 
-      int min_cc = desc.tile_description.minimum_compute_capability;
-      int max_cc = desc.tile_description.maximum_compute_capability;
+  cudaEvent_t (&events)[2] = timing.events;
+  for (auto & event : events) {
+    if (cudaEventCreate(&event) != cudaSuccess) {
+      event = nullptr;
+      return -1;
+    }
+  }
 
-      int op_alignment = maximum_alignment_requirement(desc);
+  cudaEventRecord(events[0], stream);
 
-      if ((min_cc <= preference_key.compute_capability) &&
-        (preference_key.compute_capability <= max_cc) &&
-        (op_alignment <= preference_key.alignment)) {
+  for (int iteration = 0; iteration < iterations && status == Status::kSuccess; ++iteration) {
+    status = operation->initialize(configuration, host_workspace.data(), device_workspace, stream);
+    if (status == Status::kSuccess) {
+      status = operation->run(arguments, host_workspace.data(), device_workspace, stream);
+    }
+  }
 
-        operation = op;
-        break;
+  cudaEventRecord(events[1], stream);
+
+  float elapsed_ms = -1;
+  if (status == Status::kSuccess && cudaEventSynchronize(events[1]) == cudaSuccess) {
+    cudaEventElapsedTime(&elapsed_ms, events[0], events[1]);
+    elapsed_ms /= float(iterations);
+  }
+
+  return elapsed_ms;
+}
+
+/// Preferred and fallback cluster shapes timed for operations with a dynamic cluster shape. The
+/// fallback shapes keep an even M extent so that they also serve 2SM kernels.
+static gemm::GemmCoord const kAutotuneClusterShapes[][2] = {
+  {{1, 1, 1}, {1, 1, 1}},
+  {{2, 1, 1}, {2, 1, 1}},
+  {{2, 2, 1}, {2, 1, 1}},
+  {{4, 1, 1}, {2, 1, 1}},
+  {{4, 2, 1}, {2, 1, 1}},
+  {{4, 4, 1}, {2, 2, 1}},
+  {{8, 2, 1}, {2, 1, 1}}
+};
+
+/// Returns true if the operation is launched with the cluster shape given in its arguments
+static bool has_dynamic_cluster_shape(Operation const *operation) {
+  gemm::GemmCoord const &cluster_shape = operation->description().tile_description.cluster_shape;
+  return cluster_shape.m() == 0 || cluster_shape.n() == 0 || cluster_shape.k() == 0;
+}
+
+/// Selects an operation using the autotuning cache. On a cache miss, all candidates are timed
+/// and the fastest is recorded. Returns nullptr if no selection could be made, in which case the
+/// caller falls back to the most preferred candidate.
+///
+/// If `cluster_shape` and `cluster_shape_fallback` point into `arguments`, candidates with a dynamic
+/// cluster shape are timed at each of kAutotuneClusterShapes, and the shapes of the selection are
+/// recorded with it and written back to `arguments`. Otherwise the cluster shapes of the launch
+/// are kept.
+///
+/// If `universal_arguments` is given, the raster order, swizzle size and split-K slice count of a
+/// cached selection are applied to it as well. Cached runtime arguments the operation cannot
+/// implement are dropped in favor of those of the launch.
+static Operation const * autotune_gemm_operation(
+  std::vector<Operation const *> const &candidates,
+  std::string const &autotune_key,
+  GemmAutotuneCache &cache,
+  bool allow_tuning,
+  void const *configuration,
+  void *arguments,
+  std::function<void *(uint64_t)> const &acquire_workspace,
+  cudaStream_t stream,
+  int iterations,
+  gemm::GemmCoord *cluster_shape = nullptr,
+  gemm::GemmCoord *cluster_shape_fallback = nullptr,
+  GemmUniversalArguments *universal_arguments = nullptr) {
+
+  bool tune_cluster_shape = cluster_shape && cluster_shape_fallback;
+
+  GemmAutotuneSelection cached;
+  if (cache.find(autotune_key, cached)) {
+    for (auto const *op : candidates) {
+      if (cached.operation_name != op->description().name) {
+        continue;
+      }
+
+      bool apply_cluster_shape = tune_cluster_shape && cached.has_cluster_shape() && has_dynamic_cluster_shape(op);
+      bool apply_scheduler_arguments = universal_arguments && cached.has_scheduler_arguments();
+
+      if (apply_cluster_shape || apply_scheduler_arguments) {
+        gemm::GemmCoord launch_cluster_shape;
+        gemm::GemmCoord launch_cluster_shape_fallback;
+        RasterOrder launch_raster_order = RasterOrder::kHeuristic;
+        int launch_swizzle_size = 1;
+        int launch_split_k_slices = 1;
+
+        if (apply_cluster_shape) {
+          launch_cluster_shape = *cluster_shape;
+          launch_cluster_shape_fallback = *cluster_shape_fallback;
+
+          *cluster_shape = cached.cluster_shape;
+          *cluster_shape_fallback = cached.cluster_shape_fallback;
+        }
+
+        if (apply_scheduler_arguments) {
+          launch_raster_order = universal_arguments->raster_order;
+          launch_swizzle_size = universal_arguments->swizzle_size;
+          launch_split_k_slices = universal_arguments->split_k_slices;
+
+          if (cached.raster_order != RasterOrder::kInvalid) {
+            universal_arguments->raster_order = cached.raster_order;
+          }
+          if (cached.swizzle_size != 0) {
+            universal_arguments->swizzle_size = cached.swizzle_size;
+          }
+          if (cached.split_k_slices != 0) {
+            universal_arguments->split_k_slices = cached.split_k_slices;
+          }
+        }
+
+        if (op->can_implement(configuration, arguments) == Status::kSuccess) {
+          return op;
+        }
+
+        // The cached runtime arguments do not suit this launch
+        if (apply_cluster_shape) {
+          *cluster_shape = launch_cluster_shape;
+          *cluster_shape_fallback = launch_cluster_shape_fallback;
+        }
+        if (apply_scheduler_arguments) {
+          universal_arguments->raster_order = launch_raster_order;
+          universal_arguments->swizzle_size = launch_swizzle_size;
+          universal_arguments->split_k_slices = launch_split_k_slices;
+        }
+      }
+
+      if (op->can_implement(configuration, arguments) == Status::kSuccess) {
+        return op;
+      }
+    }
+  }
+
+  // Kernels may not be timed while the stream is being captured into a graph
+  cudaStreamCaptureStatus capture_status = cudaStreamCaptureStatusNone;
+  if (cudaStreamIsCapturing(stream, &capture_status) != cudaSuccess ||
+    capture_status != cudaStreamCaptureStatusNone) {
+    allow_tuning = false;
+  }
+
+  if (!allow_tuning) {
+    return nullptr;
+  }
+
+  Operation const *best_operation = nullptr;
+  GemmAutotuneSelection best_selection;
+  float best_runtime = 0;
+
+  auto time_candidate = [&](Operation const *op) {
+    float runtime = time_gemm_operation(
+      op, configuration, arguments, acquire_workspace, stream, iterations);
+
+    if (runtime >= 0 && (!best_operation || runtime < best_runtime)) {
+      best_operation = op;
+      best_runtime = runtime;
+      best_selection.operation_name = op->description().name;
+      best_selection.cluster_shape = {};
+      best_selection.cluster_shape_fallback = {};
+      return true;
+    }
+    return false;
+  };
+
+  for (auto const *op : candidates) {
+    if (!tune_cluster_shape || !has_dynamic_cluster_shape(op)) {
+      time_candidate(op);
+      continue;
+    }
+
+    gemm::GemmCoord launch_cluster_shape = *cluster_shape;
+    gemm::GemmCoord launch_cluster_shape_fallback = *cluster_shape_fallback;
+
+    for (auto const &shapes : kAutotuneClusterShapes) {
+      *cluster_shape = shapes[0];
+      *cluster_shape_fallback = shapes[1];
+
+      if (time_candidate(op)) {
+        best_selection.cluster_shape = shapes[0];
+        best_selection.cluster_shape_fallback = shapes[1];
       }
     }
-  } while (!operation && cc_it != operators_it->second.begin());
 
-  return operation;
+    *cluster_shape = launch_cluster_shape;
+    *cluster_shape_fallback = launch_cluster_shape_fallback;
+  }
+
+  if (best_operation) {
+    if (best_selection.has_cluster_shape()) {
+      *cluster_shape = best_selection.cluster_shape;
+      *cluster_shape_fallback = best_selection.cluster_shape_fallback;
+    }
+    cache.insert(autotune_key, best_selection);
+  }
+
+  return best_operation;
+}
+
+/// Selects the candidate of least estimated cost able to implement the problem. Returns nullptr if
+/// none can, in which case the caller falls back to the most preferred candidate.
+static Operation const * heuristic_gemm_operation(
+  std::vector<Operation const *> const &candidates,
+  gemm::GemmCoord problem_size,
+  int batch_count,
+  GemmHeuristicDeviceInfo const &device,
+  void const *configuration,
+  void const *arguments) {
+
+  std::vector<Operation const *> ranked(candidates);
+  rank_gemm_operations(ranked, problem_size, batch_count, device);
+
+  for (auto const *op : ranked) {
+    if (op->can_implement(configuration, arguments) == Status::kSuccess) {
+      return op;
+    }
+  }
+
+  return nullptr;
+}
+
+/// Returns the layout of the transpose of a matrix stored in the given layout, or
+/// LayoutTypeID::kInvalid if the layout has no transposed counterpart.
+static LayoutTypeID transposed_matrix_layout(LayoutTypeID layout) {
+  switch (layout) {
+    case LayoutTypeID::kColumnMajor: return LayoutTypeID::kRowMajor;
+    case LayoutTypeID::kRowMajor: return LayoutTypeID::kColumnMajor;
+    default: break;
+  }
+  return LayoutTypeID::kInvalid;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -386,6 +857,25 @@ Status Handle::gemm(
   int64_t ldd                               /// Leading dimension of D matrix
 ) {
 
+  //
+  // Prefer the skinny tensor core kernels when M is small
+  //
+
+  if (M <= kSmallMMaximum) {
+    Status status = gemm_small_m(
+      M, N, K,
+      element_compute, element_scalar, alpha,
+      element_A, layout_A, transform_A, ptr_A, lda,
+      element_B, layout_B, transform_B, ptr_B, ldb,
+      beta,
+      element_C, ptr_C, ldc,
+      ptr_D, ldd);
+
+    if (status != cutlass::Status::kErrorNotSupported) {
+      return status;
+    }
+  }
+
   //
   // Find the operation
   //
@@ -407,120 +897,1169 @@ Status Handle::gemm(
     LayoutTypeID::kColumnMajor
   );
 
-  auto operators_it = Singleton::get().operation_table.gemm_operations.find(key);
+  //
+  // Compute the largest alignment restriction the kernel can satisfy.
+  //
+
+  // Maximum alignment expectation among all kernels (in units of bytes)
+  int const kMaximumAlignmentSize = 16;
+
+  int alignment = gemm_problem_alignment(
+    M, N, K,
+    element_A, ptr_A, lda, 0,
+    element_B, ptr_B, ldb, 0,
+    element_C, ptr_C, ldc, 0,
+    ptr_D, ldd, 0, kMaximumAlignmentSize
+  );
+
+  //
+  // Find the best kernel in descending order of preference.
+  //
+
+  std::vector<Operation const *> const *candidates =
+    Singleton::get().operation_table.find_gemm_operations(key, compute_capability(), alignment);
 
-  if (operators_it == Singleton::get().operation_table.gemm_operations.end()) {
+  if (!candidates) {
     return cutlass::Status::kErrorNotSupported;
   }
 
-  if (operators_it->second.empty()) {
+  GemmConfiguration configuration{
+    {M, N, K},
+    lda,
+    ldb,
+    ldc,
+    ldd,
+    1
+  };
+
+  GemmArguments arguments{
+    ptr_A,
+    ptr_B,
+    ptr_C,
+    ptr_D,
+    alpha,
+    beta,
+    scalar_pointer_mode_
+  };
+
+  Operation const *operation = nullptr;
+
+  if (autotune_enabled_ || autotune_cache_->size()) {
+
+    // Timing candidates overwrites D, so in-place problems only consume cached selections.
+    bool allow_tuning = autotune_enabled_ && (ptr_C != ptr_D);
+
+    operation = autotune_gemm_operation(
+      *candidates,
+      to_string(GemmAutotuneKey(key, compute_capability(), alignment, M, N, K)),
+      *autotune_cache_,
+      allow_tuning,
+      &configuration,
+      &arguments,
+      [this](uint64_t bytes) { return acquire_workspace(bytes); },
+      stream_,
+      autotune_iterations_);
+  }
+
+  if (!operation && heuristics_enabled_) {
+    operation = heuristic_gemm_operation(
+      *candidates, {M, N, K}, 1, heuristic_device_info(device_, sm_count_), &configuration, &arguments);
+  }
+
+  if (!operation) {
+    operation = candidates->front();
+  }
+
+  last_operation_ = operation;
+
+  //
+  // Configure operation
+  //
+
+  // Query host work space size
+  uint64_t host_workspace_size_needed = operation->get_host_workspace_size(&configuration);
+
+  if (uint64_t(kHostWorkspaceSize) < host_workspace_size_needed) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  char host_workspace[kHostWorkspaceSize];
+
+  // Query device workspace size
+  uint64_t device_workspace_size_needed = operation->get_device_workspace_size(&configuration);
+
+  void *device_workspace = acquire_workspace(device_workspace_size_needed);
+
+  if (device_workspace_size_needed && !device_workspace) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  // Initialize host and device workspaces
+  Status status = operation->initialize(
+    &configuration,
+    host_workspace,
+    device_workspace,
+    stream_);
+
+  if (status != cutlass::Status::kSuccess) {
+    return status;
+  }
+
+  // Run the operator
+  arguments.use_pdl = launch_with_pdl(operation);
+  return run_operation(
+    operation, &arguments, host_workspace, device_workspace, "gemm", {M, N, K}, 1, arguments.use_pdl);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Executes D <= alpha * A*B + beta * C with small M as D^T <= alpha * B^T*A^T + beta * C^T.
+Status Handle::gemm_small_m(
+  int M,
+  int N,
+  int K,
+  NumericTypeID element_compute,
+  NumericTypeID element_scalar,
+  void const *alpha,
+  NumericTypeID element_A,
+  LayoutTypeID layout_A,
+  ComplexTransform transform_A,
+  void const * ptr_A,
+  int64_t lda,
+  NumericTypeID element_B,
+  LayoutTypeID layout_B,
+  ComplexTransform transform_B,
+  void const * ptr_B,
+  int64_t ldb,
+  void const * beta,
+  NumericTypeID element_C,
+  void const * ptr_C,
+  int64_t ldc,
+  void * ptr_D,
+  int64_t ldd) {
+
+  LayoutTypeID layout_Bt = transposed_matrix_layout(layout_B);
+  LayoutTypeID layout_At = transposed_matrix_layout(layout_A);
+
+  if (layout_Bt == LayoutTypeID::kInvalid || layout_At == LayoutTypeID::kInvalid) {
     return cutlass::Status::kErrorNotSupported;
   }
 
   //
-  // Compute the largest alignment restriction the kernel can satisfy.
+  // Find the operation. The swapped problem is N-by-M with B^T as its first operand, and the
+  // transpose of a column-major D is row-major.
   //
 
-  // Maximum alignment expectation among all kernels (in units of bytes)
+  GemmFunctionalKey key(
+    provider_,
+    GemmKind::kUniversal,
+    element_compute,
+    element_scalar,
+    element_B,
+    layout_Bt,
+    transform_B,
+    element_A,
+    layout_At,
+    transform_A,
+    element_C,
+    LayoutTypeID::kRowMajor,
+    element_C,
+    LayoutTypeID::kRowMajor
+  );
+
+  // Skinny kernels load and store through TMA, which tolerates a ragged extent along the narrow
+  // dimension. Only the remaining extents, leading dimensions, and pointers limit alignment.
   int const kMaximumAlignmentSize = 16;
 
   int alignment = gemm_problem_alignment(
-    M, N, K,
-    element_A, ptr_A, lda, 0,
+    N, N, K,
     element_B, ptr_B, ldb, 0,
+    element_A, ptr_A, lda, 0,
     element_C, ptr_C, ldc, 0,
     ptr_D, ldd, 0, kMaximumAlignmentSize
   );
 
-  //
-  // Find the best kernel in descending order of preference.
+  std::vector<Operation const *> const *operations =
+    Singleton::get().operation_table.find_gemm_operations(key, compute_capability(), alignment);
+
+  if (!operations) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  std::vector<Operation const *> candidates;
+  int tile_m = 0;
+  int tile_k = 0;
+
+  for (auto const *op : *operations) {
+    TileDescription const &tile =
+      static_cast<GemmDescription const &>(op->description()).tile_description;
+
+    // Architecture-specific kernels such as those using WGMMA do not run on later devices
+    if (tile.threadblock_shape.n() <= kSmallMMaximum &&
+      tile.maximum_compute_capability >= compute_capability()) {
+      candidates.push_back(op);
+      tile_m = std::max(tile_m, tile.threadblock_shape.m());
+      tile_k = std::max(tile_k, tile.threadblock_shape.k());
+    }
+  }
+
+  if (candidates.empty()) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  // A narrow problem yields few output tiles, so split K until the device is occupied. Only
+  // stream-K kernels consume the split count; the others ignore it.
+  int tiles = (N + tile_m - 1) / tile_m;
+  int k_tiles = (K + tile_k - 1) / tile_k;
+  int split_k_slices = std::max(1, std::min(sm_count_ / std::max(tiles, 1), k_tiles));
+
+  GemmUniversalConfiguration configuration{
+    GemmUniversalMode::kGemm,
+    {N, M, K},
+    {},
+    {},
+    1,
+    ldb,
+    lda,
+    ldc,
+    ldd
+  };
+
+  GemmUniversalArguments arguments{
+    {N, M, K},
+    {},
+    {},
+    1,
+    ptr_B,
+    ptr_A,
+    ptr_C,
+    ptr_D,
+    alpha,
+    beta,
+    scalar_pointer_mode_,
+    ldb,
+    lda,
+    ldc,
+    ldd
+  };
+
+  arguments.split_k_slices = split_k_slices;
+  arguments.sm_count = sm_count_;
+
+  Operation const *operation = nullptr;
+
+  if (autotune_enabled_ || autotune_cache_->size()) {
+
+    // Timing candidates overwrites D, so in-place problems only consume cached selections.
+    bool allow_tuning = autotune_enabled_ && (ptr_C != ptr_D);
+
+    operation = autotune_gemm_operation(
+      candidates,
+      to_string(GemmAutotuneKey(key, compute_capability(), alignment, N, M, K)),
+      *autotune_cache_,
+      allow_tuning,
+      &configuration,
+      &arguments,
+      [this](uint64_t bytes) { return acquire_workspace(bytes); },
+      stream_,
+      autotune_iterations_);
+  }
+
+  if (!operation) {
+    for (auto const *op : candidates) {
+      if (op->can_implement(&configuration, &arguments) == Status::kSuccess) {
+        operation = op;
+        break;
+      }
+    }
+  }
+
+  if (!operation) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  last_operation_ = operation;
+
+  //
+  // Configure operation
+  //
+
+  // Query host work space size
+  uint64_t host_workspace_size_needed = operation->get_host_workspace_size(&configuration);
+
+  if (uint64_t(kHostWorkspaceSize) < host_workspace_size_needed) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  char host_workspace[kHostWorkspaceSize];
+
+  // Query device workspace size
+  uint64_t device_workspace_size_needed = operation->get_device_workspace_size(&configuration, &arguments);
+
+  void *device_workspace = acquire_workspace(device_workspace_size_needed);
+
+  if (device_workspace_size_needed && !device_workspace) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  // Initialize host and device workspaces
+  Status status = operation->initialize(
+    &configuration,
+    host_workspace,
+    device_workspace,
+    stream_);
+
+  if (status != cutlass::Status::kSuccess) {
+    return status;
+  }
+
+  // Run the operator
+  arguments.use_pdl = launch_with_pdl(operation);
+  return run_operation(
+    operation, &arguments, host_workspace, device_workspace, "gemm", {M, N, K}, 1, arguments.use_pdl);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Executes a GEMM computation: D <= alpha * A*B + beta * C.
+//
+// Supports batched-strided, batched array or split-K serial or split-K parallel.
+//
+Status Handle::gemm_universal(
+
+  GemmUniversalMode mode,                   /// indicates the mode in which the kUniversal GEMM is launched
+
+  int M,                                    /// GEMM M dimension
+  int N,                                    /// GEMM N dimension
+  int K,                                    /// GEMM K dimension
+  
+  int cluster_m,                            /// cluster shape M dimension
+  int cluster_n,                            /// cluster shape N dimension
+  int cluster_k,                            /// cluster shape K dimension
+  int cluster_m_fallback,                   /// Fallback cluster shape M dimension
+  int cluster_n_fallback,                   /// Fallback cluster shape N dimension
+  int cluster_k_fallback,                   /// Fallback cluster shape K dimension
+  
+
+  NumericTypeID element_compute,            /// Data type of internal accumulation
+
+  NumericTypeID element_scalar,             /// Data type of alpha/beta scalars
+
+  void const *alpha,                        /// Pointer to alpha scalar
+
+  NumericTypeID element_A,                  /// Data type of A matrix elements
+  LayoutTypeID layout_A,                    /// Layout of A matrix
+  ComplexTransform transform_A,             /// Complex transformation applied to A matrix - ignored for real-valued matrices
+  void const * ptr_A,                       /// Pointer to A matrix in Global Memory
+  int64_t lda,                              /// Leading dimension of A matrix
+
+  NumericTypeID element_B,                  /// Data type of B matrix elements
+  LayoutTypeID layout_B,                    /// Layout of B matrix
+  ComplexTransform transform_B,             /// Complex transformation applied to B matrix - ignored for real-valued matrices
+  void const * ptr_B,                       /// Pointer to B matrix in Global Memory
+  int64_t ldb,                              /// Leading dimension of B matrix
+
+  void const * beta,                        /// Pointer to beta scalar
+
+  NumericTypeID element_C,                  /// Data type of C matrix
+  LayoutTypeID layout_C,                    /// Layout of D matrix
+  void const * ptr_C,                       /// Pointer to C matrix
+  int64_t ldc,                              /// Leading dimension of C matrix
+
+  NumericTypeID element_D,                  /// Data type of D matrix
+  LayoutTypeID layout_D,                    /// Layout of D matrix
+  void * ptr_D,                             /// Pointer to D matrix
+  int64_t ldd,                              /// Leading dimension of D matrix
+
+  int batch_count,                          /// Batch count or number of split-K slices
+
+  int64_t batch_stride_A,                   /// Batch stride of A operand
+  int64_t batch_stride_B,                   /// Batch stride of B operand
+  int64_t batch_stride_C,                   /// Batch stride of C operand
+  int64_t batch_stride_D                    /// Batch stride of D operand
+) {
+
+  //
+  // Find the operation
+  //
+
+  GemmFunctionalKey key(
+    provider_,
+    GemmKind::kUniversal,
+    element_compute,
+    element_scalar,
+    element_A,
+    layout_A,
+    transform_A,
+    element_B,
+    layout_B,
+    transform_B,
+    element_C,
+    layout_C,
+    element_D,
+    layout_D
+  );
+
+  //
+  // Compute the largest alignment restriction the kernel can satisfy.
+  //
+
+  // Maximum alignment expectation among all kernels (in units of bytes)
+  int const kMaximumAlignmentSize = 16;
+
+  void const *ptr_A_check = ptr_A;
+  void const *ptr_B_check = ptr_B;
+  void const *ptr_C_check = ptr_C;
+  void *      ptr_D_check = ptr_D;
+
+  // Ignore alignment of pointers to pointers. We can't check this from the host,
+  // as each batch index has its own pointer in device memory.
+  if (mode == GemmUniversalMode::kArray) {
+    ptr_A_check = nullptr;
+    ptr_B_check = nullptr;
+    ptr_C_check = nullptr;
+    ptr_D_check = nullptr;
+  }
+
+  // Every batch of a strided batched GEMM must be as aligned as the first
+  bool batched = (mode == GemmUniversalMode::kBatched && batch_count > 1);
+
+  int alignment = gemm_problem_alignment(
+    M, N, K,
+    element_A, ptr_A_check, lda, batched ? batch_stride_A : 0,
+    element_B, ptr_B_check, ldb, batched ? batch_stride_B : 0,
+    element_C, ptr_C_check, ldc, batched ? batch_stride_C : 0,
+    ptr_D_check, ldd, batched ? batch_stride_D : 0, kMaximumAlignmentSize
+  );
+
+  //
+  // Find the best kernel in descending order of preference.
+  //
+
+  std::vector<Operation const *> const *candidates =
+    Singleton::get().operation_table.find_gemm_operations(key, compute_capability(), alignment);
+
+  if (!candidates) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  //
+  // Configure operation
+  //
+
+  GemmUniversalConfiguration configuration{
+    mode,
+    {M, N, K},
+    {cluster_m, cluster_n, cluster_k}, 
+    {cluster_m_fallback, cluster_n_fallback, cluster_k_fallback}, 
+    batch_count,
+    lda,
+    ldb,
+    ldc,
+    ldd
+  };
+
+  GemmUniversalArguments arguments{
+    {M, N, K},
+    {cluster_m, cluster_n, cluster_k}, 
+    {cluster_m_fallback, cluster_n_fallback, cluster_k_fallback}, 
+    batch_count,
+    ptr_A,
+    ptr_B,
+    ptr_C,
+    ptr_D,
+    alpha,
+    beta,
+    scalar_pointer_mode_,
+    lda,
+    ldb,
+    ldc,
+    ldd,
+    batch_stride_A,
+    batch_stride_B,
+    batch_stride_C,
+    batch_stride_D
+  };
+
+  arguments.reference_sample_count = reference_sample_count_;
+  arguments.reference_sample_seed = reference_sample_seed_;
+  arguments.sm_count = sm_count_;
+  arguments.row_scale = row_scale_;
+  arguments.col_scale = col_scale_;
+
+  bool row_col_scaled = (row_scale_ || col_scale_);
+
+  Operation const *operation = nullptr;
+
+  // Autotuning decisions are keyed by problem extents only, so they are not shared with batched
+  // and split-K launches.
+  if ((autotune_enabled_ || autotune_cache_->size()) &&
+    mode == GemmUniversalMode::kGemm && batch_count == 1) {
+
+    // Timing candidates overwrites D, so in-place problems only consume cached selections.
+    bool allow_tuning = autotune_enabled_ && (ptr_C != ptr_D);
+
+    operation = autotune_gemm_operation(
+      *candidates,
+      to_string(GemmAutotuneKey(key, compute_capability(), alignment, M, N, K)) +
+        (row_col_scaled ? "_rowcolscale" : ""),
+      *autotune_cache_,
+      allow_tuning,
+      &configuration,
+      &arguments,
+      [this](uint64_t bytes) { return acquire_workspace(bytes); },
+      stream_,
+      autotune_iterations_,
+      &arguments.cluster_shape,
+      &arguments.cluster_shape_fallback,
+      &arguments);
+  }
+
+  if (!operation && heuristics_enabled_) {
+    operation = heuristic_gemm_operation(
+      *candidates, {M, N, K}, batch_count, heuristic_device_info(device_, sm_count_), &configuration, &arguments);
+  }
+
+  // Operations without the fused scales reject them
+  if (!operation && row_col_scaled) {
+    for (auto const *op : *candidates) {
+      if (op->can_implement(&configuration, &arguments) == Status::kSuccess) {
+        operation = op;
+        break;
+      }
+    }
+
+    if (!operation) {
+      return cutlass::Status::kErrorNotSupported;
+    }
+  }
+
+  if (!operation) {
+    operation = candidates->front();
+  }
+
+  last_operation_ = operation;
+
+  // Query host work space size
+  uint64_t host_workspace_size_needed = operation->get_host_workspace_size(&configuration);
+
+  if (uint64_t(kHostWorkspaceSize) < host_workspace_size_needed) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  char host_workspace[kHostWorkspaceSize];
+
+  // Query device workspace size
+  uint64_t device_workspace_size_needed = operation->get_device_workspace_size(&configuration, &arguments);
+
+  void *device_workspace = acquire_workspace(device_workspace_size_needed);
+
+  if (device_workspace_size_needed && !device_workspace) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  // Initialize host and device workspaces
+  Status status = operation->initialize(
+    &configuration,
+    host_workspace,
+    device_workspace,
+    stream_);
+
+  if (status != cutlass::Status::kSuccess) {
+    return status;
+  }
+
+  // Run the operator
+  arguments.use_pdl = launch_with_pdl(operation);
+  return run_operation(
+    operation, &arguments, host_workspace, device_workspace, "gemm_universal", {M, N, K}, batch_count,
+    arguments.use_pdl, &arguments.cluster_shape, &arguments.cluster_shape_fallback);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Executes a tensor contraction planned by plan_contraction()
+Status Handle::contraction(
+  ContractionPlan const &plan,
+  void const *alpha,
+  void const *ptr_A,
+  void const *ptr_B,
+  void const *beta,
+  void const *ptr_C,
+  void *ptr_D) {
+
+  // Launches after the first along K accumulate into D
+  std::vector<uint8_t> one;
+  for (ContractionLoopMode const &mode : plan.loop_modes) {
+    if (mode.accumulates && one.empty()) {
+      if (scalar_pointer_mode_ != ScalarPointerMode::kHost ||
+          !cast_from_double(one, plan.element_scalar, 1.0)) {
+        return Status::kErrorNotSupported;
+      }
+    }
+  }
+
+  auto offset_pointer = [](void const *ptr, NumericTypeID element, int64_t offset) -> void const * {
+    if (!ptr) {
+      return nullptr;
+    }
+    return static_cast<uint8_t const *>(ptr) + offset * library::sizeof_bits(element) / 8;
+  };
+
+  // Accumulating launches read C from D
+  auto launch = [&](ContractionPlan p, bool accumulate, void const *a, void const *b, void const *beta_i, void const *c, void *d) {
+    if (accumulate) {
+      p.element_C = p.element_D;
+      p.ldc = p.ldd;
+      p.batch_stride_C = p.batch_stride_D;
+    }
+    return gemm_universal(
+      p.batch_count > 1 ? GemmUniversalMode::kBatched : GemmUniversalMode::kGemm,
+      p.M, p.N, p.K,
+      1, 1, 1,
+      1, 1, 1,
+      p.element_compute,
+      p.element_scalar,
+      alpha,
+      p.element_A, p.layout_A, ComplexTransform::kNone, a, p.lda,
+      p.element_B, p.layout_B, ComplexTransform::kNone, b, p.ldb,
+      beta_i,
+      p.element_C, p.layout_C, c, p.ldc,
+      p.element_D, p.layout_C, d, p.ldd,
+      p.batch_count,
+      p.batch_stride_A,
+      p.batch_stride_B,
+      p.batch_stride_C,
+      p.batch_stride_D);
+  };
+
+  ContractionPlan transposed = plan.transposed();
+  bool use_transposed = false;
+
+  std::vector<int64_t> coord(plan.loop_modes.size(), 0);
+  int64_t launch_count = plan.launch_count();
+
+  for (int64_t launch_idx = 0; launch_idx < launch_count; ++launch_idx) {
+
+    int64_t offset_A = 0;
+    int64_t offset_B = 0;
+    int64_t offset_C = 0;
+    int64_t offset_D = 0;
+    bool accumulate = false;
+
+    for (size_t i = 0; i < coord.size(); ++i) {
+      ContractionLoopMode const &mode = plan.loop_modes[i];
+      offset_A += coord[i] * mode.stride_A;
+      offset_B += coord[i] * mode.stride_B;
+      offset_C += coord[i] * mode.stride_C;
+      offset_D += coord[i] * mode.stride_D;
+      accumulate = accumulate || (mode.accumulates && coord[i]);
+    }
+
+    void const *a = offset_pointer(ptr_A, plan.element_A, offset_A);
+    void const *b = offset_pointer(ptr_B, plan.element_B, offset_B);
+    void *d = const_cast<void *>(offset_pointer(ptr_D, plan.element_D, offset_D));
+    void const *c = accumulate ? d : offset_pointer(ptr_C, plan.element_C, offset_C);
+    void const *beta_i = accumulate ? one.data() : beta;
+
+    Status status = Status::kErrorNotSupported;
+    if (!use_transposed) {
+      status = launch(plan, accumulate, a, b, beta_i, c, d);
+      // Fall back to D^T = B^T * A^T only before anything was launched
+      use_transposed = (status == Status::kErrorNotSupported && launch_idx == 0);
+    }
+    if (use_transposed) {
+      status = launch(transposed, accumulate, b, a, beta_i, c, d);
+    }
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    // Advance the coordinate, innermost mode last
+    for (size_t i = coord.size(); i > 0; --i) {
+      if (++coord[i - 1] < plan.loop_modes[i - 1].extent) {
+        break;
+      }
+      coord[i - 1] = 0;
+    }
+  }
+
+  return Status::kSuccess;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Selects an operation among candidates and launches it
+Status Handle::select_and_run(
+  char const *entry_point,
+  std::vector<Operation const *> const &candidates,
+  std::string const &autotune_key,
+  bool allow_tuning,
+  bool rank_by_cost,
+  gemm::GemmCoord problem_size,
+  int batch_count,
+  void const *configuration,
+  void *arguments,
+  bool &use_pdl,
+  gemm::GemmCoord *cluster_shape,
+  gemm::GemmCoord *cluster_shape_fallback) {
+
+  Operation const *operation = nullptr;
+
+  if (!autotune_key.empty() && (autotune_enabled_ || autotune_cache_->size())) {
+    operation = autotune_gemm_operation(
+      candidates,
+      autotune_key,
+      *autotune_cache_,
+      autotune_enabled_ && allow_tuning,
+      configuration,
+      arguments,
+      [this](uint64_t bytes) { return acquire_workspace(bytes); },
+      stream_,
+      autotune_iterations_,
+      cluster_shape,
+      cluster_shape_fallback);
+  }
+
+  if (!operation && heuristics_enabled_ && rank_by_cost) {
+    operation = heuristic_gemm_operation(
+      candidates, problem_size, batch_count, heuristic_device_info(device_, sm_count_), configuration, arguments);
+  }
+
+  if (!operation) {
+    for (auto const *op : candidates) {
+      if (op->can_implement(configuration, arguments) == Status::kSuccess) {
+        operation = op;
+        break;
+      }
+    }
+  }
+
+  if (!operation) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  last_operation_ = operation;
+
+  // Set arguments depending on the selected kernel, such as the number of active clusters
+  Status status = operation->initialize_with_arguments(arguments);
+
+  if (status != cutlass::Status::kSuccess) {
+    return status;
+  }
+
+  // Query host work space size
+  uint64_t host_workspace_size_needed = operation->get_host_workspace_size(configuration);
+
+  if (uint64_t(kHostWorkspaceSize) < host_workspace_size_needed) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  char host_workspace[kHostWorkspaceSize];
+
+  // Query device workspace size
+  uint64_t device_workspace_size_needed = operation->get_device_workspace_size(configuration, arguments);
+
+  void *device_workspace = acquire_workspace(device_workspace_size_needed);
+
+  if (device_workspace_size_needed && !device_workspace) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  // Initialize host and device workspaces
+  status = operation->initialize(
+    configuration,
+    host_workspace,
+    device_workspace,
+    stream_);
+
+  if (status != cutlass::Status::kSuccess) {
+    return status;
+  }
+
+  // Run the operator
+  use_pdl = launch_with_pdl(operation);
+  return run_operation(
+    operation, arguments, host_workspace, device_workspace, entry_point, problem_size, batch_count,
+    use_pdl, cluster_shape, cluster_shape_fallback, &autotune_key);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Executes a grouped GEMM computation
+Status Handle::grouped_gemm(
+
+  int problem_count,                        /// Number of GEMM problems in the group
+  cute::Shape<int, int, int> const *problem_sizes_host, /// Host array of GEMM problem sizes
+  cute::Shape<int, int, int> const *problem_sizes,      /// Device array of GEMM problem sizes
+
+  int cluster_m,                            /// cluster shape M dimension
+  int cluster_n,                            /// cluster shape N dimension
+  int cluster_k,                            /// cluster shape K dimension
+  int cluster_m_fallback,                   /// Fallback cluster shape M dimension
+  int cluster_n_fallback,                   /// Fallback cluster shape N dimension
+  int cluster_k_fallback,                   /// Fallback cluster shape K dimension
+
+  NumericTypeID element_compute,            /// Data type of internal accumulation
+
+  NumericTypeID element_scalar,             /// Data type of alpha/beta scalars
+
+  void const *alpha,                        /// Pointer to alpha scalar
+
+  NumericTypeID element_A,                  /// Data type of A matrix elements
+  LayoutTypeID layout_A,                    /// Layout of A matrix
+  ComplexTransform transform_A,             /// Complex transformation applied to A matrix - ignored for real-valued matrices
+  void const * const * ptr_A,               /// Device array of pointers to A matrices
+  int64_t const *lda,                       /// Host array of leading dimensions of A matrices
+
+  NumericTypeID element_B,                  /// Data type of B matrix elements
+  LayoutTypeID layout_B,                    /// Layout of B matrix
+  ComplexTransform transform_B,             /// Complex transformation applied to B matrix - ignored for real-valued matrices
+  void const * const * ptr_B,               /// Device array of pointers to B matrices
+  int64_t const *ldb,                       /// Host array of leading dimensions of B matrices
+
+  void const * beta,                        /// Pointer to beta scalar
+
+  NumericTypeID element_C,                  /// Data type of C matrix
+  LayoutTypeID layout_C,                    /// Layout of C matrix
+  void const * const * ptr_C,               /// Device array of pointers to C matrices
+
+  NumericTypeID element_D,                  /// Data type of D matrix
+  LayoutTypeID layout_D,                    /// Layout of D matrix
+  void * const * ptr_D,                     /// Device array of pointers to D matrices
+
+  int64_t const *ldc                        /// Host array of leading dimensions of C and D matrices
+) {
+
+  if (problem_count <= 0 || !problem_sizes_host || !problem_sizes) {
+    return cutlass::Status::kErrorInvalidProblem;
+  }
+
+  //
+  // Find the operation
+  //
+
+  GemmFunctionalKey key(
+    provider_,
+    GemmKind::kGrouped,
+    element_compute,
+    element_scalar,
+    element_A,
+    layout_A,
+    transform_A,
+    element_B,
+    layout_B,
+    transform_B,
+    element_C,
+    layout_C,
+    element_D,
+    layout_D
+  );
+
+  //
+  // Compute the largest alignment restriction satisfied by every group. Pointers to each group's
+  // operands reside in device memory and are not checked.
+  //
+
+  // Maximum alignment expectation among all kernels (in units of bytes)
+  int const kMaximumAlignmentSize = 16;
+
+  int alignment = kMaximumAlignmentSize * 8;
+  int total_m = 0;
+  int max_n = 0;
+  int max_k = 0;
+
+  for (int group_idx = 0; group_idx < problem_count; ++group_idx) {
+    int M = cute::get<0>(problem_sizes_host[group_idx]);
+    int N = cute::get<1>(problem_sizes_host[group_idx]);
+    int K = cute::get<2>(problem_sizes_host[group_idx]);
+
+    alignment = std::min(alignment, gemm_problem_alignment(
+      M, N, K,
+      element_A, nullptr, lda[group_idx], 0,
+      element_B, nullptr, ldb[group_idx], 0,
+      element_C, nullptr, ldc[group_idx], 0,
+      nullptr, ldc[group_idx], 0, kMaximumAlignmentSize
+    ));
+
+    total_m += M;
+    max_n = std::max(max_n, N);
+    max_k = std::max(max_k, K);
+  }
+
+  std::vector<Operation const *> const *operations =
+    Singleton::get().operation_table.find_gemm_operations(key, compute_capability(), alignment);
+
+  if (!operations) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  // Problem sizes are only passed in the CUTLASS 3.x form
+  std::vector<Operation const *> candidates;
+  for (auto const *op : *operations) {
+    if (op->description().tile_description.minimum_compute_capability >= 90) {
+      candidates.push_back(op);
+    }
+  }
+
+  if (candidates.empty()) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  //
+  // Configure operation
+  //
+
+  std::vector<int64_t> lda_host(lda, lda + problem_count);
+  std::vector<int64_t> ldb_host(ldb, ldb + problem_count);
+  std::vector<int64_t> ldc_host(ldc, ldc + problem_count);
+
+  auto *problem_sizes_3x_host = const_cast<cute::Shape<int, int, int> *>(problem_sizes_host);
+
+  GemmGroupedConfiguration configuration{
+    problem_count,
+    lda_host.data(),
+    ldb_host.data(),
+    ldc_host.data(),
+    problem_sizes_3x_host
+  };
+
+  GemmGroupedArguments arguments{};
+
+  arguments.problem_count = problem_count;
+  arguments.ptr_A = const_cast<void const **>(ptr_A);
+  arguments.ptr_B = const_cast<void const **>(ptr_B);
+  arguments.ptr_C = const_cast<void const **>(ptr_C);
+  arguments.ptr_D = const_cast<void **>(ptr_D);
+  arguments.alpha = alpha;
+  arguments.beta = beta;
+  arguments.pointer_mode = scalar_pointer_mode_;
+  arguments.sm_count = sm_count_;
+  arguments.cluster_shape = {cluster_m, cluster_n, cluster_k};
+  arguments.cluster_shape_fallback = {cluster_m_fallback, cluster_n_fallback, cluster_k_fallback};
+  arguments.problem_sizes_3x = const_cast<cute::Shape<int, int, int> *>(problem_sizes);
+  arguments.problem_sizes_3x_host = problem_sizes_3x_host;
+  arguments.max_problem_size_3x = {total_m, max_n, max_k};
+
+  // Groups share one autotuning decision per bucket of their combined extent and group count
+  std::stringstream autotune_key;
+  autotune_key << to_string(GemmAutotuneKey(key, compute_capability(), alignment, total_m, max_n, max_k))
+    << ":groups" << GemmAutotuneKey::bucket(problem_count);
+
+  // Timing candidates overwrites D, so in-place problems only consume cached selections. The
+  // per-group pointers reside in device memory and are not compared.
+  return select_and_run(
+    "grouped_gemm",
+    candidates,
+    autotune_key.str(),
+    static_cast<void const *>(ptr_C) != static_cast<void const *>(ptr_D),
+    true,
+    {total_m, max_n, max_k},
+    1,
+    &configuration,
+    &arguments,
+    arguments.use_pdl,
+    &arguments.cluster_shape,
+    &arguments.cluster_shape_fallback);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Executes a block-scaled GEMM computation
+Status Handle::block_scaled_gemm(
+
+  GemmUniversalMode mode,                   /// indicates the mode in which the kUniversal GEMM is launched
+
+  int M,                                    /// GEMM M dimension
+  int N,                                    /// GEMM N dimension
+  int K,                                    /// GEMM K dimension
+
+  int cluster_m,                            /// cluster shape M dimension
+  int cluster_n,                            /// cluster shape N dimension
+  int cluster_k,                            /// cluster shape K dimension
+  int cluster_m_fallback,                   /// Fallback cluster shape M dimension
+  int cluster_n_fallback,                   /// Fallback cluster shape N dimension
+  int cluster_k_fallback,                   /// Fallback cluster shape K dimension
+
+  NumericTypeID element_compute,            /// Data type of internal accumulation
+
+  NumericTypeID element_scalar,             /// Data type of alpha/beta scalars
+
+  void const *alpha,                        /// Pointer to alpha scalar
+
+  NumericTypeID element_A,                  /// Data type of A matrix elements
+  LayoutTypeID layout_A,                    /// Layout of A matrix
+  void const * ptr_A,                       /// Pointer to A matrix in Global Memory
+  int64_t lda,                              /// Leading dimension of A matrix
+  NumericTypeID element_SFA,                /// Data type of A scale factors
+  void const * ptr_SFA,                     /// Pointer to A scale factors
+
+  NumericTypeID element_B,                  /// Data type of B matrix elements
+  LayoutTypeID layout_B,                    /// Layout of B matrix
+  void const * ptr_B,                       /// Pointer to B matrix in Global Memory
+  int64_t ldb,                              /// Leading dimension of B matrix
+  NumericTypeID element_SFB,                /// Data type of B scale factors
+  void const * ptr_SFB,                     /// Pointer to B scale factors
+
+  int sf_vec_size,                          /// Number of K elements sharing one scale factor
+
+  void const * beta,                        /// Pointer to beta scalar
+
+  NumericTypeID element_C,                  /// Data type of C matrix
+  LayoutTypeID layout_C,                    /// Layout of C matrix
+  void const * ptr_C,                       /// Pointer to C matrix
+  int64_t ldc,                              /// Leading dimension of C matrix
+
+  NumericTypeID element_D,                  /// Data type of D matrix
+  LayoutTypeID layout_D,                    /// Layout of D matrix
+  void * ptr_D,                             /// Pointer to D matrix
+  int64_t ldd,                              /// Leading dimension of D matrix
+
+  NumericTypeID element_SFD,                /// Data type of generated D scale factors
+  LayoutTypeID layout_SFD,                  /// Layout of generated D scale factors
+  void * ptr_SFD,                           /// Pointer to generated D scale factors (may be null if none are generated)
+  int epilogue_sf_vec_size,                 /// Number of D elements sharing one generated scale factor
+  void const * norm_constant,               /// Pointer to the normalization constant used to generate SFD
+
+  int batch_count,                          /// Batch count or number of split-K slices
+
+  int64_t batch_stride_A,                   /// Batch stride of A operand
+  int64_t batch_stride_B,                   /// Batch stride of B operand
+  int64_t batch_stride_C,                   /// Batch stride of C operand
+  int64_t batch_stride_D                    /// Batch stride of D operand
+) {
+
+  //
+  // Find the operation
+  //
+
+  BlockScaledGemmFunctionalKey key(
+    provider_,
+    GemmKind::kUniversal,
+    OperationKind::kBlockScaledGemm,
+    element_compute,
+    element_scalar,
+    element_A,
+    layout_A,
+    element_SFA,
+    element_B,
+    layout_B,
+    element_SFB,
+    element_C,
+    layout_C,
+    element_D,
+    layout_D,
+    element_SFD,
+    layout_SFD,
+    sf_vec_size,
+    epilogue_sf_vec_size
+  );
+
+  //
+  // Compute the largest alignment restriction the kernel can satisfy.
   //
 
-  GemmPreferenceKey preference_key(compute_capability(), alignment);
+  // Maximum alignment expectation among all kernels (in units of bytes)
+  int const kMaximumAlignmentSize = 16;
 
-  Operation const *operation = find_gemm_operation(operators_it, preference_key);
+  bool const is_array = (mode == GemmUniversalMode::kArray);
 
-  if (!operation) {
+  int alignment = gemm_problem_alignment(
+    M, N, K,
+    element_A, is_array ? nullptr : ptr_A, lda, 0,
+    element_B, is_array ? nullptr : ptr_B, ldb, 0,
+    element_C, is_array ? nullptr : ptr_C, ldc, 0,
+    is_array ? nullptr : ptr_D, ldd, 0, kMaximumAlignmentSize
+  );
+
+  std::vector<Operation const *> const *candidates =
+    Singleton::get().operation_table.find_block_scaled_gemm_operations(key, compute_capability(), alignment);
+
+  if (!candidates) {
     return cutlass::Status::kErrorNotSupported;
   }
 
-  last_operation_ = operation;
-
   //
   // Configure operation
   //
 
-  GemmConfiguration configuration{
+  GemmUniversalConfiguration configuration{
+    mode,
     {M, N, K},
+    {cluster_m, cluster_n, cluster_k},
+    {cluster_m_fallback, cluster_n_fallback, cluster_k_fallback},
+    batch_count,
     lda,
     ldb,
     ldc,
-    ldd,
-    1
+    ldd
   };
 
-  // Query host work space size
-  uint64_t host_workspace_size_needed = operation->get_host_workspace_size(&configuration);
-
-  if (uint64_t(kHostWorkspaceSize) < host_workspace_size_needed) {
-    return cutlass::Status::kErrorNotSupported;
-  }
-
-  char host_workspace[kHostWorkspaceSize];
-
-  // Query device workspace size
-  uint64_t device_workspace_size_needed = operation->get_device_workspace_size(&configuration);
-
-  if (uint64_t(workspace_size_) < device_workspace_size_needed) {
-    return cutlass::Status::kErrorNotSupported;
+  BlockScaledGemmArguments arguments;
+
+  arguments.problem_size = {M, N, K};
+  arguments.cluster_shape = {cluster_m, cluster_n, cluster_k};
+  arguments.cluster_shape_fallback = {cluster_m_fallback, cluster_n_fallback, cluster_k_fallback};
+  arguments.batch_count = batch_count;
+  arguments.A = ptr_A;
+  arguments.B = ptr_B;
+  arguments.SFA = ptr_SFA;
+  arguments.SFB = ptr_SFB;
+  arguments.C = ptr_C;
+  arguments.D = ptr_D;
+  arguments.SFD = ptr_SFD;
+  arguments.alpha = alpha;
+  arguments.beta = beta;
+  arguments.pointer_mode = scalar_pointer_mode_;
+  arguments.sm_count = sm_count_;
+  arguments.lda = lda;
+  arguments.ldb = ldb;
+  arguments.ldc = ldc;
+  arguments.ldd = ldd;
+  arguments.batch_stride_A = batch_stride_A;
+  arguments.batch_stride_B = batch_stride_B;
+  arguments.batch_stride_C = batch_stride_C;
+  arguments.batch_stride_D = batch_stride_D;
+  arguments.norm_constant = norm_constant;
+
+  // As in gemm_universal(), only unbatched problems participate in autotuning
+  std::string autotune_key_string;
+  if (mode == GemmUniversalMode::kGemm && batch_count == 1) {
+    autotune_key_string = autotune_key(key, compute_capability(), alignment, M, N, K);
   }
 
-  // Initialize host and device workspaces
-  Status status = operation->initialize(
+  return select_and_run(
+    "block_scaled_gemm",
+    *candidates,
+    autotune_key_string,
+    ptr_C != ptr_D,
+    true,
+    {M, N, K},
+    batch_count,
     &configuration,
-    host_workspace,
-    workspace_,
-    stream_);
-
-  if (status != cutlass::Status::kSuccess) {
-    return status;
-  }
-
-  // Run the operator
-  GemmArguments arguments{
-    ptr_A,
-    ptr_B,
-    ptr_C,
-    ptr_D,
-    alpha,
-    beta,
-    scalar_pointer_mode_
-  };
-
-  return operation->run(&arguments, host_workspace, workspace_, stream_);
+    &arguments,
+    arguments.use_pdl,
+    &arguments.cluster_shape,
+    &arguments.cluster_shape_fallback);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
-/// Executes a GEMM computation: D <= alpha * A*B + beta * C.
-//
-// Supports batched-strided, batched array or split-K serial or split-K parallel.
-//
-Status Handle::gemm_universal(
+/// Executes a blockwise-scaled GEMM computation
+Status Handle::blockwise_gemm(
 
   GemmUniversalMode mode,                   /// indicates the mode in which the kUniversal GEMM is launched
 
   int M,                                    /// GEMM M dimension
   int N,                                    /// GEMM N dimension
   int K,                                    /// GEMM K dimension
-  
+
   int cluster_m,                            /// cluster shape M dimension
   int cluster_n,                            /// cluster shape N dimension
   int cluster_k,                            /// cluster shape K dimension
   int cluster_m_fallback,                   /// Fallback cluster shape M dimension
   int cluster_n_fallback,                   /// Fallback cluster shape N dimension
   int cluster_k_fallback,                   /// Fallback cluster shape K dimension
-  
 
   NumericTypeID element_compute,            /// Data type of internal accumulation
 
@@ -530,20 +2069,26 @@ Status Handle::gemm_universal(
 
   NumericTypeID element_A,                  /// Data type of A matrix elements
   LayoutTypeID layout_A,                    /// Layout of A matrix
-  ComplexTransform transform_A,             /// Complex transformation applied to A matrix - ignored for real-valued matrices
   void const * ptr_A,                       /// Pointer to A matrix in Global Memory
   int64_t lda,                              /// Leading dimension of A matrix
+  NumericTypeID element_SFA,                /// Data type of A scale factors
+  void const * ptr_SFA,                     /// Pointer to A scale factors
 
   NumericTypeID element_B,                  /// Data type of B matrix elements
   LayoutTypeID layout_B,                    /// Layout of B matrix
-  ComplexTransform transform_B,             /// Complex transformation applied to B matrix - ignored for real-valued matrices
   void const * ptr_B,                       /// Pointer to B matrix in Global Memory
   int64_t ldb,                              /// Leading dimension of B matrix
+  NumericTypeID element_SFB,                /// Data type of B scale factors
+  void const * ptr_SFB,                     /// Pointer to B scale factors
+
+  int sf_m_vec_size,                        /// Number of M elements sharing one scale factor of A
+  int sf_n_vec_size,                        /// Number of N elements sharing one scale factor of B
+  int sf_k_vec_size,                        /// Number of K elements sharing one scale factor
 
   void const * beta,                        /// Pointer to beta scalar
 
   NumericTypeID element_C,                  /// Data type of C matrix
-  LayoutTypeID layout_C,                    /// Layout of D matrix
+  LayoutTypeID layout_C,                    /// Layout of C matrix
   void const * ptr_C,                       /// Pointer to C matrix
   int64_t ldc,                              /// Leading dimension of C matrix
 
@@ -564,33 +2109,27 @@ Status Handle::gemm_universal(
   // Find the operation
   //
 
-  GemmFunctionalKey key(
+  BlockwiseGemmFunctionalKey key(
     provider_,
     GemmKind::kUniversal,
+    OperationKind::kBlockwiseGemm,
     element_compute,
     element_scalar,
     element_A,
     layout_A,
-    transform_A,
+    element_SFA,
     element_B,
     layout_B,
-    transform_B,
+    element_SFB,
     element_C,
     layout_C,
     element_D,
-    layout_D
+    layout_D,
+    sf_m_vec_size,
+    sf_n_vec_size,
+    sf_k_vec_size
   );
 
-  auto operators_it = Singleton::get().operation_table.gemm_operations.find(key);
-
-  if (operators_it == Singleton::get().operation_table.gemm_operations.end()) {
-    return cutlass::Status::kErrorNotSupported;
-  }
-
-  if (operators_it->second.empty()) {
-    return cutlass::Status::kErrorNotSupported;
-  }
-
   //
   // Compute the largest alignment restriction the kernel can satisfy.
   //
@@ -598,42 +2137,23 @@ Status Handle::gemm_universal(
   // Maximum alignment expectation among all kernels (in units of bytes)
   int const kMaximumAlignmentSize = 16;
 
-  void const *ptr_A_check = ptr_A;
-  void const *ptr_B_check = ptr_B;
-  void const *ptr_C_check = ptr_C;
-  void *      ptr_D_check = ptr_D;
-
-  // Ignore alignment of pointers to pointers. We can't check this from the host,
-  // as each batch index has its own pointer in device memory.
-  if (mode == GemmUniversalMode::kArray) {
-    ptr_A_check = nullptr;
-    ptr_B_check = nullptr;
-    ptr_C_check = nullptr;
-    ptr_D_check = nullptr;
-  }
+  bool const is_array = (mode == GemmUniversalMode::kArray);
 
   int alignment = gemm_problem_alignment(
     M, N, K,
-    element_A, ptr_A_check, lda, 0,
-    element_B, ptr_B_check, ldb, 0,
-    element_C, ptr_C_check, ldc, 0,
-    ptr_D_check, ldd, 0, kMaximumAlignmentSize
+    element_A, is_array ? nullptr : ptr_A, lda, 0,
+    element_B, is_array ? nullptr : ptr_B, ldb, 0,
+    element_C, is_array ? nullptr : ptr_C, ldc, 0,
+    is_array ? nullptr : ptr_D, ldd, 0, kMaximumAlignmentSize
   );
 
-  //
-  // Find the best kernel in descending order of preference.
-  //
-
-  GemmPreferenceKey preference_key(compute_capability(), alignment);
-
-  Operation const *operation = find_gemm_operation(operators_it, preference_key);
+  std::vector<Operation const *> const *candidates =
+    Singleton::get().operation_table.find_blockwise_gemm_operations(key, compute_capability(), alignment);
 
-  if (!operation) {
+  if (!candidates) {
     return cutlass::Status::kErrorNotSupported;
   }
 
-  last_operation_ = operation;
-
   //
   // Configure operation
   //
@@ -641,8 +2161,8 @@ Status Handle::gemm_universal(
   GemmUniversalConfiguration configuration{
     mode,
     {M, N, K},
-    {cluster_m, cluster_n, cluster_k}, 
-    {cluster_m_fallback, cluster_n_fallback, cluster_k_fallback}, 
+    {cluster_m, cluster_n, cluster_k},
+    {cluster_m_fallback, cluster_n_fallback, cluster_k_fallback},
     batch_count,
     lda,
     ldb,
@@ -650,58 +2170,323 @@ Status Handle::gemm_universal(
     ldd
   };
 
-  // Query host work space size
-  uint64_t host_workspace_size_needed = operation->get_host_workspace_size(&configuration);
+  BlockwiseGemmArguments arguments;
+
+  arguments.problem_size = {M, N, K};
+  arguments.cluster_shape = {cluster_m, cluster_n, cluster_k};
+  arguments.cluster_shape_fallback = {cluster_m_fallback, cluster_n_fallback, cluster_k_fallback};
+  arguments.batch_count = batch_count;
+  arguments.A = ptr_A;
+  arguments.B = ptr_B;
+  arguments.SFA = ptr_SFA;
+  arguments.SFB = ptr_SFB;
+  arguments.C = ptr_C;
+  arguments.D = ptr_D;
+  arguments.alpha = alpha;
+  arguments.beta = beta;
+  arguments.pointer_mode = scalar_pointer_mode_;
+  arguments.sm_count = sm_count_;
+  arguments.lda = lda;
+  arguments.ldb = ldb;
+  arguments.ldc = ldc;
+  arguments.ldd = ldd;
+  arguments.batch_stride_A = batch_stride_A;
+  arguments.batch_stride_B = batch_stride_B;
+  arguments.batch_stride_C = batch_stride_C;
+  arguments.batch_stride_D = batch_stride_D;
+  arguments.sf_m_vec_size = sf_m_vec_size;
+  arguments.sf_n_vec_size = sf_n_vec_size;
+  arguments.sf_k_vec_size = sf_k_vec_size;
+
+  // As in gemm_universal(), only unbatched problems participate in autotuning
+  std::string autotune_key_string;
+  if (mode == GemmUniversalMode::kGemm && batch_count == 1) {
+    autotune_key_string = autotune_key(key, compute_capability(), alignment, M, N, K);
+  }
 
-  if (uint64_t(kHostWorkspaceSize) < host_workspace_size_needed) {
+  return select_and_run(
+    "blockwise_gemm",
+    *candidates,
+    autotune_key_string,
+    ptr_C != ptr_D,
+    true,
+    {M, N, K},
+    batch_count,
+    &configuration,
+    &arguments,
+    arguments.use_pdl,
+    &arguments.cluster_shape,
+    &arguments.cluster_shape_fallback);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Executes a two dimensional convolution
+Status Handle::conv2d(
+
+  ConvKind conv_kind,                       /// Convolutional operator (fprop, dgrad, wgrad)
+  conv::Conv2dProblemSize const &problem_size, /// Convolution problem size
+
+  NumericTypeID element_compute,            /// Data type of internal accumulation
+
+  NumericTypeID element_scalar,             /// Data type of alpha/beta scalars
+
+  void const *alpha,                        /// Pointer to alpha scalar
+
+  NumericTypeID element_A,                  /// Data type of A tensor elements
+  LayoutTypeID layout_A,                    /// Layout of A tensor
+  void const * ptr_A,                       /// Pointer to A tensor in Global Memory
+
+  NumericTypeID element_B,                  /// Data type of B tensor elements
+  LayoutTypeID layout_B,                    /// Layout of B tensor
+  void const * ptr_B,                       /// Pointer to B tensor in Global Memory
+
+  void const * beta,                        /// Pointer to beta scalar
+
+  NumericTypeID element_C,                  /// Data type of C and D tensors
+  LayoutTypeID layout_C,                    /// Layout of C and D tensors
+  void const * ptr_C,                       /// Pointer to C tensor
+
+  void * ptr_D                              /// Pointer to D tensor
+) {
+
+  // Strides are computed for packed tensors only
+  if (layout_A != LayoutTypeID::kTensorNHWC ||
+    layout_B != LayoutTypeID::kTensorNHWC ||
+    layout_C != LayoutTypeID::kTensorNHWC) {
     return cutlass::Status::kErrorNotSupported;
   }
 
-  char host_workspace[kHostWorkspaceSize];
+  //
+  // Find the operation
+  //
 
-  GemmUniversalArguments arguments{
-    {M, N, K},
-    {cluster_m, cluster_n, cluster_k}, 
-    {cluster_m_fallback, cluster_n_fallback, cluster_k_fallback}, 
-    batch_count,
-    ptr_A,
-    ptr_B,
-    ptr_C,
-    ptr_D,
-    alpha,
-    beta,
-    scalar_pointer_mode_,
-    lda,
-    ldb,
-    ldc,
-    ldd,
-    batch_stride_A,
-    batch_stride_B,
-    batch_stride_C,
-    batch_stride_D
-  };
+  ConvFunctionalKey key(
+    provider_,
+    conv_kind,
+    element_A,
+    layout_A,
+    element_B,
+    layout_B,
+    element_C,
+    layout_C,
+    element_compute,
+    element_scalar
+  );
 
-  // Query device workspace size
-  uint64_t device_workspace_size_needed = operation->get_device_workspace_size(&configuration, &arguments);
+  std::vector<Operation const *> candidates =
+    Singleton::get().operation_table.find_conv_operations(OperationKind::kConv2d, key, compute_capability());
 
-  if (uint64_t(workspace_size_) < device_workspace_size_needed) {
+  if (candidates.empty()) {
     return cutlass::Status::kErrorNotSupported;
   }
 
-  // Initialize host and device workspaces
-  Status status = operation->initialize(
+  //
+  // Configure operation
+  //
+
+  conv::Conv2dProblemSize const &p = problem_size;
+
+  std::vector<int64_t> stride_activations = {
+    int64_t(p.C),
+    int64_t(p.W) * p.C,
+    int64_t(p.H) * p.W * p.C
+  };
+
+  std::vector<int64_t> stride_filters = {
+    int64_t(p.C / p.groups),
+    int64_t(p.S) * (p.C / p.groups),
+    int64_t(p.R) * p.S * (p.C / p.groups)
+  };
+
+  std::vector<int64_t> stride_output = {
+    int64_t(p.K),
+    int64_t(p.Q) * p.K,
+    int64_t(p.P) * p.Q * p.K
+  };
+
+  Conv2dConfiguration configuration;
+
+  configuration.split_k_mode = conv::SplitKMode::kSerial;
+  configuration.problem_size = problem_size;
+
+  switch (conv_kind) {
+    case ConvKind::kFprop:
+      configuration.stride_a = stride_activations;
+      configuration.stride_b = stride_filters;
+      configuration.stride_c = stride_output;
+      break;
+    case ConvKind::kDgrad:
+      configuration.stride_a = stride_output;
+      configuration.stride_b = stride_filters;
+      configuration.stride_c = stride_activations;
+      break;
+    case ConvKind::kWgrad:
+      configuration.stride_a = stride_output;
+      configuration.stride_b = stride_activations;
+      configuration.stride_c = stride_filters;
+      break;
+    default:
+      return cutlass::Status::kErrorInvalidProblem;
+  }
+
+  ConvArguments arguments;
+
+  arguments.A = ptr_A;
+  arguments.B = ptr_B;
+  arguments.C = ptr_C;
+  arguments.D = ptr_D;
+  arguments.alpha = alpha;
+  arguments.beta = beta;
+  arguments.pointer_mode = scalar_pointer_mode_;
+
+  // Convolutions are not ranked by the GEMM cost model and are autotuned per exact problem size.
+  // Timing candidates overwrites D, so in-place problems only consume cached selections.
+  return select_and_run(
+    "conv2d",
+    candidates,
+    autotune_key(key, compute_capability(), problem_size),
+    ptr_C != ptr_D,
+    false,
+    {},
+    1,
     &configuration,
-    host_workspace,
-    workspace_,
-    stream_);
+    &arguments,
+    arguments.use_pdl);
+}
 
-  if (status != cutlass::Status::kSuccess) {
-    return status;
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Executes a three dimensional convolution
+Status Handle::conv3d(
+
+  ConvKind conv_kind,                       /// Convolutional operator (fprop, dgrad, wgrad)
+  conv::Conv3dProblemSize const &problem_size, /// Convolution problem size
+
+  NumericTypeID element_compute,            /// Data type of internal accumulation
+
+  NumericTypeID element_scalar,             /// Data type of alpha/beta scalars
+
+  void const *alpha,                        /// Pointer to alpha scalar
+
+  NumericTypeID element_A,                  /// Data type of A tensor elements
+  LayoutTypeID layout_A,                    /// Layout of A tensor
+  void const * ptr_A,                       /// Pointer to A tensor in Global Memory
+
+  NumericTypeID element_B,                  /// Data type of B tensor elements
+  LayoutTypeID layout_B,                    /// Layout of B tensor
+  void const * ptr_B,                       /// Pointer to B tensor in Global Memory
+
+  void const * beta,                        /// Pointer to beta scalar
+
+  NumericTypeID element_C,                  /// Data type of C and D tensors
+  LayoutTypeID layout_C,                    /// Layout of C and D tensors
+  void const * ptr_C,                       /// Pointer to C tensor
+
+  void * ptr_D                              /// Pointer to D tensor
+) {
+
+  // Strides are computed for packed tensors only
+  if (layout_A != LayoutTypeID::kTensorNDHWC ||
+    layout_B != LayoutTypeID::kTensorNDHWC ||
+    layout_C != LayoutTypeID::kTensorNDHWC) {
+    return cutlass::Status::kErrorNotSupported;
   }
 
-  // Run the operator
+  if (conv_kind != ConvKind::kFprop && conv_kind != ConvKind::kDgrad && conv_kind != ConvKind::kWgrad) {
+    return cutlass::Status::kErrorInvalidProblem;
+  }
+
+  //
+  // Find the operation
+  //
+
+  ConvFunctionalKey key(
+    provider_,
+    conv_kind,
+    element_A,
+    layout_A,
+    element_B,
+    layout_B,
+    element_C,
+    layout_C,
+    element_compute,
+    element_scalar
+  );
+
+  std::vector<Operation const *> candidates =
+    Singleton::get().operation_table.find_conv_operations(OperationKind::kConv3d, key, compute_capability());
+
+  if (candidates.empty()) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  //
+  // Configure operation
+  //
+
+  conv::Conv3dProblemSize const &p = problem_size;
+
+  Conv3dConfiguration configuration;
+
+  configuration.split_k_mode = conv::SplitKMode::kSerial;
+  configuration.problem_size = problem_size;
+  configuration.layout_activations = layout::TensorNDHWC::packed({p.N, p.D, p.H, p.W, p.C});
+  configuration.layout_filters = layout::TensorNDHWC::packed({p.K, p.T, p.R, p.S, p.C});
+  configuration.layout_output = layout::TensorNDHWC::packed({p.N, p.Z, p.P, p.Q, p.K});
+  configuration.layout_source = configuration.layout_output;
+
+  ConvArguments arguments;
+
+  arguments.A = ptr_A;
+  arguments.B = ptr_B;
+  arguments.C = ptr_C;
+  arguments.D = ptr_D;
+  arguments.alpha = alpha;
+  arguments.beta = beta;
+  arguments.pointer_mode = scalar_pointer_mode_;
+
+  // Convolutions are not ranked by the GEMM cost model and are autotuned per exact problem size.
+  // Timing candidates overwrites D, so in-place problems only consume cached selections.
+  return select_and_run(
+    "conv3d",
+    candidates,
+    autotune_key(key, compute_capability(), problem_size),
+    ptr_C != ptr_D,
+    false,
+    {},
+    1,
+    &configuration,
+    &arguments,
+    arguments.use_pdl);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Prepacks the filter of a two dimensional convolution
+Status Handle::prepack_conv2d_filter(
+  void const *&packed,
+  void const *filter,
+  uint64_t version,
+  NumericTypeID element,
+  conv::Conv2dProblemSize const &problem_size) {
+
+  conv::Conv2dProblemSize const &p = problem_size;
+  return filter_cache_->get(
+    packed, filter, version, element, {p.K, p.R, p.S, p.C / p.groups}, stream_);
+}
 
-  return operation->run(&arguments, host_workspace, workspace_, stream_);
+/// Prepacks the filter of a three dimensional convolution
+Status Handle::prepack_conv3d_filter(
+  void const *&packed,
+  void const *filter,
+  uint64_t version,
+  NumericTypeID element,
+  conv::Conv3dProblemSize const &problem_size) {
+
+  conv::Conv3dProblemSize const &p = problem_size;
+  return filter_cache_->get(
+    packed, filter, version, element, {p.K, p.T, p.R, p.S, p.C / p.groups}, stream_);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -787,16 +2572,6 @@ Status Handle::gemm_planar_complex(
     LayoutTypeID::kColumnMajor
   );
 
-  auto operators_it = Singleton::get().operation_table.gemm_operations.find(key);
-
-  if (operators_it == Singleton::get().operation_table.gemm_operations.end()) {
-    return cutlass::Status::kErrorNotSupported;
-  }
-
-  if (operators_it->second.empty()) {
-    return cutlass::Status::kErrorNotSupported;
-  }
-
   //
   // Compute the largest alignment restriction the kernel can satisfy.
   //
@@ -825,14 +2600,15 @@ Status Handle::gemm_planar_complex(
   // Find the best kernel in descending order of preference.
   //
 
-  GemmPreferenceKey preference_key(compute_capability(), alignment);
+  std::vector<Operation const *> const *candidates =
+    Singleton::get().operation_table.find_gemm_operations(key, compute_capability(), alignment);
 
-  Operation const *operation = find_gemm_operation(operators_it, preference_key);
-
-  if (!operation) {
+  if (!candidates) {
     return cutlass::Status::kErrorNotSupported;
   }
 
+  Operation const *operation = candidates->front();
+
   last_operation_ = operation;
 
   //
@@ -865,7 +2641,9 @@ Status Handle::gemm_planar_complex(
   // Query device workspace size
   uint64_t device_workspace_size_needed = operation->get_device_workspace_size(&configuration);
 
-  if (uint64_t(workspace_size_) < device_workspace_size_needed) {
+  void *device_workspace = acquire_workspace(device_workspace_size_needed);
+
+  if (device_workspace_size_needed && !device_workspace) {
     return cutlass::Status::kErrorNotSupported;
   }
 
@@ -873,7 +2651,7 @@ Status Handle::gemm_planar_complex(
   Status status = operation->initialize(
     &configuration,
     host_workspace,
-    workspace_,
+    device_workspace,
     stream_);
 
   if (status != cutlass::Status::kSuccess) {
@@ -903,7 +2681,10 @@ Status Handle::gemm_planar_complex(
     batch_stride_D_imag
   };
 
-  return operation->run(&arguments, host_workspace, workspace_, stream_);
+  arguments.use_pdl = launch_with_pdl(operation);
+  return run_operation(
+    operation, &arguments, host_workspace, device_workspace, "gemm_planar_complex", {M, N, K}, batch_count,
+    arguments.use_pdl);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -984,16 +2765,6 @@ Status Handle::gemm_planar_complex_array(
     LayoutTypeID::kColumnMajor
   );
 
-  auto operators_it = Singleton::get().operation_table.gemm_operations.find(key);
-
-  if (operators_it == Singleton::get().operation_table.gemm_operations.end()) {
-    return cutlass::Status::kErrorNotSupported;
-  }
-
-  if (operators_it->second.empty()) {
-    return cutlass::Status::kErrorNotSupported;
-  }
-
   //
   // Compute the largest alignment restriction the kernel can satisfy.
   //
@@ -1022,14 +2793,15 @@ Status Handle::gemm_planar_complex_array(
   // Find the best kernel in descending order of preference.
   //
 
-  GemmPreferenceKey preference_key(compute_capability(), alignment);
+  std::vector<Operation const *> const *candidates =
+    Singleton::get().operation_table.find_gemm_operations(key, compute_capability(), alignment);
 
-  Operation const *operation = find_gemm_operation(operators_it, preference_key);
-
-  if (!operation) {
+  if (!candidates) {
     return cutlass::Status::kErrorNotSupported;
   }
 
+  Operation const *operation = candidates->front();
+
   last_operation_ = operation;
 
   //
@@ -1061,7 +2833,9 @@ Status Handle::gemm_planar_complex_array(
   // Query device workspace size
   uint64_t device_workspace_size_needed = operation->get_device_workspace_size(&configuration);
 
-  if (uint64_t(workspace_size_) < device_workspace_size_needed) {
+  void *device_workspace = acquire_workspace(device_workspace_size_needed);
+
+  if (device_workspace_size_needed && !device_workspace) {
     return cutlass::Status::kErrorNotSupported;
   }
 
@@ -1069,7 +2843,7 @@ Status Handle::gemm_planar_complex_array(
   Status status = operation->initialize(
     &configuration,
     host_workspace,
-    workspace_,
+    device_workspace,
     stream_);
 
   if (status != cutlass::Status::kSuccess) {
@@ -1092,7 +2866,10 @@ Status Handle::gemm_planar_complex_array(
     scalar_pointer_mode_
   };
 
-  return operation->run(&arguments, host_workspace, workspace_, stream_);
+  arguments.use_pdl = launch_with_pdl(operation);
+  return run_operation(
+    operation, &arguments, host_workspace, device_workspace, "gemm_planar_complex_array",
+    {expected_M, expected_N, expected_K}, batch_count, arguments.use_pdl);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1122,7 +2899,7 @@ Operation const* find_conv_operation_for_parallel_reduction(Operation const *ope
     conv_desc.element_epilogue);
 
   // conv operation table for conv2d or conv3d
-  auto conv_operations = (conv_desc.kind == OperationKind::kConv2d) ?
+  auto const &conv_operations = (conv_desc.kind == OperationKind::kConv2d) ?
                           Singleton::get().operation_table.conv2d_operations :
                           Singleton::get().operation_table.conv3d_operations;
 
@@ -1189,7 +2966,7 @@ Operation const* find_gemm_operation_for_parallel_reduction(Operation const *ope
     LayoutTypeID::kColumnMajor);
 
   // gemm operation table
-  auto gemm_operations = Singleton::get().operation_table.gemm_operations;
+  auto const &gemm_operations = Singleton::get().operation_table.gemm_operations;
 
   // find ConvFunctionalKey in gemm operation table
   auto operators_it = gemm_operations.find(key);
@@ -62,6 +62,48 @@ namespace library {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Queries the attributes and occupancy of a kernel function on the current device
+inline Status query_kernel_resources(
+  KernelResourceDescription &resources,
+  void const *kernel,
+  int threads_per_cta,
+  int dynamic_smem_bytes,
+  int cluster_size) {
+
+  cudaFuncAttributes attributes;
+  if (cudaFuncGetAttributes(&attributes, kernel) != cudaSuccess) {
+    (void)cudaGetLastError();
+    return Status::kErrorInternal;
+  }
+
+  // Kernels using more than 48 KB of dynamic shared memory must opt in before querying occupancy
+  if (dynamic_smem_bytes >= (48 << 10) &&
+      cudaFuncSetAttribute(kernel, cudaFuncAttributeMaxDynamicSharedMemorySize, dynamic_smem_bytes) != cudaSuccess) {
+    (void)cudaGetLastError();
+    return Status::kErrorInternal;
+  }
+
+  int max_active_ctas = 0;
+  if (cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+        &max_active_ctas, kernel, threads_per_cta, dynamic_smem_bytes) != cudaSuccess) {
+    (void)cudaGetLastError();
+    return Status::kErrorInternal;
+  }
+
+  resources.valid = true;
+  resources.registers_per_thread = attributes.numRegs;
+  resources.static_smem_bytes = int(attributes.sharedSizeBytes);
+  resources.dynamic_smem_bytes = dynamic_smem_bytes;
+  resources.local_memory_bytes = int(attributes.localSizeBytes);
+  resources.threads_per_cta = threads_per_cta;
+  resources.max_active_ctas_per_sm = max_active_ctas;
+  resources.cluster_size = cluster_size;
+
+  return Status::kSuccess;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 template <typename T> struct NumericTypeMap;
 
 template <> struct NumericTypeMap<void> {
@@ -404,6 +446,10 @@ template <> struct IteratorAlgorithmMap<conv::IteratorAlgorithm::kFewChannels> {
   static IteratorAlgorithmID const kId = IteratorAlgorithmID::kFewChannels;
 };
 
+template <> struct IteratorAlgorithmMap<conv::IteratorAlgorithm::kWinograd> {
+  static IteratorAlgorithmID const kId = IteratorAlgorithmID::kWinograd;
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 template <typename Element, typename Layout>
@@ -35,7 +35,17 @@
     This is the root of the data structure containing CUTLASS objects
 */
 
+#include <cstdlib>
+#include <iostream>
 #include <memory>
+#include <string>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
 #include "cutlass/library/manifest.h"
 
 namespace cutlass {
@@ -53,6 +63,7 @@ Status Manifest::initialize() {
   if (!operations_.empty()) {
     operations_.clear();
   }
+  dispatch_table_.clear();
 
   // initialize procedurally generated cutlass op in manifest object
   initialize_all(*this);
@@ -63,7 +74,15 @@ Status Manifest::initialize() {
   // initialize manually instanced reduction reference op in manifest object
   initialize_all_reduction_op(*this);
 
-  return Status::kSuccess;
+#if defined(CUTLASS_LIBRARY_DISTRIBUTED_GEMM_ENABLED)
+  // initialize manually instanced distributed gemm ops, enabled with CUTLASS_LIBRARY_DISTRIBUTED_GEMM
+  initialize_all_distributed_gemm_operations(*this);
+#endif
+
+  initialize_kernel_resources(0);
+
+  // append operations built outside of the library, such as exported CuTe DSL kernels
+  return load_external_operations();
 }
 
 /// Used for initialization
@@ -74,9 +93,155 @@ void Manifest::reserve(size_t operation_count) {
 /// Graceful shutdown
 Status Manifest::release() {
   operations_.clear();
+  dispatch_table_.clear();
   return Status::kSuccess;
 }
 
+/// Prebuilt operation selections
+DispatchTable const &Manifest::dispatch_table() const {
+  return dispatch_table_;
+}
+
+/// Returns true if operations requiring min_cc may run on a device of compute capability cc.
+/// Kernels for SM90 and later are built for architecture-specific feature sets and only run on
+/// devices of the same major architecture.
+static bool shard_is_compatible(int min_cc, int cc) {
+  if (min_cc > cc) {
+    return false;
+  }
+  if (min_cc >= 90) {
+    return (min_cc / 10) == (cc / 10);
+  }
+  return true;
+}
+
+/// Returns the directory from which shards are loaded: $CUTLASS_LIBRARY_SHARD_PATH if set,
+/// otherwise the directory containing this library.
+static std::string shard_directory() {
+
+  char const *env = std::getenv("CUTLASS_LIBRARY_SHARD_PATH");
+  if (env && *env) {
+    return std::string(env) + "/";
+  }
+
+#if !defined(_WIN32)
+  Dl_info info;
+  if (dladdr(reinterpret_cast<void *>(&shard_is_compatible), &info) && info.dli_fname) {
+    std::string path(info.dli_fname);
+    size_t pos = path.find_last_of('/');
+    if (pos != std::string::npos) {
+      return path.substr(0, pos + 1);
+    }
+  }
+#endif
+
+  return std::string();
+}
+
+/// Loads a shard library and appends its operations if they may run on the current device
+Status Manifest::load_shard(ManifestShard const &shard) {
+
+  // Querying device attributes does not load any modules, so CUDA lazy loading is preserved
+  if (compute_capability_ < 0) {
+    int device_idx = 0;
+    int major = 0;
+    int minor = 0;
+    if (cudaGetDevice(&device_idx) != cudaSuccess ||
+      cudaDeviceGetAttribute(&major, cudaDevAttrComputeCapabilityMajor, device_idx) != cudaSuccess ||
+      cudaDeviceGetAttribute(&minor, cudaDevAttrComputeCapabilityMinor, device_idx) != cudaSuccess) {
+      return Status::kErrorInternal;
+    }
+    compute_capability_ = major * 10 + minor;
+  }
+
+  if (!shard_is_compatible(shard.min_compute_capability, compute_capability_)) {
+    return Status::kSuccess;
+  }
+
+#if defined(_WIN32)
+  std::string path = shard_directory() + shard.library_name + ".dll";
+#else
+  std::string path = shard_directory() + "lib" + shard.library_name + ".so";
+#endif
+
+  return load_library(path, shard.entry_point);
+}
+
+/// Loads the libraries listed in $CUTLASS_LIBRARY_EXTERNAL_OPERATIONS and appends their operations
+Status Manifest::load_external_operations() {
+
+  char const *env = std::getenv("CUTLASS_LIBRARY_EXTERNAL_OPERATIONS");
+  if (!env || !*env) {
+    return Status::kSuccess;
+  }
+
+#if defined(_WIN32)
+  char const separator = ';';
+#else
+  char const separator = ':';
+#endif
+
+  std::string paths(env);
+  size_t begin = 0;
+  while (begin <= paths.size()) {
+    size_t end = paths.find(separator, begin);
+    if (end == std::string::npos) {
+      end = paths.size();
+    }
+    if (end > begin) {
+      Status status = load_library(paths.substr(begin, end - begin), kExternalOperationsEntryPoint);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+    begin = end + 1;
+  }
+
+  return Status::kSuccess;
+}
+
+/// Opens the library at path and calls its entry point on this manifest
+Status Manifest::load_library(std::string const &path, char const *entry_point) {
+
+  using EntryPoint = void (*)(Manifest &);
+
+#if defined(_WIN32)
+  HMODULE handle = LoadLibraryA(path.c_str());
+  EntryPoint entry = handle ?
+    reinterpret_cast<EntryPoint>(GetProcAddress(handle, entry_point)) : nullptr;
+#else
+  void *handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+  EntryPoint entry = handle ?
+    reinterpret_cast<EntryPoint>(dlsym(handle, entry_point)) : nullptr;
+#endif
+
+  if (!entry) {
+    std::cerr << "CUTLASS Library: failed to load operations from " << path << std::endl;
+    return Status::kErrorInternal;
+  }
+
+  shard_handles_.push_back(reinterpret_cast<void *>(handle));
+
+  size_t first = operations_.size();
+  entry(*this);
+  initialize_kernel_resources(first);
+
+  return Status::kSuccess;
+}
+
+/// Queries each kernel once, so that dispatchers can compare occupancy and spills without launching
+void Manifest::initialize_kernel_resources(size_t first) {
+  if (std::getenv("CUTLASS_LIBRARY_SKIP_KERNEL_RESOURCES")) {
+    return;
+  }
+  for (size_t idx = first; idx < operations_.size(); ++idx) {
+    if (!operations_[idx]->description().resources.valid) {
+      // Operations without a queryable kernel, such as reference operations, leave resources invalid
+      operations_[idx]->initialize_kernel_resources();
+    }
+  }
+}
+
 /// Returns an iterator to the first operation
 OperationVector const & Manifest::operations() const {
   return operations_;
@@ -35,6 +35,7 @@
 */
 
 #include "cutlass/library/operation_table.h"
+#include "cutlass/library/util.h"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -297,6 +298,168 @@ void OperationTable::append(Manifest const &manifest) {
 
   }
 
+  build_gemm_operation_index();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Returns the maximum required alignment for each operator
+static int maximum_alignment_requirement(GemmDescription const &desc) {
+  return std::max(
+    std::max(desc.A.alignment, desc.B.alignment), desc.C.alignment);
+}
+
+/// Finds all kernels satisfying the preference key, in descending order of preference.
+static std::vector<Operation const *> find_gemm_operation_candidates(
+  GemmOperationVectorMap const &operations,
+  GemmPreferenceKey const preference_key) {
+
+  std::vector<Operation const *> candidates;
+
+  auto cc_it = operations.upper_bound(preference_key);
+
+  // Search in descending order of compute capability
+  while (cc_it != operations.begin()) {
+    --cc_it;
+
+    // Search tile sizes in order, for now.
+    for (auto const * op : cc_it->second) {
+
+      GemmDescription desc = gemm_operation_description(op->description());
+
+      int min_cc = desc.tile_description.minimum_compute_capability;
+      int max_cc = desc.tile_description.maximum_compute_capability;
+
+      int op_alignment = maximum_alignment_requirement(desc);
+
+      if ((min_cc <= preference_key.compute_capability) &&
+        (preference_key.compute_capability <= max_cc) &&
+        (op_alignment <= preference_key.alignment)) {
+
+        candidates.push_back(op);
+      }
+    }
+  }
+
+  return candidates;
+}
+
+/// Recomputes a selection index from a map of GEMM-like operations
+template <typename FunctionalMap, typename Index>
+static void build_gemm_operation_index(FunctionalMap const &operations, Index &index) {
+
+  index.clear();
+
+  for (auto const &functional_entry : operations) {
+
+    GemmOperationIndexEntry entry;
+
+    for (auto const &preference_entry : functional_entry.second) {
+      for (auto const *op : preference_entry.second) {
+        GemmDescription desc = gemm_operation_description(op->description());
+
+        entry.compute_capabilities.push_back(desc.tile_description.minimum_compute_capability);
+        entry.compute_capabilities.push_back(desc.tile_description.maximum_compute_capability + 1);
+        entry.alignments.push_back(maximum_alignment_requirement(desc));
+      }
+    }
+
+    for (auto *thresholds : {&entry.compute_capabilities, &entry.alignments}) {
+      std::sort(thresholds->begin(), thresholds->end());
+      thresholds->erase(std::unique(thresholds->begin(), thresholds->end()), thresholds->end());
+    }
+
+    entry.candidates.reserve(entry.compute_capabilities.size() * entry.alignments.size());
+
+    for (int cc : entry.compute_capabilities) {
+      for (int alignment : entry.alignments) {
+        entry.candidates.push_back(
+          find_gemm_operation_candidates(functional_entry.second, GemmPreferenceKey(cc, alignment)));
+      }
+    }
+
+    index.emplace(functional_entry.first, std::move(entry));
+  }
+}
+
+void OperationTable::build_gemm_operation_index() {
+  library::build_gemm_operation_index(gemm_operations, gemm_operation_index);
+  library::build_gemm_operation_index(block_scaled_gemm_operations, block_scaled_gemm_operation_index);
+  library::build_gemm_operation_index(blockwise_gemm_operations, blockwise_gemm_operation_index);
+}
+
+std::vector<Operation const *> const *OperationTable::find_gemm_operations(
+  GemmFunctionalKey const &key,
+  int compute_capability,
+  int alignment) const {
+
+  auto it = gemm_operation_index.find(key);
+
+  if (it == gemm_operation_index.end()) {
+    return nullptr;
+  }
+
+  return it->second.find(compute_capability, alignment);
+}
+
+std::vector<Operation const *> const *OperationTable::find_block_scaled_gemm_operations(
+  BlockScaledGemmFunctionalKey const &key,
+  int compute_capability,
+  int alignment) const {
+
+  auto it = block_scaled_gemm_operation_index.find(key);
+
+  if (it == block_scaled_gemm_operation_index.end()) {
+    return nullptr;
+  }
+
+  return it->second.find(compute_capability, alignment);
+}
+
+std::vector<Operation const *> const *OperationTable::find_blockwise_gemm_operations(
+  BlockwiseGemmFunctionalKey const &key,
+  int compute_capability,
+  int alignment) const {
+
+  auto it = blockwise_gemm_operation_index.find(key);
+
+  if (it == blockwise_gemm_operation_index.end()) {
+    return nullptr;
+  }
+
+  return it->second.find(compute_capability, alignment);
+}
+
+std::vector<Operation const *> OperationTable::find_conv_operations(
+  OperationKind kind,
+  ConvFunctionalKey const &key,
+  int compute_capability) const {
+
+  std::vector<Operation const *> candidates;
+
+  ConvOperationFunctionalMap const &operations =
+    (kind == OperationKind::kConv2d) ? conv2d_operations : conv3d_operations;
+
+  auto it = operations.find(key);
+
+  if (it == operations.end()) {
+    return candidates;
+  }
+
+  // Search in descending order of compute capability
+  for (auto cc_it = it->second.rbegin(); cc_it != it->second.rend(); ++cc_it) {
+    for (auto const *op : cc_it->second) {
+      TileDescription const &tile = op->description().tile_description;
+
+      if (tile.minimum_compute_capability <= compute_capability &&
+        compute_capability <= tile.maximum_compute_capability) {
+
+        candidates.push_back(op);
+      }
+    }
+  }
+
+  return candidates;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
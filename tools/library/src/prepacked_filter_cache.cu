@@ -0,0 +1,233 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Cache of convolution filters transformed once into the layout of the conv operations.
+*/
+
+#include <cstdint>
+#include <stdexcept>
+
+#include "cutlass/transform/kernel/filter_format_transformer.hpp"
+#include "cutlass/transform/device/transform_universal_adapter.hpp"
+
+#include "cutlass/library/prepacked_filter_cache.h"
+#include "cutlass/library/util.h"
+
+namespace cutlass {
+namespace library {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Transforms a CKTRS filter into KTRSC with vectorized accesses of AlignmentBytes, or of single
+/// elements if the channel count does not permit them. The transformation only moves elements, so
+/// it is instantiated per element width.
+template <int NumDimensions, int AlignmentBytes, class Element>
+Status transform_filter_aligned(
+  void *dst, void const *src, std::vector<int> const &extent, cudaStream_t stream) {
+
+  using namespace cutlass::transform::kernel;
+  using TransformKernel = ConvFilterFormatTransformer<
+    FilterFormat::CKTRS, FilterFormat::KTRSC, NumDimensions, Element, AlignmentBytes>;
+  using Transform = cutlass::transform::device::TransformUniversalAdapter<TransformKernel>;
+
+  typename TransformKernel::Arguments args;
+  args.src_ptr = src;
+  args.dst_ptr = dst;
+  for (int i = 0; i < NumDimensions; ++i) {
+    args.filter_extent[i] = extent[i];
+  }
+
+  if constexpr (AlignmentBytes > int(sizeof(Element))) {
+    if (Transform::can_implement(args) != Status::kSuccess) {
+      return transform_filter_aligned<NumDimensions, int(sizeof(Element)), Element>(dst, src, extent, stream);
+    }
+  }
+
+  Transform transform_op;
+  return transform_op.run(args, nullptr, stream);
+}
+
+template <int NumDimensions>
+Status transform_filter(
+  void *dst, void const *src, NumericTypeID element, std::vector<int> const &extent, cudaStream_t stream) {
+
+  switch (sizeof_bits(element)) {
+    case 8:  return transform_filter_aligned<NumDimensions, 16, uint8_t>(dst, src, extent, stream);
+    case 16: return transform_filter_aligned<NumDimensions, 16, uint16_t>(dst, src, extent, stream);
+    case 32: return transform_filter_aligned<NumDimensions, 16, uint32_t>(dst, src, extent, stream);
+    case 64: return transform_filter_aligned<NumDimensions, 16, uint64_t>(dst, src, extent, stream);
+    default: break;
+  }
+
+  // Sub-byte elements are not addressable individually by the transformation
+  return Status::kErrorNotSupported;
+}
+
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+PrepackedFilterCache::PrepackedFilterCache() {
+  cudaError_t error = cudaGetDevice(&device_idx_);
+  if (error != cudaSuccess) {
+    throw std::runtime_error("cudaGetDevice() failed");
+  }
+}
+
+PrepackedFilterCache::~PrepackedFilterCache() {
+
+  int device_before;
+  cudaGetDevice(&device_before);
+  if (device_before != device_idx_) {
+    cudaSetDevice(device_idx_);
+  }
+
+  for (auto &entry : entries_) {
+    cudaFree(entry.second.ptr);
+  }
+  entries_.clear();
+
+  if (device_before != device_idx_) {
+    cudaSetDevice(device_before);
+  }
+}
+
+Status PrepackedFilterCache::get(
+  void const *&packed,
+  void const *filter,
+  uint64_t version,
+  NumericTypeID element,
+  std::vector<int> const &extent,
+  cudaStream_t stream) {
+
+  packed = nullptr;
+
+  if (!filter || (extent.size() != 4 && extent.size() != 5)) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  size_t count = 1;
+  for (int e : extent) {
+    if (e <= 0) {
+      return Status::kErrorInvalidProblem;
+    }
+    count *= size_t(e);
+  }
+
+  size_t bytes = (count * sizeof_bits(element) + 7) / 8;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  Entry &entry = entries_[filter];
+
+  if (entry.ptr && entry.version == version && entry.element == element && entry.extent == extent) {
+    packed = entry.ptr;
+    return Status::kSuccess;
+  }
+
+  // A new version overwrites the previous copy in place if it fits. cudaFree() synchronizes the
+  // device, so an outgrown copy is not released while still being read.
+  if (entry.bytes < bytes) {
+    if (entry.ptr) {
+      cudaFree(entry.ptr);
+      entry = Entry{};
+    }
+    if (cudaMalloc(&entry.ptr, bytes) != cudaSuccess) {
+      entries_.erase(filter);
+      return Status::kErrorMemoryAllocation;
+    }
+    entry.bytes = bytes;
+  }
+
+  Status status = extent.size() == 4 ?
+    transform_filter<4>(entry.ptr, filter, element, extent, stream) :
+    transform_filter<5>(entry.ptr, filter, element, extent, stream);
+
+  if (status != Status::kSuccess) {
+    cudaFree(entry.ptr);
+    entries_.erase(filter);
+    return status;
+  }
+
+  entry.version = version;
+  entry.element = element;
+  entry.extent = extent;
+
+  packed = entry.ptr;
+  return Status::kSuccess;
+}
+
+void PrepackedFilterCache::invalidate(void const *filter) {
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  auto it = entries_.find(filter);
+  if (it == entries_.end()) {
+    return;
+  }
+
+  cudaFree(it->second.ptr);
+  entries_.erase(it);
+}
+
+void PrepackedFilterCache::clear() {
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  for (auto &entry : entries_) {
+    cudaFree(entry.second.ptr);
+  }
+  entries_.clear();
+}
+
+size_t PrepackedFilterCache::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size();
+}
+
+size_t PrepackedFilterCache::bytes() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t total = 0;
+  for (auto const &entry : entries_) {
+    total += entry.second.bytes;
+  }
+  return total;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
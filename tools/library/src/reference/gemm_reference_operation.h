@@ -237,6 +237,42 @@ public:
 
       return Status::kSuccess;
     }
+    else if (kProvider == Provider::kReferenceDevice && args.reference_sample_count > 0) {
+
+      cutlass::reference::device::GemmComplexSampled<
+        ElementA,
+        LayoutA,
+        ElementB,
+        LayoutB,
+        NonVoidElementC,
+        LayoutC,
+        ElementCompute,
+        ElementAccumulator,
+        ElementD,
+        ConvertOp,
+        InnerProductOp
+      >(
+        config.problem_size,
+        *static_cast<ElementCompute const *>(args.alpha),
+        ref_A,
+        kTransformA,
+        ref_B,
+        kTransformB,
+        *static_cast<ElementCompute const *>(args.beta),
+        ref_C,
+        ref_D,
+        ElementAccumulator(),
+        args.reference_sample_count,
+        args.reference_sample_seed,
+        ((config.mode == library::GemmUniversalMode::kBatched) ? config.batch_count : 1),
+        args.batch_stride_A,
+        args.batch_stride_B,
+        args.batch_stride_C,
+        args.batch_stride_D
+      );
+
+      return Status::kSuccess;
+    }
     else if (kProvider == Provider::kReferenceDevice) {
 
       cutlass::reference::device::GemmComplex<
@@ -0,0 +1,353 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Sampled telemetry of the operations launched by library::Handle.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+
+#include "cutlass/library/telemetry.h"
+
+namespace cutlass {
+namespace library {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+OperationTelemetry::OperationTelemetry(
+  Callback callback,
+  uint64_t sampling_period,
+  size_t max_pending
+):
+  callback_(std::move(callback)),
+  sampling_period_(sampling_period),
+  call_count_(0),
+  untimed_count_(0),
+  max_pending_(std::max(max_pending, size_t(1))) { }
+
+OperationTelemetry::~OperationTelemetry() {
+  flush();
+
+  for (auto &pool : event_pools_) {
+    for (cudaEvent_t event : pool.second) {
+      cudaEventDestroy(event);
+    }
+  }
+}
+
+void OperationTelemetry::set_callback(Callback callback) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  callback_ = std::move(callback);
+}
+
+void OperationTelemetry::set_sampling_period(uint64_t sampling_period) {
+  sampling_period_.store(sampling_period, std::memory_order_relaxed);
+}
+
+uint64_t OperationTelemetry::get_sampling_period() const {
+  return sampling_period_.load(std::memory_order_relaxed);
+}
+
+uint64_t OperationTelemetry::call_count() const {
+  return call_count_.load(std::memory_order_relaxed);
+}
+
+uint64_t OperationTelemetry::untimed_count() const {
+  return untimed_count_.load(std::memory_order_relaxed);
+}
+
+bool OperationTelemetry::sample(cudaStream_t stream) {
+
+  uint64_t period = sampling_period_.load(std::memory_order_relaxed);
+  if (!period) {
+    return false;
+  }
+
+  if (call_count_.fetch_add(1, std::memory_order_relaxed) % period) {
+    return false;
+  }
+
+  // Events recorded during stream capture would become nodes of the graph
+  cudaStreamCaptureStatus capture_status = cudaStreamCaptureStatusNone;
+  if (cudaStreamIsCapturing(stream, &capture_status) != cudaSuccess) {
+    cudaGetLastError();
+    return false;
+  }
+  return capture_status == cudaStreamCaptureStatusNone;
+}
+
+bool OperationTelemetry::begin(Timing &timing, cudaStream_t stream) {
+
+  timing = Timing();
+  if (cudaGetDevice(&timing.device_idx) != cudaSuccess) {
+    return false;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (pending_.size() >= max_pending_) {
+      untimed_count_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+
+    std::vector<cudaEvent_t> &pool = event_pools_[timing.device_idx];
+    for (cudaEvent_t *event : {&timing.start, &timing.stop}) {
+      if (!pool.empty()) {
+        *event = pool.back();
+        pool.pop_back();
+      }
+    }
+  }
+
+  bool created = true;
+  for (cudaEvent_t *event : {&timing.start, &timing.stop}) {
+    if (!*event && cudaEventCreate(event) != cudaSuccess) {
+      *event = nullptr;
+      created = false;
+    }
+  }
+
+  if (created && cudaEventRecord(timing.start, stream) == cudaSuccess) {
+    return true;
+  }
+
+  cudaGetLastError();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (cudaEvent_t event : {timing.start, timing.stop}) {
+    if (event) {
+      event_pools_[timing.device_idx].push_back(event);
+    }
+  }
+  timing = Timing();
+  return false;
+}
+
+void OperationTelemetry::end(Timing const &timing, OperationRunRecord record) {
+
+  if (timing.start) {
+    if (record.status == Status::kSuccess && cudaEventRecord(timing.stop, record.stream) == cudaSuccess) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.push_back(Pending{std::move(record), timing});
+      }
+      deliver(false);
+      return;
+    }
+
+    cudaGetLastError();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    event_pools_[timing.device_idx].push_back(timing.start);
+    event_pools_[timing.device_idx].push_back(timing.stop);
+  }
+
+  // Launches which failed or could not be timed are delivered right away, along with any completed
+  // records
+  record.duration_ms = -1;
+
+  Callback callback;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    callback = callback_;
+  }
+  invoke(callback, {record});
+  deliver(false);
+}
+
+void OperationTelemetry::poll() {
+  deliver(false);
+}
+
+void OperationTelemetry::flush() {
+  deliver(true);
+}
+
+void OperationTelemetry::deliver(bool wait) {
+
+  std::vector<OperationRunRecord> completed;
+  Callback callback;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Launches on different streams may complete out of order
+    for (auto it = pending_.begin(); it != pending_.end();) {
+      cudaError_t result = wait ? cudaEventSynchronize(it->timing.stop) : cudaEventQuery(it->timing.stop);
+      if (result == cudaErrorNotReady) {
+        ++it;
+        continue;
+      }
+
+      float elapsed_ms = -1;
+      if (result != cudaSuccess ||
+          cudaEventElapsedTime(&elapsed_ms, it->timing.start, it->timing.stop) != cudaSuccess) {
+        cudaGetLastError();
+        elapsed_ms = -1;
+      }
+      it->record.duration_ms = elapsed_ms;
+
+      event_pools_[it->timing.device_idx].push_back(it->timing.start);
+      event_pools_[it->timing.device_idx].push_back(it->timing.stop);
+
+      completed.push_back(std::move(it->record));
+      it = pending_.erase(it);
+    }
+
+    if (completed.empty()) {
+      return;
+    }
+    callback = callback_;
+  }
+
+  invoke(callback, completed);
+}
+
+void OperationTelemetry::invoke(Callback const &callback, std::vector<OperationRunRecord> const &records) {
+  if (!callback) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(delivery_mutex_);
+  for (auto const &record : records) {
+    callback(record);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+int TelemetryHistogram::bucket(float duration_ms) {
+  double duration_us = double(duration_ms) * 1000.0;
+  if (!(duration_us > 1.0)) {
+    return 0;
+  }
+  int result = int(std::ceil(std::log2(duration_us) * kBucketsPerOctave));
+  return std::min(std::max(result, 0), kBucketCount - 1);
+}
+
+double TelemetryHistogram::bucket_upper_bound_ms(int bucket) {
+  return std::exp2(double(bucket) / kBucketsPerOctave) / 1000.0;
+}
+
+double TelemetryHistogram::Entry::mean_ms() const {
+  uint64_t timed = count - failures;
+  return timed ? total_ms / double(timed) : 0.0;
+}
+
+double TelemetryHistogram::Entry::quantile_ms(double quantile) const {
+  uint64_t timed = count - failures;
+  if (!timed) {
+    return 0.0;
+  }
+
+  uint64_t target = std::max(uint64_t(std::ceil(quantile * double(timed))), uint64_t(1));
+  uint64_t cumulative = 0;
+  for (int b = 0; b < kBucketCount; ++b) {
+    cumulative += buckets[b];
+    if (cumulative >= target) {
+      return std::min(bucket_upper_bound_ms(b), double(max_ms));
+    }
+  }
+  return double(max_ms);
+}
+
+void TelemetryHistogram::record(OperationRunRecord const &record) {
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  Entry &entry = entries_[Key(record.operation_name, record.problem_key, record.config)];
+  if (!entry.count) {
+    entry.operation_name = record.operation_name;
+    entry.problem_key = record.problem_key;
+    entry.config = record.config;
+  }
+
+  ++entry.count;
+
+  if (record.status != Status::kSuccess || record.duration_ms < 0) {
+    ++entry.failures;
+    return;
+  }
+
+  bool first_timed = (entry.count - entry.failures == 1);
+  entry.total_ms += record.duration_ms;
+  entry.min_ms = first_timed ? record.duration_ms : std::min(entry.min_ms, record.duration_ms);
+  entry.max_ms = first_timed ? record.duration_ms : std::max(entry.max_ms, record.duration_ms);
+  ++entry.buckets[bucket(record.duration_ms)];
+}
+
+std::vector<TelemetryHistogram::Entry> TelemetryHistogram::snapshot() const {
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  std::vector<Entry> result;
+  result.reserve(entries_.size());
+  for (auto const &entry : entries_) {
+    result.push_back(entry.second);
+  }
+  return result;
+}
+
+void TelemetryHistogram::reset() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+}
+
+void TelemetryHistogram::write_csv(std::ostream &out) const {
+
+  // Problem keys and configurations hold commas
+  out << "operation,problem,config,count,failures,mean_ms,min_ms,max_ms,p50_ms,p90_ms,p99_ms\n";
+
+  for (Entry const &entry : snapshot()) {
+    out << entry.operation_name
+      << ",\"" << entry.problem_key << "\""
+      << ",\"" << entry.config << "\""
+      << "," << entry.count
+      << "," << entry.failures
+      << "," << entry.mean_ms()
+      << "," << entry.min_ms
+      << "," << entry.max_ms
+      << "," << entry.quantile_ms(0.5)
+      << "," << entry.quantile_ms(0.9)
+      << "," << entry.quantile_ms(0.99)
+      << "\n";
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
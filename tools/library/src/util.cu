@@ -343,6 +343,7 @@ static struct {
   {"conv3d", "Conv3d", OperationKind::kConv3d},
   {"spgemm", "SparseGemm", OperationKind::kSparseGemm},
   {"grouped_gemm", "GroupedGemm", OperationKind::kGroupedGemm},
+  {"distributed_gemm", "DistributedGemm", OperationKind::kDistributedGemm},
 };
 
 /// Converts a Status enumerant to a string
@@ -1014,6 +1015,7 @@ IteratorAlgorithmID_enumerants[] = {
   {"optimized", "<optimized>", IteratorAlgorithmID::kOptimized},
   {"fixed_channels", "<fixed_channels>", IteratorAlgorithmID::kFixedChannels},
   {"few_channels", "<few_channels>", IteratorAlgorithmID::kFewChannels},
+  {"winograd", "<winograd>", IteratorAlgorithmID::kWinograd},
 };
 
 /// Converts a ConvModeID enumerant to a string
@@ -1103,6 +1105,7 @@ RasterOrder_enumerants[] = {
   {"along_n", "<along_n>", "N", RasterOrder::kAlongN},
   {"along_m", "<along_m>", "M", RasterOrder::kAlongM},
   {"heuristic", "<heuristic>", "H", RasterOrder::kHeuristic},
+  {"l2_aware", "<l2_aware>", "L", RasterOrder::kL2Aware},
 };
 
 /// Converts a RasterOrder enumerant to a string
@@ -1140,6 +1143,52 @@ RasterOrder from_string<RasterOrder>(std::string const &str) {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+static struct {
+  char const *text;
+  char const *pretty;
+  DistributedGemmSchedule enumerant;
+}
+DistributedGemmSchedule_enumerants[] = {
+  {"ag_rotating_a", "<AllGather1D_TilingCD_RotatingA>", DistributedGemmSchedule::kAllGather1DTilingCDRotatingA},
+  {"ag_rotating_b", "<AllGather1D_TilingCD_RotatingB>", DistributedGemmSchedule::kAllGather1DTilingCDRotatingB},
+  {"rs_tiling_a", "<ReduceScatter1D_TilingA_RotatingC>", DistributedGemmSchedule::kReduceScatter1DTilingARotatingC},
+  {"rs_tiling_b", "<ReduceScatter1D_TilingB_RotatingC>", DistributedGemmSchedule::kReduceScatter1DTilingBRotatingC},
+  {"ag_rs_2d", "<AllGatherReduceScatter2D_TilingCD_RotatingAC>", DistributedGemmSchedule::kAllGatherReduceScatter2DTilingCDRotatingAC},
+};
+
+/// Converts a DistributedGemmSchedule enumerant to a string
+char const *to_string(DistributedGemmSchedule type, bool pretty) {
+
+  for (auto const & possible : DistributedGemmSchedule_enumerants) {
+    if (type == possible.enumerant) {
+      if (pretty) {
+        return possible.pretty;
+      }
+      else {
+        return possible.text;
+      }
+    }
+  }
+
+  return pretty ? "Invalid" : "invalid";
+}
+
+/// Converts a DistributedGemmSchedule enumerant from a string
+template <>
+DistributedGemmSchedule from_string<DistributedGemmSchedule>(std::string const &str) {
+
+  for (auto const & possible : DistributedGemmSchedule_enumerants) {
+    if ((str.compare(possible.text) == 0) ||
+        (str.compare(possible.pretty) == 0)) {
+      return possible.enumerant;
+    }
+  }
+
+  return DistributedGemmSchedule::kInvalid;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
 static struct {
   char const *text;
   char const *pretty;
@@ -2008,6 +2057,28 @@ NumericTypeID dynamic_datatype_to_id(RuntimeDatatype type) {
   return element;
 }
 
+/// Returns the GEMM description of a GEMM-like operation
+GemmDescription gemm_operation_description(OperationDescription const &desc) {
+  switch (desc.kind) {
+    case OperationKind::kGroupedGemm:
+      return static_cast<GroupedGemmDescription const &>(desc).gemm;
+    case OperationKind::kDistributedGemm:
+      return static_cast<DistributedGemmDescription const &>(desc).gemm;
+    case OperationKind::kBlockScaledGemm: {
+      auto const &bs_desc = static_cast<BlockScaledGemmDescription const &>(desc);
+      return GemmDescription(desc, bs_desc.gemm_kind, bs_desc.A, bs_desc.B, bs_desc.C, bs_desc.D,
+        bs_desc.element_epilogue, bs_desc.split_k_mode, bs_desc.transform_A, bs_desc.transform_B);
+    }
+    case OperationKind::kBlockwiseGemm: {
+      auto const &bw_desc = static_cast<BlockwiseGemmDescription const &>(desc);
+      return GemmDescription(desc, bw_desc.gemm_kind, bw_desc.A, bw_desc.B, bw_desc.C, bw_desc.D,
+        bw_desc.element_epilogue, bw_desc.split_k_mode, bw_desc.transform_A, bw_desc.transform_B);
+    }
+    default:
+      break;
+  }
+  return static_cast<GemmDescription const &>(desc);
+}
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
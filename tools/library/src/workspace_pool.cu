@@ -0,0 +1,202 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Stream-ordered pool of device workspace allocations.
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+#include "cutlass/library/workspace_pool.h"
+
+namespace cutlass {
+namespace library {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+WorkspacePool::WorkspacePool(cudaMemPool_t mem_pool):
+  mem_pool_(mem_pool),
+  owns_mem_pool_(false) {
+
+  cudaError_t error = cudaGetDevice(&device_idx_);
+  if (error != cudaSuccess) {
+    throw std::runtime_error("cudaGetDevice() failed");
+  }
+
+  if (!mem_pool_) {
+
+    cudaMemPoolProps props = {};
+    props.allocType = cudaMemAllocationTypePinned;
+    props.handleTypes = cudaMemHandleTypeNone;
+    props.location.type = cudaMemLocationTypeDevice;
+    props.location.id = device_idx_;
+
+    error = cudaMemPoolCreate(&mem_pool_, &props);
+    if (error != cudaSuccess) {
+      throw std::runtime_error("cudaMemPoolCreate() failed");
+    }
+
+    owns_mem_pool_ = true;
+
+    // Keep freed blocks in the pool rather than returning them to the driver at synchronization
+    // points, such that re-growing a workspace does not incur an allocation.
+    uint64_t release_threshold = UINT64_MAX;
+    cudaMemPoolSetAttribute(mem_pool_, cudaMemPoolAttrReleaseThreshold, &release_threshold);
+  }
+}
+
+WorkspacePool::~WorkspacePool() {
+
+  int device_before;
+  cudaGetDevice(&device_before);
+  if (device_before != device_idx_) {
+    cudaSetDevice(device_idx_);
+  }
+
+  // Streams may no longer exist at this point, so blocks are freed synchronously.
+  for (Shard &s : shards_) {
+    for (auto &entry : s.blocks) {
+      if (entry.second.ptr) {
+        cudaFree(entry.second.ptr);
+      }
+    }
+    s.blocks.clear();
+  }
+
+  if (owns_mem_pool_) {
+    cudaMemPoolDestroy(mem_pool_);
+  }
+
+  if (device_before != device_idx_) {
+    cudaSetDevice(device_before);
+  }
+}
+
+WorkspacePool::Shard &WorkspacePool::shard(cudaStream_t stream) const {
+  // Stream handles are pointers, whose low bits carry little entropy
+  uintptr_t key = reinterpret_cast<uintptr_t>(stream);
+  return shards_[(key ^ (key >> 12)) % kShardCount];
+}
+
+bool WorkspacePool::is_capturing(cudaStream_t stream) {
+  cudaStreamCaptureStatus status = cudaStreamCaptureStatusNone;
+  if (cudaStreamIsCapturing(stream, &status) != cudaSuccess) {
+    // Treat a failed query conservatively, as if a graph were being captured
+    return true;
+  }
+  return status != cudaStreamCaptureStatusNone;
+}
+
+void *WorkspacePool::acquire(size_t bytes, cudaStream_t stream) {
+
+  Shard &s = shard(stream);
+  std::lock_guard<std::mutex> lock(s.mutex);
+
+  Block &block = s.blocks[stream];
+
+  if (bytes <= block.size) {
+    return block.ptr;
+  }
+
+  // An allocation or free issued while capturing would be recorded into the graph, leaving a
+  // pointer owned by the graph in the block map. The block must be grown before capture.
+  if (is_capturing(stream)) {
+    return nullptr;
+  }
+
+  // Grow geometrically to bound the number of reallocations when workspace demands vary
+  size_t new_size = std::max(bytes, 2 * block.size);
+  void *ptr = nullptr;
+
+  cudaError_t error = cudaMallocFromPoolAsync(&ptr, new_size, mem_pool_, stream);
+
+  if (error != cudaSuccess) {
+    return nullptr;
+  }
+
+  // The previous block is released after all preceding work on the stream completes
+  if (block.ptr) {
+    cudaFreeAsync(block.ptr, stream);
+  }
+
+  block.ptr = ptr;
+  block.size = new_size;
+
+  return block.ptr;
+}
+
+void WorkspacePool::release(cudaStream_t stream) {
+
+  Shard &s = shard(stream);
+  std::lock_guard<std::mutex> lock(s.mutex);
+
+  auto it = s.blocks.find(stream);
+  if (it == s.blocks.end()) {
+    return;
+  }
+
+  // Freeing during capture would be deferred to graph launches, so the block is kept instead
+  if (is_capturing(stream)) {
+    return;
+  }
+
+  if (it->second.ptr) {
+    cudaFreeAsync(it->second.ptr, stream);
+  }
+
+  s.blocks.erase(it);
+}
+
+size_t WorkspacePool::workspace_size(cudaStream_t stream) const {
+
+  Shard &s = shard(stream);
+  std::lock_guard<std::mutex> lock(s.mutex);
+
+  auto it = s.blocks.find(stream);
+  return it == s.blocks.end() ? 0 : it->second.size;
+}
+
+int WorkspacePool::device() const {
+  return device_idx_;
+}
+
+cudaMemPool_t WorkspacePool::mem_pool() const {
+  return mem_pool_;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -165,6 +165,10 @@ public:
     /// profiling to avoid camping in the last level cache.
     int problem_count{1};
 
+    /// Number of copies of the C and D tensors. Equals problem_count unless workspaces share
+    /// their outputs (--workspace-share-cd).
+    int output_problem_count{1};
+
     library::GemmUniversalConfiguration configuration;
     library::BlockScaledGemmArguments arguments;
 
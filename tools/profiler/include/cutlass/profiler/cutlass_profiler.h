@@ -76,6 +76,18 @@ private:
   /// Profiles all operations
   int profile_();
 
+  /// Partitions the problem space across all listed devices and profiles the partitions concurrently
+  int profile_parallel_sweep_();
+
+  /// Profiles all operations once per locked SM clock
+  int profile_locked_clock_sweep_();
+
+  /// Profiles all operations with the current options
+  int profile_operations_();
+
+  /// Profiles the operations of a production trace in order and summarizes the step time
+  int profile_trace_replay_();
+
 public:
 
   CutlassProfiler(Options const &options);
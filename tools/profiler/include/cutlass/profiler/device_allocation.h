@@ -36,6 +36,7 @@
 
 #include <stdexcept>
 #include <list>
+#include <string>
 #include <vector>
 
 #include "cutlass/library/library.h"
@@ -243,6 +244,12 @@ public:
   /// Writes a tensor to csv
   void write_tensor_csv(std::ostream &out);
 
+  /// Writes the raw tensor storage to a binary .npy file
+  void write_tensor_npy(std::string const &path);
+
+  /// Replaces the tensor's contents with the storage held in a binary .npy file
+  void load_tensor_npy(std::string const &path);
+
 private:
   /// A wrapper that sets the device, performs malloc, and sets back
   cudaError_t malloc(void** ptr, size_t size);
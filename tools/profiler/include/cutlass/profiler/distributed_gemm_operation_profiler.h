@@ -0,0 +1,234 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Distributed GEMM Profiler
+*/
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <algorithm>
+#include <unordered_map>
+
+// CUTLASS Library includes
+#include "cutlass/library/library.h"
+#include "cutlass/library/util.h"
+#include "cutlass/library/manifest.h"
+#include "cutlass/library/gemm_autotune_cache.h"
+
+// Profiler includes
+#include "options.h"
+#include "device_context.h"
+#include "operation_profiler.h"
+#include "performance_result.h"
+#include "problem_space.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Profiles GEMMs distributed over several devices (tensor parallel). Each operation fixes its
+/// tiling and communication schedule and the number of devices, so profiling all operations on a
+/// problem selects the fastest schedule for it.
+class DistributedGemmOperationProfiler : public OperationProfiler {
+public:
+
+  /// Problem structure obtained from problem space
+  struct DistributedGemmProblem {
+    int64_t m{1024};
+    int64_t n{1024};
+    int64_t k{1024};
+    int64_t batch_count{1};
+    int64_t copy_sms{0};
+    std::vector<uint8_t> alpha;
+    std::vector<uint8_t> beta;
+
+    //
+    // Methods
+    //
+
+    /// Parses the problem
+    Status parse(
+      library::DistributedGemmDescription const &operation_desc,
+      ProblemSpace const &problem_space,
+      ProblemSpace::Problem const &problem);
+
+    /// Total number of bytes loaded by all devices
+    int64_t bytes(library::DistributedGemmDescription const &operation_desc) const;
+
+    /// Total number of flops computed by all devices
+    int64_t flops(library::DistributedGemmDescription const &operation_desc) const;
+
+    /// Initializes a performance result
+    void initialize_result(
+      PerformanceResult &result,
+      library::DistributedGemmDescription const &operation_desc,
+      ProblemSpace const &problem_space);
+  };
+
+  /// Workspace of one device (rank)
+  struct DistributedGemmRankWorkspace {
+
+    DeviceAllocation *A{nullptr};
+    DeviceAllocation *B{nullptr};
+    DeviceAllocation *C{nullptr};
+    DeviceAllocation *Computed{nullptr};
+
+    /// Buffer used for the operation's host workspace
+    std::vector<uint8_t> host_workspace;
+
+    /// Buffer used for the operation's device workspace, accessed by all peers
+    DeviceAllocation device_workspace;
+
+    /// Stream the rank's operation is launched on
+    cudaStream_t stream{nullptr};
+  };
+
+protected:
+
+  //
+  // Data members
+  //
+
+  /// Distributed GEMM problem obtained from problem space
+  DistributedGemmProblem problem_;
+
+  /// Configuration shared by all ranks, except for `device_idx`
+  library::DistributedGemmConfiguration configuration_;
+
+  /// Operand and workspace pointers of each rank referenced by configuration_
+  std::vector<void const *> ptr_A_;
+  std::vector<void const *> ptr_B_;
+  std::vector<void const *> ptr_C_;
+  std::vector<void *> ptr_D_;
+  std::vector<void *> ptr_workspace_;
+
+  /// Workspace of each rank
+  std::vector<DistributedGemmRankWorkspace> rank_workspace_;
+
+  /// Fastest schedule measured for a problem (--export-tuning-db)
+  struct TuningRecord {
+    double gflops{0};
+    library::GemmAutotuneSelection selection;
+  };
+
+  /// Fastest operation measured so far for each key returned by library::autotune_key()
+  std::unordered_map<std::string, TuningRecord> tuning_records_;
+
+public:
+  //
+  // Methods
+  //
+
+  /// Ctor
+  DistributedGemmOperationProfiler(Options const &options);
+
+  /// Destructor
+  virtual ~DistributedGemmOperationProfiler();
+
+  /// Prints usage statement for the math function
+  virtual void print_usage(std::ostream &out) const;
+
+  /// Prints examples
+  virtual void print_examples(std::ostream &out) const;
+
+  /// Records the fastest schedule of each profiled problem
+  void export_tuning_db(library::GemmAutotuneCache &tuning_db) const override;
+
+  /// Extracts the problem dimensions
+  virtual Status initialize_configuration(
+    Options const &options,
+    PerformanceReport &report,
+    DeviceContext &device_context,
+    library::Operation const *operation,
+    ProblemSpace const &problem_space,
+    ProblemSpace::Problem const &problem);
+
+  /// Initializes workspace
+  virtual Status initialize_workspace(
+    Options const &options,
+    PerformanceReport &report,
+    DeviceContext &device_context,
+    library::Operation const *operation,
+    ProblemSpace const &problem_space,
+    ProblemSpace::Problem const &problem);
+
+  /// Verifies CUTLASS against references
+  virtual bool verify_cutlass(
+    Options const &options,
+    PerformanceReport &report,
+    DeviceContext &device_context,
+    library::Operation const *operation,
+    ProblemSpace const &problem_space,
+    ProblemSpace::Problem const &problem);
+
+  /// Measures performance results
+  virtual bool profile(
+    Options const &options,
+    PerformanceReport &report,
+    DeviceContext &device_context,
+    library::Operation const *operation,
+    ProblemSpace const &problem_space,
+    ProblemSpace::Problem const &problem);
+
+protected:
+
+  /// Initializes the performance result
+  void initialize_result_(
+    PerformanceResult &result,
+    Options const &options,
+    library::DistributedGemmDescription const &operation_desc,
+    ProblemSpace const &problem_space);
+
+  /// Enables peer access between each pair of the first `tp` devices
+  static Status enable_peer_access_(Options const &options, int tp);
+
+  /// Destroys the streams of each rank and releases the rank workspaces
+  void free_rank_workspace_();
+
+  /// Records a profiled operation in tuning_records_ if it is the fastest seen for the problem
+  void record_tuning_entry_(
+    Options const &options,
+    PerformanceResult const &result,
+    library::DistributedGemmDescription const &operation_desc);
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
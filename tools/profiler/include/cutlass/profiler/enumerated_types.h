@@ -125,6 +125,73 @@ SaveWorkspace from_string<SaveWorkspace>(std::string const &str);
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// File format of saved workspace tensors
+enum class WorkspaceFormat {
+  kCsv,         ///< human-readable text
+  kNpy,         ///< binary NumPy .npy files holding the raw tensor storage
+  kInvalid
+};
+
+/// Converts a WorkspaceFormat enumerant to a string
+char const *to_string(WorkspaceFormat format, bool pretty = false);
+
+/// Parses a WorkspaceFormat enumerant from a string
+template <>
+WorkspaceFormat from_string<WorkspaceFormat>(std::string const &str);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// State of the L2 cache when each profiled iteration starts
+enum class CacheState {
+  kRotate,        ///< cycle through enough copies of the problem to avoid L2 camping (default)
+  kCold,          ///< flush the L2 before every iteration
+  kWarm,          ///< reuse a single copy of the problem so operands stay L2-resident
+  kWeightHot,     ///< flush the L2 before every iteration, then reload the B operand (weights)
+  kInvalid
+};
+
+/// Converts a CacheState enumerant to a string
+char const *to_string(CacheState cache_state, bool pretty = false);
+
+/// Parses a CacheState enumerant from a string
+template <>
+CacheState from_string<CacheState>(std::string const &str);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Background load run concurrently with the profiled kernel
+enum class InterferenceKind {
+  kNone,          ///< no background load (default)
+  kDram,          ///< CTAs streaming reads and writes over a buffer larger than the L2
+  kSm,            ///< CTAs that occupy whole SMs without issuing work
+  kInvalid
+};
+
+/// Converts an InterferenceKind enumerant to a string
+char const *to_string(InterferenceKind kind, bool pretty = false);
+
+/// Parses an InterferenceKind enumerant from a string
+template <>
+InterferenceKind from_string<InterferenceKind>(std::string const &str);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Indicates how much of each result is checked against the reference
+enum class VerificationMode {
+  kFull,          ///< compute and compare every element of the reference (default)
+  kSampled,       ///< compute and compare randomly sampled rows of output tiles only
+  kInvalid
+};
+
+/// Converts a VerificationMode enumerant to a string
+char const *to_string(VerificationMode mode, bool pretty = false);
+
+/// Parses a VerificationMode enumerant from a string
+template <>
+VerificationMode from_string<VerificationMode>(std::string const &str);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Indicates the type of kernel argument
 // ArgumentType can be both ScalarType or NumericType. Thus, enums kScalar and kNumeric
 // 1) kScalar: e.g. of a Scalar ArgumentType is u32 is a Scalar type.
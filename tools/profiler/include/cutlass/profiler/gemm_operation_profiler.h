@@ -103,6 +103,7 @@ public:
 
     cutlass::library::RasterOrder raster_order{cutlass::library::RasterOrder::kHeuristic};
     int swizzle_size{1};
+    int mma_promotion_interval{-1};
     cutlass::library::RuntimeDatatype runtime_input_datatype_a{};
     cutlass::library::RuntimeDatatype runtime_input_datatype_b{};
     
@@ -161,6 +162,10 @@ public:
     /// profiling to avoid camping in the last level cache.
     int problem_count{1};
 
+    /// Number of copies of the C and D tensors. Equals problem_count unless workspaces share
+    /// their outputs (--workspace-share-cd).
+    int output_problem_count{1};
+
     library::GemmUniversalConfiguration configuration;
     library::GemmUniversalArguments arguments;
 
@@ -202,6 +207,15 @@ protected:
   /// CUTLASS parallel reduction operation to follow this* gemm operation
   library::Operation const *reduction_op_;
 
+  /// Fastest selection measured for a problem signature (--export-tuning-db)
+  struct TuningRecord {
+    double gflops{0};
+    library::GemmAutotuneSelection selection;
+  };
+
+  /// Fastest selection measured so far for each serialized library::GemmAutotuneKey
+  std::unordered_map<std::string, TuningRecord> tuning_records_;
+
 public:
   //
   // Methods
@@ -257,7 +271,17 @@ public:
     ProblemSpace const &problem_space,
     ProblemSpace::Problem const &problem);
 
+  /// Records the fastest operation and runtime arguments of each profiled problem
+  void export_tuning_db(library::GemmAutotuneCache &tuning_db) const override;
+
 protected:
+  /// Estimates the relative runtime of a GEMM from its tile shape and the number of waves
+  double estimate_runtime_(
+    Options const &options,
+    library::OperationDescription const &operation_desc,
+    ProblemSpace const &problem_space,
+    ProblemSpace::Problem const &problem) const override;
+
   /// Update workspace configuration according to flexible user setups
   void update_workspace_(
     GemmWorkspace &gemm_workspace,
@@ -288,6 +312,20 @@ protected:
     library::GemmDescription const &operation_desc,
     ProblemSpace const &problem_space);
 
+  /// Records a profiled configuration in tuning_records_ under the key library::Handle computes
+  /// for the same launch, if it is the fastest seen for that key
+  void record_tuning_entry_(
+    Options const &options,
+    PerformanceResult const &result,
+    library::GemmDescription const &operation_desc,
+    gemm::GemmCoord const &problem_shape,
+    std::array<int64_t, 3> const &leading_dim,
+    cutlass::library::RasterOrder raster_order,
+    int swizzle_size,
+    std::array<int64_t, 3> const &preferred_cluster,
+    std::array<int64_t, 3> const &fallback_cluster,
+    bool is_dynamic_cluster_enabled);
+
   /// Verifies CUTLASS against references
   bool verify_with_cublas_(
     Options const &options,
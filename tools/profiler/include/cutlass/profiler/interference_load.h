@@ -0,0 +1,114 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+/* \file
+   \brief Runs a background load on a device while kernels are profiled
+*/
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include "cutlass/cutlass.h"
+
+#include "enumerated_types.h"
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Host-mapped state shared between an InterferenceLoad and its kernel
+struct InterferenceControl;
+
+/// Keeps a persistent kernel resident on a dedicated stream between start() and stop(), so that
+/// kernels profiled on other streams run under contention.
+///
+/// A DRAM load launches one CTA per occupied SM, each streaming reads and writes over a buffer
+/// larger than the L2. An SM load launches one CTA per occupied SM sized to the maximum shared
+/// memory and thread count of an SM, so no other CTA can be co-resident; only one thread per CTA
+/// polls the stop flag. start() returns once every CTA is resident. The load is stopped and its
+/// resources released on destruction.
+class InterferenceLoad {
+private:
+
+  /// Kind of background load
+  InterferenceKind kind_;
+
+  /// Device the load runs on
+  int device_id_;
+
+  /// Number of CTAs, one per occupied SM
+  int ctas_;
+
+  /// Non-blocking stream the load is launched on
+  cudaStream_t stream_;
+
+  /// Host-mapped stop flag and arrival counter
+  InterferenceControl *control_;
+
+  /// Buffer streamed by the DRAM load
+  void *buffer_;
+  size_t buffer_bytes_;
+
+  /// True between a successful start() and stop()
+  bool running_;
+
+public:
+
+  /// Prepares a load of `kind` on the current device occupying `sms` SMs (a quarter of the
+  /// device if zero). The DRAM load streams `buffer_mb` MiB (four times the L2 if zero).
+  InterferenceLoad(InterferenceKind kind, int sms = 0, int buffer_mb = 0);
+
+  InterferenceLoad(InterferenceLoad const &) = delete;
+  InterferenceLoad &operator=(InterferenceLoad const &) = delete;
+
+  ~InterferenceLoad();
+
+  /// Returns true if a load is configured
+  bool enabled() const { return kind_ != InterferenceKind::kNone && kind_ != InterferenceKind::kInvalid; }
+
+  /// Launches the load and waits until it is resident. No-op if no load is configured.
+  Status start();
+
+  /// Signals the load to exit and waits for it to drain
+  Status stop();
+
+  /// Number of SMs occupied by the load
+  int sms() const { return ctas_; }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
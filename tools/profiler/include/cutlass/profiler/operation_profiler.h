@@ -46,6 +46,7 @@
 #include "cutlass/library/library.h"
 #include "cutlass/library/util.h"
 #include "cutlass/library/manifest.h"
+#include "cutlass/library/gemm_autotune_cache.h"
 
 // Profiler includes
 #include "options.h"
@@ -91,6 +92,23 @@ protected:
   /// Performance result vector constructed by profiling the operation
   PerformanceResultVector results_;
 
+  /// Profiled results retained during a trace replay so the step time can be summarized
+  PerformanceResultVector retained_results_;
+
+  /// Device context of the problem being profiled (non-owning). Used to locate operands whose
+  /// L2 residency is controlled by --cache-state.
+  DeviceContext *device_context_{nullptr};
+
+  /// Scratch buffer written between iterations to flush the L2 (owning)
+  void *l2_flush_buffer_{nullptr};
+
+  /// Size of l2_flush_buffer_ in bytes
+  size_t l2_flush_bytes_{0};
+
+  /// Best median runtime (ms) measured by adaptive sampling for the current problem, or zero if
+  /// no kernel has been sampled yet. Used to stop sampling kernels that are statistically slower.
+  double best_adaptive_runtime_{0};
+
 public:
 
   //
@@ -118,6 +136,9 @@ public:
   /// Returns a reference to the arguments
   ArgumentDescriptionVector const &arguments() const { return arguments_; }
 
+  /// Returns the results profiled so far during a trace replay
+  PerformanceResultVector &retained_results() { return retained_results_; }
+
 public:
 
   //
@@ -137,6 +158,10 @@ public:
     library::Manifest const &manifest, 
     DeviceContext &device_context);
 
+  /// Records the fastest operation and runtime arguments of each problem profiled so far in a
+  /// tuning database (--export-tuning-db). Operation kinds without runtime selection record nothing.
+  virtual void export_tuning_db(library::GemmAutotuneCache &tuning_db) const { }
+
 public:
 
   //
@@ -253,6 +278,14 @@ protected:
     std::function<Status(int, cudaStream_t, int)> const& func,
     std::vector<cudaStream_t> const& streams);
 
+  /// Profiles the distributed kernel launched in `func` on all requested devices, whose launches
+  /// synchronize with each other
+  Status profile_distributed_kernel_(
+    PerformanceResult& result,
+    Options const& options,
+    std::function<Status(int, cudaStream_t, int)> const& func,
+    std::vector<cudaStream_t> const& streams);
+
   /// Profiles the GPU kernel launched in `func` on the `stream`
   Status profile_kernel_(
     PerformanceResult& result,
@@ -260,6 +293,42 @@ protected:
     std::function<Status(cudaStream_t, int)> const& func,
     cudaStream_t stream = nullptr);
 
+  /// Returns the number of copies of a problem of `bytes` bytes to cycle through while profiling
+  static int workspace_problem_count_(Options const &options, int64_t bytes);
+
+  /// Returns the number of copies of the C and D tensors among `problem_count` workspaces
+  static int workspace_output_count_(Options const &options, int problem_count);
+
+  /// Estimates the relative runtime of an operation on a problem. Used to rank the candidates of a
+  /// pruned search (--search-top-k); the default ranks all operations equally.
+  virtual double estimate_runtime_(
+    Options const &options,
+    library::OperationDescription const &operation_desc,
+    ProblemSpace const &problem_space,
+    ProblemSpace::Problem const &problem) const;
+
+  /// Returns true if two operations differ only in their tile, cluster and stage configuration,
+  /// with each tile and cluster extent within a factor of two
+  static bool is_search_neighbor_(
+    library::OperationDescription const &lhs,
+    library::OperationDescription const &rhs);
+
+  /// Profiles the GPU kernel launched in `func` on the `stream`, flushing the L2 before each
+  /// launch according to --cache-state
+  Status profile_kernel_flushed_(
+    PerformanceResult& result,
+    Options const& options,
+    std::function<Status(cudaStream_t, int)> const& func,
+    cudaStream_t stream = nullptr);
+
+  /// Profiles the GPU kernel launched in `func` on the `stream`, sampling individual launches
+  /// until the median runtime is known to the requested precision
+  Status profile_kernel_adaptive_(
+    PerformanceResult& result,
+    Options const& options,
+    std::function<Status(cudaStream_t, int)> const& func,
+    cudaStream_t stream = nullptr);
+
   /// Profiles the GPU kernel launched in `func` on the `stream`
   Status profile_kernel_no_cuda_graphs_(
     PerformanceResult& result,
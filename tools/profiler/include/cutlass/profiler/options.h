@@ -117,6 +117,9 @@ public:
 
     /// Returns the compute capability of the listed devices (e.g. 70, 75, 80, etc.)
     int compute_capability(int device_index) const;
+
+    /// Returns the theoretical peak DRAM bandwidth of the listed device in GiB/s, or zero if unknown
+    double dram_bandwidth(int device_index) const;
   };
 
   /// Options related to initializing input tensors
@@ -139,6 +142,9 @@ public:
     /// Random number generator seed.
     int seed;
 
+    /// Tensors loaded from .npy files after initialization, as (tensor name, path) pairs
+    std::vector<std::pair<std::string, std::string>> tensor_files;
+
     //
     // Methods
     //
@@ -181,6 +187,18 @@ public:
     /// Indicates when to save the workspace
     SaveWorkspace save_workspace;
 
+    /// File format of saved workspace tensors
+    WorkspaceFormat workspace_format{WorkspaceFormat::kCsv};
+
+    /// Whether the reference is computed and compared in full or for sampled output rows only
+    VerificationMode mode{VerificationMode::kFull};
+
+    /// Number of output tile rows checked per problem in sampled mode
+    int sample_count{1024};
+
+    /// Seed selecting the output tile rows checked in sampled mode
+    uint64_t sample_seed{2080};
+
     //
     // Methods
     //
@@ -203,6 +221,18 @@ public:
     /// Number of workspaces to rotate through to avoid cache-resident working sets
     int workspace_count{0};
 
+    /// If positive, only the K best-ranked kernels of each problem are profiled, followed by a local
+    /// search over kernels whose tile, cluster and stage configurations neighbor the fastest one
+    int search_top_k{0};
+
+    /// If true, only the A and B operands are replicated across workspaces. All workspaces share
+    /// a single copy of the C and D tensors, which bounds memory use for problems with large M and N.
+    bool workspace_share_cd{false};
+
+    /// State of the L2 cache at the start of each profiled iteration. Cold and weight-hot states
+    /// flush the L2 explicitly instead of allocating copies of the problem.
+    CacheState cache_state{CacheState::kRotate};
+
     /// Number of iterations to warmup each kernel prior to profiling
     int warmup_iterations{10};
 
@@ -219,6 +249,49 @@ public:
     /// If true, profiling with cuda graph enabled.
     bool use_cuda_graphs{false};
 
+    /// If positive, enables adaptive sampling: each kernel is sampled until the 95% confidence
+    /// interval of its median runtime is within this many percent of the median. The sample count is
+    /// bounded below by min_iterations and above by the profiling-iterations/profiling-duration budget.
+    double adaptive_precision{0};
+
+    /// If true in adaptive mode, sampling of a kernel stops as soon as it is statistically slower
+    /// than the best kernel seen for the same problem.
+    bool adaptive_early_exit{true};
+
+    /// If true, board power and SM clocks are sampled through NVML during the timed region and
+    /// average power, energy per operation and GFLOP/J are reported.
+    bool measure_power{false};
+
+    /// SM clocks (MHz) to lock the devices to. If non-empty, the problem space is profiled once per
+    /// clock, and each result is tagged with the clock it was measured at.
+    std::vector<int> locked_sm_clocks;
+
+    /// If true, --enable-best-kernel-for-fixed-shape selects the candidate with the highest GFLOP/J
+    /// instead of the highest GFLOP/s. Requires measure_power.
+    bool best_kernel_by_energy{false};
+
+    /// Background load run on a separate stream while each kernel is profiled, so that runtimes
+    /// reflect contention with concurrent work instead of an otherwise idle device.
+    InterferenceKind interference{InterferenceKind::kNone};
+
+    /// Number of SMs occupied by the background load. If zero, a quarter of the device's SMs.
+    int interference_sms{0};
+
+    /// Size of the buffer streamed by the DRAM load (MiB). If zero, four times the L2 capacity.
+    int interference_buffer_mb{0};
+
+    /// If true and several devices are listed, the problem space is partitioned across the devices
+    /// and swept concurrently with one worker thread per device. Results are merged into one report.
+    bool parallel_sweep{false};
+
+    /// Index of the partition of (problem, operation) pairs profiled by this worker.
+    /// This is not set by the user, it is set by CutlassProfiler for each parallel sweep worker.
+    int partition_index{0};
+
+    /// Number of partitions the (problem, operation) pairs are distributed over
+    /// This is not set by the user, it is set by CutlassProfiler for each parallel sweep worker.
+    int partition_count{1};
+
     /// If enabled, the CUTLASS profiler searches for the best-performing kernel 
     /// within the subset of kernels matching a kernel filter regex. The best 
     /// performance is determined by screening over a set of predefined M/N/K 
@@ -277,6 +350,10 @@ public:
     /// Path to a file containing junit xml results
     std::string junit_output_path;
 
+    /// Path to a tuning database mapping each profiled problem to its fastest kernel and runtime
+    /// arguments, in the format of library::GemmAutotuneCache
+    std::string tuning_db_path;
+
     /// Sequence of tags to attach to each result
     std::vector<std::pair<std::string, std::string>> pivot_tags;
 
@@ -293,6 +370,25 @@ public:
     /// Sort results by flops-per-second
     bool sort_flops_per_sec;
 
+    /// Path to a previous CSV report whose results are compared against the current run
+    std::string baseline_path;
+
+    /// Slowdown (percent) relative to the baseline below which a result is treated as noise when
+    /// no confidence intervals are available
+    double regression_tolerance;
+
+    /// If positive, the profiler returns an error code when a regression exceeds this slowdown (percent)
+    double fail_on_regression;
+
+    /// If true, roofline columns relating achieved throughput to the device peaks are reported
+    bool roofline;
+
+    /// Peak DRAM bandwidth (GiB/s) used by the roofline columns. Queried from the device if zero.
+    double peak_bandwidth;
+
+    /// Peak math throughput (GFLOP/s) used by the roofline columns. Math columns are empty if zero.
+    double peak_gflops;
+
     /// Prints the name of the kernel being profiled before running the kernel.
     /// This is useful for determining which kernel is causing a run of the profiler to hang
     bool print_kernel_before_running;
@@ -353,6 +449,26 @@ public:
   /// Vector of operation name substrings
   std::vector<std::string> excluded_operation_names;
 
+  /// One operation of a production trace replayed with --trace-file
+  struct TraceEntry {
+
+    /// Exact name of the kernel executing this operation
+    std::string operation_name;
+
+    /// Problem arguments of the operation
+    CommandLine problem;
+
+    /// Number of times the operation executes back to back within the step
+    int repeat;
+
+    /// If true, the operands are resident in L2 when the operation starts (e.g. reused weights).
+    /// Otherwise the profiler cycles through enough copies of the operands to defeat the L2.
+    bool l2_hot;
+  };
+
+  /// Operations of a production trace in execution order
+  std::vector<TraceEntry> trace;
+
 
   //
   // Detailed configuration options
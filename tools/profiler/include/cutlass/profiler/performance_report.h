@@ -36,6 +36,8 @@
 
 #include <vector>
 #include <fstream>
+#include <string>
+#include <unordered_map>
 
 // CUTLASS Profiler includes
 #include "options.h"
@@ -83,6 +85,25 @@ private:
   /// Collection of all results
   PerformanceResultVector concatenated_results_;
 
+  /// Peak DRAM bandwidth (GiB/s) used by the roofline columns
+  double peak_bandwidth_;
+
+  /// Runtime of a result in the baseline report
+  struct BaselineResult {
+    double runtime;
+    double ci_lower;
+    double ci_upper;
+  };
+
+  /// Baseline results keyed by provider, operation and problem arguments
+  std::unordered_map<std::string, BaselineResult> baseline_;
+
+  /// Problem argument columns present in both the baseline and the current report
+  std::vector<std::string> baseline_arguments_;
+
+  /// Number of results slower than the baseline beyond --fail-on-regression
+  int failing_regression_count_;
+
 public:
 
   PerformanceReport(Options const &options, std::vector<std::string> const &argument_names, library::OperationKind const &op_kind);
@@ -90,6 +111,9 @@ public:
 
   bool good() const { return good_; }
 
+  /// Number of results slower than the baseline beyond --fail-on-regression
+  int failing_regression_count() const { return failing_regression_count_; }
+
   void next_problem();
   void append_result(PerformanceResult result);
   void sort_flops_per_byte(PerformanceResultVector &results);
@@ -104,6 +128,24 @@ public:
   /// Prints the CSV
   std::ostream & print_result_csv_(std::ostream &out, PerformanceResult const &result);
 
+  /// Loads the baseline report given by --baseline
+  void load_baseline_();
+
+  /// Returns the baseline result matching `result`, or nullptr if there is none
+  BaselineResult const *find_baseline_(PerformanceResult const &result) const;
+
+  /// Returns true if `result` is significantly slower than `baseline`
+  bool is_regression_(PerformanceResult const &result, BaselineResult const &baseline) const;
+
+  /// Prints the baseline comparison columns of the CSV
+  std::ostream & print_result_baseline_csv_(std::ostream &out, PerformanceResult const &result);
+
+  /// Prints the roofline columns of the CSV
+  std::ostream & print_result_roofline_csv_(std::ostream &out, PerformanceResult const &result);
+
+  /// Classifies a result as memory- or compute-bound, or returns an empty string if unknown
+  char const *roofline_bound_(PerformanceResult const &result) const;
+
   /// @defgroup jUnit Result Generation
   /// Functions related to generation of the jUnit results
   /// @{
@@ -89,6 +89,31 @@ struct PerformanceResult {
   /// Average runtime in ms per device
   std::vector<double> runtime_vector;
 
+  /// Median runtime in ms (adaptive sampling only)
+  double runtime_p50;
+
+  /// 90th percentile runtime in ms (adaptive sampling only)
+  double runtime_p90;
+
+  /// Bounds of the 95% confidence interval of the median runtime in ms (adaptive sampling only)
+  double runtime_ci_lower;
+  double runtime_ci_upper;
+
+  /// Number of runtime samples taken (adaptive sampling only)
+  int samples;
+
+  /// Average board power in W over the timed region (power measurement only)
+  double average_power;
+
+  /// Energy per operation in J (power measurement only)
+  double energy;
+
+  /// Average SM clock in MHz over the timed region (power measurement only)
+  double average_sm_clock;
+
+  /// Resource usage of the operation's kernel, as recorded by the library manifest
+  library::KernelResourceDescription resources;
+
   //
   // Members
   //
@@ -102,7 +127,15 @@ struct PerformanceResult {
     status(Status::kInvalid),
     bytes(0), 
     flops(0), 
-    runtime(0)
+    runtime(0),
+    runtime_p50(0),
+    runtime_p90(0),
+    runtime_ci_lower(0),
+    runtime_ci_upper(0),
+    samples(0),
+    average_power(0),
+    energy(0),
+    average_sm_clock(0)
   { }
 
   // Copy constructor for deep copy
@@ -121,6 +154,11 @@ struct PerformanceResult {
     return double(flops) / runtime / 1.0e6;
   }
 
+  /// Energy efficiency in units of GFLOP/J
+  double gflops_per_joule() const {
+    return energy > 0 ? double(flops) / energy / 1.0e9 : 0;
+  }
+
   /// memory bandwidth in units of GiB/s
   double gbytes_per_sec() const {
     return double(bytes) / double(1 << 30) / runtime * 1000.0;
@@ -0,0 +1,129 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Samples board power, energy and SM clocks of a device through NVML
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "cutlass/cutlass.h"
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Measures the energy drawn by a device over a host-side region bracketed by start() and stop().
+///
+/// Energy is taken from the board energy counter when the device exposes one, otherwise it is
+/// integrated from periodic power samples. SM clocks are sampled on the same background thread.
+/// Without NVML support (CUTLASS_PROFILER_ENABLE_NVML), supported() is false and all measurements
+/// are zero.
+class PowerMonitor {
+private:
+
+  /// NVML device handle (nvmlDevice_t) of the monitored device
+  void *handle_;
+
+  /// Interval between power and clock samples (ms)
+  int sample_interval_ms_;
+
+  /// True if the device exposes a total energy counter
+  bool has_energy_counter_;
+
+  /// Signals the sampling thread to stop
+  std::atomic<bool> sampling_;
+
+  /// Background sampling thread
+  std::thread sampler_;
+
+  /// Host time at start()
+  std::chrono::steady_clock::time_point start_time_;
+
+  /// Energy counter at start() in mJ
+  unsigned long long start_energy_mJ_;
+
+  /// Accumulated power and clock samples
+  double power_sum_W_;
+  double clock_sum_MHz_;
+  int sample_count_;
+
+  /// Measurements of the last region
+  double elapsed_s_;
+  double energy_J_;
+  double average_power_W_;
+  double average_sm_clock_MHz_;
+
+public:
+
+  /// Opens the NVML device matching CUDA device `device_id`
+  explicit PowerMonitor(int device_id, int sample_interval_ms = 1);
+
+  PowerMonitor(PowerMonitor const &) = delete;
+  PowerMonitor &operator=(PowerMonitor const &) = delete;
+
+  ~PowerMonitor();
+
+  /// Returns true if power can be measured on this device
+  bool supported() const { return handle_ != nullptr; }
+
+  /// Begins the measured region
+  void start();
+
+  /// Ends the measured region
+  void stop();
+
+  /// Energy drawn over the last region (J)
+  double energy() const { return energy_J_; }
+
+  /// Average board power over the last region (W)
+  double average_power() const { return average_power_W_; }
+
+  /// Average SM clock over the last region (MHz)
+  double average_sm_clock() const { return average_sm_clock_MHz_; }
+
+  /// Locks the SM clock of CUDA device `device_id` to `clock_MHz`. Requires administrative privileges.
+  static Status lock_sm_clock(int device_id, int clock_MHz);
+
+  /// Restores default SM clock management of CUDA device `device_id`
+  static Status reset_sm_clock(int device_id);
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
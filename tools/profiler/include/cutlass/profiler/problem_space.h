@@ -964,6 +964,18 @@ bool arg_as_RasterOrder(
   ProblemSpace const &problem_space, 
   ProblemSpace::Problem const &problem);
 
+/// Lexically casts an argument to a distributed GEMM schedule if it is defined. Returns true if not null.
+bool arg_as_DistributedGemmSchedule(
+  library::DistributedGemmSchedule &schedule,
+  KernelArgument::Value const *value_ptr);
+
+/// Lexically casts an argument to a distributed GEMM schedule if it is defined. Returns true if not null.
+bool arg_as_DistributedGemmSchedule(
+  library::DistributedGemmSchedule &schedule,
+  char const *name,
+  ProblemSpace const &problem_space,
+  ProblemSpace::Problem const &problem);
+
 /// Lexically casts an argument to an int64 if it is defined. Returns true if not null.
 bool arg_as_ProviderID(library::Provider &provider, KernelArgument::Value const *value_ptr);
 
@@ -677,19 +677,8 @@ Status BlockwiseGemmOperationProfiler::initialize_workspace(
     static_cast<library::BlockwiseGemmDescription const &>(operation->description());
 
   // Compute the number of copies of the problem to avoid L2 camping.
-  if (!options.profiling.workspace_count) {
-    int64_t bytes = problem_.bytes(operation_desc);
-    if (bytes < 3 * int64_t(options.device.properties[0].l2CacheSize)) {
-      gemm_workspace_.problem_count =
-        1 + int((3 * int64_t(options.device.properties[0].l2CacheSize)) / bytes);
-    }
-    else {
-      gemm_workspace_.problem_count = 1;
-    }
-  }
-  else {
-    gemm_workspace_.problem_count = options.profiling.workspace_count;
-  }
+  gemm_workspace_.problem_count = workspace_problem_count_(options, problem_.bytes(operation_desc));
+  gemm_workspace_.output_problem_count = workspace_output_count_(options, gemm_workspace_.problem_count);
 
   bool allocate_device_tensors = options.execution_mode != ExecutionMode::kDryRun;
   if (allocate_device_tensors) {
@@ -753,7 +742,7 @@ Status BlockwiseGemmOperationProfiler::initialize_workspace(
       operation_desc.C.layout,
       {int(problem_.m), int(problem_.n)},
       {int(problem_.ldc)},
-      problem_.batch_count * gemm_workspace_.problem_count,
+      problem_.batch_count * gemm_workspace_.output_problem_count,
       seed_shift++,
       0 // device_index
     );
@@ -765,7 +754,7 @@ Status BlockwiseGemmOperationProfiler::initialize_workspace(
       operation_desc.D.layout,
       {int(problem_.m), int(problem_.n)},
       {int(problem_.ldc)},
-      problem_.batch_count * gemm_workspace_.problem_count,
+      problem_.batch_count * gemm_workspace_.output_problem_count,
       0 // device_index
     );
 
@@ -776,7 +765,7 @@ Status BlockwiseGemmOperationProfiler::initialize_workspace(
       operation_desc.D.layout,
       {int(problem_.m), int(problem_.n)},
       {int(problem_.ldc)},
-      problem_.batch_count * gemm_workspace_.problem_count,
+      problem_.batch_count * gemm_workspace_.output_problem_count,
       0 // device_index
     );
   }
@@ -1374,7 +1363,10 @@ bool BlockwiseGemmOperationProfiler::profile(
         assert(!candidates.empty() && "Candidates vector should not be empty");
         auto best_iter = std::max_element(
           candidates.begin(), candidates.end(),
-          [](PerformanceResult const &a, PerformanceResult const &b) {
+          [&](PerformanceResult const &a, PerformanceResult const &b) {
+            if (options.profiling.best_kernel_by_energy) {
+              return a.gflops_per_joule() < b.gflops_per_joule();
+            }
             return a.gflops_per_sec() < b.gflops_per_sec();
           }
         );
@@ -1500,18 +1492,19 @@ Status BlockwiseGemmOperationProfiler::profile_cutlass_(
   auto func = [&](cudaStream_t, int iteration) {
     // Iterate over copies of the problem in memory
     int problem_idx = (iteration % gemm_workspace_.problem_count) * problem_.batch_count;
+    int output_idx = (iteration % gemm_workspace_.output_problem_count) * problem_.batch_count;
 
     gemm_workspace_.arguments.A = gemm_workspace_.A->batch_data(problem_idx);
     gemm_workspace_.arguments.B = gemm_workspace_.B->batch_data(problem_idx);
-    gemm_workspace_.arguments.C = gemm_workspace_.C->batch_data(problem_idx);
-    gemm_workspace_.arguments.D = gemm_workspace_.Computed->batch_data(problem_idx);
+    gemm_workspace_.arguments.C = gemm_workspace_.C->batch_data(output_idx);
+    gemm_workspace_.arguments.D = gemm_workspace_.Computed->batch_data(output_idx);
 
     if (problem_.split_k_mode == library::SplitKMode::kParallel) {
       gemm_workspace_.arguments.D                     = gemm_workspace_.device_workspace.data();
 
       gemm_workspace_.reduction_arguments.workspace   = gemm_workspace_.device_workspace.data();
-      gemm_workspace_.reduction_arguments.source      = gemm_workspace_.C->batch_data(problem_idx);
-      gemm_workspace_.reduction_arguments.destination = gemm_workspace_.Computed->batch_data(problem_idx);
+      gemm_workspace_.reduction_arguments.source      = gemm_workspace_.C->batch_data(output_idx);
+      gemm_workspace_.reduction_arguments.destination = gemm_workspace_.Computed->batch_data(output_idx);
     }
 
     Status status = underlying_operation->run(
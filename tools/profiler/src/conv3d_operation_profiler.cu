@@ -645,19 +645,7 @@ Status Conv3dOperationProfiler::initialize_workspace(
     static_cast<library::ConvDescription const &>(underlying_operation->description());
 
   // Compute the number of copies of the problem to avoid L2 camping.
-  if (!options.profiling.workspace_count) {
-    int64_t bytes = problem_.bytes(operation_desc);
-    if (bytes < 3 * int64_t(options.device.properties[0].l2CacheSize)) {
-      conv_workspace_.problem_count =
-        1 + int((3 * int64_t(options.device.properties[0].l2CacheSize)) / bytes);
-    }
-    else {
-      conv_workspace_.problem_count = 1;
-    }
-  }
-  else {
-    conv_workspace_.problem_count = options.profiling.workspace_count;
-  }
+  conv_workspace_.problem_count = workspace_problem_count_(options, problem_.bytes(operation_desc));
 
 
   if (options.execution_mode != ExecutionMode::kDryRun) {
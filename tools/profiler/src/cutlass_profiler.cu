@@ -32,8 +32,13 @@
    \brief Execution environment
 */
 
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
 
 // Profiler includes
 #include "cutlass/profiler/block_scaled_gemm_operation_profiler.h"
@@ -41,8 +46,10 @@
 #include "cutlass/profiler/conv2d_operation_profiler.h"
 #include "cutlass/profiler/conv3d_operation_profiler.h"
 #include "cutlass/profiler/cutlass_profiler.h"
+#include "cutlass/profiler/distributed_gemm_operation_profiler.h"
 #include "cutlass/profiler/gemm_operation_profiler.h"
 #include "cutlass/profiler/grouped_gemm_operation_profiler.h"
+#include "cutlass/profiler/power_monitor.h"
 #include "cutlass/profiler/rank_2k_operation_profiler.h"
 #include "cutlass/profiler/rank_k_operation_profiler.h"
 #include "cutlass/profiler/sparse_gemm_operation_profiler.h"
@@ -82,6 +89,8 @@ CutlassProfiler::CutlassProfiler(
   operation_profilers_.emplace_back(new SymmOperationProfiler(options));
 
   operation_profilers_.emplace_back(new GroupedGemmOperationProfiler(options));
+
+  operation_profilers_.emplace_back(new DistributedGemmOperationProfiler(options));
 }
 
 CutlassProfiler::~CutlassProfiler() {
@@ -152,6 +161,68 @@ void CutlassProfiler::enumerate_() {
 /// Profiles all operations
 int CutlassProfiler::profile_() {
 
+  // Results measured under a background load are not comparable to results on an idle device
+  if (options_.profiling.interference != InterferenceKind::kNone) {
+    options_.report.pivot_tags.push_back({"interference", to_string(options_.profiling.interference)});
+  }
+
+  if (options_.profiling.parallel_sweep && options_.device.devices.size() > 1 && options_.trace.empty()) {
+    return profile_parallel_sweep_();
+  }
+
+  if (!options_.profiling.locked_sm_clocks.empty()) {
+    return profile_locked_clock_sweep_();
+  }
+
+  return profile_operations_();
+}
+
+/// Profiles all operations once per locked SM clock
+int CutlassProfiler::profile_locked_clock_sweep_() {
+
+  std::vector<int> clocks = options_.profiling.locked_sm_clocks;
+  options_.profiling.locked_sm_clocks.clear();
+
+  options_.report.pivot_tags.push_back({"sm_clock", ""});
+
+  int result = 0;
+
+  for (size_t pass = 0; pass < clocks.size() && !result; ++pass) {
+
+    for (int device : options_.device.devices) {
+      if (PowerMonitor::lock_sm_clock(device, clocks[pass]) != Status::kSuccess) {
+        std::cerr << "Error: failed to lock the SM clock of device " << device << " to "
+          << clocks[pass] << " MHz [--lock-sm-clocks]" << std::endl;
+        result = 1;
+      }
+    }
+
+    if (!result) {
+      options_.report.pivot_tags.back().second = std::to_string(clocks[pass]);
+
+      // Later passes add their results to the report written by the first pass
+      if (pass > 0) {
+        options_.report.append = true;
+      }
+
+      result = profile_operations_();
+    }
+
+    for (int device : options_.device.devices) {
+      (void)PowerMonitor::reset_sm_clock(device);
+    }
+  }
+
+  return result;
+}
+
+/// Profiles all operations with the current options
+int CutlassProfiler::profile_operations_() {
+
+  if (!options_.trace.empty()) {
+    return profile_trace_replay_();
+  }
+
   // Keep track of all device memory tensor in map
   DeviceContext device_context;
 
@@ -171,6 +242,301 @@ int CutlassProfiler::profile_() {
     }
   }
 
+  if (!options_.report.tuning_db_path.empty()) {
+    library::GemmAutotuneCache tuning_db;
+
+    // Later passes of a locked clock sweep add their entries to the database of the first pass
+    if (options_.report.append) {
+      (void)tuning_db.load(options_.report.tuning_db_path);
+    }
+
+    for (auto const &profiler : operation_profilers_) {
+      profiler->export_tuning_db(tuning_db);
+    }
+
+    if (tuning_db.save(options_.report.tuning_db_path) != Status::kSuccess) {
+      std::cerr << "Error: failed to write tuning database '" << options_.report.tuning_db_path
+        << "' [--export-tuning-db]" << std::endl;
+      result = 1;
+    }
+  }
+
+  return result;
+}
+
+/// Profiles the operations of a production trace in order and summarizes the step time
+///
+/// Each trace entry is profiled as a single-problem testlist run of its kernel. Entries marked
+/// L2-hot reuse one copy of their operands so they stay cache resident; cold entries cycle through
+/// enough copies to defeat the L2. The step time is the repeat-weighted sum of the per-entry
+/// runtimes.
+int CutlassProfiler::profile_trace_replay_() {
+
+  struct TraceStep {
+    std::string operation_name;
+    int repeat;
+    bool l2_hot;
+    double runtime;
+  };
+
+  library::Manifest const &manifest = library::Singleton::get().manifest;
+
+  DeviceContext device_context;
+  std::vector<TraceStep> steps;
+
+  for (size_t index = 0; index < options_.trace.size(); ++index) {
+
+    Options::TraceEntry const &entry = options_.trace[index];
+
+    // Find the profiler of the named kernel's operation kind
+    OperationProfiler *profiler = nullptr;
+    for (auto const &operation : manifest) {
+      if (operation->description().name == entry.operation_name) {
+        for (auto &candidate : operation_profilers_) {
+          if (candidate->kind() == operation->description().kind) {
+            profiler = candidate.get();
+            break;
+          }
+        }
+        break;
+      }
+    }
+
+    if (!profiler) {
+      std::cerr << "Error: trace operation '" << entry.operation_name << "' not found in the manifest" << std::endl;
+      return 1;
+    }
+
+    Options entry_options(options_);
+    entry_options.trace = {entry};
+    entry_options.operation_names = {entry.operation_name};
+    entry_options.operation_problems.clear();
+    entry_options.operation_problems[entry.operation_name] = {entry.problem};
+    if (entry.l2_hot) {
+      entry_options.profiling.workspace_count = 1;
+    }
+    entry_options.report.pivot_tags.push_back({"trace_index", std::to_string(index)});
+
+    // Entries after the first add their results to the same report
+    if (index > 0) {
+      entry_options.report.append = true;
+    }
+
+    profiler->retained_results().clear();
+
+    int result = profiler->profile_all(entry_options, manifest, device_context);
+    if (result) {
+      return result;
+    }
+
+    double runtime = 0;
+    for (auto const &profiled : profiler->retained_results()) {
+      if (profiled.provider == library::Provider::kCUTLASS && profiled.good() &&
+          (runtime == 0 || profiled.runtime < runtime)) {
+        runtime = profiled.runtime;
+      }
+    }
+    profiler->retained_results().clear();
+
+    if (runtime == 0) {
+      std::cerr << "Warning: trace operation " << index << " ('" << entry.operation_name
+        << "') was not profiled and is excluded from the step time" << std::endl;
+    }
+
+    steps.push_back({entry.operation_name, entry.repeat, entry.l2_hot, runtime});
+  }
+
+  //
+  // Summarize the step
+  //
+
+  double step_time = 0;
+  for (auto const &step : steps) {
+    step_time += step.runtime * step.repeat;
+  }
+
+  auto print_csv = [&](std::ostream &out) {
+    out << "Index,Operation,Repeat,L2,Runtime,TotalRuntime,StepFraction\n";
+    for (size_t index = 0; index < steps.size(); ++index) {
+      TraceStep const &step = steps[index];
+      double total = step.runtime * step.repeat;
+      out << index
+        << "," << step.operation_name
+        << "," << step.repeat
+        << "," << (step.l2_hot ? "hot" : "cold")
+        << "," << step.runtime
+        << "," << total
+        << "," << (step_time > 0 ? total / step_time : 0) << "\n";
+    }
+  };
+
+  if (!options_.report.output_path.empty()) {
+    std::string base_path = options_.report.output_path;
+    base_path = base_path.substr(0, base_path.rfind(".csv"));
+    std::string trace_path = base_path + ".trace.csv";
+
+    std::ofstream output(trace_path);
+    if (!output.good()) {
+      std::cerr << "Could not open output file at path '" << trace_path << "'" << std::endl;
+      return 1;
+    }
+    print_csv(output);
+
+    if (options_.report.verbose) {
+      std::cout << "\nWrote trace summary to '" << trace_path << "'" << std::endl;
+    }
+  }
+
+  if (options_.report.verbose) {
+    std::cout << "\n\n=============================\n\n"
+      << "Trace Replay: " << steps.size() << " operations, step time " << step_time << " ms\n\n";
+    print_csv(std::cout);
+  }
+
+  return 0;
+}
+
+/// Partitions the problem space across all listed devices and profiles the partitions concurrently
+///
+/// Each worker thread owns one device and a private CutlassProfiler whose options list only that
+/// device. Workers write their results to per-device CSV files, which are merged into the
+/// requested output file once every worker has finished.
+int CutlassProfiler::profile_parallel_sweep_() {
+
+  if (options_.report.output_path.empty()) {
+    std::cerr << "Error: --parallel-sweep requires --output to be set" << std::endl;
+    return 1;
+  }
+
+  size_t worker_count = options_.device.devices.size();
+
+  std::string base_path = options_.report.output_path;
+  base_path = base_path.substr(0, base_path.rfind(".csv"));
+
+  auto worker_base_path = [&](size_t worker) {
+    return base_path + ".device" + std::to_string(options_.device.device_id(worker));
+  };
+
+  std::vector<Options> worker_options;
+  worker_options.reserve(worker_count);
+
+  for (size_t worker = 0; worker < worker_count; ++worker) {
+    worker_options.push_back(options_);
+
+    Options &options = worker_options.back();
+    options.device.devices = {options_.device.device_id(worker)};
+    options.device.properties = {options_.device.properties[worker]};
+    options.profiling.partition_index = int(worker);
+    options.profiling.partition_count = int(worker_count);
+
+    // Workers write fresh per-device files; the user's append setting applies to the merged report
+    options.report.append = false;
+    options.report.output_path = worker_base_path(worker) + ".csv";
+    if (!options_.report.junit_output_path.empty()) {
+      std::string junit_path = options_.report.junit_output_path;
+      junit_path = junit_path.substr(0, junit_path.rfind(".xml"));
+      junit_path = junit_path.substr(0, junit_path.rfind(".junit"));
+      options.report.junit_output_path = junit_path + ".device" +
+        std::to_string(options_.device.device_id(worker)) + ".junit.xml";
+    }
+
+    // Interleaved pretty-printing from several threads is unreadable; the merged CSV is the report
+    options.report.verbose = false;
+  }
+
+  if (options_.report.verbose) {
+    std::cout << "Parallel sweep across " << worker_count << " devices, writing '"
+      << options_.report.output_path << "'" << std::endl;
+  }
+
+  std::vector<int> worker_results(worker_count, 0);
+  std::vector<std::thread> workers;
+
+  for (size_t worker = 0; worker < worker_count; ++worker) {
+    workers.emplace_back([&, worker]() {
+      try {
+        if (cudaSetDevice(worker_options[worker].device.device_id(0)) != cudaSuccess) {
+          throw std::runtime_error("cudaSetDevice() failed.");
+        }
+        CutlassProfiler profiler(worker_options[worker]);
+        worker_results[worker] = profiler.profile_();
+      }
+      catch (std::exception const &e) {
+        std::cerr << "Error: parallel sweep worker on device "
+          << worker_options[worker].device.device_id(0) << " failed: " << e.what() << std::endl;
+        worker_results[worker] = 1;
+      }
+    });
+  }
+
+  for (auto &thread : workers) {
+    thread.join();
+  }
+
+  int result = 0;
+  for (int worker_result : worker_results) {
+    result |= worker_result;
+  }
+
+  //
+  // Merge the per-device reports of each operation kind, keeping a single CSV header
+  //
+
+  for (auto & profiler : operation_profilers_) {
+
+    if (options_.operation_kind != library::OperationKind::kInvalid &&
+        options_.operation_kind != profiler->kind()) {
+      continue;
+    }
+
+    std::string suffix = "." + std::string(library::to_string(profiler->kind())) + ".csv";
+    std::string merged_path = base_path + suffix;
+
+    bool print_header = true;
+    if (options_.report.append) {
+      std::ifstream existing(merged_path);
+      print_header = !existing.is_open();
+    }
+
+    std::ofstream merged;
+
+    for (size_t worker = 0; worker < worker_count; ++worker) {
+
+      std::string worker_path = worker_base_path(worker) + suffix;
+      std::ifstream input(worker_path);
+
+      if (!input.is_open()) {
+        continue;
+      }
+
+      if (!merged.is_open()) {
+        merged.open(merged_path, options_.report.append ? std::ios::app : std::ios::out);
+        if (!merged.good()) {
+          std::cerr << "Could not open output file at path '" << merged_path << "'" << std::endl;
+          return 1;
+        }
+      }
+
+      std::string line;
+      bool is_header = true;
+      while (std::getline(input, line)) {
+        if (is_header) {
+          is_header = false;
+          if (!print_header) {
+            continue;
+          }
+          print_header = false;
+        }
+        if (!line.empty()) {
+          merged << line << "\n";
+        }
+      }
+
+      input.close();
+      std::remove(worker_path.c_str());
+    }
+  }
+
   return result;
 }
 
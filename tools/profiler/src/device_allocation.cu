@@ -43,6 +43,7 @@
 #include "cutlass/util/reference/host/tensor_fill.h"
 #include "cutlass/util/host_tensor.h"
 #include "cutlass/util/tensor_view_io.h"
+#include "cutlass/util/tensor_npy_io.h"
 
 #include "cutlass/library/util.h"
 
@@ -571,12 +572,12 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     throw std::runtime_error("Attempting to initialize invalid allocation.");
   }
 
-  // Instantiate calls to CURAND here. This file takes a long time to compile for
-  // this reason.
+  // Fill with the counter-based Philox generator, which needs no per-thread RNG state and
+  // writes 128b vectors. This file takes a long time to compile because of these instantiations.
 
   switch (type_) {
   case library::NumericTypeID::kF16:
-    cutlass::reference::device::BlockFillRandom<cutlass::half_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<cutlass::half_t>(
       reinterpret_cast<cutlass::half_t *>(pointer_),
       capacity_,
       seed,
@@ -584,7 +585,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kBF16:
-    cutlass::reference::device::BlockFillRandom<cutlass::bfloat16_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<cutlass::bfloat16_t>(
       reinterpret_cast<cutlass::bfloat16_t *>(pointer_),
       capacity_,
       seed,
@@ -592,7 +593,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kTF32:
-    cutlass::reference::device::BlockFillRandom<cutlass::tfloat32_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<cutlass::tfloat32_t>(
       reinterpret_cast<cutlass::tfloat32_t *>(pointer_),
       capacity_,
       seed,
@@ -600,7 +601,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kF32:
-    cutlass::reference::device::BlockFillRandom<float>(
+    cutlass::reference::device::BlockFillRandomPhilox<float>(
       reinterpret_cast<float *>(pointer_),
       capacity_,
       seed,
@@ -608,7 +609,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kCBF16:
-    cutlass::reference::device::BlockFillRandom<complex<bfloat16_t>>(
+    cutlass::reference::device::BlockFillRandomPhilox<complex<bfloat16_t>>(
       reinterpret_cast<complex<bfloat16_t> *>(pointer_),
       capacity_,
       seed,
@@ -616,7 +617,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kCTF32:
-    cutlass::reference::device::BlockFillRandom<cutlass::complex<cutlass::tfloat32_t>>(
+    cutlass::reference::device::BlockFillRandomPhilox<cutlass::complex<cutlass::tfloat32_t>>(
       reinterpret_cast<cutlass::complex<cutlass::tfloat32_t> *>(pointer_),
       capacity_,
       seed,
@@ -624,7 +625,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kCF32:
-    cutlass::reference::device::BlockFillRandom<cutlass::complex<float>>(
+    cutlass::reference::device::BlockFillRandomPhilox<cutlass::complex<float>>(
       reinterpret_cast<cutlass::complex<float> *>(pointer_),
       capacity_,
       seed,
@@ -632,7 +633,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kFE4M3:
-    cutlass::reference::device::BlockFillRandom<cutlass::float_e4m3_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<cutlass::float_e4m3_t>(
       reinterpret_cast<cutlass::float_e4m3_t *>(pointer_),
       capacity_,
       seed,
@@ -640,7 +641,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kFE5M2:
-    cutlass::reference::device::BlockFillRandom<cutlass::float_e5m2_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<cutlass::float_e5m2_t>(
       reinterpret_cast<cutlass::float_e5m2_t *>(pointer_),
       capacity_,
       seed,
@@ -648,7 +649,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kFUE4M3:
-    cutlass::reference::device::BlockFillRandom<cutlass::float_ue4m3_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<cutlass::float_ue4m3_t>(
       reinterpret_cast<cutlass::float_ue4m3_t *>(pointer_),
       capacity_,
       seed,
@@ -656,7 +657,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kFUE8M0:
-    cutlass::reference::device::BlockFillRandom<cutlass::float_ue8m0_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<cutlass::float_ue8m0_t>(
       reinterpret_cast<cutlass::float_ue8m0_t *>(pointer_),
       capacity_,
       seed,
@@ -664,7 +665,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kFE2M3:
-    cutlass::reference::device::BlockFillRandom<cutlass::float_e2m3_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<cutlass::float_e2m3_t>(
       reinterpret_cast<cutlass::float_e2m3_t *>(pointer_),
       capacity_,
       seed,
@@ -672,7 +673,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kFE3M2:
-    cutlass::reference::device::BlockFillRandom<cutlass::float_e3m2_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<cutlass::float_e3m2_t>(
       reinterpret_cast<cutlass::float_e3m2_t *>(pointer_),
       capacity_,
       seed,
@@ -680,7 +681,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kFE2M1:
-    cutlass::reference::device::BlockFillRandom<cutlass::float_e2m1_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<cutlass::float_e2m1_t>(
       reinterpret_cast<cutlass::float_e2m1_t *>(pointer_),
       capacity_,
       seed,
@@ -688,7 +689,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kF64:
-    cutlass::reference::device::BlockFillRandom<double>(
+    cutlass::reference::device::BlockFillRandomPhilox<double>(
       reinterpret_cast<double *>(pointer_),
       capacity_,
       seed,
@@ -696,7 +697,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kCF64:
-    cutlass::reference::device::BlockFillRandom<complex<double>>(
+    cutlass::reference::device::BlockFillRandomPhilox<complex<double>>(
       reinterpret_cast<complex<double> *>(pointer_),
       capacity_,
       seed,
@@ -704,7 +705,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kS2:
-    cutlass::reference::device::BlockFillRandom<int2b_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<int2b_t>(
       reinterpret_cast<int2b_t *>(pointer_),
       capacity_,
       seed,
@@ -712,7 +713,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kS4:
-    cutlass::reference::device::BlockFillRandom<int4b_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<int4b_t>(
       reinterpret_cast<int4b_t *>(pointer_),
       capacity_,
       seed,
@@ -720,7 +721,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kS8:
-    cutlass::reference::device::BlockFillRandom<int8_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<int8_t>(
       reinterpret_cast<int8_t *>(pointer_),
       capacity_,
       seed,
@@ -728,7 +729,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kS16:
-    cutlass::reference::device::BlockFillRandom<int16_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<int16_t>(
       reinterpret_cast<int16_t *>(pointer_),
       capacity_,
       seed,
@@ -736,7 +737,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kS32:
-    cutlass::reference::device::BlockFillRandom<int32_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<int32_t>(
       reinterpret_cast<int32_t *>(pointer_),
       capacity_,
       seed,
@@ -744,7 +745,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kS64:
-    cutlass::reference::device::BlockFillRandom<int64_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<int64_t>(
       reinterpret_cast<int64_t *>(pointer_),
       capacity_,
       seed,
@@ -752,7 +753,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kB1:
-    cutlass::reference::device::BlockFillRandom<uint1b_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<uint1b_t>(
       reinterpret_cast<uint1b_t *>(pointer_),
       capacity_,
       seed,
@@ -760,7 +761,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kU2:
-    cutlass::reference::device::BlockFillRandom<uint2b_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<uint2b_t>(
       reinterpret_cast<uint2b_t *>(pointer_),
       capacity_,
       seed,
@@ -768,7 +769,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kU4:
-    cutlass::reference::device::BlockFillRandom<uint4b_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<uint4b_t>(
       reinterpret_cast<uint4b_t *>(pointer_),
       capacity_,
       seed,
@@ -776,7 +777,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kU8:
-    cutlass::reference::device::BlockFillRandom<uint8_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<uint8_t>(
       reinterpret_cast<uint8_t *>(pointer_),
       capacity_,
       seed,
@@ -784,7 +785,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kU16:
-    cutlass::reference::device::BlockFillRandom<uint16_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<uint16_t>(
       reinterpret_cast<uint16_t *>(pointer_),
       capacity_,
       seed,
@@ -792,7 +793,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kU32:
-    cutlass::reference::device::BlockFillRandom<uint32_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<uint32_t>(
       reinterpret_cast<uint32_t *>(pointer_),
       capacity_,
       seed,
@@ -800,7 +801,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kU64:
-    cutlass::reference::device::BlockFillRandom<uint64_t>(
+    cutlass::reference::device::BlockFillRandomPhilox<uint64_t>(
       reinterpret_cast<uint64_t *>(pointer_),
       capacity_,
       seed,
@@ -2399,6 +2400,89 @@ void DeviceAllocation::write_tensor_csv(
   }
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NumPy dtype of a library numeric type. Types without a NumPy equivalent are raw void records.
+static std::string npy_descr(library::NumericTypeID type) {
+  switch (type) {
+    case library::NumericTypeID::kF16: return "<f2";
+    case library::NumericTypeID::kF32: return "<f4";
+    case library::NumericTypeID::kF64: return "<f8";
+    case library::NumericTypeID::kS8:  return "|i1";
+    case library::NumericTypeID::kU8:  return "|u1";
+    case library::NumericTypeID::kS16: return "<i2";
+    case library::NumericTypeID::kU16: return "<u2";
+    case library::NumericTypeID::kS32: return "<i4";
+    case library::NumericTypeID::kU32: return "<u4";
+    case library::NumericTypeID::kS64: return "<i8";
+    case library::NumericTypeID::kU64: return "<u8";
+    default: break;
+  }
+
+  int bits = library::sizeof_bits(type);
+  if (bits >= 8) {
+    return "|V" + std::to_string(bits / 8);
+  }
+  return "|u1";
+}
+
+/// Writes a tensor to a binary .npy file holding its raw storage
+void DeviceAllocation::write_tensor_npy(std::string const &path) {
+
+  std::vector<uint8_t> host_data(bytes());
+  copy_to_host(host_data.data());
+
+  // Packed tensors keep their logical shape. Batches are the slowest-varying mode, so they lead a
+  // C-order shape and trail a Fortran-order one. Anything else is written as a flat array.
+  int64_t elements = batch_count_;
+  for (int dim : extent_) {
+    elements *= dim;
+  }
+
+  bool packed = library::sizeof_bits(type_) >= 8 && !extent_.empty() &&
+                size_t(elements) == capacity_;
+
+  std::vector<int64_t> shape;
+  bool fortran_order = false;
+
+  if (packed && (layout_ == library::LayoutTypeID::kRowMajor ||
+                 layout_ == library::LayoutTypeID::kTensorNHWC ||
+                 layout_ == library::LayoutTypeID::kTensorNDHWC)) {
+    if (batch_count_ > 1) {
+      shape.push_back(batch_count_);
+    }
+    shape.insert(shape.end(), extent_.begin(), extent_.end());
+  }
+  else if (packed && layout_ == library::LayoutTypeID::kColumnMajor) {
+    shape.insert(shape.end(), extent_.begin(), extent_.end());
+    if (batch_count_ > 1) {
+      shape.push_back(batch_count_);
+    }
+    fortran_order = true;
+  }
+  else if (library::sizeof_bits(type_) >= 8) {
+    shape.push_back(int64_t(capacity_));
+  }
+  else {
+    shape.push_back(int64_t(host_data.size()));
+  }
+
+  npy::write(path, npy_descr(type_), shape, fortran_order, host_data.data(), host_data.size());
+}
+
+/// Replaces the tensor's contents with the storage held in a binary .npy file
+void DeviceAllocation::load_tensor_npy(std::string const &path) {
+
+  npy::MappedFile file(path);
+
+  if (file.bytes() != bytes()) {
+    throw std::runtime_error(path + " holds " + std::to_string(file.bytes()) +
+                             " bytes, but the tensor occupies " + std::to_string(bytes()));
+  }
+
+  copy_from_host(file.data());
+}
+
 template <typename Element, typename Layout>
 static void tensor_fill_tensor_view(DeviceAllocation &allocation, Element val = Element()) {
   Coord<Layout::kRank> extent;
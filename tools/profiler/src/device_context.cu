@@ -222,6 +222,13 @@ DeviceAllocation *DeviceContext::allocate_and_initialize_tensor(
     );
   }
 
+  // Replace generated data with user-provided operands
+  for (auto const &tensor_file : options.initialization.tensor_files) {
+    if (tensor_file.first == name) {
+      allocation->load_tensor_npy(tensor_file.second);
+    }
+  }
+
   return allocation;
 }
 
@@ -0,0 +1,710 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Distributed GEMM Profiler
+*/
+
+#include <iostream>
+#include <stdexcept>
+#include <iomanip>
+#include <ios>
+
+#include "cutlass/core_io.h"
+
+#include "cutlass/profiler/distributed_gemm_operation_profiler.h"
+#include "cutlass/profiler/gpu_timer.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Ctor
+DistributedGemmOperationProfiler::DistributedGemmOperationProfiler(Options const &options):
+  OperationProfiler(
+    options,
+    library::OperationKind::kDistributedGemm,
+    {
+      {ArgumentTypeID::kInteger, {"m", "problem-size::m"}, "M dimension of the global GEMM problem space"},
+      {ArgumentTypeID::kInteger, {"n", "problem-size::n"}, "N dimension of the global GEMM problem space"},
+      {ArgumentTypeID::kInteger, {"k", "problem-size::k"}, "K dimension of the global GEMM problem space"},
+      {ArgumentTypeID::kTensor, {"A"}, "Tensor storing the A operand"},
+      {ArgumentTypeID::kTensor, {"B"}, "Tensor storing the B operand"},
+      {ArgumentTypeID::kTensor, {"C"}, "Tensor storing the C operand"},
+      {ArgumentTypeID::kTensor, {"D"}, "Tensor storing the D output"},
+      {ArgumentTypeID::kScalar, {"alpha", "epilogue::alpha"}, "Epilogue scalar alpha"},
+      {ArgumentTypeID::kScalar, {"beta", "epilogue::beta"}, "Epilogue scalar beta"},
+      {ArgumentTypeID::kInteger, {"batch_count", "batch-count"}, "Number of GEMMs computed in one batch"},
+      {ArgumentTypeID::kInteger, {"tp"}, "Number of devices the GEMM is distributed over"},
+      {ArgumentTypeID::kEnumerated, {"dist_schedule", "dist-schedule"}, "Tiling and communication schedule (ag_rotating_a, ag_rotating_b, rs_tiling_a, rs_tiling_b, ag_rs_2d)"},
+      {ArgumentTypeID::kInteger, {"copy_sms", "copy-sms"}, "SMs reserved for peer copies (0: copy engines)"},
+    }
+  ) {
+
+  description_ = "      Distributed (tensor parallel) GEMM. D = alpha * A*B + beta * C over --tp devices";
+}
+
+/// Destructor
+DistributedGemmOperationProfiler::~DistributedGemmOperationProfiler() {
+  free_rank_workspace_();
+}
+
+/// Prints usage statement for the math function
+void DistributedGemmOperationProfiler::print_usage(std::ostream &out) const {
+  out << "Distributed GEMM" << "\n\n";
+
+  OperationProfiler::print_usage(out);
+}
+
+/// Prints examples
+void DistributedGemmOperationProfiler::print_examples(std::ostream &out) const {
+
+  out << "\nExamples:\n\n"
+    << "Profile all schedules of a problem on the first 8 devices (operations spanning more devices are skipped):\n"
+    << "  $ cutlass_profiler --operation=distributed_gemm --devices=0,1,2,3,4,5,6,7 --m=16384 --n=106496 --k=16384\n\n"
+
+    << "Profile the All Gather schedules on 4 devices:\n"
+    << "  $ cutlass_profiler --operation=distributed_gemm --devices=0,1,2,3 --tp=4 --dist_schedule=ag_rotating_a,ag_rotating_b\n\n"
+
+    << "Drive peer copies with 8 SMs instead of the copy engines:\n"
+    << "  $ cutlass_profiler --operation=distributed_gemm --devices=0,1,2,3 --copy_sms=8\n\n"
+
+    << "Select the fastest schedule of each layer and save it in a tuning database:\n"
+    << "  $ cutlass_profiler --operation=distributed_gemm --devices=0,1,2,3,4,5,6,7 \\ \n"
+    << "   --m=8192 --n=8192,28672 --k=8192,28672 --export-tuning-db=dist_gemm.txt\n\n";
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+Status DistributedGemmOperationProfiler::DistributedGemmProblem::parse(
+  library::DistributedGemmDescription const &operation_desc,
+  ProblemSpace const &problem_space,
+  ProblemSpace::Problem const &problem) {
+
+  if (!arg_as_int(this->m, "m", problem_space, problem)) {
+    // default value
+    this->m = 1024;
+  }
+
+  if (!arg_as_int(this->n, "n", problem_space, problem)) {
+    // default value
+    this->n = 1024;
+  }
+
+  if (!arg_as_int(this->k, "k", problem_space, problem)) {
+    // default value
+    this->k = 1024;
+  }
+
+  if (!arg_as_int(this->batch_count, "batch_count", problem_space, problem)) {
+    // default value
+    this->batch_count = 1;
+  }
+
+  if (!arg_as_int(this->copy_sms, "copy_sms", problem_space, problem)) {
+    // default value
+    this->copy_sms = 0;
+  }
+
+  int64_t tp = 0;
+  if (arg_as_int(tp, "tp", problem_space, problem) && tp != operation_desc.tp) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  library::DistributedGemmSchedule schedule = library::DistributedGemmSchedule::kInvalid;
+  if (arg_as_DistributedGemmSchedule(schedule, "dist_schedule", problem_space, problem) &&
+      schedule != operation_desc.schedule) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  if (!tensor_description_satisfies(operation_desc.gemm.A, "A", problem_space, problem)) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  if (!tensor_description_satisfies(operation_desc.gemm.B, "B", problem_space, problem)) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  if (!tensor_description_satisfies(operation_desc.gemm.C, "C", problem_space, problem)) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  if (!tensor_description_satisfies(operation_desc.gemm.D, "D", problem_space, problem)) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  if (!arg_as_scalar(
+    this->alpha,
+    operation_desc.gemm.element_epilogue,
+    "alpha",
+    problem_space,
+    problem)) {
+
+    if (!cast_from_double(this->alpha, operation_desc.gemm.element_epilogue, 1)) {
+      return Status::kErrorInternal;
+    }
+  }
+
+  if (!arg_as_scalar(
+    this->beta,
+    operation_desc.gemm.element_epilogue,
+    "beta",
+    problem_space,
+    problem)) {
+
+    if (!cast_from_double(this->beta, operation_desc.gemm.element_epilogue, 0)) {
+      return Status::kErrorInternal;
+    }
+  }
+
+  // Every device holds one shard of each operand
+  if (m % operation_desc.shard_A.m() || k % operation_desc.shard_A.k() ||
+      n % operation_desc.shard_B.n() || k % operation_desc.shard_B.k() ||
+      m % operation_desc.shard_C.m() || n % operation_desc.shard_C.n()) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  return Status::kSuccess;
+}
+
+/// Total number of bytes loaded
+int64_t DistributedGemmOperationProfiler::DistributedGemmProblem::bytes(
+  library::DistributedGemmDescription const &operation_desc) const {
+
+  library::GemmDescription const &gemm_desc = operation_desc.gemm;
+
+  // Input bytes read and Output bytes written for the global problem
+  int64_t bytes =
+    int64_t(library::sizeof_bits(gemm_desc.A.element) * m / 8) * k +
+    int64_t(library::sizeof_bits(gemm_desc.B.element) * n / 8) * k +
+    int64_t(library::sizeof_bits(gemm_desc.C.element) * m / 8) * n;
+
+  // Set is_beta_zero true if beta is zero
+  bool is_beta_zero = std::all_of(beta.begin(), beta.end(), [](uint8_t i) { return i==0; });
+
+  // Output bytes read for the gemm problem for non-zero beta values
+  if (!is_beta_zero) {
+    bytes += int64_t(library::sizeof_bits(gemm_desc.C.element) * m / 8) * n;
+  }
+
+  bytes *= batch_count;
+
+  return bytes;
+}
+
+/// Total number of flops computed
+int64_t DistributedGemmOperationProfiler::DistributedGemmProblem::flops(
+  library::DistributedGemmDescription const &operation_desc) const {
+
+  return (int64_t(m) * n * k + m * n) * 2 * batch_count;
+}
+
+/// Initializes a performance result
+void DistributedGemmOperationProfiler::DistributedGemmProblem::initialize_result(
+  PerformanceResult &result,
+  library::DistributedGemmDescription const &operation_desc,
+  ProblemSpace const &problem_space) {
+
+  result.arguments.resize(problem_space.rank());
+
+  library::GemmDescription const &gemm_desc = operation_desc.gemm;
+
+  set_argument(result, "A", problem_space,
+    std::string(library::to_string(gemm_desc.A.element)) + ":" + library::to_string(gemm_desc.A.layout));
+
+  set_argument(result, "B", problem_space,
+    std::string(library::to_string(gemm_desc.B.element)) + ":" + library::to_string(gemm_desc.B.layout));
+
+  set_argument(result, "C", problem_space,
+    std::string(library::to_string(gemm_desc.C.element)) + ":" + library::to_string(gemm_desc.C.layout));
+
+  set_argument(result, "D", problem_space,
+    std::string(library::to_string(gemm_desc.D.element)) + ":" + library::to_string(gemm_desc.D.layout));
+
+  set_argument(result, "m", problem_space, m);
+  set_argument(result, "n", problem_space, n);
+  set_argument(result, "k", problem_space, k);
+
+  set_argument(result, "batch_count", problem_space, batch_count);
+  set_argument(result, "tp", problem_space, operation_desc.tp);
+  set_argument(result, "dist_schedule", problem_space, library::to_string(operation_desc.schedule));
+  set_argument(result, "copy_sms", problem_space, copy_sms);
+
+  set_argument(result, "alpha", problem_space,
+    library::lexical_cast(alpha, gemm_desc.element_epilogue));
+
+  set_argument(result, "beta", problem_space,
+    library::lexical_cast(beta, gemm_desc.element_epilogue));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Extracts the problem dimensions
+Status DistributedGemmOperationProfiler::initialize_configuration(
+  Options const &options,
+  PerformanceReport &report,
+  DeviceContext &device_context,
+  library::Operation const *operation,
+  ProblemSpace const &problem_space,
+  ProblemSpace::Problem const &problem) {
+
+  library::DistributedGemmDescription const &operation_desc =
+    static_cast<library::DistributedGemmDescription const &>(operation->description());
+
+  // Operations spanning more devices than requested with --devices are skipped
+  if (operation_desc.tp > int(options.device.devices.size())) {
+    return Status::kErrorNotSupported;
+  }
+
+  Status status = problem_.parse(operation_desc, problem_space, problem);
+
+  if (status != Status::kSuccess) {
+    return status;
+  }
+
+  configuration_ = library::DistributedGemmConfiguration();
+  configuration_.problem_size.m() = int(problem_.m);
+  configuration_.problem_size.n() = int(problem_.n);
+  configuration_.problem_size.k() = int(problem_.k);
+  configuration_.batch_count = int(problem_.batch_count);
+  configuration_.alpha = problem_.alpha.data();
+  configuration_.beta = problem_.beta.data();
+  configuration_.copy_sm_count = int(problem_.copy_sms);
+
+  initialize_result_(this->model_result_, options, operation_desc, problem_space);
+
+  return operation->can_implement(&configuration_, nullptr);
+}
+
+/// Initializes the performance result
+void DistributedGemmOperationProfiler::initialize_result_(
+  PerformanceResult &result,
+  Options const &options,
+  library::DistributedGemmDescription const &operation_desc,
+  ProblemSpace const &problem_space) {
+
+  result.provider = library::Provider::kCUTLASS;
+  result.disposition = Disposition::kNotRun;
+  result.status = Status::kSuccess;
+  result.operation_name = operation_desc.name;
+
+  problem_.initialize_result(result, operation_desc, problem_space);
+
+  OperationProfiler::initialize_result_(result, operation_desc, problem_space);
+
+  result.bytes = problem_.bytes(operation_desc);
+  result.flops = problem_.flops(operation_desc);
+  result.runtime = 0;
+  result.runtime_vector.resize(options.device.devices.size(), 0);
+}
+
+/// Enables peer access between each pair of the first `tp` devices
+Status DistributedGemmOperationProfiler::enable_peer_access_(Options const &options, int tp) {
+
+  for (int i = 0; i < tp; ++i) {
+    CUDA_CHECK(cudaSetDevice(options.device.device_id(i)));
+
+    for (int j = 0; j < tp; ++j) {
+      if (i == j) {
+        continue;
+      }
+
+      int can_access_peer = 0;
+      CUDA_CHECK(cudaDeviceCanAccessPeer(&can_access_peer, options.device.device_id(i), options.device.device_id(j)));
+      if (!can_access_peer) {
+        return Status::kErrorNotSupported;
+      }
+
+      cudaError_t result = cudaDeviceEnablePeerAccess(options.device.device_id(j), 0);
+      if (result == cudaErrorPeerAccessAlreadyEnabled) {
+        // clear the error bit
+        (void)cudaGetLastError();
+      }
+      else if (result != cudaSuccess) {
+        return Status::kErrorInternal;
+      }
+    }
+  }
+
+  return Status::kSuccess;
+}
+
+/// Destroys the streams of each rank and releases the rank workspaces
+void DistributedGemmOperationProfiler::free_rank_workspace_() {
+  for (auto &workspace : rank_workspace_) {
+    if (workspace.stream) {
+      (void)cudaStreamDestroy(workspace.stream);
+    }
+  }
+  rank_workspace_.clear();
+}
+
+/// Initializes workspace
+Status DistributedGemmOperationProfiler::initialize_workspace(
+  Options const &options,
+  PerformanceReport &report,
+  DeviceContext &device_context,
+  library::Operation const *operation,
+  ProblemSpace const &problem_space,
+  ProblemSpace::Problem const &problem) {
+
+  library::DistributedGemmDescription const &operation_desc =
+    static_cast<library::DistributedGemmDescription const &>(operation->description());
+
+  int const tp = operation_desc.tp;
+
+  Status status = enable_peer_access_(options, tp);
+  if (status != Status::kSuccess) {
+    return status;
+  }
+
+  free_rank_workspace_();
+  rank_workspace_.resize(tp);
+
+  ptr_A_.assign(tp, nullptr);
+  ptr_B_.assign(tp, nullptr);
+  ptr_C_.assign(tp, nullptr);
+  ptr_D_.assign(tp, nullptr);
+  ptr_workspace_.assign(tp, nullptr);
+
+  // Extents of the shard held by each device
+  int shard_m_A = int(problem_.m) / operation_desc.shard_A.m();
+  int shard_k_A = int(problem_.k) / operation_desc.shard_A.k();
+  int shard_n_B = int(problem_.n) / operation_desc.shard_B.n();
+  int shard_k_B = int(problem_.k) / operation_desc.shard_B.k();
+  int shard_m_C = int(problem_.m) / operation_desc.shard_C.m();
+  int shard_n_C = int(problem_.n) / operation_desc.shard_C.n();
+
+  library::GemmDescription const &gemm_desc = operation_desc.gemm;
+
+  for (int rank = 0; rank < tp; ++rank) {
+    DistributedGemmRankWorkspace &workspace = rank_workspace_[rank];
+
+    CUDA_CHECK(cudaSetDevice(options.device.device_id(rank)));
+    CUDA_CHECK(cudaStreamCreateWithFlags(&workspace.stream, cudaStreamNonBlocking));
+
+    if (options.execution_mode != ExecutionMode::kDryRun) {
+      int seed_shift = rank * 3;
+      std::string suffix = "_" + std::to_string(rank);
+
+      int64_t lda = DeviceAllocation::get_packed_layout(gemm_desc.A.layout, {shard_m_A, shard_k_A}).front();
+      int64_t ldb = DeviceAllocation::get_packed_layout(gemm_desc.B.layout, {shard_k_B, shard_n_B}).front();
+      int64_t ldc = DeviceAllocation::get_packed_layout(gemm_desc.C.layout, {shard_m_C, shard_n_C}).front();
+
+      workspace.A = device_context.allocate_and_initialize_tensor(
+        options,
+        "A" + suffix,
+        gemm_desc.A.element,
+        gemm_desc.A.layout,
+        {shard_m_A, shard_k_A},
+        {int(lda)},
+        problem_.batch_count,
+        seed_shift++,
+        rank // device_index
+      );
+
+      workspace.B = device_context.allocate_and_initialize_tensor(
+        options,
+        "B" + suffix,
+        gemm_desc.B.element,
+        gemm_desc.B.layout,
+        {shard_k_B, shard_n_B},
+        {int(ldb)},
+        problem_.batch_count,
+        seed_shift++,
+        rank // device_index
+      );
+
+      workspace.C = device_context.allocate_and_initialize_tensor(
+        options,
+        "C" + suffix,
+        gemm_desc.C.element,
+        gemm_desc.C.layout,
+        {shard_m_C, shard_n_C},
+        {int(ldc)},
+        problem_.batch_count,
+        seed_shift++,
+        rank // device_index
+      );
+
+      workspace.Computed = device_context.allocate_tensor(
+        options,
+        "D" + suffix,
+        gemm_desc.D.element,
+        gemm_desc.D.layout,
+        {shard_m_C, shard_n_C},
+        {int(ldc)},
+        problem_.batch_count,
+        rank // device_index
+      );
+
+      ptr_A_[rank] = workspace.A->data();
+      ptr_B_[rank] = workspace.B->data();
+      ptr_C_[rank] = workspace.C->data();
+      ptr_D_[rank] = workspace.Computed->data();
+    }
+  }
+
+  configuration_.A = ptr_A_.data();
+  configuration_.B = ptr_B_.data();
+  configuration_.C = ptr_C_.data();
+  configuration_.D = ptr_D_.data();
+  configuration_.workspace = ptr_workspace_.data();
+
+  //
+  // Initialize the CUTLASS operation
+  //
+
+  if (options.profiling.provider_enabled(library::Provider::kCUTLASS)) {
+
+    if (options.execution_mode != ExecutionMode::kDryRun) {
+
+      // Peers access each other's workspace, so all of them are allocated before any rank is
+      // initialized
+      for (int rank = 0; rank < tp; ++rank) {
+        DistributedGemmRankWorkspace &workspace = rank_workspace_[rank];
+        CUDA_CHECK(cudaSetDevice(options.device.device_id(rank)));
+
+        configuration_.device_idx = rank;
+
+        uint64_t workspace_size = operation->get_host_workspace_size(&configuration_);
+        workspace.host_workspace.resize(workspace_size, 0);
+
+        workspace_size = operation->get_device_workspace_size(&configuration_, nullptr);
+        workspace.device_workspace.reset(library::NumericTypeID::kU8, workspace_size);
+        ptr_workspace_[rank] = workspace.device_workspace.data();
+      }
+
+      for (int rank = 0; rank < tp && status == Status::kSuccess; ++rank) {
+        DistributedGemmRankWorkspace &workspace = rank_workspace_[rank];
+        CUDA_CHECK(cudaSetDevice(options.device.device_id(rank)));
+
+        configuration_.device_idx = rank;
+
+        status = operation->initialize(
+          &configuration_,
+          workspace.host_workspace.data(),
+          workspace.device_workspace.data(),
+          workspace.stream);
+      }
+
+      // Every rank must be initialized before any rank runs
+      for (int rank = 0; rank < tp; ++rank) {
+        CUDA_CHECK(cudaSetDevice(options.device.device_id(rank)));
+        CUDA_CHECK(cudaStreamSynchronize(rank_workspace_[rank].stream));
+      }
+    }
+
+    //
+    // If CUTLASS is enabled, generate a result for it
+    //
+    results_.push_back(model_result_);
+    results_.back().provider = library::Provider::kCUTLASS;
+    results_.back().op_kind = library::OperationKind::kDistributedGemm;
+    results_.back().disposition = Disposition::kNotRun;
+  }
+
+  return status;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Verifies CUTLASS against references
+bool DistributedGemmOperationProfiler::verify_cutlass(
+  Options const &options,
+  PerformanceReport &report,
+  DeviceContext &device_context,
+  library::Operation const *operation,
+  ProblemSpace const &problem_space,
+  ProblemSpace::Problem const &problem) {
+
+  if (!options.profiling.provider_enabled(library::Provider::kCUTLASS)) {
+    return true;
+  }
+
+  if (options.execution_mode == ExecutionMode::kDryRun) {
+    return true;
+  }
+
+  //
+  // Run the CUTLASS operation on all ranks
+  //
+
+  for (size_t rank = 0; rank < rank_workspace_.size(); ++rank) {
+    DistributedGemmRankWorkspace &workspace = rank_workspace_[rank];
+    CUDA_CHECK(cudaSetDevice(options.device.device_id(rank)));
+
+    results_.back().status = operation->run(
+      nullptr,
+      workspace.host_workspace.data(),
+      workspace.device_workspace.data(),
+      workspace.stream);
+
+    if (results_.back().status != Status::kSuccess) {
+      break;
+    }
+  }
+
+  for (size_t rank = 0; rank < rank_workspace_.size(); ++rank) {
+    CUDA_CHECK(cudaSetDevice(options.device.device_id(rank)));
+    if (cudaStreamSynchronize(rank_workspace_[rank].stream) != cudaSuccess) {
+      results_.back().status = Status::kErrorInternal;
+    }
+  }
+
+  if (results_.back().status != Status::kSuccess) {
+    results_.back().disposition = Disposition::kFailed;
+    return false;
+  }
+
+  // Shards are gathered and reduced differently by each schedule, so there is no reference to
+  // verify against yet
+  results_.back().disposition = Disposition::kNotVerified;
+
+  // Return true means continue profiling
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Measures performance results
+bool DistributedGemmOperationProfiler::profile(
+  Options const &options,
+  PerformanceReport &report,
+  DeviceContext &device_context,
+  library::Operation const *operation,
+  ProblemSpace const &problem_space,
+  ProblemSpace::Problem const &problem) {
+
+  if (options.profiling.provider_enabled(library::Provider::kCUTLASS)) {
+
+    auto launch_rank = [&](int rank, cudaStream_t stream, int iteration) {
+      DistributedGemmRankWorkspace &workspace = rank_workspace_[rank];
+      return operation->run(
+        nullptr,
+        workspace.host_workspace.data(),
+        workspace.device_workspace.data(),
+        stream);
+    };
+
+    std::vector<cudaStream_t> streams(rank_workspace_.size());
+    for (size_t rank = 0; rank < streams.size(); ++rank) {
+      streams[rank] = rank_workspace_[rank].stream;
+    }
+
+    results_.back().status = profile_distributed_kernel_(
+      results_.back(),
+      options,
+      launch_rank,
+      streams);
+
+    library::DistributedGemmDescription const &operation_desc =
+      static_cast<library::DistributedGemmDescription const &>(operation->description());
+
+    record_tuning_entry_(options, results_.back(), operation_desc);
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Records a profiled operation in tuning_records_ if it is the fastest seen for the problem
+void DistributedGemmOperationProfiler::record_tuning_entry_(
+  Options const &options,
+  PerformanceResult const &result,
+  library::DistributedGemmDescription const &operation_desc) {
+
+  if (options.report.tuning_db_path.empty() || result.status != Status::kSuccess) {
+    return;
+  }
+
+  double gflops = result.gflops_per_sec();
+  if (!(gflops > 0)) {
+    return;
+  }
+
+  library::GemmDescription const &gemm_desc = operation_desc.gemm;
+
+  library::GemmFunctionalKey functional_key(
+    gemm_desc.provider,
+    gemm_desc.gemm_kind,
+    gemm_desc.tile_description.math_instruction.element_accumulator,
+    gemm_desc.element_epilogue,
+    gemm_desc.A.element,
+    gemm_desc.A.layout,
+    gemm_desc.transform_A,
+    gemm_desc.B.element,
+    gemm_desc.B.layout,
+    gemm_desc.transform_B,
+    gemm_desc.C.element,
+    gemm_desc.C.layout,
+    gemm_desc.D.element,
+    gemm_desc.D.layout
+  );
+
+  // Schedules spanning different numbers of devices are not interchangeable
+  std::string key = library::autotune_key(
+    functional_key,
+    options.device.compute_capability(0),
+    operation_desc.tp,
+    int(problem_.m),
+    int(problem_.n),
+    int(problem_.k),
+    int(problem_.batch_count));
+
+  auto it = tuning_records_.find(key);
+  if (it != tuning_records_.end() && it->second.gflops >= gflops) {
+    return;
+  }
+
+  TuningRecord record;
+  record.gflops = gflops;
+  record.selection.operation_name = operation_desc.name;
+
+  tuning_records_[key] = record;
+}
+
+/// Records the fastest schedule of each profiled problem
+void DistributedGemmOperationProfiler::export_tuning_db(library::GemmAutotuneCache &tuning_db) const {
+  for (auto const &entry : tuning_records_) {
+    tuning_db.insert(entry.first, entry.second.selection);
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
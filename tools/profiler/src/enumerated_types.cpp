@@ -221,6 +221,181 @@ SaveWorkspace from_string<SaveWorkspace>(std::string const &str) {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+static struct {
+  char const *text;
+  char const *pretty;
+  WorkspaceFormat enumerant;
+}
+WorkspaceFormat_enumerants[] = {
+  {"csv", "CSV", WorkspaceFormat::kCsv},
+  {"npy", "NPY", WorkspaceFormat::kNpy}
+};
+
+/// Converts a WorkspaceFormat enumerant to a string
+char const *to_string(WorkspaceFormat format, bool pretty) {
+
+  for (auto const & possible : WorkspaceFormat_enumerants) {
+    if (format == possible.enumerant) {
+      if (pretty) {
+        return possible.pretty;
+      }
+      else {
+        return possible.text;
+      }
+    }
+  }
+
+  return pretty ? "Invalid" : "invalid";
+}
+
+/// Parses a WorkspaceFormat enumerant from a string
+template <>
+WorkspaceFormat from_string<WorkspaceFormat>(std::string const &str) {
+
+  for (auto const & possible : WorkspaceFormat_enumerants) {
+    if ((str.compare(possible.text) == 0) ||
+        (str.compare(possible.pretty) == 0)) {
+      return possible.enumerant;
+    }
+  }
+
+  return WorkspaceFormat::kInvalid;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+static struct {
+  char const *text;
+  char const *pretty;
+  CacheState enumerant;
+}
+CacheState_enumerants[] = {
+  {"rotate", "Rotate", CacheState::kRotate},
+  {"cold", "Cold", CacheState::kCold},
+  {"warm", "Warm", CacheState::kWarm},
+  {"weight-hot", "WeightHot", CacheState::kWeightHot}
+};
+
+/// Converts a CacheState enumerant to a string
+char const *to_string(CacheState cache_state, bool pretty) {
+
+  for (auto const & possible : CacheState_enumerants) {
+    if (cache_state == possible.enumerant) {
+      if (pretty) {
+        return possible.pretty;
+      }
+      else {
+        return possible.text;
+      }
+    }
+  }
+
+  return pretty ? "Invalid" : "invalid";
+}
+
+/// Parses a CacheState enumerant from a string
+template <>
+CacheState from_string<CacheState>(std::string const &str) {
+
+  for (auto const & possible : CacheState_enumerants) {
+    if ((str.compare(possible.text) == 0) ||
+        (str.compare(possible.pretty) == 0)) {
+      return possible.enumerant;
+    }
+  }
+
+  return CacheState::kInvalid;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+static struct {
+  char const *text;
+  char const *pretty;
+  InterferenceKind enumerant;
+}
+InterferenceKind_enumerants[] = {
+  {"none", "None", InterferenceKind::kNone},
+  {"dram", "Dram", InterferenceKind::kDram},
+  {"sm", "Sm", InterferenceKind::kSm}
+};
+
+/// Converts an InterferenceKind enumerant to a string
+char const *to_string(InterferenceKind kind, bool pretty) {
+
+  for (auto const & possible : InterferenceKind_enumerants) {
+    if (kind == possible.enumerant) {
+      if (pretty) {
+        return possible.pretty;
+      }
+      else {
+        return possible.text;
+      }
+    }
+  }
+
+  return pretty ? "Invalid" : "invalid";
+}
+
+/// Parses an InterferenceKind enumerant from a string
+template <>
+InterferenceKind from_string<InterferenceKind>(std::string const &str) {
+
+  for (auto const & possible : InterferenceKind_enumerants) {
+    if ((str.compare(possible.text) == 0) ||
+        (str.compare(possible.pretty) == 0)) {
+      return possible.enumerant;
+    }
+  }
+
+  return InterferenceKind::kInvalid;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+static struct {
+  char const *text;
+  char const *pretty;
+  VerificationMode enumerant;
+}
+VerificationMode_enumerants[] = {
+  {"full", "Full", VerificationMode::kFull},
+  {"sampled", "Sampled", VerificationMode::kSampled}
+};
+
+/// Converts a VerificationMode enumerant to a string
+char const *to_string(VerificationMode mode, bool pretty) {
+
+  for (auto const & possible : VerificationMode_enumerants) {
+    if (mode == possible.enumerant) {
+      if (pretty) {
+        return possible.pretty;
+      }
+      else {
+        return possible.text;
+      }
+    }
+  }
+
+  return pretty ? "Invalid" : "invalid";
+}
+
+/// Parses a VerificationMode enumerant from a string
+template <>
+VerificationMode from_string<VerificationMode>(std::string const &str) {
+
+  for (auto const & possible : VerificationMode_enumerants) {
+    if ((str.compare(possible.text) == 0) ||
+        (str.compare(possible.pretty) == 0)) {
+      return possible.enumerant;
+    }
+  }
+
+  return VerificationMode::kInvalid;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 static struct {
   char const *text;
   char const *pretty;
@@ -80,6 +80,7 @@ GemmOperationProfiler::GemmOperationProfiler(Options const &options):
       {ArgumentTypeID::kInteger, {"use_pdl", "use-pdl"}, "Use PDL (true, false)"}, 
       {ArgumentTypeID::kEnumerated, {"enable_sm90_mixed_dtype_shuffle_test", "enable-sm90-mixed-dtype-shuffle-test"}, "Enable SM90 mixed input data type kernel shuffle layout test (true, false)"},
       {ArgumentTypeID::kInteger, {"swizzle_size", "swizzle-size"}, "Size to swizzle"},
+      {ArgumentTypeID::kInteger, {"mma_promotion_interval", "mma-promotion-interval"}, "MMAs between FP8 accumulator promotions (0: never, -1: kernel default)"},
     },
     { library::Provider::kCUBLAS}
   ) {
@@ -253,6 +254,11 @@ Status GemmOperationProfiler::GemmProblem::parse(
     this->swizzle_size = 1;
   }
 
+  if (!arg_as_int(this->mma_promotion_interval, "mma_promotion_interval", problem_space, problem)) {
+    // default value
+    this->mma_promotion_interval = -1;
+  }
+
   if (!arg_as_RasterOrder(this->raster_order, "raster_order", problem_space, problem)) {
     // default value
     this->raster_order = library::RasterOrder::kHeuristic;
@@ -455,6 +461,7 @@ void GemmOperationProfiler::GemmProblem::initialize_result(
   set_argument(result, "batch_count", problem_space, batch_count);
   set_argument(result, "raster_order", problem_space, library::to_string(raster_order));
   set_argument(result, "swizzle_size", problem_space, swizzle_size);
+  set_argument(result, "mma_promotion_interval", problem_space, mma_promotion_interval);
   set_argument(result, "use_pdl", problem_space, library::to_string(use_pdl));
   set_argument(result, "enable_sm90_mixed_dtype_shuffle_test", problem_space, library::to_string(enable_sm90_mixed_dtype_shuffle_test));
 
@@ -560,6 +567,7 @@ Status GemmOperationProfiler::initialize_configuration(
     gemm_workspace_[i].arguments.beta = problem_.beta.data();
     gemm_workspace_[i].arguments.pointer_mode = library::ScalarPointerMode::kHost;
     gemm_workspace_[i].arguments.swizzle_size = problem_.swizzle_size;
+    gemm_workspace_[i].arguments.mma_promotion_interval = problem_.mma_promotion_interval;
     gemm_workspace_[i].arguments.raster_order = problem_.raster_order;
     gemm_workspace_[i].arguments.cluster_shape = {int(problem_.cluster_m), int(problem_.cluster_n), int(problem_.cluster_k)}; 
     gemm_workspace_[i].arguments.cluster_shape_fallback = {int(problem_.cluster_m_fallback), int(problem_.cluster_n_fallback), int(problem_.cluster_k_fallback)}; 
@@ -654,6 +662,47 @@ Status GemmOperationProfiler::initialize_configuration(
   return status;
 }
 
+/// The estimate counts the waves of threadblock tiles, each costing the larger of its MMA work and
+/// a nominal operand traffic term which penalizes narrow tiles. It only needs to rank candidates.
+double GemmOperationProfiler::estimate_runtime_(
+  Options const &options,
+  library::OperationDescription const &operation_desc,
+  ProblemSpace const &problem_space,
+  ProblemSpace::Problem const &problem) const {
+
+  // Multiply-accumulates per operand element loaded at which a tile stops being bandwidth-bound
+  double const kNominalRidge = 64;
+
+  int m = 1024, n = 1024, k = 1024, batch_count = 1;
+  arg_as_int(m, "m", problem_space, problem);
+  arg_as_int(n, "n", problem_space, problem);
+  arg_as_int(k, "k", problem_space, problem);
+  arg_as_int(batch_count, "batch_count", problem_space, problem);
+
+  auto const &tile = operation_desc.tile_description;
+  int64_t tile_m = tile.threadblock_shape.m();
+  int64_t tile_n = tile.threadblock_shape.n();
+  int64_t tile_k = tile.threadblock_shape.k();
+
+  if (tile_m <= 0 || tile_n <= 0 || tile_k <= 0) {
+    return 0;
+  }
+
+  // Dynamic cluster shapes are encoded as zero
+  int64_t cluster_size = int64_t(std::max(tile.cluster_shape.m(), 1)) *
+    std::max(tile.cluster_shape.n(), 1) * std::max(tile.cluster_shape.k(), 1);
+  int64_t sm_count = options.device.get_sm_count(0);
+  int64_t tiles_per_wave = std::max<int64_t>((sm_count / cluster_size) * cluster_size, 1);
+
+  int64_t tiles = ((m + tile_m - 1) / tile_m) * ((n + tile_n - 1) / tile_n) * std::max(batch_count, 1);
+  int64_t waves = (tiles + tiles_per_wave - 1) / tiles_per_wave;
+  int64_t k_iterations = (k + tile_k - 1) / tile_k;
+
+  double tile_cost = std::max(double(tile_m * tile_n), kNominalRidge * double(tile_m + tile_n));
+
+  return double(waves) * double(k_iterations * tile_k) * tile_cost;
+}
+
 void GemmOperationProfiler::update_workspace_(
   GemmWorkspace &gemm_workspace,
   gemm::GemmCoord const &problem_shape,
@@ -748,6 +797,94 @@ void GemmOperationProfiler::initialize_result_(
 
 }
 
+/// Records a profiled configuration under the autotuning key of library::Handle
+void GemmOperationProfiler::record_tuning_entry_(
+  Options const &options,
+  PerformanceResult const &result,
+  library::GemmDescription const &operation_desc,
+  gemm::GemmCoord const &problem_shape,
+  std::array<int64_t, 3> const &leading_dim,
+  cutlass::library::RasterOrder raster_order,
+  int swizzle_size,
+  std::array<int64_t, 3> const &preferred_cluster,
+  std::array<int64_t, 3> const &fallback_cluster,
+  bool is_dynamic_cluster_enabled) {
+
+  // Handle only consumes selections for single, unbatched launches without a separate reduction
+  if (options.report.tuning_db_path.empty() || result.status != Status::kSuccess ||
+    problem_.mode != library::GemmUniversalMode::kGemm || problem_.batch_count != 1 ||
+    problem_.split_k_mode == library::SplitKMode::kParallel || gemm_workspace_.empty()) {
+    return;
+  }
+
+  double gflops = result.gflops_per_sec();
+  if (!(gflops > 0)) {
+    return;
+  }
+
+  library::GemmFunctionalKey functional_key(
+    operation_desc.provider,
+    operation_desc.gemm_kind,
+    operation_desc.tile_description.math_instruction.element_accumulator,
+    operation_desc.element_epilogue,
+    operation_desc.A.element,
+    operation_desc.A.layout,
+    operation_desc.transform_A,
+    operation_desc.B.element,
+    operation_desc.B.layout,
+    operation_desc.transform_B,
+    operation_desc.C.element,
+    operation_desc.C.layout,
+    operation_desc.D.element,
+    operation_desc.D.layout
+  );
+
+  // The alignment is derived as Handle derives it, from the extents and operand addresses
+  GemmWorkspace const &workspace = gemm_workspace_.front();
+  int alignment = library::gemm_problem_alignment(
+    problem_shape.m(), problem_shape.n(), problem_shape.k(),
+    operation_desc.A.element, workspace.A->data(), leading_dim[0], 0,
+    operation_desc.B.element, workspace.B->data(), leading_dim[1], 0,
+    operation_desc.C.element, workspace.C->data(), leading_dim[2], 0,
+    workspace.Computed->data(), leading_dim[2], 0);
+
+  std::string key = library::to_string(library::GemmAutotuneKey(
+    functional_key,
+    options.device.compute_capability(0),
+    alignment,
+    problem_shape.m(),
+    problem_shape.n(),
+    problem_shape.k()));
+
+  auto it = tuning_records_.find(key);
+  if (it != tuning_records_.end() && it->second.gflops >= gflops) {
+    return;
+  }
+
+  TuningRecord record;
+  record.gflops = gflops;
+  record.selection.operation_name = operation_desc.name;
+  record.selection.raster_order = raster_order;
+  record.selection.swizzle_size = swizzle_size;
+  record.selection.split_k_slices = problem_.split_k_slices;
+
+  if (is_dynamic_cluster_enabled) {
+    record.selection.cluster_shape = {
+      int(preferred_cluster[0]), int(preferred_cluster[1]), int(preferred_cluster[2])};
+    record.selection.cluster_shape_fallback = {
+      int(fallback_cluster[0]), int(fallback_cluster[1]), int(fallback_cluster[2])};
+  }
+
+  tuning_records_[key] = record;
+}
+
+/// Records the fastest operation and runtime arguments of each profiled problem
+void GemmOperationProfiler::export_tuning_db(library::GemmAutotuneCache &tuning_db) const {
+  for (auto const &entry : tuning_records_) {
+    tuning_db.insert(entry.first, entry.second.selection);
+  }
+}
+
 /// Initialize reduction problem dimensions and library::Operation
 bool GemmOperationProfiler::initialize_reduction_configuration_(
   library::Operation const *operation,
@@ -828,19 +965,8 @@ Status GemmOperationProfiler::initialize_workspace(
     cudaSetDevice(options.device.device_id(i));
 
     // Compute the number of copies of the problem to avoid L2 camping.
-    if (!options.profiling.workspace_count) {
-      int64_t bytes = problem_.bytes(operation_desc);
-      if (bytes < 3 * int64_t(options.device.properties[0].l2CacheSize)) {
-        gemm_workspace_[i].problem_count =
-          1 + int((3 * int64_t(options.device.properties[0].l2CacheSize)) / bytes);
-      }
-      else {
-        gemm_workspace_[i].problem_count = 1;
-      }
-    }
-    else {
-      gemm_workspace_[i].problem_count = options.profiling.workspace_count;
-    }
+    gemm_workspace_[i].problem_count = workspace_problem_count_(options, problem_.bytes(operation_desc));
+    gemm_workspace_[i].output_problem_count = workspace_output_count_(options, gemm_workspace_[i].problem_count);
 
     bool allocate_device_tensors = options.execution_mode != ExecutionMode::kDryRun;
     if (allocate_device_tensors) {
@@ -887,7 +1013,7 @@ Status GemmOperationProfiler::initialize_workspace(
         operation_desc.C.layout,
         {init_m, init_n},
         {init_ldc},
-        problem_.batch_count * gemm_workspace_[i].problem_count,
+        problem_.batch_count * gemm_workspace_[i].output_problem_count,
         seed_shift++,
         i // device_index
       );
@@ -899,7 +1025,7 @@ Status GemmOperationProfiler::initialize_workspace(
         operation_desc.D.layout,
         {init_m, init_n},
         {init_ldc},
-        problem_.batch_count * gemm_workspace_[i].problem_count,
+        problem_.batch_count * gemm_workspace_[i].output_problem_count,
         i // device_index
       );
 
@@ -910,7 +1036,7 @@ Status GemmOperationProfiler::initialize_workspace(
         operation_desc.D.layout,
         {init_m, init_n},
         {init_ldc},
-        problem_.batch_count * gemm_workspace_[i].problem_count,
+        problem_.batch_count * gemm_workspace_[i].output_problem_count,
         i // device_index
       );
 
@@ -1477,6 +1603,15 @@ bool GemmOperationProfiler::verify_with_reference_(
 
       handle.set_provider(provider);
 
+      // In sampled mode, the device reference overwrites only the sampled rows in a copy of the
+      // computed result, so every other element compares equal trivially
+      if (provider == library::Provider::kReferenceDevice &&
+          options.verification.mode == VerificationMode::kSampled) {
+
+        gemm_workspace_[i].Reference->copy_from_device(gemm_workspace_[i].Computed->data());
+        handle.set_reference_sampling(options.verification.sample_count, options.verification.sample_seed);
+      }
+
       Status status = handle.gemm_universal(
         problem_.mode,
         gemm_workspace_[i].configuration.problem_size.m(),
@@ -1705,7 +1840,10 @@ bool GemmOperationProfiler::profile(
         assert(!candidates.empty() && "Candidates vector should not be empty");
         auto best_iter = std::max_element(
           candidates.begin(), candidates.end(),
-          [](PerformanceResult const &a, PerformanceResult const &b) {
+          [&](PerformanceResult const &a, PerformanceResult const &b) {
+            if (options.profiling.best_kernel_by_energy) {
+              return a.gflops_per_joule() < b.gflops_per_joule();
+            }
             return a.gflops_per_sec() < b.gflops_per_sec();
           }
         );
@@ -1750,6 +1888,8 @@ bool GemmOperationProfiler::profile(
                 auto result_opt = initialize_and_profile(result_base, problem_shape, leading_dim, preferred_cluster, fallback_cluster, raster_order, swizzle_size);
                   
                 if (result_opt) {  // Only add valid results
+                  record_tuning_entry_(options, *result_opt, operation_desc, problem_shape, leading_dim,
+                    raster_order, swizzle_size, preferred_cluster, fallback_cluster, is_dynamic_cluster_enabled);
                   candidates.push_back(*result_opt);
                 }
 
@@ -1776,6 +1916,24 @@ bool GemmOperationProfiler::profile(
         nullptr,
         nullptr
       );
+
+      library::GemmDescription const &operation_desc =
+        static_cast<library::GemmDescription const &>(operation->description());
+
+      auto cluster_shape = operation_desc.tile_description.cluster_shape;
+      bool is_dynamic_cluster_enabled = cluster_shape.m() == 0 || cluster_shape.n() == 0 || cluster_shape.k() == 0;
+
+      record_tuning_entry_(
+        options,
+        results_.back(),
+        operation_desc,
+        {int(problem_.m), int(problem_.n), int(problem_.k)},
+        {problem_.lda, problem_.ldb, problem_.ldc},
+        problem_.raster_order,
+        problem_.swizzle_size,
+        {problem_.cluster_m, problem_.cluster_n, problem_.cluster_k},
+        {problem_.cluster_m_fallback, problem_.cluster_n_fallback, problem_.cluster_k_fallback},
+        is_dynamic_cluster_enabled);
     }
 
   }
@@ -1804,11 +1962,12 @@ Status GemmOperationProfiler::profile_cutlass_(
 
   auto launch_gemm = [&](int dev_id, cudaStream_t stream, int iteration) {
     int problem_idx = (iteration % gemm_workspace_[dev_id].problem_count) * problem_.batch_count;
+    int output_idx = (iteration % gemm_workspace_[dev_id].output_problem_count) * problem_.batch_count;
 
     gemm_workspace_[dev_id].arguments.A = gemm_workspace_[dev_id].A->batch_data(problem_idx);
     gemm_workspace_[dev_id].arguments.B = gemm_workspace_[dev_id].B->batch_data(problem_idx);
-    gemm_workspace_[dev_id].arguments.C = gemm_workspace_[dev_id].C->batch_data(problem_idx);
-    gemm_workspace_[dev_id].arguments.D = gemm_workspace_[dev_id].Computed->batch_data(problem_idx);
+    gemm_workspace_[dev_id].arguments.C = gemm_workspace_[dev_id].C->batch_data(output_idx);
+    gemm_workspace_[dev_id].arguments.D = gemm_workspace_[dev_id].Computed->batch_data(output_idx);
 
       if (gemm_workspace_[dev_id].arguments.is_sm90_mixed_dtype) {
         // Scale, zero, and dequantized tensors are already generated in
@@ -1821,8 +1980,8 @@ Status GemmOperationProfiler::profile_cutlass_(
       gemm_workspace_[dev_id].arguments.D                     = gemm_workspace_[dev_id].device_workspace.data();
 
       gemm_workspace_[dev_id].reduction_arguments.workspace   = gemm_workspace_[dev_id].device_workspace.data();
-      gemm_workspace_[dev_id].reduction_arguments.source      = gemm_workspace_[dev_id].C->batch_data(problem_idx);
-      gemm_workspace_[dev_id].reduction_arguments.destination = gemm_workspace_[dev_id].Computed->batch_data(problem_idx);
+      gemm_workspace_[dev_id].reduction_arguments.source      = gemm_workspace_[dev_id].C->batch_data(output_idx);
+      gemm_workspace_[dev_id].reduction_arguments.destination = gemm_workspace_[dev_id].Computed->batch_data(output_idx);
     }
 
     // Execute the CUTLASS operation
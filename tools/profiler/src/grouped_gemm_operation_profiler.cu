@@ -32,11 +32,15 @@
    \brief Execution environment
 */
 
+#include <algorithm>
 #include <bitset>
+#include <cmath>
 #include <cstdint>
 #include <iostream>
 #include <memory>
+#include <numeric>
 #include <optional>
+#include <random>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -73,6 +77,74 @@ std::vector<std::vector<int>> parseProblemSizes(std::string const& input) {
   }
   return result;
 }
+
+/// Simulates top-k routing of tokens over experts, returning the number of tokens each expert
+/// receives. Expert popularity is uniform or Zipf-distributed over a random ranking of the
+/// experts, and the `empty_groups` least popular experts receive no tokens.
+std::vector<int> routeTokens(
+  int num_groups,
+  int64_t total_tokens,
+  int top_k,
+  bool zipf,
+  double alpha,
+  int empty_groups,
+  uint64_t seed) {
+
+  std::mt19937_64 rng(seed);
+
+  std::vector<int> rank(num_groups);
+  std::iota(rank.begin(), rank.end(), 1);
+  std::shuffle(rank.begin(), rank.end(), rng);
+
+  std::vector<double> weight(num_groups);
+  for (int e = 0; e < num_groups; ++e) {
+    weight[e] = rank[e] > num_groups - empty_groups ? 0.0 :
+                zipf ? std::pow(double(rank[e]), -alpha) : 1.0;
+  }
+
+  std::discrete_distribution<int> pick(weight.begin(), weight.end());
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+  std::vector<int> tokens(num_groups, 0);
+  std::vector<int> chosen;
+
+  for (int64_t t = 0; t < total_tokens; ++t) {
+    chosen.clear();
+    while (int(chosen.size()) < top_k) {
+      // Draws are without replacement. Rejection is cheap unless a few experts dominate, in which
+      // case the remaining experts are sampled exactly.
+      int expert = -1;
+      for (int attempt = 0; attempt < 32 && expert < 0; ++attempt) {
+        int e = pick(rng);
+        if (std::find(chosen.begin(), chosen.end(), e) == chosen.end()) {
+          expert = e;
+        }
+      }
+      if (expert < 0) {
+        double remaining = 0;
+        for (int e = 0; e < num_groups; ++e) {
+          if (std::find(chosen.begin(), chosen.end(), e) == chosen.end()) {
+            remaining += weight[e];
+          }
+        }
+        double r = uniform(rng) * remaining;
+        for (int e = 0; e < num_groups; ++e) {
+          if (weight[e] > 0 && std::find(chosen.begin(), chosen.end(), e) == chosen.end()) {
+            expert = e;
+            r -= weight[e];
+            if (r <= 0) {
+              break;
+            }
+          }
+        }
+      }
+      chosen.push_back(expert);
+      ++tokens[expert];
+    }
+  }
+
+  return tokens;
+}
 } // namespace
 
 namespace cutlass {
@@ -123,7 +195,27 @@ GroupedGemmOperationProfiler::GroupedGemmOperationProfiler(Options const& option
          {ArgumentTypeID::kScalar,
           {"problem-sizes-file"},
           "File containing grouped GEMM problem sizes, where each line represents a group whose "
-          "GEMM dimensions are 'mxnxk'."}},
+          "GEMM dimensions are 'mxnxk'."},
+         {ArgumentTypeID::kInteger,
+          {"total_tokens", "total-tokens"},
+          "Generates the group sizes of an MoE layer by routing this many tokens over num_groups "
+          "experts. Tokens form the M extent of each group (N for MoE kernels); the remaining "
+          "extents come from --n --k (--m --k for MoE kernels)."},
+         {ArgumentTypeID::kInteger,
+          {"top_k", "top-k"},
+          "Number of distinct experts each token is routed to (default: 1)."},
+         {ArgumentTypeID::kScalar,
+          {"group_dist", "group-dist"},
+          "Popularity of experts when routing tokens (uniform*, zipf)."},
+         {ArgumentTypeID::kScalar,
+          {"zipf_alpha", "zipf-alpha"},
+          "Exponent of the Zipf popularity; larger values are more skewed (default: 1.0)."},
+         {ArgumentTypeID::kInteger,
+          {"empty_groups", "empty-groups"},
+          "Number of experts that receive no tokens (default: 0)."},
+         {ArgumentTypeID::kInteger,
+          {"routing_seed", "routing-seed"},
+          "Random seed of the routing simulation (default: 2019)."}},
         {library::Provider::kReferenceDevice}) {
 
   description_ = "      Grouped matrix-matrix product. D[g] = alpha[g] * A[g] * B[g] + beta[g] * "
@@ -149,6 +241,10 @@ void GroupedGemmOperationProfiler::print_examples(std::ostream& out) const {
     << "Profile a particular problem size from a file:\n"
     << "  $ cutlass_profiler --operation=GroupedGemm --problem-sizes-file=shapes.txt\n\n"
 
+    << "Profile MoE group sizes from top-2 routing of 16384 tokens over 64 Zipf-distributed experts, 8 of them empty:\n"
+    << "  $ cutlass_profiler --operation=GroupedGemm --total_tokens=16384 --num_groups=64 --n=4096 --k=7168 \\\n"
+    << "    --top_k=2 --group_dist=zipf --zipf_alpha=0.8,1.0,1.2 --empty_groups=8\n\n"
+
     << "Schmoo over problem size and beta:\n"
     << "  $ cutlass_profiler --operation=GroupedGemm --problem-sizes='[8x8x8],[16x8x16][32x32x32]' "
        "--beta=0,1,2.5\n\n"
@@ -180,7 +276,7 @@ Status GroupedGemmOperationProfiler::GroupedGemmProblem::parse(
   bool is_moe = operation_desc.is_moe;
   this->mode = library::GemmUniversalMode::kGrouped;
 
-  std::bitset<3> args_exist;
+  std::bitset<4> args_exist;
   std::string problem_sizes_str;
   args_exist[0] = arg_as_string(problem_sizes_str, "problem-sizes", problem_space, problem);
   int m, n, k;
@@ -189,6 +285,8 @@ Status GroupedGemmOperationProfiler::GroupedGemmProblem::parse(
                   arg_as_int(k, "k", problem_space, problem);
   std::string problem_file;
   args_exist[2] = arg_as_string(problem_file, "problem-sizes-file", problem_space, problem);
+  int64_t total_tokens = 0;
+  args_exist[3] = arg_as_int(total_tokens, "total_tokens", problem_space, problem);
   int max_m = 0, max_n = 0, max_k = 0;
   if (args_exist.count() == 0) {
     int num_groups = 8;
@@ -208,7 +306,7 @@ Status GroupedGemmOperationProfiler::GroupedGemmProblem::parse(
   }
   else if (args_exist.count() > 1) {
     std::cerr
-      << "Exactly one of --problem-sizes, --problem-sizes-file, or --m --n --k may be specified.\n";
+      << "Exactly one of --problem-sizes, --problem-sizes-file, --total_tokens, or --m --n --k may be specified.\n";
     return Status::kErrorInvalidProblem;
   }
   // --problem-sizes path
@@ -274,6 +372,61 @@ Status GroupedGemmOperationProfiler::GroupedGemmProblem::parse(
     }
     max_problem_size_3x = {max_m, max_n, max_k};
   }
+  // --total_tokens path
+  else if (args_exist[3]) {
+    int num_groups;
+    if (!arg_as_int(num_groups, "num_groups", problem_space, problem)) {
+      std::cerr << "num_groups must be specified if --total_tokens is set.\n";
+      return Status::kErrorInvalidProblem;
+    }
+
+    // Tokens are the varying extent of each group; the other two extents are fixed
+    int fixed_extent;
+    bool has_fixed_extent = is_moe ? arg_as_int(fixed_extent, "m", problem_space, problem)
+                                   : arg_as_int(fixed_extent, "n", problem_space, problem);
+    if (!has_fixed_extent || !arg_as_int(k, "k", problem_space, problem)) {
+      std::cerr << (is_moe ? "--m and --k" : "--n and --k") << " must be specified if --total_tokens is set.\n";
+      return Status::kErrorInvalidProblem;
+    }
+
+    int top_k = 1;
+    int empty_groups = 0;
+    int64_t routing_seed = 2019;
+    std::string group_dist = "uniform";
+    std::string zipf_alpha = "1.0";
+    arg_as_int(top_k, "top_k", problem_space, problem);
+    arg_as_int(empty_groups, "empty_groups", problem_space, problem);
+    arg_as_int(routing_seed, "routing_seed", problem_space, problem);
+    arg_as_string(group_dist, "group_dist", problem_space, problem);
+    arg_as_string(zipf_alpha, "zipf_alpha", problem_space, problem);
+
+    if (group_dist != "uniform" && group_dist != "zipf") {
+      std::cerr << "Unknown --group_dist: " << group_dist << "\n";
+      return Status::kErrorInvalidProblem;
+    }
+    if (num_groups <= 0 || total_tokens <= 0 || empty_groups < 0 || top_k <= 0 ||
+        top_k > num_groups - empty_groups) {
+      std::cerr << "Routing requires num_groups > 0, total_tokens > 0, and "
+                << "1 <= top_k <= num_groups - empty_groups.\n";
+      return Status::kErrorInvalidProblem;
+    }
+
+    std::vector<int> tokens = routeTokens(
+      num_groups, total_tokens, top_k, group_dist == "zipf", std::stod(zipf_alpha),
+      empty_groups, uint64_t(routing_seed));
+
+    problem_sizes.resize(num_groups);
+    problem_sizes_3x.resize(num_groups);
+    int max_tokens = *std::max_element(tokens.begin(), tokens.end());
+    for (int i = 0; i < num_groups; i++) {
+      int m = is_moe ? fixed_extent : tokens[i];
+      int n = is_moe ? tokens[i] : fixed_extent;
+      problem_sizes[i] = {m, n, k};
+      problem_sizes_3x[i] = {m, n, k};
+    }
+    max_problem_size_3x = is_moe ? std::vector<int32_t>{fixed_extent, max_tokens, k}
+                                 : std::vector<int32_t>{max_tokens, fixed_extent, k};
+  }
   if (is_moe) {
     for(size_t group_idx = 0; group_idx < problem_sizes.size(); group_idx++) {
       if (problem_sizes[group_idx].m() != max_problem_size_3x[0]   ||
@@ -711,19 +864,7 @@ Status GroupedGemmOperationProfiler::initialize_workspace(
     static_cast<library::GroupedGemmDescription const&>(operation->description());
 
   // Compute the number of copies of the problem to avoid L2 camping.
-  if (!options.profiling.workspace_count) {
-    int64_t bytes = problem_.bytes(operation_desc);
-    if (bytes < 3 * int64_t(options.device.properties[0].l2CacheSize)) {
-      gemm_workspace_.problem_count =
-        1 + int((3 * int64_t(options.device.properties[0].l2CacheSize)) / bytes);
-    }
-    else {
-      gemm_workspace_.problem_count = 1;
-    }
-  }
-  else {
-    gemm_workspace_.problem_count = options.profiling.workspace_count;
-  }
+  gemm_workspace_.problem_count = workspace_problem_count_(options, problem_.bytes(operation_desc));
 
   bool allocate_device_tensors = options.execution_mode != ExecutionMode::kDryRun;
   if (allocate_device_tensors) {
@@ -2184,7 +2325,10 @@ bool GroupedGemmOperationProfiler::profile_cutlass_for_fixed_shape_(
     assert(!candidates.empty() && "Candidates vector should not be empty");
     auto best_iter = std::max_element(
       candidates.begin(), candidates.end(),
-      [](PerformanceResult const &a, PerformanceResult const &b) {
+      [&](PerformanceResult const &a, PerformanceResult const &b) {
+        if (options.profiling.best_kernel_by_energy) {
+          return a.gflops_per_joule() < b.gflops_per_joule();
+        }
         return a.gflops_per_sec() < b.gflops_per_sec();
       }
     );
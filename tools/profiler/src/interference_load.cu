@@ -0,0 +1,260 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+/* \file
+   \brief Runs a background load on a device while kernels are profiled
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <new>
+#include <thread>
+
+#include <cuda/atomic>
+
+#include "cutlass/profiler/interference_load.h"
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct InterferenceControl {
+
+  /// Set by the host to release the load
+  cuda::atomic<bool> stop;
+
+  /// Number of CTAs of the load that are resident
+  cuda::atomic<int> arrived;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Number of 16B words each thread moves between polls of the stop flag
+constexpr int kDramWordsPerPoll = 64;
+
+/// Threads per CTA of the DRAM load
+constexpr int kDramThreads = 512;
+
+/// Streams reads and writes over `count` words until released. One thread per CTA polls the
+/// host-mapped stop flag between passes so the load does not saturate the host link.
+__global__ void interference_dram(uint4 *buffer, size_t count, InterferenceControl *control) {
+
+  __shared__ bool stop;
+
+  if (threadIdx.x == 0) {
+    control->arrived.fetch_add(1, cuda::memory_order_relaxed);
+  }
+
+  size_t const first = blockIdx.x * size_t(blockDim.x) + threadIdx.x;
+  size_t const stride = size_t(gridDim.x) * blockDim.x;
+  size_t idx = first;
+
+  while (true) {
+    if (threadIdx.x == 0) {
+      stop = control->stop.load(cuda::memory_order_acquire);
+    }
+    __syncthreads();
+
+    if (stop) {
+      break;
+    }
+
+    for (int i = 0; i < kDramWordsPerPoll; ++i) {
+      if (idx >= count) {
+        idx = first;
+      }
+      uint4 v = buffer[idx];
+      v.x += 1;
+      buffer[idx] = v;
+      idx += stride;
+    }
+    __syncthreads();
+  }
+}
+
+/// Holds an SM until released. The CTA is launched with the maximum shared memory per block,
+/// which keeps other CTAs off the SM; all but one thread are parked at the barrier.
+__global__ void interference_sm(InterferenceControl *control) {
+
+  if (threadIdx.x == 0) {
+    control->arrived.fetch_add(1, cuda::memory_order_relaxed);
+    while (!control->stop.load(cuda::memory_order_acquire)) {
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 700)
+      __nanosleep(1000);
+#endif
+    }
+  }
+  __syncthreads();
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+InterferenceLoad::InterferenceLoad(InterferenceKind kind, int sms, int buffer_mb):
+  kind_(kind),
+  device_id_(0),
+  ctas_(0),
+  stream_(nullptr),
+  control_(nullptr),
+  buffer_(nullptr),
+  buffer_bytes_(0),
+  running_(false) {
+
+  if (!enabled()) {
+    return;
+  }
+
+  (void)cudaGetDevice(&device_id_);
+
+  cudaDeviceProp properties;
+  if (cudaGetDeviceProperties(&properties, device_id_) != cudaSuccess) {
+    kind_ = InterferenceKind::kNone;
+    return;
+  }
+
+  ctas_ = sms > 0 ? sms : properties.multiProcessorCount / 4;
+  ctas_ = std::max(1, std::min(ctas_, properties.multiProcessorCount));
+
+  if (kind_ == InterferenceKind::kDram) {
+    buffer_bytes_ = buffer_mb > 0 ? (size_t(buffer_mb) << 20) : 4 * size_t(properties.l2CacheSize);
+    buffer_bytes_ = std::max<size_t>(buffer_bytes_, sizeof(uint4));
+  }
+}
+
+InterferenceLoad::~InterferenceLoad() {
+  (void)stop();
+
+  if (buffer_) {
+    (void)cudaFree(buffer_);
+  }
+  if (control_) {
+    control_->~InterferenceControl();
+    (void)cudaFreeHost(control_);
+  }
+  if (stream_) {
+    (void)cudaStreamDestroy(stream_);
+  }
+}
+
+Status InterferenceLoad::start() {
+
+  if (!enabled() || running_) {
+    return Status::kSuccess;
+  }
+
+  // Resources are allocated on first use and reused by later regions
+  if (!stream_ && cudaStreamCreateWithFlags(&stream_, cudaStreamNonBlocking) != cudaSuccess) {
+    return Status::kErrorInternal;
+  }
+
+  if (!control_) {
+    void *ptr = nullptr;
+    if (cudaHostAlloc(&ptr, sizeof(InterferenceControl), cudaHostAllocPortable) != cudaSuccess) {
+      return Status::kErrorMemoryAllocation;
+    }
+    control_ = new (ptr) InterferenceControl;
+  }
+
+  control_->stop.store(false, cuda::memory_order_relaxed);
+  control_->arrived.store(0, cuda::memory_order_release);
+
+  if (kind_ == InterferenceKind::kDram) {
+    if (!buffer_) {
+      if (cudaMalloc(&buffer_, buffer_bytes_) != cudaSuccess) {
+        buffer_ = nullptr;
+        return Status::kErrorMemoryAllocation;
+      }
+      (void)cudaMemsetAsync(buffer_, 0, buffer_bytes_, stream_);
+    }
+    interference_dram<<<ctas_, kDramThreads, 0, stream_>>>(
+      static_cast<uint4 *>(buffer_), buffer_bytes_ / sizeof(uint4), control_);
+  }
+  else {
+    int threads = 0;
+    int smem = 0;
+    (void)cudaDeviceGetAttribute(&threads, cudaDevAttrMaxThreadsPerBlock, device_id_);
+    (void)cudaDeviceGetAttribute(&smem, cudaDevAttrMaxSharedMemoryPerBlockOptin, device_id_);
+
+    if (cudaFuncSetAttribute(
+          interference_sm, cudaFuncAttributeMaxDynamicSharedMemorySize, smem) != cudaSuccess) {
+      return Status::kErrorInternal;
+    }
+    interference_sm<<<ctas_, threads, smem, stream_>>>(control_);
+  }
+
+  if (cudaGetLastError() != cudaSuccess) {
+    return Status::kErrorInternal;
+  }
+
+  running_ = true;
+
+  // Wait until every CTA is resident so that the profiled region starts under full load
+  auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+
+  while (control_->arrived.load(cuda::memory_order_acquire) < ctas_) {
+    if (cudaStreamQuery(stream_) != cudaErrorNotReady) {
+      running_ = false;
+      return Status::kErrorInternal;
+    }
+    if (std::chrono::steady_clock::now() > deadline) {
+      std::cerr << "Warning: only " << control_->arrived.load(cuda::memory_order_acquire)
+        << " of " << ctas_ << " CTAs of the interference load became resident." << std::endl;
+      break;
+    }
+    std::this_thread::yield();
+  }
+
+  return Status::kSuccess;
+}
+
+Status InterferenceLoad::stop() {
+
+  if (!running_) {
+    return Status::kSuccess;
+  }
+
+  control_->stop.store(true, cuda::memory_order_release);
+  running_ = false;
+
+  return cudaStreamSynchronize(stream_) == cudaSuccess ? Status::kSuccess : Status::kErrorInternal;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -33,11 +33,16 @@
 */
 
 #include <algorithm>
+#include <cmath>
 #include <stdexcept>
 #include <iomanip>
+#include <memory>
+#include <regex>
+#include <set>
 #include <cstring>
 #include <fstream>
 #include <sstream>
+#include <vector>
 
 #ifdef __unix__
 #include <unistd.h>
@@ -52,6 +57,8 @@
 #include "cutlass/profiler/options.h"
 #include "cutlass/profiler/operation_profiler.h"
 #include "cutlass/profiler/gpu_timer.h"
+#include "cutlass/profiler/power_monitor.h"
+#include "cutlass/profiler/interference_load.h"
 
 #include "cutlass/trace.h"
 
@@ -112,7 +119,11 @@ OperationProfiler::OperationProfiler(
 }
 
 /// Destructor
-OperationProfiler::~OperationProfiler() {}
+OperationProfiler::~OperationProfiler() {
+  if (l2_flush_buffer_) {
+    (void)cudaFree(l2_flush_buffer_);
+  }
+}
 
 /// Gets the schema description
 std::string const & OperationProfiler::description() const {
@@ -334,6 +345,9 @@ std::ostream& operator<<(std::ostream& out, library::OperationKind op_kind) {
   else if (op_kind == library::OperationKind::kGroupedGemm) {
     out << "kGroupedGemm";
   }
+  else if (op_kind == library::OperationKind::kDistributedGemm) {
+    out << "kDistributedGemm";
+  }
   else {
     out << "kInvalid";
   }
@@ -364,9 +378,15 @@ int OperationProfiler::profile_all(
   // 1. Construct performance report
   PerformanceReport report(options, cmdline_problem_space.argument_names(), kind_);
 
+  device_context_ = &device_context;
+
   //
   int retval = 0;
 
+  // Running count of matched (problem, operation) pairs, used to select this worker's share
+  // of the problem space during a parallel sweep
+  size_t work_item_index = 0;
+
   size_t bound = (all_operations_and_problems.empty() ? 1 : all_operations_and_problems.size());
   for (size_t i = 0; i < bound; i++) {
 
@@ -383,10 +403,153 @@ int OperationProfiler::profile_all(
     for (; continue_profiling && problem_it != problem_end; ++problem_it) {
       ProblemSpace::Problem problem = problem_it.at();
       report.next_problem();
+      best_adaptive_runtime_ = 0;
 
       // For each operation in manifest
       int matched_operation_count = 0;
+      int assigned_operation_count = 0;
       int profiled_operation_count = 0;
+
+      // Initializes, verifies and profiles one operation. Returns the best runtime (or energy,
+      // with --best-kernel-metric=energy) measured for the CUTLASS provider, or zero if none.
+      auto profile_operation = [&](library::Operation const *operation) -> double {
+
+        double measured_runtime = 0;
+        std::string operation_name(operation->description().name);
+
+        // Clear named allocations
+        device_context.free();
+
+        // A. Initialize configuration
+        Status status = this->initialize_configuration(
+          options,
+          report,
+          device_context,
+          operation,
+          problem_space,
+          problem);
+
+        if (status == Status::kErrorInternal) {
+
+          // If there was an internal error, consume the CUDA error and move to the next operation.
+          (void)cudaGetLastError();
+
+          report.append_result(model_result_);
+          return measured_runtime;
+        }
+        else if (status != Status::kSuccess) {
+          // If the workspace could not be initialized for any other reason, continue to
+          // the next operation.
+          return measured_runtime;
+        }
+
+        if (continue_profiling) {
+
+          if (options.report.print_kernel_before_running) {
+            std::cout << "Profiling kernel for JUnit test " << options.report.junit_output_path << ": "
+                      << operation_name << std::endl;
+          }
+
+          status = this->initialize_workspace(
+            options,
+            report,
+            device_context,
+            operation,
+            problem_space,
+            problem);
+
+          if (status == Status::kErrorInternal) {
+
+            // If there was an internal error, consume the CUDA error and move to the next operation.
+            (void)cudaGetLastError();
+
+            report.append_results(results_);
+            return measured_runtime;
+          }
+          else if (status != Status::kSuccess) {
+            // If the workspace could not be initialized for any other reason, continue to
+            // the next operation.
+            return measured_runtime;
+          }
+        }
+
+        //
+        // Profile CUTLASS if it is enabled
+        //
+
+        // B. Verify CUTLASS
+        if (continue_profiling && options.profiling.provider_enabled(library::Provider::kCUTLASS)) {
+
+          continue_profiling = this->verify_cutlass(
+            options,
+            report,
+            device_context,
+            operation,
+            problem_space,
+            problem);
+
+          retval |= (not continue_profiling);
+        }
+
+        if (options.execution_mode == ExecutionMode::kDryRun) {
+          report.append_results(results_);
+          results_.clear();
+          return measured_runtime;
+        }
+
+        //
+        // C. Optionally save workspace
+        //
+
+        if (options.verification.save_workspace == SaveWorkspace::kAlways) {
+          save_workspace(
+            device_context,
+            options,
+            operation->description(),
+            library::Provider::kCUTLASS);
+        }
+
+        //
+        // D. Profile
+        //
+
+        if (continue_profiling && options.profiling.enabled) {
+
+          continue_profiling = this->profile(
+            options,
+            report,
+            device_context,
+            operation,
+            problem_space,
+            problem);
+
+          // Count op as profiled, even it failed to profile
+          profiled_operation_count++;
+        }
+
+        if (!options.trace.empty()) {
+          retained_results_.insert(retained_results_.end(), results_.begin(), results_.end());
+        }
+
+        // Keep the best measurement of the CUTLASS provider to guide a pruned search
+        for (auto const &result : results_) {
+          if (result.provider == library::Provider::kCUTLASS && result.good()) {
+            double value = options.profiling.best_kernel_by_energy ? result.energy : result.runtime;
+            if (value > 0 && (measured_runtime <= 0 || value < measured_runtime)) {
+              measured_runtime = value;
+            }
+          }
+        }
+
+        report.append_results(results_);
+        results_.clear();
+
+        return measured_runtime;
+      };
+
+      // Operations matching the filters, retained when profiling is pruned by --search-top-k
+      std::vector<library::Operation const *> search_candidates;
+
       for (auto const& operation_ptr : manifest) {
 
         library::Operation const *operation = operation_ptr.get();
@@ -467,115 +630,20 @@ int OperationProfiler::profile_all(
           // we have found a kernel match, so increment the counter for match kernels
           ++matched_operation_count;
 
-          // A. Initialize configuration
-          Status status = this->initialize_configuration(
-            options,
-            report,
-            device_context,
-            operation,
-            problem_space,
-            problem);
-
-          if (status == Status::kErrorInternal) {
-
-            // If there was an internal error, consume the CUDA error and move to the next operation.
-            (void)cudaGetLastError();
-
-            report.append_result(model_result_);
+          // During a pruned search, candidates are profiled after the manifest is scanned
+          if (options.profiling.search_top_k > 0) {
+            search_candidates.push_back(operation);
             continue;
           }
-          else if (status != Status::kSuccess) {
-            // If the workspace could not be initialized for any other reason, continue to
-            // the next operation.
-            continue;
-          }
-
-          if (continue_profiling) {
-
-            if (options.report.print_kernel_before_running) {
-              std::cout << "Profiling kernel for JUnit test " << options.report.junit_output_path << ": "
-                        << operation_name << std::endl;
-            }
-
-            status = this->initialize_workspace(
-              options,
-              report,
-              device_context,
-              operation,
-              problem_space,
-              problem);
-
-            if (status == Status::kErrorInternal) {
-
-              // If there was an internal error, consume the CUDA error and move to the next operation.
-              (void)cudaGetLastError();
-
-              report.append_results(results_);
-              continue;
-            }
-            else if (status != Status::kSuccess) {
-              // If the workspace could not be initialized for any other reason, continue to
-              // the next operation.
-              continue;
-            }
-          }
-
-          //
-          // Profile CUTLASS if it is enabled
-          //
-
-          // B. Verify CUTLASS
-          if (continue_profiling && options.profiling.provider_enabled(library::Provider::kCUTLASS)) {
-
-            continue_profiling = this->verify_cutlass(
-              options,
-              report,
-              device_context,
-              operation,
-              problem_space,
-              problem);
-
-            retval |= (not continue_profiling);
-          }
 
-          if (options.execution_mode == ExecutionMode::kDryRun) {
-            report.append_results(results_);
-            results_.clear();
+          // During a parallel sweep, each worker profiles every partition_count-th matched pair
+          if ((work_item_index++ % options.profiling.partition_count) != size_t(options.profiling.partition_index)) {
             continue;
           }
 
-          //
-          // C. Optionally save workspace
-          //
-
-          if (options.verification.save_workspace == SaveWorkspace::kAlways) {
-            save_workspace(
-              device_context,
-              options,
-              operation->description(),
-              library::Provider::kCUTLASS);
-          }
-
-          //
-          // D. Profile
-          //
-
-          if (continue_profiling && options.profiling.enabled) {
-
-            continue_profiling = this->profile(
-              options,
-              report,
-              device_context,
-              operation,
-              problem_space,
-              problem);
+          ++assigned_operation_count;
 
-            // Count op as profiled, even it failed to profile
-            profiled_operation_count++;
-          }
-
-          report.append_results(results_);
-          results_.clear();
+          profile_operation(operation);
         } // if op satisfied compute capacity
 
         if (!continue_profiling) {
@@ -585,6 +653,54 @@ int OperationProfiler::profile_all(
         }
       } // for op in manifest
 
+      // Pruned search: profile the best-ranked candidates, then the neighbors of the fastest
+      // kernel found so far until no neighbor improves on it
+      if (continue_profiling && !search_candidates.empty() &&
+          (work_item_index++ % options.profiling.partition_count) == size_t(options.profiling.partition_index)) {
+
+        std::vector<std::pair<double, library::Operation const *>> ranked;
+        for (auto const *operation : search_candidates) {
+          ranked.push_back({estimate_runtime_(options, operation->description(), problem_space, problem), operation});
+        }
+        std::stable_sort(ranked.begin(), ranked.end(),
+          [](std::pair<double, library::Operation const *> const &lhs,
+             std::pair<double, library::Operation const *> const &rhs) {
+            return lhs.first < rhs.first;
+          });
+
+        std::set<library::Operation const *> visited;
+        library::Operation const *best_operation = nullptr;
+        double best_runtime = 0;
+
+        auto evaluate = [&](library::Operation const *operation) {
+          visited.insert(operation);
+          ++assigned_operation_count;
+          double runtime = profile_operation(operation);
+          if (runtime > 0 && (!best_operation || runtime < best_runtime)) {
+            best_operation = operation;
+            best_runtime = runtime;
+          }
+        };
+
+        for (size_t k = 0; continue_profiling && k < ranked.size() && k < size_t(options.profiling.search_top_k); ++k) {
+          evaluate(ranked[k].second);
+        }
+
+        library::Operation const *center = nullptr;
+        while (continue_profiling && best_operation && best_operation != center) {
+          center = best_operation;
+          for (auto const &candidate : ranked) {
+            if (!continue_profiling) {
+              break;
+            }
+            if (!visited.count(candidate.second) &&
+                is_search_neighbor_(center->description(), candidate.second->description())) {
+              evaluate(candidate.second);
+            }
+          }
+        }
+      }
+
       // If we did not find any kernels that match our filters and error_on_no_match was set, report an error
       if (options.profiling.error_on_no_match && matched_operation_count <= 0) {
         #if !NDEBUG
@@ -595,7 +711,11 @@ int OperationProfiler::profile_all(
         continue_profiling = false;
       }
 
-      if (options.profiling.error_if_nothing_is_profiled && options.profiling.enabled && profiled_operation_count <= 0) {
+      // A parallel sweep worker may legitimately be assigned none of the matched kernels for a problem
+      bool expects_profiled_operations = (options.profiling.partition_count == 1 || assigned_operation_count > 0);
+
+      if (options.profiling.error_if_nothing_is_profiled && options.profiling.enabled &&
+          expects_profiled_operations && profiled_operation_count <= 0) {
         #if !NDEBUG
         std::cerr << "Error: No kernels profiled found with kernel selection filters [--error_if_nothing_is_profiled]" << std::endl;
         #endif
@@ -607,6 +727,11 @@ int OperationProfiler::profile_all(
     } // for each problem in problem space
   }
 
+  // Fail the run if any result regressed beyond --fail-on-regression
+  if (report.failing_regression_count()) {
+    retval |= 1;
+  }
+
   return retval;
 }
 
@@ -692,12 +817,18 @@ void OperationProfiler::save_workspace(
       filename << "verified_by_" << library::to_string(verification_provider) << "_";
     }
 
-    filename << named_allocation.first + ".mat";
+    if (options.verification.workspace_format == WorkspaceFormat::kNpy) {
+      filename << named_allocation.first + ".npy";
+      allocation->write_tensor_npy(filename.str());
+    }
+    else {
+      filename << named_allocation.first + ".mat";
 
-    std::ofstream out(filename.str());
+      std::ofstream out(filename.str());
 
-    allocation->write_tensor_csv(out);
-    out << "\n";
+      allocation->write_tensor_csv(out);
+      out << "\n";
+    }
 
     if (options.report.verbose) {
       std::cout << "wrote '" << filename.str() << "'" << std::endl;
@@ -719,6 +850,19 @@ __global__ void delay(cuda::atomic<bool> const *release) {
 }
 }
 
+/// Reads `count` words so that they become L2-resident. The conditional store keeps the loads
+/// from being eliminated and never executes for the sentinel value.
+__global__ void touch_l2(uint4 const *ptr, size_t count, uint4 *sink) {
+  uint32_t acc = 0;
+  for (size_t i = blockIdx.x * size_t(blockDim.x) + threadIdx.x; i < count; i += size_t(gridDim.x) * blockDim.x) {
+    uint4 v = ptr[i];
+    acc ^= v.x ^ v.y ^ v.z ^ v.w;
+  }
+  if (acc == 0x9e3779b9u && sink) {
+    *sink = make_uint4(acc, acc, acc, acc);
+  }
+}
+
 Status predict_iters(
   int &iterations,
   Options const &options,
@@ -800,6 +944,24 @@ Status OperationProfiler::profile_kernel_w_cuda_graphs_(
     return status;
   }
 
+  // Ends an in-progress capture on device i and releases everything captured so far. Called when
+  // a launch fails mid-capture so the stream is not left in capture mode for subsequent profiling.
+  auto abort_capture = [&](size_t i) {
+    cudaGraph_t partial = nullptr;
+    (void)cudaStreamEndCapture(streams[i], &partial);
+    if (partial) {
+      (void)cudaGraphDestroy(partial);
+    }
+    for (size_t j = 0; j < i; ++j) {
+      (void)cudaSetDevice(options.device.device_id(j));
+      (void)cudaGraphExecDestroy(graphExecs[j]);
+      (void)cudaGraphDestroy(graphs[j]);
+    }
+    if (dev_count > 1) {
+      (void)cudaFreeHost(release);
+    }
+  };
+
   for (size_t i = 0; i < dev_count; ++i) {
     CUDA_CHECK(cudaSetDevice(options.device.device_id(i)));
     CUDA_CHECK(cudaStreamBeginCapture(streams[i], cudaStreamCaptureModeGlobal));
@@ -811,6 +973,7 @@ Status OperationProfiler::profile_kernel_w_cuda_graphs_(
     for (int iteration = 0; iteration < options.profiling.warmup_iterations; ++iteration) {
       Status status = func(i, streams[i], iteration);
       if (status != Status::kSuccess) {
+        abort_capture(i);
         return status;
       }
     }
@@ -821,12 +984,18 @@ Status OperationProfiler::profile_kernel_w_cuda_graphs_(
     for (; iteration < iterations; ++iteration) {
       Status status = func(i, streams[i], iteration + options.profiling.warmup_iterations);
       if (status != Status::kSuccess) {
+        abort_capture(i);
         return status;
       }
     }
     timer[i].stop(streams[i], cudaEventRecordExternal);
     CUDA_CHECK(cudaStreamEndCapture(streams[i], &graphs[i]));
     CUDA_CHECK(cudaGraphInstantiate(&graphExecs[i], graphs[i], nullptr, nullptr, 0));
+
+    // Upload the executable graph ahead of the replay so that first-launch setup cost is not
+    // attributed to the captured iterations.
+    CUDA_CHECK(cudaGraphUpload(graphExecs[i], streams[i]));
+    CUDA_CHECK(cudaStreamSynchronize(streams[i]));
   }
 
   for (size_t i = 0; i < dev_count; ++i) {
@@ -876,7 +1045,21 @@ Status OperationProfiler::profile_kernel_(
   const std::function<Status(int, cudaStream_t, int)> &func,
   const std::vector<cudaStream_t> &streams) {
 
-  if (options.profiling.use_cuda_graphs) {
+  bool flushes_l2 = (options.profiling.cache_state == CacheState::kCold ||
+                     options.profiling.cache_state == CacheState::kWeightHot);
+
+  // The background load is confined to single-device profiling and runs until this returns
+  InterferenceLoad interference(
+    streams.size() == 1 ? options.profiling.interference : InterferenceKind::kNone,
+    options.profiling.interference_sms,
+    options.profiling.interference_buffer_mb);
+
+  Status status = interference.start();
+  if (status != Status::kSuccess) {
+    return status;
+  }
+
+  if (options.profiling.use_cuda_graphs && !(flushes_l2 && streams.size() == 1)) {
     return profile_kernel_w_cuda_graphs_(result, options, func, streams);
   }
   else if (streams.size() == 1) {
@@ -888,6 +1071,110 @@ Status OperationProfiler::profile_kernel_(
   return Status::kErrorNotSupported;
 }
 
+/// Launches of a distributed kernel wait on their peers, so no device may run ahead of the others
+/// (i.e. to predict iterations) and a spinloop gate would stall every device behind the first one
+/// to block. Iterations are instead enqueued round-robin across the devices, whose launches then
+/// proceed in lockstep, and the runtime is that of the slowest device.
+Status OperationProfiler::profile_distributed_kernel_(
+  PerformanceResult &result,
+  Options const &options,
+  std::function<Status(int, cudaStream_t, int)> const &func,
+  std::vector<cudaStream_t> const &streams) {
+
+  size_t dev_count = streams.size();
+
+  auto launch_all = [&](int iteration) -> Status {
+    for (size_t i = 0; i < dev_count; ++i) {
+      CUDA_CHECK(cudaSetDevice(options.device.device_id(i)));
+      Status status = func(int(i), streams[i], iteration);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+    return Status::kSuccess;
+  };
+
+  auto synchronize_all = [&]() {
+    for (size_t i = 0; i < dev_count; ++i) {
+      CUDA_CHECK(cudaSetDevice(options.device.device_id(i)));
+      CUDA_CHECK(cudaStreamSynchronize(streams[i]));
+    }
+  };
+
+  std::vector<GpuTimer> timer;
+  for (size_t i = 0; i < dev_count; ++i) {
+    CUDA_CHECK(cudaSetDevice(options.device.device_id(i)));
+    timer.emplace_back();
+  }
+
+  sleep(options.profiling.sleep_duration);
+
+  int iteration = 0;
+  for (; iteration < options.profiling.warmup_iterations; ++iteration) {
+    Status status = launch_all(iteration);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+  }
+
+  // Predicts the iteration count from calibration launches on all devices
+  int iterations = options.profiling.iterations;
+  if (iterations == 0) {
+    constexpr int CALIBRATION_ITERS = 5;
+    CUDA_CHECK(cudaSetDevice(options.device.device_id(0)));
+    timer[0].start(streams[0]);
+    for (int i = 0; i < CALIBRATION_ITERS; ++i, ++iteration) {
+      Status status = launch_all(iteration);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+    CUDA_CHECK(cudaSetDevice(options.device.device_id(0)));
+    timer[0].stop_and_wait(streams[0]);
+
+    double est_iters = options.profiling.duration / std::max(timer[0].duration(CALIBRATION_ITERS), 1e-6);
+    constexpr uint64_t MAX_ITERS = 1'000'000;
+    iterations = int(std::min(static_cast<uint64_t>(std::ceil(est_iters)), MAX_ITERS));
+    iterations = std::max(options.profiling.min_iterations, iterations);
+  }
+
+  synchronize_all();
+
+  for (size_t i = 0; i < dev_count; ++i) {
+    CUDA_CHECK(cudaSetDevice(options.device.device_id(i)));
+    timer[i].start(streams[i]);
+  }
+
+  for (int i = 0; i < iterations; ++i, ++iteration) {
+    Status status = launch_all(iteration);
+    if (status != Status::kSuccess) {
+      synchronize_all();
+      return status;
+    }
+  }
+
+  for (size_t i = 0; i < dev_count; ++i) {
+    CUDA_CHECK(cudaSetDevice(options.device.device_id(i)));
+    timer[i].stop(streams[i]);
+  }
+
+  synchronize_all();
+
+  result.runtime = 0;
+  for (size_t i = 0; i < dev_count; ++i) {
+    CUDA_CHECK(cudaSetDevice(options.device.device_id(i)));
+    result.runtime_vector[i] = timer[i].duration(iterations);
+    result.runtime = std::max(result.runtime, result.runtime_vector[i]);
+  }
+
+  for (size_t i = 0; i < dev_count; ++i) {
+    CUDA_CHECK(cudaSetDevice(options.device.device_id(dev_count - i - 1)));
+    timer.pop_back();
+  }
+
+  return Status::kSuccess;
+}
+
 /// Method to profile GPU execution time of a kernel launched in func
 Status OperationProfiler::profile_kernel_(
   PerformanceResult& result,
@@ -895,7 +1182,21 @@ Status OperationProfiler::profile_kernel_(
   std::function<Status(cudaStream_t, int)> const& func,
   cudaStream_t stream) {
 
-  if (options.profiling.use_cuda_graphs) {
+  bool flushes_l2 = (options.profiling.cache_state == CacheState::kCold ||
+                     options.profiling.cache_state == CacheState::kWeightHot);
+
+  // Kernels are timed while the background load, if any, is resident on the device
+  InterferenceLoad interference(
+    options.profiling.interference,
+    options.profiling.interference_sms,
+    options.profiling.interference_buffer_mb);
+
+  Status status = interference.start();
+  if (status != Status::kSuccess) {
+    return status;
+  }
+
+  if (options.profiling.use_cuda_graphs && !flushes_l2) {
     auto graph_func = [&](int dev_id, cudaStream_t stream, int iteration) {
       return func(stream, iteration);
     };
@@ -913,6 +1214,15 @@ Status OperationProfiler::profile_kernel_no_cuda_graphs_(
   std::function<Status(cudaStream_t, int)> const& func,
   cudaStream_t stream) {
 
+  if (options.profiling.cache_state == CacheState::kCold ||
+      options.profiling.cache_state == CacheState::kWeightHot) {
+    return profile_kernel_flushed_(result, options, func, stream);
+  }
+
+  if (options.profiling.adaptive_precision > 0) {
+    return profile_kernel_adaptive_(result, options, func, stream);
+  }
+
   GpuTimer timer;
   // Optional sleep to limit power consumption and thermals
   sleep(options.profiling.sleep_duration);
@@ -932,6 +1242,14 @@ Status OperationProfiler::profile_kernel_no_cuda_graphs_(
     }
   }
 
+  std::unique_ptr<PowerMonitor> power_monitor;
+  if (options.profiling.measure_power) {
+    int device_id = 0;
+    (void)cudaGetDevice(&device_id);
+    power_monitor = std::make_unique<PowerMonitor>(device_id);
+    power_monitor->start();
+  }
+
   timer.start(stream);
 
   int iteration = 0;
@@ -949,6 +1267,300 @@ Status OperationProfiler::profile_kernel_no_cuda_graphs_(
   result.runtime = timer.duration(iteration);
   result.status  = status;
 
+  if (power_monitor) {
+    power_monitor->stop();
+    result.average_power    = power_monitor->average_power();
+    result.energy           = power_monitor->energy() / double(iteration);
+    result.average_sm_clock = power_monitor->average_sm_clock();
+  }
+
+  return status;
+}
+
+/// Returns the number of copies of a problem of `bytes` bytes to cycle through while profiling
+int OperationProfiler::workspace_problem_count_(Options const &options, int64_t bytes) {
+
+  if (options.profiling.workspace_count) {
+    return options.profiling.workspace_count;
+  }
+
+  // Explicit cache states control L2 residency directly and need a single copy
+  if (options.profiling.cache_state != CacheState::kRotate) {
+    return 1;
+  }
+
+  int64_t l2_bytes = int64_t(options.device.properties[0].l2CacheSize);
+  if (bytes > 0 && bytes < 3 * l2_bytes) {
+    return 1 + int((3 * l2_bytes) / bytes);
+  }
+  return 1;
+}
+
+/// Returns the number of copies of the C and D tensors among `problem_count` workspaces
+int OperationProfiler::workspace_output_count_(Options const &options, int problem_count) {
+  return options.profiling.workspace_share_cd ? 1 : problem_count;
+}
+
+/// Ranks all operations equally, so that a pruned search profiles the first matches in manifest order
+double OperationProfiler::estimate_runtime_(
+  Options const &,
+  library::OperationDescription const &,
+  ProblemSpace const &,
+  ProblemSpace::Problem const &) const {
+
+  return 0;
+}
+
+/// Operations are neighbors if their names agree once every tile, cluster and stage count is
+/// masked out, and each tile and cluster extent changes by at most a factor of two
+bool OperationProfiler::is_search_neighbor_(
+  library::OperationDescription const &lhs,
+  library::OperationDescription const &rhs) {
+
+  static std::regex const shape_pattern("[0-9]+(x[0-9]+)+");
+  static std::regex const count_pattern("_[0-9]+_");
+
+  auto masked_name = [](char const *name) {
+    std::string masked = std::regex_replace(std::string(name), shape_pattern, "#");
+    return std::regex_replace(masked, count_pattern, "_#_");
+  };
+
+  if (masked_name(lhs.name) != masked_name(rhs.name)) {
+    return false;
+  }
+
+  auto within_factor_of_two = [](int a, int b) {
+    a = std::max(a, 1);
+    b = std::max(b, 1);
+    return a <= 2 * b && b <= 2 * a;
+  };
+
+  auto const &lhs_tile = lhs.tile_description;
+  auto const &rhs_tile = rhs.tile_description;
+
+  return
+    within_factor_of_two(lhs_tile.threadblock_shape.m(), rhs_tile.threadblock_shape.m()) &&
+    within_factor_of_two(lhs_tile.threadblock_shape.n(), rhs_tile.threadblock_shape.n()) &&
+    within_factor_of_two(lhs_tile.threadblock_shape.k(), rhs_tile.threadblock_shape.k()) &&
+    within_factor_of_two(lhs_tile.cluster_shape.m(), rhs_tile.cluster_shape.m()) &&
+    within_factor_of_two(lhs_tile.cluster_shape.n(), rhs_tile.cluster_shape.n()) &&
+    within_factor_of_two(lhs_tile.cluster_shape.k(), rhs_tile.cluster_shape.k());
+}
+
+/// Method to profile GPU execution time of a kernel launched in func
+///
+/// Before each timed launch the L2 is flushed by writing a scratch buffer twice its capacity. For
+/// the weight-hot state the B operand is then read back so that it is L2-resident while the
+/// remaining operands are cold. Only the launch itself is bracketed by events.
+Status OperationProfiler::profile_kernel_flushed_(
+  PerformanceResult& result,
+  Options const& options,
+  std::function<Status(cudaStream_t, int)> const& func,
+  cudaStream_t stream) {
+
+  // Number of launches timed between host synchronizations
+  constexpr int kBatchSize = 8;
+
+  // Optional sleep to limit power consumption and thermals
+  sleep(options.profiling.sleep_duration);
+
+  Status status = Status::kSuccess;
+
+  int iterations;
+  status = predict_iters(iterations, options, func, stream);
+  if (status != Status::kSuccess) {
+    return status;
+  }
+
+  size_t flush_bytes = 2 * size_t(options.device.properties[0].l2CacheSize);
+  if (l2_flush_bytes_ < flush_bytes) {
+    if (l2_flush_buffer_) {
+      (void)cudaFree(l2_flush_buffer_);
+      l2_flush_buffer_ = nullptr;
+      l2_flush_bytes_ = 0;
+    }
+    if (cudaMalloc(&l2_flush_buffer_, flush_bytes) != cudaSuccess) {
+      l2_flush_buffer_ = nullptr;
+      return Status::kErrorMemoryAllocation;
+    }
+    l2_flush_bytes_ = flush_bytes;
+  }
+
+  // Operand kept L2-resident for the weight-hot state
+  DeviceAllocation *weights = nullptr;
+  if (options.profiling.cache_state == CacheState::kWeightHot && device_context_) {
+    for (auto const &named_allocation : *device_context_) {
+      if (named_allocation.first == "B") {
+        weights = named_allocation.second;
+        break;
+      }
+    }
+  }
+
+  auto prepare_l2 = [&]() {
+    (void)cudaMemsetAsync(l2_flush_buffer_, 0, l2_flush_bytes_, stream);
+    if (weights && weights->data()) {
+      size_t count = weights->bytes() / sizeof(uint4);
+      touch_l2<<<options.device.properties[0].multiProcessorCount, 256, 0, stream>>>(
+        static_cast<uint4 const *>(weights->data()), count, nullptr);
+    }
+  };
+
+  for (int iteration = 0; iteration < options.profiling.warmup_iterations; ++iteration) {
+    status = func(stream, iteration);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+  }
+
+  std::vector<GpuTimer> events(kBatchSize);
+  double total = 0;
+
+  int iteration = 0;
+  while (iteration < iterations) {
+
+    int batch = std::min(kBatchSize, iterations - iteration);
+
+    for (int i = 0; i < batch; ++i) {
+      prepare_l2();
+      events[i].start(stream);
+      status = func(stream, iteration + i + options.profiling.warmup_iterations);
+      if (status != Status::kSuccess) {
+        result.status = status;
+        return status;
+      }
+      events[i].stop(stream);
+    }
+
+    if (cudaStreamSynchronize(stream) != cudaSuccess) {
+      throw std::runtime_error("Failed to synchronize with CUDA stream.");
+    }
+
+    for (int i = 0; i < batch; ++i) {
+      total += events[i].duration();
+    }
+    iteration += batch;
+  }
+
+  result.runtime = total / double(iteration);
+  result.status  = status;
+
+  return status;
+}
+
+/// Method to profile GPU execution time of a kernel launched in func
+///
+/// Launches are timed individually in batches bracketed by CUDA events. After each batch the
+/// median and a distribution-free 95% confidence interval of the median (from order statistics)
+/// are computed. Sampling stops once the interval half-width is within adaptive_precision percent
+/// of the median, once the lower bound exceeds the best median seen for this problem, or once the
+/// iteration budget is exhausted.
+Status OperationProfiler::profile_kernel_adaptive_(
+  PerformanceResult& result,
+  Options const& options,
+  std::function<Status(cudaStream_t, int)> const& func,
+  cudaStream_t stream) {
+
+  // Number of launches timed between host synchronizations
+  constexpr int kBatchSize = 8;
+
+  // Two-sided 95% normal quantile
+  constexpr double kZ = 1.96;
+
+  // Optional sleep to limit power consumption and thermals
+  sleep(options.profiling.sleep_duration);
+
+  Status status = Status::kSuccess;
+
+  int max_samples;
+  status = predict_iters(max_samples, options, func, stream);
+  if (status != Status::kSuccess) {
+    return status;
+  }
+
+  int min_samples = std::max(options.profiling.min_iterations, 1);
+  max_samples = std::max(max_samples, min_samples);
+
+  for (int iteration = 0; iteration < options.profiling.warmup_iterations; ++iteration) {
+    status = func(stream, iteration);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+  }
+
+  std::vector<GpuTimer> events(kBatchSize);
+  std::vector<double> samples;
+  samples.reserve(max_samples);
+
+  double total = 0;
+  double p50 = 0, p90 = 0, ci_lower = 0, ci_upper = 0;
+
+  int iteration = options.profiling.warmup_iterations;
+
+  while (int(samples.size()) < max_samples) {
+
+    int batch = std::min(kBatchSize, max_samples - int(samples.size()));
+
+    for (int i = 0; i < batch; ++i) {
+      events[i].start(stream);
+      status = func(stream, iteration++);
+      if (status != Status::kSuccess) {
+        result.status = status;
+        return status;
+      }
+      events[i].stop(stream);
+    }
+
+    if (cudaStreamSynchronize(stream) != cudaSuccess) {
+      throw std::runtime_error("Failed to synchronize with CUDA stream.");
+    }
+
+    for (int i = 0; i < batch; ++i) {
+      samples.push_back(events[i].duration());
+      total += samples.back();
+    }
+
+    int n = int(samples.size());
+    if (n < min_samples) {
+      continue;
+    }
+
+    std::vector<double> sorted(samples);
+    std::sort(sorted.begin(), sorted.end());
+
+    auto rank = [&](double r) {
+      return std::min(std::max(int(r), 0), n - 1);
+    };
+
+    double half_width = kZ * std::sqrt(double(n)) / 2;
+
+    p50      = sorted[rank(0.5 * (n - 1) + 0.5)];
+    p90      = sorted[rank(0.9 * (n - 1) + 0.5)];
+    ci_lower = sorted[rank(std::floor(n / 2.0 - half_width))];
+    ci_upper = sorted[rank(std::ceil(n / 2.0 + half_width))];
+
+    if (0.5 * (ci_upper - ci_lower) <= 0.01 * options.profiling.adaptive_precision * p50) {
+      break;
+    }
+
+    if (options.profiling.adaptive_early_exit &&
+        best_adaptive_runtime_ > 0 && ci_lower > best_adaptive_runtime_) {
+      break;
+    }
+  }
+
+  if (best_adaptive_runtime_ == 0 || p50 < best_adaptive_runtime_) {
+    best_adaptive_runtime_ = p50;
+  }
+
+  result.runtime          = total / double(samples.size());
+  result.runtime_p50      = p50;
+  result.runtime_p90      = p90;
+  result.runtime_ci_lower = ci_lower;
+  result.runtime_ci_upper = ci_upper;
+  result.samples          = int(samples.size());
+  result.status           = status;
+
   return status;
 }
 
@@ -991,6 +1603,8 @@ void OperationProfiler::initialize_result_(
   set_argument(result, "inst_k", problem_space, operation_desc.tile_description.math_instruction.instruction_shape.k());
   set_argument(result, "min_cc", problem_space, operation_desc.tile_description.minimum_compute_capability);
   set_argument(result, "max_cc", problem_space, operation_desc.tile_description.maximum_compute_capability);
+
+  result.resources = operation_desc.resources;
 }
 
 /// Helper
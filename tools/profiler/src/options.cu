@@ -255,6 +255,20 @@ int Options::Device::compute_capability(int device_index) const {
   return properties[device_index].major * 10 + properties[device_index].minor;
 }
 
+/// Returns the theoretical peak DRAM bandwidth of the listed device in GiB/s, or zero if unknown
+double Options::Device::dram_bandwidth(int device_index) const {
+  int memory_clock_KHz = 0;
+  int bus_width_bits = 0;
+
+  if (cudaDeviceGetAttribute(&memory_clock_KHz, cudaDevAttrMemoryClockRate, device_id(device_index)) != cudaSuccess ||
+      cudaDeviceGetAttribute(&bus_width_bits, cudaDevAttrGlobalMemoryBusWidth, device_id(device_index)) != cudaSuccess) {
+    return 0;
+  }
+
+  // Double data rate: two transfers of bus_width_bits per memory clock
+  return 2.0 * double(memory_clock_KHz) * 1000.0 * double(bus_width_bits / 8) / double(1 << 30);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 Options::Initialization::Initialization(cutlass::CommandLine const &cmdline) {
@@ -291,7 +305,7 @@ Options::Initialization::Initialization(cutlass::CommandLine const &cmdline) {
     data_distribution.set_uniform(-4, 4, 0);
   }
 
-
+  cmdline.get_cmd_line_argument_pairs("tensor-file", tensor_files);
 }
 
 /// Gets the initial distribution
@@ -410,7 +424,12 @@ void Options::Initialization::print_usage(std::ostream &out) const {
 
     << "  --seed=<int>                                 "
     << "    Random number generator seed. Used to enforce deterministic" << end_of_line
-    << "      initialization.\n\n";
+    << "      initialization.\n\n"
+
+    << "  --tensor-file=<name:path>[,<name:path>...]   "
+    << "    Loads the named tensors (e.g. A, B, C) from .npy files after initialization," << end_of_line
+    << "      such as workspaces saved with --workspace-format=npy or real weight matrices." << end_of_line
+    << "      Each file must hold exactly the storage of the tensor it replaces.\n\n";
 
 }
 
@@ -490,6 +509,17 @@ void Options::Library::print_options(std::ostream &out, int indent) const {
 Options::Profiling::Profiling(cutlass::CommandLine const &cmdline) {
 
   cmdline.get_cmd_line_argument("workspace-count", workspace_count, 0);
+  cmdline.get_cmd_line_argument("workspace-share-cd", workspace_share_cd, false);
+  cmdline.get_cmd_line_argument("search-top-k", search_top_k, 0);
+
+  if (cmdline.check_cmd_line_flag("cache-state")) {
+    std::string value;
+    cmdline.get_cmd_line_argument("cache-state", value);
+    cache_state = from_string<CacheState>(value);
+    if (cache_state == CacheState::kInvalid) {
+      throw std::runtime_error("Unknown --cache-state: " + value);
+    }
+  }
   cmdline.get_cmd_line_argument("warmup-iterations", warmup_iterations, 10);
   cmdline.get_cmd_line_argument("profiling-iterations", iterations, 100);
   cmdline.get_cmd_line_argument("sleep-duration", sleep_duration, 50);
@@ -497,6 +527,38 @@ Options::Profiling::Profiling(cutlass::CommandLine const &cmdline) {
   cmdline.get_cmd_line_argument("profiling-duration", duration, 10);
   cmdline.get_cmd_line_argument("min-iterations", min_iterations, 10);
   cmdline.get_cmd_line_argument("use-cuda-graphs", use_cuda_graphs, false);
+  cmdline.get_cmd_line_argument("parallel-sweep", parallel_sweep, false);
+  cmdline.get_cmd_line_argument("adaptive-precision", adaptive_precision, 0.0);
+  cmdline.get_cmd_line_argument("adaptive-early-exit", adaptive_early_exit, true);
+  cmdline.get_cmd_line_argument("measure-power", measure_power, false);
+  cmdline.get_cmd_line_arguments("lock-sm-clocks", locked_sm_clocks);
+
+  if (cmdline.check_cmd_line_flag("interference")) {
+    std::string value;
+    cmdline.get_cmd_line_argument("interference", value);
+    interference = from_string<InterferenceKind>(value);
+    if (interference == InterferenceKind::kInvalid) {
+      throw std::runtime_error("Unknown --interference: " + value);
+    }
+  }
+  cmdline.get_cmd_line_argument("interference-sms", interference_sms, 0);
+  cmdline.get_cmd_line_argument("interference-buffer-mb", interference_buffer_mb, 0);
+
+  if (cmdline.check_cmd_line_flag("best-kernel-metric")) {
+    std::string metric;
+    cmdline.get_cmd_line_argument("best-kernel-metric", metric);
+    if (metric == "energy") {
+      best_kernel_by_energy = true;
+    }
+    else if (metric != "runtime") {
+      throw std::runtime_error("Unknown --best-kernel-metric: " + metric);
+    }
+  }
+
+  // Energy-based selection needs power measurements
+  if (best_kernel_by_energy) {
+    measure_power = true;
+  }
   cmdline.get_cmd_line_argument("enable-kernel-performance-search", enable_kernel_performance_search, false);
   cmdline.get_cmd_line_argument("enable-best-kernel-for-fixed-shape", enable_best_kernel_for_fixed_shape, false);
 
@@ -527,6 +589,21 @@ void Options::Profiling::print_usage(std::ostream &out) const {
     << "    If zero (default), the amount is chosen for each workload based on " << end_of_line
     << "    capacity of the last-level cache.\n\n"
 
+    << "  --workspace-share-cd=<bool>                  "
+    << "    If true, only A and B are replicated across workspaces and a single copy of C and D" << end_of_line
+    << "      is shared by all of them. Reduces device memory use for problems with large M and N.\n\n"
+
+    << "  --search-top-k=<K>                           "
+    << "    If positive, profiles only the K kernels ranked best for each problem by an analytical" << end_of_line
+    << "      wave and tile model, then searches the neighboring tile, cluster and stage configurations" << end_of_line
+    << "      of the fastest kernel until none is faster. If zero (default), all matching kernels are profiled.\n\n"
+
+    << "  --cache-state=<rotate|cold|warm|weight-hot>  "
+    << "    L2 state at the start of each profiled iteration. 'rotate' (default) cycles through" << end_of_line
+    << "      copies of the problem sized to defeat the L2. 'cold' flushes the L2 before every" << end_of_line
+    << "      iteration without allocating copies. 'warm' reuses one L2-resident copy." << end_of_line
+    << "      'weight-hot' flushes the L2 and then reloads the B operand (weights) into it.\n\n"
+
     << "  --profiling-iterations=<iterations>          "
     << "    Number of iterations to profile each kernel. If zero, kernels" << end_of_line
     << "      are launched up to the profiling duration. If non-zero, this overrides" << end_of_line
@@ -544,6 +621,50 @@ void Options::Profiling::print_usage(std::ostream &out) const {
     << "  --warmup-iterations=<iterations>             "
     << "    Number of iterations to execute each kernel prior to profiling.\n\n"
 
+    << "  --use-cuda-graphs=<bool>                     "
+    << "    If true, warmup and profiling iterations are captured into a CUDA graph and" << end_of_line
+    << "      timed from a single graph replay, removing host launch overhead from the" << end_of_line
+    << "      reported per-kernel runtime.\n\n"
+
+    << "  --adaptive-precision=<percent>               "
+    << "    If positive, each kernel is sampled one launch at a time until the 95% confidence" << end_of_line
+    << "      interval of its median runtime is within <percent> of the median. At least" << end_of_line
+    << "      --min-iterations samples are taken; --profiling-iterations or --profiling-duration" << end_of_line
+    << "      bounds the sample count. Reports p50, p90 and the confidence interval.\n\n"
+
+    << "  --adaptive-early-exit=<bool>                 "
+    << "    If true (default) in adaptive mode, stops sampling a kernel once it is statistically" << end_of_line
+    << "      slower than the best kernel seen for the same problem.\n\n"
+
+    << "  --measure-power=<bool>                       "
+    << "    If true, samples board power and SM clocks through NVML while kernels are timed" << end_of_line
+    << "      and reports average watts, energy per operation and GFLOP/J.\n\n"
+
+    << "  --lock-sm-clocks=<MHz>,<MHz>,...             "
+    << "    Profiles the problem space once per listed SM clock with clocks locked through" << end_of_line
+    << "      NVML (requires administrative privileges). Results are tagged with sm_clock.\n\n"
+
+    << "  --best-kernel-metric=<runtime|energy>        "
+    << "    Metric used by --enable-best-kernel-for-fixed-shape to select the best candidate." << end_of_line
+    << "      'energy' selects the highest GFLOP/J and implies --measure-power.\n\n"
+
+    << "  --interference=<none|dram|sm>                "
+    << "    Runs a background load on a separate stream while each kernel is profiled." << end_of_line
+    << "      'dram' streams reads and writes over a buffer larger than the L2 to contend for" << end_of_line
+    << "      memory bandwidth. 'sm' occupies whole SMs, as a concurrent kernel or a green context" << end_of_line
+    << "      partition would. Results are tagged with interference.\n\n"
+
+    << "  --interference-sms=<count>                   "
+    << "    Number of SMs occupied by the background load. If zero (default), a quarter of the SMs.\n\n"
+
+    << "  --interference-buffer-mb=<MiB>               "
+    << "    Size of the buffer streamed by --interference=dram. If zero (default), four times the L2.\n\n"
+
+    << "  --parallel-sweep=<bool>                      "
+    << "    If true and several --devices are listed, the (problem, kernel) pairs are" << end_of_line
+    << "      partitioned across the devices and profiled concurrently, one worker thread" << end_of_line
+    << "      per device. Requires --output; per-device results are merged into it.\n\n"
+
     << "  --sleep-duration=<duration>                  "
     << "    Number of ms to sleep between profiling periods (ms).\n\n"
 
@@ -562,6 +683,7 @@ void Options::Profiling::print_options(std::ostream &out, int indent) const {
     << indent_str(indent) << "profiling_iterations: " << iterations << "\n"
     << indent_str(indent) << "sleep_duration: " << sleep_duration << "\n"
     << indent_str(indent) << "profiling_enabled: " << enabled << "\n"
+    << indent_str(indent) << "interference: " << to_string(interference) << "\n"
     << indent_str(indent) << "providers: [";
 
   int j = 0;
@@ -613,6 +735,26 @@ Options::Verification::Verification(cutlass::CommandLine const &cmdline) {
     save_workspace = SaveWorkspace::kNever;
   }
 
+  if (cmdline.check_cmd_line_flag("workspace-format")) {
+    std::string value;
+    cmdline.get_cmd_line_argument("workspace-format", value);
+    workspace_format = from_string<WorkspaceFormat>(value);
+    if (workspace_format == WorkspaceFormat::kInvalid) {
+      throw std::runtime_error("Unknown --workspace-format: " + value);
+    }
+  }
+
+  if (cmdline.check_cmd_line_flag("verification-mode")) {
+    std::string value;
+    cmdline.get_cmd_line_argument("verification-mode", value);
+    mode = from_string<VerificationMode>(value);
+    if (mode == VerificationMode::kInvalid) {
+      throw std::runtime_error("Unknown --verification-mode: " + value);
+    }
+  }
+  cmdline.get_cmd_line_argument("verification-samples", sample_count, 1024);
+  cmdline.get_cmd_line_argument("verification-seed", sample_seed, uint64_t(2080));
+
   if (cmdline.check_cmd_line_flag("verification-providers")) {
 
     std::vector<std::string> tokens;
@@ -655,6 +797,22 @@ void Options::Verification::print_usage(std::ostream &out) const {
     << "       --save-workspace=incorrect  save workspace for incorrect results" << end_of_line
     << "       --save-workspace=always     always save workspace\n\n"
 
+    << "  --workspace-format=<csv|npy>                 "
+    << "    File format of saved workspaces. 'csv' (default) writes text; 'npy' writes the raw" << end_of_line
+    << "      tensor storage as binary NumPy files that --tensor-file can load back.\n\n"
+
+    << "  --verification-mode=<full|sampled>           "
+    << "    'full' (default) computes and compares the entire reference. 'sampled' computes" << end_of_line
+    << "      the device reference only for randomly chosen rows of 128x128 output tiles and" << end_of_line
+    << "      compares only those, reducing GEMM verification from O(MNK) to O(samples * K)." << end_of_line
+    << "      Only GEMM verification with the device reference provider is sampled.\n\n"
+
+    << "  --verification-samples=<int>                 "
+    << "    Number of output tile rows checked per problem in sampled mode (default: 1024).\n\n"
+
+    << "  --verification-seed=<int>                    "
+    << "    Seed selecting the output tile rows checked in sampled mode.\n\n"
+
     << "  --verification-providers=<providers>         "
     << "    List of providers used to verify result. (default: '*')" << end_of_line
     << "      Gemm verification-providers {cublas*}" << end_of_line
@@ -668,6 +826,8 @@ void Options::Verification::print_options(std::ostream &out, int indent) const {
     << indent_str(indent) << "verification_enabled: " << enabled << "\n"
     << indent_str(indent) << "epsilon: " << epsilon << "\n"
     << indent_str(indent) << "save_workspace: " << to_string(save_workspace) << "\n"
+    << indent_str(indent) << "workspace_format: " << to_string(workspace_format) << "\n"
+    << indent_str(indent) << "verification_mode: " << to_string(mode) << "\n"
     << indent_str(indent) << "verification_providers: [";
 
   int j = 0;
@@ -701,6 +861,7 @@ Options::Report::Report(cutlass::CommandLine const &cmdline) {
   cmdline.get_cmd_line_argument("append", append, false);
   cmdline.get_cmd_line_argument("output", output_path);
   cmdline.get_cmd_line_argument("junit-output", junit_output_path);
+  cmdline.get_cmd_line_argument("export-tuning-db", tuning_db_path);
 
   if (cmdline.check_cmd_line_flag("tags")) {
     cmdline.get_cmd_line_argument_pairs("tags", pivot_tags);
@@ -715,6 +876,14 @@ Options::Report::Report(cutlass::CommandLine const &cmdline) {
   cmdline.get_cmd_line_argument("sort-results-flops-per-sec", sort_flops_per_sec, false);
 
   cmdline.get_cmd_line_argument("print-kernel-before-running", print_kernel_before_running, false);
+
+  cmdline.get_cmd_line_argument("baseline", baseline_path);
+  cmdline.get_cmd_line_argument("regression-tolerance", regression_tolerance, 5.0);
+  cmdline.get_cmd_line_argument("fail-on-regression", fail_on_regression, 0.0);
+
+  cmdline.get_cmd_line_argument("roofline", roofline, false);
+  cmdline.get_cmd_line_argument("peak-bandwidth", peak_bandwidth, 0.0);
+  cmdline.get_cmd_line_argument("peak-gflops", peak_gflops, 0.0);
 }
 
 void Options::Report::print_usage(std::ostream &out) const {
@@ -731,6 +900,11 @@ void Options::Report::print_usage(std::ostream &out) const {
     << "  --junit-output=<path>                        "
     << "    Path to junit output file for result reporting. Operation kind and '.junit.xml' is appended.\n\n"
 
+    << "  --export-tuning-db=<path>                    "
+    << "    Writes the fastest kernel and runtime arguments (cluster shape, raster order, swizzle," << end_of_line
+    << "      split-K) of each profiled GEMM problem to <path>. cutlass::library::Handle loads it at" << end_of_line
+    << "      startup from $CUTLASS_LIBRARY_TUNING_DB.\n\n"
+
     << "  --print-kernel-before-running=<bool>                "
     << "    Prints the name of the kernel being profiled before running the kernel." << end_of_line
     << "      This is useful for determining which kernel is causing a run of the profiler to hang\n\n"
@@ -747,7 +921,30 @@ void Options::Report::print_usage(std::ostream &out) const {
     << "    Prints human-readable text to stdout. If false, nothing is written to stdout.\n\n"
 
     << "  --sort-results=<bool>                        "
-    << "    Sorts results (by flops-per-byte).\n\n";
+    << "    Sorts results (by flops-per-byte).\n\n"
+
+    << "  --baseline=<path>                            "
+    << "    Previous CSV report to compare against. Results are matched by provider, operation" << end_of_line
+    << "      and problem arguments, and baseline runtime, speedup and regression columns are added." << end_of_line
+    << "      If <path> does not exist, the operation kind and '.csv' are appended.\n\n"
+
+    << "  --regression-tolerance=<percent>             "
+    << "    Slowdown treated as noise when neither run has adaptive confidence intervals (default: 5).\n\n"
+
+    << "  --fail-on-regression=<percent>               "
+    << "    If positive, returns an error code when a regression is slower than the baseline" << end_of_line
+    << "      by more than <percent>.\n\n"
+
+    << "  --roofline=<bool>                            "
+    << "    If true, reports achieved bandwidth and math throughput as percentages of the" << end_of_line
+    << "      device peaks, and whether each result is memory- or compute-bound.\n\n"
+
+    << "  --peak-bandwidth=<GiB/s>                     "
+    << "    Peak DRAM bandwidth for --roofline. Defaults to the theoretical device bandwidth.\n\n"
+
+    << "  --peak-gflops=<GFLOP/s>                      "
+    << "    Peak math throughput for --roofline of the data type and math instruction being" << end_of_line
+    << "      profiled. If zero (default), math roofline columns are left empty.\n\n";
 }
 
 void Options::Report::print_options(std::ostream &out, int indent) const {
@@ -756,8 +953,11 @@ void Options::Report::print_options(std::ostream &out, int indent) const {
     << indent_str(indent) << "append: " << append << "\n"
     << indent_str(indent) << "output: " << output_path << "\n"
     << indent_str(indent) << "junit-output: " << junit_output_path << "\n"
+    << indent_str(indent) << "export-tuning-db: " << tuning_db_path << "\n"
     << indent_str(indent) << "print-kernel-before-running: " << print_kernel_before_running << "\n"
     << indent_str(indent) << "report-not-run: " << report_not_run << "\n"
+    << indent_str(indent) << "baseline: " << baseline_path << "\n"
+    << indent_str(indent) << "roofline: " << roofline << "\n"
     << indent_str(indent) << "tags:\n";
 
   for (auto const & tag : pivot_tags) {
@@ -901,6 +1101,66 @@ Options::Options(cutlass::CommandLine const &cmdline):
     }
   }
 
+  if (cmdline.check_cmd_line_flag("trace-file")) {
+    // Trace file has the testlist layout. Rows are kept in order, and the optional 'repeat' and
+    // 'l2' (hot or cold) columns describe how often and with what cache state each operation runs.
+    std::string filename;
+    cmdline.get_cmd_line_argument("trace-file", filename, {});
+    std::ifstream input(filename);
+    if (!input.good()) {
+      throw std::runtime_error("failed to open: " + filename);
+    }
+
+    std::string line;
+    std::vector<std::string> col_names;
+    if (std::getline(input, line)) {
+      std::stringstream ss(line);
+      std::string header;
+      while (std::getline(ss, header, ',')) {
+        col_names.push_back(header);
+      }
+    }
+
+    while (std::getline(input, line)) {
+      if (line.empty()) {
+        continue;
+      }
+
+      std::stringstream ss(line);
+      std::string item;
+
+      size_t colIdx = 0;
+      std::string operation_name;
+      int repeat = 1;
+      bool l2_hot = false;
+
+      std::unordered_map<std::string, std::string> arguments;
+
+      while (std::getline(ss, item, ',')) {
+        if (!colIdx) {
+          operation_name = item;
+        }
+        else if (colIdx < col_names.size()) {
+          if (col_names[colIdx] == "repeat") {
+            repeat = std::max(1, std::stoi(item));
+          }
+          else if (col_names[colIdx] == "l2") {
+            if (item != "hot" && item != "cold") {
+              throw std::runtime_error("Trace column 'l2' must be 'hot' or 'cold': " + item);
+            }
+            l2_hot = (item == "hot");
+          }
+          else {
+            arguments[col_names[colIdx]] = item;
+          }
+        }
+        colIdx++;
+      }
+
+      trace.push_back({operation_name, CommandLine(arguments), repeat, l2_hot});
+    }
+  }
+
   if (cmdline.check_cmd_line_flag("ignore-kernels")) {
     cmdline.get_cmd_line_arguments("ignore-kernels", excluded_operation_names);
   }
@@ -955,6 +1215,12 @@ void Options::print_usage(std::ostream &out) const {
     << "  --testlist-file=<filename>               "
     << "    A CSV, where each row is a problem, where the first column is the kernel name and the rest are the problem arguments" << end_of_line
 	<< "    The column names should match cutlass_profiler cmd line arguments. \n\n"
+
+    << "  --trace-file=<filename>                      "
+    << "    A CSV in the --testlist-file layout describing the operations of a model step in" << end_of_line
+    << "      execution order. Optional columns 'repeat' (executions per step) and 'l2' (hot for" << end_of_line
+    << "      L2-resident operands such as reused weights, cold otherwise) set each operation's" << end_of_line
+    << "      count and cache state. Reports the per-operation breakdown and total step time.\n\n"
     ;
 
   //
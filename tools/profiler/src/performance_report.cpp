@@ -37,6 +37,8 @@
 #include <iomanip>
 #include <algorithm>
 #include <cstring>
+#include <sstream>
+#include <cstdlib>
 
 #include "cutlass/library/util.h"
 
@@ -72,7 +74,18 @@ PerformanceReport::PerformanceReport(
   std::vector<std::string> const &argument_names,
   library::OperationKind const &op_kind
 ):
-  options_(options), argument_names_(argument_names), problem_index_(0), good_(true), op_kind_(op_kind) {
+  options_(options), argument_names_(argument_names), problem_index_(0), good_(true), op_kind_(op_kind),
+  failing_regression_count_(0) {
+
+  // Load the baseline before opening the output file, which may be the same file
+  if (!options_.report.baseline_path.empty()) {
+    load_baseline_();
+  }
+
+  peak_bandwidth_ = options_.report.peak_bandwidth;
+  if (options_.report.roofline && peak_bandwidth_ <= 0) {
+    peak_bandwidth_ = options_.device.dram_bandwidth(0);
+  }
 
   // Strip '.csv' if present
   std::string base_path = options_.report.output_path;
@@ -143,6 +156,14 @@ void PerformanceReport::append_result(PerformanceResult result) {
 
   result.problem_index = problem_index_;
 
+  if (options_.report.fail_on_regression > 0 && result.good()) {
+    BaselineResult const *baseline = find_baseline_(result);
+    if (baseline && is_regression_(result, *baseline) &&
+        100.0 * (result.runtime / baseline->runtime - 1.0) > options_.report.fail_on_regression) {
+      ++failing_regression_count_;
+    }
+  }
+
   if (options_.report.verbose) {
     std::cout << "\n";
     print_result_pretty_(std::cout, result) << std::flush;
@@ -234,6 +255,12 @@ PerformanceReport::~PerformanceReport() {
     output_file_.close();
   }
 
+  if (failing_regression_count_) {
+    std::cerr << "\n" << failing_regression_count_ << " " << to_string(op_kind_)
+      << " result(s) regressed by more than " << options_.report.fail_on_regression
+      << "% relative to '" << options_.report.baseline_path << "'" << std::endl;
+  }
+
   if (junit_output_file_.is_open()) {
     print_junit_footer_(junit_output_file_);
     junit_output_file_.close();
@@ -314,6 +341,17 @@ std::ostream & PerformanceReport::print_result_pretty_(
   }
   out << "\n\n";
 
+  if (result.resources.valid) {
+    out
+      << "       Resources: " << result.resources.registers_per_thread << " registers/thread, "
+      << result.resources.static_smem_bytes << " B static smem, "
+      << result.resources.dynamic_smem_bytes << " B dynamic smem, "
+      << result.resources.local_memory_bytes << " B local memory\n"
+      << "       Occupancy: " << result.resources.max_active_ctas_per_sm << " CTAs/SM of "
+      << result.resources.threads_per_cta << " threads, cluster size "
+      << result.resources.cluster_size << "\n\n";
+  }
+
   out
     << "           Bytes: " << result.bytes << "  bytes\n"
     << "           FLOPs: " << result.flops << "  flops\n"
@@ -322,10 +360,53 @@ std::ostream & PerformanceReport::print_result_pretty_(
   if (result.good()) {
 
     out
-      << "         Runtime: " << result.runtime << "  ms\n"
+      << "         Runtime: " << result.runtime << "  ms\n";
+
+    if (result.samples > 0) {
+      out
+        << "     Runtime p50: " << result.runtime_p50 << "  ms\n"
+        << "     Runtime p90: " << result.runtime_p90 << "  ms\n"
+        << "  Runtime 95% CI: [" << result.runtime_ci_lower << ", " << result.runtime_ci_upper
+        << "]  ms (" << result.samples << " samples)\n";
+    }
+
+    out
       << "          Memory: " << result.gbytes_per_sec() << " GiB/s\n"
       << "\n            Math: " << result.gflops_per_sec() << " GFLOP/s\n";
 
+    if (result.energy > 0) {
+      out
+        << "           Power: " << result.average_power << " W @ " << result.average_sm_clock << " MHz\n"
+        << "          Energy: " << result.energy << " J\n"
+        << "      Efficiency: " << result.gflops_per_joule() << " GFLOP/J\n";
+    }
+
+    if (!baseline_.empty()) {
+      BaselineResult const *baseline = find_baseline_(result);
+      if (baseline) {
+        out
+          << "        Baseline: " << baseline->runtime << "  ms\n"
+          << "         Speedup: " << baseline->runtime / result.runtime << "x"
+          << (is_regression_(result, *baseline) ? "  (regression)" : "") << "\n";
+      }
+      else {
+        out << "        Baseline: not found\n";
+      }
+    }
+
+    if (options_.report.roofline) {
+      if (peak_bandwidth_ > 0) {
+        out << "       %PeakBand: " << 100.0 * result.gbytes_per_sec() / peak_bandwidth_ << " %\n";
+      }
+      if (options_.report.peak_gflops > 0) {
+        out << "       %PeakMath: " << 100.0 * result.gflops_per_sec() / options_.report.peak_gflops << " %\n";
+      }
+      char const *bound = roofline_bound_(result);
+      if (*bound) {
+        out << "           Bound: " << bound << "\n";
+      }
+    }
+
   }
 
   return out;
@@ -362,11 +443,27 @@ std::ostream & PerformanceReport::print_csv_header_(
     }
   }
 
+  if (options_.profiling.adaptive_precision > 0) {
+    out << ",Runtime_p50,Runtime_p90,Runtime_CI_lower,Runtime_CI_upper,Samples";
+  }
+
   out
     << ",GB/s"
     << ",GFLOPs"
     ;
 
+  if (options_.report.roofline) {
+    out << ",%PeakBandwidth,%PeakMath,Bound";
+  }
+
+  if (options_.profiling.measure_power) {
+    out << ",Power_W,Energy_J,SM_Clock_MHz,GFLOP/J";
+  }
+
+  if (!options_.report.baseline_path.empty()) {
+    out << ",BaselineRuntime,Speedup,Regression";
+  }
+
   return out;
 }
 
@@ -411,6 +508,15 @@ std::ostream & PerformanceReport::print_result_csv_(
     }
   }
 
+  if (options_.profiling.adaptive_precision > 0) {
+    out
+      << "," << result.runtime_p50
+      << "," << result.runtime_p90
+      << "," << result.runtime_ci_lower
+      << "," << result.runtime_ci_upper
+      << "," << result.samples;
+  }
+
   if (result.good()) {
 
     out
@@ -425,6 +531,207 @@ std::ostream & PerformanceReport::print_result_csv_(
     );
   }
 
+  if (options_.report.roofline) {
+    print_result_roofline_csv_(out, result);
+  }
+
+  if (options_.profiling.measure_power) {
+    out
+      << "," << result.average_power
+      << "," << result.energy
+      << "," << result.average_sm_clock
+      << "," << result.gflops_per_joule();
+  }
+
+  if (!options_.report.baseline_path.empty()) {
+    print_result_baseline_csv_(out, result);
+  }
+
+  return out;
+}
+
+/// Splits one line of a CSV report into its fields
+static std::vector<std::string> split_csv_line(std::string const &line) {
+
+  std::vector<std::string> fields;
+  std::stringstream ss(line);
+  std::string field;
+
+  while (std::getline(ss, field, ',')) {
+    fields.push_back(field);
+  }
+  if (!line.empty() && line.back() == ',') {
+    fields.push_back("");
+  }
+
+  return fields;
+}
+
+/// Loads the baseline report. Results are keyed by provider, operation name and every problem
+/// argument that also appears in the baseline, so reports written by profilers with a different
+/// set of arguments or pivot tags may still be compared.
+void PerformanceReport::load_baseline_() {
+
+  std::string path = options_.report.baseline_path;
+  std::ifstream file(path);
+
+  if (!file.is_open()) {
+    path = path.substr(0, path.rfind(".csv")) + "." + to_string(op_kind_) + ".csv";
+    file.open(path);
+  }
+
+  if (!file.is_open()) {
+    if (options_.report.verbose) {
+      std::cerr << "No " << to_string(op_kind_) << " baseline found at '"
+        << options_.report.baseline_path << "'" << std::endl;
+    }
+    return;
+  }
+
+  std::string line;
+  if (!std::getline(file, line)) {
+    return;
+  }
+
+  std::vector<std::string> header = split_csv_line(line);
+
+  auto column_of = [&](std::string const &name) -> int {
+    auto it = std::find(header.begin(), header.end(), name);
+    return it == header.end() ? -1 : int(it - header.begin());
+  };
+
+  int provider_col = column_of("Provider");
+  int operation_col = column_of("Operation");
+  int runtime_col = column_of("Runtime");
+  int ci_lower_col = column_of("Runtime_CI_lower");
+  int ci_upper_col = column_of("Runtime_CI_upper");
+
+  if (provider_col < 0 || operation_col < 0 || runtime_col < 0) {
+    std::cerr << "Baseline '" << path << "' is not a cutlass_profiler report" << std::endl;
+    return;
+  }
+
+  std::vector<int> argument_cols;
+  for (auto const &arg_name : argument_names_) {
+    int col = column_of(arg_name);
+    if (col >= 0) {
+      baseline_arguments_.push_back(arg_name);
+      argument_cols.push_back(col);
+    }
+  }
+
+  while (std::getline(file, line)) {
+
+    std::vector<std::string> fields = split_csv_line(line);
+    if (int(fields.size()) != int(header.size())) {
+      continue;
+    }
+
+    BaselineResult baseline;
+    baseline.runtime = std::atof(fields.at(runtime_col).c_str());
+    baseline.ci_lower = ci_lower_col >= 0 ? std::atof(fields.at(ci_lower_col).c_str()) : 0;
+    baseline.ci_upper = ci_upper_col >= 0 ? std::atof(fields.at(ci_upper_col).c_str()) : 0;
+
+    if (!(baseline.runtime > 0)) {
+      continue;
+    }
+
+    std::string key = fields.at(provider_col) + "," + fields.at(operation_col);
+    for (int col : argument_cols) {
+      key += "," + fields.at(col);
+    }
+
+    // Keep the fastest result if the baseline profiled a problem more than once
+    auto it = baseline_.find(key);
+    if (it == baseline_.end() || baseline.runtime < it->second.runtime) {
+      baseline_[key] = baseline;
+    }
+  }
+}
+
+/// Returns the baseline result matching `result`, or nullptr if there is none
+PerformanceReport::BaselineResult const *PerformanceReport::find_baseline_(
+  PerformanceResult const &result) const {
+
+  if (baseline_.empty()) {
+    return nullptr;
+  }
+
+  std::string key = std::string(to_string(result.provider, true)) + "," + result.operation_name;
+
+  for (auto const &arg_name : baseline_arguments_) {
+    auto arg = std::find_if(result.arguments.begin(), result.arguments.end(),
+      [&](std::pair<std::string, std::string> const &a) { return a.first == arg_name; });
+    key += "," + (arg == result.arguments.end() ? std::string() : arg->second);
+  }
+
+  auto it = baseline_.find(key);
+  return it == baseline_.end() ? nullptr : &it->second;
+}
+
+/// A result regresses if its confidence interval lies entirely above the baseline's. When either
+/// run lacks confidence intervals, the slowdown must exceed --regression-tolerance instead.
+bool PerformanceReport::is_regression_(
+  PerformanceResult const &result,
+  BaselineResult const &baseline) const {
+
+  if (result.samples > 0 && baseline.ci_upper > 0) {
+    return result.runtime_ci_lower > baseline.ci_upper;
+  }
+
+  return 100.0 * (result.runtime / baseline.runtime - 1.0) > options_.report.regression_tolerance;
+}
+
+/// Prints the baseline comparison columns of a result in CSV output
+std::ostream & PerformanceReport::print_result_baseline_csv_(
+  std::ostream &out,
+  PerformanceResult const &result) {
+
+  BaselineResult const *baseline = find_baseline_(result);
+
+  if (!baseline || !result.good()) {
+    return out << ",,,";
+  }
+
+  out
+    << "," << baseline->runtime
+    << "," << baseline->runtime / result.runtime
+    << "," << (is_regression_(result, *baseline) ? "yes" : "no");
+
+  return out;
+}
+
+/// Classifies a result as memory- or compute-bound by comparing its arithmetic intensity to the
+/// ridge point of the roofline. Returns an empty string if either peak is unknown.
+char const *PerformanceReport::roofline_bound_(PerformanceResult const &result) const {
+
+  if (peak_bandwidth_ <= 0 || options_.report.peak_gflops <= 0 || result.bytes <= 0) {
+    return "";
+  }
+
+  double flops_per_byte = double(result.flops) / double(result.bytes);
+  double ridge_flops_per_byte = options_.report.peak_gflops * 1.0e9 / (peak_bandwidth_ * double(1 << 30));
+
+  return flops_per_byte < ridge_flops_per_byte ? "memory" : "compute";
+}
+
+/// Prints the roofline columns of a result in CSV output
+std::ostream & PerformanceReport::print_result_roofline_csv_(
+  std::ostream &out,
+  PerformanceResult const &result) {
+
+  out << ",";
+  if (result.good() && peak_bandwidth_ > 0) {
+    out << 100.0 * result.gbytes_per_sec() / peak_bandwidth_;
+  }
+
+  out << ",";
+  if (result.good() && options_.report.peak_gflops > 0) {
+    out << 100.0 * result.gflops_per_sec() / options_.report.peak_gflops;
+  }
+
+  out << "," << roofline_bound_(result);
+
   return out;
 }
 
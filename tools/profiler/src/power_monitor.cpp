@@ -0,0 +1,230 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Samples board power, energy and SM clocks of a device through NVML
+*/
+
+#include <chrono>
+
+#include <cuda_runtime.h>
+
+#if CUTLASS_PROFILER_ENABLE_NVML
+#include <nvml.h>
+#endif
+
+#include "cutlass/profiler/power_monitor.h"
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+#if CUTLASS_PROFILER_ENABLE_NVML
+
+/// Returns the NVML handle of a CUDA device, matched by PCI bus ID since NVML and CUDA may
+/// enumerate devices in different orders. Returns false if NVML or the device is unavailable.
+bool get_nvml_device(int device_id, nvmlDevice_t &device) {
+  char pci_bus_id[32];
+  if (cudaDeviceGetPCIBusId(pci_bus_id, sizeof(pci_bus_id), device_id) != cudaSuccess) {
+    return false;
+  }
+  return nvmlDeviceGetHandleByPciBusId_v2(pci_bus_id, &device) == NVML_SUCCESS;
+}
+
+#endif
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+PowerMonitor::PowerMonitor(int device_id, int sample_interval_ms):
+  handle_(nullptr),
+  sample_interval_ms_(sample_interval_ms),
+  has_energy_counter_(false),
+  sampling_(false),
+  start_energy_mJ_(0),
+  power_sum_W_(0),
+  clock_sum_MHz_(0),
+  sample_count_(0),
+  elapsed_s_(0),
+  energy_J_(0),
+  average_power_W_(0),
+  average_sm_clock_MHz_(0) {
+
+#if CUTLASS_PROFILER_ENABLE_NVML
+  if (nvmlInit_v2() != NVML_SUCCESS) {
+    return;
+  }
+
+  nvmlDevice_t device;
+  if (!get_nvml_device(device_id, device)) {
+    nvmlShutdown();
+    return;
+  }
+
+  unsigned long long energy_mJ = 0;
+  has_energy_counter_ = (nvmlDeviceGetTotalEnergyConsumption(device, &energy_mJ) == NVML_SUCCESS);
+  handle_ = device;
+#endif
+}
+
+PowerMonitor::~PowerMonitor() {
+  if (sampler_.joinable()) {
+    sampling_.store(false);
+    sampler_.join();
+  }
+#if CUTLASS_PROFILER_ENABLE_NVML
+  if (handle_) {
+    nvmlShutdown();
+  }
+#endif
+}
+
+void PowerMonitor::start() {
+
+  power_sum_W_ = 0;
+  clock_sum_MHz_ = 0;
+  sample_count_ = 0;
+
+  if (!supported()) {
+    return;
+  }
+
+#if CUTLASS_PROFILER_ENABLE_NVML
+  nvmlDevice_t device = static_cast<nvmlDevice_t>(handle_);
+
+  if (has_energy_counter_ &&
+      nvmlDeviceGetTotalEnergyConsumption(device, &start_energy_mJ_) != NVML_SUCCESS) {
+    has_energy_counter_ = false;
+  }
+
+  sampling_.store(true);
+  sampler_ = std::thread([this, device]() {
+    while (sampling_.load()) {
+      unsigned int power_mW = 0;
+      unsigned int clock_MHz = 0;
+      if (nvmlDeviceGetPowerUsage(device, &power_mW) == NVML_SUCCESS &&
+          nvmlDeviceGetClockInfo(device, NVML_CLOCK_SM, &clock_MHz) == NVML_SUCCESS) {
+        power_sum_W_ += power_mW / 1000.0;
+        clock_sum_MHz_ += clock_MHz;
+        ++sample_count_;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(sample_interval_ms_));
+    }
+  });
+#endif
+
+  start_time_ = std::chrono::steady_clock::now();
+}
+
+void PowerMonitor::stop() {
+
+  elapsed_s_ = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time_).count();
+  energy_J_ = 0;
+  average_power_W_ = 0;
+  average_sm_clock_MHz_ = 0;
+
+  if (!supported()) {
+    return;
+  }
+
+  sampling_.store(false);
+  if (sampler_.joinable()) {
+    sampler_.join();
+  }
+
+  if (sample_count_) {
+    average_power_W_ = power_sum_W_ / sample_count_;
+    average_sm_clock_MHz_ = clock_sum_MHz_ / sample_count_;
+  }
+
+  energy_J_ = average_power_W_ * elapsed_s_;
+
+#if CUTLASS_PROFILER_ENABLE_NVML
+  unsigned long long stop_energy_mJ = 0;
+  if (has_energy_counter_ &&
+      nvmlDeviceGetTotalEnergyConsumption(static_cast<nvmlDevice_t>(handle_), &stop_energy_mJ) == NVML_SUCCESS &&
+      stop_energy_mJ > start_energy_mJ_) {
+
+    energy_J_ = double(stop_energy_mJ - start_energy_mJ_) / 1000.0;
+    if (elapsed_s_ > 0) {
+      average_power_W_ = energy_J_ / elapsed_s_;
+    }
+  }
+#endif
+}
+
+/// Locks the SM clock of CUDA device `device_id` to `clock_MHz`. Requires administrative privileges.
+Status PowerMonitor::lock_sm_clock(int device_id, int clock_MHz) {
+#if CUTLASS_PROFILER_ENABLE_NVML
+  if (nvmlInit_v2() != NVML_SUCCESS) {
+    return Status::kErrorInternal;
+  }
+  nvmlDevice_t device;
+  Status status = Status::kErrorNotSupported;
+  if (get_nvml_device(device_id, device) &&
+      nvmlDeviceSetGpuLockedClocks(device, unsigned(clock_MHz), unsigned(clock_MHz)) == NVML_SUCCESS) {
+    status = Status::kSuccess;
+  }
+  nvmlShutdown();
+  return status;
+#else
+  return Status::kErrorNotSupported;
+#endif
+}
+
+/// Restores default SM clock management of CUDA device `device_id`
+Status PowerMonitor::reset_sm_clock(int device_id) {
+#if CUTLASS_PROFILER_ENABLE_NVML
+  if (nvmlInit_v2() != NVML_SUCCESS) {
+    return Status::kErrorInternal;
+  }
+  nvmlDevice_t device;
+  Status status = Status::kErrorNotSupported;
+  if (get_nvml_device(device_id, device) &&
+      nvmlDeviceResetGpuLockedClocks(device) == NVML_SUCCESS) {
+    status = Status::kSuccess;
+  }
+  nvmlShutdown();
+  return status;
+#else
+  return Status::kErrorNotSupported;
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
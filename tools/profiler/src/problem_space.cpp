@@ -943,6 +943,44 @@ bool arg_as_RasterOrder(
   return arg_as_RasterOrder(raster_order, value_ptr);
 }
 
+/// Lexically casts an argument to a distributed GEMM schedule if it is defined. Returns true if not null.
+bool arg_as_DistributedGemmSchedule(
+  library::DistributedGemmSchedule &schedule,
+  KernelArgument::Value const *value_ptr) {
+
+  if (value_ptr->not_null) {
+    if (value_ptr->argument->description->type == ArgumentTypeID::kEnumerated) {
+
+      schedule = library::from_string<library::DistributedGemmSchedule>(
+        static_cast<EnumeratedTypeArgument::EnumeratedTypeValue const *>(value_ptr)->element);
+
+      if (schedule == library::DistributedGemmSchedule::kInvalid) {
+        throw std::runtime_error(
+          "arg_as_DistributedGemmSchedule() - illegal cast.");
+      }
+    }
+    else {
+      throw std::runtime_error(
+        "arg_as_DistributedGemmSchedule() - illegal cast.");
+    }
+    return true;
+  }
+  return false;
+}
+
+/// Lexically casts an argument to a distributed GEMM schedule if it is defined. Returns true if not null.
+bool arg_as_DistributedGemmSchedule(
+  library::DistributedGemmSchedule &schedule,
+  char const *name,
+  ProblemSpace const &problem_space,
+  ProblemSpace::Problem const &problem) {
+
+  size_t idx = problem_space.argument_index(name);
+  KernelArgument::Value const *value_ptr = problem.at(idx).get();
+
+  return arg_as_DistributedGemmSchedule(schedule, value_ptr);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// Lexically casts an argument to an int64 if it is defined. Returns true if not null.
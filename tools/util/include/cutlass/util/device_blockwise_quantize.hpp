@@ -0,0 +1,320 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Device quantization of GEMM operands to FP8 with blockwise scale factors.
+
+    Produces the FP8 operands and scale tensors consumed by the blockwise-scaled GEMMs, with scale
+    factors addressed through the layouts of Sm1xxBlockwiseScaleConfig (tile_atom_to_shape_SFA/SFB),
+    so that either scale-major order is written exactly as the collective reads it.
+
+    Activations are quantized in 1x128 blocks and weights in 128x128 blocks. The transpose of the
+    operand, needed by the backward pass, may be written by the same kernel: 1x128 blocks become
+    128x1 blocks of the original operand (1x128 blocks of its transpose), and 128x128 blocks keep
+    their scale.
+*/
+
+#pragma once
+
+#include <cstdint>
+
+#include "cute/layout.hpp"
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/platform/platform.h"
+
+namespace cutlass {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Arguments of blockwise_quantize(). The operand is a K-major (M, K, L) tensor; its transpose is
+/// an M-major (K, M, L) tensor, i.e. K-major for the GEMM reducing over M.
+template <
+  class ElementIn,
+  class ElementQ,
+  class ElementScale,
+  class LayoutSF,                  ///< cute layout mapping (m, k, l) to the scale of its block
+  class LayoutSFT = LayoutSF       ///< cute layout mapping (k, m, l) to the scale of its transposed block
+>
+struct BlockwiseQuantizeArguments {
+  int m;
+  int k;
+  int l;
+
+  ElementIn const *ptr_in;
+  int64_t ld_in;
+  int64_t batch_stride_in;
+
+  ElementQ *ptr_q;
+  int64_t ld_q;
+  int64_t batch_stride_q;
+  ElementScale *ptr_scale;
+  LayoutSF layout_scale;
+
+  ElementQ *ptr_q_t;               ///< Optional transposed output
+  int64_t ld_q_t;
+  int64_t batch_stride_q_t;
+  ElementScale *ptr_scale_t;
+  LayoutSFT layout_scale_t;
+
+  bool round_scale_to_pow2;        ///< Rounds scales up to powers of two (UE8M0-compatible)
+};
+
+namespace detail {
+
+/// Returns the scale mapping a block of absolute maximum amax onto the range of ElementQ
+template <class ElementQ>
+CUTLASS_DEVICE
+float blockwise_quantize_scale(float amax, bool round_to_pow2) {
+  float scale = amax / float(platform::numeric_limits<ElementQ>::max());
+  if (!(scale > 0.f)) {
+    return 1.f;
+  }
+  return round_to_pow2 ? exp2f(ceilf(log2f(scale))) : scale;
+}
+
+/// Quantizes one 128x128 tile of the operand with 256 threads. Thread t holds the vectors of
+/// kVec elements in columns (t % 16) * kVec of rows t / 16 + 16 * p, so that row maxima reduce
+/// across 16 lanes and column maxima across the 8 passes, then across warps in shared memory.
+template <int SFVecM, int SFVecK, class ElementIn, class ElementQ, class ElementScale, class LayoutSF, class LayoutSFT>
+__global__ void __launch_bounds__(256)
+blockwise_quantize_kernel(BlockwiseQuantizeArguments<ElementIn, ElementQ, ElementScale, LayoutSF, LayoutSFT> args) {
+
+  constexpr int kTile = 128;
+  constexpr int kVec = 8;
+  constexpr int kThreadsPerRow = kTile / kVec;
+  constexpr int kRowsPerPass = 256 / kThreadsPerRow;
+  constexpr int kPasses = kTile / kRowsPerPass;
+  constexpr int kTransposedPad = 16;
+
+  __shared__ float col_amax_partial[256 / 32][kTile];
+  __shared__ ElementQ tile_t[kTile][kTile + kTransposedPad];
+
+  int m0 = blockIdx.x * kTile;
+  int k0 = blockIdx.y * kTile;
+  int l = blockIdx.z;
+  int warp_idx = threadIdx.x / 32;
+  int row = threadIdx.x / kThreadsPerRow;
+  int col = (threadIdx.x % kThreadsPerRow) * kVec;
+  int k = k0 + col;
+
+  using VectorIn = AlignedArray<ElementIn, kVec>;
+  using VectorQ = AlignedArray<ElementQ, kVec>;
+
+  NumericArrayConverter<float, ElementIn, kVec> to_float;
+  NumericArrayConverter<ElementQ, float, kVec> to_q;
+
+  //
+  // Load the tile and reduce its row, column and tile maxima
+  //
+
+  Array<float, kVec> x[kPasses];
+  float row_amax[kPasses];
+  Array<float, kVec> col_amax;
+  col_amax.fill(0.f);
+
+  CUTLASS_PRAGMA_UNROLL
+  for (int p = 0; p < kPasses; ++p) {
+    int m = m0 + row + p * kRowsPerPass;
+    if (m < args.m && k < args.k) {
+      x[p] = to_float(*reinterpret_cast<VectorIn const *>(
+        args.ptr_in + l * args.batch_stride_in + m * args.ld_in + k));
+    }
+    else {
+      x[p].fill(0.f);
+    }
+
+    row_amax[p] = 0.f;
+    CUTLASS_PRAGMA_UNROLL
+    for (int j = 0; j < kVec; ++j) {
+      float a = fabsf(x[p][j]);
+      row_amax[p] = fmaxf(row_amax[p], a);
+      col_amax[j] = fmaxf(col_amax[j], a);
+    }
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int offset = kThreadsPerRow / 2; offset > 0; offset /= 2) {
+      row_amax[p] = fmaxf(row_amax[p], __shfl_xor_sync(0xFFFFFFFF, row_amax[p], offset));
+    }
+  }
+
+  CUTLASS_PRAGMA_UNROLL
+  for (int j = 0; j < kVec; ++j) {
+    col_amax[j] = fmaxf(col_amax[j], __shfl_xor_sync(0xFFFFFFFF, col_amax[j], kThreadsPerRow));
+    if (threadIdx.x % 32 < kThreadsPerRow) {
+      col_amax_partial[warp_idx][col + j] = col_amax[j];
+    }
+  }
+  __syncthreads();
+
+  float tile_amax = 0.f;
+  CUTLASS_PRAGMA_UNROLL
+  for (int j = 0; j < kVec; ++j) {
+    CUTLASS_PRAGMA_UNROLL
+    for (int w = 0; w < 256 / 32; ++w) {
+      col_amax[j] = fmaxf(col_amax[j], col_amax_partial[w][col + j]);
+    }
+    tile_amax = fmaxf(tile_amax, col_amax[j]);
+  }
+  CUTLASS_PRAGMA_UNROLL
+  for (int offset = kThreadsPerRow / 2; offset > 0; offset /= 2) {
+    tile_amax = fmaxf(tile_amax, __shfl_xor_sync(0xFFFFFFFF, tile_amax, offset));
+  }
+
+  //
+  // Quantize the operand in SFVecM x SFVecK blocks
+  //
+
+  float tile_scale = blockwise_quantize_scale<ElementQ>(tile_amax, args.round_scale_to_pow2);
+
+  if constexpr (SFVecM != 1) {
+    if (threadIdx.x == 0) {
+      args.ptr_scale[args.layout_scale(m0, k0, l)] = ElementScale(tile_scale);
+    }
+  }
+
+  CUTLASS_PRAGMA_UNROLL
+  for (int p = 0; p < kPasses; ++p) {
+    int m = m0 + row + p * kRowsPerPass;
+    float scale = SFVecM == 1 ? blockwise_quantize_scale<ElementQ>(row_amax[p], args.round_scale_to_pow2) : tile_scale;
+    float inv_scale = 1.f / scale;
+
+    if (m < args.m && k < args.k) {
+      if (SFVecM == 1 && col == 0) {
+        args.ptr_scale[args.layout_scale(m, k0, l)] = ElementScale(scale);
+      }
+
+      Array<float, kVec> y;
+      CUTLASS_PRAGMA_UNROLL
+      for (int j = 0; j < kVec; ++j) {
+        y[j] = x[p][j] * inv_scale;
+      }
+      VectorQ q;
+      static_cast<Array<ElementQ, kVec> &>(q) = to_q(y);
+      *reinterpret_cast<VectorQ *>(args.ptr_q + l * args.batch_stride_q + m * args.ld_q + k) = q;
+    }
+  }
+
+  if (args.ptr_q_t == nullptr) {
+    return;
+  }
+
+  //
+  // Quantize the transpose in SFVecK x SFVecM blocks of the operand, staged in shared memory so
+  // that rows of the transpose are written with 16B stores
+  //
+
+  Array<float, kVec> inv_scale_t;
+  CUTLASS_PRAGMA_UNROLL
+  for (int j = 0; j < kVec; ++j) {
+    float scale = SFVecM == 1 ? blockwise_quantize_scale<ElementQ>(col_amax[j], args.round_scale_to_pow2) : tile_scale;
+    inv_scale_t[j] = 1.f / scale;
+
+    if (row == 0 && k + j < args.k && (SFVecM == 1 || (threadIdx.x == 0 && j == 0))) {
+      args.ptr_scale_t[args.layout_scale_t(k + j, m0, l)] = ElementScale(scale);
+    }
+  }
+
+  NumericConverter<ElementQ, float> to_q_element;
+  CUTLASS_PRAGMA_UNROLL
+  for (int p = 0; p < kPasses; ++p) {
+    CUTLASS_PRAGMA_UNROLL
+    for (int j = 0; j < kVec; ++j) {
+      tile_t[col + j][row + p * kRowsPerPass] = to_q_element(x[p][j] * inv_scale_t[j]);
+    }
+  }
+  __syncthreads();
+
+  constexpr int kChunk = 16 / sizeof(ElementQ);
+  constexpr int kChunksPerRow = kTile / kChunk;
+  using ChunkQ = AlignedArray<ElementQ, kChunk>;
+
+  for (int idx = threadIdx.x; idx < kTile * kChunksPerRow; idx += 256) {
+    int kt = k0 + idx / kChunksPerRow;
+    int mt = m0 + (idx % kChunksPerRow) * kChunk;
+    if (kt < args.k && mt < args.m) {
+      *reinterpret_cast<ChunkQ *>(args.ptr_q_t + l * args.batch_stride_q_t + kt * args.ld_q_t + mt) =
+        *reinterpret_cast<ChunkQ const *>(&tile_t[idx / kChunksPerRow][(idx % kChunksPerRow) * kChunk]);
+    }
+  }
+}
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Quantizes a K-major operand to ElementQ in SFVecM x SFVecK blocks, with SFVecM either 1
+/// (activations) or 128 (weights) and SFVecK 128, writing one scale per block such that
+/// x ~= q * scale. Each 128x128 tile is read once.
+///
+/// K must be a multiple of 8 and the input 16B aligned. If a transpose is requested, M must be a
+/// multiple of 16 / sizeof(ElementQ) and its rows 16B aligned.
+template <int SFVecM, int SFVecK, class ElementIn, class ElementQ, class ElementScale, class LayoutSF, class LayoutSFT>
+cudaError_t blockwise_quantize(
+  BlockwiseQuantizeArguments<ElementIn, ElementQ, ElementScale, LayoutSF, LayoutSFT> const &args,
+  cudaStream_t stream = nullptr) {
+
+  static_assert((SFVecM == 1 || SFVecM == 128) && SFVecK == 128,
+    "Supported scale blocks are 1x128 (activations) and 128x128 (weights).");
+  static_assert(sizeof_bits<ElementIn>::value == 16 || sizeof_bits<ElementIn>::value == 32,
+    "Input must be a 16b or 32b floating-point type.");
+  static_assert(sizeof_bits<ElementQ>::value == 8, "Quantized type must be 8b.");
+
+  if (args.m <= 0 || args.k <= 0 || args.l <= 0) {
+    return cudaSuccess;
+  }
+
+  bool is_aligned =
+    args.k % 8 == 0 && args.ld_in % 8 == 0 && args.ld_q % 8 == 0 &&
+    args.batch_stride_in % 8 == 0 && args.batch_stride_q % 8 == 0 &&
+    reinterpret_cast<uintptr_t>(args.ptr_in) % 16 == 0 &&
+    reinterpret_cast<uintptr_t>(args.ptr_q) % 8 == 0;
+
+  if (args.ptr_q_t) {
+    is_aligned = is_aligned &&
+      args.m % 16 == 0 && args.ld_q_t % 16 == 0 && args.batch_stride_q_t % 16 == 0 &&
+      reinterpret_cast<uintptr_t>(args.ptr_q_t) % 16 == 0;
+  }
+
+  if (!is_aligned) {
+    return cudaErrorInvalidValue;
+  }
+
+  dim3 grid((args.m + 127) / 128, (args.k + 127) / 128, args.l);
+  detail::blockwise_quantize_kernel<SFVecM, SFVecK><<<grid, 256, 0, stream>>>(args);
+
+  return cudaGetLastError();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
@@ -0,0 +1,737 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Single-pass LayerNorm, RMSNorm and channels-last GroupNorm kernels.
+
+    Statistics are gathered in one pass over the input with Welford's algorithm, reading 128-bit
+    vectors, and merged across threads with warp shuffles and shared memory. Rows of up to 4096
+    vectors are held in registers, so that the input is read from global memory once. The input may
+    first be summed with a residual, and the output may be scaled and converted to a narrow type
+    (e.g. FP8) while its absolute maximum is recorded.
+
+    Unlike layernorm(), rmsnorm() and groupnorm(), these functions return launch errors instead of
+    aborting.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/functional.h"
+#include "cutlass/layout/matrix.h"
+#include "cutlass/layout/tensor.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/tensor_coord.h"
+#include "cutlass/tensor_ref.h"
+
+namespace cutlass {
+namespace fused_norm {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Count, mean and sum of squared deviations from the mean of a set of values
+struct Welford {
+  float count;
+  float mean;
+  float m2;
+
+  /// Merges the statistics of another set of values
+  CUTLASS_HOST_DEVICE
+  void merge(Welford const &other) {
+    float count_ab = count + other.count;
+    if (count_ab > 0.f) {
+      float delta = other.mean - mean;
+      float weight = other.count / count_ab;
+      mean += delta * weight;
+      m2 += other.m2 + delta * delta * count * weight;
+      count = count_ab;
+    }
+  }
+
+  /// Adds a vector of values. If kZeroMean is true, deviations are taken from zero so that m2 is
+  /// the sum of squares (RMSNorm).
+  template <bool kZeroMean, int N>
+  CUTLASS_DEVICE
+  void update(Array<float, N> const &x) {
+    float vec_mean = 0.f;
+    if constexpr (!kZeroMean) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < N; ++i) {
+        vec_mean += x[i];
+      }
+      vec_mean *= 1.f / float(N);
+    }
+    float vec_m2 = 0.f;
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < N; ++i) {
+      float delta = x[i] - vec_mean;
+      vec_m2 += delta * delta;
+    }
+    merge(Welford{float(N), vec_mean, vec_m2});
+  }
+
+  /// Reduces the statistics of a warp. All lanes receive the statistics of lane 0.
+  CUTLASS_DEVICE
+  void warp_reduce() {
+    CUTLASS_PRAGMA_UNROLL
+    for (int offset = 16; offset > 0; offset /= 2) {
+      Welford other{
+        __shfl_down_sync(0xFFFFFFFF, count, offset),
+        __shfl_down_sync(0xFFFFFFFF, mean, offset),
+        __shfl_down_sync(0xFFFFFFFF, m2, offset)};
+      merge(other);
+    }
+    count = __shfl_sync(0xFFFFFFFF, count, 0);
+    mean = __shfl_sync(0xFFFFFFFF, mean, 0);
+    m2 = __shfl_sync(0xFFFFFFFF, m2, 0);
+  }
+};
+
+/// Vector of N elements accessed with a single instruction of at most 128 bits
+template <typename T, int N>
+using Vector = AlignedArray<T, N, (sizeof_bits<T>::value * N / 8 < 16 ? sizeof_bits<T>::value * N / 8 : 16)>;
+
+/// Widest vector length in elements of T fitting in 128 bits
+template <typename T>
+constexpr int kMaxVectorLength = 128 / sizeof_bits<T>::value;
+
+/// Returns true if a pointer and a length in elements are aligned to vectors of N elements
+template <int N, typename T>
+bool is_vector_aligned(T const *ptr, int64_t length = 0) {
+  return reinterpret_cast<uintptr_t>(ptr) % sizeof(Vector<T, N>) == 0 && length % N == 0;
+}
+
+/// Loads a vector of N elements and converts it to float
+template <int N, typename T>
+CUTLASS_DEVICE
+Array<float, N> load_vector(T const *ptr) {
+  NumericArrayConverter<float, T, N> convert;
+  return convert(*reinterpret_cast<Vector<T, N> const *>(ptr));
+}
+
+/// Converts a vector of N floats and stores it
+template <int N, typename T>
+CUTLASS_DEVICE
+void store_vector(T *ptr, Array<float, N> const &x) {
+  NumericArrayConverter<T, float, N> convert;
+  Vector<T, N> vec;
+  static_cast<Array<T, N> &>(vec) = convert(x);
+  *reinterpret_cast<Vector<T, N> *>(ptr) = vec;
+}
+
+/// Reads a vector of the normalized input. With a residual, the input is summed with the residual
+/// and the rounded sum is written back to the residual, so that it feeds the next residual
+/// connection and is normalized exactly as an unfused add would be.
+template <int N, typename TIn>
+CUTLASS_DEVICE
+Array<float, N> load_input(TIn const *input, TIn *residual) {
+  Array<float, N> x = load_vector<N>(input);
+  if (residual) {
+    Array<float, N> r = load_vector<N>(residual);
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < N; ++i) {
+      x[i] += r[i];
+    }
+    NumericArrayConverter<TIn, float, N> round;
+    NumericArrayConverter<float, TIn, N> widen;
+    Array<TIn, N> sum = round(x);
+    x = widen(sum);
+    Vector<TIn, N> vec;
+    static_cast<Array<TIn, N> &>(vec) = sum;
+    *reinterpret_cast<Vector<TIn, N> *>(residual) = vec;
+  }
+  return x;
+}
+
+/// Reduces the absolute maximum of a warp's output into amax_output
+CUTLASS_DEVICE
+void reduce_amax(float amax, float *amax_output) {
+  CUTLASS_PRAGMA_UNROLL
+  for (int offset = 16; offset > 0; offset /= 2) {
+    amax = fmaxf(amax, __shfl_xor_sync(0xFFFFFFFF, amax, offset));
+  }
+  if (threadIdx.x % 32 == 0) {
+    atomic_maximum<float>{}(amax_output, amax);
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Arguments of LayerNorm and RMSNorm over the rows of a row-major (m, n) matrix
+template <typename TIn, typename TOut, typename TWeight>
+struct RowNormParams {
+  TOut *output;
+  int64_t ldo;
+  TIn const *input;
+  int64_t ldi;
+  TIn *residual;               ///< Optional, replaced by input + residual, which is normalized
+  int64_t ldr;
+  TWeight const *gamma;        ///< (n) scale
+  TWeight const *beta;         ///< Optional (n) shift, LayerNorm only
+  float const *scale_output;   ///< Optional scale applied to the output before conversion to TOut
+  float *amax_output;          ///< Optional absolute maximum of the unscaled output, reduced atomically
+  int m;
+  int n;
+  float epsilon;
+};
+
+/// Normalizes kRowsPerCta rows per CTA with kThreadsPerRow threads each. Each thread reads vectors
+/// of kVec elements and holds kVecsPerThread of them in registers; if kVecsPerThread is 0, the row
+/// is streamed and read a second time to normalize it.
+template <
+  typename TIn,
+  typename TOut,
+  typename TWeight,
+  bool kRms,
+  int kVec,
+  int kThreadsPerRow,
+  int kRowsPerCta,
+  int kVecsPerThread
+>
+__global__ void __launch_bounds__(kThreadsPerRow * kRowsPerCta)
+row_norm_kernel(RowNormParams<TIn, TOut, TWeight> params) {
+
+  static_assert(kThreadsPerRow % 32 == 0, "Rows are normalized by whole warps.");
+
+  constexpr int kWarpsPerRow = kThreadsPerRow / 32;
+  constexpr bool kCached = kVecsPerThread > 0;
+
+  __shared__ Welford warp_stats[kRowsPerCta][kWarpsPerRow];
+
+  int row_in_cta = threadIdx.x / kThreadsPerRow;
+  int thread_in_row = threadIdx.x % kThreadsPerRow;
+  int row = blockIdx.x * kRowsPerCta + row_in_cta;
+  bool is_valid_row = row < params.m;
+  int vecs = params.n / kVec;
+
+  TIn const *input = params.input + int64_t(row) * params.ldi;
+  TIn *residual = params.residual ? params.residual + int64_t(row) * params.ldr : nullptr;
+  TOut *output = params.output + int64_t(row) * params.ldo;
+
+  //
+  // Single pass gathering the row statistics
+  //
+
+  Array<float, kVec> cache[kCached ? kVecsPerThread : 1];
+  Welford stats{0.f, 0.f, 0.f};
+
+  if (is_valid_row) {
+    if constexpr (kCached) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kVecsPerThread; ++i) {
+        int v = thread_in_row + i * kThreadsPerRow;
+        if (v < vecs) {
+          cache[i] = load_input<kVec>(input + v * kVec, residual ? residual + v * kVec : nullptr);
+          stats.template update<kRms>(cache[i]);
+        }
+      }
+    }
+    else {
+      for (int v = thread_in_row; v < vecs; v += kThreadsPerRow) {
+        stats.template update<kRms>(load_input<kVec>(input + v * kVec, residual ? residual + v * kVec : nullptr));
+      }
+    }
+  }
+
+  stats.warp_reduce();
+
+  if constexpr (kWarpsPerRow > 1) {
+    if (thread_in_row % 32 == 0) {
+      warp_stats[row_in_cta][thread_in_row / 32] = stats;
+    }
+    __syncthreads();
+
+    // Every thread merges the warps in the same order, so all agree on the statistics
+    stats = warp_stats[row_in_cta][0];
+    CUTLASS_PRAGMA_UNROLL
+    for (int w = 1; w < kWarpsPerRow; ++w) {
+      stats.merge(warp_stats[row_in_cta][w]);
+    }
+  }
+
+  if (!is_valid_row) {
+    return;
+  }
+
+  float mean = kRms ? 0.f : stats.mean;
+  float rstd = rsqrtf(stats.m2 / float(params.n) + params.epsilon);
+  float scale = params.scale_output ? *params.scale_output : 1.f;
+  float amax = 0.f;
+
+  //
+  // Normalize
+  //
+
+  auto normalize = [&](int v, Array<float, kVec> const &x) {
+    Array<float, kVec> gamma = load_vector<kVec>(params.gamma + v * kVec);
+    Array<float, kVec> beta;
+    if (!kRms && params.beta) {
+      beta = load_vector<kVec>(params.beta + v * kVec);
+    }
+    else {
+      beta.fill(0.f);
+    }
+
+    Array<float, kVec> y;
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < kVec; ++i) {
+      float value = (x[i] - mean) * rstd * gamma[i] + beta[i];
+      amax = fmaxf(amax, fabsf(value));
+      y[i] = value * scale;
+    }
+    store_vector<kVec>(output + v * kVec, y);
+  };
+
+  if constexpr (kCached) {
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < kVecsPerThread; ++i) {
+      int v = thread_in_row + i * kThreadsPerRow;
+      if (v < vecs) {
+        normalize(v, cache[i]);
+      }
+    }
+  }
+  else {
+    // The summed residual was written by this thread during the first pass
+    for (int v = thread_in_row; v < vecs; v += kThreadsPerRow) {
+      normalize(v, residual ? load_vector<kVec>(residual + v * kVec) : load_vector<kVec>(input + v * kVec));
+    }
+  }
+
+  if (params.amax_output) {
+    reduce_amax(amax, params.amax_output);
+  }
+}
+
+template <
+  typename TIn,
+  typename TOut,
+  typename TWeight,
+  bool kRms,
+  int kVec,
+  int kThreadsPerRow,
+  int kRowsPerCta,
+  int kVecsPerThread
+>
+void launch_row_norm_kernel(RowNormParams<TIn, TOut, TWeight> const &params, cudaStream_t stream) {
+  dim3 grid((params.m + kRowsPerCta - 1) / kRowsPerCta);
+  dim3 block(kThreadsPerRow * kRowsPerCta);
+  row_norm_kernel<TIn, TOut, TWeight, kRms, kVec, kThreadsPerRow, kRowsPerCta, kVecsPerThread>
+    <<<grid, block, 0, stream>>>(params);
+}
+
+/// Selects the widest vector length the operands are aligned to, then the CTA shape from the
+/// number of vectors per row: narrow rows are normalized by a single warp, and rows of more than
+/// 4096 vectors are streamed.
+template <typename TIn, typename TOut, typename TWeight, bool kRms, int kVec = kMaxVectorLength<TIn>>
+cudaError_t row_norm(RowNormParams<TIn, TOut, TWeight> const &params, cudaStream_t stream) {
+
+  if constexpr (kVec > 1) {
+    bool is_aligned =
+      params.n % kVec == 0 &&
+      is_vector_aligned<kVec>(params.input, params.ldi) &&
+      is_vector_aligned<kVec>(params.output, params.ldo) &&
+      is_vector_aligned<kVec>(params.gamma) &&
+      (!params.residual || is_vector_aligned<kVec>(params.residual, params.ldr)) &&
+      (kRms || !params.beta || is_vector_aligned<kVec>(params.beta));
+
+    if (!is_aligned) {
+      return row_norm<TIn, TOut, TWeight, kRms, kVec / 2>(params, stream);
+    }
+  }
+
+  int vecs = params.n / kVec;
+
+  if (vecs <= 128) {
+    launch_row_norm_kernel<TIn, TOut, TWeight, kRms, kVec, 32, 4, 4>(params, stream);
+  }
+  else if (vecs <= 512) {
+    launch_row_norm_kernel<TIn, TOut, TWeight, kRms, kVec, 128, 1, 4>(params, stream);
+  }
+  else if (vecs <= 2048) {
+    launch_row_norm_kernel<TIn, TOut, TWeight, kRms, kVec, 256, 1, 8>(params, stream);
+  }
+  else if (vecs <= 4096) {
+    launch_row_norm_kernel<TIn, TOut, TWeight, kRms, kVec, 512, 1, 8>(params, stream);
+  }
+  else {
+    launch_row_norm_kernel<TIn, TOut, TWeight, kRms, kVec, 1024, 1, 0>(params, stream);
+  }
+
+  return cudaGetLastError();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Arguments of GroupNorm over an NHWC tensor. Each image is split into `splits` ranges of
+/// `pixels_per_split` pixels, whose partial statistics are merged before normalization.
+template <typename TIn, typename TOut, typename TWeight>
+struct GroupNormParams {
+  TOut *output;
+  TIn const *input;
+  TIn *residual;               ///< Optional, replaced by input + residual, which is normalized
+  TWeight const *gamma;        ///< (C) scale
+  TWeight const *beta;         ///< Optional (C) shift
+  float const *scale_output;   ///< Optional scale applied to the output before conversion to TOut
+  float *amax_output;          ///< Optional absolute maximum of the unscaled output, reduced atomically
+  Welford *partials;           ///< (N, splits, groups) partial statistics
+  float2 *group_stats;         ///< (N, groups) mean and reciprocal standard deviation
+  int images;
+  int pixels;
+  int channels;
+  int groups;
+  int splits;
+  int pixels_per_split;
+  int vecs_per_pixel;          ///< Threads of a CTA cover pixels_per_iter pixels of vecs_per_pixel vectors
+  int pixels_per_iter;
+  float epsilon;
+};
+
+extern __shared__ float fused_groupnorm_smem[];
+
+/// Gathers the statistics of each group over one range of pixels of an image.
+/// grid(splits, images), block(round_up(vecs_per_pixel * pixels_per_iter, 32))
+template <typename TIn, typename TOut, typename TWeight, int kVec>
+__global__ void groupnorm_partial_stats_kernel(GroupNormParams<TIn, TOut, TWeight> params) {
+
+  Welford *thread_stats = reinterpret_cast<Welford *>(fused_groupnorm_smem);
+
+  int vec = threadIdx.x % params.vecs_per_pixel;
+  int pixel_begin = blockIdx.x * params.pixels_per_split;
+  int pixel_end = min(pixel_begin + params.pixels_per_split, params.pixels);
+  int64_t image_offset = int64_t(blockIdx.y) * params.pixels * params.channels;
+
+  Welford stats{0.f, 0.f, 0.f};
+
+  if (threadIdx.x < params.vecs_per_pixel * params.pixels_per_iter) {
+    for (int pixel = pixel_begin + threadIdx.x / params.vecs_per_pixel; pixel < pixel_end; pixel += params.pixels_per_iter) {
+      int64_t offset = image_offset + int64_t(pixel) * params.channels + vec * kVec;
+      stats.template update<false>(
+        load_input<kVec>(params.input + offset, params.residual ? params.residual + offset : nullptr));
+    }
+    thread_stats[threadIdx.x] = stats;
+  }
+  __syncthreads();
+
+  // Each vector lies within a single group, so a group's statistics are those of a run of vectors
+  int vecs_per_group = params.vecs_per_pixel / params.groups;
+  for (int group = threadIdx.x; group < params.groups; group += blockDim.x) {
+    Welford group_stats{0.f, 0.f, 0.f};
+    for (int p = 0; p < params.pixels_per_iter; ++p) {
+      for (int v = 0; v < vecs_per_group; ++v) {
+        group_stats.merge(thread_stats[p * params.vecs_per_pixel + group * vecs_per_group + v]);
+      }
+    }
+    params.partials[(int64_t(blockIdx.y) * params.splits + blockIdx.x) * params.groups + group] = group_stats;
+  }
+}
+
+/// Merges the partial statistics of each group with one warp per (image, group).
+/// grid(ceil_div(images * groups, 4)), block(128)
+template <typename TIn, typename TOut, typename TWeight>
+__global__ void groupnorm_finalize_stats_kernel(GroupNormParams<TIn, TOut, TWeight> params) {
+
+  int image_group = blockIdx.x * 4 + threadIdx.x / 32;
+  if (image_group >= params.images * params.groups) {
+    return;
+  }
+
+  int image = image_group / params.groups;
+  int group = image_group % params.groups;
+
+  Welford stats{0.f, 0.f, 0.f};
+  for (int split = threadIdx.x % 32; split < params.splits; split += 32) {
+    stats.merge(params.partials[(int64_t(image) * params.splits + split) * params.groups + group]);
+  }
+  stats.warp_reduce();
+
+  if (threadIdx.x % 32 == 0) {
+    params.group_stats[image_group] = make_float2(stats.mean, rsqrtf(stats.m2 / stats.count + params.epsilon));
+  }
+}
+
+/// Normalizes one range of pixels of an image.
+/// grid(splits, images), block(round_up(vecs_per_pixel * pixels_per_iter, 32))
+template <typename TIn, typename TOut, typename TWeight, int kVec>
+__global__ void groupnorm_apply_kernel(GroupNormParams<TIn, TOut, TWeight> params) {
+
+  int vec = threadIdx.x % params.vecs_per_pixel;
+  int channel = vec * kVec;
+  int group = vec / (params.vecs_per_pixel / params.groups);
+  int pixel_begin = blockIdx.x * params.pixels_per_split;
+  int pixel_end = min(pixel_begin + params.pixels_per_split, params.pixels);
+  int64_t image_offset = int64_t(blockIdx.y) * params.pixels * params.channels;
+  bool is_active = threadIdx.x < params.vecs_per_pixel * params.pixels_per_iter;
+
+  float amax = 0.f;
+
+  if (is_active) {
+    float2 group_stats = params.group_stats[blockIdx.y * params.groups + group];
+    float scale = params.scale_output ? *params.scale_output : 1.f;
+
+    // Each thread normalizes the same channels of every pixel it visits
+    Array<float, kVec> gamma = load_vector<kVec>(params.gamma + channel);
+    Array<float, kVec> beta;
+    if (params.beta) {
+      beta = load_vector<kVec>(params.beta + channel);
+    }
+    else {
+      beta.fill(0.f);
+    }
+
+    for (int pixel = pixel_begin + threadIdx.x / params.vecs_per_pixel; pixel < pixel_end; pixel += params.pixels_per_iter) {
+      int64_t offset = image_offset + int64_t(pixel) * params.channels + channel;
+      Array<float, kVec> x = params.residual ?
+        load_vector<kVec>(params.residual + offset) : load_vector<kVec>(params.input + offset);
+
+      Array<float, kVec> y;
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kVec; ++i) {
+        float value = (x[i] - group_stats.x) * group_stats.y * gamma[i] + beta[i];
+        amax = fmaxf(amax, fabsf(value));
+        y[i] = value * scale;
+      }
+      store_vector<kVec>(params.output + offset, y);
+    }
+  }
+
+  if (params.amax_output) {
+    reduce_amax(amax, params.amax_output);
+  }
+}
+
+/// Number of ranges each image is split into. Ranges of about 8K elements keep all SMs busy for
+/// the small batches typical of inference.
+inline int groupnorm_splits(int pixels, int channels) {
+  int64_t elements = int64_t(pixels) * channels;
+  int64_t splits = (elements + 8191) / 8192;
+  return int(splits < 1 ? 1 : (splits > pixels ? pixels : splits));
+}
+
+template <typename TIn, typename TOut, typename TWeight, int kVec = kMaxVectorLength<TIn>>
+cudaError_t groupnorm(GroupNormParams<TIn, TOut, TWeight> params, cudaStream_t stream) {
+
+  int channels_per_group = params.channels / params.groups;
+
+  if constexpr (kVec > 1) {
+    int64_t image_extent = int64_t(params.pixels) * params.channels;
+    bool is_aligned =
+      channels_per_group % kVec == 0 &&
+      is_vector_aligned<kVec>(params.input, image_extent) &&
+      is_vector_aligned<kVec>(params.output) &&
+      is_vector_aligned<kVec>(params.gamma) &&
+      (!params.residual || is_vector_aligned<kVec>(params.residual)) &&
+      (!params.beta || is_vector_aligned<kVec>(params.beta));
+
+    if (!is_aligned) {
+      return groupnorm<TIn, TOut, TWeight, kVec / 2>(params, stream);
+    }
+  }
+
+  params.vecs_per_pixel = params.channels / kVec;
+  if (params.vecs_per_pixel > 1024) {
+    return cudaErrorInvalidValue;
+  }
+  params.pixels_per_iter = params.vecs_per_pixel < 256 ? 256 / params.vecs_per_pixel : 1;
+  params.pixels_per_split = (params.pixels + params.splits - 1) / params.splits;
+
+  dim3 grid(params.splits, params.images);
+  dim3 block((params.vecs_per_pixel * params.pixels_per_iter + 31) / 32 * 32);
+
+  groupnorm_partial_stats_kernel<TIn, TOut, TWeight, kVec>
+    <<<grid, block, block.x * sizeof(Welford), stream>>>(params);
+
+  groupnorm_finalize_stats_kernel<TIn, TOut, TWeight>
+    <<<(params.images * params.groups + 3) / 4, 128, 0, stream>>>(params);
+
+  groupnorm_apply_kernel<TIn, TOut, TWeight, kVec>
+    <<<grid, block, 0, stream>>>(params);
+
+  return cudaGetLastError();
+}
+
+} // namespace fused_norm
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/** \brief Single-pass LayerNorm over the rows of a row-major (m, n) tensor.
+ *
+ *  y = (x - mean(x)) / sqrt(var(x) + epsilon) * gamma + beta, where x = input (+ residual).
+ *
+ *  \param ref_residual   optional; if not null, overwritten with input + residual, which is normalized
+ *  \param scale_output   optional device scalar multiplying y before conversion to TOut
+ *  \param amax_output    optional device scalar reduced with max(|y|); must be initialized by the caller
+ */
+template <typename TIn, typename TOut = TIn, typename TWeight = TIn>
+cudaError_t fused_layernorm(cutlass::MatrixCoord tensor_size,
+                            TensorRef<TOut, layout::RowMajor> ref_output,
+                            TensorRef<TIn, layout::RowMajor> ref_input,
+                            TensorRef<TWeight, layout::RowMajor> ref_gamma,
+                            TensorRef<TWeight, layout::RowMajor> ref_beta,
+                            cudaStream_t stream,
+                            float epsilon = 1e-5f,
+                            TensorRef<TIn, layout::RowMajor> ref_residual = TensorRef<TIn, layout::RowMajor>(),
+                            float const *scale_output = nullptr,
+                            float *amax_output = nullptr) {
+
+  fused_norm::RowNormParams<TIn, TOut, TWeight> params{
+    ref_output.data(), ref_output.stride(0),
+    ref_input.data(), ref_input.stride(0),
+    ref_residual.data(), ref_residual.stride(0),
+    ref_gamma.data(),
+    ref_beta.data(),
+    scale_output,
+    amax_output,
+    tensor_size.row(),
+    tensor_size.column(),
+    epsilon
+  };
+
+  if (params.m <= 0 || params.n <= 0) {
+    return cudaSuccess;
+  }
+
+  return fused_norm::row_norm<TIn, TOut, TWeight, false>(params, stream);
+}
+
+/** \brief Single-pass RMSNorm over the rows of a row-major (m, n) tensor.
+ *
+ *  y = x / sqrt(mean(x^2) + epsilon) * weight, where x = input (+ residual).
+ *
+ *  \param ref_residual   optional; if not null, overwritten with input + residual, which is normalized
+ *  \param scale_output   optional device scalar multiplying y before conversion to TOut
+ *  \param amax_output    optional device scalar reduced with max(|y|); must be initialized by the caller
+ */
+template <typename TIn, typename TOut = TIn, typename TWeight = TIn>
+cudaError_t fused_rmsnorm(cutlass::MatrixCoord tensor_size,
+                          TensorRef<TOut, layout::RowMajor> ref_output,
+                          TensorRef<TIn, layout::RowMajor> ref_input,
+                          TensorRef<TWeight, layout::RowMajor> ref_weight,
+                          cudaStream_t stream,
+                          float epsilon = 1e-5f,
+                          TensorRef<TIn, layout::RowMajor> ref_residual = TensorRef<TIn, layout::RowMajor>(),
+                          float const *scale_output = nullptr,
+                          float *amax_output = nullptr) {
+
+  fused_norm::RowNormParams<TIn, TOut, TWeight> params{
+    ref_output.data(), ref_output.stride(0),
+    ref_input.data(), ref_input.stride(0),
+    ref_residual.data(), ref_residual.stride(0),
+    ref_weight.data(),
+    nullptr,
+    scale_output,
+    amax_output,
+    tensor_size.row(),
+    tensor_size.column(),
+    epsilon
+  };
+
+  if (params.m <= 0 || params.n <= 0) {
+    return cudaSuccess;
+  }
+
+  return fused_norm::row_norm<TIn, TOut, TWeight, true>(params, stream);
+}
+
+/// Returns the size in bytes of the device workspace of fused_groupnorm()
+inline size_t fused_groupnorm_workspace_size(cutlass::Tensor4DCoord input_size, int num_groups) {
+  int pixels = input_size.h() * input_size.w();
+  int splits = fused_norm::groupnorm_splits(pixels, input_size.c());
+  return sizeof(fused_norm::Welford) * size_t(input_size.n()) * splits * num_groups +
+         sizeof(float2) * size_t(input_size.n()) * num_groups;
+}
+
+/** \brief GroupNorm over a packed NHWC tensor with Welford statistics.
+ *
+ *  Each image is split into ranges of pixels whose partial statistics are merged per group, so
+ *  that small batches fill the device. Channels of a group are contiguous: C / num_groups channels.
+ *
+ *  \param workspace      device memory of fused_groupnorm_workspace_size() bytes, 8B aligned
+ *  \param ref_residual   optional; if not null, overwritten with input + residual, which is normalized
+ *  \param scale_output   optional device scalar multiplying y before conversion to TOut
+ *  \param amax_output    optional device scalar reduced with max(|y|); must be initialized by the caller
+ */
+template <typename TIn, typename TOut = TIn, typename TWeight = TIn>
+cudaError_t fused_groupnorm(cutlass::Tensor4DCoord input_size,
+                            int num_groups,
+                            float epsilon,
+                            TensorRef<TOut, layout::TensorNHWC> ref_output,
+                            TensorRef<TIn, layout::TensorNHWC> ref_input,
+                            TensorRef<TWeight, layout::TensorNHWC> ref_gamma,
+                            TensorRef<TWeight, layout::TensorNHWC> ref_beta,
+                            void *workspace,
+                            cudaStream_t stream,
+                            TensorRef<TIn, layout::TensorNHWC> ref_residual = TensorRef<TIn, layout::TensorNHWC>(),
+                            float const *scale_output = nullptr,
+                            float *amax_output = nullptr) {
+
+  int images = input_size.n();
+  int pixels = input_size.h() * input_size.w();
+  int channels = input_size.c();
+
+  if (num_groups <= 0 || channels % num_groups != 0 || workspace == nullptr) {
+    return cudaErrorInvalidValue;
+  }
+  if (images <= 0 || pixels <= 0 || channels <= 0) {
+    return cudaSuccess;
+  }
+
+  int splits = fused_norm::groupnorm_splits(pixels, channels);
+  fused_norm::Welford *partials = static_cast<fused_norm::Welford *>(workspace);
+
+  fused_norm::GroupNormParams<TIn, TOut, TWeight> params{
+    ref_output.data(),
+    ref_input.data(),
+    ref_residual.data(),
+    ref_gamma.data(),
+    ref_beta.data(),
+    scale_output,
+    amax_output,
+    partials,
+    reinterpret_cast<float2 *>(partials + size_t(images) * splits * num_groups),
+    images,
+    pixels,
+    channels,
+    num_groups,
+    splits,
+    0,
+    0,
+    0,
+    epsilon
+  };
+
+  return fused_norm::groupnorm(params, stream);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
@@ -36,7 +36,10 @@
  * \brief C++ interface to CUDA device memory management functions.
  */
 
+#include <cstdint>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
 
 #include "cutlass/platform/platform.h"
@@ -90,6 +93,346 @@ void free(T* ptr) {
   }
 }
 
+/// Standard allocator returning page-locked host memory from cudaMallocHost(). Transfers from and
+/// to page-locked memory may run asynchronously and overlap with kernels and other transfers.
+template <typename T>
+struct host_pinned_allocator {
+
+  using value_type = T;
+
+  host_pinned_allocator() = default;
+
+  template <typename U>
+  host_pinned_allocator(host_pinned_allocator<U> const &) { }
+
+  T* allocate(size_t count) {
+    void* ptr = nullptr;
+    cudaError_t cuda_error = cudaMallocHost(&ptr, count * sizeof(T));
+    if (cuda_error != cudaSuccess) {
+      throw cuda_exception("Failed to allocate pinned host memory", cuda_error);
+    }
+    return static_cast<T*>(ptr);
+  }
+
+  void deallocate(T* ptr, size_t) {
+    // noexcept
+    cudaFreeHost(ptr);
+  }
+
+  template <typename U>
+  bool operator==(host_pinned_allocator<U> const &) const { return true; }
+
+  template <typename U>
+  bool operator!=(host_pinned_allocator<U> const &) const { return false; }
+};
+
+/******************************************************************************
+ * Stream-ordered allocators
+ ******************************************************************************/
+
+/// Interface of a device memory allocator. Allocations and deallocations are ordered on a CUDA
+/// stream: memory returned by allocate() may be used by work enqueued on \p stream, and memory
+/// passed to deallocate() may still be in use by work previously enqueued on \p stream.
+class DeviceMemoryAllocator {
+public:
+
+  virtual ~DeviceMemoryAllocator() { }
+
+  /// Returns a buffer of at least \p bytes bytes. Throws cuda_exception on failure.
+  virtual void* allocate(size_t bytes, cudaStream_t stream = nullptr) = 0;
+
+  /// Returns a buffer obtained from allocate(). Does not throw.
+  virtual void deallocate(void* ptr, cudaStream_t stream = nullptr) = 0;
+};
+
+/// Allocator using cudaMalloc() and cudaFree(). Deallocation implicitly synchronizes the device.
+class CudaMallocAllocator : public DeviceMemoryAllocator {
+public:
+
+  void* allocate(size_t bytes, cudaStream_t = nullptr) override {
+    void* ptr = nullptr;
+    cudaError_t cuda_error = cudaMalloc(&ptr, bytes);
+    if (cuda_error != cudaSuccess) {
+      throw cuda_exception("Failed to allocate memory", cuda_error);
+    }
+    return ptr;
+  }
+
+  void deallocate(void* ptr, cudaStream_t = nullptr) override {
+    // noexcept
+    cudaFree(ptr);
+  }
+};
+
+/// Allocator using cudaMallocFromPoolAsync() and cudaFreeAsync(). Neither call synchronizes the
+/// device; freed memory is reused by later allocations ordered after the free.
+class CudaMallocAsyncAllocator : public DeviceMemoryAllocator {
+private:
+
+  cudaMemPool_t mem_pool_;
+
+  /// Indicates the memory pool was created by, and is destroyed with, this object
+  bool owns_mem_pool_;
+
+public:
+
+  /// Allocates from \p mem_pool. If null, a dedicated memory pool is created on the current device
+  /// which retains freed memory rather than returning it to the driver at synchronization points.
+  explicit CudaMallocAsyncAllocator(cudaMemPool_t mem_pool = nullptr):
+    mem_pool_(mem_pool), owns_mem_pool_(false) {
+
+    if (!mem_pool_) {
+      int device_idx = 0;
+      cudaError_t cuda_error = cudaGetDevice(&device_idx);
+      if (cuda_error != cudaSuccess) {
+        throw cuda_exception("cudaGetDevice() failed", cuda_error);
+      }
+
+      cudaMemPoolProps props = {};
+      props.allocType = cudaMemAllocationTypePinned;
+      props.handleTypes = cudaMemHandleTypeNone;
+      props.location.type = cudaMemLocationTypeDevice;
+      props.location.id = device_idx;
+
+      cuda_error = cudaMemPoolCreate(&mem_pool_, &props);
+      if (cuda_error != cudaSuccess) {
+        throw cuda_exception("cudaMemPoolCreate() failed", cuda_error);
+      }
+      owns_mem_pool_ = true;
+
+      uint64_t release_threshold = UINT64_MAX;
+      cudaMemPoolSetAttribute(mem_pool_, cudaMemPoolAttrReleaseThreshold, &release_threshold);
+    }
+  }
+
+  /// Destroys an owned memory pool. All allocations must have been deallocated.
+  ~CudaMallocAsyncAllocator() override {
+    if (owns_mem_pool_) {
+      cudaMemPoolDestroy(mem_pool_);
+    }
+  }
+
+  CudaMallocAsyncAllocator(CudaMallocAsyncAllocator const &) = delete;
+  CudaMallocAsyncAllocator &operator=(CudaMallocAsyncAllocator const &) = delete;
+
+  void* allocate(size_t bytes, cudaStream_t stream = nullptr) override {
+    void* ptr = nullptr;
+    cudaError_t cuda_error = cudaMallocFromPoolAsync(&ptr, bytes, mem_pool_, stream);
+    if (cuda_error != cudaSuccess) {
+#if (CUTLASS_DEBUG_TRACE_LEVEL > 0)
+      std::ostringstream os;
+      os << "cutlass::device_memory::CudaMallocAsyncAllocator: cudaMallocFromPoolAsync failed: bytes=" << bytes;
+      CUTLASS_TRACE_HOST(os.str());
+#endif
+      throw cuda_exception("Failed to allocate memory", cuda_error);
+    }
+    return ptr;
+  }
+
+  void deallocate(void* ptr, cudaStream_t stream = nullptr) override {
+    // noexcept
+    cudaFreeAsync(ptr, stream);
+  }
+
+  /// Underlying CUDA memory pool
+  cudaMemPool_t mem_pool() const {
+    return mem_pool_;
+  }
+};
+
+/// Caching arena over cudaMalloc(). Requests are rounded up to a power of two of at least
+/// kMinBlockBytes. A freed block is reused immediately by requests on the stream which freed it,
+/// and by requests on other streams once the work enqueued before the free has completed. Memory
+/// is returned to the driver only by release_cached(), when an allocation fails, or on destruction.
+class CachingDeviceAllocator : public DeviceMemoryAllocator {
+public:
+
+  static size_t const kMinBlockBytes = 512;
+
+private:
+
+  struct Block {
+    void* ptr = nullptr;
+    size_t bytes = 0;
+    cudaStream_t stream = nullptr;
+
+    /// Recorded on the freeing stream; null until the block has been freed once
+    cudaEvent_t ready = nullptr;
+  };
+
+  mutable std::mutex mutex_;
+
+  /// Blocks handed out by allocate(), keyed by pointer
+  std::map<void*, Block> live_;
+
+  /// Blocks available for reuse, keyed by size
+  std::multimap<size_t, Block> cached_;
+
+  size_t cached_bytes_ = 0;
+
+  static size_t round_up(size_t bytes) {
+    size_t block_bytes = kMinBlockBytes;
+    while (block_bytes < bytes) {
+      block_bytes <<= 1;
+    }
+    return block_bytes;
+  }
+
+  static void destroy(Block &block) {
+    if (block.ready) {
+      cudaEventSynchronize(block.ready);
+      cudaEventDestroy(block.ready);
+    }
+    cudaFree(block.ptr);
+  }
+
+  /// Removes a reusable block of exactly \p bytes bytes from the cache, if any. Caller holds mutex_.
+  bool take_cached(size_t bytes, cudaStream_t stream, Block &block) {
+    auto range = cached_.equal_range(bytes);
+
+    // Prefer blocks freed on the same stream, which are safe to reuse without waiting.
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second.stream == stream) {
+        block = it->second;
+        cached_.erase(it);
+        cached_bytes_ -= bytes;
+        return true;
+      }
+    }
+    for (auto it = range.first; it != range.second; ++it) {
+      if (cudaEventQuery(it->second.ready) == cudaSuccess) {
+        block = it->second;
+        cached_.erase(it);
+        cached_bytes_ -= bytes;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// Caller holds mutex_
+  void release_cached_locked() {
+    for (auto &entry : cached_) {
+      destroy(entry.second);
+    }
+    cached_.clear();
+    cached_bytes_ = 0;
+  }
+
+public:
+
+  CachingDeviceAllocator() = default;
+
+  /// Returns all memory to the driver. All allocations must have been deallocated.
+  ~CachingDeviceAllocator() override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    release_cached_locked();
+    for (auto &entry : live_) {
+      destroy(entry.second);
+    }
+    live_.clear();
+  }
+
+  CachingDeviceAllocator(CachingDeviceAllocator const &) = delete;
+  CachingDeviceAllocator &operator=(CachingDeviceAllocator const &) = delete;
+
+  void* allocate(size_t bytes, cudaStream_t stream = nullptr) override {
+    size_t block_bytes = round_up(bytes);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    Block block;
+    if (!take_cached(block_bytes, stream, block)) {
+      block.bytes = block_bytes;
+
+      cudaError_t cuda_error = cudaMalloc(&block.ptr, block_bytes);
+      if (cuda_error != cudaSuccess) {
+        // Clear the sticky error, return cached memory to the driver, and retry once.
+        cudaGetLastError();
+        release_cached_locked();
+        cuda_error = cudaMalloc(&block.ptr, block_bytes);
+      }
+      if (cuda_error != cudaSuccess) {
+#if (CUTLASS_DEBUG_TRACE_LEVEL > 0)
+        std::ostringstream os;
+        os << "cutlass::device_memory::CachingDeviceAllocator: cudaMalloc failed: bytes=" << block_bytes;
+        CUTLASS_TRACE_HOST(os.str());
+#endif
+        throw cuda_exception("Failed to allocate memory", cuda_error);
+      }
+    }
+
+    block.stream = stream;
+    live_[block.ptr] = block;
+    return block.ptr;
+  }
+
+  void deallocate(void* ptr, cudaStream_t stream = nullptr) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = live_.find(ptr);
+    if (it == live_.end()) {
+      return;
+    }
+    Block block = it->second;
+    live_.erase(it);
+
+    if (!block.ready && cudaEventCreateWithFlags(&block.ready, cudaEventDisableTiming) != cudaSuccess) {
+      // Without an event, the block cannot be safely shared across streams.
+      cudaFree(block.ptr);
+      return;
+    }
+    block.stream = stream;
+    cudaEventRecord(block.ready, stream);
+
+    cached_bytes_ += block.bytes;
+    cached_.emplace(block.bytes, block);
+  }
+
+  /// Returns all cached blocks to the driver, waiting for pending work using them
+  void release_cached() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    release_cached_locked();
+  }
+
+  /// Number of bytes held in the cache and available for reuse
+  size_t cached_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cached_bytes_;
+  }
+};
+
+namespace detail {
+
+inline std::shared_ptr<DeviceMemoryAllocator> &default_allocator() {
+  static std::shared_ptr<DeviceMemoryAllocator> allocator;
+  return allocator;
+}
+
+} // namespace detail
+
+/// Returns the allocator used by DeviceAllocation when none is given. Null denotes cudaMalloc()
+/// and cudaFree().
+inline std::shared_ptr<DeviceMemoryAllocator> get_default_allocator() {
+  return detail::default_allocator();
+}
+
+/// Sets the allocator used by DeviceAllocation objects constructed afterwards. Existing objects
+/// keep the allocator which created them.
+inline void set_default_allocator(std::shared_ptr<DeviceMemoryAllocator> allocator) {
+  detail::default_allocator() = std::move(allocator);
+}
+
+/// Allocate a buffer of \p count elements of type \p T from \p allocator, ordered on \p stream
+template <typename T>
+T* allocate(size_t count, cudaStream_t stream, DeviceMemoryAllocator *allocator) {
+  if (!allocator) {
+    return allocate<T>(count);
+  }
+  size_t bytes = count * sizeof_bits<T>::value / 8;
+  return static_cast<T*>(allocator->allocate(bytes, stream));
+}
+
 /******************************************************************************
  * Data movement
  ******************************************************************************/
@@ -150,6 +493,36 @@ void copy_host_to_host(T* dst, T const* src, size_t count = 1) {
   copy(dst, src, count, cudaMemcpyHostToHost);
 }
 
+/// Enqueues a copy on \p stream. The copy is asynchronous with respect to the host only if the
+/// host-side buffer is page-locked.
+template <typename T>
+void copy_async(T* dst, T const* src, size_t count, cudaMemcpyKind kind, cudaStream_t stream = nullptr) {
+  size_t bytes = count * sizeof_bits<T>::value / 8;
+  if (bytes == 0 && count > 0) {
+    bytes = 1;
+  }
+  cudaError_t cuda_error = (cudaMemcpyAsync(dst, src, bytes, kind, stream));
+  if (cuda_error != cudaSuccess) {
+    std::ostringstream os;
+    os << "cutlass::device_memory::copy_async: cudaMemcpyAsync() failed: "
+       << "dst=" << dst << ", src=" << src
+       << ", bytes=" << bytes << ", count=" << count
+       << ", error: " << cudaGetErrorString(cuda_error);
+
+    throw cuda_exception(os.str().c_str(), cuda_error);
+  }
+}
+
+template <typename T>
+void copy_to_device_async(T* dst, T const* src, size_t count = 1, cudaStream_t stream = nullptr) {
+  copy_async(dst, src, count, cudaMemcpyHostToDevice, stream);
+}
+
+template <typename T>
+void copy_to_host_async(T* dst, T const* src, size_t count = 1, cudaStream_t stream = nullptr) {
+  copy_async(dst, src, count, cudaMemcpyDeviceToHost, stream);
+}
+
 /// Copies elements from device memory to host-side range
 template <typename OutputIterator, typename T>
 void insert_to_host(OutputIterator begin, OutputIterator end, T const* device_begin) {
@@ -174,9 +547,17 @@ template <typename T>
 class DeviceAllocation {
 public:
 
-  /// Delete functor for CUDA device memory
+  /// Delete functor for CUDA device memory. Returns memory to the allocator which provided it,
+  /// ordered on the stream it was allocated on, or calls cudaFree() if there is no allocator.
   struct deleter {
+    std::shared_ptr<device_memory::DeviceMemoryAllocator> allocator;
+    cudaStream_t stream = nullptr;
+
     void operator()(T* ptr) {
+      if (allocator) {
+        allocator->deallocate(ptr, stream);
+        return;
+      }
       cudaError_t cuda_error = (cudaFree(ptr));
       if (cuda_error != cudaSuccess) {
         // noexcept
@@ -215,6 +596,32 @@ public:
     }
   }
 
+private:
+
+  /// Exchanges the managed objects and deleters of two smart pointers. platform::unique_ptr is
+  /// copyable and its swap() exchanges only the pointers.
+  static void swap_storage(platform::unique_ptr<T, deleter> &lhs, platform::unique_ptr<T, deleter> &rhs) {
+    lhs.swap(rhs);
+    std::swap(lhs.get_deleter(), rhs.get_deleter());
+  }
+
+  /// Allocates \p count elements using the allocator and stream of \p d
+  static T* allocate(size_t count, deleter const &d) {
+    return device_memory::allocate<T>(count, d.stream, d.allocator.get());
+  }
+
+  /// Copies \p count elements from device memory, ordered on the allocation stream if this
+  /// object's memory is stream-ordered
+  void copy_in(T const *ptr, size_t count) {
+    deleter const &d = smart_ptr.get_deleter();
+    if (d.allocator) {
+      device_memory::copy_async(get(), ptr, count, cudaMemcpyDeviceToDevice, d.stream);
+    }
+    else {
+      device_memory::copy_device_to_device(get(), ptr, count);
+    }
+  }
+
 public:
 
   //
@@ -222,25 +629,37 @@ public:
   //
 
   /// Constructor: allocates no memory
-  DeviceAllocation() : capacity(0) {}
+  DeviceAllocation() : capacity(0) {
+    smart_ptr.get_deleter().allocator = device_memory::get_default_allocator();
+  }
+
+  /// Constructor: allocates \p capacity elements on the current CUDA device using the default allocator
+  DeviceAllocation(size_t _capacity) : capacity(0) {
+    reset(_capacity, nullptr, device_memory::get_default_allocator());
+  }
 
-  /// Constructor: allocates \p capacity elements on the current CUDA device
-  DeviceAllocation(size_t _capacity) : 
-    smart_ptr(device_memory::allocate<T>(_capacity)), capacity(_capacity) {}
+  /// Constructor: allocates \p capacity elements from \p allocator, ordered on \p stream. The memory
+  /// is returned to \p allocator on the same stream. A null allocator uses cudaMalloc() and cudaFree().
+  DeviceAllocation(
+    size_t _capacity,
+    cudaStream_t stream,
+    std::shared_ptr<device_memory::DeviceMemoryAllocator> allocator = device_memory::get_default_allocator()) : capacity(0) {
+
+    reset(_capacity, stream, std::move(allocator));
+  }
 
   /// Constructor: allocates \p capacity elements on the current CUDA device taking ownership of the allocation
   DeviceAllocation(T *ptr, size_t _capacity) : smart_ptr(ptr), capacity(_capacity) {}
 
-  /// Copy constructor
-  DeviceAllocation(DeviceAllocation const &p): 
-    smart_ptr(device_memory::allocate<T>(p.capacity)), capacity(p.capacity) {
-
-    device_memory::copy_device_to_device(smart_ptr.get(), p.get(), capacity);
+  /// Copy constructor. The copy is allocated from the same allocator and stream as \p p.
+  DeviceAllocation(DeviceAllocation const &p): capacity(0) {
+    reset(p.capacity, p.get_deleter().stream, p.get_deleter().allocator);
+    copy_in(p.get(), capacity);
   }
 
   /// Move constructor
   DeviceAllocation(DeviceAllocation &&p): capacity(0) {
-    std::swap(smart_ptr, p.smart_ptr);
+    swap_storage(smart_ptr, p.smart_ptr);
     std::swap(capacity, p.capacity);
   }
 
@@ -250,7 +669,8 @@ public:
   /// Returns a pointer to the managed object
   T* get() const { return smart_ptr.get(); }
 
-  /// Releases the ownership of the managed object (without deleting) and resets capacity to zero
+  /// Releases the ownership of the managed object (without deleting) and resets capacity to zero.
+  /// Memory obtained from an allocator must be returned to it by the caller.
   T* release() {
     capacity = 0;
     return smart_ptr.release();
@@ -262,29 +682,49 @@ public:
     smart_ptr.reset();
   }
 
-  /// Deletes managed object, if owned, and allocates a new object
+  /// Deletes managed object, if owned, and allocates a new object. The allocator and stream of
+  /// this object are retained; if it has no allocator, the default allocator is used.
   void reset(size_t _capacity) {
-    reset(device_memory::allocate<T>(_capacity), _capacity);
+    deleter d = smart_ptr.get_deleter();
+    reset(_capacity, d.stream, d.allocator ? d.allocator : device_memory::get_default_allocator());
   }
 
-  /// Deletes managed object, if owned, and replaces its reference with a given pointer and capacity
+  /// Deletes managed object, if owned, and allocates a new object from \p allocator, ordered on \p stream
+  void reset(
+    size_t _capacity,
+    cudaStream_t stream,
+    std::shared_ptr<device_memory::DeviceMemoryAllocator> allocator) {
+
+    reset();
+
+    deleter &d = smart_ptr.get_deleter();
+    d.allocator = std::move(allocator);
+    d.stream = stream;
+
+    if (_capacity) {
+      smart_ptr.reset(allocate(_capacity, d));
+    }
+    capacity = _capacity;
+  }
+
+  /// Deletes managed object, if owned, and replaces its reference with a given pointer and capacity.
+  /// The pointer must have been allocated with cudaMalloc().
   void reset(T* _ptr, size_t _capacity) {
     smart_ptr.reset(_ptr);
+    smart_ptr.get_deleter() = deleter();
     capacity = _capacity;
   }
 
   /// Allocates a new buffer and copies the old buffer into it. The old buffer is then released.
   void reallocate(size_t new_capacity) {
-    
-    platform::unique_ptr<T, deleter> new_allocation(device_memory::allocate<T>(new_capacity));
 
-    device_memory::copy_device_to_device(
-      new_allocation.get(), 
-      smart_ptr.get(), 
-      std::min(new_capacity, capacity));
+    platform::unique_ptr<T, deleter> new_allocation(allocate(new_capacity, smart_ptr.get_deleter()));
+    new_allocation.get_deleter() = smart_ptr.get_deleter();
 
-    std::swap(smart_ptr, new_allocation);
+    swap_storage(smart_ptr, new_allocation);
     std::swap(new_capacity, capacity);
+
+    copy_in(new_allocation.get(), std::min(new_capacity, capacity));
   }
 
   /// Returns the number of elements
@@ -309,16 +749,15 @@ public:
   /// Copies a device-side memory allocation
   DeviceAllocation & operator=(DeviceAllocation const &p) {
     if (capacity != p.capacity) {
-      smart_ptr.reset(device_memory::allocate<T>(p.capacity));
-      capacity = p.capacity;
+      reset(p.capacity);
     }
-    device_memory::copy_device_to_device(smart_ptr.get(), p.get(), capacity);
+    copy_in(p.get(), capacity);
     return *this;
   }
 
   /// Move assignment
   DeviceAllocation & operator=(DeviceAllocation && p) {
-    std::swap(smart_ptr, p.smart_ptr);
+    swap_storage(smart_ptr, p.smart_ptr);
     std::swap(capacity, p.capacity);
     return *this;
   }
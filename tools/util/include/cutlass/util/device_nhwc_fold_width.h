@@ -0,0 +1,221 @@
+/******************************************************************************
+ * Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+/**
+ * \file
+ * \brief cuda kernels folding the filter width of a small-channel fprop into its channels.
+ *
+ * The TMA im2col loads of the 3.x implicit GEMM convolutions require 16B aligned channels, so input
+ * layers with C = 3 or 4 (e.g. the stem of vision models) would have to be padded to C = 8, wasting
+ * most of the reads and of the GEMM-K. Folding the filter width S into the channels turns such a
+ * convolution into one with a filter width of 1, a horizontal stride of 1, no horizontal padding and
+ * C' = round_up(S * C, alignment) channels, which the TMA kernels run as is:
+ *
+ *   x'[n,(d,)h,q,s*C+c] = x[n,(d,)h,q*stride_w-pad_w+s*dilation_w,c]   (0 if out of bounds or s >= S)
+ *   w'[k,(t,)r,0,s*C+c] = w[k,(t,)r,s,c]                                (s is flipped for kConvolution)
+ *
+ * The folded problem has the same output tensor. For a 7x7/s2 stem with C = 3 in 16b types, C' = 24
+ * instead of 7 * 8 = 56 per filter row.
+ */
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/conv/convnd_problem_shape.hpp"
+
+namespace cutlass {
+
+/// Channels of the width-folded activation and filter tensors
+template <int NumSpatialDimensions>
+int fold_width_channels(
+    conv::ConvProblemShape<conv::Operator::kFprop, NumSpatialDimensions> const& problem_shape,
+    int alignment) {
+  constexpr int RankT = NumSpatialDimensions + 2;
+  int folded_channels = problem_shape.shape_A[RankT - 1] * problem_shape.shape_B[RankT - 2];
+  return (folded_channels + alignment - 1) / alignment * alignment;
+}
+
+/// Problem shape of the width-folded fprop, with packed tensors
+template <int NumSpatialDimensions>
+conv::ConvProblemShape<conv::Operator::kFprop, NumSpatialDimensions>
+fold_width_problem_shape(
+    conv::ConvProblemShape<conv::Operator::kFprop, NumSpatialDimensions> const& problem_shape,
+    int alignment) {
+  using ProblemShape = conv::ConvProblemShape<conv::Operator::kFprop, NumSpatialDimensions>;
+  constexpr int RankT = ProblemShape::RankT;
+  constexpr int RankS = ProblemShape::RankS;
+
+  int folded_channels = fold_width_channels(problem_shape, alignment);
+
+  typename ProblemShape::TensorExtent shape_act = problem_shape.shape_A;
+  typename ProblemShape::TensorExtent shape_flt = problem_shape.shape_B;
+  shape_act[RankT - 2] = problem_shape.shape_C[RankT - 2];        // W' = Q
+  shape_act[RankT - 1] = folded_channels;
+  shape_flt[RankT - 2] = 1;                                       // S' = 1
+  shape_flt[RankT - 1] = folded_channels;
+
+  auto lower_padding = problem_shape.lower_padding;
+  auto upper_padding = problem_shape.upper_padding;
+  auto traversal_stride = problem_shape.traversal_stride;
+  auto dilation = problem_shape.dilation;
+  lower_padding[RankS - 1] = 0;
+  upper_padding[RankS - 1] = 0;
+  traversal_stride[RankS - 1] = 1;
+  dilation[RankS - 1] = 1;
+
+  return ProblemShape(problem_shape.mode, shape_act, shape_flt,
+                      lower_padding, upper_padding, traversal_stride, dilation, problem_shape.groups);
+}
+
+/// Gathers x' from x, one output element per thread. Rows are the leading (n,d,h) modes.
+template <typename T>
+__global__ void nhwc_fold_width_kernel(const int32_t rows,
+                                       const int32_t w,
+                                       const int32_t c,
+                                       const int32_t q,
+                                       const int32_t s,
+                                       const int32_t c_folded,
+                                       const int32_t stride_w,
+                                       const int32_t pad_w,
+                                       const int32_t dilation_w,
+                                       const T *input,
+                                       T *output) {
+  const int64_t idx_jump       = int64_t(blockDim.x) * gridDim.x;
+  const int64_t total_elements = int64_t(rows) * q * c_folded;
+
+  for (int64_t idx = int64_t(blockIdx.x) * blockDim.x + threadIdx.x; idx < total_elements; idx += idx_jump) {
+    int32_t c_idx = int32_t(idx % c_folded);
+    int64_t residual = idx / c_folded;
+    int32_t q_idx = int32_t(residual % q);
+    int64_t row_idx = residual / q;
+
+    int32_t s_idx = c_idx / c;
+    int32_t w_idx = q_idx * stride_w - pad_w + s_idx * dilation_w;
+
+    T value = T(0);
+    if (s_idx < s && w_idx >= 0 && w_idx < w) {
+      value = input[(row_idx * w + w_idx) * c + (c_idx - s_idx * c)];
+    }
+    output[idx] = value;
+  }
+}
+
+/// Gathers w' from w, one output element per thread. Rows are the leading (k,t,r) modes.
+template <typename T>
+__global__ void krsc_fold_width_kernel(const int32_t rows,
+                                       const int32_t s,
+                                       const int32_t c,
+                                       const int32_t c_folded,
+                                       const bool flip_s,
+                                       const T *input,
+                                       T *output) {
+  const int64_t idx_jump       = int64_t(blockDim.x) * gridDim.x;
+  const int64_t total_elements = int64_t(rows) * c_folded;
+
+  for (int64_t idx = int64_t(blockIdx.x) * blockDim.x + threadIdx.x; idx < total_elements; idx += idx_jump) {
+    int32_t c_idx = int32_t(idx % c_folded);
+    int64_t row_idx = idx / c_folded;
+    int32_t s_idx = c_idx / c;
+
+    T value = T(0);
+    if (s_idx < s) {
+      int32_t s_src = flip_s ? s - 1 - s_idx : s_idx;
+      value = input[(row_idx * s + s_src) * c + (c_idx - s_idx * c)];
+    }
+    output[idx] = value;
+  }
+}
+
+/** \brief Folds the filter width of a packed NHWC / NDHWC activation into its channels
+ * \tparam T: data type
+ * output must hold the activation of fold_width_problem_shape(problem_shape, alignment)
+ */
+template <typename T, int NumSpatialDimensions>
+void nhwc_fold_width(conv::ConvProblemShape<conv::Operator::kFprop, NumSpatialDimensions> const& problem_shape,
+                     int alignment,
+                     T const* input,
+                     T* output,
+                     cudaStream_t stream) {
+  constexpr int RankT = NumSpatialDimensions + 2;
+  constexpr int RankS = NumSpatialDimensions;
+
+  int32_t rows = 1;
+  for (int i = 0; i < RankT - 2; ++i) {
+    rows *= problem_shape.shape_A[i];
+  }
+  int32_t w = problem_shape.shape_A[RankT - 2];
+  int32_t c = problem_shape.shape_A[RankT - 1];
+  int32_t q = problem_shape.shape_C[RankT - 2];
+  int32_t s = problem_shape.shape_B[RankT - 2];
+  int32_t c_folded = fold_width_channels(problem_shape, alignment);
+
+  int64_t total_elements = int64_t(rows) * q * c_folded;
+  int block_size = 256;
+  dim3 grid(int((total_elements + block_size - 1) / block_size));
+  dim3 block(block_size);
+  nhwc_fold_width_kernel<<<grid, block, 0, stream>>>(
+    rows, w, c, q, s, c_folded,
+    problem_shape.traversal_stride[RankS - 1], problem_shape.lower_padding[RankS - 1], problem_shape.dilation[RankS - 1],
+    input, output);
+}
+
+/** \brief Folds the filter width of a packed KRSC / KTRSC filter into its channels
+ * \tparam T: data type
+ * output must hold the filter of fold_width_problem_shape(problem_shape, alignment)
+ */
+template <typename T, int NumSpatialDimensions>
+void krsc_fold_width(conv::ConvProblemShape<conv::Operator::kFprop, NumSpatialDimensions> const& problem_shape,
+                     int alignment,
+                     T const* input,
+                     T* output,
+                     cudaStream_t stream) {
+  constexpr int RankT = NumSpatialDimensions + 2;
+
+  int32_t rows = 1;
+  for (int i = 0; i < RankT - 2; ++i) {
+    rows *= problem_shape.shape_B[i];
+  }
+  int32_t s = problem_shape.shape_B[RankT - 2];
+  int32_t c = problem_shape.shape_B[RankT - 1];
+  int32_t c_folded = fold_width_channels(problem_shape, alignment);
+  // The kernel only flips the folded S' = 1, so convolution mode flips S while folding
+  bool flip_s = problem_shape.mode == conv::Mode::kConvolution;
+
+  int64_t total_elements = int64_t(rows) * c_folded;
+  int block_size = 256;
+  dim3 grid(int((total_elements + block_size - 1) / block_size));
+  dim3 block(block_size);
+  krsc_fold_width_kernel<<<grid, block, 0, stream>>>(
+    rows, s, c, c_folded, flip_s, input, output);
+}
+
+} //namespace cutlass
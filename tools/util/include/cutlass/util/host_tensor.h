@@ -39,9 +39,14 @@
 
   Call {host, device}_{data, ref, view}() for accessing host or device memory.
 
+  Host memory is obtained from the HostAllocator template argument. Pass
+  device_memory::host_pinned_allocator (or use PinnedHostTensor) for page-locked host memory, which
+  allows sync_device_async() and sync_host_async() to overlap transfers with kernels.
+
   See cutlass/tensor_ref.h and cutlass/tensor_view.h for more details.
 */
 
+#include <memory>
 #include <vector>
 
 #include "cutlass/cutlass.h"
@@ -60,7 +65,9 @@ template <
   /// Data type of element stored within tensor (concept: NumericType)
   typename Element_,
   /// Defines a mapping from logical coordinate to linear memory (concept: Layout)
-  typename Layout_
+  typename Layout_,
+  /// Allocator of host memory, rebound to the internal storage type (concept: Allocator)
+  typename HostAllocator_ = std::allocator<Element_>
 >
 class HostTensor {
 public:
@@ -114,6 +121,8 @@ private:
   static constexpr int kContainerTypeNumBytes = StorageContainerCalculator::kContainerTypeNumBytes;
   static constexpr int kContainerTypeNumStorageUnit = StorageContainerCalculator::kContainerTypeNumStorageUnit;
 
+  using HostAllocator = typename std::allocator_traits<HostAllocator_>::template rebind_alloc<StorageUnit>;
+
   //
   // Data members
   //
@@ -125,7 +134,7 @@ private:
   Layout layout_;
 
   /// Host-side memory allocation
-  std::vector<StorageUnit> host_;
+  std::vector<StorageUnit, HostAllocator> host_;
 
   /// Device-side memory
   device_memory::allocation<StorageUnit> device_;
@@ -407,6 +416,24 @@ public:
     }
   }
 
+  /// Enqueues a copy of data from device to host on a stream. The host must synchronize with the
+  /// stream before reading host memory. The copy is asynchronous only for pinned host memory.
+  void sync_host_async(cudaStream_t stream) {
+    if (device_backed()) {
+      device_memory::copy_to_host_async(
+          host_.data(), device_.get(), device_.size(), stream);
+    }
+  }
+
+  /// Enqueues a copy of data from host to device on a stream. Host memory must not be modified
+  /// until the copy completes. The copy is asynchronous only for pinned host memory.
+  void sync_device_async(cudaStream_t stream) {
+    if (device_backed()) {
+      device_memory::copy_to_device_async(
+          device_.get(), host_.data(), host_.size(), stream);
+    }
+  }
+
   /// Copy data from a caller-supplied device pointer into host memory.
   void copy_in_device_to_host(
     Element const* ptr_device,        ///< source device memory
@@ -538,4 +565,13 @@ public:
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Host tensor whose host memory is page-locked
+template <
+  typename Element,
+  typename Layout
+>
+using PinnedHostTensor = HostTensor<Element, Layout, device_memory::host_pinned_allocator<Element>>;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
 }  // namespace cutlass
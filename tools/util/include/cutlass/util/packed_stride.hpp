@@ -37,6 +37,7 @@
 #include "cute/layout.hpp"
 #include "cute/container/array.hpp"   // cute::array
 #include "cutlass/conv/convolution.h" // cutlass::conv::Operator
+#include "cutlass/detail/gated_layout.hpp" // cutlass::sm90_make_gated_shape
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -565,6 +566,107 @@ make_cute_packed_stride(
   });
   return s_copy;
 }
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Strides of sm90 gated (GLU) GEMM operands, which interleave gate and up along M in groups of 8 rows
+
+// K-major gated gemm stride
+template <class StrideIntT>
+CUTLASS_HOST_DEVICE
+cute::Stride<cute::Stride<StrideIntT,StrideIntT,StrideIntT>, cute::Int<1>, StrideIntT>
+sm90_make_gated_packed_stride(cute::Stride<cute::Stride<StrideIntT,StrideIntT,StrideIntT>, cute::Int<1>, StrideIntT>, cute::Shape<int,int,int> shape_MKL) {
+  using namespace cute;
+  static_assert(std::is_integral_v<StrideIntT>, "Stride must have an integral type so it can be set dynamically. Static strides not supported.");
+  auto shape = sm90_make_gated_shape<0>(cute::transform(shape_MKL, [](auto s){ return static_cast<StrideIntT>(s); }));
+  auto stride = compact_order(shape, Step<Step<_1,_3,_2>,_0,_4>{});
+  return stride;
+}
+
+// K-major gated gemm output stride
+template <class StrideIntT>
+CUTLASS_HOST_DEVICE
+cute::Stride<cute::Stride<StrideIntT,StrideIntT>, cute::Int<1>, StrideIntT>
+sm90_make_gated_packed_stride(cute::Stride<cute::Stride<StrideIntT,StrideIntT>, cute::Int<1>, StrideIntT>, cute::Shape<int,int,int> shape_MKL) {
+  using namespace cute;
+  static_assert(std::is_integral_v<StrideIntT>, "Stride must have an integral type so it can be set dynamically. Static strides not supported.");
+  auto shape = sm90_make_gated_output_shape<0>(cute::transform(shape_MKL, [](auto s){ return static_cast<StrideIntT>(s); }));
+  auto stride = compact_order(shape, Step<Step<_1,_2>,_0,_3>{});
+  return stride;
+}
+
+// K-major grouped gemm stride
+template <class StrideIntT>
+CUTLASS_HOST_DEVICE
+cute::Stride<cute::Stride<StrideIntT,StrideIntT,StrideIntT>, cute::Int<1>, cute::Int<0>>
+sm90_make_gated_packed_stride(cute::Stride<cute::Stride<StrideIntT,StrideIntT,StrideIntT>, cute::Int<1>, cute::Int<0>>, cute::Shape<int,int,int> shape_MKL) {
+  using namespace cute;
+  static_assert(std::is_integral_v<StrideIntT>, "Stride must have an integral type so it can be set dynamically. Static strides not supported.");
+  auto shape = sm90_make_gated_shape<0>(cute::transform(shape_MKL, [](auto s){ return static_cast<StrideIntT>(s); }));
+  auto stride = append(compact_order(take<0,2>(shape), Step<Step<_1,_3,_2>,_0>{}), Int<0>{});
+  return stride;
+}
+
+// K-major grouped gemm output stride
+template <class StrideIntT>
+CUTLASS_HOST_DEVICE
+cute::Stride<cute::Stride<StrideIntT,StrideIntT>, cute::Int<1>, cute::Int<0>>
+sm90_make_gated_packed_stride(cute::Stride<cute::Stride<StrideIntT,StrideIntT>, cute::Int<1>, cute::Int<0>>, cute::Shape<int,int,int> shape_MKL) {
+  using namespace cute;
+  static_assert(std::is_integral_v<StrideIntT>, "Stride must have an integral type so it can be set dynamically. Static strides not supported.");
+  auto shape = sm90_make_gated_output_shape<0>(cute::transform(shape_MKL, [](auto s){ return static_cast<StrideIntT>(s); }));
+  auto stride = append(compact_order(take<0,2>(shape), Step<Step<_1,_2>,_0>{}), Int<0>{});
+  return stride;
+}
+
+// MN-major gated gemm stride
+template <class StrideIntT>
+CUTLASS_HOST_DEVICE
+cute::Stride<cute::Stride<cute::Int<1>,StrideIntT,cute::Int<8>>, StrideIntT, StrideIntT>
+sm90_make_gated_packed_stride(cute::Stride<cute::Stride<cute::Int<1>,StrideIntT,cute::Int<8>>, StrideIntT, StrideIntT>, cute::Shape<int,int,int> shape_MKL) {
+  using namespace cute;
+  static_assert(std::is_integral_v<StrideIntT>, "Stride must have an integral type so it can be set dynamically. Static strides not supported.");
+  auto shape = sm90_make_gated_shape<0>(cute::transform(shape_MKL, [](auto s){ return static_cast<StrideIntT>(s); }));
+  auto stride = compact_order(shape, Step<Step<_0,_2,_1>,_3,_4>{});
+  return stride;
+}
+
+// MN-major gated gemm output stride
+template <class StrideIntT>
+CUTLASS_HOST_DEVICE
+cute::Stride<cute::Stride<cute::Int<1>,cute::Int<8>>, StrideIntT, StrideIntT>
+sm90_make_gated_packed_stride(cute::Stride<cute::Stride<cute::Int<1>,cute::Int<8>>, StrideIntT, StrideIntT>, cute::Shape<int,int,int> shape_MKL) {
+  using namespace cute;
+  static_assert(std::is_integral_v<StrideIntT>, "Stride must have an integral type so it can be set dynamically. Static strides not supported.");
+  auto shape = sm90_make_gated_output_shape<0>(cute::transform(shape_MKL, [](auto s){ return static_cast<StrideIntT>(s); }));
+  auto stride = compact_order(shape, Step<Step<_0,_1>,_2,_3>{});
+  return stride;
+}
+
+// MN-major gated grouped gemm stride
+template <class StrideIntT>
+CUTLASS_HOST_DEVICE
+cute::Stride<cute::Stride<cute::Int<1>,StrideIntT,cute::Int<8>>, StrideIntT, cute::Int<0>>
+sm90_make_gated_packed_stride(cute::Stride<cute::Stride<cute::Int<1>,StrideIntT,cute::Int<8>>, StrideIntT, cute::Int<0>>, cute::Shape<int,int,int> shape_MKL) {
+  using namespace cute;
+  static_assert(std::is_integral_v<StrideIntT>, "Stride must have an integral type so it can be set dynamically. Static strides not supported.");
+  auto shape = sm90_make_gated_shape<0>(cute::transform(shape_MKL, [](auto s){ return static_cast<StrideIntT>(s); }));
+  auto stride = append(compact_order(take<0,2>(shape), Step<Step<_0,_2,_1>,_3>{}), Int<0>{});
+  return stride;
+}
+
+// MN-major gated grouped gemm output stride
+template <class StrideIntT>
+CUTLASS_HOST_DEVICE
+cute::Stride<cute::Stride<cute::Int<1>,cute::Int<8>>, StrideIntT, cute::Int<0>>
+sm90_make_gated_packed_stride(cute::Stride<cute::Stride<cute::Int<1>,cute::Int<8>>, StrideIntT, cute::Int<0>>, cute::Shape<int,int,int> shape_MKL) {
+  using namespace cute;
+  static_assert(std::is_integral_v<StrideIntT>, "Stride must have an integral type so it can be set dynamically. Static strides not supported.");
+  auto shape = sm90_make_gated_output_shape<0>(cute::transform(shape_MKL, [](auto s){ return static_cast<StrideIntT>(s); }));
+  auto stride = append(compact_order(take<0,2>(shape), Step<Step<_0,_1>,_2>{}), Int<0>{});
+  return stride;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 } // namespace cutlass
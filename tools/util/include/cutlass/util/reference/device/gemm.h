@@ -86,25 +86,31 @@ void compute_gemm(
     LayoutC::kRank == 2, "Tensors must be of rank 2");
 
   // Blocking structure potentially improves performance of reference implementation
-  // with a minor increase in complexity.
+  // with a minor increase in complexity. Operand tiles are shared by the threadblock through
+  // shared memory, which keeps verification of large problems cheap. Results are identical
+  // to the unblocked kernel::Gemm.
   //
   // Note, this reference implementation is NOT expected to approach peak performance.
   using OutputTile = MatrixShape<4, 4>;
+  using ThreadblockShape = MatrixShape<64, 64>;
+  int const kBlockK = 16;
 
-  dim3 block(16, 8);
+  dim3 block(ThreadblockShape::kRow / OutputTile::kColumn, ThreadblockShape::kColumn / OutputTile::kRow);
 
   dim3 grid(
-    (problem_size.m() + block.x * OutputTile::kRow - 1) / (block.x * OutputTile::kRow),
-    (problem_size.n() + block.y * OutputTile::kColumn - 1) / (block.y * OutputTile::kColumn)
+    (problem_size.m() + ThreadblockShape::kRow - 1) / ThreadblockShape::kRow,
+    (problem_size.n() + ThreadblockShape::kColumn - 1) / ThreadblockShape::kColumn
   );
 
   // Launch a GEMM kernel
-  kernel::Gemm<
+  kernel::GemmBlocked<
     TensorRef<ElementA, LayoutA>,
     TensorRef<ElementB, LayoutB>,
     TensorRef<ElementC, LayoutC>,
     ScalarType,
     AccumulatorType,
+    ThreadblockShape,
+    kBlockK,
     OutputTile,
     InnerProductOp,
     ConvertOp
@@ -39,6 +39,7 @@
 #include "cutlass/numeric_types.h"
 #include "cutlass/functional.h"
 #include "cutlass/numeric_conversion.h"
+#include "cutlass/philox.h"
 
 #include "cutlass/tensor_view.h"
 #include "cutlass/gemm/gemm.h"
@@ -184,6 +185,115 @@ __global__ void GemmComplex(
   } // for (batch_idx)
 }
 
+/// Computes a sampled subset of the output of a general matrix product. Each threadblock draws one
+/// sample: a batch index, a (kTileM x kTileN) output tile and a row within that tile. Its threads
+/// then compute the dot products of that tile row and store them to tensor_d. Elements of
+/// tensor_d outside the sampled rows are not written.
+template <
+  typename ElementA,
+  typename LayoutA,
+  typename ElementB,
+  typename LayoutB,
+  typename ElementC,
+  typename LayoutC,
+  typename ScalarType,
+  typename ComputeType,
+  typename ElementD = ElementC,
+  typename ConvertOp = NumericConverter<ElementD, ScalarType>,
+  typename InnerProductOp = multiply_add<ComputeType>,
+  int kTileM = 128,
+  int kTileN = 128
+>
+__global__ void GemmComplexSampled(
+  gemm::GemmCoord problem_size,
+  ScalarType alpha,
+  TensorRef<ElementA, LayoutA> tensor_a,
+  ComplexTransform transform_a,
+  TensorRef<ElementB, LayoutB> tensor_b,
+  ComplexTransform transform_b,
+  ScalarType beta,
+  TensorRef<ElementC, LayoutC> tensor_c,
+  TensorRef<ElementD, LayoutC> tensor_d,
+  ComputeType initial_accum,
+  int sample_count,
+  uint64_t seed,
+  int batch_count = 1,
+  int64_t batch_stride_A = 0,
+  int64_t batch_stride_B = 0,
+  int64_t batch_stride_C = 0,
+  int64_t batch_stride_D = 0) {
+
+  static_assert(
+    LayoutA::kRank == 2 &&
+    LayoutB::kRank == 2 &&
+    LayoutC::kRank == 2, "Tensors must be of rank 2");
+
+  int const M = problem_size.m();
+  int const N = problem_size.n();
+  int const K = problem_size.k();
+
+  int const tiles_m = (M + kTileM - 1) / kTileM;
+  int const tiles_n = (N + kTileN - 1) / kTileN;
+
+  ConvertOp convert_op;
+  InnerProductOp inner_product_op;
+
+  for (int sample = blockIdx.x; sample < sample_count; sample += gridDim.x) {
+
+    // Every thread of the block draws the same sample
+    Philox4x32_10 rng(seed, uint32_t(sample));
+    typename Philox4x32_10::result_type rand = rng();
+
+    int batch_idx = int(rand[0] % uint32_t(batch_count));
+    int row_begin = int(rand[1] % uint32_t(tiles_m)) * kTileM;
+    int col_begin = int(rand[2] % uint32_t(tiles_n)) * kTileN;
+
+    // Residue tiles draw only among their valid rows
+    int tile_rows = (M - row_begin < kTileM ? M - row_begin : kTileM);
+    int row = row_begin + int(rand[3] % uint32_t(tile_rows));
+
+    TensorRef<ElementA, LayoutA> ref_a = tensor_a;
+    TensorRef<ElementB, LayoutB> ref_b = tensor_b;
+    TensorRef<ElementC, LayoutC> ref_c = tensor_c;
+    TensorRef<ElementD, LayoutC> ref_d = tensor_d;
+
+    ref_a.add_pointer_offset(batch_idx * batch_stride_A);
+    ref_b.add_pointer_offset(batch_idx * batch_stride_B);
+    if (ref_c.data()) {
+      ref_c.add_pointer_offset(batch_idx * batch_stride_C);
+    }
+    ref_d.add_pointer_offset(batch_idx * batch_stride_D);
+
+    for (int col = col_begin + threadIdx.x; col < col_begin + kTileN && col < N; col += blockDim.x) {
+
+      ComputeType accum = initial_accum;
+
+      for (int k = 0; k < K; ++k) {
+        ComputeType a_ik = ComputeType(ref_a.at(MatrixCoord(row, k)));
+        ComputeType b_kj = ComputeType(ref_b.at(MatrixCoord(k, col)));
+
+        if (transform_a == ComplexTransform::kConjugate) {
+          a_ik = conj(a_ik);
+        }
+
+        if (transform_b == ComplexTransform::kConjugate) {
+          b_kj = conj(b_kj);
+        }
+
+        accum = inner_product_op(a_ik, b_kj, accum);
+      }
+
+      MatrixCoord coord = MatrixCoord(row, col);
+
+      ScalarType epilog = alpha * ScalarType(accum);
+      if (ref_c.data()) {
+        epilog += beta * ScalarType(ref_c.at(coord));
+      }
+      ref_d.at(coord) = convert_op(epilog);
+    }
+  }
+}
+
 } // namespace kernel
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -350,6 +460,87 @@ void GemmComplex(
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Computes sample_count randomly chosen rows of 128x128 output tiles of a general matrix product,
+/// each as a dot product over K. This costs O(sample_count * 128 * K) instead of O(M * N * K).
+///
+/// Only the sampled elements of tensor_d are written. To verify a result, initialize tensor_d with
+/// a copy of the output under test and compare the two tensors afterwards: unsampled elements
+/// match trivially, and sampled elements hold the reference result. Samples are a deterministic
+/// function of 'seed', so the same seed always checks the same rows.
+template <
+  typename ElementA,
+  typename LayoutA,
+  typename ElementB,
+  typename LayoutB,
+  typename ElementC,
+  typename LayoutC,
+  typename ScalarType,
+  typename ComputeType,
+  typename ElementD = ElementC,
+  typename ConvertOp = NumericConverter<ElementD, ScalarType>,
+  typename InnerProductOp = multiply_add<ComputeType>
+>
+void GemmComplexSampled(
+  gemm::GemmCoord problem_size,
+  ScalarType alpha,
+  TensorRef<ElementA, LayoutA> tensor_a,
+  ComplexTransform transform_a,
+  TensorRef<ElementB, LayoutB> tensor_b,
+  ComplexTransform transform_b,
+  ScalarType beta,
+  TensorRef<ElementC, LayoutC> tensor_c,
+  TensorRef<ElementD, LayoutC> tensor_d,
+  ComputeType initial_accum,
+  int sample_count,
+  uint64_t seed = 0,
+  int batch_count = 1,
+  int64_t batch_stride_A = 0,
+  int64_t batch_stride_B = 0,
+  int64_t batch_stride_C = 0,
+  int64_t batch_stride_D = 0) {
+
+  if (sample_count <= 0 || batch_count <= 0 || problem_size.m() <= 0 || problem_size.n() <= 0) {
+    return;
+  }
+
+  dim3 block(128, 1, 1);
+  dim3 grid(sample_count < 65535 ? sample_count : 65535, 1, 1);
+
+  kernel::GemmComplexSampled<
+    ElementA,
+    LayoutA,
+    ElementB,
+    LayoutB,
+    ElementC,
+    LayoutC,
+    ScalarType,
+    ComputeType,
+    ElementD,
+    ConvertOp,
+    InnerProductOp
+  ><<< grid, block >>>(
+    problem_size,
+    alpha,
+    tensor_a,
+    transform_a,
+    tensor_b,
+    transform_b,
+    beta,
+    tensor_c,
+    tensor_d,
+    initial_accum,
+    sample_count,
+    seed,
+    batch_count,
+    batch_stride_A,
+    batch_stride_B,
+    batch_stride_C,
+    batch_stride_D
+  );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 } // namespace device
 } // namespace reference
 } // namespace cutlass
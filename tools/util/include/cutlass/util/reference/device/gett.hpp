@@ -101,6 +101,118 @@ gett_kernel(
   }
 }
 
+// Blocked version of gett_kernel: each threadblock computes a (BlockM,BlockN) tile of D for one batch,
+// staging (BlockM,BlockK) and (BlockN,BlockK) tiles of A and B, already converted to ElementAccumulator,
+// through shared memory. Every output accumulates over K in order, matching gett_kernel bitwise.
+template <
+  int BlockM,
+  int BlockN,
+  int BlockK,
+  class ATensor,
+  class BTensor,
+  class CTensor,
+  class DTensor,
+  class ElementAccumulator,
+  class ElementEpilogue>
+__global__ static
+void
+gett_blocked_kernel(
+  DTensor       D,
+  ATensor const A,
+  BTensor const B,
+  CTensor const C,
+  ElementEpilogue alpha, ElementEpilogue beta,
+  ElementAccumulator acc_init)
+{
+  using namespace cute;
+
+  static_assert(DTensor::rank == 3, "(M,N,L)");
+  static_assert(ATensor::rank == 3, "(M,K,L)");
+  static_assert(BTensor::rank == 3, "(N,K,L)");
+  static_assert(CTensor::rank == 3, "(M,N,L)");
+
+  constexpr int ThreadM = 4;
+  constexpr int ThreadN = 4;
+  constexpr int Threads = (BlockM / ThreadM) * (BlockN / ThreadN);
+
+  NumericConverter<ElementAccumulator, typename ATensor::value_type> a_converter;
+  NumericConverter<ElementAccumulator, typename BTensor::value_type> b_converter;
+  NumericConverter<ElementEpilogue, ElementAccumulator> acc_converter;
+  NumericConverter<ElementEpilogue, typename CTensor::value_type> source_converter;
+  NumericConverter<typename DTensor::value_type, ElementEpilogue> output_converter;
+
+  // Raw storage, since the accumulator type may not be trivially constructible
+  __shared__ uint4 smem_A_storage[(BlockK * BlockM * sizeof(ElementAccumulator) + sizeof(uint4) - 1) / sizeof(uint4)];
+  __shared__ uint4 smem_B_storage[(BlockK * BlockN * sizeof(ElementAccumulator) + sizeof(uint4) - 1) / sizeof(uint4)];
+  auto smem_A = reinterpret_cast<ElementAccumulator (*)[BlockM]>(smem_A_storage);  // [BlockK][BlockM]
+  auto smem_B = reinterpret_cast<ElementAccumulator (*)[BlockN]>(smem_B_storage);  // [BlockK][BlockN]
+
+  int const M = size<0>(D);
+  int const N = size<1>(D);
+  int const K = size<1>(A);
+  int const l = blockIdx.z;
+  int const m_block = blockIdx.x * BlockM;
+  int const n_block = blockIdx.y * BlockN;
+  int const thread_idx = threadIdx.x;
+  // Consecutive threads own consecutive rows of D
+  int const m_thread = (thread_idx % (BlockM / ThreadM)) * ThreadM;
+  int const n_thread = (thread_idx / (BlockM / ThreadM)) * ThreadN;
+
+  ElementAccumulator accum[ThreadM][ThreadN];
+  for (int i = 0; i < ThreadM; ++i) {
+    for (int j = 0; j < ThreadN; ++j) {
+      accum[i][j] = ElementAccumulator(0);
+    }
+  }
+
+  for (int k_block = 0; k_block < K; k_block += BlockK) {
+    for (int idx = thread_idx; idx < BlockM * BlockK; idx += Threads) {
+      int m = m_block + idx % BlockM;
+      int k = k_block + idx / BlockM;
+      if (m < M && k < K) {
+        smem_A[idx / BlockM][idx % BlockM] = a_converter(A(m,k,l));
+      }
+    }
+    for (int idx = thread_idx; idx < BlockN * BlockK; idx += Threads) {
+      int k = k_block + idx % BlockK;
+      int n = n_block + idx / BlockK;
+      if (n < N && k < K) {
+        smem_B[idx % BlockK][idx / BlockK] = b_converter(B(n,k,l));
+      }
+    }
+    __syncthreads();
+
+    int const k_count = cute::min(BlockK, K - k_block);
+    for (int kk = 0; kk < k_count; ++kk) {
+      ElementAccumulator a[ThreadM];
+      ElementAccumulator b[ThreadN];
+      for (int i = 0; i < ThreadM; ++i) {
+        a[i] = smem_A[kk][m_thread + i];
+      }
+      for (int j = 0; j < ThreadN; ++j) {
+        b[j] = smem_B[kk][n_thread + j];
+      }
+      for (int i = 0; i < ThreadM; ++i) {
+        for (int j = 0; j < ThreadN; ++j) {
+          accum[i][j] += a[i] * b[j];
+        }
+      }
+    }
+    __syncthreads();
+  }
+
+  for (int i = 0; i < ThreadM; ++i) {
+    for (int j = 0; j < ThreadN; ++j) {
+      int m = m_block + m_thread + i;
+      int n = n_block + n_thread + j;
+      if (m < M && n < N) {
+        ElementEpilogue scaled_output = (alpha * acc_converter(accum[i][j])) + (beta * source_converter(C(m,n,l)));
+        D(m,n,l) = output_converter(scaled_output);
+      }
+    }
+  }
+}
+
 // Most general version
 template <
   class ProblemShapeMNKL,
@@ -138,9 +250,12 @@ gett(
   auto C = make_tensor(make_gmem_ptr(ptr_C), make_shape(M,N,L), stride_c_mnl); // (M,N,L)
   auto D = make_tensor(make_gmem_ptr(ptr_D), make_shape(M,N,L), stride_d_mnl); // (M,N,L)
 
-  dim3 dimBlock(256);
-  dim3 dimGrid(240);
-  gett_kernel<<< dimGrid, dimBlock, 0, stream >>>(D, A, B, C, alpha, beta, ElementAccumulator(0));
+  constexpr int BlockM = 64;
+  constexpr int BlockN = 64;
+  constexpr int BlockK = 16;
+  dim3 dimBlock((BlockM / 4) * (BlockN / 4));
+  dim3 dimGrid(cute::ceil_div(int(M), BlockM), cute::ceil_div(int(N), BlockN), int(L));
+  gett_blocked_kernel<BlockM, BlockN, BlockK><<< dimGrid, dimBlock, 0, stream >>>(D, A, B, C, alpha, beta, ElementAccumulator(0));
 }
 
 } // namespace cutlass::reference::device
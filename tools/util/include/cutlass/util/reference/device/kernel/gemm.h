@@ -98,6 +98,130 @@ __global__ void Gemm(
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Computes a general matrix product among matrices (tensors of rank=2) pointed to by TensorRef
+/// objects, staging (ThreadblockShape::kRow x kBlockK) tiles of A and (kBlockK x ThreadblockShape::kColumn)
+/// tiles of B through shared memory so that each operand element is read from global memory once per
+/// threadblock instead of once per thread.
+///
+/// Each thread computes an OutputTile with thread::Gemm's accumulators and epilogue, and every output
+/// accumulates over K in order, so results are bitwise identical to kernel::Gemm.
+///
+/// Must be launched with blockDim = (ThreadblockShape::kRow / OutputTile::kColumn,
+/// ThreadblockShape::kColumn / OutputTile::kRow).
+template <
+  typename TensorRefA,
+  typename TensorRefB,
+  typename TensorRefC,
+  typename ScalarType,
+  typename AccumulatorType,
+  typename ThreadblockShape,
+  int kBlockK,
+  typename OutputTile,
+  typename InnerProductOp,
+  typename ConvertOp
+>
+__global__ void GemmBlocked(
+  gemm::GemmCoord problem_size,
+  ScalarType alpha,
+  TensorRefA tensor_a,
+  TensorRefB tensor_b,
+  ScalarType beta,
+  TensorRefC tensor_c,
+  TensorRefC tensor_d,
+  AccumulatorType initial_accum) {
+
+  using ElementA = typename TensorRefA::Element;
+  using ElementB = typename TensorRefB::Element;
+
+  int const kBlockM = ThreadblockShape::kRow;
+  int const kBlockN = ThreadblockShape::kColumn;
+  int const kThreads = (kBlockM / OutputTile::kColumn) * (kBlockN / OutputTile::kRow);
+
+  // Raw storage, since element types may not be trivially constructible
+  __shared__ uint4 smem_a[(kBlockK * kBlockM * sizeof(ElementA) + sizeof(uint4) - 1) / sizeof(uint4)];
+  __shared__ uint4 smem_b[(kBlockK * kBlockN * sizeof(ElementB) + sizeof(uint4) - 1) / sizeof(uint4)];
+  ElementA *A_block = reinterpret_cast<ElementA *>(smem_a);  // [kBlockK][kBlockM]
+  ElementB *B_block = reinterpret_cast<ElementB *>(smem_b);  // [kBlockK][kBlockN]
+
+  int const thread_idx = threadIdx.x + threadIdx.y * blockDim.x;
+  MatrixCoord const block_coord(
+    MatrixCoord::Index(blockIdx.x * kBlockM),
+    MatrixCoord::Index(blockIdx.y * kBlockN)
+  );
+
+  // Map each thread to a unique tile of the threadblock's output
+  MatrixCoord const thread_offset(
+    MatrixCoord::Index(threadIdx.x * OutputTile::kColumn),
+    MatrixCoord::Index(threadIdx.y * OutputTile::kRow)
+  );
+
+  thread::Gemm<
+    TensorRefA,
+    TensorRefB,
+    TensorRefC,
+    ScalarType,
+    AccumulatorType,
+    OutputTile,
+    InnerProductOp,
+    ConvertOp
+  > gemm(initial_accum);
+
+  InnerProductOp inner_product_op;
+
+  CUTLASS_PRAGMA_NO_UNROLL
+  for (int k_begin = 0; k_begin < problem_size.k(); k_begin += kBlockK) {
+
+    // Stage the operand tiles, out-of-bounds rows and columns are never consumed
+    for (int idx = thread_idx; idx < kBlockK * kBlockM; idx += kThreads) {
+      int m = block_coord.row() + idx % kBlockM;
+      int k = k_begin + idx / kBlockM;
+      if (m < problem_size.m() && k < problem_size.k()) {
+        A_block[idx] = tensor_a.at(make_Coord(m, k));
+      }
+    }
+
+    for (int idx = thread_idx; idx < kBlockK * kBlockN; idx += kThreads) {
+      int k = k_begin + idx % kBlockK;
+      int n = block_coord.column() + idx / kBlockK;
+      if (n < problem_size.n() && k < problem_size.k()) {
+        B_block[(idx % kBlockK) * kBlockN + idx / kBlockK] = tensor_b.at(make_Coord(k, n));
+      }
+    }
+
+    __syncthreads();
+
+    int const k_count = (problem_size.k() - k_begin < kBlockK) ? (problem_size.k() - k_begin) : kBlockK;
+
+    CUTLASS_PRAGMA_NO_UNROLL
+    for (int kk = 0; kk < k_count; ++kk) {
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < OutputTile::kColumn; ++i) {
+        gemm.A_tile[i] = A_block[kk * kBlockM + thread_offset.row() + i];
+      }
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int j = 0; j < OutputTile::kRow; ++j) {
+        gemm.B_tile[j] = B_block[kk * kBlockN + thread_offset.column() + j];
+      }
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int j = 0; j < OutputTile::kRow; ++j) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < OutputTile::kColumn; ++i) {
+          gemm.accum[j][i] = inner_product_op(gemm.A_tile[i], gemm.B_tile[j], gemm.accum[j][i]);
+        }
+      }
+    }
+
+    __syncthreads();
+  }
+
+  gemm.epilogue(problem_size, alpha, beta, tensor_c, tensor_d, block_coord + thread_offset);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Computes a general matrix product among matrices (tensors of rank=2) pointed to by TensorRef
 /// objects.
 template <
@@ -58,6 +58,8 @@
 #include "cutlass/tensor_view.h"
 #include "cutlass/blas3.h"
 #include "cutlass/numeric_types.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/philox.h"
 
 #include "cutlass/layout/vector.h"
 
@@ -1988,6 +1990,457 @@ void BlockFillRandom(
 
 namespace detail {
 
+/// Draws four random words for element 'index' from a counter-based Philox generator. Elements
+/// filled this way depend only on (seed, index), so the result is independent of the launch
+/// configuration and of the vector width used to store it.
+CUTLASS_HOST_DEVICE
+Philox4x32_10::result_type philox_random_words(uint64_t seed, uint64_t index, uint32_t subsequence = 0) {
+  Philox4x32_10 rng(seed, uint32_t(index), uint32_t(index >> 32), subsequence);
+  return rng();
+}
+
+/// Maps random words to a uniformly distributed value in (0, 1]
+template <typename FloatType>
+CUTLASS_HOST_DEVICE
+FloatType philox_uniform(uint32_t hi, uint32_t lo) {
+  if constexpr (sizeof(FloatType) > 4) {
+    uint64_t bits = (uint64_t(hi) << 21) | uint64_t(lo >> 11);
+    return FloatType(bits + 1) * FloatType(1.0 / 9007199254740992.0);   // 2^-53
+  }
+  else {
+    return FloatType((hi >> 8) + 1) * FloatType(1.0 / 16777216.0);      // 2^-24
+  }
+}
+
+/// Computes a pair of independent standard normal values with the Box-Muller transform
+template <typename FloatType>
+CUTLASS_HOST_DEVICE
+void philox_normal_pair(Philox4x32_10::result_type const &words, FloatType &z0, FloatType &z1) {
+  using CUTLASS_CMATH_NAMESPACE :: sqrt;
+  using CUTLASS_CMATH_NAMESPACE :: log;
+  using CUTLASS_CMATH_NAMESPACE :: cos;
+  using CUTLASS_CMATH_NAMESPACE :: sin;
+
+  FloatType u1 = philox_uniform<FloatType>(words[0], words[1]);
+  FloatType u2 = philox_uniform<FloatType>(words[2], words[3]);
+
+  FloatType radius = sqrt(FloatType(-2) * log(u1));
+  FloatType theta = FloatType(6.283185307179586) * u2;
+
+  z0 = radius * cos(theta);
+  z1 = radius * sin(theta);
+}
+
+/// Returns true if element 'index' is drawn as NaN with probability pnan
+CUTLASS_HOST_DEVICE
+bool philox_is_nan(uint64_t seed, uint64_t index, double pnan) {
+  return pnan > 0 && philox_uniform<float>(philox_random_words(seed, index, 1)[0], 0) < pnan;
+}
+
+/// Computes a random uniform distribution of element 'index' with the semantics of
+/// RandomUniformFunc, drawing from a counter-based Philox generator
+template <typename Element>
+struct PhiloxRandomUniformFunc {
+
+  using FloatType = typename RandomUniformFunc<Element>::FloatType;
+  using Params = typename RandomUniformFunc<Element>::Params;
+
+  Params params;
+
+  CUTLASS_HOST_DEVICE
+  Element operator()(uint64_t index) const {
+
+    if constexpr (std::numeric_limits<Element>::has_quiet_NaN) {
+      if (philox_is_nan(params.seed, index, params.pnan)) {
+        return Element(NAN);
+      }
+    }
+
+    Philox4x32_10::result_type words = philox_random_words(params.seed, index);
+
+    FloatType rnd = philox_uniform<FloatType>(words[0], words[1]);
+    rnd = params.max - params.range * rnd;
+
+    // Random values are cast to integer after scaling by a power of two to facilitate error
+    // testing
+    Element result;
+
+    if (params.int_scale >= 0) {
+      rnd = FloatType(std::llround(rnd * params.float_scale_up));
+      result = Element(rnd * params.float_scale_down);
+    }
+    else {
+      result = Element(rnd);
+    }
+
+    if (params.exclude_zero >= 0 && result == Element(0.0)) {
+      if (rnd > FloatType(0)) {
+        rnd = std::min(params.max, rnd + FloatType(1));
+      } else {
+        rnd = std::max((params.max - params.range), rnd - FloatType(1));
+      }
+      result = Element(rnd);
+    }
+
+    return result;
+  }
+};
+
+/// Computes an exponent-uniform random distribution for UE8M0 scale factors.
+template <>
+struct PhiloxRandomUniformFunc<float_ue8m0_t> {
+
+  using Element = float_ue8m0_t;
+  using FloatType = float;
+  using Params = typename RandomUniformFunc<Element>::Params;
+
+  Params params;
+
+  CUTLASS_HOST_DEVICE
+  Element operator()(uint64_t index) const {
+
+    if constexpr (std::numeric_limits<Element>::has_quiet_NaN) {
+      if (philox_is_nan(params.seed, index, params.pnan)) {
+        return Element(NAN);
+      }
+    }
+
+    using CUTLASS_CMATH_NAMESPACE :: pow;
+
+    Philox4x32_10::result_type words = philox_random_words(params.seed, index);
+
+    FloatType rnd = philox_uniform<FloatType>(words[0], words[1]);
+    int exponent_count = params.exp_range + 1;
+    int exponent_offset = int(rnd * FloatType(exponent_count));
+    exponent_offset = exponent_offset < exponent_count ? exponent_offset : exponent_count - 1;
+    FloatType exp = FloatType(params.exp_min + exponent_offset);
+
+    return Element(FloatType(pow(FloatType(2), exp)));
+  }
+};
+
+/// Computes a random uniform distribution of complex element 'index'
+template <typename Real>
+struct PhiloxRandomUniformFunc<complex<Real>> {
+
+  using Element = complex<Real>;
+  using FloatType = typename RandomUniformFunc<Element>::FloatType;
+  using Params = typename RandomUniformFunc<Element>::Params;
+
+  Params params;
+
+  CUTLASS_HOST_DEVICE
+  Element operator()(uint64_t index) const {
+
+    if constexpr (std::numeric_limits<Element>::has_quiet_NaN) {
+      if (philox_is_nan(params.seed, index, params.pnan)) {
+        return Element(Real(NAN), Real(NAN));
+      }
+    }
+
+    Philox4x32_10::result_type words = philox_random_words(params.seed, index);
+
+    FloatType rnd_r = params.min + params.range * philox_uniform<FloatType>(words[0], words[1]);
+    FloatType rnd_i = params.min + params.range * philox_uniform<FloatType>(words[2], words[3]);
+
+    Element result;
+
+    if (params.int_scale >= 0) {
+      rnd_r = FloatType(std::llround(rnd_r * params.float_scale_up));
+      rnd_i = FloatType(std::llround(rnd_i * params.float_scale_up));
+
+      result = {
+        Real(rnd_r * params.float_scale_down),
+        Real(rnd_i * params.float_scale_down)
+      };
+    }
+    else {
+      result = Element(Real(rnd_r), Real(rnd_i));
+    }
+
+    if (params.exclude_zero >= 0 &&
+        result.real() == Real(0.0) &&
+        result.imag() == Real(0.0)) {
+
+      if (rnd_r > FloatType(0)) {
+        rnd_r = std::min(params.min + params.range, rnd_r + FloatType(1));
+      } else {
+        rnd_r = std::max((params.min), rnd_r - FloatType(1));
+      }
+      result = Element(Real(rnd_r), Real(rnd_i));
+    }
+
+    return result;
+  }
+};
+
+/// Computes a random Gaussian distribution of element 'index' with the semantics of
+/// RandomGaussianFunc, drawing from a counter-based Philox generator
+template <typename Element>
+struct PhiloxRandomGaussianFunc {
+
+  using FloatType = typename RandomGaussianFunc<Element>::FloatType;
+  using Params = typename RandomGaussianFunc<Element>::Params;
+
+  Params params;
+
+  CUTLASS_HOST_DEVICE
+  Element operator()(uint64_t index) const {
+
+    FloatType rnd, unused;
+    philox_normal_pair(philox_random_words(params.seed, index), rnd, unused);
+    rnd = params.mean + params.stddev * rnd;
+
+    Element result;
+    if (params.int_scale >= 0) {
+      rnd = FloatType(std::llround(rnd * params.float_scale_up));
+      result = Element(rnd * params.float_scale_down);
+    }
+    else {
+      result = Element(rnd);
+    }
+
+    if (params.exclude_zero >= 0 && result == Element(0.0)) {
+      if (rnd > FloatType(0)) {
+        rnd += FloatType(1);
+      } else {
+        rnd -= FloatType(1);
+      }
+      result = Element(rnd);
+    }
+
+    return result;
+  }
+};
+
+/// Computes a random Gaussian distribution of complex element 'index'
+template <typename Real>
+struct PhiloxRandomGaussianFunc<complex<Real>> {
+
+  using Element = complex<Real>;
+  using FloatType = typename RandomGaussianFunc<Element>::FloatType;
+  using Params = typename RandomGaussianFunc<Element>::Params;
+
+  Params params;
+
+  CUTLASS_HOST_DEVICE
+  Element operator()(uint64_t index) const {
+
+    FloatType rnd_r, rnd_i;
+    philox_normal_pair(philox_random_words(params.seed, index), rnd_r, rnd_i);
+    rnd_r = params.mean + params.stddev * rnd_r;
+    rnd_i = params.mean + params.stddev * rnd_i;
+
+    Element result;
+    if (params.int_scale >= 0) {
+      rnd_r = FloatType(std::llround(rnd_r * params.float_scale_up));
+      rnd_i = FloatType(std::llround(rnd_i * params.float_scale_up));
+
+      result = {
+        Real(rnd_r * params.float_scale_down),
+        Real(rnd_i * params.float_scale_down)
+      };
+    }
+    else {
+      result = Element(Real(rnd_r), Real(rnd_i));
+    }
+
+    if (params.exclude_zero >= 0 &&
+        result.real() == Real(0.0) &&
+        result.imag() == Real(0.0)) {
+
+      if (rnd_r > FloatType(0)) {
+        rnd_r += FloatType(1);
+      } else {
+        rnd_r -= FloatType(1);
+      }
+      result = Element(Real(rnd_r), Real(rnd_i));
+    }
+
+    return result;
+  }
+};
+
+} // namespace detail
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace kernel {
+
+/// Fills a block with elements computed from their linear index. Each thread stores
+/// kElementsPerAccess consecutive elements at a time. With kVectorStore, they are packed in
+/// registers and written with one aligned store. Otherwise, they are written one by one, which
+/// is needed for sub-byte types whose elements straddle storage units.
+template <typename Element, typename Func, int kElementsPerAccess, bool kVectorStore>
+__global__ void BlockFillRandomPhilox(
+  Element *ptr,
+  size_t capacity,
+  typename Func::Params params) {
+
+  using AccessType = AlignedArray<Element, kElementsPerAccess>;
+
+  Func func{params};
+
+  size_t access_count = capacity / kElementsPerAccess;
+  size_t index = threadIdx.x + blockIdx.x * size_t(blockDim.x);
+
+  for (; index < access_count; index += size_t(blockDim.x) * gridDim.x) {
+    size_t base = index * kElementsPerAccess;
+
+    if constexpr (kVectorStore) {
+      AccessType frag;
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kElementsPerAccess; ++i) {
+        frag[i] = func(base + i);
+      }
+
+      reinterpret_cast<AccessType *>(ptr)[index] = frag;
+    }
+    else {
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kElementsPerAccess; ++i) {
+        ReferenceFactory<Element>::get(ptr, base + i) = func(base + i);
+      }
+    }
+  }
+
+  // A single thread writes the residue, so sub-byte elements sharing a byte are never raced
+  if (threadIdx.x + blockIdx.x * blockDim.x == 0) {
+    for (size_t i = access_count * kElementsPerAccess; i < capacity; ++i) {
+      ReferenceFactory<Element>::get(ptr, i) = func(i);
+    }
+  }
+}
+
+} // namespace kernel
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+template <typename Element, typename Func, int kElementsPerAccess, bool kVectorStore>
+void block_fill_random_philox_launch(
+  Element *ptr,
+  size_t capacity,
+  typename Func::Params const &params,
+  cudaStream_t stream) {
+
+  auto fill_kernel = kernel::BlockFillRandomPhilox<Element, Func, kElementsPerAccess, kVectorStore>;
+
+  int grid_size = 0;
+  int block_size = 0;
+
+  cudaError_t result = cudaOccupancyMaxPotentialBlockSize(
+    &grid_size,
+    &block_size,
+    reinterpret_cast<void const *>(fill_kernel));
+
+  if (result != cudaSuccess) {
+    throw std::runtime_error("Failed to query occupancy.");
+  }
+
+  // Without per-thread RNG state to amortize, launch no more threads than there are accesses
+  size_t access_count = capacity / kElementsPerAccess;
+  size_t needed_blocks = (access_count + block_size - 1) / block_size;
+  if (needed_blocks < size_t(grid_size)) {
+    grid_size = int(needed_blocks > 0 ? needed_blocks : 1);
+  }
+
+  fill_kernel<<< grid_size, block_size, 0, stream >>>(ptr, capacity, params);
+}
+
+/// Fills a block with a Philox functor, storing 128b vectors when the pointer is aligned to them.
+/// Otherwise, each thread writes whole bytes element by element.
+template <typename Element, typename Func>
+void block_fill_random_philox(
+  Element *ptr,
+  size_t capacity,
+  typename Func::Params const &params,
+  cudaStream_t stream) {
+
+  constexpr int kBits = sizeof_bits<Element>::value;
+
+  if constexpr ((kBits & (kBits - 1)) != 0) {
+    // Non power-of-two widths (e.g. 6b floats) are written in groups of whole bytes
+    constexpr int kGroupBits = cutlass::lcm_cxx11(kBits, 8);
+    block_fill_random_philox_launch<Element, Func, kGroupBits / kBits, false>(ptr, capacity, params, stream);
+  }
+  else {
+    constexpr int kMaxAccess = (kBits >= 128 ? 1 : 128 / kBits);
+    constexpr int kMinAccess = (kBits >= 8 ? 1 : 8 / kBits);
+
+    if (reinterpret_cast<uintptr_t>(ptr) % sizeof(AlignedArray<Element, kMaxAccess>) == 0) {
+      block_fill_random_philox_launch<Element, Func, kMaxAccess, true>(ptr, capacity, params, stream);
+    }
+    else {
+      block_fill_random_philox_launch<Element, Func, kMinAccess, false>(ptr, capacity, params, stream);
+    }
+  }
+}
+
+} // namespace detail
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Fills a block of data with random values using a counter-based Philox generator. Supports the
+/// same distributions as BlockFillRandom. Each element is a function of (seed, index) alone, so no
+/// RNG state is initialized per thread and elements are written with vectorized stores.
+template <
+  typename Element
+>
+void BlockFillRandomPhilox(
+  Element *ptr,
+  size_t capacity,
+  uint64_t seed,
+  Distribution dist,
+  cudaStream_t stream = nullptr) {
+
+  using Real = typename RealType<Element>::Type;
+  using UniformReal = typename detail::UniformDistributionValueType<Element>::Type;
+
+  if (!capacity) {
+    return;
+  }
+
+  if (dist.kind == Distribution::Gaussian) {
+    using Func = detail::PhiloxRandomGaussianFunc<Element>;
+
+    typename Func::Params params(
+      seed,
+      static_cast<Real>(dist.gaussian.mean),
+      static_cast<Real>(dist.gaussian.stddev),
+      dist.int_scale);
+
+    detail::block_fill_random_philox<Element, Func>(ptr, capacity, params, stream);
+  }
+  else if (dist.kind == Distribution::Uniform) {
+    using Func = detail::PhiloxRandomUniformFunc<Element>;
+
+    typename Func::Params params(
+      seed,
+      static_cast<UniformReal>(dist.uniform.max),
+      static_cast<UniformReal>(dist.uniform.min),
+      dist.int_scale,
+      dist.uniform.pnan);
+
+    detail::block_fill_random_philox<Element, Func>(ptr, capacity, params, stream);
+  }
+  else if (dist.kind == Distribution::Sequential) {
+    BlockFillSequential<Element>(
+      ptr,
+      capacity,
+      static_cast<Real>(dist.sequential.delta),
+      static_cast<Real>(dist.sequential.start),
+      stream);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
 /// Computes a random Gaussian distribution
 template <
   typename Element,               ///< Element type
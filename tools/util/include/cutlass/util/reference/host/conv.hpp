@@ -119,6 +119,11 @@ struct ConvEpilogueFusionParams {
   TensorAlpha tensor_alpha{};
   TensorBeta tensor_beta{};
   TensorBias tensor_bias{};
+
+  // Output quantization: D = scale_d * activation(Z), amax_d = max(abs(activation(Z)))
+  ElementScalar scale_d = ElementScalar(1);
+  bool compute_abs_max_D = false;
+  ElementCompute abs_max_D = ElementCompute(0);
 };
 
 template<
@@ -200,6 +205,19 @@ struct ConvReferenceImpl {
   }
 
 private:
+  ElementOut quantize_output(ElementCompute output) {
+    if (epi_fusion_params_.compute_abs_max_D) {
+      ElementCompute abs_output = output < ElementCompute(0) ? -output : output;
+#if defined(_OPENMP)
+  #pragma omp critical
+#endif
+      if (epi_fusion_params_.abs_max_D < abs_output) {
+        epi_fusion_params_.abs_max_D = abs_output;
+      }
+    }
+    return output_converter(scale_converter(epi_fusion_params_.scale_d) * output);
+  }
+
   // Specialization for 1D fprop kernel
   void fprop_reference(cute::Int<1> spatial_dims) {
     int32_t G = size<3>(tensor_d_);
@@ -242,7 +260,7 @@ private:
             if (EpilogueFusionParams::ResidualAdd) {
               output += scale_converter(beta) * residual_converter(tensor_c_(k, q, n, g));
             }
-            tensor_d_(k, q, n, g) = output_converter(output);
+            tensor_d_(k, q, n, g) = quantize_output(output);
           }
         }
       }
@@ -298,7 +316,7 @@ private:
               if (EpilogueFusionParams::ResidualAdd) {
                 output += scale_converter(beta) * residual_converter(tensor_c_(k, q, p, n, g));
               }
-              tensor_d_(k, q, p, n, g) = output_converter(output);
+              tensor_d_(k, q, p, n, g) = quantize_output(output);
             }
           }
         }
@@ -361,7 +379,7 @@ private:
                 if (EpilogueFusionParams::ResidualAdd) {
                   output += scale_converter(beta) * residual_converter(tensor_c_(k, q, p, z, n, g));
                 }
-                tensor_d_(k, q, p, z, n, g) = output_converter(output);
+                tensor_d_(k, q, p, z, n, g) = quantize_output(output);
               }
             }
           }
@@ -418,7 +436,7 @@ private:
             if (EpilogueFusionParams::ResidualAdd) {
               output += scale_converter(beta) * residual_converter(tensor_c_(c, w, n, g));
             }
-            tensor_d_(c, w, n, g) = output_converter(output);
+            tensor_d_(c, w, n, g) = quantize_output(output);
           }
         }
       }
@@ -486,7 +504,7 @@ private:
                 output += scale_converter(beta) * residual_converter(tensor_c_(c, w, h, n, g));
               }
 
-              tensor_d_(c, w, h, n, g) = output_converter(output);
+              tensor_d_(c, w, h, n, g) = quantize_output(output);
             }
           }
         }
@@ -566,7 +584,7 @@ private:
                 if (EpilogueFusionParams::ResidualAdd) {
                   output += scale_converter(beta) * residual_converter(tensor_c_(c, w, h, d, n, g));
                 }
-                tensor_d_(c, w, h, d, n, g) = output_converter(output);
+                tensor_d_(c, w, h, d, n, g) = quantize_output(output);
               }
             }
           }
@@ -627,7 +645,7 @@ private:
             if (EpilogueFusionParams::ResidualAdd) {
               output += scale_converter(beta) * residual_converter(tensor_c_(c, s, k, g));
             }
-            tensor_d_(c, s, k, g) = output_converter(output);
+            tensor_d_(c, s, k, g) = quantize_output(output);
           }
         }
       }
@@ -692,7 +710,7 @@ private:
               if (EpilogueFusionParams::ResidualAdd) {
                 output += scale_converter(beta) * residual_converter(tensor_c_(c, s, r, k, g));
               }
-              tensor_d_(c, s, r, k, g) = output_converter(output);
+              tensor_d_(c, s, r, k, g) = quantize_output(output);
             }
           }
         }
@@ -765,7 +783,7 @@ private:
                 if (EpilogueFusionParams::ResidualAdd) {
                   output += scale_converter(beta) * residual_converter(tensor_c_(c, s, r, t, k, g));
                 }
-                tensor_d_(c, s, r, t, k, g) = output_converter(output);
+                tensor_d_(c, s, r, t, k, g) = quantize_output(output);
               }
             }
           }
@@ -45,6 +45,7 @@
 #include "cutlass/conv/convolution.h"
 #include "cutlass/conv/conv2d_problem_size.h"
 #include "cutlass/conv/conv3d_problem_size.h"
+#include "cutlass/util/reference/host/parallel_for.h"
 #include <iostream>
 
 namespace cutlass {
@@ -76,62 +77,64 @@ void Conv2dFprop(
   TensorRef<ElementC, LayoutC> tensor_y_in,
   TensorRef<ElementD, LayoutC> tensor_y_out,
   ElementCompute alpha,
-  ElementCompute beta) {
+  ElementCompute beta,
+  int num_threads = 1) {
 
   ConvertOp convert_op;
   InnerProductOp inner_product_op;
 
   // Apply MMA and accumulate ElementAccumulator
-  for (int n = 0; n < problem_size.N; ++n) {
-    for (int p = 0; p < problem_size.P; ++p) {
-      for (int q = 0; q < problem_size.Q; ++q) {
-        for (int k = 0; k < problem_size.K; ++k) {
+  detail::parallel_for(int64_t(problem_size.N) * problem_size.P, num_threads, [&](int64_t idx) {
+    int n = int(idx / problem_size.P);
+    int p = int(idx % problem_size.P);
 
-          int group_idx = k / (problem_size.K / problem_size.groups);
-          int channels_per_group = problem_size.C / problem_size.groups;
+    for (int q = 0; q < problem_size.Q; ++q) {
+      for (int k = 0; k < problem_size.K; ++k) {
 
-          ElementAccumulator acc = ElementAccumulator();
+        int group_idx = k / (problem_size.K / problem_size.groups);
+        int channels_per_group = problem_size.C / problem_size.groups;
 
-          for (int r = 0; r < problem_size.R; ++r) {
-            for (int s = 0; s < problem_size.S; ++s) {
-              for (int c = 0; c < channels_per_group; ++c) {
+        ElementAccumulator acc = ElementAccumulator();
 
-                int filter_r = r;
-                int filter_s = s;
+        for (int r = 0; r < problem_size.R; ++r) {
+          for (int s = 0; s < problem_size.S; ++s) {
+            for (int c = 0; c < channels_per_group; ++c) {
 
-                if (problem_size.mode == cutlass::conv::Mode::kConvolution) {
-                  filter_r = problem_size.R - 1 - r;
-                  filter_s = problem_size.S - 1 - s;
-                }
+              int filter_r = r;
+              int filter_s = s;
 
-                int h = p * problem_size.stride_h - problem_size.pad_h + filter_r * problem_size.dilation_h;
-                int w = q * problem_size.stride_w - problem_size.pad_w + filter_s * problem_size.dilation_w;
+              if (problem_size.mode == cutlass::conv::Mode::kConvolution) {
+                filter_r = problem_size.R - 1 - r;
+                filter_s = problem_size.S - 1 - s;
+              }
 
-                if (h >= 0 && h < problem_size.H && w >= 0 && w < problem_size.W) {
+              int h = p * problem_size.stride_h - problem_size.pad_h + filter_r * problem_size.dilation_h;
+              int w = q * problem_size.stride_w - problem_size.pad_w + filter_s * problem_size.dilation_w;
 
-                  ElementA a = tensor_x.at({n, h, w, c + group_idx * channels_per_group});
-                  ElementB b = tensor_w.at({k, r, s, c});
+              if (h >= 0 && h < problem_size.H && w >= 0 && w < problem_size.W) {
 
-                  acc = inner_product_op(ElementAccumulator(a), ElementAccumulator(b), acc);
+                ElementA a = tensor_x.at({n, h, w, c + group_idx * channels_per_group});
+                ElementB b = tensor_w.at({k, r, s, c});
+
+                acc = inner_product_op(ElementAccumulator(a), ElementAccumulator(b), acc);
 
-                }
               }
             }
           }
+        }
 
-          // Apply Epilogue, compute ElementCompute, convert and store ElementC
-          ElementC c_ref = ElementC();
-
-          if (beta != ElementCompute()) {
-            c_ref = tensor_y_in.at(cutlass::make_Coord(n, p, q, k));
-          }
+        // Apply Epilogue, compute ElementCompute, convert and store ElementC
+        ElementC c_ref = ElementC();
 
-          tensor_y_out.at(cutlass::make_Coord(n, p, q, k)) =
-              convert_op(alpha * ElementCompute(acc) + beta * ElementCompute(c_ref));
+        if (beta != ElementCompute()) {
+          c_ref = tensor_y_in.at(cutlass::make_Coord(n, p, q, k));
         }
+
+        tensor_y_out.at(cutlass::make_Coord(n, p, q, k)) =
+            convert_op(alpha * ElementCompute(acc) + beta * ElementCompute(c_ref));
       }
     }
-  }
+  });
 }
 
 /// Depthwise-separable convolution
@@ -222,82 +225,84 @@ void Conv2dDgrad(
   TensorRef<ElementD, LayoutC> tensor_dx_out,
   ElementCompute alpha,
   ElementCompute beta,
-  bool is_deconv = false) {
+  bool is_deconv = false,
+  int num_threads = 1) {
 
   ConvertOp convert_op;
   InnerProductOp inner_product_op;
 
   // Apply MMA and accumulate ElementAccumulator
-  for (int n = 0; n < problem_size.N; ++n) {
-    for (int h = 0; h < problem_size.H; ++h) {
-      for (int w = 0; w < problem_size.W; ++w) {
-        for (int c = 0; c < problem_size.C; ++c) {
+  detail::parallel_for(int64_t(problem_size.N) * problem_size.H, num_threads, [&](int64_t idx) {
+    int n = int(idx / problem_size.H);
+    int h = int(idx % problem_size.H);
 
-          ElementAccumulator acc = ElementAccumulator();
+    for (int w = 0; w < problem_size.W; ++w) {
+      for (int c = 0; c < problem_size.C; ++c) {
 
-          for (int r = 0; r < problem_size.R; ++r) {
-            for (int s = 0; s < problem_size.S; ++s) {
-              for (int k = 0; k < problem_size.K; ++k) {
+        ElementAccumulator acc = ElementAccumulator();
 
-                int filter_r = r;
-                int filter_s = s;
+        for (int r = 0; r < problem_size.R; ++r) {
+          for (int s = 0; s < problem_size.S; ++s) {
+            for (int k = 0; k < problem_size.K; ++k) {
 
-                if (problem_size.mode == cutlass::conv::Mode::kConvolution) {
-                  filter_r = problem_size.R - 1 - r;
-                  filter_s = problem_size.S - 1 - s;
-                }
+              int filter_r = r;
+              int filter_s = s;
 
-                int p = h + problem_size.pad_h - filter_r * problem_size.dilation_h;
-                int q = w + problem_size.pad_w - filter_s * problem_size.dilation_w;
+              if (problem_size.mode == cutlass::conv::Mode::kConvolution) {
+                filter_r = problem_size.R - 1 - r;
+                filter_s = problem_size.S - 1 - s;
+              }
 
-                if (p >= 0 && (p % problem_size.stride_h) == 0 && 
-                    q >= 0 && (q % problem_size.stride_w) == 0) {
+              int p = h + problem_size.pad_h - filter_r * problem_size.dilation_h;
+              int q = w + problem_size.pad_w - filter_s * problem_size.dilation_w;
 
-                  p = p / problem_size.stride_h;
-                  q = q / problem_size.stride_w;
+              if (p >= 0 && (p % problem_size.stride_h) == 0 && 
+                  q >= 0 && (q % problem_size.stride_w) == 0) {
+
+                p = p / problem_size.stride_h;
+                q = q / problem_size.stride_w;
 #if 0
-                  std::cout << "row:" 
-                  << n * problem_size.H * problem_size.W +
-                    h * problem_size.W +
-                    w << " "
-                  << "n, p, q: (" 
-                  << n << ", "
-                  << p << ", "
-                  << q << ") * "
-                  << "r, s: (" 
-                  << r << ", "
-                  << s << ") [" 
-                  << ((p < problem_size.P && q < problem_size.Q) ? "true":"false") << "]"        
-                  << std::endl;
+                std::cout << "row:" 
+                << n * problem_size.H * problem_size.W +
+                  h * problem_size.W +
+                  w << " "
+                << "n, p, q: (" 
+                << n << ", "
+                << p << ", "
+                << q << ") * "
+                << "r, s: (" 
+                << r << ", "
+                << s << ") [" 
+                << ((p < problem_size.P && q < problem_size.Q) ? "true":"false") << "]"        
+                << std::endl;
 #endif
-                  if (p < problem_size.P && q < problem_size.Q) {
+                if (p < problem_size.P && q < problem_size.Q) {
 
-                    ElementA a = tensor_dy.at(cutlass::make_Coord(n, p, q, k));
-                    ElementB b = is_deconv ? tensor_w.at(cutlass::make_Coord(c, r, s, k))
-                        : tensor_w.at(cutlass::make_Coord(k, r, s, c));
+                  ElementA a = tensor_dy.at(cutlass::make_Coord(n, p, q, k));
+                  ElementB b = is_deconv ? tensor_w.at(cutlass::make_Coord(c, r, s, k))
+                      : tensor_w.at(cutlass::make_Coord(k, r, s, c));
 
-                    acc = inner_product_op(ElementAccumulator(a), ElementAccumulator(b), acc);
-                  }
+                  acc = inner_product_op(ElementAccumulator(a), ElementAccumulator(b), acc);
                 }
+              }
 
-              } // for (K)
-            } // for (S)
-          } // for (R)
+            } // for (K)
+          } // for (S)
+        } // for (R)
 
-          // Apply Epilogue, compute ElementCompute, convert and store ElementC
-          ElementC c_ref = ElementC();
+        // Apply Epilogue, compute ElementCompute, convert and store ElementC
+        ElementC c_ref = ElementC();
 
-          if (beta != ElementCompute()) {
-            c_ref = tensor_dx_in.at(cutlass::make_Coord(n, h, w, c));
-          }
+        if (beta != ElementCompute()) {
+          c_ref = tensor_dx_in.at(cutlass::make_Coord(n, h, w, c));
+        }
 
-          tensor_dx_out.at(cutlass::make_Coord(n, h, w, c)) =
-              convert_op(alpha * ElementCompute(acc) + beta * ElementCompute(c_ref));
+        tensor_dx_out.at(cutlass::make_Coord(n, h, w, c)) =
+            convert_op(alpha * ElementCompute(acc) + beta * ElementCompute(c_ref));
 
-        } // for (C)
-      } // for (W)
-    } // for (H)
-  } // for (N)
+      } // for (C)
+    } // for (W)
+  });
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -325,64 +330,66 @@ void Conv2dWgrad(
   TensorRef<ElementC, LayoutC> tensor_dw_in,
   TensorRef<ElementD, LayoutC> tensor_dw_out,
   ElementCompute alpha,
-  ElementCompute beta) {
+  ElementCompute beta,
+  int num_threads = 1) {
   
   InnerProductOp inner_product_op;
   ConvertOp convert_op;
 
   // Apply MMA and accumulate ElementAccumulator
-  for (int k = 0; k < problem_size.K; ++k) {
-    for (int r = 0; r < problem_size.R; ++r) {
-      for (int s = 0; s < problem_size.S; ++s) {
-        for (int c = 0; c < problem_size.C; ++c) {
+  detail::parallel_for(int64_t(problem_size.K) * problem_size.R, num_threads, [&](int64_t idx) {
+    int k = int(idx / problem_size.R);
+    int r = int(idx % problem_size.R);
 
-          ElementAccumulator acc = ElementAccumulator();
+    for (int s = 0; s < problem_size.S; ++s) {
+      for (int c = 0; c < problem_size.C; ++c) {
 
-          for (int n = 0; n < problem_size.N; ++n) {
-            for (int p = 0; p < problem_size.P; ++p) {
-              for (int q = 0; q < problem_size.Q; ++q) {
-                  
-                cutlass::Tensor4DCoord b_coord;
+        ElementAccumulator acc = ElementAccumulator();
+
+        for (int n = 0; n < problem_size.N; ++n) {
+          for (int p = 0; p < problem_size.P; ++p) {
+            for (int q = 0; q < problem_size.Q; ++q) {
                 
-                int filter_r = r;
-                int filter_s = s; 
+              cutlass::Tensor4DCoord b_coord;
+              
+              int filter_r = r;
+              int filter_s = s; 
 
-                if (problem_size.mode == cutlass::conv::Mode::kConvolution) {
-                  filter_r = problem_size.R - 1 - r;
-                  filter_s = problem_size.S - 1 - s;
-                }
+              if (problem_size.mode == cutlass::conv::Mode::kConvolution) {
+                filter_r = problem_size.R - 1 - r;
+                filter_s = problem_size.S - 1 - s;
+              }
 
-                b_coord = make_Coord(
-                    n,
-                    p * problem_size.stride_h - problem_size.pad_h + filter_r * problem_size.dilation_h,
-                    q * problem_size.stride_w - problem_size.pad_w + filter_s * problem_size.dilation_w,
-                    c);
+              b_coord = make_Coord(
+                  n,
+                  p * problem_size.stride_h - problem_size.pad_h + filter_r * problem_size.dilation_h,
+                  q * problem_size.stride_w - problem_size.pad_w + filter_s * problem_size.dilation_w,
+                  c);
 
-                if (b_coord.h() < problem_size.H && b_coord.h() >= 0 &&
-                    b_coord.w() < problem_size.W && b_coord.w() >= 0) {
+              if (b_coord.h() < problem_size.H && b_coord.h() >= 0 &&
+                  b_coord.w() < problem_size.W && b_coord.w() >= 0) {
 
-                  ElementAccumulator a = ElementAccumulator(tensor_dy.at(cutlass::make_Coord(n, p, q, k)));
-                  ElementAccumulator b = ElementAccumulator(tensor_x.at(b_coord));
-                  acc = inner_product_op(a, b, acc);
-                }
+                ElementAccumulator a = ElementAccumulator(tensor_dy.at(cutlass::make_Coord(n, p, q, k)));
+                ElementAccumulator b = ElementAccumulator(tensor_x.at(b_coord));
+                acc = inner_product_op(a, b, acc);
               }
             }
           }
+        }
 
-          // Apply Epilogue, compute ElementCompute, convert and store ElementC
-          ElementC c_ref = ElementC();
+        // Apply Epilogue, compute ElementCompute, convert and store ElementC
+        ElementC c_ref = ElementC();
 
-          if (beta != ElementCompute()) {
-            c_ref = tensor_dw_in.at(cutlass::make_Coord(k, r, s, c));
-          }
+        if (beta != ElementCompute()) {
+          c_ref = tensor_dw_in.at(cutlass::make_Coord(k, r, s, c));
+        }
 
-          tensor_dw_out.at(cutlass::make_Coord(k, r, s, c)) =
-              convert_op(alpha * ElementCompute(acc) + beta * ElementCompute(c_ref));
+        tensor_dw_out.at(cutlass::make_Coord(k, r, s, c)) =
+            convert_op(alpha * ElementCompute(acc) + beta * ElementCompute(c_ref));
 
-        } // for (C)
-      } // for (S)
-    } // for (R)
-  } // for (K)
+      } // for (C)
+    } // for (S)
+  });
 }
 
 /// Generic 2D convolution targeting Conv2dFprop, Conv2dDgrad, and Conv2dWgrad.
@@ -407,7 +414,8 @@ void Conv2d(
   TensorRef<ElementC, LayoutC> tensor_C,
   TensorRef<ElementD, LayoutC> tensor_D,
   ElementCompute alpha,
-  ElementCompute beta) {
+  ElementCompute beta,
+  int num_threads = 1) {
 
   switch (convolutional_operator) {
   case conv::Operator::kFprop:
@@ -419,7 +427,7 @@ void Conv2d(
       ElementAccumulator,
       ElementD,
       ConvertOp, InnerProductOp
-    >(problem_size, tensor_A, tensor_B, tensor_C, tensor_D, alpha, beta);
+    >(problem_size, tensor_A, tensor_B, tensor_C, tensor_D, alpha, beta, num_threads);
     break;
 
   case conv::Operator::kDeconv:
@@ -432,7 +440,7 @@ void Conv2d(
       ElementAccumulator,
       ElementD,
       ConvertOp, InnerProductOp
-    >(problem_size, tensor_A, tensor_B, tensor_C, tensor_D, alpha, beta, (convolutional_operator == conv::Operator::kDeconv));
+    >(problem_size, tensor_A, tensor_B, tensor_C, tensor_D, alpha, beta, (convolutional_operator == conv::Operator::kDeconv), num_threads);
     break;
 
   case conv::Operator::kWgrad:
@@ -444,7 +452,7 @@ void Conv2d(
       ElementAccumulator,
       ElementD,
       ConvertOp, InnerProductOp
-    >(problem_size, tensor_A, tensor_B, tensor_C, tensor_D, alpha, beta);
+    >(problem_size, tensor_A, tensor_B, tensor_C, tensor_D, alpha, beta, num_threads);
     break;
 
   default:
@@ -476,67 +484,69 @@ void Conv3dFprop(
   TensorRef<ElementC, LayoutC> tensor_y_in,
   TensorRef<ElementC, LayoutC> tensor_y_out,
   ElementCompute alpha,
-  ElementCompute beta) {
+  ElementCompute beta,
+  int num_threads = 1) {
 
   ConvertOp convert_op;
   InnerProductOp inner_product_op;
 
   // Apply MMA and accumulate ElementAccumulator
-  for (int n = 0; n < problem_size.N; ++n) {
-    for (int z = 0; z < problem_size.Z; ++z) {
-      for (int p = 0; p < problem_size.P; ++p) {
-        for (int q = 0; q < problem_size.Q; ++q) {
-          for (int k = 0; k < problem_size.K; ++k) {
-
-            ElementAccumulator acc = ElementAccumulator();
-
-            for (int t = 0; t < problem_size.T; ++t) {
-              for (int r = 0; r < problem_size.R; ++r) {
-                for (int s = 0; s < problem_size.S; ++s) {
-                  for (int c = 0; c < problem_size.C; ++c) {
-
-                    int filter_t = t;
-                    int filter_r = r;
-                    int filter_s = s;
-
-                    if (problem_size.mode == cutlass::conv::Mode::kConvolution) {
-                      filter_t = problem_size.T - 1 - t;
-                      filter_r = problem_size.R - 1 - r;
-                      filter_s = problem_size.S - 1 - s;
-                    }
+  detail::parallel_for(int64_t(problem_size.N) * problem_size.Z, num_threads, [&](int64_t idx) {
+    int n = int(idx / problem_size.Z);
+    int z = int(idx % problem_size.Z);
+
+    for (int p = 0; p < problem_size.P; ++p) {
+      for (int q = 0; q < problem_size.Q; ++q) {
+        for (int k = 0; k < problem_size.K; ++k) {
 
-                    int d = z * problem_size.stride_d - problem_size.pad_d + filter_t * problem_size.dilation_d;
-                    int h = p * problem_size.stride_h - problem_size.pad_h + filter_r * problem_size.dilation_h;
-                    int w = q * problem_size.stride_w - problem_size.pad_w + filter_s * problem_size.dilation_w;
+          ElementAccumulator acc = ElementAccumulator();
 
-                    if (d >= 0 && d < problem_size.D && 
-                      h >=0 && h < problem_size.H && 
-                      w >= 0 && w < problem_size.W) {
+          for (int t = 0; t < problem_size.T; ++t) {
+            for (int r = 0; r < problem_size.R; ++r) {
+              for (int s = 0; s < problem_size.S; ++s) {
+                for (int c = 0; c < problem_size.C; ++c) {
 
-                      ElementA a = tensor_x.at({n, d, h, w, c});
-                      ElementB b = tensor_w.at({k, t, r, s, c});
-                      
-                      acc = inner_product_op(ElementAccumulator(a), ElementAccumulator(b), acc);
-                    }
+                  int filter_t = t;
+                  int filter_r = r;
+                  int filter_s = s;
+
+                  if (problem_size.mode == cutlass::conv::Mode::kConvolution) {
+                    filter_t = problem_size.T - 1 - t;
+                    filter_r = problem_size.R - 1 - r;
+                    filter_s = problem_size.S - 1 - s;
+                  }
+
+                  int d = z * problem_size.stride_d - problem_size.pad_d + filter_t * problem_size.dilation_d;
+                  int h = p * problem_size.stride_h - problem_size.pad_h + filter_r * problem_size.dilation_h;
+                  int w = q * problem_size.stride_w - problem_size.pad_w + filter_s * problem_size.dilation_w;
+
+                  if (d >= 0 && d < problem_size.D && 
+                    h >=0 && h < problem_size.H && 
+                    w >= 0 && w < problem_size.W) {
+
+                    ElementA a = tensor_x.at({n, d, h, w, c});
+                    ElementB b = tensor_w.at({k, t, r, s, c});
+                    
+                    acc = inner_product_op(ElementAccumulator(a), ElementAccumulator(b), acc);
                   }
                 }
               }
             }
+          }
 
-            // Apply Epilogue, compute ElementCompute, convert and store ElementC
-            ElementC c_ref = ElementC();
-
-            if (beta != ElementCompute()) {
-              c_ref = tensor_y_in.at(cutlass::make_Coord(n, z, p, q, k));
-            }
+          // Apply Epilogue, compute ElementCompute, convert and store ElementC
+          ElementC c_ref = ElementC();
 
-            tensor_y_out.at(cutlass::make_Coord(n, z, p, q, k)) =
-                convert_op(alpha * ElementCompute(acc) + beta * ElementCompute(c_ref));
+          if (beta != ElementCompute()) {
+            c_ref = tensor_y_in.at(cutlass::make_Coord(n, z, p, q, k));
           }
+
+          tensor_y_out.at(cutlass::make_Coord(n, z, p, q, k)) =
+              convert_op(alpha * ElementCompute(acc) + beta * ElementCompute(c_ref));
         }
       }
     }
-  }
+  });
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -564,76 +574,78 @@ void Conv3dDgrad(
   TensorRef<ElementC, LayoutC> tensor_dx_out,
   ElementCompute alpha,
   ElementCompute beta,
-  bool is_deconv = false) {
+  bool is_deconv = false,
+  int num_threads = 1) {
 
   ConvertOp convert_op;
   InnerProductOp inner_product_op;
 
   // Apply MMA and accumulate ElementAccumulator
-  for (int n = 0; n < problem_size.N; ++n) {
-    for (int d = 0; d < problem_size.D; ++d) {
-      for (int h = 0; h < problem_size.H; ++h) {
-        for (int w = 0; w < problem_size.W; ++w) {
-          for (int c = 0; c < problem_size.C; ++c) {
-
-            ElementAccumulator acc = ElementAccumulator();
-
-            for (int t = 0; t < problem_size.T; ++t) {
-              for (int r = 0; r < problem_size.R; ++r) {
-                for (int s = 0; s < problem_size.S; ++s) {
-                  for (int k = 0; k < problem_size.K; ++k) {
-
-                    int filter_t = t;
-                    int filter_r = r;
-                    int filter_s = s;
-
-                    if (problem_size.mode == cutlass::conv::Mode::kConvolution) {
-                      filter_t = problem_size.T - 1 - t;
-                      filter_r = problem_size.R - 1 - r;
-                      filter_s = problem_size.S - 1 - s;
-                    }
+  detail::parallel_for(int64_t(problem_size.N) * problem_size.D, num_threads, [&](int64_t idx) {
+    int n = int(idx / problem_size.D);
+    int d = int(idx % problem_size.D);
+
+    for (int h = 0; h < problem_size.H; ++h) {
+      for (int w = 0; w < problem_size.W; ++w) {
+        for (int c = 0; c < problem_size.C; ++c) {
+
+          ElementAccumulator acc = ElementAccumulator();
 
-                    int z = d + problem_size.pad_d - filter_t * problem_size.dilation_d;
-                    int p = h + problem_size.pad_h - filter_r * problem_size.dilation_h;
-                    int q = w + problem_size.pad_w - filter_s * problem_size.dilation_w;
-
-                    if (z >= 0 && (z % problem_size.stride_d) == 0 &&
-                        p >= 0 && (p % problem_size.stride_h) == 0 && 
-                        q >= 0 && (q % problem_size.stride_w) == 0) {
-
-                      z = z / problem_size.stride_d;
-                      p = p / problem_size.stride_h;
-                      q = q / problem_size.stride_w;
-                      
-                      if (z < problem_size.Z && p < problem_size.P && q < problem_size.Q) {
-
-                        ElementA a = tensor_dy.at(cutlass::make_Coord(n, z, p, q, k));
-                        ElementB b = is_deconv ? tensor_w.at(cutlass::make_Coord(c, t, r, s, k))
-                            : tensor_w.at(cutlass::make_Coord(k, t, r, s, c));
-                        acc = inner_product_op(ElementAccumulator(a), ElementAccumulator(b), acc);
-                      }
+          for (int t = 0; t < problem_size.T; ++t) {
+            for (int r = 0; r < problem_size.R; ++r) {
+              for (int s = 0; s < problem_size.S; ++s) {
+                for (int k = 0; k < problem_size.K; ++k) {
+
+                  int filter_t = t;
+                  int filter_r = r;
+                  int filter_s = s;
+
+                  if (problem_size.mode == cutlass::conv::Mode::kConvolution) {
+                    filter_t = problem_size.T - 1 - t;
+                    filter_r = problem_size.R - 1 - r;
+                    filter_s = problem_size.S - 1 - s;
+                  }
+
+                  int z = d + problem_size.pad_d - filter_t * problem_size.dilation_d;
+                  int p = h + problem_size.pad_h - filter_r * problem_size.dilation_h;
+                  int q = w + problem_size.pad_w - filter_s * problem_size.dilation_w;
+
+                  if (z >= 0 && (z % problem_size.stride_d) == 0 &&
+                      p >= 0 && (p % problem_size.stride_h) == 0 && 
+                      q >= 0 && (q % problem_size.stride_w) == 0) {
+
+                    z = z / problem_size.stride_d;
+                    p = p / problem_size.stride_h;
+                    q = q / problem_size.stride_w;
+                    
+                    if (z < problem_size.Z && p < problem_size.P && q < problem_size.Q) {
+
+                      ElementA a = tensor_dy.at(cutlass::make_Coord(n, z, p, q, k));
+                      ElementB b = is_deconv ? tensor_w.at(cutlass::make_Coord(c, t, r, s, k))
+                          : tensor_w.at(cutlass::make_Coord(k, t, r, s, c));
+                      acc = inner_product_op(ElementAccumulator(a), ElementAccumulator(b), acc);
                     }
+                  }
 
-                  } // for (K)
-                } // for (S)
-              } // for (R)
-            } // for (T)
+                } // for (K)
+              } // for (S)
+            } // for (R)
+          } // for (T)
 
-            // Apply Epilogue, compute ElementCompute, convert and store ElementC
-            ElementC c_ref = ElementC();
+          // Apply Epilogue, compute ElementCompute, convert and store ElementC
+          ElementC c_ref = ElementC();
 
-            if (beta != ElementCompute()) {
-              c_ref = tensor_dx_in.at(cutlass::make_Coord(n, d, h, w, c));
-            }
+          if (beta != ElementCompute()) {
+            c_ref = tensor_dx_in.at(cutlass::make_Coord(n, d, h, w, c));
+          }
 
-            tensor_dx_out.at(cutlass::make_Coord(n, d, h, w, c)) =
-                convert_op(alpha * ElementCompute(acc) + beta * ElementCompute(c_ref));
+          tensor_dx_out.at(cutlass::make_Coord(n, d, h, w, c)) =
+              convert_op(alpha * ElementCompute(acc) + beta * ElementCompute(c_ref));
 
-          } // for (C)
-        } // for (W)
-      } // for (H)
-    } // for (D)
-  } // for (N)
+        } // for (C)
+      } // for (W)
+    } // for (H)
+  });
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -660,71 +672,73 @@ void Conv3dWgrad(
   TensorRef<ElementC, LayoutC> tensor_dw_in,
   TensorRef<ElementC, LayoutC> tensor_dw_out,
   ElementCompute alpha,
-  ElementCompute beta) {
+  ElementCompute beta,
+  int num_threads = 1) {
   
   InnerProductOp inner_product_op;
   ConvertOp convert_op;
 
   // Apply MMA and accumulate ElementAccumulator
-  for (int k = 0; k < problem_size.K; ++k) {
-    for (int t = 0; t < problem_size.T; ++t) {
-      for (int r = 0; r < problem_size.R; ++r) {
-        for (int s = 0; s < problem_size.S; ++s) {
-          for (int c = 0; c < problem_size.C; ++c) {
-
-            ElementAccumulator acc = ElementAccumulator();
-
-            for (int n = 0; n < problem_size.N; ++n) {
-              for (int z = 0; z < problem_size.Z; ++z) {
-                for (int p = 0; p < problem_size.P; ++p) {
-                  for (int q = 0; q < problem_size.Q; ++q) {
-                      
-                    int filter_t = t;     
-                    int filter_r = r;
-                    int filter_s = s; 
-
-                    if (problem_size.mode == cutlass::conv::Mode::kConvolution) {
-                      filter_t = problem_size.T - 1 - t;
-                      filter_r = problem_size.R - 1 - r;
-                      filter_s = problem_size.S - 1 - s;
-                    }
+  detail::parallel_for(int64_t(problem_size.K) * problem_size.T, num_threads, [&](int64_t idx) {
+    int k = int(idx / problem_size.T);
+    int t = int(idx % problem_size.T);
 
-                    Tensor5DCoord b_coord = make_Coord(
-                        n,
-                        z * problem_size.stride_d - problem_size.pad_d + filter_t * problem_size.dilation_d,
-                        p * problem_size.stride_h - problem_size.pad_h + filter_r * problem_size.dilation_h,
-                        q * problem_size.stride_w - problem_size.pad_w + filter_s * problem_size.dilation_w,
-                        c);
+    for (int r = 0; r < problem_size.R; ++r) {
+      for (int s = 0; s < problem_size.S; ++s) {
+        for (int c = 0; c < problem_size.C; ++c) {
 
-                    if (b_coord.d() < problem_size.D && b_coord.d() >= 0 &&
-                        b_coord.h() < problem_size.H && b_coord.h() >= 0 &&
-                        b_coord.w() < problem_size.W && b_coord.w() >= 0) {
+          ElementAccumulator acc = ElementAccumulator();
 
-                      ElementAccumulator a = ElementAccumulator(tensor_dy.at(cutlass::make_Coord(n, z, p, q, k)));
-                      ElementAccumulator b = ElementAccumulator(tensor_x.at(b_coord));
+          for (int n = 0; n < problem_size.N; ++n) {
+            for (int z = 0; z < problem_size.Z; ++z) {
+              for (int p = 0; p < problem_size.P; ++p) {
+                for (int q = 0; q < problem_size.Q; ++q) {
+                    
+                  int filter_t = t;     
+                  int filter_r = r;
+                  int filter_s = s; 
+
+                  if (problem_size.mode == cutlass::conv::Mode::kConvolution) {
+                    filter_t = problem_size.T - 1 - t;
+                    filter_r = problem_size.R - 1 - r;
+                    filter_s = problem_size.S - 1 - s;
+                  }
 
-                      acc = inner_product_op(a, b, acc);
-                    }
+                  Tensor5DCoord b_coord = make_Coord(
+                      n,
+                      z * problem_size.stride_d - problem_size.pad_d + filter_t * problem_size.dilation_d,
+                      p * problem_size.stride_h - problem_size.pad_h + filter_r * problem_size.dilation_h,
+                      q * problem_size.stride_w - problem_size.pad_w + filter_s * problem_size.dilation_w,
+                      c);
+
+                  if (b_coord.d() < problem_size.D && b_coord.d() >= 0 &&
+                      b_coord.h() < problem_size.H && b_coord.h() >= 0 &&
+                      b_coord.w() < problem_size.W && b_coord.w() >= 0) {
+
+                    ElementAccumulator a = ElementAccumulator(tensor_dy.at(cutlass::make_Coord(n, z, p, q, k)));
+                    ElementAccumulator b = ElementAccumulator(tensor_x.at(b_coord));
+
+                    acc = inner_product_op(a, b, acc);
                   }
                 }
               }
             }
+          }
 
-            // Apply Epilogue, compute ElementCompute, convert and store ElementC
-            ElementC c_ref = ElementC();
+          // Apply Epilogue, compute ElementCompute, convert and store ElementC
+          ElementC c_ref = ElementC();
 
-            if (beta != ElementCompute()) {
-              c_ref = tensor_dw_in.at(cutlass::make_Coord(k, t, r, s, c));
-            }
+          if (beta != ElementCompute()) {
+            c_ref = tensor_dw_in.at(cutlass::make_Coord(k, t, r, s, c));
+          }
 
-            tensor_dw_out.at(cutlass::make_Coord(k, t, r, s, c)) =
-                convert_op(alpha * ElementCompute(acc) + beta * ElementCompute(c_ref));
+          tensor_dw_out.at(cutlass::make_Coord(k, t, r, s, c)) =
+              convert_op(alpha * ElementCompute(acc) + beta * ElementCompute(c_ref));
 
-          } // for (C)
-        } // for (S)
-      } // for (R)
-    } // for (T)
-  } // for (K)
+        } // for (C)
+      } // for (S)
+    } // for (R)
+  });
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -750,7 +764,8 @@ void Conv3d(
   TensorRef<ElementC, LayoutC> tensor_C,
   TensorRef<ElementC, LayoutC> tensor_D,
   ElementCompute alpha,
-  ElementCompute beta) {
+  ElementCompute beta,
+  int num_threads = 1) {
 
   switch (convolutional_operator) {
   case conv::Operator::kFprop:
@@ -761,7 +776,7 @@ void Conv3d(
       ElementCompute,
       ElementAccumulator,
       ConvertOp, InnerProductOp
-    >(problem_size, tensor_A, tensor_B, tensor_C, tensor_D, alpha, beta);
+    >(problem_size, tensor_A, tensor_B, tensor_C, tensor_D, alpha, beta, num_threads);
     break;
 
   case conv::Operator::kDeconv:
@@ -773,7 +788,7 @@ void Conv3d(
       ElementCompute,
       ElementAccumulator, 
       ConvertOp, InnerProductOp
-    >(problem_size, tensor_A, tensor_B, tensor_C, tensor_D, alpha, beta, (convolutional_operator == conv::Operator::kDeconv));
+    >(problem_size, tensor_A, tensor_B, tensor_C, tensor_D, alpha, beta, (convolutional_operator == conv::Operator::kDeconv), num_threads);
     break;
 
   case conv::Operator::kWgrad:
@@ -784,7 +799,7 @@ void Conv3d(
       ElementCompute,
       ElementAccumulator, 
       ConvertOp, InnerProductOp
-    >(problem_size, tensor_A, tensor_B, tensor_C, tensor_D, alpha, beta);
+    >(problem_size, tensor_A, tensor_B, tensor_C, tensor_D, alpha, beta, num_threads);
     break;
 
   default:
@@ -43,6 +43,7 @@
 #include "cutlass/gemm/gemm.h"
 #include "cutlass/arch/mma.h"
 #include "cutlass/util/host_tensor.h"
+#include "cutlass/util/reference/host/parallel_for.h"
 
 namespace cutlass {
 namespace reference {
@@ -201,6 +202,148 @@ void compute_gemm(
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Multi-threaded variant of compute_gemm(). Output tiles are distributed over num_threads host
+/// threads (non-positive selects the hardware concurrency). Within a tile, the K dimension is
+/// walked in panels of A and B that are converted to ComputeType once and packed contiguously,
+/// so the inner loop streams through cache-resident memory regardless of the operand layouts.
+/// Products are accumulated in ascending k order with the same InnerProductOp, so results are
+/// bitwise identical to compute_gemm().
+template <
+  typename ElementA,
+  typename LayoutA,
+  typename ElementB,
+  typename LayoutB,
+  typename ElementC,
+  typename LayoutC,
+  typename ScalarType,
+  typename ComputeType,
+  typename InnerProductOp = multiply_add<ComputeType>,
+  typename ConvertOp = NumericConverter<ElementC, ScalarType>
+>
+void compute_gemm_parallel(
+  gemm::GemmCoord problem_size,
+  ScalarType alpha,
+  TensorRef<ElementA, LayoutA> tensor_a,
+  TensorRef<ElementB, LayoutB> tensor_b,
+  ScalarType beta,
+  TensorRef<ElementC, LayoutC> tensor_c,
+  TensorRef<ElementC, LayoutC> tensor_d,
+  ComputeType initial_accum,
+  int num_threads = 0) {
+
+  static_assert(
+    LayoutA::kRank == 2 &&
+    LayoutB::kRank == 2 &&
+    LayoutC::kRank == 2, "Tensors must be of rank 2");
+
+  // Note: batch is ignored.
+  int const M = problem_size.m();
+  int const N = problem_size.n();
+  int const K = problem_size.k();
+
+  int const Mblock = 16;
+  int const Nblock = 16;
+  int const Kblock = 256;
+
+  int const row_blocks = (M + Mblock - 1) / Mblock;
+  int const col_blocks = (N + Nblock - 1) / Nblock;
+
+  detail::parallel_for(int64_t(row_blocks) * col_blocks, num_threads, [&](int64_t tile_idx) {
+
+    ConvertOp convert_op;
+    InnerProductOp inner_product_op;
+
+    int const row_block = int(tile_idx / col_blocks) * Mblock;
+    int const col_block = int(tile_idx % col_blocks) * Nblock;
+    int const rows = std::min(Mblock, M - row_block);
+    int const cols = std::min(Nblock, N - col_block);
+
+    ComputeType accum[Mblock][Nblock];
+    ComputeType packed_a[Kblock][Mblock];
+    ComputeType packed_b[Kblock][Nblock];
+
+    for (int i = 0; i < Mblock; i++) {
+      for (int j = 0; j < Nblock; j++) {
+        accum[i][j] = initial_accum;
+      }
+    }
+
+    for (int k_begin = 0; k_begin < K; k_begin += Kblock) {
+      int const depth = std::min(Kblock, K - k_begin);
+
+      // Pack and convert the panels of A and B touched by this tile
+      for (int kk = 0; kk < depth; kk++) {
+        for (int i = 0; i < rows; i++) {
+          packed_a[kk][i] = cast_if_scalar<ComputeType>(
+            tensor_a.at(MatrixCoord(row_block + i, k_begin + kk)));
+        }
+        for (int j = 0; j < cols; j++) {
+          packed_b[kk][j] = cast_if_scalar<ComputeType>(
+            tensor_b.at(MatrixCoord(k_begin + kk, col_block + j)));
+        }
+      }
+
+      for (int kk = 0; kk < depth; kk++) {
+        for (int i = 0; i < rows; i++) {
+          for (int j = 0; j < cols; j++) {
+            accum[i][j] = inner_product_op(packed_a[kk][i], packed_b[kk][j], accum[i][j]);
+          }
+        }
+      }
+    }
+
+    for (int i = 0; i < rows; i++) {
+      for (int j = 0; j < cols; j++) {
+        MatrixCoord coord = MatrixCoord(row_block + i, col_block + j);
+        tensor_d.at(coord) = convert_op(
+          alpha * ScalarType(accum[i][j]) +
+          beta * ScalarType(tensor_c.at(coord)));
+      }
+    }
+  });
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Runs compute_gemm() on the calling thread if num_threads is 1, and compute_gemm_parallel()
+/// with num_threads threads otherwise (non-positive selects the hardware concurrency).
+template <
+  typename ElementA,
+  typename LayoutA,
+  typename ElementB,
+  typename LayoutB,
+  typename ElementC,
+  typename LayoutC,
+  typename ScalarType,
+  typename ComputeType,
+  typename InnerProductOp = multiply_add<ComputeType>,
+  typename ConvertOp = NumericConverter<ElementC, ScalarType>
+>
+void compute_gemm_threaded(
+  gemm::GemmCoord problem_size,
+  ScalarType alpha,
+  TensorRef<ElementA, LayoutA> tensor_a,
+  TensorRef<ElementB, LayoutB> tensor_b,
+  ScalarType beta,
+  TensorRef<ElementC, LayoutC> tensor_c,
+  TensorRef<ElementC, LayoutC> tensor_d,
+  ComputeType initial_accum,
+  int num_threads) {
+
+  if (num_threads == 1) {
+    compute_gemm<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
+                 ScalarType, ComputeType, InnerProductOp, ConvertOp>(
+        problem_size, alpha, tensor_a, tensor_b, beta, tensor_c, tensor_d, initial_accum);
+  }
+  else {
+    compute_gemm_parallel<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
+                          ScalarType, ComputeType, InnerProductOp, ConvertOp>(
+        problem_size, alpha, tensor_a, tensor_b, beta, tensor_c, tensor_d, initial_accum, num_threads);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 template <
   typename ElementA,
   typename LayoutA,
@@ -227,14 +370,15 @@ struct Gemm<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC, ScalarType,
                   TensorRef<ElementA, LayoutA> tensor_a,
                   TensorRef<ElementB, LayoutB> tensor_b, ScalarType beta,
                   TensorRef<ElementC, LayoutC> tensor_c,
-                  ComputeType initial_accum = ComputeType(0)) {
+                  ComputeType initial_accum = ComputeType(0),
+                  int num_threads = 1) {
     static_assert(
         LayoutA::kRank == 2 && LayoutB::kRank == 2 && LayoutC::kRank == 2,
         "Tensors must be of rank 2");
 
-    compute_gemm<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
-                 ScalarType, ComputeType, multiply_add<ComputeType>>(
-        problem_size, alpha, tensor_a, tensor_b, beta, tensor_c, initial_accum);
+    compute_gemm_threaded<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
+                          ScalarType, ComputeType, multiply_add<ComputeType>>(
+        problem_size, alpha, tensor_a, tensor_b, beta, tensor_c, tensor_c, initial_accum, num_threads);
   }
   
   void operator()(gemm::GemmCoord problem_size, ScalarType alpha,
@@ -242,14 +386,15 @@ struct Gemm<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC, ScalarType,
                   TensorRef<ElementB, LayoutB> tensor_b, ScalarType beta,
                   TensorRef<ElementC, LayoutC> tensor_c,
                   TensorRef<ElementC, LayoutC> tensor_d,
-                  ComputeType initial_accum = ComputeType(0)) {
+                  ComputeType initial_accum = ComputeType(0),
+                  int num_threads = 1) {
     static_assert(
         LayoutA::kRank == 2 && LayoutB::kRank == 2 && LayoutC::kRank == 2,
         "Tensors must be of rank 2");
 
-    compute_gemm<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
-                 ScalarType, ComputeType, multiply_add<ComputeType>>(
-        problem_size, alpha, tensor_a, tensor_b, beta, tensor_c, tensor_d, initial_accum);
+    compute_gemm_threaded<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
+                          ScalarType, ComputeType, multiply_add<ComputeType>>(
+        problem_size, alpha, tensor_a, tensor_b, beta, tensor_c, tensor_d, initial_accum, num_threads);
   }
 };
 
@@ -266,14 +411,15 @@ struct Gemm<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC, ScalarType,
                   TensorRef<ElementA, LayoutA> tensor_a,
                   TensorRef<ElementB, LayoutB> tensor_b, ScalarType beta,
                   TensorRef<ElementC, LayoutC> tensor_c,
-                  ComputeType initial_accum = ComputeType(0)) {
+                  ComputeType initial_accum = ComputeType(0),
+                  int num_threads = 1) {
     static_assert(
         LayoutA::kRank == 2 && LayoutB::kRank == 2 && LayoutC::kRank == 2,
         "Tensors must be of rank 2");
 
-    compute_gemm<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
-                 ScalarType, ComputeType, multiply_add<ComputeType>>(
-        problem_size, alpha, tensor_a, tensor_b, beta, tensor_c, initial_accum);
+    compute_gemm_threaded<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
+                          ScalarType, ComputeType, multiply_add<ComputeType>>(
+        problem_size, alpha, tensor_a, tensor_b, beta, tensor_c, tensor_c, initial_accum, num_threads);
   }
   
   void operator()(gemm::GemmCoord problem_size, ScalarType alpha,
@@ -281,14 +427,15 @@ struct Gemm<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC, ScalarType,
                   TensorRef<ElementB, LayoutB> tensor_b, ScalarType beta,
                   TensorRef<ElementC, LayoutC> tensor_c,
                   TensorRef<ElementC, LayoutC> tensor_d,
-                  ComputeType initial_accum = ComputeType(0)) {
+                  ComputeType initial_accum = ComputeType(0),
+                  int num_threads = 1) {
     static_assert(
         LayoutA::kRank == 2 && LayoutB::kRank == 2 && LayoutC::kRank == 2,
         "Tensors must be of rank 2");
 
-    compute_gemm<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
-                 ScalarType, ComputeType, multiply_add<ComputeType>>(
-        problem_size, alpha, tensor_a, tensor_b, beta, tensor_c, tensor_d, initial_accum);
+    compute_gemm_threaded<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
+                          ScalarType, ComputeType, multiply_add<ComputeType>>(
+        problem_size, alpha, tensor_a, tensor_b, beta, tensor_c, tensor_d, initial_accum, num_threads);
   }
 };
 
@@ -305,15 +452,16 @@ struct Gemm<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC, ScalarType,
                   TensorRef<ElementA, LayoutA> tensor_a,
                   TensorRef<ElementB, LayoutB> tensor_b, ScalarType beta,
                   TensorRef<ElementC, LayoutC> tensor_c,
-                  ComputeType initial_accum = ComputeType(0)) {
+                  ComputeType initial_accum = ComputeType(0),
+                  int num_threads = 1) {
     static_assert(
         LayoutA::kRank == 2 && LayoutB::kRank == 2 && LayoutC::kRank == 2,
         "Tensors must be of rank 2");
 
-    compute_gemm<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
-                 ScalarType, ComputeType, multiply_add<ComputeType>,
+    compute_gemm_threaded<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
+                          ScalarType, ComputeType, multiply_add<ComputeType>,
                  NumericConverterClamp<ElementC, ScalarType>>(
-        problem_size, alpha, tensor_a, tensor_b, beta, tensor_c, initial_accum);
+        problem_size, alpha, tensor_a, tensor_b, beta, tensor_c, tensor_c, initial_accum, num_threads);
   }
 
   void operator()(gemm::GemmCoord problem_size, ScalarType alpha,
@@ -321,15 +469,16 @@ struct Gemm<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC, ScalarType,
                   TensorRef<ElementB, LayoutB> tensor_b, ScalarType beta,
                   TensorRef<ElementC, LayoutC> tensor_c,
                   TensorRef<ElementC, LayoutC> tensor_d,
-                  ComputeType initial_accum = ComputeType(0)) {
+                  ComputeType initial_accum = ComputeType(0),
+                  int num_threads = 1) {
     static_assert(
         LayoutA::kRank == 2 && LayoutB::kRank == 2 && LayoutC::kRank == 2,
         "Tensors must be of rank 2");
 
-    compute_gemm<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
-                 ScalarType, ComputeType, multiply_add<ComputeType>,
+    compute_gemm_threaded<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
+                          ScalarType, ComputeType, multiply_add<ComputeType>,
                  NumericConverterClamp<ElementC, ScalarType>>(
-        problem_size, alpha, tensor_a, tensor_b, beta, tensor_c, tensor_d, initial_accum);
+        problem_size, alpha, tensor_a, tensor_b, beta, tensor_c, tensor_d, initial_accum, num_threads);
   }
 };
 
@@ -346,14 +495,15 @@ struct Gemm<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC, ScalarType,
                   TensorRef<ElementA, LayoutA> tensor_a,
                   TensorRef<ElementB, LayoutB> tensor_b, ScalarType beta,
                   TensorRef<ElementC, LayoutC> tensor_c,
-                  ComputeType initial_accum = ComputeType(0)) {
+                  ComputeType initial_accum = ComputeType(0),
+                  int num_threads = 1) {
     static_assert(
         LayoutA::kRank == 2 && LayoutB::kRank == 2 && LayoutC::kRank == 2,
         "Tensors must be of rank 2");
 
-    compute_gemm<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
-                 ScalarType, ComputeType, xor_popc_add<ComputeType>>(
-        problem_size, alpha, tensor_a, tensor_b, beta, tensor_c, initial_accum);
+    compute_gemm_threaded<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
+                          ScalarType, ComputeType, xor_popc_add<ComputeType>>(
+        problem_size, alpha, tensor_a, tensor_b, beta, tensor_c, tensor_c, initial_accum, num_threads);
   }
 
   void operator()(gemm::GemmCoord problem_size, ScalarType alpha,
@@ -361,14 +511,15 @@ struct Gemm<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC, ScalarType,
                   TensorRef<ElementB, LayoutB> tensor_b, ScalarType beta,
                   TensorRef<ElementC, LayoutC> tensor_c,
                   TensorRef<ElementC, LayoutC> tensor_d,
-                  ComputeType initial_accum = ComputeType(0)) {
+                  ComputeType initial_accum = ComputeType(0),
+                  int num_threads = 1) {
     static_assert(
         LayoutA::kRank == 2 && LayoutB::kRank == 2 && LayoutC::kRank == 2,
         "Tensors must be of rank 2");
 
-    compute_gemm<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
-                 ScalarType, ComputeType, xor_popc_add<ComputeType>>(
-        problem_size, alpha, tensor_a, tensor_b, beta, tensor_c, tensor_d, initial_accum);
+    compute_gemm_threaded<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
+                          ScalarType, ComputeType, xor_popc_add<ComputeType>>(
+        problem_size, alpha, tensor_a, tensor_b, beta, tensor_c, tensor_d, initial_accum, num_threads);
   }
 };
 
@@ -383,14 +534,15 @@ struct Gemm<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC, ScalarType,
                   TensorRef<ElementA, LayoutA> tensor_a,
                   TensorRef<ElementB, LayoutB> tensor_b, ScalarType beta,
                   TensorRef<ElementC, LayoutC> tensor_c,
-                  ComputeType initial_accum = ComputeType(0)) {
+                  ComputeType initial_accum = ComputeType(0),
+                  int num_threads = 1) {
     static_assert(
         LayoutA::kRank == 2 && LayoutB::kRank == 2 && LayoutC::kRank == 2,
         "Tensors must be of rank 2");
 
-    compute_gemm<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
-                 ScalarType, ComputeType, and_popc_add<ComputeType>>(
-        problem_size, alpha, tensor_a, tensor_b, beta, tensor_c, initial_accum);
+    compute_gemm_threaded<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
+                          ScalarType, ComputeType, and_popc_add<ComputeType>>(
+        problem_size, alpha, tensor_a, tensor_b, beta, tensor_c, tensor_c, initial_accum, num_threads);
   }
 
   void operator()(gemm::GemmCoord problem_size, ScalarType alpha,
@@ -398,14 +550,15 @@ struct Gemm<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC, ScalarType,
                   TensorRef<ElementB, LayoutB> tensor_b, ScalarType beta,
                   TensorRef<ElementC, LayoutC> tensor_c,
                   TensorRef<ElementC, LayoutC> tensor_d,
-                  ComputeType initial_accum = ComputeType(0)) {
+                  ComputeType initial_accum = ComputeType(0),
+                  int num_threads = 1) {
     static_assert(
         LayoutA::kRank == 2 && LayoutB::kRank == 2 && LayoutC::kRank == 2,
         "Tensors must be of rank 2");
 
-    compute_gemm<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
-                 ScalarType, ComputeType, and_popc_add<ComputeType>>(
-        problem_size, alpha, tensor_a, tensor_b, beta, tensor_c, tensor_d, initial_accum);
+    compute_gemm_threaded<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
+                          ScalarType, ComputeType, and_popc_add<ComputeType>>(
+        problem_size, alpha, tensor_a, tensor_b, beta, tensor_c, tensor_d, initial_accum, num_threads);
   }
 };
 
@@ -422,14 +575,15 @@ struct Gemm<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC, ScalarType,
                   TensorRef<ElementA, LayoutA> tensor_a,
                   TensorRef<ElementB, LayoutB> tensor_b, ScalarType beta,
                   TensorRef<ElementC, LayoutC> tensor_c,
-                  ComputeType initial_accum = ComputeType(0)) {
+                  ComputeType initial_accum = ComputeType(0),
+                  int num_threads = 1) {
     static_assert(
         LayoutA::kRank == 2 && LayoutB::kRank == 2 && LayoutC::kRank == 2,
         "Tensors must be of rank 2");
 
-    compute_gemm<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
-                 ScalarType, ComputeType, multiply_add<ComputeType>>(
-        problem_size, alpha, tensor_a, tensor_b, beta, tensor_c, initial_accum);
+    compute_gemm_threaded<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
+                          ScalarType, ComputeType, multiply_add<ComputeType>>(
+        problem_size, alpha, tensor_a, tensor_b, beta, tensor_c, tensor_c, initial_accum, num_threads);
   }
   
   void operator()(gemm::GemmCoord problem_size, ScalarType alpha,
@@ -437,14 +591,15 @@ struct Gemm<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC, ScalarType,
                   TensorRef<ElementB, LayoutB> tensor_b, ScalarType beta,
                   TensorRef<ElementC, LayoutC> tensor_c,
                   TensorRef<ElementC, LayoutC> tensor_d,
-                  ComputeType initial_accum = ComputeType(0)) {
+                  ComputeType initial_accum = ComputeType(0),
+                  int num_threads = 1) {
     static_assert(
         LayoutA::kRank == 2 && LayoutB::kRank == 2 && LayoutC::kRank == 2,
         "Tensors must be of rank 2");
 
-    compute_gemm<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
-                 ScalarType, ComputeType, multiply_add<ComputeType>>(
-        problem_size, alpha, tensor_a, tensor_b, beta, tensor_c, tensor_d, initial_accum);
+    compute_gemm_threaded<ElementA, LayoutA, ElementB, LayoutB, ElementC, LayoutC,
+                          ScalarType, ComputeType, multiply_add<ComputeType>>(
+        problem_size, alpha, tensor_a, tensor_b, beta, tensor_c, tensor_d, initial_accum, num_threads);
   }
 };
 
@@ -650,7 +650,8 @@ void gett_epilogue(
 
   constexpr bool IsBackpropFusion =
       cute::is_same_v<ActivationFunctor, cutlass::epilogue::thread::dGELU<ElementCompute>> or
-      cute::is_same_v<ActivationFunctor, cutlass::epilogue::thread::dReLU<ElementCompute>>;
+      cute::is_same_v<ActivationFunctor, cutlass::epilogue::thread::dReLU<ElementCompute>> or
+      cute::is_same_v<ActivationFunctor, cutlass::epilogue::thread::dSiLU<ElementCompute>>;
 
   // Input related converter
   NumericConverter<ElementCompute, ElementAccumulator> accumulator_converter;
@@ -699,6 +700,12 @@ void gett_epilogue(
 
   ElementCompute inter_accum[kBlockM][kBlockN];
 
+  // Per-column dBias partial sums of this block
+  [[maybe_unused]] ElementCompute local_col_dBias[kBlockN];
+  for (int n_b = 0; n_b < kBlockN; ++n_b) {
+    local_col_dBias[n_b] = ElementCompute(0);
+  }
+
   for (int m_b = 0; m_b < kBlockM; ++m_b) {
     ElementCompute local_dBias = ElementCompute(0);
 
@@ -735,7 +742,12 @@ void gett_epilogue(
           }
 
           output = activation(output, aux_source_converter(aux_input));
-          local_dBias = add(local_dBias, output);
+          if constexpr (PerColBias) {
+            local_col_dBias[n_b] = add(local_col_dBias[n_b], output);
+          }
+          else {
+            local_dBias = add(local_dBias, output);
+          }
         }
         else {
           if (raw_pointer_cast(epilogue_params.Aux.data())) {
@@ -773,13 +785,24 @@ void gett_epilogue(
     } // n_b
 
     if (m + m_b < cute::size<0>(epilogue_params.D.layout()) && n < cute::size<1>(epilogue_params.D.layout())) {
-      if (raw_pointer_cast(epilogue_params.Bias.data()) && IsBackpropFusion) {
+      if (raw_pointer_cast(epilogue_params.Bias.data()) && IsBackpropFusion && not PerColBias) {
         ElementCompute converted_dBias = bias_converter(epilogue_params.Bias(m + m_b));
         local_dBias = add(local_dBias, converted_dBias);
         epilogue_params.Bias(m + m_b) = dBias_converter(local_dBias);
       }
     }
   } // m_b
+
+  if constexpr (IsBackpropFusion && PerColBias) {
+    if (raw_pointer_cast(epilogue_params.Bias.data()) && m < cute::size<0>(epilogue_params.D.layout())) {
+      for (int n_b = 0; n_b < kBlockN; ++n_b) {
+        if (n + n_b < cute::size<1>(epilogue_params.D.layout())) {
+          ElementCompute converted_dBias = bias_converter(epilogue_params.Bias(n + n_b));
+          epilogue_params.Bias(n + n_b) = dBias_converter(add(local_col_dBias[n_b], converted_dBias));
+        }
+      }
+    }
+  }
   
   if constexpr (
                 SfGenStrategy == SfStrategy::SfDGen
@@ -35,10 +35,12 @@
 #pragma once
 
 // Standard Library includes
+#include <type_traits>
 #include <utility>
 
 // Cutlass includes
 #include "cutlass/cutlass.h"
+#include "cutlass/numeric_conversion.h"
 #include "tensor_foreach.h"
 
 namespace cutlass {
@@ -205,6 +207,18 @@ void TensorCopy(
   TensorView<DstElement, DstLayout> dst,
   TensorView<SrcElement, SrcLayout> src) {
 
+  // Packed tensors of identical shape and layout convert as one contiguous array, using the
+  // vectorized host conversions where they exist for the element types.
+  if constexpr (std::is_same_v<DstLayout, SrcLayout> &&
+                cutlass::detail::HostBulkConverter<
+                  DstElement, SrcElement, FloatRoundStyle::round_to_nearest>::kSupported) {
+    if (dst.extent() == src.extent() && dst.stride() == src.stride() &&
+        dst.capacity() == size_t(dst.extent().product())) {
+      host_numeric_array_convert<DstElement, SrcElement>(dst.data(), src.data(), dst.capacity());
+      return;
+    }
+  }
+
   detail::TrivialConvert<DstElement, SrcElement> convert;
 
   TensorCopy(dst, src, convert);
@@ -0,0 +1,404 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+**************************************************************************************************/
+/*! \file
+    \brief Binary tensor I/O in the NumPy .npy format, with memory-mapped loading.
+
+    Files hold a short text header followed by the raw storage of the tensor, so multi-GB operands
+    are written with one fwrite() and loaded without parsing. Element types without a NumPy dtype
+    (bfloat16, float8, ...) are written as raw void records of the same width ('|V2', '|V1').
+*/
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define CUTLASS_NPY_MMAP_ENABLED 1
+#endif
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/tensor_view.h"
+#include "cutlass/layout/matrix.h"
+#include "cutlass/layout/tensor.h"
+
+namespace cutlass {
+namespace npy {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NumPy dtype descriptor of an element type. Storage is assumed to be little-endian.
+template <typename T>
+struct Descr {
+  static std::string value() {
+    return "|V" + std::to_string(sizeof(T));
+  }
+};
+
+#define CUTLASS_NPY_DESCR(T, str)                   \
+  template <> struct Descr<T> {                     \
+    static std::string value() { return str; }      \
+  };
+
+CUTLASS_NPY_DESCR(float, "<f4")
+CUTLASS_NPY_DESCR(double, "<f8")
+CUTLASS_NPY_DESCR(cutlass::half_t, "<f2")
+CUTLASS_NPY_DESCR(int8_t, "|i1")
+CUTLASS_NPY_DESCR(uint8_t, "|u1")
+CUTLASS_NPY_DESCR(int16_t, "<i2")
+CUTLASS_NPY_DESCR(uint16_t, "<u2")
+CUTLASS_NPY_DESCR(int32_t, "<i4")
+CUTLASS_NPY_DESCR(uint32_t, "<u4")
+CUTLASS_NPY_DESCR(int64_t, "<i8")
+CUTLASS_NPY_DESCR(uint64_t, "<u8")
+
+#undef CUTLASS_NPY_DESCR
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Writes raw storage as a version 1.0 .npy file. Throws std::runtime_error on failure.
+inline void write(
+  std::string const &path,
+  std::string const &descr,
+  std::vector<int64_t> const &shape,
+  bool fortran_order,
+  void const *data,
+  size_t bytes) {
+
+  std::stringstream dict;
+  dict << "{'descr': '" << descr << "', 'fortran_order': " << (fortran_order ? "True" : "False")
+       << ", 'shape': (";
+  for (size_t i = 0; i < shape.size(); ++i) {
+    dict << shape[i] << ((shape.size() == 1 || i + 1 < shape.size()) ? "," : "");
+    if (i + 1 < shape.size()) {
+      dict << " ";
+    }
+  }
+  dict << "), }";
+
+  // Magic, version and header length take 10 bytes; the header is padded so data is 64B aligned
+  std::string header = dict.str();
+  size_t total = 10 + header.size() + 1;
+  header.append((64 - total % 64) % 64, ' ');
+  header.push_back('\n');
+
+  if (header.size() > 0xffff) {
+    throw std::runtime_error("npy header too large for " + path);
+  }
+
+  FILE *file = std::fopen(path.c_str(), "wb");
+  if (!file) {
+    throw std::runtime_error("Failed to open " + path + " for writing");
+  }
+
+  unsigned char preamble[10] = {0x93, 'N', 'U', 'M', 'P', 'Y', 1, 0,
+                                uint8_t(header.size() & 0xff), uint8_t(header.size() >> 8)};
+
+  bool ok = std::fwrite(preamble, 1, sizeof(preamble), file) == sizeof(preamble) &&
+            std::fwrite(header.data(), 1, header.size(), file) == header.size() &&
+            (bytes == 0 || std::fwrite(data, 1, bytes, file) == bytes);
+
+  ok = (std::fclose(file) == 0) && ok;
+
+  if (!ok) {
+    throw std::runtime_error("Failed to write " + path);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Read-only .npy file. The payload is memory-mapped where the platform supports it, so loading
+/// a large operand costs only the page faults of the bytes actually consumed.
+class MappedFile {
+public:
+
+  explicit MappedFile(std::string const &path) {
+#if defined(CUTLASS_NPY_MMAP_ENABLED)
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw std::runtime_error("Failed to open " + path);
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+      ::close(fd);
+      throw std::runtime_error("Failed to stat " + path);
+    }
+    file_bytes_ = size_t(st.st_size);
+    if (file_bytes_) {
+      void *ptr = ::mmap(nullptr, file_bytes_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (ptr == MAP_FAILED) {
+        ::close(fd);
+        throw std::runtime_error("Failed to map " + path);
+      }
+      base_ = static_cast<char const *>(ptr);
+    }
+    ::close(fd);
+#else
+    FILE *file = std::fopen(path.c_str(), "rb");
+    if (!file) {
+      throw std::runtime_error("Failed to open " + path);
+    }
+    std::fseek(file, 0, SEEK_END);
+    buffer_.resize(size_t(std::ftell(file)));
+    std::fseek(file, 0, SEEK_SET);
+    size_t read = std::fread(buffer_.data(), 1, buffer_.size(), file);
+    std::fclose(file);
+    if (read != buffer_.size()) {
+      throw std::runtime_error("Failed to read " + path);
+    }
+    base_ = buffer_.data();
+    file_bytes_ = buffer_.size();
+#endif
+
+    try {
+      parse_header(path);
+    }
+    catch (...) {
+      release();
+      throw;
+    }
+  }
+
+  MappedFile(MappedFile const &) = delete;
+  MappedFile &operator=(MappedFile const &) = delete;
+
+  ~MappedFile() {
+    release();
+  }
+
+  std::string const &descr() const { return descr_; }
+  bool fortran_order() const { return fortran_order_; }
+  std::vector<int64_t> const &shape() const { return shape_; }
+
+  /// Pointer to the tensor storage following the header
+  void const *data() const { return base_ + data_offset_; }
+
+  /// Size of the tensor storage in bytes
+  size_t bytes() const { return file_bytes_ - data_offset_; }
+
+private:
+
+  void release() {
+#if defined(CUTLASS_NPY_MMAP_ENABLED)
+    if (base_) {
+      ::munmap(const_cast<char *>(base_), file_bytes_);
+    }
+#endif
+    base_ = nullptr;
+  }
+
+  void parse_header(std::string const &path) {
+    if (file_bytes_ < 10 || std::memcmp(base_, "\x93NUMPY", 6) != 0) {
+      throw std::runtime_error(path + " is not an npy file");
+    }
+
+    int major = static_cast<unsigned char>(base_[6]);
+    size_t header_bytes = 0;
+    size_t preamble_bytes = 0;
+    if (major == 1) {
+      header_bytes = size_t(uint8_t(base_[8])) | (size_t(uint8_t(base_[9])) << 8);
+      preamble_bytes = 10;
+    }
+    else if (major == 2 || major == 3) {
+      if (file_bytes_ < 12) {
+        throw std::runtime_error(path + " has a truncated npy header");
+      }
+      for (int i = 0; i < 4; ++i) {
+        header_bytes |= size_t(uint8_t(base_[8 + i])) << (8 * i);
+      }
+      preamble_bytes = 12;
+    }
+    else {
+      throw std::runtime_error(path + " has an unsupported npy version");
+    }
+
+    data_offset_ = preamble_bytes + header_bytes;
+    if (data_offset_ > file_bytes_) {
+      throw std::runtime_error(path + " has a truncated npy header");
+    }
+
+    std::string header(base_ + preamble_bytes, header_bytes);
+
+    descr_ = dict_value(header, "descr");
+    if (descr_.size() >= 2 && (descr_.front() == '\'' || descr_.front() == '"')) {
+      descr_ = descr_.substr(1, descr_.size() - 2);
+    }
+    fortran_order_ = dict_value(header, "fortran_order") == "True";
+
+    std::string shape = dict_value(header, "shape");
+    shape_.clear();
+    std::string token;
+    for (char c : shape) {
+      if (c >= '0' && c <= '9') {
+        token.push_back(c);
+      }
+      else if (!token.empty()) {
+        shape_.push_back(std::stoll(token));
+        token.clear();
+      }
+    }
+  }
+
+  /// Extracts the text of a value from the header's Python dict literal
+  static std::string dict_value(std::string const &header, std::string const &key) {
+    size_t pos = header.find("'" + key + "'");
+    if (pos == std::string::npos) {
+      throw std::runtime_error("npy header is missing '" + key + "'");
+    }
+    pos = header.find(':', pos);
+    size_t begin = header.find_first_not_of(' ', pos + 1);
+    size_t end = begin;
+    if (header[begin] == '(') {
+      end = header.find(')', begin) + 1;
+    }
+    else {
+      end = header.find_first_of(",}", begin);
+    }
+    std::string value = header.substr(begin, end - begin);
+    value.erase(value.find_last_not_of(' ') + 1);
+    return value;
+  }
+
+  char const *base_ = nullptr;
+  size_t file_bytes_ = 0;
+  size_t data_offset_ = 0;
+  std::string descr_;
+  bool fortran_order_ = false;
+  std::vector<int64_t> shape_;
+
+#if !defined(CUTLASS_NPY_MMAP_ENABLED)
+  std::vector<char> buffer_;
+#endif
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+/// Shape and storage order of a packed tensor. Layouts whose storage order is not a plain
+/// row- or column-major ordering of the extent are written as a flat array.
+template <typename Layout>
+struct LayoutShape {
+  template <typename Extent>
+  static std::vector<int64_t> shape(Extent const &, size_t capacity) {
+    return {int64_t(capacity)};
+  }
+  static bool const kFortranOrder = false;
+};
+
+template <bool FortranOrder>
+struct ExtentShape {
+  template <typename Extent>
+  static std::vector<int64_t> shape(Extent const &extent, size_t) {
+    std::vector<int64_t> result;
+    for (int i = 0; i < Extent::kRank; ++i) {
+      result.push_back(extent[i]);
+    }
+    return result;
+  }
+  static bool const kFortranOrder = FortranOrder;
+};
+
+template <> struct LayoutShape<layout::RowMajor> : ExtentShape<false> {};
+template <> struct LayoutShape<layout::ColumnMajor> : ExtentShape<true> {};
+template <> struct LayoutShape<layout::TensorNHWC> : ExtentShape<false> {};
+template <> struct LayoutShape<layout::TensorNDHWC> : ExtentShape<false> {};
+
+} // namespace detail
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace npy
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Writes a packed host TensorView to an .npy file. Sub-byte elements are written as their packed
+/// bytes ('|u1').
+template <typename Element, typename Layout>
+void TensorViewWriteNpy(std::string const &path, TensorView<Element, Layout> const &view) {
+
+  size_t capacity = view.capacity();
+  if (capacity != size_t(view.extent().product())) {
+    throw std::runtime_error("TensorViewWriteNpy() requires a packed tensor");
+  }
+
+  size_t bytes = (capacity * sizeof_bits<Element>::value + 7) / 8;
+
+  if constexpr (sizeof_bits<Element>::value < 8) {
+    npy::write(path, "|u1", {int64_t(bytes)}, false, view.data(), bytes);
+  }
+  else {
+    npy::write(
+      path,
+      npy::Descr<Element>::value(),
+      npy::detail::LayoutShape<Layout>::shape(view.extent(), capacity),
+      npy::detail::LayoutShape<Layout>::kFortranOrder,
+      view.data(),
+      bytes);
+  }
+}
+
+/// Loads an .npy file into a packed host TensorView. The file must hold exactly the view's
+/// storage; the element dtype is checked for types with a NumPy equivalent.
+template <typename Element, typename Layout>
+void TensorViewReadNpy(std::string const &path, TensorView<Element, Layout> view) {
+
+  npy::MappedFile file(path);
+
+  size_t bytes = (view.capacity() * sizeof_bits<Element>::value + 7) / 8;
+  if (file.bytes() != bytes) {
+    throw std::runtime_error(path + " holds " + std::to_string(file.bytes()) +
+                             " bytes, expected " + std::to_string(bytes));
+  }
+
+  if constexpr (sizeof_bits<Element>::value >= 8) {
+    bool is_raw = file.descr().size() > 1 && file.descr()[1] == 'V';
+    if (!is_raw && file.descr() != npy::Descr<Element>::value()) {
+      throw std::runtime_error(path + " has dtype '" + file.descr() + "', expected '" +
+                               npy::Descr<Element>::value() + "'");
+    }
+  }
+
+  std::memcpy(view.data(), file.data(), bytes);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass